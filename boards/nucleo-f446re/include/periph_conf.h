@@ -49,6 +49,8 @@ static const dma_conf_t dma_config[] = {
     { .stream = 3 },    /* DMA1 Stream 3 - SPI2_RX */
     { .stream = 5 },    /* DMA1 Stream 5 - SPI3_TX */
     { .stream = 0 },    /* DMA1 Stream 0 - SPI3_RX */
+    { .stream = 13 },   /* DMA2 Stream 5 - USART1_RX */
+    { .stream = 12 },   /* DMA2 Stream 4 - ADC1 */
 };
 
 #define DMA_0_ISR           isr_dma2_stream3
@@ -57,6 +59,8 @@ static const dma_conf_t dma_config[] = {
 #define DMA_3_ISR           isr_dma1_stream3
 #define DMA_4_ISR           isr_dma1_stream5
 #define DMA_5_ISR           isr_dma1_stream0
+#define DMA_6_ISR           isr_dma2_stream5
+#define DMA_7_ISR           isr_dma2_stream4
 
 #define DMA_NUMOF           ARRAY_SIZE(dma_config)
 /** @} */
@@ -78,6 +82,10 @@ static const uart_conf_t uart_config[] = {
 #ifdef MODULE_PERIPH_DMA
         .dma        = DMA_STREAM_UNDEF,
         .dma_chan   = UINT8_MAX,
+#endif
+#ifdef MODULE_PERIPH_UART_RX_DMA
+        .rx_dma     = DMA_STREAM_UNDEF,
+        .rx_dma_chan = UINT8_MAX,
 #endif
     },
     {
@@ -92,6 +100,10 @@ static const uart_conf_t uart_config[] = {
 #ifdef MODULE_PERIPH_DMA
         .dma        = DMA_STREAM_UNDEF,
         .dma_chan   = UINT8_MAX,
+#endif
+#ifdef MODULE_PERIPH_UART_RX_DMA
+        .rx_dma     = 6,
+        .rx_dma_chan = 4,
 #endif
     },
     {
@@ -106,6 +118,10 @@ static const uart_conf_t uart_config[] = {
 #ifdef MODULE_PERIPH_DMA
         .dma        = DMA_STREAM_UNDEF,
         .dma_chan   = UINT8_MAX,
+#endif
+#ifdef MODULE_PERIPH_UART_RX_DMA
+        .rx_dma     = DMA_STREAM_UNDEF,
+        .rx_dma_chan = UINT8_MAX,
 #endif
     },
 };
@@ -269,6 +285,19 @@ static const adc_conf_t adc_config[] = {
 
 #define VBAT_ADC            ADC_LINE(6) /**< VBAT ADC line */
 #define ADC_NUMOF           ARRAY_SIZE(adc_config)
+
+/**
+ * @brief   Continuous sampling on ADC1, triggered by TIM1 CC1
+ */
+static const adc_continuous_conf_t adc_continuous_config = {
+    .tim      = TIM1,
+    .rcc_mask = RCC_APB2ENR_TIM1EN,
+    .bus      = APB2,
+    .adc      = 0,
+    .extsel   = 0,      /* TIM1_CC1 */
+    .dma      = 7,
+    .dma_chan = 0,
+};
 /** @} */
 
 #ifdef __cplusplus
@@ -52,6 +52,13 @@ void cond_wait(cond_t *cond, mutex_t *mutex)
 
 static void _cond_signal(cond_t *cond, bool broadcast)
 {
+    /* Waiters enqueue themselves with IRQs disabled, usually while the
+     * signalling thread is locked out by the mutex. Without waiters there is
+     * nothing to do. */
+    if (!__atomic_load_n(&cond->queue.next, __ATOMIC_RELAXED)) {
+        return;
+    }
+
     unsigned irqstate = irq_disable();
     list_node_t *next;
 
@@ -22,6 +22,7 @@
 #ifndef MBOX_H
 #define MBOX_H
 
+#include "kernel_defines.h"
 #include "list.h"
 #include "cib.h"
 #include "msg.h"
@@ -32,7 +33,7 @@ extern "C" {
 
 /** Static initializer for mbox objects */
 #define MBOX_INIT(queue, queue_size) { \
-        { 0 }, { 0 }, CIB_INIT(queue_size), queue \
+        .cib = CIB_INIT(queue_size), .msg_array = queue \
 }
 
 /**
@@ -43,6 +44,13 @@ typedef struct {
     list_node_t writers;    /**< list of threads waiting to send        */
     cib_t cib;              /**< cib for msg array                      */
     msg_t *msg_array;       /**< ptr to array of msg queue              */
+#if IS_USED(MODULE_CORE_THREAD_FLAGS) || defined(DOXYGEN)
+    /**
+     * @brief   Thread to set @ref THREAD_FLAG_MBOX on when a message is
+     *          queued, may be NULL
+     */
+    struct _thread *notify;
+#endif
 } mbox_t;
 
 enum {
@@ -158,6 +158,19 @@
  * }
  * ~~~~~~~~~~~~~~~~~~~~~~~~
  *
+ * Lock-free message queues
+ * ------------------------
+ * By default, putting a message into a thread's message queue happens with
+ * IRQs disabled. With the module `core_msg_lockfree`, senders instead reserve
+ * a queue slot with an atomic compare-and-swap and only disable IRQs if the
+ * receiver has to be woken up. This keeps interrupt latency low when many
+ * threads and ISRs send to a mostly busy receiver. It requires hardware
+ * support for atomic compare-and-swap to be of any benefit (e.g. ARMv7-M and
+ * ARMv8-M mainline, but not ARMv6-M). Message reception still disables IRQs.
+ *
+ * @note    With `core_msg_lockfree` @ref msg_avail() also counts messages that
+ *          are currently being written to the queue.
+ *
  * Timing & messages
  * =================
  * Timing out the reception of a message or sending messages at a certain time
@@ -281,6 +294,43 @@ int msg_send_to_self(msg_t *m);
  */
 int msg_send_int(msg_t *m, kernel_pid_t target_pid);
 
+/**
+ * @brief Send several messages at once (non-blocking).
+ *
+ * Delivers as many of the @p n messages in @p m as possible to @p target_pid
+ * within a single critical section: the first one directly, if the receiver
+ * is waiting, the following ones to its message queue. The receiver is woken
+ * up at most once. This function never blocks and can also be called from
+ * interrupt context.
+ *
+ * @param[in] m             Array of @p n preallocated ``msg_t`` structures,
+ *                          must not be NULL.
+ * @param[in] n             Number of messages in @p m.
+ * @param[in] target_pid    PID of target thread.
+ *
+ * @return  Number of messages delivered (from the start of @p m). Less than
+ *          @p n, if the receiver's message queue ran full.
+ * @return  -1, on error (invalid PID)
+ */
+int msg_send_bulk(msg_t *m, unsigned n, kernel_pid_t target_pid);
+
+/**
+ * @brief Send a message to several threads at once (non-blocking).
+ *
+ * Delivers @p m to each of the @p n threads in @p targets within a single
+ * critical section, like @ref msg_try_send() would: a thread that is not
+ * waiting and has a full message queue (or none) does not get the message.
+ * This function never blocks and can also be called from interrupt context.
+ *
+ * @param[in] m             Pointer to preallocated ``msg_t`` structure, must
+ *                          not be NULL.
+ * @param[in] targets       Array of @p n PIDs of target threads.
+ * @param[in] n             Number of PIDs in @p targets.
+ *
+ * @return  Number of threads the message was delivered to.
+ */
+int msg_send_multicast(msg_t *m, const kernel_pid_t *targets, unsigned n);
+
 /**
  * @brief Test if the message was sent inside an ISR.
  * @see msg_send_int()
@@ -318,6 +368,23 @@ int msg_receive(msg_t *m);
  */
 int msg_try_receive(msg_t *m);
 
+/**
+ * @brief Receive several messages at once.
+ *
+ * Blocks until at least one message was received, then takes up to @p n - 1
+ * further messages from the thread's message queue within the same critical
+ * section.
+ *
+ * @pre     `n > 0`
+ *
+ * @param[out] m    Array of @p n preallocated ``msg_t`` structures, must not
+ *                  be NULL.
+ * @param[in] n     Maximum number of messages to receive.
+ *
+ * @return  Number of messages received (at least 1).
+ */
+int msg_receive_bulk(msg_t *m, unsigned n);
+
 /**
  * @brief Send a message, block until reply received.
  *
@@ -330,6 +397,13 @@ int msg_try_receive(msg_t *m);
  * rejected (if sent with @ref msg_try_send or from an interrupt) -- just like
  * if the thread were blocked on anything different than message reception.
  *
+ * With the module `core_msg_priority_inheritance`, a target with a lower
+ * priority than the calling thread runs with the priority of the calling
+ * thread until it replies with @ref msg_reply(). Do not combine this with
+ * replies from ISRs via @ref msg_reply_int(), they do not end the inheritance.
+ * If the target itself waits for a mutex or a reply, the priority is passed on
+ * along the chain of blocked threads, see @ref sched_inherit_priority().
+ *
  * @pre     @p target_pid is not the PID of the current thread.
  *
  * @param[in] m             Pointer to preallocated ``msg_t`` structure with
@@ -29,6 +29,14 @@
  *              If you want to check if a message was sent directly (not
  *              over a bus, you can use the @ref msg_is_from_bus function.
  *
+ *              Posting a message checks every subscriber of the bus. With
+ *              the module `core_msg_bus_index`, the first
+ *              @ref MSG_BUS_INDEX_SLOTS subscribers of a bus are instead
+ *              indexed by the event types they subscribed to, so posting
+ *              only visits the interested ones. This takes
+ *              @ref MSG_BUS_INDEX_SLOTS pointers and 32 words of memory per
+ *              bus.
+ *
  *              @note Make sure to unsubscribe from all previously subscribed
  *              buses before terminating a thread.
  *
@@ -41,6 +49,7 @@
 #include <assert.h>
 #include <stdint.h>
 
+#include "irq.h"
 #include "list.h"
 #include "msg.h"
 
@@ -48,11 +57,28 @@
 extern "C" {
 #endif
 
+/**
+ * @brief Number of subscribers of a bus indexed by module
+ *        `core_msg_bus_index`, further subscribers are kept in a list
+ */
+#define MSG_BUS_INDEX_SLOTS (8 * sizeof(unsigned))
+
 /**
  * @brief A message bus is just a list of subscribers.
  */
 typedef struct {
     list_node_t subs;       /**< List of subscribers to the bus */
+#if IS_USED(MODULE_CORE_MSG_BUS_INDEX) || defined(DOXYGEN)
+    /**
+     * @brief Indexed subscribers
+     */
+    struct msg_bus_entry *slots[MSG_BUS_INDEX_SLOTS];
+    /**
+     * @brief Bitmask of the @ref msg_bus_t::slots subscribed to each
+     *        event type
+     */
+    unsigned event_slots[32];
+#endif
     uint16_t id;            /**< Message Bus ID */
 } msg_bus_t;
 
@@ -60,10 +86,15 @@ typedef struct {
  * @brief Message bus subscriber entry.
  *        Should not be modified by the user.
  */
-typedef struct {
+typedef struct msg_bus_entry {
     list_node_t next;       /**< next subscriber */
     uint32_t event_mask;    /**< Bitmask of event classes */
     kernel_pid_t pid;       /**< Subscriber PID */
+#if IS_USED(MODULE_CORE_MSG_BUS_INDEX) || defined(DOXYGEN)
+    msg_bus_t *bus;         /**< Bus the entry is attached to */
+    uint8_t slot;           /**< Index in @ref msg_bus_t::slots,
+                                 @ref MSG_BUS_INDEX_SLOTS if not indexed */
+#endif
 } msg_bus_entry_t;
 
 /**
@@ -200,6 +231,13 @@ static inline void msg_bus_subscribe(msg_bus_entry_t *entry, uint8_t type)
 {
     assert(type < 32);
     entry->event_mask |= (1UL << type);
+#if IS_USED(MODULE_CORE_MSG_BUS_INDEX)
+    if (entry->slot < MSG_BUS_INDEX_SLOTS) {
+        unsigned state = irq_disable();
+        entry->bus->event_slots[type] |= (1U << entry->slot);
+        irq_restore(state);
+    }
+#endif
 }
 
 /**
@@ -214,6 +252,13 @@ static inline void msg_bus_unsubscribe(msg_bus_entry_t *entry, uint8_t type)
 {
     assert(type < 32);
     entry->event_mask &= ~(1UL << type);
+#if IS_USED(MODULE_CORE_MSG_BUS_INDEX)
+    if (entry->slot < MSG_BUS_INDEX_SLOTS) {
+        unsigned state = irq_disable();
+        entry->bus->event_slots[type] &= ~(1U << entry->slot);
+        irq_restore(state);
+    }
+#endif
 }
 
 /**
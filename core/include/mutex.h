@@ -97,6 +97,27 @@
  *       `MUTEX_LOCK`.
  *     - The scheduler is run, so that if the unblocked waiting thread can
  *       run now, in case it has a higher priority than the running thread.
+ *
+ * Unlocking without Hand-Over
+ * ---------------------------
+ *
+ * By default the mutex is handed over to the unblocked thread in case 3)
+ * above: it stays locked and is owned by the woken up thread, even if that
+ * thread does not get scheduled right away. If the running thread wants to
+ * enter the critical section again before that, it has to block, which
+ * causes two context switches per critical section for threads of the same
+ * priority (lock convoy).
+ *
+ * With module `core_mutex_no_handoff` the mutex is unlocked instead if the
+ * woken up thread was the last waiter. That thread tries to obtain the mutex
+ * again once it is scheduled and blocks again if it was taken in between.
+ * Threads with a higher priority than the unlocking thread are scheduled
+ * right away and still get the mutex. If more than one thread is waiting,
+ * the mutex is handed over as usual.
+ *
+ * @note    RIOT runs all threads on a single core, so there is no point in
+ *          spinning on a locked mutex before blocking: the owner cannot
+ *          release it until the spinning thread blocks.
  * @{
  *
  * @file
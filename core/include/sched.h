@@ -189,6 +189,10 @@ typedef enum {
 /**
  * @def SCHED_PRIO_LEVELS
  * @brief The number of thread priority levels
+ *
+ * Up to 32 priority levels are tracked in a single bitmap word. Up to 128
+ * levels are supported by adding a second bitmap level, so that finding the
+ * next thread to run still takes constant time.
  */
 #ifndef SCHED_PRIO_LEVELS
 #define SCHED_PRIO_LEVELS 16
@@ -270,6 +274,34 @@ NORETURN void sched_task_exit(void);
  */
 void sched_change_priority(thread_t *thread, uint8_t priority);
 
+#if defined(MODULE_CORE_MUTEX_PRIORITY_INHERITANCE) || \
+    defined(MODULE_CORE_MSG_PRIORITY_INHERITANCE) || defined(DOXYGEN)
+/**
+ * @brief   Maximum number of threads a priority is passed on to by
+ *          @ref sched_inherit_priority
+ */
+#ifndef CONFIG_SCHED_PRIORITY_INHERITANCE_DEPTH
+#define CONFIG_SCHED_PRIORITY_INHERITANCE_DEPTH     4
+#endif
+
+/**
+ * @brief   Lend @p priority to @p thread and to the threads it is waiting for
+ *
+ * If @p thread waits for a mutex (module `core_mutex_priority_inheritance`)
+ * or for the reply to @ref msg_send_receive (module
+ * `core_msg_priority_inheritance`), the owner of the mutex or the receiver of
+ * the message inherits @p priority as well, and so on along the chain of
+ * blocked threads, up to @ref CONFIG_SCHED_PRIORITY_INHERITANCE_DEPTH threads.
+ * Threads that already run with @p priority or higher end the chain.
+ *
+ * @pre     @p priority is not higher than the priority of the calling thread
+ *
+ * @param[in,out] thread    thread that blocks the calling thread
+ * @param[in]     priority  priority of the calling thread
+ */
+void sched_inherit_priority(thread_t *thread, uint8_t priority);
+#endif
+
 /**
  * @brief  Set CPU to idle mode (CPU dependent)
  *
@@ -332,8 +364,9 @@ static inline void sched_runq_advance(uint8_t prio)
  * @details Function has to be provided by the user of this API.
  *          It will be called:
  *          - when the scheduler is run,
- *          - when a thread enters the active queue or
- *          - when the last thread leaves a queue
+ *          - when a thread enters the active queue,
+ *          - when the last thread leaves a queue or
+ *          - when a thread leaves a queue and only one thread is left in it
  *
  * @warning This API is not intended for out of tree users.
  *          Breaking API changes will be done without notice and
@@ -180,9 +180,10 @@ struct _thread {
     clist_node_t rq_entry;          /**< run queue entry                */
 
 #if defined(MODULE_CORE_MSG) || defined(MODULE_CORE_THREAD_FLAGS) \
-    || defined(MODULE_CORE_MBOX) || defined(DOXYGEN)
-    void *wait_data;                /**< used by msg, mbox and thread
-                                         flags                          */
+    || defined(MODULE_CORE_MBOX) \
+    || defined(MODULE_CORE_MUTEX_PRIORITY_INHERITANCE) || defined(DOXYGEN)
+    void *wait_data;                /**< used by msg, mbox, thread flags
+                                         and mutexes                    */
 #endif
 #if defined(MODULE_CORE_MSG) || defined(DOXYGEN)
     list_node_t msg_waiters;        /**< threads waiting for their message
@@ -193,16 +194,28 @@ struct _thread {
     msg_t *msg_array;               /**< memory holding messages sent
                                          to this thread's message queue */
 #endif
+#if defined(MODULE_CORE_MSG_PRIORITY_INHERITANCE) || defined(DOXYGEN)
+    kernel_pid_t msg_receiver_pid;  /**< receiver this thread waits for
+                                         in msg_send_receive(), if any  */
+    uint8_t msg_receiver_original_priority; /**< priority of that receiver
+                                                 before the inheritance */
+#endif
 #if defined(DEVELHELP) || IS_ACTIVE(SCHED_TEST_STACK) \
-    || defined(MODULE_MPU_STACK_GUARD) || defined(DOXYGEN)
+    || defined(MODULE_MPU_STACK_GUARD) \
+    || defined(MODULE_CORE_STACK_WATERMARK) || defined(DOXYGEN)
     char *stack_start;              /**< thread's stack start address   */
 #endif
 #if defined(CONFIG_THREAD_NAMES) || defined(DOXYGEN)
     const char *name;               /**< thread's name                  */
 #endif
-#if defined(DEVELHELP) || defined(DOXYGEN)
+#if defined(DEVELHELP) || defined(MODULE_CORE_STACK_WATERMARK) \
+    || defined(DOXYGEN)
     int stack_size;                 /**< thread's stack size            */
 #endif
+#if defined(MODULE_CORE_STACK_WATERMARK) || defined(DOXYGEN)
+    char *sp_min;                   /**< lowest stack pointer seen on a
+                                         context switch                 */
+#endif
 /* enable TLS only when Picolibc is compiled with TLS enabled */
 #ifdef PICOLIBC_TLS
     void *tls;                      /**< thread local storage ptr */
@@ -464,6 +477,34 @@ static inline const char *thread_getname(kernel_pid_t pid)
  */
 uintptr_t thread_measure_stack_free(const char *stack);
 
+/**
+ * @brief   Get the sampled stack usage high-water mark of a thread
+ *
+ * With the `core_stack_watermark` module the scheduler records the lowest
+ * stack pointer each thread had when it got switched out. Unlike
+ * @ref thread_measure_stack_free this costs only a compare per context switch
+ * and a subtraction per query, so it can be polled in production builds.
+ *
+ * @note    The value is a lower bound of the real stack usage: function calls
+ *          that return before the next context switch are not seen. Use
+ *          @ref thread_measure_stack_free when the exact figure is needed.
+ *
+ * @param[in] thread    thread to work on
+ *
+ * @return  maximum number of stack bytes in use seen on a context switch,
+ *          0 if the `core_stack_watermark` module is not used
+ */
+static inline size_t thread_stack_watermark(const struct _thread *thread)
+{
+#if defined(MODULE_CORE_STACK_WATERMARK)
+    return (uintptr_t)thread->stack_start + thread->stack_size
+           - (uintptr_t)thread->sp_min;
+#else
+    (void)thread;
+    return 0;
+#endif
+}
+
 /**
  * @brief   Get the number of bytes used on the ISR stack
  */
@@ -559,7 +600,7 @@ const char *thread_state_to_string(thread_status_t state);
 static inline void *thread_get_stackstart(const thread_t *thread)
 {
 #if defined(DEVELHELP) || IS_ACTIVE(SCHED_TEST_STACK) \
-    || defined(MODULE_MPU_STACK_GUARD)
+    || defined(MODULE_MPU_STACK_GUARD) || defined(MODULE_CORE_STACK_WATERMARK)
     return thread->stack_start;
 #else
     (void)thread;
@@ -588,7 +629,7 @@ static inline void *thread_get_sp(const thread_t *thread)
  */
 static inline size_t thread_get_stacksize(const thread_t *thread)
 {
-#if defined(DEVELHELP)
+#if defined(DEVELHELP) || defined(MODULE_CORE_STACK_WATERMARK)
     return thread->stack_size;
 #else
     (void)thread;
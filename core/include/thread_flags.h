@@ -101,6 +101,11 @@ extern "C" {
  * @see xtimer_set_timeout_flag
  */
 #define THREAD_FLAG_TIMEOUT         (1u << 14)
+/**
+ * @brief Set when a message is queued in an mbox with mbox_t::notify
+ *        pointing to the thread
+ */
+#define THREAD_FLAG_MBOX            (1u << 13)
 
 /**
  * @brief Comprehensive set of all predefined flags
@@ -113,7 +118,8 @@ extern "C" {
  * When using custom flags, asserting that they are not in this set can help
  * avoid conflict with future additions to the predefined flags.
  */
-#define THREAD_FLAG_PREDEFINED_MASK (THREAD_FLAG_MSG_WAITING | THREAD_FLAG_TIMEOUT)
+#define THREAD_FLAG_PREDEFINED_MASK (THREAD_FLAG_MSG_WAITING | THREAD_FLAG_TIMEOUT | \
+                                     THREAD_FLAG_MBOX)
 /** @} */
 
 /**
@@ -130,6 +136,20 @@ typedef uint16_t thread_flags_t;
  */
 void thread_flags_set(thread_t *thread, thread_flags_t mask);
 
+/**
+ * @brief Set thread flags, possibly waking it up, without yielding
+ *
+ * Like thread_flags_set(), but only requests the context switch instead of
+ * yielding. In interrupt context, the switch happens once when the ISR
+ * returns, no matter how many flags and threads were set before. In thread
+ * context, call thread_yield_higher() after the last call.
+ *
+ * @param[in]   thread  thread to work upon
+ * @param[in]   mask    additional flags to be set for the thread,
+ *                      represented as a bitmask
+ */
+void thread_flags_set_deferred(thread_t *thread, thread_flags_t mask);
+
 /**
  * @brief Clear current thread's flags
  *
@@ -97,6 +97,25 @@ extern "C" {
 #define PURE
 #endif
 
+/**
+ * @def RIOT_HOT
+ * @brief The function is on a latency critical path and is executed from RAM
+ *        if the module `core_ramfunc` is used.
+ *
+ * On MCUs with flash wait states, executing code from flash adds latency and
+ * jitter whenever the flash cache misses. Functions marked with this are
+ * placed in the `.ramfunc` section, which the startup code copies to RAM
+ * along with `.data`. Without `core_ramfunc`, this expands to nothing.
+ *
+ * Only the function itself is placed in RAM, functions it calls that are not
+ * inlined stay in flash. Every marked function costs its size in RAM.
+ */
+#if defined(MODULE_CORE_RAMFUNC) && defined(__GNUC__)
+#define RIOT_HOT  __attribute__((section(".ramfunc")))
+#else
+#define RIOT_HOT
+#endif
+
 /**
  * @def       UNREACHABLE()
  * @brief     Tell the compiler that this line of code cannot be reached.
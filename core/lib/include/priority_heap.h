@@ -0,0 +1,142 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     core_util
+ * @{
+ *
+ * @file
+ * @brief       A priority queue based on a pairing heap
+ *
+ * Drop-in alternative to @ref priority_queue.h for long queues: adding a
+ * node takes constant time and removing the head takes amortized logarithmic
+ * time, instead of the linear time insertion of the sorted list.
+ *
+ * Nodes of equal priority are removed in the order they were added, just
+ * like with @ref priority_queue_t.
+ */
+
+#ifndef PRIORITY_HEAP_H
+#define PRIORITY_HEAP_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief data type for priority heap nodes
+ */
+typedef struct priority_heap_node {
+    struct priority_heap_node *child;   /**< first child */
+    struct priority_heap_node *sibling; /**< next sibling */
+    struct priority_heap_node *prev;    /**< previous sibling or parent */
+    uint32_t priority;                  /**< node priority */
+    uint32_t seq;                       /**< insertion order, set on add */
+    unsigned int data;                  /**< node data */
+} priority_heap_node_t;
+
+/**
+ * @brief data type for priority heaps
+ */
+typedef struct {
+    priority_heap_node_t *first;        /**< node with the lowest priority
+                                             value */
+    uint32_t seq;                       /**< sequence number of the next node */
+} priority_heap_t;
+
+/**
+ * @brief Static initializer for priority_heap_node_t.
+ */
+#define PRIORITY_HEAP_NODE_INIT { NULL, NULL, NULL, 0, 0, 0 }
+
+/**
+ * @brief   Initialize a priority heap node object.
+ * @details For initialization of variables use PRIORITY_HEAP_NODE_INIT
+ *          instead. Only use this function for dynamically allocated
+ *          priority heap nodes.
+ * @param[out] priority_heap_node
+ *          pre-allocated priority_heap_node_t object, must not be NULL.
+ */
+static inline void priority_heap_node_init(
+    priority_heap_node_t *priority_heap_node)
+{
+    priority_heap_node_t n = PRIORITY_HEAP_NODE_INIT;
+
+    *priority_heap_node = n;
+}
+
+/**
+ * @brief Static initializer for priority_heap_t.
+ */
+#define PRIORITY_HEAP_INIT { NULL, 0 }
+
+/**
+ * @brief   Initialize a priority heap object.
+ * @details For initialization of variables use PRIORITY_HEAP_INIT
+ *          instead. Only use this function for dynamically allocated
+ *          priority heaps.
+ * @param[out] priority_heap
+ *          pre-allocated priority_heap_t object, must not be NULL.
+ */
+static inline void priority_heap_init(priority_heap_t *priority_heap)
+{
+    priority_heap_t h = PRIORITY_HEAP_INIT;
+
+    *priority_heap = h;
+}
+
+/**
+ * @brief get the priority heap's head without removing it
+ *
+ * @param[in]   root    the heap's root
+ *
+ * @return              the head, NULL if the heap is empty
+ */
+static inline priority_heap_node_t *priority_heap_peek(
+    const priority_heap_t *root)
+{
+    return root->first;
+}
+
+/**
+ * @brief remove the priority heap's head
+ *
+ * @param[out]  root    the heap's root
+ *
+ * @return              the old head
+ */
+priority_heap_node_t *priority_heap_remove_head(priority_heap_t *root);
+
+/**
+ * @brief insert a new node into the heap
+ *
+ * @param[in,out]   root    the heap's root
+ * @param[in]       new_obj the new node, must not be in the heap already
+ */
+void priority_heap_add(priority_heap_t *root, priority_heap_node_t *new_obj);
+
+/**
+ * @brief remove a node from the heap
+ *
+ * Nothing happens if @p node was initialized or removed before and is not in
+ * the heap.
+ *
+ * @param[in,out]   root    the heap's root
+ * @param[in]       node    the node to remove
+ */
+void priority_heap_remove(priority_heap_t *root, priority_heap_node_t *node);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PRIORITY_HEAP_H */
+/** @} */
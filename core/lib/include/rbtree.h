@@ -0,0 +1,229 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     core_util
+ * @{
+ *
+ * @file
+ * @brief       Intrusive red-black tree
+ *
+ * Like @ref clist.h, the tree does not allocate memory: objects embed a
+ * @ref rbtree_node_t and use container_of() to get from a node to the
+ * object. The tree is kept sorted by the comparison function given on
+ * initialization.
+ *
+ * Its operations are:
+ *
+ * operation            | runtime  | description
+ * ---------------------|----------|---------------
+ * rbtree_insert()      | O(log n) | insert node, after nodes comparing equal
+ * rbtree_remove()      | O(log n) | remove node
+ * rbtree_find()        | O(log n) | find first node matching a key
+ * rbtree_lower_bound() | O(log n) | find first node not less than a key
+ * rbtree_first()       | O(log n) | get the smallest node
+ * rbtree_last()        | O(log n) | get the largest node
+ * rbtree_next()        | O(log n) | get the next larger node, amortized O(1)
+ * rbtree_prev()        | O(log n) | get the next smaller node, amortized O(1)
+ * rbtree_is_empty()    | O(1)     | returns true if the tree has no nodes
+ *
+ * Example:
+ *
+ *     typedef struct {
+ *         rbtree_node_t node;
+ *         uint32_t key;
+ *     } entry_t;
+ *
+ *     static int _cmp(const rbtree_node_t *a, const rbtree_node_t *b)
+ *     {
+ *         uint32_t ka = container_of(a, entry_t, node)->key;
+ *         uint32_t kb = container_of(b, entry_t, node)->key;
+ *         return (ka > kb) - (ka < kb);
+ *     }
+ *
+ *     static int _key_cmp(const void *key, const rbtree_node_t *node)
+ *     {
+ *         uint32_t k = *(const uint32_t *)key;
+ *         uint32_t kn = container_of(node, entry_t, node)->key;
+ *         return (k > kn) - (k < kn);
+ *     }
+ *
+ *     static rbtree_t tree = RBTREE_INIT(_cmp);
+ *
+ *     [...]
+ *     rbtree_insert(&tree, &entry->node);
+ *     rbtree_node_t *n = rbtree_find(&tree, &key, _key_cmp);
+ *
+ *     for (n = rbtree_first(&tree); n; n = rbtree_next(n)) {
+ *         // visit the nodes in ascending order
+ *     }
+ *
+ * The color of a node is stored in the least significant bit of its parent
+ * pointer, so a node is three pointers in size.
+ */
+
+#ifndef RBTREE_H
+#define RBTREE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Tree node, embedded in the objects kept in the tree
+ */
+typedef struct rbtree_node {
+    struct rbtree_node *child[2];   /**< left and right child */
+    uintptr_t parent_color;         /**< parent pointer and color bit */
+} rbtree_node_t;
+
+/**
+ * @brief   Compares two nodes
+ *
+ * @return  < 0 if @p a sorts before @p b, 0 if equal, > 0 otherwise
+ */
+typedef int (*rbtree_cmp_t)(const rbtree_node_t *a, const rbtree_node_t *b);
+
+/**
+ * @brief   Compares a key to a node, used for lookups
+ *
+ * Must be consistent with the @ref rbtree_cmp_t of the tree.
+ *
+ * @return  < 0 if @p key sorts before @p node, 0 if equal, > 0 otherwise
+ */
+typedef int (*rbtree_key_cmp_t)(const void *key, const rbtree_node_t *node);
+
+/**
+ * @brief   Red-black tree
+ */
+typedef struct {
+    rbtree_node_t *root;            /**< root node, NULL if empty */
+    rbtree_cmp_t cmp;               /**< order of the nodes */
+} rbtree_t;
+
+/**
+ * @brief   Static initializer for rbtree_t
+ *
+ * @param[in]   cmp     comparison function of the tree
+ */
+#define RBTREE_INIT(cmp) { NULL, cmp }
+
+/**
+ * @brief   Initialize a tree
+ * @details For initialization of variables use RBTREE_INIT instead.
+ *
+ * @param[out]  tree    tree to initialize
+ * @param[in]   cmp     comparison function of the tree
+ */
+static inline void rbtree_init(rbtree_t *tree, rbtree_cmp_t cmp)
+{
+    tree->root = NULL;
+    tree->cmp = cmp;
+}
+
+/**
+ * @brief   Checks if the tree is empty
+ *
+ * @param[in]   tree    tree to check
+ *
+ * @return  true if @p tree has no nodes, false otherwise
+ */
+static inline bool rbtree_is_empty(const rbtree_t *tree)
+{
+    return tree->root == NULL;
+}
+
+/**
+ * @brief   Inserts a node
+ *
+ * A node comparing equal to nodes already in the tree is inserted after them.
+ *
+ * @param[in,out]   tree    tree to insert into
+ * @param[out]      node    node to insert, must not be in a tree
+ */
+void rbtree_insert(rbtree_t *tree, rbtree_node_t *node);
+
+/**
+ * @brief   Removes a node
+ *
+ * @param[in,out]   tree    tree to remove from
+ * @param[in,out]   node    node to remove, must be in @p tree
+ */
+void rbtree_remove(rbtree_t *tree, rbtree_node_t *node);
+
+/**
+ * @brief   Finds the first node not sorting before @p key
+ *
+ * @param[in]   tree    tree to search
+ * @param[in]   key     key to search for
+ * @param[in]   cmp     compares @p key to the nodes
+ *
+ * @return  first node comparing greater than or equal to @p key
+ * @return  NULL if all nodes sort before @p key
+ */
+rbtree_node_t *rbtree_lower_bound(const rbtree_t *tree, const void *key,
+                                  rbtree_key_cmp_t cmp);
+
+/**
+ * @brief   Finds the first node comparing equal to @p key
+ *
+ * @param[in]   tree    tree to search
+ * @param[in]   key     key to search for
+ * @param[in]   cmp     compares @p key to the nodes
+ *
+ * @return  first node comparing equal to @p key, NULL if there is none
+ */
+rbtree_node_t *rbtree_find(const rbtree_t *tree, const void *key,
+                           rbtree_key_cmp_t cmp);
+
+/**
+ * @brief   Gets the smallest node
+ *
+ * @param[in]   tree    tree to get the node of
+ *
+ * @return  smallest node, NULL if @p tree is empty
+ */
+rbtree_node_t *rbtree_first(const rbtree_t *tree);
+
+/**
+ * @brief   Gets the largest node
+ *
+ * @param[in]   tree    tree to get the node of
+ *
+ * @return  largest node, NULL if @p tree is empty
+ */
+rbtree_node_t *rbtree_last(const rbtree_t *tree);
+
+/**
+ * @brief   Gets the node following @p node in order
+ *
+ * @param[in]   node    node in a tree
+ *
+ * @return  next node, NULL if @p node is the largest one
+ */
+rbtree_node_t *rbtree_next(const rbtree_node_t *node);
+
+/**
+ * @brief   Gets the node preceding @p node in order
+ *
+ * @param[in]   node    node in a tree
+ *
+ * @return  previous node, NULL if @p node is the smallest one
+ */
+rbtree_node_t *rbtree_prev(const rbtree_node_t *node);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* RBTREE_H */
+/** @} */
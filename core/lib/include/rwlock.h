@@ -0,0 +1,220 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    core_sync_rwlock Reader/Writer Lock
+ * @ingroup     core_sync
+ * @brief       Reader/writer lock for thread synchronization
+ *
+ * Any number of readers or a single writer may hold the lock. As long as no
+ * thread has to wait, locking and unlocking is a single atomic
+ * compare-and-swap on @ref rwlock_t::state and is inlined into the caller.
+ *
+ * Waiting threads are queued by priority. A reader does not get the lock
+ * while a writer of the same or a higher priority waits for it, so writers
+ * are not starved by a steady stream of readers. Readers of a higher priority
+ * than the first waiting writer still enter the critical section.
+ *
+ * @{
+ *
+ * @file
+ * @brief       Reader/writer lock for thread synchronization
+ */
+
+#ifndef RWLOCK_H
+#define RWLOCK_H
+
+#include <stdbool.h>
+
+#include "mutex.h"
+#include "priority_queue.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Bit in @ref rwlock_t::state set while a writer holds the lock
+ */
+#define RWLOCK_WRITER       (1U << (sizeof(unsigned) * 8 - 1))
+
+/**
+ * @brief   Bit in @ref rwlock_t::state set while threads wait for the lock
+ *
+ * This forces all operations on the lock into the slow path.
+ */
+#define RWLOCK_WAITING      (1U << (sizeof(unsigned) * 8 - 2))
+
+/**
+ * @brief   Reader/writer lock structure. Must never be modified by the user.
+ */
+typedef struct {
+    /**
+     * @brief   Number of readers holding the lock, @ref RWLOCK_WRITER and
+     *          @ref RWLOCK_WAITING
+     * @internal
+     */
+    unsigned state;
+    /**
+     * @brief   Serializes the slow path
+     * @internal
+     */
+    mutex_t mutex;
+    /**
+     * @brief   Waiting threads
+     * @internal
+     */
+    priority_queue_t queue;
+} rwlock_t;
+
+/**
+ * @brief   Static initializer for rwlock_t.
+ */
+#define RWLOCK_INIT { 0, MUTEX_INIT, PRIORITY_QUEUE_INIT }
+
+/**
+ * @brief   Initializes a reader/writer lock.
+ *
+ * @details For initialization of variables use @ref RWLOCK_INIT instead.
+ *
+ * @param[out]  rwlock  Lock to initialize, must not be NULL
+ */
+static inline void rwlock_init(rwlock_t *rwlock)
+{
+    rwlock_t empty = RWLOCK_INIT;
+
+    *rwlock = empty;
+}
+
+/**
+ * @brief   Locks for reading or writing, blocking
+ *
+ * @internal
+ *
+ * @param[in,out]   rwlock      Lock to acquire
+ * @param[in]       writer      True to lock for writing
+ * @param[in]       wakeable    Give up if the thread is woken up by
+ *                              @ref thread_wakeup() while waiting
+ *
+ * @retval  true    The lock was acquired
+ * @retval  false   The thread was woken up before it got the lock
+ */
+bool rwlock_lock_internal(rwlock_t *rwlock, bool writer, bool wakeable);
+
+/**
+ * @brief   Unlocks if threads wait for the lock
+ *
+ * @internal
+ *
+ * @param[in,out]   rwlock      Lock to release
+ */
+void rwlock_unlock_internal(rwlock_t *rwlock);
+
+/**
+ * @brief   Tries to lock for reading, non-blocking
+ *
+ * @param[in,out]   rwlock  Lock to acquire, must not be NULL
+ *
+ * @return  1 if the lock is now held for reading
+ * @return  0 if acquiring the lock would have to block
+ */
+static inline int rwlock_tryrdlock(rwlock_t *rwlock)
+{
+    unsigned state = __atomic_load_n(&rwlock->state, __ATOMIC_RELAXED);
+
+    while (!(state & (RWLOCK_WRITER | RWLOCK_WAITING))) {
+        if (__atomic_compare_exchange_n(&rwlock->state, &state, state + 1,
+                                        true, __ATOMIC_ACQUIRE,
+                                        __ATOMIC_RELAXED)) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+/**
+ * @brief   Tries to lock for writing, non-blocking
+ *
+ * @param[in,out]   rwlock  Lock to acquire, must not be NULL
+ *
+ * @return  1 if the lock is now held for writing
+ * @return  0 if acquiring the lock would have to block
+ */
+static inline int rwlock_trywrlock(rwlock_t *rwlock)
+{
+    unsigned state = 0;
+
+    return __atomic_compare_exchange_n(&rwlock->state, &state, RWLOCK_WRITER,
+                                       false, __ATOMIC_ACQUIRE,
+                                       __ATOMIC_RELAXED);
+}
+
+/**
+ * @brief   Locks for reading, blocking
+ *
+ * @param[in,out]   rwlock  Lock to acquire, must not be NULL
+ */
+static inline void rwlock_rdlock(rwlock_t *rwlock)
+{
+    if (!rwlock_tryrdlock(rwlock)) {
+        rwlock_lock_internal(rwlock, false, false);
+    }
+}
+
+/**
+ * @brief   Locks for writing, blocking
+ *
+ * @param[in,out]   rwlock  Lock to acquire, must not be NULL
+ */
+static inline void rwlock_wrlock(rwlock_t *rwlock)
+{
+    if (!rwlock_trywrlock(rwlock)) {
+        rwlock_lock_internal(rwlock, true, false);
+    }
+}
+
+/**
+ * @brief   Releases the lock held for reading or writing
+ *
+ * @pre     The lock is held by the calling thread
+ *
+ * @param[in,out]   rwlock  Lock to release, must not be NULL
+ */
+static inline void rwlock_unlock(rwlock_t *rwlock)
+{
+    unsigned state = __atomic_load_n(&rwlock->state, __ATOMIC_RELAXED);
+
+    while (!(state & RWLOCK_WAITING)) {
+        unsigned next = (state & RWLOCK_WRITER) ? 0 : state - 1;
+        if (__atomic_compare_exchange_n(&rwlock->state, &state, next,
+                                        true, __ATOMIC_RELEASE,
+                                        __ATOMIC_RELAXED)) {
+            return;
+        }
+    }
+    rwlock_unlock_internal(rwlock);
+}
+
+/**
+ * @brief   Checks if the lock is held by any thread
+ *
+ * @param[in]   rwlock  Lock to check, must not be NULL
+ *
+ * @return  true if the lock is held for reading or writing
+ */
+static inline bool rwlock_is_locked(const rwlock_t *rwlock)
+{
+    return __atomic_load_n(&rwlock->state, __ATOMIC_RELAXED) & ~RWLOCK_WAITING;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* RWLOCK_H */
+/** @} */
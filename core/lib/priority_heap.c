@@ -0,0 +1,141 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     core_util
+ * @{
+ *
+ * @file
+ * @brief       A priority queue based on a pairing heap
+ *
+ * @}
+ */
+
+#include <stdbool.h>
+
+#include "priority_heap.h"
+
+static bool _before(const priority_heap_node_t *a,
+                    const priority_heap_node_t *b)
+{
+    if (a->priority != b->priority) {
+        return a->priority < b->priority;
+    }
+    /* serial number arithmetic, survives the wrap around of root->seq */
+    return (int32_t)(a->seq - b->seq) < 0;
+}
+
+/* link two roots, the one to be removed later becomes the first child of the
+ * other one */
+static priority_heap_node_t *_meld(priority_heap_node_t *a,
+                                   priority_heap_node_t *b)
+{
+    if (_before(b, a)) {
+        priority_heap_node_t *tmp = a;
+        a = b;
+        b = tmp;
+    }
+
+    b->prev = a;
+    b->sibling = a->child;
+    if (a->child) {
+        a->child->prev = b;
+    }
+    a->child = b;
+    a->sibling = NULL;
+    a->prev = NULL;
+
+    return a;
+}
+
+/* two-pass pairing of the children of a removed node */
+static priority_heap_node_t *_merge_pairs(priority_heap_node_t *first)
+{
+    priority_heap_node_t *pairs = NULL;
+
+    /* meld pairs from left to right, collect them in reverse order */
+    while (first) {
+        priority_heap_node_t *a = first;
+        priority_heap_node_t *b = a->sibling;
+
+        if (b) {
+            first = b->sibling;
+            a = _meld(a, b);
+        }
+        else {
+            first = NULL;
+        }
+        a->sibling = pairs;
+        pairs = a;
+    }
+
+    /* meld the pairs from right to left */
+    priority_heap_node_t *res = NULL;
+    while (pairs) {
+        priority_heap_node_t *next = pairs->sibling;
+        pairs->sibling = NULL;
+        pairs->prev = NULL;
+        res = res ? _meld(res, pairs) : pairs;
+        pairs = next;
+    }
+
+    return res;
+}
+
+priority_heap_node_t *priority_heap_remove_head(priority_heap_t *root)
+{
+    priority_heap_node_t *head = root->first;
+
+    if (head) {
+        root->first = _merge_pairs(head->child);
+        head->child = NULL;
+    }
+    return head;
+}
+
+void priority_heap_add(priority_heap_t *root, priority_heap_node_t *new_obj)
+{
+    new_obj->child = NULL;
+    new_obj->sibling = NULL;
+    new_obj->prev = NULL;
+    new_obj->seq = root->seq++;
+
+    root->first = root->first ? _meld(root->first, new_obj) : new_obj;
+}
+
+void priority_heap_remove(priority_heap_t *root, priority_heap_node_t *node)
+{
+    if (node == root->first) {
+        priority_heap_remove_head(root);
+        return;
+    }
+    if (!node->prev) {
+        /* not in the heap */
+        return;
+    }
+
+    /* unlink the subtree of node */
+    if (node->prev->child == node) {
+        node->prev->child = node->sibling;
+    }
+    else {
+        node->prev->sibling = node->sibling;
+    }
+    if (node->sibling) {
+        node->sibling->prev = node->prev;
+    }
+
+    priority_heap_node_t *sub = _merge_pairs(node->child);
+    if (sub) {
+        root->first = _meld(root->first, sub);
+    }
+
+    node->child = NULL;
+    node->sibling = NULL;
+    node->prev = NULL;
+}
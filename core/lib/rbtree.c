@@ -0,0 +1,284 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     core_util
+ * @{
+ *
+ * @file
+ * @brief       Intrusive red-black tree implementation
+ *
+ * Left and right cases are handled by the same code, with dir selecting the
+ * child a rotation or fixup starts from.
+ *
+ * @}
+ */
+
+#include "rbtree.h"
+
+#define BLACK   ((uintptr_t)1)
+
+static inline rbtree_node_t *_parent(const rbtree_node_t *node)
+{
+    return (rbtree_node_t *)(node->parent_color & ~BLACK);
+}
+
+static inline void _set_parent(rbtree_node_t *node, rbtree_node_t *parent)
+{
+    node->parent_color = (uintptr_t)parent | (node->parent_color & BLACK);
+}
+
+/* NULL leaves are black */
+static inline bool _is_black(const rbtree_node_t *node)
+{
+    return !node || (node->parent_color & BLACK);
+}
+
+static inline void _set_black(rbtree_node_t *node)
+{
+    node->parent_color |= BLACK;
+}
+
+static inline void _set_red(rbtree_node_t *node)
+{
+    node->parent_color &= ~BLACK;
+}
+
+static void _replace_child(rbtree_t *tree, rbtree_node_t *parent,
+                           rbtree_node_t *old, rbtree_node_t *new)
+{
+    if (!parent) {
+        tree->root = new;
+    }
+    else {
+        parent->child[parent->child[1] == old] = new;
+    }
+}
+
+/* moves node down towards dir, its child on the other side takes its place */
+static void _rotate(rbtree_t *tree, rbtree_node_t *node, int dir)
+{
+    rbtree_node_t *up = node->child[!dir];
+    rbtree_node_t *parent = _parent(node);
+
+    node->child[!dir] = up->child[dir];
+    if (up->child[dir]) {
+        _set_parent(up->child[dir], node);
+    }
+    up->child[dir] = node;
+    _set_parent(up, parent);
+    _replace_child(tree, parent, node, up);
+    _set_parent(node, up);
+}
+
+static void _insert_fixup(rbtree_t *tree, rbtree_node_t *node)
+{
+    rbtree_node_t *parent;
+
+    while ((parent = _parent(node)) && !_is_black(parent)) {
+        /* a red node is never the root, so there is a grandparent */
+        rbtree_node_t *grandparent = _parent(parent);
+        int dir = (grandparent->child[1] == parent);
+        rbtree_node_t *uncle = grandparent->child[!dir];
+
+        if (!_is_black(uncle)) {
+            _set_black(parent);
+            _set_black(uncle);
+            _set_red(grandparent);
+            node = grandparent;
+            continue;
+        }
+        if (parent->child[!dir] == node) {
+            _rotate(tree, parent, dir);
+            parent = node;
+        }
+        _set_black(parent);
+        _set_red(grandparent);
+        _rotate(tree, grandparent, !dir);
+        break;
+    }
+    _set_black(tree->root);
+}
+
+void rbtree_insert(rbtree_t *tree, rbtree_node_t *node)
+{
+    rbtree_node_t *parent = NULL;
+    rbtree_node_t **link = &tree->root;
+
+    while (*link) {
+        parent = *link;
+        link = &parent->child[tree->cmp(node, parent) >= 0];
+    }
+
+    node->child[0] = NULL;
+    node->child[1] = NULL;
+    /* new nodes are red */
+    node->parent_color = (uintptr_t)parent;
+    *link = node;
+
+    _insert_fixup(tree, node);
+}
+
+/* node has one black node less on its path than its sibling, node may be
+ * NULL, so its parent is passed as well */
+static void _remove_fixup(rbtree_t *tree, rbtree_node_t *node,
+                          rbtree_node_t *parent)
+{
+    while ((node != tree->root) && _is_black(node)) {
+        /* the sibling is never NULL, it has a black node more on its path */
+        int dir = (parent->child[1] == node);
+        rbtree_node_t *sibling = parent->child[!dir];
+
+        if (!_is_black(sibling)) {
+            _set_black(sibling);
+            _set_red(parent);
+            _rotate(tree, parent, dir);
+            sibling = parent->child[!dir];
+        }
+        if (_is_black(sibling->child[0]) && _is_black(sibling->child[1])) {
+            _set_red(sibling);
+            node = parent;
+            parent = _parent(node);
+            continue;
+        }
+        if (_is_black(sibling->child[!dir])) {
+            _set_black(sibling->child[dir]);
+            _set_red(sibling);
+            _rotate(tree, sibling, !dir);
+            sibling = parent->child[!dir];
+        }
+        sibling->parent_color = (sibling->parent_color & ~BLACK)
+                                | (parent->parent_color & BLACK);
+        _set_black(parent);
+        _set_black(sibling->child[!dir]);
+        _rotate(tree, parent, dir);
+        node = tree->root;
+        break;
+    }
+    if (node) {
+        _set_black(node);
+    }
+}
+
+void rbtree_remove(rbtree_t *tree, rbtree_node_t *node)
+{
+    rbtree_node_t *child;
+    rbtree_node_t *parent;
+    bool black;
+
+    if (node->child[0] && node->child[1]) {
+        /* the successor has no left child, it takes the place of node */
+        rbtree_node_t *succ = node->child[1];
+        while (succ->child[0]) {
+            succ = succ->child[0];
+        }
+        child = succ->child[1];
+        parent = _parent(succ);
+        black = _is_black(succ);
+
+        if (parent == node) {
+            parent = succ;
+        }
+        else {
+            parent->child[0] = child;
+            if (child) {
+                _set_parent(child, parent);
+            }
+            succ->child[1] = node->child[1];
+            _set_parent(succ->child[1], succ);
+        }
+        succ->child[0] = node->child[0];
+        _set_parent(succ->child[0], succ);
+        _replace_child(tree, _parent(node), node, succ);
+        succ->parent_color = node->parent_color;
+    }
+    else {
+        child = node->child[0] ? node->child[0] : node->child[1];
+        parent = _parent(node);
+        black = _is_black(node);
+
+        _replace_child(tree, parent, node, child);
+        if (child) {
+            _set_parent(child, parent);
+        }
+    }
+
+    if (black) {
+        _remove_fixup(tree, child, parent);
+    }
+}
+
+rbtree_node_t *rbtree_lower_bound(const rbtree_t *tree, const void *key,
+                                  rbtree_key_cmp_t cmp)
+{
+    rbtree_node_t *node = tree->root;
+    rbtree_node_t *res = NULL;
+
+    while (node) {
+        if (cmp(key, node) <= 0) {
+            res = node;
+            node = node->child[0];
+        }
+        else {
+            node = node->child[1];
+        }
+    }
+    return res;
+}
+
+rbtree_node_t *rbtree_find(const rbtree_t *tree, const void *key,
+                           rbtree_key_cmp_t cmp)
+{
+    rbtree_node_t *res = rbtree_lower_bound(tree, key, cmp);
+
+    return (res && !cmp(key, res)) ? res : NULL;
+}
+
+static rbtree_node_t *_outermost(rbtree_node_t *node, int dir)
+{
+    if (node) {
+        while (node->child[dir]) {
+            node = node->child[dir];
+        }
+    }
+    return node;
+}
+
+rbtree_node_t *rbtree_first(const rbtree_t *tree)
+{
+    return _outermost(tree->root, 0);
+}
+
+rbtree_node_t *rbtree_last(const rbtree_t *tree)
+{
+    return _outermost(tree->root, 1);
+}
+
+static rbtree_node_t *_step(const rbtree_node_t *node, int dir)
+{
+    rbtree_node_t *parent;
+
+    if (node->child[dir]) {
+        return _outermost(node->child[dir], !dir);
+    }
+    /* go up until coming from the other side */
+    while ((parent = _parent(node)) && (parent->child[dir] == node)) {
+        node = parent;
+    }
+    return parent;
+}
+
+rbtree_node_t *rbtree_next(const rbtree_node_t *node)
+{
+    return _step(node, 1);
+}
+
+rbtree_node_t *rbtree_prev(const rbtree_node_t *node)
+{
+    return _step(node, 0);
+}
@@ -0,0 +1,172 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     core_sync_rwlock
+ * @{
+ *
+ * @file
+ * @brief       Reader/writer lock implementation, slow path
+ *
+ * The slow path is serialized by @ref rwlock_t::mutex. While @ref
+ * RWLOCK_WAITING is set, the fast paths in rwlock.h do not modify the state,
+ * so it is only changed with the mutex held.
+ *
+ * @}
+ */
+
+#include <stdint.h>
+
+#include "kernel_defines.h"
+#include "rwlock.h"
+#include "sched.h"
+#include "thread.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+typedef struct {
+    priority_queue_node_t qnode;    /**< entry in rwlock_t::queue */
+    thread_t *thread;               /**< waiting thread */
+    bool writer;                    /**< waits for writing */
+    bool granted;                   /**< the lock was handed over */
+} _waiter_t;
+
+static inline _waiter_t *_first_waiter(const rwlock_t *rwlock)
+{
+    priority_queue_node_t *qnode = rwlock->queue.first;
+
+    return (qnode) ? container_of(qnode, _waiter_t, qnode) : NULL;
+}
+
+static bool _try_lock(rwlock_t *rwlock, bool writer, uint8_t priority)
+{
+    unsigned state = __atomic_load_n(&rwlock->state, __ATOMIC_RELAXED);
+
+    if (writer) {
+        if (state & ~RWLOCK_WAITING) {
+            return false;
+        }
+        state |= RWLOCK_WRITER;
+    }
+    else {
+        if (state & RWLOCK_WRITER) {
+            return false;
+        }
+        /* don't starve a waiting writer of the same or a higher priority */
+        _waiter_t *first = _first_waiter(rwlock);
+        if (first && first->writer && (first->qnode.priority <= priority)) {
+            return false;
+        }
+        state++;
+    }
+    __atomic_store_n(&rwlock->state, state, __ATOMIC_RELAXED);
+    return true;
+}
+
+static void _update_waiting(rwlock_t *rwlock)
+{
+    if (rwlock->queue.first == NULL) {
+        __atomic_fetch_and(&rwlock->state, ~RWLOCK_WAITING, __ATOMIC_RELEASE);
+    }
+}
+
+bool rwlock_lock_internal(rwlock_t *rwlock, bool writer, bool wakeable)
+{
+    thread_t *me = thread_get_active();
+
+    mutex_lock(&rwlock->mutex);
+
+    /* block the fast paths before checking, so that no unlock can be missed
+     * between the check and queuing */
+    __atomic_fetch_or(&rwlock->state, RWLOCK_WAITING, __ATOMIC_RELAXED);
+    if (_try_lock(rwlock, writer, me->priority)) {
+        _update_waiting(rwlock);
+        mutex_unlock(&rwlock->mutex);
+        return true;
+    }
+
+    DEBUG("rwlock_lock_internal(): %" PRIkernel_pid " waits for %s\n",
+          me->pid, writer ? "writing" : "reading");
+    _waiter_t waiter = {
+        .qnode = {
+            .next = NULL,
+            .priority = me->priority,
+        },
+        .thread = me,
+        .writer = writer,
+        .granted = false,
+    };
+    priority_queue_add(&rwlock->queue, &waiter.qnode);
+
+    while (1) {
+        mutex_unlock_and_sleep(&rwlock->mutex);
+        mutex_lock(&rwlock->mutex);
+
+        if (waiter.granted) {
+            /* rwlock_unlock_internal() already updated the state */
+            break;
+        }
+        if (wakeable) {
+            priority_queue_remove(&rwlock->queue, &waiter.qnode);
+            _update_waiting(rwlock);
+            break;
+        }
+    }
+
+    mutex_unlock(&rwlock->mutex);
+    return waiter.granted;
+}
+
+void rwlock_unlock_internal(rwlock_t *rwlock)
+{
+    mutex_lock(&rwlock->mutex);
+
+    unsigned state = __atomic_load_n(&rwlock->state, __ATOMIC_RELAXED);
+    state = (state & RWLOCK_WRITER) ? RWLOCK_WAITING : state - 1;
+    __atomic_store_n(&rwlock->state, state, __ATOMIC_RELEASE);
+
+    if (state & ~RWLOCK_WAITING) {
+        /* other readers still hold the lock */
+        mutex_unlock(&rwlock->mutex);
+        return;
+    }
+
+    uint16_t prio = SCHED_PRIO_LEVELS;
+    _waiter_t *waiter;
+
+    /* hand the lock over to the first writer, or to all readers queued before
+     * the first writer */
+    while ((waiter = _first_waiter(rwlock))) {
+        if (waiter->writer && (state != RWLOCK_WAITING)) {
+            break;
+        }
+        priority_queue_remove_head(&rwlock->queue);
+        waiter->granted = true;
+        if (waiter->qnode.priority < prio) {
+            prio = waiter->qnode.priority;
+        }
+        sched_set_status(waiter->thread, STATUS_PENDING);
+        DEBUG("rwlock_unlock_internal(): hand over to %" PRIkernel_pid "\n",
+              waiter->thread->pid);
+
+        if (waiter->writer) {
+            state |= RWLOCK_WRITER;
+            break;
+        }
+        state++;
+    }
+    __atomic_store_n(&rwlock->state, state, __ATOMIC_RELAXED);
+    _update_waiting(rwlock);
+
+    mutex_unlock(&rwlock->mutex);
+
+    if (prio < SCHED_PRIO_LEVELS) {
+        sched_switch(prio);
+    }
+}
@@ -24,6 +24,7 @@
 #include "irq.h"
 #include "sched.h"
 #include "thread.h"
+#include "thread_flags.h"
 
 #define ENABLE_DEBUG 0
 #include "debug.h"
@@ -89,7 +90,15 @@ int _mbox_put(mbox_t *mbox, msg_t *msg, int blocking)
         msg->sender_pid = thread_getpid();
         /* copy msg into queue */
         mbox->msg_array[cib_put_unsafe(&mbox->cib)] = *msg;
+#if IS_USED(MODULE_CORE_THREAD_FLAGS)
+        thread_t *notify = mbox->notify;
         irq_restore(irqstate);
+        if (notify) {
+            thread_flags_set(notify, THREAD_FLAG_MBOX);
+        }
+#else
+        irq_restore(irqstate);
+#endif
         return 1;
     }
 }
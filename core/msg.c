@@ -23,6 +23,7 @@
 #include <stddef.h>
 #include <inttypes.h>
 #include <assert.h>
+#include "bitarithm.h"
 #include "sched.h"
 #include "msg.h"
 #include "msg_bus.h"
@@ -33,6 +34,7 @@
 #endif
 #include "irq.h"
 #include "cib.h"
+#include "tracepoint.h"
 
 #define ENABLE_DEBUG 0
 #include "debug.h"
@@ -41,19 +43,155 @@ static int _msg_receive(msg_t *m, int block);
 static int _msg_send(msg_t *m, kernel_pid_t target_pid, bool block,
                      unsigned state);
 
-static int queue_msg(thread_t *target, const msg_t *m)
+#if IS_USED(MODULE_CORE_MSG_LOCKFREE)
+/*
+ * Multi-producer, single-consumer variant of the message queue: producers
+ * reserve a slot by advancing thread_t::msg_queue's write counter with a
+ * compare-and-swap. The slot is published by writing msg_t::sender_pid last,
+ * which is never KERNEL_PID_UNDEF for a sent message. The consumer side is
+ * only ever run with IRQs disabled, so it needs no further synchronization.
+ */
+static int _queue_push(thread_t *target, const msg_t *m)
+{
+    cib_t *queue = &target->msg_queue;
+    unsigned write = __atomic_load_n(&queue->write_count, __ATOMIC_RELAXED);
+
+    assert(m->sender_pid != KERNEL_PID_UNDEF);
+    if (!thread_has_msg_queue(target)) {
+        return 0;
+    }
+    do {
+        if ((write - __atomic_load_n(&queue->read_count, __ATOMIC_ACQUIRE))
+            > queue->mask) {
+            return 0;
+        }
+    } while (!__atomic_compare_exchange_n(&queue->write_count, &write,
+                                          write + 1, true, __ATOMIC_ACQ_REL,
+                                          __ATOMIC_RELAXED));
+
+    msg_t *dest = &target->msg_array[write & queue->mask];
+
+    dest->type = m->type;
+    dest->content = m->content;
+    __atomic_store_n(&dest->sender_pid, m->sender_pid, __ATOMIC_RELEASE);
+    return 1;
+}
+
+static int _queue_pop(thread_t *me, msg_t *m)
+{
+    cib_t *queue = &me->msg_queue;
+    unsigned read = queue->read_count;
+
+    if (read == __atomic_load_n(&queue->write_count, __ATOMIC_ACQUIRE)) {
+        return -1;
+    }
+
+    msg_t *src = &me->msg_array[read & queue->mask];
+    kernel_pid_t sender_pid = __atomic_load_n(&src->sender_pid,
+                                              __ATOMIC_ACQUIRE);
+
+    if (sender_pid == KERNEL_PID_UNDEF) {
+        /* slot is reserved, but its producer was preempted before it wrote
+         * out the message. It will wake us up once it did. */
+        return 0;
+    }
+    m->sender_pid = sender_pid;
+    m->type = src->type;
+    m->content = src->content;
+    src->sender_pid = KERNEL_PID_UNDEF;
+    __atomic_store_n(&queue->read_count, read + 1, __ATOMIC_RELEASE);
+    return 1;
+}
+
+/* must be called with IRQs disabled */
+static void _queue_wake(thread_t *target)
+{
+    if (target->status == STATUS_RECEIVE_BLOCKED) {
+        if (_queue_pop(target, target->wait_data) > 0) {
+            sched_set_status(target, STATUS_PENDING);
+            sched_context_switch_request = 1;
+        }
+    }
+#if MODULE_CORE_THREAD_FLAGS
+    else {
+        thread_flags_wake(target);
+    }
+#endif
+}
+
+static int _msg_send_lockfree(msg_t *m, kernel_pid_t target_pid)
+{
+    thread_t *target = thread_get_unchecked(target_pid);
+
+    /* leave everything that might block or wake up directly to the regular
+     * path, also if there are blocked senders to not overtake them */
+    if ((target == NULL) || (target->status == STATUS_RECEIVE_BLOCKED) ||
+        (target->msg_waiters.next != NULL)) {
+        return 0;
+    }
+    m->sender_pid = thread_getpid();
+    if (!_queue_push(target, m)) {
+        return 0;
+    }
+#if MODULE_CORE_THREAD_FLAGS
+    __atomic_fetch_or(&target->flags, THREAD_FLAG_MSG_WAITING,
+                      __ATOMIC_SEQ_CST);
+#endif
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    /* target may have gone blocked while we were writing the message */
+    switch (target->status) {
+    case STATUS_RECEIVE_BLOCKED:
+#if MODULE_CORE_THREAD_FLAGS
+    case STATUS_FLAG_BLOCKED_ANY:
+    case STATUS_FLAG_BLOCKED_ALL:
+#endif
+        {
+            unsigned state = irq_disable();
+
+            _queue_wake(target);
+            irq_restore(state);
+            if (sched_context_switch_request) {
+                thread_yield_higher();
+            }
+        }
+        break;
+    default:
+        break;
+    }
+    return 1;
+}
+#else   /* MODULE_CORE_MSG_LOCKFREE */
+static int _queue_push(thread_t *target, const msg_t *m)
 {
     int n = cib_put(&(target->msg_queue));
 
     if (n < 0) {
+        return 0;
+    }
+    target->msg_array[n] = *m;
+    return 1;
+}
+
+static int _queue_pop(thread_t *me, msg_t *m)
+{
+    int n = cib_get(&(me->msg_queue));
+
+    if (n < 0) {
+        return -1;
+    }
+    *m = me->msg_array[n];
+    return 1;
+}
+#endif  /* MODULE_CORE_MSG_LOCKFREE */
+
+static int queue_msg(thread_t *target, const msg_t *m)
+{
+    if (!_queue_push(target, m)) {
         DEBUG("queue_msg(): message queue is full (or there is none)\n");
         return 0;
     }
 
     DEBUG("queue_msg(): queuing message\n");
-    msg_t *dest = &target->msg_array[n];
-
-    *dest = *m;
 #if MODULE_CORE_THREAD_FLAGS
     target->flags |= THREAD_FLAG_MSG_WAITING;
     thread_flags_wake(target);
@@ -63,12 +201,19 @@ static int queue_msg(thread_t *target, const msg_t *m)
 
 int msg_send(msg_t *m, kernel_pid_t target_pid)
 {
+    TRACEPOINT(msg_send, target_pid);
+
     if (irq_is_in()) {
         return msg_send_int(m, target_pid);
     }
     if (thread_getpid() == target_pid) {
         return msg_send_to_self(m);
     }
+#if IS_USED(MODULE_CORE_MSG_LOCKFREE)
+    if (_msg_send_lockfree(m, target_pid)) {
+        return 1;
+    }
+#endif
     return _msg_send(m, target_pid, true, irq_disable());
 }
 
@@ -80,11 +225,16 @@ int msg_try_send(msg_t *m, kernel_pid_t target_pid)
     if (thread_getpid() == target_pid) {
         return msg_send_to_self(m);
     }
+#if IS_USED(MODULE_CORE_MSG_LOCKFREE)
+    if (_msg_send_lockfree(m, target_pid)) {
+        return 1;
+    }
+#endif
     return _msg_send(m, target_pid, false, irq_disable());
 }
 
-static int _msg_send(msg_t *m, kernel_pid_t target_pid, bool block,
-                     unsigned state)
+static int RIOT_HOT _msg_send(msg_t *m, kernel_pid_t target_pid, bool block,
+                              unsigned state)
 {
 #ifdef DEVELHELP
     if (!pid_is_valid(target_pid)) {
@@ -172,9 +322,12 @@ static int _msg_send(msg_t *m, kernel_pid_t target_pid, bool block,
         msg_t *target_message = target->wait_data;
         *target_message = *m;
         sched_set_status(target, STATUS_PENDING);
+        uint16_t target_prio = target->priority;
 
         irq_restore(state);
-        thread_yield_higher();
+        /* only switch if the receiver preempts us or we wait for a reply,
+         * a yield to ourselves costs a full pass through the scheduler */
+        sched_switch(target_prio);
     }
 
     return 1;
@@ -239,6 +392,81 @@ int msg_send_int(msg_t *m, kernel_pid_t target_pid)
     return res;
 }
 
+int msg_send_bulk(msg_t *m, unsigned n, kernel_pid_t target_pid)
+{
+    const bool in_irq = irq_is_in();
+    const kernel_pid_t sender_pid = (in_irq) ? KERNEL_PID_ISR
+                                             : thread_getpid();
+    thread_t *target = thread_get_unchecked(target_pid);
+    unsigned count = 0;
+
+    if (target == NULL) {
+        DEBUG("%s: target thread %d does not exist\n", __func__, target_pid);
+        return -1;
+    }
+
+    unsigned state = irq_disable();
+
+    if ((n > 0) && (target->status == STATUS_RECEIVE_BLOCKED)) {
+        DEBUG("%s: Direct msg copy from %" PRIkernel_pid " to %"
+              PRIkernel_pid ".\n", __func__, sender_pid, target_pid);
+        m[0].sender_pid = sender_pid;
+        *((msg_t *)target->wait_data) = m[0];
+        sched_set_status(target, STATUS_PENDING);
+        sched_context_switch_request = 1;
+        count++;
+    }
+    /* do not overtake senders that are blocked on a full queue */
+    if (target->msg_waiters.next == NULL) {
+        for (; count < n; count++) {
+            m[count].sender_pid = sender_pid;
+            if (!_queue_push(target, &m[count])) {
+                DEBUG("%s: message queue is full (or there is none)\n",
+                      __func__);
+                break;
+            }
+        }
+    }
+#if MODULE_CORE_THREAD_FLAGS
+    if (count > 0) {
+        target->flags |= THREAD_FLAG_MSG_WAITING;
+        thread_flags_wake(target);
+    }
+#endif
+
+    irq_restore(state);
+
+    if (sched_context_switch_request && !in_irq) {
+        thread_yield_higher();
+    }
+
+    return count;
+}
+
+int msg_send_multicast(msg_t *m, const kernel_pid_t *targets, unsigned n)
+{
+    const bool in_irq = irq_is_in();
+    int count = 0;
+
+    m->sender_pid = (in_irq) ? KERNEL_PID_ISR : thread_getpid();
+
+    unsigned state = irq_disable();
+
+    for (unsigned i = 0; i < n; i++) {
+        if (_msg_send_oneway(m, targets[i]) > 0) {
+            ++count;
+        }
+    }
+
+    irq_restore(state);
+
+    if (sched_context_switch_request && !in_irq) {
+        thread_yield_higher();
+    }
+
+    return count;
+}
+
 int msg_send_bus(msg_t *m, msg_bus_t *bus)
 {
     const bool in_irq = irq_is_in();
@@ -250,6 +478,16 @@ int msg_send_bus(msg_t *m, msg_bus_t *bus)
 
     unsigned state = irq_disable();
 
+#if IS_USED(MODULE_CORE_MSG_BUS_INDEX)
+    uint8_t slot;
+    for (unsigned slots = bus->event_slots[m->type & 0x1F]; slots;) {
+        slots = bitarithm_test_and_clear(slots, &slot);
+        if (_msg_send_oneway(m, bus->slots[slot]->pid) > 0) {
+            ++count;
+        }
+    }
+#endif
+
     for (list_node_t *e = bus->subs.next; e; e = e->next) {
         msg_bus_entry_t *subscriber = container_of(e, msg_bus_entry_t, next);
 
@@ -271,9 +509,29 @@ int msg_send_bus(msg_t *m, msg_bus_t *bus)
     return count;
 }
 
+#ifdef MODULE_CORE_MSG_PRIORITY_INHERITANCE
+static void _inherit_priority(thread_t *me, kernel_pid_t target_pid)
+{
+    thread_t *target = thread_get(target_pid);
+
+    me->msg_receiver_pid = KERNEL_PID_UNDEF;
+    if (target) {
+        /* recorded even if the receiver has a higher priority, a thread
+         * waiting for us may lend its priority along this chain later on */
+        me->msg_receiver_pid = target_pid;
+        me->msg_receiver_original_priority = target->priority;
+        /* the receiver only gets our priority, so this does not yield */
+        sched_inherit_priority(target, me->priority);
+    }
+}
+#endif
+
 int msg_send_receive(msg_t *m, msg_t *reply, kernel_pid_t target_pid)
 {
     assert(thread_getpid() != target_pid);
+#ifdef MODULE_CORE_MSG_PRIORITY_INHERITANCE
+    _inherit_priority(thread_get_active(), target_pid);
+#endif
     unsigned state = irq_disable();
     thread_t *me = thread_get_active();
 
@@ -312,7 +570,22 @@ int msg_reply(msg_t *m, msg_t *reply)
     sched_set_status(target, STATUS_PENDING);
     uint16_t target_prio = target->priority;
 
+#ifdef MODULE_CORE_MSG_PRIORITY_INHERITANCE
+    thread_t *me = thread_get_active();
+    bool inherited = (target->msg_receiver_pid == me->pid);
+    uint8_t original_prio = target->msg_receiver_original_priority;
+    if (inherited) {
+        target->msg_receiver_pid = KERNEL_PID_UNDEF;
+    }
+#endif
+
     irq_restore(state);
+#ifdef MODULE_CORE_MSG_PRIORITY_INHERITANCE
+    if (inherited && (me->priority != original_prio)) {
+        /* yields to the target, which now has a higher priority than us */
+        sched_change_priority(me, original_prio);
+    }
+#endif
     sched_switch(target_prio);
 
     return 1;
@@ -347,7 +620,38 @@ int msg_receive(msg_t *m)
     return _msg_receive(m, 1);
 }
 
-static int _msg_receive(msg_t *m, int block)
+static unsigned _msg_receive_queued(msg_t *m, unsigned count, unsigned n)
+{
+    thread_t *me = thread_get_active();
+
+    if (thread_has_msg_queue(me)) {
+        unsigned state = irq_disable();
+
+        /* blocked senders are left to _msg_receive() */
+        while ((count < n) && (me->msg_waiters.next == NULL) &&
+               (_queue_pop(me, &m[count]) > 0)) {
+            count++;
+        }
+        irq_restore(state);
+    }
+    return count;
+}
+
+int msg_receive_bulk(msg_t *m, unsigned n)
+{
+    assert(n > 0);
+
+    unsigned count = _msg_receive_queued(m, 0, n);
+
+    if (count == 0) {
+        _msg_receive(m, 1);
+        /* take what was queued while we were blocked */
+        count = _msg_receive_queued(m, 1, n);
+    }
+    return count;
+}
+
+static int RIOT_HOT _msg_receive(msg_t *m, int block)
 {
     unsigned state = irq_disable();
 
@@ -359,31 +663,35 @@ static int _msg_receive(msg_t *m, int block)
     int queue_index = -1;
 
     if (thread_has_msg_queue(me)) {
-        queue_index = cib_get(&(me->msg_queue));
+        queue_index = _queue_pop(me, m);
     }
 
+    /* a message that is still being written to the queue comes before
+     * the ones of blocked senders */
+    bool take_waiter = (queue_index != 0) && me->msg_waiters.next;
+
     /* no message, fail */
-    if ((!block) && ((!me->msg_waiters.next) && (queue_index == -1))) {
+    if ((!block) && (!take_waiter) && (queue_index <= 0)) {
         irq_restore(state);
         return -1;
     }
 
-    if (queue_index >= 0) {
+    if (queue_index > 0) {
         DEBUG("_msg_receive: %" PRIkernel_pid ": _msg_receive(): We've got a "
               "queued message.\n", thread_getpid());
-        *m = me->msg_array[queue_index];
     }
     else {
         me->wait_data = (void *)m;
     }
 
-    list_node_t *next = list_remove_head(&me->msg_waiters);
+    list_node_t *next = (take_waiter) ? list_remove_head(&me->msg_waiters)
+                                      : NULL;
 
     if (next == NULL) {
         DEBUG("_msg_receive: %" PRIkernel_pid ": _msg_receive(): No thread in "
               "waiting list.\n", thread_getpid());
 
-        if (queue_index < 0) {
+        if (queue_index <= 0) {
             DEBUG("_msg_receive(): %" PRIkernel_pid ": No msg in queue. Going "
                   "blocked.\n", thread_getpid());
             sched_set_status(me, STATUS_RECEIVE_BLOCKED);
@@ -407,16 +715,18 @@ static int _msg_receive(msg_t *m, int block)
         thread_t *sender =
             container_of((clist_node_t *)next, thread_t, rq_entry);
 
-        if (queue_index >= 0) {
+        /* copy msg */
+        msg_t *sender_msg = (msg_t *)sender->wait_data;
+
+        if (queue_index > 0) {
             /* We've already got a message from the queue. As there is a
              * waiter, take it's message into the just freed queue space.
              */
-            m = &(me->msg_array[cib_put(&(me->msg_queue))]);
+            _queue_push(me, sender_msg);
+        }
+        else {
+            *m = *sender_msg;
         }
-
-        /* copy msg */
-        msg_t *sender_msg = (msg_t *)sender->wait_data;
-        *m = *sender_msg;
 
         /* remove sender from queue */
         uint16_t sender_prio = THREAD_PRIORITY_IDLE;
@@ -481,6 +791,12 @@ void msg_init_queue(msg_t *array, int num)
 
     me->msg_array = array;
     cib_init(&(me->msg_queue), num);
+#if IS_USED(MODULE_CORE_MSG_LOCKFREE)
+    /* an undefined sender marks a slot as not yet written */
+    for (int i = 0; i < num; i++) {
+        array[i].sender_pid = KERNEL_PID_UNDEF;
+    }
+#endif
 }
 
 void msg_queue_print(void)
@@ -19,6 +19,8 @@
  * @}
  */
 
+#include <string.h>
+
 #include "irq.h"
 #include "msg_bus.h"
 #include "thread.h"
@@ -28,9 +30,59 @@ void msg_bus_init(msg_bus_t *bus)
     static uint16_t bus_count;
 
     bus->subs.next = NULL;
+#if IS_USED(MODULE_CORE_MSG_BUS_INDEX)
+    memset(bus->slots, 0, sizeof(bus->slots));
+    memset(bus->event_slots, 0, sizeof(bus->event_slots));
+#endif
     bus->id = bus_count++;
 }
 
+#if IS_USED(MODULE_CORE_MSG_BUS_INDEX)
+static bool _attach_slot(msg_bus_t *bus, msg_bus_entry_t *entry)
+{
+    entry->bus = bus;
+
+    for (unsigned i = 0; i < MSG_BUS_INDEX_SLOTS; i++) {
+        if (bus->slots[i] == NULL) {
+            bus->slots[i] = entry;
+            entry->slot = i;
+            return true;
+        }
+    }
+
+    entry->slot = MSG_BUS_INDEX_SLOTS;
+    return false;
+}
+
+static bool _detach_slot(msg_bus_t *bus, msg_bus_entry_t *entry)
+{
+    if (entry->slot >= MSG_BUS_INDEX_SLOTS) {
+        return false;
+    }
+
+    for (unsigned type = 0; type < ARRAY_SIZE(bus->event_slots); type++) {
+        bus->event_slots[type] &= ~(1U << entry->slot);
+    }
+    bus->slots[entry->slot] = NULL;
+
+    return true;
+}
+#else
+static inline bool _attach_slot(msg_bus_t *bus, msg_bus_entry_t *entry)
+{
+    (void)bus;
+    (void)entry;
+    return false;
+}
+
+static inline bool _detach_slot(msg_bus_t *bus, msg_bus_entry_t *entry)
+{
+    (void)bus;
+    (void)entry;
+    return false;
+}
+#endif
+
 void msg_bus_attach(msg_bus_t *bus, msg_bus_entry_t *entry)
 {
     unsigned state;
@@ -40,7 +92,9 @@ void msg_bus_attach(msg_bus_t *bus, msg_bus_entry_t *entry)
     entry->pid = thread_getpid();
 
     state = irq_disable();
-    list_add(&bus->subs, &entry->next);
+    if (!_attach_slot(bus, entry)) {
+        list_add(&bus->subs, &entry->next);
+    }
     irq_restore(state);
 }
 
@@ -49,7 +103,9 @@ void msg_bus_detach(msg_bus_t *bus, msg_bus_entry_t *entry)
     unsigned state;
 
     state = irq_disable();
-    list_remove(&bus->subs, &entry->next);
+    if (!_detach_slot(bus, entry)) {
+        list_remove(&bus->subs, &entry->next);
+    }
     irq_restore(state);
 }
 
@@ -58,6 +114,15 @@ msg_bus_entry_t *msg_bus_get_entry(msg_bus_t *bus)
     msg_bus_entry_t *s = NULL;
     unsigned state = irq_disable();
 
+#if IS_USED(MODULE_CORE_MSG_BUS_INDEX)
+    for (unsigned i = 0; i < MSG_BUS_INDEX_SLOTS; i++) {
+        if (bus->slots[i] && (bus->slots[i]->pid == thread_getpid())) {
+            irq_restore(state);
+            return bus->slots[i];
+        }
+    }
+#endif
+
     for (list_node_t *e = bus->subs.next; e; e = e->next) {
 
         msg_bus_entry_t *subscriber = container_of(e, msg_bus_entry_t, next);
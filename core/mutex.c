@@ -41,13 +41,19 @@
  * @post    IRQs are restored to @p irq_state
  * @post    The calling thread is no longer waiting for the mutex, either
  *          because it got the mutex, or because the operation was cancelled
- *          (only possible for @ref mutex_lock_cancelable)
+ *          (only possible for @ref mutex_lock_cancelable), or because the
+ *          mutex was released without handing it over (only possible with
+ *          module `core_mutex_no_handoff`)
+ *
+ * @retval  true    The mutex was handed over (or the operation was cancelled)
+ * @retval  false   The mutex was released without hand-over, the caller has
+ *                  to try to obtain it again
  *
  * Most applications don't use @ref mutex_lock_cancelable. Inlining this
  * function into both @ref mutex_lock and @ref mutex_lock_cancelable is,
  * therefore, beneficial for the majority of applications.
  */
-static inline __attribute__((always_inline)) void _block(mutex_t *mutex,
+static inline __attribute__((always_inline)) bool _block(mutex_t *mutex,
                                                          unsigned irq_state)
 {
     thread_t *me = thread_get_active();
@@ -66,20 +72,51 @@ static inline __attribute__((always_inline)) void _block(mutex_t *mutex,
         thread_add_to_list(&mutex->queue, me);
     }
 
+#if defined(MODULE_CORE_MUTEX_PRIORITY_INHERITANCE) || \
+    defined(MODULE_CORE_MUTEX_NO_HANDOFF)
+    /* lets the priority inheritance follow chains of blocked owners, with
+     * core_mutex_no_handoff the waker clears this if it releases the mutex
+     * instead of handing it over */
+    me->wait_data = mutex;
+#endif
+
 #ifdef MODULE_CORE_MUTEX_PRIORITY_INHERITANCE
-    thread_t *owner = thread_get(mutex->owner);
-    if ((owner) && (owner->priority > me->priority)) {
-        DEBUG("PID[%" PRIkernel_pid "] prio of %" PRIkernel_pid
-              ": %u --> %u\n",
-              thread_getpid(), mutex->owner,
-              (unsigned)owner->priority, (unsigned)me->priority);
-        sched_change_priority(owner, me->priority);
-    }
+    sched_inherit_priority(thread_get(mutex->owner), me->priority);
 #endif
 
     irq_restore(irq_state);
     thread_yield_higher();
     /* We were woken up by scheduler. Waker removed us from queue. */
+#ifdef MODULE_CORE_MUTEX_NO_HANDOFF
+    return me->wait_data != NULL;
+#else
+    return true;
+#endif
+}
+
+/**
+ * @brief   Pass the mutex on to @p process, which just has been removed from
+ *          the list of waiters
+ * @pre     IRQs are disabled
+ *
+ * Without module `core_mutex_no_handoff` the mutex stays locked and is now
+ * owned by @p process. With that module the mutex is released instead if
+ * @p process was the last waiter, so that the running thread can re-obtain
+ * it without blocking when it has to enter the critical section again
+ * before @p process gets scheduled. This avoids lock convoys between threads
+ * of the same priority.
+ */
+static inline void _hand_over(mutex_t *mutex, thread_t *process)
+{
+    if (!mutex->queue.next) {
+#ifdef MODULE_CORE_MUTEX_NO_HANDOFF
+        /* leave the mutex unlocked, process has to compete for it again */
+        process->wait_data = NULL;
+#else
+        (void)process;
+        mutex->queue.next = MUTEX_LOCKED;
+#endif
+    }
 }
 
 bool mutex_lock_internal(mutex_t *mutex, bool block)
@@ -89,26 +126,29 @@ bool mutex_lock_internal(mutex_t *mutex, bool block)
     DEBUG("PID[%" PRIkernel_pid "] mutex_lock_internal(block=%u).\n",
           thread_getpid(), (unsigned)block);
 
-    if (mutex->queue.next == NULL) {
-        /* mutex is unlocked. */
-        mutex->queue.next = MUTEX_LOCKED;
-#ifdef MODULE_CORE_MUTEX_PRIORITY_INHERITANCE
-        thread_t *me = thread_get_active();
-        mutex->owner = me->pid;
-        mutex->owner_original_priority = me->priority;
-#endif
-        DEBUG("PID[%" PRIkernel_pid "] mutex_lock(): early out.\n",
-              thread_getpid());
-        irq_restore(irq_state);
-    }
-    else {
+    while (mutex->queue.next != NULL) {
         if (!block) {
             irq_restore(irq_state);
             return false;
         }
-        _block(mutex, irq_state);
+        if (_block(mutex, irq_state)) {
+            return true;
+        }
+        /* mutex was released without hand-over, try again */
+        irq_state = irq_disable();
     }
 
+    /* mutex is unlocked. */
+    mutex->queue.next = MUTEX_LOCKED;
+#ifdef MODULE_CORE_MUTEX_PRIORITY_INHERITANCE
+    thread_t *me = thread_get_active();
+    mutex->owner = me->pid;
+    mutex->owner_original_priority = me->priority;
+#endif
+    DEBUG("PID[%" PRIkernel_pid "] mutex_lock(): early out.\n",
+          thread_getpid());
+    irq_restore(irq_state);
+
     return true;
 }
 
@@ -128,27 +168,33 @@ int mutex_lock_cancelable(mutex_cancel_t *mc)
 
     mutex_t *mutex = mc->mutex;
 
-    if (mutex->queue.next == NULL) {
-        /* mutex is unlocked. */
-        mutex->queue.next = MUTEX_LOCKED;
-#ifdef MODULE_CORE_MUTEX_PRIORITY_INHERITANCE
-        thread_t *me = thread_get_active();
-        mutex->owner = me->pid;
-        mutex->owner_original_priority = me->priority;
-#endif
-        DEBUG("PID[%" PRIkernel_pid "] mutex_lock_cancelable() early out.\n",
-              thread_getpid());
-        irq_restore(irq_state);
-        return 0;
-    }
-    else {
-        _block(mutex, irq_state);
+    while (mutex->queue.next != NULL) {
+        if (_block(mutex, irq_state) || mc->cancelled) {
+            if (mc->cancelled) {
+                DEBUG("PID[%" PRIkernel_pid "] mutex_lock_cancelable() "
+                      "cancelled.\n", thread_getpid());
+            }
+            return (mc->cancelled) ? -ECANCELED : 0;
+        }
+        /* mutex was released without hand-over, try again */
+        irq_state = irq_disable();
         if (mc->cancelled) {
-            DEBUG("PID[%" PRIkernel_pid "] mutex_lock_cancelable() "
-                  "cancelled.\n", thread_getpid());
+            irq_restore(irq_state);
+            return -ECANCELED;
         }
-        return (mc->cancelled) ? -ECANCELED : 0;
     }
+
+    /* mutex is unlocked. */
+    mutex->queue.next = MUTEX_LOCKED;
+#ifdef MODULE_CORE_MUTEX_PRIORITY_INHERITANCE
+    thread_t *me = thread_get_active();
+    mutex->owner = me->pid;
+    mutex->owner_original_priority = me->priority;
+#endif
+    DEBUG("PID[%" PRIkernel_pid "] mutex_lock_cancelable() early out.\n",
+          thread_getpid());
+    irq_restore(irq_state);
+    return 0;
 }
 
 void mutex_unlock(mutex_t *mutex)
@@ -178,10 +224,7 @@ void mutex_unlock(mutex_t *mutex)
     DEBUG("PID[%" PRIkernel_pid "] mutex_unlock(): waking up waiting thread %"
           PRIkernel_pid "\n", thread_getpid(),  process->pid);
     sched_set_status(process, STATUS_PENDING);
-
-    if (!mutex->queue.next) {
-        mutex->queue.next = MUTEX_LOCKED;
-    }
+    _hand_over(mutex, process);
 
     uint16_t process_priority = process->priority;
 
@@ -193,6 +236,9 @@ void mutex_unlock(mutex_t *mutex)
               (unsigned)owner->priority, (unsigned)owner->priority);
         sched_change_priority(owner, mutex->owner_original_priority);
     }
+    /* the chain of blocked owners has to continue at the new owner */
+    mutex->owner = process->pid;
+    mutex->owner_original_priority = process->priority;
 #endif
 
     irq_restore(irqstate);
@@ -216,9 +262,11 @@ void mutex_unlock_and_sleep(mutex_t *mutex)
             DEBUG("PID[%" PRIkernel_pid "] mutex_unlock_and_sleep(): waking up "
                   "waiter.\n", process->pid);
             sched_set_status(process, STATUS_PENDING);
-            if (!mutex->queue.next) {
-                mutex->queue.next = MUTEX_LOCKED;
-            }
+            _hand_over(mutex, process);
+#ifdef MODULE_CORE_MUTEX_PRIORITY_INHERITANCE
+            mutex->owner = process->pid;
+            mutex->owner_original_priority = process->priority;
+#endif
         }
     }
 
@@ -31,6 +31,9 @@
 #include "sched.h"
 #include "thread.h"
 #include "panic.h"
+#include "list.h"
+#include "mutex.h"
+#include "tracepoint.h"
 
 #ifdef MODULE_MPU_STACK_GUARD
 #include "mpu.h"
@@ -60,7 +63,7 @@ volatile kernel_pid_t sched_active_pid = KERNEL_PID_UNDEF;
 volatile thread_t *sched_threads[KERNEL_PID_LAST + 1];
 volatile int sched_num_threads = 0;
 
-static_assert(SCHED_PRIO_LEVELS <= 32, "SCHED_PRIO_LEVELS may at most be 32");
+static_assert(SCHED_PRIO_LEVELS <= 128, "SCHED_PRIO_LEVELS may at most be 128");
 
 FORCE_USED_SECTION
 const uint8_t max_threads = ARRAY_SIZE(sched_threads);
@@ -79,6 +82,19 @@ volatile unsigned int sched_context_switch_request;
 clist_node_t sched_runqueues[SCHED_PRIO_LEVELS];
 static uint32_t runqueue_bitcache = 0;
 
+#if SCHED_PRIO_LEVELS > 32
+/**
+ * @brief   Number of 32 bit groups the priority levels are split into
+ */
+#define RUNQUEUE_GROUPS     ((SCHED_PRIO_LEVELS + 31) / 32)
+
+/* With more than 32 priority levels, one bit per priority level is kept in
+ * runqueue_groups, and runqueue_bitcache has one bit per group in which at
+ * least one run queue is non-empty. Finding the highest priority run queue
+ * thus still is two bit scans. */
+static uint32_t runqueue_groups[RUNQUEUE_GROUPS];
+#endif
+
 #ifdef MODULE_SCHED_CB
 static void (*sched_cb)(kernel_pid_t active_thread,
                         kernel_pid_t next_thread) = NULL;
@@ -91,30 +107,54 @@ static void (*sched_cb)(kernel_pid_t active_thread,
  * and readout away, switching between the two orders depending on the CLZ
  * instruction availability
  */
-static inline void _set_runqueue_bit(uint8_t priority)
+static inline uint32_t _runqueue_bit(unsigned idx)
 {
 #if defined(BITARITHM_HAS_CLZ)
-    runqueue_bitcache |= BIT31 >> priority;
+    return BIT31 >> idx;
 #else
-    runqueue_bitcache |= 1UL << priority;
+    return 1UL << idx;
 #endif
 }
 
-static inline void _clear_runqueue_bit(uint8_t priority)
+static inline unsigned _runqueue_first(uint32_t bitcache)
 {
 #if defined(BITARITHM_HAS_CLZ)
-    runqueue_bitcache &= ~(BIT31 >> priority);
+    return 31 - bitarithm_msb(bitcache);
+#else
+    return bitarithm_lsb(bitcache);
+#endif
+}
+
+static inline void _set_runqueue_bit(uint8_t priority)
+{
+#if SCHED_PRIO_LEVELS > 32
+    runqueue_groups[priority >> 5] |= _runqueue_bit(priority & 31);
+    runqueue_bitcache |= _runqueue_bit(priority >> 5);
+#else
+    runqueue_bitcache |= _runqueue_bit(priority);
+#endif
+}
+
+static inline void _clear_runqueue_bit(uint8_t priority)
+{
+#if SCHED_PRIO_LEVELS > 32
+    runqueue_groups[priority >> 5] &= ~_runqueue_bit(priority & 31);
+    if (!runqueue_groups[priority >> 5]) {
+        runqueue_bitcache &= ~_runqueue_bit(priority >> 5);
+    }
 #else
-    runqueue_bitcache &= ~(1UL << priority);
+    runqueue_bitcache &= ~_runqueue_bit(priority);
 #endif
 }
 
 static inline unsigned _get_prio_queue_from_runqueue(void)
 {
-#if defined(BITARITHM_HAS_CLZ)
-    return 31 - bitarithm_msb(runqueue_bitcache);
+#if SCHED_PRIO_LEVELS > 32
+    unsigned group = _runqueue_first(runqueue_bitcache);
+
+    return (group << 5) + _runqueue_first(runqueue_groups[group]);
 #else
-    return bitarithm_lsb(runqueue_bitcache);
+    return _runqueue_first(runqueue_bitcache);
 #endif
 }
 
@@ -144,7 +184,7 @@ static void _unschedule(thread_t *active_thread)
 #endif
 }
 
-thread_t *__attribute__((used)) sched_run(void)
+thread_t *__attribute__((used)) RIOT_HOT sched_run(void)
 {
     thread_t *active_thread = thread_get_active();
     thread_t *previous_thread = active_thread;
@@ -177,6 +217,8 @@ thread_t *__attribute__((used)) sched_run(void)
                        : active_thread->pid),
         next_thread->pid);
 
+    TRACEPOINT(sched_run, next_thread->pid);
+
     next_thread->status = STATUS_RUNNING;
 
     if (previous_thread == next_thread) {
@@ -201,6 +243,15 @@ thread_t *__attribute__((used)) sched_run(void)
         sched_active_pid = next_thread->pid;
         sched_active_thread = next_thread;
 
+#ifdef MODULE_CORE_STACK_WATERMARK
+        /* The context of next_thread was saved onto its stack when it got
+         * switched out, so its stored SP is the deepest point of that switch.
+         * The SP of the outgoing thread is not stored yet on all platforms. */
+        if (next_thread->sp < next_thread->sp_min) {
+            next_thread->sp_min = next_thread->sp;
+        }
+#endif
+
 #ifdef MODULE_SCHED_CB
         if (sched_cb) {
             sched_cb(KERNEL_PID_UNDEF, next_thread->pid);
@@ -260,6 +311,11 @@ static inline __attribute__((always_inline)) void _runqueue_pop(thread_t *thread
         sched_runq_callback(thread->priority);
 #endif
     }
+#if (IS_USED(MODULE_SCHED_RUNQ_CALLBACK))
+    else if (clist_exactly_one(&sched_runqueues[thread->priority])) {
+        sched_runq_callback(thread->priority);
+    }
+#endif
 }
 
 void sched_set_status(thread_t *process, thread_status_t status)
@@ -332,6 +388,50 @@ void sched_register_cb(void (*callback)(kernel_pid_t, kernel_pid_t))
 }
 #endif
 
+#if defined(MODULE_CORE_MUTEX_PRIORITY_INHERITANCE) || \
+    defined(MODULE_CORE_MSG_PRIORITY_INHERITANCE)
+/* must be called with IRQs disabled */
+static thread_t *_blocked_by(thread_t *thread)
+{
+#ifdef MODULE_CORE_MUTEX_PRIORITY_INHERITANCE
+    if (thread->status == STATUS_MUTEX_BLOCKED) {
+        mutex_t *mutex = thread->wait_data;
+        /* keep the waiters sorted by their new priority */
+        list_remove(&mutex->queue, (list_node_t *)&thread->rq_entry);
+        thread_add_to_list(&mutex->queue, thread);
+        return thread_get(mutex->owner);
+    }
+#endif
+#ifdef MODULE_CORE_MSG_PRIORITY_INHERITANCE
+    if (thread->status == STATUS_REPLY_BLOCKED) {
+        return thread_get(thread->msg_receiver_pid);
+    }
+#endif
+    return NULL;
+}
+
+void sched_inherit_priority(thread_t *thread, uint8_t priority)
+{
+    unsigned irq_state = irq_disable();
+
+    for (unsigned i = 0; thread && (i < CONFIG_SCHED_PRIORITY_INHERITANCE_DEPTH);
+         i++) {
+        if (thread->priority <= priority) {
+            break;
+        }
+        DEBUG("sched_inherit_priority: prio of %" PRIkernel_pid
+              ": %u --> %u\n", thread->pid, (unsigned)thread->priority,
+              (unsigned)priority);
+        /* the calling thread has at least this priority, so this never
+         * yields */
+        sched_change_priority(thread, priority);
+        thread = _blocked_by(thread);
+    }
+
+    irq_restore(irq_state);
+}
+#endif
+
 void sched_change_priority(thread_t *thread, uint8_t priority)
 {
     assert(thread && (priority < SCHED_PRIO_LEVELS));
@@ -196,7 +196,7 @@ kernel_pid_t thread_create(char *stack, int stacksize, uint8_t priority,
         return -EINVAL;
     }
 
-#ifdef DEVELHELP
+#if defined(DEVELHELP) || defined(MODULE_CORE_STACK_WATERMARK)
     int total_stacksize = stacksize;
 #endif
 #ifndef CONFIG_THREAD_NAMES
@@ -275,13 +275,19 @@ kernel_pid_t thread_create(char *stack, int stacksize, uint8_t priority,
     thread->sp = thread_stack_init(function, arg, stack, stacksize);
 
 #if defined(DEVELHELP) || IS_ACTIVE(SCHED_TEST_STACK) || \
-    defined(MODULE_MPU_STACK_GUARD)
+    defined(MODULE_MPU_STACK_GUARD) || defined(MODULE_CORE_STACK_WATERMARK)
     thread->stack_start = stack;
 #endif
 
-#ifdef DEVELHELP
+#if defined(DEVELHELP) || defined(MODULE_CORE_STACK_WATERMARK)
     thread->stack_size = total_stacksize;
 #endif
+#ifdef MODULE_CORE_STACK_WATERMARK
+    thread->sp_min = thread->sp;
+#endif
+#ifdef MODULE_CORE_MSG_PRIORITY_INHERITANCE
+    thread->msg_receiver_pid = KERNEL_PID_UNDEF;
+#endif
 #ifdef CONFIG_THREAD_NAMES
     thread->name = name;
 #endif
@@ -142,6 +142,17 @@ thread_flags_t thread_flags_wait_all(thread_flags_t mask)
     return _thread_flags_clear_atomic(me, mask);
 }
 
+void thread_flags_set_deferred(thread_t *thread, thread_flags_t mask)
+{
+    DEBUG("thread_flags_set_deferred(): setting 0x%08x for pid %" PRIkernel_pid "\n",
+          mask, thread->pid);
+    unsigned state = irq_disable();
+
+    thread->flags |= mask;
+    _thread_flags_wake(thread);
+    irq_restore(state);
+}
+
 void thread_flags_set(thread_t *thread, thread_flags_t mask)
 {
     DEBUG("thread_flags_set(): setting 0x%08x for pid %" PRIkernel_pid "\n",
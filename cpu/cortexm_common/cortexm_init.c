@@ -81,6 +81,10 @@ void cortexm_init(void)
 
     cortexm_init_isr_priorities();
     cortexm_init_misc();
+
+#ifdef MODULE_CORTEXM_IRQ_STATS
+    irq_stats_init();
+#endif
 }
 
 bool cpu_check_address(volatile const char *address)
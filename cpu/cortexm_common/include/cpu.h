@@ -97,9 +97,36 @@ static inline void cortexm_init_fpu(void)
 #if (defined(CPU_CORE_CORTEX_M33) || defined(CPU_CORE_CORTEX_M4F) || defined(CPU_CORE_CORTEX_M7)) && defined(MODULE_CORTEXM_FPU)
     /* give full access to the FPU */
     SCB->CPACR |= (uint32_t)CORTEXM_SCB_CPACR_FPU_ACCESS_FULL;
+    /* track FPU usage per thread and defer stacking of s0-s15 until an ISR
+     * actually uses the FPU (the reset default, but bootloaders may change
+     * it) */
+    FPU->FPCCR |= FPU_FPCCR_ASPEN_Msk | FPU_FPCCR_LSPEN_Msk;
 #endif
 }
 
+#if defined(MODULE_CORTEXM_FPU) || defined(DOXYGEN)
+/**
+ * @brief   Drop the floating point context of the calling thread
+ *
+ * Once a thread executed a floating point instruction, every context switch
+ * of it saves and restores the floating point registers. Threads that use the
+ * FPU only occasionally can call this function when they are done with it, so
+ * that their context switches are as cheap as those of integer-only threads
+ * again. The next floating point instruction re-establishes the context.
+ *
+ * @warning The contents of all floating point registers are lost. Only call
+ *          this function while no floating point value is live, e.g. not from
+ *          a function whose callers keep a floating point value across the
+ *          call.
+ */
+static inline void cortexm_fpu_release(void)
+{
+    __set_FPSCR(0);
+    __set_CONTROL(__get_CONTROL() & ~(CONTROL_FPCA_Msk));
+    __ISB();
+}
+#endif
+
 #if defined(CPU_CORTEXM_INIT_SUBFUNCTIONS) || defined(DOXYGEN)
 
 /**
@@ -23,10 +23,27 @@
 #include <stdint.h>
 #include "cpu_conf.h"
 
+#ifdef MODULE_CORTEXM_IRQ_STATS
+#include "irq_stats.h"
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+#if defined(MODULE_CORTEXM_IRQ_STATS) || defined(DOXYGEN)
+/**
+ * @brief   Get the address the calling code is located at
+ */
+static inline __attribute__((always_inline)) uintptr_t _irq_stats_pc(void)
+{
+    uintptr_t pc;
+
+    __asm__ volatile ("mov %0, pc" : "=r" (pc));
+    return pc;
+}
+#endif
+
 /**
  * @brief Disable all maskable interrupts
  */
@@ -35,6 +52,11 @@ static inline __attribute__((always_inline)) unsigned int irq_disable(void)
     uint32_t mask = __get_PRIMASK();
 
     __disable_irq();
+#ifdef MODULE_CORTEXM_IRQ_STATS
+    if (!mask) {
+        irq_stats_off_begin(_irq_stats_pc());
+    }
+#endif
     return mask;
 }
 
@@ -46,6 +68,11 @@ irq_enable(void)
 {
     unsigned result = __get_PRIMASK();
 
+#ifdef MODULE_CORTEXM_IRQ_STATS
+    if (result) {
+        irq_stats_off_end();
+    }
+#endif
     __enable_irq();
     return result;
 }
@@ -56,6 +83,11 @@ irq_enable(void)
 static inline __attribute__((always_inline)) void irq_restore(
     unsigned int state)
 {
+#ifdef MODULE_CORTEXM_IRQ_STATS
+    if (!state && __get_PRIMASK()) {
+        irq_stats_off_end();
+    }
+#endif
     __set_PRIMASK(state);
 }
 
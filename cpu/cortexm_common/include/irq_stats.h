@@ -0,0 +1,126 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser General
+ * Public License v2.1. See the file LICENSE in the top level directory for more
+ * details.
+ */
+
+/**
+ * @defgroup    cpu_cortexm_irq_stats Cortex-M ISR and IRQ-off time statistics
+ * @ingroup     cpu_cortexm_common
+ * @brief       Measures how long ISRs run and how long IRQs stay disabled
+ *
+ * With module `cortexm_irq_stats`, the vector table is copied to RAM and all
+ * hardware interrupts are routed through a common entry function that
+ * measures the duration of the original ISR with the DWT cycle counter. Per
+ * interrupt, the number of calls, the longest duration and a histogram of
+ * durations is kept.
+ *
+ * In addition, @ref irq_disable, @ref irq_enable and @ref irq_restore keep
+ * track of the longest time IRQs were disabled, together with the address of
+ * the @ref irq_disable call that started it.
+ *
+ * The statistics can be printed with @ref irq_stats_print, or by the shell
+ * command `irqstats` (module `shell_cmd_irq_stats`).
+ *
+ * @note    Durations of ISRs include the time spent in ISRs of a higher
+ *          priority that preempted them.
+ * @note    This needs the DWT cycle counter, so ARMv6-M (Cortex-M0(+)) and
+ *          ARMv8-M baseline (Cortex-M23) CPUs are not supported.
+ * @{
+ *
+ * @file
+ * @brief       Cortex-M ISR and IRQ-off time statistics
+ */
+
+#ifndef IRQ_STATS_H
+#define IRQ_STATS_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Number of histogram buckets for ISR durations
+ *
+ * Bucket 0 counts ISRs that took less than 64 CPU cycles, each following
+ * bucket covers twice the range of the previous one. The last bucket counts
+ * all ISRs that took longer.
+ */
+#ifndef CONFIG_CORTEXM_IRQ_STATS_BUCKETS
+#define CONFIG_CORTEXM_IRQ_STATS_BUCKETS    (8U)
+#endif
+
+/**
+ * @brief   Statistics of a single interrupt
+ */
+typedef struct {
+    uint32_t count;         /**< number of times the ISR was run */
+    uint32_t max;           /**< longest duration in CPU cycles */
+    uint16_t hist[CONFIG_CORTEXM_IRQ_STATS_BUCKETS];  /**< histogram of
+                                                           durations,
+                                                           saturating */
+} irq_stats_isr_t;
+
+/**
+ * @brief   Route all interrupts through the measurement code
+ *
+ * This is called by `cortexm_init()`.
+ */
+void irq_stats_init(void);
+
+/**
+ * @brief   Get the statistics of an interrupt
+ *
+ * @param[in]   irqn    interrupt number, as used with the NVIC
+ *
+ * @return  statistics of @p irqn
+ */
+const irq_stats_isr_t *irq_stats_get(unsigned irqn);
+
+/**
+ * @brief   Get the longest time IRQs were disabled
+ *
+ * @param[out]  pc      if not NULL, address of the @ref irq_disable call that
+ *                      disabled IRQs for that long
+ *
+ * @return  longest IRQ-off time in CPU cycles
+ */
+uint32_t irq_stats_off_max(uintptr_t *pc);
+
+/**
+ * @brief   Reset all statistics
+ */
+void irq_stats_reset(void);
+
+/**
+ * @brief   Print the statistics of all interrupts that occurred and the
+ *          longest IRQ-off time to stdout
+ */
+void irq_stats_print(void);
+
+/**
+ * @brief   Mark the start of a period with IRQs disabled
+ *
+ * @internal    Used by @ref irq_disable
+ *
+ * @param[in]   pc      address the IRQs got disabled at
+ */
+void irq_stats_off_begin(uintptr_t pc);
+
+/**
+ * @brief   Mark the end of a period with IRQs disabled
+ *
+ * @internal    Used by @ref irq_enable and @ref irq_restore
+ */
+void irq_stats_off_end(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* IRQ_STATS_H */
+/** @} */
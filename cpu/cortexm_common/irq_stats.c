@@ -0,0 +1,182 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser General
+ * Public License v2.1. See the file LICENSE in the top level directory for more
+ * details.
+ */
+
+/**
+ * @ingroup     cpu_cortexm_irq_stats
+ * @{
+ *
+ * @file
+ * @brief       Cortex-M ISR and IRQ-off time statistics
+ *
+ * @}
+ */
+
+#ifdef MODULE_CORTEXM_IRQ_STATS
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "bitarithm.h"
+#include "cpu.h"
+#include "irq_stats.h"
+#include "vectors_cortexm.h"
+
+#ifndef DWT_CTRL_CYCCNTENA_Msk
+#error "cortexm_irq_stats: this CPU has no DWT cycle counter"
+#endif
+
+/**
+ * @brief   Number of entries in the vector table, including the stack pointer
+ */
+#define VECTORS_NUMOF       (1 + CPU_NONISR_EXCEPTIONS + CPU_IRQ_NUMOF)
+
+/**
+ * @brief   The vector table needs to be aligned to its size, rounded up to the
+ *          next power of two
+ */
+#if VECTORS_NUMOF <= 32
+#define VECTORS_ALIGN       (128)
+#elif VECTORS_NUMOF <= 64
+#define VECTORS_ALIGN       (256)
+#elif VECTORS_NUMOF <= 128
+#define VECTORS_ALIGN       (512)
+#else
+#define VECTORS_ALIGN       (1024)
+#endif
+
+/**
+ * @brief   Interrupt vector base address, defined by the linker
+ */
+extern const void *_isr_vectors;
+
+static isr_t _vectors[VECTORS_NUMOF] __attribute__((aligned(VECTORS_ALIGN)));
+static irq_stats_isr_t _stats[CPU_IRQ_NUMOF];
+
+static uint32_t _off_start;
+static uintptr_t _off_pc;
+static uint32_t _off_max;
+static uintptr_t _off_max_pc;
+
+static void _isr_entry(void)
+{
+    unsigned vector = __get_IPSR() & IPSR_ISR_Msk;
+    irq_stats_isr_t *stats = &_stats[vector - CPU_NONISR_EXCEPTIONS - 1];
+    const isr_t *orig = (const isr_t *)&_isr_vectors;
+    uint32_t start = DWT->CYCCNT;
+
+    orig[vector]();
+
+    uint32_t duration = DWT->CYCCNT - start;
+    unsigned bucket = (duration < 64) ? 0 : bitarithm_msb(duration) - 5;
+
+    if (bucket >= CONFIG_CORTEXM_IRQ_STATS_BUCKETS) {
+        bucket = CONFIG_CORTEXM_IRQ_STATS_BUCKETS - 1;
+    }
+
+    /* IPSR is per priority level, so no other ISR is updating this */
+    stats->count++;
+    if (duration > stats->max) {
+        stats->max = duration;
+    }
+    if (stats->hist[bucket] < UINT16_MAX) {
+        stats->hist[bucket]++;
+    }
+}
+
+void irq_stats_init(void)
+{
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = 0;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+    /* keep stack pointer and system exceptions, hook all interrupts */
+    memcpy(_vectors, &_isr_vectors,
+           (1 + CPU_NONISR_EXCEPTIONS) * sizeof(isr_t));
+    for (unsigned i = 1 + CPU_NONISR_EXCEPTIONS; i < VECTORS_NUMOF; i++) {
+        _vectors[i] = _isr_entry;
+    }
+
+    __DSB();
+    SCB->VTOR = (uint32_t)_vectors;
+    __DSB();
+    __ISB();
+}
+
+const irq_stats_isr_t *irq_stats_get(unsigned irqn)
+{
+    return &_stats[irqn];
+}
+
+void irq_stats_off_begin(uintptr_t pc)
+{
+    _off_start = DWT->CYCCNT;
+    _off_pc = pc;
+}
+
+void irq_stats_off_end(void)
+{
+    uint32_t duration = DWT->CYCCNT - _off_start;
+
+    if (duration > _off_max) {
+        _off_max = duration;
+        _off_max_pc = _off_pc;
+    }
+}
+
+uint32_t irq_stats_off_max(uintptr_t *pc)
+{
+    unsigned state = irq_disable();
+    uint32_t res = _off_max;
+
+    if (pc) {
+        *pc = _off_max_pc;
+    }
+    irq_restore(state);
+
+    return res;
+}
+
+void irq_stats_reset(void)
+{
+    unsigned state = irq_disable();
+
+    memset(_stats, 0, sizeof(_stats));
+    _off_max = 0;
+    _off_max_pc = 0;
+    irq_restore(state);
+}
+
+void irq_stats_print(void)
+{
+    printf("%4s %10s %10s  histogram (< 64, < 128, ... cycles)\n",
+           "irq", "count", "max");
+    for (unsigned i = 0; i < CPU_IRQ_NUMOF; i++) {
+        unsigned state = irq_disable();
+        irq_stats_isr_t stats = _stats[i];
+        irq_restore(state);
+
+        if (!stats.count) {
+            continue;
+        }
+        printf("%4u %10" PRIu32 " %10" PRIu32 " ", i, stats.count, stats.max);
+        for (unsigned j = 0; j < CONFIG_CORTEXM_IRQ_STATS_BUCKETS; j++) {
+            printf(" %5u", (unsigned)stats.hist[j]);
+        }
+        puts("");
+    }
+
+    uintptr_t pc;
+    uint32_t off_max = irq_stats_off_max(&pc);
+    printf("max IRQ off: %" PRIu32 " cycles, disabled at %p\n",
+           off_max, (void *)pc);
+}
+
+#else
+typedef int dont_be_pedantic;
+#endif /* MODULE_CORTEXM_IRQ_STATS */
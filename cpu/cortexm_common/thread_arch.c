@@ -82,8 +82,12 @@
  * | R8   | <- lowest address (top of stack)
  * --------
  *
- * TODO: Implement handling of FPU registers for Cortex-M4 CPUs
- *
+ * With the `cortexm_fpu` module, the FPU registers s16-s31 are saved between
+ * R0 and RET for threads that have an active floating point context, i.e. whose
+ * exception return code has bit 4 cleared. The hardware tracks this per thread
+ * and stacks s0-s15 and FPSCR lazily. Threads that are done with the FPU can
+ * drop their context with @ref cortexm_fpu_release so that the FPU registers
+ * are no longer saved on their context switches.
  *
  * @author      Stefan Pfeiffer <stefan.pfeiffer@fu-berlin.de>
  * @author      Hauke Petersen <hauke.petersen@fu-berlin.de>
@@ -288,8 +292,7 @@ void NORETURN cpu_switch_context_exit(void)
      * which in turn causes `isr_pendsv` to skip all FPU storing/restoring.
      * That might lead to this thread's FPU lazy stacking / FPCAR to stay active.
      */
-    __set_FPSCR(0);
-    __set_CONTROL(__get_CONTROL() & (~(CONTROL_FPCA_Msk)));
+    cortexm_fpu_release();
 #endif
 
     /* enable IRQs to make sure the PENDSV interrupt is reachable */
@@ -301,7 +304,7 @@ void NORETURN cpu_switch_context_exit(void)
 }
 
 #if CPU_CORE_CORTEXM_FULL_THUMB
-void __attribute__((naked)) __attribute__((used)) isr_pendsv(void) {
+void __attribute__((naked)) __attribute__((used)) RIOT_HOT isr_pendsv(void) {
     __asm__ volatile (
     /* PendSV handler entry point */
     /* save context by pushing unsaved registers to the stack */
@@ -362,7 +365,7 @@ void __attribute__((naked)) __attribute__((used)) isr_pendsv(void) {
     );
 }
 #else /* CPU_CORE_CORTEXM_FULL_THUMB */
-void __attribute__((naked)) __attribute__((used)) isr_pendsv(void) {
+void __attribute__((naked)) __attribute__((used)) RIOT_HOT isr_pendsv(void) {
     __asm__ volatile (
     /* PendSV handler entry point */
     /* save context by pushing unsaved registers to the stack */
@@ -161,6 +161,9 @@ void reset_handler_default(void)
 #endif /* CPU_HAS_BACKUP_RAM */
 
 #ifdef MODULE_MPU_NOEXEC_RAM
+#  ifdef MODULE_CORE_RAMFUNC
+#    error "core_ramfunc executes code from RAM, which mpu_noexec_ram forbids"
+#  endif
     /* This marks the memory region from 0x20000000 to 0x3FFFFFFF as non
      * executable. This is the Cortex-M SRAM region used for on-chip RAM.
      */
@@ -56,7 +56,6 @@
 #error Board definition does not provide EMAC configuration
 #endif
 
-#define SYSTEM_EVENT_ETH_RX_DONE    (SYSTEM_EVENT_MAX + 1)
 #define SYSTEM_EVENT_ETH_TX_DONE    (SYSTEM_EVENT_MAX + 2)
 
 #define EMAC_PHY_CLOCK_DELAY_MS     (500)
@@ -100,14 +99,28 @@ static esp_err_t IRAM_ATTR _eth_input_callback(esp_eth_handle_t hdl,
 
     mutex_lock(&_esp_eth_dev.dev_lock);
 
-    memcpy(_esp_eth_dev.rx_buf, buffer, len);
+    /* the ISR handler passes up all queued frames, so it only needs to be
+     * scheduled for the first frame of a burst */
+    bool idle = !cib_avail(&_esp_eth_dev.rx_cib);
+    int idx = cib_put(&_esp_eth_dev.rx_cib);
+
     /* buffer is allocated by the `emac_esp32_rx_task` upon receipt of a
      * MAC frame and is forwarded to the consumer who responsible for
-     * freeing the buffer. */
-    free(buffer);
-    _esp_eth_dev.rx_len = len;
-    _esp_eth_dev.event = SYSTEM_EVENT_ETH_RX_DONE;
-    netdev_trigger_event_isr(&_esp_eth_dev.netdev);
+     * freeing the buffer. It is kept until the upper layer read the frame. */
+    if (idx < 0) {
+        DEBUG("%s: receive queue full, dropping frame\n", __func__);
+        free(buffer);
+        if (_esp_eth_dev.rx_overruns < UINT16_MAX) {
+            _esp_eth_dev.rx_overruns++;
+        }
+    }
+    else {
+        _esp_eth_dev.rx_queue[idx].buf = buffer;
+        _esp_eth_dev.rx_queue[idx].len = len;
+    }
+    if (idle) {
+        netdev_trigger_event_isr(&_esp_eth_dev.netdev);
+    }
 
     mutex_unlock(&_esp_eth_dev.dev_lock);
 
@@ -268,6 +281,15 @@ static int _esp_eth_send(netdev_t *netdev, const iolist_t *iolist)
     return ret;
 }
 
+/* drops the oldest frame of the receive queue, dev_lock must be held */
+static void _rx_queue_drop(esp_eth_netdev_t *dev)
+{
+    int idx = cib_get(&dev->rx_cib);
+
+    assert(idx >= 0);
+    free(dev->rx_queue[idx].buf);
+}
+
 static int _esp_eth_recv(netdev_t *netdev, void *buf, size_t len, void *info)
 {
     DEBUG("%s: netdev=%p buf=%p len=%u info=%p\n",
@@ -279,36 +301,46 @@ static int _esp_eth_recv(netdev_t *netdev, void *buf, size_t len, void *info)
 
     mutex_lock(&dev->dev_lock);
 
-    int size = dev->rx_len;
+    int idx = cib_peek(&dev->rx_cib);
+
+    if (idx < 0) {
+        /* no frame received */
+        mutex_unlock(&dev->dev_lock);
+        return 0;
+    }
+
+    esp_eth_rx_frame_t *frame = &dev->rx_queue[idx];
+    int size = frame->len;
 
     if (!buf) {
         /* get the size of the frame; if len > 0 then also drop the frame */
         if (len > 0) {
             /* drop frame requested */
-            dev->rx_len = 0;
+            _rx_queue_drop(dev);
         }
         mutex_unlock(&dev->dev_lock);
         return size;
     }
 
-    if (dev->rx_len > len) {
+    if (frame->len > len) {
         /* buffer is smaller than the number of received bytes */
         DEBUG("%s: Not enough space in receive buffer for %d bytes\n",
-              __func__, dev->rx_len);
+              __func__, frame->len);
+        _rx_queue_drop(dev);
         mutex_unlock(&dev->dev_lock);
         return -ENOBUFS;
     }
 
     if (IS_ACTIVE(ENABLE_DEBUG)) {
-        printf ("%s: received %d byte\n", __func__, dev->rx_len);
+        printf ("%s: received %d byte\n", __func__, frame->len);
         if (IS_ACTIVE(ENABLE_DEBUG) && IS_USED(MODULE_OD)) {
-            od_hex_dump(dev->rx_buf, dev->rx_len, OD_WIDTH_DEFAULT);
+            od_hex_dump(frame->buf, frame->len, OD_WIDTH_DEFAULT);
         }
     }
 
-    /* copy received date and reset the receive length */
-    memcpy(buf, dev->rx_buf, dev->rx_len);
-    dev->rx_len = 0;
+    /* copy received data and release the frame */
+    memcpy(buf, frame->buf, frame->len);
+    _rx_queue_drop(dev);
 
     mutex_unlock(&dev->dev_lock);
     return size;
@@ -367,13 +399,31 @@ static void _esp_eth_isr(netdev_t *netdev)
 
     esp_eth_netdev_t* dev = container_of(netdev, esp_eth_netdev_t, netdev);
 
-    switch (dev->event) {
-        case SYSTEM_EVENT_ETH_RX_DONE:
-            /* if data were received */
-            if (dev->rx_len) {
-                dev->netdev.event_callback(netdev, NETDEV_EVENT_RX_COMPLETE);
-            }
+    /* link events share the ISR event with received frames, so the receive
+     * queue is checked on every run */
+    for (unsigned budget = CONFIG_ESP_ETH_RX_BUDGET; budget; budget--) {
+        if (!cib_avail(&dev->rx_cib)) {
             break;
+        }
+        dev->netdev.event_callback(netdev, NETDEV_EVENT_RX_COMPLETE);
+    }
+
+    mutex_lock(&dev->dev_lock);
+    unsigned overruns = dev->rx_overruns;
+    dev->rx_overruns = 0;
+    mutex_unlock(&dev->dev_lock);
+
+    while (overruns--) {
+        dev->netdev.event_callback(netdev, NETDEV_EVENT_RX_OVERRUN);
+    }
+
+    if (cib_avail(&dev->rx_cib)) {
+        /* budget used up, continue after the other pending events of the
+         * upper layer */
+        netdev_trigger_event_isr(netdev);
+    }
+
+    switch (dev->event) {
         case SYSTEM_EVENT_ETH_CONNECTED:
             dev->netdev.event_callback(netdev, NETDEV_EVENT_LINK_UP);
             break;
@@ -451,7 +501,8 @@ void esp_eth_setup(esp_eth_netdev_t* dev)
     /* initialize netdev data structure */
     _esp_eth_dev.event = SYSTEM_EVENT_MAX; /* no event */
     _esp_eth_dev.link_up = false;
-    _esp_eth_dev.rx_len = 0;
+    cib_init(&_esp_eth_dev.rx_cib, CONFIG_ESP_ETH_RX_QUEUE_SIZE);
+    _esp_eth_dev.rx_overruns = 0;
     _esp_eth_dev.tx_len = 0;
 
     netdev_register(&dev->netdev, NETDEV_ESP_ETH, 0);
@@ -21,6 +21,7 @@
 
 #include <stdbool.h>
 
+#include "cib.h"
 #include "mutex.h"
 #include "net/ethernet.h"
 #include "net/netdev.h"
@@ -29,11 +30,39 @@
 extern "C" {
 #endif
 
+/**
+ * @brief   Number of received frames queued for the upper layer
+ *
+ * Must be a power of two. Frames received while the queue is full are dropped
+ * and reported by @ref NETDEV_EVENT_RX_OVERRUN.
+ */
+#ifndef CONFIG_ESP_ETH_RX_QUEUE_SIZE
+#define CONFIG_ESP_ETH_RX_QUEUE_SIZE    (4)
+#endif
+
+/**
+ * @brief   Maximum number of frames passed up per run of the ISR handler
+ *
+ * If more frames are queued, the ISR handler is scheduled again, so that
+ * other events of the network interface are handled in between.
+ */
+#ifndef CONFIG_ESP_ETH_RX_BUDGET
+#define CONFIG_ESP_ETH_RX_BUDGET        CONFIG_ESP_ETH_RX_QUEUE_SIZE
+#endif
+
 /**
  * @brief   Reference to the netdev device driver struct
  */
 extern const netdev_driver_t esp_eth_driver;
 
+/**
+ * @brief   Received frame
+ */
+typedef struct {
+    uint8_t *buf;                       /**< frame, allocated by the EMAC driver */
+    uint16_t len;                       /**< length of the frame */
+} esp_eth_rx_frame_t;
+
 /**
  * @brief   Device descriptor for ESP-ETH devices
  */
@@ -42,10 +71,13 @@ typedef struct {
 
     void    *eth_driver;                /**< EMAC driver handle */
 
-    uint16_t rx_len;                    /**< number of bytes received */
+    cib_t    rx_cib;                    /**< index of the receive queue */
+    uint16_t rx_overruns;               /**< frames dropped as the receive
+                                             queue was full, not reported yet */
     uint16_t tx_len;                    /**< number of bytes in transmit buffer */
 
-    uint8_t  rx_buf[ETHERNET_MAX_LEN];  /**< receive buffer */
+    /** receive queue */
+    esp_eth_rx_frame_t rx_queue[CONFIG_ESP_ETH_RX_QUEUE_SIZE];
     uint8_t  tx_buf[ETHERNET_MAX_LEN];  /**< transmit buffer */
 
     uint32_t event;                     /**< received event */
@@ -359,6 +359,15 @@ unsigned int IRAM_ATTR timer_read(tim_t dev)
     }
 }
 
+uint64_t IRAM_ATTR timer_read64(tim_t dev)
+{
+    assert(dev < HW_TIMER_NUMOF);
+
+    uint64_t value;
+    timer_hal_get_counter_value(&_timers[dev].hw, &value);
+    return value;
+}
+
 void IRAM_ATTR timer_start(tim_t dev)
 {
     DEBUG("%s dev=%u @%" PRIu32 "\n", __func__, dev, system_get_time());
@@ -572,6 +581,13 @@ unsigned int IRAM timer_read(tim_t dev)
     return system_get_time ();
 }
 
+uint64_t IRAM timer_read64(tim_t dev)
+{
+    (void)dev;
+
+    return system_get_time_64();
+}
+
 void IRAM timer_start(tim_t dev)
 {
     DEBUG("%s dev=%u @%u\n", __func__, dev, system_get_time());
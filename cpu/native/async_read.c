@@ -23,6 +23,9 @@
 #include <unistd.h>
 #include <fcntl.h>
 #include <poll.h>
+#ifdef __linux__
+#include <sys/epoll.h>
+#endif
 
 #include "async_read.h"
 #include "native_internal.h"
@@ -31,9 +34,47 @@ static int _next_index;
 static struct pollfd _fds[ASYNC_READ_NUMOF];
 static async_read_t pollers[ASYNC_READ_NUMOF];
 
-static void _sigio_child(int fd);
+#ifdef __linux__
+/* all monitored fds, the ISR only visits the ready ones */
+static int _epfd = -1;
+/* fds that are unable to signal IO, watched by a single child process */
+static int _int_epfd = -1;
+static pid_t _int_child_pid;
+
+static void _epoll_add(int *epfd, int fd, int index)
+{
+    if (*epfd < 0) {
+        *epfd = epoll_create1(EPOLL_CLOEXEC);
+        if (*epfd < 0) {
+            err(EXIT_FAILURE, "async_read: epoll_create1");
+        }
+    }
+
+    struct epoll_event ev = {
+        .events = EPOLLIN | EPOLLPRI,
+        .data.u32 = index,
+    };
+    if (epoll_ctl(*epfd, EPOLL_CTL_ADD, fd, &ev) == -1) {
+        err(EXIT_FAILURE, "async_read: epoll_ctl");
+    }
+}
+
+static void _epoll_child(void);
+#else
+static void _sigio_child(int index);
+#endif
 
 static void _async_io_isr(void) {
+#ifdef __linux__
+    struct epoll_event evs[ASYNC_READ_NUMOF];
+    int ready = epoll_wait(_epfd, evs, ASYNC_READ_NUMOF, 0);
+
+    /* a single SIGIO covers all fds that became ready since the last one */
+    for (int i = 0; i < ready; i++) {
+        async_read_t *poll = &pollers[evs[i].data.u32];
+        poll->cb(poll->fd->fd, poll->arg);
+    }
+#else
     if (real_poll(_fds, _next_index, 0) > 0) {
         for (int i = 0; i < _next_index; i++) {
             /* handle if one of the events has happened */
@@ -42,6 +83,7 @@ static void _async_io_isr(void) {
             }
         }
     }
+#endif
 }
 
 void native_async_read_setup(void) {
@@ -57,6 +99,17 @@ void native_async_read_cleanup(void) {
             kill(pollers[i].child_pid, SIGKILL);
         }
     }
+#ifdef __linux__
+    if (_epfd >= 0) {
+        real_close(_epfd);
+        _epfd = -1;
+    }
+    if (_int_epfd >= 0) {
+        real_close(_int_epfd);
+        _int_epfd = -1;
+    }
+    _int_child_pid = 0;
+#endif
 }
 
 void native_async_read_continue(int fd) {
@@ -76,6 +129,10 @@ static void _add_handler(int fd, void *arg, native_async_read_callback_t handler
     poll->cb = handler;
     poll->arg = arg;
     poll->fd = &_fds[_next_index];
+
+#ifdef __linux__
+    _epoll_add(&_epfd, fd, _next_index);
+#endif
 }
 
 void native_async_read_add_handler(int fd, void *arg, native_async_read_callback_t handler) {
@@ -110,10 +167,60 @@ void native_async_read_add_int_handler(int fd, void *arg, native_async_read_call
 
     _add_handler(fd, arg, handler);
 
+#ifdef __linux__
+    /* the child shares the epoll instance, so fds added after the fork
+     * are watched as well */
+    _epoll_add(&_int_epfd, fd, _next_index);
+    if (!_int_child_pid) {
+        _epoll_child();
+    }
+    pollers[_next_index].child_pid = _int_child_pid;
+#else
     _sigio_child(_next_index);
+#endif
     _next_index++;
 }
 
+#ifdef __linux__
+static void _epoll_child(void)
+{
+    pid_t parent = _native_pid;
+    pid_t child;
+    if ((child = real_fork()) == -1) {
+        err(EXIT_FAILURE, "epoll_child: fork");
+    }
+    if (child > 0) {
+        _int_child_pid = child;
+
+        /* return in parent process */
+        return;
+    }
+
+    sigset_t sigmask;
+
+    sigemptyset(&sigmask);
+    sigaddset(&sigmask, SIGCONT);
+    sigprocmask(SIG_BLOCK, &sigmask, NULL);
+
+    /* signal the parent process once for any number of ready fds */
+    while (1) {
+        struct epoll_event ev;
+        if (epoll_wait(_int_epfd, &ev, 1, -1) == 1) {
+            kill(parent, SIGIO);
+        }
+        else {
+            kill(parent, SIGKILL);
+            err(EXIT_FAILURE, "epoll_child: epoll_wait");
+        }
+
+        int sig;
+
+        sigemptyset(&sigmask);
+        sigaddset(&sigmask, SIGCONT);
+        sigwait(&sigmask, &sig);
+    }
+}
+#else
 static void _sigio_child(int index)
 {
     struct pollfd fds = _fds[index];
@@ -157,4 +264,5 @@ static void _sigio_child(int index)
         sigwait(&sigmask, &sig);
     }
 }
+#endif
 /** @} */
@@ -83,6 +83,10 @@ void native_async_read_add_handler(int fd, void *arg, native_async_read_callback
 /**
  * @brief   start monitoring of file descriptor as interrupt
  *
+ * Use this for file descriptors that cannot signal IO (e.g. sysfs GPIOs).
+ * A child process watches them and signals the RIOT process. On Linux, a
+ * single child process is shared by all of those file descriptors.
+ *
  * @param[in] fd       The file descriptor to monitor
  * @param[in] arg      Pointer to be passed as arguments to the callback
  * @param[in] handler  The callback function to be called when the file
@@ -163,6 +163,7 @@ extern pid_t _native_pid;
 extern pid_t _native_id;
 extern unsigned _native_rng_seed;
 extern int _native_rng_mode; /**< 0 = /dev/random, 1 = random(3) */
+extern unsigned _native_time_scale; /**< host time per timer tick, in ticks */
 extern const char *_native_unix_socket_path;
 
 ssize_t _native_read(int fd, void *buf, size_t count);
@@ -36,6 +36,16 @@ extern "C" {
 #include "net/if.h"
 #endif
 
+/**
+ * @brief   Maximum number of frames received per interrupt
+ *
+ * After this many frames, the remaining ones are handled after a new
+ * interrupt, so that other threads get a chance to run.
+ */
+#ifndef CONFIG_NETDEV_TAP_RX_BATCH
+#define CONFIG_NETDEV_TAP_RX_BATCH      (16U)
+#endif
+
 /**
  * @brief tap interface state
  */
@@ -100,16 +100,42 @@ static inline int _get_wired(netdev_t *netdev)
     return dev->wired;
 }
 
+static bool _is_readable(netdev_tap_t *dev)
+{
+    fd_set rfds;
+    struct timeval t;
+    memset(&t, 0, sizeof(t));
+    FD_ZERO(&rfds);
+    FD_SET(dev->tap_fd, &rfds);
+
+    _native_in_syscall++; /* no switching here */
+    bool readable = real_select(dev->tap_fd + 1, &rfds, NULL, NULL, &t) == 1;
+    _native_in_syscall--;
+
+    return readable;
+}
+
+static void _continue_reading(netdev_tap_t *dev);
+
 static inline void _isr(netdev_t *netdev)
 {
-    if (netdev->event_callback) {
-        netdev->event_callback(netdev, NETDEV_EVENT_RX_COMPLETE);
-    }
+    netdev_tap_t *dev = container_of(netdev, netdev_tap_t, netdev);
+
+    if (!netdev->event_callback) {
 #if DEVELHELP
-    else {
         puts("netdev_tap: _isr(): no event_callback set.");
-    }
 #endif
+        return;
+    }
+
+    /* drain the frames that are already queued instead of taking a
+     * round trip through the signal handler for each of them */
+    unsigned budget = CONFIG_NETDEV_TAP_RX_BATCH;
+    do {
+        netdev->event_callback(netdev, NETDEV_EVENT_RX_COMPLETE);
+    } while (--budget && _is_readable(dev));
+
+    _continue_reading(dev);
 }
 
 static int _get(netdev_t *dev, netopt_t opt, void *value, size_t max_len)
@@ -196,15 +222,9 @@ static inline bool _is_addr_multicast(uint8_t *addr)
 static void _continue_reading(netdev_tap_t *dev)
 {
     /* work around lost signals */
-    fd_set rfds;
-    struct timeval t;
-    memset(&t, 0, sizeof(t));
-    FD_ZERO(&rfds);
-    FD_SET(dev->tap_fd, &rfds);
-
     _native_in_syscall++; /* no switching here */
 
-    if (real_select(dev->tap_fd + 1, &rfds, NULL, NULL, &t) == 1) {
+    if (_is_readable(dev)) {
         int sig = SIGIO;
         extern int _sig_pipefd[2];
         extern ssize_t (*real_write)(int fd, const void * buf, size_t count);
@@ -241,8 +261,6 @@ static int _recv(netdev_t *netdev, void *buf, size_t len, void *info)
             static uint8_t nullbuf[ETHERNET_FRAME_LEN];
 
             real_read(dev->tap_fd, nullbuf, sizeof(nullbuf));
-
-            _continue_reading(dev);
         }
 
         /* no way of figuring out packet size without racey buffering,
@@ -263,13 +281,9 @@ static int _recv(netdev_t *netdev, void *buf, size_t len, void *info)
                   hdr->dst[0], hdr->dst[1], hdr->dst[2],
                   hdr->dst[3], hdr->dst[4], hdr->dst[5]);
 
-            native_async_read_continue(dev->tap_fd);
-
             return 0;
         }
 
-        _continue_reading(dev);
-
         return nread;
     }
     else if (nread == -1) {
@@ -16,6 +16,7 @@
  * @brief       Native CPU periph/timer.h implementation
  *
  * Uses POSIX realtime clock and POSIX itimer to mimic hardware.
+ * With `--time-scale=<scale>`, a tick lasts <scale> microseconds.
  *
  * This is based on native's hwtimer implementation by Ludwig Knüpfer.
  * I removed the multiplexing, as xtimer does the same. (kaspar)
@@ -53,7 +54,7 @@
 
 #define NATIVE_TIMER_SPEED 1000000
 
-static unsigned long time_null;
+static uint64_t time_null;
 
 static timer_cb_t _callback;
 static void *_cb_arg;
@@ -63,10 +64,10 @@ static struct itimerval itv;
 /**
  * returns ticks for give timespec
  */
-static unsigned long ts2ticks(struct timespec *tp)
+static uint64_t ts2ticks(struct timespec *tp)
 {
-    /* TODO: check for overflow */
-    return (((unsigned long)tp->tv_sec * NATIVE_TIMER_SPEED) + (tp->tv_nsec / 1000));
+    return (((uint64_t)tp->tv_sec * NATIVE_TIMER_SPEED) + (tp->tv_nsec / 1000))
+           / _native_time_scale;
 }
 
 /**
@@ -109,13 +110,15 @@ static void do_timer_set(unsigned int offset, bool periodic)
 {
     DEBUG("%s\n", __func__);
 
-    if (offset && offset < NATIVE_TIMER_MIN_RES) {
-        offset = NATIVE_TIMER_MIN_RES;
+    uint64_t usec = (uint64_t)offset * _native_time_scale;
+
+    if (usec && usec < NATIVE_TIMER_MIN_RES) {
+        usec = NATIVE_TIMER_MIN_RES;
     }
 
     memset(&itv, 0, sizeof(itv));
-    itv.it_value.tv_sec = (offset / 1000000);
-    itv.it_value.tv_usec = offset % 1000000;
+    itv.it_value.tv_sec = (usec / 1000000);
+    itv.it_value.tv_usec = usec % 1000000;
     if (periodic) {
         itv.it_interval = itv.it_value;
     }
@@ -201,16 +204,8 @@ void timer_stop(tim_t dev)
     DEBUG("time left: %lu.%06lu\n", itv.it_value.tv_sec, itv.it_value.tv_usec);
 }
 
-unsigned int timer_read(tim_t dev)
+static void _read_clock(struct timespec *t)
 {
-    if (dev >= TIMER_NUMOF) {
-        return 0;
-    }
-
-    struct timespec t;
-
-    DEBUG("timer_read()\n");
-
     _native_syscall_enter();
 #ifdef __MACH__
     clock_serv_t cclock;
@@ -218,16 +213,45 @@ unsigned int timer_read(tim_t dev)
     host_get_clock_service(mach_host_self(), SYSTEM_CLOCK, &cclock);
     clock_get_time(cclock, &mts);
     mach_port_deallocate(mach_task_self(), cclock);
-    t.tv_sec = mts.tv_sec;
-    t.tv_nsec = mts.tv_nsec;
+    t->tv_sec = mts.tv_sec;
+    t->tv_nsec = mts.tv_nsec;
 #else
 
-    if (real_clock_gettime(CLOCK_MONOTONIC, &t) == -1) {
+    if (real_clock_gettime(CLOCK_MONOTONIC, t) == -1) {
         err(EXIT_FAILURE, "timer_read: clock_gettime");
     }
 
 #endif
     _native_syscall_leave();
+}
+
+unsigned int timer_read(tim_t dev)
+{
+    if (dev >= TIMER_NUMOF) {
+        return 0;
+    }
+
+    struct timespec t;
+
+    DEBUG("timer_read()\n");
+
+    _read_clock(&t);
+
+    return ts2ticks(&t) - time_null;
+}
+
+uint64_t timer_read64(tim_t dev)
+{
+    if (dev >= TIMER_NUMOF) {
+        return 0;
+    }
+
+    struct timespec t;
+
+    DEBUG("timer_read64()\n");
+
+    _read_clock(&t);
 
+    /* the lower 32 bits match timer_read() */
     return ts2ticks(&t) - time_null;
 }
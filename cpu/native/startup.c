@@ -64,6 +64,7 @@ pid_t _native_pid;
 pid_t _native_id;
 unsigned _native_rng_seed = 0;
 int _native_rng_mode = 0;
+unsigned _native_time_scale = 1;
 const char *_native_unix_socket_path = NULL;
 
 #ifdef MODULE_NETDEV_TAP
@@ -97,7 +98,7 @@ socket_zep_params_t socket_zep_params[SOCKET_ZEP_MAX];
 extern char eeprom_file[EEPROM_FILEPATH_MAX_LEN];
 #endif
 
-static const char short_opts[] = ":hi:s:deEoc:"
+static const char short_opts[] = ":hi:s:deEoc:T:"
 #ifdef MODULE_PERIPH_GPIO_LINUX
     "g:"
 #endif
@@ -130,6 +131,7 @@ static const struct option long_opts[] = {
     { "stderr-noredirect", no_argument, NULL, 'E' },
     { "stdout-pipe", no_argument, NULL, 'o' },
     { "uart-tty", required_argument, NULL, 'c' },
+    { "time-scale", required_argument, NULL, 'T' },
 #ifdef MODULE_PERIPH_GPIO_LINUX
     { "gpio", required_argument, NULL, 'g' },
 #endif
@@ -280,11 +282,10 @@ void usage_exit(int status)
         real_printf(" <tap interface %d>", i + 1);
     }
 #endif
-    real_printf(" [-i <id>] [-d] [-e|-E] [-o] [-c <tty>]");
+    real_printf(" [-i <id>] [-d] [-e|-E] [-o] [-c <tty>] [-T <scale>]");
 #ifdef MODULE_PERIPH_GPIO_LINUX
     real_printf(" [-g <gpiochip>]");
 #endif
-    real_printf(" [-i <id>] [-d] [-e|-E] [-o] [-c <tty>]");
 #if defined(MODULE_SOCKET_ZEP) && (SOCKET_ZEP_MAX > 0)
     real_printf(" -z [[<laddr>:<lport>,]<raddr>:<rport>]");
     for (int i = 0; i < SOCKET_ZEP_MAX - 1; i++) {
@@ -325,6 +326,10 @@ void usage_exit(int status)
 "    -c <tty>, --uart-tty=<tty>\n"
 "        specify TTY device for UART. This argument can be used multiple\n"
 "        times (up to UART_NUMOF)\n"
+"    -T <scale>, --time-scale=<scale>\n"
+"        run the timer <scale> times slower than the host clock. Start all\n"
+"        nodes of a simulated network with the same scale to give each of\n"
+"        them more host CPU time per simulated second\n"
 #ifdef MODULE_PERIPH_GPIO_LINUX
 "    -g <gpio>, --gpio=<gpio>\n"
 "        specify gpiochip device for GPIO access.\n"
@@ -532,6 +537,12 @@ __attribute__((constructor)) static void startup(int argc, char **argv, char **e
             case 'c':
                 tty_uart_setup(uart++, optarg);
                 break;
+            case 'T':
+                _native_time_scale = atol(optarg);
+                if (_native_time_scale == 0) {
+                    usage_exit(EXIT_FAILURE);
+                }
+                break;
 #ifdef MODULE_MTD_NATIVE
             case 'm':
                 ((mtd_native_dev_t *)mtd0)->fname = strndup(optarg, PATH_MAX - 1);
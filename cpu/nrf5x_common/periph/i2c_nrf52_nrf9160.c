@@ -23,10 +23,12 @@
  */
 
 #include <assert.h>
+#include <stdbool.h>
 #include <string.h>
 #include <errno.h>
 
 #include "cpu.h"
+#include "irq.h"
 #include "mutex.h"
 #include "assert.h"
 #include "periph/i2c.h"
@@ -62,6 +64,16 @@ static mutex_t locks[I2C_NUMOF];
  */
 static mutex_t busy[I2C_NUMOF];
 
+#ifdef MODULE_PERIPH_I2C_ASYNC
+/**
+ * @brief   State of the asynchronous transactions of an I2C device
+ */
+static struct {
+    i2c_async_xfer_t *queue;    /**< queued transactions, the head is active */
+    bool held;                  /**< bus is acquired for the queue */
+} _async[I2C_NUMOF];
+#endif
+
 void i2c_isr_handler(void *arg);
 
 static inline NRF_TWIM_Type *bus(i2c_t dev)
@@ -69,18 +81,8 @@ static inline NRF_TWIM_Type *bus(i2c_t dev)
     return i2c_config[dev].dev;
 }
 
-static int finish(i2c_t dev)
+static int check_error(i2c_t dev)
 {
-    DEBUG("[i2c] waiting for STOPPED or ERROR event\n");
-    /* Unmask interrupts */
-    bus(dev)->INTENSET = TWIM_INTEN_STOPPED_Msk | TWIM_INTEN_ERROR_Msk;
-    mutex_lock(&busy[dev]);
-
-    if ((bus(dev)->EVENTS_STOPPED)) {
-        bus(dev)->EVENTS_STOPPED = 0;
-        DEBUG("[i2c] finish: stop event occurred\n");
-    }
-
     if (bus(dev)->EVENTS_ERROR) {
         bus(dev)->EVENTS_ERROR = 0;
         if (bus(dev)->ERRORSRC & TWIM_ERRORSRC_ANACK_Msk) {
@@ -98,6 +100,21 @@ static int finish(i2c_t dev)
     return 0;
 }
 
+static int finish(i2c_t dev)
+{
+    DEBUG("[i2c] waiting for STOPPED or ERROR event\n");
+    /* Unmask interrupts */
+    bus(dev)->INTENSET = TWIM_INTEN_STOPPED_Msk | TWIM_INTEN_ERROR_Msk;
+    mutex_lock(&busy[dev]);
+
+    if ((bus(dev)->EVENTS_STOPPED)) {
+        bus(dev)->EVENTS_STOPPED = 0;
+        DEBUG("[i2c] finish: stop event occurred\n");
+    }
+
+    return check_error(dev);
+}
+
 static void _init_pins(i2c_t dev)
 {
     gpio_init(i2c_config[dev].scl, GPIO_IN_OD_PU);
@@ -314,10 +331,105 @@ int i2c_write_bytes(i2c_t dev, uint16_t addr, const void *data, size_t len,
     return finish(dev);
 }
 
+#ifdef MODULE_PERIPH_I2C_ASYNC
+static void _async_start(i2c_t dev, i2c_async_xfer_t *xfer)
+{
+    DEBUG("[i2c] async: %u byte(s) out, %u byte(s) in at addr 0x%02x\n",
+          (unsigned)xfer->out_len, (unsigned)xfer->in_len, (unsigned)xfer->addr);
+
+    bus(dev)->ADDRESS = xfer->addr;
+    bus(dev)->TXD.PTR = (uint32_t)xfer->out;
+    bus(dev)->TXD.MAXCNT = xfer->out_len;
+    bus(dev)->RXD.PTR = (uint32_t)xfer->in;
+    bus(dev)->RXD.MAXCNT = xfer->in_len;
+    bus(dev)->INTENSET = TWIM_INTEN_STOPPED_Msk | TWIM_INTEN_ERROR_Msk;
+
+    if (!xfer->out_len) {
+        bus(dev)->SHORTS = TWIM_SHORTS_LASTRX_STOP_Msk;
+        bus(dev)->TASKS_STARTRX = 1;
+    }
+    else {
+        bus(dev)->SHORTS = xfer->in_len
+                         ? (TWIM_SHORTS_LASTTX_STARTRX_Msk |
+                            TWIM_SHORTS_LASTRX_STOP_Msk)
+                         : TWIM_SHORTS_LASTTX_STOP_Msk;
+        bus(dev)->TASKS_STARTTX = 1;
+    }
+}
+
+static void _async_irq(i2c_t dev)
+{
+    i2c_async_xfer_t *xfer = _async[dev].queue;
+
+    if (bus(dev)->EVENTS_ERROR) {
+        /* the transaction is aborted, wait for the STOPPED event */
+        xfer->res = check_error(dev);
+        bus(dev)->TASKS_STOP = 1;
+        return;
+    }
+    if (!bus(dev)->EVENTS_STOPPED) {
+        return;
+    }
+    bus(dev)->EVENTS_STOPPED = 0;
+
+    _async[dev].queue = xfer->next;
+    if (xfer->cb) {
+        xfer->cb(xfer->arg);
+    }
+
+    /* the callback may have queued further transactions */
+    if (_async[dev].queue) {
+        _async_start(dev, _async[dev].queue);
+    }
+    else {
+        bus(dev)->INTENCLR = TWIM_INTEN_STOPPED_Msk | TWIM_INTEN_ERROR_Msk;
+        _async[dev].held = false;
+        i2c_release(dev);
+    }
+}
+
+void i2c_transfer_async(i2c_t dev, i2c_async_xfer_t *xfer)
+{
+    assert((dev < I2C_NUMOF) && xfer && (xfer->out_len || xfer->in_len));
+
+    xfer->next = NULL;
+    xfer->res = 0;
+
+    unsigned state = irq_disable();
+    if (_async[dev].held) {
+        i2c_async_xfer_t **tail = &_async[dev].queue;
+        while (*tail) {
+            tail = &(*tail)->next;
+        }
+        /* an empty queue of a held bus is restarted by _async_irq() */
+        *tail = xfer;
+        irq_restore(state);
+        return;
+    }
+    irq_restore(state);
+
+    assert(!irq_is_in());
+    i2c_acquire(dev);
+
+    state = irq_disable();
+    _async[dev].held = true;
+    _async[dev].queue = xfer;
+    _async_start(dev, xfer);
+    irq_restore(state);
+}
+#endif /* MODULE_PERIPH_I2C_ASYNC */
+
 void i2c_isr_handler(void *arg)
 {
     i2c_t dev = (i2c_t)(uintptr_t)arg;
 
+#ifdef MODULE_PERIPH_I2C_ASYNC
+    if (_async[dev].held) {
+        _async_irq(dev);
+        return;
+    }
+#endif
+
     /* Mask interrupts to ensure that they only trigger once */
     bus(dev)->INTENCLR = TWIM_INTEN_STOPPED_Msk | TWIM_INTEN_ERROR_Msk;
 
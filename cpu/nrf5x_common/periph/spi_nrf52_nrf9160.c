@@ -27,6 +27,7 @@
 #include <assert.h>
 
 #include "cpu.h"
+#include "irq.h"
 #include "mutex.h"
 #include "periph/spi.h"
 #include "periph/gpio.h"
@@ -48,6 +49,17 @@ static mutex_t busy[SPI_NUMOF];
 
 static uint8_t _mbuf[SPI_NUMOF][CONFIG_SPI_MBUF_SIZE];
 
+#ifdef MODULE_PERIPH_SPI_ASYNC
+/**
+ * @brief   State of the asynchronous transfers of a SPI device
+ */
+static struct {
+    spi_async_xfer_t *queue;    /**< queued transfers, the head is active */
+    size_t pos;                 /**< bytes of the head already transferred */
+    size_t chunk;               /**< bytes of the running EasyDMA transfer */
+} _async[SPI_NUMOF];
+#endif
+
 static void spi_isr_handler(void *arg);
 
 static inline NRF_SPIM_Type *dev(spi_t bus)
@@ -202,6 +214,10 @@ void spi_acquire(spi_t bus, spi_cs_t cs, spi_mode_t mode, spi_clk_t clk)
 
 void spi_release(spi_t bus)
 {
+#ifdef MODULE_PERIPH_SPI_ASYNC
+    assert(!_async[bus].queue);
+#endif
+
     /* power off everything */
     dev(bus)->ENABLE = 0;
 
@@ -293,10 +309,87 @@ void spi_transfer_bytes(spi_t bus, spi_cs_t cs, bool cont,
     }
 }
 
+#ifdef MODULE_PERIPH_SPI_ASYNC
+static void _async_start(spi_t bus, spi_async_xfer_t *xfer)
+{
+    if (xfer->cs != SPI_CS_UNDEF) {
+        gpio_clear((gpio_t)xfer->cs);
+    }
+    if (xfer->len == 1) {
+        _enable_workaround(bus);
+    }
+
+    dev(bus)->INTENSET = SPIM_INTENSET_END_Msk;
+    _async[bus].pos = 0;
+    _async[bus].chunk = _transfer(bus, xfer->out, xfer->in, xfer->len);
+}
+
+static void _async_end(spi_t bus)
+{
+    spi_async_xfer_t *xfer = _async[bus].queue;
+    const uint8_t *out_buf = xfer->out;
+    uint8_t *in_buf = xfer->in;
+
+    _async[bus].pos += _async[bus].chunk;
+    if (_async[bus].pos < xfer->len) {
+        /* chain the next chunk right from the ISR */
+        size_t pos = _async[bus].pos;
+        _async[bus].chunk = _transfer(bus, out_buf ? out_buf + pos : NULL,
+                                      in_buf ? in_buf + pos : NULL,
+                                      xfer->len - pos);
+        return;
+    }
+
+    dev(bus)->INTENCLR = SPIM_INTENCLR_END_Msk;
+    if (xfer->len == 1) {
+        _clear_workaround(bus);
+    }
+    if ((xfer->cs != SPI_CS_UNDEF) && (!xfer->cont)) {
+        gpio_set((gpio_t)xfer->cs);
+    }
+
+    /* dequeue before calling back, so the callback can queue a new transfer */
+    spi_async_xfer_t *next = xfer->next;
+    _async[bus].queue = next;
+    if (xfer->cb) {
+        xfer->cb(xfer->arg);
+    }
+    if (next) {
+        _async_start(bus, next);
+    }
+}
+
+void spi_transfer_bytes_async(spi_t bus, spi_async_xfer_t *xfer)
+{
+    assert(xfer->out || xfer->in);
+
+    xfer->next = NULL;
+
+    unsigned state = irq_disable();
+    spi_async_xfer_t **tail = &_async[bus].queue;
+    while (*tail) {
+        tail = &(*tail)->next;
+    }
+    *tail = xfer;
+    irq_restore(state);
+
+    if (tail == &_async[bus].queue) {
+        _async_start(bus, xfer);
+    }
+}
+#endif /* MODULE_PERIPH_SPI_ASYNC */
+
 void spi_isr_handler(void *arg)
 {
     spi_t bus = (spi_t)(uintptr_t)arg;
 
+#ifdef MODULE_PERIPH_SPI_ASYNC
+    if (_async[bus].queue) {
+        dev(bus)->EVENTS_END = 0;
+        _async_end(bus);
+        return;
+    }
+#endif
     mutex_unlock(&busy[bus]);
     dev(bus)->EVENTS_END = 0;
 }
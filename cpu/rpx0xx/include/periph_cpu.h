@@ -20,6 +20,9 @@
 #ifndef PERIPH_CPU_H
 #define PERIPH_CPU_H
 
+#include <stdbool.h>
+#include <stddef.h>
+
 #include "cpu.h"
 #include "vendor/RP2040.h"
 #include "io_reg.h"
@@ -716,6 +719,162 @@ void rosc_stop(void);
 
 /** @} */
 
+/**
+ * @name    RP2040 multicore support
+ *
+ * RIOT's scheduler runs on core 0 only. These functions give access to the
+ * inter-core hardware of the SIO block: core 1 can be started with a bare
+ * function that runs outside of RIOT's scheduler, data is exchanged via the
+ * inter-core FIFOs and shared data is protected by the hardware spinlocks.
+ *
+ * Code running on core 1 must not call any RIOT API that accesses the
+ * scheduler (e.g. mutexes, messages, thread flags). To hand work to a RIOT
+ * thread, core 1 pushes a word into the FIFO: this raises an interrupt on
+ * core 0 whose callback (see @ref rpx0xx_fifo_irq_enable) may wake up threads.
+ * @{
+ */
+
+/**
+ * @brief   Number of hardware spinlocks
+ */
+#define RPX0XX_SPINLOCK_NUMOF   (32U)
+
+/**
+ * @brief   Callback for words received via the inter-core FIFO
+ *
+ * @param[in]   arg     argument given to @ref rpx0xx_fifo_irq_enable
+ * @param[in]   word    received word
+ */
+typedef void (*rpx0xx_fifo_cb_t)(void *arg, uint32_t word);
+
+/**
+ * @brief   Get the number of the core executing this function
+ *
+ * @return  0 on core 0, 1 on core 1
+ */
+static inline unsigned rpx0xx_core_id(void)
+{
+    return SIO->CPUID;
+}
+
+/**
+ * @brief   Try to acquire a hardware spinlock
+ *
+ * @pre     `num < RPX0XX_SPINLOCK_NUMOF`
+ *
+ * @param[in]   num     number of the spinlock
+ *
+ * @return  true if the lock was acquired, false if it is held already
+ */
+static inline bool rpx0xx_spinlock_trylock(unsigned num)
+{
+    bool acquired = (&SIO->SPINLOCK0)[num] != 0;
+    __DMB();
+    return acquired;
+}
+
+/**
+ * @brief   Acquire a hardware spinlock, busy wait until it is available
+ *
+ * @note    The spinlocks are not recursive and do not disable interrupts.
+ *          Disable interrupts before acquiring a lock that is used in ISRs,
+ *          too.
+ *
+ * @pre     `num < RPX0XX_SPINLOCK_NUMOF`
+ *
+ * @param[in]   num     number of the spinlock
+ */
+static inline void rpx0xx_spinlock_lock(unsigned num)
+{
+    while (!rpx0xx_spinlock_trylock(num)) {}
+}
+
+/**
+ * @brief   Release a hardware spinlock
+ *
+ * @pre     `num < RPX0XX_SPINLOCK_NUMOF`
+ *
+ * @param[in]   num     number of the spinlock
+ */
+static inline void rpx0xx_spinlock_unlock(unsigned num)
+{
+    __DMB();
+    /* any write releases the lock, the vendor header declares it read-only */
+    *(volatile uint32_t *)&(&SIO->SPINLOCK0)[num] = 0;
+}
+
+/**
+ * @brief   Check whether a word is available in the FIFO of this core
+ */
+static inline bool rpx0xx_fifo_readable(void)
+{
+    return SIO->FIFO_ST.reg & SIO_FIFO_ST_VLD_Msk;
+}
+
+/**
+ * @brief   Check whether the FIFO towards the other core has room for a word
+ */
+static inline bool rpx0xx_fifo_writable(void)
+{
+    return SIO->FIFO_ST.reg & SIO_FIFO_ST_RDY_Msk;
+}
+
+/**
+ * @brief   Send a word to the other core, busy wait while its FIFO is full
+ *
+ * @param[in]   word    word to send
+ */
+void rpx0xx_fifo_push(uint32_t word);
+
+/**
+ * @brief   Receive a word from the other core, sleep until one is available
+ *
+ * @return  received word
+ */
+uint32_t rpx0xx_fifo_pop(void);
+
+/**
+ * @brief   Discard all words in the FIFO of this core
+ */
+void rpx0xx_fifo_drain(void);
+
+/**
+ * @brief   Call @p cb in interrupt context for every word the other core sends
+ *
+ * Enables the FIFO interrupt of the calling core. On core 0, the callback may
+ * use all ISR safe RIOT APIs, a context switch is triggered if needed.
+ *
+ * @param[in]   cb      callback
+ * @param[in]   arg     argument passed to @p cb
+ */
+void rpx0xx_fifo_irq_enable(rpx0xx_fifo_cb_t cb, void *arg);
+
+/**
+ * @brief   Disable the FIFO interrupt of the calling core
+ */
+void rpx0xx_fifo_irq_disable(void);
+
+/**
+ * @brief   Reset core 1 and start it executing @p entry
+ *
+ * Must be called on core 0. @p entry runs with interrupts enabled, the vector
+ * table of core 0 and its own stack. It must not return.
+ *
+ * @param[in]   entry       function to execute on core 1
+ * @param[in]   stack       stack of core 1, 8 byte aligned
+ * @param[in]   stack_size  size of @p stack in bytes
+ */
+void rpx0xx_core1_start(void (*entry)(void), void *stack, size_t stack_size);
+
+/**
+ * @brief   Hold core 1 in reset
+ *
+ * Must be called on core 0.
+ */
+void rpx0xx_core1_stop(void);
+
+/** @} */
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,143 @@
+/*
+ * Copyright (C) 2026 Otto-von-Guericke-Universität Magdeburg
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     cpu_rpx0xx
+ * @{
+ *
+ * @file
+ * @brief       Implementation of the inter-core FIFO and the start of core 1
+ *
+ * See section "2.8.2. Launching Code On Processor Core 1" in
+ * https://datasheets.raspberrypi.org/rpx0xx/rpx0xx-datasheet.pdf
+ *
+ * @}
+ */
+
+#include <assert.h>
+#include <stdbool.h>
+
+#include "cpu.h"
+#include "io_reg.h"
+#include "irq.h"
+#include "kernel_defines.h"
+#include "periph_cpu.h"
+#include "vendor/RP2040.h"
+
+static rpx0xx_fifo_cb_t _fifo_cb[2];
+static void *_fifo_arg[2];
+
+void rpx0xx_fifo_push(uint32_t word)
+{
+    while (!rpx0xx_fifo_writable()) {}
+    SIO->FIFO_WR = word;
+    /* wake up the other core if it waits in rpx0xx_fifo_pop() */
+    __SEV();
+}
+
+uint32_t rpx0xx_fifo_pop(void)
+{
+    while (!rpx0xx_fifo_readable()) {
+        __WFE();
+    }
+    return SIO->FIFO_RD;
+}
+
+void rpx0xx_fifo_drain(void)
+{
+    while (rpx0xx_fifo_readable()) {
+        (void)SIO->FIFO_RD;
+    }
+    /* clear the sticky overflow and underflow flags */
+    SIO->FIFO_ST.reg = SIO_FIFO_ST_WOF_Msk | SIO_FIFO_ST_ROE_Msk;
+}
+
+void rpx0xx_fifo_irq_enable(rpx0xx_fifo_cb_t cb, void *arg)
+{
+    unsigned core = rpx0xx_core_id();
+    IRQn_Type irqn = core ? SIO_IRQ_PROC1_IRQn : SIO_IRQ_PROC0_IRQn;
+
+    unsigned state = irq_disable();
+    _fifo_cb[core] = cb;
+    _fifo_arg[core] = arg;
+    irq_restore(state);
+
+    /* the NVIC is private to each core */
+    NVIC_EnableIRQ(irqn);
+}
+
+void rpx0xx_fifo_irq_disable(void)
+{
+    NVIC_DisableIRQ(rpx0xx_core_id() ? SIO_IRQ_PROC1_IRQn : SIO_IRQ_PROC0_IRQn);
+}
+
+static void _fifo_isr(unsigned core)
+{
+    /* the IRQ is also raised by the sticky error flags, clear them */
+    SIO->FIFO_ST.reg = SIO_FIFO_ST_WOF_Msk | SIO_FIFO_ST_ROE_Msk;
+    while (rpx0xx_fifo_readable()) {
+        uint32_t word = SIO->FIFO_RD;
+        if (_fifo_cb[core]) {
+            _fifo_cb[core](_fifo_arg[core], word);
+        }
+    }
+}
+
+void isr_sio_proc0(void)
+{
+    _fifo_isr(0);
+    cortexm_isr_end();
+}
+
+void isr_sio_proc1(void)
+{
+    /* core 1 does not run the scheduler, no context switch to trigger */
+    _fifo_isr(1);
+}
+
+void rpx0xx_core1_stop(void)
+{
+    io_reg_atomic_set(&PSM->FRCE_OFF.reg, PSM_FRCE_OFF_proc1_Msk);
+    while (!(PSM->FRCE_OFF.reg & PSM_FRCE_OFF_proc1_Msk)) {}
+}
+
+void rpx0xx_core1_start(void (*entry)(void), void *stack, size_t stack_size)
+{
+    assert(rpx0xx_core_id() == 0);
+    assert(!((uintptr_t)stack & 0x7) && !(stack_size & 0x7));
+
+    const uint32_t cmds[] = {
+        0, 0, 1,
+        SCB->VTOR,
+        (uintptr_t)stack + stack_size,
+        (uintptr_t)entry,
+    };
+
+    /* the bootrom handshake uses the FIFO, keep our FIFO IRQ out of it */
+    bool irq_enabled = NVIC_GetEnableIRQ(SIO_IRQ_PROC0_IRQn);
+    NVIC_DisableIRQ(SIO_IRQ_PROC0_IRQn);
+
+    rpx0xx_core1_stop();
+    io_reg_atomic_clear(&PSM->FRCE_OFF.reg, PSM_FRCE_OFF_proc1_Msk);
+
+    /* core 1 echoes every word, start over on any mismatch */
+    unsigned i = 0;
+    while (i < ARRAY_SIZE(cmds)) {
+        if (!cmds[i]) {
+            rpx0xx_fifo_drain();
+            __SEV();
+        }
+        rpx0xx_fifo_push(cmds[i]);
+        i = (rpx0xx_fifo_pop() == cmds[i]) ? i + 1 : 0;
+    }
+
+    if (irq_enabled) {
+        NVIC_ClearPendingIRQ(SIO_IRQ_PROC0_IRQn);
+        NVIC_EnableIRQ(SIO_IRQ_PROC0_IRQn);
+    }
+}
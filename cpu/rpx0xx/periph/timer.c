@@ -220,6 +220,12 @@ unsigned int timer_read(tim_t dev)
     return _timer_read_us(dev);
 }
 
+uint64_t timer_read64(tim_t dev)
+{
+    assert(dev < TIMER_NUMOF);
+    return _timer_read_us(dev);
+}
+
 void timer_start(tim_t dev)
 {
     assert(dev < TIMER_NUMOF);
@@ -1159,6 +1159,25 @@ void dma_wait(dma_t dma);
  * @param   dma     DMA channel reference
  */
 void dma_cancel(dma_t dma);
+
+/**
+ * @brief   DMA transfer complete callback
+ *
+ * @param   arg     argument given to @ref dma_set_cb
+ */
+typedef void (*dma_cb_t)(void *arg);
+
+/**
+ * @brief   Set a callback to be called when a transfer is complete
+ *
+ * While a callback is set, @ref dma_wait must not be used on the channel. The
+ * callback is called from interrupt context.
+ *
+ * @param   dma     DMA channel reference
+ * @param   cb      callback, NULL to wake up @ref dma_wait again
+ * @param   arg     argument passed to @p cb
+ */
+void dma_set_cb(dma_t dma, dma_cb_t cb, void *arg);
 /** @} */
 #endif /* REV_DMAC || DOXYGEN */
 
@@ -29,6 +29,7 @@
 #include <assert.h>
 
 #include "cpu.h"
+#include "irq.h"
 #include "mutex.h"
 #include "periph/spi.h"
 #include "pm_layered.h"
@@ -61,6 +62,13 @@ static DmacDescriptor DMA_DESCRIPTOR_ATTRS tx_desc[SPI_NUMOF];
 static DmacDescriptor DMA_DESCRIPTOR_ATTRS rx_desc[SPI_NUMOF];
 #endif
 
+#ifdef MODULE_PERIPH_SPI_ASYNC
+/**
+ * @brief   Queued asynchronous transfers, the head is the active one
+ */
+static spi_async_xfer_t *_async_queue[SPI_NUMOF];
+#endif
+
 /**
  * @brief   Shortcut for accessing the used SPI SERCOM device
  */
@@ -429,6 +437,10 @@ void spi_acquire(spi_t bus, spi_cs_t cs, spi_mode_t mode, spi_clk_t clk)
 
 void spi_release(spi_t bus)
 {
+#ifdef MODULE_PERIPH_SPI_ASYNC
+    assert(!_async_queue[bus]);
+#endif
+
     /* Demux clk_pin back to GPIO_OUT function. Otherwise it will get HIGH-Z
      * and lead to unexpected current draw by SPI salves. */
     gpio_disable_mux(spi_config[bus].clk_pin);
@@ -553,3 +565,90 @@ void spi_transfer_bytes(spi_t bus, spi_cs_t cs, bool cont,
         gpio_set((gpio_t)cs);
     }
 }
+
+#ifdef MODULE_PERIPH_SPI_ASYNC
+#ifdef MODULE_PERIPH_DMA
+/* dummy source and sink for DMA transfers without in or out buffer */
+static uint8_t _async_dummy[SPI_NUMOF];
+
+static void _async_done(void *arg);
+
+static void _async_start(spi_t bus, spi_async_xfer_t *xfer)
+{
+    const uint8_t *out = xfer->out;
+    uint8_t *in = xfer->in;
+    const uint8_t *out_addr = out ? out + xfer->len : &_async_dummy[bus];
+    uint8_t *in_addr = in ? in + xfer->len : &_async_dummy[bus];
+
+    if (xfer->cs != SPI_CS_UNDEF) {
+        gpio_clear((gpio_t)xfer->cs);
+    }
+
+    dma_set_cb(_dma_state[bus].rx_dma, _async_done, (void *)(uintptr_t)bus);
+    dma_prepare_dst(_dma_state[bus].rx_dma, in_addr, xfer->len, in ? true : false);
+    dma_prepare_src(_dma_state[bus].tx_dma, out_addr, xfer->len, out ? true : false);
+
+#if defined(CPU_COMMON_SAMD21)
+    pm_block(SAMD21_PM_IDLE_1);
+#endif
+    dma_start(_dma_state[bus].rx_dma);
+    dma_start(_dma_state[bus].tx_dma);
+}
+
+static void _async_done(void *arg)
+{
+    spi_t bus = (spi_t)(uintptr_t)arg;
+    spi_async_xfer_t *xfer = _async_queue[bus];
+    spi_async_xfer_t *next = xfer->next;
+
+#if defined(CPU_COMMON_SAMD21)
+    pm_unblock(SAMD21_PM_IDLE_1);
+#endif
+    if ((!xfer->cont) && (xfer->cs != SPI_CS_UNDEF)) {
+        gpio_set((gpio_t)xfer->cs);
+    }
+
+    /* dequeue before calling back, so the callback can queue a new transfer */
+    _async_queue[bus] = next;
+    if (!next) {
+        dma_set_cb(_dma_state[bus].rx_dma, NULL, NULL);
+    }
+    if (xfer->cb) {
+        xfer->cb(xfer->arg);
+    }
+    if (next) {
+        _async_start(bus, next);
+    }
+}
+#endif /* MODULE_PERIPH_DMA */
+
+void spi_transfer_bytes_async(spi_t bus, spi_async_xfer_t *xfer)
+{
+    assert(xfer->out || xfer->in);
+
+#ifdef MODULE_PERIPH_DMA
+    if (_use_dma(bus)) {
+        xfer->next = NULL;
+
+        unsigned state = irq_disable();
+        spi_async_xfer_t **tail = &_async_queue[bus];
+        while (*tail) {
+            tail = &(*tail)->next;
+        }
+        *tail = xfer;
+        irq_restore(state);
+
+        if (tail == &_async_queue[bus]) {
+            _async_start(bus, xfer);
+        }
+        return;
+    }
+#endif
+
+    spi_transfer_bytes(bus, xfer->cs, xfer->cont, xfer->out, xfer->in,
+                       xfer->len);
+    if (xfer->cb) {
+        xfer->cb(xfer->arg);
+    }
+}
+#endif /* MODULE_PERIPH_SPI_ASYNC */
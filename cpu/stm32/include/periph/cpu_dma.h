@@ -179,6 +179,45 @@ void dma_stop(dma_t dma);
  */
 void dma_wait(dma_t dma);
 
+/**
+ * @brief   DMA transfer complete callback
+ *
+ * @param[in] arg     argument given to @ref dma_set_cb
+ */
+typedef void (*dma_cb_t)(void *arg);
+
+/**
+ * @brief   Set a callback to be called at the end of a transfer
+ *
+ * While a callback is set, @ref dma_wait must not be used on the stream. The
+ * callback is called from interrupt context.
+ *
+ * @param[in] dma     logical DMA stream
+ * @param[in] cb      callback, NULL to wake up @ref dma_wait again
+ * @param[in] arg     argument passed to @p cb
+ */
+void dma_set_cb(dma_t dma, dma_cb_t cb, void *arg);
+
+/**
+ * @brief   Let a stream restart from the beginning of the buffer when a
+ *          transfer is complete
+ *
+ * In circular mode, the callback set with @ref dma_set_cb is also called when
+ * half of the transfer is done. This must be called after @ref dma_setup.
+ *
+ * @param[in] dma     logical DMA stream
+ */
+void dma_set_circular(dma_t dma);
+
+/**
+ * @brief   Get the number of transfers left on a stream
+ *
+ * @param[in] dma     logical DMA stream
+ *
+ * @return  number of transfers left until the end of the buffer
+ */
+uint16_t dma_remaining(dma_t dma);
+
 /**
  * @brief   Configure a DMA stream for a new transfer
  *
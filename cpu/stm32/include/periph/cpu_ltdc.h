@@ -69,6 +69,9 @@ void ltdc_clear(void);
 /**
  * @brief   Map a buffer of RGB565 (16bit depth) colors to the display
  *
+ * On CPUs with a DMA2D (Chrom-ART) controller, this and @ref ltdc_fill() are
+ * done by the DMA2D.
+ *
  * @param[in]  x1       horizontal start position
  * @param[in]  x2       horizontal end position (included)
  * @param[in]  y1       vertical start position
@@ -41,6 +41,11 @@ typedef enum {
 
 /**
  * @brief   Size of the UART TX buffer for non-blocking mode.
+ *
+ * If a UART has a DMA stream configured, the buffer is sent by DMA and
+ * @ref uart_write only blocks while the buffer is full.
+ *
+ * @pre Needs to be a power of two
  */
 #ifndef UART_TXBUF_SIZE
 #define UART_TXBUF_SIZE    (64)
@@ -131,6 +136,12 @@ typedef struct {
     dma_t dma;              /**< Logical DMA stream used for TX */
     uint8_t dma_chan;       /**< DMA channel used for TX */
 #endif
+#ifdef MODULE_PERIPH_UART_RX_DMA
+    dma_t rx_dma;           /**< Logical DMA stream used for RX, boards
+                             *   providing `periph_uart_rx_dma` must set this
+                             *   for every UART, DMA_STREAM_UNDEF if unused */
+    uint8_t rx_dma_chan;    /**< DMA channel used for RX */
+#endif
 } uart_conf_t;
 
 
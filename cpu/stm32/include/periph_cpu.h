@@ -96,6 +96,22 @@ typedef struct {
     uint8_t chan;           /**< CPU ADC channel connected to the pin */
 } adc_conf_t;
 
+/**
+ * @brief   Continuous ADC sampling configuration data
+ *
+ * The timer is set up to generate both a CC1 and a TRGO (update) event, so
+ * either of them can be selected as trigger.
+ */
+typedef struct {
+    TIM_TypeDef *tim;       /**< timer triggering the scans */
+    uint32_t rcc_mask;      /**< bit in clock enable register of the timer */
+    uint8_t bus;            /**< APBx bus the timer is clocked from */
+    uint8_t adc;            /**< ADCx - 1 device used for sampling */
+    uint8_t extsel;         /**< external trigger selection of @ref tim */
+    dma_t dma;              /**< DMA stream connected to the ADC */
+    uint8_t dma_chan;       /**< DMA channel of @ref dma */
+} adc_continuous_conf_t;
+
 /**
  * @brief   DAC line configuration data
  */
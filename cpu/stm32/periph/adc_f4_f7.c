@@ -19,6 +19,8 @@
  * @}
  */
 
+#include <errno.h>
+
 #include "cpu.h"
 #include "mutex.h"
 #include "periph/adc.h"
@@ -145,3 +147,127 @@ int32_t adc_sample(adc_t line, adc_res_t res)
 
     return sample;
 }
+
+#ifdef MODULE_PERIPH_ADC_CONTINUOUS
+/**
+ * @brief   Parameters of the running continuous sampling, NULL if stopped
+ */
+static const adc_continuous_t *cont;
+
+static inline ADC_TypeDef *cont_dev(void)
+{
+    return (ADC_TypeDef *)(ADC1_BASE + (adc_continuous_config.adc << 8));
+}
+
+static void _cont_dma_cb(void *arg)
+{
+    (void)arg;
+    size_t half = cont->len / 2;
+
+    /* after wrapping around the DMA is back in the first half */
+    if (dma_remaining(adc_continuous_config.dma) > half) {
+        cont->cb(cont->arg, cont->buf + half, half);
+    }
+    else {
+        cont->cb(cont->arg, cont->buf, half);
+    }
+}
+
+int adc_continuous_start(const adc_continuous_t *params)
+{
+    const adc_continuous_conf_t *conf = &adc_continuous_config;
+
+    if ((params->res & 0xff) || !params->lines_numof ||
+        (params->lines_numof > 16) || !params->rate || !params->len ||
+        (params->len % (2 * params->lines_numof)) ||
+        (params->len > UINT16_MAX)) {
+        return -EINVAL;
+    }
+    for (unsigned i = 0; i < params->lines_numof; i++) {
+        if (params->lines[i] >= ADC_NUMOF) {
+            return -EINVAL;
+        }
+        if (adc_config[params->lines[i]].dev != conf->adc) {
+            return -ENOTSUP;
+        }
+    }
+
+    /* split the scan period into prescaler and a 16 bit reload value */
+    uint32_t ticks = periph_timer_clk(conf->bus) / params->rate;
+    if (ticks < 2) {
+        return -EINVAL;
+    }
+    uint32_t psc = (ticks - 1) >> 16;
+    uint32_t arr = ticks / (psc + 1) - 1;
+
+    mutex_lock(&locks[conf->adc]);
+    periph_clk_en(APB2, (RCC_APB2ENR_ADC1EN << conf->adc));
+
+    /* program the scan sequence */
+    ADC_TypeDef *adc = cont_dev();
+    uint32_t sqr[3] = { 0 };
+    for (unsigned i = 0; i < params->lines_numof; i++) {
+        sqr[i / 6] |= (uint32_t)adc_config[params->lines[i]].chan << (5 * (i % 6));
+    }
+    adc->CR2 = 0;
+    adc->CR1 = params->res | ADC_CR1_SCAN;
+    adc->SQR3 = sqr[0];
+    adc->SQR2 = sqr[1];
+    adc->SQR1 = sqr[2] | ((params->lines_numof - 1) << ADC_SQR1_L_Pos);
+    adc->CR2 = ADC_CR2_ADON | ADC_CR2_DMA | ADC_CR2_DDS | ADC_CR2_EXTEN_0 |
+               ((uint32_t)conf->extsel << ADC_CR2_EXTSEL_Pos);
+
+    cont = params;
+    dma_acquire(conf->dma);
+    dma_setup(conf->dma, conf->dma_chan, (void *)&adc->DR, DMA_PERIPH_TO_MEM,
+              DMA_DATA_WIDTH_HALF_WORD, false);
+    dma_set_circular(conf->dma);
+    dma_prepare(conf->dma, params->buf, params->len, true);
+    dma_set_cb(conf->dma, _cont_dma_cb, NULL);
+    dma_start(conf->dma);
+
+    /* generate both a CC1 and an update event once per scan period */
+    TIM_TypeDef *tim = conf->tim;
+    periph_clk_en(conf->bus, conf->rcc_mask);
+    tim->CR1 = 0;
+    tim->PSC = psc;
+    tim->ARR = arr;
+    tim->CCR1 = arr / 2;
+    tim->CCMR1 = TIM_CCMR1_OC1M_2 | TIM_CCMR1_OC1M_1;
+    tim->CCER = TIM_CCER_CC1E;
+    tim->CR2 = TIM_CR2_MMS_1;
+    if (IS_TIM_BREAK_INSTANCE(tim)) {
+        tim->BDTR = TIM_BDTR_MOE;
+    }
+    tim->EGR = TIM_EGR_UG;
+    tim->CR1 = TIM_CR1_CEN;
+
+    return 0;
+}
+
+void adc_continuous_stop(void)
+{
+    const adc_continuous_conf_t *conf = &adc_continuous_config;
+
+    if (!cont) {
+        return;
+    }
+
+    conf->tim->CR1 = 0;
+    periph_clk_dis(conf->bus, conf->rcc_mask);
+
+    dma_stop(conf->dma);
+    dma_set_cb(conf->dma, NULL, NULL);
+    dma_release(conf->dma);
+
+    /* restore the single conversion setup used by adc_sample() */
+    ADC_TypeDef *adc = cont_dev();
+    adc->CR2 = ADC_CR2_ADON;
+    adc->CR1 = 0;
+    adc->SQR1 = 0;
+    cont = NULL;
+
+    periph_clk_dis(APB2, (RCC_APB2ENR_ADC1EN << conf->adc));
+    mutex_unlock(&locks[conf->adc]);
+}
+#endif
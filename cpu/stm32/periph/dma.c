@@ -22,6 +22,7 @@
 
 #include "periph_cpu.h"
 #include "periph_conf.h"
+#include "irq.h"
 #include "mutex.h"
 #include "assert.h"
 #include "pm_layered.h"
@@ -89,6 +90,8 @@ struct dma_ctx {
     mutex_t conf_lock;
     mutex_t sync_lock;
     uint16_t len;
+    dma_cb_t cb;
+    void *arg;
 };
 
 static struct dma_ctx dma_ctx[DMA_NUMOF];
@@ -500,11 +503,45 @@ void dma_wait(dma_t dma)
     mutex_lock(&dma_ctx[dma].sync_lock);
 }
 
+void dma_set_cb(dma_t dma, dma_cb_t cb, void *arg)
+{
+    unsigned state = irq_disable();
+    dma_ctx[dma].cb = cb;
+    dma_ctx[dma].arg = arg;
+    irq_restore(state);
+}
+
+void dma_set_circular(dma_t dma)
+{
+    STM32_DMA_Stream_Type *stream = dma_ctx[dma].stream;
+
+#if CPU_FAM_STM32F2 || CPU_FAM_STM32F4 || CPU_FAM_STM32F7
+    stream->CONTROL_REG |= DMA_SxCR_CIRC | DMA_SxCR_HTIE;
+#else
+    stream->CONTROL_REG |= DMA_CCR_CIRC | DMA_CCR_HTIE;
+#endif
+}
+
+uint16_t dma_remaining(dma_t dma)
+{
+    return dma_ctx[dma].stream->NDTR_REG;
+}
+
+static void _transfer_done(dma_t dma)
+{
+    if (dma_ctx[dma].cb) {
+        dma_ctx[dma].cb(dma_ctx[dma].arg);
+    }
+    else {
+        mutex_unlock(&dma_ctx[dma].sync_lock);
+    }
+}
+
 void dma_isr_handler(dma_t dma)
 {
     dma_clear_all_flags(dma);
 
-    mutex_unlock(&dma_ctx[dma].sync_lock);
+    _transfer_done(dma);
 
     cortexm_isr_end();
 }
@@ -603,7 +640,7 @@ static void shared_isr(uint8_t *streams, size_t nb)
         dma_t dma = streams[i];
         if (dma_is_isr(dma)) {
             dma_clear_all_flags(dma);
-            mutex_unlock(&dma_ctx[dma].sync_lock);
+            _transfer_done(dma);
         }
     }
 
@@ -27,6 +27,7 @@
 #include "bitarithm.h"
 #include "board.h"
 #include "iolist.h"
+#include "irq.h"
 #include "mii.h"
 #include "mutex.h"
 #include "net/ethernet.h"
@@ -68,7 +69,27 @@ static ztimer_t _link_status_timer;
 #define ETH_TX_DESCRIPTOR_COUNT     (8U)
 #endif
 #ifndef ETH_RX_BUFFER_SIZE
-#define ETH_RX_BUFFER_SIZE          (256U)
+#  if IS_USED(MODULE_NETDEV_RX_LEND)
+/* frames can only be lent to the upper layer if they fit in a single buffer */
+#    define ETH_RX_BUFFER_SIZE      (1536U)
+#  else
+#    define ETH_RX_BUFFER_SIZE      (256U)
+#  endif
+#endif
+
+/**
+ * @brief   Maximum number of frames passed up per run of the ISR handler with
+ *          module `stm32_eth_rx_poll`
+ *
+ * If more frames are left in the RX ring, the ISR handler is scheduled again,
+ * so that other events of the network interface are handled in between.
+ */
+#ifndef CONFIG_STM32_ETH_RX_BUDGET
+#define CONFIG_STM32_ETH_RX_BUDGET  ETH_RX_DESCRIPTOR_COUNT
+#endif
+
+#if IS_USED(MODULE_NETDEV_RX_LEND) && (ETH_RX_DESCRIPTOR_COUNT > 32)
+#error "netdev_rx_lend supports at most 32 RX descriptors"
 #endif
 
 /* Bitmask to extract link state */
@@ -154,6 +175,9 @@ static edma_desc_t tx_desc[ETH_TX_DESCRIPTOR_COUNT];
 static edma_desc_t *rx_curr;
 static edma_desc_t *tx_curr;
 
+/* PTP timestamp of the last frame sent, 0 if none was timestamped yet */
+static uint64_t _tx_timestamp;
+
 /* RX Buffers */
 static char rx_buffer[ETH_RX_DESCRIPTOR_COUNT][ETH_RX_BUFFER_SIZE];
 
@@ -163,6 +187,22 @@ netdev_t *stm32_eth_netdev;
 /* Used for checking the link status */
 static uint8_t _link_state = LINK_STATE_DOWN;
 
+#if IS_USED(MODULE_NETDEV_RX_LEND)
+/* Bitmask of RX descriptors whose buffer is currently lent to the upper
+ * layer. Those are not owned by the DMA, but also don't hold a new frame */
+static uint32_t _rx_lent;
+#endif
+
+static inline bool _rx_desc_lent(const edma_desc_t *desc)
+{
+#if IS_USED(MODULE_NETDEV_RX_LEND)
+    return _rx_lent & (1UL << (desc - rx_desc));
+#else
+    (void)desc;
+    return false;
+#endif
+}
+
 static void _debug_tx_descriptor_info(unsigned line)
 {
     if (IS_ACTIVE(ENABLE_DEBUG) && IS_ACTIVE(ENABLE_DEBUG_VERBOSE)) {
@@ -305,7 +345,8 @@ static void _init_dma_descriptors(void)
 {
     size_t i;
     for (i = 0; i < ETH_RX_DESCRIPTOR_COUNT; i++) {
-        rx_desc[i].status = RX_DESC_STAT_OWN;
+        /* buffers lent to the upper layer are handed to the DMA on return */
+        rx_desc[i].status = _rx_desc_lent(&rx_desc[i]) ? 0 : RX_DESC_STAT_OWN;
         rx_desc[i].control = RX_DESC_CTRL_RCH | (ETH_RX_BUFFER_SIZE & 0x0fff);
         rx_desc[i].buffer_addr = &rx_buffer[i][0];
         if ((i + 1) < ETH_RX_DESCRIPTOR_COUNT) {
@@ -377,6 +418,30 @@ static int stm32_eth_get(netdev_t *dev, netopt_t opt,
         }
         res = sizeof(netopt_enable_t);
         break;
+    case NETOPT_TX_IOLIST_MAX:
+        assert(max_len == sizeof(uint16_t));
+        /* each iolist entry is chained onto its own TX descriptor */
+        *((uint16_t *)value) = ETH_TX_DESCRIPTOR_COUNT;
+        res = sizeof(uint16_t);
+        break;
+    case NETOPT_TX_CSUM_OFFLOAD:
+        assert(max_len == sizeof(netopt_enable_t));
+        /* TX descriptors request insertion of the payload checksum, see
+         * TX_DESC_STAT_CIC */
+        *((netopt_enable_t *)value) = NETOPT_ENABLE;
+        res = sizeof(netopt_enable_t);
+        break;
+#if IS_USED(MODULE_PERIPH_PTP)
+    case NETOPT_TX_TIMESTAMP:
+        assert(max_len == sizeof(uint64_t));
+        if (!_tx_timestamp) {
+            res = -EAGAIN;
+            break;
+        }
+        memcpy(value, &_tx_timestamp, sizeof(_tx_timestamp));
+        res = sizeof(uint64_t);
+        break;
+#endif
     default:
         res = netdev_eth_get(dev, opt, value, max_len);
         break;
@@ -562,27 +627,42 @@ static int stm32_eth_send(netdev_t *netdev, const struct iolist *iolist)
     assert(bytes_to_send <= ETHERNET_FRAME_LEN);
     /* This API is not thread safe, check that no other thread is sending */
     assert(!(tx_desc[0].status & TX_DESC_STAT_OWN));
-    /* We cannot send more chunks than allocated descriptors */
+    /* We cannot send more chunks than allocated descriptors, upper layers
+     * query NETOPT_TX_IOLIST_MAX to merge longer iolists beforehand */
     assert(iolist_count(iolist) <= ETH_TX_DESCRIPTOR_COUNT);
 
     _debug_tx_descriptor_info(__LINE__);
+    /* chain every iolist entry onto its own descriptor, so that the DMA
+     * gathers the frame directly from the upper layer's buffers */
     edma_desc_t *dma_iter = tx_curr;
-    for (unsigned i = 0; iolist; iolist = iolist->iol_next, i++) {
+    edma_desc_t *last = NULL;
+    for (; iolist; iolist = iolist->iol_next) {
+        if (!iolist->iol_len) {
+            /* skip empty chunks, a zero sized buffer would stall the DMA */
+            continue;
+        }
         dma_iter->control = iolist->iol_len;
         dma_iter->buffer_addr = iolist->iol_base;
-        uint32_t status = TX_DESC_STAT_IC | TX_DESC_STAT_TCH | TX_DESC_STAT_CIC
-                          | TX_DESC_STAT_OWN;
-        if (!i) {
-            /* fist chunk */
+        uint32_t status = TX_DESC_STAT_IC | TX_DESC_STAT_TCH | TX_DESC_STAT_CIC;
+        if (!last) {
+            /* fist chunk, handed over to the DMA once the chain is complete */
             status |= TX_DESC_STAT_FS;
+            if (IS_USED(MODULE_PERIPH_PTP)) {
+                /* the MAC stores the timestamp in the last descriptor */
+                status |= TX_DESC_STAT_TTSE;
+            }
         }
-        if (!iolist->iol_next) {
-            /* last chunk */
-            status |= TX_DESC_STAT_LS;
+        else {
+            status |= TX_DESC_STAT_OWN;
         }
         dma_iter->status = status;
+        last = dma_iter;
         dma_iter = dma_iter->desc_next;
     }
+    assert(last);
+    /* last chunk */
+    last->status |= TX_DESC_STAT_LS;
+    tx_curr->status |= TX_DESC_STAT_OWN;
 
     if (IS_USED(MODULE_STM32_ETH_TRACING)) {
         gpio_ll_set(GPIO_PORT(STM32_ETH_TRACING_TX_PORT_NUM),
@@ -627,6 +707,10 @@ static int stm32_eth_send(netdev_t *netdev, const struct iolist *iolist)
             }
             _reset_eth_dma();
         }
+        if (IS_USED(MODULE_PERIPH_PTP) && (status & TX_DESC_STAT_TTSS)) {
+            _tx_timestamp = tx_curr->ts_low;
+            _tx_timestamp += (uint64_t)tx_curr->ts_high * NS_PER_SEC;
+        }
         tx_curr = tx_curr->desc_next;
         if (status & TX_DESC_STAT_LS) {
             break;
@@ -649,18 +733,23 @@ static int get_rx_frame_size(void)
     uint32_t status;
     while (1) {
         /* Wait until DMA gave up control over descriptor */
-        if ((status = i->status) & RX_DESC_STAT_OWN) {
+        if (((status = i->status) & RX_DESC_STAT_OWN) || _rx_desc_lent(i)) {
             DEBUG("[stm32_eth] RX not completed (spurious interrupt?)\n");
             return -EAGAIN;
         }
         if (status & RX_DESC_STAT_DE) {
             DEBUG("[stm32_eth] Overflow during RX\n");
+            stm32_eth_netdev->event_callback(stm32_eth_netdev,
+                                             NETDEV_EVENT_RX_OVERRUN);
             _reset_eth_dma();
             return -EOVERFLOW;
         }
-        if (status & RX_DESC_STAT_ES) {
+        if ((status & (RX_DESC_STAT_LS | RX_DESC_STAT_ES))
+            == (RX_DESC_STAT_LS | RX_DESC_STAT_ES)) {
+            /* the frame was received completely, dropping it is enough */
             DEBUG("[stm32_eth] Error during RX\n");
-            _reset_eth_dma();
+            stm32_eth_netdev->event_callback(stm32_eth_netdev,
+                                             NETDEV_EVENT_CRC_ERROR);
             return -EIO;
         }
         if (status & RX_DESC_STAT_LS) {
@@ -686,29 +775,39 @@ static void drop_frame_and_update_rx_curr(void)
     }
 }
 
-static void handle_lost_rx_irqs(void)
+static bool _rx_frame_ready(void)
 {
     edma_desc_t *iter = rx_curr;
     while (1) {
         uint32_t status = iter->status;
-        if (status & RX_DESC_STAT_OWN) {
-            break;
+        if ((status & RX_DESC_STAT_OWN) || _rx_desc_lent(iter)) {
+            return false;
         }
         if (status & RX_DESC_STAT_LS) {
-            DEBUG("[stm32_eth] Lost RX IRQ, sending event to upper layer\n");
-            /* we use the ISR event for this, as the upper layer calls recv()
-             * right away on an NETDEV_EVENT_RX_COMPLETE. Because there could be
-             * potentially quite a lot of received frames in the queue, we might
-             * risk a stack overflow if we would send an
-             * NETDEV_EVENT_RX_COMPLETE
-             */
-            netdev_trigger_event_isr(stm32_eth_netdev);
-            break;
+            return true;
         }
         iter = iter->desc_next;
     }
 }
 
+static void handle_lost_rx_irqs(void)
+{
+    if (IS_USED(MODULE_STM32_ETH_RX_POLL)) {
+        /* the ISR handler keeps polling until the RX ring is drained */
+        return;
+    }
+    if (_rx_frame_ready()) {
+        DEBUG("[stm32_eth] Lost RX IRQ, sending event to upper layer\n");
+        /* we use the ISR event for this, as the upper layer calls recv()
+         * right away on an NETDEV_EVENT_RX_COMPLETE. Because there could be
+         * potentially quite a lot of received frames in the queue, we might
+         * risk a stack overflow if we would send an
+         * NETDEV_EVENT_RX_COMPLETE
+         */
+        netdev_trigger_event_isr(stm32_eth_netdev);
+    }
+}
+
 static int stm32_eth_recv(netdev_t *netdev, void *_buf, size_t max_len,
                           void *_info)
 {
@@ -778,13 +877,127 @@ static int stm32_eth_recv(netdev_t *netdev, void *_buf, size_t max_len,
     return size;
 }
 
+#if IS_USED(MODULE_NETDEV_RX_LEND)
+static int stm32_eth_recv_lend(netdev_t *netdev, void **buf, void *_info)
+{
+    (void)netdev;
+    netdev_eth_rx_info_t *info = _info;
+    int size = get_rx_frame_size();
+
+    if (size < 0) {
+        if (size != -EAGAIN) {
+            DEBUG("[stm32_eth] Dropping frame due to error\n");
+            drop_frame_and_update_rx_curr();
+        }
+        return size;
+    }
+
+    if (!(rx_curr->status & RX_DESC_STAT_LS)) {
+        /* frame spans multiple DMA buffers, it needs to be copied out */
+        return -ENOTSUP;
+    }
+
+    if (IS_USED(MODULE_PERIPH_PTP) && info) {
+        info->timestamp = rx_curr->ts_low;
+        info->timestamp += (uint64_t)rx_curr->ts_high * NS_PER_SEC;
+        info->flags |= NETDEV_ETH_RX_INFO_FLAG_TIMESTAMP;
+    }
+
+    /* keep the descriptor away from the DMA until the buffer is returned */
+    *buf = rx_curr->buffer_addr;
+    unsigned state = irq_disable();
+    _rx_lent |= 1UL << (rx_curr - rx_desc);
+    irq_restore(state);
+    rx_curr = rx_curr->desc_next;
+
+    if (IS_USED(MODULE_STM32_ETH_TRACING)) {
+        gpio_ll_clear(GPIO_PORT(STM32_ETH_TRACING_RX_PORT_NUM),
+                      (1U << STM32_ETH_TRACING_RX_PIN_NUM));
+    }
+
+    _debug_rx_descriptor_info(__LINE__);
+    handle_lost_rx_irqs();
+    return size;
+}
+
+static void stm32_eth_recv_return(netdev_t *netdev, void *buf)
+{
+    (void)netdev;
+    unsigned idx = ((char *)buf - &rx_buffer[0][0]) / ETH_RX_BUFFER_SIZE;
+
+    assert(idx < ETH_RX_DESCRIPTOR_COUNT);
+    assert(rx_desc[idx].buffer_addr == buf);
+
+    unsigned state = irq_disable();
+    _rx_lent &= ~(1UL << idx);
+    rx_desc[idx].status = RX_DESC_STAT_OWN;
+    irq_restore(state);
+
+    /* resume reception, in case the DMA ran out of descriptors */
+    ETH->DMARPDR = 0;
+}
+#endif
+
 void stm32_eth_isr_eth_wkup(void)
 {
     cortexm_isr_end();
 }
 
+static void _report_missed_frames(netdev_t *netdev)
+{
+    /* cleared on read, frames missed as no RX descriptor was available and
+     * frames missed due to an overflow of the RX FIFO */
+    uint32_t mfbocr = ETH->DMAMFBOCR;
+    unsigned missed = (mfbocr & ETH_DMAMFBOCR_MFC)
+                    + ((mfbocr & ETH_DMAMFBOCR_MFA) >> 17);
+
+    while (missed--) {
+        netdev->event_callback(netdev, NETDEV_EVENT_RX_OVERRUN);
+    }
+}
+
+static void _rx_complete(netdev_t *netdev)
+{
+    if (IS_USED(MODULE_STM32_ETH_TRACING)) {
+        gpio_ll_set(GPIO_PORT(STM32_ETH_TRACING_RX_PORT_NUM),
+                    (1U << STM32_ETH_TRACING_RX_PIN_NUM));
+    }
+    netdev->event_callback(netdev, NETDEV_EVENT_RX_COMPLETE);
+}
+
+static void _rx_poll(netdev_t *netdev)
+{
+    /* RX IRQs were masked by the IRQ handler, drain the RX ring instead of
+     * taking one interrupt per frame */
+    for (unsigned budget = CONFIG_STM32_ETH_RX_BUDGET; budget; budget--) {
+        if (!_rx_frame_ready()) {
+            _report_missed_frames(netdev);
+            unsigned state = irq_disable();
+            ETH->DMAIER |= ETH_DMAIER_RIE;
+            irq_restore(state);
+            /* a frame completed while RX IRQs were masked may have had its
+             * RS flag cleared by a TX IRQ already */
+            if (!_rx_frame_ready()) {
+                return;
+            }
+            state = irq_disable();
+            ETH->DMAIER &= ~ETH_DMAIER_RIE;
+            irq_restore(state);
+        }
+        _rx_complete(netdev);
+    }
+    /* budget used up, keep RX IRQs masked and continue after the other
+     * pending events of the upper layer */
+    netdev_trigger_event_isr(netdev);
+}
+
 static void stm32_eth_isr(netdev_t *netdev)
 {
+    if (IS_USED(MODULE_STM32_ETH_RX_POLL)) {
+        /* link state changes share the ISR event, so poll on every run */
+        _rx_poll(netdev);
+    }
+
     if (IS_USED(MODULE_STM32_ETH_LINK_UP)) {
         switch (_link_state) {
         case LINK_STATE_UP:
@@ -806,11 +1019,10 @@ static void stm32_eth_isr(netdev_t *netdev)
         }
     }
 
-    if (IS_USED(MODULE_STM32_ETH_TRACING)) {
-        gpio_ll_set(GPIO_PORT(STM32_ETH_TRACING_RX_PORT_NUM),
-                    (1U << STM32_ETH_TRACING_RX_PIN_NUM));
+    if (!IS_USED(MODULE_STM32_ETH_RX_POLL)) {
+        _rx_complete(netdev);
+        _report_missed_frames(netdev);
     }
-    netdev->event_callback(netdev, NETDEV_EVENT_RX_COMPLETE);
 }
 
 static const netdev_driver_t netdev_driver_stm32f4eth = {
@@ -820,6 +1032,10 @@ static const netdev_driver_t netdev_driver_stm32f4eth = {
     .isr = stm32_eth_isr,
     .get = stm32_eth_get,
     .set = stm32_eth_set,
+#if IS_USED(MODULE_NETDEV_RX_LEND)
+    .recv_lend = stm32_eth_recv_lend,
+    .recv_return = stm32_eth_recv_return,
+#endif
 };
 
 void stm32_eth_netdev_setup(netdev_t *netdev)
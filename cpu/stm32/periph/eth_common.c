@@ -132,8 +132,18 @@ void isr_eth(void)
             mutex_unlock(&stm32_eth_tx_completed);
         }
 
+        if (IS_USED(MODULE_STM32_ETH_RX_POLL)
+            && !(ETH->DMAIER & ETH_DMAIER_RIE)) {
+            /* the netif thread is polling the RX ring already */
+            tmp &= ~ETH_DMASR_RS;
+        }
+
         if ((tmp & ETH_DMASR_RS)) {
             DEBUG("isr_eth: RX completed\n");
+            if (IS_USED(MODULE_STM32_ETH_RX_POLL)) {
+                /* RX IRQs stay masked until the RX ring is drained */
+                ETH->DMAIER &= ~ETH_DMAIER_RIE;
+            }
             if (stm32_eth_netdev) {
                 netdev_trigger_event_isr(stm32_eth_netdev);
             }
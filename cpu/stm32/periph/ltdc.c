@@ -46,6 +46,8 @@
 #define LTDC_BLENDING_FACTOR1_CA    0x00000400U
 #define LTDC_BLENDING_FACTOR2_CA    0x00000005U
 
+#define DMA2D_CM_RGB565             (2U)
+
 typedef struct {
     uint32_t hsync;
     uint32_t vsync;
@@ -60,6 +62,26 @@ typedef struct {
 /* allocate array of 16bit pixels for the framebuffer (TODO: use external SRAM via FMC) */
 static uint16_t _ltdc_frame_buffer[LCD_SCREEN_WIDTH * LCD_SCREEN_HEIGHT];
 
+#ifdef DMA2D
+static void _dma2d_wait(void)
+{
+    /* LVGL may have started a transfer as well, see lvgl_draw_stm32_dma2d */
+    while (DMA2D->CR & DMA2D_CR_START) {}
+}
+
+static void _dma2d_start(uint16_t x1, uint16_t x2, uint16_t y1, uint16_t y2)
+{
+    uint32_t width = x2 - x1 + 1;
+
+    DMA2D->OMAR = (uint32_t)&_ltdc_frame_buffer[x1 + y1 * LCD_SCREEN_WIDTH];
+    DMA2D->OOR = LCD_SCREEN_WIDTH - width;
+    DMA2D->OPFCCR = DMA2D_CM_RGB565;
+    DMA2D->NLR = (width << DMA2D_NLR_PL_Pos) | (y2 - y1 + 1);
+    DMA2D->CR |= DMA2D_CR_START;
+    _dma2d_wait();
+}
+#endif
+
 static void _init_gpio(void)
 {
     gpio_init(ltdc_config.clk_pin.pin, GPIO_OUT);
@@ -178,6 +200,9 @@ void ltdc_init(void)
     DEBUG("[ltdc] init: initializing device\n");
 
     periph_clk_en(ltdc_config.bus, ltdc_config.rcc_mask);
+#ifdef DMA2D
+    periph_clk_en(AHB1, RCC_AHB1ENR_DMA2DEN);
+#endif
 
     _init_gpio();
     _configure_ltdc();
@@ -192,21 +217,39 @@ void ltdc_clear(void)
 
 void ltdc_map(uint16_t x1, uint16_t x2, uint16_t y1, uint16_t y2, const uint16_t *color)
 {
+#ifdef DMA2D
+    /* memory to memory, the area is contiguous in color */
+    _dma2d_wait();
+    DMA2D->CR = 0;
+    DMA2D->FGMAR = (uint32_t)color;
+    DMA2D->FGOR = 0;
+    DMA2D->FGPFCCR = DMA2D_CM_RGB565;
+    _dma2d_start(x1, x2, y1, y2);
+#else
     for (uint16_t y = y1; y <= y2; y++) {
         for (uint16_t x = x1; x <= x2; x++) {
             *(_ltdc_frame_buffer + (x + y * LCD_SCREEN_WIDTH)) = *color++;
         }
     }
+#endif
     LTDC->SRCR = LTDC_SRCR_IMR;
 }
 
 void ltdc_fill(uint16_t x1, uint16_t x2, uint16_t y1, uint16_t y2, const uint16_t color)
 {
+#ifdef DMA2D
+    /* register to memory */
+    _dma2d_wait();
+    DMA2D->CR = DMA2D_CR_MODE;
+    DMA2D->OCOLR = color;
+    _dma2d_start(x1, x2, y1, y2);
+#else
     for (uint16_t y = y1; y <= y2; y++) {
         for (uint16_t x = x1; x <= x2; x++) {
             *(_ltdc_frame_buffer + (x + y * LCD_SCREEN_WIDTH)) = color;
         }
     }
+#endif
 
     LTDC->SRCR = LTDC_SRCR_IMR;
 }
@@ -30,6 +30,7 @@
 
 #include "bitarithm.h"
 #include "cpu.h"
+#include "irq.h"
 #include "mutex.h"
 #include "periph/gpio.h"
 #include "periph/spi.h"
@@ -69,6 +70,13 @@ static uint32_t clocks[SPI_NUMOF];
  */
 static uint8_t dividers[SPI_NUMOF];
 
+#ifdef MODULE_PERIPH_SPI_ASYNC
+/**
+ * @brief   Queued asynchronous transfers, the head is the active one
+ */
+static spi_async_xfer_t *_async_queue[SPI_NUMOF];
+#endif
+
 static inline SPI_TypeDef *dev(spi_t bus)
 {
     return spi_config[bus].dev;
@@ -286,6 +294,9 @@ void spi_acquire(spi_t bus, spi_cs_t cs, spi_mode_t mode, spi_clk_t clk)
 
 void spi_release(spi_t bus)
 {
+#ifdef MODULE_PERIPH_SPI_ASYNC
+    assert(!_async_queue[bus]);
+#endif
 #ifdef MODULE_PERIPH_DMA
     if (_use_dma(&spi_config[bus])) {
         dma_release(spi_config[bus].tx_dma);
@@ -417,3 +428,110 @@ void spi_transfer_bytes(spi_t bus, spi_cs_t cs, bool cont,
         }
     }
 }
+
+#ifdef MODULE_PERIPH_SPI_ASYNC
+#ifdef MODULE_PERIPH_DMA
+/* dummy source and sink for DMA transfers without in or out buffer */
+static uint8_t _async_dummy[SPI_NUMOF];
+
+static void _async_done(void *arg);
+
+static void _async_tx_done(void *arg)
+{
+    /* the RX stream completes the transfer, this just keeps the TX stream
+     * from waking up a later dma_wait() */
+    (void)arg;
+}
+
+static void _async_start(spi_t bus, spi_async_xfer_t *xfer)
+{
+    dev(bus)->CR1 |= (SPI_CR1_SPE);     /* this pulls the HW CS line low */
+    if ((xfer->cs != SPI_HWCS_MASK) && gpio_is_valid(xfer->cs)) {
+        gpio_clear((gpio_t)xfer->cs);
+    }
+
+    dma_set_cb(spi_config[bus].rx_dma, _async_done, (void *)(uintptr_t)bus);
+    dma_set_cb(spi_config[bus].tx_dma, _async_tx_done, NULL);
+
+    if (xfer->out) {
+        dma_prepare(spi_config[bus].tx_dma, (void *)xfer->out, xfer->len, 1);
+    }
+    else {
+        dma_prepare(spi_config[bus].tx_dma, &_async_dummy[bus], xfer->len, 0);
+    }
+    if (xfer->in) {
+        dma_prepare(spi_config[bus].rx_dma, xfer->in, xfer->len, 1);
+    }
+    else {
+        dma_prepare(spi_config[bus].rx_dma, &_async_dummy[bus], xfer->len, 0);
+    }
+
+    dma_start(spi_config[bus].rx_dma);
+    dma_start(spi_config[bus].tx_dma);
+}
+
+static void _async_done(void *arg)
+{
+    spi_t bus = (spi_t)(uintptr_t)arg;
+    spi_async_xfer_t *xfer = _async_queue[bus];
+    spi_async_xfer_t *next = xfer->next;
+
+#ifdef DMA_CCR_EN
+    dma_stop(spi_config[bus].rx_dma);
+    dma_stop(spi_config[bus].tx_dma);
+#endif
+    /* the last byte was received, so this only waits for BSY to clear */
+    _wait_for_end(bus);
+
+    if ((!xfer->cont) && gpio_is_valid(xfer->cs)) {
+        dev(bus)->CR1 &= ~(SPI_CR1_SPE);    /* pull HW CS line high */
+        if (xfer->cs != SPI_HWCS_MASK) {
+            gpio_set((gpio_t)xfer->cs);
+        }
+    }
+
+    /* dequeue before calling back, so the callback can queue a new transfer */
+    _async_queue[bus] = next;
+    if (!next) {
+        dma_set_cb(spi_config[bus].rx_dma, NULL, NULL);
+        dma_set_cb(spi_config[bus].tx_dma, NULL, NULL);
+    }
+    if (xfer->cb) {
+        xfer->cb(xfer->arg);
+    }
+    if (next) {
+        _async_start(bus, next);
+    }
+}
+#endif /* MODULE_PERIPH_DMA */
+
+void spi_transfer_bytes_async(spi_t bus, spi_async_xfer_t *xfer)
+{
+    assert(xfer->out || xfer->in);
+
+#ifdef MODULE_PERIPH_DMA
+    if (_use_dma(&spi_config[bus])) {
+        xfer->next = NULL;
+
+        unsigned state = irq_disable();
+        spi_async_xfer_t **tail = &_async_queue[bus];
+        while (*tail) {
+            tail = &(*tail)->next;
+        }
+        *tail = xfer;
+        irq_restore(state);
+
+        if (tail == &_async_queue[bus]) {
+            _async_start(bus, xfer);
+        }
+        return;
+    }
+#endif
+
+    spi_transfer_bytes(bus, xfer->cs, xfer->cont, xfer->out, xfer->in,
+                       xfer->len);
+    if (xfer->cb) {
+        xfer->cb(xfer->arg);
+    }
+}
+#endif /* MODULE_PERIPH_SPI_ASYNC */
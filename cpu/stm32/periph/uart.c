@@ -27,6 +27,7 @@
  */
 
 #include "cpu.h"
+#include "irq.h"
 #include "sched.h"
 #include "thread.h"
 #include "assert.h"
@@ -70,6 +71,27 @@
 #define RXENABLE            (USART_CR1_RE | USART_CR1_RXNEIE)
 #endif
 
+#ifdef MODULE_PERIPH_UART_RX_DMA
+#ifdef USART_ISR_IDLE
+#define ISR_IDLE            USART_ISR_IDLE
+#else
+#define ISR_IDLE            USART_SR_IDLE
+#endif
+/* the RX interrupt enable bit only */
+#define RX_IRQ_ENABLE       (RXENABLE & ~USART_CR1_RE)
+
+/**
+ * @brief   Circular DMA receive buffers
+ */
+static struct {
+    uint8_t *buf;               /**< receive buffer */
+    uint16_t len;               /**< size of the receive buffer */
+    uint16_t pos;               /**< first byte not passed to @ref cb yet */
+    uart_rx_block_cb_t cb;      /**< block receive callback, NULL if off */
+    void *arg;                  /**< argument to @ref cb */
+} rx_dma_ctx[UART_NUMOF];
+#endif
+
 #ifdef MODULE_PERIPH_UART_NONBLOCKING
 
 #include "tsrb.h"
@@ -78,6 +100,18 @@
  */
 static tsrb_t uart_tx_rb[UART_NUMOF];
 static uint8_t uart_tx_rb_buf[UART_NUMOF][UART_TXBUF_SIZE];
+
+#ifdef MODULE_PERIPH_DMA
+/**
+ * @brief   Length of the running TX DMA transfer, 0 if the stream is idle
+ */
+static uint16_t tx_dma_len[UART_NUMOF];
+
+/**
+ * @brief   Bitmap of UARTs that hold their TX DMA stream
+ */
+static uint32_t tx_dma_acquired;
+#endif
 #endif
 
 /**
@@ -98,6 +132,9 @@ static inline USART_TypeDef *dev(uart_t uart)
 }
 
 static inline void uart_init_usart(uart_t uart, uint32_t baudrate);
+#if defined(MODULE_PERIPH_UART_NONBLOCKING) && defined(MODULE_PERIPH_DMA)
+static void _tx_dma_cb(void *arg);
+#endif
 #if defined(CPU_FAM_STM32L0) || defined(CPU_FAM_STM32L4) || \
     defined(CPU_FAM_STM32WB) || defined(CPU_FAM_STM32G4) || \
     defined(CPU_FAM_STM32L5) || defined(CPU_FAM_STM32U5) || \
@@ -239,6 +276,21 @@ int uart_init(uart_t uart, uint32_t baudrate, uart_rx_cb_t rx_cb, void *arg)
 
 #ifdef MODULE_PERIPH_UART_NONBLOCKING
     NVIC_EnableIRQ(uart_config[uart].irqn);
+#ifdef MODULE_PERIPH_DMA
+    if (uart_config[uart].dma != DMA_STREAM_UNDEF) {
+        /* the stream feeds the TX buffer to the UART from now on */
+        if (!(tx_dma_acquired & (1UL << uart))) {
+            dma_acquire(uart_config[uart].dma);
+            tx_dma_acquired |= 1UL << uart;
+        }
+        dma_setup(uart_config[uart].dma, uart_config[uart].dma_chan,
+                  (void *)&dev(uart)->TDR_REG, DMA_MEM_TO_PERIPH,
+                  DMA_DATA_WIDTH_BYTE, false);
+        dma_set_cb(uart_config[uart].dma, _tx_dma_cb, (void *)(uintptr_t)uart);
+        tx_dma_len[uart] = 0;
+        dev(uart)->CR3 |= USART_CR3_DMAT;
+    }
+#endif
 #endif
 
     return UART_OK;
@@ -380,6 +432,61 @@ static inline void wait_for_tx_complete(uart_t uart)
 }
 #endif
 
+#if defined(MODULE_PERIPH_UART_NONBLOCKING) && defined(MODULE_PERIPH_DMA)
+/* must be called with interrupts disabled */
+static void _tx_dma_next(uart_t uart)
+{
+    tsrb_t *rb = &uart_tx_rb[uart];
+    unsigned avail = tsrb_avail(rb);
+    unsigned tail = rb->reads & (rb->size - 1);
+
+    /* a transfer can only cover the part up to the end of the buffer */
+    tx_dma_len[uart] = (avail < rb->size - tail) ? avail : rb->size - tail;
+    if (tx_dma_len[uart]) {
+        dma_stop(uart_config[uart].dma);
+        dma_prepare(uart_config[uart].dma, rb->buf + tail, tx_dma_len[uart],
+                    true);
+        dma_start(uart_config[uart].dma);
+    }
+}
+
+static void _tx_dma_cb(void *arg)
+{
+    uart_t uart = (uart_t)(uintptr_t)arg;
+
+    /* ignore completions already handled by polling in _tx_dma_write() */
+    if (!tx_dma_len[uart] || dma_remaining(uart_config[uart].dma)) {
+        return;
+    }
+    tsrb_drop(&uart_tx_rb[uart], tx_dma_len[uart]);
+    _tx_dma_next(uart);
+}
+
+static void _tx_dma_write(uart_t uart, const uint8_t *data, size_t len)
+{
+    /* the DMA interrupt cannot free up space in these contexts */
+    bool poll = irq_is_in() || __get_PRIMASK();
+
+    while (len) {
+        int added = tsrb_add(&uart_tx_rb[uart], data, len);
+
+        data += added;
+        len -= added;
+
+        unsigned state = irq_disable();
+        if (!tx_dma_len[uart]) {
+            _tx_dma_next(uart);
+        }
+        else if (len && poll) {
+            /* wait for the running transfer to free up space */
+            while (dma_remaining(uart_config[uart].dma)) {}
+            _tx_dma_cb((void *)(uintptr_t)uart);
+        }
+        irq_restore(state);
+    }
+}
+#endif
+
 void uart_write(uart_t uart, const uint8_t *data, size_t len)
 {
     assert(uart < UART_NUMOF);
@@ -394,6 +501,9 @@ void uart_write(uart_t uart, const uint8_t *data, size_t len)
         return;
     }
     if (uart_config[uart].dma != DMA_STREAM_UNDEF) {
+#ifdef MODULE_PERIPH_UART_NONBLOCKING
+        _tx_dma_write(uart, data, len);
+#else
         if (irq_is_in()) {
             uint16_t todo = 0;
             if (dev(uart)->CR3 & USART_CR3_DMAT) {
@@ -425,6 +535,7 @@ void uart_write(uart_t uart, const uint8_t *data, size_t len)
             dev(uart)->CR3 &= ~USART_CR3_DMAT;
             dma_release(uart_config[uart].dma);
         }
+#endif
         return;
     }
 #endif
@@ -500,6 +611,105 @@ static inline void irq_handler_tx(uart_t uart)
 }
 #endif
 
+#ifdef MODULE_PERIPH_UART_RX_DMA
+static inline void _rx_dma_clear_idle(uart_t uart)
+{
+#ifdef USART_ICR_IDLECF
+    dev(uart)->ICR = USART_ICR_IDLECF;
+#else
+    /* IDLE is cleared by reading SR and DR sequentially */
+    (void)dev(uart)->SR;
+    (void)dev(uart)->DR;
+#endif
+}
+
+static void _rx_dma_flush(uart_t uart)
+{
+    uint16_t head = rx_dma_ctx[uart].len - dma_remaining(uart_config[uart].rx_dma);
+    uint16_t pos = rx_dma_ctx[uart].pos;
+
+    if (head == rx_dma_ctx[uart].len) {
+        /* the counter reloads right away, but just in case */
+        head = 0;
+    }
+    if (head < pos) {
+        /* the buffer wrapped around */
+        rx_dma_ctx[uart].cb(rx_dma_ctx[uart].arg, rx_dma_ctx[uart].buf + pos,
+                            rx_dma_ctx[uart].len - pos);
+        pos = 0;
+    }
+    if (head > pos) {
+        rx_dma_ctx[uart].cb(rx_dma_ctx[uart].arg, rx_dma_ctx[uart].buf + pos,
+                            head - pos);
+    }
+    rx_dma_ctx[uart].pos = head;
+}
+
+static void _rx_dma_cb(void *arg)
+{
+    _rx_dma_flush((uart_t)(uintptr_t)arg);
+}
+
+int uart_rx_dma_start(uart_t uart, uint8_t *buf, size_t len,
+                      uart_rx_block_cb_t cb, void *arg)
+{
+    assert(uart < UART_NUMOF);
+    assert(cb && (len > 0) && (len <= UINT16_MAX));
+
+    dma_t dma = uart_config[uart].rx_dma;
+
+    if (dma == DMA_STREAM_UNDEF) {
+        return -ENOTSUP;
+    }
+
+    dma_acquire(dma);
+    dma_setup(dma, uart_config[uart].rx_dma_chan, (void *)&dev(uart)->RDR_REG,
+              DMA_PERIPH_TO_MEM, DMA_DATA_WIDTH_BYTE, false);
+    dma_set_circular(dma);
+    dma_prepare(dma, buf, len, true);
+    dma_set_cb(dma, _rx_dma_cb, (void *)(uintptr_t)uart);
+
+    unsigned state = irq_disable();
+    rx_dma_ctx[uart].buf = buf;
+    rx_dma_ctx[uart].len = len;
+    rx_dma_ctx[uart].pos = 0;
+    rx_dma_ctx[uart].cb = cb;
+    rx_dma_ctx[uart].arg = arg;
+    dev(uart)->CR1 &= ~RX_IRQ_ENABLE;
+    dev(uart)->CR3 |= USART_CR3_DMAR;
+    dma_start(dma);
+    _rx_dma_clear_idle(uart);
+    dev(uart)->CR1 |= USART_CR1_IDLEIE;
+    irq_restore(state);
+
+    return 0;
+}
+
+void uart_rx_dma_stop(uart_t uart)
+{
+    assert(uart < UART_NUMOF);
+
+    dma_t dma = uart_config[uart].rx_dma;
+
+    if (!rx_dma_ctx[uart].cb) {
+        return;
+    }
+
+    unsigned state = irq_disable();
+    dev(uart)->CR1 &= ~USART_CR1_IDLEIE;
+    dev(uart)->CR3 &= ~USART_CR3_DMAR;
+    dma_stop(dma);
+    dma_set_cb(dma, NULL, NULL);
+    rx_dma_ctx[uart].cb = NULL;
+    if (isr_ctx[uart].rx_cb) {
+        dev(uart)->CR1 |= RX_IRQ_ENABLE;
+    }
+    irq_restore(state);
+
+    dma_release(dma);
+}
+#endif /* MODULE_PERIPH_UART_RX_DMA */
+
 static inline void irq_handler(uart_t uart)
 {
     uint32_t status = dev(uart)->ISR_REG;
@@ -510,6 +720,17 @@ static inline void irq_handler(uart_t uart)
     }
 #endif
 
+#ifdef MODULE_PERIPH_UART_RX_DMA
+    if (rx_dma_ctx[uart].cb) {
+        /* RXNE is only set until the DMA fetched the byte */
+        if (status & ISR_IDLE) {
+            _rx_dma_clear_idle(uart);
+            _rx_dma_flush(uart);
+        }
+        status &= ~ISR_RXNE;
+    }
+#endif
+
     if (status & ISR_RXNE) {
         isr_ctx[uart].rx_cb(isr_ctx[uart].arg,
                             (uint8_t)dev(uart)->RDR_REG & isr_ctx[uart].data_mask);
@@ -96,6 +96,19 @@ static uint16_t _ep_out_buf[_ENDPOINT_NUMOF];
 /* Buffers used for receiving packets on OUT EPs. */
 static uint8_t* _app_pbuf[_ENDPOINT_NUMOF];
 
+/* Double buffering state of an endpoint, see USBOPT_EP_DOUBLE_BUFFER */
+typedef struct {
+    uint8_t *buf;       /* buffer of the queued transfer */
+    uint16_t len;       /* length of the queued transfer */
+    uint16_t done_len;  /* bytes received by the last completed OUT transfer */
+    bool enabled;       /* double buffering is enabled */
+    bool active;        /* a transfer is running in the peripheral */
+    bool queued;        /* a transfer is queued behind the active one */
+} _ep_dbuf_t;
+
+static _ep_dbuf_t _dbuf_in[_ENDPOINT_NUMOF];
+static _ep_dbuf_t _dbuf_out[_ENDPOINT_NUMOF];
+
 /* Forward declaration for the usb device driver */
 const usbdev_driver_t driver;
 
@@ -104,6 +117,11 @@ static USB_TypeDef *_global_regs(const stm32_usbdev_fs_config_t *conf)
     return (USB_TypeDef *)conf->base_addr;
 }
 
+static _ep_dbuf_t *_dbuf(const usbdev_ep_t *ep)
+{
+    return ep->dir == USB_EP_DIR_IN ? &_dbuf_in[ep->num] : &_dbuf_out[ep->num];
+}
+
 #if _PMA_ACCESS_SCHEME == 1
 
 /* Endpoint Buffer Descriptor for the 1 x 16-bit/word access scheme
@@ -299,6 +317,53 @@ static void _set_address(stm32_usbdev_fs_t *usbdev, uint8_t address)
     _global_regs(conf)->DADDR = USB_DADDR_EF | (address & USB_DADDR_ADD);
 }
 
+static void _read_pma(const usbdev_ep_t *ep, uint8_t *buf, size_t len)
+{
+    /* `addr_rx` is the USB IP local address offset in half-words. The PMA
+     * address offset depends on the access scheme.
+     * - 2 x 16 bits/word access scheme: `_PMA_ACCESS_STEP_SIZE` is 1
+     *   and the PMA address offset corresponds to USB IP local address.
+     * - 1 x 16 bits/word access scheme: `_PMA_ACCESS_STEP_SIZE` is 2
+     *   and the PMA address offset is the double of the USB IP local
+     *   address. */
+    uint16_t* pma_ptr = (uint16_t *)(USB1_PMAADDR +
+                                     (EP_DESC[ep->num].addr_rx * _PMA_ACCESS_STEP_SIZE));
+    uint16_t hword;
+    size_t cpt = 0;
+    while (cpt < len) {
+        hword = *pma_ptr;
+        buf[cpt++] = hword & 0x00ff;
+        if (cpt < len) {
+            buf[cpt++] = (hword & 0xff00) >> 8;
+        }
+        pma_ptr += _PMA_ACCESS_STEP_SIZE;
+    }
+}
+
+static void _ep_start(usbdev_ep_t *ep, uint8_t *buf, size_t len);
+
+/* Called from the ISR on a completed transfer. With double buffering enabled,
+ * the queued transfer is started right away, the completed one is reported to
+ * the upper layer afterwards by _usbdev_ep_esr() */
+static void _dbuf_complete(usbdev_ep_t *ep)
+{
+    _ep_dbuf_t *dbuf = _dbuf(ep);
+
+    if (!dbuf->enabled || !dbuf->active) {
+        return;
+    }
+    if (ep->dir == USB_EP_DIR_OUT) {
+        /* the PMA buffer is reused by the next transfer, copy it out now */
+        dbuf->done_len = EP_DESC[ep->num].count_rx & 0x03FF;
+        _read_pma(ep, _app_pbuf[ep->num], dbuf->done_len);
+    }
+    dbuf->active = dbuf->queued;
+    if (dbuf->queued) {
+        dbuf->queued = false;
+        _ep_start(ep, dbuf->buf, dbuf->len);
+    }
+}
+
 void USBDEV_ISR(void) {
     stm32_usbdev_fs_t *usbdev = &_usbdevs[0];
     const stm32_usbdev_fs_config_t *conf = usbdev->config;
@@ -318,10 +383,12 @@ void USBDEV_ISR(void) {
         if (irq_status & USB_ISTR_DIR) {
             /* Clear RX CTR by writing 0, avoid clear TX CTR so leave it to one */
             EP_REG(epnum) = reg | USB_EP_CTR_TX;
+            _dbuf_complete(ep);
             usbdev->usbdev.epcb(ep, USBDEV_EVENT_ESR);
         } else {
             /* Clear TX CTR by writing 0, avoid clear RX CTR so leave it to one */
             EP_REG(epnum) = reg | USB_EP_CTR_RX;
+            _dbuf_complete(ep);
             usbdev->usbdev.epcb(ep, USBDEV_EVENT_ESR);
         }
     } else if (_global_regs(conf)->ISTR & USB_ISTR_RESET) {
@@ -615,7 +682,10 @@ static size_t _ep_get_available(usbdev_ep_t *ep)
     size_t size;
 
     if (ep->dir == USB_EP_DIR_OUT) {
-        size = EP_DESC[ep->num].count_rx & 0x03FF;
+        /* with double buffering the counter may belong to the next transfer
+         * already */
+        size = _dbuf(ep)->enabled ? _dbuf(ep)->done_len
+                                  : (EP_DESC[ep->num].count_rx & 0x03FF);
     } else {
         size = EP_DESC[ep->num].count_tx;
     }
@@ -674,6 +744,9 @@ static int _usbdev_ep_set(usbdev_ep_t *ep, usbopt_ep_t opt,
     switch (opt) {
         case USBOPT_EP_ENABLE:
             assert(value_len == sizeof(usbopt_enable_t));
+            /* drop transfers of the previous configuration */
+            _dbuf(ep)->active = false;
+            _dbuf(ep)->queued = false;
             if (*((usbopt_enable_t *)value)) {
                 _usbdev_ep_init(ep);
                 _ep_enable(ep);
@@ -688,6 +761,16 @@ static int _usbdev_ep_set(usbdev_ep_t *ep, usbopt_ep_t opt,
             _ep_set_stall(ep, *(usbopt_enable_t *)value);
             res = sizeof(usbopt_enable_t);
             break;
+        case USBOPT_EP_DOUBLE_BUFFER:
+            assert(value_len == sizeof(usbopt_enable_t));
+            if (ep->type == USB_EP_TYPE_CONTROL) {
+                break;
+            }
+            _dbuf(ep)->enabled = *(usbopt_enable_t *)value;
+            _dbuf(ep)->active = false;
+            _dbuf(ep)->queued = false;
+            res = sizeof(usbopt_enable_t);
+            break;
         default:
             DEBUG("usbdev_fs: Unhandled endpoint set call: 0x%x\n", opt);
             break;
@@ -697,33 +780,18 @@ static int _usbdev_ep_set(usbdev_ep_t *ep, usbopt_ep_t opt,
 
 static void _usbdev_ep_esr(usbdev_ep_t *ep)
 {
-    if (ep->dir == USB_EP_DIR_OUT) {
+    /* With double buffering the data was already copied by the ISR */
+    if (ep->dir == USB_EP_DIR_OUT && !_dbuf(ep)->enabled) {
         /* Copy PMA SRAM buffer to OUT buffer */
-        /* `addr_rx` is the USB IP local address offset in half-words. The PMA
-         * address offset depends on the access scheme.
-         * - 2 x 16 bits/word access scheme: `_PMA_ACCESS_STEP_SIZE` is 1
-         *   and the PMA address offset corresponds to USB IP local address.
-         * - 1 x 16 bits/word access scheme: `_PMA_ACCESS_STEP_SIZE` is 2
-         *   and the PMA address offset is the double of the USB IP local
-         *   address. */
-        uint16_t* pma_ptr = (uint16_t *)(USB1_PMAADDR +
-                                         (EP_DESC[ep->num].addr_rx * _PMA_ACCESS_STEP_SIZE));
-        uint16_t hword;
-        uint8_t cpt = 0;
-        while (cpt < 64) {
-            hword = *pma_ptr;
-            _app_pbuf[ep->num][cpt++] = hword & 0x00ff;
-            _app_pbuf[ep->num][cpt++] = (hword & 0xff00) >> 8;
-            pma_ptr += _PMA_ACCESS_STEP_SIZE;
-        }
+        _read_pma(ep, _app_pbuf[ep->num], 64);
     }
     ep->dev->epcb(ep, USBDEV_EVENT_TR_COMPLETE);
     _enable_irq();
 }
 
-static int _usbdev_ep_xmit(usbdev_ep_t *ep, uint8_t* buf, size_t len)
+/* Hands a transfer to the peripheral, must be called with IRQs disabled */
+static void _ep_start(usbdev_ep_t *ep, uint8_t *buf, size_t len)
 {
-    unsigned irq = irq_disable();
     uint16_t reg = EP_REG(ep->num);
     /* Avoid modification of the following registers */
     SETBIT(reg, USB_EP_CTR_RX | USB_EP_CTR_TX);
@@ -763,6 +831,29 @@ static int _usbdev_ep_xmit(usbdev_ep_t *ep, uint8_t* buf, size_t len)
     }
 
     EP_REG(ep->num) = reg;
+}
+
+static int _usbdev_ep_xmit(usbdev_ep_t *ep, uint8_t* buf, size_t len)
+{
+    _ep_dbuf_t *dbuf = _dbuf(ep);
+    unsigned irq = irq_disable();
+
+    if (dbuf->enabled) {
+        if (dbuf->active) {
+            if (dbuf->queued) {
+                irq_restore(irq);
+                return -EBUSY;
+            }
+            /* started by the ISR once the active transfer completes */
+            dbuf->buf = buf;
+            dbuf->len = len;
+            dbuf->queued = true;
+            irq_restore(irq);
+            return 0;
+        }
+        dbuf->active = true;
+    }
+    _ep_start(ep, buf, len);
     irq_restore(irq);
     return 0;
 }
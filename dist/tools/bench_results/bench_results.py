@@ -0,0 +1,241 @@
+#! /usr/bin/env python3
+#
+# Copyright (C) 2026 Freie Universität Berlin
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+"""
+Collects the results of benchmark applications using `test_utils_result_output`
+(JSON format) and stores them per board and commit, so the performance of core
+APIs can be tracked over time.
+
+Results are stored in `<db>/<board>/<commit>.json`, each file maps the
+application name to the results it printed.
+"""
+
+import argparse
+import datetime
+import json
+import os
+import re
+import signal
+import subprocess
+import sys
+import time
+
+RIOTBASE = os.path.abspath(os.path.join(os.path.dirname(__file__), "..", "..", ".."))
+
+DEFAULT_APPS = [
+    "tests/bench_msg_pingpong",
+    "tests/bench_mutex_pingpong",
+    "tests/bench_runtime_coreapis",
+    "tests/bench_sched_nop",
+    "tests/bench_thread_flags_pingpong",
+    "tests/bench_thread_yield_pingpong",
+    "tests/bench_timers",
+    "tests/bench_ztimer",
+]
+
+# a complete turo container ends with the exit status
+RESULT = re.compile(r"(\[.*\{\"exit_status\":\s*-?\d+\}\])")
+
+
+def parse_results(line):
+    """Returns the results in a line of output, None if it has none"""
+    match = RESULT.search(line)
+    if match is None:
+        return None
+    try:
+        results = json.loads(match.group(1))
+    except json.JSONDecodeError:
+        return None
+    return {
+        "exit_status": results[-1]["exit_status"],
+        "results": results[:-1],
+    }
+
+
+def commit_id():
+    rev = subprocess.check_output(["git", "-C", RIOTBASE, "rev-parse",
+                                   "--short", "HEAD"], text=True).strip()
+    dirty = subprocess.call(["git", "-C", RIOTBASE, "diff", "--quiet",
+                             "HEAD"]) != 0
+    return rev + ("-dirty" if dirty else "")
+
+
+def run_app(app, board, timeout):
+    """Builds and flashes an application, returns the results it prints"""
+    env = dict(os.environ, BOARD=board)
+    make = ["make", "--no-print-directory", "-C", os.path.join(RIOTBASE, app)]
+    subprocess.run(make + ["flash"], env=env, check=True,
+                   stdout=subprocess.DEVNULL)
+    term = subprocess.Popen(make + ["term"], env=env, text=True,
+                            stdin=subprocess.PIPE, stdout=subprocess.PIPE,
+                            stderr=subprocess.STDOUT, start_new_session=True)
+    deadline = time.monotonic() + timeout
+    result = None
+    try:
+        os.set_blocking(term.stdout.fileno(), False)
+        buf = ""
+        while result is None and time.monotonic() < deadline:
+            chunk = term.stdout.read()
+            if not chunk:
+                if term.poll() is not None:
+                    break
+                time.sleep(0.1)
+                continue
+            buf += chunk
+            lines = buf.split("\n")
+            buf = lines.pop()
+            for line in lines:
+                result = result or parse_results(line)
+    finally:
+        os.killpg(term.pid, signal.SIGTERM)
+        term.wait()
+    return result
+
+
+def db_file(db, board, commit):
+    return os.path.join(db, board, commit + ".json")
+
+
+def store(db, board, commit, app, result):
+    path = db_file(db, board, commit)
+    os.makedirs(os.path.dirname(path), exist_ok=True)
+    entry = {}
+    if os.path.exists(path):
+        with open(path) as f:
+            entry = json.load(f)
+    entry.setdefault("commit", commit)
+    entry.setdefault("board", board)
+    entry["date"] = datetime.datetime.now().isoformat(timespec="seconds")
+    entry.setdefault("apps", {})[app] = result
+    with open(path, "w") as f:
+        json.dump(entry, f, indent=2)
+
+
+def cmd_run(args):
+    commit = args.commit or commit_id()
+    failed = False
+    for app in args.apps or DEFAULT_APPS:
+        name = os.path.basename(os.path.normpath(app))
+        print(f"{args.board}: running {name}", file=sys.stderr)
+        try:
+            result = run_app(app, args.board, args.timeout)
+        except subprocess.CalledProcessError as exc:
+            print(f"{name}: {exc}", file=sys.stderr)
+            result = None
+        if result is None:
+            print(f"{name}: no results", file=sys.stderr)
+            failed = True
+            continue
+        store(args.db, args.board, commit, name, result)
+    return 1 if failed else 0
+
+
+def cmd_parse(args):
+    """Parses results from previously captured output"""
+    commit = args.commit or commit_id()
+    for line in args.input:
+        result = parse_results(line)
+        if result is not None:
+            store(args.db, args.board, commit, args.app, result)
+            return 0
+    print("no results found", file=sys.stderr)
+    return 1
+
+
+def _flatten(value, prefix=""):
+    """Yields (key, number) of all numbers in the results, lists of dicts are
+    keyed by their "name", "function" or "variant" member if present"""
+    if isinstance(value, dict):
+        for key, val in value.items():
+            if key in ("name", "function", "variant"):
+                continue
+            yield from _flatten(val, f"{prefix}.{key}" if prefix else key)
+    elif isinstance(value, list):
+        for idx, val in enumerate(value):
+            key = str(idx)
+            if isinstance(val, dict):
+                key = val.get("name", val.get("function",
+                                              val.get("variant", key)))
+            yield from _flatten(val, f"{prefix}[{key}]")
+    elif isinstance(value, (int, float)) and not isinstance(value, bool):
+        yield prefix, value
+
+
+def cmd_show(args):
+    """Prints the history of the results of an application on a board"""
+    board_dir = os.path.join(args.db, args.board)
+    entries = []
+    for name in os.listdir(board_dir):
+        with open(os.path.join(board_dir, name)) as f:
+            entry = json.load(f)
+        if args.app in entry.get("apps", {}):
+            entries.append(entry)
+    entries.sort(key=lambda e: e["date"])
+
+    keys = []
+    rows = []
+    for entry in entries:
+        row = dict(_flatten(entry["apps"][args.app]["results"]))
+        if args.filter:
+            row = {k: v for k, v in row.items() if re.search(args.filter, k)}
+        keys += [k for k in row if k not in keys]
+        rows.append((entry["commit"], row))
+
+    for key in keys:
+        print(key)
+        for commit, row in rows:
+            print(f"    {commit:16s} {row.get(key, '-')}")
+    return 0
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--db", default="bench_results",
+                        help="directory to store the results in "
+                             "(default: %(default)s)")
+    parser.add_argument("--board", default=os.environ.get("BOARD", "native"),
+                        help="board the results are for (default: $BOARD or "
+                             "native)")
+    sub = parser.add_subparsers(dest="command", required=True)
+
+    run = sub.add_parser("run", help="flash and run applications, store "
+                                     "their results")
+    run.add_argument("apps", nargs="*",
+                     help="applications relative to RIOTBASE (default: all "
+                          "core benchmarks)")
+    run.add_argument("--commit", help="commit to store the results for "
+                                      "(default: current HEAD)")
+    run.add_argument("-t", "--timeout", type=int, default=120,
+                     help="max time in seconds to wait for the results of an "
+                          "application (default: %(default)s)")
+    run.set_defaults(func=cmd_run)
+
+    parse = sub.add_parser("parse", help="store the results found in "
+                                         "captured output")
+    parse.add_argument("app", help="name of the application")
+    parse.add_argument("input", nargs="?", type=argparse.FileType("r"),
+                       default=sys.stdin,
+                       help="captured output, read from STDIN if omitted")
+    parse.add_argument("--commit", help="commit to store the results for "
+                                        "(default: current HEAD)")
+    parse.set_defaults(func=cmd_parse)
+
+    show = sub.add_parser("show", help="print the results of an application "
+                                       "over all stored commits")
+    show.add_argument("app", help="name of the application")
+    show.add_argument("-f", "--filter",
+                      help="only show values whose key matches this regex")
+    show.set_defaults(func=cmd_show)
+
+    args = parser.parse_args()
+    sys.exit(args.func(args))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,318 @@
+#! /usr/bin/env python3
+#
+# Copyright (C) 2026 Freie Universität Berlin
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+"""
+Runs the UDP benchmark on a simulated network of `native` nodes.
+
+A border router and a number of nodes running the `benchmark_udp` example are
+connected through the ZEP dispatcher, optionally using a topology file to
+simulate multi-hop paths and packet loss. For every workload the benchmark
+server is started on the host, all nodes start sending to it and when the
+workload is done the packet buffer and interface statistics of every node are
+collected. The results of all workloads are written as a single JSON report.
+
+Must be run with `sudo` as the border router needs a TAP interface.
+"""
+
+import argparse
+import json
+import os
+import queue
+import re
+import signal
+import subprocess
+import sys
+import tempfile
+import threading
+import time
+
+TOOLS_DIR = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+ZEP_DISPATCH = os.path.join(TOOLS_DIR, "zep_dispatch", "bin", "zep_dispatch")
+START_NETWORK = os.path.join(TOOLS_DIR, "zep_dispatch", "start_network.sh")
+BENCHMARK_SERVER = os.path.join(TOOLS_DIR, "benchmark_udp", "bin",
+                                "benchmark_server")
+
+# name:interval_us:payload_len
+DEFAULT_WORKLOADS = [
+    "flood:10000:32",
+    "periodic:1000000:32",
+    # exceeds a single IEEE 802.15.4 frame, exercises 6LoWPAN fragmentation
+    "fragmented:100000:300",
+]
+
+# EUI-64 of the border router (0) and the nodes (1..n), so they can be pinned
+# in the topology file
+EUI64_FMT = "02:00:00:00:00:00:00:{:02x}"
+
+RE_GLOBAL_ADDR = re.compile(r"inet6 addr: ([0-9a-f:]+)\s+scope: global")
+RE_IFACE = re.compile(r"Iface\s+(\S+)")
+RE_STATS_LAYER = re.compile(r"Statistics for (Layer 2|IPv6)")
+RE_STATS_RX = re.compile(r"RX packets (\d+)\s+bytes (\d+)")
+RE_STATS_TX = re.compile(r"TX packets (\d+) \(Multicast: (\d+)\)\s+bytes (\d+)")
+RE_STATS_TX_RES = re.compile(r"TX succeeded (\d+) errors (\d+)")
+RE_PKTBUF = re.compile(r"bytes in use: (\d+) \(high-water mark: (\d+)\)")
+
+
+class Node:
+    """A `native` instance controlled through its shell"""
+
+    def __init__(self, name, args):
+        self.name = name
+        self.lines = queue.Queue()
+        self.proc = subprocess.Popen(args, stdin=subprocess.PIPE,
+                                     stdout=subprocess.PIPE,
+                                     stderr=subprocess.STDOUT,
+                                     text=True, bufsize=1,
+                                     start_new_session=True)
+        threading.Thread(target=self._reader, daemon=True).start()
+
+    def _reader(self):
+        for line in self.proc.stdout:
+            self.lines.put(line.rstrip("\n"))
+
+    def cmd(self, cmd, timeout=2.0):
+        """Runs a shell command, returns the lines printed by it"""
+        while not self.lines.empty():
+            self.lines.get_nowait()
+        self.proc.stdin.write(cmd + "\n")
+        self.proc.stdin.flush()
+
+        # the prompt is not terminated by a newline, so the end of the output
+        # is detected by the node going quiet
+        out = []
+        deadline = time.monotonic() + timeout
+        while time.monotonic() < deadline:
+            try:
+                out.append(self.lines.get(timeout=0.3))
+            except queue.Empty:
+                if out:
+                    break
+        return out
+
+    def global_addr(self):
+        for line in self.cmd("ifconfig"):
+            match = RE_GLOBAL_ADDR.search(line)
+            if match:
+                return match.group(1)
+        return None
+
+    def stop(self):
+        if self.proc.poll() is None:
+            os.killpg(self.proc.pid, signal.SIGTERM)
+            try:
+                self.proc.wait(timeout=5)
+            except subprocess.TimeoutExpired:
+                os.killpg(self.proc.pid, signal.SIGKILL)
+
+
+def parse_ifconfig(lines):
+    """Extracts the netstats of all interfaces from the `ifconfig` output"""
+    ifaces = {}
+    stats = None
+    for line in lines:
+        match = RE_IFACE.search(line)
+        if match:
+            iface = ifaces.setdefault(match.group(1), {})
+            continue
+        match = RE_STATS_LAYER.search(line)
+        if match:
+            layer = "l2" if match.group(1) == "Layer 2" else "ipv6"
+            stats = iface.setdefault(layer, {})
+            continue
+        if stats is None:
+            continue
+        match = RE_STATS_RX.search(line)
+        if match:
+            stats["rx_packets"], stats["rx_bytes"] = map(int, match.groups())
+        match = RE_STATS_TX.search(line)
+        if match:
+            (stats["tx_packets"], stats["tx_multicast"],
+             stats["tx_bytes"]) = map(int, match.groups())
+        match = RE_STATS_TX_RES.search(line)
+        if match:
+            stats["tx_succeeded"], stats["tx_errors"] = map(int, match.groups())
+    return ifaces
+
+
+def parse_pktbuf(lines):
+    """Extracts the packet buffer usage from the `pktbuf` output"""
+    for line in lines:
+        match = RE_PKTBUF.search(line)
+        if match:
+            return {"in_use": int(match.group(1)),
+                    "high_water_mark": int(match.group(2))}
+    return None
+
+
+def node_stats(node):
+    return {
+        "pktbuf": parse_pktbuf(node.cmd("pktbuf")),
+        "netstats": parse_ifconfig(node.cmd("ifconfig")),
+    }
+
+
+def reset_stats(node):
+    for iface in parse_ifconfig(node.cmd("ifconfig")):
+        node.cmd(f"ifconfig {iface} stats all reset")
+
+
+def wait_for_addresses(nodes, timeout):
+    addrs = {}
+    deadline = time.monotonic() + timeout
+    while len(addrs) < len(nodes) and time.monotonic() < deadline:
+        for node in nodes:
+            if node.name not in addrs:
+                addr = node.global_addr()
+                if addr:
+                    addrs[node.name] = addr
+        time.sleep(1)
+    return addrs
+
+
+def run_workload(args, name, interval, payload, nodes):
+    print(f"running workload '{name}': {interval} µs, {payload} bytes",
+          file=sys.stderr)
+    with tempfile.NamedTemporaryFile(suffix=".json") as result:
+        server_args = [BENCHMARK_SERVER, "-q", "-d", str(args.duration),
+                       "-j", result.name, "-i", str(interval),
+                       "-s", str(payload), "::", str(args.port)]
+        if args.one_way:
+            server_args.insert(1, "-o")
+        server = subprocess.Popen(server_args)
+
+        # netstats are cumulative, only count this workload
+        for node in nodes:
+            reset_stats(node)
+
+        # let the server bind before the first packet arrives
+        time.sleep(0.5)
+        for node in nodes:
+            node.cmd(f"bench_udp start {args.server} {args.port}")
+        server.wait()
+        for node in nodes:
+            node.cmd("bench_udp stop")
+
+        with open(result.name) as f:
+            report = json.load(f)
+
+    report["name"] = name
+    report["nodes"] = {node.name: node_stats(node) for node in nodes}
+    return report
+
+
+def parse_workload(spec):
+    try:
+        name, interval, payload = spec.split(":")
+        return name, int(interval), int(payload)
+    except ValueError:
+        raise argparse.ArgumentTypeError(
+            f"'{spec}' is not of the form name:interval_us:payload_len")
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--br", required=True,
+                        help="ELF file of the border router "
+                             "(examples/gnrc_border_router)")
+    parser.add_argument("--node", required=True,
+                        help="ELF file of the nodes (examples/benchmark_udp "
+                             "built with USE_ZEP=1)")
+    parser.add_argument("-n", "--nodes", type=int, default=4,
+                        help="number of nodes (default: %(default)s)")
+    parser.add_argument("-t", "--topology",
+                        help="zep_dispatch topology file, "
+                             "flat topology if omitted")
+    parser.add_argument("--zep-port", type=int, default=17754,
+                        help="ZEP dispatcher port (default: %(default)s)")
+    parser.add_argument("--prefix", default="2001:db8::/64",
+                        help="prefix of the simulated network "
+                             "(default: %(default)s)")
+    parser.add_argument("--tap", default="tap0",
+                        help="TAP interface of the border router "
+                             "(default: %(default)s)")
+    parser.add_argument("--server", default="fdea:dbee:f::1",
+                        help="address of the host on the TAP interface "
+                             "(default: %(default)s)")
+    parser.add_argument("--port", type=int, default=12345,
+                        help="benchmark server port (default: %(default)s)")
+    parser.add_argument("-d", "--duration", type=int, default=60,
+                        help="duration of each workload in seconds "
+                             "(default: %(default)s)")
+    parser.add_argument("-w", "--workload", type=parse_workload,
+                        action="append",
+                        help="workload as name:interval_us:payload_len, can "
+                             "be given multiple times (default: "
+                             + ", ".join(DEFAULT_WORKLOADS) + ")")
+    parser.add_argument("-o", "--one-way", action="store_true",
+                        help="don't echo packets back to the nodes")
+    parser.add_argument("--settle", type=int, default=60,
+                        help="max time in seconds to wait for the nodes to "
+                             "get a global address (default: %(default)s)")
+    parser.add_argument("-j", "--json", default="-",
+                        help="output file for the report (default: stdout)")
+    args = parser.parse_args()
+
+    if os.geteuid() != 0 or "SUDO_USER" not in os.environ:
+        sys.exit("must be run with sudo to set up the TAP interface")
+    for tool in (ZEP_DISPATCH, BENCHMARK_SERVER):
+        if not os.access(tool, os.X_OK):
+            sys.exit(f"{tool} not found, run `make -C {os.path.dirname(os.path.dirname(tool))}`")
+
+    workloads = args.workload or [parse_workload(w) for w in DEFAULT_WORKLOADS]
+    zep = f"[::1]:{args.zep_port}"
+
+    dispatcher_args = [ZEP_DISPATCH]
+    if args.topology:
+        dispatcher_args += ["-t", args.topology]
+    dispatcher = subprocess.Popen(dispatcher_args + ["::1", str(args.zep_port)],
+                                  stdout=subprocess.DEVNULL)
+    br = None
+    nodes = []
+    try:
+        # start_network.sh starts its own dispatcher if given `-z`, but that
+        # one has no topology
+        br = Node("br", [START_NETWORK, args.br, args.prefix,
+                         "-z", zep, f"--eui64={EUI64_FMT.format(0)}",
+                         args.tap])
+        nodes = [Node(f"node{i}", ["sudo", "-u", os.environ["SUDO_USER"],
+                                   args.node, "-z", zep,
+                                   f"--eui64={EUI64_FMT.format(i)}"])
+                 for i in range(1, args.nodes + 1)]
+
+        addrs = wait_for_addresses(nodes, args.settle)
+        if len(addrs) < len(nodes):
+            missing = [n.name for n in nodes if n.name not in addrs]
+            print(f"no global address on {', '.join(missing)}",
+                  file=sys.stderr)
+
+        report = {
+            "topology": args.topology,
+            "duration_s": args.duration,
+            "nodes": addrs,
+            "workloads": [run_workload(args, *w, nodes) for w in workloads],
+            "border_router": node_stats(br),
+        }
+    finally:
+        for node in nodes:
+            node.stop()
+        if br:
+            br.stop()
+        dispatcher.terminate()
+        dispatcher.wait()
+
+    if args.json == "-":
+        json.dump(report, sys.stdout, indent=2)
+        print()
+    else:
+        with open(args.json, "w") as f:
+            json.dump(report, f, indent=2)
+
+
+if __name__ == "__main__":
+    main()
@@ -17,6 +17,7 @@
 
 #include <arpa/inet.h>
 #include <netdb.h>
+#include <signal.h>
 #include <stdbool.h>
 #include <stdio.h>
 #include <stdlib.h>
@@ -33,6 +34,9 @@
 #define US_PER_SEC  (1000 * US_PER_MS)
 #define MS_PER_SEC  (1000UL)
 
+/* number of round trip times kept per client for the percentiles */
+#define RTT_SAMPLES (4096)
+
 typedef struct {
     list_node_t node;
     struct sockaddr_in6 addr;
@@ -43,9 +47,15 @@ typedef struct {
     uint32_t count_rt;
     uint32_t rtt_us;
     size_t packet_len;
+    uint32_t rtt_samples[RTT_SAMPLES];
+    size_t rtt_count;
 } bench_client_t;
 
 static bool one_way;
+static bool quiet;
+static volatile sig_atomic_t stop;
+static unsigned duration_s;
+static const char *json_file;
 static uint32_t cookie;
 static uint32_t delay_us    = 100 * US_PER_MS; /* 100 ms */
 static uint16_t payload_len = 32;
@@ -81,8 +91,9 @@ static void clrscr(void)
 
 static uint64_t _tv_diff_msec(struct timeval *a, struct timeval *b)
 {
-    return (a->tv_sec - b->tv_sec) * MS_PER_SEC
-         + (a->tv_usec - b->tv_usec) / US_PER_MS;
+    /* the difference of the µs fields may be negative */
+    return (int64_t)(a->tv_sec - b->tv_sec) * (int64_t)MS_PER_SEC
+         + (int64_t)(a->tv_usec - b->tv_usec) / (int64_t)US_PER_MS;
 }
 
 static void _print_stats(list_node_t *head, struct timeval *now)
@@ -128,6 +139,70 @@ static void _print_stats(list_node_t *head, struct timeval *now)
     }
 }
 
+static void _add_rtt(bench_client_t *node, uint32_t rtt_us)
+{
+    node->rtt_samples[node->rtt_count % RTT_SAMPLES] = rtt_us;
+    node->rtt_count++;
+}
+
+static int _cmp_u32(const void *a, const void *b)
+{
+    uint32_t x = *(const uint32_t *)a;
+    uint32_t y = *(const uint32_t *)b;
+
+    return (x > y) - (x < y);
+}
+
+/* sorted must hold num > 0 samples in ascending order */
+static uint32_t _percentile(const uint32_t *sorted, size_t num, unsigned pct)
+{
+    return sorted[((num - 1) * pct + 50) / 100];
+}
+
+static void _write_json(list_node_t *head, struct timeval *now, FILE *out)
+{
+    fprintf(out, "{\n  \"interval_us\": %u,\n  \"payload_len\": %u,\n"
+                 "  \"one_way\": %s,\n  \"clients\": [",
+            delay_us, payload_len, one_way ? "true" : "false");
+
+    for (list_node_t* n = head->next; n; n = n->next) {
+        bench_client_t *node = container_of(n, bench_client_t, node);
+        unsigned elapsed_ms = _tv_diff_msec(now, &node->first_seen);
+
+        inet_ntop(AF_INET6, &node->addr.sin6_addr, addr_str, INET6_ADDRSTRLEN);
+        fprintf(out, "\n    {\n      \"host\": \"%s\",\n"
+                     "      \"duration_ms\": %u,\n"
+                     "      \"packet_len\": %zu,\n"
+                     "      \"bandwidth\": %llu,\n"
+                     "      \"tx\": %u,\n      \"rx\": %u,\n      \"rt\": %u",
+                addr_str, elapsed_ms, node->packet_len,
+                elapsed_ms ? (unsigned long long)node->count_rx * node->packet_len
+                             * MS_PER_SEC / elapsed_ms : 0,
+                node->count_tx, node->count_rx, node->count_rt);
+
+        size_t num = node->rtt_count < RTT_SAMPLES ? node->rtt_count : RTT_SAMPLES;
+        if (num) {
+            uint32_t *sorted = malloc(num * sizeof(*sorted));
+            memcpy(sorted, node->rtt_samples, num * sizeof(*sorted));
+            qsort(sorted, num, sizeof(*sorted), _cmp_u32);
+            fprintf(out, ",\n      \"rtt_us\": { \"samples\": %zu, \"min\": %u, "
+                         "\"p50\": %u, \"p90\": %u, \"p99\": %u, \"max\": %u }",
+                    num, sorted[0], _percentile(sorted, num, 50),
+                    _percentile(sorted, num, 90), _percentile(sorted, num, 99),
+                    sorted[num - 1]);
+            free(sorted);
+        }
+        fprintf(out, "\n    }%s", n->next ? "," : "");
+    }
+    fprintf(out, "\n  ]\n}\n");
+}
+
+static void _on_signal(int sig)
+{
+    (void)sig;
+    stop = 1;
+}
+
 static void dispatch_loop(int sock)
 {
     list_node_t head = { .next = NULL };
@@ -135,8 +210,12 @@ static void dispatch_loop(int sock)
     const size_t len_total = payload_len + sizeof(benchmark_msg_ping_t);
     uint8_t *buffer = malloc(len_total);
 
+    struct timeval tv_start;
+
+    gettimeofday(&tv_start, NULL);
+
     puts("entering loop…");
-    while (1) {
+    while (!stop) {
         struct sockaddr_in6 src_addr;
         socklen_t addr_len = sizeof(src_addr);
 
@@ -144,6 +223,11 @@ static void dispatch_loop(int sock)
         ssize_t bytes_in = recvfrom(sock, buffer, len_total, 0,
                                     (struct sockaddr*)&src_addr, &addr_len);
 
+        gettimeofday(&tv_now, NULL);
+        if (duration_s && _tv_diff_msec(&tv_now, &tv_start) >= duration_s * MS_PER_SEC) {
+            break;
+        }
+
         if (bytes_in <= 0 || addr_len != sizeof(src_addr)) {
             continue;
         }
@@ -154,6 +238,9 @@ static void dispatch_loop(int sock)
         benchmark_msg_ping_t *ping = (void *)buffer;
         node->count_tx = ping->seq_no + 1;
 
+        /* only count a round trip time once, the client repeats the last one
+         * until the next echo arrives */
+        bool new_rtt = !one_way && ping->replies > node->count_rt;
         if (!one_way) {
             node->count_rt = ping->replies;
         }
@@ -167,6 +254,7 @@ static void dispatch_loop(int sock)
             cmd->payload_len = payload_len;
             gettimeofday(&node->first_seen, NULL);
             node->count_rx   = 0;
+            node->rtt_count  = 0;
 
             bytes_in = sizeof(*cmd);
             new_node = true;
@@ -174,6 +262,9 @@ static void dispatch_loop(int sock)
             node->rtt_us = node->rtt_us
                          ? (node->rtt_us + ping->rtt_last) / 2
                          : ping->rtt_last;
+            if (new_rtt) {
+                _add_rtt(node, ping->rtt_last);
+            }
         }
 
         /* send reply */
@@ -181,18 +272,32 @@ static void dispatch_loop(int sock)
             sendto(sock, buffer, bytes_in, 0, (struct sockaddr*)&src_addr, addr_len);
         }
 
-        gettimeofday(&tv_now, NULL);
-        if (_tv_diff_msec(&tv_now, &tv_last) > 50) {
+        if (!quiet && _tv_diff_msec(&tv_now, &tv_last) > 50) {
             tv_last = tv_now;
             clrscr();
             _print_stats(&head, &tv_now);
         }
     }
+
+    free(buffer);
+
+    if (json_file) {
+        FILE *out = strcmp(json_file, "-") ? fopen(json_file, "w") : stdout;
+        if (out == NULL) {
+            perror("fopen()");
+            return;
+        }
+        _write_json(&head, &tv_now, out);
+        if (out != stdout) {
+            fclose(out);
+        }
+    }
 }
 
 static void _print_help(const char *progname)
 {
-    fprintf(stderr, "usage: %s [-i send interval] [-s payload size] <address> <port>\n",
+    fprintf(stderr, "usage: %s [-i send interval] [-s payload size] [-o] "
+                    "[-d duration] [-j json file] [-q] <address> <port>\n",
             progname);
 
     fprintf(stderr, "\npositional arguments:\n");
@@ -203,6 +308,9 @@ static void _print_help(const char *progname)
     fprintf(stderr, "\t-i <interval>\tsend interval in µs\n");
     fprintf(stderr, "\t-s <size>\tadded payload size\n");
     fprintf(stderr, "\t-o one-way mode, don't echo back packets\n");
+    fprintf(stderr, "\t-d <seconds>\tstop after the given time\n");
+    fprintf(stderr, "\t-j <file>\twrite the results as JSON on exit ('-' for stdout)\n");
+    fprintf(stderr, "\t-q quiet mode, don't print statistics while running\n");
 }
 
 int main(int argc, char **argv)
@@ -210,7 +318,7 @@ int main(int argc, char **argv)
     const char *progname = argv[0];
     int c;
 
-    while ((c = getopt(argc, argv, "i:s:o")) != -1) {
+    while ((c = getopt(argc, argv, "i:s:od:j:q")) != -1) {
         switch (c) {
         case 'i':
             delay_us = atoi(optarg);
@@ -221,6 +329,15 @@ int main(int argc, char **argv)
         case 'o':
             one_way = true;
             break;
+        case 'd':
+            duration_s = atoi(optarg);
+            break;
+        case 'j':
+            json_file = optarg;
+            break;
+        case 'q':
+            quiet = true;
+            break;
         default:
             _print_help(progname);
             exit(1);
@@ -267,6 +384,14 @@ int main(int argc, char **argv)
 
     freeaddrinfo(server_addr);
 
+    /* wake up regularly to check for the end of the run */
+    struct timeval timeout = { .tv_usec = 100 * US_PER_MS };
+    setsockopt(sock, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+
+    struct sigaction sa = { .sa_handler = _on_signal };
+    sigaction(SIGINT, &sa, NULL);
+    sigaction(SIGTERM, &sa, NULL);
+
     dispatch_loop(sock);
 
     close(sock);
@@ -0,0 +1,114 @@
+#! /usr/bin/env python3
+#
+# Copyright (C) 2026 Freie Universität Berlin
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+"""
+Replays inputs found by AFL through a fuzzing application that reports its
+cost by printing a `fuzzing_perf:` line (e.g. fuzzing/gnrc_rx) and lists the
+most expensive ones.
+
+Each input is run several times and the minimum is used, as the measurement
+of a single run is also influenced by the host.
+"""
+
+import argparse
+import glob
+import os
+import re
+import subprocess
+import sys
+
+PERF = re.compile(r"fuzzing_perf: (.*)")
+KEYS = ("time_ns", "cycles", "pktbuf_peak")
+
+
+def find_inputs(paths):
+    """Yields all inputs below the given AFL input or output directories"""
+    for path in paths:
+        if os.path.isfile(path):
+            yield path
+            continue
+        for sub in ("", "queue", "crashes", "hangs", "*/queue", "*/crashes",
+                    "*/hangs"):
+            for name in sorted(glob.glob(os.path.join(path, sub, "*"))):
+                if os.path.isfile(name) and \
+                        not os.path.basename(name).startswith("README"):
+                    yield name
+
+
+def measure(elf, path, runs, timeout):
+    """Returns the cost of an input, None if the application did not report it"""
+    best = None
+    for _ in range(runs):
+        with open(path, "rb") as f:
+            try:
+                proc = subprocess.run([elf], stdin=f, stdout=subprocess.PIPE,
+                                      stderr=subprocess.DEVNULL,
+                                      timeout=timeout)
+            except subprocess.TimeoutExpired:
+                return {"timeout": True}
+        match = PERF.search(proc.stdout.decode(errors="replace"))
+        if match is None:
+            return None
+        fields = match.group(1).split()
+        result = {k: int(v) for k, v in zip(fields[::2], fields[1::2])}
+        if best is None:
+            best = result
+        else:
+            for key in KEYS:
+                best[key] = min(best[key], result[key])
+    return best
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("elf", help="fuzzing application (built without "
+                                    "all-asan for meaningful timings)")
+    parser.add_argument("inputs", nargs="+",
+                        help="input files, input corpus or AFL findings "
+                             "directories")
+    parser.add_argument("-s", "--sort", choices=KEYS, default="time_ns",
+                        help="sort by this value (default: %(default)s)")
+    parser.add_argument("-n", "--num", type=int, default=20,
+                        help="number of inputs to list (default: %(default)s)")
+    parser.add_argument("-r", "--runs", type=int, default=3,
+                        help="runs per input (default: %(default)s)")
+    parser.add_argument("-t", "--timeout", type=float, default=5,
+                        help="timeout per run in seconds "
+                             "(default: %(default)s)")
+    args = parser.parse_args()
+
+    results = []
+    timeouts = []
+    for path in find_inputs(args.inputs):
+        result = measure(args.elf, path, args.runs, args.timeout)
+        if result is None:
+            print(f"{path}: no measurement, crashed?", file=sys.stderr)
+        elif result.get("timeout"):
+            timeouts.append(path)
+        else:
+            results.append((path, result))
+
+    if not results:
+        sys.exit("no inputs measured")
+    results.sort(key=lambda r: r[1][args.sort], reverse=True)
+    median = results[len(results) // 2][1][args.sort]
+    print(f"{len(results)} inputs, median {args.sort} {median}")
+    print(f"{'time_ns':>10s} {'cycles':>12s} {'pktbuf':>6s} {'frames':>6s} "
+          f"{'bytes':>5s} {'x median':>8s}  input")
+    for path, result in results[:args.num]:
+        factor = result[args.sort] / median if median else 0
+        print(f"{result['time_ns']:10d} {result['cycles']:12d} "
+              f"{result['pktbuf_peak']:6d} {result['frames']:6d} "
+              f"{result['bytes']:5d} {factor:8.1f}  {path}")
+    for path in timeouts:
+        print(f"{'timeout':>10s} {'-':>12s} {'-':>6s} {'-':>6s} {'-':>5s} "
+              f"{'-':>8s}  {path}")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,182 @@
+#! /usr/bin/env python3
+#
+# Copyright (C) 2026 Freie Universität Berlin
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+"""
+Script to format the records written by the `log_deferred` module.
+
+The format strings are read from the `.logstr` section of the ELF file, all
+output that is not a record is passed through.
+"""
+
+import argparse
+import re
+import struct
+import sys
+
+SYNC = 0x1e
+
+ARG_U32 = 1
+ARG_U64 = 2
+ARG_DOUBLE = 3
+ARG_STR = 4
+
+LEVELS = {1: "ERROR", 2: "WARNING", 3: "INFO", 4: "DEBUG"}
+
+CONVERSION = re.compile(
+    r"%(?P<flags>[-+ #0]*)(?P<width>\*|\d+)?(?:\.(?P<prec>\*|\d+))?"
+    r"(?P<length>hh|h|ll|l|j|z|t|L)?(?P<conv>[diouxXeEfFgGaAcspn%])"
+)
+
+
+def read_logstr(elf):
+    """Returns the endianness and address of `.logstr` and its content"""
+    with open(elf, "rb") as f:
+        data = f.read()
+    if data[:4] != b"\x7fELF":
+        sys.exit("{} is no ELF file".format(elf))
+    is64 = data[4] == 2
+    end = "<" if data[5] == 1 else ">"
+    if is64:
+        shoff, = struct.unpack_from(end + "Q", data, 0x28)
+        shentsize, shnum, shstrndx = struct.unpack_from(end + "HHH", data, 0x3a)
+        shdr = end + "IIQQQQIIQQ"
+    else:
+        shoff, = struct.unpack_from(end + "I", data, 0x20)
+        shentsize, shnum, shstrndx = struct.unpack_from(end + "HHH", data, 0x2e)
+        shdr = end + "IIIIIIIIII"
+    sections = [struct.unpack_from(shdr, data, shoff + i * shentsize)
+                for i in range(shnum)]
+    names = sections[shstrndx]
+    for name, _, _, addr, offset, size, *_ in sections:
+        start = names[4] + name
+        if data[start:data.index(b"\0", start)] == b".logstr":
+            return end, addr, data[offset:offset + size]
+    sys.exit("{} has no .logstr section".format(elf))
+
+
+def format_arg(spec, value):
+    """Formats a single argument with a C conversion specification"""
+    conv = spec.group("conv")
+    width = spec.group("width") or ""
+    prec = spec.group("prec")
+    pyspec = "%" + spec.group("flags") + width
+    if prec is not None:
+        pyspec += "." + prec
+    if conv == "p":
+        return "0x{:x}".format(value)
+    if conv in "di":
+        bits = 64 if spec.group("length") in ("ll", "j") or value >= 1 << 32 \
+            else 32
+        if value >= 1 << (bits - 1):
+            value -= 1 << bits
+        conv = "d"
+    elif conv == "u":
+        conv = "d"
+    elif conv == "c":
+        value = chr(value)
+    elif conv in "aA":
+        conv = "e"
+    return (pyspec + conv) % value
+
+
+def format_record(fmt, args):
+    """Formats a record like printf() would"""
+    out = []
+    pos = 0
+    args = iter(args)
+    for spec in CONVERSION.finditer(fmt):
+        out.append(fmt[pos:spec.start()])
+        pos = spec.end()
+        if spec.group("conv") == "%":
+            out.append("%")
+            continue
+        try:
+            out.append(format_arg(spec, next(args)))
+        except StopIteration:
+            out.append(spec.group(0))
+        except (TypeError, ValueError):
+            out.append("<{}?>".format(spec.group(0)))
+    out.append(fmt[pos:])
+    return "".join(out)
+
+
+def parse_args(end, data):
+    """Parses the arguments of a record"""
+    args = []
+    pos = 0
+    while pos < len(data):
+        arg_type = data[pos]
+        pos += 1
+        if arg_type == ARG_U32:
+            value, = struct.unpack_from(end + "I", data, pos)
+            pos += 4
+        elif arg_type == ARG_U64:
+            value, = struct.unpack_from(end + "Q", data, pos)
+            pos += 8
+        elif arg_type == ARG_DOUBLE:
+            value, = struct.unpack_from(end + "d", data, pos)
+            pos += 8
+        elif arg_type == ARG_STR:
+            length = data[pos]
+            value = data[pos + 1:pos + 1 + length].decode(errors="replace")
+            pos += 1 + length
+        else:
+            raise ValueError("unknown argument type {}".format(arg_type))
+        args.append(value)
+    return args
+
+
+def decode_record(end, addr, logstr, record, prefix=False):
+    """Returns the text of a record"""
+    level = record[0]
+    if level == 0:
+        dropped, = struct.unpack_from(end + "I", record, 1)
+        return "*** log_deferred: {} records dropped\n".format(dropped)
+    fmt_id, = struct.unpack_from(end + "I", record, 1)
+    offset = fmt_id - addr
+    if not 0 <= offset < len(logstr):
+        return "*** log_deferred: unknown format 0x{:x}\n".format(fmt_id)
+    fmt = logstr[offset:logstr.index(b"\0", offset)].decode(errors="replace")
+    text = format_record(fmt, parse_args(end, record[5:]))
+    if prefix:
+        text = "[{}] {}".format(LEVELS.get(level, level), text)
+    return text
+
+
+def decode(inp, out, end, addr, logstr, prefix=False):
+    """Decodes the records in inp and passes everything else through"""
+    while True:
+        byte = inp.read(1)
+        if not byte:
+            break
+        if byte[0] != SYNC:
+            out.write(byte.decode(errors="replace"))
+            continue
+        length = inp.read(1)
+        if not length:
+            break
+        record = inp.read(length[0])
+        if len(record) < 5:
+            break
+        try:
+            out.write(decode_record(end, addr, logstr, record, prefix))
+        except (ValueError, struct.error, IndexError) as exc:
+            out.write("*** log_deferred: broken record: {}\n".format(exc))
+        out.flush()
+
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("elf", help="ELF file of the application")
+    parser.add_argument("input", nargs="?", type=argparse.FileType("rb"),
+                        default=sys.stdin.buffer,
+                        help="output of the node (default: stdin)")
+    parser.add_argument("-l", "--level", action="store_true",
+                        help="prefix messages with their log level")
+    args = parser.parse_args()
+    decode(args.input, sys.stdout, *read_logstr(args.elf), prefix=args.level)
@@ -9,6 +9,7 @@ import io
 import itertools
 import mmap
 import shutil
+import subprocess
 from binascii import hexlify
 
 C_HEADER = """/* This file was automatically generated by mkconstfs2.
@@ -27,6 +28,14 @@ FILE_TEMPLATE = """ {{
  }},
 """
 
+COMPRESSED_FILE_TEMPLATE = """ {{
+  .path = "{target_name}",
+  .data = {buff_name},
+  .size = {size},
+  .compressed_size = sizeof({buff_name})
+ }},
+"""
+
 C_FOOTER = """
 static const constfs_t _fs_data = {{
     .files = _files,
@@ -55,9 +64,15 @@ def _relpath_p(path, start):
                              pathlib.Path(os.path.abspath(start)).as_posix())
 
 
-def mkconstfs(files, root_path, mount_point, constfs_name):
+def mkconstfs(files, root_path, mount_point, constfs_name, heatshrink=None):
     """Generate a C file containing a constant file system
 
+    Parameters
+    ----------
+
+    heatshrink: (window, lookahead) to compress the files with heatshrink,
+                None to store them uncompressed.
+
     Return
     ------
 
@@ -66,16 +81,29 @@ def mkconstfs(files, root_path, mount_point, constfs_name):
 
     filemap = {f: (_mkident(i), _relpath_p(f, root_path))
                for i, f in enumerate(files)}
+    compressed = {}
+    if heatshrink:
+        for local_f, (ident, _) in filemap.items():
+            data = compress_file(local_f, *heatshrink)
+            if data is not None:
+                compressed[ident] = data
 
     yield C_HEADER
     yield from itertools.chain.from_iterable(
-                print_file_data(local_f, *f_data) for local_f, f_data in filemap.items())
+                print_file_data(local_f, *f_data,
+                                data=compressed.get(f_data[0], (None, None))[1])
+                for local_f, f_data in filemap.items())
 
     yield FILES_DECL
 
-    yield from (FILE_TEMPLATE.format(target_name=_addroot(relp),
-                                     buff_name=ident)
-                for ident, relp in sorted(filemap.values()))
+    for ident, relp in sorted(filemap.values()):
+        if ident in compressed:
+            yield COMPRESSED_FILE_TEMPLATE.format(target_name=_addroot(relp),
+                                                  buff_name=ident,
+                                                  size=compressed[ident][0])
+        else:
+            yield FILE_TEMPLATE.format(target_name=_addroot(relp),
+                                       buff_name=ident)
 
     yield "};\n"
 
@@ -90,7 +118,27 @@ def _mkident(k):
     return "_file{:02X}".format(k)
 
 
-def print_file_data(local_fname, varname, target_fname=""):
+def compress_file(local_fname, window, lookahead):
+    """Compress a file with the heatshrink command line tool
+
+    Return
+    ------
+
+    (size, data): uncompressed size and compressed contents, or None if
+                  compression does not make the file smaller.
+    """
+
+    with open(local_fname, 'rb') as f:
+        size = len(f.read())
+
+    data = subprocess.run(["heatshrink", "-e", "-w", str(window),
+                           "-l", str(lookahead), str(local_fname)],
+                          stdout=subprocess.PIPE, check=True).stdout
+
+    return (size, data) if len(data) < size else None
+
+
+def print_file_data(local_fname, varname, target_fname="", data=None):
     """Convert a file into a static C array:
 
     Parameters
@@ -98,7 +146,7 @@ def print_file_data(local_fname, varname, target_fname=""):
 
     local_fname: real Path (where the file is on this machine's fs)
     target_fname: name that the file will have in the constfs.
-    output_file: File-like object where the array will be written.
+    data: contents to write instead of the contents of the file.
 
     Return
     ------
@@ -116,16 +164,22 @@ def print_file_data(local_fname, varname, target_fname=""):
         return (x for _, x in itertools.groupby(enumerate(iterable),
                                                 lambda x: x[0]//blocksize))
 
-    with open(local_fname, 'rb') as f, mmap.mmap(f.fileno(), 0,
-                                                 access=mmap.ACCESS_READ
-                                                 ) as bfile:
-        yield from map(lambda x: x[1],
-                       itertools.chain.from_iterable(
-                            map(lambda l: itertools.chain(l, [(0, "\n")]),
-                                chunk(map(byte2s, bfile), 16)
-                                )
-                        )
-                       )
+    def lines(bfile):
+        return map(lambda x: x[1],
+                   itertools.chain.from_iterable(
+                        map(lambda l: itertools.chain(l, [(0, "\n")]),
+                            chunk(map(byte2s, bfile), 16)
+                            )
+                    )
+                   )
+
+    if data is not None:
+        yield from lines(data[i:i + 1] for i in range(len(data)))
+    else:
+        with open(local_fname, 'rb') as f, mmap.mmap(f.fileno(), 0,
+                                                     access=mmap.ACCESS_READ
+                                                     ) as bfile:
+            yield from lines(bfile)
 
     yield "};\n"
 
@@ -149,6 +203,19 @@ def main():
                         "By default the current directory (.) is used",
                         default=pathlib.Path())
 
+    parser.add_argument("-z", '--heatshrink', action="store_true",
+                        help="Compress the files with heatshrink, unless that "
+                        "does not make them smaller. Requires the heatshrink "
+                        "command line tool and the constfs_heatshrink module")
+
+    parser.add_argument("-w", '--window', type=int, default=8,
+                        help="heatshrink window size, must match the decoder "
+                        "(HEATSHRINK_STATIC_WINDOW_BITS)")
+
+    parser.add_argument("-l", '--lookahead', type=int, default=4,
+                        help="heatshrink lookahead size, must match the decoder "
+                        "(HEATSHRINK_STATIC_LOOKAHEAD_BITS)")
+
     parser.add_argument("name", help="Name for the vfs_mount_t structure")
 
     parser.add_argument("files", nargs="+", type=pathlib.Path,
@@ -156,7 +223,8 @@ def main():
 
     ns = parser.parse_args()
 
-    f_chunks = mkconstfs(ns.files, ns.root, ns.mount, ns.name)
+    f_chunks = mkconstfs(ns.files, ns.root, ns.mount, ns.name,
+                         (ns.window, ns.lookahead) if ns.heatshrink else None)
 
     if ns.output:
         tmp_out = io.StringIO()
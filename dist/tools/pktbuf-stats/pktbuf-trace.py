@@ -0,0 +1,227 @@
+#! /usr/bin/env python3
+#
+# Copyright (C) 2026 Freie Universität Berlin
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+"""
+Script to follow the allocation trace of `gnrc_pktbuf_static` (provided by the
+`gnrc_pktbuf_static_trace` pseudo-module).
+
+Prints the usage and fragmentation of the packet buffer over time, reports
+failed allocations together with the state of the buffer at that time and
+lists allocations that live suspiciously long on exit.
+"""
+
+import argparse
+import bisect
+import collections
+import csv
+import re
+import sys
+
+TRACE = re.compile(r"pktbuf_trace: ([iafxr]) (\d+) (-?\d+) (\d+) (\d+)")
+
+
+class Allocation:
+    def __init__(self, offset, size, born, pid):
+        self.offset = offset
+        self.size = size
+        self.born = born
+        self.pid = pid
+        self.moved = False
+
+    @property
+    def end(self):
+        return self.offset + self.size
+
+
+class Pktbuf:
+    """State of the packet buffer as reconstructed from the trace"""
+
+    def __init__(self, size=0):
+        self.size = size
+        self.offsets = []       # sorted offsets of all allocations
+        self.allocs = {}        # offset -> Allocation
+        self.realloc = None     # (offset, pid) of a realloc in progress
+        self.lifetimes = collections.defaultdict(list)  # pid -> [ms]
+        self.stats = collections.Counter()
+
+    def alloc(self, now, pid, offset, size):
+        alloc = Allocation(offset, size, now, pid)
+        if self.realloc and self.realloc[1] == pid and \
+                self.realloc[0] in self.allocs:
+            # the data keeps its age when it is moved
+            old = self.allocs[self.realloc[0]]
+            alloc.born = old.born
+            old.moved = True
+            self.realloc = None
+        bisect.insort(self.offsets, offset)
+        self.allocs[offset] = alloc
+        self.stats["alloc"] += 1
+
+    def free(self, now, pid, offset, size):
+        self.realloc = None
+        idx = bisect.bisect_right(self.offsets, offset) - 1
+        if idx < 0 or self.allocs[self.offsets[idx]].end < offset + size:
+            print(f"warning: free of unknown range {offset}+{size}",
+                  file=sys.stderr)
+            return
+        alloc = self.allocs.pop(self.offsets.pop(idx))
+        end = offset + size
+        # realloc to a smaller size only frees the tail
+        if alloc.offset < offset:
+            self._insert(Allocation(alloc.offset, offset - alloc.offset,
+                                    alloc.born, alloc.pid))
+        if end < alloc.end:
+            self._insert(Allocation(end, alloc.end - end, alloc.born,
+                                    alloc.pid))
+        if alloc.offset == offset and alloc.end == end and not alloc.moved:
+            self.lifetimes[alloc.pid].append(now - alloc.born)
+            self.stats["free"] += 1
+
+    def _insert(self, alloc):
+        bisect.insort(self.offsets, alloc.offset)
+        self.allocs[alloc.offset] = alloc
+
+    def holes(self):
+        """Returns the sizes of all unallocated areas"""
+        holes = []
+        pos = 0
+        for offset in self.offsets:
+            if offset > pos:
+                holes.append(offset - pos)
+            pos = self.allocs[offset].end
+        if self.size > pos:
+            holes.append(self.size - pos)
+        return holes
+
+    def summary(self, now):
+        holes = self.holes()
+        free = sum(holes)
+        largest = max(holes, default=0)
+        return {
+            "time_ms": now,
+            "used": self.size - free,
+            "allocs": len(self.allocs),
+            "holes": len(holes),
+            "largest_hole": largest,
+            # share of the free space not usable for the largest request
+            "fragmentation": round(1 - largest / free, 3) if free else 0,
+        }
+
+    def map(self, width):
+        """Returns the buffer as text, one char per `size / width` bytes"""
+        if not self.size:
+            return ""
+        used = [0] * width
+        scale = self.size / width
+        for alloc in self.allocs.values():
+            first = int(alloc.offset / scale)
+            last = min(int((alloc.end - 1) / scale), width - 1)
+            for cell in range(first, last + 1):
+                lo = max(alloc.offset, cell * scale)
+                hi = min(alloc.end, (cell + 1) * scale)
+                used[cell] += hi - lo
+        return "".join("#" if u >= scale else ("+" if u > 0 else ".")
+                       for u in used)
+
+
+def print_row(row, bytemap):
+    print(f"{row['time_ms'] / 1000:10.3f}s  used {row['used']:6d}  "
+          f"allocs {row['allocs']:4d}  holes {row['holes']:4d}  "
+          f"largest {row['largest_hole']:6d}  "
+          f"frag {row['fragmentation'] * 100:5.1f}%  {bytemap}")
+
+
+def print_report(pktbuf, now, leak_age):
+    print(f"\n{pktbuf.stats['alloc']} allocations, {pktbuf.stats['free']} "
+          f"frees, {pktbuf.stats['realloc']} reallocations, "
+          f"{pktbuf.stats['failed']} failed")
+
+    print("\nlifetime of freed allocations per thread:")
+    for pid, times in sorted(pktbuf.lifetimes.items()):
+        times.sort()
+        print(f"  pid {pid:3d}: {len(times):6d} allocations, "
+              f"median {times[len(times) // 2]:6d} ms, max {times[-1]:6d} ms")
+
+    suspects = collections.defaultdict(list)
+    for alloc in pktbuf.allocs.values():
+        if now - alloc.born >= leak_age:
+            suspects[alloc.pid].append(alloc)
+    if not suspects:
+        print(f"\nno allocations older than {leak_age} ms")
+        return
+    print(f"\nallocations older than {leak_age} ms (leak suspects):")
+    for pid, allocs in sorted(suspects.items()):
+        for alloc in sorted(allocs, key=lambda a: a.born):
+            print(f"  pid {pid:3d}: offset {alloc.offset:6d}, "
+                  f"{alloc.size:5d} bytes, age {now - alloc.born} ms")
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("trace", nargs="?", type=argparse.FileType("r"),
+                        default=sys.stdin,
+                        help="output of the node, read from STDIN if omitted")
+    parser.add_argument("-i", "--interval", type=int, default=1000,
+                        help="print the state every INTERVAL ms of node time "
+                             "(default: %(default)s)")
+    parser.add_argument("-w", "--width", type=int, default=64,
+                        help="width of the buffer map (default: %(default)s)")
+    parser.add_argument("-l", "--leak-age", type=int, default=10000,
+                        help="report allocations older than LEAK_AGE ms on "
+                             "exit (default: %(default)s)")
+    parser.add_argument("--csv", type=argparse.FileType("w"),
+                        help="also write the state over time as CSV")
+    parser.add_argument("-e", "--echo", action="store_true",
+                        help="pass through all other output of the node")
+    args = parser.parse_args()
+
+    pktbuf = Pktbuf()
+    writer = None
+    now = 0
+    next_row = 0
+    try:
+        for line in args.trace:
+            match = TRACE.search(line)
+            if match is None:
+                if args.echo:
+                    print(line, end="")
+                continue
+            event = match.group(1)
+            now, pid, offset, size = map(int, match.groups()[1:])
+            if event == "i":
+                pktbuf = Pktbuf(size)
+                next_row = now
+            elif event == "a":
+                pktbuf.alloc(now, pid, offset, size)
+            elif event == "f":
+                pktbuf.free(now, pid, offset, size)
+            elif event == "r":
+                pktbuf.realloc = (offset, pid)
+                pktbuf.stats["realloc"] += 1
+            elif event == "x":
+                pktbuf.stats["failed"] += 1
+                row = pktbuf.summary(now)
+                print(f"allocation of {size} bytes by pid {pid} failed:")
+                print_row(row, pktbuf.map(args.width))
+
+            if now >= next_row:
+                row = pktbuf.summary(now)
+                print_row(row, pktbuf.map(args.width))
+                if args.csv:
+                    if writer is None:
+                        writer = csv.DictWriter(args.csv, row.keys())
+                        writer.writeheader()
+                    writer.writerow(row)
+                next_row = now + args.interval
+    except KeyboardInterrupt:
+        pass
+    print_report(pktbuf, now, args.leak_age)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,113 @@
+#! /usr/bin/env python3
+#
+# Copyright (C) 2026 Freie Universität Berlin
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+"""
+Script to map the histogram printed by the `profiler` module to functions.
+
+The last histogram found in the input is printed as folded stacks
+(`<thread>;<function> <count>`), as expected by flame graph generators such
+as `flamegraph.pl` or speedscope.
+"""
+
+import argparse
+import bisect
+import collections
+import re
+import subprocess
+import sys
+
+HEADER = re.compile(r"profiler: samples (\d+) isr (\d+) lost (\d+)")
+SAMPLE = re.compile(r"profiler: (\d+) (-?\d+) (\S+) 0x([0-9a-fA-F]+)")
+END = re.compile(r"profiler: end")
+
+
+class Symbols:
+    """Maps addresses to the functions containing them"""
+
+    def __init__(self, elf, nm):
+        out = subprocess.check_output([nm, "-C", "-n", "-S", "--defined-only",
+                                       elf], universal_newlines=True)
+        self.starts = []
+        self.symbols = []
+        for line in out.splitlines():
+            fields = line.split(maxsplit=3)
+            if len(fields) != 4 or fields[2] not in "tTwW":
+                continue
+            # clear the Thumb bit
+            start = int(fields[0], 16) & ~1
+            self.starts.append(start)
+            self.symbols.append((start + int(fields[1], 16), fields[3]))
+
+    def lookup(self, addr):
+        """Returns the name of the function containing addr"""
+        idx = bisect.bisect_right(self.starts, addr) - 1
+        if idx >= 0 and addr < self.symbols[idx][0]:
+            return self.symbols[idx][1]
+        return "0x{:x}".format(addr)
+
+
+def parse(lines):
+    """Returns the statistics and the samples of the last histogram"""
+    stats = None
+    samples = []
+    complete = None
+    for line in lines:
+        match = HEADER.search(line)
+        if match:
+            stats = [int(x) for x in match.groups()]
+            samples = []
+            continue
+        if stats is None:
+            continue
+        match = SAMPLE.search(line)
+        if match:
+            count, pid, name, pc = match.groups()
+            if name == "-":
+                name = "pid{}".format(pid)
+            samples.append((int(count), name, int(pc, 16)))
+        elif END.search(line):
+            complete = (stats, samples)
+    if complete is None:
+        sys.exit("no complete histogram found")
+    return complete
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("elf", help="ELF file of the application")
+    parser.add_argument("input", nargs="?", type=argparse.FileType("r"),
+                        default=sys.stdin,
+                        help="output of the node (default: stdin)")
+    parser.add_argument("--nm", default="nm",
+                        help="nm to use, e.g. arm-none-eabi-nm (default: nm)")
+    parser.add_argument("-t", "--top", type=int, metavar="N",
+                        help="print the N functions with most samples instead")
+    args = parser.parse_args()
+
+    (samples_total, isr, lost), samples = parse(args.input)
+    symbols = Symbols(args.elf, args.nm)
+
+    folded = collections.Counter()
+    for count, thread, pc in samples:
+        folded[(thread, symbols.lookup(pc))] += count
+    if isr:
+        folded[("isr", "[unknown]")] += isr
+
+    if args.top is None:
+        for (thread, func), count in sorted(folded.items()):
+            print("{};{} {}".format(thread, func, count))
+        return
+
+    print("{} samples, {} lost".format(samples_total, lost))
+    for (thread, func), count in folded.most_common(args.top):
+        print("{:6.2f}% {:8} {:12} {}".format(100 * count / samples_total,
+                                              count, thread, func))
+
+
+if __name__ == "__main__":
+    main()
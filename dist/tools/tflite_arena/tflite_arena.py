@@ -0,0 +1,221 @@
+#! /usr/bin/env python3
+#
+# Copyright (C) 2026 Freie Universität Berlin
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+"""
+Computes the size of the tensor arena a TensorFlow Lite Micro model needs and
+writes it as C header.
+
+The non-persistent part of the arena is planned like the greedy memory planner
+of TensorFlow Lite Micro does: the non-constant tensors of the main subgraph
+are placed largest first at the lowest offset that does not overlap with any
+tensor alive at the same time. The persistent part (tensor and node metadata,
+variable tensors, per channel quantization data) is estimated from the number
+of tensors and operators. Kernels may request additional scratch buffers, which
+is covered by the margin.
+"""
+
+import argparse
+import struct
+import sys
+
+# TensorType of the TFLite schema -> size of an element in bytes
+TYPE_SIZE = {
+    0: 4,   # FLOAT32
+    1: 2,   # FLOAT16
+    2: 4,   # INT32
+    3: 1,   # UINT8
+    4: 8,   # INT64
+    6: 1,   # BOOL
+    7: 2,   # INT16
+    8: 8,   # COMPLEX64
+    9: 1,   # INT8
+    10: 8,  # FLOAT64
+    11: 16,  # COMPLEX128
+    12: 8,  # UINT64
+    15: 4,  # UINT32
+    16: 2,  # UINT16
+}
+
+# BuiltinOperator of the TFLite schema with per output channel quantization
+# data allocated by the kernel
+PER_CHANNEL_OPS = {
+    3,      # CONV_2D
+    4,      # DEPTHWISE_CONV_2D
+    67,     # TRANSPOSE_CONV
+}
+
+BUFFER_ALIGNMENT = 16   # MicroArenaBufferAlignment()
+EVAL_TENSOR_SIZE = 12   # TfLiteEvalTensor on 32 bit targets
+TENSOR_SIZE = 64        # TfLiteTensor of the inputs and outputs
+NODE_SIZE = 48          # NodeAndRegistration
+BUILTIN_DATA_SIZE = 32  # parsed builtin options of an operator
+FIXED_OVERHEAD = 512    # allocator, memory planner and interpreter state
+
+
+class Table:
+    """Minimal read-only access to a FlatBuffers table"""
+
+    def __init__(self, buf, pos):
+        self.buf = buf
+        self.pos = pos
+        vtable = pos - struct.unpack_from("<i", buf, pos)[0]
+        vt_len = struct.unpack_from("<H", buf, vtable)[0]
+        self.fields = struct.unpack_from(f"<{(vt_len - 4) // 2}H", buf,
+                                         vtable + 4)
+
+    def _field(self, idx):
+        if idx < len(self.fields) and self.fields[idx]:
+            return self.pos + self.fields[idx]
+        return None
+
+    def scalar(self, idx, fmt, default=0):
+        pos = self._field(idx)
+        return default if pos is None else struct.unpack_from(fmt, self.buf,
+                                                              pos)[0]
+
+    def _vector(self, idx):
+        pos = self._field(idx)
+        if pos is None:
+            return None, 0
+        pos += struct.unpack_from("<I", self.buf, pos)[0]
+        return pos + 4, struct.unpack_from("<I", self.buf, pos)[0]
+
+    def vector(self, idx, fmt):
+        pos, length = self._vector(idx)
+        if pos is None:
+            return []
+        return list(struct.unpack_from(f"<{length}{fmt}", self.buf, pos))
+
+    def tables(self, idx):
+        pos, length = self._vector(idx)
+        if pos is None:
+            return []
+        return [Table(self.buf, p + struct.unpack_from("<I", self.buf, p)[0])
+                for p in range(pos, pos + 4 * length, 4)]
+
+
+def align(size, alignment):
+    return (size + alignment - 1) // alignment * alignment
+
+
+def tensor_bytes(tensor):
+    # Tensor: shape (0), type (1)
+    shape = tensor.vector(0, "i")
+    size = TYPE_SIZE.get(tensor.scalar(1, "<b"), 4)
+    for dim in shape:
+        size *= max(dim, 1)
+    return size
+
+
+def plan(buffers):
+    """Greedy planning of (size, first_used, last_used), returns arena size"""
+    placed = []
+    total = 0
+    for size, first, last in sorted(buffers, key=lambda b: -b[0]):
+        overlapping = sorted((off, off + sz) for off, sz, f, l in placed
+                             if f <= last and first <= l)
+        offset = 0
+        for start, end in overlapping:
+            if offset + size <= start:
+                break
+            offset = max(offset, align(end, BUFFER_ALIGNMENT))
+        placed.append((offset, size, first, last))
+        total = max(total, offset + size)
+    return total
+
+
+def estimate(model):
+    """Returns (non-persistent, persistent) bytes needed by the model"""
+    # Model: operator_codes (1), subgraphs (2), buffers (4)
+    opcodes = []
+    for code in model.tables(1):
+        # OperatorCode: deprecated_builtin_code (0), builtin_code (3)
+        opcodes.append(max(code.scalar(0, "<b"), code.scalar(3, "<i")))
+    buffers = model.tables(4)
+    subgraph = model.tables(2)[0]
+
+    # SubGraph: tensors (0), inputs (1), outputs (2), operators (3)
+    tensors = subgraph.tables(0)
+    inputs = subgraph.vector(1, "i")
+    outputs = subgraph.vector(2, "i")
+    operators = subgraph.tables(3)
+    last_op = max(len(operators) - 1, 0)
+
+    first_used = {}
+    last_used = {}
+    for idx in inputs:
+        first_used[idx] = 0
+    persistent = FIXED_OVERHEAD
+    for op_idx, op in enumerate(operators):
+        # Operator: opcode_index (0), inputs (1), outputs (2)
+        for idx in op.vector(1, "i"):
+            if idx >= 0:
+                last_used[idx] = op_idx
+        for idx in op.vector(2, "i"):
+            first_used.setdefault(idx, op_idx)
+            last_used.setdefault(idx, op_idx)
+        opcode = opcodes[op.scalar(0, "<I")] if opcodes else -1
+        persistent += align(NODE_SIZE + BUILTIN_DATA_SIZE, 4)
+        if opcode in PER_CHANNEL_OPS:
+            channels = max(tensors[op.vector(2, "i")[0]].vector(0, "i")[-1:]
+                           or [1])
+            persistent += align(2 * 4 * channels, 4)
+    for idx in outputs:
+        last_used[idx] = last_op
+
+    planned = []
+    for idx, tensor in enumerate(tensors):
+        persistent += EVAL_TENSOR_SIZE
+        # Tensor: buffer (2), is_variable (5); Buffer: data (0)
+        buf_idx = tensor.scalar(2, "<I")
+        if buf_idx and buf_idx < len(buffers) and buffers[buf_idx].vector(0, "B"):
+            continue    # constant, stays in the flatbuffer
+        size = align(tensor_bytes(tensor), BUFFER_ALIGNMENT)
+        if tensor.scalar(5, "<b"):
+            persistent += size
+        elif idx in first_used or idx in last_used:
+            planned.append((size, first_used.get(idx, 0),
+                            last_used.get(idx, last_op)))
+    persistent += (len(inputs) + len(outputs)) * TENSOR_SIZE
+    return align(plan(planned), BUFFER_ALIGNMENT), persistent
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("model", type=argparse.FileType("rb"),
+                        help="TensorFlow Lite model (.tflite)")
+    parser.add_argument("-o", "--output", type=argparse.FileType("w"),
+                        default=sys.stdout,
+                        help="header to write, STDOUT if omitted")
+    parser.add_argument("-m", "--margin", type=int, default=10,
+                        help="margin in percent added for scratch buffers "
+                             "(default: %(default)s)")
+    args = parser.parse_args()
+
+    buf = args.model.read()
+    if buf[4:8] != b"TFL3":
+        sys.exit(f"{args.model.name}: not a TensorFlow Lite model")
+    planned, persistent = estimate(Table(buf, struct.unpack_from("<I", buf)[0]))
+    total = align((planned + persistent) * (100 + args.margin) // 100,
+                  BUFFER_ALIGNMENT)
+
+    args.output.write(f"""/* generated by {parser.prog} from {args.model.name} */
+#ifndef TFLITE_ARENA_SIZE_H
+#define TFLITE_ARENA_SIZE_H
+
+/* planned tensors: {planned} bytes, persistent estimate: {persistent} bytes,
+ * margin: {args.margin}% */
+#define TFLITE_ARENA_SIZE_MODEL ({total}U)
+
+#endif /* TFLITE_ARENA_SIZE_H */
+""")
+
+
+if __name__ == "__main__":
+    main()
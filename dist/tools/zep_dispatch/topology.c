@@ -21,8 +21,16 @@
 #define NODE_NAME_MAX_LEN   32
 #define HW_ADDR_MAX_LEN      8
 
+struct link {
+    struct link *next;
+    struct node *dst;
+    float weight;
+};
+
 struct node {
     list_node_t next;
+    struct node *next_by_addr;  /**< next node in the same hash bucket */
+    struct link *links;         /**< outgoing connections */
     char name[NODE_NAME_MAX_LEN];
     uint8_t mac[HW_ADDR_MAX_LEN];
     struct sockaddr_in6 addr;
@@ -55,6 +63,66 @@ static char *_fmt_addr(char *out, size_t out_len, const uint8_t *addr, uint8_t a
     return start;
 }
 
+static size_t _addr_hash(const topology_t *t, const struct sockaddr_in6 *addr)
+{
+    const uint8_t *p = addr->sin6_addr.s6_addr;
+    uint32_t hash = 2166136261u;
+
+    /* FNV-1a */
+    for (unsigned i = 0; i < sizeof(addr->sin6_addr); i++) {
+        hash = (hash ^ p[i]) * 16777619u;
+    }
+    hash = (hash ^ (addr->sin6_port & 0xff)) * 16777619u;
+    hash = (hash ^ (addr->sin6_port >> 8)) * 16777619u;
+
+    return hash & t->by_addr_mask;
+}
+
+static struct node *_find_node_by_addr(const topology_t *t,
+                                       const struct sockaddr_in6 *addr)
+{
+    for (struct node *n = t->by_addr[_addr_hash(t, addr)]; n; n = n->next_by_addr) {
+        if (memcmp(&n->addr, addr, sizeof(*addr)) == 0) {
+            return n;
+        }
+    }
+
+    return NULL;
+}
+
+static void _remove_node_by_addr(topology_t *t, struct node *node)
+{
+    struct node **n = &t->by_addr[_addr_hash(t, &node->addr)];
+
+    for (; *n; n = &(*n)->next_by_addr) {
+        if (*n == node) {
+            *n = node->next_by_addr;
+            return;
+        }
+    }
+}
+
+static void _add_node_by_addr(topology_t *t, struct node *node)
+{
+    struct node **bucket = &t->by_addr[_addr_hash(t, &node->addr)];
+
+    node->next_by_addr = *bucket;
+    *bucket = node;
+}
+
+static void _add_link(struct node *src, struct node *dst, float weight)
+{
+    if (weight <= 0) {
+        return;
+    }
+
+    struct link *l = malloc(sizeof(*l));
+    l->dst = dst;
+    l->weight = weight;
+    l->next = src->links;
+    src->links = l;
+}
+
 static struct node *_find_node_by_name(const list_node_t *nodes, const char *name)
 {
     for (list_node_t *node = nodes->next; node; node = node->next) {
@@ -210,6 +278,24 @@ int topology_parse(const char *file, topology_t *out)
         free(line);
     }
 
+    /* follow only the edges of the sender when dispatching a packet */
+    for (list_node_t *edge = out->edges.next; edge; edge = edge->next) {
+        struct edge *super = container_of(edge, struct edge, next);
+        _add_link(super->a, super->b, super->weight_a_b);
+        _add_link(super->b, super->a, super->weight_b_a);
+    }
+
+    /* at least two buckets per node */
+    size_t numof = 0, buckets = 16;
+    for (list_node_t *node = out->nodes.next; node; node = node->next) {
+        numof++;
+    }
+    while (buckets < 2 * numof) {
+        buckets *= 2;
+    }
+    out->by_addr_mask = buckets - 1;
+    out->by_addr = calloc(buckets, sizeof(*out->by_addr));
+
     return 0;
 }
 
@@ -222,33 +308,24 @@ void topology_send(const topology_t *t, int sock,
                (struct sockaddr *)&t->sniffer_addr, sizeof(t->sniffer_addr));
     }
 
-    for (list_node_t *edge = t->edges.next; edge; edge = edge->next) {
-        struct edge *super = container_of(edge, struct edge, next);
+    struct node *src = _find_node_by_addr(t, src_addr);
+    if (src == NULL) {
+        return;
+    }
 
-        if (!super->a->mac_len || !super->b->mac_len) {
+    for (struct link *l = src->links; l; l = l->next) {
+        if (!l->dst->mac_len) {
             continue;
         }
 
-        if (memcmp(&super->a->addr, src_addr, sizeof(*src_addr)) == 0) {
-            /* packet loss */
-            if (random() > super->weight_a_b * RAND_MAX) {
-                return;
-            }
-            zep_set_lqi(buffer, super->weight_a_b * 0xFF);
-            sendto(sock, buffer, len, 0,
-                   (struct sockaddr *)&super->b->addr,
-                   sizeof(super->b->addr));
-        }
-        else if (memcmp(&super->b->addr, src_addr, sizeof(*src_addr)) == 0) {
-            /* packet loss */
-            if (random() > super->weight_b_a * RAND_MAX) {
-                return;
-            }
-            zep_set_lqi(buffer, super->weight_b_a * 0xFF);
-            sendto(sock, buffer, len, 0,
-                   (struct sockaddr *)&super->a->addr,
-                   sizeof(super->a->addr));
+        /* packet loss */
+        if (random() > l->weight * RAND_MAX) {
+            continue;
         }
+        zep_set_lqi(buffer, l->weight * 0xFF);
+        sendto(sock, buffer, len, 0,
+               (struct sockaddr *)&l->dst->addr,
+               sizeof(l->dst->addr));
     }
 }
 
@@ -263,6 +340,13 @@ bool topology_add(topology_t *t, const uint8_t *mac, uint8_t mac_len,
         return false;
     }
 
+    /* every frame passes here, take the short path for connected nodes */
+    struct node *known = _find_node_by_addr(t, addr);
+    if (known && (known->mac_len == mac_len) &&
+        (memcmp(known->mac, mac, mac_len) == 0)) {
+        return true;
+    }
+
     for (list_node_t *node = t->nodes.next; node; node = node->next) {
         struct node *super = container_of(node, struct node, next);
 
@@ -299,9 +383,13 @@ bool topology_add(topology_t *t, const uint8_t *mac, uint8_t mac_len,
     printf("adding node %s\n", _fmt_addr(addr_str, sizeof(addr_str), mac, mac_len));
 
     /* add new node to empty spot */
+    if (empty->mac_len) {
+        _remove_node_by_addr(t, empty);
+    }
     memcpy(empty->mac, mac, sizeof(empty->mac));
     memcpy(&empty->addr, addr, sizeof(empty->addr));
     empty->mac_len = mac_len;
+    _add_node_by_addr(t, empty);
 
     return true;
 }
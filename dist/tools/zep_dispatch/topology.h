@@ -15,12 +15,16 @@
 extern "C" {
 #endif
 
+struct node;
+
 /**
  * @brief   Struct describing a graph of nodes and their connections
  */
 typedef struct {
     list_node_t nodes;  /**< list of nodes */
     list_node_t edges;  /**< list of connections between nodes. Unused if topology is flat */
+    struct node **by_addr;  /**< connected nodes hashed by their address. Unused if topology is flat */
+    size_t by_addr_mask;    /**< number of buckets in @ref by_addr minus one */
     struct sockaddr_in6 sniffer_addr;   /**< address of sniffer node. Unused if topology is flat */
     bool has_sniffer;   /**< true if a sniffer node is connected. Unused if topology is flat */
     bool flat;          /**< flat topology, all nodes are connected to each other */
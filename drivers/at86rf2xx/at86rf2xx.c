@@ -240,6 +240,8 @@ void at86rf2xx_reset(at86rf2xx_t *dev)
     IS_USED(MODULE_AT86RF2XX_AES_SPI)
     dev->netdev.sec_ctx.dev.cipher_ops = &_at86rf2xx_cipher_ops;
     dev->netdev.sec_ctx.dev.ctx = dev;
+    /* the key must be loaded to the transceiver again */
+    ieee802154_sec_key_invalidate(&dev->netdev.sec_ctx);
 #endif
 
     /* State to return after receiving or transmitting */
@@ -523,6 +523,11 @@ uint8_t at86rf2xx_set_state(at86rf2xx_t *dev, uint8_t state)
                        AT86RF2XX_STATE_FORCE_TRX_OFF);
             /* Discard all IRQ flags, framebuffer is lost anyway */
             at86rf2xx_reg_read(dev, AT86RF2XX_REG__IRQ_STATUS);
+#if IS_USED(MODULE_IEEE802154_SECURITY) && \
+    IS_USED(MODULE_AT86RF2XX_AES_SPI)
+            /* so is the content of the AES engine */
+            ieee802154_sec_key_invalidate(&dev->netdev.sec_ctx);
+#endif
             /* Go to SLEEP mode from TRX_OFF */
 #if defined(MODULE_AT86RFA1) || defined(MODULE_AT86RFR2)
             /* reset interrupts states in device */
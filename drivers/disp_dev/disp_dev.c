@@ -71,6 +71,80 @@ void disp_dev_map(const disp_dev_t *dev,
     dev->driver->map(dev, area, color);
 }
 
+void disp_dev_map_async(const disp_dev_t *dev,
+                        const disp_dev_area_t *area,
+                        const uint16_t *color,
+                        disp_dev_map_cb_t cb, void *arg)
+{
+    assert(dev);
+
+    if (dev->driver->map_async) {
+        dev->driver->map_async(dev, area, color, cb, arg);
+        return;
+    }
+
+    dev->driver->map(dev, area, color);
+    if (cb) {
+        cb(arg);
+    }
+}
+
+static void _bounding_box(disp_dev_area_t *res, const disp_dev_area_t *a,
+                          const disp_dev_area_t *b)
+{
+    res->x1 = (a->x1 < b->x1) ? a->x1 : b->x1;
+    res->x2 = (a->x2 > b->x2) ? a->x2 : b->x2;
+    res->y1 = (a->y1 < b->y1) ? a->y1 : b->y1;
+    res->y2 = (a->y2 > b->y2) ? a->y2 : b->y2;
+}
+
+static void _dirty_remove(disp_dev_dirty_t *dirty, unsigned idx)
+{
+    dirty->areas[idx] = dirty->areas[--dirty->numof];
+}
+
+void disp_dev_dirty_add(disp_dev_dirty_t *dirty, const disp_dev_area_t *area)
+{
+    assert(dirty && area);
+    assert((area->x1 <= area->x2) && (area->y1 <= area->y2));
+
+    disp_dev_area_t add = *area;
+    disp_dev_area_t box;
+
+    while (dirty->numof) {
+        uint32_t add_size = disp_dev_area_size(&add);
+        unsigned best = 0;
+        uint32_t best_growth = UINT32_MAX;
+
+        for (unsigned i = 0; i < dirty->numof; i++) {
+            _bounding_box(&box, &add, &dirty->areas[i]);
+            uint32_t size = disp_dev_area_size(&box);
+            uint32_t separate = add_size + disp_dev_area_size(&dirty->areas[i]);
+            uint32_t growth = (size > separate) ? size - separate : 0;
+
+            if (growth < best_growth) {
+                best_growth = growth;
+                best = i;
+            }
+            if (!growth) {
+                break;
+            }
+        }
+
+        /* keep the area on its own if merging costs pixels and there is
+         * room for it */
+        if (best_growth && (dirty->numof < CONFIG_DISP_DEV_DIRTY_AREAS_NUMOF)) {
+            break;
+        }
+
+        /* merge and try again, the grown area may now cover other areas */
+        _bounding_box(&add, &add, &dirty->areas[best]);
+        _dirty_remove(dirty, best);
+    }
+
+    dirty->areas[dirty->numof++] = add;
+}
+
 uint16_t disp_dev_height(const disp_dev_t *dev)
 {
     assert(dev);
@@ -47,6 +47,9 @@ extern isrpipe_t ethos_stdio_isrpipe;
 
 static void _get_mac_addr(netdev_t *dev, uint8_t* buf);
 static void ethos_isr(void *arg, uint8_t c);
+#if IS_USED(MODULE_PERIPH_UART_RX_DMA)
+static void _rx_block_cb(void *arg, const uint8_t *data, size_t len);
+#endif
 static const netdev_driver_t netdev_driver_ethos;
 
 static const uint8_t _esc_esc[] = {ETHOS_ESC_CHAR, (ETHOS_ESC_CHAR ^ 0x20)};
@@ -67,6 +70,11 @@ void ethos_setup(ethos_t *dev, const ethos_params_t *params, uint8_t idx,
     netdev_eui48_get(&dev->netdev, (eui48_t *)&dev->mac_addr);
 
     uart_init(params->uart, params->baudrate, ethos_isr, (void*)dev);
+#if IS_USED(MODULE_PERIPH_UART_RX_DMA)
+    /* UARTs without a DMA stream keep receiving byte by byte */
+    uart_rx_dma_start(params->uart, dev->rxdma, sizeof(dev->rxdma),
+                      _rx_block_cb, dev);
+#endif
 
     uint8_t frame_delim = ETHOS_FRAME_DELIMITER;
     uart_write(dev->uart, &frame_delim, 1);
@@ -206,6 +214,36 @@ static void ethos_isr(void *arg, uint8_t c)
     }
 }
 
+#if IS_USED(MODULE_PERIPH_UART_RX_DMA)
+static void _rx_block_cb(void *arg, const uint8_t *data, size_t len)
+{
+    ethos_t *dev = arg;
+    const uint8_t *stop = data + len;
+
+    while (data < stop) {
+        if ((dev->state == IN_FRAME) &&
+            (dev->frametype == ETHOS_FRAME_TYPE_DATA)) {
+            /* add data up to the next special byte at once */
+            const uint8_t *next = data;
+
+            while ((next < stop) && (*next != ETHOS_FRAME_DELIMITER) &&
+                   (*next != ETHOS_ESC_CHAR)) {
+                next++;
+            }
+            if ((next > data) &&
+                (tsrb_add(&dev->inbuf, data, next - data) != next - data)) {
+                _fail_frame(dev);
+            }
+            data = next;
+            if (data == stop) {
+                break;
+            }
+        }
+        ethos_isr(dev, *data++);
+    }
+}
+#endif
+
 static void _isr(netdev_t *netdev)
 {
     netdev->event_callback(netdev, NETDEV_EVENT_RX_COMPLETE);
@@ -228,26 +266,40 @@ static size_t iolist_count_total(const iolist_t *iolist)
     return result;
 }
 
-static void _write_escaped(uart_t uart, uint8_t c)
+static void _write_escaped(uart_t uart, const uint8_t *data, size_t len)
 {
-    const uint8_t *out;
-    int n;
+    const uint8_t *stop = data + len;
+    /* memchr() searches a word at a time, keep the next match of both bytes
+     * so every byte is only searched once */
+    const uint8_t *delim = memchr(data, ETHOS_FRAME_DELIMITER, len);
+    const uint8_t *esc = memchr(data, ETHOS_ESC_CHAR, len);
 
-    switch(c) {
-        case ETHOS_FRAME_DELIMITER:
-            out = _esc_delim;
-            n = 2;
-            break;
-        case ETHOS_ESC_CHAR:
-            out = _esc_esc;
-            n = 2;
+    while (data < stop) {
+        const uint8_t *next = stop;
+
+        if (delim && (delim < next)) {
+            next = delim;
+        }
+        if (esc && (esc < next)) {
+            next = esc;
+        }
+        /* write bytes that need no escaping at once */
+        if (next > data) {
+            uart_write(uart, data, next - data);
+        }
+        if (next == stop) {
             break;
-        default:
-            out = &c;
-            n = 1;
+        }
+        if (next == delim) {
+            uart_write(uart, _esc_delim, sizeof(_esc_delim));
+            delim = memchr(next + 1, ETHOS_FRAME_DELIMITER, stop - next - 1);
+        }
+        else {
+            uart_write(uart, _esc_esc, sizeof(_esc_esc));
+            esc = memchr(next + 1, ETHOS_ESC_CHAR, stop - next - 1);
+        }
+        data = next + 1;
     }
-
-    uart_write(uart, out, n);
 }
 
 void ethos_send_frame(ethos_t *dev, const uint8_t *data, size_t len, unsigned frame_type)
@@ -266,9 +318,7 @@ void ethos_send_frame(ethos_t *dev, const uint8_t *data, size_t len, unsigned fr
     }
 
     /* send frame content */
-    while(len--) {
-        _write_escaped(dev->uart, *data++);
-    }
+    _write_escaped(dev->uart, data, len);
 
     /* end of frame */
     uart_write(dev->uart, &frame_delim, 1);
@@ -293,11 +343,7 @@ static int _send(netdev_t *netdev, const iolist_t *iolist)
 
     /* send iolist */
     for (const iolist_t *iol = iolist; iol; iol = iol->iol_next) {
-        size_t n = iol->iol_len;
-        uint8_t *ptr = iol->iol_base;
-        while(n--) {
-            _write_escaped(dev->uart, *ptr++);
-        }
+        _write_escaped(dev->uart, iol->iol_base, iol->iol_len);
     }
 
     uart_write(dev->uart, &frame_delim, 1);
@@ -354,6 +400,65 @@ unsigned ethos_unstuff_readbyte(uint8_t *buf, uint8_t byte, bool *escaped, uint8
     return 0U;
 }
 
+static void _drop(ethos_t *dev, size_t len)
+{
+    tsrb_region_t regions[2];
+    size_t n = 0;
+
+    tsrb_peek_region(&dev->inbuf, regions);
+    for (unsigned i = 0; (i < ARRAY_SIZE(regions)) && (n < len); i++) {
+        size_t chunk = regions[i].len;
+        const uint8_t *end;
+
+        if (chunk > (len - n)) {
+            chunk = len - n;
+        }
+        end = memchr(regions[i].buf, ETHOS_FRAME_DELIMITER, chunk);
+        if (end) {
+            /* end early if end of packet is reached; len might be larger than
+             * the actual packet */
+            n += (end - regions[i].buf) + 1;
+            break;
+        }
+        n += chunk;
+    }
+    tsrb_consume(&dev->inbuf, n);
+}
+
+static int _unstuff(ethos_t *dev, uint8_t *buf, size_t len, uint8_t *frametype)
+{
+    bool escaped = false;
+    size_t res = 0;
+
+    /* decode in place from the ringbuffer instead of locking it per byte */
+    while (1) {
+        tsrb_region_t regions[2];
+        size_t n = 0;
+
+        if (tsrb_peek_region(&dev->inbuf, regions) == 0) {
+            DEBUG("ethos _recv(): inbuf doesn't contain enough bytes.\n");
+            return -EIO;
+        }
+        for (unsigned i = 0; i < ARRAY_SIZE(regions); i++) {
+            for (size_t j = 0; j < regions[i].len; j++) {
+                uint8_t byte = regions[i].buf[j];
+                uint8_t overflow;
+
+                n++;
+                if (byte == ETHOS_FRAME_DELIMITER) {
+                    tsrb_consume(&dev->inbuf, n);
+                    /* the packet was cleared out if it did not fit */
+                    return (res > len) ? -ENOBUFS : (int)res;
+                }
+                res += ethos_unstuff_readbyte((res < len) ? &buf[res]
+                                                          : &overflow,
+                                              byte, &escaped, frametype);
+            }
+        }
+        tsrb_consume(&dev->inbuf, n);
+    }
+}
+
 static int _recv(netdev_t *netdev, void *buf, size_t len, void* info)
 {
     (void) info;
@@ -361,29 +466,11 @@ static int _recv(netdev_t *netdev, void *buf, size_t len, void* info)
     int res = 0;
 
     if (buf) {
-        int byte;
-        bool escaped = false;
-        uint8_t *ptr = buf;
         uint8_t frametype = ETHOS_FRAME_TYPE_DATA;
 
-        do {
-            int tmp;
-
-            if ((byte = tsrb_get_one(&dev->inbuf)) < 0) {
-                DEBUG("ethos _recv(): inbuf doesn't contain enough bytes.\n");
-                return -EIO;
-            }
-            tmp = ethos_unstuff_readbyte(ptr, (uint8_t)byte, &escaped, &frametype);
-            ptr += tmp;
-            res += tmp;
-            if ((unsigned)res > len) {
-                while (byte != (int)ETHOS_FRAME_DELIMITER) {
-                    /* clear out unreceived packet */
-                    byte = tsrb_get_one(&dev->inbuf);
-                }
-                return -ENOBUFS;
-            }
-        } while (byte != ETHOS_FRAME_DELIMITER);
+        if ((res = _unstuff(dev, buf, len, &frametype)) < 0) {
+            return res;
+        }
 
         switch (frametype) {
         case ETHOS_FRAME_TYPE_HELLO:
@@ -401,14 +488,7 @@ static int _recv(netdev_t *netdev, void *buf, size_t len, void* info)
     else {
         if (len) {
             /* remove data */
-            for (; len > 0; len--) {
-                int byte = tsrb_get_one(&dev->inbuf);
-                if ((byte == (int)ETHOS_FRAME_DELIMITER) || (byte < 0)) {
-                    /* end early if end of packet or ringbuffer is reached;
-                     * len might be larger than the actual packet */
-                    break;
-                }
-            }
+            _drop(dev, len);
         }
         else {
             /* set to 2048 in sys/net/gnrc/netif/init_devs/auto_init_ethos.c so safe to cast
@@ -0,0 +1,59 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     drivers_gpio_par_bus
+ * @{
+ *
+ * @file
+ * @brief       Parallel GPIO bus implementation
+ *
+ * @}
+ */
+
+#include <errno.h>
+
+#include "gpio_par_bus.h"
+
+int gpio_par_bus_init(gpio_par_bus_t *bus, const gpio_t *pins, uint8_t width)
+{
+    const gpio_conf_t conf = {
+        .state = GPIO_OUTPUT_PUSH_PULL,
+        .slew_rate = GPIO_SLEW_FASTEST,
+        .initial_value = false,
+    };
+
+    if (!width || (width > GPIO_PAR_BUS_WIDTH_MAX)) {
+        return -EINVAL;
+    }
+
+    bus->port = gpio_get_port(pins[0]);
+    bus->mask = 0;
+    bus->width = width;
+    bus->shift = gpio_get_pin_num(pins[0]);
+
+    for (unsigned i = 0; i < width; i++) {
+        uint8_t pin = gpio_get_pin_num(pins[i]);
+
+        if (gpio_get_port(pins[i]) != bus->port) {
+            return -EINVAL;
+        }
+        if (pin != bus->shift + i) {
+            bus->shift = GPIO_PAR_BUS_SCATTERED;
+        }
+        bus->pins[i] = pin;
+        bus->mask |= (uword_t)1 << pin;
+
+        int res = gpio_ll_init(bus->port, pin, &conf);
+        if (res) {
+            return res;
+        }
+    }
+
+    return 0;
+}
@@ -22,6 +22,7 @@
 
 #include <string.h>
 
+#include "kernel_defines.h"
 #include "log.h"
 #ifdef MODULE_PCF857X
 #include "pcf857x.h"
@@ -38,6 +39,13 @@
 static pcf857x_t _pcf857x_dev;
 #endif
 
+/* the pins of a port expander cannot be written with gpio_ll */
+#if IS_USED(MODULE_GPIO_PAR_BUS) && !IS_USED(MODULE_PCF857X)
+#define HD44780_USE_PAR_BUS     1
+#else
+#define HD44780_USE_PAR_BUS     0
+#endif
+
 static inline void _command(const hd44780_t *dev, uint8_t value);
 static void _pulse(const hd44780_t *dev);
 static void _send(const hd44780_t *dev, uint8_t value, hd44780_state_t state);
@@ -46,6 +54,7 @@ static void _write_bits(const hd44780_t *dev, uint8_t bits, uint8_t value);
 static inline void _gpio_set(gpio_t pin);
 static inline void _gpio_clear(gpio_t pin);
 static inline int _gpio_init(gpio_t pin, gpio_mode_t mode);
+static void _init_data_pins(hd44780_t *dev);
 
 /**
  * @brief   Send a command to the display
@@ -99,6 +108,14 @@ static void _send(const hd44780_t *dev, uint8_t value, hd44780_state_t state)
 
 static void _write_bits(const hd44780_t *dev, uint8_t bits, uint8_t value)
 {
+#if HD44780_USE_PAR_BUS
+    if (dev->bus.width) {
+        /* width equals bits, the bus is set up for the mode in use */
+        gpio_par_bus_write(&dev->bus, value & ((1U << bits) - 1));
+        _pulse(dev);
+        return;
+    }
+#endif
     for (unsigned i = 0; i < bits; ++i) {
         if ((value >> i) & 0x01) {
             _gpio_set(dev->p.data[i]);
@@ -119,6 +136,23 @@ static inline int _gpio_init(gpio_t pin, gpio_mode_t mode)
 #endif
 }
 
+static void _init_data_pins(hd44780_t *dev)
+{
+    unsigned width = (dev->flag & HD44780_8BITMODE) ? 8 : 4;
+
+#if HD44780_USE_PAR_BUS
+    /* write all data pins at once if they are on the same port, otherwise
+     * fall back to writing them one by one */
+    if (gpio_par_bus_init(&dev->bus, dev->p.data, width) == 0) {
+        return;
+    }
+    dev->bus.width = 0;
+#endif
+    for (unsigned i = 0; i < width; ++i) {
+        _gpio_init(dev->p.data[i], GPIO_OUT);
+    }
+}
+
 static inline void _gpio_set(gpio_t pin)
 {
 #ifdef MODULE_PCF857X
@@ -185,9 +219,7 @@ int hd44780_init(hd44780_t *dev, const hd44780_params_t *params)
     }
     _gpio_init(dev->p.enable, GPIO_OUT);
     /* configure all data pins as output */
-    for (int i = 0; i < ((dev->flag & HD44780_8BITMODE) ? 8 : 4); ++i) {
-        _gpio_init(dev->p.data[i], GPIO_OUT);
-    }
+    _init_data_pins(dev);
     /* see hitachi HD44780 datasheet pages 45/46 for init specs */
     xtimer_usleep(HD44780_INIT_WAIT_XXL);
     _gpio_clear(dev->p.rs);
@@ -12,6 +12,16 @@
  * @brief       Define the generic API of a display device
  * @experimental This API is experimental and in an early state - expect
  *               changes!
+ *
+ * Drivers that can send pixels in the background (e.g. using DMA) implement
+ * @ref disp_dev_driver_t::map_async. @ref disp_dev_map_async() returns right
+ * away on these and calls a callback once the area is on the display, so the
+ * next area can be rendered in the meantime. It is used when the
+ * `disp_dev_async` module is selected.
+ *
+ * To send fewer pixels per frame, the areas changed since the last frame can
+ * be collected in a @ref disp_dev_dirty_t. Overlapping and adjacent areas are
+ * merged as long as this does not increase the number of pixels to send.
  * @{
  *
  * @author      Alexandre Abadie <alexandre.abadie@inria.fr>
@@ -29,6 +39,22 @@ extern "C" {
 
 #include "board.h"
 
+/**
+ * @defgroup drivers_disp_dev_conf Display device generic API compile configurations
+ * @ingroup  config
+ * @{
+ */
+/**
+ * @brief   Maximum number of areas in a @ref disp_dev_dirty_t
+ *
+ * When more areas are added, the added area is merged with the area that
+ * grows the least by it.
+ */
+#ifndef CONFIG_DISP_DEV_DIRTY_AREAS_NUMOF
+#define CONFIG_DISP_DEV_DIRTY_AREAS_NUMOF   (4U)
+#endif
+/** @} */
+
 #ifndef BACKLIGHT_ON
 #define BACKLIGHT_ON
 #endif
@@ -52,6 +78,21 @@ typedef struct {
     uint16_t y2;                    /**< Vertical end position (included) */
 } disp_dev_area_t;
 
+/**
+ * @brief   Callback for a completed asynchronous map
+ *
+ * @param[in] arg   Argument given to @ref disp_dev_map_async()
+ */
+typedef void (*disp_dev_map_cb_t)(void *arg);
+
+/**
+ * @brief   Set of areas to update on the display
+ */
+typedef struct {
+    disp_dev_area_t areas[CONFIG_DISP_DEV_DIRTY_AREAS_NUMOF];  /**< areas */
+    uint8_t numof;                                  /**< number of areas */
+} disp_dev_dirty_t;
+
 /**
  * @brief   Generic type for a display driver
  */
@@ -99,6 +140,23 @@ typedef struct {
      * @param[in] invert    Invert mode (true if invert, false otherwise)
      */
     void (*set_invert)(const disp_dev_t *dev, bool invert);
+
+    /**
+     * @brief   Map an area to display on the device in the background
+     *
+     * Optional, may be NULL. @p cb may be called from interrupt context.
+     *
+     * @param[in] dev   Pointer to the display device
+     * @param[in] area  Coordinates of display area
+     * @param[in] color Array of color to map to the display, must stay valid
+     *                  until @p cb was called
+     * @param[in] cb    Called when the area is on the display
+     * @param[in] arg   Argument passed to @p cb
+     */
+    void (*map_async)(const disp_dev_t *dev,
+                      const disp_dev_area_t *area,
+                      const uint16_t *color,
+                      disp_dev_map_cb_t cb, void *arg);
 } disp_dev_driver_t;
 
 /**
@@ -153,6 +211,59 @@ void disp_dev_map(const disp_dev_t *dev,
                   const disp_dev_area_t *area,
                   const uint16_t *color);
 
+/**
+ * @brief   Map an area to display on the device in the background
+ *
+ * If the driver has no asynchronous map, the area is mapped right away and
+ * @p cb is called before this function returns. Otherwise @p cb may be
+ * called from interrupt context.
+ *
+ * @param[in] dev   Pointer to the display device
+ * @param[in] area  Coordinates of display area
+ * @param[in] color Array of color to map to the display, must stay valid
+ *                  until @p cb was called
+ * @param[in] cb    Called when the area is on the display
+ * @param[in] arg   Argument passed to @p cb
+ */
+void disp_dev_map_async(const disp_dev_t *dev,
+                        const disp_dev_area_t *area,
+                        const uint16_t *color,
+                        disp_dev_map_cb_t cb, void *arg);
+
+/**
+ * @brief   Get the number of pixels of an area
+ *
+ * @param[in] area  Coordinates of the area
+ *
+ * @return          Number of pixels
+ */
+static inline uint32_t disp_dev_area_size(const disp_dev_area_t *area)
+{
+    return (uint32_t)(area->x2 - area->x1 + 1) * (area->y2 - area->y1 + 1);
+}
+
+/**
+ * @brief   Remove all areas from a set of areas to update
+ *
+ * @param[out] dirty    Set of areas
+ */
+static inline void disp_dev_dirty_clear(disp_dev_dirty_t *dirty)
+{
+    dirty->numof = 0;
+}
+
+/**
+ * @brief   Add an area to a set of areas to update
+ *
+ * The area is merged with the areas in @p dirty as long as their bounding box
+ * has no more pixels than the areas on their own. If @p dirty is full, it is
+ * merged with the area that grows the least.
+ *
+ * @param[in,out] dirty Set of areas
+ * @param[in] area      Area to add
+ */
+void disp_dev_dirty_add(disp_dev_dirty_t *dirty, const disp_dev_area_t *area);
+
 /**
  * @brief   Get the height of the display device
  *
@@ -68,6 +68,17 @@ extern "C" {
 #endif
 #endif
 
+/**
+ * @brief   Size of the circular DMA buffer used with `periph_uart_rx_dma`
+ *
+ * Received data is handed on whenever the line goes idle or half of this
+ * buffer is filled, so it needs to hold what arrives while the receive
+ * interrupt is blocked.
+ */
+#ifndef CONFIG_ETHOS_RX_DMA_BUFSIZE
+#define CONFIG_ETHOS_RX_DMA_BUFSIZE     (64U)
+#endif
+
 /**
  * @name    Escape char definitions
  * @{
@@ -102,6 +113,12 @@ typedef struct {
     line_state_t state;     /**< Line status variable */
     unsigned frametype;     /**< type of currently incoming frame */
     mutex_t out_mutex;      /**< mutex used for locking concurrent sends */
+#if IS_USED(MODULE_PERIPH_UART_RX_DMA) || defined(DOXYGEN)
+    /**
+     * @brief   DMA receive buffer, used if the UART has a DMA stream
+     */
+    uint8_t rxdma[CONFIG_ETHOS_RX_DMA_BUFSIZE];
+#endif
 } ethos_t;
 
 /**
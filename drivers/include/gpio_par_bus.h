@@ -0,0 +1,145 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    drivers_gpio_par_bus Parallel GPIO bus
+ * @ingroup     drivers_soft_periph
+ * @brief       Write a parallel bus of GPIO pins with a single port store
+ *
+ * Drivers for parallel buses (e.g. character displays) often write every data
+ * line with its own call to @ref gpio_set or @ref gpio_clear. This module
+ * uses @ref drivers_periph_gpio_ll instead: all data lines of the bus must be
+ * on the same GPIO port, and a value is written to all of them with one
+ * @ref gpio_ll_write. So the lines also change at the same time.
+ *
+ * If the data lines are consecutive pins of the port in the order of the data
+ * bits, a value is only shifted into place. Otherwise the bits are moved to
+ * their pins one by one, which still needs only one store to the port.
+ *
+ * @warning Writing the bus reads the output register of the port and writes
+ *          it back. Other pins of the same port must not be changed
+ *          concurrently, e.g. from interrupt context.
+ *
+ * ## Usage
+ *
+ * ```
+ * USEMODULE += gpio_par_bus
+ * ```
+ *
+ * ```
+ * static const gpio_t pins[] = { GPIO_PIN(1, 0), GPIO_PIN(1, 1), ... };
+ * gpio_par_bus_t bus;
+ *
+ * gpio_par_bus_init(&bus, pins, ARRAY_SIZE(pins));
+ * gpio_par_bus_write(&bus, 0xa5);
+ * ```
+ *
+ * @{
+ *
+ * @file
+ * @brief       Parallel GPIO bus interface definitions
+ */
+
+#ifndef GPIO_PAR_BUS_H
+#define GPIO_PAR_BUS_H
+
+#include <stdint.h>
+
+#include "periph/gpio.h"
+#include "periph/gpio_ll.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Maximum number of data lines of a bus
+ */
+#define GPIO_PAR_BUS_WIDTH_MAX      (16U)
+
+/**
+ * @brief   Value of @ref gpio_par_bus_t::shift if the data lines are not
+ *          consecutive pins
+ */
+#define GPIO_PAR_BUS_SCATTERED      (UINT8_MAX)
+
+/**
+ * @brief   Parallel GPIO bus
+ */
+typedef struct {
+    gpio_port_t port;                       /**< port of all data lines */
+    uword_t mask;                           /**< mask of the data lines */
+    uint8_t pins[GPIO_PAR_BUS_WIDTH_MAX];   /**< pin number of every data
+                                             *   bit */
+    uint8_t width;                          /**< number of data lines */
+    uint8_t shift;                          /**< pin of data bit 0 if the
+                                             *   lines are consecutive, or
+                                             *   @ref GPIO_PAR_BUS_SCATTERED */
+} gpio_par_bus_t;
+
+/**
+ * @brief   Initializes a bus and configures its data lines as outputs
+ *
+ * All data lines are driven low.
+ *
+ * @param[out] bus      Bus to initialize.
+ * @param[in] pins      Data lines, starting with data bit 0.
+ * @param[in] width     Number of data lines.
+ *
+ * @return  0 on success
+ * @return  -EINVAL, if there are too many data lines or they are not on the
+ *          same port
+ * @return  <0 if a data line could not be configured
+ */
+int gpio_par_bus_init(gpio_par_bus_t *bus, const gpio_t *pins, uint8_t width);
+
+/**
+ * @brief   Maps a value to the pins of the port
+ *
+ * @param[in] bus       Bus to write.
+ * @param[in] value     Value of the data lines.
+ *
+ * @return  Bits of the port to set
+ */
+static inline uword_t gpio_par_bus_map(const gpio_par_bus_t *bus,
+                                       unsigned value)
+{
+    if (bus->shift != GPIO_PAR_BUS_SCATTERED) {
+        return ((uword_t)value << bus->shift) & bus->mask;
+    }
+
+    uword_t state = 0;
+    for (unsigned i = 0; i < bus->width; i++) {
+        if (value & (1U << i)) {
+            state |= (uword_t)1 << bus->pins[i];
+        }
+    }
+    return state;
+}
+
+/**
+ * @brief   Writes a value to all data lines of a bus at once
+ *
+ * @param[in] bus       Bus to write.
+ * @param[in] value     Value of the data lines, data bit 0 is the first pin
+ *                      given to @ref gpio_par_bus_init.
+ */
+static inline void gpio_par_bus_write(const gpio_par_bus_t *bus,
+                                      unsigned value)
+{
+    gpio_ll_write(bus->port,
+                  gpio_ll_prepare_write(bus->port, bus->mask,
+                                        gpio_par_bus_map(bus, value)));
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* GPIO_PAR_BUS_H */
+/** @} */
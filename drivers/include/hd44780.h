@@ -26,6 +26,9 @@
 #include <stdint.h>
 
 #include "periph/gpio.h"
+#ifdef MODULE_GPIO_PAR_BUS
+#include "gpio_par_bus.h"
+#endif
 
 #ifdef __cplusplus
 extern "C" {
@@ -75,6 +78,10 @@ typedef struct {
     uint8_t ctrl;                   /**< LCD control flags */
     uint8_t mode;                   /**< LCD mode flags */
     uint8_t roff[HD44780_MAX_ROWS]; /**< offsets for LCD rows */
+#if defined(MODULE_GPIO_PAR_BUS) || defined(DOXYGEN)
+    gpio_par_bus_t bus;             /**< data pins, unused if
+                                     *   gpio_par_bus_t::width is 0 */
+#endif
 } hd44780_t;
 
 /**
@@ -56,6 +56,16 @@ extern "C" {
 #define CONFIG_LCD_LE_MODE
 #endif
 
+/**
+ * @brief   Maximum number of bytes sent by one asynchronous SPI transfer
+ *
+ * Larger pixmaps are sent in chunks, as DMA controllers limit the length of
+ * a transfer (e.g. to 65535 on stm32).
+ */
+#ifndef LCD_ASYNC_CHUNK_SIZE
+#define LCD_ASYNC_CHUNK_SIZE    (32768U)
+#endif
+
 /**
  * @name Memory access control bits
  * @{
@@ -104,6 +114,13 @@ typedef struct {
 #endif
     const lcd_driver_t *driver;     /**< LCD driver */
     const lcd_params_t *params;     /**< Device initialization parameters */
+#if defined(MODULE_PERIPH_SPI_ASYNC) || DOXYGEN
+    spi_async_xfer_t xfer;          /**< transfer of @ref lcd_pixmap_async */
+    const uint8_t *pending;         /**< pixel data not yet queued */
+    size_t pending_len;             /**< length of @ref pending in bytes */
+    spi_async_cb_t cb;              /**< callback of @ref lcd_pixmap_async */
+    void *arg;                      /**< argument of @ref cb */
+#endif
 } lcd_t;
 
 /**
@@ -181,6 +198,31 @@ void lcd_fill(const lcd_t *dev, uint16_t x1, uint16_t x2,
 void lcd_pixmap(const lcd_t *dev, uint16_t x1, uint16_t x2, uint16_t y1,
                 uint16_t y2, const uint16_t *color);
 
+#if defined(MODULE_PERIPH_SPI_ASYNC) || DOXYGEN
+/**
+ * @brief   Fill a rectangular area with an array of pixels in the background
+ *
+ * Same as @ref lcd_pixmap, but the pixels are sent with asynchronous SPI
+ * transfers. The bus stays acquired until @p cb is called, so other
+ * functions of the driver block until then. With @ref CONFIG_LCD_LE_MODE
+ * the pixels are sent right away, as they have to be converted.
+ *
+ * @param[in]   dev     device descriptor
+ * @param[in]   x1      x coordinate of the first corner
+ * @param[in]   x2      x coordinate of the opposite corner
+ * @param[in]   y1      y coordinate of the first corner
+ * @param[in]   y2      y coordinate of the opposite corner
+ * @param[in]   color   array of colors to fill the area with, must stay valid
+ *                      until @p cb was called
+ * @param[in]   cb      called when the pixels are sent, may be called from
+ *                      interrupt context
+ * @param[in]   arg     argument passed to @p cb
+ */
+void lcd_pixmap_async(lcd_t *dev, uint16_t x1, uint16_t x2, uint16_t y1,
+                      uint16_t y2, const uint16_t *color,
+                      spi_async_cb_t cb, void *arg);
+#endif
+
 /**
  * @brief   Raw write command
  *
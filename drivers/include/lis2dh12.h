@@ -16,8 +16,10 @@
  * now, it only provides very basic access to the device. The driver configures
  * the device to continuously read the acceleration data with statically
  * defined scale and rate, and with a fixed 10-bit resolution. The LIS2DH12's
- * FIFO is bypassed, so the driver might not be sufficient for use cases where
- * the complete history of readings is of interest.
+ * FIFO is bypassed by default. If the complete history of readings is of
+ * interest, enable it with @ref lis2dh12_set_fifo and read it with
+ * @ref lis2dh12_read_fifo_data or @ref saul_reg_read_batch, optionally woken
+ * up by @ref lis2dh12_cfg_fifo_watermark_event.
  *
  * Also, the current version of the driver supports only interfacing the sensor
  * via SPI. The driver is however written in a way, that adding I2C interface
@@ -299,6 +301,18 @@ void lis2dh12_cfg_click_event(const lis2dh12_t *dev, uint32_t mg,
  */
 void lis2dh12_cfg_disable_event(const lis2dh12_t *dev, uint8_t event, uint8_t pin);
 
+/**
+ * @brief   Configure the FIFO watermark event
+ *          An interrupt is generated on INT1 while the FIFO holds at least the
+ *          number of samples set as watermark with @ref lis2dh12_set_fifo.
+ *          The FIFO_SRC_REG value can be extracted from the result of
+ *          @ref lis2dh12_wait_event with LIS2DH12_INT_SRC_FIFO().
+ *
+ * @param[in] dev       device descriptor
+ * @param[in] enable    enable or disable the event
+ */
+void lis2dh12_cfg_fifo_watermark_event(const lis2dh12_t *dev, bool enable);
+
 /**
  * @brief   Wait for an interrupt event
  *          This function will block until an interrupt is received
@@ -175,6 +175,49 @@ int lsm6dsl_read_gyro(const lsm6dsl_t *dev, lsm6dsl_3d_data_t *data);
  */
 int lsm6dsl_read_temp(const lsm6dsl_t *dev, int16_t *data);
 
+/**
+ * @brief   Read accelerometer samples from the FIFO
+ *
+ * The FIFO is filled continuously if LSM6DSL_PARAM_ACC_DECIMATION is not
+ * LSM6DSL_DECIMATION_NOT_IN_FIFO. If the gyroscope is stored in the FIFO as
+ * well, it must use the same data rate and decimation, its samples are
+ * dropped.
+ *
+ * @param[in] dev    device to read
+ * @param[out] data  accelerometer values, in mg, oldest first
+ * @param[in] num    number of entries in @p data
+ *
+ * @return number of samples read on success
+ * @return -LSM6DSL_ERROR_CNF if the FIFO configuration is not supported
+ * @return < 0 on other errors
+ */
+int lsm6dsl_read_acc_fifo(const lsm6dsl_t *dev, lsm6dsl_3d_data_t *data,
+                          size_t num);
+
+/**
+ * @brief   Get the time between two accelerometer samples in the FIFO
+ *
+ * @param[in] dev    device to read
+ *
+ * @return sample period in µs, 0 if the accelerometer is not in the FIFO
+ */
+uint32_t lsm6dsl_acc_fifo_period(const lsm6dsl_t *dev);
+
+/**
+ * @brief   Set the FIFO threshold and route it to INT1
+ *
+ * INT1 is active while the FIFO holds at least @p words 16 bit words, a
+ * sample of one sensor takes three words.
+ *
+ * @param[in] dev    device to configure
+ * @param[in] words  FIFO threshold in 16 bit words, 0 to disable the
+ *                   interrupt
+ *
+ * @return LSM6DSL_OK on success
+ * @return < 0 on error
+ */
+int lsm6dsl_set_fifo_threshold(const lsm6dsl_t *dev, uint16_t words);
+
 /**
  * @brief   Power down accelerometer
  *
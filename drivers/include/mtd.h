@@ -73,8 +73,13 @@
 #ifndef MTD_H
 #define MTD_H
 
+#include <stdbool.h>
 #include <stdint.h>
 
+#if defined(MODULE_MTD_ASYNC) || DOXYGEN
+#include "event.h"
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -278,6 +283,18 @@ struct mtd_desc {
      */
     int (*power)(mtd_dev_t *dev, enum mtd_power_state power);
 
+    /**
+     * @brief   Write data buffered by the driver to the device
+     *
+     * Optional, drivers that don't buffer writes leave it NULL.
+     *
+     * @param[in] dev       Pointer to the selected driver
+     *
+     * @return 0 on success
+     * @return < 0 value on error
+     */
+    int (*flush)(mtd_dev_t *dev);
+
     /**
      * @brief   Properties of the MTD driver
      */
@@ -462,6 +479,177 @@ int mtd_erase_sector(mtd_dev_t *mtd, uint32_t sector, uint32_t num);
  */
 int mtd_power(mtd_dev_t *mtd, enum mtd_power_state power);
 
+/**
+ * @brief   Write data buffered by the driver of a MTD device to the device
+ *
+ * File systems call this when they sync, so data reaches the storage even if
+ * the driver (e.g. @ref drivers_mtd_cache) holds back writes.
+ *
+ * @param      mtd   the device to access
+ *
+ * @return 0 if all data was written (or the driver doesn't buffer writes)
+ * @return < 0 if an error occurred
+ * @return -ENODEV if @p mtd is not a valid device
+ * @return -EIO if I/O error occurred
+ */
+int mtd_flush(mtd_dev_t *mtd);
+
+#if defined(MODULE_MTD_ASYNC) || DOXYGEN
+/**
+ * @name    Asynchronous MTD operations
+ *
+ * Requests are run one after the other in the thread handling the event
+ * queue given to @ref mtd_async_init(), so the thread submitting them can
+ * continue while e.g. a sector is erased. The callback of a request is called
+ * in that thread as well once the request completed. Requests sharing a queue
+ * complete in the order they were submitted.
+ *
+ * The buffer of a read or write request must stay valid until its callback
+ * was called.
+ *
+ * @note    Requires module `mtd_async`
+ * @{
+ */
+/**
+ * @brief   An asynchronous MTD request
+ */
+typedef struct mtd_async_req mtd_async_req_t;
+
+/**
+ * @brief   Completion callback of an asynchronous MTD request
+ *
+ * @param[in] req   The completed request. It can be resubmitted from the
+ *                  callback.
+ * @param[in] res   Result of the operation, as returned by the synchronous
+ *                  function.
+ */
+typedef void (*mtd_async_cb_t)(mtd_async_req_t *req, int res);
+
+/**
+ * @brief   An asynchronous MTD request
+ *
+ * @note    All members are private, use @ref mtd_async_init() to initialize
+ *          the request.
+ */
+struct mtd_async_req {
+    event_t super;              /**< event running the request */
+    event_queue_t *queue;       /**< queue the request is run in */
+    mtd_async_cb_t cb;          /**< completion callback */
+    void *arg;                  /**< callback argument */
+    mtd_dev_t *mtd;             /**< device, NULL if not pending */
+    void *buf;                  /**< data buffer */
+    uint32_t page;              /**< first page or sector */
+    uint32_t offset;            /**< byte offset in the page */
+    uint32_t count;             /**< number of bytes or sectors */
+    uint8_t op;                 /**< operation */
+};
+
+/**
+ * @brief   Initialize an asynchronous MTD request
+ *
+ * The request can be reused for any number of operations, as long as it
+ * isn't pending.
+ *
+ * @param[out] req      The request to initialize
+ * @param[in] queue     Event queue to run the request in
+ * @param[in] cb        Completion callback
+ * @param[in] arg       Argument for @p cb, see @ref mtd_async_arg()
+ */
+void mtd_async_init(mtd_async_req_t *req, event_queue_t *queue,
+                    mtd_async_cb_t cb, void *arg);
+
+/**
+ * @brief   Get the callback argument of an asynchronous MTD request
+ *
+ * @param[in] req   The request
+ *
+ * @return  The argument given to @ref mtd_async_init()
+ */
+static inline void *mtd_async_arg(const mtd_async_req_t *req)
+{
+    return req->arg;
+}
+
+/**
+ * @brief   Check if an asynchronous MTD request did not complete yet
+ *
+ * @param[in] req   The request
+ *
+ * @return  true, if the request was submitted and its callback wasn't called
+ *          yet
+ */
+static inline bool mtd_async_pending(const mtd_async_req_t *req)
+{
+    return req->mtd != NULL;
+}
+
+/**
+ * @brief   Read data from a MTD device with pagewise addressing, without
+ *          blocking
+ *
+ * See @ref mtd_read_page() for the parameters and results of the operation.
+ *
+ * @param[in,out] req   Request to submit
+ *
+ * @return 0 if the request was submitted
+ * @return -ENODEV if @p mtd is not a valid device
+ * @return -EBUSY if @p req is still pending
+ */
+int mtd_read_page_async(mtd_async_req_t *req, mtd_dev_t *mtd, void *dest,
+                        uint32_t page, uint32_t offset, uint32_t size);
+
+/**
+ * @brief   Write data to a MTD device with pagewise addressing, without
+ *          blocking
+ *
+ * See @ref mtd_write_page_raw() for the parameters and results of the
+ * operation.
+ *
+ * @param[in,out] req   Request to submit
+ *
+ * @return 0 if the request was submitted
+ * @return -ENODEV if @p mtd is not a valid device
+ * @return -EBUSY if @p req is still pending
+ */
+int mtd_write_page_raw_async(mtd_async_req_t *req, mtd_dev_t *mtd,
+                             const void *src, uint32_t page, uint32_t offset,
+                             uint32_t size);
+
+#if defined(MODULE_MTD_WRITE_PAGE) || DOXYGEN
+/**
+ * @brief   Write data to a MTD device with pagewise addressing, erasing
+ *          sectors as needed, without blocking
+ *
+ * See @ref mtd_write_page() for the parameters and results of the operation.
+ *
+ * @param[in,out] req   Request to submit
+ *
+ * @return 0 if the request was submitted
+ * @return -ENODEV if @p mtd is not a valid device
+ * @return -EBUSY if @p req is still pending
+ */
+int mtd_write_page_async(mtd_async_req_t *req, mtd_dev_t *mtd,
+                         const void *src, uint32_t page, uint32_t offset,
+                         uint32_t size);
+#endif
+
+/**
+ * @brief   Erase sectors of a MTD device, without blocking
+ *
+ * See @ref mtd_erase_sector() for the parameters and results of the
+ * operation.
+ *
+ * @param[in,out] req   Request to submit
+ *
+ * @return 0 if the request was submitted
+ * @return -ENODEV if @p mtd is not a valid device
+ * @return -EBUSY if @p req is still pending
+ */
+int mtd_erase_sector_async(mtd_async_req_t *req, mtd_dev_t *mtd,
+                           uint32_t sector, uint32_t num);
+/** @} */
+#endif /* MODULE_MTD_ASYNC */
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,139 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    drivers_mtd_cache  MTD page cache
+ * @ingroup     drivers_storage
+ * @brief       Write-back page cache on top of another MTD device
+ *
+ * This MTD module keeps recently used pages of a backing MTD device in RAM,
+ * so file systems re-reading the same pages (e.g. the FAT of a FAT file
+ * system) don't hit the device every time. The least recently used page is
+ * evicted when a new page is needed.
+ *
+ * Writes are kept in the cache until the page is evicted, the sector it is in
+ * is erased, the device is powered down or @ref mtd_flush() is called. The
+ * file system packages call @ref mtd_flush() when a file is synced, e.g. by
+ * @ref vfs_fsync(). Data written but not flushed is lost on a reset.
+ *
+ * The cache only writes the bytes that were written to a page, so the
+ * restrictions of the backing device on rewriting its memory still apply.
+ *
+ * When pages are read in order, the following pages are read ahead, see
+ * @ref CONFIG_MTD_CACHE_READ_AHEAD.
+ *
+ * ## Usage
+ *
+ * ```
+ * USEMODULE += mtd_cache
+ * ```
+ *
+ * ```
+ * static mtd_cache_t cache = MTD_CACHE_INIT(MTD_0);
+ *
+ * mtd_dev_t *dev = &cache.mtd;
+ * ```
+ *
+ * @{
+ *
+ * @file
+ * @brief       Interface definitions for the MTD page cache
+ */
+
+#ifndef MTD_CACHE_H
+#define MTD_CACHE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "mtd.h"
+#include "mutex.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup drivers_mtd_cache_conf MTD page cache compile configurations
+ * @ingroup  config
+ * @{
+ */
+/**
+ * @brief   Number of pages in each cache
+ */
+#ifndef CONFIG_MTD_CACHE_PAGES
+#define CONFIG_MTD_CACHE_PAGES      (4U)
+#endif
+
+/**
+ * @brief   Maximum page size of backing devices
+ */
+#ifndef CONFIG_MTD_CACHE_PAGE_SIZE
+#define CONFIG_MTD_CACHE_PAGE_SIZE  (512U)
+#endif
+
+/**
+ * @brief   Number of pages to read ahead when pages are read in order
+ *
+ * Set to 0 to disable read-ahead. At most @ref CONFIG_MTD_CACHE_PAGES - 1
+ * pages are read ahead.
+ */
+#ifndef CONFIG_MTD_CACHE_READ_AHEAD
+#define CONFIG_MTD_CACHE_READ_AHEAD (1U)
+#endif
+/** @} */
+
+/**
+ * @brief   Initializer for a @ref mtd_cache_t
+ *
+ * @param[in] _parent   Backing MTD device
+ */
+#define MTD_CACHE_INIT(_parent) \
+{ \
+    .mtd = { .driver = &mtd_cache_driver }, \
+    .parent = _parent, \
+    .lock = MUTEX_INIT, \
+}
+
+/**
+ * @brief   A cached page
+ */
+typedef struct {
+    uint32_t page;          /**< page of the backing device */
+    uint32_t used;          /**< time of last use */
+    uint16_t dirty_start;   /**< first byte not written to the device */
+    uint16_t dirty_end;     /**< end of the bytes not written to the device,
+                             *   0 if the page is clean */
+    bool valid;             /**< true, if the line holds a page */
+} mtd_cache_line_t;
+
+/**
+ * @brief   MTD page cache
+ */
+typedef struct {
+    mtd_dev_t mtd;          /**< MTD context */
+    mtd_dev_t *parent;      /**< Backing MTD device */
+    mutex_t lock;           /**< Mutex for guarding the cache */
+    uint32_t now;           /**< LRU clock */
+    uint32_t next_page;     /**< page following the last page read */
+    mtd_cache_line_t lines[CONFIG_MTD_CACHE_PAGES];     /**< cached pages */
+    uint8_t data[CONFIG_MTD_CACHE_PAGES][CONFIG_MTD_CACHE_PAGE_SIZE];
+                                                        /**< page data */
+} mtd_cache_t;
+
+/**
+ * @brief   Page cache MTD device operations table
+ */
+extern const mtd_desc_t mtd_cache_driver;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MTD_CACHE_H */
+/** @} */
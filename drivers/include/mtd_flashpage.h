@@ -15,6 +15,20 @@
  * accessible flash page memory. To expose merely an area of that as a single
  * MTD partition, the @ref drivers_mtd_mapper can be used.
  *
+ * Erasing a sector that is already erased is skipped, see
+ * @ref CONFIG_MTD_FLASHPAGE_SKIP_ERASED.
+ *
+ * With the module `mtd_flashpage_buffered`, sequential writes are collected
+ * in a buffer of @ref CONFIG_MTD_FLASHPAGE_WRITE_BUF_SIZE bytes and programmed
+ * at once, instead of passing every small write to @ref flashpage_write(). The
+ * buffer is written when it is full, when a write does not continue it, when
+ * the buffered area is read or erased, and by @ref mtd_flush(). Only the bytes
+ * that were written are programmed. Data written but not flushed is lost on a
+ * reset.
+ *
+ * Writes can be moved to a thread with an event queue using the
+ * [asynchronous MTD API](@ref mtd_write_page_async).
+ *
  * @{
  *
  * @file
@@ -26,6 +40,9 @@
 #ifndef MTD_FLASHPAGE_H
 #define MTD_FLASHPAGE_H
 
+#include <stdalign.h>
+
+#include "kernel_defines.h"
 #include "mtd.h"
 #include "periph/flashpage.h"
 
@@ -34,6 +51,25 @@ extern "C"
 {
 #endif
 
+/**
+ * @brief   Skip erasing sectors that read as erased already
+ *
+ * Set to 0 on flash with ECC, if the erased value is ever written explicitly:
+ * such memory reads as erased, but cannot be written again.
+ */
+#ifndef CONFIG_MTD_FLASHPAGE_SKIP_ERASED
+#define CONFIG_MTD_FLASHPAGE_SKIP_ERASED    1
+#endif
+
+/**
+ * @brief   Size of the write buffer of `mtd_flashpage_buffered` in bytes
+ *
+ * Must be a multiple of @ref FLASHPAGE_WRITE_BLOCK_SIZE.
+ */
+#ifndef CONFIG_MTD_FLASHPAGE_WRITE_BUF_SIZE
+#define CONFIG_MTD_FLASHPAGE_WRITE_BUF_SIZE 256
+#endif
+
 /**
  * @brief   Macro helper to initialize a mtd_t with flash-age driver
  */
@@ -59,6 +95,13 @@ extern const mtd_desc_t mtd_flashpage_driver;
  */
 typedef struct {
     mtd_dev_t base;     /**< MTD generic device */
+#if IS_USED(MODULE_MTD_FLASHPAGE_BUFFERED) || DOXYGEN
+    uint32_t buf_addr;  /**< address of the buffered data */
+    uint32_t buf_len;   /**< number of bytes in @p buf, 0 if empty */
+    /** data waiting to be written */
+    alignas(FLASHPAGE_WRITE_BLOCK_ALIGNMENT)
+    uint8_t buf[CONFIG_MTD_FLASHPAGE_WRITE_BUF_SIZE];
+#endif
 } mtd_flashpage_t;
 
 #ifdef __cplusplus
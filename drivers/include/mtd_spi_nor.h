@@ -24,8 +24,10 @@
 #ifndef MTD_SPI_NOR_H
 #define MTD_SPI_NOR_H
 
+#include <stdbool.h>
 #include <stdint.h>
 
+#include "mutex.h"
 #include "periph_conf.h"
 #include "periph/spi.h"
 #include "periph/gpio.h"
@@ -53,6 +55,8 @@ typedef struct {
     uint8_t chip_erase;      /**< Chip erase */
     uint8_t sleep;           /**< Deep power down */
     uint8_t wake;            /**< Release from deep power down */
+    uint8_t erase_suspend;   /**< Suspend a sector or block erase */
+    uint8_t erase_resume;    /**< Resume a suspended erase */
     /* TODO: enter 4 byte address mode for large memories */
 } mtd_spi_nor_opcode_t;
 
@@ -96,6 +100,26 @@ typedef struct __attribute__((packed)) {
  */
 #define SPI_NOR_F_SECT_64K  (4)
 
+/**
+ * @brief   Flag to set to read with the read_fast opcode
+ *
+ * Most devices only reach their maximum SPI clock (@ref
+ * mtd_spi_nor_params_t::clk) with the fast read command, which inserts
+ * eight dummy clocks between address and data.
+ */
+#define SPI_NOR_F_FAST_READ (8)
+
+/**
+ * @brief   Flag to set when the device can suspend an erase to serve reads
+ *
+ * While an erase is running, the device is released for other threads. A
+ * read from another thread suspends the erase with the erase_suspend opcode
+ * and resumes it afterwards with erase_resume, instead of waiting up to the
+ * full erase time. Without this flag, the read waits for the erase to
+ * complete.
+ */
+#define SPI_NOR_F_ERASE_SUSPEND (16)
+
 /**
  * @brief Compile-time parameters for a serial flash device
  */
@@ -119,6 +143,10 @@ typedef struct {
  * @brief   Device descriptor for serial flash memory devices
  *
  * This is an extension of the @c mtd_dev_t struct
+ *
+ * Threads using the device are served in the order of their priority. While
+ * an erase is running, other threads can access the device, see
+ * @ref SPI_NOR_F_ERASE_SUSPEND.
  */
 typedef struct {
     mtd_dev_t base;          /**< inherit from mtd_dev_t object */
@@ -155,6 +183,13 @@ typedef struct {
      * Computed by mtd_spi_nor_init, no need to touch outside the driver.
      */
     uint8_t addr_width;
+    /**
+     * @brief   an erase is running while the device is released
+     *
+     * No need to touch outside the driver.
+     */
+    bool erasing;
+    mutex_t lock;            /**< serializes access to the device */
 } mtd_spi_nor_t;
 
 /**
@@ -268,6 +268,13 @@ typedef enum {
     NETDEV_EVENT_CRC_ERROR,                 /**< wrong CRC */
     NETDEV_EVENT_FHSS_CHANGE_CHANNEL,       /**< channel changed */
     NETDEV_EVENT_CAD_DONE,                  /**< channel activity detection done */
+    /**
+     * @brief   a received frame was lost, e.g. as all RX buffers were in use
+     *
+     * Issued once per lost frame the device is aware of. Frames received with
+     * errors are reported with @ref NETDEV_EVENT_CRC_ERROR instead.
+     */
+    NETDEV_EVENT_RX_OVERRUN,
     /* expand this list if needed */
 } netdev_event_t;
 
@@ -332,6 +339,7 @@ typedef enum {
     NETDEV_ESP_ETH,
     NETDEV_ESP_WIFI,
     NETDEV_CDC_ECM,
+    NETDEV_CDC_NCM,
     /* add more if needed */
 } netdev_type_t;
 /** @} */
@@ -597,6 +605,52 @@ typedef struct netdev_driver {
      */
     int (*set)(netdev_t *dev, netopt_t opt,
                const void *value, size_t value_len);
+
+#if defined(MODULE_NETDEV_RX_LEND) || defined(DOXYGEN)
+    /**
+     * @brief   Lend the buffer holding a received frame to the upper layer
+     *          instead of copying it out (zero-copy receive)
+     *
+     * @pre     `(dev != NULL) && (buf != NULL)`
+     *
+     * Supposed to be called instead of netdev_driver_t::recv, may be `NULL`
+     * if not supported by the driver. On success, the driver must not reuse
+     * the memory at `*buf` until it is handed back via
+     * netdev_driver_t::recv_return. A driver that runs out of buffers while
+     * frames are lent will drop incoming frames.
+     *
+     * @param[in]   dev     network device descriptor. Must not be NULL.
+     * @param[out]  buf     start of the received frame
+     * @param[out]  info    status information for the received frame, as
+     *                      for netdev_driver_t::recv. May be NULL.
+     *
+     * @retval  -ENOTSUP    the frame cannot be lent (e.g. it does not lie in
+     *                      contiguous memory), netdev_driver_t::recv must be
+     *                      used to fetch it instead
+     * @retval  <0          other error, the frame was dropped
+     * @return  size of the received frame
+     *
+     * @note    Only available with module `netdev_rx_lend`.
+     */
+    int (*recv_lend)(netdev_t *dev, void **buf, void *info);
+
+    /**
+     * @brief   Hand a buffer lent via netdev_driver_t::recv_lend back to
+     *          the driver
+     *
+     * @pre     `(dev != NULL) && (buf != NULL)`
+     *
+     * May be called from any thread, in any order with regards to lent
+     * buffers, and must not block.
+     *
+     * @param[in]   dev     network device descriptor. Must not be NULL.
+     * @param[in]   buf     buffer previously returned by
+     *                      netdev_driver_t::recv_lend
+     *
+     * @note    Only available with module `netdev_rx_lend`.
+     */
+    void (*recv_return)(netdev_t *dev, void *buf);
+#endif
 } netdev_driver_t;
 
 /**
@@ -15,10 +15,10 @@
  * a MCU's ADC unit(s). This interface is intentionally designed as simple as
  * possible, to allow for very easy implementation and maximal portability.
  *
- * As of now, the interface does not allow for any advanced ADC concepts (e.g.
- * continuous mode, scan sequences, injections). It is to be determined, if
- * these features will ever be integrated in this interface, or if it does make
- * more sense to create a second, advanced ADC interface for this.
+ * As of now, the interface does not allow for advanced ADC concepts like
+ * injections. Platforms providing the `periph_adc_continuous` feature can
+ * sample a scan sequence of lines continuously, see
+ * @ref adc_continuous_start().
  *
  * The ADC driver interface is built around the concept of ADC lines. An ADC
  * line in this context is a tuple consisting out of a hardware ADC device (an
@@ -42,8 +42,6 @@
  * might need to block certain power states.
  *
  *
- * @todo        Extend interface for continuous mode?
- *
  * @{
  *
  * @file
@@ -56,6 +54,7 @@
 #define PERIPH_ADC_H
 
 #include <limits.h>
+#include <stddef.h>
 #include <stdint.h>
 
 #include "periph_cpu.h"
@@ -128,6 +127,61 @@ int adc_init(adc_t line);
  */
 int32_t adc_sample(adc_t line, adc_res_t res);
 
+#if defined(MODULE_PERIPH_ADC_CONTINUOUS) || defined(DOXYGEN)
+/**
+ * @brief   Signature of the callback for continuously sampled data
+ *
+ * @param[in] arg           argument passed to @ref adc_continuous_start()
+ * @param[in] samples       half of the sample buffer that was just filled
+ * @param[in] len           number of samples in @p samples
+ */
+typedef void (*adc_continuous_cb_t)(void *arg, const uint16_t *samples,
+                                    size_t len);
+
+/**
+ * @brief   Parameters of continuous sampling
+ */
+typedef struct {
+    const adc_t *lines;         /**< lines to sample in this order */
+    uint8_t lines_numof;        /**< number of entries in @ref lines */
+    adc_res_t res;              /**< resolution to use for conversions */
+    uint32_t rate;              /**< scans of all lines per second */
+    uint16_t *buf;              /**< sample buffer */
+    size_t len;                 /**< number of samples in @ref buf, a multiple
+                                 *   of twice @ref lines_numof */
+    adc_continuous_cb_t cb;     /**< called for every filled half of
+                                 *   @ref buf, in interrupt context */
+    void *arg;                  /**< argument to @ref cb */
+} adc_continuous_t;
+
+/**
+ * @brief   Starts sampling a sequence of lines continuously
+ *
+ * A hardware timer starts a scan of all lines @p params->rate times per
+ * second and DMA writes the results to @p params->buf, which is used as a
+ * double buffer: while one half is filled, @p params->cb is called for the
+ * other half. The samples of one scan are stored next to each other, in the
+ * order of @p params->lines. The callback must be done with the data before
+ * the DMA wraps around to it.
+ *
+ * The lines must have been initialized with @ref adc_init() and are blocked
+ * for @ref adc_sample() until @ref adc_continuous_stop() is called.
+ *
+ * @param[in] params        sampling parameters, must stay valid until
+ *                          sampling is stopped
+ *
+ * @return                  0 on success
+ * @return                  -EINVAL if the parameters are not applicable
+ * @return                  -ENOTSUP if the lines cannot be sampled together
+ */
+int adc_continuous_start(const adc_continuous_t *params);
+
+/**
+ * @brief   Stops continuous sampling
+ */
+void adc_continuous_stop(void);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
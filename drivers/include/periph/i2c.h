@@ -492,6 +492,90 @@ int i2c_write_reg(i2c_t dev, uint16_t addr, uint16_t reg,
 int i2c_write_regs(i2c_t dev, uint16_t addr, uint16_t reg,
                   const void *data, size_t len, uint8_t flags);
 
+#if defined(MODULE_PERIPH_I2C_ASYNC) || defined(DOXYGEN)
+/**
+ * @name    Asynchronous transactions
+ *
+ * Platforms providing the `periph_i2c_async` feature can queue transactions
+ * that are done in the background and signal their completion by callback.
+ * Every bus has a queue of transactions, so several drivers can submit
+ * without waiting for each other:
+ *
+ * ```
+ * static void _done(void *arg)
+ * {
+ *     thread_flags_set(arg, FLAG_I2C_DONE);
+ * }
+ *
+ * uint8_t reg = SENSOR_REG_DATA;
+ * uint8_t data[6];
+ * i2c_async_xfer_t xfer = { .addr = SENSOR_ADDR,
+ *                           .out = &reg, .out_len = 1,
+ *                           .in = data, .in_len = sizeof(data),
+ *                           .cb = _done, .arg = thread_get_active() };
+ *
+ * i2c_transfer_async(dev, &xfer);
+ * thread_flags_wait_any(FLAG_I2C_DONE);
+ * ```
+ *
+ * The bus does not need to be acquired for this: the first transaction
+ * queued on an idle bus acquires it and the bus is released when the queue
+ * is empty again. Blocking transfers of other threads wait for the queue to
+ * drain.
+ * @{
+ */
+/**
+ * @brief   Callback for a completed asynchronous transaction
+ *
+ * @param[in]   arg     @ref i2c_async_xfer_t::arg of the transaction
+ */
+typedef void (*i2c_async_cb_t)(void *arg);
+
+/**
+ * @brief   Asynchronous I2C transaction
+ *
+ * A transaction writes @ref out, then reads @ref in after a repeated start
+ * condition and ends with a stop condition. Either part may be empty, so a
+ * register read puts the register address into @ref out. Only 7-bit
+ * addresses are supported.
+ *
+ * The transaction and its buffers must stay valid until its callback was
+ * called.
+ */
+typedef struct i2c_async_xfer {
+    struct i2c_async_xfer *next;    /**< next queued transaction, used
+                                     *   internally */
+    uint16_t addr;                  /**< 7-bit device address */
+    uint8_t out_len;                /**< number of bytes to write */
+    uint8_t in_len;                 /**< number of bytes to read */
+    const void *out;                /**< buffer to write */
+    void *in;                       /**< buffer to read into */
+    int res;                        /**< result, set before @ref cb is
+                                     *   called: 0 on success, -ENXIO or
+                                     *   -EIO on NACK of address or data */
+    i2c_async_cb_t cb;              /**< called in interrupt context when
+                                     *   the transaction is complete, may be
+                                     *   NULL */
+    void *arg;                      /**< argument passed to @ref cb */
+} i2c_async_xfer_t;
+
+/**
+ * @brief   Queue a transaction on the given I2C bus
+ *
+ * The transaction is started right away if the bus is idle, otherwise it is
+ * started from interrupt context as soon as the previously queued
+ * transactions are complete. Queueing from within a callback is allowed.
+ *
+ * @pre     If the bus is idle, this must be called from thread context and
+ *          the calling thread must not hold the bus, as the bus is acquired.
+ *
+ * @param[in]   dev     I2C peripheral device
+ * @param[in]   xfer    transaction to queue
+ */
+void i2c_transfer_async(i2c_t dev, i2c_async_xfer_t *xfer);
+/** @} */
+#endif /* MODULE_PERIPH_I2C_ASYNC */
+
 #ifdef __cplusplus
 }
 #endif
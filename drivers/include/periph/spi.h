@@ -422,6 +422,85 @@ uint8_t spi_transfer_reg(spi_t bus, spi_cs_t cs, uint8_t reg, uint8_t out);
 void spi_transfer_regs(spi_t bus, spi_cs_t cs, uint8_t reg,
                        const void *out, void *in, size_t len);
 
+#if defined(MODULE_PERIPH_SPI_ASYNC) || DOXYGEN
+/**
+ * @name    Asynchronous SPI transfers
+ *
+ * With the `periph_spi_async` feature, transfers can be queued on an acquired
+ * bus. The function queueing them returns right away, the transfers are done
+ * one after the other in the background (e.g. using DMA) and a callback is
+ * called from interrupt context when a transfer is complete:
+ *
+ * ```
+ * static void _done(void *arg)
+ * {
+ *     thread_flags_set(arg, FLAG_SPI_DONE);
+ * }
+ *
+ * spi_async_xfer_t cmd = { .cs = cs, .cont = true, .out = hdr, .len = 4 };
+ * spi_async_xfer_t data = { .cs = cs, .out = buf, .len = sizeof(buf),
+ *                            .cb = _done, .arg = thread_get_active() };
+ *
+ * spi_acquire(bus, cs, SPI_MODE_0, SPI_CLK_10MHZ);
+ * spi_transfer_bytes_async(bus, &cmd);
+ * spi_transfer_bytes_async(bus, &data);
+ * thread_flags_wait_any(FLAG_SPI_DONE);
+ * spi_release(bus);
+ * ```
+ *
+ * All queued transfers must be complete before the bus is released or before
+ * the blocking transfer functions are used on the bus again. Buses
+ * the implementation cannot transfer in the background (e.g. because no DMA
+ * is configured for them) do the transfer right away, so the callback may
+ * also be called from thread context before @ref spi_transfer_bytes_async
+ * returns.
+ * @{
+ */
+/**
+ * @brief   Callback for a completed asynchronous transfer
+ *
+ * @param[in]   arg     @ref spi_async_xfer_t::arg of the transfer
+ */
+typedef void (*spi_async_cb_t)(void *arg);
+
+/**
+ * @brief   Asynchronous SPI transfer
+ *
+ * The transfer and its buffers must stay valid until its callback was called.
+ */
+typedef struct spi_async_xfer {
+    struct spi_async_xfer *next;    /**< next queued transfer, used
+                                     *   internally */
+    const void *out;                /**< buffer to send, NULL if only
+                                     *   receiving */
+    void *in;                       /**< buffer to read into, NULL if only
+                                     *   sending */
+    size_t len;                     /**< number of bytes to transfer */
+    spi_cs_t cs;                    /**< chip select line, SPI_CS_UNDEF if
+                                     *   not handled by the driver */
+    bool cont;                      /**< keep the device selected after the
+                                     *   transfer */
+    spi_async_cb_t cb;              /**< called when the transfer is
+                                     *   complete, may be NULL */
+    void *arg;                      /**< argument passed to @ref cb */
+} spi_async_xfer_t;
+
+/**
+ * @brief   Queue a transfer on the given SPI bus
+ *
+ * The transfer is started right away if the bus is idle, otherwise it is
+ * started from interrupt context as soon as the previously queued transfers
+ * are complete. Queueing from within a callback is allowed.
+ *
+ * @pre     The bus was acquired with spi_acquire() by the calling thread
+ *
+ * @param[in]   bus     SPI device to use
+ * @param[in]   xfer    transfer to queue
+ */
+void spi_transfer_bytes_async(spi_t bus, spi_async_xfer_t *xfer);
+/** @} */
+#endif /* MODULE_PERIPH_SPI_ASYNC */
+
 #ifdef __cplusplus
 }
 #endif
@@ -211,6 +211,20 @@ int timer_clear(tim_t dev, int channel);
  */
 unsigned int timer_read(tim_t dev);
 
+/**
+ * @brief Read the current value of the 64 bit counter of the given timer
+ *        device
+ *
+ * The lower 32 bits are the value returned by @ref timer_read().
+ *
+ * @note  Needs to be enabled with `FEATURES_REQUIRED += periph_timer_read64`.
+ *
+ * @param[in] dev           the timer to read the current value from
+ *
+ * @return                  the timers current value
+ */
+uint64_t timer_read64(tim_t dev);
+
 /**
  * @brief Start the given timer
  *
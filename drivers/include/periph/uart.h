@@ -296,6 +296,61 @@ void uart_rxstart_irq_enable(uart_t uart);
 void uart_rxstart_irq_disable(uart_t uart);
 #endif /* MODULE_PERIPH_UART_RXSTART_IRQ */
 
+#if defined(MODULE_PERIPH_UART_RX_DMA) || DOXYGEN
+/**
+ * @brief   Signature for the block receive callback
+ *
+ * @param[in] arg           context to the callback (optional)
+ * @param[in] data          received data, points into the buffer given to
+ *                          @ref uart_rx_dma_start
+ * @param[in] len           number of bytes received
+ */
+typedef void(*uart_rx_block_cb_t)(void *arg, const uint8_t *data, size_t len);
+
+/**
+ * @brief   Receive into a circular buffer using DMA
+ *
+ * Instead of calling the receive callback given to @ref uart_init for every
+ * byte, data is received into @p buf by DMA. @p cb is called from interrupt
+ * context when the line goes idle after some data was received, when half of
+ * @p buf is filled and when the end of @p buf is reached. So at high symbol
+ * rates, there is about one interrupt per message, or per half buffer for
+ * continuous streams.
+ *
+ * The data passed to @p cb must be consumed before it is overwritten, i.e.
+ * before another `len / 2` bytes are received.
+ *
+ * @note    You have to add the module `periph_uart_rx_dma` to your project
+ *          to enable this function
+ *
+ * @pre     @p uart was initialized with a receive callback
+ *
+ * @param[in] uart          The device to configure
+ * @param[in] buf           Circular receive buffer
+ * @param[in] len           Size of @p buf
+ * @param[in] cb            Called with chunks of received data
+ * @param[in] arg           Optional argument passed to @p cb
+ *
+ * @retval  0               success
+ * @retval  -ENOTSUP        no DMA stream is configured for the device
+ */
+int uart_rx_dma_start(uart_t uart, uint8_t *buf, size_t len,
+                      uart_rx_block_cb_t cb, void *arg);
+
+/**
+ * @brief   Stop receiving using DMA
+ *
+ * Data not handed to the block receive callback yet is dropped, the receive
+ * callback given to @ref uart_init is called for every byte again.
+ *
+ * @note    You have to add the module `periph_uart_rx_dma` to your project
+ *          to enable this function
+ *
+ * @param[in] uart          The device to configure
+ */
+void uart_rx_dma_stop(uart_t uart);
+#endif /* MODULE_PERIPH_UART_RX_DMA */
+
 #if defined(MODULE_PERIPH_UART_COLLISION) || DOXYGEN
 /**
  * @brief   Enables collision detection check of the UART.
@@ -58,6 +58,26 @@
  * instantiated with the attributes to ensure that the low level DMA interface
  * can use it.
  *
+ * # Double buffering
+ *
+ * By default only one transfer can be pending per endpoint. The bus then idles
+ * from the completion of a transfer until the upper layer has handled the
+ * @ref USBDEV_EVENT_TR_COMPLETE event and submitted the next buffer.
+ *
+ * Drivers may support @ref USBOPT_EP_DOUBLE_BUFFER for non-control endpoints.
+ * Once it is enabled, a second transfer can be submitted with
+ * @ref usbdev_ep_xmit while the first one is still pending. The driver starts
+ * it as soon as the first one completes, without waiting for the upper layer.
+ * - @ref USBDEV_EVENT_TR_COMPLETE is emitted once per transfer, in the order
+ *   the transfers were submitted.
+ * - @ref USBOPT_EP_AVAILABLE refers to the transfer the event is emitted for.
+ * - @ref usbdev_ep_xmit returns -EBUSY if two transfers are pending already.
+ * - Disabling the endpoint drops the queued transfer.
+ * - The option must only be changed while no transfer is pending.
+ *
+ * Setting the option returns -ENOTSUP if the driver doesn't support it, the
+ * upper layer then has to keep to a single pending transfer.
+ *
  * A callback function is required for signalling events from the driver. The
  * @ref USBDEV_EVENT_ESR is special in that it indicates that the USB peripheral
  * had an interrupt that needs to be serviced in a non-interrupt context. This
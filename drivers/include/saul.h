@@ -48,6 +48,7 @@
 #ifndef SAUL_H
 #define SAUL_H
 
+#include <stddef.h>
 #include <stdint.h>
 #include <errno.h>
 
@@ -277,6 +278,33 @@ typedef int(*saul_read_t)(const void *dev, phydat_t *res);
  */
 typedef int(*saul_write_t)(const void *dev, const phydat_t *data);
 
+/**
+ * @brief   Sample read from a device buffer, see @ref saul_read_batch_t
+ */
+typedef struct {
+    phydat_t data;          /**< value of the sample */
+    uint32_t timestamp;     /**< time the sample was taken in µs */
+} saul_sample_t;
+
+/**
+ * @brief   Read all samples buffered by a device
+ *
+ * Sensors with a hardware FIFO can implement this to drain the FIFO with a
+ * single call. The samples are stored oldest first. Sensors do not timestamp
+ * their samples, so the driver stores the age of every sample in µs relative
+ * to the read in saul_sample_t::timestamp, derived from the sample rate.
+ *
+ * @param[in] dev       device descriptor of the target device
+ * @param[out] res      samples read from the device
+ * @param[in] num       number of entries in @p res
+ *
+ * @return  number of samples written to @p res
+ * @return  -ENOTSUP if the device does not support this operation
+ * @return  -ECANCELED on other errors
+ */
+typedef int(*saul_read_batch_t)(const void *dev, saul_sample_t *res,
+                                size_t num);
+
 /**
  * @brief   Definition of the RIOT actuator/sensor interface
  */
@@ -284,6 +312,8 @@ typedef struct {
     saul_read_t read;       /**< read function pointer */
     saul_write_t write;     /**< write function pointer */
     uint8_t type;           /**< device class the device belongs to */
+    saul_read_batch_t read_batch;   /**< batch read function pointer, may be
+                                     *   NULL */
 } saul_driver_t;
 
 /**
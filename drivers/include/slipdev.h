@@ -52,6 +52,17 @@ extern "C" {
 #ifndef CONFIG_SLIPDEV_BUFSIZE
 #define CONFIG_SLIPDEV_BUFSIZE (2048U)
 #endif
+
+/**
+ * @brief   Size of the circular DMA buffer used with `periph_uart_rx_dma`
+ *
+ * Received data is handed on whenever the line goes idle or half of this
+ * buffer is filled, so it needs to hold what arrives while the receive
+ * interrupt is blocked.
+ */
+#ifndef CONFIG_SLIPDEV_RX_DMA_BUFSIZE
+#define CONFIG_SLIPDEV_RX_DMA_BUFSIZE (64U)
+#endif
 /** @} */
 
 /**
@@ -93,6 +104,12 @@ typedef struct {
     slipdev_params_t config;                /**< configuration parameters */
     tsrb_t inbuf;                           /**< RX buffer */
     uint8_t rxmem[CONFIG_SLIPDEV_BUFSIZE];  /**< memory used by RX buffer */
+#if defined(MODULE_PERIPH_UART_RX_DMA) || defined(DOXYGEN)
+    /**
+     * @brief   DMA receive buffer, used if the UART has a DMA stream
+     */
+    uint8_t rxdma[CONFIG_SLIPDEV_RX_DMA_BUFSIZE];
+#endif
     /**
      * @brief   Device state
      * @see     [Device state definitions](@ref drivers_slipdev_states)
@@ -46,6 +46,27 @@
  *
  * The native (VT100) implementation writes the LED state to the console.
  *
+ * ## SPI
+ *
+ * On platforms with the `periph_spi_async` feature, the LEDs can be driven by
+ * the MOSI pin of an SPI bus. Every data bit is encoded into three SPI bits
+ * (`100` for a zero, `110` for a one), so the SPI clock must be between
+ * 2.2 MHz and 3.2 MHz. The frame is encoded into one of two buffers given in
+ * the parameters and sent with @ref spi_transfer_bytes_async (e.g. by DMA),
+ * so interrupts stay enabled during the transfer and @ref ws281x_write
+ * returns while the frame is still sent. The next frame is encoded into the
+ * other buffer in the meantime. With only one buffer, encoding the next frame
+ * waits for the previous one to be sent.
+ *
+ * Frames larger than a buffer (see @ref ws281x_write_buffer) are sent in
+ * chunks, alternating between both buffers. The gap between two chunks is
+ * only the latency of the completion interrupt, which is well below the end
+ * of transmission time of the LEDs.
+ *
+ * @note    The SPI bus is not available to other devices while a frame is
+ *          sent. @ref WS281X_PARAM_SPI_CLK defaults to 3 MHz, platforms
+ *          where `spi_clk_t` is not a frequency in Hz have to set it.
+ *
  * ### Usage
  *
  * Add the following to your `Makefile`:
@@ -75,6 +96,11 @@
  * USEMODULE += ws281x_vt100
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
  *
+ * * the SPI backend:
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ Makefile
+ * USEMODULE += ws281x_spi
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ *
  * @{
  *
  * @file
@@ -86,10 +112,15 @@
 #ifndef WS281X_H
 #define WS281X_H
 
+#include <stdbool.h>
 #include <stdint.h>
 
 #include "color.h"
 #include "periph/gpio.h"
+#if defined(MODULE_WS281X_SPI) || defined(DOXYGEN)
+#include "mutex.h"
+#include "periph/spi.h"
+#endif
 #include "ws281x_backend.h"
 #include "ws281x_constants.h"
 #include "xtimer.h"
@@ -103,6 +134,18 @@ extern "C" {
  */
 #define WS281X_BYTES_PER_DEVICE       (3U)
 
+#if defined(MODULE_WS281X_SPI) || defined(DOXYGEN)
+/**
+ * @brief   Size of an SPI buffer holding a frame of @p numof LEDs
+ *
+ * A full frame fits into a buffer of this size, so it is sent with a single
+ * transfer.
+ */
+#define WS281X_SPI_BUF_SIZE(numof)    ((numof) * WS281X_BYTES_PER_DEVICE * \
+                                       WS281X_SPI_BYTES_PER_BYTE + \
+                                       WS281X_SPI_RESET_BYTES)
+#endif
+
 /**
  * @brief   Struct to hold initialization parameters for a WS281x RGB LED
  */
@@ -115,6 +158,20 @@ typedef struct {
     uint8_t *buf;
     uint16_t numof;             /**< Number of chained RGB LEDs */
     gpio_t pin;                 /**< GPIO connected to the data pin of the first LED */
+#if defined(MODULE_WS281X_SPI) || defined(DOXYGEN)
+    spi_t spi;                  /**< SPI bus whose MOSI pin is connected to
+                                 *   the data pin of the first LED */
+    spi_clk_t spi_clk;          /**< SPI clock, 2.2 MHz to 3.2 MHz */
+    /**
+     * @brief   Buffers for the encoded frames
+     *
+     * The second buffer may be NULL. Both buffers must be at least
+     * @ref WS281X_SPI_BYTES_PER_BYTE bytes, and @ref WS281X_SPI_BUF_SIZE
+     * bytes to send a frame in one transfer.
+     */
+    uint8_t *spi_buf[2];
+    size_t spi_buf_size;        /**< Size of each buffer in @ref spi_buf */
+#endif
 } ws281x_params_t;
 
 /**
@@ -122,6 +179,16 @@ typedef struct {
  */
 typedef struct {
     ws281x_params_t params;   /**< Parameters of the LED chain */
+#if defined(MODULE_WS281X_SPI) || defined(DOXYGEN)
+    spi_async_xfer_t xfer[2]; /**< Transfers of the SPI buffers */
+    mutex_t lock[2];          /**< Locked while an SPI buffer is encoded or
+                               *   sent */
+    bool last[2];             /**< Transfer ends the transmission */
+    size_t pos;               /**< Bytes encoded into the current buffer */
+    uint8_t cur;              /**< SPI buffer currently encoded into */
+    uint8_t sending;          /**< SPI buffer sent by the oldest transfer */
+    bool acquired;            /**< SPI bus acquired for this transmission */
+#endif
 } ws281x_t;
 
 #if defined(WS281X_HAVE_INIT) || defined(DOXYGEN)
@@ -160,6 +160,75 @@ void lcd_pixmap(const lcd_t *dev, uint16_t x1, uint16_t x2,
     spi_release(dev->params->spi);
 }
 
+#ifdef MODULE_PERIPH_SPI_ASYNC
+static void _pixmap_queue_chunk(lcd_t *dev)
+{
+    size_t len = dev->pending_len;
+
+    if (len > LCD_ASYNC_CHUNK_SIZE) {
+        len = LCD_ASYNC_CHUNK_SIZE;
+    }
+
+    dev->xfer.out = dev->pending;
+    dev->xfer.len = len;
+    dev->xfer.cont = (len < dev->pending_len);
+    dev->pending += len;
+    dev->pending_len -= len;
+
+    spi_transfer_bytes_async(dev->params->spi, &dev->xfer);
+}
+
+static void _pixmap_chunk_done(void *arg)
+{
+    lcd_t *dev = arg;
+
+    if (dev->pending_len) {
+        _pixmap_queue_chunk(dev);
+        return;
+    }
+
+    spi_release(dev->params->spi);
+    if (dev->cb) {
+        dev->cb(dev->arg);
+    }
+}
+
+void lcd_pixmap_async(lcd_t *dev, uint16_t x1, uint16_t x2, uint16_t y1,
+                      uint16_t y2, const uint16_t *color,
+                      spi_async_cb_t cb, void *arg)
+{
+    if (IS_ACTIVE(CONFIG_LCD_LE_MODE)) {
+        lcd_pixmap(dev, x1, x2, y1, y2, color);
+        if (cb) {
+            cb(arg);
+        }
+        return;
+    }
+
+    size_t num_pix = (x2 - x1 + 1) * (y2 - y1 + 1);
+
+    DEBUG("[lcd]: Write async x1: %" PRIu16 ", x2: %" PRIu16 ", "
+          "y1: %" PRIu16 ", y2: %" PRIu16 ". Num pixels: %lu\n",
+          x1, x2, y1, y2, (unsigned long)num_pix);
+
+    _lcd_spi_acquire(dev);
+
+    _lcd_set_area(dev, x1, x2, y1, y2);
+    _lcd_cmd_start(dev, LCD_CMD_RAMWR, true);
+
+    dev->cb = cb;
+    dev->arg = arg;
+    dev->pending = (const uint8_t *)color;
+    dev->pending_len = num_pix * 2;
+    dev->xfer.in = NULL;
+    dev->xfer.cs = dev->params->cs_pin;
+    dev->xfer.cb = _pixmap_chunk_done;
+    dev->xfer.arg = dev;
+
+    _pixmap_queue_chunk(dev);
+}
+#endif /* MODULE_PERIPH_SPI_ASYNC */
+
 void lcd_invert_on(const lcd_t *dev)
 {
     uint8_t command = (dev->params->inverted) ? LCD_CMD_DINVOFF
@@ -33,6 +33,17 @@ static void _lcd_map(const disp_dev_t *dev, const disp_dev_area_t *area, const u
     lcd_pixmap(lcd, area->x1, area->x2, area->y1, area->y2, color);
 }
 
+#ifdef MODULE_PERIPH_SPI_ASYNC
+static void _lcd_map_async(const disp_dev_t *dev, const disp_dev_area_t *area,
+                           const uint16_t *color, disp_dev_map_cb_t cb,
+                           void *arg)
+{
+    lcd_t *lcd = (lcd_t *)dev;
+    lcd_pixmap_async(lcd, area->x1, area->x2, area->y1, area->y2, color,
+                     cb, arg);
+}
+#endif
+
 static uint16_t _lcd_height(const disp_dev_t *disp_dev)
 {
     const lcd_t *dev = (lcd_t *)disp_dev;
@@ -75,4 +86,7 @@ const disp_dev_driver_t lcd_disp_dev_driver = {
     .width          = _lcd_width,
     .color_depth    = _lcd_color_depth,
     .set_invert     = _lcd_set_invert,
+#ifdef MODULE_PERIPH_SPI_ASYNC
+    .map_async      = _lcd_map_async,
+#endif
 };
@@ -132,6 +132,11 @@ enum {
  */
 #define LIS2DH12_INT_SRC_CLICK(ret) (((uint32_t)(ret) >> 16) & 0x7F)
 
+/**
+ * @brief   Extract FIFO_SRC_REG for the FIFO watermark event
+ */
+#define LIS2DH12_INT_SRC_FIFO(ret)  (((uint32_t)(ret) >> 24) & 0xFF)
+
 /**
  * @brief   CLICK_SRC definitions
  */
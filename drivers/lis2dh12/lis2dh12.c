@@ -427,6 +427,10 @@ static uint32_t _merge_int_flags(const lis2dh12_t *dev, uint8_t events)
     if (events & LIS2DH12_INT_TYPE_CLICK) {
         int_src |= (uint32_t)_read(dev, REG_CLICK_SRC) << 16;
     }
+    /* reserved bit in CTRL_REG6, so only set for INT1 */
+    if (events & LIS2DH12_INT_TYPE_I1_WTM) {
+        int_src |= (uint32_t)_read(dev, REG_FIFO_SRC_REG) << 24;
+    }
 
     DEBUG("int_src: %"PRIx32"\n", int_src);
 
@@ -435,7 +439,20 @@ static uint32_t _merge_int_flags(const lis2dh12_t *dev, uint8_t events)
 
 #define LIS2DH12_INT_SRC_ANY (((uint32_t)LIS2DH12_INT_SRC_IA <<  0) | \
                               ((uint32_t)LIS2DH12_INT_SRC_IA <<  8) | \
-                              ((uint32_t)LIS2DH12_INT_SRC_IA << 16))
+                              ((uint32_t)LIS2DH12_INT_SRC_IA << 16) | \
+                              ((uint32_t)0x80 << 24))   /* FIFO_SRC_REG WTM */
+
+void lis2dh12_cfg_fifo_watermark_event(const lis2dh12_t *dev, bool enable)
+{
+    _acquire(dev);
+
+    LIS2DH12_CTRL_REG3_t reg3;
+    reg3.reg = _read(dev, REG_CTRL_REG3);
+    reg3.bit.I1_WTM = enable;
+    _write(dev, REG_CTRL_REG3, reg3.reg);
+
+    _release(dev);
+}
 
 int lis2dh12_wait_event(const lis2dh12_t *dev, uint8_t line, bool stale_events)
 {
@@ -20,6 +20,7 @@
 
 #include "saul.h"
 #include "lis2dh12.h"
+#include "timex.h"
 
 static int read_accelerometer(const void *dev, phydat_t *res)
 {
@@ -31,6 +32,32 @@ static int read_accelerometer(const void *dev, phydat_t *res)
     return 3;
 }
 
+static int read_accelerometer_batch(const void *dev, saul_sample_t *res,
+                                    size_t num)
+{
+    uint16_t rate = lis2dh12_get_datarate(dev);
+    uint32_t period = rate ? US_PER_SEC / rate : 0;
+    size_t n = 0;
+
+    while (n < num && lis2dh12_read_fifo_data(dev,
+                          (lis2dh12_fifo_data_t *)res[n].data.val, 1)) {
+        res[n].data.unit = UNIT_G;
+        res[n].data.scale = -3;
+        n++;
+    }
+    /* FIFO bypassed: return the current sample */
+    if (n == 0 && num) {
+        if (read_accelerometer(dev, &res[0].data) == 0) {
+            return 0;
+        }
+        n = 1;
+    }
+    for (size_t i = 0; i < n; i++) {
+        res[i].timestamp = (n - 1 - i) * period;
+    }
+    return n;
+}
+
 static int read_temperature(const void *dev, phydat_t *res)
 {
     if (lis2dh12_read_temperature(dev, &res->val[0])) {
@@ -46,6 +73,7 @@ const saul_driver_t lis2dh12_saul_driver = {
     .read = read_accelerometer,
     .write = saul_write_notsup,
     .type = SAUL_SENSE_ACCEL,
+    .read_batch = read_accelerometer_batch,
 };
 
 const saul_driver_t lis2dh12_saul_temp_driver = {
@@ -149,8 +149,30 @@ extern "C" {
 #define LSM6DSL_FIFO_CTRL5_FIFO_ODR_SHIFT   (3)
 
 #define LSM6DSL_FIFO_CTRL3_GYRO_DEC_SHIFT   (3)
+
+#define LSM6DSL_FIFO_CTRL2_FTH_MASK         (0x07)
+/** @} */
+
+/**
+ * @name    FIFO_STATUSx registers
+ * @{
+ */
+#define LSM6DSL_FIFO_STATUS2_DIFF_MASK      (0x07)
+#define LSM6DSL_FIFO_STATUS4_PATTERN_MASK   (0x03)
+/** @} */
+
+/**
+ * @name    INT1_CTRL register
+ * @{
+ */
+#define LSM6DSL_INT1_CTRL_FTH               (0x08)
 /** @} */
 
+/**
+ * @brief   Maximum FIFO threshold in 16 bit words
+ */
+#define LSM6DSL_FIFO_FTH_MAX                (0x7ff)
+
 /**
  * @brief	Offset for temperature calculation
  */
@@ -21,6 +21,7 @@
  */
 
 #include <assert.h>
+#include <stdbool.h>
 
 #include "ztimer.h"
 
@@ -137,6 +138,127 @@ int lsm6dsl_read_acc(const lsm6dsl_t *dev, lsm6dsl_3d_data_t *data)
     return LSM6DSL_OK;
 }
 
+static const uint8_t fifo_decimation[] = { 0, 1, 2, 3, 4, 8, 16, 32 };
+
+uint32_t lsm6dsl_acc_fifo_period(const lsm6dsl_t *dev)
+{
+    uint8_t odr = MAX(dev->params.acc_odr, dev->params.gyro_odr);
+    uint32_t period;
+
+    if (dev->params.acc_decimation == LSM6DSL_DECIMATION_NOT_IN_FIFO ||
+        odr == LSM6DSL_DATA_RATE_POWER_DOWN) {
+        return 0;
+    }
+    if (odr == LSM6DSL_DATA_RATE_1_6HZ) {
+        period = 625000;
+    }
+    else {
+        /* 12.5 Hz doubling with every step */
+        period = 80000 >> (odr - LSM6DSL_DATA_RATE_12_5HZ);
+    }
+    return period * fifo_decimation[dev->params.acc_decimation];
+}
+
+int lsm6dsl_read_acc_fifo(const lsm6dsl_t *dev, lsm6dsl_3d_data_t *data,
+                          size_t num)
+{
+    uint8_t status[4];
+    bool gyro = dev->params.gyro_decimation != LSM6DSL_DECIMATION_NOT_IN_FIFO;
+
+    if ((dev->params.acc_decimation == LSM6DSL_DECIMATION_NOT_IN_FIFO) ||
+        (gyro && ((dev->params.gyro_decimation != dev->params.acc_decimation) ||
+                  (dev->params.gyro_odr != dev->params.acc_odr)))) {
+        return -LSM6DSL_ERROR_CNF;
+    }
+
+    /* with both sensors in the FIFO, gyroscope and accelerometer data sets
+     * alternate */
+    unsigned set_words = gyro ? 6 : 3;
+    unsigned acc_offset = gyro ? 3 : 0;
+
+    i2c_acquire(BUS);
+    if (i2c_read_regs(BUS, ADDR, LSM6DSL_REG_FIFO_STATUS1, status,
+                      sizeof(status), 0) < 0) {
+        i2c_release(BUS);
+        return -LSM6DSL_ERROR_BUS;
+    }
+    unsigned unread = status[0] |
+                      ((status[1] & LSM6DSL_FIFO_STATUS2_DIFF_MASK) << 8);
+    unsigned pattern = status[2] |
+                       ((status[3] & LSM6DSL_FIFO_STATUS4_PATTERN_MASK) << 8);
+
+    size_t n = 0;
+    uint8_t axes = 0;
+    while (unread && n < num) {
+        uint8_t word[2];
+        if (i2c_read_regs(BUS, ADDR, LSM6DSL_REG_FIFO_DATA_OUT_L, word,
+                          sizeof(word), 0) < 0) {
+            i2c_release(BUS);
+            return -LSM6DSL_ERROR_BUS;
+        }
+        unread--;
+
+        unsigned pos = pattern++ % set_words;
+        if (pos < acc_offset) {
+            continue;
+        }
+        pos -= acc_offset;
+        int16_t val = word[0] | (word[1] << 8);
+        val = ((int32_t)val * range_acc[dev->params.acc_fs]) / INT16_MAX;
+        switch (pos) {
+        case 0:
+            data[n].x = val;
+            axes = 1;
+            break;
+        case 1:
+            data[n].y = val;
+            axes |= 2;
+            break;
+        default:
+            data[n].z = val;
+            /* skip sets that were partially read before */
+            if (axes == 3) {
+                n++;
+            }
+            axes = 0;
+        }
+    }
+    i2c_release(BUS);
+
+    return n;
+}
+
+int lsm6dsl_set_fifo_threshold(const lsm6dsl_t *dev, uint16_t words)
+{
+    uint8_t tmp;
+    int res;
+
+    if (words > LSM6DSL_FIFO_FTH_MAX) {
+        return -LSM6DSL_ERROR_CNF;
+    }
+
+    i2c_acquire(BUS);
+    res = i2c_write_reg(BUS, ADDR, LSM6DSL_REG_FIFO_CTRL1, words & 0xff, 0);
+    res += i2c_read_reg(BUS, ADDR, LSM6DSL_REG_FIFO_CTRL2, &tmp, 0);
+    tmp = (tmp & ~LSM6DSL_FIFO_CTRL2_FTH_MASK) | (words >> 8);
+    res += i2c_write_reg(BUS, ADDR, LSM6DSL_REG_FIFO_CTRL2, tmp, 0);
+    res += i2c_read_reg(BUS, ADDR, LSM6DSL_REG_INT1_CTRL, &tmp, 0);
+    if (words) {
+        tmp |= LSM6DSL_INT1_CTRL_FTH;
+    }
+    else {
+        tmp &= ~LSM6DSL_INT1_CTRL_FTH;
+    }
+    res += i2c_write_reg(BUS, ADDR, LSM6DSL_REG_INT1_CTRL, tmp, 0);
+    i2c_release(BUS);
+
+    if (res < 0) {
+        DEBUG("[ERROR] lsm6dsl_set_fifo_threshold\n");
+        return -LSM6DSL_ERROR_BUS;
+    }
+    return LSM6DSL_OK;
+}
+
 int lsm6dsl_read_gyro(const lsm6dsl_t *dev, lsm6dsl_3d_data_t *data)
 {
     int res;
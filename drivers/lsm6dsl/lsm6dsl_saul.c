@@ -20,6 +20,9 @@
  * @}
  */
 
+#include <string.h>
+
+#include "kernel_defines.h"
 #include "lsm6dsl.h"
 #include "saul.h"
 
@@ -36,6 +39,35 @@ static int read_acc(const void *dev, phydat_t *res)
     return 3;
 }
 
+static int read_acc_batch(const void *dev, saul_sample_t *res, size_t num)
+{
+    lsm6dsl_3d_data_t data[8];
+    size_t n = 0;
+
+    while (n < num) {
+        size_t chunk = (num - n < ARRAY_SIZE(data)) ? num - n : ARRAY_SIZE(data);
+        int ret = lsm6dsl_read_acc_fifo(dev, data, chunk);
+        if (ret < 0) {
+            return -ECANCELED;
+        }
+        for (int i = 0; i < ret; i++, n++) {
+            memcpy(res[n].data.val, &data[i], sizeof(data[i]));
+            res[n].data.scale = -3;
+            res[n].data.unit = UNIT_G;
+        }
+        if ((size_t)ret < chunk) {
+            break;
+        }
+    }
+
+    uint32_t period = lsm6dsl_acc_fifo_period(dev);
+    for (size_t i = 0; i < n; i++) {
+        res[i].timestamp = (n - 1 - i) * period;
+    }
+
+    return n;
+}
+
 static int read_gyro(const void *dev, phydat_t *res)
 {
     int ret = lsm6dsl_read_gyro((const lsm6dsl_t *)dev, (lsm6dsl_3d_data_t *)res->val);
@@ -64,6 +96,7 @@ const saul_driver_t lsm6dsl_saul_acc_driver = {
     .read = read_acc,
     .write = saul_write_notsup,
     .type = SAUL_SENSE_ACCEL,
+    .read_batch = read_acc_batch,
 };
 
 const saul_driver_t lsm6dsl_saul_gyro_driver = {
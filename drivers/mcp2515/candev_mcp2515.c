@@ -512,6 +512,11 @@ static int _set_filter(candev_t *dev, const struct can_filter *filter)
             return -1;
         }
     }
+    /* mailbox is in use with another mask */
+    else {
+        DEBUG_PUTS("mask of mailbox differs");
+        res = -1;
+    }
 
     if (mutex_trylock(&_mcp_mutex)) {
         mcp2515_set_mode(dev_mcp, mode);
@@ -522,6 +527,9 @@ static int _set_filter(candev_t *dev, const struct can_filter *filter)
         return -1;
     }
 
+    if (res < 0) {
+        return -1;
+    }
     /* Filter added */
     return 0;
 }
@@ -529,7 +537,7 @@ static int _set_filter(candev_t *dev, const struct can_filter *filter)
 static int _remove_filter(candev_t *dev, const struct can_filter *filter)
 {
     DEBUG("inside _remove_filter of MCP2515\n");
-    bool filter_removed;
+    bool filter_removed = false;
     struct can_filter f = *filter;
     int res = 0;
     enum mcp2515_mode mode;
@@ -602,7 +610,7 @@ static int _remove_filter(candev_t *dev, const struct can_filter *filter)
                     dev_mcp->masks[mailbox_index] = 0;
                 }
 
-                filter_removed = 0;
+                filter_removed = true;
             }
         }
         mailbox_index++;
@@ -616,7 +624,7 @@ static int _remove_filter(candev_t *dev, const struct can_filter *filter)
         return -1;
     }
 
-    return filter_removed;
+    return filter_removed ? 0 : -1;
 }
 
 static void _irq_rx(candev_mcp2515_t *dev, int box)
@@ -26,6 +26,7 @@
 #include <string.h>
 
 #include "bitarithm.h"
+#include "kernel_defines.h"
 #include "mtd.h"
 
 int mtd_init(mtd_dev_t *mtd)
@@ -354,4 +355,114 @@ int mtd_power(mtd_dev_t *mtd, enum mtd_power_state power)
     }
 }
 
+int mtd_flush(mtd_dev_t *mtd)
+{
+    if (!mtd || !mtd->driver) {
+        return -ENODEV;
+    }
+
+    if (mtd->driver->flush) {
+        return mtd->driver->flush(mtd);
+    }
+    return 0;
+}
+
+#ifdef MODULE_MTD_ASYNC
+enum {
+    MTD_ASYNC_READ,
+    MTD_ASYNC_WRITE_RAW,
+    MTD_ASYNC_WRITE,
+    MTD_ASYNC_ERASE,
+};
+
+static void _async_handler(event_t *event)
+{
+    mtd_async_req_t *req = container_of(event, mtd_async_req_t, super);
+    mtd_dev_t *mtd = req->mtd;
+    int res = -EINVAL;
+
+    switch (req->op) {
+    case MTD_ASYNC_READ:
+        res = mtd_read_page(mtd, req->buf, req->page, req->offset, req->count);
+        break;
+    case MTD_ASYNC_WRITE_RAW:
+        res = mtd_write_page_raw(mtd, req->buf, req->page, req->offset,
+                                 req->count);
+        break;
+#ifdef MODULE_MTD_WRITE_PAGE
+    case MTD_ASYNC_WRITE:
+        res = mtd_write_page(mtd, req->buf, req->page, req->offset,
+                             req->count);
+        break;
+#endif
+    case MTD_ASYNC_ERASE:
+        res = mtd_erase_sector(mtd, req->page, req->count);
+        break;
+    }
+    /* allow to resubmit the request from the callback */
+    req->mtd = NULL;
+    req->cb(req, res);
+}
+
+void mtd_async_init(mtd_async_req_t *req, event_queue_t *queue,
+                    mtd_async_cb_t cb, void *arg)
+{
+    assert(queue && cb);
+    memset(req, 0, sizeof(*req));
+    req->super.handler = _async_handler;
+    req->queue = queue;
+    req->cb = cb;
+    req->arg = arg;
+}
+
+static int _async_submit(mtd_async_req_t *req, mtd_dev_t *mtd, uint8_t op,
+                         const void *buf, uint32_t page, uint32_t offset,
+                         uint32_t count)
+{
+    if (!mtd || !mtd->driver) {
+        return -ENODEV;
+    }
+    if (mtd_async_pending(req)) {
+        return -EBUSY;
+    }
+    req->mtd = mtd;
+    req->op = op;
+    req->buf = (void *)buf;
+    req->page = page;
+    req->offset = offset;
+    req->count = count;
+    event_post(req->queue, &req->super);
+    return 0;
+}
+
+int mtd_read_page_async(mtd_async_req_t *req, mtd_dev_t *mtd, void *dest,
+                        uint32_t page, uint32_t offset, uint32_t size)
+{
+    return _async_submit(req, mtd, MTD_ASYNC_READ, dest, page, offset, size);
+}
+
+int mtd_write_page_raw_async(mtd_async_req_t *req, mtd_dev_t *mtd,
+                             const void *src, uint32_t page, uint32_t offset,
+                             uint32_t size)
+{
+    return _async_submit(req, mtd, MTD_ASYNC_WRITE_RAW, src, page, offset,
+                         size);
+}
+
+#ifdef MODULE_MTD_WRITE_PAGE
+int mtd_write_page_async(mtd_async_req_t *req, mtd_dev_t *mtd,
+                         const void *src, uint32_t page, uint32_t offset,
+                         uint32_t size)
+{
+    return _async_submit(req, mtd, MTD_ASYNC_WRITE, src, page, offset, size);
+}
+#endif
+
+int mtd_erase_sector_async(mtd_async_req_t *req, mtd_dev_t *mtd,
+                           uint32_t sector, uint32_t num)
+{
+    return _async_submit(req, mtd, MTD_ASYNC_ERASE, NULL, sector, 0, num);
+}
+#endif /* MODULE_MTD_ASYNC */
+
 /** @} */
@@ -0,0 +1,321 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     drivers_mtd_cache
+ * @{
+ *
+ * @file
+ * @brief       Write-back page cache for MTD devices
+ *
+ * @}
+ */
+
+#include <assert.h>
+#include <errno.h>
+#include <inttypes.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "kernel_defines.h"
+#include "mtd.h"
+#include "mtd_cache.h"
+#include "mutex.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+#ifndef MIN
+#define MIN(a, b) ((a) > (b) ? (b) : (a))
+#endif
+#ifndef MAX
+#define MAX(a, b) ((a) > (b) ? (a) : (b))
+#endif
+
+static_assert(CONFIG_MTD_CACHE_PAGE_SIZE <= UINT16_MAX,
+              "CONFIG_MTD_CACHE_PAGE_SIZE too large");
+
+static uint32_t _pages(const mtd_cache_t *cache)
+{
+    return cache->mtd.sector_count * cache->mtd.pages_per_sector;
+}
+
+static uint8_t *_data(mtd_cache_t *cache, mtd_cache_line_t *line)
+{
+    return cache->data[line - cache->lines];
+}
+
+static mtd_cache_line_t *_lookup(mtd_cache_t *cache, uint32_t page)
+{
+    for (unsigned i = 0; i < ARRAY_SIZE(cache->lines); i++) {
+        mtd_cache_line_t *line = &cache->lines[i];
+
+        if (line->valid && (line->page == page)) {
+            line->used = ++cache->now;
+            return line;
+        }
+    }
+    return NULL;
+}
+
+static int _flush_line(mtd_cache_t *cache, mtd_cache_line_t *line)
+{
+    int res;
+
+    if (line->dirty_end == 0) {
+        return 0;
+    }
+    DEBUG("mtd_cache: write back page %" PRIu32 " [%u, %u)\n", line->page,
+          line->dirty_start, line->dirty_end);
+    res = mtd_write_page_raw(cache->parent,
+                             _data(cache, line) + line->dirty_start,
+                             line->page, line->dirty_start,
+                             line->dirty_end - line->dirty_start);
+    if (res < 0) {
+        return res;
+    }
+    line->dirty_end = 0;
+    return 0;
+}
+
+/* get an unused line, writing back the least recently used one if needed */
+static int _evict(mtd_cache_t *cache, mtd_cache_line_t **res)
+{
+    mtd_cache_line_t *lru = &cache->lines[0];
+
+    for (unsigned i = 0; i < ARRAY_SIZE(cache->lines); i++) {
+        mtd_cache_line_t *line = &cache->lines[i];
+
+        if (!line->valid) {
+            lru = line;
+            break;
+        }
+        /* wrap around safe comparison */
+        if ((int32_t)(line->used - lru->used) < 0) {
+            lru = line;
+        }
+    }
+    if (lru->valid) {
+        int err = _flush_line(cache, lru);
+
+        if (err < 0) {
+            return err;
+        }
+        lru->valid = false;
+    }
+    *res = lru;
+    return 0;
+}
+
+static int _fill(mtd_cache_t *cache, uint32_t page, mtd_cache_line_t **res)
+{
+    mtd_cache_line_t *line;
+    int err;
+
+    if ((err = _evict(cache, &line)) < 0) {
+        return err;
+    }
+    err = mtd_read_page(cache->parent, _data(cache, line), page, 0,
+                        cache->mtd.page_size);
+    if (err < 0) {
+        return err;
+    }
+    line->page = page;
+    line->used = ++cache->now;
+    line->dirty_end = 0;
+    line->valid = true;
+    *res = line;
+    return 0;
+}
+
+static void _read_ahead(mtd_cache_t *cache, uint32_t page)
+{
+    const unsigned ahead = MIN(CONFIG_MTD_CACHE_READ_AHEAD,
+                               ARRAY_SIZE(cache->lines) - 1);
+
+    for (unsigned i = 1; (i <= ahead) && ((page + i) < _pages(cache)); i++) {
+        mtd_cache_line_t *line;
+
+        if (_lookup(cache, page + i)) {
+            continue;
+        }
+        if (_fill(cache, page + i, &line) < 0) {
+            break;
+        }
+    }
+}
+
+static int _init(mtd_dev_t *mtd)
+{
+    mtd_cache_t *cache = container_of(mtd, mtd_cache_t, mtd);
+    mtd_dev_t *parent = cache->parent;
+    int res;
+
+    mutex_lock(&cache->lock);
+    if ((res = mtd_init(parent)) < 0) {
+        goto out;
+    }
+    if (parent->page_size > CONFIG_MTD_CACHE_PAGE_SIZE) {
+        DEBUG("mtd_cache: page size %" PRIu32 " too large\n", parent->page_size);
+        res = -ENOTSUP;
+        goto out;
+    }
+    mtd->sector_count = parent->sector_count;
+    mtd->pages_per_sector = parent->pages_per_sector;
+    mtd->page_size = parent->page_size;
+    mtd->write_size = parent->write_size;
+    memset(cache->lines, 0, sizeof(cache->lines));
+    cache->next_page = UINT32_MAX;
+out:
+    mutex_unlock(&cache->lock);
+    return res;
+}
+
+static int _read_page(mtd_dev_t *mtd, void *dest, uint32_t page,
+                      uint32_t offset, uint32_t count)
+{
+    mtd_cache_t *cache = container_of(mtd, mtd_cache_t, mtd);
+    mtd_cache_line_t *line;
+    int res;
+
+    if ((page >= _pages(cache)) || (offset >= mtd->page_size)) {
+        return -EOVERFLOW;
+    }
+    count = MIN(count, mtd->page_size - offset);
+
+    mutex_lock(&cache->lock);
+    if ((line = _lookup(cache, page)) == NULL) {
+        if ((res = _fill(cache, page, &line)) < 0) {
+            goto out;
+        }
+    }
+    memcpy(dest, _data(cache, line) + offset, count);
+    res = count;
+    if (page == cache->next_page) {
+        _read_ahead(cache, page);
+    }
+    cache->next_page = page + 1;
+out:
+    mutex_unlock(&cache->lock);
+    return res;
+}
+
+static int _write_page(mtd_dev_t *mtd, const void *src, uint32_t page,
+                       uint32_t offset, uint32_t count)
+{
+    mtd_cache_t *cache = container_of(mtd, mtd_cache_t, mtd);
+    mtd_cache_line_t *line;
+    int res;
+
+    if ((page >= _pages(cache)) || (offset >= mtd->page_size)) {
+        return -EOVERFLOW;
+    }
+    count = MIN(count, mtd->page_size - offset);
+
+    mutex_lock(&cache->lock);
+    if ((line = _lookup(cache, page)) == NULL) {
+        if (count == mtd->page_size) {
+            /* the whole page is overwritten, no need to read it */
+            if ((res = _evict(cache, &line)) < 0) {
+                goto out;
+            }
+            line->page = page;
+            line->used = ++cache->now;
+            line->dirty_end = 0;
+            line->valid = true;
+        }
+        else if ((res = _fill(cache, page, &line)) < 0) {
+            goto out;
+        }
+    }
+    /* only keep a single contiguous range of dirty bytes per page, so no
+     * unchanged bytes are rewritten */
+    if ((line->dirty_end != 0) &&
+        ((offset > line->dirty_end) || ((offset + count) < line->dirty_start))) {
+        if ((res = _flush_line(cache, line)) < 0) {
+            goto out;
+        }
+    }
+    memcpy(_data(cache, line) + offset, src, count);
+    if (line->dirty_end == 0) {
+        line->dirty_start = offset;
+        line->dirty_end = offset + count;
+    }
+    else {
+        line->dirty_start = MIN(line->dirty_start, offset);
+        line->dirty_end = MAX(line->dirty_end, offset + count);
+    }
+    res = count;
+out:
+    mutex_unlock(&cache->lock);
+    return res;
+}
+
+static int _erase_sector(mtd_dev_t *mtd, uint32_t sector, uint32_t count)
+{
+    mtd_cache_t *cache = container_of(mtd, mtd_cache_t, mtd);
+    const uint32_t first = sector * mtd->pages_per_sector;
+    const uint32_t last = (sector + count) * mtd->pages_per_sector;
+    int res;
+
+    mutex_lock(&cache->lock);
+    /* pending writes to erased pages are void */
+    for (unsigned i = 0; i < ARRAY_SIZE(cache->lines); i++) {
+        mtd_cache_line_t *line = &cache->lines[i];
+
+        if (line->valid && (line->page >= first) && (line->page < last)) {
+            line->valid = false;
+        }
+    }
+    res = mtd_erase_sector(cache->parent, sector, count);
+    mutex_unlock(&cache->lock);
+    return res;
+}
+
+static int _flush(mtd_dev_t *mtd)
+{
+    mtd_cache_t *cache = container_of(mtd, mtd_cache_t, mtd);
+    int res = 0;
+
+    mutex_lock(&cache->lock);
+    for (unsigned i = 0; i < ARRAY_SIZE(cache->lines); i++) {
+        mtd_cache_line_t *line = &cache->lines[i];
+
+        if (line->valid && ((res = _flush_line(cache, line)) < 0)) {
+            break;
+        }
+    }
+    if (res == 0) {
+        res = mtd_flush(cache->parent);
+    }
+    mutex_unlock(&cache->lock);
+    return res;
+}
+
+static int _power(mtd_dev_t *mtd, enum mtd_power_state power)
+{
+    mtd_cache_t *cache = container_of(mtd, mtd_cache_t, mtd);
+
+    if (power == MTD_POWER_DOWN) {
+        int res = _flush(mtd);
+
+        if (res < 0) {
+            return res;
+        }
+    }
+    return mtd_power(cache->parent, power);
+}
+
+const mtd_desc_t mtd_cache_driver = {
+    .init = _init,
+    .read_page = _read_page,
+    .write_page = _write_page,
+    .erase_sector = _erase_sector,
+    .power = _power,
+    .flush = _flush,
+};
@@ -22,6 +22,7 @@
 #include <string.h>
 #include <errno.h>
 #include <assert.h>
+#include <stdbool.h>
 
 #include "architecture.h"
 #include "cpu.h"
@@ -31,6 +32,78 @@
 
 #define MTD_FLASHPAGE_END_ADDR     ((uint32_t) CPU_FLASH_BASE + (FLASHPAGE_NUMOF * FLASHPAGE_SIZE))
 
+#if IS_USED(MODULE_MTD_FLASHPAGE_BUFFERED)
+static int _flush(mtd_dev_t *dev)
+{
+    mtd_flashpage_t *fp = container_of(dev, mtd_flashpage_t, base);
+
+    if (fp->buf_len) {
+        uword_t dst_addr = fp->buf_addr;
+        flashpage_write((void *)dst_addr, fp->buf, fp->buf_len);
+        fp->buf_len = 0;
+    }
+    return 0;
+}
+
+/* flushes the buffer if it overlaps [addr, addr + size) */
+static void _flush_range(mtd_dev_t *dev, uint32_t addr, uint32_t size)
+{
+    mtd_flashpage_t *fp = container_of(dev, mtd_flashpage_t, base);
+
+    if (fp->buf_len && (addr < fp->buf_addr + fp->buf_len) &&
+        (fp->buf_addr < addr + size)) {
+        _flush(dev);
+    }
+}
+
+static void _write_buffered(mtd_dev_t *dev, const uint8_t *src, uint32_t addr,
+                            uint32_t size)
+{
+    mtd_flashpage_t *fp = container_of(dev, mtd_flashpage_t, base);
+
+    if (fp->buf_len && (addr != fp->buf_addr + fp->buf_len)) {
+        _flush(dev);
+    }
+    while (size) {
+        if (!fp->buf_len && (size >= sizeof(fp->buf))) {
+            /* nothing to combine with */
+            uword_t dst_addr = addr;
+            flashpage_write((void *)dst_addr, src, size);
+            return;
+        }
+        uint32_t len = sizeof(fp->buf) - fp->buf_len;
+        if (len > size) {
+            len = size;
+        }
+        if (!fp->buf_len) {
+            fp->buf_addr = addr;
+        }
+        memcpy(&fp->buf[fp->buf_len], src, len);
+        fp->buf_len += len;
+        if (fp->buf_len == sizeof(fp->buf)) {
+            _flush(dev);
+        }
+        src += len;
+        addr += len;
+        size -= len;
+    }
+}
+#endif
+
+#if CONFIG_MTD_FLASHPAGE_SKIP_ERASED
+static bool _is_erased(uword_t addr, size_t size)
+{
+    const uint8_t *mem = (const void *)addr;
+
+    for (size_t i = 0; i < size; i++) {
+        if (mem[i] != FLASHPAGE_ERASE_STATE) {
+            return false;
+        }
+    }
+    return true;
+}
+#endif
+
 static int _init(mtd_dev_t *dev)
 {
     (void)dev;
@@ -42,14 +115,16 @@ static int _read(mtd_dev_t *dev, void *buf, uint32_t addr, uint32_t size)
 {
     assert(addr < MTD_FLASHPAGE_END_ADDR);
 
-    (void)dev;
-
 #ifndef CPU_HAS_UNALIGNED_ACCESS
     if (addr % sizeof(uword_t)) {
         return -EINVAL;
     }
 #endif
 
+#if IS_USED(MODULE_MTD_FLASHPAGE_BUFFERED)
+    _flush_range(dev, addr, size);
+#endif
+
     uword_t dst_addr = addr;
     memcpy(buf, (void *)dst_addr, size);
 
@@ -58,7 +133,6 @@ static int _read(mtd_dev_t *dev, void *buf, uint32_t addr, uint32_t size)
 
 static int _write(mtd_dev_t *dev, const void *buf, uint32_t addr, uint32_t size)
 {
-    (void)dev;
 
 #ifndef CPU_HAS_UNALIGNED_ACCESS
     if ((uintptr_t)buf % sizeof(uword_t)) {
@@ -75,8 +149,12 @@ static int _write(mtd_dev_t *dev, const void *buf, uint32_t addr, uint32_t size)
         return -EOVERFLOW;
     }
 
+#if IS_USED(MODULE_MTD_FLASHPAGE_BUFFERED)
+    _write_buffered(dev, buf, addr, size);
+#else
     uword_t dst_addr = addr;
     flashpage_write((void *)dst_addr, buf, size);
+#endif
 
     return 0;
 }
@@ -95,9 +173,18 @@ int _erase(mtd_dev_t *dev, uint32_t addr, uint32_t size)
         return -EOVERFLOW;
     }
 
+#if IS_USED(MODULE_MTD_FLASHPAGE_BUFFERED)
+    _flush_range(dev, addr, size);
+#endif
+
     uword_t dst_addr = addr;
 
     for (size_t i = 0; i < size; i += sector_size) {
+#if CONFIG_MTD_FLASHPAGE_SKIP_ERASED
+        if (_is_erased(dst_addr + i, sector_size)) {
+            continue;
+        }
+#endif
         flashpage_erase(flashpage_page((void *)(dst_addr + i)));
     }
 
@@ -109,4 +196,7 @@ const mtd_desc_t mtd_flashpage_driver = {
     .read = _read,
     .write = _write,
     .erase = _erase,
+#if IS_USED(MODULE_MTD_FLASHPAGE_BUFFERED)
+    .flush = _flush,
+#endif
 };
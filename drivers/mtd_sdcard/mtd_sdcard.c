@@ -32,6 +32,12 @@
 
 #define MIN(a, b) ((a) > (b) ? (b) : (a))
 
+/* sdcard_spi transfers at most UINT16_MAX blocks with a single command */
+static uint16_t _nblocks(uint32_t size)
+{
+    return MIN(size / SD_HC_BLOCK_SIZE, UINT16_MAX);
+}
+
 static int mtd_sdcard_init(mtd_dev_t *dev)
 {
     DEBUG("mtd_sdcard_init\n");
@@ -60,7 +66,7 @@ static int mtd_sdcard_read_page(mtd_dev_t *dev, void *buff, uint32_t page,
     DEBUG("mtd_sdcard_read_page: page:%" PRIu32 " offset:%" PRIu32 " size:%" PRIu32 "\n",
           page, offset, size);
 
-    if (offset || size % SD_HC_BLOCK_SIZE) {
+    if (offset || size < SD_HC_BLOCK_SIZE) {
 #if IS_USED(MODULE_MTD_WRITE_PAGE)
         if (dev->work_area == NULL) {
             DEBUG("mtd_sdcard_read_page: no work area\n");
@@ -84,13 +90,15 @@ static int mtd_sdcard_read_page(mtd_dev_t *dev, void *buff, uint32_t page,
 #endif
     }
 
-    sdcard_spi_read_blocks(mtd_sd->sd_card, page,
-                           buff, SD_HC_BLOCK_SIZE,
-                           size / SD_HC_BLOCK_SIZE, &err);
+    /* read all whole blocks with a single multi-block command, a remainder
+       is read by the next call */
+    int nblocks = sdcard_spi_read_blocks(mtd_sd->sd_card, page,
+                                         buff, SD_HC_BLOCK_SIZE,
+                                         _nblocks(size), &err);
     if (err != SD_RW_OK) {
         return -EIO;
     }
-    return size;
+    return nblocks * SD_HC_BLOCK_SIZE;
 }
 
 static int mtd_sdcard_write_page(mtd_dev_t *dev, const void *buff, uint32_t page,
@@ -102,7 +110,7 @@ static int mtd_sdcard_write_page(mtd_dev_t *dev, const void *buff, uint32_t page
     DEBUG("mtd_sdcard_write_page: page:%" PRIu32 " offset:%" PRIu32 " size:%" PRIu32 "\n",
           page, offset, size);
 
-    if (offset || size % SD_HC_BLOCK_SIZE) {
+    if (offset || size < SD_HC_BLOCK_SIZE) {
 #if IS_USED(MODULE_MTD_WRITE_PAGE)
         if (dev->work_area == NULL) {
             DEBUG("mtd_sdcard_write_page: no work area\n");
@@ -127,9 +135,13 @@ static int mtd_sdcard_write_page(mtd_dev_t *dev, const void *buff, uint32_t page
         return -ENOTSUP;
 #endif
     } else {
-        sdcard_spi_write_blocks(mtd_sd->sd_card, page,
-                                buff, SD_HC_BLOCK_SIZE,
-                                size / SD_HC_BLOCK_SIZE, &err);
+        /* write all whole blocks with a single multi-block command, so the
+           card can pre-erase them at once. A remainder is written by the
+           next call */
+        int nblocks = sdcard_spi_write_blocks(mtd_sd->sd_card, page,
+                                              buff, SD_HC_BLOCK_SIZE,
+                                              _nblocks(size), &err);
+        size = nblocks * SD_HC_BLOCK_SIZE;
     }
 
     if (err != SD_RW_OK) {
@@ -188,29 +200,15 @@ static int mtd_sdcard_power(mtd_dev_t *dev, enum mtd_power_state power)
 static int mtd_sdcard_read(mtd_dev_t *dev, void *buff, uint32_t addr,
                            uint32_t size)
 {
-    int res = mtd_sdcard_read_page(dev, buff, addr / SD_HC_BLOCK_SIZE,
-                                   addr % SD_HC_BLOCK_SIZE, size);
-    if (res < 0) {
-        return res;
-    }
-    if (res == (int)size) {
-        return 0;
-    }
-    return -EOVERFLOW;
+    return mtd_read_page(dev, buff, addr / SD_HC_BLOCK_SIZE,
+                         addr % SD_HC_BLOCK_SIZE, size);
 }
 
 static int mtd_sdcard_write(mtd_dev_t *dev, const void *buff, uint32_t addr,
                             uint32_t size)
 {
-    int res =  mtd_sdcard_write_page(dev, buff, addr / SD_HC_BLOCK_SIZE,
-                                     addr % SD_HC_BLOCK_SIZE, size);
-    if (res < 0) {
-        return res;
-    }
-    if (res == (int)size) {
-        return 0;
-    }
-    return -EOVERFLOW;
+    return mtd_write_page_raw(dev, buff, addr / SD_HC_BLOCK_SIZE,
+                              addr % SD_HC_BLOCK_SIZE, size);
 }
 
 const mtd_desc_t mtd_sdcard_driver = {
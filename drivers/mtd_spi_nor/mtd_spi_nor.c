@@ -32,6 +32,7 @@
 #elif IS_USED(MODULE_XTIMER)
 #include "xtimer.h"
 #endif
+#include "mutex.h"
 #include "thread.h"
 #include "byteorder.h"
 #include "mtd_spi_nor.h"
@@ -82,15 +83,18 @@ static inline spi_t _get_spi(const mtd_spi_nor_t *dev)
     return dev->params->spi;
 }
 
-static void mtd_spi_acquire(const mtd_spi_nor_t *dev)
+static void mtd_spi_acquire(mtd_spi_nor_t *dev)
 {
+    /* waiting threads get the device in the order of their priority */
+    mutex_lock(&dev->lock);
     spi_acquire(_get_spi(dev), dev->params->cs,
                 dev->params->mode, dev->params->clk);
 }
 
-static void mtd_spi_release(const mtd_spi_nor_t *dev)
+static void mtd_spi_release(mtd_spi_nor_t *dev)
 {
     spi_release(_get_spi(dev));
+    mutex_unlock(&dev->lock);
 }
 
 static inline uint8_t* _be_addr(const mtd_spi_nor_t *dev, uint32_t *addr)
@@ -106,11 +110,13 @@ static inline uint8_t* _be_addr(const mtd_spi_nor_t *dev, uint32_t *addr)
  * @param[in]  dev    pointer to device descriptor
  * @param[in]  opcode command opcode
  * @param[in]  addr   address (big endian)
+ * @param[in]  dummy  number of dummy bytes between address and data
  * @param[out] dest   read buffer
  * @param[in]  count  number of bytes to read after the address has been sent
  */
 static void mtd_spi_cmd_addr_read(const mtd_spi_nor_t *dev, uint8_t opcode,
-                                  uint32_t addr, void *dest, uint32_t count)
+                                  uint32_t addr, uint8_t dummy, void *dest,
+                                  uint32_t count)
 {
     TRACE("mtd_spi_cmd_addr_read: %p, %02x, (%06"PRIx32"), %p, %" PRIu32 "\n",
           (void *)dev, (unsigned int)opcode, addr, dest, count);
@@ -129,6 +135,9 @@ static void mtd_spi_cmd_addr_read(const mtd_spi_nor_t *dev, uint8_t opcode,
     spi_transfer_byte(_get_spi(dev), dev->params->cs, true, opcode);
     spi_transfer_bytes(_get_spi(dev), dev->params->cs, true,
                        (char *)addr_buf, NULL, dev->addr_width);
+    while (dummy--) {
+        spi_transfer_byte(_get_spi(dev), dev->params->cs, true, 0);
+    }
 
     /* Read data */
     spi_transfer_bytes(_get_spi(dev), dev->params->cs, false,
@@ -410,6 +419,91 @@ static inline void wait_for_write_complete(const mtd_spi_nor_t *dev, uint32_t us
     DEBUG("\n");
 }
 
+static inline bool _is_busy(const mtd_spi_nor_t *dev)
+{
+    uint8_t status;
+
+    mtd_spi_cmd_read(dev, dev->params->opcode->rdsr, &status, sizeof(status));
+    return status & 1;
+}
+
+static void _sleep_us(uint32_t us)
+{
+#if IS_USED(MODULE_ZTIMER_USEC)
+    ztimer_sleep(ZTIMER_USEC, us);
+#elif IS_USED(MODULE_XTIMER)
+    xtimer_usleep(us);
+#else
+    (void)us;
+    thread_yield();
+#endif
+}
+
+/**
+ * @brief   Wait for an erase to complete, letting other threads use the device
+ *
+ * Must be called with the device acquired, returns with the device acquired.
+ * Another thread may take over waiting for the erase in the meantime, which
+ * it signals by clearing @ref mtd_spi_nor_t::erasing.
+ */
+static void _wait_for_erase_complete(mtd_spi_nor_t *dev, uint32_t us)
+{
+    uint32_t div = 1; /* first wait one full interval */
+
+    dev->erasing = true;
+    do {
+        uint32_t wait_us = us / div;
+
+        mtd_spi_release(dev);
+        _sleep_us(wait_us > 2 ? wait_us : 2);
+        mtd_spi_acquire(dev);
+        div++;
+    } while (dev->erasing && _is_busy(dev));
+    dev->erasing = false;
+}
+
+/**
+ * @brief   Wait for an erase started by another thread to complete
+ */
+static void _finish_erase(mtd_spi_nor_t *dev)
+{
+    if (dev->erasing) {
+        wait_for_write_complete(dev, dev->params->wait_sector_erase);
+        dev->erasing = false;
+    }
+}
+
+/**
+ * @brief   Suspend an erase started by another thread, so the array can be read
+ *
+ * Devices without @ref SPI_NOR_F_ERASE_SUSPEND finish the erase instead.
+ *
+ * @return  true if the erase has to be resumed with @ref _resume_erase
+ */
+static bool _suspend_erase(mtd_spi_nor_t *dev)
+{
+    if (!dev->erasing) {
+        return false;
+    }
+    if (!(dev->params->flag & SPI_NOR_F_ERASE_SUSPEND)) {
+        _finish_erase(dev);
+        return false;
+    }
+    DEBUG("mtd_spi_nor: suspend erase\n");
+    mtd_spi_cmd(dev, dev->params->opcode->erase_suspend);
+    /* the device is ready once the erase is suspended */
+    wait_for_write_complete(dev, 0);
+    return true;
+}
+
+static void _resume_erase(mtd_spi_nor_t *dev, bool suspended)
+{
+    if (suspended) {
+        DEBUG("mtd_spi_nor: resume erase\n");
+        mtd_spi_cmd(dev, dev->params->opcode->erase_resume);
+    }
+}
+
 static void _init_pins(mtd_spi_nor_t *dev)
 {
     DEBUG("mtd_spi_nor_init: init pins\n");
@@ -458,6 +552,7 @@ static int mtd_spi_nor_power(mtd_dev_t *mtd, enum mtd_power_state power)
                 retries++;
             } while (res < 0 && retries < MTD_POWER_UP_WAIT_FOR_ID);
             if (res < 0) {
+                mtd_spi_release(dev);
                 return -EIO;
             }
             /* enable 32 bit address mode */
@@ -592,7 +687,7 @@ static int mtd_spi_nor_read(mtd_dev_t *mtd, void *dest, uint32_t addr, uint32_t
 {
     DEBUG("mtd_spi_nor_read: %p, %p, 0x%" PRIx32 ", 0x%" PRIx32 "\n",
           (void *)mtd, dest, addr, size);
-    const mtd_spi_nor_t *dev = (mtd_spi_nor_t *)mtd;
+    mtd_spi_nor_t *dev = (mtd_spi_nor_t *)mtd;
     uint32_t chipsize = mtd->page_size * mtd->pages_per_sector * mtd->sector_count;
 
     if (addr > chipsize) {
@@ -606,7 +701,17 @@ static int mtd_spi_nor_read(mtd_dev_t *mtd, void *dest, uint32_t addr, uint32_t
     }
 
     mtd_spi_acquire(dev);
-    mtd_spi_cmd_addr_read(dev, dev->params->opcode->read, addr, dest, size);
+    bool suspended = _suspend_erase(dev);
+    if (dev->params->flag & SPI_NOR_F_FAST_READ) {
+        /* fast read takes eight dummy clocks, but may be clocked higher */
+        mtd_spi_cmd_addr_read(dev, dev->params->opcode->read_fast, addr, 1,
+                              dest, size);
+    }
+    else {
+        mtd_spi_cmd_addr_read(dev, dev->params->opcode->read, addr, 0,
+                              dest, size);
+    }
+    _resume_erase(dev, suspended);
     mtd_spi_release(dev);
 
     return 0;
@@ -621,7 +726,7 @@ static int mtd_spi_nor_write(mtd_dev_t *mtd, const void *src, uint32_t addr, uin
     if (size == 0) {
         return 0;
     }
-    const mtd_spi_nor_t *dev = (mtd_spi_nor_t *)mtd;
+    mtd_spi_nor_t *dev = (mtd_spi_nor_t *)mtd;
     if (size > mtd->page_size) {
         DEBUG("mtd_spi_nor_write: ERR: page program >1 page (%" PRIu32 ")!\n", mtd->page_size);
         return -EOVERFLOW;
@@ -636,6 +741,7 @@ static int mtd_spi_nor_write(mtd_dev_t *mtd, const void *src, uint32_t addr, uin
     }
 
     mtd_spi_acquire(dev);
+    _finish_erase(dev);
 
     /* write enable */
     mtd_spi_cmd(dev, dev->params->opcode->wren);
@@ -654,7 +760,7 @@ static int mtd_spi_nor_write(mtd_dev_t *mtd, const void *src, uint32_t addr, uin
 static int mtd_spi_nor_write_page(mtd_dev_t *mtd, const void *src, uint32_t page, uint32_t offset,
                                   uint32_t size)
 {
-    const mtd_spi_nor_t *dev = (mtd_spi_nor_t *)mtd;
+    mtd_spi_nor_t *dev = (mtd_spi_nor_t *)mtd;
 
     DEBUG("mtd_spi_nor_write_page: %p, %p, 0x%" PRIx32 ", 0x%" PRIx32 ", 0x%" PRIx32 "\n",
           (void *)mtd, src, page, offset, size);
@@ -665,6 +771,7 @@ static int mtd_spi_nor_write_page(mtd_dev_t *mtd, const void *src, uint32_t page
     uint32_t addr = page * mtd->page_size + offset;
 
     mtd_spi_acquire(dev);
+    _finish_erase(dev);
 
     /* write enable */
     mtd_spi_cmd(dev, dev->params->opcode->wren);
@@ -708,6 +815,8 @@ static int mtd_spi_nor_erase(mtd_dev_t *mtd, uint32_t addr, uint32_t size)
     while (size) {
         uint32_t us;
 
+        _finish_erase(dev);
+
         /* write enable */
         mtd_spi_cmd(dev, dev->params->opcode->wren);
 
@@ -748,8 +857,9 @@ static int mtd_spi_nor_erase(mtd_dev_t *mtd, uint32_t addr, uint32_t size)
             return -EINVAL;
         }
 
-        /* waiting for the command to complete before continuing */
-        wait_for_write_complete(dev, us);
+        /* waiting for the command to complete before continuing, other
+         * threads may read from the device in the meantime */
+        _wait_for_erase_complete(dev, us);
     }
     mtd_spi_release(dev);
 
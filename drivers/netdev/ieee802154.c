@@ -259,6 +259,7 @@ int netdev_ieee802154_set(netdev_ieee802154_t *dev, netopt_t opt, const void *va
             }
             memcpy(dev->sec_ctx.cipher.context.context, value,
                    IEEE802154_SEC_KEY_LENGTH);
+            ieee802154_sec_key_invalidate(&dev->sec_ctx);
             res = IEEE802154_SEC_KEY_LENGTH;
             break;
 #endif /* IS_USED(MODULE_IEEE802154_SECURITY) */
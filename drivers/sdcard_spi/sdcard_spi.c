@@ -771,6 +771,17 @@ static uint16_t _write_blocks(sdcard_spi_t *card, uint8_t cmd_idx,
     uint16_t written = 0;
 
     uint32_t addr = card->use_block_addr ? bladdr : (bladdr * SD_HC_BLOCK_SIZE);
+
+    if (cmd_idx == SD_CMD_25) {
+        /* let the card erase all blocks before the data arrives, so it doesn't
+           have to erase them block by block while writing. This is only a
+           hint, so ignore if the card refuses it */
+        uint8_t acmd_r1_resu = sdcard_spi_send_acmd(card, SD_CMD_23, nbl, 0);
+        if (!R1_VALID(acmd_r1_resu) || R1_ERROR(acmd_r1_resu)) {
+            DEBUG("_write_blocks: send ACMD23: [FAILED] (ignored)\n");
+        }
+    }
+
     uint8_t cmd_r1_resu = sdcard_spi_send_cmd(card, cmd_idx, addr, SD_BLOCK_WRITE_CMD_RETRY_US);
 
     if (R1_VALID(cmd_r1_resu) && !R1_ERROR(cmd_r1_resu)) {
@@ -74,6 +74,36 @@ check_end:
     }
 }
 
+#if IS_USED(MODULE_PERIPH_UART_RX_DMA)
+static void _slip_rx_block_cb(void *arg, const uint8_t *data, size_t len)
+{
+    slipdev_t *dev = arg;
+
+    if (IS_USED(MODULE_SLIPDEV_STDIO)) {
+        /* stdio frames are demultiplexed byte by byte */
+        for (size_t i = 0; i < len; i++) {
+            _slip_rx_cb(dev, data[i]);
+        }
+        return;
+    }
+
+    while (len) {
+        const uint8_t *end = memchr(data, SLIPDEV_END, len);
+        size_t chunk = end ? (size_t)(end - data) + 1 : len;
+
+        dev->state = SLIPDEV_STATE_NET;
+        tsrb_add(&dev->inbuf, data, chunk);
+        if (end) {
+            dev->rx_queued++;
+            netdev_trigger_event_isr(&dev->netdev);
+            dev->state = SLIPDEV_STATE_NONE;
+        }
+        data += chunk;
+        len -= chunk;
+    }
+}
+#endif
+
 static int _init(netdev_t *netdev)
 {
     slipdev_t *dev = (slipdev_t *)netdev;
@@ -88,6 +118,11 @@ static int _init(netdev_t *netdev)
                   dev->config.uart, dev->config.baudrate);
         return -ENODEV;
     }
+#if IS_USED(MODULE_PERIPH_UART_RX_DMA)
+    /* UARTs without a DMA stream keep receiving byte by byte */
+    uart_rx_dma_start(dev->config.uart, dev->rxdma, sizeof(dev->rxdma),
+                      _slip_rx_block_cb, dev);
+#endif
 
     /* signal link UP */
     netdev->event_callback(netdev, NETDEV_EVENT_LINK_UP);
@@ -97,21 +132,39 @@ static int _init(netdev_t *netdev)
 
 void slipdev_write_bytes(uart_t uart, const uint8_t *data, size_t len)
 {
-    for (unsigned j = 0; j < len; j++, data++) {
-        switch (*data) {
-            case SLIPDEV_END:
-                /* escaping END byte*/
-                slipdev_write_byte(uart, SLIPDEV_ESC);
-                slipdev_write_byte(uart, SLIPDEV_END_ESC);
-                break;
-            case SLIPDEV_ESC:
-                /* escaping ESC byte*/
-                slipdev_write_byte(uart, SLIPDEV_ESC);
-                slipdev_write_byte(uart, SLIPDEV_ESC_ESC);
-                break;
-            default:
-                slipdev_write_byte(uart, *data);
+    static const uint8_t esc_end[] = { SLIPDEV_ESC, SLIPDEV_END_ESC };
+    static const uint8_t esc_esc[] = { SLIPDEV_ESC, SLIPDEV_ESC_ESC };
+    const uint8_t *stop = data + len;
+    /* memchr() searches a word at a time, keep the next match of both bytes
+     * so every byte is only searched once */
+    const uint8_t *end = memchr(data, SLIPDEV_END, len);
+    const uint8_t *esc = memchr(data, SLIPDEV_ESC, len);
+
+    while (data < stop) {
+        const uint8_t *next = stop;
+
+        if (end && (end < next)) {
+            next = end;
         }
+        if (esc && (esc < next)) {
+            next = esc;
+        }
+        /* write bytes that need no escaping at once */
+        if (next > data) {
+            uart_write(uart, data, next - data);
+        }
+        if (next == stop) {
+            break;
+        }
+        if (next == end) {
+            uart_write(uart, esc_end, sizeof(esc_end));
+            end = memchr(next + 1, SLIPDEV_END, stop - next - 1);
+        }
+        else {
+            uart_write(uart, esc_esc, sizeof(esc_esc));
+            esc = memchr(next + 1, SLIPDEV_ESC, stop - next - 1);
+        }
+        data = next + 1;
     }
 }
 
@@ -167,6 +220,65 @@ static int _send(netdev_t *netdev, const iolist_t *iolist)
     return bytes;
 }
 
+static void _drop(slipdev_t *dev, size_t len)
+{
+    tsrb_region_t regions[2];
+    size_t n = 0;
+
+    tsrb_peek_region(&dev->inbuf, regions);
+    for (unsigned i = 0; (i < ARRAY_SIZE(regions)) && (n < len); i++) {
+        size_t chunk = regions[i].len;
+        const uint8_t *end;
+
+        if (chunk > (len - n)) {
+            chunk = len - n;
+        }
+        end = memchr(regions[i].buf, SLIPDEV_END, chunk);
+        if (end) {
+            /* end early if end of packet is reached; len might be larger than
+             * the actual packet */
+            n += (end - regions[i].buf) + 1;
+            break;
+        }
+        n += chunk;
+    }
+    tsrb_consume(&dev->inbuf, n);
+}
+
+static int _unstuff(slipdev_t *dev, uint8_t *buf, size_t len)
+{
+    bool escaped = false;
+    size_t res = 0;
+
+    /* decode in place from the ringbuffer instead of locking it per byte */
+    while (1) {
+        tsrb_region_t regions[2];
+        size_t n = 0;
+
+        if (tsrb_peek_region(&dev->inbuf, regions) == 0) {
+            /* something went wrong, return error */
+            return -EIO;
+        }
+        for (unsigned i = 0; i < ARRAY_SIZE(regions); i++) {
+            for (size_t j = 0; j < regions[i].len; j++) {
+                uint8_t byte = regions[i].buf[j];
+                uint8_t overflow;
+
+                n++;
+                if (byte == SLIPDEV_END) {
+                    tsrb_consume(&dev->inbuf, n);
+                    /* the packet was cleared out if it did not fit */
+                    return (res > len) ? -ENOBUFS : (int)res;
+                }
+                res += slipdev_unstuff_readbyte((res < len) ? &buf[res]
+                                                            : &overflow,
+                                                byte, &escaped);
+            }
+        }
+        tsrb_consume(&dev->inbuf, n);
+    }
+}
+
 static int _recv(netdev_t *netdev, void *buf, size_t len, void *info)
 {
     slipdev_t *dev = (slipdev_t *)netdev;
@@ -176,43 +288,16 @@ static int _recv(netdev_t *netdev, void *buf, size_t len, void *info)
     if (buf == NULL) {
         if (len > 0) {
             /* remove data */
-            for (; len > 0; len--) {
-                int byte = tsrb_get_one(&dev->inbuf);
-                if ((byte == (int)SLIPDEV_END) || (byte < 0)) {
-                    /* end early if end of packet or ringbuffer is reached;
-                     * len might be larger than the actual packet */
-                    break;
-                }
-            }
+            _drop(dev, len);
         } else {
             /* the user was warned not to use a buffer size > `INT_MAX` ;-) */
             res = (int)tsrb_avail(&dev->inbuf);
         }
     }
     else {
-        int byte;
-        bool escaped = false;
-        uint8_t *ptr = buf;
-
-        do {
-            int tmp;
-
-            if ((byte = tsrb_get_one(&dev->inbuf)) < 0) {
-                /* something went wrong, return error */
-                return -EIO;
-            }
-            tmp = slipdev_unstuff_readbyte(ptr, byte, &escaped);
-            ptr += tmp;
-            res += tmp;
-            if ((unsigned)res > len) {
-                while (byte != SLIPDEV_END) {
-                    /* clear out unreceived packet */
-                    byte = tsrb_get_one(&dev->inbuf);
-                }
-                return -ENOBUFS;
-            }
-        } while (byte != SLIPDEV_END);
-
+        if ((res = _unstuff(dev, buf, len)) < 0) {
+            return res;
+        }
         if (++dev->rx_done != dev->rx_queued) {
             DEBUG("slipdev: pkt still in queue");
             netdev_trigger_event_isr(&dev->netdev);
@@ -130,12 +130,27 @@ typedef struct {
     bool suspend;                               /**< Suspend status */
 } dwc2_usb_otg_fshs_t;
 
+/**
+ * @brief Double buffering state of an endpoint, see USBOPT_EP_DOUBLE_BUFFER
+ */
+typedef struct {
+    uint8_t *buf;       /**< Buffer of the queued transfer */
+    size_t len;         /**< Length of the queued transfer */
+    size_t done_len;    /**< Bytes received by the last completed OUT transfer */
+    bool enabled;       /**< Double buffering is enabled */
+    bool active;        /**< A transfer is running in the peripheral */
+    bool queued;        /**< A transfer is queued behind the active one */
+} dwc2_usb_otg_fshs_dbuf_t;
+
 /* List of instantiated USB peripherals */
 static dwc2_usb_otg_fshs_t _usbdevs[USBDEV_NUMOF] = { 0 };
 
 static dwc2_usb_otg_fshs_out_ep_t _out[_TOTAL_NUM_ENDPOINTS];
 static usbdev_ep_t _in[_TOTAL_NUM_ENDPOINTS];
 
+static dwc2_usb_otg_fshs_dbuf_t _dbuf_out[_TOTAL_NUM_ENDPOINTS];
+static dwc2_usb_otg_fshs_dbuf_t _dbuf_in[_TOTAL_NUM_ENDPOINTS];
+
 /* Forward declaration for the usb device driver */
 const usbdev_driver_t driver;
 
@@ -1056,6 +1071,15 @@ static void _usbdev_esr(usbdev_t *dev)
     _global_regs(conf)->GAHBCFG |= USB_OTG_GAHBCFG_GINT;
 }
 
+static dwc2_usb_otg_fshs_dbuf_t *_dbuf(usbdev_ep_t *ep)
+{
+    /* endpoints of all peripherals are allocated from the same arrays */
+    if (ep->dir == USB_EP_DIR_IN) {
+        return &_dbuf_in[ep - _in];
+    }
+    return &_dbuf_out[container_of(ep, dwc2_usb_otg_fshs_out_ep_t, ep) - _out];
+}
+
 static void _usbdev_ep_init(usbdev_ep_t *ep)
 {
     DEBUG("usbdev: Initializing EP%u-%s\n", ep->num,
@@ -1065,6 +1089,12 @@ static void _usbdev_ep_init(usbdev_ep_t *ep)
 static size_t _get_available(usbdev_ep_t *ep)
 {
     dwc2_usb_otg_fshs_t *usbdev = (dwc2_usb_otg_fshs_t *)ep->dev;
+
+    if (_dbuf(ep)->enabled) {
+        /* DOEPTSIZ may belong to the next transfer already */
+        return _dbuf(ep)->done_len;
+    }
+
     const dwc2_usb_otg_fshs_config_t *conf = usbdev->config;
 
     return ep->len -
@@ -1116,6 +1146,9 @@ static int _usbdev_ep_set(usbdev_ep_t *ep, usbopt_ep_t opt,
     switch (opt) {
         case USBOPT_EP_ENABLE:
             assert(value_len == sizeof(usbopt_enable_t));
+            /* drop transfers of the previous configuration */
+            _dbuf(ep)->active = false;
+            _dbuf(ep)->queued = false;
             if (*((usbopt_enable_t *)value)) {
                 _ep_activate(ep);
             }
@@ -1129,6 +1162,16 @@ static int _usbdev_ep_set(usbdev_ep_t *ep, usbopt_ep_t opt,
             _ep_set_stall(ep, *(usbopt_enable_t *)value);
             res = sizeof(usbopt_enable_t);
             break;
+        case USBOPT_EP_DOUBLE_BUFFER:
+            assert(value_len == sizeof(usbopt_enable_t));
+            if (ep->num == 0) {
+                break;
+            }
+            _dbuf(ep)->enabled = *(usbopt_enable_t *)value;
+            _dbuf(ep)->active = false;
+            _dbuf(ep)->queued = false;
+            res = sizeof(usbopt_enable_t);
+            break;
         default:
             DEBUG("usbdev: Unhandled endpoint set call: 0x%x\n", opt);
             break;
@@ -1136,7 +1179,7 @@ static int _usbdev_ep_set(usbdev_ep_t *ep, usbopt_ep_t opt,
     return res;
 }
 
-static int _usbdev_ep_xmit(usbdev_ep_t *ep, uint8_t *buf, size_t len)
+static int _ep_start(usbdev_ep_t *ep, uint8_t *buf, size_t len)
 {
     dwc2_usb_otg_fshs_t *usbdev = (dwc2_usb_otg_fshs_t *)ep->dev;
     const dwc2_usb_otg_fshs_config_t *conf = usbdev->config;
@@ -1222,6 +1265,54 @@ static int _usbdev_ep_xmit(usbdev_ep_t *ep, uint8_t *buf, size_t len)
     return 0;
 }
 
+static int _usbdev_ep_xmit(usbdev_ep_t *ep, uint8_t *buf, size_t len)
+{
+    dwc2_usb_otg_fshs_dbuf_t *dbuf = _dbuf(ep);
+
+    /* Completions are handled in _usbdev_ep_esr(), which runs in the same
+     * thread context as the callers of this function */
+    if (dbuf->enabled) {
+        if (dbuf->active) {
+            if (dbuf->queued) {
+                return -EBUSY;
+            }
+            dbuf->buf = buf;
+            dbuf->len = len;
+            dbuf->queued = true;
+            return 0;
+        }
+        dbuf->active = true;
+    }
+
+    int res = _ep_start(ep, buf, len);
+    if (res < 0) {
+        dbuf->active = false;
+    }
+    return res;
+}
+
+/* Signals a completed transfer to the upper layer. With double buffering the
+ * queued transfer is started first, so that the peripheral doesn't idle while
+ * the upper layer handles the event */
+static void _ep_complete(dwc2_usb_otg_fshs_t *usbdev, usbdev_ep_t *ep)
+{
+    dwc2_usb_otg_fshs_dbuf_t *dbuf = _dbuf(ep);
+
+    if (dbuf->enabled && dbuf->active) {
+        if (ep->dir == USB_EP_DIR_OUT) {
+            const dwc2_usb_otg_fshs_config_t *conf = usbdev->config;
+            dbuf->done_len = ep->len - (_out_regs(conf, ep->num)->DOEPTSIZ &
+                                        USB_OTG_DOEPTSIZ_XFRSIZ_Msk);
+        }
+        dbuf->active = false;
+        if (dbuf->queued) {
+            dbuf->queued = false;
+            dbuf->active = (_ep_start(ep, dbuf->buf, dbuf->len) == 0);
+        }
+    }
+    usbdev->usbdev.epcb(ep, USBDEV_EVENT_TR_COMPLETE);
+}
+
 static void _copy_rxfifo(dwc2_usb_otg_fshs_t *usbdev, uint8_t *buf, size_t len)
 {
     /* The FIFO requires 32 bit word reads/writes. This is only called with
@@ -1265,7 +1356,7 @@ static void _read_packet(dwc2_usb_otg_fshs_out_ep_t *st_ep)
      * status is skipped */
     else if (pkt_status == DWC2_PKTSTS_XFER_COMP ||
              pkt_status == DWC2_PKTSTS_SETUP_COMP) {
-        usbdev->usbdev.epcb(&st_ep->ep, USBDEV_EVENT_TR_COMPLETE);
+        _ep_complete(usbdev, &st_ep->ep);
     }
 }
 
@@ -1285,14 +1376,14 @@ static void _usbdev_ep_esr(usbdev_ep_t *ep)
         if (status & USB_OTG_DIEPINT_XFRC && _uses_dma(conf)) {
             _in_regs(conf, ep->num)->DIEPINT = USB_OTG_DIEPINT_XFRC;
             if (ep->num != 0) {
-                usbdev->usbdev.epcb(ep, USBDEV_EVENT_TR_COMPLETE);
+                _ep_complete(usbdev, ep);
             }
         }
         else
         /* TXFE empty interrupt is only used with DMA disabled */
         if (status & USB_OTG_DIEPINT_TXFE) {
             _device_regs(conf)->DIEPEMPMSK &= ~(1 << ep->num);
-            usbdev->usbdev.epcb(ep, USBDEV_EVENT_TR_COMPLETE);
+            _ep_complete(usbdev, ep);
         }
     }
     else {
@@ -1306,7 +1397,7 @@ static void _usbdev_ep_esr(usbdev_ep_t *ep)
         else if (_out_regs(conf, ep->num)->DOEPINT & USB_OTG_DOEPINT_XFRC) {
             _out_regs(conf, ep->num)->DOEPINT = USB_OTG_DOEPINT_XFRC;
             if (_uses_dma(conf)) {
-                usbdev->usbdev.epcb(ep, USBDEV_EVENT_TR_COMPLETE);
+                _ep_complete(usbdev, ep);
             }
         }
     }
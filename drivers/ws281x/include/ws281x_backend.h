@@ -41,6 +41,28 @@ extern "C" {
 #endif
 /** @} */
 
+/**
+ * @name    Properties of the SPI backend.
+ * @{
+ */
+#ifdef MODULE_WS281X_SPI
+#define WS281X_HAVE_INIT                    (1)
+#define WS281X_HAVE_PREPARE_TRANSMISSION    (1)
+#define WS281X_HAVE_END_TRANSMISSION        (1)
+#endif
+/**
+ * @brief   Number of SPI bytes encoding one data byte
+ */
+#define WS281X_SPI_BYTES_PER_BYTE           (3U)
+/**
+ * @brief   Number of zero bytes sent at the end of a frame
+ *
+ * This keeps the data line low for at least @ref WS281X_T_END_US at up to
+ * 3.2 MHz SPI clock.
+ */
+#define WS281X_SPI_RESET_BYTES              (32U)
+/** @} */
+
 /**
  * @name    Properties of the VT100 terminal backend.
  * @{
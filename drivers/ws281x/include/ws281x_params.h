@@ -44,6 +44,37 @@ extern uint8_t ws281x_buf[WS281X_PARAM_NUMOF * WS281X_BYTES_PER_DEVICE];
 #define WS281X_PARAM_BUF                (ws281x_buf)  /**< Data buffer holding LED states */
 #endif
 
+#if defined(MODULE_WS281X_SPI) || defined(DOXYGEN)
+#ifndef WS281X_PARAM_SPI
+#define WS281X_PARAM_SPI                (SPI_DEV(0))    /**< SPI bus driving the LEDs */
+#endif
+#ifndef WS281X_PARAM_SPI_CLK
+#define WS281X_PARAM_SPI_CLK            (3000000U)      /**< SPI clock */
+#endif
+#ifndef WS281X_PARAM_SPI_BUF_SIZE
+/**
+ * @brief   Size of each SPI buffer
+ */
+#define WS281X_PARAM_SPI_BUF_SIZE       WS281X_SPI_BUF_SIZE(WS281X_PARAM_NUMOF)
+#endif
+#ifndef WS281X_PARAM_SPI_BUF
+/**
+ * @brief   Buffers for the encoded frames
+ */
+extern uint8_t ws281x_spi_buf[2][WS281X_PARAM_SPI_BUF_SIZE];
+#define WS281X_PARAM_SPI_BUF            { ws281x_spi_buf[0], ws281x_spi_buf[1] } /**< SPI buffers */
+#endif
+/**
+ * @brief   SPI backend parameters
+ */
+#define WS281X_PARAMS_SPI               .spi = WS281X_PARAM_SPI, \
+                                        .spi_clk = WS281X_PARAM_SPI_CLK, \
+                                        .spi_buf = WS281X_PARAM_SPI_BUF, \
+                                        .spi_buf_size = WS281X_PARAM_SPI_BUF_SIZE,
+#else
+#define WS281X_PARAMS_SPI
+#endif
+
 #ifndef WS281X_PARAMS
 /**
  * @brief   WS281x initialization parameters
@@ -52,6 +83,7 @@ extern uint8_t ws281x_buf[WS281X_PARAM_NUMOF * WS281X_BYTES_PER_DEVICE];
                                             .pin = WS281X_PARAM_PIN,  \
                                             .numof = WS281X_PARAM_NUMOF, \
                                             .buf = WS281X_PARAM_BUF, \
+                                            WS281X_PARAMS_SPI \
                                         }
 #endif
 /**@}*/
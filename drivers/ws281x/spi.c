@@ -0,0 +1,153 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     drivers_ws281x
+ *
+ * @{
+ *
+ * @file
+ * @brief       Implementation of `ws281x_write_buffer()` using SPI
+ *
+ * Every data bit is encoded into three SPI bits, the encoded frames are sent
+ * in the background with asynchronous SPI transfers.
+ *
+ * @}
+ */
+#include <assert.h>
+#include <errno.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "ws281x.h"
+#include "ws281x_params.h"
+#include "ws281x_constants.h"
+#include "periph/spi.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+/* Default buffers used in ws281x_params.h. Will be optimized out if unused */
+uint8_t ws281x_spi_buf[2][WS281X_PARAM_SPI_BUF_SIZE];
+
+static unsigned _numof_bufs(const ws281x_t *dev)
+{
+    return dev->params.spi_buf[1] ? 2 : 1;
+}
+
+static void _xfer_done(void *arg)
+{
+    ws281x_t *dev = arg;
+    /* transfers complete in the order they were queued */
+    unsigned idx = dev->sending;
+    bool last = dev->last[idx];
+
+    dev->sending = (idx + 1) % _numof_bufs(dev);
+    mutex_unlock(&dev->lock[idx]);
+    if (last) {
+        spi_release(dev->params.spi);
+    }
+}
+
+static void _submit(ws281x_t *dev, bool last)
+{
+    unsigned idx = dev->cur;
+    spi_async_xfer_t *xfer = &dev->xfer[idx];
+
+    if (!dev->acquired) {
+        spi_acquire(dev->params.spi, SPI_CS_UNDEF, SPI_MODE_0,
+                    dev->params.spi_clk);
+        dev->acquired = true;
+    }
+
+    xfer->out = dev->params.spi_buf[idx];
+    xfer->in = NULL;
+    xfer->len = dev->pos;
+    xfer->cs = SPI_CS_UNDEF;
+    xfer->cont = false;
+    xfer->cb = _xfer_done;
+    xfer->arg = dev;
+    dev->last[idx] = last;
+
+    DEBUG("[ws281x] spi: sending %u bytes from buffer %u\n",
+          (unsigned)dev->pos, idx);
+    spi_transfer_bytes_async(dev->params.spi, xfer);
+
+    dev->cur = (idx + 1) % _numof_bufs(dev);
+    dev->pos = 0;
+    if (!last) {
+        /* wait for the transfer of the next buffer to complete */
+        mutex_lock(&dev->lock[dev->cur]);
+    }
+}
+
+void ws281x_write_buffer(ws281x_t *dev, const void *buf, size_t size)
+{
+    assert(dev);
+    const uint8_t *pos = buf;
+    const uint8_t *end = pos + size;
+
+    while (pos < end) {
+        if (dev->pos + WS281X_SPI_BYTES_PER_BYTE > dev->params.spi_buf_size) {
+            _submit(dev, false);
+        }
+
+        /* a zero is sent as 0b100, a one as 0b110 */
+        uint32_t sym = 0;
+        for (uint8_t mask = 0x80; mask; mask >>= 1) {
+            sym = (sym << 3) | ((*pos & mask) ? 0x6 : 0x4);
+        }
+
+        uint8_t *out = dev->params.spi_buf[dev->cur] + dev->pos;
+        out[0] = sym >> 16;
+        out[1] = sym >> 8;
+        out[2] = sym;
+        dev->pos += WS281X_SPI_BYTES_PER_BYTE;
+        pos++;
+    }
+}
+
+void ws281x_prepare_transmission(ws281x_t *dev)
+{
+    assert(dev);
+
+    /* waits for the buffer to be sent if it is still in use */
+    mutex_lock(&dev->lock[dev->cur]);
+    dev->pos = 0;
+    dev->acquired = false;
+}
+
+void ws281x_end_transmission(ws281x_t *dev)
+{
+    assert(dev);
+
+    /* keep the data line low to latch the data */
+    for (unsigned i = 0; i < WS281X_SPI_RESET_BYTES; i++) {
+        if (dev->pos == dev->params.spi_buf_size) {
+            _submit(dev, false);
+        }
+        dev->params.spi_buf[dev->cur][dev->pos++] = 0;
+    }
+
+    _submit(dev, true);
+}
+
+int ws281x_init(ws281x_t *dev, const ws281x_params_t *params)
+{
+    if (!dev || !params || !params->buf || !params->spi_buf[0] ||
+        (params->spi_buf_size < WS281X_SPI_BYTES_PER_BYTE)) {
+        return -EINVAL;
+    }
+
+    memset(dev, 0, sizeof(ws281x_t));
+    dev->params = *params;
+    mutex_init(&dev->lock[0]);
+    mutex_init(&dev->lock[1]);
+
+    return 0;
+}
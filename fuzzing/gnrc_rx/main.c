@@ -0,0 +1,226 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/*
+ * Feeds IEEE 802.15.4 frames through the complete GNRC receive path
+ * (gnrc_netif -> 6LoWPAN -> IPv6 -> UDP -> gcoap) and records the processing
+ * time and the packet buffer high-water mark of every input.
+ *
+ * An input is a sequence of frames, each preceded by a single length byte, so
+ * a single input can e.g. contain all fragments of a datagram.
+ */
+
+#include <err.h>
+#include <errno.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "sched.h"
+#include "thread.h"
+
+#include "net/gnrc/netif/ieee802154.h"
+#include "net/gnrc/pktbuf.h"
+#include "net/ieee802154.h"
+#include "net/netdev_test.h"
+
+/* maximum input size, enough for a datagram of the maximum size fragmented
+ * into 127 byte frames */
+#define INPUT_MAX       (4096U)
+
+/* all GNRC threads must have a higher priority than the main thread, so
+ * processing of a frame is done once the main thread runs again */
+#define MAIN_PRIO       (THREAD_PRIORITY_IDLE - 1)
+
+static const uint8_t _l2addr[] = { 0x02, 0x00, 0x00, 0x00,
+                                   0x00, 0x00, 0x00, 0x01 };
+
+static netdev_test_t _dev;
+static gnrc_netif_t _netif;
+static char _netif_stack[THREAD_STACKSIZE_DEFAULT];
+
+static uint8_t _input[INPUT_MAX];
+static const uint8_t *_frame;
+static size_t _frame_len;
+
+static uint64_t _now_ns(void)
+{
+    struct timespec ts;
+
+    /* all RIOT threads run in the same host thread, its CPU time does not
+     * include time other processes (e.g. parallel fuzzers) spent */
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000LLU + ts.tv_nsec;
+}
+
+static uint64_t _cycles(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+    return __builtin_ia32_rdtsc();
+#else
+    return 0;
+#endif
+}
+
+static uint64_t _getenv_limit(const char *name)
+{
+    const char *val = getenv(name);
+
+    return (val == NULL) ? UINT64_MAX : strtoull(val, NULL, 0);
+}
+
+static int _get_device_type(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    (void)max_len;
+    *((uint16_t *)value) = NETDEV_TYPE_IEEE802154;
+    return sizeof(uint16_t);
+}
+
+static int _get_proto(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    (void)max_len;
+    *((gnrc_nettype_t *)value) = GNRC_NETTYPE_SIXLOWPAN;
+    return sizeof(gnrc_nettype_t);
+}
+
+static int _get_max_pdu_size(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    (void)max_len;
+    *((uint16_t *)value) = IEEE802154_FRAME_LEN_MAX - IEEE802154_FCS_LEN;
+    return sizeof(uint16_t);
+}
+
+static int _get_src_len(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    (void)max_len;
+    *((uint16_t *)value) = sizeof(_l2addr);
+    return sizeof(uint16_t);
+}
+
+static int _get_address_long(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    if (max_len < sizeof(_l2addr)) {
+        return -EOVERFLOW;
+    }
+    memcpy(value, _l2addr, sizeof(_l2addr));
+    return sizeof(_l2addr);
+}
+
+static int _send(netdev_t *dev, const iolist_t *iolist)
+{
+    (void)dev;
+    /* responses are dropped, but still count into the processing time */
+    return iolist_size(iolist);
+}
+
+static int _recv(netdev_t *dev, char *buf, int len, void *info)
+{
+    (void)dev;
+
+    if (info != NULL) {
+        memset(info, 0, sizeof(netdev_ieee802154_rx_info_t));
+    }
+    if (buf == NULL) {
+        return (len == 0) ? (int)_frame_len : 0;
+    }
+    if ((size_t)len > _frame_len) {
+        len = _frame_len;
+    }
+    memcpy(buf, _frame, len);
+    _frame_len = 0;
+    return len;
+}
+
+static void _isr(netdev_t *dev)
+{
+    dev->event_callback(dev, NETDEV_EVENT_RX_COMPLETE);
+}
+
+static void _init_netif(void)
+{
+    netdev_test_setup(&_dev, NULL);
+    netdev_test_set_get_cb(&_dev, NETOPT_DEVICE_TYPE, _get_device_type);
+    netdev_test_set_get_cb(&_dev, NETOPT_PROTO, _get_proto);
+    netdev_test_set_get_cb(&_dev, NETOPT_MAX_PDU_SIZE, _get_max_pdu_size);
+    netdev_test_set_get_cb(&_dev, NETOPT_SRC_LEN, _get_src_len);
+    netdev_test_set_get_cb(&_dev, NETOPT_ADDRESS_LONG, _get_address_long);
+    netdev_test_set_send_cb(&_dev, _send);
+    netdev_test_set_recv_cb(&_dev, _recv);
+    netdev_test_set_isr_cb(&_dev, _isr);
+
+    if (gnrc_netif_ieee802154_create(&_netif, _netif_stack,
+                                     sizeof(_netif_stack), GNRC_NETIF_PRIO,
+                                     "fuzzing_wpan", &_dev.netdev.netdev)) {
+        errx(EXIT_FAILURE, "gnrc_netif_ieee802154_create failed");
+    }
+}
+
+static size_t _read_input(void)
+{
+    size_t len = 0;
+    ssize_t r;
+
+    while ((len < sizeof(_input)) &&
+           ((r = read(STDIN_FILENO, &_input[len], sizeof(_input) - len)) > 0)) {
+        len += r;
+    }
+    return len;
+}
+
+int main(void)
+{
+    netdev_t *dev = &_dev.netdev.netdev;
+    uint64_t max_ns = _getenv_limit("FUZZING_MAX_NS");
+    uint64_t max_pktbuf = _getenv_limit("FUZZING_MAX_PKTBUF");
+    uint64_t start_ns, start_cycles, time_ns = 0, cycles = 0;
+    unsigned frames = 0;
+    size_t len, pos = 0;
+
+    _init_netif();
+    sched_change_priority(thread_get_active(), MAIN_PRIO);
+
+    len = _read_input();
+    gnrc_pktbuf_reset_high_water_mark();
+    while (pos < len) {
+        _frame_len = _input[pos++];
+        if (_frame_len > len - pos) {
+            _frame_len = len - pos;
+        }
+        _frame = &_input[pos];
+        pos += _frame_len;
+        frames++;
+
+        start_ns = _now_ns();
+        start_cycles = _cycles();
+        /* returns once all higher priority threads are done */
+        dev->event_callback(dev, NETDEV_EVENT_ISR);
+        cycles += _cycles() - start_cycles;
+        time_ns += _now_ns() - start_ns;
+    }
+
+    size_t pktbuf_peak = gnrc_pktbuf_get_high_water_mark();
+    printf("fuzzing_perf: frames %u bytes %u time_ns %llu cycles %llu "
+           "pktbuf_peak %u\n", frames, (unsigned)len,
+           (unsigned long long)time_ns, (unsigned long long)cycles,
+           (unsigned)pktbuf_peak);
+
+    /* report inputs exceeding the budget as crash, so AFL keeps them */
+    if ((time_ns > max_ns) || (pktbuf_peak > max_pktbuf)) {
+        fflush(stdout);
+        abort();
+    }
+    exit(EXIT_SUCCESS);
+}
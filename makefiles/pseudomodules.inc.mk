@@ -39,17 +39,34 @@ PSEUDOMODULES += can_raw
 PSEUDOMODULES += ccn-lite-utils
 PSEUDOMODULES += cc2538_rf_obs_sig
 PSEUDOMODULES += conn_can_isotp_multi
+## @defgroup    pseudomodule_constfs_heatshrink constfs_heatshrink
+## @brief       Decompress heatshrink compressed ConstFS files while reading
+##
+## See @ref sys_fs_constfs for details.
+PSEUDOMODULES += constfs_heatshrink
 PSEUDOMODULES += cord_ep_standalone
 PSEUDOMODULES += core_%
 PSEUDOMODULES += cortexm_fpu
 PSEUDOMODULES += cortexm_svc
 PSEUDOMODULES += cpp
+## @defgroup    pseudomodule_cpp_new_delete_pool cpp_new_delete_pool
+## @brief       Serve small C++ allocations from size-class pools
+##
+## See @ref sys_cpp_new_delete for details.
+PSEUDOMODULES += cpp_new_delete_pool
 PSEUDOMODULES += cpu_check_address
 PSEUDOMODULES += crc16_fast
 PSEUDOMODULES += crc32_fast
+PSEUDOMODULES += crc32_slice_by_4
+PSEUDOMODULES += crc32_slice_by_8
 PSEUDOMODULES += credman_load
 PSEUDOMODULES += dbgpin
 PSEUDOMODULES += devfs_%
+## @addtogroup drivers_disp_dev
+## @{
+## Use the asynchronous map of display drivers, e.g. by SPI DMA
+PSEUDOMODULES += disp_dev_async
+## @}
 PSEUDOMODULES += dhcpv6_%
 PSEUDOMODULES += dhcpv6_client_dns
 PSEUDOMODULES += dhcpv6_client_ia_pd
@@ -57,6 +74,8 @@ PSEUDOMODULES += dhcpv6_client_ia_na
 PSEUDOMODULES += dhcpv6_client_mud_url
 PSEUDOMODULES += dhcpv6_relay
 PSEUDOMODULES += dns_cache
+PSEUDOMODULES += dns_cache_prefetch
+PSEUDOMODULES += dns_cache_vfs
 PSEUDOMODULES += dns_msg
 PSEUDOMODULES += ecc_%
 PSEUDOMODULES += ethos_stdio
@@ -72,6 +91,7 @@ PSEUDOMODULES += event_timeout
 PSEUDOMODULES += event_timeout_ztimer
 PSEUDOMODULES += evtimer_mbox
 PSEUDOMODULES += evtimer_on_ztimer
+PSEUDOMODULES += evtimer_wheel
 PSEUDOMODULES += fatfs_vfs_format
 PSEUDOMODULES += fmt_%
 PSEUDOMODULES += gcoap_forward_proxy
@@ -79,6 +99,10 @@ PSEUDOMODULES += gcoap_fileserver
 PSEUDOMODULES += gcoap_fileserver_delete
 PSEUDOMODULES += gcoap_fileserver_put
 PSEUDOMODULES += gcoap_dtls
+PSEUDOMODULES += gcoap_index
+PSEUDOMODULES += gcoap_workers
+PSEUDOMODULES += gcoap_congure
+PSEUDOMODULES += gcoap_congure_reno
 ## @addtogroup net_gcoap_dns
 ## @{
 ## Enable @ref net_gcoap_dns
@@ -116,6 +140,18 @@ PSEUDOMODULES += gnrc_ipv6_nib_rio
 PSEUDOMODULES += gnrc_ipv6_nib_router
 PSEUDOMODULES += gnrc_ipv6_nib_rtr_adv_pio_cb
 PSEUDOMODULES += gnrc_lorawan_1_1
+## @defgroup net_gnrc_lwmac_adaptive  gnrc_lwmac_adaptive
+## @ingroup net_gnrc_lwmac
+## @brief   Traffic adaptive wake-ups for @ref net_gnrc_lwmac
+##
+## A receiver that got more than one packet per wake-up in the last cycle
+## doubles its wake-ups, up to 2^@ref CONFIG_GNRC_LWMAC_ADAPTIVE_MAX_EXP per
+## cycle. It halves them again once it got less than one packet per two
+## wake-ups. The first wake-up of a cycle stays at the phase senders locked
+## to, so senders without this module still reach the node. The number of
+## wake-ups is appended to the WA, senders with this module use it to wait
+## for the nearest wake-up instead of the next cycle.
+PSEUDOMODULES += gnrc_lwmac_adaptive
 ## @defgroup net_gnrc_netdev_default  gnrc_netdev_default
 ## @ingroup net_gnrc_netif
 ## @{
@@ -126,6 +162,7 @@ PSEUDOMODULES += gnrc_netdev_default
 PSEUDOMODULES += gnrc_neterr
 PSEUDOMODULES += gnrc_netapi_callbacks
 PSEUDOMODULES += gnrc_netapi_mbox
+PSEUDOMODULES += gnrc_netapi_steering
 PSEUDOMODULES += gnrc_netif_bus
 PSEUDOMODULES += gnrc_netif_timestamp
 ## @defgroup net_gnrc_pktbuf_cmd  gnrc_pktbuf_cmd
@@ -135,9 +172,60 @@ PSEUDOMODULES += gnrc_netif_timestamp
 ##              will be removed after 2023.07 release.
 PSEUDOMODULES += gnrc_pktbuf_cmd
 ## @}
+## @defgroup net_gnrc_pktbuf_cow  gnrc_pktbuf_cow
+## @ingroup net_gnrc_pktbuf
+## @brief   Share the data of packet snips when only their headers change
+##
+## See @ref gnrc_pktbuf_start_write_desc(). Requires `gnrc_pktbuf_ext`.
+PSEUDOMODULES += gnrc_pktbuf_cow
+## @defgroup net_gnrc_pktbuf_ext  gnrc_pktbuf_ext
+## @ingroup net_gnrc_pktbuf
+## @brief   Allow packet snips to reference external (e.g. DMA) buffers
+##
+## See @ref gnrc_pktbuf_add_ext(). Requires `gnrc_pktbuf_static`.
+PSEUDOMODULES += gnrc_pktbuf_ext
+## @defgroup net_gnrc_pktbuf_static_segfit  gnrc_pktbuf_static_segfit
+## @ingroup net_gnrc_pktbuf
+## @brief   Segregated-fit allocator for `gnrc_pktbuf_static`
+##
+## Keeps free space of the static packet buffer in power-of-two size class
+## lists instead of a single first-fit list. Allocating and freeing become
+## O(1) and large holes are not broken up by small allocations as easily,
+## which helps with sustained fragmented (e.g. 6LoWPAN) traffic.
+PSEUDOMODULES += gnrc_pktbuf_static_segfit
+## @defgroup net_gnrc_pktbuf_static_trace  gnrc_pktbuf_static_trace
+## @ingroup net_gnrc_pktbuf
+## @brief   Trace allocations of `gnrc_pktbuf_static` on stdio
+##
+## Prints a line with time, thread and position for every allocation, failed
+## allocation, reallocation and free of the static packet buffer.
+## `dist/tools/pktbuf-stats/pktbuf-trace.py` shows the fragmentation over time
+## and long living allocations from it. A fast stdio such as `stdio_rtt` is
+## recommended, stdio must not use GNRC itself.
+PSEUDOMODULES += gnrc_pktbuf_static_trace
 PSEUDOMODULES += gnrc_netif_6lo
 PSEUDOMODULES += gnrc_netif_ipv6
 PSEUDOMODULES += gnrc_netif_mac
+## @defgroup net_gnrc_netif_pktq_fq  gnrc_netif_pktq_fq
+## @ingroup net_gnrc_netif_pktq
+## @brief   Flow queueing with CoDel for @ref net_gnrc_netif_pktq
+##
+## ICMPv6 packets, and with them NDP and RPL, are sent before all others.
+## The other packets are hashed into @ref CONFIG_GNRC_NETIF_PKTQ_FQ_FLOWS
+## flows per interface, which are served by deficit round robin. Each flow
+## drops packets with CoDel (RFC 8289) when they are queued for longer than
+## @ref CONFIG_GNRC_NETIF_PKTQ_CODEL_TARGET_MS. When the pool is depleted, the
+## longest flow of the interface loses its oldest packet.
+PSEUDOMODULES += gnrc_netif_pktq_fq
+## @defgroup net_gnrc_netif_rx_offload  gnrc_netif_rx_offload
+## @ingroup net_gnrc_netif
+## @brief   Dispatch received packets from an event queue
+##
+## The interface thread hands received packets to an event handler thread
+## selected per interface (see gnrc_netif_set_rx_queue()), and
+## @ref net_gnrc_ipv6 processes them directly in that thread instead of
+## receiving them via its message queue.
+PSEUDOMODULES += gnrc_netif_rx_offload
 PSEUDOMODULES += gnrc_netif_single
 ## @defgroup net_gnrc_netif_cmd_lora  gnrc_netif_cmd_lora
 ## @ingroup sys_shell_commands
@@ -148,6 +236,14 @@ PSEUDOMODULES += gnrc_netif_single
 PSEUDOMODULES += gnrc_netif_cmd_lora
 ## @}
 PSEUDOMODULES += gnrc_netif_dedup
+## @defgroup net_gnrc_netreg_hash  gnrc_netreg_hash
+## @ingroup net_gnrc_netreg
+## @brief   Hash the registry by demultiplexing context
+##
+## Splits each type's list of @ref net_gnrc_netreg entries into
+## 2^@ref CONFIG_GNRC_NETREG_HASH_BUCKETS_EXP buckets, so lookups don't scan
+## all registrations of the type anymore.
+PSEUDOMODULES += gnrc_netreg_hash
 
 
 ## @addtogroup 	net_gnrc_nettype
@@ -221,15 +317,26 @@ PSEUDOMODULES += gnrc_nettype_udp
 ## @}
 
 
+## @defgroup net_gnrc_rpl_srh_routes_mod  gnrc_rpl_srh_routes
+## @ingroup net_gnrc_rpl_srh
+## @brief   Keep the DAO parents of a non-storing mode DODAG in a compact
+##          source route store
+##
+## See @ref net_gnrc_rpl_srh_routes.
+PSEUDOMODULES += gnrc_rpl_srh_routes
 PSEUDOMODULES += gnrc_sixloenc
 PSEUDOMODULES += gnrc_sixlowpan_border_router_default
 PSEUDOMODULES += gnrc_sixlowpan_default
 PSEUDOMODULES += gnrc_sixlowpan_frag_hint
+PSEUDOMODULES += gnrc_sixlowpan_frag_sfr_congure
+PSEUDOMODULES += gnrc_sixlowpan_frag_sfr_congure_quic
+PSEUDOMODULES += gnrc_sixlowpan_frag_sfr_congure_reno
 PSEUDOMODULES += gnrc_sixlowpan_frag_sfr_ecn
 PSEUDOMODULES += gnrc_sixlowpan_frag_sfr_ecn_if_in
 PSEUDOMODULES += gnrc_sixlowpan_frag_sfr_ecn_if_out
 PSEUDOMODULES += gnrc_sixlowpan_frag_sfr_ecn_fqueue
 PSEUDOMODULES += gnrc_sixlowpan_frag_sfr_stats
+PSEUDOMODULES += gnrc_sixlowpan_iphc_cache
 PSEUDOMODULES += gnrc_sixlowpan_iphc_nhc
 PSEUDOMODULES += gnrc_sixlowpan_nd_border_router
 PSEUDOMODULES += gnrc_sixlowpan_router_default
@@ -241,7 +348,11 @@ PSEUDOMODULES += gnrc_sixlowpan_router_default
 PSEUDOMODULES += gnrc_udp_cmd
 ## @}
 PSEUDOMODULES += gnrc_sock_async
+PSEUDOMODULES += gnrc_sock_async_only
+PSEUDOMODULES += gnrc_sock_pktqueue
 PSEUDOMODULES += gnrc_sock_check_reuse
+PSEUDOMODULES += gnrc_tcp_congure
+PSEUDOMODULES += gnrc_tcp_congure_reno
 PSEUDOMODULES += gnrc_txtsnd
 ## @defgroup pseudomodule_heap_cmd heap_cmd
 ## @ingroup sys_shell_commands
@@ -259,11 +370,22 @@ PSEUDOMODULES += i2c_scan
 ## @}
 PSEUDOMODULES += ieee802154_security
 PSEUDOMODULES += ieee802154_submac
+## @defgroup    net_ieee802154_submac_pipeline IEEE 802.15.4 SubMAC frame pipelining
+## @ingroup     net_ieee802154_submac
+## @brief       Accept one pending frame while the SubMAC is transmitting
+## @{
+PSEUDOMODULES += ieee802154_submac_pipeline
+## @}
 PSEUDOMODULES += ipv4
 PSEUDOMODULES += ipv6
 PSEUDOMODULES += l2filter_blacklist
 PSEUDOMODULES += l2filter_whitelist
 PSEUDOMODULES += libstdcpp
+## @defgroup    pseudomodule_littlefs2_fs_stats littlefs2_fs_stats
+## @brief       Count the MTD accesses of littlefs2 and the time spent on them
+##
+## See @ref sys_littlefs2 for details.
+PSEUDOMODULES += littlefs2_fs_stats
 PSEUDOMODULES += log
 PSEUDOMODULES += lora
 ## @defgroup pseudomodule_libc_gettimeofday libc_gettimeofday
@@ -271,6 +393,12 @@ PSEUDOMODULES += lora
 ##
 PSEUDOMODULES += libc_gettimeofday
 
+## @defgroup pseudomodule_cortexm_irq_stats cortexm_irq_stats
+## @brief Measure ISR durations and IRQ-off times on Cortex-M
+##
+## See @ref cpu_cortexm_irq_stats for details.
+PSEUDOMODULES += cortexm_irq_stats
+
 ## @defgroup pseudomodule_mpu_stack_guard mpu_stack_guard
 ## @brief MPU based stack guard
 ##
@@ -287,6 +415,21 @@ PSEUDOMODULES += mpu_stack_guard
 PSEUDOMODULES += mpu_noexec_ram
 ## @}
 
+## @defgroup    pseudomodule_malloc_profile malloc_profile
+## @brief       Record heap usage per call site
+##
+## See @ref sys_malloc_profile for details.
+PSEUDOMODULES += malloc_profile
+
+## @defgroup    sys_malloc_thread_cache Per-thread caches for small allocations
+## @ingroup     sys_malloc_ts
+## @brief       Serve small allocations from lock-free per-thread free lists
+##
+## See @ref sys_malloc_ts for details.
+## @{
+PSEUDOMODULES += malloc_thread_cache
+## @}
+
 ## @defgroup pseudomodule_md5sum md5sum
 ## @ingroup sys_shell_commands
 ## @{
@@ -294,6 +437,22 @@ PSEUDOMODULES += mpu_noexec_ram
 ##              will be removed after 2023.07 release.
 PSEUDOMODULES += md5sum
 ## @}
+
+## @defgroup    pseudomodule_memarray_atomic memarray_atomic
+## @brief       Lock-free memory array allocator with statistics
+##
+## See @ref sys_memarray_atomic for details.
+PSEUDOMODULES += memarray_atomic
+
+## @defgroup drivers_mtd_async  mtd_async
+## @ingroup drivers_mtd
+## @brief   Submit MTD operations without blocking, see @ref mtd_async_init()
+PSEUDOMODULES += mtd_async
+## @defgroup    pseudomodule_mtd_flashpage_buffered mtd_flashpage_buffered
+## @brief       Combine sequential writes to the flashpage MTD
+##
+## See @ref drivers_mtd_flashpage for details.
+PSEUDOMODULES += mtd_flashpage_buffered
 PSEUDOMODULES += mtd_write_page
 PSEUDOMODULES += nanocoap_%
 PSEUDOMODULES += netdev_default
@@ -305,6 +464,17 @@ PSEUDOMODULES += netdev_layer
 PSEUDOMODULES += netdev_legacy_api
 PSEUDOMODULES += netdev_new_api
 PSEUDOMODULES += netdev_register
+
+## @defgroup drivers_netdev_rx_lend netdev_rx_lend
+## @ingroup drivers_netdev_api
+## @{
+## @brief Enable zero-copy reception via netdev_driver_t::recv_lend()
+##
+## Drivers supporting it hand their DMA receive buffers directly to the upper
+## layer, which returns them via netdev_driver_t::recv_return() once the
+## frame was consumed. With GNRC this pulls in `gnrc_pktbuf_ext`.
+PSEUDOMODULES += netdev_rx_lend
+## @}
 PSEUDOMODULES += netstats
 PSEUDOMODULES += netstats_l2
 PSEUDOMODULES += netstats_neighbor_etx
@@ -339,6 +509,16 @@ PSEUDOMODULES += openthread
 PSEUDOMODULES += picolibc
 PSEUDOMODULES += picolibc_stdout_buffered
 PSEUDOMODULES += pktqueue
+
+## @defgroup pseudomodule_pm_layered_tickless pm_layered_tickless
+## @ingroup sys_pm_layered
+## @brief Only enter power modes that can be left before the next ztimer expires
+##
+## When going idle, @ref pm_set_lowest() skips power modes whose wakeup latency
+## (see @ref PM_WAKEUP_LATENCY_US) exceeds the time until the next timer on
+## ZTIMER_USEC or ZTIMER_MSEC is due.
+PSEUDOMODULES += pm_layered_tickless
+
 PSEUDOMODULES += posix_headers
 PSEUDOMODULES += printf_float
 PSEUDOMODULES += prng
@@ -359,9 +539,19 @@ PSEUDOMODULES += saul_gpio
 PSEUDOMODULES += saul_nrf_temperature
 PSEUDOMODULES += saul_nrf_vddh
 PSEUDOMODULES += saul_pwm
+PSEUDOMODULES += saul_reg_index
 PSEUDOMODULES += scanf_float
 PSEUDOMODULES += sched_cb
 PSEUDOMODULES += sched_runq_callback
+
+## @defgroup pseudomodule_schedstatistics_cycles schedstatistics_cycles
+## @ingroup schedstatistics
+## @brief Additionally account thread run times in CPU cycles
+##
+## Uses the DWT cycle counter on Cortex-M (not available on ARMv6-M and
+## ARMv8-M baseline) and the time stamp counter on native.
+PSEUDOMODULES += schedstatistics_cycles
+
 ## @defgroup pseudomodule_sema_deprecated sema_deprecated
 ## @ingroup sys_sema
 ## @{
@@ -370,6 +560,7 @@ PSEUDOMODULES += sema_deprecated
 ## @}
 PSEUDOMODULES += semtech_loramac_rx
 PSEUDOMODULES += senml_cbor
+PSEUDOMODULES += senml_json
 PSEUDOMODULES += senml_phydat
 PSEUDOMODULES += senml_saul
 ## @defgroup pseudomodule_sha1sum sha1sum
@@ -409,7 +600,9 @@ PSEUDOMODULES += shell_cmd_gnrc_sixlowpan_frag_stats
 PSEUDOMODULES += shell_cmd_gnrc_udp
 PSEUDOMODULES += shell_cmd_heap
 PSEUDOMODULES += shell_cmd_i2c_scan
+PSEUDOMODULES += shell_cmd_irq_stats
 PSEUDOMODULES += shell_cmd_lwip_netif
+PSEUDOMODULES += shell_cmd_malloc_profile
 PSEUDOMODULES += shell_cmd_mci
 PSEUDOMODULES += shell_cmd_md5sum
 PSEUDOMODULES += shell_cmd_nanocoap_vfs
@@ -419,6 +612,7 @@ PSEUDOMODULES += shell_cmd_nimble_netif
 PSEUDOMODULES += shell_cmd_nimble_statconn
 PSEUDOMODULES += shell_cmd_openwsn
 PSEUDOMODULES += shell_cmd_pm
+PSEUDOMODULES += shell_cmd_profiler
 PSEUDOMODULES += shell_cmd_ps
 PSEUDOMODULES += shell_cmd_random
 PSEUDOMODULES += shell_cmd_rtc
@@ -431,6 +625,7 @@ PSEUDOMODULES += shell_cmd_sht1x
 PSEUDOMODULES += shell_cmd_sntp
 PSEUDOMODULES += shell_cmd_suit
 PSEUDOMODULES += shell_cmd_sys
+PSEUDOMODULES += shell_cmd_tracepoint
 PSEUDOMODULES += shell_cmd_vfs
 PSEUDOMODULES += shell_cmds_default
 ## @addtogroup sys_shell_commands
@@ -471,6 +666,7 @@ PSEUDOMODULES += stdio_uart_rx
 PSEUDOMODULES += stm32_eth
 PSEUDOMODULES += stm32_eth_auto
 PSEUDOMODULES += stm32_eth_link_up
+PSEUDOMODULES += stm32_eth_rx_poll
 PSEUDOMODULES += stm32_eth_tracing
 PSEUDOMODULES += stm32mp1_eng_mode
 PSEUDOMODULES += suit_transport_%
@@ -478,6 +674,12 @@ PSEUDOMODULES += suit_storage_%
 PSEUDOMODULES += sys_bus_%
 PSEUDOMODULES += tiny_strerror_as_strerror
 PSEUDOMODULES += tiny_strerror_minimal
+
+## @defgroup pseudomodule_trace_stream trace_stream
+## @brief Store traces as binary records in a lock-free ring buffer
+##
+## See @ref trace.h for the record format.
+PSEUDOMODULES += trace_stream
 PSEUDOMODULES += vdd_lc_filter_%
 ## @defgroup pseudomodule_vfs_auto_format vfs_auto_format
 ## @brief Format mount points at startup unless they can be mounted
@@ -535,6 +737,31 @@ PSEUDOMODULES += ztimer64_%
 ## configuration header board.h. These can be found out by running tests/ztimer_overhead
 PSEUDOMODULES += ztimer_auto_adjust
 
+## @defgroup pseudomodule_ztimer_heap ztimer_heap
+## @brief Store the timers of each ztimer clock in a pairing heap
+##
+## By default, every ztimer clock keeps its timers in a sorted delta list,
+## which costs O(n) for each ztimer_set() and ztimer_remove(). With this
+## module, a pairing heap is used instead, so insertion is constant and
+## removal amortized O(log n) at the cost of two pointers per timer.
+PSEUDOMODULES += ztimer_heap
+
+## @defgroup pseudomodule_ztimer_slack ztimer_slack
+## @brief Allow ztimer timers to trigger late by a per timer slack
+##
+## Timers set up with ztimer_set_slack() may trigger up to the given amount of
+## ticks after their target, so that ztimer can trigger nearby timers from a
+## single interrupt and program the underlying clock only once per batch.
+PSEUDOMODULES += ztimer_slack
+
+## @defgroup pseudomodule_ztimer_usec_ptp ztimer_usec_ptp
+## @brief Run ZTIMER_USEC on the PTP clock
+##
+## ZTIMER_USEC is derived from the PTP clock instead of the basic timer, so it
+## follows the network time when the PTP clock is synchronized, e.g. by
+## @ref net_ptp_client. Steps of the PTP clock shift pending timers.
+PSEUDOMODULES += ztimer_usec_ptp
+
 # core_lib is not a submodule
 NO_PSEUDOMODULES += core_lib
 
@@ -547,6 +774,8 @@ PSEUDOMODULES += od_string
 
 # add all pseudo random number generator variants as pseudomodules
 PSEUDOMODULES += prng_%
+# reads the HWRNG of prng_hwrng in bulk into a pool
+PSEUDOMODULES += random_hwrng_pool
 
 # STM32 periph pseudomodules
 PSEUDOMODULES += stm32_periph_%
@@ -562,10 +791,18 @@ PSEUDOMODULES += skald_eddystone
 PSEUDOMODULES += crypto_aes_128
 PSEUDOMODULES += crypto_aes_192
 PSEUDOMODULES += crypto_aes_256
+# Constant-time, bitsliced AES instead of the T table implementation
+PSEUDOMODULES += crypto_aes_ct
+# Computes four ChaCha20 blocks at once in the chacha20poly1305 AEAD
+PSEUDOMODULES += crypto_chacha20poly1305_fast
 # By using this pseudomodule, T tables will be precalculated.
 PSEUDOMODULES += crypto_aes_precalculated
 # This pseudomodule causes a loop in AES to be unrolled (more flash, less CPU)
 PSEUDOMODULES += crypto_aes_unroll
+# Poly1305 in radix 2^26, using only 32x32 bit multiplications
+PSEUDOMODULES += crypto_poly1305_fast
+# This pseudomodule unrolls the rounds of SHA-224/256 (more flash, less CPU)
+PSEUDOMODULES += hashes_sha2xx_unroll
 
 # declare shell version of test_utils_interactive_sync
 PSEUDOMODULES += test_utils_interactive_sync_shell
@@ -222,6 +222,38 @@ static fatfs_file_desc_t * _get_fatfs_file_desc(vfs_file_t *f)
     return (fatfs_file_desc_t *)(uintptr_t)f->private_data.buffer;
 }
 
+#if CONFIG_FATFS_READAHEAD_SIZE
+/* drops the unread contents of the read-ahead buffer, so the file position of
+ * FatFs matches the one seen by the user again */
+static int _ra_discard(fatfs_desc_t *fs_desc, vfs_file_t *filp)
+{
+    FIL *file = &_get_fatfs_file_desc(filp)->file;
+    size_t unread = fs_desc->ra_len - fs_desc->ra_pos;
+
+    if (fs_desc->ra_file != filp) {
+        return 0;
+    }
+    fs_desc->ra_pos = 0;
+    fs_desc->ra_len = 0;
+    if (unread == 0) {
+        return 0;
+    }
+    return fatfs_err_to_errno(f_lseek(file, f_tell(file) - unread));
+}
+
+static int _ra_fill(fatfs_desc_t *fs_desc, vfs_file_t *filp)
+{
+    FIL *file = &_get_fatfs_file_desc(filp)->file;
+    UINT br;
+
+    FRESULT res = f_read(file, fs_desc->ra_buf, sizeof(fs_desc->ra_buf), &br);
+
+    fs_desc->ra_pos = 0;
+    fs_desc->ra_len = (res == FR_OK) ? br : 0;
+    return fatfs_err_to_errno(res);
+}
+#endif
+
 static int _open(vfs_file_t *filp, const char *name, int flags, mode_t mode)
 {
     fatfs_file_desc_t *fd = _get_fatfs_file_desc(filp);
@@ -285,6 +317,13 @@ static int _close(vfs_file_t *filp)
 
     DEBUG("fatfs_vfs.c: _close: private_data = %p\n", filp->mp->private_data);
 
+#if CONFIG_FATFS_READAHEAD_SIZE
+    fatfs_desc_t *fs_desc = filp->mp->private_data;
+    if (fs_desc->ra_file == filp) {
+        fs_desc->ra_file = NULL;
+    }
+#endif
+
     FRESULT res = f_close(&fd->file);
 
     if (res == FR_OK) {
@@ -303,6 +342,13 @@ static ssize_t _write(vfs_file_t *filp, const void *src, size_t nbytes)
 
     UINT bw;
 
+#if CONFIG_FATFS_READAHEAD_SIZE
+    int ra_res = _ra_discard(filp->mp->private_data, filp);
+    if (ra_res < 0) {
+        return ra_res;
+    }
+#endif
+
     FRESULT res = f_write(&fd->file, src, nbytes, &bw);
 
     if (res != FR_OK) {
@@ -331,6 +377,28 @@ static ssize_t _read(vfs_file_t *filp, void *dest, size_t nbytes)
 
     UINT br;
 
+#if CONFIG_FATFS_READAHEAD_SIZE
+    fatfs_desc_t *fs_desc = filp->mp->private_data;
+    if (fs_desc->ra_file == filp) {
+        if ((fs_desc->ra_pos == fs_desc->ra_len) &&
+            (nbytes < sizeof(fs_desc->ra_buf))) {
+            int ra_res = _ra_fill(fs_desc, filp);
+            if (ra_res < 0) {
+                return ra_res;
+            }
+        }
+        if (fs_desc->ra_pos < fs_desc->ra_len) {
+            size_t n = fs_desc->ra_len - fs_desc->ra_pos;
+            if (n > nbytes) {
+                n = nbytes;
+            }
+            memcpy(dest, &fs_desc->ra_buf[fs_desc->ra_pos], n);
+            fs_desc->ra_pos += n;
+            return n;
+        }
+    }
+#endif
+
     FRESULT res = f_read(&fd->file, dest, nbytes, &br);
 
     if (res != FR_OK) {
@@ -346,6 +414,13 @@ static off_t _lseek(vfs_file_t *filp, off_t off, int whence)
     FRESULT res;
     off_t new_pos = 0;
 
+#if CONFIG_FATFS_READAHEAD_SIZE
+    int ra_res = _ra_discard(filp->mp->private_data, filp);
+    if (ra_res < 0) {
+        return ra_res;
+    }
+#endif
+
     if (whence == SEEK_SET) {
         new_pos = off;
     }
@@ -368,6 +443,35 @@ static off_t _lseek(vfs_file_t *filp, off_t off, int whence)
     return fatfs_err_to_errno(res);
 }
 
+#if CONFIG_FATFS_READAHEAD_SIZE
+static int _fadvise(vfs_file_t *filp, vfs_fadvise_t advice)
+{
+    fatfs_desc_t *fs_desc = filp->mp->private_data;
+    int res;
+
+    if ((advice != VFS_FADV_SEQUENTIAL) && (advice != VFS_FADV_WILLNEED)) {
+        res = _ra_discard(fs_desc, filp);
+        if (fs_desc->ra_file == filp) {
+            fs_desc->ra_file = NULL;
+        }
+        return res;
+    }
+    if (fs_desc->ra_file != filp) {
+        /* take the buffer over from another file */
+        if (fs_desc->ra_file &&
+            ((res = _ra_discard(fs_desc, fs_desc->ra_file)) < 0)) {
+            return res;
+        }
+        fs_desc->ra_file = filp;
+    }
+    if ((advice == VFS_FADV_WILLNEED) && (fs_desc->ra_pos == fs_desc->ra_len) &&
+        ((filp->flags & O_ACCMODE) != O_WRONLY)) {
+        return _ra_fill(fs_desc, filp);
+    }
+    return 0;
+}
+#endif
+
 static int _fstat(vfs_file_t *filp, struct stat *buf)
 {
     fatfs_desc_t *fs_desc = (fatfs_desc_t *)filp->mp->private_data;
@@ -577,6 +681,9 @@ static const vfs_file_ops_t fatfs_file_ops = {
     .lseek = _lseek,
     .fstat = _fstat,
     .fsync = _fsync,
+#if CONFIG_FATFS_READAHEAD_SIZE
+    .fadvise = _fadvise,
+#endif
 };
 
 static const vfs_dir_ops_t fatfs_dir_ops = {
@@ -25,10 +25,55 @@
 #include <string.h>
 
 #include "fs/littlefs2_fs.h"
+#if IS_USED(MODULE_LITTLEFS2_FS_STATS)
+#include "ztimer.h"
+#endif
 
 #define ENABLE_DEBUG 0
 #include <debug.h>
 
+#if IS_USED(MODULE_LITTLEFS2_FS_STATS)
+static inline uint32_t _stats_now(void)
+{
+    return ztimer_now(ZTIMER_USEC);
+}
+
+static void _stats_add(littlefs2_op_stats_t *op, uint32_t start, size_t bytes)
+{
+    op->count++;
+    op->bytes += bytes;
+    op->time_us += _stats_now() - start;
+}
+
+#define _STATS_ADD(fs, op, start, bytes) _stats_add(&(fs)->stats.op, start, bytes)
+#else
+static inline uint32_t _stats_now(void)
+{
+    return 0;
+}
+
+#define _STATS_ADD(fs, op, start, bytes) (void)(start)
+#endif
+
+static void _lock(littlefs2_desc_t *fs)
+{
+    mutex_lock(&fs->lock);
+#if IS_USED(MODULE_LITTLEFS2_FS_STATS)
+    fs->op_start = _stats_now();
+#endif
+}
+
+static void _unlock(littlefs2_desc_t *fs)
+{
+#if IS_USED(MODULE_LITTLEFS2_FS_STATS)
+    uint32_t duration = _stats_now() - fs->op_start;
+    if (duration > fs->stats.stall_max_us) {
+        fs->stats.stall_max_us = duration;
+    }
+#endif
+    mutex_unlock(&fs->lock);
+}
+
 static int littlefs_err_to_errno(ssize_t err)
 {
     switch (err) {
@@ -71,7 +116,10 @@ static int _dev_read(const struct lfs_config *c, lfs_block_t block,
           (void *)c, block, off, buffer, size);
 
     uint32_t page = (fs->base_addr + block) * fs->sectors_per_block * mtd->pages_per_sector;
-    return mtd_read_page(mtd, buffer, page, off, size);
+    uint32_t start = _stats_now();
+    int ret = mtd_read_page(mtd, buffer, page, off, size);
+    _STATS_ADD(fs, read, start, size);
+    return ret;
 }
 
 static int _dev_write(const struct lfs_config *c, lfs_block_t block,
@@ -84,7 +132,10 @@ static int _dev_write(const struct lfs_config *c, lfs_block_t block,
           (void *)c, block, off, buffer, size);
 
     uint32_t page = (fs->base_addr + block) * fs->sectors_per_block * mtd->pages_per_sector;
-    return mtd_write_page_raw(mtd, buffer, page, off, size);
+    uint32_t start = _stats_now();
+    int ret = mtd_write_page_raw(mtd, buffer, page, off, size);
+    _STATS_ADD(fs, prog, start, size);
+    return ret;
 }
 
 static int _dev_erase(const struct lfs_config *c, lfs_block_t block)
@@ -95,19 +146,23 @@ static int _dev_erase(const struct lfs_config *c, lfs_block_t block)
     DEBUG("lfs_erase: c=%p, block=%" PRIu32 "\n", (void *)c, block);
 
     uint32_t sector = (fs->base_addr + block) * fs->sectors_per_block;
-    return mtd_erase_sector(mtd, sector, fs->sectors_per_block);}
+    uint32_t start = _stats_now();
+    int ret = mtd_erase_sector(mtd, sector, fs->sectors_per_block);
+    _STATS_ADD(fs, erase, start, c->block_size);
+    return ret;
+}
 
 static int _dev_sync(const struct lfs_config *c)
 {
-    (void)c;
+    littlefs2_desc_t *fs = c->context;
 
-    return 0;
+    return mtd_flush(fs->dev);
 }
 
 static int prepare(littlefs2_desc_t *fs)
 {
     mutex_init(&fs->lock);
-    mutex_lock(&fs->lock);
+    _lock(fs);
 
     int ret = mtd_init(fs->dev);
 
@@ -148,8 +203,10 @@ static int prepare(littlefs2_desc_t *fs)
     if (!fs->config.block_cycles) {
         fs->config.block_cycles = CONFIG_LITTLEFS2_BLOCK_CYCLES;
     }
-    fs->config.lookahead_size = CONFIG_LITTLEFS2_LOOKAHEAD_SIZE;
-    fs->config.lookahead_buffer = fs->lookahead_buf;
+    if (!fs->config.lookahead_buffer) {
+        fs->config.lookahead_size = CONFIG_LITTLEFS2_LOOKAHEAD_SIZE;
+        fs->config.lookahead_buffer = fs->lookahead_buf;
+    }
     fs->config.context = fs;
     fs->config.read = _dev_read;
     fs->config.prog = _dev_write;
@@ -179,7 +236,7 @@ static int _format(vfs_mount_t *mountp)
     }
 
     ret = lfs_format(&fs->fs, &fs->config);
-    mutex_unlock(&fs->lock);
+    _unlock(fs);
 
     return littlefs_err_to_errno(ret);
 }
@@ -202,7 +259,7 @@ static int _mount(vfs_mount_t *mountp)
     }
 
     ret = lfs_mount(&fs->fs, &fs->config);
-    mutex_unlock(&fs->lock);
+    _unlock(fs);
 
     return littlefs_err_to_errno(ret);
 }
@@ -211,12 +268,12 @@ static int _umount(vfs_mount_t *mountp)
 {
     littlefs2_desc_t *fs = mountp->private_data;
 
-    mutex_lock(&fs->lock);
+    _lock(fs);
 
     DEBUG("littlefs: umount: mountp=%p\n", (void *)mountp);
 
     int ret = lfs_unmount(&fs->fs);
-    mutex_unlock(&fs->lock);
+    _unlock(fs);
 
     return littlefs_err_to_errno(ret);
 }
@@ -225,13 +282,13 @@ static int _unlink(vfs_mount_t *mountp, const char *name)
 {
     littlefs2_desc_t *fs = mountp->private_data;
 
-    mutex_lock(&fs->lock);
+    _lock(fs);
 
     DEBUG("littlefs: unlink: mountp=%p, name=%s\n",
           (void *)mountp, name);
 
     int ret = lfs_remove(&fs->fs, name);
-    mutex_unlock(&fs->lock);
+    _unlock(fs);
 
     return littlefs_err_to_errno(ret);
 }
@@ -240,13 +297,13 @@ static int _rename(vfs_mount_t *mountp, const char *from_path, const char *to_pa
 {
     littlefs2_desc_t *fs = mountp->private_data;
 
-    mutex_lock(&fs->lock);
+    _lock(fs);
 
     DEBUG("littlefs: rename: mountp=%p, from=%s, to=%s\n",
           (void *)mountp, from_path, to_path);
 
     int ret = lfs_rename(&fs->fs, from_path, to_path);
-    mutex_unlock(&fs->lock);
+    _unlock(fs);
 
     return littlefs_err_to_errno(ret);
 }
@@ -256,13 +313,13 @@ static int _mkdir(vfs_mount_t *mountp, const char *name, mode_t mode)
     (void)mode;
     littlefs2_desc_t *fs = mountp->private_data;
 
-    mutex_lock(&fs->lock);
+    _lock(fs);
 
     DEBUG("littlefs: mkdir: mountp=%p, name=%s, mode=%" PRIu32 "\n",
           (void *)mountp, name, (uint32_t)mode);
 
     int ret = lfs_mkdir(&fs->fs, name);
-    mutex_unlock(&fs->lock);
+    _unlock(fs);
 
     return littlefs_err_to_errno(ret);
 }
@@ -271,13 +328,13 @@ static int _rmdir(vfs_mount_t *mountp, const char *name)
 {
     littlefs2_desc_t *fs = mountp->private_data;
 
-    mutex_lock(&fs->lock);
+    _lock(fs);
 
     DEBUG("littlefs: rmdir: mountp=%p, name=%s\n",
           (void *)mountp, name);
 
     int ret = lfs_remove(&fs->fs, name);
-    mutex_unlock(&fs->lock);
+    _unlock(fs);
 
     return littlefs_err_to_errno(ret);
 }
@@ -291,13 +348,43 @@ static inline lfs_file_t * _get_lfs_file(vfs_file_t *f)
     return (lfs_file_t *)(uintptr_t)f->private_data.buffer;
 }
 
+#if CONFIG_LITTLEFS2_READAHEAD_SIZE
+/* drops the unread contents of the read-ahead buffer, so the file position of
+ * littlefs matches the one seen by the user again */
+static int _ra_discard(littlefs2_desc_t *fs, vfs_file_t *filp)
+{
+    lfs_soff_t unread = fs->ra_len - fs->ra_pos;
+
+    if (fs->ra_file != filp) {
+        return 0;
+    }
+    fs->ra_pos = 0;
+    fs->ra_len = 0;
+    if (unread == 0) {
+        return 0;
+    }
+    int ret = lfs_file_seek(&fs->fs, _get_lfs_file(filp), -unread, LFS_SEEK_CUR);
+    return (ret < 0) ? littlefs_err_to_errno(ret) : 0;
+}
+
+static int _ra_fill(littlefs2_desc_t *fs, vfs_file_t *filp)
+{
+    lfs_ssize_t ret = lfs_file_read(&fs->fs, _get_lfs_file(filp),
+                                    fs->ra_buf, sizeof(fs->ra_buf));
+
+    fs->ra_pos = 0;
+    fs->ra_len = (ret > 0) ? ret : 0;
+    return (ret < 0) ? littlefs_err_to_errno(ret) : 0;
+}
+#endif
+
 static int _open(vfs_file_t *filp, const char *name, int flags, mode_t mode)
 {
     littlefs2_desc_t *fs = filp->mp->private_data;
     lfs_file_t *fp = _get_lfs_file(filp);
     (void) mode;
 
-    mutex_lock(&fs->lock);
+    _lock(fs);
 
     DEBUG("littlefs: open: filp=%p, fp=%p\n", (void *)filp, (void *)fp);
 
@@ -327,7 +414,7 @@ static int _open(vfs_file_t *filp, const char *name, int flags, mode_t mode)
     DEBUG("littlefs: open: %s, flags: 0x%x\n", name, (int) l_flags);
 
     int ret = lfs_file_open(&fs->fs, fp, name, l_flags);
-    mutex_unlock(&fs->lock);
+    _unlock(fs);
 
     return littlefs_err_to_errno(ret);
 }
@@ -337,12 +424,18 @@ static int _close(vfs_file_t *filp)
     littlefs2_desc_t *fs = filp->mp->private_data;
     lfs_file_t *fp = _get_lfs_file(filp);
 
-    mutex_lock(&fs->lock);
+    _lock(fs);
 
     DEBUG("littlefs: close: filp=%p, fp=%p\n", (void *)filp, (void *)fp);
 
+#if CONFIG_LITTLEFS2_READAHEAD_SIZE
+    if (fs->ra_file == filp) {
+        fs->ra_file = NULL;
+    }
+#endif
+
     int ret = lfs_file_close(&fs->fs, fp);
-    mutex_unlock(&fs->lock);
+    _unlock(fs);
 
     return littlefs_err_to_errno(ret);
 }
@@ -352,13 +445,21 @@ static ssize_t _write(vfs_file_t *filp, const void *src, size_t nbytes)
     littlefs2_desc_t *fs = filp->mp->private_data;
     lfs_file_t *fp = _get_lfs_file(filp);
 
-    mutex_lock(&fs->lock);
+    _lock(fs);
 
     DEBUG("littlefs: write: filp=%p, fp=%p, src=%p, nbytes=%u\n",
           (void *)filp, (void *)fp, (void *)src, (unsigned)nbytes);
 
+#if CONFIG_LITTLEFS2_READAHEAD_SIZE
+    int ra_ret = _ra_discard(fs, filp);
+    if (ra_ret < 0) {
+        _unlock(fs);
+        return ra_ret;
+    }
+#endif
+
     ssize_t ret = lfs_file_write(&fs->fs, fp, src, nbytes);
-    mutex_unlock(&fs->lock);
+    _unlock(fs);
 
     return littlefs_err_to_errno(ret);
 }
@@ -368,13 +469,35 @@ static ssize_t _read(vfs_file_t *filp, void *dest, size_t nbytes)
     littlefs2_desc_t *fs = filp->mp->private_data;
     lfs_file_t *fp = _get_lfs_file(filp);
 
-    mutex_lock(&fs->lock);
+    _lock(fs);
 
     DEBUG("littlefs: read: filp=%p, fp=%p, dest=%p, nbytes=%u\n",
           (void *)filp, (void *)fp, (void *)dest, (unsigned)nbytes);
 
+#if CONFIG_LITTLEFS2_READAHEAD_SIZE
+    if (fs->ra_file == filp) {
+        if ((fs->ra_pos == fs->ra_len) && (nbytes < sizeof(fs->ra_buf))) {
+            int ra_ret = _ra_fill(fs, filp);
+            if (ra_ret < 0) {
+                _unlock(fs);
+                return ra_ret;
+            }
+        }
+        if (fs->ra_pos < fs->ra_len) {
+            size_t n = fs->ra_len - fs->ra_pos;
+            if (n > nbytes) {
+                n = nbytes;
+            }
+            memcpy(dest, &fs->ra_buf[fs->ra_pos], n);
+            fs->ra_pos += n;
+            _unlock(fs);
+            return n;
+        }
+    }
+#endif
+
     ssize_t ret = lfs_file_read(&fs->fs, fp, dest, nbytes);
-    mutex_unlock(&fs->lock);
+    _unlock(fs);
 
     return littlefs_err_to_errno(ret);
 }
@@ -384,13 +507,21 @@ static off_t _lseek(vfs_file_t *filp, off_t off, int whence)
     littlefs2_desc_t *fs = filp->mp->private_data;
     lfs_file_t *fp = _get_lfs_file(filp);
 
-    mutex_lock(&fs->lock);
+    _lock(fs);
 
     DEBUG("littlefs: seek: filp=%p, fp=%p, off=%ld, whence=%d\n",
           (void *)filp, (void *)fp, (long)off, whence);
 
+#if CONFIG_LITTLEFS2_READAHEAD_SIZE
+    int ra_ret = _ra_discard(fs, filp);
+    if (ra_ret < 0) {
+        _unlock(fs);
+        return ra_ret;
+    }
+#endif
+
     int ret = lfs_file_seek(&fs->fs, fp, off, whence);
-    mutex_unlock(&fs->lock);
+    _unlock(fs);
 
     return littlefs_err_to_errno(ret);
 }
@@ -400,29 +531,64 @@ static int _fsync(vfs_file_t *filp)
     littlefs2_desc_t *fs = filp->mp->private_data;
     lfs_file_t *fp = _get_lfs_file(filp);
 
-    mutex_lock(&fs->lock);
+    _lock(fs);
 
     DEBUG("littlefs: fsync: filp=%p, fp=%p\n",
           (void *)filp, (void *)fp);
 
     int ret = lfs_file_sync(&fs->fs, fp);
-    mutex_unlock(&fs->lock);
+    _unlock(fs);
 
     return littlefs_err_to_errno(ret);
 }
 
+#if CONFIG_LITTLEFS2_READAHEAD_SIZE
+static int _fadvise(vfs_file_t *filp, vfs_fadvise_t advice)
+{
+    littlefs2_desc_t *fs = filp->mp->private_data;
+    int ret = 0;
+
+    _lock(fs);
+
+    DEBUG("littlefs: fadvise: filp=%p, advice=%d\n", (void *)filp, (int)advice);
+
+    if ((advice != VFS_FADV_SEQUENTIAL) && (advice != VFS_FADV_WILLNEED)) {
+        ret = _ra_discard(fs, filp);
+        if (fs->ra_file == filp) {
+            fs->ra_file = NULL;
+        }
+        goto out;
+    }
+    if (fs->ra_file != filp) {
+        /* take the buffer over from another file */
+        if (fs->ra_file && ((ret = _ra_discard(fs, fs->ra_file)) < 0)) {
+            goto out;
+        }
+        fs->ra_file = filp;
+    }
+    if ((advice == VFS_FADV_WILLNEED) && (fs->ra_pos == fs->ra_len) &&
+        ((filp->flags & O_ACCMODE) != O_WRONLY)) {
+        ret = _ra_fill(fs, filp);
+    }
+out:
+    _unlock(fs);
+
+    return ret;
+}
+#endif
+
 static int _stat(vfs_mount_t *mountp, const char *restrict path, struct stat *restrict buf)
 {
     littlefs2_desc_t *fs = mountp->private_data;
 
-    mutex_lock(&fs->lock);
+    _lock(fs);
 
     DEBUG("littlefs: stat: mountp=%p, path=%s, buf=%p\n",
           (void *)mountp, path, (void *)buf);
 
     struct lfs_info info;
     int ret = lfs_stat(&fs->fs, path, &info);
-    mutex_unlock(&fs->lock);
+    _unlock(fs);
     /* info.name */
     buf->st_size = info.size;
     switch (info.type) {
@@ -451,14 +617,14 @@ static int _statvfs(vfs_mount_t *mountp, const char *restrict path, struct statv
     (void)path;
     littlefs2_desc_t *fs = mountp->private_data;
 
-    mutex_lock(&fs->lock);
+    _lock(fs);
 
     DEBUG("littlefs: statvfs: mountp=%p, path=%s, buf=%p\n",
           (void *)mountp, path, (void *)buf);
 
     unsigned long nb_blocks = 0;
     int ret = lfs_fs_traverse(&fs->fs, _traverse_cb, &nb_blocks);
-    mutex_unlock(&fs->lock);
+    _unlock(fs);
 
     buf->f_bsize = fs->fs.cfg->block_size;      /* block size */
     buf->f_frsize = fs->dev->page_size *
@@ -486,13 +652,13 @@ static int _opendir(vfs_DIR *dirp, const char *dirname)
     littlefs2_desc_t *fs = dirp->mp->private_data;
     lfs_dir_t *dir = _get_lfs_dir(dirp);
 
-    mutex_lock(&fs->lock);
+    _lock(fs);
 
     DEBUG("littlefs: opendir: dirp=%p, dirname=%s\n",
           (void *)dirp, dirname);
 
     int ret = lfs_dir_open(&fs->fs, dir, dirname);
-    mutex_unlock(&fs->lock);
+    _unlock(fs);
 
     return littlefs_err_to_errno(ret);
 }
@@ -502,7 +668,7 @@ static int _readdir(vfs_DIR *dirp, vfs_dirent_t *entry)
     littlefs2_desc_t *fs = dirp->mp->private_data;
     lfs_dir_t *dir = _get_lfs_dir(dirp);
 
-    mutex_lock(&fs->lock);
+    _lock(fs);
 
     DEBUG("littlefs: readdir: dirp=%p, entry=%p\n",
           (void *)dirp, (void *)entry);
@@ -514,7 +680,7 @@ static int _readdir(vfs_DIR *dirp, vfs_dirent_t *entry)
         strncpy(entry->d_name, info.name, VFS_NAME_MAX - 1);
     }
 
-    mutex_unlock(&fs->lock);
+    _unlock(fs);
 
     return littlefs_err_to_errno(ret);
 }
@@ -524,16 +690,30 @@ static int _closedir(vfs_DIR *dirp)
     littlefs2_desc_t *fs = dirp->mp->private_data;
     lfs_dir_t *dir = _get_lfs_dir(dirp);
 
-    mutex_lock(&fs->lock);
+    _lock(fs);
 
     DEBUG("littlefs: closedir: dirp=%p\n", (void *)dirp);
 
     int ret = lfs_dir_close(&fs->fs, dir);
-    mutex_unlock(&fs->lock);
+    _unlock(fs);
 
     return littlefs_err_to_errno(ret);
 }
 
+#if IS_USED(MODULE_LITTLEFS2_FS_STATS)
+void littlefs2_fs_get_stats(littlefs2_desc_t *fs, littlefs2_stats_t *stats,
+                            bool reset)
+{
+    /* not _lock(), so this does not count as a stall */
+    mutex_lock(&fs->lock);
+    *stats = fs->stats;
+    if (reset) {
+        memset(&fs->stats, 0, sizeof(fs->stats));
+    }
+    mutex_unlock(&fs->lock);
+}
+#endif
+
 static const vfs_file_system_ops_t littlefs_fs_ops = {
     .format = _format,
     .mount = _mount,
@@ -553,6 +733,9 @@ static const vfs_file_ops_t littlefs_file_ops = {
     .write = _write,
     .lseek = _lseek,
     .fsync = _fsync,
+#if CONFIG_LITTLEFS2_READAHEAD_SIZE
+    .fadvise = _fadvise,
+#endif
 };
 
 static const vfs_dir_ops_t littlefs_dir_ops = {
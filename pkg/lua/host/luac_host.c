@@ -0,0 +1,44 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/*
+ * luaL_newstate() for the host compiler, as removed from lauxlib by
+ * 0001-Remove-luaL_newstate.patch
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "luac_host.h"
+
+static void *_alloc(void *ud, void *ptr, size_t osize, size_t nsize)
+{
+    (void)ud;
+    (void)osize;
+    if (nsize == 0) {
+        free(ptr);
+        return NULL;
+    }
+    return realloc(ptr, nsize);
+}
+
+static int _panic(lua_State *L)
+{
+    fprintf(stderr, "luac: unprotected error (%s)\n", lua_tostring(L, -1));
+    return 0;
+}
+
+lua_State *luaL_newstate(void)
+{
+    lua_State *L = lua_newstate(_alloc, NULL);
+
+    if (L) {
+        lua_atpanic(L, _panic);
+    }
+    return L;
+}
@@ -0,0 +1,21 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/*
+ * Included into luac.c when building the host compiler: the package removes
+ * luaL_newstate() from lauxlib, luac still needs it.
+ */
+
+#ifndef LUAC_HOST_H
+#define LUAC_HOST_H
+
+#include "lua.h"
+
+lua_State *luaL_newstate(void);
+
+#endif /* LUAC_HOST_H */
@@ -214,6 +214,28 @@ LUALIB_API int lua_riot_do_module(const char *modname, void *memory, size_t mem_
 LUALIB_API int lua_riot_do_buffer(const uint8_t *buf, size_t buflen, void *memory,
                                   size_t mem_size, uint16_t modmask, int *retval);
 
+/**
+ * Initialize the interpreter and run precompiled bytecode in protected mode.
+ *
+ * Skips the parser, so less memory is needed than for the source code. Only
+ * trusted bytecode must be run, e.g. bytecode built into the application with
+ * LUA_PRECOMPILE, as the lua interpreter is not robust against corrupt binary
+ * code.
+ *
+ * @see lua_riot_do_module() for more information on internal errors.
+ *
+ * @param       buf     Bytecode as written by luac.
+ * @param       buflen  Size of the bytecode in bytes.
+ * @param       memory      @see lua_riot_newstate()
+ * @param       mem_size    @see lua_riot_newstate()
+ * @param       modmask     @see lua_riot_newstate()
+ * @param[out]  retval      @see lua_riot_do_module()
+ * @return      @see lua_riot_do_module().
+ */
+LUALIB_API int lua_riot_do_bytecode(const uint8_t *buf, size_t buflen,
+                                    void *memory, size_t mem_size,
+                                    uint16_t modmask, int *retval);
+
 #ifdef __cplusplus
 extern "C" }
 #endif
@@ -70,6 +70,10 @@ static kernel_pid_t _task_thread_pid;
 
 static lv_disp_draw_buf_t disp_buf;
 static lv_color_t draw_buf[LVGL_COLOR_BUF_SIZE];
+#if IS_USED(MODULE_DISP_DEV_ASYNC)
+/* render into the second buffer while the first one is sent */
+static lv_color_t draw_buf2[LVGL_COLOR_BUF_SIZE];
+#endif
 
 static lv_disp_drv_t disp_drv;
 #if IS_USED(MODULE_TOUCH_DEV)
@@ -78,6 +82,12 @@ static lv_indev_drv_t indev_drv;
 
 #if !IS_USED(MODULE_LV_DRIVERS_SDL)
 static screen_dev_t *_screen_dev = NULL;
+
+static void _disp_map_done(void *arg)
+{
+    lv_disp_flush_ready(arg);
+}
+
 static void _disp_map(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t *color_p)
 {
     if (!_screen_dev->display) {
@@ -92,11 +102,11 @@ static void _disp_map(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t *col
         area->x1, area->x2, area->y1, area->y2
     };
 
-    disp_dev_map(_screen_dev->display, &disp_area, (const uint16_t *)color_p);
-
     LOG_DEBUG("[lvgl] flush display\n");
 
-    lv_disp_flush_ready(drv);
+    /* LVGL waits for lv_disp_flush_ready() before reusing the buffer */
+    disp_dev_map_async(_screen_dev->display, &disp_area,
+                       (const uint16_t *)color_p, _disp_map_done, drv);
 }
 #endif
 
@@ -145,7 +155,11 @@ void lvgl_init(screen_dev_t *screen_dev)
     (void)screen_dev;
 #endif
 
+#if IS_USED(MODULE_DISP_DEV_ASYNC)
+    lv_disp_draw_buf_init(&disp_buf, draw_buf, draw_buf2, LVGL_COLOR_BUF_SIZE);
+#else
     lv_disp_draw_buf_init(&disp_buf, draw_buf, NULL, LVGL_COLOR_BUF_SIZE);
+#endif
 
     lv_disp_drv_init(&disp_drv);
     disp_drv.draw_buf = &disp_buf;
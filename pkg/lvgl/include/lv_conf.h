@@ -148,11 +148,11 @@ extern "C" {
  *-----------*/
 
 /*Use STM32's DMA2D (aka Chrom Art) GPU*/
-#define LV_USE_GPU_STM32_DMA2D  0
+#define LV_USE_GPU_STM32_DMA2D  IS_USED(MODULE_LVGL_DRAW_STM32_DMA2D)
 #if LV_USE_GPU_STM32_DMA2D
 /*Must be defined to include path of CMSIS header of target processor
 e.g. "stm32f769xx.h" or "stm32f429xx.h"*/
-#define LV_GPU_DMA2D_CMSIS_INCLUDE
+#define LV_GPU_DMA2D_CMSIS_INCLUDE "cpu_conf.h"
 #endif
 
 /** Use NXP's PXP GPU iMX RTxxx platforms*/
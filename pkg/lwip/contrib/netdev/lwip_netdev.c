@@ -33,6 +33,7 @@
 #include "net/ipv6/addr.h"
 #include "net/netdev.h"
 #include "net/netopt.h"
+#include "kernel_defines.h"
 #include "utlist.h"
 #include "thread.h"
 
@@ -41,7 +42,8 @@
 
 #define LWIP_NETDEV_NAME            "lwip_netdev_mux"
 #define LWIP_NETDEV_PRIO            (THREAD_PRIORITY_MAIN - 4)
-#define LWIP_NETDEV_STACKSIZE       (THREAD_STACKSIZE_DEFAULT)
+/* received packets are processed by the stack in this thread */
+#define LWIP_NETDEV_STACKSIZE       (TCPIP_THREAD_STACKSIZE)
 #define LWIP_NETDEV_QUEUE_LEN       (8)
 #define LWIP_NETDEV_MSG_TYPE_EVENT 0x1235
 
@@ -51,10 +53,24 @@
 #define WPAN_IFNAME1 'W'
 #define WPAN_IFNAME2 'P'
 
+/**
+ * @brief   Event for the stack, raised by the device while its lock is held
+ *
+ * Handing the event to the stack takes the TCP/IP core lock, while the TCP/IP
+ * thread takes the device lock to send with the core lock held. So events are
+ * handed to the stack only after the device lock was released.
+ */
+typedef struct {
+    struct netif *netif;
+    struct pbuf *p;             /**< received packet, NULL for link events */
+    netdev_event_t event;
+} _stack_event_t;
+
 static kernel_pid_t _pid = KERNEL_PID_UNDEF;
 static char _stack[LWIP_NETDEV_STACKSIZE];
 static msg_t _queue[LWIP_NETDEV_QUEUE_LEN];
-static char _tmp_buf[LWIP_NETDEV_BUFLEN];
+static _stack_event_t _stack_events[LWIP_NETDEV_QUEUE_LEN];
+static unsigned _stack_events_numof;
 
 #ifdef MODULE_NETDEV_ETH
 static err_t _eth_link_output(struct netif *netif, struct pbuf *p);
@@ -257,29 +273,91 @@ static err_t _ieee802154_link_output(struct netif *netif, struct pbuf *p)
 }
 #endif
 
+/* called with the device lock held */
 static struct pbuf *_get_recv_pkt(netdev_t *dev)
 {
-    lwip_netif_t *compat_netif = dev->context;
-    struct netif *netif = &compat_netif->lwip_netif;
-    lwip_netif_dev_acquire(netif);
-    int len = dev->driver->recv(dev, _tmp_buf, sizeof(_tmp_buf), NULL);
-    lwip_netif_dev_release(netif);
+    int len = dev->driver->recv(dev, NULL, 0, NULL);
 
     if (len < 0) {
         DEBUG("lwip_netdev: an error occurred while reading the packet\n");
         return NULL;
     }
-    assert(((unsigned)len) <= UINT16_MAX);
-    struct pbuf *p = pbuf_alloc(PBUF_RAW, (u16_t)len, PBUF_POOL);
+    if (len > LWIP_NETDEV_BUFLEN) {
+        DEBUG("lwip_netdev: dropping packet of %d bytes\n", len);
+        dev->driver->recv(dev, NULL, len, NULL);
+        return NULL;
+    }
+    /* PBUF_RAM is contiguous, so the device copies the frame straight into
+     * the pbuf handed to the stack (the pools are allocated from the heap
+     * anyway as MEMP_MEM_MALLOC is set) */
+    struct pbuf *p = pbuf_alloc(PBUF_RAW, (u16_t)len, PBUF_RAM);
 
     if (p == NULL) {
         DEBUG("lwip_netdev: can not allocate in pbuf\n");
+        dev->driver->recv(dev, NULL, len, NULL);
+        return NULL;
+    }
+    len = dev->driver->recv(dev, p->payload, len, NULL);
+    if (len < 0) {
+        DEBUG("lwip_netdev: an error occurred while reading the packet\n");
+        pbuf_free(p);
         return NULL;
     }
-    pbuf_take(p, _tmp_buf, len);
+    pbuf_realloc(p, (u16_t)len);
     return p;
 }
 
+static void _handle_stack_events(void);
+
+static void _queue_stack_event(struct netif *netif, struct pbuf *p,
+                               netdev_event_t event)
+{
+    if (_stack_events_numof == ARRAY_SIZE(_stack_events)) {
+        DEBUG("lwip_netdev: dropping event %d\n", event);
+        if (p != NULL) {
+            pbuf_free(p);
+        }
+        return;
+    }
+    _stack_events[_stack_events_numof++] = (_stack_event_t){
+        .netif = netif, .p = p, .event = event,
+    };
+    /* e.g. link events while initializing the device */
+    if (thread_getpid() != _pid) {
+        _handle_stack_events();
+    }
+}
+
+/* called without the device lock */
+static void _handle_stack_events(void)
+{
+    for (unsigned i = 0; i < _stack_events_numof; i++) {
+        _stack_event_t *ev = &_stack_events[i];
+
+        switch (ev->event) {
+        case NETDEV_EVENT_RX_COMPLETE:
+            /* with LWIP_TCPIP_CORE_LOCKING_INPUT the packet is processed
+             * right here with the core lock held, instead of being passed
+             * to the TCP/IP thread */
+            if (ev->netif->input(ev->p, ev->netif) != ERR_OK) {
+                DEBUG("lwip_netdev: error inputing packet\n");
+                pbuf_free(ev->p);
+            }
+            break;
+        case NETDEV_EVENT_LINK_UP:
+            /* Will wake up DHCP state machine */
+            netifapi_netif_set_link_up(ev->netif);
+            break;
+        case NETDEV_EVENT_LINK_DOWN:
+            netifapi_netif_set_link_down(ev->netif);
+            break;
+        default:
+            break;
+        }
+    }
+    _stack_events_numof = 0;
+}
+
 static void _event_cb(netdev_t *dev, netdev_event_t event)
 {
     if (event == NETDEV_EVENT_ISR) {
@@ -303,21 +381,13 @@ static void _event_cb(netdev_t *dev, netdev_event_t event)
                 DEBUG("lwip_netdev: error receiving packet\n");
                 return;
             }
-            if (netif->input(p, netif) != ERR_OK) {
-                DEBUG("lwip_netdev: error inputing packet\n");
-                return;
-            }
+            _queue_stack_event(netif, p, event);
             break;
         }
-        case NETDEV_EVENT_LINK_UP: {
-            /* Will wake up DHCP state machine */
-            netifapi_netif_set_link_up(netif);
+        case NETDEV_EVENT_LINK_UP:      /* fall through */
+        case NETDEV_EVENT_LINK_DOWN:
+            _queue_stack_event(netif, NULL, event);
             break;
-        }
-        case NETDEV_EVENT_LINK_DOWN: {
-            netifapi_netif_set_link_down(netif);
-            break;
-        }
         default:
             break;
         }
@@ -326,19 +396,23 @@ static void _event_cb(netdev_t *dev, netdev_event_t event)
 
 static void *_event_loop(void *arg)
 {
-    struct netif *netif = arg;
+    (void)arg;
     msg_init_queue(_queue, LWIP_NETDEV_QUEUE_LEN);
     while (1) {
         msg_t msg;
         msg_receive(&msg);
         if (msg.type == LWIP_NETDEV_MSG_TYPE_EVENT) {
             netdev_t *dev = msg.content.ptr;
+            lwip_netif_t *compat_netif = dev->context;
+            struct netif *netif = &compat_netif->lwip_netif;
             lwip_netif_dev_acquire(netif);
             dev->driver->isr(dev);
             lwip_netif_dev_release(netif);
+            _handle_stack_events();
         }
         else if (IS_USED(MODULE_BHP_MSG) && msg.type == BHP_MSG_BH_REQUEST) {
             bhp_msg_handler(&msg);
+            _handle_stack_events();
         }
     }
     return NULL;
@@ -165,6 +165,12 @@ extern "C" {
 #define TCPIP_THREAD_STACKSIZE  (THREAD_STACKSIZE_DEFAULT)
 #endif
 
+/* process received packets in the netdev thread with the core lock held
+ * instead of passing each one to the TCP/IP thread */
+#ifndef LWIP_TCPIP_CORE_LOCKING_INPUT
+#define LWIP_TCPIP_CORE_LOCKING_INPUT   1
+#endif
+
 #define MEM_ALIGNMENT           4
 #ifndef MEM_SIZE
 /* packet buffer size of GNRC + stack for TCP/IP */
@@ -69,6 +69,7 @@
 #include <stdint.h>
 #include <errno.h>
 
+#include "kernel_defines.h"
 #include "net/ble.h"
 #include "nimble_riot.h"
 
@@ -170,6 +171,43 @@ typedef struct {
 #define NIMBLE_NETIF_CONN_ITVL_SPACING          0
 #endif
 
+/**
+ * @brief   Number of SDUs that are queued per connection while its L2CAP
+ *          channel is busy
+ *
+ * NimBLE accepts a single SDU per L2CAP channel at a time. Further SDUs are
+ * queued per connection and passed to NimBLE as soon as the channel is
+ * unstalled, so the netif thread does not wait for a slow connection while
+ * others could transmit. Only once the queue of a connection is full, sending
+ * to that connection blocks.
+ *
+ * @note    Must be at least 1
+ */
+#ifndef NIMBLE_NETIF_TX_QUEUE_LEN
+#define NIMBLE_NETIF_TX_QUEUE_LEN               4
+#endif
+
+/**
+ * @brief   Maximum LL payload size requested for each new connection [byte]
+ *
+ * When both controllers support the data length extension, a payload of up to
+ * 251 bytes per LL packet reduces the per packet overhead significantly. Set to
+ * 0 to keep the controller's default of 27 bytes.
+ */
+#ifndef NIMBLE_NETIF_DATA_LEN
+#define NIMBLE_NETIF_DATA_LEN                   251
+#endif
+
+/**
+ * @brief   Request the 2M PHY for each new connection
+ *
+ * The PHY is only switched if the peer supports it. Enabled by default if
+ * the `nimble_phy_2mbit` module is used.
+ */
+#ifndef NIMBLE_NETIF_PREFER_2M
+#define NIMBLE_NETIF_PREFER_2M                  IS_USED(MODULE_NIMBLE_PHY_2MBIT)
+#endif
+
 /**
  * @brief   Event types triggered by the NimBLE netif module
  */
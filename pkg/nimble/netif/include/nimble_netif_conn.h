@@ -46,6 +46,12 @@ typedef struct {
     uint16_t state;                 /**< the current state of the context */
     uint8_t addr[BLE_ADDR_LEN];     /**< BLE address of connected peer
                                          (in network byte order) */
+    uint8_t txq_first;              /**< index of the oldest queued SDU */
+    uint8_t txq_len;                /**< number of queued SDUs */
+    /**
+     * @brief   SDUs waiting for the L2CAP channel to become available
+     */
+    struct os_mbuf *txq[NIMBLE_NETIF_TX_QUEUE_LEN];
 } nimble_netif_conn_t;
 
 /**
@@ -22,6 +22,7 @@
 #include <errno.h>
 
 #include "assert.h"
+#include "mutex.h"
 #include "thread.h"
 #include "thread_flags.h"
 
@@ -64,6 +65,13 @@
 #define FLAG_TX_NOTCONN         (1u << 12)
 #define FLAG_ALL                (FLAG_TX_UNSTALLED | FLAG_TX_NOTCONN)
 
+/* LL packet transmission time on the 1M PHY for the given payload size, as
+ * expected by the data length extension */
+#define DATA_LEN_TX_TIME(len)   (((len) + 14) * 8)
+
+static_assert(NIMBLE_NETIF_TX_QUEUE_LEN > 0,
+              "NIMBLE_NETIF_TX_QUEUE_LEN must be at least 1");
+
 /* allocate a stack for the netif device */
 static char _stack[THREAD_STACKSIZE_DEFAULT];
 static thread_t *_netif_thread;
@@ -75,6 +83,10 @@ static gnrc_nettype_t _nettype = NETTYPE;
 /* keep a reference to the event callback */
 static nimble_netif_eventcb_t _eventcb;
 
+/* protects the TX queues, which are filled by the netif thread and drained
+ * by the NimBLE host thread */
+static mutex_t _txq_lock = MUTEX_INIT;
+
 /* notify the user about state changes for a connection context */
 static void _notify(int handle, nimble_netif_event_t event, uint8_t *addr)
 {
@@ -105,6 +117,53 @@ static int _netif_init(gnrc_netif_t *netif)
     return res;
 }
 
+static void _txq_push(nimble_netif_conn_t *conn, struct os_mbuf *sdu)
+{
+    unsigned pos = (conn->txq_first + conn->txq_len++) % NIMBLE_NETIF_TX_QUEUE_LEN;
+    conn->txq[pos] = sdu;
+}
+
+static struct os_mbuf *_txq_pop(nimble_netif_conn_t *conn)
+{
+    struct os_mbuf *sdu = conn->txq[conn->txq_first];
+    conn->txq_first = (conn->txq_first + 1) % NIMBLE_NETIF_TX_QUEUE_LEN;
+    conn->txq_len--;
+    return sdu;
+}
+
+/* pass queued SDUs to NimBLE once the previous one is out, called from the
+ * NimBLE host thread */
+static void _on_tx_unstalled(nimble_netif_conn_t *conn)
+{
+    mutex_lock(&_txq_lock);
+    while (conn->txq_len > 0) {
+        struct os_mbuf *sdu = conn->txq[conn->txq_first];
+        int res = ble_l2cap_send(conn->coc, sdu);
+        if (res == BLE_HS_EBUSY) {
+            break;
+        }
+        _txq_pop(conn);
+        if ((res != 0) && (res != BLE_HS_ESTALLED)) {
+            os_mbuf_free_chain(sdu);
+        }
+        if (res == BLE_HS_ESTALLED) {
+            break;
+        }
+    }
+    mutex_unlock(&_txq_lock);
+
+    thread_flags_set(_netif_thread, FLAG_TX_UNSTALLED);
+}
+
+static void _txq_flush(nimble_netif_conn_t *conn)
+{
+    mutex_lock(&_txq_lock);
+    while (conn->txq_len > 0) {
+        os_mbuf_free_chain(_txq_pop(conn));
+    }
+    mutex_unlock(&_txq_lock);
+}
+
 static int _send_pkt(nimble_netif_conn_t *conn, gnrc_pktsnip_t *pkt)
 {
     int res;
@@ -129,17 +188,35 @@ static int _send_pkt(nimble_netif_conn_t *conn, gnrc_pktsnip_t *pkt)
         pkt = pkt->next;
     }
 
-    /* send packet via the given L2CAP COC */
-    do {
-        res = ble_l2cap_send(conn->coc, sdu);
-        if (res == BLE_HS_EBUSY) {
-            thread_flags_t state = thread_flags_wait_any(FLAG_ALL);
-            /* abort if the active connection was lost in the mean time */
-            if ((state & FLAG_TX_NOTCONN) && !nimble_netif_conn_is_open(conn)) {
-                return -ECONNRESET;
+    /* send packet via the given L2CAP COC, or queue it while the channel is
+     * busy with a previous SDU */
+    mutex_lock(&_txq_lock);
+    while (1) {
+        if (conn->txq_len == 0) {
+            res = ble_l2cap_send(conn->coc, sdu);
+            if (res != BLE_HS_EBUSY) {
+                break;
             }
         }
-    } while (res == BLE_HS_EBUSY);
+        if (conn->txq_len < NIMBLE_NETIF_TX_QUEUE_LEN) {
+            _txq_push(conn, sdu);
+            res = 0;
+            break;
+        }
+
+        /* the queue is full, wait for the channel to drain it */
+        mutex_unlock(&_txq_lock);
+        thread_flags_t state = thread_flags_wait_any(FLAG_ALL);
+        mutex_lock(&_txq_lock);
+        /* abort if the active connection was lost in the mean time */
+        if (((state & FLAG_TX_NOTCONN) && !nimble_netif_conn_is_open(conn)) ||
+            (conn->coc == NULL)) {
+            mutex_unlock(&_txq_lock);
+            os_mbuf_free_chain(sdu);
+            return -ECONNRESET;
+        }
+    }
+    mutex_unlock(&_txq_lock);
 
     if ((res != 0) && (res != BLE_HS_ESTALLED)) {
         os_mbuf_free_chain(sdu);
@@ -348,6 +425,7 @@ static int _on_l2cap_client_evt(struct ble_l2cap_event *event, void *arg)
             break;
         case BLE_L2CAP_EVENT_COC_DISCONNECTED:
             assert(conn->state & NIMBLE_NETIF_L2CAP_CLIENT);
+            _txq_flush(conn);
             conn->state &= ~NIMBLE_NETIF_L2CAP_CONNECTED;
             break;
         case BLE_L2CAP_EVENT_COC_ACCEPT:
@@ -358,7 +436,7 @@ static int _on_l2cap_client_evt(struct ble_l2cap_event *event, void *arg)
             _on_data(conn, event);
             break;
         case BLE_L2CAP_EVENT_COC_TX_UNSTALLED:
-            thread_flags_set(_netif_thread, FLAG_TX_UNSTALLED);
+            _on_tx_unstalled(conn);
             break;
         default:
             break;
@@ -404,6 +482,7 @@ static int _on_l2cap_server_evt(struct ble_l2cap_event *event, void *arg)
         case BLE_L2CAP_EVENT_COC_DISCONNECTED:
             conn = nimble_netif_conn_from_gaphandle(event->disconnect.conn_handle);
             assert(conn && (conn->state & NIMBLE_NETIF_L2CAP_SERVER));
+            _txq_flush(conn);
             conn->coc = NULL;
             conn->state &= ~NIMBLE_NETIF_L2CAP_CONNECTED;
             break;
@@ -421,7 +500,9 @@ static int _on_l2cap_server_evt(struct ble_l2cap_event *event, void *arg)
             _on_data(conn, event);
             break;
         case BLE_L2CAP_EVENT_COC_TX_UNSTALLED:
-            thread_flags_set(_netif_thread, FLAG_TX_UNSTALLED);
+            conn = nimble_netif_conn_from_gaphandle(event->tx_unstalled.conn_handle);
+            assert(conn);
+            _on_tx_unstalled(conn);
             break;
         default:
             break;
@@ -440,6 +521,21 @@ static void _on_gap_connected(nimble_netif_conn_t *conn, uint16_t conn_handle)
     conn->gaphandle = conn_handle;
     conn->itvl = desc.conn_itvl;
     bluetil_addr_swapped_cp(desc.peer_id_addr.val, conn->addr);
+
+    /* ask for larger LL packets and the faster PHY, the controller negotiates
+     * them with the peer in the background. Failing to do so is not fatal,
+     * the connection simply keeps the default parameters. */
+    if (NIMBLE_NETIF_DATA_LEN > 0) {
+        res = ble_gap_set_data_len(conn_handle, NIMBLE_NETIF_DATA_LEN,
+                                   DATA_LEN_TX_TIME(NIMBLE_NETIF_DATA_LEN));
+        DEBUG("[nimble_netif] set data length: %d\n", res);
+    }
+    if (NIMBLE_NETIF_PREFER_2M) {
+        res = ble_gap_set_prefered_le_phy(conn_handle, BLE_GAP_LE_PHY_2M_MASK,
+                                          BLE_GAP_LE_PHY_2M_MASK,
+                                          BLE_GAP_LE_PHY_CODED_ANY);
+        DEBUG("[nimble_netif] prefer 2M PHY: %d\n", res);
+    }
 }
 
 static void _on_gap_param_update(int handle, nimble_netif_conn_t *conn)
@@ -491,6 +587,7 @@ static int _on_gap_master_evt(struct ble_gap_event *event, void *arg)
             type = (conn->coc != NULL) ? NIMBLE_NETIF_CLOSED_MASTER
                                        : NIMBLE_NETIF_ABORT_MASTER;
             uint8_t addr[BLE_ADDR_LEN];
+            _txq_flush(conn);
             nimble_netif_conn_free(handle, addr);
             thread_flags_set(_netif_thread, FLAG_TX_NOTCONN);
             _notify(handle, type, addr);
@@ -535,6 +632,7 @@ static int _on_gap_slave_evt(struct ble_gap_event *event, void *arg)
             type = (conn->coc != NULL) ? NIMBLE_NETIF_CLOSED_SLAVE
                                        : NIMBLE_NETIF_ABORT_SLAVE;
             uint8_t addr[BLE_ADDR_LEN];
+            _txq_flush(conn);
             nimble_netif_conn_free(handle, addr);
             thread_flags_set(_netif_thread, FLAG_TX_NOTCONN);
             _notify(handle, type, addr);
@@ -35,7 +35,9 @@
 
 static otInstance *sInstance;   /**< global OpenThread instance */
 static netdev_t *_dev;          /**< netdev descriptor for OpenThread */
+#if !IS_USED(MODULE_OPENTHREAD_EVENT_THREAD)
 static event_queue_t ev_queue;  /**< the event queue for OpenThread */
+#endif
 
 static void _ev_isr_handler(event_t *event)
 {
@@ -49,7 +51,11 @@ static event_t ev_isr = {
 
 event_queue_t *openthread_get_evq(void)
 {
+#if IS_USED(MODULE_OPENTHREAD_EVENT_THREAD)
+    return OPENTHREAD_EVENT_THREAD_QUEUE;
+#else
     return &ev_queue;
+#endif
 }
 
 otInstance* openthread_get_instance(void)
@@ -60,7 +66,7 @@ otInstance* openthread_get_instance(void)
 static void _event_cb(netdev_t *dev, netdev_event_t event) {
     switch (event) {
         case NETDEV_EVENT_ISR:
-            event_post(&ev_queue, &ev_isr);
+            event_post(openthread_get_evq(), &ev_isr);
             break;
         case NETDEV_EVENT_RX_COMPLETE:
             DEBUG("openthread_netdev: Reception of a packet\n");
@@ -77,13 +83,8 @@ static void _event_cb(netdev_t *dev, netdev_event_t event) {
     }
 }
 
-static void *_openthread_event_loop(void *arg)
+static void _openthread_init(netdev_t *netdev)
 {
-    _dev = arg;
-    netdev_t *netdev = arg;
-
-    event_queue_init(&ev_queue);
-
     netdev->driver->init(netdev);
     netdev->event_callback = _event_cb;
 
@@ -112,6 +113,23 @@ static void *_openthread_event_loop(void *arg)
 #if OPENTHREAD_ENABLE_DIAG
     diagInit(sInstance);
 #endif
+}
+
+#if IS_USED(MODULE_OPENTHREAD_EVENT_THREAD)
+static void _ev_init_handler(event_t *event)
+{
+    (void) event;
+    _openthread_init(_dev);
+}
+
+static event_t ev_init = {
+    .handler = _ev_init_handler
+};
+#else
+static void *_openthread_event_loop(void *arg)
+{
+    event_queue_init(&ev_queue);
+    _openthread_init(arg);
 
     while (1) {
         event_loop(&ev_queue);
@@ -119,15 +137,27 @@ static void *_openthread_event_loop(void *arg)
 
     return NULL;
 }
+#endif
 
 /* starts OpenThread thread */
 int openthread_netdev_init(char *stack, int stacksize, char priority,
                            const char *name, netdev_t *netdev) {
+    _dev = netdev;
+
+#if IS_USED(MODULE_OPENTHREAD_EVENT_THREAD)
+    (void)stack;
+    (void)stacksize;
+    (void)priority;
+    (void)name;
+    /* OpenThread must only be called from the thread of its queue */
+    event_post(openthread_get_evq(), &ev_init);
+#else
     if (thread_create(stack, stacksize,
                          priority, THREAD_CREATE_STACKTEST,
                          _openthread_event_loop, netdev, name) < 0) {
         return -EINVAL;
     }
+#endif
 
     return 0;
 }
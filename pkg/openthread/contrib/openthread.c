@@ -72,7 +72,9 @@ static netdev_ieee802154_submac_t nrf802154_netdev;
 
 static uint8_t rx_buf[OPENTHREAD_NETDEV_BUFLEN];
 static uint8_t tx_buf[OPENTHREAD_NETDEV_BUFLEN];
+#if !IS_USED(MODULE_OPENTHREAD_EVENT_THREAD)
 static char ot_thread_stack[2 * THREAD_STACKSIZE_MAIN];
+#endif
 
 void openthread_bootstrap(void)
 {
@@ -101,5 +103,9 @@ void openthread_bootstrap(void)
 #endif
 
     openthread_radio_init(netdev, tx_buf, rx_buf);
+#if IS_USED(MODULE_OPENTHREAD_EVENT_THREAD)
+    openthread_netdev_init(NULL, 0, 0, NULL, netdev);
+#else
     openthread_netdev_init(ot_thread_stack, sizeof(ot_thread_stack), THREAD_PRIORITY_MAIN - 5, "openthread", netdev);
+#endif
 }
@@ -40,11 +40,18 @@ static otRadioFrame sReceiveFrame;
 static int8_t Rssi;
 
 static netdev_t *_dev;
+static uint16_t _channel;   /**< channel last set, 0 if unknown */
 
-/* set 15.4 channel */
+/* set 15.4 channel, OpenThread sets it before every RX and TX */
 static int _set_channel(uint16_t channel)
 {
-    return _dev->driver->set(_dev, NETOPT_CHANNEL, &channel, sizeof(uint16_t));
+    if (channel == _channel) {
+        return sizeof(uint16_t);
+    }
+
+    int res = _dev->driver->set(_dev, NETOPT_CHANNEL, &channel, sizeof(uint16_t));
+    _channel = (res < 0) ? 0 : channel;
+    return res;
 }
 
 /* set transmission power */
@@ -110,6 +117,8 @@ static netopt_state_t _get_state(void)
 static void _set_off(void)
 {
     _set_state(NETOPT_STATE_OFF);
+    /* don't rely on the device keeping its configuration */
+    _channel = 0;
 }
 
 /* sets device state to SLEEP */
@@ -139,12 +148,13 @@ void recv_pkt(otInstance *aInstance, netdev_t *dev)
 {
     DEBUG("Openthread: Received pkt\n");
     netdev_ieee802154_rx_info_t rx_info;
-    /* Read frame length from driver */
-    int len = dev->driver->recv(dev, NULL, 0, NULL);
 
-    /* very unlikely */
-    if ((len < 0) || ((uint32_t)len > UINT16_MAX)) {
-        DEBUG("Invalid len: %d\n", len);
+    /* Read received frame directly into the OpenThread receive frame, the
+     * buffer fits every 802.15.4 frame so the length needs no extra query */
+    int res = dev->driver->recv(dev, (char *) sReceiveFrame.mPsdu,
+                                OPENTHREAD_NETDEV_BUFLEN, &rx_info);
+    if (res <= 0) {
+        DEBUG("Invalid len: %d\n", res);
         otPlatRadioReceiveDone(aInstance, NULL, OT_ERROR_ABORT);
         return;
     }
@@ -152,10 +162,7 @@ void recv_pkt(otInstance *aInstance, netdev_t *dev)
     /* Fill OpenThread receive frame */
     /* Openthread needs a packet length with FCS included,
      * OpenThread do not use the data so we don't need to calculate FCS */
-    sReceiveFrame.mLength = len + RADIO_IEEE802154_FCS_LEN;
-
-    /* Read received frame */
-    int res = dev->driver->recv(dev, (char *) sReceiveFrame.mPsdu, len, &rx_info);
+    sReceiveFrame.mLength = res + RADIO_IEEE802154_FCS_LEN;
 
     /* Get RSSI from a radio driver. RSSI should be in [dBm] */
     Rssi = (int8_t)rx_info.rssi;
@@ -168,7 +175,7 @@ void recv_pkt(otInstance *aInstance, netdev_t *dev)
     }
 
     /* Tell OpenThread that receive has finished */
-    otPlatRadioReceiveDone(aInstance, res > 0 ? &sReceiveFrame : NULL, res > 0 ? OT_ERROR_NONE : OT_ERROR_ABORT);
+    otPlatRadioReceiveDone(aInstance, &sReceiveFrame, OT_ERROR_NONE);
 }
 
 /* Called upon TX event */
@@ -366,8 +373,10 @@ otRadioCaps otPlatRadioGetCaps(otInstance *aInstance)
 {
     (void)aInstance;
     DEBUG("openthread: otPlatRadioGetCaps\n");
-    /* all drivers should handle ACK, including call of NETDEV_EVENT_TX_NOACK */
-    return OT_RADIO_CAPS_TRANSMIT_RETRIES | OT_RADIO_CAPS_ACK_TIMEOUT;
+    /* all drivers should handle ACK, including call of NETDEV_EVENT_TX_NOACK,
+     * and CSMA-CA, including call of NETDEV_EVENT_TX_MEDIUM_BUSY */
+    return OT_RADIO_CAPS_TRANSMIT_RETRIES | OT_RADIO_CAPS_ACK_TIMEOUT |
+           OT_RADIO_CAPS_CSMA_BACKOFF;
 }
 
 /* OpenThread will call this for getting the state of promiscuous mode */
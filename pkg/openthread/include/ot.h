@@ -57,6 +57,7 @@
 extern "C" {
 #endif
 
+#include "kernel_defines.h"
 #include "net/netopt.h"
 #include "net/ieee802154.h"
 #include "net/ethernet.h"
@@ -64,6 +65,9 @@ extern "C" {
 #include "thread.h"
 #include "openthread/instance.h"
 #include "event.h"
+#if IS_USED(MODULE_OPENTHREAD_EVENT_THREAD)
+#include "event/thread.h"
+#endif
 
 /**
  * @name    Openthread constants
@@ -91,6 +95,13 @@ extern "C" {
 #define OPENTHREAD_NETDEV_BUFLEN                            (IEEE802154_MAX_LENGTH)
 /** @} */
 
+/**
+ * @brief   The event queue OpenThread runs on if openthread_event_thread is used
+ */
+#ifndef OPENTHREAD_EVENT_THREAD_QUEUE
+#define OPENTHREAD_EVENT_THREAD_QUEUE                       EVENT_PRIO_MEDIUM
+#endif
+
 /**
  * @brief   Struct containing a serial message
  */
@@ -135,6 +146,10 @@ void send_pkt(otInstance *aInstance, netdev_t *dev, netdev_event_t event);
 /**
  * @brief Get OpenThread event queue
  *
+ * If openthread_event_thread is used, this is
+ * @ref OPENTHREAD_EVENT_THREAD_QUEUE of the @ref sys_event_thread module.
+ * Otherwise OpenThread runs its own thread and queue.
+ *
  * @return pointer to the event queue
  */
 event_queue_t *openthread_get_evq(void);
@@ -163,6 +178,10 @@ void openthread_radio_init(netdev_t *dev, uint8_t *tb, uint8_t *rb);
 /**
  * @brief   Starts OpenThread thread.
  *
+ * If openthread_event_thread is used, no thread is started and the first four
+ * parameters are ignored. OpenThread is initialized on its event queue
+ * instead.
+ *
  * @param[in]  stack              pointer to the stack designed for OpenThread
  * @param[in]  stacksize          size of the stack
  * @param[in]  priority           priority of the OpenThread stack
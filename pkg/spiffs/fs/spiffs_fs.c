@@ -203,7 +203,7 @@ static int _umount(vfs_mount_t *mountp)
 
     SPIFFS_unmount(&fs_desc->fs);
 
-    return 0;
+    return mtd_flush(_get_mtd(fs_desc));
 }
 
 static int _unlink(vfs_mount_t *mountp, const char *name)
@@ -330,13 +330,26 @@ static off_t _lseek(vfs_file_t *filp, off_t off, int whence)
     return spiffs_err_to_errno(SPIFFS_lseek(&fs_desc->fs, filp->private_data.value, off, s_whence));
 }
 
+static mtd_dev_t *_get_mtd(spiffs_desc_t *fs_desc)
+{
+#if SPIFFS_HAL_CALLBACK_EXTRA == 1
+    return fs_desc->dev;
+#else
+    (void)fs_desc;
+    return SPIFFS_MTD_DEV;
+#endif
+}
+
 static int _fsync(vfs_file_t *filp)
 {
     spiffs_desc_t *fs_desc = filp->mp->private_data;
 
     int ret = SPIFFS_fflush(&fs_desc->fs, filp->private_data.value);
 
-    return spiffs_err_to_errno(ret);
+    if (ret < 0) {
+        return spiffs_err_to_errno(ret);
+    }
+    return mtd_flush(_get_mtd(fs_desc));
 }
 
 static int _fstat(vfs_file_t *filp, struct stat *buf)
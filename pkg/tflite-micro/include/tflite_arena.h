@@ -0,0 +1,94 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    pkg_tflite-micro_arena  Tensor arena
+ * @ingroup     pkg_tflite-micro
+ * @brief       Statically allocated tensor arena sized from the model
+ *
+ * If `TFLITE_MODEL` is set to the `.tflite` file of the application in its
+ * Makefile, the size of the arena is computed from the model at build time
+ * by `dist/tools/tflite_arena/tflite_arena.py`. `TFLITE_ARENA_MARGIN` sets
+ * the margin in percent added for scratch buffers of the kernels (default:
+ * 10). Without a model, @ref CONFIG_TFLITE_ARENA_SIZE is used.
+ *
+ * The arena is placed in the `.noinit` section on Cortex-M, so it is not
+ * cleared on startup. Define @ref TFLITE_ARENA_ATTRS to place it in a
+ * different (e.g. a faster tightly coupled) RAM.
+ *
+ * ~~~~~~~~~~~~~~~~ {.cpp}
+ * TFLITE_ARENA_DEFINE(tensor_arena);
+ *
+ * static tflite::MicroInterpreter interpreter(model, resolver, tensor_arena,
+ *                                             sizeof(tensor_arena),
+ *                                             error_reporter);
+ * ~~~~~~~~~~~~~~~~
+ *
+ * @{
+ *
+ * @file
+ */
+
+#ifndef TFLITE_ARENA_H
+#define TFLITE_ARENA_H
+
+#include <stdint.h>
+
+#ifdef TFLITE_ARENA_GENERATED
+#include "tflite_arena_size.h"
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Size of the tensor arena in bytes
+ *
+ * Defaults to the size computed from `TFLITE_MODEL` if set.
+ */
+#ifndef CONFIG_TFLITE_ARENA_SIZE
+#ifdef TFLITE_ARENA_SIZE_MODEL
+#define CONFIG_TFLITE_ARENA_SIZE    TFLITE_ARENA_SIZE_MODEL
+#else
+#define CONFIG_TFLITE_ARENA_SIZE    (8 * 1024U)
+#endif
+#endif
+
+/**
+ * @brief   Alignment of the tensor arena, matches the alignment of the
+ *          buffers planned in it
+ */
+#define TFLITE_ARENA_ALIGNMENT      (16)
+
+/**
+ * @brief   Additional attributes of the tensor arena, e.g. its section
+ */
+#ifndef TFLITE_ARENA_ATTRS
+#ifdef MODULE_CORTEXM_COMMON
+#define TFLITE_ARENA_ATTRS          __attribute__((section(".noinit")))
+#else
+#define TFLITE_ARENA_ATTRS
+#endif
+#endif
+
+/**
+ * @brief   Defines a tensor arena of @ref CONFIG_TFLITE_ARENA_SIZE bytes
+ *
+ * @param   name    name of the arena
+ */
+#define TFLITE_ARENA_DEFINE(name) \
+    static uint8_t name[CONFIG_TFLITE_ARENA_SIZE] \
+        __attribute__((aligned(TFLITE_ARENA_ALIGNMENT))) TFLITE_ARENA_ATTRS
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TFLITE_ARENA_H */
+/** @} */
@@ -3,4 +3,9 @@ MODULE = tflite-micro-kernels
 SRCXXEXT = cc
 SRCXXEXCLUDE = $(wildcard *_test.$(SRCXXEXT))
 
+# The optimized kernels replace the reference kernels of the same name
+ifneq (,$(filter tflite-micro-kernels-cmsis-nn,$(USEMODULE)))
+  SRCXXEXCLUDE += $(notdir $(wildcard cmsis_nn/*.$(SRCXXEXT)))
+endif
+
 include $(RIOTBASE)/Makefile.base
@@ -0,0 +1,131 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    pkg_wamr_runtime Shared WAMR runtime
+ * @ingroup     pkg_wamr
+ * @brief       Single WAMR runtime shared by all WebAssembly applications
+ *
+ * The runtime is initialized once and then used to load, run and unload any
+ * number of modules, in bytecode or AOT format. All memory of the runtime,
+ * the modules and their instances is allocated from a dedicated TLSF pool of
+ * @ref CONFIG_WAMR_RUNTIME_POOL_SIZE bytes, so WebAssembly applications can
+ * neither exhaust nor fragment the system heap.
+ *
+ * Native functions are registered with the WAMR API (e.g.
+ * `wasm_runtime_register_natives()`) after @ref wamr_runtime_init().
+ *
+ * @{
+ *
+ * @file
+ */
+
+#ifndef WAMR_RUNTIME_H
+#define WAMR_RUNTIME_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "wasm_export.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Size of the memory pool of the runtime in bytes
+ */
+#ifndef CONFIG_WAMR_RUNTIME_POOL_SIZE
+#define CONFIG_WAMR_RUNTIME_POOL_SIZE   (32U * 1024)
+#endif
+
+/**
+ * @brief   Size of the WebAssembly stack of an instance in bytes
+ */
+#ifndef CONFIG_WAMR_RUNTIME_STACK_SIZE
+#define CONFIG_WAMR_RUNTIME_STACK_SIZE  (8U * 1024)
+#endif
+
+/**
+ * @brief   Size of the heap of an instance in bytes
+ */
+#ifndef CONFIG_WAMR_RUNTIME_HEAP_SIZE
+#define CONFIG_WAMR_RUNTIME_HEAP_SIZE   (8U * 1024)
+#endif
+
+/**
+ * @brief   Module loaded into the runtime
+ */
+typedef struct {
+    wasm_module_t module;           /**< loaded module */
+    wasm_module_inst_t inst;        /**< instance of the module */
+} wamr_app_t;
+
+/**
+ * @brief   Initializes the runtime
+ *
+ * Does nothing if the runtime is already initialized.
+ *
+ * @retval  0 on success
+ * @retval  -ENOMEM if the runtime could not be initialized
+ */
+int wamr_runtime_init(void);
+
+/**
+ * @brief   Loads and instantiates a module
+ *
+ * @p code is bytecode or an AOT module built by wamrc, the format is detected
+ * from its header. Bytecode is modified while loading. @p code must stay
+ * valid until the module is unloaded.
+ *
+ * @param[out] app          loaded module
+ * @param[in] code          module to load
+ * @param[in] len           length of @p code
+ * @param[out] error        buffer for an error message, may be NULL
+ * @param[in] error_len     size of @p error
+ *
+ * @retval  0 on success
+ * @retval  -EINVAL if @p code could not be loaded
+ * @retval  -ENOMEM if the module could not be instantiated
+ */
+int wamr_runtime_load(wamr_app_t *app, uint8_t *code, size_t len,
+                      char *error, size_t error_len);
+
+/**
+ * @brief   Runs the main function of a loaded module
+ *
+ * @param[in] app           module to run
+ * @param[in] argc          number of arguments
+ * @param[in] argv          arguments
+ *
+ * @return  return value of the main function
+ * @retval  -ECANCELED if the module raised an exception
+ */
+int wamr_runtime_exec_main(wamr_app_t *app, int argc, char **argv);
+
+/**
+ * @brief   Unloads a module and frees its memory
+ *
+ * @param[in] app           module to unload
+ */
+void wamr_runtime_unload(wamr_app_t *app);
+
+/**
+ * @brief   Returns the use of the memory pool
+ *
+ * @param[out] used         bytes allocated, may be NULL
+ * @param[out] avail        bytes free, may be NULL
+ */
+void wamr_runtime_pool_usage(size_t *used, size_t *avail);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* WAMR_RUNTIME_H */
+/** @} */
@@ -0,0 +1,190 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     pkg_wamr_runtime
+ * @{
+ *
+ * @file
+ * @brief       Shared WAMR runtime implementation
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "mutex.h"
+#include "tlsf.h"
+#include "wamr_runtime.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+static uint8_t _pool[CONFIG_WAMR_RUNTIME_POOL_SIZE] __attribute__((aligned(8)));
+static tlsf_t _tlsf;
+/* WAMR allocates from every thread running a module */
+static mutex_t _pool_lock = MUTEX_INIT;
+static mutex_t _init_lock = MUTEX_INIT;
+static bool _initialized;
+
+static void *_malloc(unsigned int size)
+{
+    mutex_lock(&_pool_lock);
+    void *ptr = tlsf_malloc(_tlsf, size);
+    mutex_unlock(&_pool_lock);
+    return ptr;
+}
+
+static void *_realloc(void *ptr, unsigned int size)
+{
+    mutex_lock(&_pool_lock);
+    ptr = tlsf_realloc(_tlsf, ptr, size);
+    mutex_unlock(&_pool_lock);
+    return ptr;
+}
+
+static void _free(void *ptr)
+{
+    mutex_lock(&_pool_lock);
+    tlsf_free(_tlsf, ptr);
+    mutex_unlock(&_pool_lock);
+}
+
+int wamr_runtime_init(void)
+{
+    int res = 0;
+
+    mutex_lock(&_init_lock);
+    if (_initialized) {
+        goto out;
+    }
+
+    _tlsf = tlsf_create_with_pool(_pool, sizeof(_pool));
+    if (_tlsf == NULL) {
+        res = -ENOMEM;
+        goto out;
+    }
+
+    RuntimeInitArgs init_args;
+    memset(&init_args, 0, sizeof(init_args));
+    init_args.mem_alloc_type = Alloc_With_Allocator;
+    init_args.mem_alloc_option.allocator.malloc_func = _malloc;
+    init_args.mem_alloc_option.allocator.realloc_func = _realloc;
+    init_args.mem_alloc_option.allocator.free_func = _free;
+
+    if (!wasm_runtime_full_init(&init_args)) {
+        DEBUG_PUTS("wamr_runtime: init failed");
+        res = -ENOMEM;
+        goto out;
+    }
+    _initialized = true;
+
+out:
+    mutex_unlock(&_init_lock);
+    return res;
+}
+
+int wamr_runtime_load(wamr_app_t *app, uint8_t *code, size_t len,
+                      char *error, size_t error_len)
+{
+    char buf[1];
+
+    if (error == NULL) {
+        error = buf;
+        error_len = sizeof(buf);
+    }
+
+    app->module = wasm_runtime_load(code, len, error, error_len);
+    if (app->module == NULL) {
+        DEBUG("wamr_runtime: load failed: %s\n", error);
+        return -EINVAL;
+    }
+
+    app->inst = wasm_runtime_instantiate(app->module,
+                                         CONFIG_WAMR_RUNTIME_STACK_SIZE,
+                                         CONFIG_WAMR_RUNTIME_HEAP_SIZE,
+                                         error, error_len);
+    if (app->inst == NULL) {
+        DEBUG("wamr_runtime: instantiate failed: %s\n", error);
+        wasm_runtime_unload(app->module);
+        app->module = NULL;
+        return -ENOMEM;
+    }
+    return 0;
+}
+
+int wamr_runtime_exec_main(wamr_app_t *app, int argc, char **argv)
+{
+    /* the return value of main is stored in argv[0] */
+    char arg0[] = "";
+    char *empty[] = { arg0 };
+
+    if (argc == 0) {
+        argc = 1;
+        argv = empty;
+    }
+
+    wasm_application_execute_main(app->inst, argc, argv);
+    const char *exception = wasm_runtime_get_exception(app->inst);
+    if (exception) {
+        DEBUG("wamr_runtime: %s\n", exception);
+        wasm_runtime_clear_exception(app->inst);
+        return -ECANCELED;
+    }
+    return *((int *)argv);
+}
+
+void wamr_runtime_unload(wamr_app_t *app)
+{
+    if (app->inst) {
+        wasm_runtime_deinstantiate(app->inst);
+        app->inst = NULL;
+    }
+    if (app->module) {
+        wasm_runtime_unload(app->module);
+        app->module = NULL;
+    }
+}
+
+typedef struct {
+    size_t used;
+    size_t avail;
+} _usage_t;
+
+static void _walker(void *ptr, size_t size, int used, void *user)
+{
+    _usage_t *usage = user;
+
+    (void)ptr;
+    if (used) {
+        usage->used += size;
+    }
+    else {
+        usage->avail += size;
+    }
+}
+
+void wamr_runtime_pool_usage(size_t *used, size_t *avail)
+{
+    _usage_t usage = { 0 };
+
+    mutex_lock(&_pool_lock);
+    if (_tlsf) {
+        tlsf_walk_pool(tlsf_get_pool(_tlsf), _walker, &usage);
+    }
+    mutex_unlock(&_pool_lock);
+
+    if (used) {
+        *used = usage.used;
+    }
+    if (avail) {
+        *avail = usage.avail;
+    }
+}
@@ -26,6 +26,10 @@
 #include "auto_init_utils.h"
 #include "auto_init_priorities.h"
 #include "kernel_defines.h"
+#if IS_USED(MODULE_AUTO_INIT_ASYNC)
+#include "event/thread.h"
+#include "mutex.h"
+#endif
 
 #define ENABLE_DEBUG CONFIG_AUTO_INIT_ENABLE_DEBUG
 #include "debug.h"
@@ -40,6 +44,85 @@ static inline void _auto_init_module(const volatile auto_init_module_t *module)
     module->init();
 }
 
+#if IS_USED(MODULE_AUTO_INIT_ASYNC)
+XFA_INIT_CONST(auto_init_dep_t, auto_init_deps_xfa);
+
+enum {
+    ASYNC_WAITING,      /**< not reached in the boot sequence yet */
+    ASYNC_READY,        /**< reached, waiting for its dependencies */
+    ASYNC_RUNNING,      /**< posted to the queue */
+    ASYNC_DONE,         /**< initialized */
+};
+
+static mutex_t _lock = MUTEX_INIT;
+/* unlocked once all asynchronous modules are initialized */
+static mutex_t _done = MUTEX_INIT_LOCKED;
+/* asynchronous modules not done yet, plus one until the sequence finished */
+static unsigned _pending = 1;
+
+static bool _deps_done(const auto_init_async_t *async)
+{
+    for (unsigned i = 0; i < XFA_LEN(auto_init_dep_t, auto_init_deps_xfa); i++) {
+        const volatile auto_init_dep_t *dep = &auto_init_deps_xfa[i];
+        if ((dep->module == async) && (dep->dep->state != ASYNC_DONE)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/* posts all modules that got ready, must be called with _lock held */
+static void _post_ready(void)
+{
+    for (unsigned i = 0; i < XFA_LEN(auto_init_module_t, auto_init_xfa); i++) {
+        auto_init_async_t *async = auto_init_xfa[i].async;
+        if (async && (async->state == ASYNC_READY) && _deps_done(async)) {
+            async->state = ASYNC_RUNNING;
+            event_post(AUTO_INIT_ASYNC_QUEUE, &async->event);
+        }
+    }
+}
+
+static void _release(void)
+{
+    if (--_pending == 0) {
+        mutex_unlock(&_done);
+    }
+}
+
+static void _async_handler(event_t *event)
+{
+    auto_init_async_t *async = container_of(event, auto_init_async_t, event);
+
+    async->init();
+
+    mutex_lock(&_lock);
+    async->state = ASYNC_DONE;
+    _post_ready();
+    _release();
+    mutex_unlock(&_lock);
+}
+
+static void _auto_init_async_start(const volatile auto_init_module_t *module)
+{
+#if IS_ACTIVE(CONFIG_AUTO_INIT_ENABLE_DEBUG)
+    DEBUG("auto_init: %s (%u, async)\n", module->name, module->prio);
+#endif
+    mutex_lock(&_lock);
+    module->async->event.handler = _async_handler;
+    module->async->state = ASYNC_READY;
+    _pending++;
+    _post_ready();
+    mutex_unlock(&_lock);
+}
+
+void auto_init_async_wait(void)
+{
+    mutex_lock(&_done);
+    mutex_unlock(&_done);
+}
+#endif
+
 #if IS_USED(MODULE_AUTO_INIT_ZTIMER)
 extern void ztimer_init(void);
 AUTO_INIT(ztimer_init,
@@ -75,6 +158,11 @@ extern void dummy_thread_create(void);
 AUTO_INIT(dummy_thread_create,
           AUTO_INIT_PRIO_MOD_DUMMY_THREAD);
 #endif
+#if IS_USED(MODULE_LOG_DEFERRED)
+extern void log_deferred_init(void);
+AUTO_INIT(log_deferred_init,
+          AUTO_INIT_PRIO_MOD_LOG_DEFERRED);
+#endif
 #if IS_USED(MODULE_EVENT_THREAD)
 extern void auto_init_event_thread(void);
 AUTO_INIT(auto_init_event_thread,
@@ -313,13 +401,13 @@ AUTO_INIT(telnet_server_start,
 #if IS_USED(MODULE_AUTO_INIT_MULTIMEDIA)
 #if IS_USED(MODULE_DFPLAYER)
 extern void auto_init_dfplayer(void);
-AUTO_INIT(auto_init_dfplayer,
+AUTO_INIT_ASYNC(auto_init_dfplayer,
           AUTO_INIT_PRIO_MOD_DFPLAYER);
 #endif
 #endif
 #if IS_USED(MODULE_AUTO_INIT_SCREEN)
 extern void auto_init_screen(void);
-AUTO_INIT(auto_init_screen,
+AUTO_INIT_ASYNC(auto_init_screen,
           AUTO_INIT_PRIO_MOD_SCREEN);
 #endif
 #if IS_USED(MODULE_AUTO_INIT_BENCHMARK_UDP)
@@ -336,6 +424,17 @@ AUTO_INIT(auto_init_sock_dns,
 void auto_init(void)
 {
     for (unsigned i = 0; i < XFA_LEN(auto_init_module_t, auto_init_xfa); i++) {
+#if IS_USED(MODULE_AUTO_INIT_ASYNC)
+        if (auto_init_xfa[i].async) {
+            _auto_init_async_start(&auto_init_xfa[i]);
+            continue;
+        }
+#endif
         _auto_init_module(&auto_init_xfa[i]);
     }
+#if IS_USED(MODULE_AUTO_INIT_ASYNC)
+    mutex_lock(&_lock);
+    _release();
+    mutex_unlock(&_lock);
+#endif
 }
@@ -65,6 +65,12 @@ extern "C" {
  */
 #define AUTO_INIT_PRIO_MOD_DUMMY_THREAD                 1070
 #endif
+#ifndef AUTO_INIT_PRIO_MOD_LOG_DEFERRED
+/**
+ * @brief   log_deferred priority
+ */
+#define AUTO_INIT_PRIO_MOD_LOG_DEFERRED                 1075
+#endif
 #ifndef AUTO_INIT_PRIO_MOD_EVENT_THREAD
 /**
  * @brief   event thread priority
@@ -32,6 +32,10 @@
 #include "usb/usbus/cdc/ecm.h"
 usbus_cdcecm_device_t cdcecm;
 #endif
+#ifdef MODULE_USBUS_CDC_NCM
+#include "usb/usbus/cdc/ncm.h"
+usbus_cdcncm_device_t cdcncm;
+#endif
 #ifdef MODULE_USBUS_CDC_ACM
 #include "usb/usbus/cdc/acm.h"
 #endif
@@ -62,6 +66,10 @@ void auto_init_usb(void)
     usbus_cdcecm_init(&usbus, &cdcecm);
 #endif
 
+#ifdef MODULE_USBUS_CDC_NCM
+    usbus_cdcncm_init(&usbus, &cdcncm);
+#endif
+
 #ifdef MODULE_USBUS_DFU
     usbus_dfu_init(&usbus, &dfu, USB_DFU_PROTOCOL_RUNTIME_MODE);
 #endif
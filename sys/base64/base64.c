@@ -26,73 +26,107 @@
 #include "base64.h"
 #include "kernel_defines.h"
 
-#define BASE64_CAPITAL_UPPER_BOUND     (25)     /**< base64 'Z'           */
-#define BASE64_SMALL_UPPER_BOUND       (51)     /**< base64 'z'           */
-#define BASE64_NUMBER_UPPER_BOUND      (61)     /**< base64 '9'           */
-#define BASE64_PLUS                    (62)     /**< base64 '+'           */
-#define BASE64_MINUS                   (62)     /**< base64 '-'           */
-#define BASE64_SLASH                   (63)     /**< base64 '/'           */
-#define BASE64_UNDERLINE               (63)     /**< base64 '_'           */
 #define BASE64_EQUALS                  (0xFE)   /**< no base64 symbol '=' */
 #define BASE64_NOT_DEFINED             (0xFF)   /**< no base64 symbol     */
 
+static const char _alphabet[64] =
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+#if IS_ACTIVE(MODULE_BASE64URL)
+static const char _alphabet_url[64] =
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_";
+#endif
+
 /*
- * returns the corresponding ascii symbol value for the given base64 code
+ * base64 code of every ASCII symbol, both alphabets are accepted.
+ * BASE64_NOT_DEFINED marks symbols to ignore, such as newlines.
  */
-static char getsymbol(uint8_t code, bool urlsafe)
+static const uint8_t _codes[128] = {
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3f,
+    0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x3b, 0x3c, 0x3d, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff,
+    0xff, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e,
+    0x0f, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0xff, 0xff, 0xff, 0xff, 0x3f,
+    0xff, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28,
+    0x29, 0x2a, 0x2b, 0x2c, 0x2d, 0x2e, 0x2f, 0x30, 0x31, 0x32, 0x33, 0xff, 0xff, 0xff, 0xff, 0xff
+};
+
+static const char *_get_alphabet(bool urlsafe)
 {
-    if (!IS_ACTIVE(MODULE_BASE64URL)) {
-        urlsafe = false;
-    }
-
-    if (urlsafe && code == BASE64_UNDERLINE) {
-        return '_';
+#if IS_ACTIVE(MODULE_BASE64URL)
+    if (urlsafe) {
+        return _alphabet_url;
     }
+#else
+    (void)urlsafe;
+#endif
+    return _alphabet;
+}
 
-    if (urlsafe && code == BASE64_MINUS) {
-        return '-';
-    }
+/*
+ * returns the corresponding base64 code for the given ascii symbol
+ */
+static inline uint8_t getcode(uint8_t symbol)
+{
+    return (symbol < sizeof(_codes)) ? _codes[symbol] : BASE64_NOT_DEFINED;
+}
 
-    if (!urlsafe && code == BASE64_SLASH) {
-        return '/';
-    }
+static void encode_three_bytes(uint8_t *dest, const char *alphabet,
+                               uint8_t b1, uint8_t b2, uint8_t b3)
+{
+    uint32_t v = ((uint32_t)b1 << 16) | ((uint32_t)b2 << 8) | b3;
 
-    if (!urlsafe && code == BASE64_PLUS) {
-        return '+';
-    }
+    dest[0] = alphabet[v >> 18];
+    dest[1] = alphabet[(v >> 12) & 0x3f];
+    dest[2] = alphabet[(v >> 6) & 0x3f];
+    dest[3] = alphabet[v & 0x3f];
+}
 
-    if (code <= BASE64_CAPITAL_UPPER_BOUND) {
-        return (code + 'A');
+static uint8_t *_encode_blocks(uint8_t *out, const char *alphabet,
+                               const uint8_t *in, size_t blocks)
+{
+    while (blocks--) {
+        encode_three_bytes(out, alphabet, in[0], in[1], in[2]);
+        out += 4;
+        in += 3;
     }
+    return out;
+}
 
-    if (code <= BASE64_SMALL_UPPER_BOUND) {
-        return (code + ('z' - BASE64_SMALL_UPPER_BOUND));
+/* encodes the last one or two bytes of the input, returns the number of
+ * symbols written */
+static size_t _encode_tail(uint8_t *out, const char *alphabet,
+                           const uint8_t *in, size_t len, bool urlsafe)
+{
+    if (len == 1) {
+        /* One byte still left to decode, set other two input bytes to zero */
+        encode_three_bytes(out, alphabet, in[0], 0, 0);
+        /* padding is not required for urlsafe application */
+        if (urlsafe) {
+            return 2;
+        }
+        /* Replace last two bytes with "=" to signal corresponding input bytes
+         * didn't exist */
+        out[2] = out[3] = '=';
+        return 4;
     }
 
-    if (code <= BASE64_NUMBER_UPPER_BOUND) {
-        return (code + ('9' - BASE64_NUMBER_UPPER_BOUND));
+    /* Final case: 2 bytes remain for encoding, use zero as third input */
+    encode_three_bytes(out, alphabet, in[0], in[1], 0);
+    if (urlsafe) {
+        return 3;
     }
-
-    return (char)BASE64_NOT_DEFINED;
-}
-
-static void encode_three_bytes(uint8_t *dest,
-                               uint8_t b1, uint8_t b2, uint8_t b3,
-                               bool urlsafe)
-{
-    dest[0] = getsymbol(b1 >> 2, urlsafe);
-    dest[1] = getsymbol(((b1 & 0x03) << 4) | (b2 >> 4), urlsafe);
-    dest[2] = getsymbol(((b2 & 0x0f) << 2) | (b3 >> 6), urlsafe);
-    dest[3] = getsymbol(b3 & 0x3f, urlsafe);
+    /* Replace last output with "=" to signal corresponding input byte didn't exit */
+    out[3] = '=';
+    return 4;
 }
 
 static int base64_encode_base(const void *data_in, size_t data_in_size,
                               void *base64_out, size_t *base64_out_size,
                               bool urlsafe)
 {
-    const uint8_t padding = urlsafe ? 0 : '=';
     const uint8_t *in = data_in;
-    const uint8_t *end = in + data_in_size;
     uint8_t *out = base64_out;
     size_t required_size = base64_estimate_encode_size(data_in_size);
 
@@ -114,42 +148,19 @@ static int base64_encode_base(const void *data_in, size_t data_in_size,
         return BASE64_ERROR_BUFFER_OUT;
     }
 
-    *base64_out_size = required_size;
+    const char *alphabet = _get_alphabet(urlsafe);
+    size_t blocks = data_in_size / 3;
 
-    while (in < end - 2) {
-        encode_three_bytes(out, in[0], in[1], in[2], urlsafe);
-        out += 4;
-        in += 3;
-    }
+    out = _encode_blocks(out, alphabet, in, blocks);
+    in += 3 * blocks;
+    data_in_size -= 3 * blocks;
 
-    if (in == end) {
-        /* data_in_size is multiple of 3, we're done */
-        return BASE64_SUCCESS;
+    if (data_in_size) {
+        out += _encode_tail(out, alphabet, in, data_in_size,
+                            urlsafe && IS_ACTIVE(MODULE_BASE64URL));
     }
 
-    if (in + 1 == end) {
-        /* One byte still left to decode, set other two input bytes to zero */
-        encode_three_bytes(out, in[0], 0, 0, urlsafe);
-        /* Replace last two bytes with "=" to signal corresponding input bytes
-         * didn't exist */
-        out[2] = out[3] = padding;
-
-        /* padding is not required for urlsafe application */
-        if (urlsafe) {
-            *base64_out_size -= 2;
-        }
-        return BASE64_SUCCESS;
-    }
-
-    /* Final case: 2 bytes remain for encoding, use zero as third input */
-    encode_three_bytes(out, in[0], in[1], 0, urlsafe);
-    /* Replace last output with "=" to signal corresponding input byte didn't exit */
-    out[3] = padding;
-
-    /* padding is not required for urlsafe application */
-    if (urlsafe) {
-        *base64_out_size -= 1;
-    }
+    *base64_out_size = out - (uint8_t *)base64_out;
 
     return BASE64_SUCCESS;
 }
@@ -166,53 +177,92 @@ int base64url_encode(const void *data_in, size_t data_in_size,
 {
     return base64_encode_base(data_in, data_in_size, base64_out, base64_out_size, true);
 }
+
+void base64url_encode_init(base64_encode_ctx_t *ctx)
+{
+    ctx->len = 0;
+    ctx->urlsafe = true;
+}
 #endif
 
-/*
- *  returns the corresponding base64 code for the given ascii symbol
- */
-static uint8_t getcode(char symbol)
+void base64_encode_init(base64_encode_ctx_t *ctx)
 {
-    if (symbol == '/') {
-        return BASE64_SLASH;
-    }
+    ctx->len = 0;
+    ctx->urlsafe = false;
+}
+
+int base64_encode_update(base64_encode_ctx_t *ctx, const void *data_in,
+                         size_t data_in_size, void *base64_out,
+                         size_t *base64_out_size)
+{
+    const uint8_t *in = data_in;
+    uint8_t *out = base64_out;
+    size_t required_size = 4 * ((ctx->len + data_in_size) / 3);
 
-    if (symbol == '_') {
-        return BASE64_UNDERLINE;
+    if ((in == NULL) && data_in_size) {
+        return BASE64_ERROR_DATA_IN;
     }
 
-    if (symbol == '+') {
-        return BASE64_PLUS;
+    if (*base64_out_size < required_size) {
+        *base64_out_size = required_size;
+        return BASE64_ERROR_BUFFER_OUT_SIZE;
     }
 
-    if (symbol == '-') {
-        return BASE64_MINUS;
+    if ((out == NULL) && required_size) {
+        return BASE64_ERROR_BUFFER_OUT;
     }
 
-    if (symbol == '=') {
-        /* indicates a padded base64 end */
-        return BASE64_EQUALS;
+    const char *alphabet = _get_alphabet(ctx->urlsafe);
+
+    /* complete the bytes left over from the last call */
+    if (ctx->len && (ctx->len + data_in_size >= 3)) {
+        while (ctx->len < 3) {
+            ctx->buf[ctx->len++] = *in++;
+            data_in_size--;
+        }
+        out = _encode_blocks(out, alphabet, ctx->buf, 1);
+        ctx->len = 0;
     }
 
-    if (symbol < '0') {
-        /* indicates that the given symbol is not base64 and should be ignored */
-        return BASE64_NOT_DEFINED;
+    size_t blocks = data_in_size / 3;
+
+    out = _encode_blocks(out, alphabet, in, blocks);
+    in += 3 * blocks;
+    data_in_size -= 3 * blocks;
+
+    while (data_in_size--) {
+        ctx->buf[ctx->len++] = *in++;
     }
 
-    if (symbol <= '9' && symbol >= '0') {
-        return (symbol + (BASE64_NUMBER_UPPER_BOUND - '9'));
+    *base64_out_size = required_size;
+
+    return BASE64_SUCCESS;
+}
+
+int base64_encode_finish(base64_encode_ctx_t *ctx, void *base64_out,
+                         size_t *base64_out_size)
+{
+    bool urlsafe = ctx->urlsafe && IS_ACTIVE(MODULE_BASE64URL);
+    size_t required_size = ctx->len ? (urlsafe ? ctx->len + 1 : 4) : 0;
+
+    if (*base64_out_size < required_size) {
+        *base64_out_size = required_size;
+        return BASE64_ERROR_BUFFER_OUT_SIZE;
     }
 
-    if (symbol <= 'Z' && symbol >= 'A') {
-        return (symbol - 'A');
+    if ((base64_out == NULL) && required_size) {
+        return BASE64_ERROR_BUFFER_OUT;
     }
 
-    if (symbol <= 'z' && symbol >= 'a') {
-        return (symbol + (BASE64_SMALL_UPPER_BOUND - 'z'));
+    if (ctx->len) {
+        _encode_tail(base64_out, _get_alphabet(urlsafe), ctx->buf, ctx->len,
+                     urlsafe);
+        ctx->len = 0;
     }
 
-    /* indicates that the given symbol is not base64 and should be ignored */
-    return BASE64_NOT_DEFINED;
+    *base64_out_size = required_size;
+
+    return BASE64_SUCCESS;
 }
 
 static void decode_four_codes(uint8_t *out, const uint8_t *src)
@@ -222,12 +272,85 @@ static void decode_four_codes(uint8_t *out, const uint8_t *src)
     out[2] = (src[2] << 6) | src[3];
 }
 
+static uint8_t *_decode(base64_decode_ctx_t *ctx, const uint8_t *in,
+                        const uint8_t *end, uint8_t *out)
+{
+    while (in < end) {
+        if (ctx->fill == 0) {
+            /* fast path: four base64 symbols in a row */
+            while (end - in >= 4) {
+                uint8_t codes[4] = {
+                    getcode(in[0]), getcode(in[1]), getcode(in[2]), getcode(in[3])
+                };
+
+                /* BASE64_NOT_DEFINED and BASE64_EQUALS have the top bit set */
+                if ((codes[0] | codes[1] | codes[2] | codes[3]) & 0x80) {
+                    break;
+                }
+                decode_four_codes(out, codes);
+                out += 3;
+                in += 4;
+            }
+            if (in == end) {
+                break;
+            }
+        }
+
+        /* load the codes one by one, skipping invalid symbols (such as
+         * inserted newlines commonly used to improve readability) and
+         * padding */
+        uint8_t code = getcode(*in++);
+
+        if (code & 0x80) {
+            continue;
+        }
+        ctx->codes[ctx->fill++] = code;
+        if (ctx->fill == 4) {
+            decode_four_codes(out, ctx->codes);
+            out += 3;
+            ctx->fill = 0;
+        }
+    }
+
+    return out;
+}
+
+/* decodes the codes left in the context, returns the number of bytes
+ * written or a negative error */
+static int _decode_tail(base64_decode_ctx_t *ctx, uint8_t *out)
+{
+    uint8_t tmp[3];
+
+    switch (ctx->fill) {
+    case 0:
+        /* no data in decode buffer -->nothing to do */
+        return 0;
+    case 1:
+        /* an input size of 4 * n + 1 cannot happen, (even when
+         * dropping the "=" chars) */
+        return BASE64_ERROR_DATA_IN_SIZE;
+    default:
+        /* Got two or three base64 chars, or one or two bytes of output
+         * data. Just fill with zero codes and ignore the additionally
+         * decoded bytes */
+        for (unsigned i = ctx->fill; i < 4; i++) {
+            ctx->codes[i] = 0;
+        }
+        decode_four_codes(tmp, ctx->codes);
+        for (unsigned i = 0; i < ctx->fill - 1U; i++) {
+            out[i] = tmp[i];
+        }
+        return ctx->fill - 1;
+    }
+}
+
 int base64_decode(const void *base64_in, size_t base64_in_size,
                   void *data_out, size_t *data_out_size)
 {
     uint8_t *out = data_out;
     const uint8_t *in = base64_in;
     size_t required_size = base64_estimate_decode_size(base64_in_size);
+    base64_decode_ctx_t ctx;
 
     if (in == NULL) {
         return BASE64_ERROR_DATA_IN;
@@ -242,55 +365,72 @@ int base64_decode(const void *base64_in, size_t base64_in_size,
         return BASE64_ERROR_BUFFER_OUT;
     }
 
-    const uint8_t *end = in + base64_in_size;
-    uint8_t decode_buf[4];
+    base64_decode_init(&ctx);
+    out = _decode(&ctx, in, in + base64_in_size, out);
 
-    while (1) {
-        size_t decode_buf_fill = 0;
-        /* Try to load 4 codes into the decode buffer, skipping invalid symbols
-         * (such as inserted newlines commonly used to improve readability) */
-        do {
-            /* Reached end of input before 4 codes were loaded, handle each
-             * possible decode buffer fill level individually: */
-            if (in == end) {
-                switch (decode_buf_fill) {
-                    case 0:
-                        /* no data in decode buffer -->nothing to do */
-                        break;
-                    case 1:
-                        /* an input size of 4 * n + 1 cannot happen, (even when
-                         * dropping the "=" chars) */
-                        return BASE64_ERROR_DATA_IN_SIZE;
-                    case 2:
-                        /* Got two base64 chars, or one byte of output data.
-                         * The just fill with zero codes and ignore the two
-                         * additionally decoded bytes */
-                        decode_buf[2] = decode_buf[3] = 0;
-                        decode_four_codes(out, decode_buf);
-                        out += 1;
-                        break;
-                    case 3:
-                        /* Got three base64 chars or 2 bytes of output data.
-                         * Again, just fill with zero bytes and ignore the
-                         * additionally decoded byte */
-                        decode_buf[3] = 0;
-                        decode_four_codes(out, decode_buf);
-                        out += 2;
-                        break;
-                }
-                *data_out_size = (uintptr_t)out - (uintptr_t)data_out;
-                return BASE64_SUCCESS;
-            }
-            switch (decode_buf[decode_buf_fill] = getcode(*in++)) {
-                case BASE64_NOT_DEFINED:
-                case BASE64_EQUALS:
-                    continue;
-            }
-            decode_buf_fill++;
-        }
-        while (decode_buf_fill < 4);
+    int res = _decode_tail(&ctx, out);
+    if (res < 0) {
+        return res;
+    }
+    out += res;
+
+    *data_out_size = out - (uint8_t *)data_out;
+    return BASE64_SUCCESS;
+}
+
+void base64_decode_init(base64_decode_ctx_t *ctx)
+{
+    ctx->fill = 0;
+}
+
+int base64_decode_update(base64_decode_ctx_t *ctx, const void *base64_in,
+                         size_t base64_in_size, void *data_out,
+                         size_t *data_out_size)
+{
+    const uint8_t *in = base64_in;
+    /* every symbol might be valid */
+    size_t required_size = 3 * ((ctx->fill + base64_in_size) / 4);
+
+    if ((in == NULL) && base64_in_size) {
+        return BASE64_ERROR_DATA_IN;
+    }
+
+    if (*data_out_size < required_size) {
+        *data_out_size = required_size;
+        return BASE64_ERROR_BUFFER_OUT_SIZE;
+    }
+
+    if ((data_out == NULL) && required_size) {
+        return BASE64_ERROR_BUFFER_OUT;
+    }
+
+    uint8_t *out = _decode(ctx, in, in + base64_in_size, data_out);
+
+    *data_out_size = out - (uint8_t *)data_out;
+    return BASE64_SUCCESS;
+}
+
+int base64_decode_finish(base64_decode_ctx_t *ctx, void *data_out,
+                         size_t *data_out_size)
+{
+    size_t required_size = ctx->fill ? ctx->fill - 1 : 0;
 
-        decode_four_codes(out, decode_buf);
-        out += 3;
+    if (*data_out_size < required_size) {
+        *data_out_size = required_size;
+        return BASE64_ERROR_BUFFER_OUT_SIZE;
     }
+
+    if ((data_out == NULL) && required_size) {
+        return BASE64_ERROR_BUFFER_OUT;
+    }
+
+    int res = _decode_tail(ctx, data_out);
+
+    ctx->fill = 0;
+    if (res < 0) {
+        return res;
+    }
+
+    *data_out_size = res;
+    return BASE64_SUCCESS;
 }
@@ -35,3 +35,95 @@ void benchmark_print_time(uint32_t time, unsigned long runs, const char *name)
            "  ---  %9" PRIu32 " calls per sec\n",
            name, time, full, div, per_sec);
 }
+
+void benchmark_stats_init(benchmark_stats_t *stats, unsigned runs)
+{
+    matstat_clear(&stats->stats);
+    stats->runs = runs;
+}
+
+void benchmark_stats_add(benchmark_stats_t *stats, uint32_t time)
+{
+    uint32_t count = stats->stats.count;
+
+    if (count >= CONFIG_BENCHMARK_SAMPLES_MAX) {
+        return;
+    }
+
+    uint32_t ns = ((uint64_t)time * NS_PER_US) / stats->runs;
+
+    stats->samples[count] = ns;
+    matstat_add(&stats->stats, ns);
+}
+
+static uint32_t _isqrt(uint64_t val)
+{
+    uint64_t res = 0;
+    uint64_t bit = 1ULL << 62;
+
+    while (bit > val) {
+        bit >>= 2;
+    }
+    while (bit) {
+        if (val >= res + bit) {
+            val -= res + bit;
+            res = (res >> 1) + bit;
+        }
+        else {
+            res >>= 1;
+        }
+        bit >>= 2;
+    }
+
+    return res;
+}
+
+void benchmark_stats_summary(benchmark_stats_t *stats,
+                             benchmark_summary_t *summary)
+{
+    uint32_t *samples = stats->samples;
+    unsigned n = stats->stats.count;
+
+    summary->samples = n;
+    if (n == 0) {
+        return;
+    }
+
+    /* insertion sort, there are only few samples */
+    for (unsigned i = 1; i < n; i++) {
+        uint32_t tmp = samples[i];
+        unsigned j = i;
+        for (; (j > 0) && (samples[j - 1] > tmp); j--) {
+            samples[j] = samples[j - 1];
+        }
+        samples[j] = tmp;
+    }
+
+    /* nearest rank method */
+    unsigned p99 = (n * 99 + 99) / 100 - 1;
+
+    summary->min = samples[0];
+    summary->median = samples[n / 2];
+    summary->p99 = samples[p99];
+    summary->max = samples[n - 1];
+    summary->mean = matstat_mean(&stats->stats);
+    summary->stddev = _isqrt(matstat_variance(&stats->stats));
+}
+
+void benchmark_stats_print(benchmark_stats_t *stats, const char *name)
+{
+    benchmark_summary_t summary;
+
+    benchmark_stats_summary(stats, &summary);
+    if (summary.samples == 0) {
+        printf("{ \"name\" : \"%s\", \"samples\" : 0 }\n", name);
+        return;
+    }
+
+    printf("{ \"name\" : \"%s\", \"runs\" : %u, \"samples\" : %u, "
+           "\"min\" : %" PRIu32 ", \"median\" : %" PRIu32 ", "
+           "\"p99\" : %" PRIu32 ", \"max\" : %" PRIu32 ", "
+           "\"mean\" : %" PRIi32 ", \"stddev\" : %" PRIu32 " }\n",
+           name, stats->runs, summary.samples, summary.min, summary.median,
+           summary.p99, summary.max, summary.mean, summary.stddev);
+}
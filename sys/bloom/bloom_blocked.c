@@ -0,0 +1,177 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_bloom_blocked
+ * @{
+ *
+ * @file
+ * @brief       Blocked and counting Bloom filter implementation
+ *
+ * The upper 32 bit of the hash select the block, the lower 32 bit give the
+ * probes within the block by double hashing: probe i is taken from the top
+ * bits of `a + i * b`, where `a` is the lower half of the hash and `b` is
+ * derived from the upper half.
+ *
+ * @}
+ */
+
+#include <assert.h>
+#include <string.h>
+
+#include "bloom_blocked.h"
+
+#define COUNTER_MAX     (0xfU)
+
+static inline uint32_t _fmix32(uint32_t h)
+{
+    h ^= h >> 16;
+    h *= 0x85ebca6bU;
+    h ^= h >> 13;
+    h *= 0xc2b2ae35U;
+    h ^= h >> 16;
+    return h;
+}
+
+uint64_t bloom_blocked_hash(const void *buf, size_t len)
+{
+    const uint8_t *p = buf;
+    uint32_t h1 = 0x811c9dc5U ^ (uint32_t)len;
+    uint32_t h2 = 0x9e3779b9U;
+
+    /* two independent lanes in a single pass over the element */
+    while (len--) {
+        h1 = (h1 ^ *p) * 0x01000193U;
+        h2 = (h2 + *p++) * 0x5bd1e995U;
+    }
+    h1 = _fmix32(h1);
+    h2 = _fmix32(h2 ^ h1);
+
+    return ((uint64_t)h1 << 32) | h2;
+}
+
+static inline uint8_t *_block(uint8_t *blocks, uint32_t numof, uint64_t hash)
+{
+    uint32_t idx = ((hash >> 32) * numof) >> 32;
+    return blocks + idx * BLOOM_BLOCKED_BLOCK_SIZE;
+}
+
+static inline uint32_t _step(uint64_t hash)
+{
+    uint32_t h = hash >> 32;
+    /* odd, so that the probes of an element differ */
+    return ((h << 16) | (h >> 16)) | 1;
+}
+
+void bloom_blocked_init(bloom_blocked_t *bloom, void *buf, size_t size,
+                        unsigned k)
+{
+    assert(size && !(size % BLOOM_BLOCKED_BLOCK_SIZE));
+    assert(k && (k <= BLOOM_BLOCKED_K_MAX));
+
+    memset(buf, 0, size);
+    bloom->blocks = buf;
+    bloom->numof = size / BLOOM_BLOCKED_BLOCK_SIZE;
+    bloom->k = k;
+}
+
+void bloom_blocked_add_hash(bloom_blocked_t *bloom, uint64_t hash)
+{
+    uint8_t *block = _block(bloom->blocks, bloom->numof, hash);
+    uint32_t a = hash;
+    uint32_t b = _step(hash);
+
+    for (unsigned i = 0; i < bloom->k; i++, a += b) {
+        unsigned bit = a >> 23;
+        block[bit / 8] |= 1U << (bit % 8);
+    }
+}
+
+bool bloom_blocked_check_hash(const bloom_blocked_t *bloom, uint64_t hash)
+{
+    const uint8_t *block = _block(bloom->blocks, bloom->numof, hash);
+    uint32_t a = hash;
+    uint32_t b = _step(hash);
+
+    for (unsigned i = 0; i < bloom->k; i++, a += b) {
+        unsigned bit = a >> 23;
+        if (!(block[bit / 8] & (1U << (bit % 8)))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static inline unsigned _counter_get(const uint8_t *block, unsigned idx)
+{
+    return (block[idx / 2] >> ((idx % 2) * 4)) & COUNTER_MAX;
+}
+
+static inline void _counter_set(uint8_t *block, unsigned idx, unsigned val)
+{
+    unsigned shift = (idx % 2) * 4;
+    block[idx / 2] = (block[idx / 2] & ~(COUNTER_MAX << shift)) |
+                     (val << shift);
+}
+
+void bloom_counting_init(bloom_counting_t *bloom, void *buf, size_t size,
+                         unsigned k)
+{
+    assert(size && !(size % BLOOM_BLOCKED_BLOCK_SIZE));
+    assert(k && (k <= BLOOM_BLOCKED_K_MAX));
+
+    memset(buf, 0, size);
+    bloom->blocks = buf;
+    bloom->numof = size / BLOOM_BLOCKED_BLOCK_SIZE;
+    bloom->k = k;
+}
+
+void bloom_counting_add_hash(bloom_counting_t *bloom, uint64_t hash)
+{
+    uint8_t *block = _block(bloom->blocks, bloom->numof, hash);
+    uint32_t a = hash;
+    uint32_t b = _step(hash);
+
+    for (unsigned i = 0; i < bloom->k; i++, a += b) {
+        unsigned idx = a >> 25;
+        unsigned val = _counter_get(block, idx);
+        if (val < COUNTER_MAX) {
+            _counter_set(block, idx, val + 1);
+        }
+    }
+}
+
+void bloom_counting_remove_hash(bloom_counting_t *bloom, uint64_t hash)
+{
+    uint8_t *block = _block(bloom->blocks, bloom->numof, hash);
+    uint32_t a = hash;
+    uint32_t b = _step(hash);
+
+    for (unsigned i = 0; i < bloom->k; i++, a += b) {
+        unsigned idx = a >> 25;
+        unsigned val = _counter_get(block, idx);
+        /* a saturated counter lost track of its elements, keep it */
+        if (val && (val < COUNTER_MAX)) {
+            _counter_set(block, idx, val - 1);
+        }
+    }
+}
+
+bool bloom_counting_check_hash(const bloom_counting_t *bloom, uint64_t hash)
+{
+    const uint8_t *block = _block(bloom->blocks, bloom->numof, hash);
+    uint32_t a = hash;
+    uint32_t b = _step(hash);
+
+    for (unsigned i = 0; i < bloom->k; i++, a += b) {
+        if (!_counter_get(block, a >> 25)) {
+            return false;
+        }
+    }
+    return true;
+}
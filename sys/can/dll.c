@@ -44,6 +44,18 @@ static int candev_nb = 0;
 static can_reg_entry_t *tx_list[CAN_DLL_NUMOF];
 static mutex_t tx_lock = MUTEX_INIT;
 
+/**
+ * Filter programmed into a device in place of the filters which did not fit
+ * into it, one per frame format
+ */
+typedef struct {
+    struct can_filter filter;   /**< programmed filter */
+    bool set;                   /**< filter is programmed */
+} cover_filter_t;
+
+static cover_filter_t cover[CAN_DLL_NUMOF][2];
+static mutex_t filter_lock = MUTEX_INIT;
+
 static int _get_ifnum(kernel_pid_t pid)
 {
     for (int i = 0; i < candev_nb; i++) {
@@ -166,61 +178,142 @@ int raw_can_abort(int ifnum, int handle)
     return 0;
 }
 
-static int register_filter_entry(can_reg_entry_t *entry, struct can_filter *filter, void *param)
+static int _device_filter(int ifnum, uint16_t type, struct can_filter *filter)
 {
     msg_t msg, reply;
+
+    msg.type = type;
+    msg.content.ptr = filter;
+    msg_send_receive(&msg, &reply, candev_list[ifnum]->pid);
+
+    return (int)reply.content.value;
+}
+
+/* Reprograms the filter covering the filters which are not in the device */
+static int _update_cover(int ifnum, bool eff, const struct can_filter *filter)
+{
+    cover_filter_t *c = &cover[ifnum][eff];
+    struct can_filter prev = c->filter;
+    struct can_filter next = *filter;
+    int count = can_router_get_sw(ifnum, eff, &next);
+    bool was_set = c->set;
+
+    if (c->set) {
+        if (count && (next.can_id == prev.can_id) &&
+            (next.can_mask == prev.can_mask)) {
+            return 0;
+        }
+        _device_filter(ifnum, CAN_MSG_REMOVE_FILTER, &c->filter);
+        c->set = false;
+    }
+    if (count == 0) {
+        return 0;
+    }
+
+    DEBUG("_update_cover: ifnum=%d, filter=0x%" PRIx32 ", mask=0x%" PRIx32 " for %d filters\n",
+          ifnum, next.can_id, next.can_mask, count);
+
+    if (_device_filter(ifnum, CAN_MSG_SET_FILTER, &next) >= 0) {
+        c->filter = next;
+        c->set = true;
+        return 0;
+    }
+    if (was_set) {
+        /* restore the filter covering the previous set of filters */
+        c->set = (_device_filter(ifnum, CAN_MSG_SET_FILTER, &prev) >= 0);
+    }
+    return -ENOMEM;
+}
+
+/* The device ran out of filters: cover @p filter and those which did not fit
+ * before by a single filter, evicting a programmed one to make room for it */
+static int _cover_filter(int ifnum, struct can_filter *filter)
+{
+    bool eff = filter->can_id & CAN_EFF_FLAG;
+    bool evict = !cover[ifnum][eff].set;
+    struct can_filter evicted = *filter;
+
+    if (evict) {
+        if ((can_router_get_hw(ifnum, eff, &evicted) < 0) ||
+            (_device_filter(ifnum, CAN_MSG_REMOVE_FILTER, &evicted) < 0)) {
+            return -ENOMEM;
+        }
+        can_router_set_hw(ifnum, evicted.can_id, evicted.can_mask, false);
+    }
+    can_router_set_hw(ifnum, filter->can_id, filter->can_mask, false);
+
+    if (_update_cover(ifnum, eff, filter) == 0) {
+        return 0;
+    }
+
+    can_router_set_hw(ifnum, filter->can_id, filter->can_mask, true);
+    if (evict) {
+        _device_filter(ifnum, CAN_MSG_SET_FILTER, &evicted);
+        can_router_set_hw(ifnum, evicted.can_id, evicted.can_mask, true);
+    }
+    return -ENOMEM;
+}
+
+static int register_filter_entry(can_reg_entry_t *entry, struct can_filter *filter, void *param)
+{
     int ret;
 
     DEBUG("register_filter_entry: ifnum=%d, filter=0x%" PRIx32 ", mask=0x%" PRIx32 ", param=%p\n",
           entry->ifnum, filter->can_id, filter->can_mask, param);
 
+    mutex_lock(&filter_lock);
     ret = can_router_register(entry, filter->can_id, filter->can_mask, param);
     if (ret < 0) {
+        mutex_unlock(&filter_lock);
         return -ENOMEM;
     }
     else if (ret == 1) {
         DEBUG("raw_can_subscribe_rx: filter=0x%" PRIx32 " already in use\n", filter->can_id);
+        mutex_unlock(&filter_lock);
         return 0;
     }
 
-    msg.type = CAN_MSG_SET_FILTER;
-    msg.content.ptr = filter;
-    msg_send_receive(&msg, &reply, candev_list[entry->ifnum]->pid);
-
-    if ((int) reply.content.value < 0) {
+    if ((_device_filter(entry->ifnum, CAN_MSG_SET_FILTER, filter) < 0) &&
+        (_cover_filter(entry->ifnum, filter) < 0)) {
         can_router_unregister(entry, filter->can_id, filter->can_mask, param);
+        mutex_unlock(&filter_lock);
         return -ENOMEM;
     }
 
+    mutex_unlock(&filter_lock);
     return 0;
 }
 
 static int unregister_filter_entry(can_reg_entry_t *entry, struct can_filter *filter, void *param)
 {
-    msg_t msg, reply;
     int ret;
+    bool hw;
 
     DEBUG("unregister_filter_entry: ifnum=%d, filter=0x%" PRIx32 ", mask=0x%" PRIx32 ", param=%p\n",
           entry->ifnum, filter->can_id, filter->can_mask, param);
 
+    mutex_lock(&filter_lock);
+    hw = can_router_is_hw(entry->ifnum, filter->can_id, filter->can_mask);
     ret = can_router_unregister(entry, filter->can_id, filter->can_mask, param);
     if (ret < 0) {
+        mutex_unlock(&filter_lock);
         return -ENOMEM;
     }
     else if (ret == 1) {
         DEBUG("raw_can_unsubscribe_rx: filter=0x%" PRIx32 " still in use\n", filter->can_id);
+        mutex_unlock(&filter_lock);
         return 0;
     }
 
-    msg.type = CAN_MSG_REMOVE_FILTER;
-    msg.content.ptr = filter;
-    msg_send_receive(&msg, &reply, candev_list[entry->ifnum]->pid);
-
-    if ((int) reply.content.value < 0) {
-        return -ENOMEM;
+    if (hw) {
+        ret = _device_filter(entry->ifnum, CAN_MSG_REMOVE_FILTER, filter);
     }
+    else {
+        ret = _update_cover(entry->ifnum, filter->can_id & CAN_EFF_FLAG, filter);
+    }
+    mutex_unlock(&filter_lock);
 
-    return 0;
+    return (ret < 0) ? -ENOMEM : 0;
 }
 
 int raw_can_subscribe_rx(int ifnum, struct can_filter *filter, kernel_pid_t pid, void *param)
@@ -93,6 +93,9 @@ static mutex_t lock = MUTEX_INIT;
 static void _rx_timeout(void *arg);
 static int _isotp_send_fc(struct isotp *isotp, int ae, uint8_t status);
 static int _isotp_tx_send(struct isotp *isotp, struct can_frame *frame);
+static void _isotp_tx_abort(struct isotp *isotp);
+static bool _isotp_tx_block_done(struct isotp *isotp);
+static void _isotp_send_cf(struct isotp *isotp);
 
 static int _send_msg(msg_t *msg, can_reg_entry_t *entry)
 {
@@ -230,6 +233,10 @@ static int _isotp_rcv_fc(struct isotp *isotp, struct can_frame *frame, int ae)
     case ISOTP_FC_CTS:
         isotp->tx_wft = 0;
         isotp->tx.bs = 0;
+        if (isotp->tx_gap == 0) {
+            _isotp_send_cf(isotp);
+            break;
+        }
         isotp->tx.state = ISOTP_SENDING_NEXT_CF;
         ztimer_set(ZTIMER_USEC, &isotp->tx_timer, isotp->tx_gap);
         break;
@@ -520,9 +527,6 @@ static void _isotp_fill_dataframe(struct isotp *isotp, struct can_frame *frame,
 
 static void _isotp_tx_timeout_task(struct isotp *isotp)
 {
-    int ae = (isotp->opt.flags & CAN_ISOTP_EXTEND_ADDR) ? 1 : 0;
-    struct can_frame frame;
-
     DEBUG("_isotp_tx_timeout_task: state=%d\n", isotp->tx.state);
 
     switch (isotp->tx.state) {
@@ -534,13 +538,7 @@ static void _isotp_tx_timeout_task(struct isotp *isotp)
 
     case ISOTP_SENDING_NEXT_CF:
         DEBUG("_isotp_tx_timeout_task: sending next CF\n");
-        _isotp_fill_dataframe(isotp, &frame, ae);
-        frame.data[ae] = N_PCI_CF | isotp->tx.sn++;
-        isotp->tx.sn %= 16;
-        isotp->tx.bs++;
-
-        isotp->tx.state = ISOTP_SENDING_CF;
-        _isotp_tx_send(isotp, &frame);
+        _isotp_send_cf(isotp);
         break;
 
     case ISOTP_SENDING_CF:
@@ -548,7 +546,7 @@ static void _isotp_tx_timeout_task(struct isotp *isotp)
     case ISOTP_SENDING_SF:
         DEBUG("_isotp_tx_timeout_task: timeout on DLL\n");
         isotp->tx.state = ISOTP_IDLE;
-        raw_can_abort(isotp->entry.ifnum, isotp->tx.tx_handle);
+        _isotp_tx_abort(isotp);
         _isotp_dispatch_tx(isotp, ETIMEDOUT);
         break;
     }
@@ -557,9 +555,19 @@ static void _isotp_tx_timeout_task(struct isotp *isotp)
 static void _isotp_tx_tx_conf(struct isotp *isotp)
 {
     ztimer_remove(ZTIMER_USEC, &isotp->tx_timer);
-    isotp->tx.tx_handle = 0;
 
-    DEBUG("_isotp_tx_tx_conf: state=%d\n", isotp->tx.state);
+    DEBUG("_isotp_tx_tx_conf: state=%d, pending=%u\n", isotp->tx.state,
+          isotp->tx_pending);
+
+    if (isotp->tx_pending) {
+        /* more frames in flight, their confirmation is due */
+        ztimer_set(ZTIMER_USEC, &isotp->tx_timer, CAN_ISOTP_TIMEOUT_N_As);
+        if ((isotp->tx.state == ISOTP_SENDING_CF) && !_isotp_tx_block_done(isotp)) {
+            _isotp_send_cf(isotp);
+        }
+        return;
+    }
+    isotp->tx.tx_handle = 0;
 
     switch (isotp->tx.state) {
     case ISOTP_SENDING_SF:
@@ -587,6 +595,11 @@ static void _isotp_tx_tx_conf(struct isotp *isotp)
             break;
         }
 
+        if (isotp->tx_gap == 0) {
+            _isotp_send_cf(isotp);
+            break;
+        }
+
         isotp->tx.state = ISOTP_SENDING_NEXT_CF;
         ztimer_set(ZTIMER_USEC, &isotp->tx_timer, isotp->tx_gap);
         break;
@@ -625,6 +638,14 @@ static void _isotp_rx_tx_conf(struct isotp *isotp)
     }
 }
 
+static void _isotp_tx_abort(struct isotp *isotp)
+{
+    for (unsigned i = 0; i < isotp->tx_pending; i++) {
+        raw_can_abort(isotp->entry.ifnum, isotp->tx_handles[i]);
+    }
+    isotp->tx_pending = 0;
+}
+
 static int _isotp_tx_send(struct isotp *isotp, struct can_frame *frame)
 {
     ztimer_set(ZTIMER_USEC, &isotp->tx_timer, CAN_ISOTP_TIMEOUT_N_As);
@@ -632,13 +653,56 @@ static int _isotp_tx_send(struct isotp *isotp, struct can_frame *frame)
     DEBUG("isotp_send: FF/SF/CF sent handle=%d\n", isotp->tx.tx_handle);
     if (isotp->tx.tx_handle < 0) {
         ztimer_remove(ZTIMER_USEC, &isotp->tx_timer);
+        _isotp_tx_abort(isotp);
         isotp->tx.state = ISOTP_IDLE;
         return _isotp_dispatch_tx(isotp, isotp->tx.tx_handle);
     }
+    isotp->tx_handles[isotp->tx_pending++] = isotp->tx.tx_handle;
 
     return 0;
 }
 
+/* Returns true if @p handle is a frame of @p isotp in flight and forgets it */
+static bool _isotp_tx_confirmed(struct isotp *isotp, int handle)
+{
+    for (unsigned i = 0; i < isotp->tx_pending; i++) {
+        if (isotp->tx_handles[i] == handle) {
+            isotp->tx_pending--;
+            memmove(&isotp->tx_handles[i], &isotp->tx_handles[i + 1],
+                    (isotp->tx_pending - i) * sizeof(isotp->tx_handles[0]));
+            return true;
+        }
+    }
+    return false;
+}
+
+static bool _isotp_tx_block_done(struct isotp *isotp)
+{
+    return (isotp->tx.idx >= isotp->tx.snip->size) ||
+           (isotp->txfc.bs && (isotp->tx.bs >= isotp->txfc.bs));
+}
+
+/* Sends the next consecutive frame, and more of them as long as the window
+ * allows if the receiver does not require a separation time */
+static void _isotp_send_cf(struct isotp *isotp)
+{
+    int ae = (isotp->opt.flags & CAN_ISOTP_EXTEND_ADDR) ? 1 : 0;
+    struct can_frame frame;
+
+    do {
+        _isotp_fill_dataframe(isotp, &frame, ae);
+        frame.data[ae] = N_PCI_CF | isotp->tx.sn++;
+        isotp->tx.sn %= 16;
+        isotp->tx.bs++;
+
+        isotp->tx.state = ISOTP_SENDING_CF;
+        if (_isotp_tx_send(isotp, &frame) < 0) {
+            return;
+        }
+    } while ((isotp->tx_gap == 0) && (isotp->tx_pending < CAN_ISOTP_TX_WINDOW) &&
+             !_isotp_tx_block_done(isotp));
+}
+
 static int _isotp_send_sf_ff(struct isotp *isotp)
 {
     struct can_frame frame;
@@ -695,7 +759,7 @@ static void *_isotp_thread(void *args)
             DEBUG("_isotp_thread: CAN_MSG_TX_CONFIRMATION, handle=%d\n", (int)msg.content.value);
             mutex_lock(&lock);
             LL_FOREACH(isotp_list, isotp) {
-                if (isotp->tx.tx_handle == (int)msg.content.value) {
+                if (_isotp_tx_confirmed(isotp, (int)msg.content.value)) {
                     mutex_unlock(&lock);
                     _isotp_tx_tx_conf(isotp);
                     break;
@@ -773,6 +837,7 @@ int isotp_send(struct isotp *isotp, const void *buf, int len, int flags)
     isotp->tx.idx = 0;
 
     isotp->tx_wft = 0;
+    isotp->tx_pending = 0;
 
     msg_t msg;
     msg.type = CAN_MSG_SEND_FRAME;
@@ -814,6 +879,7 @@ int isotp_bind(struct isotp *isotp, can_reg_entry_t *entry, void *arg,
     isotp->txfc.bs = 0;
     isotp->txfc.stmin = 0;
     isotp->txfc.wftmax = fc_options ? fc_options->wftmax : CAN_ISOTP_WFTMAX;
+    isotp->tx_pending = 0;
 
     isotp->entry.ifnum = entry->ifnum;
 #ifdef MODULE_CAN_MBOX
@@ -845,6 +911,19 @@ int isotp_bind(struct isotp *isotp, can_reg_entry_t *entry, void *arg,
     return 0;
 }
 
+void isotp_set_fc(struct isotp *isotp, const struct isotp_fc_options *fc_options)
+{
+    assert(isotp != NULL);
+    assert(fc_options != NULL);
+
+    DEBUG("isotp_set_fc: bs=%" PRIu8 ", stmin=0x%" PRIx8 ", wftmax=%" PRIu8 "\n",
+          fc_options->bs, fc_options->stmin, fc_options->wftmax);
+
+    isotp->rxfc.bs = fc_options->bs;
+    isotp->rxfc.stmin = fc_options->stmin;
+    isotp->txfc.wftmax = fc_options->wftmax;
+}
+
 void isotp_free_rx(can_rx_data_t *rx)
 {
     DEBUG("isotp_free_rx: rx=%p\n", (void *)rx);
@@ -17,6 +17,7 @@
  * @}
  */
 
+#include <stdbool.h>
 #include <stdint.h>
 #include <errno.h>
 #include <inttypes.h>
@@ -44,16 +45,35 @@ typedef struct filter_el {
     canid_t can_id;          /**< CAN ID of the element */
     canid_t mask;            /**< Mask of the element */
     void *data;              /**< Private data */
+    bool hw;                 /**< Filter is programmed into the device */
 } filter_el_t;
 
+#ifndef CAN_ROUTER_MAX_FILTER
+#define CAN_ROUTER_MAX_FILTER   64
+#endif
+
+/**
+ * Number of hash buckets per interface for filters matching a single CAN ID,
+ * must be a power of two
+ */
+#ifndef CAN_ROUTER_HASH_SIZE
+#define CAN_ROUTER_HASH_SIZE    16
+#endif
+
+static_assert((CAN_ROUTER_HASH_SIZE & (CAN_ROUTER_HASH_SIZE - 1)) == 0,
+              "CAN_ROUTER_HASH_SIZE must be a power of two");
+
 /**
- * This table contains @p CAN_ROUTER_APP_MAX lists of CAN IDs per interface
+ * This table contains the lists of filters matching a range of CAN IDs
+ * per interface
  */
 static can_reg_entry_t *table[CAN_DLL_NUMOF];
 
-#ifndef CAN_ROUTER_MAX_FILTER
-#define CAN_ROUTER_MAX_FILTER   64
-#endif
+/**
+ * Filters matching a single CAN ID, hashed by that ID, so that a received
+ * frame is only compared against the filters of its bucket and @ref table
+ */
+static can_reg_entry_t *buckets[CAN_DLL_NUMOF][CAN_ROUTER_HASH_SIZE];
 
 static filter_el_t _filter_buf[CAN_ROUTER_MAX_FILTER];
 static memarray_t _filter_array;
@@ -63,18 +83,58 @@ static filter_el_t *_alloc_filter_el(canid_t can_id, canid_t mask, void *data);
 static void _free_filter_el(filter_el_t *el);
 static void _insert_to_list(can_reg_entry_t **list, filter_el_t *el);
 static filter_el_t *_find_filter_el(can_reg_entry_t *list, can_reg_entry_t *entry, canid_t can_id, canid_t mask, void *data);
-static int _filter_is_used(unsigned int ifnum, canid_t can_id, canid_t mask);
+static filter_el_t *_filter_is_used(can_reg_entry_t *list, canid_t can_id, canid_t mask);
+
+/* Bits identifying a frame: the frame format and the CAN ID */
+static inline canid_t _id_key(canid_t can_id)
+{
+    return (can_id & CAN_EFF_FLAG) ? (can_id & (CAN_EFF_FLAG | CAN_EFF_MASK))
+                                   : (can_id & CAN_SFF_MASK);
+}
+
+static inline unsigned _hash(canid_t key)
+{
+    key ^= key >> 16;
+    key ^= key >> 8;
+    return key & (CAN_ROUTER_HASH_SIZE - 1);
+}
+
+/* A filter matches a single CAN ID if its mask covers all bits of the key */
+static inline bool _is_single_id(canid_t can_id, canid_t mask)
+{
+    canid_t key_mask = CAN_EFF_FLAG |
+                       ((can_id & CAN_EFF_FLAG) ? CAN_EFF_MASK : CAN_SFF_MASK);
+
+    return (mask & key_mask) == key_mask;
+}
+
+static can_reg_entry_t **_filter_list(unsigned int ifnum, canid_t can_id, canid_t mask)
+{
+    if (_is_single_id(can_id, mask)) {
+        return &buckets[ifnum][_hash(_id_key(can_id))];
+    }
+    return &table[ifnum];
+}
+
+/* List @p i of interface @p ifnum, the last one is @ref table */
+static inline can_reg_entry_t *_list_at(unsigned int ifnum, unsigned int i)
+{
+    return (i < CAN_ROUTER_HASH_SIZE) ? buckets[ifnum][i] : table[ifnum];
+}
 
 #if IS_ACTIVE(ENABLE_DEBUG)
 static void _print_filters(void)
 {
     for (int i = 0; i < (int)CAN_DLL_NUMOF; i++) {
         DEBUG("--- Ifnum: %d ---\n", i);
-        can_reg_entry_t *entry;
-        LL_FOREACH(table[i], entry) {
-            filter_el_t *el = container_of(entry, filter_el_t, entry);
-            DEBUG("App pid=%" PRIkernel_pid ", el=%p, can_id=0x%" PRIx32 ", mask=0x%" PRIx32 ", data=%p\n",
-                  el->entry.target.pid, (void*)el, el->can_id, el->mask, el->data);
+        for (unsigned j = 0; j <= CAN_ROUTER_HASH_SIZE; j++) {
+            can_reg_entry_t *entry;
+            LL_FOREACH(_list_at(i, j), entry) {
+                filter_el_t *el = container_of(entry, filter_el_t, entry);
+                DEBUG("App pid=%" PRIkernel_pid ", el=%p, can_id=0x%" PRIx32 ", mask=0x%" PRIx32
+                      ", data=%p, hw=%d\n", el->entry.target.pid, (void*)el, el->can_id,
+                      el->mask, el->data, el->hw);
+            }
         }
     }
 }
@@ -180,32 +240,33 @@ static filter_el_t *_find_filter_el(can_reg_entry_t *list, can_reg_entry_t *entr
     return NULL;
 }
 
-static int _filter_is_used(unsigned int ifnum, canid_t can_id, canid_t mask)
+static filter_el_t *_filter_is_used(can_reg_entry_t *list, canid_t can_id, canid_t mask)
 {
-    filter_el_t *el = container_of(table[ifnum], filter_el_t, entry);
+    filter_el_t *el = container_of(list, filter_el_t, entry);
     if (!el) {
         DEBUG("_filter_is_used: empty list\n");
-        return 0;
+        return NULL;
     }
     do {
         if ((el->can_id == can_id) && (el->mask == mask)) {
             DEBUG("_filter_is_used: found el=%p, can_id=%" PRIx32 ", mask=%" PRIx32 ", data=%p\n",
                   (void *)el, el->can_id, el->mask, el->data);
-            return 1;
+            return el;
         }
         el = container_of(el->entry.next, filter_el_t, entry);
     }  while (el);
 
     DEBUG("_filter_is_used: filter not found\n");
 
-    return 0;
+    return NULL;
 }
 
 /* register interested users */
 int can_router_register(can_reg_entry_t *entry, canid_t can_id, canid_t mask, void *param)
 {
     filter_el_t *filter;
-    int ret;
+    filter_el_t *used;
+    can_reg_entry_t **list = _filter_list(entry->ifnum, can_id, mask);
 
 #ifdef MODULE_CAN_MBOX
     if (IS_ACTIVE(ENABLE_DEBUG)) {
@@ -220,13 +281,15 @@ int can_router_register(can_reg_entry_t *entry, canid_t can_id, canid_t mask, vo
 #endif
 
     mutex_lock(&lock);
-    ret = _filter_is_used(entry->ifnum, can_id, mask);
+    used = _filter_is_used(*list, can_id, mask);
 
     filter = _alloc_filter_el(can_id, mask, param);
     if (!filter) {
         mutex_unlock(&lock);
         return -ENOMEM;
     }
+    /* a new filter is expected to be programmed into the device */
+    filter->hw = used ? used->hw : true;
 
 #ifdef MODULE_CAN_MBOX
     filter->entry.type = entry->type;
@@ -243,12 +306,12 @@ int can_router_register(can_reg_entry_t *entry, canid_t can_id, canid_t mask, vo
     filter->entry.target.pid = entry->target.pid;
 #endif
     filter->entry.ifnum = entry->ifnum;
-    _insert_to_list(&table[entry->ifnum], filter);
+    _insert_to_list(list, filter);
     mutex_unlock(&lock);
 
     PRINT_FILTERS();
 
-    return ret;
+    return used ? 1 : 0;
 }
 
 /* unregister interested users */
@@ -257,6 +320,7 @@ int can_router_unregister(can_reg_entry_t *entry, canid_t can_id,
 {
     filter_el_t *el;
     int ret;
+    can_reg_entry_t **list = _filter_list(entry->ifnum, can_id, mask);
 
 #ifdef MODULE_CAN_MBOX
     if (IS_ACTIVE(ENABLE_DEBUG)) {
@@ -271,14 +335,14 @@ int can_router_unregister(can_reg_entry_t *entry, canid_t can_id,
 #endif
 
     mutex_lock(&lock);
-    el = _find_filter_el(table[entry->ifnum], entry, can_id, mask, param);
+    el = _find_filter_el(*list, entry, can_id, mask, param);
     if (!el) {
         mutex_unlock(&lock);
         return -EINVAL;
     }
-    LL_DELETE(table[entry->ifnum], &el->entry);
+    LL_DELETE(*list, &el->entry);
     _free_filter_el(el);
-    ret = _filter_is_used(entry->ifnum, can_id, mask);
+    ret = _filter_is_used(*list, can_id, mask) ? 1 : 0;
     mutex_unlock(&lock);
 
     PRINT_FILTERS();
@@ -303,26 +367,15 @@ static int _send_msg(msg_t *msg, can_reg_entry_t *entry)
 #endif
 }
 
-/* send received pkt to all interested users */
-int can_router_dispatch_rx_indic(can_pkt_t *pkt)
+/* send received pkt to the interested users of a filter list */
+static int _dispatch_list(can_pkt_t *pkt, can_reg_entry_t *list, int *msg_cnt)
 {
-    if (!pkt) {
-        DEBUG("can_router_dispatch_rx_indic: invalid pkt\n");
-        return -EINVAL;
-    }
-
-    int res = 0;
     msg_t msg;
     msg.type = CAN_MSG_RX_INDICATION;
-    int msg_cnt = 0;
-
-    DEBUG("can_router_dispatch_rx_indic: pkt=%p, ifnum=%d, can_id=%" PRIx32 "\n",
-          (void *)pkt, pkt->entry.ifnum, pkt->frame.can_id);
 
-    mutex_lock(&lock);
     can_reg_entry_t *entry = NULL;
     filter_el_t *el;
-    LL_FOREACH(table[pkt->entry.ifnum], entry) {
+    LL_FOREACH(list, entry) {
         el = container_of(entry, filter_el_t, entry);
         if ((pkt->frame.can_id & el->mask) == el->can_id) {
             DEBUG("can_router_dispatch_rx_indic: found el=%p, data=%p\n",
@@ -333,7 +386,7 @@ int can_router_dispatch_rx_indic(can_pkt_t *pkt)
             msg.content.ptr = can_pkt_alloc_rx_data(&pkt->frame, sizeof(pkt->frame), el->data);
 
             if (IS_ACTIVE(ENABLE_DEBUG)) {
-                msg_cnt++;
+                (*msg_cnt)++;
             }
 
             if (!msg.content.ptr || (_send_msg(&msg, entry) <= 0)) {
@@ -341,11 +394,35 @@ int can_router_dispatch_rx_indic(can_pkt_t *pkt)
                 atomic_fetch_sub(&pkt->ref_count, 1);
                 DEBUG("can_router_dispatch_rx_indic: failed to send msg to "
                       "pid=%" PRIkernel_pid "\n", entry->target.pid);
-                res = -EBUSY;
-                break;
+                return -EBUSY;
             }
         }
     }
+
+    return 0;
+}
+
+/* send received pkt to all interested users */
+int can_router_dispatch_rx_indic(can_pkt_t *pkt)
+{
+    if (!pkt) {
+        DEBUG("can_router_dispatch_rx_indic: invalid pkt\n");
+        return -EINVAL;
+    }
+
+    int res;
+    int msg_cnt = 0;
+    unsigned int ifnum = pkt->entry.ifnum;
+
+    DEBUG("can_router_dispatch_rx_indic: pkt=%p, ifnum=%d, can_id=%" PRIx32 "\n",
+          (void *)pkt, pkt->entry.ifnum, pkt->frame.can_id);
+
+    mutex_lock(&lock);
+    res = _dispatch_list(pkt, buckets[ifnum][_hash(_id_key(pkt->frame.can_id))],
+                         &msg_cnt);
+    if (res == 0) {
+        res = _dispatch_list(pkt, table[ifnum], &msg_cnt);
+    }
     mutex_unlock(&lock);
 
     DEBUG("can_router_dispatch_rx: msg send to %d threads\n", msg_cnt);
@@ -357,6 +434,93 @@ int can_router_dispatch_rx_indic(can_pkt_t *pkt)
     return res;
 }
 
+int can_router_set_hw(unsigned int ifnum, canid_t can_id, canid_t mask, bool hw)
+{
+    can_reg_entry_t *entry;
+    int count = 0;
+
+    mutex_lock(&lock);
+    LL_FOREACH(*_filter_list(ifnum, can_id, mask), entry) {
+        filter_el_t *el = container_of(entry, filter_el_t, entry);
+        if ((el->can_id == can_id) && (el->mask == mask)) {
+            el->hw = hw;
+            count++;
+        }
+    }
+    mutex_unlock(&lock);
+
+    return count ? 0 : -ENOENT;
+}
+
+bool can_router_is_hw(unsigned int ifnum, canid_t can_id, canid_t mask)
+{
+    filter_el_t *el;
+
+    mutex_lock(&lock);
+    el = _filter_is_used(*_filter_list(ifnum, can_id, mask), can_id, mask);
+    mutex_unlock(&lock);
+
+    return el && el->hw;
+}
+
+int can_router_get_hw(unsigned int ifnum, bool eff, struct can_filter *filter)
+{
+    int res = -ENOENT;
+
+    mutex_lock(&lock);
+    for (unsigned i = 0; (i <= CAN_ROUTER_HASH_SIZE) && res; i++) {
+        can_reg_entry_t *entry;
+        LL_FOREACH(_list_at(ifnum, i), entry) {
+            filter_el_t *el = container_of(entry, filter_el_t, entry);
+            if (el->hw && (!(el->can_id & CAN_EFF_FLAG) == !eff)) {
+                filter->can_id = el->can_id;
+                filter->can_mask = el->mask;
+                res = 0;
+                break;
+            }
+        }
+    }
+    mutex_unlock(&lock);
+
+    return res;
+}
+
+int can_router_get_sw(unsigned int ifnum, bool eff, struct can_filter *filter)
+{
+    canid_t can_id = 0, mask = 0, diff = 0;
+    int count = 0;
+
+    mutex_lock(&lock);
+    for (unsigned i = 0; i <= CAN_ROUTER_HASH_SIZE; i++) {
+        can_reg_entry_t *entry;
+        LL_FOREACH(_list_at(ifnum, i), entry) {
+            filter_el_t *el = container_of(entry, filter_el_t, entry);
+            if (el->hw || (!(el->can_id & CAN_EFF_FLAG) != !eff)) {
+                continue;
+            }
+            if (count++ == 0) {
+                can_id = el->can_id;
+                mask = el->mask;
+            }
+            else {
+                /* only bits all filters agree on remain in the mask */
+                mask &= el->mask;
+                diff |= el->can_id ^ can_id;
+            }
+        }
+    }
+    mutex_unlock(&lock);
+
+    if (count) {
+        mask &= ~diff;
+        /* devices select the frame format of a filter by its ID */
+        filter->can_id = (can_id & mask) | (eff ? CAN_EFF_FLAG : 0);
+        filter->can_mask = mask | CAN_EFF_FLAG;
+    }
+
+    return count;
+}
+
 int can_router_dispatch_tx_conf(can_pkt_t *pkt)
 {
     msg_t msg;
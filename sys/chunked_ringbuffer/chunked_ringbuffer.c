@@ -76,6 +76,56 @@ bool crb_add_chunk(chunk_ringbuf_t *rb, const void *data, size_t len)
     return crb_end_chunk(rb ,keep);
 }
 
+void *crb_reserve_chunk(chunk_ringbuf_t *rb, size_t len)
+{
+    size_t tail = 1 + rb->buffer_end - rb->cur;
+
+    if (rb->cur == rb->protect) {
+        /* ringbuffer is full */
+        return NULL;
+    } else if (rb->protect == NULL) {
+        /* ringbuffer is empty */
+        if (len > tail) {
+            rb->cur = rb->buffer;
+        }
+    } else if (rb->protect > rb->cur) {
+        if (len > (size_t)(rb->protect - rb->cur)) {
+            return NULL;
+        }
+    } else if (len > tail) {
+        /* leave the end of the work area unused */
+        if (len > (size_t)(rb->protect - rb->buffer)) {
+            return NULL;
+        }
+        rb->cur = rb->buffer;
+    }
+
+    if ((len > (size_t)(1 + rb->buffer_end - rb->buffer)) ||
+        !crb_start_chunk(rb)) {
+        return NULL;
+    }
+
+    return rb->cur_start;
+}
+
+bool crb_commit_chunk(chunk_ringbuf_t *rb, size_t len)
+{
+    if (rb->cur_start == NULL) {
+        return false;
+    }
+
+    if (len == 0) {
+        return crb_end_chunk(rb, false);
+    }
+
+    rb->cur = rb->cur_start + len;
+    if (rb->cur > rb->buffer_end) {
+        rb->cur = rb->buffer;
+    }
+
+    return crb_end_chunk(rb, true);
+}
+
 static unsigned _get_cur_len(chunk_ringbuf_t *rb)
 {
     if (rb->cur > rb->cur_start) {
@@ -182,6 +232,19 @@ bool crb_chunk_foreach(chunk_ringbuf_t *rb, crb_foreach_callback_t func, void *c
     return true;
 }
 
+bool crb_peek_chunk(chunk_ringbuf_t *rb, void **data, size_t *len)
+{
+    int idx = _get_complete_chunk(rb);
+    if (idx < 0) {
+        return false;
+    }
+
+    *data = rb->chunk_start[idx];
+    *len = rb->chunk_len[idx];
+
+    return rb->chunk_start[idx] + *len <= rb->buffer_end + 1;
+}
+
 bool crb_consume_chunk(chunk_ringbuf_t *rb, void *dst, size_t len)
 {
     int idx = _get_complete_chunk(rb);
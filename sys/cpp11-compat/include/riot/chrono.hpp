@@ -12,7 +12,7 @@
  *
  * @file
  * @brief  C++11 chrono drop in replacement that adds the function now based on
- *         xtimer/timex
+ *         xtimer/timex and steady clocks based on ztimer
  * @see    <a href="http://en.cppreference.com/w/cpp/thread/thread">
  *           std::thread, defined in header thread
  *         </a>
@@ -26,10 +26,16 @@
 #define RIOT_CHRONO_HPP
 
 #include <chrono>
+#include <ratio>
+#include <cstdint>
 #include <algorithm>
 
 #include "time.h"
 #include "xtimer.h"
+#include "kernel_defines.h"
+#if IS_USED(MODULE_ZTIMER)
+#include "ztimer.h"
+#endif
 
 namespace riot {
 
@@ -140,6 +146,96 @@ inline bool operator>=(const time_point& lhs, const time_point& rhs) {
   return !(lhs < rhs);
 }
 
+#if IS_USED(MODULE_ZTIMER) || defined(DOXYGEN)
+/**
+ * @brief A steady clock counting the ticks of a ztimer clock.
+ *
+ * The duration of the clock is the native tick with its period given as
+ * compile time ratio, so converting a standard duration to ticks is a
+ * constant multiplication or division by a constant. Time points are 32 bit
+ * wide and wrap around like ztimer_now(), only compare them by the sign of
+ * their difference.
+ *
+ * @tparam Clock    the ztimer clock, e.g. `ZTIMER_MSEC`
+ * @tparam Period   the length of a tick, e.g. `std::milli`
+ */
+template <ztimer_clock_t* const& Clock, class Period>
+struct ztimer_clock {
+  /**
+   * @brief Type of a tick count.
+   */
+  using rep = uint32_t;
+  /**
+   * @brief Length of a tick.
+   */
+  using period = Period;
+  /**
+   * @brief Duration in ticks of the clock.
+   */
+  using duration = std::chrono::duration<rep, period>;
+  /**
+   * @brief Point in time of the clock.
+   */
+  using time_point = std::chrono::time_point<ztimer_clock, duration>;
+  /**
+   * @brief The clock is not set, but it may wrap around.
+   */
+  static constexpr bool is_steady = true;
+
+  /**
+   * @brief Returns the current time of the clock.
+   */
+  static time_point now() noexcept {
+    return time_point(duration(ztimer_now(Clock)));
+  }
+
+  /**
+   * @brief Returns the ztimer clock.
+   */
+  static ztimer_clock_t* native_handle() noexcept { return Clock; }
+
+  /**
+   * @brief Converts a duration to ticks of the clock, rounding up.
+   */
+  template <class Rep, class P>
+  static constexpr uint32_t to_ticks(const std::chrono::duration<Rep, P>& d) {
+    return (std::chrono::duration_cast<duration>(d) < d)
+           ? std::chrono::duration_cast<duration>(d).count() + 1
+           : std::chrono::duration_cast<duration>(d).count();
+  }
+
+  /**
+   * @brief Returns the ticks from now until @p t, negative if @p t has
+   *        passed.
+   */
+  template <class Dur>
+  static int32_t ticks_until(const std::chrono::time_point<ztimer_clock, Dur>& t) {
+    uint32_t end = std::chrono::time_point_cast<duration>(t)
+                   .time_since_epoch().count();
+    return static_cast<int32_t>(end - ztimer_now(Clock));
+  }
+};
+
+#if IS_USED(MODULE_ZTIMER_USEC) || defined(DOXYGEN)
+/**
+ * @brief Steady clock with microsecond ticks based on `ZTIMER_USEC`.
+ */
+using usec_clock = ztimer_clock<ZTIMER_USEC, std::micro>;
+#endif
+#if IS_USED(MODULE_ZTIMER_MSEC) || defined(DOXYGEN)
+/**
+ * @brief Steady clock with millisecond ticks based on `ZTIMER_MSEC`.
+ */
+using msec_clock = ztimer_clock<ZTIMER_MSEC, std::milli>;
+#endif
+#if IS_USED(MODULE_ZTIMER_SEC) || defined(DOXYGEN)
+/**
+ * @brief Steady clock with second ticks based on `ZTIMER_SEC`.
+ */
+using sec_clock = ztimer_clock<ZTIMER_SEC, std::ratio<1>>;
+#endif
+#endif
+
 } // namespace riot
 
 #endif // RIOT_CHRONO_HPP
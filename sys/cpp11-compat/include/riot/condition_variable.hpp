@@ -103,9 +103,24 @@ public:
    *                      the cv.
    * @return Result of the pred when the function returns.
    */
-  template <class Predicate>
-  bool wait_until(unique_lock<mutex>& lock, const time_point& timeout_time,
+  template <class TimePoint, class Predicate>
+  bool wait_until(unique_lock<mutex>& lock, const TimePoint& timeout_time,
                   Predicate pred);
+#if IS_USED(MODULE_ZTIMER) || defined(DOXYGEN)
+  /**
+   * @brief Block until woken up through the condition variable or a specified
+   *        point in time of a ztimer based clock is reached. The lock is
+   *        reacquired either way.
+   * @param lock          A lock that is locked by the current thread.
+   * @param timeout_time  Point in time when the thread is woken up
+   *                      independently of the condition variable.
+   * @return A status to signify if woken up due to a timeout or the cv.
+   */
+  template <ztimer_clock_t* const& Clock, class Period, class Duration>
+  cv_status wait_until(unique_lock<mutex>& lock,
+                       const std::chrono::time_point<ztimer_clock<Clock, Period>,
+                                                     Duration>& timeout_time);
+#endif
 
   /**
    * @brief Blocks until woken up through the condition variable or when the
@@ -150,9 +165,9 @@ void condition_variable::wait(unique_lock<mutex>& lock, Predicate pred) {
   }
 }
 
-template <class Predicate>
+template <class TimePoint, class Predicate>
 bool condition_variable::wait_until(unique_lock<mutex>& lock,
-                                    const time_point& timeout_time,
+                                    const TimePoint& timeout_time,
                                     Predicate pred) {
   while (!pred()) {
     if (wait_until(lock, timeout_time) == cv_status::timeout) {
@@ -192,9 +207,28 @@ inline bool condition_variable::wait_for(unique_lock<mutex>& lock,
                                          const std::chrono::duration
                                          <Rep, Period>& timeout_duration,
                                          Predicate pred) {
-  return wait_until(lock, std::chrono::steady_clock::now() + timeout_duration,
-                    std::move(pred));
+  return wait_until(lock, riot::now() += timeout_duration, std::move(pred));
+}
+
+#if IS_USED(MODULE_ZTIMER)
+template <ztimer_clock_t* const& Clock, class Period, class Duration>
+cv_status condition_variable::wait_until(unique_lock<mutex>& lock,
+                                         const std::chrono::time_point
+                                         <ztimer_clock<Clock, Period>,
+                                         Duration>& timeout_time) {
+  using clock = ztimer_clock<Clock, Period>;
+  int32_t ticks = clock::ticks_until(timeout_time);
+  if (ticks <= 0) {
+    return cv_status::timeout;
+  }
+  ztimer_t timer;
+  ztimer_set_wakeup(Clock, &timer, ticks, thread_getpid());
+  wait(lock);
+  ztimer_remove(Clock, &timer);
+  return clock::ticks_until(timeout_time) > 0 ? cv_status::no_timeout
+                                              : cv_status::timeout;
 }
+#endif
 
 } // namespace riot
 
@@ -0,0 +1,581 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup cpp11-compat
+ * @{
+ *
+ * @file
+ * @brief   C++20 coroutines on top of sys/event
+ *
+ * A @ref riot::task is a lazily started coroutine. Tasks are run by the thread
+ * that serves an @ref event_queue_t: @ref riot::spawn() posts the start of a
+ * task to a queue, every awaitable below posts the resumption of the awaiting
+ * task to the queue of that task (or resumes it right away if its callback
+ * already runs on that queue). A task awaiting another task runs on the same
+ * queue, so many concurrent tasks share the stack of a single event thread:
+ *
+ * ~~~~~~~~~~~~~~~ {.cpp}
+ * riot::task<int> answer()
+ * {
+ *     co_await riot::sleep(ZTIMER_MSEC, 100);
+ *     co_return 42;
+ * }
+ *
+ * riot::task<void> worker()
+ * {
+ *     int res = co_await answer();
+ *     printf("%d\n", res);
+ * }
+ *
+ * riot::spawn(EVENT_PRIO_MEDIUM, worker());
+ * ~~~~~~~~~~~~~~~
+ *
+ * The coroutine frames are allocated with `operator new`.
+ *
+ * @note    The flags of the thread serving the queue are used by the event
+ *          loop itself; use @ref riot::async_flags to signal a task instead
+ *          of `thread_flags`.
+ *
+ * @note    Requires C++20 (e.g. `CXXEXFLAGS += -std=c++20`).
+ *
+ * @}
+ */
+
+#ifndef RIOT_COROUTINE_HPP
+#define RIOT_COROUTINE_HPP
+
+#include "event.h"
+#include "irq.h"
+#include "kernel_defines.h"
+#if IS_USED(MODULE_ZTIMER)
+#include "ztimer.h"
+#endif
+#if IS_USED(MODULE_SOCK_ASYNC_EVENT) && IS_USED(MODULE_SOCK_UDP)
+#include "net/sock/async/event.h"
+#include "net/sock/udp.h"
+#endif
+
+#include <cerrno>
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <type_traits>
+#include <utility>
+
+#ifndef __cpp_impl_coroutine
+#error "riot/coroutine.hpp requires C++20 coroutine support"
+#endif
+
+namespace riot {
+
+template <typename T>
+class task;
+
+namespace detail {
+
+/**
+ * @brief   Event that resumes a coroutine when handled
+ */
+struct resume_event {
+  event_t super;                   /**< event structure that is posted */
+  std::coroutine_handle<> handle;  /**< coroutine to resume */
+
+  /**
+   * @brief   Handler resuming the coroutine of the event
+   */
+  static void handler(event_t *ev)
+  {
+    reinterpret_cast<resume_event *>(ev)->handle.resume();
+  }
+
+  /**
+   * @brief   Post the resumption of @p h to @p queue
+   */
+  void post(event_queue_t *queue, std::coroutine_handle<> h)
+  {
+    handle = h;
+    event_post(queue, &super);
+  }
+};
+
+/**
+ * @brief   State shared by the promises of all task types
+ */
+struct promise_base {
+  event_queue_t *queue = nullptr;        /**< queue the task runs on */
+  std::coroutine_handle<> continuation;  /**< task awaiting this task */
+  /** event used to resume the task */
+  resume_event ev = { { {}, resume_event::handler }, {} };
+  bool detached = false;  /**< started by @ref spawn */
+
+  /**
+   * @brief   Resumes the continuation or frees a detached task
+   */
+  struct final_awaiter {
+    bool await_ready() noexcept { return false; }
+
+    template <typename P>
+    std::coroutine_handle<> await_suspend(std::coroutine_handle<P> h) noexcept
+    {
+      promise_base &p = h.promise();
+      if (p.continuation) {
+        return p.continuation;
+      }
+      if (p.detached) {
+        h.destroy();
+      }
+      return std::noop_coroutine();
+    }
+
+    void await_resume() noexcept {}
+  };
+
+  std::suspend_always initial_suspend() noexcept { return {}; }
+  final_awaiter final_suspend() noexcept { return {}; }
+  void unhandled_exception() noexcept { std::terminate(); }
+};
+
+/**
+ * @brief   Base of awaitables that are resumed with the event of the task
+ */
+struct suspend_base {
+  bool await_ready() const noexcept { return false; }
+  void await_resume() const noexcept {}
+};
+
+} /* namespace detail */
+
+/**
+ * @brief   A lazily started coroutine returning a value of type @p T
+ *
+ * A task starts running when it is awaited or passed to @ref spawn().
+ */
+template <typename T>
+class [[nodiscard]] task {
+public:
+  /**
+   * @brief   Promise type of the coroutine
+   */
+  struct promise_type : detail::promise_base {
+    T value{};  /**< value passed to co_return */
+
+    task get_return_object() noexcept
+    {
+      return task(std::coroutine_handle<promise_type>::from_promise(*this));
+    }
+
+    void return_value(T v) noexcept(std::is_nothrow_move_assignable_v<T>)
+    {
+      value = std::move(v);
+    }
+  };
+
+  task(task &&other) noexcept : m_handle(std::exchange(other.m_handle, {})) {}
+  task(const task &) = delete;
+  task &operator=(const task &) = delete;
+
+  ~task()
+  {
+    if (m_handle) {
+      m_handle.destroy();
+    }
+  }
+
+  /**
+   * @brief   Awaiter starting the task on the queue of the awaiting task
+   */
+  struct awaiter {
+    std::coroutine_handle<promise_type> handle;  /**< awaited task */
+
+    bool await_ready() const noexcept { return false; }
+
+    template <typename P>
+    std::coroutine_handle<> await_suspend(std::coroutine_handle<P> parent) noexcept
+    {
+      handle.promise().continuation = parent;
+      handle.promise().queue = parent.promise().queue;
+      return handle;
+    }
+
+    T await_resume() { return std::move(handle.promise().value); }
+  };
+
+  /**
+   * @brief   Start the task and wait for its result
+   */
+  awaiter operator co_await() && noexcept { return awaiter{ m_handle }; }
+
+private:
+  template <typename U>
+  friend void spawn(event_queue_t *queue, task<U> t);
+
+  explicit task(std::coroutine_handle<promise_type> h) noexcept : m_handle(h) {}
+
+  std::coroutine_handle<promise_type> m_handle;
+};
+
+/**
+ * @brief   A lazily started coroutine without a return value
+ */
+template <>
+class [[nodiscard]] task<void> {
+public:
+  /**
+   * @brief   Promise type of the coroutine
+   */
+  struct promise_type : detail::promise_base {
+    task get_return_object() noexcept
+    {
+      return task(std::coroutine_handle<promise_type>::from_promise(*this));
+    }
+
+    void return_void() noexcept {}
+  };
+
+  task(task &&other) noexcept : m_handle(std::exchange(other.m_handle, {})) {}
+  task(const task &) = delete;
+  task &operator=(const task &) = delete;
+
+  ~task()
+  {
+    if (m_handle) {
+      m_handle.destroy();
+    }
+  }
+
+  /**
+   * @brief   Awaiter starting the task on the queue of the awaiting task
+   */
+  struct awaiter {
+    std::coroutine_handle<promise_type> handle;  /**< awaited task */
+
+    bool await_ready() const noexcept { return false; }
+
+    template <typename P>
+    std::coroutine_handle<> await_suspend(std::coroutine_handle<P> parent) noexcept
+    {
+      handle.promise().continuation = parent;
+      handle.promise().queue = parent.promise().queue;
+      return handle;
+    }
+
+    void await_resume() const noexcept {}
+  };
+
+  /**
+   * @brief   Start the task and wait for it to complete
+   */
+  awaiter operator co_await() && noexcept { return awaiter{ m_handle }; }
+
+private:
+  template <typename U>
+  friend void spawn(event_queue_t *queue, task<U> t);
+
+  explicit task(std::coroutine_handle<promise_type> h) noexcept : m_handle(h) {}
+
+  std::coroutine_handle<promise_type> m_handle;
+};
+
+/**
+ * @brief   Run @p t on the thread serving @p queue
+ *
+ * The task is detached, it frees itself when it completes. Its result, if
+ * any, is dropped.
+ *
+ * @param[in]   queue   queue to run the task on
+ * @param[in]   t       task to start
+ */
+template <typename T>
+void spawn(event_queue_t *queue, task<T> t)
+{
+  auto h = std::exchange(t.m_handle, {});
+  h.promise().queue = queue;
+  h.promise().detached = true;
+  h.promise().ev.post(queue, h);
+}
+
+/**
+ * @brief   Let the other events of the queue run before continuing
+ *
+ * ~~~~~~~~~~~~~~~ {.cpp}
+ * co_await riot::yield();
+ * ~~~~~~~~~~~~~~~
+ */
+struct yield : detail::suspend_base {
+  template <typename P>
+  void await_suspend(std::coroutine_handle<P> h) noexcept
+  {
+    h.promise().ev.post(h.promise().queue, h);
+  }
+};
+
+/**
+ * @brief   Continue the awaiting task on the thread serving another queue
+ *
+ * Tasks awaited afterwards by the task also run on @p queue. When the task
+ * completes, the task that awaits it continues on @p queue as well.
+ *
+ * ~~~~~~~~~~~~~~~ {.cpp}
+ * co_await riot::resume_on(EVENT_PRIO_HIGHEST);
+ * ~~~~~~~~~~~~~~~
+ */
+struct resume_on : detail::suspend_base {
+  event_queue_t *queue;  /**< queue to continue on */
+
+  /**
+   * @brief   Create an awaitable that switches to @p q
+   */
+  explicit resume_on(event_queue_t *q) noexcept : queue(q) {}
+
+  template <typename P>
+  void await_suspend(std::coroutine_handle<P> h) noexcept
+  {
+    h.promise().queue = queue;
+    h.promise().ev.post(queue, h);
+  }
+};
+
+#if IS_USED(MODULE_ZTIMER) || defined(DOXYGEN)
+/**
+ * @brief   Suspend the awaiting task for @p val ticks of @p clock
+ *
+ * ~~~~~~~~~~~~~~~ {.cpp}
+ * co_await riot::sleep(ZTIMER_MSEC, 500);
+ * ~~~~~~~~~~~~~~~
+ */
+class sleep : public detail::suspend_base {
+public:
+  /**
+   * @brief   Create an awaitable for @p val ticks of @p clock
+   */
+  sleep(ztimer_clock_t *clock, uint32_t val) noexcept
+    : m_clock(clock), m_val(val) {}
+
+  sleep(const sleep &) = delete;
+  sleep &operator=(const sleep &) = delete;
+
+  template <typename P>
+  void await_suspend(std::coroutine_handle<P> h) noexcept
+  {
+    m_queue = h.promise().queue;
+    m_ev = &h.promise().ev;
+    m_ev->handle = h;
+    m_timer.callback = _cb;
+    m_timer.arg = this;
+    ztimer_set(m_clock, &m_timer, m_val);
+  }
+
+private:
+  static void _cb(void *arg)
+  {
+    sleep *self = static_cast<sleep *>(arg);
+    event_post(self->m_queue, &self->m_ev->super);
+  }
+
+  ztimer_clock_t *m_clock;
+  uint32_t m_val;
+  ztimer_t m_timer = {};
+  event_queue_t *m_queue = nullptr;
+  detail::resume_event *m_ev = nullptr;
+};
+#endif
+
+/**
+ * @brief   Flags a task can wait for, may be set from interrupt context
+ *
+ * Only a single task may wait for the flags at a time.
+ *
+ * ~~~~~~~~~~~~~~~ {.cpp}
+ * riot::async_flags flags;
+ *
+ * // in an ISR
+ * flags.set(0x1);
+ *
+ * // in a task
+ * uint16_t res = co_await flags.wait_any(0x1 | 0x2);
+ * ~~~~~~~~~~~~~~~
+ */
+class async_flags {
+public:
+  async_flags() noexcept = default;
+  async_flags(const async_flags &) = delete;
+  async_flags &operator=(const async_flags &) = delete;
+
+  /**
+   * @brief   Set @p mask and resume the waiting task if it waits for them
+   */
+  void set(uint16_t mask) noexcept
+  {
+    unsigned state = irq_disable();
+    m_flags = m_flags | mask;
+    if (m_ev && (m_flags & m_waiting)) {
+      event_post(m_queue, &m_ev->super);
+      m_ev = nullptr;
+    }
+    irq_restore(state);
+  }
+
+  /**
+   * @brief   Clear @p mask without waiting
+   *
+   * @return  the flags of @p mask that were set
+   */
+  uint16_t clear(uint16_t mask) noexcept
+  {
+    unsigned state = irq_disable();
+    uint16_t res = m_flags & mask;
+    m_flags = m_flags & ~mask;
+    irq_restore(state);
+    return res;
+  }
+
+  /**
+   * @brief   Awaiter of @ref wait_any
+   */
+  struct awaiter {
+    async_flags &flags;  /**< flags to wait for */
+    uint16_t mask;       /**< flags of interest */
+
+    bool await_ready() const noexcept
+    {
+      return flags.m_flags & mask;
+    }
+
+    template <typename P>
+    bool await_suspend(std::coroutine_handle<P> h) noexcept
+    {
+      unsigned state = irq_disable();
+      if (flags.m_flags & mask) {
+        /* set in between await_ready() and now */
+        irq_restore(state);
+        return false;
+      }
+      flags.m_waiting = mask;
+      flags.m_queue = h.promise().queue;
+      flags.m_ev = &h.promise().ev;
+      flags.m_ev->handle = h;
+      irq_restore(state);
+      return true;
+    }
+
+    uint16_t await_resume() const noexcept
+    {
+      return flags.clear(mask);
+    }
+  };
+
+  /**
+   * @brief   Wait for any of the flags in @p mask
+   *
+   * The awaited value are the flags of @p mask that were set, they are
+   * cleared.
+   */
+  awaiter wait_any(uint16_t mask) noexcept { return awaiter{ *this, mask }; }
+
+private:
+  volatile uint16_t m_flags = 0;
+  uint16_t m_waiting = 0;
+  event_queue_t *m_queue = nullptr;
+  detail::resume_event *m_ev = nullptr;
+};
+
+#if (IS_USED(MODULE_SOCK_ASYNC_EVENT) && IS_USED(MODULE_SOCK_UDP)) || \
+  defined(DOXYGEN)
+/**
+ * @brief   Awaitable wrapper of an UDP sock
+ *
+ * The sock is registered with @ref sock_udp_event_init() on construction, so
+ * the task waiting for data is resumed by the thread serving the given queue.
+ * Only a single task may wait for data at a time. The wrapper must outlive
+ * the use of the sock, close the sock before destroying it.
+ *
+ * ~~~~~~~~~~~~~~~ {.cpp}
+ * riot::async_udp_sock udp(&sock, EVENT_PRIO_MEDIUM);
+ * ssize_t res = co_await udp.recv(buf, sizeof(buf), &remote);
+ * ~~~~~~~~~~~~~~~
+ */
+class async_udp_sock {
+public:
+  /**
+   * @brief   Wrap @p sock, its events are handled on @p queue
+   */
+  async_udp_sock(sock_udp_t *sock, event_queue_t *queue) noexcept
+    : m_sock(sock)
+  {
+    sock_udp_event_init(sock, queue, _cb, this);
+  }
+
+  async_udp_sock(const async_udp_sock &) = delete;
+  async_udp_sock &operator=(const async_udp_sock &) = delete;
+
+  /**
+   * @brief   Awaiter of @ref recv
+   */
+  struct awaiter {
+    async_udp_sock &udp;    /**< sock to receive from */
+    void *data;             /**< buffer to receive into */
+    size_t max_len;         /**< size of @ref data */
+    sock_udp_ep_t *remote;  /**< remote end point, may be NULL */
+    ssize_t res = -EAGAIN;  /**< result of sock_udp_recv() */
+
+    bool await_ready() noexcept
+    {
+      res = sock_udp_recv(udp.m_sock, data, max_len, 0, remote);
+      return res != -EAGAIN;
+    }
+
+    void await_suspend(std::coroutine_handle<> h) noexcept
+    {
+      udp.m_waiter = h;
+    }
+
+    ssize_t await_resume() noexcept
+    {
+      if (res == -EAGAIN) {
+        res = sock_udp_recv(udp.m_sock, data, max_len, 0, remote);
+      }
+      return res;
+    }
+  };
+
+  /**
+   * @brief   Wait for a datagram, see @ref sock_udp_recv()
+   *
+   * The awaited value is the value sock_udp_recv() returned.
+   */
+  awaiter recv(void *data, size_t max_len,
+        sock_udp_ep_t *remote = nullptr) noexcept
+  {
+    return awaiter{ *this, data, max_len, remote };
+  }
+
+  /**
+   * @brief   Get the wrapped sock
+   */
+  sock_udp_t *get() const noexcept { return m_sock; }
+
+private:
+  static void _cb(sock_udp_t *, sock_async_flags_t flags, void *arg)
+  {
+    async_udp_sock *self = static_cast<async_udp_sock *>(arg);
+    if ((flags & SOCK_ASYNC_MSG_RECV) && self->m_waiter) {
+      /* already running on the queue of the sock */
+      std::exchange(self->m_waiter, {}).resume();
+    }
+  }
+
+  sock_udp_t *m_sock;
+  std::coroutine_handle<> m_waiter;
+};
+#endif
+
+} /* namespace riot */
+
+#endif /* RIOT_COROUTINE_HPP */
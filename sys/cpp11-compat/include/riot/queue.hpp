@@ -0,0 +1,396 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup cpp11-compat
+ * @{
+ *
+ * @file
+ * @brief   Lock-free bounded queues
+ *
+ * @ref riot::spsc_queue is a ring buffer for a single producer and a single
+ * consumer, @ref riot::mpmc_queue allows any number of producers and
+ * consumers. Both store up to `N` elements of type `T` in place and never
+ * disable interrupts, so they can be used to pass work items between ISRs and
+ * threads. @ref riot::blocking_queue adds a `pop()` to either of them that
+ * puts the calling thread to sleep until an element is available.
+ *
+ * ~~~~~~~~~~~~~~~ {.cpp}
+ * static riot::blocking_queue<riot::spsc_queue<work_item, 8>> queue;
+ *
+ * // in an ISR
+ * queue.try_push(work_item{ ... });
+ *
+ * // in a thread
+ * work_item item;
+ * queue.pop(item);
+ * ~~~~~~~~~~~~~~~
+ *
+ * @note    The queues use `std::atomic<unsigned>`. On CPUs without atomic
+ *          read-modify-write instructions (e.g. Cortex-M0), the
+ *          compare-and-swap of @ref riot::mpmc_queue falls back to the
+ *          `atomic_c11` implementation, which briefly disables interrupts.
+ *
+ * @}
+ */
+
+#ifndef RIOT_QUEUE_HPP
+#define RIOT_QUEUE_HPP
+
+#include "thread.h"
+#include "thread_flags.h"
+
+#include <new>
+#include <atomic>
+#include <cstddef>
+#include <utility>
+#include <type_traits>
+
+namespace riot {
+
+#ifndef RIOT_QUEUE_THREAD_FLAG
+/**
+ * @brief Thread flag used by @ref blocking_queue to wake up the consumer
+ */
+#define RIOT_QUEUE_THREAD_FLAG (1u << 13)
+#endif
+
+/**
+ * @brief Lock-free queue for a single producer and a single consumer
+ *
+ * @tparam T    type of the elements
+ * @tparam N    capacity, must be a power of two
+ */
+template <typename T, unsigned N>
+class spsc_queue {
+  static_assert(N && !(N & (N - 1)), "N must be a power of two");
+
+public:
+  /**
+   * @brief Type of the elements
+   */
+  using value_type = T;
+
+  spsc_queue() noexcept : m_head{0}, m_tail{0} {}
+  spsc_queue(const spsc_queue&) = delete;
+  spsc_queue& operator=(const spsc_queue&) = delete;
+
+  ~spsc_queue() {
+    while (try_pop_with([](T&) {})) {
+    }
+  }
+
+  /**
+   * @brief Construct an element at the end of the queue
+   * @return `true` on success, `false` if the queue is full
+   */
+  template <class... Args>
+  bool try_emplace(Args&&... args) {
+    unsigned tail = m_tail.load(std::memory_order_relaxed);
+    if (tail - m_head.load(std::memory_order_acquire) == N) {
+      return false;
+    }
+    new (slot(tail)) T(std::forward<Args>(args)...);
+    m_tail.store(tail + 1, std::memory_order_release);
+    return true;
+  }
+
+  /**
+   * @brief Copy @p val to the end of the queue
+   * @return `true` on success, `false` if the queue is full
+   */
+  bool try_push(const T& val) { return try_emplace(val); }
+
+  /**
+   * @brief Move @p val to the end of the queue
+   * @return `true` on success, `false` if the queue is full
+   */
+  bool try_push(T&& val) { return try_emplace(std::move(val)); }
+
+  /**
+   * @brief Remove the first element of the queue, if any, and pass it to @p f
+   * @return `true` if @p f was called, `false` if the queue is empty
+   */
+  template <class F>
+  bool try_pop_with(F&& f) {
+    unsigned head = m_head.load(std::memory_order_relaxed);
+    if (head == m_tail.load(std::memory_order_acquire)) {
+      return false;
+    }
+    T* elem = slot(head);
+    f(*elem);
+    elem->~T();
+    m_head.store(head + 1, std::memory_order_release);
+    return true;
+  }
+
+  /**
+   * @brief Move the first element of the queue to @p out
+   * @return `true` on success, `false` if the queue is empty
+   */
+  bool try_pop(T& out) {
+    return try_pop_with([&out](T& elem) { out = std::move(elem); });
+  }
+
+  /**
+   * @brief Number of elements in the queue
+   *
+   * The value may be outdated if the other side is running concurrently.
+   */
+  unsigned size() const noexcept {
+    return m_tail.load(std::memory_order_acquire)
+           - m_head.load(std::memory_order_acquire);
+  }
+
+  /**
+   * @brief Check whether the queue is empty
+   */
+  bool empty() const noexcept { return size() == 0; }
+
+  /**
+   * @brief Maximum number of elements in the queue
+   */
+  static constexpr unsigned capacity() noexcept { return N; }
+
+private:
+  T* slot(unsigned pos) noexcept {
+    return reinterpret_cast<T*>(&m_buf[pos & (N - 1)]);
+  }
+
+  std::atomic<unsigned> m_head;
+  std::atomic<unsigned> m_tail;
+  typename std::aligned_storage<sizeof(T), alignof(T)>::type m_buf[N];
+};
+
+/**
+ * @brief Lock-free queue for multiple producers and multiple consumers
+ *
+ * Every slot has a sequence number telling whether it is free or holds an
+ * element for the current round. Producers and consumers claim a slot with a
+ * compare-and-swap on the write or read position.
+ *
+ * @note  A producer interrupted between claiming and filling a slot (e.g. by
+ *        an ISR) blocks the slot: until it continues, consumers see the queue
+ *        as empty at that slot. `try_pop()` does not wait for it.
+ *
+ * @tparam T    type of the elements
+ * @tparam N    capacity, must be a power of two
+ */
+template <typename T, unsigned N>
+class mpmc_queue {
+  static_assert(N && !(N & (N - 1)), "N must be a power of two");
+
+public:
+  /**
+   * @brief Type of the elements
+   */
+  using value_type = T;
+
+  mpmc_queue() noexcept : m_head{0}, m_tail{0} {
+    for (unsigned i = 0; i < N; i++) {
+      m_cells[i].seq.store(i, std::memory_order_relaxed);
+    }
+  }
+  mpmc_queue(const mpmc_queue&) = delete;
+  mpmc_queue& operator=(const mpmc_queue&) = delete;
+
+  ~mpmc_queue() {
+    while (try_pop_with([](T&) {})) {
+    }
+  }
+
+  /**
+   * @brief Construct an element at the end of the queue
+   * @return `true` on success, `false` if the queue is full
+   */
+  template <class... Args>
+  bool try_emplace(Args&&... args) {
+    unsigned pos = m_tail.load(std::memory_order_relaxed);
+    cell* c;
+    for (;;) {
+      c = &m_cells[pos & (N - 1)];
+      int diff = static_cast<int>(c->seq.load(std::memory_order_acquire) - pos);
+      if (diff == 0) {
+        if (m_tail.compare_exchange_weak(pos, pos + 1,
+                                         std::memory_order_relaxed)) {
+          break;
+        }
+      }
+      else if (diff < 0) {
+        /* slot still holds an element of the previous round */
+        return false;
+      }
+      else {
+        pos = m_tail.load(std::memory_order_relaxed);
+      }
+    }
+    new (&c->storage) T(std::forward<Args>(args)...);
+    c->seq.store(pos + 1, std::memory_order_release);
+    return true;
+  }
+
+  /**
+   * @brief Copy @p val to the end of the queue
+   * @return `true` on success, `false` if the queue is full
+   */
+  bool try_push(const T& val) { return try_emplace(val); }
+
+  /**
+   * @brief Move @p val to the end of the queue
+   * @return `true` on success, `false` if the queue is full
+   */
+  bool try_push(T&& val) { return try_emplace(std::move(val)); }
+
+  /**
+   * @brief Remove the first element of the queue, if any, and pass it to @p f
+   * @return `true` if @p f was called, `false` if the queue is empty
+   */
+  template <class F>
+  bool try_pop_with(F&& f) {
+    unsigned pos = m_head.load(std::memory_order_relaxed);
+    cell* c;
+    for (;;) {
+      c = &m_cells[pos & (N - 1)];
+      int diff = static_cast<int>(c->seq.load(std::memory_order_acquire)
+                                  - (pos + 1));
+      if (diff == 0) {
+        if (m_head.compare_exchange_weak(pos, pos + 1,
+                                         std::memory_order_relaxed)) {
+          break;
+        }
+      }
+      else if (diff < 0) {
+        /* slot not filled yet */
+        return false;
+      }
+      else {
+        pos = m_head.load(std::memory_order_relaxed);
+      }
+    }
+    T* elem = reinterpret_cast<T*>(&c->storage);
+    f(*elem);
+    elem->~T();
+    c->seq.store(pos + N, std::memory_order_release);
+    return true;
+  }
+
+  /**
+   * @brief Move the first element of the queue to @p out
+   * @return `true` on success, `false` if the queue is empty
+   */
+  bool try_pop(T& out) {
+    return try_pop_with([&out](T& elem) { out = std::move(elem); });
+  }
+
+  /**
+   * @brief Approximate number of elements in the queue
+   */
+  unsigned size() const noexcept {
+    unsigned tail = m_tail.load(std::memory_order_acquire);
+    unsigned head = m_head.load(std::memory_order_acquire);
+    return (tail - head <= N) ? tail - head : 0;
+  }
+
+  /**
+   * @brief Check whether the queue is empty
+   */
+  bool empty() const noexcept { return size() == 0; }
+
+  /**
+   * @brief Maximum number of elements in the queue
+   */
+  static constexpr unsigned capacity() noexcept { return N; }
+
+private:
+  struct cell {
+    std::atomic<unsigned> seq;
+    typename std::aligned_storage<sizeof(T), alignof(T)>::type storage;
+  };
+
+  std::atomic<unsigned> m_head;
+  std::atomic<unsigned> m_tail;
+  cell m_cells[N];
+};
+
+/**
+ * @brief Adds a blocking `pop()` to @ref spsc_queue or @ref mpmc_queue
+ *
+ * The consumer sleeps on @ref RIOT_QUEUE_THREAD_FLAG and is woken up by the
+ * next push. Only a single thread may block in `pop()` at a time, any number
+ * of threads may use `try_pop()` concurrently (as far as the underlying queue
+ * allows).
+ *
+ * @tparam Queue    underlying lock-free queue
+ */
+template <class Queue>
+class blocking_queue : public Queue {
+public:
+  /**
+   * @brief Type of the elements
+   */
+  using value_type = typename Queue::value_type;
+
+  blocking_queue() noexcept : m_waiter{nullptr} {}
+
+  /**
+   * @brief Construct an element at the end of the queue and wake up the
+   *        consumer
+   * @return `true` on success, `false` if the queue is full
+   */
+  template <class... Args>
+  bool try_emplace(Args&&... args) {
+    if (!Queue::try_emplace(std::forward<Args>(args)...)) {
+      return false;
+    }
+    thread_t* waiter = m_waiter.exchange(nullptr);
+    if (waiter) {
+      thread_flags_set(waiter, RIOT_QUEUE_THREAD_FLAG);
+    }
+    return true;
+  }
+
+  /**
+   * @brief Copy @p val to the end of the queue and wake up the consumer
+   * @return `true` on success, `false` if the queue is full
+   */
+  bool try_push(const value_type& val) { return try_emplace(val); }
+
+  /**
+   * @brief Move @p val to the end of the queue and wake up the consumer
+   * @return `true` on success, `false` if the queue is full
+   */
+  bool try_push(value_type&& val) { return try_emplace(std::move(val)); }
+
+  /**
+   * @brief Move the first element of the queue to @p out, wait for one if
+   *        the queue is empty
+   *
+   * @pre   Must be called in thread context
+   */
+  void pop(value_type& out) {
+    for (;;) {
+      if (Queue::try_pop(out)) {
+        return;
+      }
+      m_waiter.store(thread_get_active());
+      /* an element pushed before the waiter was set did not wake us up */
+      if (Queue::try_pop(out)) {
+        m_waiter.store(nullptr);
+        return;
+      }
+      thread_flags_wait_any(RIOT_QUEUE_THREAD_FLAG);
+    }
+  }
+
+private:
+  std::atomic<thread_t*> m_waiter;
+};
+
+} // namespace riot
+
+#endif // RIOT_QUEUE_HPP
@@ -25,12 +25,17 @@
 #define RIOT_THREAD_HPP
 
 #include "time.h"
+#include "irq.h"
+#include "mutex.h"
 #include "thread.h"
 
+#include <new>
 #include <array>
 #include <tuple>
 #include <atomic>
 #include <memory>
+#include <cstddef>
+#include <system_error>
 #include <utility>
 #include <exception>
 #include <stdexcept>
@@ -209,6 +214,21 @@ inline void sleep_until(const riot::time_point& sleep_time) {
     cv.wait_until(lk, sleep_time);
   }
 }
+#if IS_USED(MODULE_ZTIMER) || defined(DOXYGEN)
+/**
+ * @brief Puts the current thread to sleep.
+ * @param[in] sleep_time    A point in time of a ztimer based clock that
+ *                          specifies when the thread should wake up.
+ */
+template <ztimer_clock_t* const& Clock, class Period, class Duration>
+inline void sleep_until(const std::chrono::time_point
+                        <ztimer_clock<Clock, Period>, Duration>& sleep_time) {
+  int32_t ticks = ztimer_clock<Clock, Period>::ticks_until(sleep_time);
+  if (ticks > 0) {
+    ztimer_sleep(Clock, ticks);
+  }
+}
+#endif
 } // namespace this_thread
 
 /**
@@ -378,6 +398,218 @@ inline thread& thread::operator=(thread&& other) noexcept {
 
 inline void swap(thread& lhs, thread& rhs) noexcept { lhs.swap(rhs); }
 
+/**
+ * @brief Attributes of a thread started with @ref static_thread::start
+ */
+struct thread_attributes {
+  /**
+   * @brief Create thread attributes.
+   * @param[in] prio      Priority of the thread.
+   * @param[in] thr_name  Name of the thread.
+   */
+  constexpr thread_attributes(uint8_t prio = THREAD_PRIORITY_MAIN - 1,
+                              const char* thr_name = "riot_cpp_thread") noexcept
+    : priority{prio}, name{thr_name} {}
+  /**
+   * @brief Priority of the thread.
+   */
+  uint8_t priority;
+  /**
+   * @brief Name of the thread.
+   */
+  const char* name;
+};
+
+/**
+ * @brief   Thread with a statically sized stack that does not use the heap
+ *
+ * The stack, the functor and its arguments are all stored inside the object,
+ * so the memory used by a thread is known at link time if the object is
+ * placed in static storage. Starting a thread does not allocate memory.
+ *
+ * ```
+ * static riot::static_thread<1024> worker;
+ *
+ * int main() {
+ *     worker.start({ THREAD_PRIORITY_MAIN - 1, "worker" }, [] { ... });
+ *     worker.join();
+ * }
+ * ```
+ *
+ * A joined or finished thread can be started again.
+ *
+ * @warning The object must outlive the thread running on it. This also
+ *          applies to detached threads.
+ *
+ * @tparam  StackSize   Size of the stack in bytes. The functor and the
+ *                      arguments are stored at the bottom of the stack.
+ */
+template <size_t StackSize = THREAD_STACKSIZE_MAIN>
+class static_thread {
+  /** @cond INTERNAL */
+  template <class Thread, class Tuple>
+  friend void* static_thread_proxy(void* vp);
+  /** @endcond */
+
+public:
+  /**
+   * @brief The id is of type `thread_id`-
+   */
+  using id = thread_id;
+  /**
+   * @brief The native handle type is the `kernel_pid_t` of RIOT.
+   */
+  using native_handle_type = kernel_pid_t;
+
+  /**
+   * @brief Create a thread object without starting a thread.
+   */
+  constexpr static_thread() noexcept
+    : m_handle{thread_uninitialized}, m_running{}, m_stack{} {}
+
+  static_thread(const static_thread&) = delete;
+  static_thread& operator=(const static_thread&) = delete;
+
+  ~static_thread() {
+    if (joinable()) {
+      std::terminate();
+    }
+  }
+
+  /**
+   * @brief Start a thread running @p f with @p args.
+   * @param[in] attr  Priority and name of the thread.
+   * @param[in] f     Functor to run as a thread.
+   * @param[in] args  Arguments passed to the functor.
+   * @throws  std::system_error if a thread is still running on this
+   *          object or the thread could not be created.
+   */
+  template <class F, class... Args>
+  void start(const thread_attributes& attr, F&& f, Args&&... args);
+
+  /**
+   * @brief Start a thread with default attributes.
+   * @param[in] f     Functor to run as a thread.
+   * @param[in] args  Arguments passed to the functor.
+   */
+  template <class F, class... Args,
+            typename std::enable_if<!std::is_same<
+              typename std::decay<F>::type, thread_attributes>::value,
+              int>::type = 0>
+  void start(F&& f, Args&&... args) {
+    start(thread_attributes{}, std::forward<F>(f),
+          std::forward<Args>(args)...);
+  }
+
+  /**
+   * @brief Query if the thread is joinable.
+   * @return  `true` if the thread is joinable, `false` otherwise.
+   */
+  inline bool joinable() const noexcept {
+    return m_handle != thread_uninitialized;
+  }
+  /**
+   * @brief Block until the thread finishes.
+   * @throws  std::system_error if the thread is not joinable or a thread
+   *          joins itself.
+   */
+  void join() {
+    if (get_id() == this_thread::get_id()) {
+      throw std::system_error(
+        std::make_error_code(std::errc::resource_deadlock_would_occur),
+        "Joining this leads to a deadlock.");
+    }
+    if (!joinable()) {
+      throw std::system_error(std::make_error_code(std::errc::invalid_argument),
+                              "Can not join an unjoinable thread.");
+    }
+    mutex_lock(&m_running);
+    mutex_unlock(&m_running);
+    m_handle = thread_uninitialized;
+  }
+  /**
+   * @brief Detaches the thread from this handle.
+   */
+  void detach() {
+    if (!joinable()) {
+      throw std::system_error(std::make_error_code(std::errc::invalid_argument),
+                              "Can not detach an unjoinable thread.");
+    }
+    m_handle = thread_uninitialized;
+  }
+  /**
+   * @brief Returns the id of a thread.
+   */
+  inline id get_id() const noexcept { return thread_id{m_handle}; }
+  /**
+   * @brief Returns the native handle to a thread.
+   */
+  inline native_handle_type native_handle() noexcept { return m_handle; }
+
+private:
+  kernel_pid_t m_handle;
+  /* locked as long as a thread runs on this object */
+  mutex_t m_running;
+  alignas(std::max_align_t) std::array<char, StackSize> m_stack;
+};
+
+/** @cond INTERNAL */
+template <class Thread, class Tuple>
+void* static_thread_proxy(void* vp) {
+  Tuple* p = static_cast<Tuple*>(vp);
+  Thread* self = std::get<0>(*p);
+  // create indices for the arguments, 0 is the thread and 1 is the function
+  auto indices = detail::get_indices<std::tuple_size<Tuple>::value, 2>();
+  try {
+    detail::apply_args(std::get<1>(*p), indices, *p);
+  }
+  catch (...) {
+    // nop
+  }
+  p->~Tuple();
+  // do not get preempted by the joining thread before leaving the stack,
+  // it may start a new thread on it
+  irq_disable();
+  mutex_unlock(&self->m_running);
+  sched_task_exit();
+  return nullptr;
+}
+/** @endcond */
+
+template <size_t StackSize>
+template <class F, class... Args>
+void static_thread<StackSize>::start(const thread_attributes& attr, F&& f,
+                                     Args&&... args) {
+  using namespace std;
+  using func_and_args = tuple
+    <static_thread*, typename decay<F>::type, typename decay<Args>::type...>;
+  constexpr size_t offset = (sizeof(func_and_args) + alignof(max_align_t) - 1)
+                            / alignof(max_align_t) * alignof(max_align_t);
+  static_assert(offset < StackSize,
+                "stack too small for the functor and its arguments");
+  static_assert(alignof(func_and_args) <= alignof(max_align_t),
+                "functor or arguments are over-aligned");
+
+  if (joinable() || !mutex_trylock(&m_running)) {
+    throw system_error(
+      make_error_code(errc::resource_unavailable_try_again),
+        "A thread is still running on this object.");
+  }
+  auto p = new (m_stack.data())
+    func_and_args(this, forward<F>(f), forward<Args>(args)...);
+  m_handle = thread_create(
+    m_stack.data() + offset, StackSize - offset, attr.priority, 0,
+    &static_thread_proxy<static_thread, func_and_args>, p, attr.name);
+  if (m_handle < 0) {
+    p->~func_and_args();
+    m_handle = thread_uninitialized;
+    mutex_unlock(&m_running);
+    throw system_error(
+      make_error_code(errc::resource_unavailable_try_again),
+        "Failed to create thread.");
+  }
+}
+
 } // namespace riot
 
 #endif // RIOT_THREAD_HPP
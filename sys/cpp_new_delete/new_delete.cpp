@@ -18,14 +18,187 @@
  * SPDX-License-Identifier: LGPL-2.1-or-later
  */
 
+#include <stdint.h>
 #include <stdlib.h>
 
-void *operator new(size_t size) {
+#include "kernel_defines.h"
+
+#if IS_USED(MODULE_CPP_NEW_DELETE_POOL)
+#include "irq.h"
+#include "memarray.h"
+
+#ifndef CONFIG_CPP_NEW_DELETE_POOL_16_NUMOF
+#define CONFIG_CPP_NEW_DELETE_POOL_16_NUMOF     16
+#endif
+#ifndef CONFIG_CPP_NEW_DELETE_POOL_32_NUMOF
+#define CONFIG_CPP_NEW_DELETE_POOL_32_NUMOF     16
+#endif
+#ifndef CONFIG_CPP_NEW_DELETE_POOL_64_NUMOF
+#define CONFIG_CPP_NEW_DELETE_POOL_64_NUMOF     8
+#endif
+#ifndef CONFIG_CPP_NEW_DELETE_POOL_128_NUMOF
+#define CONFIG_CPP_NEW_DELETE_POOL_128_NUMOF    4
+#endif
+
+/* Blocks are aligned to their size, so a pool can serve any alignment up to
+ * its block size */
+alignas(16) static uint8_t _data16[CONFIG_CPP_NEW_DELETE_POOL_16_NUMOF][16];
+alignas(32) static uint8_t _data32[CONFIG_CPP_NEW_DELETE_POOL_32_NUMOF][32];
+alignas(64) static uint8_t _data64[CONFIG_CPP_NEW_DELETE_POOL_64_NUMOF][64];
+alignas(128) static uint8_t _data128[CONFIG_CPP_NEW_DELETE_POOL_128_NUMOF][128];
+
+typedef struct {
+    memarray_t mem;
+    uint8_t *data;
+    size_t size;
+    size_t numof;
+} pool_t;
+
+static pool_t _pools[] = {
+    { {}, &_data16[0][0], 16, CONFIG_CPP_NEW_DELETE_POOL_16_NUMOF },
+    { {}, &_data32[0][0], 32, CONFIG_CPP_NEW_DELETE_POOL_32_NUMOF },
+    { {}, &_data64[0][0], 64, CONFIG_CPP_NEW_DELETE_POOL_64_NUMOF },
+    { {}, &_data128[0][0], 128, CONFIG_CPP_NEW_DELETE_POOL_128_NUMOF },
+};
+
+static bool _initialized;
+
+static void _pools_init(void)
+{
+    for (pool_t &pool : _pools) {
+        memarray_init(&pool.mem, pool.data, pool.size, pool.numof);
+    }
+    _initialized = true;
+}
+
+static void *_pool_alloc(size_t size, size_t align)
+{
+    unsigned state = irq_disable();
+
+    /* operator new may be called by static constructors, so initialize
+     * lazily */
+    if (!_initialized) {
+        _pools_init();
+    }
+
+    void *ptr = NULL;
+    for (pool_t &pool : _pools) {
+        if ((size <= pool.size) && (align <= pool.size)) {
+            /* try the next larger class if this one is exhausted */
+            ptr = memarray_alloc(&pool.mem);
+            if (ptr) {
+                break;
+            }
+        }
+    }
+
+    irq_restore(state);
+    return ptr;
+}
+
+static bool _pool_free(void *ptr)
+{
+    uint8_t *p = static_cast<uint8_t *>(ptr);
+
+    for (pool_t &pool : _pools) {
+        if ((p >= pool.data) && (p < pool.data + pool.size * pool.numof)) {
+            unsigned state = irq_disable();
+            memarray_free(&pool.mem, ptr);
+            irq_restore(state);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+static void *_new(size_t size)
+{
+    void *ptr = _pool_alloc(size, 1);
+    return ptr ? ptr : malloc(size);
+}
+
+static void _delete(void *ptr)
+{
+    if (ptr && !_pool_free(ptr)) {
+        free(ptr);
+    }
+}
+
+#if __cpp_aligned_new
+namespace std {
+    enum class align_val_t : size_t;
+}
+
+static void *_new_aligned(size_t size, std::align_val_t al)
+{
+    size_t align = static_cast<size_t>(al);
+    void *ptr = _pool_alloc(size, align);
+    if (ptr) {
+        return ptr;
+    }
+
+    /* over-allocate and store the pointer to the block in front of the
+     * aligned memory */
+    void *block = malloc(size + align + sizeof(void *));
+    if (!block) {
+        return NULL;
+    }
+    uintptr_t addr = reinterpret_cast<uintptr_t>(block) + sizeof(void *);
+    addr = (addr + align - 1) & ~(uintptr_t)(align - 1);
+    reinterpret_cast<void **>(addr)[-1] = block;
+    return reinterpret_cast<void *>(addr);
+}
+
+static void _delete_aligned(void *ptr)
+{
+    if (ptr && !_pool_free(ptr)) {
+        free(static_cast<void **>(ptr)[-1]);
+    }
+}
+
+void *operator new(size_t size, std::align_val_t align) {
+    return _new_aligned(size, align);
+}
+
+void *operator new[](size_t size, std::align_val_t align) {
+    return _new_aligned(size, align);
+}
+
+void operator delete(void *ptr, std::align_val_t) noexcept {
+    _delete_aligned(ptr);
+}
+
+void operator delete(void *ptr, size_t, std::align_val_t) noexcept {
+    _delete_aligned(ptr);
+}
+
+void operator delete[](void *ptr, std::align_val_t) noexcept {
+    _delete_aligned(ptr);
+}
+
+void operator delete[](void *ptr, size_t, std::align_val_t) noexcept {
+    _delete_aligned(ptr);
+}
+#endif /* __cpp_aligned_new */
+#else
+static inline void *_new(size_t size)
+{
     return malloc(size);
 }
 
+static inline void _delete(void *ptr)
+{
+    free(ptr);
+}
+#endif /* MODULE_CPP_NEW_DELETE_POOL */
+
+void *operator new(size_t size) {
+    return _new(size);
+}
+
 void *operator new[](size_t size) {
-    return malloc(size);
+    return _new(size);
 }
 
 void *operator new(size_t size, void *ptr) noexcept {
@@ -34,17 +207,17 @@ void *operator new(size_t size, void *ptr) noexcept {
 }
 
 void operator delete(void *ptr) {
-    free(ptr);
+    _delete(ptr);
 }
 
 void operator delete(void *ptr, size_t) noexcept {
-    free(ptr);
+    _delete(ptr);
 }
 
 void operator delete[](void *ptr) {
-    free(ptr);
+    _delete(ptr);
 }
 
 void operator delete [](void *ptr, size_t) noexcept {
-    free(ptr);
+    _delete(ptr);
 }
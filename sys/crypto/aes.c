@@ -66,13 +66,63 @@
  * Interface to the aes cipher
  */
 static const cipher_interface_t aes_interface = {
-    AES_BLOCK_SIZE,
-    aes_init,
-    aes_encrypt,
-    aes_decrypt
+    .block_size = AES_BLOCK_SIZE,
+    .init = aes_init,
+    .encrypt = aes_encrypt,
+    .decrypt = aes_decrypt,
+    .encrypt_blocks = aes_encrypt_blocks,
+    .decrypt_blocks = aes_decrypt_blocks,
 };
 
+const cipher_id_t CIPHER_AES_SW = &aes_interface;
+
+#if IS_USED(MODULE_PERIPH_CIPHER_AES)
+const cipher_id_t CIPHER_AES = &periph_cipher_aes_interface;
+#else
 const cipher_id_t CIPHER_AES = &aes_interface;
+#endif
+
+int aes_init(cipher_context_t *context, const uint8_t *key, uint8_t keySize)
+{
+    uint8_t i;
+
+    if (keySize != AES_KEY_SIZE_128 && keySize != AES_KEY_SIZE_192 &&
+        keySize != AES_KEY_SIZE_256) {
+        return CIPHER_ERR_INVALID_KEY_SIZE;
+    }
+
+    if ((keySize == AES_KEY_SIZE_128 && !IS_USED(MODULE_CRYPTO_AES_128)) ||
+        (keySize == AES_KEY_SIZE_192 && !IS_USED(MODULE_CRYPTO_AES_192)) ||
+        (keySize == AES_KEY_SIZE_256 && !IS_USED(MODULE_CRYPTO_AES_256))) {
+        return CIPHER_ERR_INVALID_KEY_SIZE;
+    }
+
+    context->key_size = keySize;
+
+    /* Make sure that context is large enough. If this is not the case,
+       you should build with -DAES */
+    if (CIPHER_MAX_CONTEXT_SIZE < keySize) {
+        return CIPHER_ERR_BAD_CONTEXT_SIZE;
+    }
+
+    /* key must be at least CIPHERS_MAX_KEY_SIZE Bytes long */
+    if (keySize < CIPHERS_MAX_KEY_SIZE) {
+        /* fill up by concatenating key to as long as needed */
+        for (i = 0; i < CIPHERS_MAX_KEY_SIZE; i++) {
+            context->context[i] = key[(i % keySize)];
+        }
+    }
+    else {
+        for (i = 0; i < CIPHERS_MAX_KEY_SIZE; i++) {
+            context->context[i] = key[i];
+        }
+    }
+
+    return CIPHER_INIT_SUCCESS;
+}
+
+#if !IS_USED(MODULE_CRYPTO_AES_CT)
+/* with crypto_aes_ct, the bitsliced implementation in aes_ct.c is used */
 
 static const u32 Te0[256] = {
     0xc66363a5U, 0xf87c7c84U, 0xee777799U, 0xf67b7b8dU,
@@ -817,45 +867,6 @@ static const u32 rcon[] = {
     0x1B000000, 0x36000000,
 };
 
-int aes_init(cipher_context_t *context, const uint8_t *key, uint8_t keySize)
-{
-    uint8_t i;
-
-    if (keySize != AES_KEY_SIZE_128 && keySize != AES_KEY_SIZE_192 &&
-        keySize != AES_KEY_SIZE_256) {
-        return CIPHER_ERR_INVALID_KEY_SIZE;
-    }
-
-    if ((keySize == AES_KEY_SIZE_128 && !IS_USED(MODULE_CRYPTO_AES_128)) ||
-        (keySize == AES_KEY_SIZE_192 && !IS_USED(MODULE_CRYPTO_AES_192)) ||
-        (keySize == AES_KEY_SIZE_256 && !IS_USED(MODULE_CRYPTO_AES_256))) {
-        return CIPHER_ERR_INVALID_KEY_SIZE;
-    }
-
-    context->key_size = keySize;
-
-    /* Make sure that context is large enough. If this is not the case,
-       you should build with -DAES */
-    if (CIPHER_MAX_CONTEXT_SIZE < keySize) {
-        return CIPHER_ERR_BAD_CONTEXT_SIZE;
-    }
-
-    /* key must be at least CIPHERS_MAX_KEY_SIZE Bytes long */
-    if (keySize < CIPHERS_MAX_KEY_SIZE) {
-        /* fill up by concatenating key to as long as needed */
-        for (i = 0; i < CIPHERS_MAX_KEY_SIZE; i++) {
-            context->context[i] = key[(i % keySize)];
-        }
-    }
-    else {
-        for (i = 0; i < CIPHERS_MAX_KEY_SIZE; i++) {
-            context->context[i] = key[i];
-        }
-    }
-
-    return CIPHER_INIT_SUCCESS;
-}
-
 /**
  * Expand the cipher key into the encryption key schedule.
  */
@@ -1057,20 +1068,9 @@ static int aes_set_decrypt_key(const unsigned char *userKey, const int bits,
  * Encrypt a single block
  * in and out can overlap
  */
-int aes_encrypt(const cipher_context_t *context, const uint8_t *plainBlock,
-                uint8_t *cipherBlock)
+static void _encrypt_block(const AES_KEY *key, const uint8_t *plainBlock,
+                           uint8_t *cipherBlock)
 {
-    /* setup AES_KEY */
-    int res;
-    AES_KEY aeskey;
-    const AES_KEY *key = &aeskey;
-
-    res = aes_set_encrypt_key((unsigned char *)context->context,
-                              AES_KEY_SIZE(context) * 8, &aeskey);
-    if (res < 0) {
-        return res;
-    }
-
     const u32 *rk;
     u32 s0, s1, s2, s3, t0, t1, t2, t3;
 
@@ -1319,28 +1319,15 @@ int aes_encrypt(const cipher_context_t *context, const uint8_t *plainBlock,
         (Te4((t2) & 0xff)       & 0x000000ff) ^
         rk[3];
     PUTU32(cipherBlock + 12, s3);
-    return 1;
 }
 
 /*
  * Decrypt a single block
  * in and out can overlap
  */
-int aes_decrypt(const cipher_context_t *context, const uint8_t *cipherBlock,
-                uint8_t *plainBlock)
+static void _decrypt_block(const AES_KEY *key, const uint8_t *cipherBlock,
+                           uint8_t *plainBlock)
 {
-    /* setup AES_KEY */
-    int res;
-    AES_KEY aeskey;
-    const AES_KEY *key = &aeskey;
-
-    res = aes_set_decrypt_key((unsigned char *)context->context,
-                              AES_KEY_SIZE(context) * 8, &aeskey);
-
-    if (res < 0) {
-        return res;
-    }
-
     const u32 *rk;
     u32 s0, s1, s2, s3, t0, t1, t2, t3;
 
@@ -1581,7 +1568,62 @@ int aes_decrypt(const cipher_context_t *context, const uint8_t *cipherBlock,
         (Td4((t0) & 0xff)       & 0x000000ff) ^
         rk[3];
     PUTU32(plainBlock + 12, s3);
+}
+
+int aes_encrypt(const cipher_context_t *context, const uint8_t *plainBlock,
+                uint8_t *cipherBlock)
+{
+    return aes_encrypt_blocks(context, plainBlock, cipherBlock, 1);
+}
+
+int aes_decrypt(const cipher_context_t *context, const uint8_t *cipherBlock,
+                uint8_t *plainBlock)
+{
+    return aes_decrypt_blocks(context, cipherBlock, plainBlock, 1);
+}
+
+/*
+ * The key schedule is expanded once for all blocks
+ */
+int aes_encrypt_blocks(const cipher_context_t *context, const uint8_t *input,
+                       uint8_t *output, size_t blocks)
+{
+    AES_KEY aeskey;
+    int res;
+
+    res = aes_set_encrypt_key((unsigned char *)context->context,
+                              AES_KEY_SIZE(context) * 8, &aeskey);
+    if (res < 0) {
+        return res;
+    }
+
+    for (size_t i = 0; i < blocks; i++) {
+        _encrypt_block(&aeskey, input, output);
+        input += AES_BLOCK_SIZE;
+        output += AES_BLOCK_SIZE;
+    }
+    return 1;
+}
+
+int aes_decrypt_blocks(const cipher_context_t *context, const uint8_t *input,
+                       uint8_t *output, size_t blocks)
+{
+    AES_KEY aeskey;
+    int res;
+
+    res = aes_set_decrypt_key((unsigned char *)context->context,
+                              AES_KEY_SIZE(context) * 8, &aeskey);
+    if (res < 0) {
+        return res;
+    }
+
+    for (size_t i = 0; i < blocks; i++) {
+        _decrypt_block(&aeskey, input, output);
+        input += AES_BLOCK_SIZE;
+        output += AES_BLOCK_SIZE;
+    }
     return 1;
 }
 
 #endif /* AES_ASM */
+#endif /* !MODULE_CRYPTO_AES_CT */
@@ -26,6 +26,7 @@
 #include "crypto/helper.h"
 #include "crypto/chacha20poly1305.h"
 #include "crypto/poly1305.h"
+#include "kernel_defines.h"
 #include "unaligned.h"
 
 /* Missing operations to convert numbers to little endian prevents this from
@@ -88,6 +89,90 @@ static void _keystream(chacha20poly1305_ctx_t *ctx, const uint8_t *key,
     _add_initial(ctx, key, nonce, blk);
 }
 
+#if IS_USED(MODULE_CRYPTO_CHACHA20POLY1305_FAST)
+/* Number of blocks computed in parallel. The state is stored lane by lane, so
+ * that the compiler can map the lanes to SIMD registers or interleave the
+ * independent blocks in the pipeline */
+#define CHACHA20_LANES  (4U)
+
+#define _ROTL(v, c)     (((v) << (c)) | ((v) >> (32 - (c))))
+
+/* Quarter round over all lanes */
+#define _QR(x, a, b, c, d)                                  \
+    for (unsigned l = 0; l < CHACHA20_LANES; l++) {         \
+        x[a][l] += x[b][l]; x[d][l] ^= x[a][l];             \
+        x[d][l] = _ROTL(x[d][l], 16);                       \
+        x[c][l] += x[d][l]; x[b][l] ^= x[c][l];             \
+        x[b][l] = _ROTL(x[b][l], 12);                       \
+        x[a][l] += x[b][l]; x[d][l] ^= x[a][l];             \
+        x[d][l] = _ROTL(x[d][l], 8);                        \
+        x[c][l] += x[d][l]; x[b][l] ^= x[c][l];             \
+        x[b][l] = _ROTL(x[b][l], 7);                        \
+    }
+
+static void _keystream_lanes(uint32_t x[16][CHACHA20_LANES],
+                             const uint32_t input[16])
+{
+    for (unsigned i = 0; i < 16; i++) {
+        for (unsigned l = 0; l < CHACHA20_LANES; l++) {
+            x[i][l] = input[i];
+        }
+    }
+    for (unsigned l = 0; l < CHACHA20_LANES; l++) {
+        x[12][l] += l;
+    }
+
+    for (unsigned i = 0; i < 10; i++) {
+        /* column round */
+        _QR(x, 0, 4,  8, 12);
+        _QR(x, 1, 5,  9, 13);
+        _QR(x, 2, 6, 10, 14);
+        _QR(x, 3, 7, 11, 15);
+        /* diagonal round */
+        _QR(x, 0, 5, 10, 15);
+        _QR(x, 1, 6, 11, 12);
+        _QR(x, 2, 7,  8, 13);
+        _QR(x, 3, 4,  9, 14);
+    }
+
+    for (unsigned i = 0; i < 16; i++) {
+        for (unsigned l = 0; l < CHACHA20_LANES; l++) {
+            x[i][l] += input[i];
+        }
+    }
+    for (unsigned l = 0; l < CHACHA20_LANES; l++) {
+        x[12][l] += l;
+    }
+}
+
+static void _xcrypt(chacha20poly1305_ctx_t *ctx, const uint8_t *key,
+                    const uint8_t *nonce, const uint8_t *in, uint8_t *out, size_t len)
+{
+    uint32_t x[16][CHACHA20_LANES];
+
+    /* Initialize block state, ctx->state holds the input of the block
+     * function here */
+    memset(ctx->state, 0, sizeof(ctx->state));
+    _add_initial(ctx, key, nonce, 1);
+
+    while (len) {
+        _keystream_lanes(x, ctx->state);
+        ctx->state[12] += CHACHA20_LANES;
+
+        for (unsigned l = 0; (l < CHACHA20_LANES) && len; l++) {
+            const size_t chunk = (len < 64) ? len : 64;
+
+            for (size_t j = 0; j < chunk; j++) {
+                out[j] = in[j] ^ (uint8_t)(x[j >> 2][l] >> (8 * (j & 3)));
+            }
+            in += chunk;
+            out += chunk;
+            len -= chunk;
+        }
+    }
+    crypto_secure_wipe(x, sizeof(x));
+}
+#else
 static void _xcrypt(chacha20poly1305_ctx_t *ctx, const uint8_t *key,
                     const uint8_t *nonce, const uint8_t *in, uint8_t *out, size_t len)
 {
@@ -109,6 +194,7 @@ static void _xcrypt(chacha20poly1305_ctx_t *ctx, const uint8_t *key,
         }
     }
 }
+#endif
 
 static void _poly1305_padded(poly1305_ctx_t *pctx, const uint8_t *data, size_t len)
 {
@@ -22,7 +22,15 @@ int cipher_init(cipher_t *cipher, cipher_id_t cipher_id, const uint8_t *key,
                 uint8_t key_size)
 {
     cipher->interface = cipher_id;
-    return cipher->interface->init(&cipher->context, key, key_size);
+    int res = cipher->interface->init(&cipher->context, key, key_size);
+
+    if (IS_USED(MODULE_PERIPH_CIPHER_AES) && (res == CIPHER_ERR_INVALID_KEY_SIZE) &&
+        (cipher_id == CIPHER_AES) && (cipher_id != CIPHER_AES_SW)) {
+        /* the engine does not support this key size, AES in software may */
+        cipher->interface = CIPHER_AES_SW;
+        res = cipher->interface->init(&cipher->context, key, key_size);
+    }
+    return res;
 }
 
 int cipher_encrypt(const cipher_t *cipher, const uint8_t *input,
@@ -37,6 +45,42 @@ int cipher_decrypt(const cipher_t *cipher, const uint8_t *input,
     return cipher->interface->decrypt(&cipher->context, input, output);
 }
 
+int cipher_encrypt_blocks(const cipher_t *cipher, const uint8_t *input,
+                          uint8_t *output, size_t blocks)
+{
+    if (cipher->interface->encrypt_blocks) {
+        return cipher->interface->encrypt_blocks(&cipher->context, input,
+                                                 output, blocks);
+    }
+    for (size_t i = 0; i < blocks; i++) {
+        int res = cipher->interface->encrypt(&cipher->context, input, output);
+        if (res != 1) {
+            return res;
+        }
+        input += cipher->interface->block_size;
+        output += cipher->interface->block_size;
+    }
+    return 1;
+}
+
+int cipher_decrypt_blocks(const cipher_t *cipher, const uint8_t *input,
+                          uint8_t *output, size_t blocks)
+{
+    if (cipher->interface->decrypt_blocks) {
+        return cipher->interface->decrypt_blocks(&cipher->context, input,
+                                                 output, blocks);
+    }
+    for (size_t i = 0; i < blocks; i++) {
+        int res = cipher->interface->decrypt(&cipher->context, input, output);
+        if (res != 1) {
+            return res;
+        }
+        input += cipher->interface->block_size;
+        output += cipher->interface->block_size;
+    }
+    return 1;
+}
+
 int cipher_get_block_size(const cipher_t *cipher)
 {
     return cipher->interface->block_size;
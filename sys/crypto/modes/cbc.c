@@ -64,6 +64,19 @@ int cipher_decrypt_cbc(const cipher_t *cipher, uint8_t iv[16],
         return CIPHER_ERR_INVALID_LENGTH;
     }
 
+    if (cipher_supports_blocks(cipher) && length &&
+        ((input + length <= output) || (output + length <= input))) {
+        /* unlike encryption, the blocks can be decrypted independently */
+        if (cipher_decrypt_blocks(cipher, input, output,
+                                  length / block_size) != 1) {
+            return CIPHER_ERR_DEC_FAILED;
+        }
+        for (size_t i = 0; i < length; ++i) {
+            output[i] ^= (i < block_size) ? iv[i] : input[i - block_size];
+        }
+        return length;
+    }
+
     input_block_last = iv;
     do {
         input_block = input + offset;
@@ -18,9 +18,47 @@
  * @}
  */
 
+#include <string.h>
+
 #include "crypto/helper.h"
 #include "crypto/modes/ctr.h"
 
+/* number of key stream blocks generated per call to a hardware engine */
+#define CTR_BULK_BLOCKS     (4U)
+
+static int _encrypt_ctr_bulk(const cipher_t *cipher, uint8_t nonce_counter[16],
+                             uint8_t nonce_len, const uint8_t *input,
+                             size_t length, uint8_t *output)
+{
+    uint8_t counter[CTR_BULK_BLOCKS * CIPHER_MAX_BLOCK_SIZE];
+    uint8_t stream[CTR_BULK_BLOCKS * CIPHER_MAX_BLOCK_SIZE];
+    uint8_t block_size = cipher_get_block_size(cipher);
+    size_t offset = 0;
+
+    while (offset < length) {
+        size_t len = length - offset;
+        unsigned blocks = (len + block_size - 1) / block_size;
+
+        if (blocks > CTR_BULK_BLOCKS) {
+            blocks = CTR_BULK_BLOCKS;
+            len = blocks * block_size;
+        }
+        for (unsigned i = 0; i < blocks; i++) {
+            memcpy(&counter[i * block_size], nonce_counter, block_size);
+            crypto_block_inc_ctr(nonce_counter, block_size - nonce_len);
+        }
+        if (cipher_encrypt_blocks(cipher, counter, stream, blocks) != 1) {
+            return CIPHER_ERR_ENC_FAILED;
+        }
+        for (size_t i = 0; i < len; i++) {
+            output[offset + i] = stream[i] ^ input[offset + i];
+        }
+        offset += len;
+    }
+
+    return offset;
+}
+
 int cipher_encrypt_ctr(const cipher_t *cipher, uint8_t nonce_counter[16],
                        uint8_t nonce_len, const uint8_t *input, size_t length,
                        uint8_t *output)
@@ -28,6 +66,11 @@ int cipher_encrypt_ctr(const cipher_t *cipher, uint8_t nonce_counter[16],
     size_t offset = 0;
     uint8_t stream_block[16] = { 0 }, block_size;
 
+    if (cipher_supports_blocks(cipher) && length) {
+        return _encrypt_ctr_bulk(cipher, nonce_counter, nonce_len, input,
+                                 length, output);
+    }
+
     block_size = cipher_get_block_size(cipher);
     do {
         uint8_t block_size_input;
@@ -20,8 +20,7 @@
 
 #include <string.h>
 #include "crypto/poly1305.h"
-
-static void poly1305_block(poly1305_ctx_t *ctx, uint8_t c4);
+#include "kernel_defines.h"
 
 static uint32_t u8to32(const uint8_t *p)
 {
@@ -49,7 +48,56 @@ static void _clear_c(poly1305_ctx_t *ctx)
     ctx->c_idx = 0;
 }
 
-static void poly1305_block(poly1305_ctx_t *ctx, uint8_t c4)
+#if IS_USED(MODULE_CRYPTO_POLY1305_FAST)
+/* radix 2^26 implementation, all products fit into 32x32 bit multiplications.
+ * Based on poly1305-donna-32 */
+static void poly1305_block(poly1305_ctx_t *ctx, const uint32_t *c, uint8_t c4)
+{
+    const uint32_t r0 = ctx->r[0];
+    const uint32_t r1 = ctx->r[1];
+    const uint32_t r2 = ctx->r[2];
+    const uint32_t r3 = ctx->r[3];
+    const uint32_t r4 = ctx->r[4];
+
+    const uint32_t s1 = r1 * 5;
+    const uint32_t s2 = r2 * 5;
+    const uint32_t s3 = r3 * 5;
+    const uint32_t s4 = r4 * 5;
+
+    /* h += c */
+    const uint32_t h0 = ctx->h[0] + (c[0] & 0x3ffffff);
+    const uint32_t h1 = ctx->h[1] + (((c[0] >> 26) | (c[1] << 6)) & 0x3ffffff);
+    const uint32_t h2 = ctx->h[2] + (((c[1] >> 20) | (c[2] << 12)) & 0x3ffffff);
+    const uint32_t h3 = ctx->h[3] + (((c[2] >> 14) | (c[3] << 18)) & 0x3ffffff);
+    const uint32_t h4 = ctx->h[4] + ((c[3] >> 8) | ((uint32_t)c4 << 24));
+
+    /* h * r */
+    uint64_t d0 = (uint64_t)h0 * r0 + (uint64_t)h1 * s4 + (uint64_t)h2 * s3 +
+                  (uint64_t)h3 * s2 + (uint64_t)h4 * s1;
+    uint64_t d1 = (uint64_t)h0 * r1 + (uint64_t)h1 * r0 + (uint64_t)h2 * s4 +
+                  (uint64_t)h3 * s3 + (uint64_t)h4 * s2;
+    uint64_t d2 = (uint64_t)h0 * r2 + (uint64_t)h1 * r1 + (uint64_t)h2 * r0 +
+                  (uint64_t)h3 * s4 + (uint64_t)h4 * s3;
+    uint64_t d3 = (uint64_t)h0 * r3 + (uint64_t)h1 * r2 + (uint64_t)h2 * r1 +
+                  (uint64_t)h3 * r0 + (uint64_t)h4 * s4;
+    uint64_t d4 = (uint64_t)h0 * r4 + (uint64_t)h1 * r3 + (uint64_t)h2 * r2 +
+                  (uint64_t)h3 * r1 + (uint64_t)h4 * r0;
+
+    /* partial reduction modulo 2^130 - 5 */
+    uint32_t carry;
+
+    carry = (uint32_t)(d0 >> 26); ctx->h[0] = (uint32_t)d0 & 0x3ffffff;
+    d1 += carry; carry = (uint32_t)(d1 >> 26); ctx->h[1] = (uint32_t)d1 & 0x3ffffff;
+    d2 += carry; carry = (uint32_t)(d2 >> 26); ctx->h[2] = (uint32_t)d2 & 0x3ffffff;
+    d3 += carry; carry = (uint32_t)(d3 >> 26); ctx->h[3] = (uint32_t)d3 & 0x3ffffff;
+    d4 += carry; carry = (uint32_t)(d4 >> 26); ctx->h[4] = (uint32_t)d4 & 0x3ffffff;
+    ctx->h[0] += carry * 5;
+    carry = ctx->h[0] >> 26;
+    ctx->h[0] &= 0x3ffffff;
+    ctx->h[1] += carry;
+}
+#else
+static void poly1305_block(poly1305_ctx_t *ctx, const uint32_t *c, uint8_t c4)
 {
     /* Local copies */
     const uint32_t r0 = ctx->r[0];
@@ -63,10 +111,10 @@ static void poly1305_block(poly1305_ctx_t *ctx, uint8_t c4)
     const uint32_t rr3 = (r3 >> 2) + r3;
 
     /* s = h + c, without carry propagation */
-    const uint64_t s0 = ctx->h[0] + (uint64_t)ctx->c[0];
-    const uint64_t s1 = ctx->h[1] + (uint64_t)ctx->c[1];
-    const uint64_t s2 = ctx->h[2] + (uint64_t)ctx->c[2];
-    const uint64_t s3 = ctx->h[3] + (uint64_t)ctx->c[3];
+    const uint64_t s0 = ctx->h[0] + (uint64_t)c[0];
+    const uint64_t s1 = ctx->h[1] + (uint64_t)c[1];
+    const uint64_t s2 = ctx->h[2] + (uint64_t)c[2];
+    const uint64_t s3 = ctx->h[3] + (uint64_t)c[3];
     const uint32_t s4 = ctx->h[4] + c4;
 
     /* (h + c) * r, without carry propagation */
@@ -91,6 +139,7 @@ static void poly1305_block(poly1305_ctx_t *ctx, uint8_t c4)
     ctx->h[3] = (uint32_t)u3;
     ctx->h[4] = (uint32_t)u4;
 }
+#endif
 
 static void _take_input(poly1305_ctx_t *ctx, uint8_t input)
 {
@@ -103,25 +152,57 @@ static void _take_input(poly1305_ctx_t *ctx, uint8_t input)
 
 void poly1305_update(poly1305_ctx_t *ctx, const uint8_t *data, size_t len)
 {
-    for (size_t i = 0; i < len; i++) {
-        _take_input(ctx, data[i]);
+    /* complete a partial block first */
+    while (ctx->c_idx && len) {
+        _take_input(ctx, *data++);
+        len--;
         if (ctx->c_idx == 16) {
-            poly1305_block(ctx, 1);
+            poly1305_block(ctx, ctx->c, 1);
             _clear_c(ctx);
         }
     }
+
+    /* hash full blocks straight from the input */
+    for (; len >= POLY1305_BLOCK_SIZE; len -= POLY1305_BLOCK_SIZE) {
+        const uint32_t c[4] = {
+            u8to32(data), u8to32(data + 4), u8to32(data + 8), u8to32(data + 12)
+        };
+
+        poly1305_block(ctx, c, 1);
+        data += POLY1305_BLOCK_SIZE;
+    }
+
+    while (len--) {
+        _take_input(ctx, *data++);
+    }
 }
 
 void poly1305_init(poly1305_ctx_t *ctx, const uint8_t *key)
 {
-    /* load and clamp key */
-    ctx->r[0] = u8to32(key) & 0x0fffffff;
-    for (size_t i = 1; i < 4; i++) {
-        ctx->r[i] = u8to32(&key[4 * i]) & 0x0ffffffc;
-    }
+    uint32_t r[4];
+    uint32_t pad[4];
+
+    /* load the key first, it may overlap with the context */
     for (size_t i = 0; i < 4; i++) {
-        ctx->pad[i] = u8to32(&key[16 + i * 4]);
+        r[i] = u8to32(&key[4 * i]);
+        pad[i] = u8to32(&key[16 + i * 4]);
+    }
+
+    /* clamp key */
+    r[0] &= 0x0fffffff;
+    for (size_t i = 1; i < 4; i++) {
+        r[i] &= 0x0ffffffc;
     }
+#if IS_USED(MODULE_CRYPTO_POLY1305_FAST)
+    ctx->r[0] = r[0] & 0x3ffffff;
+    ctx->r[1] = ((r[0] >> 26) | (r[1] << 6)) & 0x3ffffff;
+    ctx->r[2] = ((r[1] >> 20) | (r[2] << 12)) & 0x3ffffff;
+    ctx->r[3] = ((r[2] >> 14) | (r[3] << 18)) & 0x3ffffff;
+    ctx->r[4] = r[3] >> 8;
+#else
+    memcpy(ctx->r, r, sizeof(r));
+#endif
+    memcpy(ctx->pad, pad, sizeof(pad));
 
     /* Zero the hash */
     memset(ctx->h, 0, sizeof(ctx->h));
@@ -136,9 +217,54 @@ void poly1305_finish(poly1305_ctx_t *ctx, uint8_t *mac)
         /* (We may add less than 2^130 to the last input block) */
         _take_input(ctx, 1);
         /* And update hash */
-        poly1305_block(ctx, 0);
+        poly1305_block(ctx, ctx->c, 0);
     }
 
+#if IS_USED(MODULE_CRYPTO_POLY1305_FAST)
+    /* fully carry h */
+    uint32_t h0 = ctx->h[0];
+    uint32_t h1 = ctx->h[1];
+    uint32_t h2 = ctx->h[2];
+    uint32_t h3 = ctx->h[3];
+    uint32_t h4 = ctx->h[4];
+    uint32_t carry;
+
+    carry = h1 >> 26; h1 &= 0x3ffffff;
+    h2 += carry; carry = h2 >> 26; h2 &= 0x3ffffff;
+    h3 += carry; carry = h3 >> 26; h3 &= 0x3ffffff;
+    h4 += carry; carry = h4 >> 26; h4 &= 0x3ffffff;
+    h0 += carry * 5; carry = h0 >> 26; h0 &= 0x3ffffff;
+    h1 += carry;
+
+    /* g = h - (2^130 - 5) */
+    uint32_t g0 = h0 + 5; carry = g0 >> 26; g0 &= 0x3ffffff;
+    uint32_t g1 = h1 + carry; carry = g1 >> 26; g1 &= 0x3ffffff;
+    uint32_t g2 = h2 + carry; carry = g2 >> 26; g2 &= 0x3ffffff;
+    uint32_t g3 = h3 + carry; carry = g3 >> 26; g3 &= 0x3ffffff;
+    uint32_t g4 = h4 + carry - (1UL << 26);
+
+    /* select h if h < 2^130 - 5, g otherwise, without branching */
+    const uint32_t mask = (g4 >> 31) - 1;
+
+    h0 = (h0 & ~mask) | (g0 & mask);
+    h1 = (h1 & ~mask) | (g1 & mask);
+    h2 = (h2 & ~mask) | (g2 & mask);
+    h3 = (h3 & ~mask) | (g3 & mask);
+    h4 = (h4 & ~mask) | (g4 & mask);
+
+    /* h + pad, converted back to radix 2^32 */
+    uint64_t f;
+
+    f = (uint64_t)(h0 | (h1 << 26)) + ctx->pad[0];
+    u32to8(mac, f);
+    f = (f >> 32) + (uint32_t)((h1 >> 6) | (h2 << 20)) + ctx->pad[1];
+    u32to8(mac + 4, f);
+    f = (f >> 32) + (uint32_t)((h2 >> 12) | (h3 << 14)) + ctx->pad[2];
+    u32to8(mac + 8, f);
+    f = (f >> 32) + (uint32_t)((h3 >> 18) | (h4 << 8)) + ctx->pad[3];
+    u32to8(mac + 12, f);
+#else
+
     /* check if we should subtract 2^130-5 by performing the
      * corresponding carry propagation. */
     const uint64_t u0 = (uint64_t)5 + ctx->h[0];    // <= 1_00000004
@@ -160,7 +286,7 @@ void poly1305_finish(poly1305_ctx_t *ctx, uint8_t *mac)
 
     const uint64_t uu3 = (uu2 >> 32)   + ctx->h[3] + ctx->pad[3];
     u32to8(mac + 12, uu3);
-
+#endif
 }
 
 void poly1305_auth(uint8_t *mac, const uint8_t *data, size_t len,
@@ -33,22 +33,43 @@
 #include "xtimer.h"
 #endif
 
-void event_post(event_queue_t *queue, event_t *event)
+/* queues the event and wakes the waiter, must be called with IRQs disabled */
+static int _post(event_queue_t *queue, event_t *event)
 {
-    assert(queue && event);
-
-    unsigned state = irq_disable();
     if (!event->list_node.next) {
         clist_rpush(&queue->event_list, &event->list_node);
     }
+
     thread_t *waiter = queue->waiter;
+    if (!waiter) {
+        return 0;
+    }
+    waiter->flags |= THREAD_FLAG_EVENT;
+    return thread_flags_wake(waiter);
+}
+
+void event_post(event_queue_t *queue, event_t *event)
+{
+    assert(queue && event);
+
+    unsigned state = irq_disable();
+    int woken = _post(queue, event);
     irq_restore(state);
 
-    if (waiter) {
-        thread_flags_set(waiter, THREAD_FLAG_EVENT);
+    if (woken) {
+        thread_yield_higher();
     }
 }
 
+void event_post_deferred(event_queue_t *queue, event_t *event)
+{
+    assert(queue && event);
+
+    unsigned state = irq_disable();
+    _post(queue, event);
+    irq_restore(state);
+}
+
 void event_cancel(event_queue_t *queue, event_t *event)
 {
     assert(queue);
@@ -72,6 +93,32 @@ event_t *event_get(event_queue_t *queue)
     return result;
 }
 
+static event_t *_get_multi(event_queue_t *queues, size_t n_queues)
+{
+    for (size_t i = 0; i < n_queues; i++) {
+        clist_node_t *node = clist_lpop(&queues[i].event_list);
+        if (node) {
+            return container_of(node, event_t, list_node);
+        }
+    }
+
+    return NULL;
+}
+
+event_t *event_get_multi(event_queue_t *queues, size_t n_queues)
+{
+    assert(queues && n_queues);
+
+    unsigned state = irq_disable();
+    event_t *result = _get_multi(queues, n_queues);
+    irq_restore(state);
+
+    if (result) {
+        result->list_node.next = NULL;
+    }
+    return result;
+}
+
 event_t *event_wait_multi(event_queue_t *queues, size_t n_queues)
 {
     assert(queues && n_queues);
@@ -81,11 +128,13 @@ event_t *event_wait_multi(event_queue_t *queues, size_t n_queues)
         unsigned state = irq_disable();
         for (size_t i = 0; i < n_queues; i++) {
             assert(queues[i].waiter);
-            result = container_of(clist_lpop(&queues[i].event_list),
-                                  event_t, list_node);
-            if (result) {
-                break;
-            }
+        }
+        result = _get_multi(queues, n_queues);
+        if (result == NULL) {
+            /* All queues are empty: the flag can only be left over from
+             * events that were already taken from the queues without waiting.
+             * Clearing it avoids a spurious wakeup and rescan. */
+            thread_flags_clear(THREAD_FLAG_EVENT);
         }
         irq_restore(state);
         if (result == NULL) {
@@ -224,6 +224,31 @@ void evtimer_init(evtimer_t *evtimer, evtimer_callback_t handler)
     evtimer->events = NULL;
 }
 
+int evtimer_foreach(evtimer_t *evtimer, evtimer_foreach_cb_t cb, void *arg)
+{
+    evtimer_event_t **list = &evtimer->events;
+    uint32_t offset = 0;
+    int res = 0;
+    unsigned state = irq_disable();
+
+    _update_head_offset(evtimer);
+    while (*list) {
+        evtimer_event_t *event = *list;
+        uint32_t remaining = offset + event->offset;
+
+        if ((res = cb(event, remaining, arg))) {
+            break;
+        }
+        /* if the event was deleted, its offset was added to the next one */
+        if (*list == event) {
+            offset = remaining;
+            list = &event->next;
+        }
+    }
+    irq_restore(state);
+    return res;
+}
+
 void evtimer_print(const evtimer_t *evtimer)
 {
     evtimer_event_t *list = evtimer->events;
@@ -0,0 +1,265 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_evtimer
+ * @{
+ *
+ * @file
+ * @brief       event timer implementation using a timing wheel
+ *
+ * Events store their absolute target granule in evtimer_event_t::offset and
+ * are kept in the unsorted list of slot (target % CONFIG_EVTIMER_WHEEL_SLOTS).
+ * The timer is only set to the next granule an event is due in, so the wheel
+ * does not tick while idle.
+ *
+ * @}
+ */
+
+#include <assert.h>
+#include <inttypes.h>
+#include <stdio.h>
+
+#include "irq.h"
+#include "sched.h"
+#include "thread.h"
+
+#include "evtimer.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+#define SLOTS       CONFIG_EVTIMER_WHEEL_SLOTS
+#define GRANULARITY CONFIG_EVTIMER_WHEEL_GRANULARITY_MS
+
+static_assert(!(SLOTS & (SLOTS - 1)),
+              "CONFIG_EVTIMER_WHEEL_SLOTS must be a power of two");
+static_assert(GRANULARITY > 0,
+              "CONFIG_EVTIMER_WHEEL_GRANULARITY_MS must not be 0");
+
+static inline bool _is_due(const evtimer_t *evtimer,
+                           const evtimer_event_t *event)
+{
+    return (int32_t)(event->offset - evtimer->granule) <= 0;
+}
+
+/* granules from the current one until event is due */
+static inline uint32_t _granules_left(const evtimer_t *evtimer,
+                                      const evtimer_event_t *event)
+{
+    return _is_due(evtimer, event) ? 0 : event->offset - evtimer->granule;
+}
+
+static uint32_t _ms_left(const evtimer_t *evtimer, uint32_t granules,
+                         uint32_t now)
+{
+    uint64_t ms = (uint64_t)granules * GRANULARITY;
+    uint32_t elapsed = now - evtimer->base;
+
+    if (ms <= elapsed) {
+        return 0;
+    }
+    ms -= elapsed;
+    /* keep (now - base) from overflowing while events are pending */
+    return (ms > INT32_MAX) ? INT32_MAX : ms;
+}
+
+static void _set_timer(evtimer_t *evtimer, uint32_t target)
+{
+    uint32_t offset = _ms_left(evtimer, target - evtimer->granule,
+                               ztimer_now(ZTIMER_MSEC));
+
+    DEBUG("evtimer: setting ztimer to %" PRIu32 " ms\n", offset);
+    evtimer->next = target;
+    ztimer_set(ZTIMER_MSEC, &evtimer->timer, offset);
+}
+
+/* sets the timer to the next granule an event is due in */
+static void _update_timer(evtimer_t *evtimer)
+{
+    if (evtimer->due) {
+        _set_timer(evtimer, evtimer->granule);
+        return;
+    }
+    if (!evtimer->numof) {
+        ztimer_remove(ZTIMER_MSEC, &evtimer->timer);
+        return;
+    }
+
+    uint32_t min = UINT32_MAX;
+
+    for (unsigned i = 0; i < SLOTS; i++) {
+        evtimer_event_t *event = evtimer->slots[(evtimer->granule + i) % SLOTS];
+
+        for (; event; event = event->next) {
+            uint32_t left = _granules_left(evtimer, event);
+            if (left < min) {
+                min = left;
+            }
+        }
+        /* events of later slots are due at least i + 1 granules from now */
+        if (min <= i) {
+            break;
+        }
+    }
+    _set_timer(evtimer, evtimer->granule + min);
+}
+
+static bool _unlink(evtimer_event_t **list, evtimer_event_t *event)
+{
+    for (; *list; list = &(*list)->next) {
+        if (*list == event) {
+            *list = event->next;
+            return true;
+        }
+    }
+    return false;
+}
+
+/* moves all expired events to the list of due events */
+static void _advance(evtimer_t *evtimer)
+{
+    uint32_t granules = (ztimer_now(ZTIMER_MSEC) - evtimer->base) / GRANULARITY;
+    uint32_t from = evtimer->granule;
+    unsigned slots = (granules < SLOTS) ? granules + 1 : SLOTS;
+
+    evtimer->base += granules * GRANULARITY;
+    evtimer->granule += granules;
+
+    for (unsigned i = 0; i < slots; i++) {
+        evtimer_event_t **list = &evtimer->slots[(from + i) % SLOTS];
+
+        while (*list) {
+            evtimer_event_t *event = *list;
+            if (_is_due(evtimer, event)) {
+                *list = event->next;
+                event->next = evtimer->due;
+                evtimer->due = event;
+            }
+            else {
+                list = &event->next;
+            }
+        }
+    }
+}
+
+void evtimer_add(evtimer_t *evtimer, evtimer_event_t *event)
+{
+    unsigned state = irq_disable();
+
+    DEBUG("evtimer_add(): adding event with offset %" PRIu32 "\n", event->offset);
+
+    if (!evtimer->numof) {
+        /* the wheel did not advance while idle */
+        _advance(evtimer);
+    }
+
+    /* round up, events must not trigger early */
+    uint64_t ms = (uint64_t)(ztimer_now(ZTIMER_MSEC) - evtimer->base)
+                  + event->offset + GRANULARITY - 1;
+    uint32_t granules = ms / GRANULARITY;
+
+    if (granules > INT32_MAX) {
+        /* only possible for a granularity of 1 ms */
+        granules = INT32_MAX;
+    }
+    event->offset = evtimer->granule + granules;
+
+    evtimer_event_t **slot = &evtimer->slots[event->offset % SLOTS];
+    event->next = *slot;
+    *slot = event;
+
+    if (!evtimer->numof++ ||
+        ((int32_t)(event->offset - evtimer->next) < 0)) {
+        _set_timer(evtimer, event->offset);
+    }
+    irq_restore(state);
+    if (sched_context_switch_request) {
+        thread_yield_higher();
+    }
+}
+
+void evtimer_del(evtimer_t *evtimer, evtimer_event_t *event)
+{
+    unsigned state = irq_disable();
+
+    DEBUG("evtimer_del(): removing event with target %" PRIu32 "\n", event->offset);
+
+    if (_unlink(&evtimer->slots[event->offset % SLOTS], event) ||
+        _unlink(&evtimer->due, event)) {
+        /* an early wakeup is harmless, only stop the timer when idle */
+        if (!--evtimer->numof) {
+            ztimer_remove(ZTIMER_MSEC, &evtimer->timer);
+        }
+    }
+    irq_restore(state);
+}
+
+static void _evtimer_handler(void *arg)
+{
+    DEBUG("_evtimer_handler()\n");
+
+    evtimer_t *evtimer = (evtimer_t *)arg;
+    evtimer_event_t *event;
+
+    _advance(evtimer);
+    /* events can be deleted and added by the callbacks */
+    while ((event = evtimer->due)) {
+        evtimer->due = event->next;
+        evtimer->numof--;
+        evtimer->callback(event);
+    }
+
+    _update_timer(evtimer);
+}
+
+void evtimer_init(evtimer_t *evtimer, evtimer_callback_t handler)
+{
+    *evtimer = (evtimer_t){
+        .timer = { .callback = _evtimer_handler, .arg = evtimer },
+        .callback = handler,
+        .base = ztimer_now(ZTIMER_MSEC),
+    };
+}
+
+int evtimer_foreach(evtimer_t *evtimer, evtimer_foreach_cb_t cb, void *arg)
+{
+    int res = 0;
+    unsigned state = irq_disable();
+    uint32_t now = ztimer_now(ZTIMER_MSEC);
+
+    for (unsigned i = 0; (i <= SLOTS) && !res; i++) {
+        evtimer_event_t *event = (i < SLOTS) ? evtimer->slots[i] : evtimer->due;
+
+        while (event && !res) {
+            /* cb may delete the event */
+            evtimer_event_t *next = event->next;
+            res = cb(event, _ms_left(evtimer, _granules_left(evtimer, event), now),
+                     arg);
+            event = next;
+        }
+    }
+    irq_restore(state);
+    return res;
+}
+
+static int _print(evtimer_event_t *event, uint32_t remaining, void *arg)
+{
+    unsigned *nr = arg;
+
+    (void)event;
+    printf("ev #%u remaining=%" PRIu32 "\n", ++(*nr), remaining);
+    return 0;
+}
+
+void evtimer_print(const evtimer_t *evtimer)
+{
+    unsigned nr = 0;
+
+    evtimer_foreach((evtimer_t *)evtimer, _print, &nr);
+}
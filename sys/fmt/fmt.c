@@ -20,6 +20,7 @@
 
 #include <assert.h>
 #include <stdarg.h>
+#include <stdbool.h>
 #include <stdint.h>
 #include <stdio.h>
 #include <string.h>
@@ -30,6 +31,19 @@
 
 static const char _hex_chars[16] = "0123456789ABCDEF";
 
+/* two decimal digits at once, halves the number of divisions */
+static const char _digit_pairs[200] =
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899";
+
 static const uint32_t _tenmap[] = {
     0,
     10LU,
@@ -43,6 +57,39 @@ static const uint32_t _tenmap[] = {
 
 #define TENMAP_SIZE  ARRAY_SIZE(_tenmap)
 
+static inline void _put_pair(char *out, unsigned val)
+{
+    out[0] = _digit_pairs[2 * val];
+    out[1] = _digit_pairs[2 * val + 1];
+}
+
+static unsigned _u32_dec_len(uint32_t val)
+{
+    if (val < 100000ul) {
+        return (val < 10) ? 1 : (val < 100) ? 2 : (val < 1000) ? 3 :
+               (val < 10000) ? 4 : 5;
+    }
+    return (val < 1000000ul) ? 6 : (val < 10000000ul) ? 7 :
+           (val < 100000000ul) ? 8 : (val < 1000000000ul) ? 9 : 10;
+}
+
+/* writes val backwards, ending right before end */
+static void _u32_dec_rev(char *end, uint32_t val)
+{
+    while (val >= 100) {
+        uint32_t q = val / 100;
+        end -= 2;
+        _put_pair(end, val - q * 100);
+        val = q;
+    }
+    if (val >= 10) {
+        _put_pair(end - 2, val);
+    }
+    else {
+        end[-1] = '0' + val;
+    }
+}
+
 static inline char _to_lower(char c)
 {
     return 'a' + (c - 'A');
@@ -194,6 +241,13 @@ size_t fmt_u64_dec(char *out, uint64_t val)
     uint32_t q;
     size_t len = 0;
 
+    if (val <= UINT32_MAX) {
+        return fmt_u32_dec(out, val);
+    }
+
+    /* split into 16 bit limbs and convert them into base 10000 digits, this
+     * only needs 32 bit multiplications and divisions by a constant, so no
+     * 64 bit division helper is pulled in on 32 bit MCUs */
     d[0] = val         & 0xFFFF;
     d[1] = (val >> 16) & 0xFFFF;
     d[2] = (val >> 32) & 0xFFFF;
@@ -228,13 +282,12 @@ size_t fmt_u64_dec(char *out, uint64_t val)
 
     if (out) {
         out += len;
-        memset(out, '0', total_len - len);
         while (first) {
             first--;
-            if (d[first]) {
-                size_t tmp = fmt_u32_dec(NULL, d[first]);
-                fmt_u32_dec(out + (4 - tmp), d[first]);
-            }
+            /* d[first] < 10000, so the group is just two pairs */
+            unsigned hi = d[first] / 100;
+            _put_pair(out, hi);
+            _put_pair(out + 2, d[first] - hi * 100);
             out += 4;
         }
     }
@@ -244,24 +297,10 @@ size_t fmt_u64_dec(char *out, uint64_t val)
 
 size_t fmt_u32_dec(char *out, uint32_t val)
 {
-    size_t len = 1;
-
-    /* count needed characters */
-    /* avoid multiply overflow: uint32_t max len = 10 digits */
-    if (val >= 1000000000ul) {
-        len = 10;
-    }
-    else {
-        for (uint32_t tmp = 10; tmp <= val; len++) {
-            tmp *= 10;
-        }
-    }
+    size_t len = _u32_dec_len(val);
 
     if (out) {
-        char *ptr = out + len;
-        do {
-            *--ptr = (val % 10) + '0';
-        } while ((val /= 10));
+        _u32_dec_rev(out + len, val);
     }
 
     return len;
@@ -334,7 +373,7 @@ size_t fmt_s32_dfp(char *out, int32_t val, int scale)
         scale = -scale;
         char buf[10]; /* "2147483648" */
         int negative = val < 0;
-        uint32_t uval = negative ? -val : val;
+        uint32_t uval = negative ? -(uint32_t)val : (uint32_t)val;
         int len = fmt_u32_dec(buf, uval);
         if (negative) {
             if (out) {
@@ -357,9 +396,7 @@ size_t fmt_s32_dfp(char *out, int32_t val, int scale)
 
         if (out) {
             unsigned dot_pos = pos - scale;
-            for (unsigned i = pos; i >= dot_pos; i--) {
-                out[i] = out[i - 1];
-            }
+            memmove(&out[dot_pos + 1], &out[dot_pos], scale);
             out[dot_pos] = '.';
         }
         pos += 1;
@@ -367,6 +404,7 @@ size_t fmt_s32_dfp(char *out, int32_t val, int scale)
 
     return pos;
 }
+
 /* this is very probably not the most efficient implementation, as it at least
  * pulls in floating point math.  But it works, and it's always nice to have
  * low hanging fruits when optimizing. (Kaspar)
@@ -406,6 +444,294 @@ size_t fmt_float(char *out, float f, unsigned precision)
     return res;
 }
 
+/* Shortest round trip formatting of floats, following Ryu by Ulf Adams
+ * ("Ryu: fast float-to-string conversion", PLDI 2018). The tables hold
+ * 5^-i and 5^i, scaled to 59 and 61 significant bits. */
+#define FLOAT_POW5_INV_BITCOUNT 59
+#define FLOAT_POW5_BITCOUNT     61
+
+static const uint64_t _float_pow5_inv_split[31] = {
+    0x0800000000000001u, 0x0666666666666667u, 0x051eb851eb851eb9u,
+    0x04189374bc6a7efau, 0x068db8bac710cb2au, 0x053e2d6238da3c22u,
+    0x0431bde82d7b634eu, 0x06b5fca6af2bd216u, 0x055e63b88c230e78u,
+    0x044b82fa09b5a52du, 0x06df37f675ef6eaeu, 0x057f5ff85e592558u,
+    0x0465e6604b7a8447u, 0x0709709a125da071u, 0x05a126e1a84ae6c1u,
+    0x0480ebe7b9d58567u, 0x0734aca5f6226f0bu, 0x05c3bd5191b525a3u,
+    0x049c97747490eae9u, 0x0760f253edb4ab0eu, 0x05e72843249088d8u,
+    0x04b8ed0283a6d3e0u, 0x078e480405d7b966u, 0x060b6cd004ac9452u,
+    0x04d5f0a66a23a9dbu, 0x07bcb43d769f762bu, 0x063090312bb2c4efu,
+    0x04f3a68dbc8f03f3u, 0x07ec3daf94180651u, 0x065697bfa9acd1dau,
+    0x051212ffbaf0a7e2u,
+};
+
+static const uint64_t _float_pow5_split[47] = {
+    0x1000000000000000u, 0x1400000000000000u, 0x1900000000000000u,
+    0x1f40000000000000u, 0x1388000000000000u, 0x186a000000000000u,
+    0x1e84800000000000u, 0x1312d00000000000u, 0x17d7840000000000u,
+    0x1dcd650000000000u, 0x12a05f2000000000u, 0x174876e800000000u,
+    0x1d1a94a200000000u, 0x12309ce540000000u, 0x16bcc41e90000000u,
+    0x1c6bf52634000000u, 0x11c37937e0800000u, 0x16345785d8a00000u,
+    0x1bc16d674ec80000u, 0x1158e460913d0000u, 0x15af1d78b58c4000u,
+    0x1b1ae4d6e2ef5000u, 0x10f0cf064dd59200u, 0x152d02c7e14af680u,
+    0x1a784379d99db420u, 0x108b2a2c28029094u, 0x14adf4b7320334b9u,
+    0x19d971e4fe8401e7u, 0x1027e72f1f128130u, 0x1431e0fae6d7217cu,
+    0x193e5939a08ce9dbu, 0x1f8def8808b02452u, 0x13b8b5b5056e16b3u,
+    0x18a6e32246c99c60u, 0x1ed09bead87c0378u, 0x13426172c74d822bu,
+    0x1812f9cf7920e2b6u, 0x1e17b84357691b64u, 0x12ced32a16a1b11eu,
+    0x178287f49c4a1d66u, 0x1d6329f1c35ca4bfu, 0x125dfa371a19e6f7u,
+    0x16f578c4e0a060b5u, 0x1cb2d6f618c878e3u, 0x11efc659cf7d4b8du,
+    0x166bb7f0435c9e71u, 0x1c06a5ec5433c60du,
+};
+
+/* ceil(log2(5^e)), 1 for e == 0 */
+static inline int32_t _pow5bits(int32_t e)
+{
+    return (int32_t)(((uint32_t)e * 1217359) >> 19) + 1;
+}
+
+/* floor(log10(2^e)) */
+static inline uint32_t _log10_pow2(int32_t e)
+{
+    return ((uint32_t)e * 78913) >> 18;
+}
+
+/* floor(log10(5^e)) */
+static inline uint32_t _log10_pow5(int32_t e)
+{
+    return ((uint32_t)e * 732923) >> 20;
+}
+
+static bool _multiple_of_pow5(uint32_t val, uint32_t p)
+{
+    uint32_t count = 0;
+
+    while (val % 5 == 0) {
+        val /= 5;
+        count++;
+    }
+    return count >= p;
+}
+
+static inline bool _multiple_of_pow2(uint32_t val, uint32_t p)
+{
+    return (val & ((1ul << p) - 1)) == 0;
+}
+
+/* (m * factor) >> shift with shift > 32, using 32x32 bit multiplications */
+static inline uint32_t _mul_shift32(uint32_t m, uint64_t factor, int32_t shift)
+{
+    uint64_t bits0 = (uint64_t)m * (uint32_t)factor;
+    uint64_t bits1 = (uint64_t)m * (uint32_t)(factor >> 32);
+
+    return (uint32_t)(((bits0 >> 32) + bits1) >> (shift - 32));
+}
+
+/* returns the shortest decimal digits of a finite, non-zero float and
+ * stores their decimal exponent in e10 */
+static uint32_t _float_shortest(uint32_t mantissa, uint32_t exponent,
+                                int32_t *e10)
+{
+    int32_t e2;
+    uint32_t m2;
+
+    if (exponent == 0) {
+        e2 = 1 - 127 - 23 - 2;
+        m2 = mantissa;
+    }
+    else {
+        e2 = (int32_t)exponent - 127 - 23 - 2;
+        m2 = (1ul << 23) | mantissa;
+    }
+
+    bool accept_bounds = (m2 & 1) == 0;
+
+    /* bounds of the interval rounding to this float, times 4 */
+    uint32_t mv = 4 * m2;
+    uint32_t mp = 4 * m2 + 2;
+    uint32_t mm_shift = (mantissa != 0) || (exponent <= 1);
+    uint32_t mm = 4 * m2 - 1 - mm_shift;
+
+    uint32_t vr, vp, vm;
+    bool vm_trailing_zeros = false;
+    bool vr_trailing_zeros = false;
+    uint8_t last_removed = 0;
+
+    if (e2 >= 0) {
+        uint32_t q = _log10_pow2(e2);
+        int32_t k = FLOAT_POW5_INV_BITCOUNT + _pow5bits(q) - 1;
+        int32_t i = -e2 + (int32_t)q + k;
+
+        *e10 = q;
+        vr = _mul_shift32(mv, _float_pow5_inv_split[q], i);
+        vp = _mul_shift32(mp, _float_pow5_inv_split[q], i);
+        vm = _mul_shift32(mm, _float_pow5_inv_split[q], i);
+        if (q != 0 && (vp - 1) / 10 <= vm / 10) {
+            /* the last removed digit is needed for rounding */
+            int32_t l = FLOAT_POW5_INV_BITCOUNT + _pow5bits(q - 1) - 1;
+            last_removed = _mul_shift32(mv, _float_pow5_inv_split[q - 1],
+                                        -e2 + (int32_t)q - 1 + l) % 10;
+        }
+        if (q <= 9) {
+            /* only one of mp, mv and mm can be a multiple of 5 */
+            if (mv % 5 == 0) {
+                vr_trailing_zeros = _multiple_of_pow5(mv, q);
+            }
+            else if (accept_bounds) {
+                vm_trailing_zeros = _multiple_of_pow5(mm, q);
+            }
+            else {
+                vp -= _multiple_of_pow5(mp, q);
+            }
+        }
+    }
+    else {
+        uint32_t q = _log10_pow5(-e2);
+        int32_t i = -e2 - (int32_t)q;
+        int32_t k = _pow5bits(i) - FLOAT_POW5_BITCOUNT;
+        int32_t j = (int32_t)q - k;
+
+        *e10 = (int32_t)q + e2;
+        vr = _mul_shift32(mv, _float_pow5_split[i], j);
+        vp = _mul_shift32(mp, _float_pow5_split[i], j);
+        vm = _mul_shift32(mm, _float_pow5_split[i], j);
+        if (q != 0 && (vp - 1) / 10 <= vm / 10) {
+            j = (int32_t)q - 1 - (_pow5bits(i + 1) - FLOAT_POW5_BITCOUNT);
+            last_removed = _mul_shift32(mv, _float_pow5_split[i + 1], j) % 10;
+        }
+        if (q <= 1) {
+            /* mv has at least q trailing zero bits */
+            vr_trailing_zeros = true;
+            if (accept_bounds) {
+                vm_trailing_zeros = mm_shift == 1;
+            }
+            else {
+                vp--;
+            }
+        }
+        else if (q < 31) {
+            vr_trailing_zeros = _multiple_of_pow2(mv, q - 1);
+        }
+    }
+
+    /* remove digits as long as the interval still holds a shorter number */
+    int32_t removed = 0;
+    uint32_t output;
+
+    if (vm_trailing_zeros || vr_trailing_zeros) {
+        while (vp / 10 > vm / 10) {
+            vm_trailing_zeros &= vm % 10 == 0;
+            vr_trailing_zeros &= last_removed == 0;
+            last_removed = vr % 10;
+            vr /= 10;
+            vp /= 10;
+            vm /= 10;
+            removed++;
+        }
+        if (vm_trailing_zeros) {
+            while (vm % 10 == 0) {
+                vr_trailing_zeros &= last_removed == 0;
+                last_removed = vr % 10;
+                vr /= 10;
+                vp /= 10;
+                vm /= 10;
+                removed++;
+            }
+        }
+        if (vr_trailing_zeros && last_removed == 5 && vr % 2 == 0) {
+            /* round even */
+            last_removed = 4;
+        }
+        output = vr + ((vr == vm && (!accept_bounds || !vm_trailing_zeros)) ||
+                       last_removed >= 5);
+    }
+    else {
+        while (vp / 10 > vm / 10) {
+            last_removed = vr % 10;
+            vr /= 10;
+            vp /= 10;
+            vm /= 10;
+            removed++;
+        }
+        output = vr + (vr == vm || last_removed >= 5);
+    }
+
+    *e10 += removed;
+    return output;
+}
+
+size_t fmt_float_shortest(char *out, float f)
+{
+    char buf[FMT_FLOAT_SHORTEST_MAXLEN];
+    char *pos = buf;
+    uint32_t bits;
+
+    memcpy(&bits, &f, sizeof(bits));
+
+    uint32_t mantissa = bits & ((1ul << 23) - 1);
+    uint32_t exponent = (bits >> 23) & 0xff;
+
+    if (exponent == 0xff && mantissa) {
+        return fmt_str(out, "nan");
+    }
+    if (bits >> 31) {
+        *pos++ = '-';
+    }
+    if (exponent == 0xff) {
+        memcpy(pos, "inf", 3);
+        pos += 3;
+    }
+    else if (!exponent && !mantissa) {
+        *pos++ = '0';
+    }
+    else {
+        int32_t e10;
+        uint32_t digits = _float_shortest(mantissa, exponent, &e10);
+        int len = _u32_dec_len(digits);
+        /* position of the decimal point relative to the first digit */
+        int point = len + e10;
+
+        if (point > 0 && point <= 9) {
+            _u32_dec_rev(pos + len, digits);
+            if (point >= len) {
+                memset(pos + len, '0', point - len);
+                pos += point;
+            }
+            else {
+                memmove(pos + point + 1, pos + point, len - point);
+                pos[point] = '.';
+                pos += len + 1;
+            }
+        }
+        else if (point <= 0 && point > -4) {
+            *pos++ = '0';
+            *pos++ = '.';
+            memset(pos, '0', -point);
+            pos += -point;
+            _u32_dec_rev(pos + len, digits);
+            pos += len;
+        }
+        else {
+            _u32_dec_rev(pos + 1 + len, digits);
+            pos[0] = pos[1];
+            if (len > 1) {
+                pos[1] = '.';
+                pos += len + 1;
+            }
+            else {
+                pos++;
+            }
+            *pos++ = 'e';
+            pos += fmt_s32_dec(pos, point - 1);
+        }
+    }
+
+    size_t res = pos - buf;
+    if (out) {
+        memcpy(out, buf, res);
+    }
+    return res;
+}
+
 size_t fmt_lpad(char *out, size_t in_len, size_t pad_len, char pad_char)
 {
     if (in_len >= pad_len) {
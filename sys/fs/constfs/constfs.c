@@ -27,8 +27,14 @@
 #include <errno.h>
 
 #include "fs/constfs.h"
+#include "kernel_defines.h"
 #include "vfs.h"
 
+#if IS_USED(MODULE_CONSTFS_HEATSHRINK)
+#include "heatshrink_decoder.h"
+#include "mutex.h"
+#endif
+
 #define ENABLE_DEBUG 0
 #include "debug.h"
 
@@ -40,7 +46,11 @@ static int constfs_statvfs(vfs_mount_t *mountp, const char *restrict path, struc
 static int constfs_fstat(vfs_file_t *filp, struct stat *buf);
 static off_t constfs_lseek(vfs_file_t *filp, off_t off, int whence);
 static int constfs_open(vfs_file_t *filp, const char *name, int flags, mode_t mode);
+#if IS_USED(MODULE_CONSTFS_HEATSHRINK)
+static int constfs_close(vfs_file_t *filp);
+#endif
 static ssize_t constfs_read(vfs_file_t *filp, void *dest, size_t nbytes);
+static ssize_t constfs_read_ptr(vfs_file_t *filp, const void **data, size_t nbytes);
 
 /* Directory operations */
 static int constfs_opendir(vfs_DIR *dirp, const char *dirname);
@@ -55,7 +65,11 @@ static const vfs_file_ops_t constfs_file_ops = {
     .fstat = constfs_fstat,
     .lseek = constfs_lseek,
     .open  = constfs_open,
+#if IS_USED(MODULE_CONSTFS_HEATSHRINK)
+    .close = constfs_close,
+#endif
     .read  = constfs_read,
+    .read_ptr = constfs_read_ptr,
 };
 
 static const vfs_dir_ops_t constfs_dir_ops = {
@@ -79,6 +93,104 @@ const vfs_file_system_t constfs_file_system = {
  */
 static void _constfs_write_stat(const constfs_file_t *fp, struct stat *restrict buf);
 
+#if IS_USED(MODULE_CONSTFS_HEATSHRINK)
+/**
+ * @internal
+ * @brief Decompression state of an open compressed file
+ */
+typedef struct {
+    heatshrink_decoder decoder;     /**< decoder state */
+    const constfs_file_t *fp;       /**< file, NULL if unused */
+    size_t in_pos;                  /**< compressed bytes passed to the decoder */
+    size_t out_pos;                 /**< decompressed bytes taken from the decoder */
+} _constfs_hs_t;
+
+static _constfs_hs_t _hs[CONFIG_CONSTFS_HEATSHRINK_NUMOF];
+static mutex_t _hs_lock = MUTEX_INIT;
+
+static _constfs_hs_t *_get_hs(const vfs_file_t *filp)
+{
+    _constfs_hs_t *hs = filp->private_data.ptr;
+    if ((hs >= &_hs[0]) && (hs < &_hs[ARRAY_SIZE(_hs)])) {
+        return hs;
+    }
+    return NULL;
+}
+
+static void _hs_reset(_constfs_hs_t *hs)
+{
+    heatshrink_decoder_reset(&hs->decoder);
+    hs->in_pos = 0;
+    hs->out_pos = 0;
+}
+
+static _constfs_hs_t *_hs_alloc(const constfs_file_t *fp)
+{
+    _constfs_hs_t *res = NULL;
+    mutex_lock(&_hs_lock);
+    for (unsigned i = 0; i < ARRAY_SIZE(_hs); i++) {
+        if (_hs[i].fp == NULL) {
+            res = &_hs[i];
+            res->fp = fp;
+            break;
+        }
+    }
+    mutex_unlock(&_hs_lock);
+    if (res) {
+        _hs_reset(res);
+    }
+    return res;
+}
+
+static ssize_t _hs_read(_constfs_hs_t *hs, size_t pos, uint8_t *dest, size_t nbytes)
+{
+    const constfs_file_t *fp = hs->fp;
+    size_t done = 0;
+
+    if (pos < hs->out_pos) {
+        /* the decoder only goes forward, start over */
+        _hs_reset(hs);
+    }
+    while ((done < nbytes) && (hs->out_pos < fp->size)) {
+        /* output before pos is decompressed into dest and dropped */
+        size_t skip = (hs->out_pos < pos) ? pos - hs->out_pos : 0;
+        size_t want = skip ? skip : nbytes - done;
+        if (want > nbytes - done) {
+            want = nbytes - done;
+        }
+        size_t len = 0;
+        HSD_poll_res res = heatshrink_decoder_poll(&hs->decoder, dest + done,
+                                                   want, &len);
+        if (res < 0) {
+            return -EIO;
+        }
+        hs->out_pos += len;
+        if (!skip) {
+            done += len;
+        }
+        if (res == HSDR_POLL_MORE) {
+            continue;
+        }
+        if (hs->in_pos < fp->compressed_size) {
+            size_t sunk = 0;
+            /* the decoder does not modify its input */
+            heatshrink_decoder_sink(&hs->decoder,
+                                    (uint8_t *)fp->data + hs->in_pos,
+                                    fp->compressed_size - hs->in_pos, &sunk);
+            hs->in_pos += sunk;
+        }
+        else if (heatshrink_decoder_finish(&hs->decoder) == HSDR_FINISH_DONE) {
+            break;
+        }
+    }
+    if ((done < nbytes) && (hs->out_pos < fp->size)) {
+        /* compressed data ended before the file size was reached */
+        return -EIO;
+    }
+    return done;
+}
+#endif
+
 static int constfs_stat(vfs_mount_t *mountp, const char *restrict name, struct stat *restrict buf)
 {
     (void) name;
@@ -114,7 +226,8 @@ static int constfs_statvfs(vfs_mount_t *mountp, const char *restrict path, struc
     buf->f_frsize = sizeof(uint8_t); /* fundamental block size */
     fsblkcnt_t f_blocks = 0;
     for (size_t i = 0; i < fs->nfiles; ++i) {
-        f_blocks += fs->files[i].size;
+        f_blocks += fs->files[i].compressed_size ? fs->files[i].compressed_size
+                                                 : fs->files[i].size;
     }
     buf->f_blocks = f_blocks;  /* Blocks total */
     buf->f_bfree = 0;          /* Blocks free */
@@ -128,9 +241,20 @@ static int constfs_statvfs(vfs_mount_t *mountp, const char *restrict path, struc
     return 0;
 }
 
+static const constfs_file_t *_get_file(const vfs_file_t *filp)
+{
+#if IS_USED(MODULE_CONSTFS_HEATSHRINK)
+    _constfs_hs_t *hs = _get_hs(filp);
+    if (hs) {
+        return hs->fp;
+    }
+#endif
+    return filp->private_data.ptr;
+}
+
 static int constfs_fstat(vfs_file_t *filp, struct stat *buf)
 {
-    constfs_file_t *fp = filp->private_data.ptr;
+    const constfs_file_t *fp = _get_file(filp);
     if (buf == NULL) {
         return -EFAULT;
     }
@@ -140,7 +264,7 @@ static int constfs_fstat(vfs_file_t *filp, struct stat *buf)
 
 static off_t constfs_lseek(vfs_file_t *filp, off_t off, int whence)
 {
-    constfs_file_t *fp = filp->private_data.ptr;
+    const constfs_file_t *fp = _get_file(filp);
     switch (whence) {
         case SEEK_SET:
             break;
@@ -176,6 +300,18 @@ static int constfs_open(vfs_file_t *filp, const char *name, int flags, mode_t mo
         DEBUG("constfs_open ? \"%s\"\n", fs->files[i].path);
         if (strcmp(fs->files[i].path, name) == 0) {
             DEBUG("constfs_open: Found :)\n");
+            if (fs->files[i].compressed_size) {
+#if IS_USED(MODULE_CONSTFS_HEATSHRINK)
+                _constfs_hs_t *hs = _hs_alloc(&fs->files[i]);
+                if (hs == NULL) {
+                    return -ENFILE;
+                }
+                filp->private_data.ptr = hs;
+                return 0;
+#else
+                return -ENOTSUP;
+#endif
+            }
             filp->private_data.ptr = (void *)&fs->files[i];
             return 0;
         }
@@ -184,9 +320,22 @@ static int constfs_open(vfs_file_t *filp, const char *name, int flags, mode_t mo
     return -ENOENT;
 }
 
+#if IS_USED(MODULE_CONSTFS_HEATSHRINK)
+static int constfs_close(vfs_file_t *filp)
+{
+    _constfs_hs_t *hs = _get_hs(filp);
+    if (hs) {
+        mutex_lock(&_hs_lock);
+        hs->fp = NULL;
+        mutex_unlock(&_hs_lock);
+    }
+    return 0;
+}
+#endif
+
 static ssize_t constfs_read(vfs_file_t *filp, void *dest, size_t nbytes)
 {
-    constfs_file_t *fp = filp->private_data.ptr;
+    const constfs_file_t *fp = _get_file(filp);
     DEBUG("constfs_read: %p, %p, %lu\n", (void *)filp, dest, (unsigned long)nbytes);
     if ((size_t)filp->pos >= fp->size) {
         /* Current offset is at or beyond end of file */
@@ -196,12 +345,43 @@ static ssize_t constfs_read(vfs_file_t *filp, void *dest, size_t nbytes)
     if (nbytes > (fp->size - filp->pos)) {
         nbytes = fp->size - filp->pos;
     }
+#if IS_USED(MODULE_CONSTFS_HEATSHRINK)
+    _constfs_hs_t *hs = _get_hs(filp);
+    if (hs) {
+        ssize_t res = _hs_read(hs, filp->pos, dest, nbytes);
+        if (res > 0) {
+            filp->pos += res;
+        }
+        return res;
+    }
+#endif
     memcpy(dest, (const uint8_t *)fp->data + filp->pos, nbytes);
     DEBUG("constfs_read: read %lu bytes\n", (long unsigned)nbytes);
     filp->pos += nbytes;
     return nbytes;
 }
 
+static ssize_t constfs_read_ptr(vfs_file_t *filp, const void **data, size_t nbytes)
+{
+    const constfs_file_t *fp = _get_file(filp);
+    DEBUG("constfs_read_ptr: %p, %p, %lu\n", (void *)filp, (void *)data, (unsigned long)nbytes);
+    if (fp->compressed_size) {
+        /* the contents are not in memory, callers fall back to vfs_read() */
+        return -ENOTSUP;
+    }
+    if ((size_t)filp->pos >= fp->size) {
+        /* Current offset is at or beyond end of file */
+        return 0;
+    }
+
+    if (nbytes > (fp->size - filp->pos)) {
+        nbytes = fp->size - filp->pos;
+    }
+    *data = (const uint8_t *)fp->data + filp->pos;
+    filp->pos += nbytes;
+    return nbytes;
+}
+
 static int constfs_opendir(vfs_DIR *dirp, const char *dirname)
 {
     DEBUG("constfs_opendir: %p, \"%s\"\n", (void *)dirp, dirname);
@@ -50,6 +50,7 @@
 #include <assert.h>
 
 #include "hashes/sha2xx_common.h"
+#include "kernel_defines.h"
 
 #ifdef __BIG_ENDIAN__
 /* Copy a vector of big-endian uint32_t into a vector of bytes */
@@ -96,42 +97,74 @@ static void be32enc_vect(void *dst_, const void *src_, size_t len)
 
 #endif /* __BYTE_ORDER__ != __ORDER_BIG_ENDIAN__ */
 
+/*
+ * One round of SHA-2XX. The message schedule is computed on the fly in a
+ * window of 16 words.
+ */
+#define RND(a, b, c, d, e, f, g, h, i) do { \
+        uint32_t w = ((i) < 16) ? W[(i) & 15] : \
+                     (W[(i) & 15] += s1(W[((i) - 2) & 15]) + W[((i) - 7) & 15] + \
+                                     s0(W[((i) - 15) & 15])); \
+        uint32_t t0 = h + S1(e) + Ch(e, f, g) + w + K[i]; \
+        d += t0; \
+        h = t0 + S0(a) + Maj(a, b, c); \
+} while (0)
+
 /*
  * SHA256 block compression function.  The 256-bit state is transformed via
- * the 512-bit input block to produce a new state.
+ * the 512-bit input blocks to produce a new state.
  */
-static void sha2xx_transform(uint32_t *state, const unsigned char block[64])
+static void sha2xx_transform(uint32_t *state, const unsigned char *block,
+                             size_t blocks)
 {
-    uint32_t W[64];
-    uint32_t S[8];
-
-    /* 1. Prepare message schedule W. */
-    be32dec_vect(W, block, 64);
-    for (int i = 16; i < 64; i++) {
-        W[i] = s1(W[i - 2]) + W[i - 7] + s0(W[i - 15]) + W[i - 16];
-    }
-
-    /* 2. Initialize working variables. */
-    memcpy(S, state, 32);
-
-    /* 3. Mix. */
-    for (int i = 0; i < 64; ++i) {
-        uint32_t e = S[(68 - i) % 8], f = S[(69 - i) % 8];
-        uint32_t g = S[(70 - i) % 8], h = S[(71 - i) % 8];
-        uint32_t t0 = h + S1(e) + Ch(e, f, g) + W[i] + K[i];
-
-        uint32_t a = S[(64 - i) % 8], b = S[(65 - i) % 8];
-        uint32_t c = S[(66 - i) % 8], d = S[(67 - i) % 8];
-        uint32_t t1 = S0(a) + Maj(a, b, c);
-
-        S[(67 - i) % 8] = d + t0;
-        S[(71 - i) % 8] = t0 + t1;
-    }
-
-    /* 4. Mix local working variables into global state */
-    for (int i = 0; i < 8; i++) {
-        state[i] += S[i];
+#if IS_USED(MODULE_PERIPH_HASH_SHA256)
+    periph_hash_sha256_transform(state, block, blocks);
+#else
+    for (; blocks; blocks--, block += 64) {
+        uint32_t W[16];
+        uint32_t a = state[0], b = state[1], c = state[2], d = state[3];
+        uint32_t e = state[4], f = state[5], g = state[6], h = state[7];
+
+        be32dec_vect(W, block, 64);
+#ifdef MODULE_HASHES_SHA2XX_UNROLL
+        for (int i = 0; i < 64; i += 8) {
+            RND(a, b, c, d, e, f, g, h, i + 0);
+            RND(h, a, b, c, d, e, f, g, i + 1);
+            RND(g, h, a, b, c, d, e, f, i + 2);
+            RND(f, g, h, a, b, c, d, e, i + 3);
+            RND(e, f, g, h, a, b, c, d, i + 4);
+            RND(d, e, f, g, h, a, b, c, i + 5);
+            RND(c, d, e, f, g, h, a, b, i + 6);
+            RND(b, c, d, e, f, g, h, a, i + 7);
+        }
+#else
+        for (int i = 0; i < 64; i++) {
+            uint32_t t;
+
+            RND(a, b, c, d, e, f, g, h, i);
+            /* rename the working variables for the next round */
+            t = h;
+            h = g;
+            g = f;
+            f = e;
+            e = d;
+            d = c;
+            c = b;
+            b = a;
+            a = t;
+        }
+#endif
+
+        state[0] += a;
+        state[1] += b;
+        state[2] += c;
+        state[3] += d;
+        state[4] += e;
+        state[5] += f;
+        state[6] += g;
+        state[7] += h;
     }
+#endif
 }
 
 static unsigned char PAD[64] = {
@@ -190,15 +223,15 @@ void sha2xx_update(sha2xx_context_t *ctx, const void *data, size_t len)
     const unsigned char *src = data;
 
     memcpy(&ctx->buf[r], src, 64 - r);
-    sha2xx_transform(ctx->state, ctx->buf);
+    sha2xx_transform(ctx->state, ctx->buf, 1);
     src += 64 - r;
     len -= 64 - r;
 
-    /* Perform complete blocks */
-    while (len >= 64) {
-        sha2xx_transform(ctx->state, src);
-        src += 64;
-        len -= 64;
+    /* Perform complete blocks, all at once to allow for DMA */
+    if (len >= 64) {
+        sha2xx_transform(ctx->state, src, len / 64);
+        src += len & ~(size_t)63;
+        len &= 63;
     }
 
     /* Copy left over data into buffer */
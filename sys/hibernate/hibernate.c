@@ -0,0 +1,193 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_hibernate
+ * @{
+ *
+ * @file
+ * @brief       Hibernate state retention implementation
+ *
+ * The snapshot is a header followed by one record per state, each record is
+ * the identifier and length of the state followed by its data. The header is
+ * written last, so an interrupted save leaves no valid snapshot.
+ *
+ * @}
+ */
+
+#include <errno.h>
+
+#include "checksum/crc16_ccitt.h"
+#include "hibernate.h"
+#include "periph/rtc_mem.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+#define HIBERNATE_MAGIC     (0x4948)    /* "HI" */
+
+typedef struct {
+    uint16_t magic;
+    uint16_t len;       /**< length of the records */
+    uint16_t crc;       /**< CRC of the records */
+    uint16_t numof;     /**< number of records */
+} _hdr_t;
+
+typedef struct {
+    uint16_t id;
+    uint16_t len;
+} _rec_t;
+
+XFA_INIT_CONST(hibernate_state_t, hibernate_xfa);
+
+#define RECORDS_START   (CONFIG_HIBERNATE_RTC_MEM_OFFSET + sizeof(_hdr_t))
+
+static uint16_t _crc(unsigned pos, size_t len)
+{
+    uint8_t buf[16];
+    uint16_t crc = 0xffff;
+
+    while (len) {
+        size_t n = len < sizeof(buf) ? len : sizeof(buf);
+        rtc_mem_read(pos, buf, n);
+        crc = crc16_ccitt_false_update(crc, buf, n);
+        pos += n;
+        len -= n;
+    }
+    return crc;
+}
+
+static void _invalidate(void)
+{
+    uint16_t magic = 0;
+
+    rtc_mem_write(CONFIG_HIBERNATE_RTC_MEM_OFFSET, &magic, sizeof(magic));
+}
+
+int hibernate_write(hibernate_t *h, const void *data, size_t len)
+{
+    if (len > hibernate_remaining(h)) {
+        return -ENOSPC;
+    }
+    rtc_mem_write(h->pos, data, len);
+    h->pos += len;
+    return 0;
+}
+
+int hibernate_read(hibernate_t *h, void *data, size_t len)
+{
+    if (len > hibernate_remaining(h)) {
+        return -ENODATA;
+    }
+    rtc_mem_read(h->pos, data, len);
+    h->pos += len;
+    return 0;
+}
+
+int hibernate_save(void)
+{
+    size_t size = rtc_mem_size();
+    _hdr_t hdr = { .magic = HIBERNATE_MAGIC };
+    unsigned pos = RECORDS_START;
+
+    if (size < RECORDS_START) {
+        return -ENOSPC;
+    }
+    /* the records must fit the 16 bit length of the header */
+    if (size - RECORDS_START > UINT16_MAX) {
+        size = RECORDS_START + UINT16_MAX;
+    }
+
+    _invalidate();
+
+    for (unsigned i = 0; i < XFA_LEN(hibernate_state_t, hibernate_xfa); i++) {
+        const volatile hibernate_state_t *state = &hibernate_xfa[i];
+        hibernate_t h = { .pos = pos + sizeof(_rec_t), .end = size };
+
+        if (h.pos > h.end) {
+            return -ENOSPC;
+        }
+
+        int res = state->save(&h);
+        if (res < 0) {
+            DEBUG("hibernate: saving 0x%04x failed: %d\n", state->id, res);
+            return res;
+        }
+        if (h.pos == pos + sizeof(_rec_t)) {
+            /* nothing to keep */
+            continue;
+        }
+
+        _rec_t rec = { .id = state->id, .len = h.pos - pos - sizeof(_rec_t) };
+        rtc_mem_write(pos, &rec, sizeof(rec));
+        pos = h.pos;
+        hdr.numof++;
+    }
+
+    hdr.len = pos - RECORDS_START;
+    hdr.crc = _crc(RECORDS_START, hdr.len);
+    rtc_mem_write(CONFIG_HIBERNATE_RTC_MEM_OFFSET, &hdr, sizeof(hdr));
+
+    DEBUG("hibernate: saved %u states in %u bytes\n", hdr.numof, pos);
+    return pos - CONFIG_HIBERNATE_RTC_MEM_OFFSET;
+}
+
+static const volatile hibernate_state_t *_find(uint16_t id)
+{
+    for (unsigned i = 0; i < XFA_LEN(hibernate_state_t, hibernate_xfa); i++) {
+        if (hibernate_xfa[i].id == id) {
+            return &hibernate_xfa[i];
+        }
+    }
+    return NULL;
+}
+
+int hibernate_restore(void)
+{
+    size_t size = rtc_mem_size();
+    _hdr_t hdr;
+    int numof = 0;
+
+    if (size < RECORDS_START) {
+        return -ENOENT;
+    }
+
+    rtc_mem_read(CONFIG_HIBERNATE_RTC_MEM_OFFSET, &hdr, sizeof(hdr));
+    if ((hdr.magic != HIBERNATE_MAGIC) || (hdr.len > size - RECORDS_START) ||
+        (_crc(RECORDS_START, hdr.len) != hdr.crc)) {
+        return -ENOENT;
+    }
+
+    /* don't restore the same state twice, e.g. after a crash on restore */
+    _invalidate();
+
+    unsigned pos = RECORDS_START;
+    unsigned end = RECORDS_START + hdr.len;
+    while (end - pos >= sizeof(_rec_t)) {
+        _rec_t rec;
+
+        rtc_mem_read(pos, &rec, sizeof(rec));
+        pos += sizeof(rec);
+        if (rec.len > end - pos) {
+            break;
+        }
+
+        const volatile hibernate_state_t *state = _find(rec.id);
+        if (state) {
+            hibernate_t h = { .pos = pos, .end = pos + rec.len };
+            state->restore(&h);
+            numof++;
+        }
+        else {
+            DEBUG("hibernate: no state 0x%04x\n", rec.id);
+        }
+        pos += rec.len;
+    }
+
+    return numof;
+}
@@ -21,6 +21,15 @@
  * lower priorities are initialized first, as long as their priorities comply
  * with the current rules.
  *
+ * With the `auto_init_async` module, modules added with @ref AUTO_INIT_ASYNC
+ * do not block the boot sequence. When the sequence reaches such a module, its
+ * init function is posted to @ref AUTO_INIT_ASYNC_QUEUE as soon as all modules
+ * declared as its dependencies with @ref AUTO_INIT_DEPENDS are initialized,
+ * and the sequence continues with the next module. `main()` may thus be
+ * started before these modules are ready, use @ref auto_init_async_wait() to
+ * wait for them. Without `auto_init_async`, @ref AUTO_INIT_ASYNC is the same
+ * as @ref AUTO_INIT.
+ *
  * @experimental
  * @author      Fabian Hüßler <fabian.huessler@ovgu.de>
  */
@@ -34,6 +43,9 @@
 #if IS_USED(MODULE_PREPROCESSOR_SUCCESSOR)
 #include "preprocessor_successor.h"
 #endif
+#if IS_USED(MODULE_AUTO_INIT_ASYNC)
+#include "event.h"
+#endif
 
 #ifdef __cplusplus
 extern "C" {
@@ -56,6 +68,32 @@ typedef void (*auto_init_fn_t)(void);
  */
 typedef uint16_t auto_init_prio_t;
 
+#if IS_USED(MODULE_AUTO_INIT_ASYNC) || defined(DOXYGEN)
+#ifndef AUTO_INIT_ASYNC_QUEUE
+/**
+ * @brief   Event queue the init functions of asynchronous modules run on
+ */
+#define AUTO_INIT_ASYNC_QUEUE   EVENT_PRIO_LOWEST
+#endif
+
+/**
+ * @brief   Run time state of a module added with @ref AUTO_INIT_ASYNC
+ */
+typedef struct {
+    event_t event;          /**< Posted to run the init function */
+    auto_init_fn_t init;    /**< Function to initialize the module */
+    uint8_t state;          /**< Progress of the initialization */
+} auto_init_async_t;
+
+/**
+ * @brief   Declares that an asynchronous module depends on another one
+ */
+typedef struct {
+    auto_init_async_t *module;      /**< Module that depends on dep */
+    auto_init_async_t *dep;         /**< Module to be initialized first */
+} auto_init_dep_t;
+#endif
+
 /**
  * @brief   Type to represent a module to be auto-initialized
  */
@@ -65,9 +103,19 @@ typedef struct {
     auto_init_prio_t prio;  /**< Module priority */
     const char *name;       /**< Module auto-init function name */
 #endif
+#if IS_USED(MODULE_AUTO_INIT_ASYNC) || defined(DOXYGEN)
+    auto_init_async_t *async;   /**< State of asynchronous modules, else NULL */
+#endif
 } auto_init_module_t;
 
 #if IS_ACTIVE(CONFIG_AUTO_INIT_ENABLE_DEBUG) || defined(DOXYGEN)
+#define _AUTO_INIT_DEBUG(function, priority)                                            \
+            .prio = priority,                                                           \
+            .name = XTSTR(function),
+#else
+#define _AUTO_INIT_DEBUG(function, priority)
+#endif
+
 /**
  * @brief   Add a module to the auto-initialization array
  *
@@ -78,13 +126,61 @@ typedef struct {
     XFA_CONST(auto_init_xfa, priority)                                                  \
     auto_init_module_t auto_init_xfa_ ## function                                       \
         = { .init = (auto_init_fn_t)function,                                           \
-            .prio = priority,                                                           \
-            .name = XTSTR(function) }
-#else
-#define AUTO_INIT(function, priority)                                                   \
+            _AUTO_INIT_DEBUG(function, priority) }
+
+#if IS_USED(MODULE_AUTO_INIT_ASYNC) || defined(DOXYGEN)
+/**
+ * @brief   Add a module to the auto-initialization array that is initialized
+ *          without blocking the boot sequence
+ *
+ * @p priority must be higher than @ref AUTO_INIT_PRIO_MOD_EVENT_THREAD. No
+ * module added with @ref AUTO_INIT may rely on a module added with this macro.
+ *
+ * @param   function    Function to be called on initialization @ref auto_init_fn_t
+ * @param   priority    Priority level @ref auto_init_prio_t
+ */
+#define AUTO_INIT_ASYNC(function, priority)                                             \
+    auto_init_async_t auto_init_async_ ## function                                      \
+        = { .init = (auto_init_fn_t)function };                                         \
     XFA_CONST(auto_init_xfa, priority)                                                  \
     auto_init_module_t auto_init_xfa_ ## function                                       \
-        = { .init = (auto_init_fn_t)function }
+        = { .init = (auto_init_fn_t)function,                                           \
+            _AUTO_INIT_DEBUG(function, priority)                                        \
+            .async = &auto_init_async_ ## function }
+
+/**
+ * @brief   Declare that the asynchronous module @p function is initialized
+ *          only after the asynchronous module @p dependency
+ *
+ * Both modules must be added with @ref AUTO_INIT_ASYNC and @p dependency must
+ * have a lower priority. Modules added with @ref AUTO_INIT with a lower
+ * priority are always initialized before.
+ *
+ * @param   function    Init function of the dependent module
+ * @param   dependency  Init function of the module to be initialized first
+ */
+#define AUTO_INIT_DEPENDS(function, dependency)                                         \
+    extern auto_init_async_t auto_init_async_ ## function;                              \
+    extern auto_init_async_t auto_init_async_ ## dependency;                            \
+    XFA_CONST(auto_init_deps_xfa, 0)                                                    \
+    auto_init_dep_t auto_init_dep_ ## function ## _ ## dependency                       \
+        = { .module = &auto_init_async_ ## function,                                    \
+            .dep = &auto_init_async_ ## dependency }
+
+/**
+ * @brief   Wait until all modules added with @ref AUTO_INIT_ASYNC are
+ *          initialized
+ *
+ * @pre     Must not be called from @ref AUTO_INIT_ASYNC_QUEUE
+ */
+void auto_init_async_wait(void);
+#else
+#define AUTO_INIT_ASYNC(function, priority) AUTO_INIT(function, priority)
+/* priority already orders the modules */
+#define AUTO_INIT_DEPENDS(function, dependency) extern const unsigned __xfa_dummy
+static inline void auto_init_async_wait(void)
+{
+}
 #endif
 
 /**
@@ -20,7 +20,9 @@
 #ifndef BASE64_H
 #define BASE64_H
 
+#include <stdbool.h>
 #include <stddef.h> /* for size_t */
+#include <stdint.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -123,6 +125,141 @@ int base64url_encode(const void *data_in, size_t data_in_size,
 int base64_decode(const void *base64_in, size_t base64_in_size,
                   void *data_out, size_t *data_out_size);
 
+/**
+ * @brief   Context for encoding data to base64 in chunks
+ */
+typedef struct {
+    uint8_t buf[3];     /**< bytes not encoded yet */
+    uint8_t len;        /**< number of bytes in @ref buf */
+    bool urlsafe;       /**< use the URL and Filename Safe Alphabet */
+} base64_encode_ctx_t;
+
+/**
+ * @brief   Context for decoding base64 in chunks
+ */
+typedef struct {
+    uint8_t codes[4];   /**< codes not decoded yet */
+    uint8_t fill;       /**< number of codes in @ref codes */
+} base64_decode_ctx_t;
+
+/**
+ * @brief           Initializes a context to encode data to base64 in chunks
+ *
+ * @param[out]      ctx     context to initialize
+ */
+void base64_encode_init(base64_encode_ctx_t *ctx);
+
+/**
+ * @brief           Initializes a context to encode data to base64 with URL and
+ *                  Filename Safe Alphabet in chunks
+ *
+ * No padding is added by @ref base64_encode_finish with this context.
+ *
+ * @note            Requires the use of the `base64url` module.
+ *
+ * @param[out]      ctx     context to initialize
+ */
+void base64url_encode_init(base64_encode_ctx_t *ctx);
+
+/**
+ * @brief           Encodes the next chunk of data to base64
+ *
+ * Bytes that do not complete a group of three are kept in @p ctx, so
+ * `4 * ((pending + data_in_size) / 3)` characters are written, with less
+ * than 3 bytes pending from previous calls.
+ *
+ * @param[in,out]   ctx               encoding context
+ * @param[in]       data_in           pointer to the chunk to encode
+ * @param[in]       data_in_size      the size of `data_in`
+ * @param[out]      base64_out        pointer to store the encoded base64 string
+ * @param[in,out]   base64_out_size   pointer to the variable containing the size of `base64_out.`
+ *                                    This value is overwritten with the required size on
+ *                                    BASE64_ERROR_BUFFER_OUT_SIZE and with the actual used
+ *                                    size on BASE64_SUCCESS.
+ *
+ * @returns BASE64_SUCCESS on success,
+ *          BASE64_ERROR_BUFFER_OUT_SIZE on insufficient size for encoding to `base64_out`,
+ *          BASE64_ERROR_BUFFER_OUT if `base64_out` equals NULL
+ *                                  but the `base64_out_size` is sufficient,
+ *          BASE64_ERROR_DATA_IN if `data_in` equals NULL.
+ */
+int base64_encode_update(base64_encode_ctx_t *ctx, const void *data_in,
+                         size_t data_in_size, void *base64_out,
+                         size_t *base64_out_size);
+
+/**
+ * @brief           Encodes the bytes left in a context and adds padding
+ *
+ * At most 4 characters are written.
+ *
+ * @param[in,out]   ctx               encoding context
+ * @param[out]      base64_out        pointer to store the encoded base64 string
+ * @param[in,out]   base64_out_size   pointer to the variable containing the size of `base64_out.`
+ *                                    This value is overwritten with the required size on
+ *                                    BASE64_ERROR_BUFFER_OUT_SIZE and with the actual used
+ *                                    size on BASE64_SUCCESS.
+ *
+ * @returns BASE64_SUCCESS on success,
+ *          BASE64_ERROR_BUFFER_OUT_SIZE on insufficient size for encoding to `base64_out`,
+ *          BASE64_ERROR_BUFFER_OUT if `base64_out` equals NULL
+ *                                  but the `base64_out_size` is sufficient.
+ */
+int base64_encode_finish(base64_encode_ctx_t *ctx, void *base64_out,
+                         size_t *base64_out_size);
+
+/**
+ * @brief           Initializes a context to decode base64 in chunks
+ *
+ * @param[out]      ctx     context to initialize
+ */
+void base64_decode_init(base64_decode_ctx_t *ctx);
+
+/**
+ * @brief           Decodes the next chunk of a base64 string
+ *
+ * Codes that do not complete a group of four are kept in @p ctx. Both
+ * alphabets are accepted, padding and other symbols are skipped.
+ *
+ * @param[in,out]   ctx              decoding context
+ * @param[in]       base64_in        pointer to the chunk to decode
+ * @param[in]       base64_in_size   the size of `base64_in`
+ * @param[out]      data_out         pointer to store the decoded data
+ * @param[in,out]   data_out_size    the size of `data_out`.
+ *                                   This value is overwritten with the required size on
+ *                                   BASE64_ERROR_BUFFER_OUT_SIZE and with the actual used
+ *                                   size on BASE64_SUCCESS.
+ *
+ * @returns BASE64_SUCCESS on success,
+ *          BASE64_ERROR_BUFFER_OUT_SIZE on insufficient size for decoding to `data_out`,
+ *          BASE64_ERROR_BUFFER_OUT if `data_out` equals NULL
+ *                                  but the size for `data_out_size` is sufficient,
+ *          BASE64_ERROR_DATA_IN if `base64_in` equals NULL.
+ */
+int base64_decode_update(base64_decode_ctx_t *ctx, const void *base64_in,
+                         size_t base64_in_size, void *data_out,
+                         size_t *data_out_size);
+
+/**
+ * @brief           Decodes the codes left in a context
+ *
+ * At most 2 bytes are written.
+ *
+ * @param[in,out]   ctx              decoding context
+ * @param[out]      data_out         pointer to store the decoded data
+ * @param[in,out]   data_out_size    the size of `data_out`.
+ *                                   This value is overwritten with the required size on
+ *                                   BASE64_ERROR_BUFFER_OUT_SIZE and with the actual used
+ *                                   size on BASE64_SUCCESS.
+ *
+ * @returns BASE64_SUCCESS on success,
+ *          BASE64_ERROR_BUFFER_OUT_SIZE on insufficient size for decoding to `data_out`,
+ *          BASE64_ERROR_BUFFER_OUT if `data_out` equals NULL
+ *                                  but the size for `data_out_size` is sufficient,
+ *          BASE64_ERROR_DATA_IN_SIZE if the input ended with a single code.
+ */
+int base64_decode_finish(base64_decode_ctx_t *ctx, void *data_out,
+                         size_t *data_out_size);
+
 #ifdef __cplusplus
 }
 #endif
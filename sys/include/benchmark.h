@@ -24,12 +24,45 @@
 #include <stdint.h>
 
 #include "irq.h"
+#include "matstat.h"
 #include "ztimer.h"
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+/**
+ * @brief   Maximum number of samples @ref BENCHMARK_FUNC_STATS can take
+ */
+#ifndef CONFIG_BENCHMARK_SAMPLES_MAX
+#define CONFIG_BENCHMARK_SAMPLES_MAX    (32U)
+#endif
+
+/**
+ * @brief   Statistics over the samples of a benchmark
+ */
+typedef struct {
+    matstat_state_t stats;      /**< running statistics in ns per call */
+    /**
+     * @brief   the individual samples in ns per call, for percentiles
+     */
+    uint32_t samples[CONFIG_BENCHMARK_SAMPLES_MAX];
+    unsigned runs;              /**< number of calls per sample */
+} benchmark_stats_t;
+
+/**
+ * @brief   Summary of benchmark statistics, all values in ns per call
+ */
+typedef struct {
+    unsigned samples;           /**< number of samples taken */
+    uint32_t min;               /**< fastest sample */
+    uint32_t median;            /**< median of the samples */
+    uint32_t p99;               /**< 99th percentile of the samples */
+    uint32_t max;               /**< slowest sample */
+    int32_t mean;               /**< mean of the samples */
+    uint32_t stddev;            /**< standard deviation of the samples */
+} benchmark_summary_t;
+
 /**
  * @brief   Measure the runtime of a given function call
  *
@@ -51,6 +84,105 @@ extern "C" {
         benchmark_print_time(_benchmark_time, runs, name);      \
     } while (0)
 
+/**
+ * @brief   Measure the runtime of a given function call repeatedly and print
+ *          statistics over the samples
+ *
+ * First, @p func is run @p runs times as warmup (e.g. for caches) without
+ * taking the time. Then @p samples samples are taken, each by measuring the
+ * time it takes to run @p func @p runs times. The minimum, median, 99th
+ * percentile, maximum, mean and standard deviation of the time per call are
+ * printed as one line of JSON using @ref benchmark_stats_print.
+ *
+ * @param[in] name      name for labeling the output
+ * @param[in] samples   number of samples to take, at most
+ *                      @ref CONFIG_BENCHMARK_SAMPLES_MAX
+ * @param[in] runs      number of times to run @p func per sample
+ * @param[in] func      function call to benchmark
+ */
+#define BENCHMARK_FUNC_STATS(name, samples, runs, func)         \
+    do {                                                        \
+        benchmark_stats_t _benchmark_stats;                     \
+        BENCHMARK_STATS_COLLECT(&_benchmark_stats, samples, runs, func);\
+        benchmark_stats_print(&_benchmark_stats, name);         \
+    } while (0)
+
+/**
+ * @brief   Measure the runtime of a given function call repeatedly without
+ *          printing the statistics
+ *
+ * Same as @ref BENCHMARK_FUNC_STATS, but leaves the output to the caller,
+ * e.g. using @ref benchmark_stats_summary.
+ *
+ * @param[out] stats    statistics to fill
+ * @param[in] samples   number of samples to take, at most
+ *                      @ref CONFIG_BENCHMARK_SAMPLES_MAX
+ * @param[in] runs      number of times to run @p func per sample
+ * @param[in] func      function call to benchmark
+ */
+#define BENCHMARK_STATS_COLLECT(stats, samples, runs, func)     \
+    do {                                                        \
+        benchmark_stats_init(stats, runs);                      \
+        for (unsigned _s = 0; _s <= (samples); _s++) {          \
+            uint32_t _benchmark_time = ztimer_now(ZTIMER_USEC); \
+            for (unsigned long i = 0; i < runs; i++) {          \
+                func;                                           \
+            }                                                   \
+            _benchmark_time = (ztimer_now(ZTIMER_USEC) - _benchmark_time);\
+            if (_s) { /* first round is warmup */               \
+                benchmark_stats_add(stats, _benchmark_time);    \
+            }                                                   \
+        }                                                       \
+    } while (0)
+
+/**
+ * @brief   Initialize benchmark statistics
+ *
+ * @param[out] stats    statistics to initialize
+ * @param[in]  runs     number of calls per sample
+ */
+void benchmark_stats_init(benchmark_stats_t *stats, unsigned runs);
+
+/**
+ * @brief   Add a sample to benchmark statistics
+ *
+ * Samples exceeding @ref CONFIG_BENCHMARK_SAMPLES_MAX are ignored.
+ *
+ * @param[in,out] stats     statistics to add the sample to
+ * @param[in]     time      time in us it took to do all calls of the sample
+ */
+void benchmark_stats_add(benchmark_stats_t *stats, uint32_t time);
+
+/**
+ * @brief   Summarize benchmark statistics
+ *
+ * @note    The samples are sorted in place.
+ *
+ * @param[in,out] stats     statistics to summarize
+ * @param[out]    summary   minimum, median, 99th percentile, maximum, mean
+ *                          and standard deviation of the samples
+ */
+void benchmark_stats_summary(benchmark_stats_t *stats,
+                             benchmark_summary_t *summary);
+
+/**
+ * @brief   Print benchmark statistics as one line of JSON on STDIO
+ *
+ * All values are given in ns per call, e.g.:
+ *
+ *     { "name" : "foo", "runs" : 1000, "samples" : 10, "min" : 120,
+ *       "median" : 125, "p99" : 140, "max" : 140, "mean" : 126,
+ *       "stddev" : 5 }
+ *
+ * (without the line break).
+ *
+ * @note    The samples are sorted in place.
+ *
+ * @param[in,out] stats     statistics to print
+ * @param[in]     name      name to label the output
+ */
+void benchmark_stats_print(benchmark_stats_t *stats, const char *name);
+
 /**
  * @brief   Output the given time as well as the time per run on STDIO
  *
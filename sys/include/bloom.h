@@ -106,6 +106,10 @@
  * bits of space per inserted key, where eta is the false positive rate of
  * the Bloom filter.
  *
+ * See @ref sys_bloom_blocked for a faster variant that hashes each element
+ * once and keeps all its bits in a single cache line, and for a counting
+ * variant that supports removal.
+ *
  */
 
 /**
@@ -0,0 +1,250 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    sys_bloom_blocked Blocked Bloom filter
+ * @ingroup     sys_bloom
+ * @brief       Cache friendly Bloom filters using a single hash per element
+ *
+ * A blocked Bloom filter splits its bit array into blocks of
+ * @ref BLOOM_BLOCKED_BLOCK_SIZE bytes, the size of a typical cache line. An
+ * element is hashed once into a 64 bit value: its upper half selects the
+ * block, the lower half is split into the k probes within that block. Compared
+ * to @ref bloom_t, an insertion or a lookup costs a single hash pass and
+ * touches a single block, at the expense of a slightly higher false positive
+ * rate for the same size.
+ *
+ * The counting variant @ref bloom_counting_t uses a 4 bit counter instead of
+ * a bit per position and thus supports removing elements. A counter that
+ * reached its maximum is never decremented, so removing an element never
+ * causes a false negative.
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~{.c}
+ * static uint8_t buf[4 * BLOOM_BLOCKED_BLOCK_SIZE];
+ * bloom_blocked_t bloom;
+ *
+ * bloom_blocked_init(&bloom, buf, sizeof(buf), 6);
+ * bloom_blocked_add(&bloom, "foo", 3);
+ * if (bloom_blocked_check(&bloom, "foo", 3)) {
+ *     puts("foo may be in the set");
+ * }
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ *
+ * @{
+ *
+ * @file
+ * @brief       Blocked and counting Bloom filter API
+ */
+
+#ifndef BLOOM_BLOCKED_H
+#define BLOOM_BLOCKED_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Size of a block in bytes
+ */
+#define BLOOM_BLOCKED_BLOCK_SIZE    (64U)
+
+/**
+ * @brief   Maximum number of probes per element
+ */
+#define BLOOM_BLOCKED_K_MAX         (16U)
+
+/**
+ * @brief   Blocked Bloom filter
+ */
+typedef struct {
+    uint8_t *blocks;        /**< bit array */
+    uint32_t numof;         /**< number of blocks */
+    uint8_t k;              /**< number of probes per element */
+} bloom_blocked_t;
+
+/**
+ * @brief   Counting blocked Bloom filter
+ */
+typedef struct {
+    uint8_t *blocks;        /**< array of 4 bit counters */
+    uint32_t numof;         /**< number of blocks */
+    uint8_t k;              /**< number of probes per element */
+} bloom_counting_t;
+
+/**
+ * @brief   Hash an element to the 64 bit value used by the filters
+ *
+ * Use this to hash an element once and pass the hash to several filters or
+ * to @ref bloom_blocked_check_hash() and @ref bloom_blocked_add_hash().
+ *
+ * @param[in]   buf     element
+ * @param[in]   len     length of @p buf
+ *
+ * @return  hash of the element
+ */
+uint64_t bloom_blocked_hash(const void *buf, size_t len);
+
+/**
+ * @brief   Initialize an empty blocked Bloom filter
+ *
+ * @pre     @p size is a non-zero multiple of @ref BLOOM_BLOCKED_BLOCK_SIZE
+ * @pre     `0 < k <= BLOOM_BLOCKED_K_MAX`
+ *
+ * @param[out]  bloom   filter to initialize
+ * @param[in]   buf     memory of the filter, will be cleared
+ * @param[in]   size    size of @p buf in bytes
+ * @param[in]   k       number of probes per element
+ */
+void bloom_blocked_init(bloom_blocked_t *bloom, void *buf, size_t size,
+                        unsigned k);
+
+/**
+ * @brief   Add an element given by its hash
+ *
+ * @param[in,out]   bloom   filter
+ * @param[in]       hash    hash of the element, see @ref bloom_blocked_hash()
+ */
+void bloom_blocked_add_hash(bloom_blocked_t *bloom, uint64_t hash);
+
+/**
+ * @brief   Check for an element given by its hash
+ *
+ * @param[in]   bloom   filter
+ * @param[in]   hash    hash of the element, see @ref bloom_blocked_hash()
+ *
+ * @return  false if the element is not in the filter
+ * @return  true if the element may be in the filter
+ */
+bool bloom_blocked_check_hash(const bloom_blocked_t *bloom, uint64_t hash);
+
+/**
+ * @brief   Add an element
+ *
+ * @param[in,out]   bloom   filter
+ * @param[in]       buf     element
+ * @param[in]       len     length of @p buf
+ */
+static inline void bloom_blocked_add(bloom_blocked_t *bloom, const void *buf,
+                                     size_t len)
+{
+    bloom_blocked_add_hash(bloom, bloom_blocked_hash(buf, len));
+}
+
+/**
+ * @brief   Check for an element
+ *
+ * @param[in]   bloom   filter
+ * @param[in]   buf     element
+ * @param[in]   len     length of @p buf
+ *
+ * @return  false if the element is not in the filter
+ * @return  true if the element may be in the filter
+ */
+static inline bool bloom_blocked_check(const bloom_blocked_t *bloom,
+                                       const void *buf, size_t len)
+{
+    return bloom_blocked_check_hash(bloom, bloom_blocked_hash(buf, len));
+}
+
+/**
+ * @brief   Initialize an empty counting Bloom filter
+ *
+ * @pre     @p size is a non-zero multiple of @ref BLOOM_BLOCKED_BLOCK_SIZE
+ * @pre     `0 < k <= BLOOM_BLOCKED_K_MAX`
+ *
+ * @param[out]  bloom   filter to initialize
+ * @param[in]   buf     memory of the filter, will be cleared
+ * @param[in]   size    size of @p buf in bytes
+ * @param[in]   k       number of probes per element
+ */
+void bloom_counting_init(bloom_counting_t *bloom, void *buf, size_t size,
+                         unsigned k);
+
+/**
+ * @brief   Add an element given by its hash
+ *
+ * @param[in,out]   bloom   filter
+ * @param[in]       hash    hash of the element, see @ref bloom_blocked_hash()
+ */
+void bloom_counting_add_hash(bloom_counting_t *bloom, uint64_t hash);
+
+/**
+ * @brief   Remove an element given by its hash
+ *
+ * @pre     The element was added before
+ *
+ * @param[in,out]   bloom   filter
+ * @param[in]       hash    hash of the element, see @ref bloom_blocked_hash()
+ */
+void bloom_counting_remove_hash(bloom_counting_t *bloom, uint64_t hash);
+
+/**
+ * @brief   Check for an element given by its hash
+ *
+ * @param[in]   bloom   filter
+ * @param[in]   hash    hash of the element, see @ref bloom_blocked_hash()
+ *
+ * @return  false if the element is not in the filter
+ * @return  true if the element may be in the filter
+ */
+bool bloom_counting_check_hash(const bloom_counting_t *bloom, uint64_t hash);
+
+/**
+ * @brief   Add an element
+ *
+ * @param[in,out]   bloom   filter
+ * @param[in]       buf     element
+ * @param[in]       len     length of @p buf
+ */
+static inline void bloom_counting_add(bloom_counting_t *bloom,
+                                      const void *buf, size_t len)
+{
+    bloom_counting_add_hash(bloom, bloom_blocked_hash(buf, len));
+}
+
+/**
+ * @brief   Remove an element
+ *
+ * @pre     The element was added before
+ *
+ * @param[in,out]   bloom   filter
+ * @param[in]       buf     element
+ * @param[in]       len     length of @p buf
+ */
+static inline void bloom_counting_remove(bloom_counting_t *bloom,
+                                         const void *buf, size_t len)
+{
+    bloom_counting_remove_hash(bloom, bloom_blocked_hash(buf, len));
+}
+
+/**
+ * @brief   Check for an element
+ *
+ * @param[in]   bloom   filter
+ * @param[in]   buf     element
+ * @param[in]   len     length of @p buf
+ *
+ * @return  false if the element is not in the filter
+ * @return  true if the element may be in the filter
+ */
+static inline bool bloom_counting_check(const bloom_counting_t *bloom,
+                                        const void *buf, size_t len)
+{
+    return bloom_counting_check_hash(bloom, bloom_blocked_hash(buf, len));
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* BLOOM_BLOCKED_H */
+/** @} */
@@ -52,6 +52,21 @@ extern "C" {
 #define CAN_ISOTP_WFTMAX    (1)
 #endif
 
+#ifndef CAN_ISOTP_TX_WINDOW
+/**
+ * @brief   Maximum number of consecutive frames handed to the device at once
+ *
+ * This only applies if the receiver requests a STmin of 0. With the default
+ * of 1, the next consecutive frame is sent as soon as the previous one is
+ * confirmed.
+ *
+ * @warning Larger values must not exceed the number of TX mailboxes of the
+ *          device, and the device must send frames of the same CAN ID in
+ *          the order they were queued (e.g. bxCAN with txfp enabled).
+ */
+#define CAN_ISOTP_TX_WINDOW (1)
+#endif
+
 /**
  * @brief The isotp_fc_options struct
  *
@@ -115,6 +130,8 @@ struct isotp {
     can_reg_entry_t entry;         /**< entry containing ifnum and upper layer msg system */
     uint32_t tx_gap;               /**< transmit gap from fc (in us) */
     uint8_t tx_wft;                /**< transmit wait counter */
+    uint8_t tx_pending;            /**< number of frames in flight */
+    int tx_handles[CAN_ISOTP_TX_WINDOW]; /**< handles of the frames in flight */
     void *arg;                     /**< upper layer private arg */
 };
 
@@ -189,6 +206,18 @@ int isotp_send(struct isotp *isotp, const void *buf, int len, int flags);
 int isotp_bind(struct isotp *isotp, can_reg_entry_t *entry, void *arg,
                struct isotp_fc_options *fc_options);
 
+/**
+ * @brief Change the flow control parameters of a bound isotp channel
+ *
+ * The new block size and STmin are sent to the remote sender with the next
+ * flow control frame, i.e. they also apply to the remaining blocks of a
+ * transfer in progress.
+ *
+ * @param isotp           the channel to configure
+ * @param fc_options      flow control parameters, bs and stmin for rx, wftmax for tx
+ */
+void isotp_set_fc(struct isotp *isotp, const struct isotp_fc_options *fc_options);
+
 /**
  * @brief Release a bound isotp channel
  *
@@ -84,6 +84,10 @@ int raw_can_abort(int ifnum, int handle);
  * on the interface @p ifnum.
  * The user thread will then receive msg via IPC on reception of frame matching @p filters.
  *
+ * The filter is programmed into the device. Once the device runs out of
+ * filters, the filters which did not fit are replaced by a single filter
+ * accepting all of their frames, and the frames are filtered in software.
+ *
  * @param[in] ifnum      the interface number to listen
  * @param[in] filter     the list of filter to receive
  * @param[in] pid        the thread id of the user
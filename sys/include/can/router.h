@@ -24,6 +24,8 @@
 extern "C" {
 #endif
 
+#include <stdbool.h>
+
 #include "can/can.h"
 #include "can/pkt.h"
 
@@ -62,6 +64,62 @@ int can_router_register(can_reg_entry_t *entry, canid_t can_id, canid_t mask, vo
  */
 int can_router_unregister(can_reg_entry_t *entry, canid_t can_id, canid_t mask, void *param);
 
+/**
+ * @brief Mark a registered filter as programmed into the device or not
+ *
+ * Filters are expected to be programmed into the device when they are
+ * registered. Filters which did not fit into the device are covered by the
+ * filter returned by @ref can_router_get_sw().
+ *
+ * @param[in] ifnum   the interface number
+ * @param[in] can_id  the CAN ID of the filter
+ * @param[in] mask    the mask of the filter
+ * @param[in] hw      true if the filter is programmed into the device
+ *
+ * @return 0 on success
+ * @return -ENOENT if the filter is not registered
+ */
+int can_router_set_hw(unsigned int ifnum, canid_t can_id, canid_t mask, bool hw);
+
+/**
+ * @brief Check if a registered filter is programmed into the device
+ *
+ * @param[in] ifnum   the interface number
+ * @param[in] can_id  the CAN ID of the filter
+ * @param[in] mask    the mask of the filter
+ *
+ * @return true if the filter is registered and programmed into the device
+ */
+bool can_router_is_hw(unsigned int ifnum, canid_t can_id, canid_t mask);
+
+/**
+ * @brief Get a registered filter which is programmed into the device
+ *
+ * @param[in]  ifnum   the interface number
+ * @param[in]  eff     true for a filter of extended frames
+ * @param[out] filter  the filter
+ *
+ * @return 0 on success
+ * @return -ENOENT if no such filter is registered
+ */
+int can_router_get_hw(unsigned int ifnum, bool eff, struct can_filter *filter);
+
+/**
+ * @brief Compute a filter covering all registered filters which are not
+ *        programmed into the device
+ *
+ * The filter accepts every frame of the given format accepted by one of these
+ * filters, and possibly more. The router still dispatches received frames by
+ * the registered filters only.
+ *
+ * @param[in]  ifnum   the interface number
+ * @param[in]  eff     true to cover the filters of extended frames
+ * @param[out] filter  the covering filter, unchanged if 0 is returned
+ *
+ * @return the number of filters covered
+ */
+int can_router_get_sw(unsigned int ifnum, bool eff, struct can_filter *filter);
+
 /**
  * @brief Free a received frame
  *
@@ -33,7 +33,10 @@ extern "C" {
  * Uses the `0xedb88320` polynomial
  *
  * @note enable the `crc32_fast` module for a look-up table based implementation
- *       that trades code size for speed.
+ *       that trades code size for speed. `crc32_slice_by_4` and
+ *       `crc32_slice_by_8` add 3 KiB and 7 KiB of tables to process 4 or 8
+ *       bytes at once, which is several times faster again. On ARMv8-A cores
+ *       with the CRC32 extension, its instructions are used instead.
  *
  * @param[in] buf   The data to checksum
  * @param[in] size  Length of the data in bytes
@@ -17,6 +17,12 @@
  *
  * A chunked ringbuffer is a ringbuffer that holds chunks of data.
  *
+ * Chunks can either be assembled by copying data into the ringbuffer, or be
+ * written in place: @ref crb_reserve_chunk() provides a contiguous area of the
+ * ringbuffer (e.g. for a DMA) that is turned into a chunk by
+ * @ref crb_commit_chunk(). Likewise @ref crb_peek_chunk() gives access to the
+ * first valid chunk in place, to be released with @ref crb_consume_chunk().
+ *
  * @author  Benjamin Valentin <benjamin.valentin@ml-pa.com>
  */
 
@@ -165,6 +171,43 @@ bool crb_add_bytes(chunk_ringbuf_t *rb, const void *data, size_t len);
  */
 bool crb_end_chunk(chunk_ringbuf_t *rb, bool valid);
 
+/**
+ * @brief Start a new chunk that is written in place
+ *
+ * @note  This function is expected to be called in ISR context / with
+ *        interrupts disabled.
+ *
+ * If there is not enough contiguous space behind the current write position,
+ * the chunk is placed at the start of the work area. The chunk is completed
+ * with @ref crb_commit_chunk or discarded with @ref crb_end_chunk.
+ *
+ * @pre No other chunk has been started
+ *
+ * @param[in] rb        The Ringbuffer to work on
+ * @param[in] len       Maximum size of the chunk
+ *
+ * @return              Start of @p len contiguous bytes to write the chunk to
+ * @return NULL         If there is not enough contiguous space
+ */
+void *crb_reserve_chunk(chunk_ringbuf_t *rb, size_t len);
+
+/**
+ * @brief Close a chunk that was written in place
+ *
+ * @note  This function is expected to be called in ISR context / with
+ *        interrupts disabled.
+ *
+ * @pre A new chunk has been started with @ref crb_reserve_chunk
+ *
+ * @param[in] rb        The Ringbuffer to work on
+ * @param[in] len       Size of the chunk, at most the size reserved.
+ *                      The chunk is discarded if this is 0.
+ *
+ * @return true         If the chunk could be stored in the valid chunk array
+ * @return false        If there is no more space in the valid chunk array
+ */
+bool crb_commit_chunk(chunk_ringbuf_t *rb, size_t len);
+
 /**
  * @brief Add a complete chunk to the Ringbuffer
  *
@@ -207,6 +250,22 @@ bool crb_get_chunk_size(chunk_ringbuf_t *rb, size_t *len);
  */
 bool crb_peek_bytes(chunk_ringbuf_t *rb, void *dst, size_t offset, size_t len);
 
+/**
+ * @brief Get the first valid chunk in place without consuming it
+ *
+ * Chunks written with @ref crb_reserve_chunk are always contiguous, chunks
+ * assembled byte by byte may wrap around at the end of the work area.
+ *
+ * @param[in] rb        The Ringbuffer to work on
+ * @param[out] data     Pointer to store the start of the chunk
+ * @param[out] len      Pointer to store the size of the chunk
+ *
+ * @return true         If a valid chunk exists and is contiguous
+ * @return false        If no valid chunk exists or it is not contiguous, use
+ *                      @ref crb_chunk_foreach or @ref crb_consume_chunk then
+ */
+bool crb_peek_chunk(chunk_ringbuf_t *rb, void **data, size_t *len);
+
 /**
  * @brief Remove a chunk from the valid chunk array
  *
@@ -140,6 +140,48 @@ int aes_encrypt(const cipher_context_t *context, const uint8_t *plain_block,
 int aes_decrypt(const cipher_context_t *context, const uint8_t *cipher_block,
                 uint8_t *plain_block);
 
+/**
+ * @brief   encrypts several independent blocks
+ *
+ * The key schedule is only expanded once for all blocks. With the
+ * `crypto_aes_ct` module, two blocks are encrypted in parallel.
+ *
+ * @param       context     the cipher_context_t-struct to use for this
+ *                          encryption
+ * @param       input       pointer to the plaintext, @p blocks * blocksize
+ *                          bytes
+ * @param       output      pointer to the place where the ciphertext will be
+ *                          stored, may be equal to @p input
+ * @param       blocks      number of blocks to encrypt
+ *
+ * @return  1 on success
+ * @return  A negative value if the cipher key cannot be expanded with the
+ *          AES key schedule
+ */
+int aes_encrypt_blocks(const cipher_context_t *context, const uint8_t *input,
+                       uint8_t *output, size_t blocks);
+
+/**
+ * @brief   decrypts several independent blocks
+ *
+ * The key schedule is only expanded once for all blocks. With the
+ * `crypto_aes_ct` module, two blocks are decrypted in parallel.
+ *
+ * @param       context     the cipher_context_t-struct to use for this
+ *                          decryption
+ * @param       input       pointer to the ciphertext, @p blocks * blocksize
+ *                          bytes
+ * @param       output      pointer to the place where the plaintext will be
+ *                          stored, may be equal to @p input
+ * @param       blocks      number of blocks to decrypt
+ *
+ * @return  1 on success
+ * @return  A negative value if the cipher key cannot be expanded with the
+ *          AES key schedule
+ */
+int aes_decrypt_blocks(const cipher_context_t *context, const uint8_t *input,
+                       uint8_t *output, size_t blocks);
+
 #ifdef __cplusplus
 }
 #endif
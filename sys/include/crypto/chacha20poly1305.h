@@ -17,6 +17,11 @@
  * Nonces must be unique per message for a single key. They are allowed to be
  * predictable, e.g. a message counter and are allowed to be visible during
  * transmission.
+ *
+ * The default implementation is optimized for small flash size. With the
+ * `crypto_chacha20poly1305_fast` module, four ChaCha20 blocks are computed at
+ * once and Poly1305 is computed with 32x32 bit multiplications only
+ * (`crypto_poly1305_fast`). Both variants run in constant time.
  * @{
  *
  * @file
@@ -22,6 +22,8 @@
 #ifndef CRYPTO_CIPHERS_H
 #define CRYPTO_CIPHERS_H
 
+#include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 #include "kernel_defines.h"
 
@@ -102,6 +104,19 @@ typedef struct cipher_interface_st {
     /** @brief the decrypt function */
     int (*decrypt)(const cipher_context_t *ctx, const uint8_t *cipher_block,
                    uint8_t *plain_block);
+
+    /**
+     * @brief encrypt several independent blocks at once, may be NULL
+     *
+     * Hardware engines implement this to process whole buffers, e.g. fed by
+     * DMA, instead of one block per call.
+     */
+    int (*encrypt_blocks)(const cipher_context_t *ctx, const uint8_t *input,
+                          uint8_t *output, size_t blocks);
+
+    /** @brief decrypt several independent blocks at once, may be NULL */
+    int (*decrypt_blocks)(const cipher_context_t *ctx, const uint8_t *input,
+                          uint8_t *output, size_t blocks);
 } cipher_interface_t;
 
 /** Pointer type to BlockCipher-Interface for the Cipher-Algorithms */
@@ -109,9 +124,30 @@ typedef const cipher_interface_t *cipher_id_t;
 
 /**
  * @brief AES cipher id
+ *
+ * If the MCU provides the `periph_cipher_aes` feature, this is its AES engine,
+ * otherwise it is @ref CIPHER_AES_SW. Key sizes the engine does not support
+ * are handled by @ref CIPHER_AES_SW transparently.
  */
 extern const cipher_id_t CIPHER_AES;
 
+/**
+ * @brief AES cipher id of the software implementation
+ */
+extern const cipher_id_t CIPHER_AES_SW;
+
+#if IS_USED(MODULE_PERIPH_CIPHER_AES) || DOXYGEN
+/**
+ * @brief AES engine of the MCU, provided by the `periph_cipher_aes` driver
+ *
+ * The engine uses the same context as @ref CIPHER_AES_SW, i.e. the key is
+ * stored in @ref cipher_context_t::context, with its length in
+ * @ref cipher_context_t::key_size. Its init function returns
+ * @ref CIPHER_ERR_INVALID_KEY_SIZE for key sizes it does not support.
+ */
+extern const cipher_interface_t periph_cipher_aes_interface;
+#endif
+
 /**
  * @brief basic struct for using block ciphers
  *        contains the cipher interface and the context
@@ -173,6 +209,50 @@ int cipher_encrypt(const cipher_t *cipher, const uint8_t *input,
 int cipher_decrypt(const cipher_t *cipher, const uint8_t *input,
                    uint8_t *output);
 
+/**
+ * @brief Encrypt several independent blocks of BLOCK_SIZE length
+ *
+ * This uses the bulk operation of a hardware engine, if there is one.
+ *
+ * @param cipher     Already initialized cipher struct
+ * @param input      pointer to input data to encrypt
+ * @param output     pointer to allocated memory for encrypted data. It has to
+ *                   be of size @p blocks * BLOCK_SIZE
+ * @param blocks     number of blocks to encrypt
+ * @return           1 in case of success
+ * @return           A negative value for an error
+ */
+int cipher_encrypt_blocks(const cipher_t *cipher, const uint8_t *input,
+                          uint8_t *output, size_t blocks);
+
+/**
+ * @brief Decrypt several independent blocks of BLOCK_SIZE length
+ *
+ * This uses the bulk operation of a hardware engine, if there is one.
+ *
+ * @param cipher     Already initialized cipher struct
+ * @param input      pointer to input data to decrypt
+ * @param output     pointer to allocated memory for decrypted data. It has to
+ *                   be of size @p blocks * BLOCK_SIZE
+ * @param blocks     number of blocks to decrypt
+ * @return           1 in case of success
+ * @return           A negative value for an error
+ */
+int cipher_decrypt_blocks(const cipher_t *cipher, const uint8_t *input,
+                          uint8_t *output, size_t blocks);
+
+/**
+ * @brief Check whether a cipher processes several blocks at once
+ *
+ * @param cipher     Already initialized cipher struct
+ * @return           true, if cipher_encrypt_blocks() is faster than
+ *                   encrypting block by block
+ */
+static inline bool cipher_supports_blocks(const cipher_t *cipher)
+{
+    return cipher->interface->encrypt_blocks != NULL;
+}
+
 /**
  * @brief Get block size of cipher
  * *
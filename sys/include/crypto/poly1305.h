@@ -16,6 +16,10 @@
  * Poly1305 is a one-time authenticator designed by D.J. Bernstein. It uses a
  * 32-byte one-time key and a message and produces a 16-byte tag.
  *
+ * The `crypto_poly1305_fast` module computes Poly1305 in radix 2^26, which
+ * only needs 32x32 bit multiplications. This is faster on 32 bit MCUs, at
+ * the cost of more flash.
+ *
  * @{
  *
  * @file
@@ -42,9 +46,16 @@ extern "C" {
 
 /**
  * @brief Poly1305 context
+ *
+ * With the `crypto_poly1305_fast` module, @ref poly1305_ctx_t::r and
+ * @ref poly1305_ctx_t::h hold five limbs of 26 bit each.
  */
 typedef struct {
+#if defined(MODULE_CRYPTO_POLY1305_FAST) || defined(DOXYGEN)
+    uint32_t r[5];                          /**< first key part         */
+#else
     uint32_t r[4];                          /**< first key part         */
+#endif
     uint32_t pad[4];                        /**< Second key part        */
     uint32_t h[5];                          /**< Hash                   */
     uint32_t c[4];                          /**< Message chunk          */
@@ -264,6 +264,21 @@ static inline void event_queue_claim(event_queue_t *queue)
  */
 void event_post(event_queue_t *queue, event_t *event);
 
+/**
+ * @brief   Queue an event without yielding to the waiting thread
+ *
+ * Like event_post(), but only requests the context switch, see
+ * thread_flags_set_deferred(). An ISR posting several events this way
+ * switches to the waiting thread once when it returns. In thread context,
+ * call thread_yield_higher() after the last event.
+ *
+ * @pre     queue should be initialized
+ *
+ * @param[in]   queue   event queue to queue event in
+ * @param[in]   event   event to queue in event queue
+ */
+void event_post_deferred(event_queue_t *queue, event_t *event);
+
 /**
  * @brief   Cancel a queued event
  *
@@ -289,6 +304,25 @@ void event_cancel(event_queue_t *queue, event_t *event);
  */
 event_t *event_get(event_queue_t *queue);
 
+/**
+ * @brief   Get next event from the given event queues, non-blocking
+ *
+ * If more than one queue contains an event, the queue with the lowest index is
+ * chosen, so the queues act as priority lanes of a single event loop.
+ *
+ * In order to handle an event retrieved using this function,
+ * call event->handler(event).
+ *
+ * @pre     0 < @p n_queues (expect blowing `assert()` otherwise)
+ *
+ * @param[in]   queues      Array of event queues to get event from
+ * @param[in]   n_queues    Number of event queues passed in @p queues
+ *
+ * @returns     pointer to next event
+ * @returns     NULL if all queues are empty
+ */
+event_t *event_get_multi(event_queue_t *queues, size_t n_queues);
+
 /**
  * @brief   Get next event from the given event queues, blocking
  *
@@ -404,14 +438,24 @@ event_t *event_wait_timeout_ztimer(event_queue_t *queue,
  * queue with the lowest index is chosen. Thus, a lower index in the @p queues
  * array translates into a higher priority of the queue.
  *
+ * All pending events are handled in a batch before the thread waits for
+ * @ref THREAD_FLAG_EVENT again. The queues are rechecked in order of their
+ * index before each event, so an event posted to a higher priority queue
+ * during the batch is handled next.
+ *
  * It is pretty much defined as:
  *
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~ {.c}
- *     while ((event = event_wait_multi(queues, n_queues))) {
+ *     while (1) {
+ *         while ((event = event_get_multi(queues, n_queues))) {
+ *             event->handler(event);
+ *         }
+ *         event = event_wait_multi(queues, n_queues);
  *         event->handler(event);
  *     }
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~
  *
+ * @see event_get_multi
  * @see event_wait_multi
  *
  * @pre     The queue must have a waiter (i.e. it should have been claimed, or
@@ -424,7 +468,11 @@ static inline void event_loop_multi(event_queue_t *queues, size_t n_queues)
 {
     event_t *event;
 
-    while ((event = event_wait_multi(queues, n_queues))) {
+    while (1) {
+        while ((event = event_get_multi(queues, n_queues))) {
+            event->handler(event);
+        }
+        event = event_wait_multi(queues, n_queues);
         event->handler(event);
     }
 }
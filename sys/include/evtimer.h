@@ -33,6 +33,16 @@
  *   the pseudomodule "evtimer_on_ztimer" compiled in, evtimer is backend by
  *   @ref sys_ztimer "ZTIMER_MSEC".
  *
+ * By default, events are kept in a sorted list, so adding an event takes
+ * linear time in the number of events. With the pseudomodule "evtimer_wheel",
+ * events are instead hashed into the @ref CONFIG_EVTIMER_WHEEL_SLOTS slots of
+ * a timing wheel with a resolution of
+ * @ref CONFIG_EVTIMER_WHEEL_GRANULARITY_MS, still backed by a single
+ * ZTIMER_MSEC timer. Adding an event then takes constant time, at the cost of
+ * events being triggered up to one granule late and of the memory for the
+ * slots. Events triggering in the same granule are handled in no particular
+ * order.
+ *
  * @{
  *
  * @file
@@ -60,12 +70,36 @@
 extern "C" {
 #endif
 
+/**
+ * @defgroup sys_evtimer_conf evtimer compile configurations
+ * @ingroup config
+ * @{
+ */
+/**
+ * @brief   Number of slots of the timing wheel of module `evtimer_wheel`
+ *
+ * Must be a power of two.
+ */
+#ifndef CONFIG_EVTIMER_WHEEL_SLOTS
+#define CONFIG_EVTIMER_WHEEL_SLOTS              (32U)
+#endif
+
+/**
+ * @brief   Duration of a slot of the timing wheel of module `evtimer_wheel`
+ *          in milliseconds
+ */
+#ifndef CONFIG_EVTIMER_WHEEL_GRANULARITY_MS
+#define CONFIG_EVTIMER_WHEEL_GRANULARITY_MS     (8U)
+#endif
+/** @} */
+
 /**
  * @brief   Generic event
  */
 typedef struct evtimer_event {
     struct evtimer_event *next; /**< the next event in the queue */
-    uint32_t offset;            /**< offset in milliseconds from previous event */
+    uint32_t offset;            /**< offset in milliseconds from previous event,
+                                     the target granule with `evtimer_wheel` */
 } evtimer_event_t;
 
 /**
@@ -79,15 +113,41 @@ typedef void(*evtimer_callback_t)(evtimer_event_t* event);
 typedef struct {
 #if IS_USED(MODULE_EVTIMER_ON_ZTIMER)
     ztimer_t timer;                 /**< Timer */
-    uint32_t base;                  /**< Absolute time the first event is built on */
+    uint32_t base;                  /**< Absolute time the first event is built on,
+                                         the start of the current granule with
+                                         `evtimer_wheel` */
 #else
     xtimer_t timer;                 /**< Timer */
 #endif
     evtimer_callback_t callback;    /**< Handler function for this evtimer's
                                          event type */
+#if IS_USED(MODULE_EVTIMER_WHEEL) || defined(DOXYGEN)
+    /**
+     * @brief   Events hashed by their target granule
+     */
+    evtimer_event_t *slots[CONFIG_EVTIMER_WHEEL_SLOTS];
+    evtimer_event_t *due;           /**< Expired events not yet handled */
+    uint32_t granule;               /**< Current granule */
+    uint32_t next;                  /**< Granule the timer is set to */
+    unsigned numof;                 /**< Number of events */
+#else
     evtimer_event_t *events;        /**< Event queue */
+#endif
 } evtimer_t;
 
+/**
+ * @brief   Callback for @ref evtimer_foreach()
+ *
+ * @param[in] event     a pending event
+ * @param[in] remaining milliseconds until @p event triggers
+ * @param[in] arg       argument passed to @ref evtimer_foreach()
+ *
+ * @return  0 to continue with the next event
+ * @return  any other value to stop
+ */
+typedef int (*evtimer_foreach_cb_t)(evtimer_event_t *event, uint32_t remaining,
+                                    void *arg);
+
 /**
  * @brief   Initializes an event timer
  *
@@ -116,6 +176,23 @@ void evtimer_add(evtimer_t *evtimer, evtimer_event_t *event);
  */
 void evtimer_del(evtimer_t *evtimer, evtimer_event_t *event);
 
+/**
+ * @brief   Calls a function for every pending event of an event timer
+ *
+ * Events are visited in the order they trigger, except with module
+ * `evtimer_wheel`, where the order is unspecified. @p cb is called with
+ * interrupts disabled and may remove the event it is called for with
+ * @ref evtimer_del(), but must make no other changes to @p evtimer.
+ *
+ * @param[in] evtimer   An event timer
+ * @param[in] cb        Function to call
+ * @param[in] arg       Argument for @p cb
+ *
+ * @return  the first non-zero return value of @p cb
+ * @return  0 if @p cb returned 0 for all events
+ */
+int evtimer_foreach(evtimer_t *evtimer, evtimer_foreach_cb_t cb, void *arg);
+
 /**
  * @brief   Print overview of current state of an event timer
  *
@@ -341,6 +341,36 @@ size_t fmt_s32_dfp(char *out, int32_t val, int scale);
  */
 size_t fmt_float(char *out, float f, unsigned precision);
 
+/**
+ * @brief   Maximum length of a string written by @ref fmt_float_shortest()
+ *
+ * "-1.23456789e-45" style numbers are the longest strings written.
+ */
+#define FMT_FLOAT_SHORTEST_MAXLEN   (15U)
+
+/**
+ * @brief Format float to the shortest string that reads back as the same float
+ *
+ * Unlike @ref fmt_float(), this does not need a precision and does not use
+ * floating point math. The digits are found with integer arithmetic only,
+ * following the Ryu algorithm. Numbers with a decimal exponent from -4 to 8
+ * are written as plain decimals ("21.5", "0.001"), all others in scientific
+ * notation ("1e-07" is written as "1e-7"). Infinity and NaN are written as
+ * "inf", "-inf" and "nan".
+ *
+ * If @p out is NULL, will only return the number of characters that would have
+ * been written.
+ *
+ * @note This pulls in about 620 bytes of tables.
+ *
+ * @param[out]  out         string to write to (or NULL), must hold at least
+ *                          @ref FMT_FLOAT_SHORTEST_MAXLEN characters
+ * @param[in]   f           float value to convert
+ *
+ * @returns     nr of characters the function did or would write to out
+ */
+size_t fmt_float_shortest(char *out, float f);
+
 /**
  * @brief   Copy @p in char to string (without terminating '\0')
  *
@@ -15,6 +15,15 @@
  * RIOT VFS layer. The implementation uses an array of @c constfs_file_t objects
  * as its storage back-end.
  *
+ * Uncompressed files can be read without a copy using @ref vfs_read_ptr().
+ *
+ * With the module `constfs_heatshrink`, files can be stored compressed with
+ * @ref pkg_heatshrink. They are decompressed while they are read, using one of
+ * @ref CONFIG_CONSTFS_HEATSHRINK_NUMOF decoders that are taken on open and
+ * returned on close. Seeking backwards restarts decompression at the start of
+ * the file. `mkconstfs2.py -z` compresses the files it embeds, with the window
+ * and lookahead size of the decoder, by default `-w 8 -l 4`.
+ *
  * @{
  * @file
  * @brief   ConstFS public API
@@ -33,13 +42,25 @@
 extern "C" {
 #endif
 
+/**
+ * @brief   Number of compressed files that can be open at the same time
+ */
+#ifndef CONFIG_CONSTFS_HEATSHRINK_NUMOF
+#define CONFIG_CONSTFS_HEATSHRINK_NUMOF     (1U)
+#endif
+
 /**
  * @brief A file in ConstFS (file name + contents)
  */
 typedef struct {
     const char *path;  /**< file system relative path to file */
-    const size_t size; /**< length of @c data */
+    const size_t size; /**< length of the file contents */
     const void *data;  /**< pointer to file contents */
+    /**
+     * @brief   length of @c data if it is compressed with heatshrink,
+     *          0 if @c data is the uncompressed contents
+     */
+    const size_t compressed_size;
 } constfs_file_t;
 
 /**
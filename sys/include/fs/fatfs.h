@@ -63,6 +63,21 @@ extern "C" {
 #define CONFIG_FATFS_FORMAT_ALLOC_STATIC    0
 #endif
 
+/**
+ * @brief Size of the read-ahead buffer of a volume
+ *
+ * After @ref vfs_fadvise with @ref VFS_FADV_SEQUENTIAL or
+ * @ref VFS_FADV_WILLNEED, small reads from that file are served from a buffer
+ * filled by reads of this size. Use a multiple of the sector size, so FatFs
+ * reads whole sectors from the device at once. Only one file per volume
+ * uses the buffer at a time.
+ *
+ * If this is set to 0, read-ahead is disabled.
+ */
+#ifndef CONFIG_FATFS_READAHEAD_SIZE
+#define CONFIG_FATFS_READAHEAD_SIZE         0
+#endif
+
 /**
  * @brief Size of path buffer for absolute paths
  *
@@ -82,6 +97,13 @@ typedef struct fatfs_desc {
     /** most FatFs file operations need an absolute path. This buffer provides
         static memory to circumvent stack allocation within vfs-wrappers */
     char abs_path_str_buff[FATFS_MAX_ABS_PATH_SIZE];
+#if CONFIG_FATFS_READAHEAD_SIZE || DOXYGEN
+    vfs_file_t *ra_file;    /**< file that uses the read-ahead buffer */
+    size_t ra_pos;          /**< read position in @ref ra_buf */
+    size_t ra_len;          /**< number of bytes in @ref ra_buf */
+    /** read-ahead buffer, if CONFIG_FATFS_READAHEAD_SIZE is set */
+    uint8_t ra_buf[CONFIG_FATFS_READAHEAD_SIZE];
+#endif
 } fatfs_desc_t;
 
 /**
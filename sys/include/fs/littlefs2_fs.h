@@ -12,6 +12,21 @@
  * @ingroup     pkg_littlefs2
  * @brief       RIOT integration of littlefs version 2.x.y
  *
+ * The geometry and buffers are derived from the MTD device and the
+ * `CONFIG_LITTLEFS2_*` values, unless they are set in
+ * @ref littlefs2_desc_t::config before mounting. This way, a single mount can
+ * be tuned without changing the others:
+ *
+ * - `cache_size`, `read_size`, `prog_size`, `block_size`, `block_count` and
+ *   `block_cycles`, if not 0
+ * - `lookahead_buffer` and `lookahead_size`, if `lookahead_buffer` is set.
+ *   Each bit of the lookahead buffer tracks one block, so a buffer of
+ *   `block_count / 8` bytes avoids repeated scans of the file system for
+ *   free blocks
+ *
+ * With the module `littlefs2_fs_stats`, the accesses to the MTD device and
+ * the time spent on them are counted, see @ref littlefs2_fs_get_stats().
+ *
  * @{
  *
  * @file
@@ -25,7 +40,9 @@
 #define FS_LITTLEFS2_FS_H
 
 #include <stdalign.h>
+#include <stdbool.h>
 
+#include "kernel_defines.h"
 #include "vfs.h"
 #include "lfs.h"
 #include "mtd.h"
@@ -83,8 +100,38 @@ extern "C" {
  * The desired block size is not guaranteed to be applicable but will be respected. */
 #define CONFIG_LITTLEFS2_MIN_BLOCK_SIZE_EXP (-1)
 #endif
+
+#ifndef CONFIG_LITTLEFS2_READAHEAD_SIZE
+/** Read-ahead buffer size, if 0, read-ahead is disabled.
+ * After @ref vfs_fadvise with @ref VFS_FADV_SEQUENTIAL or
+ * @ref VFS_FADV_WILLNEED, small reads from that file are served from a buffer
+ * filled by reads of this size. Only one file per file system uses the buffer
+ * at a time. */
+#define CONFIG_LITTLEFS2_READAHEAD_SIZE     (0)
+#endif
 /** @} */
 
+/**
+ * @brief   Statistics of one type of MTD access
+ */
+typedef struct {
+    uint32_t count;             /**< number of accesses */
+    uint32_t bytes;             /**< number of bytes accessed */
+    uint32_t time_us;           /**< time spent on the accesses in us */
+} littlefs2_op_stats_t;
+
+/**
+ * @brief   littlefs statistics
+ */
+typedef struct {
+    littlefs2_op_stats_t read;  /**< reads */
+    littlefs2_op_stats_t prog;  /**< programs */
+    littlefs2_op_stats_t erase; /**< erases */
+    /** longest time a single file system operation held the file system,
+     *  e.g. while scanning for free blocks */
+    uint32_t stall_max_us;
+} littlefs2_stats_t;
+
 /**
  * @brief   littlefs descriptor for vfs integration
  */
@@ -114,12 +161,37 @@ typedef struct {
 #endif
     /** lookahead buffer to use internally */
     alignas(uint32_t) uint8_t lookahead_buf[CONFIG_LITTLEFS2_LOOKAHEAD_SIZE];
+#if CONFIG_LITTLEFS2_READAHEAD_SIZE || DOXYGEN
+    vfs_file_t *ra_file;        /**< file that uses the read-ahead buffer */
+    size_t ra_pos;              /**< read position in @p ra_buf */
+    size_t ra_len;              /**< number of bytes in @p ra_buf */
+    /** read-ahead buffer, if CONFIG_LITTLEFS2_READAHEAD_SIZE is set */
+    uint8_t ra_buf[CONFIG_LITTLEFS2_READAHEAD_SIZE];
+#endif
+#if IS_USED(MODULE_LITTLEFS2_FS_STATS) || DOXYGEN
+    littlefs2_stats_t stats;    /**< statistics */
+    uint32_t op_start;          /**< start of the current operation in us */
+#endif
     uint16_t sectors_per_block; /**< number of sectors per block */
 } littlefs2_desc_t;
 
 /** The littlefs vfs driver */
 extern const vfs_file_system_t littlefs2_file_system;
 
+/**
+ * @brief   Get the statistics of a littlefs file system
+ *
+ * The statistics are kept across mounts and are only cleared by @p reset.
+ *
+ * @note    Only available with the module `littlefs2_fs_stats`
+ *
+ * @param[in]   fs      littlefs descriptor
+ * @param[out]  stats   the statistics are written here
+ * @param[in]   reset   clear the statistics after reading them
+ */
+void littlefs2_fs_get_stats(littlefs2_desc_t *fs, littlefs2_stats_t *stats,
+                            bool reset);
+
 #ifdef __cplusplus
 }
 #endif
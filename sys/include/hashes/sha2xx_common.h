@@ -52,6 +52,8 @@
 #include <string.h>
 #include <stdint.h>
 
+#include "kernel_defines.h"
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -102,6 +104,23 @@ static const uint32_t K[64] = {
     0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2,
 };
 
+#if IS_USED(MODULE_PERIPH_HASH_SHA256) || DOXYGEN
+/**
+ * @brief   SHA-224/256 compression function of the hash engine of the MCU
+ *
+ * This is provided by MCUs with the `periph_hash_sha256` feature, for engines
+ * that can load and store the intermediate hash value. It replaces the
+ * software implementation of the compression function, padding and
+ * buffering of partial blocks are still done in software.
+ *
+ * @param[in,out] state  intermediate hash value, in host byte order
+ * @param[in] blocks     input data, @p numof * 64 bytes, may be unaligned
+ * @param[in] numof      number of blocks, at least 1
+ */
+void periph_hash_sha256_transform(uint32_t state[8], const void *blocks,
+                                  size_t numof);
+#endif
+
 /**
  * @brief SHA-2XX initialization.  Begins a SHA-2XX operation.
  *
@@ -0,0 +1,193 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    sys_hibernate   Hibernate state retention
+ * @ingroup     sys
+ * @brief       Keep selected state in RTC memory across deep sleep
+ *
+ * In deep sleep modes that power down the RAM, a node cold boots on every
+ * wake-up and has to learn its network state again. This module lets modules
+ * save state worth keeping to the RTC memory (@ref drivers_periph_rtc_mem)
+ * before going to sleep and restore it after waking up.
+ *
+ * Modules register a @ref hibernate_state_t with @ref HIBERNATE_STATE. On
+ * @ref hibernate_save() every state writes a record with
+ * @ref hibernate_write(), on @ref hibernate_restore() every state that has a
+ * record reads it back with @ref hibernate_read(). The records are covered by
+ * a CRC, so the garbage found in RTC memory after a power loss is never
+ * restored. A snapshot is restored at most once.
+ *
+ * The following states are provided:
+ *
+ * - @ref net_gnrc_ipv6_nib: neighbor cache entries with a link-layer
+ *   address, restored as STALE, so no address resolution is needed for the
+ *   first packets after waking up
+ *
+ * ## Usage
+ *
+ * ```
+ * USEMODULE += hibernate
+ * ```
+ *
+ * ```
+ * int main(void)
+ * {
+ *     if (hibernate_restore() < 0) {
+ *         // cold boot, no state to restore
+ *     }
+ *     [...]
+ *     hibernate_save();
+ *     pm_set(0);
+ * }
+ * ```
+ *
+ * @ref hibernate_restore() must be called after the modules whose state is
+ * restored are initialized, e.g. from `main()` for states of modules
+ * initialized by @ref sys_auto_init.
+ *
+ * @{
+ *
+ * @file
+ * @brief       Hibernate state retention definitions
+ */
+
+#ifndef HIBERNATE_H
+#define HIBERNATE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "xfa.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Offset of the snapshot in RTC memory
+ *
+ * The snapshot uses the RTC memory from this offset to its end.
+ */
+#ifndef CONFIG_HIBERNATE_RTC_MEM_OFFSET
+#define CONFIG_HIBERNATE_RTC_MEM_OFFSET     0
+#endif
+
+/**
+ * @name    Identifiers of the states
+ *
+ * Applications use identifiers from @ref HIBERNATE_ID_APP.
+ * @{
+ */
+#define HIBERNATE_ID_GNRC_IPV6_NIB_NC   (0x0001)    /**< NIB neighbor cache */
+#define HIBERNATE_ID_APP                (0x8000)    /**< first application ID */
+/** @} */
+
+/**
+ * @brief   Position in the record of a state
+ */
+typedef struct {
+    unsigned pos;       /**< next offset to read or write in RTC memory */
+    unsigned end;       /**< end of the record in RTC memory */
+} hibernate_t;
+
+/**
+ * @brief   State to keep while hibernating
+ */
+typedef struct {
+    uint16_t id;        /**< unique identifier of the state */
+    /**
+     * @brief   Writes the state with @ref hibernate_write()
+     *
+     * @return  0 on success, negative errno on error, which aborts
+     *          @ref hibernate_save()
+     */
+    int (*save)(hibernate_t *h);
+    /**
+     * @brief   Reads the state with @ref hibernate_read()
+     */
+    void (*restore)(hibernate_t *h);
+} hibernate_state_t;
+
+/**
+ * @brief   Registers a state
+ *
+ * ```
+ * HIBERNATE_STATE(app) = {
+ *     .id = HIBERNATE_ID_APP,
+ *     .save = _save,
+ *     .restore = _restore,
+ * };
+ * ```
+ *
+ * @param   name    name of the state
+ */
+#define HIBERNATE_STATE(name) \
+    XFA_CONST(hibernate_xfa, 0) hibernate_state_t hibernate_state_ ## name
+
+/**
+ * @brief   Saves all states to RTC memory
+ *
+ * Any snapshot in RTC memory is invalidated first.
+ *
+ * @return  bytes of RTC memory used on success
+ * @return  -ENOSPC if the states do not fit into the RTC memory
+ * @return  negative errno returned by hibernate_state_t::save()
+ */
+int hibernate_save(void);
+
+/**
+ * @brief   Restores the states saved in RTC memory and invalidates them
+ *
+ * @return  number of states restored
+ * @return  -ENOENT if there is no valid snapshot
+ */
+int hibernate_restore(void);
+
+/**
+ * @brief   Appends data to the record of a state
+ *
+ * @param[in,out]   h       position in the record
+ * @param[in]       data    data to append
+ * @param[in]       len     length of @p data
+ *
+ * @return  0 on success
+ * @return  -ENOSPC if @p data does not fit into the RTC memory
+ */
+int hibernate_write(hibernate_t *h, const void *data, size_t len);
+
+/**
+ * @brief   Reads data from the record of a state
+ *
+ * @param[in,out]   h       position in the record
+ * @param[out]      data    buffer to read into
+ * @param[in]       len     length to read
+ *
+ * @return  0 on success
+ * @return  -ENODATA if less than @p len bytes are left in the record
+ */
+int hibernate_read(hibernate_t *h, void *data, size_t len);
+
+/**
+ * @brief   Gets the number of bytes left in the record of a state
+ *
+ * @param[in]   h       position in the record
+ *
+ * @return  bytes left
+ */
+static inline size_t hibernate_remaining(const hibernate_t *h)
+{
+    return h->end - h->pos;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HIBERNATE_H */
+/** @} */
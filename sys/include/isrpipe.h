@@ -77,6 +77,17 @@ int isrpipe_write_one(isrpipe_t *isrpipe, uint8_t c);
  */
 int isrpipe_write(isrpipe_t *isrpipe, const uint8_t *buf, size_t n);
 
+/**
+ * @brief   Add bytes written in place into the isrpipe's buffer
+ *
+ * The bytes have to be written into the regions returned by
+ * @ref tsrb_get_write_region() for isrpipe_t::tsrb before, e.g. by a DMA.
+ *
+ * @param[in]   isrpipe     isrpipe object to operate on
+ * @param[in]   n           number of bytes written
+ */
+void isrpipe_write_commit(isrpipe_t *isrpipe, size_t n);
+
 /**
  * @brief   Read data from isrpipe (blocking)
  *
@@ -0,0 +1,157 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    sys_malloc_profile Heap usage profiler
+ * @ingroup     sys_malloc_ts
+ * @brief       Per call site accounting of heap allocations
+ *
+ * With the module `malloc_profile`, the thread-safe malloc wrappers record the
+ * size, the calling thread and the address of the caller of every allocation.
+ * Allocations are grouped by their call site. For each call site, the number
+ * of live blocks, the live bytes and the peak number of live bytes are kept.
+ * Global statistics contain the total live bytes and their peak. This data
+ * helps finding leaks and sources of fragmentation in the field.
+ *
+ * The call site is the return address of `malloc()`, `calloc()` or
+ * `realloc()`. It can be resolved to a function with `addr2line` on the ELF
+ * file of the application.
+ *
+ * Up to @ref CONFIG_MALLOC_PROFILE_ALLOCS_NUMOF live allocations and
+ * @ref CONFIG_MALLOC_PROFILE_SITES_NUMOF call sites are tracked. Allocations
+ * that do not fit into the tables are still served, but they are only
+ * counted in @ref malloc_profile_stats_t::untracked.
+ *
+ * @note    The live allocations are kept in a plain table that is searched
+ *          linearly on `free()`. This module is meant for debugging and adds
+ *          noticeable overhead to every allocation.
+ *
+ * Use the shell command `mprof` (module `shell_cmd_malloc_profile`) to print
+ * the statistics.
+ *
+ * @{
+ *
+ * @file
+ * @brief       Heap usage profiler API
+ */
+
+#ifndef MALLOC_PROFILE_H
+#define MALLOC_PROFILE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "sched.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef CONFIG_MALLOC_PROFILE_ALLOCS_NUMOF
+/**
+ * @brief   Number of live allocations that can be tracked
+ */
+#define CONFIG_MALLOC_PROFILE_ALLOCS_NUMOF  64
+#endif
+
+#ifndef CONFIG_MALLOC_PROFILE_SITES_NUMOF
+/**
+ * @brief   Number of call sites that can be tracked
+ */
+#define CONFIG_MALLOC_PROFILE_SITES_NUMOF   16
+#endif
+
+/**
+ * @brief   Statistics of a single call site
+ */
+typedef struct {
+    uintptr_t pc;               /**< address the allocator was called from */
+    size_t live_bytes;          /**< bytes currently allocated */
+    size_t peak_bytes;          /**< maximum of @ref live_bytes */
+    unsigned live;              /**< number of blocks currently allocated */
+    unsigned allocs;            /**< number of allocations in total */
+} malloc_profile_site_t;
+
+/**
+ * @brief   Global heap statistics
+ */
+typedef struct {
+    size_t live_bytes;          /**< bytes currently allocated */
+    size_t peak_bytes;          /**< maximum of @ref live_bytes */
+    unsigned live;              /**< number of blocks currently allocated */
+    unsigned failed;            /**< number of failed allocations */
+    unsigned untracked;         /**< allocations that did not fit the tables */
+} malloc_profile_stats_t;
+
+/**
+ * @brief   A live allocation
+ */
+typedef struct {
+    void *ptr;                  /**< address of the block, NULL if unused */
+    size_t size;                /**< requested size */
+    uint8_t site;               /**< index of the call site */
+    kernel_pid_t pid;           /**< thread that allocated the block */
+} malloc_profile_alloc_t;
+
+/**
+ * @brief   Callback for @ref malloc_profile_foreach
+ *
+ * @param[in]   alloc   live allocation
+ * @param[in]   site    call site of the allocation
+ * @param[in]   arg     argument passed to @ref malloc_profile_foreach
+ */
+typedef void (*malloc_profile_cb_t)(const malloc_profile_alloc_t *alloc,
+                                    const malloc_profile_site_t *site,
+                                    void *arg);
+
+/**
+ * @brief   Get the global heap statistics
+ *
+ * @param[out]  stats   the statistics are written here
+ */
+void malloc_profile_get_stats(malloc_profile_stats_t *stats);
+
+/**
+ * @brief   Get the statistics of the tracked call sites
+ *
+ * @param[out]  sites   array to write the statistics of the call sites to
+ * @param[in]   numof   number of elements in @p sites
+ *
+ * @return  number of call sites written to @p sites
+ */
+unsigned malloc_profile_get_sites(malloc_profile_site_t *sites, unsigned numof);
+
+/**
+ * @brief   Call @p cb for every tracked live allocation
+ *
+ * @warning The callback is run with the profiler locked. It must not
+ *          allocate or free memory.
+ *
+ * @param[in]   cb      callback to call
+ * @param[in]   arg     argument to pass to @p cb
+ */
+void malloc_profile_foreach(malloc_profile_cb_t cb, void *arg);
+
+/**
+ * @brief   Reset the peak values to the current live values
+ *
+ * Call sites without live allocations are removed.
+ */
+void malloc_profile_reset_peak(void);
+
+/**
+ * @brief   Print the global statistics and the statistics of all call sites
+ */
+void malloc_profile_print(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MALLOC_PROFILE_H */
+/** @} */
@@ -0,0 +1,195 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    sys_memarray_atomic Lock-free memory array allocator
+ * @ingroup     sys_memarray
+ * @brief       Thread and ISR safe memory array allocator with statistics
+ *
+ * Unlike @ref sys_memarray, the pools of this module may be used from any
+ * number of threads and ISRs concurrently. The free list is modified with a
+ * compare-and-swap only, interrupts are never disabled (except on CPUs that
+ * lack atomic instructions, where the C11 atomics fall back to it).
+ *
+ * The head of the free list holds the index of the first free element and a
+ * 16 bit tag that is incremented on every change. This prevents the ABA
+ * problem of a plain pointer based free list, where a preempted pop could
+ * install an element that was allocated and freed again in the meantime.
+ * A pool thus holds up to `UINT16_MAX` elements.
+ *
+ * Every pool counts the elements in use, the maximum of elements in use and
+ * the failed allocations.
+ *
+ * Pools of different element sizes can be combined to size classes: an array
+ * of pools sorted by ascending element size is passed to
+ * @ref memarray_atomic_alloc_size(), which serves a request from the smallest
+ * pool with large enough elements that is not exhausted.
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~{.c}
+ * static uint32_t small[16][4];
+ * static uint32_t large[4][32];
+ * static memarray_atomic_t pools[2];
+ *
+ * memarray_atomic_init(&pools[0], small, sizeof(small[0]), ARRAY_SIZE(small));
+ * memarray_atomic_init(&pools[1], large, sizeof(large[0]), ARRAY_SIZE(large));
+ *
+ * void *buf = memarray_atomic_alloc_size(pools, ARRAY_SIZE(pools), 20);
+ * memarray_atomic_free_any(pools, ARRAY_SIZE(pools), buf);
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ *
+ * @{
+ *
+ * @file
+ * @brief       Lock-free memory array allocator API
+ */
+
+#ifndef MEMARRAY_ATOMIC_H
+#define MEMARRAY_ATOMIC_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#ifdef __cplusplus
+#include "c11_atomics_compat.hpp"
+#else
+#include <stdatomic.h>
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Lock-free memory pool
+ */
+typedef struct {
+    atomic_uint_least32_t head; /**< index + 1 of the first free element in
+                                     the low, ABA tag in the high 16 bit */
+    atomic_uint in_use;         /**< number of allocated elements */
+    atomic_uint high_water;     /**< maximum of @ref in_use */
+    atomic_uint failed;         /**< number of failed allocations */
+    uint8_t *data;              /**< memory of the elements */
+    size_t size;                /**< size of a single element */
+    uint16_t num;               /**< number of elements */
+} memarray_atomic_t;
+
+/**
+ * @brief   Statistics of a pool
+ */
+typedef struct {
+    unsigned in_use;            /**< number of allocated elements */
+    unsigned high_water;        /**< maximum of elements allocated at once */
+    unsigned failed;            /**< number of failed allocations */
+} memarray_atomic_stats_t;
+
+/**
+ * @brief   Initialize a pool
+ *
+ * @pre `mem != NULL`
+ * @pre `data != NULL`
+ * @pre `size >= sizeof(uint16_t)`
+ * @pre `num != 0 && num <= UINT16_MAX`
+ *
+ * @param[out]  mem     pool to initialize
+ * @param[in]   data    memory of the elements
+ * @param[in]   size    size of a single element in @p data
+ * @param[in]   num     number of elements in @p data
+ */
+void memarray_atomic_init(memarray_atomic_t *mem, void *data, size_t size,
+                          size_t num);
+
+/**
+ * @brief   Allocate an element
+ *
+ * May be called from interrupt context.
+ *
+ * @note    The element is not cleared
+ *
+ * @param[in,out]   mem     pool to allocate from
+ *
+ * @return  pointer to the element
+ * @return  NULL if the pool is exhausted
+ */
+void *memarray_atomic_alloc(memarray_atomic_t *mem);
+
+/**
+ * @brief   Return an element to its pool
+ *
+ * May be called from interrupt context.
+ *
+ * @pre     @p ptr was allocated from @p mem
+ *
+ * @param[in,out]   mem     pool to return the element to
+ * @param[in]       ptr     element to free
+ */
+void memarray_atomic_free(memarray_atomic_t *mem, void *ptr);
+
+/**
+ * @brief   Check whether @p ptr is an element of @p mem
+ *
+ * @param[in]   mem     pool to check
+ * @param[in]   ptr     pointer to check
+ *
+ * @return  true if @p ptr points into the elements of @p mem
+ */
+static inline bool memarray_atomic_contains(const memarray_atomic_t *mem,
+                                            const void *ptr)
+{
+    const uint8_t *p = ptr;
+    return (p >= mem->data) && (p < mem->data + mem->size * mem->num);
+}
+
+/**
+ * @brief   Allocate an element of at least @p size bytes from size classes
+ *
+ * If the smallest fitting pool is exhausted, the next larger one is tried.
+ *
+ * @param[in,out]   pools   pools sorted by ascending element size
+ * @param[in]       numof   number of pools in @p pools
+ * @param[in]       size    requested size
+ *
+ * @return  pointer to the element
+ * @return  NULL if no fitting pool has free elements
+ */
+void *memarray_atomic_alloc_size(memarray_atomic_t *pools, unsigned numof,
+                                 size_t size);
+
+/**
+ * @brief   Return an element allocated with @ref memarray_atomic_alloc_size
+ *
+ * @pre     @p ptr was allocated from one of @p pools
+ *
+ * @param[in,out]   pools   pools @p ptr was allocated from
+ * @param[in]       numof   number of pools in @p pools
+ * @param[in]       ptr     element to free
+ */
+void memarray_atomic_free_any(memarray_atomic_t *pools, unsigned numof,
+                              void *ptr);
+
+/**
+ * @brief   Get the statistics of a pool
+ *
+ * @param[in]   mem     pool
+ * @param[out]  stats   statistics of @p mem
+ */
+void memarray_atomic_get_stats(memarray_atomic_t *mem,
+                               memarray_atomic_stats_t *stats);
+
+/**
+ * @brief   Reset the high water mark of a pool to the elements in use
+ *
+ * @param[in,out]   mem     pool
+ */
+void memarray_atomic_reset_high_water(memarray_atomic_t *mem);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MEMARRAY_ATOMIC_H */
+/** @} */
@@ -0,0 +1,187 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    sys_mtd_kvs     MTD key-value store
+ * @ingroup     sys
+ * @brief       Log-structured key-value store on MTD
+ *
+ * This module stores values by string keys in the sectors of a
+ * @ref mtd_dev_t. It is meant for configuration and credentials: thousands of
+ * small values that are read far more often than written.
+ *
+ * Entries are appended to the current sector. Setting a key writes a new
+ * entry, deleting a key writes a tombstone. When the current sector is full,
+ * the next sector is opened, and the live entries of the sector after it are
+ * copied into the new sector before it is erased. So one sector is always
+ * free, and every sector is erased equally often.
+ *
+ * Keys are hashed into buckets. For every bucket, only the location of its
+ * newest entry is kept in RAM, in an array provided by the user. Every entry
+ * links to the entry written before it in the same bucket, so the index lives
+ * on flash. A lookup follows this chain from the newest entry, comparing a
+ * 16 bit hash of the keys first. With enough buckets, the chains are short
+ * and a lookup only reads a few entry headers. On @ref mtd_kvs_init(), the
+ * buckets are rebuilt by reading the entry headers of all sectors.
+ *
+ * Every entry carries a CRC covering the entry and the sequence number of its
+ * sector. Entries torn by a power failure are dropped when the store is
+ * initialized.
+ *
+ * The store requires erased memory to read as `0xff`, a write size of at most
+ * @ref MTD_KVS_ALIGN bytes and sectors of at most 64 KiB.
+ *
+ * ## Usage
+ *
+ * ```
+ * USEMODULE += mtd_kvs
+ * ```
+ *
+ * ```
+ * static uint32_t seq[8];
+ * static uint32_t buckets[256];
+ * static mtd_kvs_t kvs = {
+ *     .mtd = MTD_0,
+ *     .first_sector = 0,
+ *     .sectors = ARRAY_SIZE(seq),
+ *     .seq = seq,
+ *     .buckets = buckets,
+ *     .buckets_numof = ARRAY_SIZE(buckets),
+ * };
+ *
+ * mtd_kvs_init(&kvs);
+ * mtd_kvs_set(&kvs, "wifi/ssid", "RIOT", 4);
+ * ```
+ *
+ * @{
+ *
+ * @file
+ * @brief       MTD key-value store interface definitions
+ */
+
+#ifndef MTD_KVS_H
+#define MTD_KVS_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "mtd.h"
+#include "mutex.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup sys_mtd_kvs_conf MTD key-value store compile configurations
+ * @ingroup  config
+ * @{
+ */
+/**
+ * @brief   Maximum length of a key
+ *
+ * Keys are read to the stack to compare them.
+ */
+#ifndef CONFIG_MTD_KVS_KEY_LEN_MAX
+#define CONFIG_MTD_KVS_KEY_LEN_MAX  (32U)
+#endif
+/** @} */
+
+/**
+ * @brief   Alignment of entries in the store
+ *
+ * The write size of the MTD device must be a divider of this.
+ */
+#define MTD_KVS_ALIGN       (8U)
+
+/**
+ * @brief   MTD key-value store
+ *
+ * The first six members must be set by the user before calling
+ * @ref mtd_kvs_init().
+ */
+typedef struct {
+    mtd_dev_t *mtd;             /**< MTD device holding the store */
+    uint32_t first_sector;      /**< first sector of the store on @ref mtd */
+    uint32_t sectors;           /**< number of sectors of the store, at least 2 */
+    uint32_t *seq;              /**< sequence numbers of the @ref sectors
+                                 *   sectors */
+    uint32_t *buckets;          /**< newest entry of every bucket */
+    uint32_t buckets_numof;     /**< number of @ref buckets, a power of two */
+    mutex_t lock;               /**< lock of the store */
+    uint32_t sector_size;       /**< size of a sector in bytes */
+    uint32_t head;              /**< sector entries are appended to */
+    uint32_t offset;            /**< offset of the next entry in @ref head */
+} mtd_kvs_t;
+
+/**
+ * @brief   Initializes a store and rebuilds its index
+ *
+ * An MTD area without a valid store is set up as an empty store.
+ *
+ * @param[in,out] kvs   Store to initialize.
+ *
+ * @return  0 on success
+ * @return  -ENOTSUP, if the MTD device is not suitable for the store
+ * @return  <0 on MTD errors
+ */
+int mtd_kvs_init(mtd_kvs_t *kvs);
+
+/**
+ * @brief   Gets the value of a key
+ *
+ * @param[in] kvs       Store to read.
+ * @param[in] key       Key to look up.
+ * @param[out] value    Buffer for the value.
+ * @param[in] len       Size of @p value.
+ *
+ * @return  length of the value on success
+ * @return  -ENOENT, if @p key is not in the store
+ * @return  -ENOBUFS, if @p value is too small
+ * @return  <0 on MTD errors
+ */
+int mtd_kvs_get(mtd_kvs_t *kvs, const char *key, void *value, size_t len);
+
+/**
+ * @brief   Sets the value of a key
+ *
+ * Nothing is written if @p key already has this value.
+ *
+ * @param[in,out] kvs   Store to write to.
+ * @param[in] key       Key to set, at most @ref CONFIG_MTD_KVS_KEY_LEN_MAX
+ *                      characters.
+ * @param[in] value     Value of @p key.
+ * @param[in] len       Length of @p value.
+ *
+ * @return  0 on success
+ * @return  -EINVAL, if @p key is empty or too long
+ * @return  -EOVERFLOW, if the entry does not fit into a sector
+ * @return  -ENOSPC, if the store is full
+ * @return  <0 on MTD errors
+ */
+int mtd_kvs_set(mtd_kvs_t *kvs, const char *key, const void *value, size_t len);
+
+/**
+ * @brief   Deletes a key
+ *
+ * @param[in,out] kvs   Store to write to.
+ * @param[in] key       Key to delete.
+ *
+ * @return  0 on success
+ * @return  -ENOENT, if @p key is not in the store
+ * @return  -ENOSPC, if the store is full
+ * @return  <0 on MTD errors
+ */
+int mtd_kvs_del(mtd_kvs_t *kvs, const char *key);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MTD_KVS_H */
+/** @} */
@@ -0,0 +1,212 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    sys_mtd_log     MTD record log
+ * @ingroup     sys
+ * @brief       Circular, append-only log of timestamped records on MTD
+ *
+ * A file system spends most of its writes on metadata when small records are
+ * appended to a file at a high rate. This module writes records back to back
+ * into the sectors of a @ref mtd_dev_t instead. Records are appended to the
+ * current sector until it is full, then the next sector is erased and the
+ * log continues there. When there is no sector left, the oldest sector is
+ * erased, so every sector is erased equally often.
+ *
+ * Every sector starts with a header holding its sequence number, every
+ * record has a header with its length, its timestamp and a CRC covering both,
+ * the record data and the sequence number of its sector. On
+ * @ref mtd_log_init() the sector with the highest sequence number is
+ * continued. A record torn by a power failure fails its CRC check, is
+ * dropped and the log continues in the next sector.
+ *
+ * For every sector, the sequence number and the timestamp of its first record
+ * are kept in RAM, in an array provided by the user. This allows to find
+ * records by their timestamp with @ref mtd_log_seek() by only reading the
+ * sector that contains them. The timestamps are not interpreted, but must not
+ * decrease from one record to the next.
+ *
+ * The log requires erased memory to read as `0xff` and a write size of at
+ * most @ref MTD_LOG_ALIGN bytes, so it is meant for NOR flash and internal
+ * flash, not for SD cards.
+ *
+ * ## Usage
+ *
+ * ```
+ * USEMODULE += mtd_log
+ * ```
+ *
+ * ```
+ * static mtd_log_sector_t index[16];
+ * static mtd_log_t log = {
+ *     .mtd = MTD_0,
+ *     .first_sector = 0,
+ *     .sectors = ARRAY_SIZE(index),
+ *     .index = index,
+ * };
+ *
+ * mtd_log_init(&log);
+ * mtd_log_append(&log, ztimer_now(ZTIMER_SEC), &sample, sizeof(sample));
+ * ```
+ *
+ * @{
+ *
+ * @file
+ * @brief       MTD record log interface definitions
+ */
+
+#ifndef MTD_LOG_H
+#define MTD_LOG_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "mtd.h"
+#include "mutex.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Alignment of records in the log
+ *
+ * The write size of the MTD device must be a divider of this.
+ */
+#define MTD_LOG_ALIGN       (8U)
+
+/**
+ * @brief   Size of the header of a record in the log
+ */
+#define MTD_LOG_RECORD_HDR  (8U)
+
+/**
+ * @brief   RAM index entry of a sector
+ */
+typedef struct {
+    uint32_t seq;           /**< sequence number of the sector, 0 if empty */
+    uint32_t first;         /**< timestamp of the first record */
+} mtd_log_sector_t;
+
+/**
+ * @brief   MTD record log
+ *
+ * The first four members must be set by the user before calling
+ * @ref mtd_log_init().
+ */
+typedef struct {
+    mtd_dev_t *mtd;             /**< MTD device holding the log */
+    uint32_t first_sector;      /**< first sector of the log on @ref mtd */
+    uint32_t sectors;           /**< number of sectors of the log, at least 2 */
+    mtd_log_sector_t *index;    /**< index of @ref sectors entries */
+    mutex_t lock;               /**< lock of the log */
+    uint32_t sector_size;       /**< size of a sector in bytes */
+    uint32_t head;              /**< sector the log is appended to */
+    uint32_t offset;            /**< offset of the next record in @ref head */
+} mtd_log_t;
+
+/**
+ * @brief   Read position in a log
+ */
+typedef struct {
+    uint32_t sector;        /**< sector of the next record */
+    uint32_t offset;        /**< offset of the next record in @ref sector */
+    uint32_t seq;           /**< sequence number of @ref sector */
+} mtd_log_cursor_t;
+
+/**
+ * @brief   Initializes a log and recovers its contents
+ *
+ * An MTD area without a valid log is erased and set up as an empty log.
+ *
+ * @param[in,out] log   Log to initialize.
+ *
+ * @return  0 on success
+ * @return  -ENOTSUP, if the MTD device is not suitable for the log
+ * @return  <0 on MTD errors
+ */
+int mtd_log_init(mtd_log_t *log);
+
+/**
+ * @brief   Appends a record to a log
+ *
+ * This erases the oldest sector if the current one is full.
+ *
+ * @param[in,out] log       Log to append to.
+ * @param[in] timestamp     Timestamp of the record, must not be smaller than
+ *                          the last one written.
+ * @param[in] data          Record data.
+ * @param[in] len           Length of @p data.
+ *
+ * @return  0 on success
+ * @return  -EOVERFLOW, if the record does not fit into a sector
+ * @return  <0 on MTD errors
+ */
+int mtd_log_append(mtd_log_t *log, uint32_t timestamp,
+                   const void *data, size_t len);
+
+/**
+ * @brief   Sets a cursor to the oldest record of a log
+ *
+ * @param[in] log       Log to read.
+ * @param[out] cur      Cursor to set.
+ */
+void mtd_log_rewind(mtd_log_t *log, mtd_log_cursor_t *cur);
+
+/**
+ * @brief   Sets a cursor to the first record not older than a timestamp
+ *
+ * @param[in] log       Log to read.
+ * @param[out] cur      Cursor to set.
+ * @param[in] timestamp Timestamp to look for.
+ *
+ * @return  0 on success
+ * @return  -ENOENT, if all records are older than @p timestamp. @p cur is
+ *          set to the end of the log.
+ * @return  <0 on MTD errors
+ */
+int mtd_log_seek(mtd_log_t *log, mtd_log_cursor_t *cur, uint32_t timestamp);
+
+/**
+ * @brief   Reads the record at a cursor and advances the cursor
+ *
+ * If the sector of the cursor was overwritten in the meantime, reading
+ * continues with the oldest record.
+ *
+ * @param[in] log           Log to read.
+ * @param[in,out] cur       Position to read from.
+ * @param[out] timestamp    Timestamp of the record, may be NULL.
+ * @param[out] buf          Buffer for the record data, NULL to skip the
+ *                          record.
+ * @param[in] len           Size of @p buf.
+ *
+ * @return  length of the record on success
+ * @return  -ENOENT, if there are no more records in the log
+ * @return  -ENOBUFS, if @p buf is too small for the record. The cursor is
+ *          not advanced.
+ * @return  <0 on MTD errors
+ */
+int mtd_log_read(mtd_log_t *log, mtd_log_cursor_t *cur, uint32_t *timestamp,
+                 void *buf, size_t len);
+
+/**
+ * @brief   Removes all records from a log
+ *
+ * @param[in,out] log   Log to clear.
+ *
+ * @return  0 on success
+ * @return  <0 on MTD errors
+ */
+int mtd_log_clear(mtd_log_t *log);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MTD_LOG_H */
+/** @} */
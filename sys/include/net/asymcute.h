@@ -143,6 +143,19 @@ extern "C" {
 #ifndef CONFIG_ASYMCUTE_N_RETRY
 #define CONFIG_ASYMCUTE_N_RETRY         (3U)
 #endif
+
+/**
+ * @brief   Maximum number of QoS 1 PUBLISH messages in flight per connection
+ *
+ * A PUBLISH message is in flight from being sent until its PUBACK is received
+ * or it times out. Further QoS 1 publish requests are queued and sent in
+ * order as soon as a PUBLISH message leaves the window, so bursts of messages
+ * are bounded by the link bandwidth and not by the round trip time, without
+ * overrunning the gateway.
+ */
+#ifndef CONFIG_ASYMCUTE_INFLIGHT_MAX
+#define CONFIG_ASYMCUTE_INFLIGHT_MAX    (8U)
+#endif
 /** @} */
 
 #ifndef ASYMCUTE_HANDLER_PRIO
@@ -271,6 +284,8 @@ struct asymcute_con {
     mutex_t lock;                       /**< synchronization lock */
     sock_udp_t sock;                    /**< socket used by a connections */
     asymcute_req_t *pending;            /**< list holding pending requests */
+    asymcute_req_t *queued;             /**< QoS 1 publish requests waiting
+                                         *   for the in-flight window */
     asymcute_sub_t *subscriptions;      /**< list holding active subscriptions */
     asymcute_evt_cb_t user_cb;          /**< event callback provided by user */
     event_callback_t keepalive_evt;     /**< keep alive event */
@@ -278,6 +293,7 @@ struct asymcute_con {
     uint16_t last_id;                   /**< last used message ID for this
                                          *   connection */
     uint8_t keepalive_retry_cnt;        /**< keep alive transmission counter */
+    uint8_t inflight;                   /**< QoS 1 PUBLISH messages in flight */
     uint8_t state;                      /**< connection state */
     uint8_t rxbuf[CONFIG_ASYMCUTE_BUFSIZE];    /**< connection specific receive buf */
     char cli_id[MQTTSN_CLI_ID_MAXLEN + 1];  /**< buffer to store client ID */
@@ -514,6 +530,11 @@ int asymcute_register(asymcute_con_t *con, asymcute_req_t *req,
 /**
  * @brief   Publish the given data to the given topic
  *
+ * Any number of requests can be published at the same time using different
+ * request contexts. If @ref CONFIG_ASYMCUTE_INFLIGHT_MAX QoS 1 PUBLISH
+ * messages are in flight already, the request is queued and sent once a
+ * PUBACK for a previous message is received or it timed out.
+ *
  * @param[in] con       connection to use
  * @param[in,out] req   request context used for PUBLISH procedure
  * @param[in] topic     publish data to this topic
@@ -521,7 +542,7 @@ int asymcute_register(asymcute_con_t *con, asymcute_req_t *req,
  * @param[in] data_len  size of @p data in bytes
  * @param[in] flags     additional flags (QoS level, DUP, and RETAIN)
  *
- * @return  ASYMCUTE_OK if PUBLISH message has been sent
+ * @return  ASYMCUTE_OK if PUBLISH message has been sent or queued
  * @return  ASYMCUTE_NOTSUP if unsupported flags have been set
  * @return  ASYMCUTE_OVERFLOW if data does not fit into transmit buffer
  * @return  ASYMCUTE_REGERR if given topic is not registered
@@ -27,12 +27,22 @@
  * If there is communication to many different hosts, the addition of a
  * least-recently used counter could likely improve the behavior.
  *
+ * With the `dns_cache_prefetch` module, the cache tracks when less than
+ * @ref CONFIG_DNS_CACHE_PREFETCH_PERCENT of the lifetime of an entry is left,
+ * see dns_cache_refresh_due(). @ref net_sock_dns uses this to refresh names
+ * that are still in use in the background, so lookups keep hitting the cache.
+ *
+ * With the `dns_cache_vfs` module, the cache can be saved to a file with
+ * dns_cache_save() and loaded again with dns_cache_load(), e.g. across a
+ * reboot.
+ *
  * @author  Benjamin Valentin <benjamin.valentin@ml-pa.com>
  */
 
 #ifndef NET_DNS_CACHE_H
 #define NET_DNS_CACHE_H
 
+#include <stdbool.h>
 #include <stdint.h>
 
 #include "kernel_defines.h"
@@ -62,6 +72,15 @@ extern "C" {
 #define CONFIG_DNS_CACHE_AAAA   IS_USED(MODULE_IPV6)
 #endif
 
+/**
+ * @brief   Percentage of the lifetime of an entry left when a refresh is due
+ *
+ * Only used with the `dns_cache_prefetch` module.
+ */
+#ifndef CONFIG_DNS_CACHE_PREFETCH_PERCENT
+#define CONFIG_DNS_CACHE_PREFETCH_PERCENT   10
+#endif
+
 #if IS_USED(MODULE_DNS_CACHE) || DOXYGEN
 /**
  * @brief Get IP address for a DNS name from the DNS cache
@@ -84,6 +103,53 @@ int dns_cache_query(const char *domain_name, void *addr_out, int family);
  * @param[in]   ttl             lifetime of the entry in seconds
  */
 void dns_cache_add(const char *domain_name, const void *addr, int addr_len, uint32_t ttl);
+
+#if IS_USED(MODULE_DNS_CACHE_PREFETCH) || DOXYGEN
+/**
+ * @brief Check if the cached entry for a DNS name should be refreshed
+ *
+ * This is the case once less than @ref CONFIG_DNS_CACHE_PREFETCH_PERCENT of
+ * its lifetime is left. It is reported only once per entry, so the caller is
+ * expected to resolve the name again and to add the result with
+ * dns_cache_add(). If it doesn't, the entry expires as usual.
+ *
+ * @param[in]   domain_name     DNS name of the entry
+ * @param[in]   family          Either AF_INET, AF_INET6 or AF_UNSPEC
+ *
+ * @return      true if a refresh of the entry is due
+ * @return      false if not or if there is no entry for @p domain_name
+ */
+bool dns_cache_refresh_due(const char *domain_name, int family);
+#endif
+
+#if IS_USED(MODULE_DNS_CACHE_VFS) || DOXYGEN
+/**
+ * @brief Save all valid entries of the DNS cache to a file
+ *
+ * The remaining lifetime of each entry is stored.
+ *
+ * @param[in]   path            path of the file to write
+ *
+ * @return      0 on success
+ * @return      negative errno on error
+ */
+int dns_cache_save(const char *path);
+
+/**
+ * @brief Add the entries saved with dns_cache_save() to the DNS cache
+ *
+ * The lifetime of each entry continues with what was left when it was saved.
+ * Time passed in between, e.g. while the device was off, is not known to the
+ * cache, so keep the saved file only as long as that is acceptable.
+ *
+ * @param[in]   path            path of the file to read
+ *
+ * @return      0 on success
+ * @return      -EINVAL if the file was not written by dns_cache_save()
+ * @return      negative errno on other errors
+ */
+int dns_cache_load(const char *path);
+#endif
 #else
 static inline int dns_cache_query(const char *domain_name, void *addr_out, int family)
 {
@@ -101,6 +167,13 @@ static inline void dns_cache_add(const char *domain_name, const void *addr,
     (void)addr_len;
     (void)ttl;
 }
+
+static inline bool dns_cache_refresh_due(const char *domain_name, int family)
+{
+    (void)domain_name;
+    (void)family;
+    return false;
+}
 #endif
 
 #ifdef __cplusplus
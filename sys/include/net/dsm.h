@@ -16,6 +16,10 @@
  * has to provide the potentially maximum number of possible session objects.
  * Session storage can be offloaded to this generic module.
  *
+ * Sessions are kept in a pool of CONFIG_DSM_PEER_MAX slots, indexed by a hash of
+ * their endpoint and ordered by their last use. Looking up a session and
+ * finding the least recently used one do not depend on the number of sessions.
+ *
  * @{\
  *
  * @file
@@ -30,6 +34,7 @@
 #ifndef NET_DSM_H
 #define NET_DSM_H
 
+#include <stdbool.h>
 #include <stdint.h>
 
 #include "dtls.h"
@@ -46,6 +51,16 @@ extern "C" {
 #define CONFIG_DSM_PEER_MAX   (CONFIG_DTLS_PEER_MAX)
 #endif
 
+/**
+ * @brief   Number of hash buckets the sessions are indexed by
+ *
+ * Lookups compare the endpoint of CONFIG_DSM_PEER_MAX / CONFIG_DSM_BUCKETS_NUMOF
+ * sessions on average.
+ */
+#ifndef CONFIG_DSM_BUCKETS_NUMOF
+#define CONFIG_DSM_BUCKETS_NUMOF    (CONFIG_DSM_PEER_MAX)
+#endif
+
 /**
  * @brief Session management states
  */
@@ -117,6 +132,24 @@ uint8_t dsm_get_num_available_slots(void);
  */
 ssize_t dsm_get_least_recently_used_session(sock_dtls_t *sock, sock_dtls_session_t *session);
 
+/**
+ * @brief   Returns the least recently used session if it is idle
+ *
+ * Sessions are used when they are stored with @ref dsm_store.
+ *
+ * @param[in]   sock        @ref sock_dtls_t, which the session is created on
+ * @param[out]  session     Least recently used session
+ * @param[in]   idle_sec    Time in seconds without use after which a
+ *                          session is idle
+ * @param[out]  next_sec    Time in seconds until the least recently used
+ *                          session becomes idle, not written if no session
+ *                          is stored. May be NULL.
+ * @return   1, if the least recently used session is idle
+ * @return   -1, when no session is idle
+ */
+ssize_t dsm_get_idle_session(sock_dtls_t *sock, sock_dtls_session_t *session,
+                             uint32_t idle_sec, uint32_t *next_sec);
+
 #ifdef __cplusplus
 }
 #endif
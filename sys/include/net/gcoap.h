@@ -365,6 +365,49 @@
  * times out. We track the response with an entry in the
  * `_coap_state.open_reqs` array.
  *
+ * ### Indexed lookups ###
+ *
+ * By default, the open requests and the observe registrations are stored in
+ * arrays sized by @ref CONFIG_GCOAP_REQ_WAITING_MAX and
+ * @ref CONFIG_GCOAP_OBS_REGISTRATIONS_MAX, which are scanned for every
+ * response, request and notification. For larger tables the `gcoap_index`
+ * module adds hash indexes, finding the request for a response by its token
+ * and the observe registration of a resource in constant time on average.
+ *
+ * ### Worker threads ###
+ *
+ * By default the gcoap thread runs the request handlers itself, so a slow
+ * handler delays all other messages. With the `gcoap_workers` module, requests
+ * received via UDP are handed over to a pool of
+ * @ref CONFIG_GCOAP_WORKERS_NUMOF worker threads with their own PDU buffers.
+ * The gcoap thread keeps receiving and handles responses and empty messages
+ * itself, as well as requests arriving while all workers are busy and requests
+ * received via DTLS.
+ *
+ * As independent requests are handled concurrently, request handlers must not
+ * share state between invocations without locking.
+ *
+ * ### Congestion control ###
+ *
+ * By default, confirmable requests are retransmitted with the fixed
+ * exponential backoff of RFC 7252, starting from
+ * @ref CONFIG_COAP_ACK_TIMEOUT_MS. With the `gcoap_congure` module, gcoap
+ * keeps the state of up to @ref CONFIG_GCOAP_CONGURE_PEERS_NUMOF peers
+ * instead:
+ *
+ * - the retransmission timeout is estimated from the round-trip times to
+ *   the peer as proposed by
+ *   [CoCoA](https://datatracker.ietf.org/doc/draft-ietf-core-cocoa/), with
+ *   its variable backoff factor and aging of the timeout
+ * - the number of confirmable requests in flight to a peer is limited by a
+ *   congestion window of @ref sys_congure, starting at @ref COAP_NSTART.
+ *   Requests exceeding the window are not sent, gcoap_req_send() returns 0.
+ *   The algorithm is selected with a `gcoap_congure_%` module,
+ *   `gcoap_congure_reno` by default
+ *
+ * Requests to further peers while the state of all peers is in use are sent
+ * with the default timeouts.
+ *
  * ## Implementation Status ##
  * gcoap includes server and client capability. Available features include:
  *
@@ -455,6 +498,14 @@ extern "C" {
 #define CONFIG_GCOAP_DTLS_MINIMUM_AVAILABLE_SESSIONS_TIMEOUT_MSEC  (15 * MS_PER_SEC)
 #endif
 
+/**
+ * @brief   Time in seconds after which a session without traffic is closed.
+ *          Set to 0 to keep idle sessions open.
+ */
+#ifndef CONFIG_GCOAP_DTLS_IDLE_TIMEOUT_SEC
+#define CONFIG_GCOAP_DTLS_IDLE_TIMEOUT_SEC  (0)
+#endif
+
 /**
  * @brief   Size of the buffer used to build a CoAP request or response
  */
@@ -651,6 +702,42 @@ extern "C" {
 #define CONFIG_GCOAP_RESEND_BUFS_MAX      (1)
 #endif
 
+/**
+ * @ingroup net_gcoap_conf
+ * @brief   Number of peers whose congestion state is kept with `gcoap_congure`
+ */
+#ifndef CONFIG_GCOAP_CONGURE_PEERS_NUMOF
+#define CONFIG_GCOAP_CONGURE_PEERS_NUMOF  (4)
+#endif
+
+/**
+ * @ingroup net_gcoap_conf
+ * @brief   Number of worker threads handling requests with `gcoap_workers`
+ *
+ * Each worker has its own stack of @ref GCOAP_WORKER_STACK_SIZE and its own
+ * PDU buffer of @ref CONFIG_GCOAP_PDU_BUF_SIZE.
+ */
+#ifndef CONFIG_GCOAP_WORKERS_NUMOF
+#define CONFIG_GCOAP_WORKERS_NUMOF        (2)
+#endif
+
+/**
+ * @brief   Stack size for a worker thread of `gcoap_workers`
+ */
+#ifndef GCOAP_WORKER_STACK_SIZE
+#define GCOAP_WORKER_STACK_SIZE           (GCOAP_STACK_SIZE)
+#endif
+
+/**
+ * @brief   Priority of the worker threads of `gcoap_workers`
+ *
+ * Should be lower than the priority of the gcoap thread, so that the gcoap
+ * thread keeps receiving messages while a worker runs a request handler.
+ */
+#ifndef GCOAP_WORKER_PRIO
+#define GCOAP_WORKER_PRIO                 (THREAD_PRIORITY_MAIN)
+#endif
+
 /**
  * @name Bitwise positional flags for encoding resource links
  * @anchor COAP_LINK_FLAG_
@@ -783,6 +870,11 @@ struct gcoap_listener {
  */
 typedef struct gcoap_request_memo gcoap_request_memo_t;
 
+/**
+ * @brief   Forward declaration of the congestion state of a peer
+ */
+typedef struct gcoap_congure_peer gcoap_congure_peer_t;
+
 /**
  * @brief   Handler function for a server response, including the state for the
  *          originating request
@@ -828,6 +920,16 @@ struct gcoap_request_memo {
      */
     uint8_t cache_key[CONFIG_NANOCOAP_CACHE_KEY_LENGTH];
 #endif
+#if IS_USED(MODULE_GCOAP_CONGURE) || DOXYGEN
+    /**
+     * @brief   Congestion state of the remote endpoint, NULL if not accounted
+     *
+     * @note    Only available with module `gcoap_congure`
+     */
+    gcoap_congure_peer_t *congure_peer;
+    uint32_t send_time;                 /**< First transmission in ms */
+    uint32_t rto;                       /**< Current retransmission timeout in ms */
+#endif
 };
 
 /**
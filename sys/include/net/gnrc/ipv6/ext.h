@@ -69,8 +69,10 @@ extern "C" {
 /**
  * @brief   The number of total allocatable @ref gnrc_ipv6_ext_frag_limits_t objects
  *
- * This is the maximum number of receivable fragments, shared between all
- * fragmented datagrams
+ * Adjacent fragments of a datagram share one object, so this is the maximum
+ * number of disjoint ranges of received fragments, shared between all
+ * fragmented datagrams. Fragments received in order only take one object per
+ * datagram.
  *
  * @note    Only applicable with [gnrc_ipv6_ext_frag](@ref net_gnrc_ipv6_ext_frag) module
  */
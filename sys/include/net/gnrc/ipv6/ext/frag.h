@@ -53,14 +53,16 @@ extern "C" {
 #define GNRC_IPV6_EXT_FRAG_SEND         (0xfe02U)
 
 /**
- * @brief   Data type to describe limits of a single fragment in the reassembly
- *          buffer
+ * @brief   Data type to describe limits of a contiguous range of received
+ *          fragments in the reassembly buffer
+ *
+ * Units are 8 octets, as for the fragment offset.
  */
 typedef struct gnrc_ipv6_ext_frag_limits {
-    struct gnrc_ipv6_ext_frag_limits *next; /**< limits of next fragment */
-    uint16_t start;                         /**< the start (= offset) of the fragment */
+    struct gnrc_ipv6_ext_frag_limits *next; /**< limits of next range */
+    uint16_t start;                         /**< the start (= offset) of the range */
     uint16_t end;                           /**< the exclusive end (= offset + length) of the
-                                             *   fragment */
+                                             *   range */
 } gnrc_ipv6_ext_frag_limits_t;
 
 /**
@@ -84,6 +86,9 @@ typedef struct {
     /**
      * @brief   The limits of the fragments in the reassembled packet
      *
+     * Sorted by gnrc_ipv6_ext_frag_limits_t::start, adjacent fragments are
+     * merged into one entry.
+     *
      * @note    Members of this list can be cast to gnrc_ipv6_ext_frag_limits_t.
      */
     clist_node_t limits;
@@ -91,6 +96,7 @@ typedef struct {
     uint32_t arrival;       /**< arrival time of last received fragment */
     uint16_t pkt_len;       /**< length of gnrc_ipv6_ext_frag_rbuf_t::pkt */
     uint8_t last;           /**< received last fragment */
+    uint16_t frags;         /**< number of received fragments */
 } gnrc_ipv6_ext_frag_rbuf_t;
 
 /**
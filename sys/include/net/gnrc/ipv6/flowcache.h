@@ -0,0 +1,129 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    net_gnrc_ipv6_flowcache IPv6 receive flow cache
+ * @ingroup     net_gnrc_ipv6
+ * @brief       Remembers the receive decisions for established UDP flows
+ *
+ * For every received packet, @ref net_gnrc_ipv6 checks the source against
+ * @ref net_gnrc_ipv6_whitelist and @ref net_gnrc_ipv6_blacklist, looks up the
+ * interface owning the destination address and the registrations for the
+ * next header. With the module `gnrc_ipv6_flowcache`, the result of these
+ * lookups is kept for up to @ref CONFIG_GNRC_IPV6_FLOWCACHE_NUMOF UDP flows,
+ * identified by receiving interface, source and destination address and
+ * ports. Further packets of a flow skip the lookups. Checks of the packet
+ * itself, e.g. length, hop limit and checksum, are done for every packet.
+ *
+ * Only unicast packets without extension headers are cached. All entries are
+ * invalidated at once by @ref gnrc_ipv6_flowcache_flush(), which is called
+ * whenever a registration in @ref net_gnrc_netreg, an IPv6 address of an
+ * interface, the whitelist or the blacklist changes.
+ *
+ * @{
+ *
+ * @file
+ * @brief   IPv6 receive flow cache definitions
+ */
+#ifndef NET_GNRC_IPV6_FLOWCACHE_H
+#define NET_GNRC_IPV6_FLOWCACHE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "net/gnrc/netif.h"
+#include "net/ipv6/hdr.h"
+#include "net/udp.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup    net_gnrc_ipv6_flowcache_conf GNRC IPv6 flow cache compile configurations
+ * @ingroup     net_gnrc_ipv6_flowcache
+ * @ingroup     net_gnrc_conf
+ * @{
+ */
+/**
+ * @brief   Number of flows in the cache
+ */
+#ifndef CONFIG_GNRC_IPV6_FLOWCACHE_NUMOF
+#define CONFIG_GNRC_IPV6_FLOWCACHE_NUMOF   (4)
+#endif
+/** @} */
+
+/**
+ * @brief   Cached receive decisions of a flow
+ */
+typedef struct {
+    ipv6_addr_t src;                /**< source address */
+    ipv6_addr_t dst;                /**< destination address */
+    const gnrc_netif_t *rx_netif;   /**< receiving interface, may be NULL */
+    gnrc_netif_t *netif;            /**< interface owning the destination */
+    network_uint16_t src_port;      /**< UDP source port */
+    network_uint16_t dst_port;      /**< UDP destination port */
+    unsigned version;               /**< cache version the entry is valid for */
+    uint16_t last_used;             /**< time of the last use, in lookups */
+    bool nh_subs;                   /**< there are subscribers to the next
+                                     *   header at @ref GNRC_NETTYPE_IPV6 */
+} gnrc_ipv6_flowcache_entry_t;
+
+/**
+ * @brief   Get the current version of the cache
+ *
+ * Read before looking up the decisions to add for a flow, so that the entry
+ * is not valid if the cache was flushed in the meantime.
+ *
+ * @return  version to pass to gnrc_ipv6_flowcache_add()
+ */
+unsigned gnrc_ipv6_flowcache_version(void);
+
+/**
+ * @brief   Look up the cached decisions for a received packet
+ *
+ * @param[in] rx_netif  receiving interface, may be NULL
+ * @param[in] hdr       IPv6 header of the packet
+ * @param[in] udp       UDP header of the packet
+ *
+ * @return  the valid entry of the flow
+ * @return  NULL, if the flow is not cached
+ */
+const gnrc_ipv6_flowcache_entry_t *gnrc_ipv6_flowcache_get(const gnrc_netif_t *rx_netif,
+                                                           const ipv6_hdr_t *hdr,
+                                                           const udp_hdr_t *udp);
+
+/**
+ * @brief   Add the decisions for a flow to the cache
+ *
+ * Replaces an invalid or the least recently used entry.
+ *
+ * @param[in] version   cache version read before the lookups
+ * @param[in] rx_netif  receiving interface, may be NULL
+ * @param[in] hdr       IPv6 header of the packet
+ * @param[in] udp       UDP header of the packet
+ * @param[in] netif     interface owning the destination address
+ * @param[in] nh_subs   whether there are subscribers to the next header
+ */
+void gnrc_ipv6_flowcache_add(unsigned version, const gnrc_netif_t *rx_netif,
+                             const ipv6_hdr_t *hdr, const udp_hdr_t *udp,
+                             gnrc_netif_t *netif, bool nh_subs);
+
+/**
+ * @brief   Invalidate all entries
+ *
+ * May be called from any thread.
+ */
+void gnrc_ipv6_flowcache_flush(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NET_GNRC_IPV6_FLOWCACHE_H */
+/** @} */
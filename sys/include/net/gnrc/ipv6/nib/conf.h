@@ -245,6 +245,55 @@ extern "C" {
 #define CONFIG_GNRC_IPV6_NIB_REACH_TIME_RESET        (7200000U)
 #endif
 
+/**
+ * @brief   (de-)activate the address hash index over on-link entries
+ *
+ * When set, on-link entries (neighbor cache, default router next hops, ...)
+ * are additionally kept in a hash table keyed by their IPv6 address, so
+ * looking up a neighbor by address does not need to scan all
+ * @ref CONFIG_GNRC_IPV6_NIB_NUMOF entries. This costs one pointer of RAM per
+ * entry and per bucket.
+ */
+#ifndef CONFIG_GNRC_IPV6_NIB_NC_HASH
+#define CONFIG_GNRC_IPV6_NIB_NC_HASH                  0
+#endif
+
+/**
+ * @brief   Number of buckets of the on-link entry hash index as exponent of 2
+ *
+ * @note    Only applicable with @ref CONFIG_GNRC_IPV6_NIB_NC_HASH
+ */
+#ifndef CONFIG_GNRC_IPV6_NIB_NC_HASH_BUCKETS_EXP
+#define CONFIG_GNRC_IPV6_NIB_NC_HASH_BUCKETS_EXP      4U
+#endif
+
+/**
+ * @brief   (de-)activate the prefix trie index over the forwarding table
+ *
+ * When set, off-link entries are additionally kept in a path-compressed
+ * binary (Patricia) trie keyed by their prefix, so the longest-prefix match
+ * on route lookup is bounded by the prefix length instead of by
+ * @ref CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF. This costs two trie nodes of RAM per
+ * off-link entry and is mainly useful for border routers with a large
+ * forwarding table.
+ */
+#ifndef CONFIG_GNRC_IPV6_NIB_FT_TRIE
+#define CONFIG_GNRC_IPV6_NIB_FT_TRIE                  0
+#endif
+
+/**
+ * @brief   Number of next hop lookups kept as snapshot
+ *
+ * When not 0, the results of next hop lookups that did not change the NIB
+ * are kept, and repeated lookups of the same destination are answered from
+ * them without acquiring the NIB. Any change of the NIB invalidates all
+ * snapshots. This is mainly useful if several threads forward packets, so
+ * they don't contend for the NIB.
+ */
+#ifndef CONFIG_GNRC_IPV6_NIB_SNAPSHOT_NUMOF
+#define CONFIG_GNRC_IPV6_NIB_SNAPSHOT_NUMOF           0
+#endif
+
 /**
  * @brief   Disable router solicitations
  *
@@ -232,6 +232,18 @@ void gnrc_lorawan_mcps_request(gnrc_lorawan_t *mac,
                                const mcps_request_t *mcps_request,
                                mcps_confirm_t *mcps_confirm);
 
+/**
+ * @brief Get the maximum size of an MCPS request payload
+ *
+ * This takes the MAC commands pending for the next uplink into account.
+ *
+ * @param[in] mac pointer to the MAC descriptor
+ * @param[in] dr datarate of the request
+ *
+ * @return maximum size of the payload (in bytes)
+ */
+size_t gnrc_lorawan_mcps_payload_max(gnrc_lorawan_t *mac, uint8_t dr);
+
 /**
  * @brief Fetch a LoRaWAN packet from the radio.
  *
@@ -313,6 +313,22 @@ extern "C" {
 #ifndef CONFIG_GNRC_LWMAC_BROADCAST_CSMA_RETRIES
 #define CONFIG_GNRC_LWMAC_BROADCAST_CSMA_RETRIES    (3U)
 #endif
+
+/**
+ * @brief Maximum number of additional wake-ups per cycle, as exponent of two.
+ *
+ * With @ref net_gnrc_lwmac_adaptive, a receiver splits its cycle into up to
+ * 2^CONFIG_GNRC_LWMAC_ADAPTIVE_MAX_EXP evenly spread wake-ups when it
+ * received more than one packet per wake-up in the last cycle. It merges them
+ * again when it received less than one packet per two wake-ups. The first
+ * wake-up of a cycle stays at the phase the senders locked to.
+ *
+ * @ref CONFIG_GNRC_LWMAC_WAKEUP_INTERVAL_US divided by 2 to the power of this
+ * value must be well above @ref GNRC_LWMAC_WAKEUP_DURATION_US.
+ */
+#ifndef CONFIG_GNRC_LWMAC_ADAPTIVE_MAX_EXP
+#define CONFIG_GNRC_LWMAC_ADAPTIVE_MAX_EXP          (2U)
+#endif
 /** @} */
 
 /**
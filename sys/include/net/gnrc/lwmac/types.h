@@ -200,6 +200,13 @@ typedef struct lwmac {
     uint32_t last_wakeup;                                       /**< Used to calculate wakeup times */
     uint8_t lwmac_info;                                         /**< LWMAC's internal information (flags) */
     gnrc_lwmac_timeout_t timeouts[CONFIG_GNRC_LWMAC_TIMEOUT_COUNT];    /**< Store timeouts used for protocol */
+#if defined(MODULE_GNRC_LWMAC_ADAPTIVE) || defined(DOXYGEN)
+    uint32_t wakeup;                                            /**< Time of the current wake-up, last_wakeup
+                                                                     is the first one of the cycle */
+    uint8_t wakeup_exp;                                         /**< 2^wakeup_exp wake-ups per cycle */
+    uint8_t wakeup_slot;                                        /**< Index of the next wake-up in its cycle */
+    uint8_t rx_count;                                           /**< Packets received in the current cycle */
+#endif
 
 #if (GNRC_MAC_ENABLE_DUTYCYCLE_RECORD == 1)
     /* Parameters for recording duty-cycle */
@@ -130,6 +130,9 @@ typedef struct {
     uint32_t cp_phase;      /**< Neighbor's wake-up phase. */
     uint8_t mac_type;       /**< Neighbor's phase-track indicator. */
 #endif
+#ifdef MODULE_GNRC_LWMAC_ADAPTIVE
+    uint8_t wakeup_exp;     /**< Neighbor wakes up 2^wakeup_exp times per cycle. */
+#endif
 } gnrc_mac_tx_neighbor_t;
 
 /**
@@ -54,6 +54,25 @@
  * USEMODULE += gnrc_netapi_callbacks
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
  * @}
+ *
+ * @defgroup    net_gnrc_netapi_steering   Flow steering extension
+ * @ingroup     net_gnrc_netapi
+ * @brief       Spread received packets over several worker threads by flow
+ * @{
+ * @details The submodule `gnrc_netapi_steering` allows multiple entries of
+ *          the same type and demux context to act as a group of workers:
+ *          entries marked with gnrc_netreg_entry_set_steered() only get the
+ *          received packets of the flows (IPv6 addresses, next header and
+ *          UDP/TCP ports) hashed to them, instead of every packet. This keeps
+ *          the packets of one flow in order on one worker.
+ *
+ * To use, add the module `gnrc_netapi_steering` to the `USEMODULE` macro in
+ * your application's Makefile:
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ {.mk}
+ * USEMODULE += gnrc_netapi_steering
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * @}
  */
 
 #ifndef NET_GNRC_NETAPI_H
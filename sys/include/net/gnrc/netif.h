@@ -19,6 +19,20 @@
  * If you only have one network interface on the board, you can select the
  * `gnrc_netif_single` pseudo-module to enable further optimisations.
  *
+ * ## Receive offload
+ *
+ * With the `gnrc_netif_rx_offload` pseudo-module (@ref net_gnrc_netif_rx_offload)
+ * an interface's thread only receives packets from the device and queues them.
+ * Dispatching them to the upper layer is done by an event handler from the
+ * interface's gnrc_netif_t::rx_evq, which defaults to @ref EVENT_PRIO_MEDIUM
+ * and can be changed per interface with gnrc_netif_set_rx_queue().
+ * @ref net_gnrc_ipv6 then processes the packets directly in the context of
+ * the dispatching thread instead of in its own thread, so e.g. the interfaces
+ * of a border router can be handled at different priorities.
+ *
+ * @note    The stack sizes of the @ref sys_event_thread "event threads"
+ *          need to be large enough for IPv6 processing.
+ *
  * @{
  *
  * @file
@@ -33,6 +47,7 @@
 #include <stdint.h>
 #include <stdbool.h>
 
+#include "cib.h"
 #include "sched.h"
 #include "msg.h"
 #ifdef MODULE_GNRC_NETIF_BUS
@@ -216,6 +231,34 @@ typedef struct {
      * @note    Only available with @ref net_gnrc_netif_pktq.
      */
     gnrc_netif_pktq_t send_queue;
+#endif
+#if IS_USED(MODULE_GNRC_NETIF_RX_OFFLOAD) || defined(DOXYGEN)
+    /**
+     * @brief   Event queue received packets are dispatched from
+     *
+     * @note    Only available with @ref net_gnrc_netif_rx_offload.
+     *
+     * @see     gnrc_netif_set_rx_queue()
+     */
+    event_queue_t *rx_evq;
+    /**
+     * @brief   Event dispatching gnrc_netif_t::rx_queue
+     *
+     * @note    Only available with @ref net_gnrc_netif_rx_offload.
+     */
+    event_t event_rx;
+    /**
+     * @brief   Circular buffer for gnrc_netif_t::rx_queue
+     *
+     * @note    Only available with @ref net_gnrc_netif_rx_offload.
+     */
+    cib_t rx_cib;
+    /**
+     * @brief   Received packets waiting for dispatch
+     *
+     * @note    Only available with @ref net_gnrc_netif_rx_offload.
+     */
+    gnrc_pktsnip_t *rx_queue[GNRC_NETIF_RX_OFFLOAD_QUEUE_SIZE];
 #endif
     /**
      * @brief   Message queue for the netif thread
@@ -432,7 +475,9 @@ unsigned gnrc_netif_numof(void);
  * > There can only be one!
  *
  * This function is used to allow compile time optimizations for
- * single interface applications
+ * single interface applications. With module `gnrc_netif_single`,
+ * @ref gnrc_netif_iter() and @ref gnrc_netif_get_by_pid() are inlined and
+ * loops over all interfaces are folded to a single pass by the compiler.
  *
  * @return true, if there can only only one interface
  * @return false, if there can be more than one interface
@@ -442,6 +487,15 @@ static inline bool gnrc_netif_highlander(void)
     return IS_USED(MODULE_GNRC_NETIF_SINGLE);
 }
 
+#if IS_USED(MODULE_GNRC_NETIF_SINGLE) || defined(DOXYGEN)
+/**
+ * @brief   The only network interface, NULL before it is created
+ *
+ * @internal    Only used with module `gnrc_netif_single`
+ */
+extern gnrc_netif_t *gnrc_netif_single;
+#endif
+
 /**
  * @brief   Iterate over all network interfaces.
  *
@@ -450,7 +504,15 @@ static inline bool gnrc_netif_highlander(void)
  * @return  The next network interface after @p prev.
  * @return  NULL, if @p prev was the last network interface.
  */
+#if IS_USED(MODULE_GNRC_NETIF_SINGLE)
+static inline gnrc_netif_t *gnrc_netif_iter(const gnrc_netif_t *prev)
+{
+    /* NULL after the first call, whether the interface exists or not */
+    return (prev) ? NULL : gnrc_netif_single;
+}
+#else
 gnrc_netif_t *gnrc_netif_iter(const gnrc_netif_t *prev);
+#endif
 
 /**
  * @brief   Get network interface by PID
@@ -460,7 +522,16 @@ gnrc_netif_t *gnrc_netif_iter(const gnrc_netif_t *prev);
  * @return  The network interface on success.
  * @return  NULL, if no network interface with PID exists.
  */
+#if IS_USED(MODULE_GNRC_NETIF_SINGLE)
+static inline gnrc_netif_t *gnrc_netif_get_by_pid(kernel_pid_t pid)
+{
+    gnrc_netif_t *netif = gnrc_netif_single;
+
+    return (netif && (netif->pid == pid)) ? netif : NULL;
+}
+#else
 gnrc_netif_t *gnrc_netif_get_by_pid(kernel_pid_t pid);
+#endif
 
 /**
  * @brief   Gets the (unicast on anycast) IPv6 address of an interface (if IPv6
@@ -735,6 +806,24 @@ static inline int gnrc_netif_send(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt)
     return gnrc_netapi_send(netif->pid, pkt);
 }
 
+#if IS_USED(MODULE_GNRC_NETIF_RX_OFFLOAD) || defined(DOXYGEN)
+/**
+ * @brief   Selects the event queue received packets of an interface are
+ *          dispatched from
+ *
+ * @note    Only available with @ref net_gnrc_netif_rx_offload.
+ *
+ * @param netif         pointer to the interface
+ * @param evq           event queue to dispatch received packets from, e.g.
+ *                      @ref EVENT_PRIO_HIGHEST
+ */
+static inline void gnrc_netif_set_rx_queue(gnrc_netif_t *netif,
+                                           event_queue_t *evq)
+{
+    netif->rx_evq = evq;
+}
+#endif
+
 #if defined(MODULE_GNRC_NETIF_BUS) || DOXYGEN
 /**
  * @brief   Get a message bus of a given @ref gnrc_netif_t interface.
@@ -66,6 +66,16 @@ extern "C" {
 #define CONFIG_GNRC_NETIF_PKTQ_POOL_SIZE      (16U)
 #endif
 
+/**
+ * @brief       Number of received packets that can wait for dispatch per
+ *              interface (as exponent of 2^n)
+ *
+ * @see         net_gnrc_netif_rx_offload
+ */
+#ifndef CONFIG_GNRC_NETIF_RX_OFFLOAD_QUEUE_SIZE_EXP
+#define CONFIG_GNRC_NETIF_RX_OFFLOAD_QUEUE_SIZE_EXP (2U)
+#endif
+
 /**
  * @brief       Time in microseconds for when to try send a queued packet at the
  *              latest
@@ -79,6 +89,47 @@ extern "C" {
 #define CONFIG_GNRC_NETIF_PKTQ_TIMER_US       (5000U)
 #endif
 
+/**
+ * @brief       Number of flow sub-queues per network interface
+ *
+ * @see         net_gnrc_netif_pktq_fq
+ */
+#ifndef CONFIG_GNRC_NETIF_PKTQ_FQ_FLOWS
+#define CONFIG_GNRC_NETIF_PKTQ_FQ_FLOWS       (4U)
+#endif
+
+/**
+ * @brief       Bytes a flow may send per round robin round
+ *
+ * @see         net_gnrc_netif_pktq_fq
+ */
+#ifndef CONFIG_GNRC_NETIF_PKTQ_FQ_QUANTUM
+#define CONFIG_GNRC_NETIF_PKTQ_FQ_QUANTUM     (128U)
+#endif
+
+/**
+ * @brief       Acceptable queueing delay of a flow in milliseconds
+ *
+ * The defaults of CoDel (5 ms target, 100 ms interval) are tailored to fast
+ * links, a single IEEE 802.15.4 frame already takes about 4 ms on air.
+ *
+ * @see         net_gnrc_netif_pktq_fq
+ */
+#ifndef CONFIG_GNRC_NETIF_PKTQ_CODEL_TARGET_MS
+#define CONFIG_GNRC_NETIF_PKTQ_CODEL_TARGET_MS    (20U)
+#endif
+
+/**
+ * @brief       Time in milliseconds the queueing delay of a flow may stay
+ *              above @ref CONFIG_GNRC_NETIF_PKTQ_CODEL_TARGET_MS before
+ *              packets are dropped
+ *
+ * @see         net_gnrc_netif_pktq_fq
+ */
+#ifndef CONFIG_GNRC_NETIF_PKTQ_CODEL_INTERVAL_MS
+#define CONFIG_GNRC_NETIF_PKTQ_CODEL_INTERVAL_MS  (200U)
+#endif
+
 /**
  * @brief   Number of multicast addresses needed for @ref net_gnrc_rpl "RPL".
  *
@@ -182,6 +233,15 @@ extern "C" {
 #define GNRC_NETIF_MSG_QUEUE_SIZE   (1 << CONFIG_GNRC_NETIF_MSG_QUEUE_SIZE_EXP)
 #endif
 
+/**
+ * @brief   Number of received packets that can wait for dispatch per interface
+ *
+ * @see     net_gnrc_netif_rx_offload
+ */
+#ifndef GNRC_NETIF_RX_OFFLOAD_QUEUE_SIZE
+#define GNRC_NETIF_RX_OFFLOAD_QUEUE_SIZE (1 << CONFIG_GNRC_NETIF_RX_OFFLOAD_QUEUE_SIZE_EXP)
+#endif
+
 /**
  * @brief   Enable the usage of non standard MTU for 6LoWPAN network interfaces
  *
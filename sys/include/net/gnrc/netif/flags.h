@@ -141,6 +141,22 @@ enum {
  */
 #define GNRC_NETIF_FLAGS_6LO                       (0x00002000U)
 
+/**
+ * @brief   The device calculates the upper layer checksums of IPv6 packets it
+ *          transmits
+ *
+ * Set from @ref NETOPT_TX_CSUM_OFFLOAD on initialization.
+ */
+#define GNRC_NETIF_FLAGS_TX_CSUM_OFFLOAD           (0x00004000U)
+
+/**
+ * @brief   The device verifies the upper layer checksums of IPv6 packets it
+ *          receives
+ *
+ * Set from @ref NETOPT_RX_CSUM_OFFLOAD on initialization.
+ */
+#define GNRC_NETIF_FLAGS_RX_CSUM_OFFLOAD           (0x00008000U)
+
 /**
  * @brief   Network interface is configured in raw mode
  */
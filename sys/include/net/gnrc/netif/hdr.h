@@ -22,6 +22,7 @@
 #define NET_GNRC_NETIF_HDR_H
 
 #include <errno.h>
+#include <stdbool.h>
 #include <string.h>
 #include <stdint.h>
 
@@ -112,6 +113,17 @@ extern "C" {
  *          can be used to check for presence of a valid timestamp.
  */
 #define GNRC_NETIF_HDR_FLAGS_TIMESTAMP  (0x08)
+
+/**
+ * @brief   The network device verified the upper layer checksum
+ *
+ * @details Set for packets received on interfaces with
+ *          @ref GNRC_NETIF_FLAGS_RX_CSUM_OFFLOAD. Packets reassembled on the
+ *          network layer must not have this flag set.
+ *
+ * @see     gnrc_netif_hdr_csum_valid()
+ */
+#define GNRC_NETIF_HDR_FLAGS_CSUM_VALID (0x04)
 /**
  * @}
  */
@@ -398,6 +410,25 @@ static inline void gnrc_netif_hdr_set_netif(gnrc_netif_hdr_t *hdr,
     hdr->if_pid = (netif != NULL) ? netif->pid : KERNEL_PID_UNDEF;
 }
 
+/**
+ * @brief   Checks if the network device already verified the upper layer
+ *          checksum of a received packet
+ *
+ * @param[in] pkt   A received packet.
+ *
+ * @return  true, if the interface header of @p pkt has
+ *          @ref GNRC_NETIF_HDR_FLAGS_CSUM_VALID set
+ * @return  false, if the checksum needs to be verified
+ */
+static inline bool gnrc_netif_hdr_csum_valid(gnrc_pktsnip_t *pkt)
+{
+    gnrc_pktsnip_t *netif = gnrc_pktsnip_search_type(pkt, GNRC_NETTYPE_NETIF);
+
+    return (netif != NULL) &&
+           (((gnrc_netif_hdr_t *)netif->data)->flags &
+            GNRC_NETIF_HDR_FLAGS_CSUM_VALID);
+}
+
 /**
  * @brief   Outputs a generic interface header to stdout.
  *
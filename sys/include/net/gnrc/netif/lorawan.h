@@ -46,6 +46,32 @@ extern "C" {
 #define CONFIG_GNRC_NETIF_LORAWAN_NETIF_HDR
 #endif
 
+/**
+ * @brief   Number of uplinks queued while the MAC layer is busy
+ *
+ * Packets sent to the interface while a transmission, its reception windows
+ * or a join procedure are in progress are queued and sent once the MAC layer
+ * is idle again, so senders never block. Packets are dropped with
+ * `-ENOBUFS` if the queue is full.
+ */
+#ifndef CONFIG_GNRC_NETIF_LORAWAN_TX_QUEUE_LEN
+#define CONFIG_GNRC_NETIF_LORAWAN_TX_QUEUE_LEN          (4U)
+#endif
+
+/**
+ * @brief   Aggregate queued uplinks to the same port into a single frame
+ *
+ * When set, queued packets to the same port are concatenated into one uplink
+ * as long as they fit into the maximum payload of the current datarate. This
+ * saves the header, MIC and airtime of every further frame and the reception
+ * windows that follow it, but the payloads are sent back to back without any
+ * delimiter. Only enable this if the application server can split the
+ * payload again, e.g. with fixed size or self-delimiting records.
+ */
+#if defined(DOXYGEN)
+#define CONFIG_GNRC_NETIF_LORAWAN_AGGREGATE
+#endif
+
 /**
  * @brief   GNRC LoRaWAN interface descriptor
  */
@@ -72,6 +98,10 @@ typedef struct {
     uint8_t port;                                   /**< LoRaWAN port for the next transmission */
     uint8_t ack_req;                                /**< Request ACK in the next transmission */
     uint8_t otaa;                                   /**< whether the next transmission is OTAA or not */
+    uint8_t txq_first;                              /**< index of the oldest queued uplink */
+    uint8_t txq_len;                                /**< number of queued uplinks */
+    uint8_t txq_port[CONFIG_GNRC_NETIF_LORAWAN_TX_QUEUE_LEN];       /**< ports of the queued uplinks */
+    gnrc_pktsnip_t *txq[CONFIG_GNRC_NETIF_LORAWAN_TX_QUEUE_LEN];    /**< queued uplinks */
 } gnrc_netif_lorawan_t;
 
 /**
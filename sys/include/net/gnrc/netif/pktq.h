@@ -40,6 +40,9 @@ extern "C" {
  * @param[in] netif A network interface. May not be NULL.
  * @param[in] pkt   A packet. May not be NULL.
  *
+ * With @ref net_gnrc_netif_pktq_fq, the head of the longest flow of @p netif
+ * is dropped when the pool is depleted.
+ *
  * @return  0 on success
  * @return  -1 when the pool of available gnrc_pktqueue_t entries (of size
  *          @ref CONFIG_GNRC_NETIF_PKTQ_POOL_SIZE) is depleted
@@ -53,6 +56,20 @@ int gnrc_netif_pktq_put(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt);
  */
 unsigned gnrc_netif_pktq_usage(void);
 
+#if IS_USED(MODULE_GNRC_NETIF_PKTQ_FQ) || defined(DOXYGEN)
+/**
+ * @brief   Gets a packet with @ref net_gnrc_netif_pktq_fq
+ *
+ * @internal    Use @ref gnrc_netif_pktq_get() instead.
+ *
+ * @param[in] netif A network interface. May not be NULL.
+ *
+ * @return  A packet on success
+ * @return  NULL when the queue is empty
+ */
+gnrc_pktsnip_t *gnrc_netif_pktq_fq_get(gnrc_netif_t *netif);
+#endif
+
 /**
  * @brief   Gets a packet from the packet send queue of a network interface
  *
@@ -65,7 +82,11 @@ unsigned gnrc_netif_pktq_usage(void);
  */
 static inline gnrc_pktsnip_t *gnrc_netif_pktq_get(gnrc_netif_t *netif)
 {
-#if IS_USED(MODULE_GNRC_NETIF_PKTQ)
+#if IS_USED(MODULE_GNRC_NETIF_PKTQ_FQ)
+    assert(netif != NULL);
+
+    return gnrc_netif_pktq_fq_get(netif);
+#elif IS_USED(MODULE_GNRC_NETIF_PKTQ)
     assert(netif != NULL);
 
     gnrc_pktsnip_t *pkt = NULL;
@@ -103,6 +124,8 @@ void gnrc_netif_pktq_sched_get(gnrc_netif_t *netif);
  * @brief   Pushes a packet back to the head of the packet send queue of a
  *          network interface
  *
+ * With @ref net_gnrc_netif_pktq_fq the packet is sent before any flow.
+ *
  * @pre `netif != NULL`
  * @pre `pkt != NULL`
  *
@@ -130,6 +153,11 @@ static inline bool gnrc_netif_pktq_empty(gnrc_netif_t *netif)
 #if IS_USED(MODULE_GNRC_NETIF_PKTQ)
     assert(netif != NULL);
 
+#if IS_USED(MODULE_GNRC_NETIF_PKTQ_FQ)
+    if (netif->send_queue.backlog) {
+        return false;
+    }
+#endif
     return (netif->send_queue.queue == NULL);
 #else   /* IS_USED(MODULE_GNRC_NETIF_PKTQ) */
     (void)netif;
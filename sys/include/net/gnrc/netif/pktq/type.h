@@ -23,6 +23,10 @@
 #ifndef NET_GNRC_NETIF_PKTQ_TYPE_H
 #define NET_GNRC_NETIF_PKTQ_TYPE_H
 
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "net/gnrc/netif/conf.h"
 #include "net/gnrc/pktqueue.h"
 #include "xtimer.h"
 
@@ -30,11 +34,46 @@
 extern "C" {
 #endif
 
+#if IS_USED(MODULE_GNRC_NETIF_PKTQ_FQ) || defined(DOXYGEN)
+/**
+ * @brief   A flow sub-queue of @ref net_gnrc_netif_pktq_fq
+ */
+typedef struct {
+    gnrc_pktqueue_t *queue;     /**< queued packets of the flow */
+    uint32_t first_above;       /**< time in ms the sojourn time may be above
+                                 *   target until dropping starts, 0 if it is
+                                 *   below target */
+    uint32_t drop_next;         /**< time in ms of the next drop */
+    uint16_t count;             /**< packets dropped since dropping started */
+    uint16_t last_count;        /**< gnrc_netif_pktq_flow_t::count when
+                                 *   dropping started last */
+    uint16_t len;               /**< number of queued packets */
+    int16_t deficit;            /**< bytes left to send in this round */
+    bool dropping;              /**< in dropping state */
+} gnrc_netif_pktq_flow_t;
+#endif
+
 /**
  * @brief   A packet queue for @ref net_gnrc_netif with a de-queue timer
  */
 typedef struct {
-    gnrc_pktqueue_t *queue;     /**< the actual packet queue class */
+    /**
+     * @brief   the actual packet queue class
+     *
+     * With @ref net_gnrc_netif_pktq_fq, this holds the control packets and
+     * packets pushed back, which are sent before the flows.
+     */
+    gnrc_pktqueue_t *queue;
+#if IS_USED(MODULE_GNRC_NETIF_PKTQ_FQ) || defined(DOXYGEN)
+    /**
+     * @brief   flow sub-queues
+     *
+     * @note    Only available with @ref net_gnrc_netif_pktq_fq.
+     */
+    gnrc_netif_pktq_flow_t flows[CONFIG_GNRC_NETIF_PKTQ_FQ_FLOWS];
+    uint16_t backlog;           /**< packets queued in the flows */
+    uint8_t flow;               /**< flow served by the round robin */
+#endif
 #if CONFIG_GNRC_NETIF_PKTQ_TIMER_US >= 0
     msg_t dequeue_msg;          /**< message for gnrc_netif_pktq_t::dequeue_timer to send */
     xtimer_t dequeue_timer;     /**< timer to schedule next sending of
@@ -22,6 +22,7 @@
 #define NET_GNRC_NETREG_H
 
 #include <inttypes.h>
+#include <stdbool.h>
 
 #include "sched.h"
 #include "net/gnrc/nettype.h"
@@ -35,6 +36,17 @@
 extern "C" {
 #endif
 
+/**
+ * @brief   Number of hash buckets per @ref gnrc_nettype_t (as exponent of 2^n)
+ *
+ * With the `gnrc_netreg_hash` pseudomodule, registry entries are distributed
+ * over this many lists per type by their demultiplexing context, keeping
+ * lookups fast with many registrations (e.g. one per UDP socket).
+ */
+#ifndef CONFIG_GNRC_NETREG_HASH_BUCKETS_EXP
+#define CONFIG_GNRC_NETREG_HASH_BUCKETS_EXP (3U)
+#endif
+
 #if defined(MODULE_GNRC_NETAPI_MBOX) || defined(MODULE_GNRC_NETAPI_CALLBACKS) || \
     defined(DOXYGEN)
 /**
@@ -210,6 +222,17 @@ typedef struct gnrc_netreg_entry {
         gnrc_netreg_entry_cbd_t *cbd;
 #endif
     } target;                   /**< Target for the registry entry */
+#if IS_USED(MODULE_GNRC_NETAPI_STEERING) || defined(DOXYGEN)
+    /**
+     * @brief   Entry is one of several workers for its demux context
+     *
+     * Received packets are only handed to one of these entries, selected by
+     * the flow of the packet. See gnrc_netreg_entry_set_steered().
+     *
+     * @note    Only available with module `gnrc_netapi_steering`.
+     */
+    bool steered;
+#endif
 } gnrc_netreg_entry_t;
 
 /**
@@ -279,6 +302,9 @@ static inline void gnrc_netreg_entry_init_pid(gnrc_netreg_entry_t *entry,
     entry->type = GNRC_NETREG_TYPE_DEFAULT;
 #endif
     entry->target.pid = pid;
+#if IS_USED(MODULE_GNRC_NETAPI_STEERING)
+    entry->steered = false;
+#endif
 }
 
 #if defined(MODULE_GNRC_NETAPI_MBOX) || defined(DOXYGEN)
@@ -300,6 +326,9 @@ static inline void gnrc_netreg_entry_init_mbox(gnrc_netreg_entry_t *entry,
     entry->demux_ctx = demux_ctx;
     entry->type = GNRC_NETREG_TYPE_MBOX;
     entry->target.mbox = mbox;
+#if IS_USED(MODULE_GNRC_NETAPI_STEERING)
+    entry->steered = false;
+#endif
 }
 #endif
 
@@ -322,6 +351,34 @@ static inline void gnrc_netreg_entry_init_cb(gnrc_netreg_entry_t *entry,
     entry->demux_ctx = demux_ctx;
     entry->type = GNRC_NETREG_TYPE_CB;
     entry->target.cbd = cbd;
+#if IS_USED(MODULE_GNRC_NETAPI_STEERING)
+    entry->steered = false;
+#endif
+}
+#endif
+
+#if IS_USED(MODULE_GNRC_NETAPI_STEERING) || defined(DOXYGEN)
+/**
+ * @brief   Marks a netreg entry as a flow steering worker
+ *
+ * Of all steered entries registered for the same type and demux context,
+ * gnrc_netapi_dispatch_receive() hands a received packet to only one,
+ * selected by a hash over the packets flow (addresses, next header and ports).
+ * Packets of the same flow thus always reach the same worker in order, as
+ * long as the set of workers does not change. Entries that are not steered
+ * still receive every packet.
+ *
+ * @pre gnrc_netreg_entry_t::next of @p entry is initialized (i.e. one of the
+ *      gnrc_netreg_entry_init_*() functions was called) and @p entry is not
+ *      registered yet.
+ *
+ * @note    Only available with module `gnrc_netapi_steering`.
+ *
+ * @param[in,out] entry A netreg entry
+ */
+static inline void gnrc_netreg_entry_set_steered(gnrc_netreg_entry_t *entry)
+{
+    entry->steered = true;
 }
 #endif
 /** @} */
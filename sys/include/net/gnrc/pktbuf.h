@@ -63,6 +63,18 @@ extern "C" {
 #ifndef CONFIG_GNRC_PKTBUF_SIZE
 #define CONFIG_GNRC_PKTBUF_SIZE    (6144)
 #endif
+
+/**
+ * @brief   Maximum number of external buffers that can be lent to the packet
+ *          buffer at the same time (module `gnrc_pktbuf_ext`).
+ *
+ * With module `gnrc_pktbuf_cow` this also limits how many snips of the packet
+ * buffer can share their data at the same time, see
+ * @ref gnrc_pktbuf_start_write_desc().
+ */
+#ifndef CONFIG_GNRC_PKTBUF_EXT_NUMOF
+#define CONFIG_GNRC_PKTBUF_EXT_NUMOF    (4U)
+#endif
 /** @} */
 
 /**
@@ -94,6 +106,53 @@ void gnrc_pktbuf_init(void);
 gnrc_pktsnip_t *gnrc_pktbuf_add(gnrc_pktsnip_t *next, const void *data, size_t size,
                                 gnrc_nettype_t type);
 
+#if IS_USED(MODULE_GNRC_PKTBUF_EXT) || defined(DOXYGEN)
+/**
+ * @brief   Callback to give an external buffer back to its owner
+ *
+ * @param[in] arg   argument given to @ref gnrc_pktbuf_add_ext()
+ * @param[in] data  start of the buffer given to @ref gnrc_pktbuf_add_ext()
+ */
+typedef void (*gnrc_pktbuf_ext_release_t)(void *arg, void *data);
+
+/**
+ * @brief   Adds a new gnrc_pktsnip_t referencing external memory (e.g. a
+ *          DMA buffer of a network device) instead of copying it into the
+ *          packet buffer.
+ *
+ * The buffer is reference counted across all snips pointing into it (e.g.
+ * after @ref gnrc_pktbuf_mark()). Once the last of them is released,
+ * @p release is called, with the packet buffer locked. It thus must not
+ * call into the packet buffer itself.
+ *
+ * Snips referencing external memory are read-only: @ref
+ * gnrc_pktbuf_start_write() copies them into the packet buffer when they have
+ * multiple users. Growing them by @ref gnrc_pktbuf_realloc_data() moves the
+ * data into the packet buffer.
+ *
+ * @note    Only available with module `gnrc_pktbuf_ext`, which requires
+ *          `gnrc_pktbuf_static`.
+ *
+ * @param[in] next      Next gnrc_pktsnip_t in the packet. Leave NULL if you
+ *                      want to create a new packet.
+ * @param[in] data      External data the new snip references. Must not be
+ *                      NULL.
+ * @param[in] size      Length of @p data.
+ * @param[in] type      Protocol type of the gnrc_pktsnip_t.
+ * @param[in] release   Callback to give @p data back to its owner.
+ * @param[in] arg       Argument for @p release.
+ *
+ * @return  The new gnrc_pktsnip_t.
+ * @return  NULL, if no space is left in the packet buffer or
+ *          @ref CONFIG_GNRC_PKTBUF_EXT_NUMOF buffers are lent already. The
+ *          caller still owns @p data in that case.
+ */
+gnrc_pktsnip_t *gnrc_pktbuf_add_ext(gnrc_pktsnip_t *next, void *data,
+                                    size_t size, gnrc_nettype_t type,
+                                    gnrc_pktbuf_ext_release_t release,
+                                    void *arg);
+#endif
+
 /**
  * @brief   Marks the first @p size bytes in a received packet with a new
  *          packet snip that is appended to the packet.
@@ -187,15 +246,49 @@ static inline void gnrc_pktbuf_release(gnrc_pktsnip_t *pkt)
  *
  * @details This function duplicates a packet snip in the packet buffer (both
  *          the instance of the gnrc_pktsnip_t and its data) if
- *          gnrc_pktsnip_t::users of @p pkt > 1.
+ *          gnrc_pktsnip_t::users of @p pkt > 1. If only the data is shared
+ *          (see @ref gnrc_pktbuf_start_write_desc()), the data is copied and
+ *          @p pkt itself is returned.
  *
  * @param[in] pkt   The packet snip you want to write into.
  *
  * @return  The (new) pointer to the packet snip.
+ * @return  NULL, if @p pkt or its data is shared and if there is not enough
+ *          space in the packet buffer.
+ */
+gnrc_pktsnip_t *gnrc_pktbuf_start_write(gnrc_pktsnip_t *pkt);
+
+/**
+ * @brief   Must be called once before the gnrc_pktsnip_t of a
+ *          [packet snip](@ref gnrc_pktsnip_t) is changed in a thread, but
+ *          not its data.
+ *
+ * @details With module `gnrc_pktbuf_cow` this only duplicates the instance
+ *          of the gnrc_pktsnip_t if gnrc_pktsnip_t::users of @p pkt > 1. The
+ *          new snip shares the data with @p pkt. It may be marked with
+ *          @ref gnrc_pktbuf_mark(), shrunk with
+ *          @ref gnrc_pktbuf_realloc_data() or linked differently, but its
+ *          data must not be written to without calling
+ *          @ref gnrc_pktbuf_start_write() before, which then copies the data.
+ *
+ *          Without module `gnrc_pktbuf_cow`, or if no more data can be shared
+ *          (see @ref CONFIG_GNRC_PKTBUF_EXT_NUMOF), this is the same as
+ *          @ref gnrc_pktbuf_start_write().
+ *
+ * @param[in] pkt   The packet snip you want to change.
+ *
+ * @return  The (new) pointer to the packet snip.
  * @return  NULL, if gnrc_pktsnip_t::users of @p pkt > 1 and if there is not
  *          enough space in the packet buffer.
  */
-gnrc_pktsnip_t *gnrc_pktbuf_start_write(gnrc_pktsnip_t *pkt);
+#if IS_USED(MODULE_GNRC_PKTBUF_COW) || defined(DOXYGEN)
+gnrc_pktsnip_t *gnrc_pktbuf_start_write_desc(gnrc_pktsnip_t *pkt);
+#else
+static inline gnrc_pktsnip_t *gnrc_pktbuf_start_write_desc(gnrc_pktsnip_t *pkt)
+{
+    return gnrc_pktbuf_start_write(pkt);
+}
+#endif
 
 /**
  * @brief   Deletes a snip from a packet and the packet buffer.
@@ -285,11 +378,32 @@ int gnrc_pktbuf_merge(gnrc_pktsnip_t *pkt);
  *
  * @note    Only available with DEVELHELP defined.
  *
- * @details Statistics include maximum number of reserved bytes.
+ * @details Statistics include maximum number of reserved bytes, the number
+ *          of bytes currently in use and their high-water mark.
  */
 void gnrc_pktbuf_stats(void);
 #endif
 
+#if (IS_USED(MODULE_GNRC_PKTBUF_STATIC) && defined(DEVELHELP)) || defined(DOXYGEN)
+/**
+ * @brief   Returns the maximum number of bytes that were in use at the same
+ *          time
+ *
+ * @note    Only available with DEVELHELP defined and `gnrc_pktbuf_static`.
+ *
+ * @return  high-water mark of the bytes in use since startup or the last call
+ *          of @ref gnrc_pktbuf_reset_high_water_mark()
+ */
+size_t gnrc_pktbuf_get_high_water_mark(void);
+
+/**
+ * @brief   Resets the high-water mark to the number of bytes currently in use
+ *
+ * @note    Only available with DEVELHELP defined and `gnrc_pktbuf_static`.
+ */
+void gnrc_pktbuf_reset_high_water_mark(void);
+#endif
+
 /* for testing */
 #ifdef TEST_SUITES
 /**
@@ -148,6 +148,17 @@ bool gnrc_rpl_parent_remove(gnrc_rpl_parent_t *parent);
  */
 void gnrc_rpl_parent_update(gnrc_rpl_dodag_t *dodag, gnrc_rpl_parent_t *parent);
 
+/**
+ * @brief   Mark a @p parent of the @p dodag as active and restart its lifetime.
+ *
+ * Unlike gnrc_rpl_parent_update(), the preferred parent is not re-evaluated,
+ * so this is only sufficient if nothing else about the parent changed.
+ *
+ * @param[in] dodag     Pointer to the DODAG
+ * @param[in] parent    Pointer to the parent
+ */
+void gnrc_rpl_parent_refresh(gnrc_rpl_dodag_t *dodag, gnrc_rpl_parent_t *parent);
+
 /**
  * @brief Removes the dodag state of @p dodag after
  * CONFIG_GNRC_RPL_CLEANUP_TIME milliseconds
@@ -0,0 +1,143 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    net_gnrc_rpl_srh_routes RPL source route store
+ * @ingroup     net_gnrc_rpl_srh
+ * @brief       Routes of a RPL root in non-storing mode
+ *
+ * In non-storing mode, the DAO of every node in the DODAG reaches the root
+ * with the address of the DAO parent of the node in its transit option. Just
+ * like the routing tables of LLN border routers, the root rather stores these
+ * parents than routes to every node in the NIB, so the number of nodes it can
+ * handle isn't bound by @ref CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF.
+ *
+ * All nodes share the prefix of the first node added, so per node only its
+ * interface identifier, the index of its parent and its lifetime are stored.
+ * Nodes are found by a hash of their interface identifier. The source route
+ * to a node is the chain of its parents up to the root, see
+ * gnrc_rpl_srh_routes_path().
+ *
+ * @see <a href="https://tools.ietf.org/html/rfc6550#section-9.7">
+ *          RFC 6550, section 9.7
+ *      </a>
+ * @{
+ *
+ * @file
+ * @brief       Definitions for the RPL source route store
+ */
+#ifndef NET_GNRC_RPL_SRH_ROUTES_H
+#define NET_GNRC_RPL_SRH_ROUTES_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "net/ipv6/addr.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup net_gnrc_rpl_srh_routes_conf RPL source route store compile
+ *           configurations
+ * @ingroup  config
+ * @{
+ */
+/**
+ * @brief   Maximum number of nodes in the route store
+ *
+ * Parents a node reports before their own DAO was received take an entry as
+ * well.
+ */
+#ifndef CONFIG_GNRC_RPL_SRH_ROUTES_NUMOF
+#define CONFIG_GNRC_RPL_SRH_ROUTES_NUMOF        (64U)
+#endif
+
+/**
+ * @brief   Number of hash buckets to find nodes in the route store
+ *
+ * @note    Must be a power of two.
+ */
+#ifndef CONFIG_GNRC_RPL_SRH_ROUTES_BUCKETS
+#define CONFIG_GNRC_RPL_SRH_ROUTES_BUCKETS      (16U)
+#endif
+/** @} */
+
+/**
+ * @brief   Memory usage of the route store
+ */
+typedef struct {
+    unsigned numof;     /**< number of nodes in the store */
+    unsigned max;       /**< maximum number of nodes in the store */
+    size_t route_size;  /**< bytes used per node */
+    size_t total_size;  /**< bytes used by the store, including the lookup
+                         *   table */
+} gnrc_rpl_srh_routes_stats_t;
+
+/**
+ * @brief   Adds a node or updates its parent and lifetime
+ *
+ * @param[in] target    Address of the node.
+ * @param[in] parent    Address of the DAO parent of @p target. If it is an
+ *                      address of this node, @p target is a child of the
+ *                      root.
+ * @param[in] lifetime  Lifetime of the route in seconds. 0 removes the node.
+ *
+ * @return  0 on success
+ * @return  -ENOTSUP, if the prefix of @p target or @p parent differs from that
+ *          of the nodes in the store
+ * @return  -EINVAL, if @p parent is @p target or one of its children
+ * @return  -ENOMEM, if the store is full
+ */
+int gnrc_rpl_srh_routes_add(const ipv6_addr_t *target,
+                            const ipv6_addr_t *parent, uint32_t lifetime);
+
+/**
+ * @brief   Removes a node
+ *
+ * Children of the node keep their entries, but have no source route until
+ * they report a new parent.
+ *
+ * @param[in] target    Address of the node.
+ */
+void gnrc_rpl_srh_routes_del(const ipv6_addr_t *target);
+
+/**
+ * @brief   Gets the source route to a node
+ *
+ * @param[in] target    Address of the node.
+ * @param[out] hops     Addresses of the hops from the first hop after the root
+ *                      to @p target.
+ * @param[in] max_hops  Maximum number of addresses in @p hops.
+ *
+ * @return  number of addresses in @p hops (including @p target)
+ * @return  -ENOENT, if there is no valid route to @p target
+ * @return  -ENOSPC, if the route has more than @p max_hops hops
+ */
+int gnrc_rpl_srh_routes_path(const ipv6_addr_t *target, ipv6_addr_t *hops,
+                             unsigned max_hops);
+
+/**
+ * @brief   Removes all nodes
+ */
+void gnrc_rpl_srh_routes_clear(void);
+
+/**
+ * @brief   Gets the memory usage of the route store
+ *
+ * @param[out] stats    Memory usage.
+ */
+void gnrc_rpl_srh_routes_stats(gnrc_rpl_srh_routes_stats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NET_GNRC_RPL_SRH_ROUTES_H */
+/** @} */
@@ -53,6 +53,16 @@ extern "C" {
 #define CONFIG_GNRC_SIXLOWPAN_MSG_QUEUE_SIZE_EXP   (3U)
 #endif
 
+/**
+ * @brief   Number of flows the IPHC address compression is cached for
+ *
+ * @note    Only applicable with `gnrc_sixlowpan_iphc_cache` module
+ *          (see gnrc_sixlowpan_iphc_cache_flush())
+ */
+#ifndef CONFIG_GNRC_SIXLOWPAN_IPHC_CACHE_SIZE
+#define CONFIG_GNRC_SIXLOWPAN_IPHC_CACHE_SIZE      (4U)
+#endif
+
 /**
  * @brief   Number of datagrams that can be fragmented simultaneously
  *
@@ -208,8 +218,12 @@ extern "C" {
  * When the sender reacts to Explicit Congestion Notification (ECN) its window
  * size will vary between @ref CONFIG_GNRC_SIXLOWPAN_SFR_MIN_WIN_SIZE and @ref
  * CONFIG_GNRC_SIXLOWPAN_SFR_MAX_WIN_SIZE.
+ *
+ * @note    Only has an effect with @ref net_gnrc_sixlowpan_frag_sfr_congure
  */
+#ifndef CONFIG_GNRC_SIXLOWPAN_SFR_USE_ECN
 #define CONFIG_GNRC_SIXLOWPAN_SFR_USE_ECN           0U
+#endif
 
 /**
  * @brief   Default minimum value of window size that the sender can use
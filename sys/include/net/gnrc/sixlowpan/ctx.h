@@ -115,6 +115,18 @@ gnrc_sixlowpan_ctx_t *gnrc_sixlowpan_ctx_update(uint8_t id, const ipv6_addr_t *p
                                                 uint8_t prefix_len, uint16_t ltime,
                                                 bool comp);
 
+/**
+ * @brief   Gets the version of the context buffer
+ *
+ * The version changes with every call of gnrc_sixlowpan_ctx_update(), so
+ * users can check if compression decisions based on the context buffer are
+ * still up-to-date. Contexts removed with gnrc_sixlowpan_ctx_remove() or
+ * expiring contexts do not change the version.
+ *
+ * @return  The current version of the context buffer.
+ */
+uint16_t gnrc_sixlowpan_ctx_version(void);
+
 /**
  * @brief   Removes context.
  *
@@ -59,6 +59,37 @@ int gnrc_sixlowpan_frag_minfwd_forward(gnrc_pktsnip_t *pkt,
                                        gnrc_sixlowpan_frag_vrb_t *vrbe,
                                        unsigned page);
 
+/**
+ * @brief   Forwards a received fragment according to a VRB entry by rewriting
+ *          it in place
+ *
+ * In contrast to gnrc_sixlowpan_frag_minfwd_forward() no new fragmentation
+ * and network interface header are allocated: The datagram tag of the
+ * received fragmentation header is switched to gnrc_sixlowpan_frag_vrb_t::out_tag
+ * and the received network interface header is reused for the next hop.
+ *
+ * @param[in] pkt       The fragment to forward as received, i.e. starting
+ *                      with the fragmentation header and with the network
+ *                      interface header as its only successor. Is consumed by
+ *                      this function on success.
+ * @param[in] vrbe      Virtual reassembly buffer containing the forwarding
+ *                      information. Removed when datagram was completely
+ *                      forwarded.
+ * @param[in] page      Current 6Lo dispatch parsing page.
+ *
+ * @pre `vrbe != NULL`
+ * @pre `pkt != NULL`
+ *
+ * @return  0 on success.
+ * @return  -ENOTSUP, when @p pkt can not be rewritten in place, e.g. because
+ *          it is shared or its network interface header is too small for the
+ *          next hop's address. @p pkt is **not** released in that case and
+ *          should be forwarded with gnrc_sixlowpan_frag_minfwd_forward().
+ */
+int gnrc_sixlowpan_frag_minfwd_forward_in_place(gnrc_pktsnip_t *pkt,
+                                                gnrc_sixlowpan_frag_vrb_t *vrbe,
+                                                unsigned page);
+
 /**
  * @brief   Fragments a packet with just the IPHC (and padding payload to get
  *          to 8 byte) as the first fragment
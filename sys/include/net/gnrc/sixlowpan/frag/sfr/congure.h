@@ -0,0 +1,212 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    net_gnrc_sixlowpan_frag_sfr_congure Congestion control for 6LoWPAN SFR
+ * @ingroup     net_gnrc_sixlowpan_frag_sfr
+ * @brief       Window and inter-frame gap adaptation for 6LoWPAN selective
+ *              fragment recovery using @ref sys_congure
+ *
+ * Without this module, the sender uses the fixed
+ * @ref CONFIG_GNRC_SIXLOWPAN_SFR_OPT_WIN_SIZE and
+ * @ref CONFIG_GNRC_SIXLOWPAN_SFR_INTER_FRAME_GAP_US for every datagram.
+ * With the module `gnrc_sixlowpan_frag_sfr_congure` the window size is taken
+ * from the congestion window of a CongURE instance, which is fed with the
+ * RFRAG-ACKs, fragment losses, ACK timeouts and, if
+ * @ref CONFIG_GNRC_SIXLOWPAN_SFR_USE_ECN is set, with ECN echoes. Window sizes
+ * are counted in fragments and stay between
+ * @ref CONFIG_GNRC_SIXLOWPAN_SFR_MIN_WIN_SIZE and
+ * @ref CONFIG_GNRC_SIXLOWPAN_SFR_MAX_WIN_SIZE.
+ *
+ * The congestion state is kept per link-layer destination, so consecutive
+ * datagrams to the same next hop, e.g. the blocks of a CoAP block-wise
+ * transfer, continue with the window learned before.
+ *
+ * If the congestion control algorithm supports pacing, its inter-message
+ * interval is used as the inter-frame gap, but never less than
+ * @ref CONFIG_GNRC_SIXLOWPAN_SFR_INTER_FRAME_GAP_US. Pacing is only available
+ * if @ref CONFIG_GNRC_SIXLOWPAN_SFR_INTER_FRAME_GAP_US is greater than 0.
+ *
+ * The algorithm is selected with one of the following modules:
+ *
+ * - `gnrc_sixlowpan_frag_sfr_congure_reno`: @ref sys_congure_reno (default)
+ * - `gnrc_sixlowpan_frag_sfr_congure_quic`: @ref sys_congure_quic; also adapts
+ *   the inter-frame gap to the measured round-trip time
+ *
+ * @{
+ *
+ * @file
+ * @brief   Congestion control for 6LoWPAN SFR definitions
+ */
+#ifndef NET_GNRC_SIXLOWPAN_FRAG_SFR_CONGURE_H
+#define NET_GNRC_SIXLOWPAN_FRAG_SFR_CONGURE_H
+
+#include <stdint.h>
+
+#include "congure.h"
+#include "kernel_defines.h"
+#include "net/gnrc/sixlowpan/config.h"
+#include "net/gnrc/sixlowpan/frag/fb.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Number of link-layer destinations congestion state is kept for
+ */
+#ifndef CONFIG_GNRC_SIXLOWPAN_SFR_CONGURE_NUMOF
+#define CONFIG_GNRC_SIXLOWPAN_SFR_CONGURE_NUMOF (CONFIG_GNRC_SIXLOWPAN_FRAG_FB_SIZE)
+#endif
+
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_SFR_CONGURE) || defined(DOXYGEN)
+/**
+ * @brief   Get the state object of a CongURE instance
+ *
+ * @note    Provided by the selected congestion control implementation.
+ *
+ * @param[in] idx   Index of the instance,
+ *                  < @ref CONFIG_GNRC_SIXLOWPAN_SFR_CONGURE_NUMOF
+ *
+ * @return  The state object, with congure_snd_t::driver set.
+ */
+congure_snd_t *gnrc_sixlowpan_frag_sfr_congure_snd_get(unsigned idx);
+
+/**
+ * @brief   Assign congestion state to a fragmentation buffer entry and set
+ *          its window size accordingly
+ *
+ * @pre `fbuf->pkt` starts with the netif header of the datagram
+ *
+ * @param[in,out] fbuf  A fragmentation buffer entry about to send its first
+ *                      fragment
+ */
+void gnrc_sixlowpan_frag_sfr_congure_snd_init(gnrc_sixlowpan_frag_fb_t *fbuf);
+
+/**
+ * @brief   Get the gap to keep before sending the next frame
+ *
+ * @param[in] fbuf  A fragmentation buffer entry
+ *
+ * @return  The inter-frame gap in microseconds
+ */
+uint32_t gnrc_sixlowpan_frag_sfr_congure_snd_inter_frame_gap(
+    gnrc_sixlowpan_frag_fb_t *fbuf);
+
+/**
+ * @brief   Report that a fragment was sent or resent
+ *
+ * @param[in,out] fbuf  A fragmentation buffer entry
+ */
+void gnrc_sixlowpan_frag_sfr_congure_snd_report_frag_sent(
+    gnrc_sixlowpan_frag_fb_t *fbuf);
+
+/**
+ * @brief   Report fragments as acknowledged by an RFRAG-ACK
+ *
+ * @param[in,out] fbuf      A fragmentation buffer entry
+ * @param[in] frags         Number of acknowledged fragments
+ * @param[in] send_time     Time in milliseconds (@ref ZTIMER_MSEC) the
+ *                          latest of those fragments was sent
+ */
+void gnrc_sixlowpan_frag_sfr_congure_snd_report_frags_acked(
+    gnrc_sixlowpan_frag_fb_t *fbuf, unsigned frags, ztimer_now_t send_time);
+
+/**
+ * @brief   Report fragments as not received by an RFRAG-ACK
+ *
+ * @param[in,out] fbuf      A fragmentation buffer entry
+ * @param[in] frags         Number of lost fragments
+ * @param[in] send_time     Time in milliseconds (@ref ZTIMER_MSEC) the
+ *                          latest of those fragments was sent
+ * @param[in] resends       Lowest number of resends of those fragments
+ */
+void gnrc_sixlowpan_frag_sfr_congure_snd_report_frags_lost(
+    gnrc_sixlowpan_frag_fb_t *fbuf, unsigned frags, ztimer_now_t send_time,
+    uint8_t resends);
+
+/**
+ * @brief   Report that the RFRAG-ACK for a fragment timed out
+ *
+ * @param[in,out] fbuf      A fragmentation buffer entry
+ * @param[in] send_time     Time in milliseconds (@ref ZTIMER_MSEC) the
+ *                          fragment was sent
+ * @param[in] resends       Number of resends of the fragment so far
+ */
+void gnrc_sixlowpan_frag_sfr_congure_snd_report_frag_timeout(
+    gnrc_sixlowpan_frag_fb_t *fbuf, ztimer_now_t send_time, uint8_t resends);
+
+/**
+ * @brief   Report that an RFRAG-ACK echoed explicit congestion notification
+ *
+ * @param[in,out] fbuf      A fragmentation buffer entry
+ * @param[in] send_time     Time in milliseconds (@ref ZTIMER_MSEC) the
+ *                          fragment requesting the ACK was sent
+ */
+void gnrc_sixlowpan_frag_sfr_congure_snd_report_ecn(
+    gnrc_sixlowpan_frag_fb_t *fbuf, ztimer_now_t send_time);
+#else   /* IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_SFR_CONGURE) || defined(DOXYGEN) */
+static inline void gnrc_sixlowpan_frag_sfr_congure_snd_init(
+    gnrc_sixlowpan_frag_fb_t *fbuf)
+{
+    (void)fbuf;
+}
+
+static inline uint32_t gnrc_sixlowpan_frag_sfr_congure_snd_inter_frame_gap(
+    gnrc_sixlowpan_frag_fb_t *fbuf)
+{
+    (void)fbuf;
+    return CONFIG_GNRC_SIXLOWPAN_SFR_INTER_FRAME_GAP_US;
+}
+
+static inline void gnrc_sixlowpan_frag_sfr_congure_snd_report_frag_sent(
+    gnrc_sixlowpan_frag_fb_t *fbuf)
+{
+    (void)fbuf;
+}
+
+static inline void gnrc_sixlowpan_frag_sfr_congure_snd_report_frags_acked(
+    gnrc_sixlowpan_frag_fb_t *fbuf, unsigned frags, ztimer_now_t send_time)
+{
+    (void)fbuf;
+    (void)frags;
+    (void)send_time;
+}
+
+static inline void gnrc_sixlowpan_frag_sfr_congure_snd_report_frags_lost(
+    gnrc_sixlowpan_frag_fb_t *fbuf, unsigned frags, ztimer_now_t send_time,
+    uint8_t resends)
+{
+    (void)fbuf;
+    (void)frags;
+    (void)send_time;
+    (void)resends;
+}
+
+static inline void gnrc_sixlowpan_frag_sfr_congure_snd_report_frag_timeout(
+    gnrc_sixlowpan_frag_fb_t *fbuf, ztimer_now_t send_time, uint8_t resends)
+{
+    (void)fbuf;
+    (void)send_time;
+    (void)resends;
+}
+
+static inline void gnrc_sixlowpan_frag_sfr_congure_snd_report_ecn(
+    gnrc_sixlowpan_frag_fb_t *fbuf, ztimer_now_t send_time)
+{
+    (void)fbuf;
+    (void)send_time;
+}
+#endif  /* IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_SFR_CONGURE) || defined(DOXYGEN) */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NET_GNRC_SIXLOWPAN_FRAG_SFR_CONGURE_H */
+/** @} */
@@ -22,6 +22,9 @@
 
 #include "bitfield.h"
 #include "clist.h"
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_SFR_CONGURE
+#include "congure.h"
+#endif
 #include "evtimer_msg.h"
 #include "msg.h"
 #include "xtimer.h"
@@ -55,6 +58,14 @@ typedef struct gnrc_sixlowpan_frag_sfr_fb {
                                  *   fragments */
     uint8_t retrans;            /**< Datagram retransmissions */
     clist_node_t window;        /**< Sent fragments of the current window */
+#if defined(MODULE_GNRC_SIXLOWPAN_FRAG_SFR_CONGURE) || defined(DOXYGEN)
+    /**
+     * @brief   Congestion control state for the destination of the datagram
+     *
+     * @note    Only available with module `gnrc_sixlowpan_frag_sfr_congure`
+     */
+    congure_snd_t *congure;
+#endif
 } gnrc_sixlowpan_frag_sfr_fb_t;
 
 #ifdef __cplusplus
@@ -39,6 +39,14 @@ typedef struct {
 #if defined(MODULE_GNRC_SIXLOWPAN_FRAG_VRB) || DOXYGEN
     unsigned vrb_full;      /**< counts the number of events where the virtual
                              *   reassembly buffer is full */
+    unsigned vrb_hits;      /**< VRB look-ups for received fragments that found
+                             *   an entry */
+    unsigned vrb_misses;    /**< VRB look-ups for received fragments that found
+                             *   no entry */
+#endif
+#if defined(MODULE_GNRC_SIXLOWPAN_FRAG_MINFWD) || DOXYGEN
+    unsigned vrb_in_place;  /**< fragments forwarded by rewriting them in
+                             *   place */
 #endif
 } gnrc_sixlowpan_frag_stats_t;
 
@@ -22,6 +22,7 @@
 
 #include <stdbool.h>
 
+#include "kernel_defines.h"
 #include "net/gnrc/pkt.h"
 #include "net/sixlowpan.h"
 
@@ -63,6 +64,32 @@ void gnrc_sixlowpan_iphc_recv(gnrc_pktsnip_t *pkt, void *ctx, unsigned page);
  */
 void gnrc_sixlowpan_iphc_send(gnrc_pktsnip_t *pkt, void *ctx, unsigned page);
 
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_IPHC_CACHE) || defined(DOXYGEN)
+/**
+ * @brief   Invalidates all flows in the compression cache
+ *
+ * With module `gnrc_sixlowpan_iphc_cache`, the address compression of
+ * the most recent flows, identified by interface, IPv6 source and destination
+ * address, and link-layer destination address, is cached, so that
+ * for consecutive packets of the same flow the contexts and interface
+ * identifiers do not have to be looked up again. Changes of the context
+ * buffer are detected automatically (see gnrc_sixlowpan_ctx_version()), as
+ * are changes in the neighbor cache, as they result in a different
+ * link-layer destination address.
+ *
+ * This function needs to be called when the link-layer address of an
+ * interface, and thus its interface identifier, changes. @ref net_gnrc_netif
+ * does this automatically.
+ *
+ * @note    Only available with module `gnrc_sixlowpan_iphc_cache`.
+ */
+void gnrc_sixlowpan_iphc_cache_flush(void);
+#else
+static inline void gnrc_sixlowpan_iphc_cache_flush(void)
+{
+}
+#endif
+
 #ifdef __cplusplus
 }
 #endif
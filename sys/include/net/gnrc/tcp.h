@@ -268,6 +268,55 @@ ssize_t gnrc_tcp_send(gnrc_tcp_tcb_t *tcb, const void *data, const size_t len,
 ssize_t gnrc_tcp_recv(gnrc_tcp_tcb_t *tcb, void *data, const size_t max_len,
                       const uint32_t user_timeout_duration_ms);
 
+/**
+ * @brief Receive Data from the peer without copying it.
+ *
+ * Lends the next contiguous chunk of the receive buffer to the caller. Data lent
+ * by a previous call of this function is released first, the same happens on the
+ * next call of gnrc_tcp_recv() or gnrc_tcp_recv_buf_release(). Lent data stays in
+ * the receive buffer and therefore reduces the receive window until it is released.
+ *
+ * @pre gnrc_tcp_tcb_init() must have been successfully called.
+ * @pre @p tcb must not be NULL.
+ * @pre @p data must not be NULL.
+ *
+ * @note Function blocks if user_timeout_duration_us is not zero.
+ * @note @p data is only valid until the data is released or the connection is closed.
+ *
+ * @param[in,out] tcb                        TCB holding the connection information.
+ * @param[out]    data                       Pointer to the received data inside the
+ *                                           receive buffer.
+ * @param[in]     user_timeout_duration_ms   Timeout for receive in milliseconds.
+ *                                           If zero and no data is available, the function
+ *                                           returns immediately. If not zero the function
+ *                                           blocks until data is available or
+ *                                           @p user_timeout_duration_ms milliseconds passed.
+ *                                           If GNRC_TCP_NO_TIMEOUT, causing the function to
+ *                                           block until some data was available or an error
+ *                                           occurred.
+ *
+ * @return   The number of bytes available at @p data. Further data may follow
+ *           on the next call, e.g. if the receive buffer wrapped around.
+ * @return   0, if the connection is closing and no further data can be read.
+ * @return   -ENOTCONN if connection is not established.
+ * @return   -EAGAIN if  user_timeout_duration_us is zero and no data is available.
+ * @return   -ECONNRESET if connection was reset by the peer.
+ * @return   -ECONNABORTED if the connection was aborted.
+ * @return   -ETIMEDOUT if @p user_timeout_duration_ms expired.
+ */
+ssize_t gnrc_tcp_recv_buf(gnrc_tcp_tcb_t *tcb, void **data,
+                          const uint32_t user_timeout_duration_ms);
+
+/**
+ * @brief Release data lent by gnrc_tcp_recv_buf().
+ *
+ * @pre gnrc_tcp_tcb_init() must have been successfully called.
+ * @pre @p tcb must not be NULL.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ */
+void gnrc_tcp_recv_buf_release(gnrc_tcp_tcb_t *tcb);
+
 /**
  * @brief Close a TCP connection.
  *
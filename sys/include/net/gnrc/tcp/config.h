@@ -86,6 +86,9 @@ extern "C" {
 
 /**
  * @brief Default receive window size
+ *
+ * @note Windows larger than 65535 bytes can only be advertised if
+ *       @ref CONFIG_GNRC_TCP_WND_SCALE_EN is enabled.
  */
 #ifndef CONFIG_GNRC_TCP_DEFAULT_WINDOW
 #define CONFIG_GNRC_TCP_DEFAULT_WINDOW (CONFIG_GNRC_TCP_MSS * CONFIG_GNRC_TCP_MSS_MULTIPLICATOR)
@@ -108,6 +111,38 @@ extern "C" {
 #define GNRC_TCP_RCV_BUF_SIZE (CONFIG_GNRC_TCP_DEFAULT_WINDOW)
 #endif
 
+/**
+ * @brief Enable the window scale option (see RFC 7323). Disabled by default.
+ *
+ * @note If enabled, the window scale option is sent with every SYN. The shift
+ *       count is the smallest value for which @ref GNRC_TCP_RCV_BUF_SIZE fits
+ *       into the 16 bit window field. Window scaling is only used if the
+ *       peer sends the option as well.
+ */
+#ifndef CONFIG_GNRC_TCP_WND_SCALE_EN
+#define CONFIG_GNRC_TCP_WND_SCALE_EN 0
+#endif
+
+/**
+ * @brief Maximum number of unacknowledged segments per connection.
+ *
+ * @note Every unacknowledged segment is kept in the packet buffer until it
+ *       is acknowledged. With more than one segment, lost segments are
+ *       detected by duplicate ACKs (fast retransmit). Use the module
+ *       `gnrc_tcp_congure` to limit the segments in flight by a congestion
+ *       window.
+ */
+#ifndef CONFIG_GNRC_TCP_RETRANSMIT_QUEUE_SIZE
+#define CONFIG_GNRC_TCP_RETRANSMIT_QUEUE_SIZE (1U)
+#endif
+
+/**
+ * @brief Number of duplicate ACKs that trigger a fast retransmit.
+ */
+#ifndef CONFIG_GNRC_TCP_DUP_ACK_THRESH
+#define CONFIG_GNRC_TCP_DUP_ACK_THRESH (3U)
+#endif
+
 /**
  * @brief Lower bound for RTO in milliseconds. Default is 1 sec (see RFC 6298)
  *
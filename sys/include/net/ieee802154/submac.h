@@ -100,6 +100,20 @@
  * - @ref ieee802154_submac_ack_timer_cancel
  * - @ref ieee802154_submac_bh_request
  *
+ * Frame pipelining
+ * ================
+ *
+ * With the `ieee802154_submac_pipeline` module, @ref ieee802154_send accepts
+ * one additional frame while a transmission (including CSMA-CA, ACK wait and
+ * retransmissions) is still in progress. The frame is copied to a buffer of
+ * the SubMAC, so the caller may release it as soon as the function returns.
+ * As soon as the ongoing transmission ends, the SubMAC writes the pending
+ * frame into the radio and starts its transmission right away, before
+ * reporting @ref ieee802154_submac_cb_t::tx_done of the previous frame. This
+ * removes the round trip through the upper layer between two consecutive
+ * frames. The pending frame occupies `IEEE802154_FRAME_LEN_MAX` bytes of RAM
+ * in the SubMAC descriptor.
+ *
  * @{
  *
  * @author       José I. Alamos <jose.alamos@haw-hamburg.de>
@@ -147,7 +161,10 @@ typedef struct {
      * This function is called from the SubMAC to indicate that the TX
      * procedure finished.
      *
-     * The SubMAC will automatically go to IDLE.
+     * The SubMAC will automatically go to IDLE, unless a pipelined frame
+     * is pending (see `ieee802154_submac_pipeline`). In this case the
+     * transmission of the pending frame already started when this callback is
+     * called.
      *
      * @param[in] submac pointer to the SubMAC descriptor
      * @param[out] info TX information associated to the transmission (status,
@@ -206,6 +223,10 @@ struct ieee802154_submac {
     ieee802154_fsm_state_t fsm_state;    /**< State of the SubMAC */
     ieee802154_phy_mode_t phy_mode;     /**< IEEE 802.15.4 PHY mode */
     const iolist_t *psdu;               /**< stores the current PSDU */
+#if IS_USED(MODULE_IEEE802154_SUBMAC_PIPELINE) || defined(DOXYGEN)
+    iolist_t next;                      /**< pending frame, empty if iol_len is 0 */
+    uint8_t next_psdu[IEEE802154_FRAME_LEN_MAX]; /**< buffer of the pending frame */
+#endif
 };
 
 /**
@@ -215,13 +236,19 @@ struct ieee802154_submac {
  * retransmissions (if ACK Request bit is set).  When the transmission finishes
  * an @ref ieee802154_submac_cb_t::tx_done event is issued.
  *
+ * With the `ieee802154_submac_pipeline` module, a frame sent while the SubMAC
+ * is busy with a transmission is copied and transmitted as soon as the
+ * ongoing transmission ends. Only one frame can be pending at a time.
+ *
  * @param[in] submac pointer to the SubMAC descriptor
  * @param[in] iolist pointer to the PSDU frame (without FCS)
  *
  * @return 0 on success
  * @return -EBUSY if the SubMAC is not in RX or IDLE state or if called inside
  *         @ref ieee802154_submac_cb_t::rx_done or
- *         @ref ieee802154_submac_cb_t::tx_done
+ *         @ref ieee802154_submac_cb_t::tx_done. With
+ *         `ieee802154_submac_pipeline`, only if a frame is already pending
+ * @return -EMSGSIZE if a frame to be pipelined exceeds the maximum PSDU size
  */
 int ieee802154_send(ieee802154_submac_t *submac, const iolist_t *iolist);
 
@@ -30,6 +30,7 @@
 #ifndef NET_IEEE802154_SECURITY_H
 #define NET_IEEE802154_SECURITY_H
 
+#include <stdbool.h>
 #include <stdint.h>
 #include "kernel_defines.h"
 #include "ieee802154.h"
@@ -44,6 +45,24 @@ extern "C" {
  */
 typedef struct ieee802154_sec_dev ieee802154_sec_dev_t;
 
+/**
+ * @brief   Format of 13 byte nonce
+ */
+typedef struct __attribute__((packed)) {
+    /**
+     * @brief   Source long address
+     */
+    uint8_t src_addr[IEEE802154_LONG_ADDRESS_LEN];
+    /**
+     * @brief   Frame counter
+     */
+    uint32_t frame_counter;
+    /**
+     * @brief   One of IEEE802154_SEC_SCF_SECLEVEL_*
+     */
+    uint8_t security_level;
+} ieee802154_sec_ccm_nonce_t;
+
 /**
  * @brief   Struct of security operations
  *
@@ -91,6 +110,35 @@ typedef struct ieee802154_radio_cipher_ops {
                 uint8_t *cipher,
                 const uint8_t *plain,
                 uint8_t nblocks);
+    /**
+     * @brief   Function to perform CCM* on a whole frame
+     *
+     * Optional, for devices with a CCM mode. The MIC is computed over @p a and
+     * @p m, and @p m is encrypted if the security level of @p nonce requires
+     * encryption. Without this function, or if it returns
+     * -IEEE802154_SEC_UNSUPORTED, the frame is processed block by block with
+     * ieee802154_radio_cipher_ops_t::cbc and ieee802154_radio_cipher_ops_t::ecb.
+     *
+     * @param[in]       dev         Will be @ref ieee802154_sec_context_t::ieee802154_sec_dev_t
+     * @param[in]       nonce       Nonce of the frame
+     * @param[in]       a           Authenticated data: header and auxiliary header
+     * @param[in]       a_len       Length of @p a
+     * @param[in, out]  m           Payload, encrypted or decrypted in place
+     * @param[in]       m_len       Length of @p m
+     * @param[in, out]  mic         encrypt: computed MIC; decrypt: received MIC
+     * @param[in]       mic_size    Size of the MIC, 0 if there is none
+     * @param[in]       decrypt     true to decrypt @p m and check @p mic
+     *
+     * @return          0 on success
+     * @return          -IEEE802154_SEC_MAC_CHECK_FAILURE if the MIC did not match
+     * @return          -IEEE802154_SEC_UNSUPORTED to fall back to block operations
+     */
+    int (*ccm)(const ieee802154_sec_dev_t *dev,
+               const ieee802154_sec_ccm_nonce_t *nonce,
+               const uint8_t *a, uint16_t a_len,
+               uint8_t *m, uint16_t m_len,
+               uint8_t *mic, uint8_t mic_size,
+               bool decrypt);
 } ieee802154_radio_cipher_ops_t;
 
 /**
@@ -263,6 +311,13 @@ typedef struct ieee802154_sec_context {
      * @brief   Own frame counter
      */
     uint32_t frame_counter;
+    /**
+     * @brief   Key currently loaded into the security device, NULL if none
+     *
+     * The key is only passed to ieee802154_radio_cipher_ops_t::set_key when
+     * it differs from this one.
+     */
+    const uint8_t *dev_key;
     /**
      * @brief   802.15.4 security dev
      */
@@ -339,24 +394,6 @@ typedef struct __attribute__((packed)) {
     uint8_t key_index;
 } ieee802154_sec_aux_key_identifier_9_t;
 
-/**
- * @brief   Format of 13 byte nonce
- */
-typedef struct __attribute__((packed)) {
-    /**
-     * @brief   Source long address
-     */
-    uint8_t src_addr[IEEE802154_LONG_ADDRESS_LEN];
-    /**
-     * @brief   Frame counter
-     */
-    uint32_t frame_counter;
-    /**
-     * @brief   One of IEEE802154_SEC_SCF_SECLEVEL_*
-     */
-    uint8_t security_level;
-} ieee802154_sec_ccm_nonce_t;
-
 /**
  * @brief   Format of 16 byte input block of CCM
  */
@@ -383,6 +420,19 @@ typedef struct __attribute__((packed)) {
  */
 void ieee802154_sec_init(ieee802154_sec_context_t *ctx);
 
+/**
+ * @brief   Forget about the key loaded into the security device
+ *
+ * Must be called when the key was changed, or when the device lost the key,
+ * e.g. by a reset, so the key is loaded again for the next frame.
+ *
+ * @param[in, out]  ctx                     IEEE 802.15.4 security context
+ */
+static inline void ieee802154_sec_key_invalidate(ieee802154_sec_context_t *ctx)
+{
+    ctx->dev_key = NULL;
+}
+
 /**
  * @brief   Encrypt IEEE 802.15.4 frame according to @p ctx
  *
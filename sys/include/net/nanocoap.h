@@ -64,6 +64,15 @@
  * and exact matching should be register, and then a second one with the path
  * `/resource01/` and subtree matching.
  *
+ * By default the resources are matched in the order they are registered, so
+ * the time needed to find a resource grows with the number of resources. With
+ * the `nanocoap_resources_sorted` module, a resource is looked up by a binary
+ * search instead. All resource lists, including those of
+ * @ref coap_subtree_handler, then *must* be sorted by
+ * @ref coap_resource_t::path "path" in `strcmp()` order. An exact match of the URI-path is preferred over a
+ * subtree match, and of several matching subtree resources the one with the
+ * longest path is used, independent of the order of the resources.
+ *
  * @{
  *
  * @file
@@ -166,6 +175,18 @@ extern "C" {
 #ifndef CONFIG_NANOCOAP_QS_MAX
 #define CONFIG_NANOCOAP_QS_MAX             (64)
 #endif
+
+/**
+ * @brief   Highest option number found without a search with the
+ *          `nanocoap_opt_index` module
+ *
+ * The default covers the options commonly read by handlers, including
+ * Uri-Path, Content-Format, Accept, Block2 and Block1. Each option number
+ * up to this costs one byte in @ref coap_pkt_t.
+ */
+#ifndef CONFIG_NANOCOAP_OPT_INDEX_MAX
+#define CONFIG_NANOCOAP_OPT_INDEX_MAX      (COAP_OPT_BLOCK1)
+#endif
 /** @} */
 
 /**
@@ -177,6 +198,16 @@ extern "C" {
 #define CONFIG_NANOCOAP_BLOCK_HEADER_MAX   (80)
 #endif
 
+/**
+ * @brief    Maximum number of block requests in flight for a pipelined
+ *           blockwise transfer
+ *
+ * @see nanocoap_sock_get_blockwise_pipelined()
+ */
+#ifndef CONFIG_NANOCOAP_BLOCKWISE_WINDOW
+#define CONFIG_NANOCOAP_BLOCKWISE_WINDOW   (4)
+#endif
+
 /**
  * @name coap_opt_finish() flag parameter values
  *
@@ -231,6 +262,13 @@ typedef struct {
     uint16_t options_len;                             /**< length of options array */
     coap_optpos_t options[CONFIG_NANOCOAP_NOPTS_MAX]; /**< option offset array     */
     BITFIELD(opt_crit, CONFIG_NANOCOAP_NOPTS_MAX);    /**< unhandled critical option */
+#if defined(MODULE_NANOCOAP_OPT_INDEX) || defined(DOXYGEN)
+    /**
+     * @brief   index into @ref coap_pkt_t::options plus one by option number,
+     *          0 if the option is not present
+     */
+    uint8_t opt_index[CONFIG_NANOCOAP_OPT_INDEX_MAX + 1];
+#endif
 #ifdef MODULE_GCOAP
     uint32_t observe_value;                           /**< observe value           */
 #endif
@@ -610,6 +648,11 @@ static inline void coap_hdr_set_type(coap_hdr_t *hdr, unsigned type)
 /**
  * @brief   Get pointer to an option field by type
  *
+ * With the `nanocoap_opt_index` module, options with numbers up to
+ * @ref CONFIG_NANOCOAP_OPT_INDEX_MAX are found with a table lookup that
+ * coap_parse() and the option write functions of the Packet API keep up to
+ * date, instead of a search of the options of @p pkt.
+ *
  * @param[in]   pkt     packet to work on
  * @param[in]   opt_num the option number to search for
  *
@@ -1858,6 +1901,9 @@ ssize_t coap_handle_req(coap_pkt_t *pkt, uint8_t *resp_buf, unsigned resp_buf_le
  * This function will try to find a matching handler in @p resources and call
  * the handler.
  *
+ * With the `nanocoap_resources_sorted` module, @p resources must be sorted by
+ * path, see @ref net_nanocoap "Server path matching".
+ *
  * @param[in]   pkt             pointer to (parsed) CoAP packet
  * @param[out]  resp_buf        buffer for response
  * @param[in]   resp_buf_len    size of response buffer
@@ -11,6 +11,17 @@
  * @ingroup     net_nanocoap
  * @brief       A cache implementation for nanocoap response messages
  *
+ * Entries are found by a hash of their cache key. When the cache is full, the
+ * least recently used entry is replaced.
+ *
+ * By default, every entry reserves @ref CONFIG_NANOCOAP_CACHE_RESPONSE_SIZE
+ * bytes for its response. With the `nanocoap_cache_arena` module, responses
+ * are instead stored with their actual length in a shared arena of
+ * @ref CONFIG_NANOCOAP_CACHE_ARENA_SIZE bytes, and least recently used entries
+ * are replaced until a new response fits. This allows to cache more, typically
+ * small, responses in the same amount of RAM by increasing
+ * @ref CONFIG_NANOCOAP_CACHE_ENTRIES.
+ *
  * @{
  *
  * @file
@@ -55,6 +66,18 @@ extern "C" {
 #define CONFIG_NANOCOAP_CACHE_RESPONSE_SIZE    (128)
 #endif
 
+/**
+ * @brief Size of the arena shared by all responses in the cache.
+ *
+ * Only used with the `nanocoap_cache_arena` module.
+ * @ref CONFIG_NANOCOAP_CACHE_RESPONSE_SIZE remains the maximum size of a
+ * single response.
+ */
+#ifndef CONFIG_NANOCOAP_CACHE_ARENA_SIZE
+#define CONFIG_NANOCOAP_CACHE_ARENA_SIZE       (CONFIG_NANOCOAP_CACHE_ENTRIES * \
+                                                CONFIG_NANOCOAP_CACHE_RESPONSE_SIZE)
+#endif
+
 /**
  * @brief   Cache container that holds a @p coap_pkt_t struct.
  */
@@ -74,10 +97,17 @@ typedef struct {
      */
     coap_pkt_t response_pkt;
 
+#if IS_USED(MODULE_NANOCOAP_CACHE_ARENA) || defined(DOXYGEN)
+    /**
+     * @brief the response message, stored in the arena
+     */
+    uint8_t *response_buf;
+#else
     /**
      * @brief buffer to hold the response message.
      */
     uint8_t response_buf[CONFIG_NANOCOAP_CACHE_RESPONSE_SIZE];
+#endif
 
     size_t response_len; /**< length of the message in @p response */
 
@@ -101,6 +131,15 @@ typedef struct {
  */
 typedef int (*nanocoap_cache_replacement_strategy_t)(void);
 
+/**
+ * @brief   Statistics of the nanocoap cache since nanocoap_cache_init()
+ */
+typedef struct {
+    uint32_t hits;          /**< lookups that found an entry */
+    uint32_t misses;        /**< lookups that found no entry */
+    uint32_t evictions;     /**< entries replaced to make room for others */
+} nanocoap_cache_stats_t;
+
 /**
  * @brief Typedef for the cache update strategy on element access.
  *
@@ -137,6 +176,16 @@ size_t nanocoap_cache_used_count(void);
  */
 size_t nanocoap_cache_free_count(void);
 
+/**
+ * @brief   Gets the statistics of the cache
+ *
+ * Hits and misses are counted by nanocoap_cache_key_lookup() and
+ * nanocoap_cache_request_lookup().
+ *
+ * @param[out] stats    The statistics
+ */
+void nanocoap_cache_get_stats(nanocoap_cache_stats_t *stats);
+
 /**
  * @brief   Determines if a response is cacheable and modifies the cache
  *          as reflected in RFC7252, Section 5.9.
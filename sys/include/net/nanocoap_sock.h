@@ -347,6 +347,36 @@ int nanocoap_sock_get_blockwise(nanocoap_sock_t *sock, const char *path,
                                 coap_blksize_t blksize,
                                 coap_blockwise_cb_t callback, void *arg);
 
+/**
+ * @brief    Performs a blockwise coap get request on a socket with multiple
+ *           block requests in flight.
+ *
+ * Like nanocoap_sock_get_blockwise(), but after the first block, which
+ * determines the block size used by the server, up to
+ * @ref CONFIG_NANOCOAP_BLOCKWISE_WINDOW blocks are requested at once. This
+ * saves most of the round trips on links with a high latency. Responses
+ * arriving out of order are stored in @p buf, so @p callback is still called
+ * for each block in order.
+ *
+ * The window is limited to as many blocks as fit into @p buf. If not even two
+ * blocks fit, this falls back to fetching one block at a time.
+ *
+ * @param[in]   sock       socket to use for the request
+ * @param[in]   path       pointer to source path
+ * @param[in]   blksize    sender suggested SZX for the COAP block request
+ * @param[in]   buf        buffer for blocks received out of order
+ * @param[in]   len        length of @p buf
+ * @param[in]   callback   callback to be executed on each received block
+ * @param[in]   arg        optional function arguments
+ *
+ * @returns     <0         if failed to fetch the url content
+ * @returns      0         on success
+ */
+int nanocoap_sock_get_blockwise_pipelined(nanocoap_sock_t *sock, const char *path,
+                                          coap_blksize_t blksize,
+                                          void *buf, size_t len,
+                                          coap_blockwise_cb_t callback, void *arg);
+
 /**
  * @brief    Performs a blockwise coap get request to the specified url.
  *
@@ -354,6 +384,12 @@ int nanocoap_sock_get_blockwise(nanocoap_sock_t *sock, const char *path,
  * block-wise-transfer. A coap_blockwise_cb_t will be called on each received
  * block.
  *
+ * With the `nanocoap_sock_pipeline` module, the blocks are fetched with
+ * nanocoap_sock_get_blockwise_pipelined() using a static buffer of
+ * @ref CONFIG_NANOCOAP_BLOCKWISE_WINDOW blocks of
+ * 2^@ref CONFIG_NANOCOAP_BLOCK_SIZE_EXP_MAX bytes. This also applies to the
+ * firmware downloads of SUIT.
+ *
  * @param[in]   url        Absolute URL pointer to source path (i.e. not containing
  *                         a fragment identifier)
  * @param[in]   blksize    sender suggested SZX for the COAP block request
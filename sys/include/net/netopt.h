@@ -828,6 +828,42 @@ typedef enum {
      * @brief   (array of byte arrays) Leave an link layer multicast group
      */
     NETOPT_L2_GROUP_LEAVE,
+    /**
+     * @brief   (uint16_t) maximum number of @ref iolist_t entries the device
+     *          can transmit from directly (scatter-gather DMA), read-only
+     *
+     * Devices not implementing this option copy the frame to transmit and
+     * accept an iolist of arbitrary length. Upper layers have to merge the
+     * payload, if the iolist passed to @ref netdev_driver_t::send would be
+     * longer than the returned value.
+     */
+    NETOPT_TX_IOLIST_MAX,
+    /**
+     * @brief   (uint64_t) time the last frame was transmitted, read-only
+     *
+     * The timestamp refers to the start of frame delimiter of the last frame
+     * sent and is given in nanoseconds since epoch of the PTP clock. Devices
+     * return -EAGAIN if no frame has been timestamped yet.
+     */
+    NETOPT_TX_TIMESTAMP,
+    /**
+     * @brief   (@ref netopt_enable_t) the device calculates and inserts the
+     *          TCP, UDP and ICMPv6 checksums of transmitted IPv6 packets,
+     *          read-only
+     *
+     * Upper layers leave the checksum to the device, except for packets
+     * that are fragmented on the IP layer.
+     */
+    NETOPT_TX_CSUM_OFFLOAD,
+    /**
+     * @brief   (@ref netopt_enable_t) the device verifies the TCP, UDP and
+     *          ICMPv6 checksums of received IPv6 packets and drops packets
+     *          with invalid checksums, read-only
+     *
+     * Upper layers skip verifying the checksum of packets received from the
+     * device, except for packets reassembled on the IP layer.
+     */
+    NETOPT_RX_CSUM_OFFLOAD,
     /**
      * @brief   maximum number of options defined here.
      *
@@ -68,6 +68,10 @@ typedef struct {
     uint32_t tx_bytes;          /**< sent bytes */
     uint32_t rx_count;          /**< received (data) packets */
     uint32_t rx_bytes;          /**< received bytes */
+    uint32_t rx_invalid;        /**< frames dropped by the device as invalid,
+                                     e.g. with a wrong CRC */
+    uint32_t rx_overrun;        /**< frames lost by the device, e.g. as its
+                                     RX buffers were full */
 } netstats_t;
 
 /**
@@ -0,0 +1,193 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    net_ptp_client Precision Time Protocol client
+ * @ingroup     net
+ * @brief       Synchronizes the PTP clock to an IEEE 1588 master
+ *
+ * The client implements an ordinary clock in slave only mode of IEEE 1588-2008
+ * (PTPv2) over UDP, using the end-to-end delay mechanism. Sync messages of
+ * one-step and two-step masters are supported. The offset to the master is
+ * corrected by adjusting the speed of the PTP clock with a PI controller, the
+ * clock is only stepped initially and when the offset exceeds
+ * @ref CONFIG_PTP_CLIENT_STEP_THRESHOLD_NS. With module `ztimer_usec_ptp`,
+ * ZTIMER_USEC runs on the PTP clock and is thus synchronized as well.
+ *
+ * The reception of Sync messages is timestamped by the network device
+ * (module `sock_aux_timestamp`). The transmission of Delay_Req messages is
+ * timestamped with @ref NETOPT_TX_TIMESTAMP of the network interface, if
+ * provided, otherwise the PTP clock is read before sending. The path delay is
+ * filtered, so the remaining error of the latter only affects the offset
+ * slowly.
+ *
+ * Messages of the first master heard are used, another master is only
+ * accepted once no Sync message was received from it for
+ * @ref CONFIG_PTP_CLIENT_MASTER_TIMEOUT_MS. There is no best master clock
+ * algorithm. Delay_Req messages are sent unicast to the master, which needs to
+ * answer them (e.g. hybrid mode of ptp4l). To receive multicast Sync messages,
+ * the application has to join the PTP multicast group on the interface.
+ *
+ * @note    The PTP clock runs in the timescale of the master, which usually
+ *          is TAI and not UTC.
+ *
+ * @{
+ *
+ * @file
+ * @brief       PTP client definitions
+ */
+
+#ifndef NET_PTP_CLIENT_H
+#define NET_PTP_CLIENT_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "net/sock/udp.h"
+#include "thread.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup net_ptp_client_conf PTP client compile configurations
+ * @ingroup config
+ * @{
+ */
+/**
+ * @brief   PTP domain to synchronize to
+ */
+#ifndef CONFIG_PTP_CLIENT_DOMAIN
+#define CONFIG_PTP_CLIENT_DOMAIN                (0U)
+#endif
+
+/**
+ * @brief   Offset in nanoseconds above which the clock is stepped
+ */
+#ifndef CONFIG_PTP_CLIENT_STEP_THRESHOLD_NS
+#define CONFIG_PTP_CLIENT_STEP_THRESHOLD_NS     (100000U)
+#endif
+
+/**
+ * @brief   Offset in nanoseconds below which the clock counts as locked
+ */
+#ifndef CONFIG_PTP_CLIENT_LOCK_THRESHOLD_NS
+#define CONFIG_PTP_CLIENT_LOCK_THRESHOLD_NS     (1000U)
+#endif
+
+/**
+ * @brief   Proportional gain of the clock controller in 1/1000
+ */
+#ifndef CONFIG_PTP_CLIENT_KP
+#define CONFIG_PTP_CLIENT_KP                    (700U)
+#endif
+
+/**
+ * @brief   Integral gain of the clock controller in 1/1000
+ */
+#ifndef CONFIG_PTP_CLIENT_KI
+#define CONFIG_PTP_CLIENT_KI                    (300U)
+#endif
+
+/**
+ * @brief   Maximum speed correction of the clock in parts per billion
+ */
+#ifndef CONFIG_PTP_CLIENT_MAX_PPB
+#define CONFIG_PTP_CLIENT_MAX_PPB               (500000U)
+#endif
+
+/**
+ * @brief   Interval of Delay_Req messages in milliseconds
+ */
+#ifndef CONFIG_PTP_CLIENT_DELAY_REQ_INTERVAL_MS
+#define CONFIG_PTP_CLIENT_DELAY_REQ_INTERVAL_MS (1000U)
+#endif
+
+/**
+ * @brief   Weight of a new path delay measurement as power of two, e.g. 3
+ *          for 1/8
+ */
+#ifndef CONFIG_PTP_CLIENT_DELAY_FILTER_SHIFT
+#define CONFIG_PTP_CLIENT_DELAY_FILTER_SHIFT    (3U)
+#endif
+
+/**
+ * @brief   Time without Sync messages in milliseconds after which another
+ *          master is accepted
+ */
+#ifndef CONFIG_PTP_CLIENT_MASTER_TIMEOUT_MS
+#define CONFIG_PTP_CLIENT_MASTER_TIMEOUT_MS     (5000U)
+#endif
+/** @} */
+
+/**
+ * @brief   Stack size of the client thread
+ */
+#ifndef PTP_CLIENT_STACKSIZE
+#define PTP_CLIENT_STACKSIZE        (THREAD_STACKSIZE_DEFAULT)
+#endif
+
+/**
+ * @brief   Priority of the client thread
+ */
+#ifndef PTP_CLIENT_PRIO
+#define PTP_CLIENT_PRIO             (THREAD_PRIORITY_MAIN - 1)
+#endif
+
+/**
+ * @brief   UDP port of PTP event messages
+ */
+#define PTP_CLIENT_EVENT_PORT       (319U)
+
+/**
+ * @brief   UDP port of PTP general messages
+ */
+#define PTP_CLIENT_GENERAL_PORT     (320U)
+
+/**
+ * @brief   Synchronization state
+ */
+typedef struct {
+    int64_t offset;         /**< last offset to the master in ns */
+    int64_t path_delay;     /**< filtered mean path delay in ns, -1 if not
+                             *   measured yet */
+    int32_t ppb;            /**< speed correction of the clock in ppb */
+    uint32_t syncs;         /**< number of Sync messages processed */
+    uint32_t steps;         /**< number of times the clock was stepped */
+    bool locked;            /**< offset below
+                             *   @ref CONFIG_PTP_CLIENT_LOCK_THRESHOLD_NS */
+} ptp_client_stats_t;
+
+/**
+ * @brief   Starts the client thread
+ *
+ * @pre     The PTP clock is initialized
+ *
+ * @param[in] local     family and interface to listen on, the port is
+ *                      ignored
+ *
+ * @retval  0 on success
+ * @retval  -EALREADY if the client is already running
+ * @retval  negative errno of @ref sock_udp_create() on error
+ */
+int ptp_client_run(const sock_udp_ep_t *local);
+
+/**
+ * @brief   Returns the synchronization state
+ *
+ * @param[out] stats    synchronization state
+ */
+void ptp_client_get_stats(ptp_client_stats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NET_PTP_CLIENT_H */
+/** @} */
@@ -50,6 +50,7 @@ typedef struct {
     netstats_rpl_block_t dis;           /**< DIS statistics */
     netstats_rpl_block_t dao;           /**< DAO statistics */
     netstats_rpl_block_t dao_ack;       /**< DAO-ACK statistics */
+    uint32_t dio_consistent;            /**< DIOs only counted for trickle */
 } netstats_rpl_t;
 
 #ifdef __cplusplus
@@ -123,6 +123,10 @@ sock_dtls_session_t *sock_dodtls_get_server_session(void);
 /**
  * @brief       Configure and establish session with DNS over DTLS server
  *
+ * If a session with @p server using the credential with the tag and type of
+ * @p creds is already established, it is kept and no new handshake is done.
+ * A session with another configured server is destroyed first.
+ *
  * @param[in] server    A DNS over DTLS server endpoint. May be NULL to
  *                      destroy the session with and unset the currently
  *                      configured server.
@@ -361,6 +361,20 @@ typedef struct {
     sock_aux_flags_t flags; /**< Flags used request information */
 } sock_udp_aux_tx_t;
 
+/**
+ * @brief   Description of a single datagram for sock_udp_recv_many()
+ */
+typedef struct {
+    void *data;             /**< Buffer to store the payload into */
+    size_t max_len;         /**< Maximum space available at sock_udp_msg_t::data */
+    /**
+     * @brief   Length of the received payload, or negative errno (-ENOBUFS,
+     *          -EPROTO) if the datagram was consumed but not delivered
+     */
+    ssize_t len;
+    sock_udp_ep_t remote;   /**< Remote end point of the datagram */
+} sock_udp_msg_t;
+
 /**
  * @brief   Creates a new UDP sock object
  *
@@ -785,6 +799,63 @@ static inline ssize_t sock_udp_sendv(sock_udp_t *sock,
     return sock_udp_sendv_aux(sock, snips, remote, NULL);
 }
 
+/**
+ * @brief   Sends a batch of UDP messages to one remote end point
+ *
+ * Validates the end points and binds @p sock only once for the whole batch
+ * and passes the datagrams down the stack back to back.
+ *
+ * @pre `((sock != NULL || remote != NULL))`
+ * @pre `(numof == 0) || (snips != NULL)`
+ *
+ * @param[in] sock      A UDP sock object. May be `NULL`.
+ *                      A sensible local end point should be selected by the
+ *                      implementation in that case.
+ * @param[in] snips     Array of @p numof payload chunk lists, one per datagram.
+ * @param[in] numof     Number of datagrams in @p snips.
+ * @param[in] remote    Remote end point for all datagrams.
+ *                      May be `NULL`, if @p sock has a remote end point.
+ *
+ * @experimental    This function is quite new, not implemented for all stacks
+ *                  yet, and may be subject to sudden API changes. Do not use in
+ *                  production if this is unacceptable.
+ *
+ * @return  The number of datagrams sent on success. May be less than @p numof
+ *          if the stack ran out of resources; the remaining datagrams were not
+ *          sent.
+ * @return  A negative errno as sock_udp_sendv_aux() would return it, if no
+ *          datagram could be sent.
+ */
+ssize_t sock_udp_send_many(sock_udp_t *sock, const iolist_t *const *snips,
+                           unsigned numof, const sock_udp_ep_t *remote);
+
+/**
+ * @brief   Receives a batch of UDP messages
+ *
+ * Waits up to @p timeout for the first datagram, then takes further datagrams
+ * from the queue of @p sock without blocking.
+ *
+ * @pre `(sock != NULL) && ((numof == 0) || (msgs != NULL))`
+ *
+ * @param[in] sock      A UDP sock object.
+ * @param[in,out] msgs  Array of @p numof datagram descriptions. On return
+ *                      sock_udp_msg_t::len and sock_udp_msg_t::remote are set
+ *                      for each received datagram.
+ * @param[in] numof     Number of elements in @p msgs.
+ * @param[in] timeout   Timeout for the first datagram in microseconds, see
+ *                      sock_udp_recv().
+ *
+ * @experimental    This function is quite new, not implemented for all stacks
+ *                  yet, and may be subject to sudden API changes. Do not use in
+ *                  production if this is unacceptable.
+ *
+ * @return  The number of elements of @p msgs filled on success.
+ * @return  A negative errno as sock_udp_recv() would return it, if no datagram
+ *          was received.
+ */
+ssize_t sock_udp_recv_many(sock_udp_t *sock, sock_udp_msg_t *msgs,
+                           unsigned numof, uint32_t timeout);
+
 #include "sock_types.h"
 
 #ifdef __cplusplus
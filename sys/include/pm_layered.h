@@ -23,6 +23,8 @@
  * - individual power modes can be blocked/unblocked, e.g., by peripherals
  * - if a mode is blocked, so are implicitly all lower modes
  * - the idle thread automatically selects and sets the lowest unblocked mode
+ * - with module `pm_layered_tickless`, modes that would wake up too late for
+ *   the next ztimer timer are skipped as well
  *
  * In order to use this module, you'll need to implement pm_set().
  *
@@ -50,6 +52,20 @@ extern "C" {
 #define PROVIDES_PM_SET_LOWEST
 #endif
 
+/**
+ * @brief   Wakeup latency of each power mode in microseconds
+ *
+ * Initializer for an array of @ref PM_NUM_MODES entries, starting with the
+ * lowest power mode. It is used by module `pm_layered_tickless` to avoid
+ * entering power modes that cannot be left in time for the next timer on
+ * ZTIMER_USEC or ZTIMER_MSEC. CPUs or boards should provide it in
+ * `periph_cpu.h` or `board.h`; by default every mode is considered to wake up
+ * instantly.
+ */
+#ifndef PM_WAKEUP_LATENCY_US
+#define PM_WAKEUP_LATENCY_US    { 0 }
+#endif
+
 /**
  * @brief Power Management mode blocker typedef
  */
@@ -0,0 +1,146 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    sys_profiler Sampling profiler
+ * @ingroup     sys
+ * @brief       Histogram of the code interrupted by a periodic timer
+ *
+ * While running, a periodic timer interrupts the system
+ * @ref CONFIG_PROFILER_FREQ_HZ times a second. Every interrupt takes the
+ * program counter of the interrupted code and the active thread from the
+ * exception frame and counts it in a histogram. Over time, the histogram shows
+ * where the CPU time goes, without a debugger attached.
+ *
+ * The program counter is taken from:
+ *
+ * - Cortex-M: the exception frame on the process stack
+ * - RISC-V: the `mepc` register
+ * - native: the context saved by the signal handler
+ *
+ * Samples of code that cannot be attributed, e.g. interrupts interrupted by
+ * the timer on Cortex-M, are only counted in @ref profiler_stats_t::isr. Up to
+ * @ref CONFIG_PROFILER_SLOTS_NUMOF distinct program counters and threads are
+ * counted, further ones only in @ref profiler_stats_t::lost.
+ *
+ * @ref profiler_print() writes the histogram to stdio.
+ * `dist/tools/profiler/profiler.py` maps the program counters to functions
+ * using the ELF file of the application and prints them as folded stacks to
+ * feed into a flame graph generator:
+ *
+ * ```
+ * make term | tee profile.log
+ * dist/tools/profiler/profiler.py bin/<board>/<app>.elf profile.log > profile.folded
+ * flamegraph.pl profile.folded > profile.svg
+ * ```
+ *
+ * Use the shell command `prof` (module `shell_cmd_profiler`) to control the
+ * profiler.
+ *
+ * @note    Only the interrupted function is known, there is no stack unwinding.
+ *          The flame graph has one level for the thread and one for the
+ *          function.
+ *
+ * @{
+ *
+ * @file
+ * @brief       Sampling profiler API
+ */
+
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include <stdint.h>
+
+#include "sched.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef CONFIG_PROFILER_FREQ_HZ
+/**
+ * @brief   Sampling frequency in Hz
+ */
+#define CONFIG_PROFILER_FREQ_HZ     1000
+#endif
+
+#ifndef CONFIG_PROFILER_SLOTS_NUMOF
+/**
+ * @brief   Number of distinct program counters and threads that are counted
+ */
+#define CONFIG_PROFILER_SLOTS_NUMOF 128
+#endif
+
+/**
+ * @brief   Count of a program counter in a thread
+ */
+typedef struct {
+    uintptr_t pc;               /**< interrupted program counter */
+    uint32_t count;             /**< number of samples, 0 if unused */
+    kernel_pid_t pid;           /**< interrupted thread */
+} profiler_sample_t;
+
+/**
+ * @brief   Profiler statistics
+ */
+typedef struct {
+    uint32_t samples;           /**< samples taken in total */
+    uint32_t isr;               /**< samples in code that is not attributed */
+    uint32_t lost;              /**< samples that did not fit the histogram */
+} profiler_stats_t;
+
+/**
+ * @brief   Start sampling
+ *
+ * The histogram is kept, call @ref profiler_reset() to start over.
+ */
+void profiler_start(void);
+
+/**
+ * @brief   Stop sampling
+ */
+void profiler_stop(void);
+
+/**
+ * @brief   Clear the histogram and the statistics
+ */
+void profiler_reset(void);
+
+/**
+ * @brief   Get the profiler statistics
+ *
+ * @param[out]  stats   the statistics are written here
+ */
+void profiler_get_stats(profiler_stats_t *stats);
+
+/**
+ * @brief   Get the histogram
+ *
+ * @param[out]  samples array to write the used histogram entries to
+ * @param[in]   numof   number of elements in @p samples
+ *
+ * @return  number of entries written to @p samples
+ */
+unsigned profiler_get_samples(profiler_sample_t *samples, unsigned numof);
+
+/**
+ * @brief   Print the statistics and the histogram
+ *
+ * Every entry is printed as line `profiler: <count> <pid> <thread> 0x<pc>`,
+ * enclosed by a line starting with `profiler: samples` and a line
+ * `profiler: end`.
+ */
+void profiler_print(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PROFILER_H */
+/** @} */
@@ -44,6 +44,17 @@ extern "C" {
 #define RANDOM_SEED_DEFAULT (1)
 #endif
 
+/**
+ * @brief   Number of words kept in the pool of the `random_hwrng_pool` module
+ *
+ * With `prng_hwrng`, this module reads the HWRNG in bulk from the lowest
+ * priority event thread, so that @ref random_uint32 usually takes a word from
+ * the pool instead of waiting for the HWRNG.
+ */
+#ifndef CONFIG_RANDOM_HWRNG_POOL_SIZE
+#define CONFIG_RANDOM_HWRNG_POOL_SIZE   (16U)
+#endif
+
 /**
  * @brief Enables support for floating point random number generation
  */
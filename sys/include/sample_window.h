@@ -0,0 +1,192 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    sys_sample_window  Quantized sample windows
+ * @ingroup     sys
+ * @brief       Collects sensor samples into windows of quantized int8 values
+ *              for inference
+ *
+ * Samples are quantized with the input quantization of the model (scale and
+ * zero point) straight into a ring of windows provided by the application,
+ * without any intermediate @ref phydat_t or float buffers. Once a window is
+ * complete, an event is posted, its handler hands the window to the model
+ * (e.g. by copying it into the input tensor of TensorFlow Lite Micro) and
+ * releases it. Sampling continues into the next window in the meantime.
+ *
+ * Samples are fed from
+ * - a SAUL device using @ref sample_window_read_saul(), which drains the
+ *   buffer of the device using @ref saul_reg_read_batch(), or
+ * - continuous ADC sampling by passing @ref sample_window_adc_cb() as
+ *   callback to @ref adc_continuous_start(), in interrupt context.
+ *
+ * A frame is one sample of all channels, e.g. the three axes of an
+ * accelerometer. Windows store frames next to each other in the order of the
+ * channels, i.e. in the layout of a `[frames][channels]` input tensor.
+ *
+ * @{
+ *
+ * @file
+ */
+
+#ifndef SAMPLE_WINDOW_H
+#define SAMPLE_WINDOW_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "event.h"
+#include "kernel_defines.h"
+
+#if IS_USED(MODULE_SAUL_REG)
+#include "saul_reg.h"
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Number of samples read from a SAUL device at once
+ */
+#ifndef CONFIG_SAMPLE_WINDOW_SAUL_CHUNK
+#define CONFIG_SAMPLE_WINDOW_SAUL_CHUNK     (8U)
+#endif
+
+/**
+ * @brief   Ring of sample windows
+ */
+typedef struct {
+    event_t event;              /**< posted when a window is complete */
+    event_queue_t *queue;       /**< queue to post @ref event to */
+    int8_t *buf;                /**< memory of all windows */
+    uint16_t frames;            /**< frames per window */
+    uint8_t channels;           /**< channels per frame */
+    uint8_t numof;              /**< number of windows */
+    int8_t zero_point;          /**< zero point of the quantization */
+    int8_t exp;                 /**< exponent @ref mult was computed for */
+    float scale;                /**< scale of the quantization */
+    int32_t mult;               /**< input to quantized value, Q16 */
+    int8_t *cur;                /**< window being filled, NULL if none */
+    uint16_t pos;               /**< frames in the window being filled */
+    uint8_t read;               /**< oldest complete window */
+    uint8_t ready;              /**< complete windows not yet released */
+    unsigned overruns;          /**< frames dropped as no window was free */
+} sample_window_t;
+
+/**
+ * @brief   Initializes a ring of sample windows
+ *
+ * @param[out] sw           ring to initialize
+ * @param[in] buf           memory for @p numof windows of
+ *                          @p frames * @p channels bytes each
+ * @param[in] numof         number of windows, at least 2 to keep sampling
+ *                          while a window is processed
+ * @param[in] frames        frames per window
+ * @param[in] channels      channels per frame
+ * @param[in] scale         scale of the input quantization of the model
+ * @param[in] zero_point    zero point of the input quantization of the model
+ * @param[in] queue         queue to post the completion event to
+ * @param[in] handler       handler of the completion event, should call
+ *                          @ref sample_window_get() until it returns NULL
+ */
+void sample_window_init(sample_window_t *sw, int8_t *buf, uint8_t numof,
+                        uint16_t frames, uint8_t channels, float scale,
+                        int8_t zero_point, event_queue_t *queue,
+                        event_handler_t handler);
+
+/**
+ * @brief   Sets the value of one unit of the raw samples
+ *
+ * Required for raw samples (e.g. from the ADC), samples of SAUL devices are
+ * scaled by their exponent.
+ *
+ * @param[in] sw            ring of windows
+ * @param[in] unit          value of one unit of the raw samples, in the unit
+ *                          the model expects
+ */
+void sample_window_set_input_scale(sample_window_t *sw, float unit);
+
+/**
+ * @brief   Adds frames of raw samples
+ *
+ * Can be called from interrupt context.
+ *
+ * @param[in] sw            ring of windows
+ * @param[in] samples       @p num frames, @ref sample_window_t::channels
+ *                          samples each
+ * @param[in] num           number of frames
+ */
+void sample_window_add(sample_window_t *sw, const int16_t *samples,
+                       size_t num);
+
+/**
+ * @brief   Returns the oldest complete window
+ *
+ * @param[in] sw            ring of windows
+ *
+ * @return  the window, must be released with @ref sample_window_release()
+ * @return  NULL if no window is complete
+ */
+const int8_t *sample_window_get(sample_window_t *sw);
+
+/**
+ * @brief   Releases the window returned by @ref sample_window_get()
+ *
+ * @param[in] sw            ring of windows
+ */
+void sample_window_release(sample_window_t *sw);
+
+/**
+ * @brief   Returns the number of frames dropped and resets it
+ *
+ * Frames are dropped if no window is free, i.e. if windows are not released
+ * fast enough.
+ *
+ * @param[in] sw            ring of windows
+ *
+ * @return  number of frames dropped since the last call
+ */
+unsigned sample_window_overruns(sample_window_t *sw);
+
+#if IS_USED(MODULE_SAUL_REG) || defined(DOXYGEN)
+/**
+ * @brief   Adds all samples buffered by a SAUL device
+ *
+ * The first @ref sample_window_t::channels values of every sample are used.
+ *
+ * @param[in] sw            ring of windows
+ * @param[in] dev           device to read from
+ *
+ * @return  number of frames read
+ * @return  negative error of @ref saul_reg_read_batch()
+ */
+int sample_window_read_saul(sample_window_t *sw, saul_reg_t *dev);
+#endif
+
+#if IS_USED(MODULE_PERIPH_ADC_CONTINUOUS) || defined(DOXYGEN)
+/**
+ * @brief   Callback for @ref adc_continuous_start()
+ *
+ * Pass the ring of windows as argument. The lines sampled are the channels
+ * of the windows, the value of one ADC count must have been set with
+ * @ref sample_window_set_input_scale().
+ *
+ * @param[in] arg           ring of windows
+ * @param[in] samples       samples, a scan of all lines each
+ * @param[in] len           number of samples
+ */
+void sample_window_adc_cb(void *arg, const uint16_t *samples, size_t len);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SAMPLE_WINDOW_H */
+/** @} */
@@ -11,6 +11,13 @@
  * @ingroup     sys
  * @brief       Global sensor/actuator registry for SAUL devices
  *
+ * With the module `saul_reg_index`, @ref saul_reg_add keeps hash tables of the
+ * first entry of every type, every name and every pair of type and name. The
+ * lookup functions then take the same time regardless of the number of
+ * registered devices. If a table runs full, lookups that miss in it fall back
+ * to walking the registry, so the results are the same with and without the
+ * index.
+ *
  * @see @ref drivers_saul
  *
  * @{
@@ -33,6 +40,20 @@
 extern "C" {
 #endif
 
+#ifndef CONFIG_SAUL_REG_INDEX_TYPES_NUMOF
+/**
+ * @brief   Number of distinct device types the index holds
+ */
+#define CONFIG_SAUL_REG_INDEX_TYPES_NUMOF   16
+#endif
+
+#ifndef CONFIG_SAUL_REG_INDEX_NAMES_NUMOF
+/**
+ * @brief   Number of distinct device names the index holds
+ */
+#define CONFIG_SAUL_REG_INDEX_NAMES_NUMOF   32
+#endif
+
 /**
  * @brief   SAUL registry entry
  */
@@ -123,6 +144,25 @@ saul_reg_t *saul_reg_find_type_and_name(uint8_t type, const char *name);
  */
 int saul_reg_read(saul_reg_t *dev, phydat_t *res);
 
+/**
+ * @brief   Read all buffered samples from the given device
+ *
+ * Devices without a buffer return a single sample taken now.
+ *
+ * @param[in] dev       device to read from
+ * @param[out] res      location to store the samples in, oldest first
+ * @param[in] num       number of entries in @p res
+ * @param[in] now       current time in µs, used to calculate the timestamps
+ *                      of the samples
+ *
+ * @return      the number of samples stored in @p res
+ * @return      -ENODEV if given device is invalid
+ * @return      -ENOTSUP if read operation is not supported by the device
+ * @return      -ECANCELED on device errors
+ */
+int saul_reg_read_batch(saul_reg_t *dev, saul_sample_t *res, size_t num,
+                        uint32_t now);
+
 /**
  * @brief   Write data to the given device
  *
@@ -18,6 +18,11 @@
  *              But it does round robin the runqueue when the timer ticks
  *              even if the thread just got the CPU.
  *
+ *              The timer only runs while at least two threads are runnable
+ *              at the active priority, an idle system and priorities with a
+ *              single thread are not woken up by it. The time slice can be
+ *              set per priority with @ref SCHED_RR_TIMEOUT_PRIO.
+ *
  *              This module might be used if threads are not divisible
  *              into priorities and cooperation can not be ensured.
  *
@@ -49,6 +54,18 @@ extern "C" {
 #endif
 #endif
 
+#if !defined(SCHED_RR_TIMEOUT_PRIO) || defined(DOXYGEN)
+/**
+ * @brief   Time slice of threads of priority @p prio in Units of
+ *          SCHED_RR_TIMERBASE
+ *
+ * @details Defaults to SCHED_RR_TIMEOUT for all priorities. Can be defined
+ *          to e.g. `((prio) < 8 ? 2 : SCHED_RR_TIMEOUT)` to switch between
+ *          threads of high priorities more often.
+ */
+#define SCHED_RR_TIMEOUT_PRIO(prio) SCHED_RR_TIMEOUT
+#endif
+
 #if !defined(SCHED_RR_TIMERBASE) || defined(DOXYGEN)
 /**
  * @brief   ztimer to use for the round robin scheduler
@@ -16,6 +16,16 @@
  *
  * @note        If auto_init is disabled `init_schedstatistics()` needs to be
  *              called as well as xtimer_init().
+ *
+ * With module `schedstatistics_cycles` the run time of each thread is also
+ * counted in CPU cycles, which is precise enough to account for threads that
+ * only run for a few microseconds at a time. Time spent in ISRs is accounted
+ * to the thread that got interrupted, as it is for the microsecond run time.
+ *
+ * @warning     On Cortex-M the 32 bit cycle counter overflows after
+ *              2^32 cycles (e.g. about 27 seconds at 160 MHz). A thread
+ *              running longer than that without a context switch in between
+ *              is accounted too few cycles.
  * @{
  *
  * @file
@@ -31,6 +41,8 @@
 
 #include <stdint.h>
 
+#include "sched.h"
+
 #ifdef __cplusplus
  extern "C" {
 #endif
@@ -43,6 +55,12 @@ typedef struct {
                                   scheduled to run */
     unsigned int schedules;  /**< How often the thread was scheduled to run */
     uint64_t runtime_us;     /**< The total runtime of this thread in microseconds */
+#if defined(MODULE_SCHEDSTATISTICS_CYCLES) || defined(DOXYGEN)
+    uint64_t laststart_cycles;  /**< Cycle count of the last time this thread
+                                     was scheduled to run */
+    uint64_t runtime_cycles;    /**< The total runtime of this thread in CPU
+                                     cycles */
+#endif
 } schedstat_t;
 
 /**
@@ -56,6 +74,19 @@ extern schedstat_t sched_pidlist[KERNEL_PID_LAST + 1];
  */
 void init_schedstatistics(void);
 
+#if defined(MODULE_SCHEDSTATISTICS_CYCLES) || defined(DOXYGEN)
+/**
+ * @brief   Get the number of CPU cycles a thread ran for
+ *
+ * @param[in]   pid     thread to get the run time of, or KERNEL_PID_UNDEF for
+ *                      the time spent idle without an idle thread
+ *
+ * @return  CPU cycles @p pid ran for, not including the current time slice
+ *          if @p pid is the running thread
+ */
+uint64_t schedstat_get_cycles(kernel_pid_t pid);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
@@ -14,7 +14,8 @@
  * The `senml` module contains the building blocks for using
  * [SenML](https://www.rfc-editor.org/rfc/rfc8428).
  * This module provides the basic types that can be used with (for example)
- * @ref sys_senml_cbor for encoding measurement data.
+ * @ref sys_senml_cbor for encoding measurement data, or @ref sys_senml_json
+ * for decoding it.
  *
  * Some attributes defined in SenML need to be enabled explicitly,
  * see @ref senml_attr_t for details. To enable all attributes, set:
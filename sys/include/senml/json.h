@@ -0,0 +1,189 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    sys_senml_json SenML JSON
+ * @ingroup     sys_senml
+ * @brief       Streaming decoder for SenML JSON
+ *
+ * The `senml_json` module decodes [SenML JSON](https://www.rfc-editor.org/rfc/rfc8428)
+ * packs into @ref sys_senml values. The input is passed in chunks of any size
+ * as it arrives, e.g. CoAP blocks, and every record is passed to a callback as
+ * soon as it is complete. Memory use is bounded by the parser context and does
+ * not depend on the length of the pack.
+ *
+ * Runs of string content and whitespace are scanned a word at a time.
+ *
+ * Decoding follows these rules:
+ *
+ * - base attributes are kept in the parser and set in the
+ *   @ref senml_attr_t of every following record, as they apply to all of them
+ * - integers are decoded as @ref SENML_TYPE_NUMERIC_INT, or as
+ *   @ref SENML_TYPE_NUMERIC_UINT if they don't fit, other numbers as
+ *   @ref SENML_TYPE_NUMERIC_DECFRAC. Digits beyond the precision of the 32 bit
+ *   mantissa are dropped
+ * - units not in @ref senml_unit_t are decoded as @ref SENML_UNIT_NONE
+ * - data values (`vd`), unknown fields and records without a value are skipped
+ * - records with an unknown field ending in `_` are an error, as required by
+ *   RFC 8428
+ *
+ * ```
+ * static void _on_value(void *arg, const senml_value_t *val)
+ * {
+ *     printf("%s%s\n", val->attr.base_name ? val->attr.base_name : "",
+ *            val->attr.name ? val->attr.name : "");
+ * }
+ *
+ * static const senml_json_cbs_t _cbs = { .value = _on_value };
+ * static senml_json_parser_t _parser;
+ *
+ * senml_json_init(&_parser, &_cbs, NULL);
+ * while (more data) {
+ *     if (senml_json_parse(&_parser, chunk, chunk_len) < 0) {
+ *         ...
+ *     }
+ * }
+ * res = senml_json_finish(&_parser);
+ * ```
+ *
+ * @{
+ *
+ * @file
+ * @brief       Streaming decoder for SenML JSON
+ */
+
+#ifndef SENML_JSON_H
+#define SENML_JSON_H
+
+#include <stddef.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "senml.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Maximum length of a name or base name, including the terminator
+ */
+#ifndef CONFIG_SENML_JSON_NAME_MAX
+#define CONFIG_SENML_JSON_NAME_MAX  64
+#endif
+
+/**
+ * @brief   Maximum length of a string value, including the terminator
+ */
+#ifndef CONFIG_SENML_JSON_STR_MAX
+#define CONFIG_SENML_JSON_STR_MAX   64
+#endif
+
+/**
+ * @brief   Callbacks for the decoded records
+ *
+ * The values and their strings are only valid during the callback. Callbacks
+ * may be NULL to ignore records of their type.
+ */
+typedef struct {
+    /** called for records with a numeric value (`v`) */
+    void (*value)(void *arg, const senml_value_t *val);
+    /** called for records with a string value (`vs`) */
+    void (*string)(void *arg, const senml_string_value_t *val);
+    /** called for records with a boolean value (`vb`) */
+    void (*boolean)(void *arg, const senml_bool_value_t *val);
+} senml_json_cbs_t;
+
+/**
+ * @brief   State of a number being decoded
+ */
+typedef struct {
+    uint64_t mant;          /**< digits decoded so far */
+    int32_t exp;            /**< decimal exponent of the dropped and fraction digits */
+    int32_t e;              /**< explicit exponent */
+    uint16_t flags;         /**< parts seen so far */
+} senml_json_num_t;
+
+/**
+ * @brief   SenML JSON parser context
+ *
+ * The members are private.
+ */
+typedef struct {
+    const senml_json_cbs_t *cbs;    /**< record callbacks */
+    void *arg;                      /**< argument of the callbacks */
+    senml_attr_t base;              /**< base attributes, the others are unused */
+    senml_attr_t attr;              /**< attributes of the current record */
+    senml_numeric_t value;          /**< numeric value of the current record */
+    senml_json_num_t num;           /**< number being decoded */
+    int error;                      /**< negative errno after an error */
+    char *str;                      /**< destination of the current string */
+    uint16_t str_len;               /**< length of the current string */
+    uint16_t str_max;               /**< size of @ref str */
+    uint16_t string_len;            /**< length of @ref string */
+    uint16_t code;                  /**< code point of a `\u` escape */
+    uint16_t hi_surrogate;          /**< pending high surrogate of `\u` escapes */
+    uint8_t esc;                    /**< state of an escape or a skipped value */
+    uint8_t state;                  /**< parser state */
+    uint8_t field;                  /**< field of the current value */
+    uint8_t depth;                  /**< nesting depth of a skipped value */
+    uint8_t lit;                    /**< matched characters of a literal */
+    uint8_t has;                    /**< values present in the current record */
+    bool boolean;                   /**< boolean value of the current record */
+    bool underscore;                /**< the last string ended with `_` */
+    char key[6];                    /**< current key */
+    char unit[10];                  /**< current unit */
+    char base_name[CONFIG_SENML_JSON_NAME_MAX];     /**< base name */
+    char name[CONFIG_SENML_JSON_NAME_MAX];          /**< name */
+    char string[CONFIG_SENML_JSON_STR_MAX];         /**< string value */
+} senml_json_parser_t;
+
+/**
+ * @brief   Initialize a parser for a new pack
+ *
+ * @param[out]  parser  parser to initialize
+ * @param[in]   cbs     record callbacks, must stay valid while parsing
+ * @param[in]   arg     argument passed to the callbacks
+ */
+void senml_json_init(senml_json_parser_t *parser, const senml_json_cbs_t *cbs,
+                     void *arg);
+
+/**
+ * @brief   Decode the next chunk of a pack
+ *
+ * Calls the callbacks for every record completed by @p buf.
+ *
+ * @param[in,out]   parser  parser
+ * @param[in]       buf     next chunk of the pack
+ * @param[in]       len     length of @p buf
+ *
+ * @return  0 on success
+ * @return  -EBADMSG if the input is not a SenML JSON pack
+ * @return  -ENOBUFS if a string does not fit @ref CONFIG_SENML_JSON_NAME_MAX
+ *          or @ref CONFIG_SENML_JSON_STR_MAX
+ * @return  -ENOTSUP on a field that must be understood, but is unknown
+ */
+int senml_json_parse(senml_json_parser_t *parser, const void *buf, size_t len);
+
+/**
+ * @brief   Check that the pack is complete
+ *
+ * @param[in]   parser  parser
+ *
+ * @return  0 if the pack is complete
+ * @return  -ENODATA if the pack is incomplete
+ * @return  the error returned by @ref senml_json_parse() before
+ */
+int senml_json_finish(const senml_json_parser_t *parser);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SENML_JSON_H */
+/** @} */
@@ -26,8 +26,12 @@
 #define SENML_SAUL_H
 
 #include <stdint.h>
+#include "kernel_defines.h"
 #include "nanocbor/nanocbor.h"
 #include "saul_reg.h"
+#if IS_USED(MODULE_NANOCOAP) || defined(DOXYGEN)
+#include "net/nanocoap.h"
+#endif
 
 #ifdef __cplusplus
 extern "C" {
@@ -44,6 +48,17 @@ extern "C" {
 #define CONFIG_SENML_SAUL_USE_FLOATS    0
 #endif
 
+/**
+ * @brief Size of the buffer a single sensor is encoded into by
+ *        @ref senml_saul_encode_cbor_block.
+ *
+ * The buffer is allocated on the stack. It must hold all dimensions of a
+ * sensor, including its name and unit.
+ */
+#ifndef CONFIG_SENML_SAUL_BLOCK_SCRATCH_SIZE
+#define CONFIG_SENML_SAUL_BLOCK_SCRATCH_SIZE    128
+#endif
+
 /**
  * @brief Encode a single @ref drivers_saul sensor as senml+cbor.
  *
@@ -68,6 +83,35 @@ int senml_saul_reg_encode_cbor(nanocbor_encoder_t *enc, saul_reg_t *dev);
  */
 size_t senml_saul_encode_cbor(uint8_t *buf, size_t len, saul_reg_t *reg);
 
+#if IS_USED(MODULE_NANOCOAP) || defined(DOXYGEN)
+/**
+ * @brief Encode a block of all sensors from a @ref drivers_saul registry as
+ *        senml+cbor.
+ *
+ * This encodes the sensors one after another into a small buffer of
+ * @ref CONFIG_SENML_SAUL_BLOCK_SCRATCH_SIZE bytes and only writes the part
+ * that falls into the current block of @p slicer to @p buf, e.g. the payload
+ * of a CoAP response. So a Block2 transfer of many sensors needs neither a
+ * buffer for the full encoding nor a copy of it.
+ *
+ * @note  The sensors are read again for every block, so values may change
+ *        from one block to the next.
+ *
+ * @note  Requires the `nanocoap` module.
+ *
+ * @param slicer Block slicer selecting the block to write.
+ * @param buf    Buffer for the block.
+ * @param reg    SAUL registry to encode.
+ *
+ * @return Number of bytes written to @p buf. The full size of the encoding is
+ *         in `slicer->cur` afterwards.
+ * @return 0 if reading a sensor failed or its encoding exceeds
+ *         @ref CONFIG_SENML_SAUL_BLOCK_SCRATCH_SIZE.
+ */
+size_t senml_saul_encode_cbor_block(coap_block_slicer_t *slicer, uint8_t *buf,
+                                    saul_reg_t *reg);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
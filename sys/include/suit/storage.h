@@ -285,6 +285,15 @@ typedef struct suit_storage_driver {
      * @brief Component ID separator used by this storage driver.
      */
     char separator;
+
+    /**
+     * @brief The payload written is a delta or a compressed image that the
+     *        backend decodes, so its size differs from the image size in the
+     *        manifest.
+     *
+     * The backend has to check the size of the resulting image itself.
+     */
+    bool delta;
 } suit_storage_driver_t;
 
 /**
@@ -376,6 +385,20 @@ static inline bool suit_storage_has_readptr(const suit_storage_t *storage)
     return (storage->driver->read_ptr);
 }
 
+/**
+ * @brief Check if the storage backend expects a delta as payload, see @ref
+ * suit_storage_driver_t::delta
+ *
+ * @param[in]   storage     Storage context
+ *
+ * @returns     True if the payload is a delta,
+ * @returns     False if the payload is the image itself
+ */
+static inline bool suit_storage_is_delta(const suit_storage_t *storage)
+{
+    return storage->driver->delta;
+}
+
 /**
  * @brief Check if the storage backend implements the @ref
  * suit_storage_driver_t::match_offset function
@@ -0,0 +1,80 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+/**
+ * @defgroup    sys_suit_storage_flashwrite_heatshrink  riotboot compressed storage backend
+ * @ingroup     sys_suit_storage
+ * @brief       SUIT riotboot firmware storage backend for compressed images
+ *
+ * This backend takes a firmware image compressed with @ref pkg_heatshrink as
+ * payload. It decompresses the image while it is received and streams it into
+ * the other riotboot slot, so neither RAM nor flash for the compressed image
+ * is needed: the decoder state consists of its small input buffer and its
+ * window of `2 ^ HEATSHRINK_STATIC_WINDOW_BITS` bytes. Image size and digest
+ * in the manifest refer to the decompressed image.
+ *
+ * The backend handles components with the ID
+ * @ref CONFIG_SUIT_STORAGE_FLASHWRITE_HEATSHRINK_LOCATION and selects the slot
+ * by the component offset, like @ref sys_suit_storage_flashwrite does. The
+ * image must be compressed with the window and lookahead size the decoder is
+ * built with (by default `-w 8 -l 4`):
+ *
+ *     heatshrink -e -w 8 -l 4 slot1.bin slot1.hs
+ *
+ * and passed to the manifest generator as
+ * `slot1.hs:$(SLOT1_OFFSET):heatshrink`.
+ *
+ * @{
+ *
+ * @brief       riotboot heatshrink storage backend functions for SUIT manifests
+ */
+
+#ifndef SUIT_STORAGE_FLASHWRITE_HEATSHRINK_H
+#define SUIT_STORAGE_FLASHWRITE_HEATSHRINK_H
+
+#include "suit.h"
+#include "riotboot/flashwrite.h"
+#include "heatshrink_decoder.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Component ID of payloads handled by this backend
+ */
+#ifndef CONFIG_SUIT_STORAGE_FLASHWRITE_HEATSHRINK_LOCATION
+#define CONFIG_SUIT_STORAGE_FLASHWRITE_HEATSHRINK_LOCATION  "heatshrink"
+#endif
+
+/**
+ * @brief   Size of the buffer the decompressed data is passed on in
+ *
+ * The buffer is placed on the stack of the thread writing the payload.
+ */
+#ifndef CONFIG_SUIT_STORAGE_FLASHWRITE_HEATSHRINK_BUF_SIZE
+#define CONFIG_SUIT_STORAGE_FLASHWRITE_HEATSHRINK_BUF_SIZE  (64U)
+#endif
+
+/**
+ * @brief riotboot heatshrink SUIT storage context
+ */
+typedef struct {
+    suit_storage_t storage;       /**< parent struct */
+    riotboot_flashwrite_t writer; /**< Riotboot flashwriter */
+    heatshrink_decoder decoder;   /**< decompression state */
+    size_t img_size;              /**< expected size of the image */
+    size_t img_offset;            /**< bytes of the image decompressed */
+    size_t payload_offset;        /**< bytes of the payload received */
+} suit_storage_flashwrite_heatshrink_t;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SUIT_STORAGE_FLASHWRITE_HEATSHRINK_H */
+/** @} */
@@ -0,0 +1,71 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+/**
+ * @defgroup    sys_suit_storage_flashwrite_vcdiff  riotboot delta storage backend
+ * @ingroup     sys_suit_storage
+ * @brief       SUIT riotboot firmware storage backend for VCDIFF deltas
+ *
+ * This backend takes a VCDIFF delta (see @ref pkg_tinyvcdiff) instead of a
+ * full firmware image. The delta is applied against the image in the running
+ * riotboot slot while it is received, the resulting image is streamed into the
+ * other slot. Just as with @ref sys_suit_storage_flashwrite, the image size
+ * and digest in the manifest refer to the resulting image, so an image built
+ * from a delta against the wrong source is rejected before it is installed.
+ *
+ * The backend handles components with the ID
+ * @ref CONFIG_SUIT_STORAGE_FLASHWRITE_VCDIFF_LOCATION and selects the slot by
+ * the component offset, like @ref sys_suit_storage_flashwrite does. The delta
+ * for a slot has to be created against the binary of the other slot that is
+ * currently running, in the interleaved format, e.g. with open-vcdiff:
+ *
+ *     vcdiff encode -interleaved -dictionary old-slot0.bin \
+ *                   -target new-slot1.bin -delta slot1.vcdiff
+ *
+ * and passed to the manifest generator as
+ * `slot1.vcdiff:$(SLOT1_OFFSET):vcdiff`.
+ *
+ * @{
+ *
+ * @brief       riotboot VCDIFF storage backend functions for SUIT manifests
+ */
+
+#ifndef SUIT_STORAGE_FLASHWRITE_VCDIFF_H
+#define SUIT_STORAGE_FLASHWRITE_VCDIFF_H
+
+#include "suit.h"
+#include "riotboot/flashwrite.h"
+#include "vcdiff.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Component ID of payloads handled by this backend
+ */
+#ifndef CONFIG_SUIT_STORAGE_FLASHWRITE_VCDIFF_LOCATION
+#define CONFIG_SUIT_STORAGE_FLASHWRITE_VCDIFF_LOCATION  "vcdiff"
+#endif
+
+/**
+ * @brief riotboot VCDIFF SUIT storage context
+ */
+typedef struct {
+    suit_storage_t storage;       /**< parent struct */
+    riotboot_flashwrite_t writer; /**< Riotboot flashwriter for the target */
+    vcdiff_t vcdiff;              /**< delta decoder */
+    size_t img_size;              /**< expected size of the resulting image */
+    size_t delta_offset;          /**< bytes of the delta received so far */
+} suit_storage_flashwrite_vcdiff_t;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SUIT_STORAGE_FLASHWRITE_VCDIFF_H */
+/** @} */
@@ -31,6 +31,26 @@
  * It does incur some overhead (at least a function call, getting the current
  * time, a pair of enable/disable interrupts and a couple of memory accesses).
  *
+ * Binary trace stream
+ * -------------------
+ *
+ * With the `trace_stream` module, traces are instead appended to a lock-free
+ * byte ring buffer of @ref CONFIG_TRACE_STREAM_BUFSIZE bytes, without
+ * disabling interrupts. Each record consists of the timestamp followed by the
+ * value, both encoded as unsigned LEB128 varints (7 bits per byte, least
+ * significant group first, MSB set on all but the last byte). The buffer can
+ * be drained with `trace_stream_read()` while tracing continues, e.g. from a
+ * low priority thread, and `trace_dump()` writes all pending records in
+ * binary to stdio (e.g. `stdio_rtt` or `stdio_cdc_acm`). If the buffer is
+ * full, new records are dropped and counted (see `trace_stream_dropped()`).
+ * `trace_reset()` must not be called while other contexts are tracing.
+ *
+ * The timestamp is taken from ZTIMER_USEC unless `TRACE_NOW()` is defined
+ * to return a different 32 bit time stamp, e.g. a CPU cycle counter.
+ *
+ * @warning The lock-free buffer relies on writers only preempting each other,
+ *          as is the case on all single core targets RIOT supports.
+ *
  * Example:
  *
  * ~~~~~~~~~~~~~~~~~~~~~~~~ {.c}
@@ -53,12 +73,20 @@
 #ifndef TRACE_H
 #define TRACE_H
 
+#include <stddef.h>
 #include <stdint.h>
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+/**
+ * @brief   Size of the trace stream buffer in bytes, must be a power of two
+ */
+#ifndef CONFIG_TRACE_STREAM_BUFSIZE
+#define CONFIG_TRACE_STREAM_BUFSIZE 1024
+#endif
+
 /**
  * @brief   Add entry to trace buffer
  *
@@ -92,6 +120,29 @@ void trace_dump(void);
  */
 void trace_reset(void);
 
+#if defined(MODULE_TRACE_STREAM) || defined(DOXYGEN)
+/**
+ * @brief   Take binary trace records from the trace stream buffer
+ *
+ * @note    Only available with module `trace_stream`. Must not be called
+ *          concurrently from more than one context.
+ *
+ * @param[out]  buf     buffer to copy the records to
+ * @param[in]   len     size of @p buf in bytes
+ *
+ * @return  number of bytes copied to @p buf
+ */
+size_t trace_stream_read(void *buf, size_t len);
+
+/**
+ * @brief   Get the number of trace records dropped because the trace stream
+ *          buffer was full
+ *
+ * @note    Only available with module `trace_stream`
+ */
+unsigned trace_stream_dropped(void);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,135 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    sys_tracepoint Tracepoints
+ * @ingroup     sys
+ * @brief       Named probes in hot paths that are enabled at run time
+ *
+ * A tracepoint is placed into code with @ref TRACEPOINT(). Every tracepoint
+ * registers itself by name in a cross-file array, so all of them can be listed
+ * and enabled at run time, e.g. with the shell command `tp` (module
+ * `shell_cmd_tracepoint`). While disabled, a tracepoint costs a load of its
+ * flag byte and a branch that is expected not to be taken. Firmware can thus
+ * carry instrumentation that is only switched on when needed.
+ *
+ * An enabled tracepoint counts its hits and, with the `trace` module, adds
+ * `(index << 24) | (value & 0xffffff)` to the trace buffer, where `index` is
+ * the position of the tracepoint in the list.
+ *
+ * The following tracepoints are built in:
+ *
+ * | name           | value                            |
+ * |:-------------- |:-------------------------------- |
+ * | `msg_send`     | PID of the receiver              |
+ * | `sched_run`    | PID of the next thread           |
+ * | `pktbuf_alloc` | requested size                   |
+ * | `ztimer_set`   | timer value                      |
+ *
+ * Without the `tracepoint` module, @ref TRACEPOINT() expands to nothing.
+ *
+ * @{
+ *
+ * @file
+ * @brief       Tracepoint API
+ */
+
+#ifndef TRACEPOINT_H
+#define TRACEPOINT_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "kernel_defines.h"
+
+#if IS_USED(MODULE_TRACEPOINT)
+#include "xfa.h"
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Tracepoint
+ */
+typedef struct {
+    const char *name;           /**< name of the tracepoint */
+    uint32_t hits;              /**< number of hits while enabled */
+    uint8_t enabled;            /**< non-zero if enabled */
+} tracepoint_t;
+
+#if IS_USED(MODULE_TRACEPOINT) || defined(DOXYGEN)
+/**
+ * @brief   Place a tracepoint
+ *
+ * Tracepoints of the same name, e.g. in a static inline function, are listed
+ * separately but enabled together.
+ *
+ * @param[in]   name    name of the tracepoint, an identifier
+ * @param[in]   val     value passed to the trace backend, only evaluated while
+ *                      the tracepoint is enabled
+ */
+#define TRACEPOINT(name, val) do {                                  \
+        XFA(tracepoint_xfa, 0) static tracepoint_t _tp_ ## name =   \
+            { #name, 0, 0 };                                        \
+        if (__builtin_expect(_tp_ ## name.enabled, 0)) {            \
+            tracepoint_hit(&_tp_ ## name, (val));                   \
+        }                                                           \
+    } while (0)
+#else
+#define TRACEPOINT(name, val) do { } while (0)
+#endif
+
+/**
+ * @brief   Record a hit of an enabled tracepoint
+ *
+ * Use @ref TRACEPOINT() instead.
+ *
+ * @param[in]   tp      tracepoint
+ * @param[in]   val     value passed to the trace backend
+ */
+void tracepoint_hit(tracepoint_t *tp, uint32_t val);
+
+/**
+ * @brief   Enable or disable tracepoints by name
+ *
+ * @param[in]   name    name of the tracepoints, NULL for all
+ * @param[in]   enable  true to enable, false to disable
+ *
+ * @return  number of tracepoints changed
+ */
+unsigned tracepoint_enable(const char *name, bool enable);
+
+/**
+ * @brief   Get the number of tracepoints
+ *
+ * @return  number of tracepoints
+ */
+unsigned tracepoint_numof(void);
+
+/**
+ * @brief   Get a tracepoint by index
+ *
+ * @param[in]   idx     index of the tracepoint
+ *
+ * @return  the tracepoint, NULL if @p idx is out of range
+ */
+const tracepoint_t *tracepoint_get(unsigned idx);
+
+/**
+ * @brief   Clear the hit counters of all tracepoints
+ */
+void tracepoint_reset(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TRACEPOINT_H */
+/** @} */
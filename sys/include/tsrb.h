@@ -14,6 +14,13 @@
  *
  * @attention   Buffer size must be a power of two!
  *
+ * Besides copying data in and out, the buffer can be accessed in place with
+ * @ref tsrb_get_write_region() / @ref tsrb_commit() for the producer and
+ * @ref tsrb_peek_region() / @ref tsrb_consume() for the consumer, e.g. to
+ * let a DMA fill or drain the buffer. As the data may wrap around at the end
+ * of the buffer, each of them yields up to two contiguous regions. This is
+ * only safe with a single producer and a single consumer.
+ *
  * @file
  * @brief       Thread-safe ringbuffer interface definition
  *
@@ -43,6 +50,14 @@ typedef struct tsrb {
     unsigned writes;            /**< total number of writes */
 } tsrb_t;
 
+/**
+ * @brief     contiguous region of a ringbuffer
+ */
+typedef struct {
+    uint8_t *buf;               /**< Start of the region */
+    size_t len;                 /**< Length of the region in bytes */
+} tsrb_region_t;
+
 /**
  * @brief Static initializer
  */
@@ -192,6 +207,54 @@ int tsrb_add_one(tsrb_t *rb, uint8_t c);
  */
 int tsrb_add(tsrb_t *rb, const uint8_t *src, size_t n);
 
+/**
+ * @brief       Get the free space of the ringbuffer for writing in place
+ *
+ * @p regions[0] starts at the write position, @p regions[1] at the start of
+ * the buffer if the free space wraps around, otherwise its length is 0.
+ * Written bytes are added to the ringbuffer with @ref tsrb_commit().
+ *
+ * @param[in]   rb      Ringbuffer to operate on
+ * @param[out]  regions free regions in order
+ * @return      total length of @p regions in bytes
+ */
+size_t tsrb_get_write_region(tsrb_t *rb, tsrb_region_t regions[2]);
+
+/**
+ * @brief       Add bytes written in place to the ringbuffer
+ *
+ * @pre         @p n is not larger than the space returned by the last call
+ *              to @ref tsrb_get_write_region()
+ *
+ * @param[in]   rb  Ringbuffer to operate on
+ * @param[in]   n   number of bytes written into the free regions
+ */
+void tsrb_commit(tsrb_t *rb, size_t n);
+
+/**
+ * @brief       Get the bytes in the ringbuffer for reading in place
+ *
+ * @p regions[0] starts at the read position, @p regions[1] at the start of
+ * the buffer if the data wraps around, otherwise its length is 0. Read bytes
+ * are removed from the ringbuffer with @ref tsrb_consume().
+ *
+ * @param[in]   rb      Ringbuffer to operate on
+ * @param[out]  regions regions holding data in order
+ * @return      total length of @p regions in bytes
+ */
+size_t tsrb_peek_region(tsrb_t *rb, tsrb_region_t regions[2]);
+
+/**
+ * @brief       Remove bytes read in place from the ringbuffer
+ *
+ * @pre         @p n is not larger than the data returned by the last call
+ *              to @ref tsrb_peek_region()
+ *
+ * @param[in]   rb  Ringbuffer to operate on
+ * @param[in]   n   number of bytes to remove
+ */
+void tsrb_consume(tsrb_t *rb, size_t n);
+
 #ifdef __cplusplus
 }
 #endif
@@ -68,6 +68,8 @@ extern "C" {
 #define USB_CDC_PROTOCOL_3GPP          0x05 /**< AT Commands defined by 3GPP 27.007 */
 #define USB_CDC_PROTOCOL_CS            0x06 /**< AT Commands defined by TIA for CDMA */
 #define USB_CDC_PROTOCOL_EEM           0x07 /**< Ethernet Emulation Model */
+#define USB_CDC_PROTOCOL_NCM_NTB       0x01 /**< Network Transfer Block, for
+                                                 NCM data interfaces */
 #define USB_CDC_PROTOCOL_EXT           0xFE /**< External Protocol */
 #define USB_CDC_PROTOCOL_VENDOR        0xFF /**< Vendor-specific */
 /** @} */
@@ -84,6 +86,7 @@ extern "C" {
                                                       management descriptor */
 #define USB_CDC_DESCR_SUBTYPE_UNION         0x06 /**< Union descriptor */
 #define USB_CDC_DESCR_SUBTYPE_ETH_NET       0x0f /**< Ethernet descriptor */
+#define USB_CDC_DESCR_SUBTYPE_NCM           0x1a /**< NCM descriptor */
 /** @} */
 
 /**
@@ -130,6 +133,31 @@ extern "C" {
  * @brief Get ethernet statistics
  */
 #define USB_CDC_MGNT_REQUEST_GET_ETH_STATISTICS         0x44
+
+/**
+ * @brief Get the NTB parameters of an NCM function
+ */
+#define USB_CDC_MGNT_REQUEST_GET_NTB_PARAMETERS         0x80
+
+/**
+ * @brief Get the current NTB format of an NCM function
+ */
+#define USB_CDC_MGNT_REQUEST_GET_NTB_FORMAT             0x83
+
+/**
+ * @brief Select the NTB format of an NCM function
+ */
+#define USB_CDC_MGNT_REQUEST_SET_NTB_FORMAT             0x84
+
+/**
+ * @brief Get the maximum size of NTBs sent to the host
+ */
+#define USB_CDC_MGNT_REQUEST_GET_NTB_INPUT_SIZE         0x85
+
+/**
+ * @brief Set the maximum size of NTBs sent to the host
+ */
+#define USB_CDC_MGNT_REQUEST_SET_NTB_INPUT_SIZE         0x86
 /** @} */
 
 /**
@@ -270,6 +298,83 @@ typedef struct __attribute__((packed)) {
     uint32_t up;        /**< Uplink bit rate */
 } usb_desc_cdcecm_speed_t;
 
+/**
+ * @brief USB CDC NCM functional descriptor
+ *
+ * @see USB CDC NCM 1.0 spec table 5-2
+ */
+typedef struct __attribute__((packed)) {
+    uint8_t length;         /**< Size of this descriptor */
+    uint8_t type;           /**< Descriptor type (@ref USB_TYPE_DESCRIPTOR_CDC) */
+    uint8_t subtype;        /**< Descriptor subtype (@ref USB_CDC_DESCR_SUBTYPE_NCM) */
+    uint16_t bcd_ncm;       /**< NCM release number in bcd (0x0100) */
+    uint8_t capabilities;   /**< Bitmap indicating the supported requests */
+} usb_desc_ncm_t;
+
+/**
+ * @name USB CDC NCM Network Transfer Blocks
+ * @{
+ */
+#define USB_CDC_NCM_NTH16_SIGNATURE     0x484d434e  /**< "NCMH" */
+#define USB_CDC_NCM_NDP16_SIGNATURE     0x304d434e  /**< "NCM0", without CRC */
+#define USB_CDC_NCM_NTB16_FORMAT        0x0001      /**< 16 bit NTB format bit */
+
+/**
+ * @brief NTB parameter structure, response to
+ *        @ref USB_CDC_MGNT_REQUEST_GET_NTB_PARAMETERS
+ *
+ * @see USB CDC NCM 1.0 spec table 6-3
+ */
+typedef struct __attribute__((packed)) {
+    uint16_t length;            /**< Size of this structure */
+    uint16_t formats;           /**< Supported NTB formats */
+    uint32_t in_max_size;       /**< Max size of NTBs to the host */
+    uint16_t in_divisor;        /**< Alignment divisor of datagrams to the host */
+    uint16_t in_remainder;      /**< Alignment remainder of datagrams to the host */
+    uint16_t in_alignment;      /**< Alignment of NDPs to the host */
+    uint16_t reserved;          /**< Reserved, 0 */
+    uint32_t out_max_size;      /**< Max size of NTBs from the host */
+    uint16_t out_divisor;       /**< Alignment divisor of datagrams from the host */
+    uint16_t out_remainder;     /**< Alignment remainder of datagrams from the host */
+    uint16_t out_alignment;     /**< Alignment of NDPs from the host */
+    uint16_t out_max_datagrams; /**< Max datagrams per NTB from the host, 0 for
+                                     no limit */
+} usb_cdc_ncm_ntb_params_t;
+
+/**
+ * @brief 16 bit NTB transfer header
+ *
+ * @see USB CDC NCM 1.0 spec table 3-1
+ */
+typedef struct __attribute__((packed)) {
+    uint32_t signature;     /**< @ref USB_CDC_NCM_NTH16_SIGNATURE */
+    uint16_t length;        /**< Size of this header */
+    uint16_t sequence;      /**< Sequence number of the NTB */
+    uint16_t block_length;  /**< Size of the NTB */
+    uint16_t ndp_index;     /**< Offset of the first NDP in the NTB */
+} usb_cdc_ncm_nth16_t;
+
+/**
+ * @brief 16 bit datagram pointer entry
+ */
+typedef struct __attribute__((packed)) {
+    uint16_t index;         /**< Offset of the datagram in the NTB, 0 at the end */
+    uint16_t length;        /**< Size of the datagram, 0 at the end */
+} usb_cdc_ncm_dpe16_t;
+
+/**
+ * @brief 16 bit datagram pointer table header, followed by the
+ *        @ref usb_cdc_ncm_dpe16_t entries
+ *
+ * @see USB CDC NCM 1.0 spec table 3-3
+ */
+typedef struct __attribute__((packed)) {
+    uint32_t signature;     /**< @ref USB_CDC_NCM_NDP16_SIGNATURE */
+    uint16_t length;        /**< Size of the NDP including all entries */
+    uint16_t next_ndp_index;/**< Offset of the next NDP in the NTB, 0 if none */
+} usb_cdc_ncm_ndp16_t;
+/** @} */
+
 /**
  * @name USB CDC ACM line coding setup defines
  * @{
@@ -96,6 +96,14 @@ typedef enum {
      */
     USBOPT_EP_AVAILABLE,
 
+    /**
+     * @brief   (usbopt_enable_t) Allow a second transfer to be queued
+     *
+     * See @ref drivers_periph_usbdev for the details. Drivers without support
+     * return -ENOTSUP when setting this option.
+     */
+    USBOPT_EP_DOUBLE_BUFFER,
+
     /* expand list if required */
 } usbopt_ep_t;
 
@@ -0,0 +1,212 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser General
+ * Public License v2.1. See the file LICENSE in the top level directory for
+ * more details.
+ */
+
+/**
+ * @defgroup    usbus_cdc_ncm USBUS CDC NCM - USBUS CDC network control model
+ * @ingroup     usb
+ * @brief       USBUS CDC NCM interface module
+ *
+ * CDC NCM transfers Ethernet frames in Network Transfer Blocks (NTBs), each of
+ * which can carry several frames. Compared to @ref usbus_cdc_ecm this reduces
+ * the per-frame overhead on both sides of the link:
+ *
+ * - The host can batch frames into a single bulk transfer. All frames of an
+ *   NTB are passed to the network stack in one go.
+ * - Two NTB buffers are used per direction. The next NTB is received while the
+ *   frames of the previous one are passed to the network stack, and frames are
+ *   added to the next NTB while the previous one is transmitted.
+ * - Frames are sent immediately when the IN endpoint is idle, otherwise they
+ *   are collected in the next NTB, so batching adapts to the load.
+ * - The USB packets of an NTB are chained in the USBUS thread, the network
+ *   stack only gets involved once per NTB. If the peripheral driver supports
+ *   @ref USBOPT_EP_DOUBLE_BUFFER, the next packet is queued while the current
+ *   one is transmitted.
+ *
+ * Only 16 bit NTBs without CRC are supported, which every host has to support.
+ *
+ * @{
+ *
+ * @file
+ * @brief       Interface and definitions for USB CDC NCM type interfaces
+ */
+
+#ifndef USB_USBUS_CDC_NCM_H
+#define USB_USBUS_CDC_NCM_H
+
+#include <stdint.h>
+#include <stdlib.h>
+#include "net/ethernet.h"
+#include "net/ethernet/hdr.h"
+#include "usb/cdc.h"
+#include "usb/descriptor.h"
+#include "usb/usbus.h"
+#include "usb/usbus/control.h"
+#include "net/netdev.h"
+#include "mutex.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Link throughput as reported by the peripheral
+ *
+ * This defines a common up and down link throughput in bits/second. The USB
+ * peripheral will report this to the host. This doesn't affect the actual
+ * throughput, only what the peripheral reports to the host.
+ */
+#ifndef CONFIG_USBUS_CDC_NCM_CONFIG_SPEED
+#define CONFIG_USBUS_CDC_NCM_CONFIG_SPEED  12000000
+#endif
+
+/**
+ * @brief Size of an NTB buffer in bytes
+ *
+ * Two buffers of this size are used for each direction. Hosts expect at least
+ * 2048 bytes.
+ */
+#ifndef CONFIG_USBUS_CDC_NCM_NTB_SIZE
+#define CONFIG_USBUS_CDC_NCM_NTB_SIZE  2048
+#endif
+
+/**
+ * @brief Maximum number of frames in an NTB sent to the host
+ */
+#ifndef CONFIG_USBUS_CDC_NCM_TX_DATAGRAMS
+#define CONFIG_USBUS_CDC_NCM_TX_DATAGRAMS  8
+#endif
+
+/**
+ * @brief CDC NCM interrupt endpoint size.
+ *
+ * Used by the device to report events to the host.
+ *
+ * @note Must be at least 16B to allow for reporting the link throughput
+ */
+#define USBUS_CDCNCM_EP_CTRL_SIZE  16
+
+/**
+ * @brief CDC NCM bulk data endpoint size.
+ */
+#define USBUS_CDCNCM_EP_DATA_SIZE  64
+
+/**
+ * @brief Space reserved for the transfer header and the datagram pointer table
+ *        at the start of an NTB sent to the host
+ */
+#define USBUS_CDCNCM_TX_HEADER_LEN (sizeof(usb_cdc_ncm_nth16_t) + \
+                                    sizeof(usb_cdc_ncm_ndp16_t) + \
+                                    (CONFIG_USBUS_CDC_NCM_TX_DATAGRAMS + 1) * \
+                                    sizeof(usb_cdc_ncm_dpe16_t))
+
+/**
+ * @brief notification state, used to track which information must be send to
+ * the host
+ */
+typedef enum {
+    USBUS_CDCNCM_NOTIF_NONE,    /**< Nothing notified so far */
+    USBUS_CDCNCM_NOTIF_LINK_UP, /**< Link status is notified */
+    USBUS_CDCNCM_NOTIF_SPEED,   /**< Link speed is notified */
+} usbus_cdcncm_notif_t;
+
+/**
+ * @brief State of an NTB buffer received from the host
+ */
+typedef enum {
+    USBUS_CDCNCM_RX_EMPTY,      /**< Free to receive the next NTB */
+    USBUS_CDCNCM_RX_RECEIVING,  /**< NTB is being received */
+    USBUS_CDCNCM_RX_FULL,       /**< NTB is complete, frames are processed */
+} usbus_cdcncm_rx_state_t;
+
+/**
+ * @brief NTB buffer received from the host
+ */
+typedef struct {
+    /**
+     * @brief NTB data
+     */
+    usbdev_ep_buf_t data[CONFIG_USBUS_CDC_NCM_NTB_SIZE];
+    size_t len;                             /**< Bytes received */
+    volatile uint8_t state;                 /**< @ref usbus_cdcncm_rx_state_t */
+} usbus_cdcncm_rx_ntb_t;
+
+/**
+ * @brief NTB buffer sent to the host
+ */
+typedef struct {
+    /**
+     * @brief NTB data
+     */
+    usbdev_ep_buf_t data[CONFIG_USBUS_CDC_NCM_NTB_SIZE];
+    size_t len;                             /**< Size of the NTB */
+    unsigned datagrams;                     /**< Number of frames in the NTB */
+} usbus_cdcncm_tx_ntb_t;
+
+/**
+ * @brief USBUS CDC NCM device interface context
+ */
+typedef struct usbus_cdcncm_device {
+    usbus_handler_t handler_ctrl;           /**< Control interface handler */
+    usbus_interface_t iface_data;           /**< Data interface */
+    usbus_interface_t iface_ctrl;           /**< Control interface */
+    usbus_interface_alt_t iface_data_alt;   /**< Data alternative (active) interface */
+    usbus_endpoint_t *ep_in;                /**< Data endpoint in */
+    usbus_endpoint_t *ep_out;               /**< Data endpoint out */
+    usbus_endpoint_t *ep_ctrl;              /**< Control endpoint */
+    usbus_descr_gen_t ncm_descr;            /**< NCM descriptor generator */
+    event_t rx_ready;                       /**< NTB buffer released event */
+    event_t tx_xmit;                        /**< Transmit NTB event */
+    netdev_t netdev;                        /**< Netdev context struct */
+    uint8_t mac_netdev[ETHERNET_ADDR_LEN];  /**< this device's MAC address */
+    char mac_host[13];                      /**< host side's MAC address as string */
+    usbus_string_t mac_str;                 /**< String context for the host side mac address */
+    usbus_t *usbus;                         /**< Ptr to the USBUS context */
+    /**
+     * @brief Locked while an NTB is sent to the host
+     */
+    mutex_t tx_busy;
+    uint32_t ntb_in_max;                    /**< Max NTB size set by the host */
+    usbus_cdcncm_notif_t notif;             /**< Startup message notification tracker */
+    unsigned active_iface;                  /**< Current active data interface */
+
+    uint8_t rx_usb;                         /**< Buffer receiving from USB */
+    uint8_t rx_net;                         /**< Buffer processed by netdev */
+    uint16_t rx_index;                      /**< Offset of the current frame */
+    uint16_t rx_len;                        /**< Length of the current frame */
+    bool rx_stalled;                        /**< No buffer was free to receive */
+
+    uint8_t tx_fill;                        /**< Buffer frames are added to */
+    uint16_t tx_seq;                        /**< Sequence number of the next NTB */
+    size_t tx_offset;                       /**< Bytes of the NTB sent */
+    bool tx_zlp;                            /**< Zero length packet was sent */
+    uint8_t tx_pending;                     /**< USB packets submitted */
+    uint8_t tx_depth;                       /**< Max USB packets submitted at once */
+
+    usbus_cdcncm_rx_ntb_t rx[2];            /**< NTBs received from the host */
+    usbus_cdcncm_tx_ntb_t tx[2];            /**< NTBs sent to the host */
+
+    /**
+     * @brief Host out device in control buffer
+     */
+    usbdev_ep_buf_t control_in[USBUS_CDCNCM_EP_CTRL_SIZE];
+} usbus_cdcncm_device_t;
+
+/**
+ * @brief CDC NCM initialization function
+ *
+ * @param   usbus   USBUS thread to use
+ * @param   handler CDCNCM device struct
+ */
+void usbus_cdcncm_init(usbus_t *usbus, usbus_cdcncm_device_t *handler);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* USB_USBUS_CDC_NCM_H */
+/** @} */
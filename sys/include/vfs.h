@@ -181,6 +181,18 @@ extern "C" {
 #define VFS_MAX_OPEN_FILES (16)
 #endif
 
+#ifndef VFS_MOUNT_BUCKETS
+/**
+ * @brief Number of hash buckets to look up mount points
+ *
+ * Path lookups probe one bucket per leading path component of the path
+ * instead of comparing the path with every mount point.
+ *
+ * @note Must be a power of two.
+ */
+#define VFS_MOUNT_BUCKETS (8)
+#endif
+
 #ifndef VFS_DIR_BUFFER_SIZE
 /**
  * @brief Size of buffer space in vfs_DIR
@@ -311,6 +323,16 @@ typedef struct vfs_file_system_ops vfs_file_system_ops_t;
 /* not struct vfs_mount because of name collision with the function */
 typedef struct vfs_mount_struct vfs_mount_t;
 
+/**
+ * @brief Access pattern hints for @ref vfs_fadvise
+ */
+typedef enum {
+    VFS_FADV_NORMAL,        /**< no particular access pattern */
+    VFS_FADV_SEQUENTIAL,    /**< file is read from start to end */
+    VFS_FADV_RANDOM,        /**< file is read at random positions */
+    VFS_FADV_WILLNEED,      /**< data at the current position is needed soon */
+} vfs_fadvise_t;
+
 /**
  * @brief   MTD driver for VFS
  */
@@ -333,6 +355,8 @@ struct vfs_mount_struct {
     const vfs_file_system_t *fs; /**< The file system driver for the mount point */
     const char *mount_point;     /**< Mount point, e.g. "/mnt/cdrom" */
     size_t mount_point_len;      /**< Length of mount_point string (set by vfs_mount) */
+    vfs_mount_t *hash_next;      /**< Next mount point in the same lookup bucket
+                                  *   (set by vfs_mount) */
     atomic_int open_files;       /**< Number of currently open files and directories */
     void *private_data;          /**< File system driver private data, implementation defined */
 };
@@ -516,6 +540,36 @@ struct vfs_file_ops {
      * @return <0 on error
      */
     int (*fsync) (vfs_file_t *filp);
+
+    /**
+     * @brief Get a pointer to the contents of an open file
+     *
+     * Only file systems that keep their files in memory mapped storage
+     * implement this, so the contents can be passed on without copying them.
+     * The file position is advanced by the number of bytes returned.
+     *
+     * @param[in]  filp     pointer to open file
+     * @param[out] data     contents of the file at the current position
+     * @param[in]  nbytes   maximum number of bytes to read
+     *
+     * @return number of bytes available at @p data on success
+     * @return <0 on error
+     */
+    ssize_t (*read_ptr) (vfs_file_t *filp, const void **data, size_t nbytes);
+
+    /**
+     * @brief Announce the access pattern of an open file
+     *
+     * File systems may use this to read ahead or to stop doing so. The hint
+     * must not change the results of any operation on the file.
+     *
+     * @param[in]  filp     pointer to open file
+     * @param[in]  advice   expected access pattern
+     *
+     * @return 0 on success
+     * @return <0 on error
+     */
+    int (*fadvise) (vfs_file_t *filp, vfs_fadvise_t advice);
 };
 
 /**
@@ -799,6 +853,47 @@ int vfs_open(const char *name, int flags, mode_t mode);
  */
 ssize_t vfs_read(int fd, void *dest, size_t count);
 
+/**
+ * @brief Read bytes from an open file without copying them
+ *
+ * Instead of copying the contents of the file to a buffer, @p data is set to
+ * point to them, e.g. to send files kept in flash directly from there. The
+ * contents must not be written to and are only valid as long as the file is
+ * open.
+ *
+ * This is only supported by file systems that keep their files in memory
+ * mapped storage, e.g. @ref constfs. For other file systems, fall back to
+ * @ref vfs_read.
+ *
+ * @param[in]  fd       fd number obtained from vfs_open
+ * @param[out] data     contents of the file at the current position
+ * @param[in]  count    maximum number of bytes to read
+ *
+ * @return number of bytes available at @p data on success
+ * @return -ENOTSUP if the file system or the file does not support this,
+ *         e.g. a compressed file
+ * @return <0 on other errors
+ */
+ssize_t vfs_read_ptr(int fd, const void **data, size_t count);
+
+/**
+ * @brief Announce the access pattern of an open file
+ *
+ * This is a hint only, similar to posix_fadvise(). File systems that keep a
+ * read-ahead buffer fill it with larger reads from the storage device after
+ * @ref VFS_FADV_SEQUENTIAL or @ref VFS_FADV_WILLNEED, so many small
+ * @ref vfs_read calls are served from RAM. File systems that do not support
+ * this ignore the hint.
+ *
+ * @param[in]  fd       fd number obtained from vfs_open
+ * @param[in]  advice   expected access pattern
+ *
+ * @return 0 on success
+ * @return -EINVAL if @p advice is unknown
+ * @return <0 on other errors
+ */
+int vfs_fadvise(int fd, vfs_fadvise_t advice);
+
 /**
  * @brief Write bytes to an open file
  *
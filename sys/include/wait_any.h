@@ -0,0 +1,120 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    sys_wait_any Wait on multiple sources
+ * @ingroup     sys
+ * @brief       Block until one of several sources is ready or a timeout
+ *              expires
+ *
+ * A thread passes an array of sources to @ref wait_any(), which fetches from
+ * the first ready source and returns its index. While no source is ready, the
+ * thread sleeps on the thread flags the sources set when they become ready:
+ *
+ * - @ref WAIT_ANY_MSG: the thread's message queue (@ref THREAD_FLAG_MSG_WAITING)
+ * - @ref WAIT_ANY_MBOX: a mailbox (@ref THREAD_FLAG_MBOX)
+ * - @ref WAIT_ANY_EVENT: an event queue bound to the thread
+ *   (@ref THREAD_FLAG_EVENT), this also covers socks using `sock_async_event`
+ *
+ * A timeout is implemented with @ref ztimer_set_timeout_flag().
+ *
+ * Example handling both messages and events:
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~ {.c}
+ * wait_any_src_t srcs[] = {
+ *     { .type = WAIT_ANY_EVENT, .queue = &queue },
+ *     { .type = WAIT_ANY_MSG },
+ * };
+ *
+ * while (1) {
+ *     switch (wait_any(srcs, ARRAY_SIZE(srcs), NULL, 0)) {
+ *     case 0:
+ *         srcs[0].event->handler(srcs[0].event);
+ *         break;
+ *     case 1:
+ *         handle_msg(&srcs[1].msg);
+ *         break;
+ *     }
+ * }
+ * ~~~~~~~~~~~~~~~~~~~~~~~~
+ *
+ * @{
+ *
+ * @file
+ * @brief       Wait on multiple sources definitions
+ */
+
+#ifndef WAIT_ANY_H
+#define WAIT_ANY_H
+
+#include <stdint.h>
+
+#include "event.h"
+#include "mbox.h"
+#include "msg.h"
+#include "ztimer.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Type of a source
+ */
+typedef enum {
+    WAIT_ANY_MSG,           /**< message queue of the calling thread */
+    WAIT_ANY_MBOX,          /**< mailbox */
+    WAIT_ANY_EVENT,         /**< event queue */
+} wait_any_type_t;
+
+/**
+ * @brief   Source to wait on
+ */
+typedef struct {
+    wait_any_type_t type;   /**< type of the source */
+    union {
+        mbox_t *mbox;           /**< mailbox of @ref WAIT_ANY_MBOX */
+        event_queue_t *queue;   /**< event queue of @ref WAIT_ANY_EVENT */
+    };
+    union {
+        msg_t msg;              /**< received message of @ref WAIT_ANY_MSG
+                                 *   and @ref WAIT_ANY_MBOX */
+        event_t *event;         /**< received event of @ref WAIT_ANY_EVENT */
+    };
+} wait_any_src_t;
+
+/**
+ * @brief   Waits until one of the sources is ready and fetches from it
+ *
+ * If several sources are ready, the one with the lowest index is chosen.
+ * Exactly one message or event is fetched per call, it is stored in the
+ * source returned.
+ *
+ * @pre     The calling thread has a message queue for @ref WAIT_ANY_MSG
+ * @pre     Mailboxes of @ref WAIT_ANY_MBOX have a queue and are not waited on
+ *          by another thread with @ref wait_any()
+ * @pre     Event queues of @ref WAIT_ANY_EVENT are bound to the calling thread
+ *          or to no thread, in which case they are bound to it
+ *
+ * @param[in,out] srcs      sources to wait on
+ * @param[in]   numof       number of entries in @p srcs
+ * @param[in]   clock       clock of the timeout, NULL to wait forever
+ * @param[in]   timeout     timeout in ticks of @p clock
+ *
+ * @return  index of the source fetched from
+ * @return  -ETIMEDOUT if no source got ready before the timeout
+ */
+int wait_any(wait_any_src_t *srcs, unsigned numof, ztimer_clock_t *clock,
+             uint32_t timeout);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* WAIT_ANY_H */
+/** @} */
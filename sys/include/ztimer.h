@@ -157,6 +157,19 @@
  * to be shown whether the increased complexity would lead to better
  * performance for any reasonable amount of active timers.
  *
+ * For systems with many concurrently armed timers (e.g., border routers
+ * running several network protocols), the module `ztimer_heap` replaces the
+ * sorted list by a pairing heap:
+ *
+ * - two more pointers per timer object ("child" and "prev")
+ * - constant get_min() and insertion
+ * - amortized O(log n) removal of timer objects and of the expired head
+ *
+ * In that mode, each entry stores its absolute target time. The clock's base
+ * time (B) is only ever advanced up to the earliest target, so the distance
+ * of each target to B can be used to order the entries without suffering
+ * from wrap-around.
+ *
  *
  * ## Clock extension
  *
@@ -177,6 +190,19 @@
  * callbacks every (max_value / 2) ticks (even if no timeout is configured).
  *
  *
+ * ## Timer slack
+ *
+ * With the module `ztimer_slack`, every timer may be given a slack using
+ * @ref ztimer_set_slack(), i.e., an amount of ticks by which it may trigger
+ * late. When programming the underlying clock, ztimer then picks the latest
+ * point in time that still satisfies all timers in the current batch (the
+ * minimum of target + slack over all timers targeted before that point), so
+ * nearby timers get triggered from a single interrupt. Timers without slack
+ * (the default) keep triggering at their exact target.
+ *
+ * With `ztimer_heap`, only the earliest timer is considered when computing
+ * the batch, so slack is effectively ignored.
+ *
  * ## Reliability
  *
  * Care has been taken to avoid any unexpected behaviour of ztimer. In
@@ -297,8 +323,14 @@ typedef void (*ztimer_callback_t)(void *arg);
  * @brief   Minimum information for each timer
  */
 struct ztimer_base {
-    ztimer_base_t *next;        /**< next timer in list */
-    uint32_t offset;            /**< offset from last timer in list */
+    ztimer_base_t *next;        /**< next timer in list (or next sibling in
+                                     heap) */
+    uint32_t offset;            /**< offset from last timer in list (or
+                                     absolute target in heap) */
+#if MODULE_ZTIMER_HEAP || DOXYGEN
+    ztimer_base_t *child;       /**< first child in heap */
+    ztimer_base_t *prev;        /**< previous sibling or parent in heap */
+#endif
 };
 
 /**
@@ -333,6 +365,9 @@ typedef struct {
     ztimer_base_t base;             /**< clock list entry */
     ztimer_callback_t callback;     /**< timer callback function pointer */
     void *arg;                      /**< timer callback argument */
+#if MODULE_ZTIMER_SLACK || DOXYGEN
+    uint32_t slack;                 /**< ticks the timer may trigger late */
+#endif
 } ztimer_t;
 
 /**
@@ -367,7 +402,8 @@ typedef struct {
  * @brief   ztimer device structure
  */
 struct ztimer_clock {
-    ztimer_base_t list;             /**< list of active timers              */
+    ztimer_base_t list;             /**< list (or heap root) of active
+                                         timers                             */
     const ztimer_ops_t *ops;        /**< pointer to methods structure       */
     ztimer_base_t *last;            /**< last timer in queue, for _is_set() */
     uint16_t adjust_set;            /**< will be subtracted on every set()  */
@@ -411,6 +447,28 @@ void ztimer_handler(ztimer_clock_t *clock);
  */
 uint32_t ztimer_set(ztimer_clock_t *clock, ztimer_t *timer, uint32_t val);
 
+/**
+ * @brief   Set the slack of a timer
+ *
+ * The slack is the amount of ticks @p timer may trigger after its target,
+ * allowing ztimer to handle nearby timers within a single interrupt. It
+ * applies to all subsequent calls to @ref ztimer_set() for @p timer.
+ *
+ * @note    Only available with module `ztimer_slack`.
+ *
+ * @param[in]   timer       timer to configure
+ * @param[in]   slack       maximum delay of the trigger (in ticks)
+ */
+static inline void ztimer_set_slack(ztimer_t *timer, uint32_t slack)
+{
+#if MODULE_ZTIMER_SLACK
+    timer->slack = slack;
+#else
+    (void)timer;
+    (void)slack;
+#endif
+}
+
 /**
  * @brief   Check if a timer is currently active
  *
@@ -422,6 +480,20 @@ uint32_t ztimer_set(ztimer_clock_t *clock, ztimer_t *timer, uint32_t val);
  */
 unsigned ztimer_is_set(const ztimer_clock_t *clock, const ztimer_t *timer);
 
+/**
+ * @brief   Get the time until the next timer on a clock expires
+ *
+ * This is intended for idle time / power management decisions, e.g. to
+ * figure out whether a low power mode can be left in time.
+ *
+ * @param[in]   clock       ztimer clock to operate on
+ *
+ * @return  number of @p clock ticks until the earliest timer expires
+ * @return  0 if a timer already is overdue
+ * @return  UINT32_MAX if no timer is set on @p clock
+ */
+uint32_t ztimer_until_next(ztimer_clock_t *clock);
+
 /**
  * @brief   Remove a timer from a clock
  *
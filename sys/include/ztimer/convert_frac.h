@@ -18,6 +18,12 @@
  * inversions, avoiding integer divisions. frac trades accuracy for speed.
  * Please see the documentation of frac for more details.
  *
+ * If the lower clock runs at a power of two fraction of this clock, e.g.
+ * ZTIMER_USEC on a 32768 Hz or ZTIMER_MSEC on a 1024 Hz clock, now() is
+ * computed exactly with 32 bit multiplications only. On cores without a
+ * 32x32->64 bit multiplication (e.g. cortex-m0), frac is computed from 16 bit
+ * partial products instead of calling into the runtime library.
+ *
  * @{
  * @file
  * @brief   ztimer_convert_frac interface definitions
@@ -60,6 +66,16 @@ typedef struct {
      * E.g., 1000000/32768== ~30.5. `round` will be set to 30.
      */
     uint32_t round;
+    /**
+     * @brief   Numerator of the conversion from lower to self, if its
+     *          denominator is a power of two, otherwise 0
+     */
+    uint32_t now_num;
+    /**
+     * @brief   Binary logarithm of the denominator of the conversion from
+     *          lower to self, if `now_num` is set
+     */
+    uint8_t now_shift;
 } ztimer_convert_frac_t;
 
 /**
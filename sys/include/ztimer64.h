@@ -48,6 +48,16 @@
  *          timer (e.g., periph_rtt). ztimer64_usec will almost certainly block
  *          low-power sleep.
  *
+ * ## Native 64bit counters
+ *
+ * If the hardware counter behind the base clock is 64bit wide, the clock can
+ * be initialized with @ref ztimer64_clock_init_native(). ztimer64_now() then
+ * reads that counter directly instead of extending the base clock, and the
+ * base clock is only used while timers are set.
+ * ZTIMER64_USEC does so automatically if ZTIMER_USEC runs unconverted on a
+ * periph_timer providing `periph_timer_read64` (e.g., esp32, rpx0xx and
+ * native).
+ *
  * TODO:
  *  - some explicit power management
  *  - implement adjust_set and adjust_sleep API
@@ -84,6 +94,13 @@ typedef struct ztimer64_base ztimer64_base_t;
  */
 typedef struct ztimer64_clock ztimer64_clock_t;
 
+/**
+ * @brief   Reads a native 64bit counter
+ *
+ * @return  current count, running at the rate of the base clock
+ */
+typedef uint64_t (*ztimer64_native_now_t)(void);
+
 /**
  * @brief   Minimum information for each timer
  */
@@ -112,6 +129,7 @@ struct ztimer64_clock {
     ztimer_clock_t *base_clock;     /**< 32bit clock backend                */
     ztimer_t base_timer;            /**< 32bit backend timer                */
     uint64_t checkpoint;            /**< lower timer checkpoint offset      */
+    ztimer64_native_now_t native_now;   /**< native 64bit counter, or NULL  */
     uint16_t adjust_set;            /**< will be subtracted on every set()  */
     uint16_t adjust_sleep;          /**< will be subtracted on every sleep(),
                                          in addition to adjust_set          */
@@ -498,6 +516,20 @@ void ztimer64_init(void);
  */
 void ztimer64_clock_init(ztimer64_clock_t *clock, ztimer_clock_t *base_clock);
 
+/**
+ * @brief           Initialize @p clock to read a native 64bit counter
+ *
+ * @p base_clock is only used to set timers, so @p now must count at the same
+ * rate. It must never be stopped or reset.
+ *
+ * @param[in,out]   clock       Clock to initialize
+ * @param[in]       base_clock  Base clock to use for timers
+ * @param[in]       now         Reads the 64bit counter
+ */
+void ztimer64_clock_init_native(ztimer64_clock_t *clock,
+                                ztimer_clock_t *base_clock,
+                                ztimer64_native_now_t now);
+
 /* default ztimer virtual devices */
 /**
  * @brief   Default ztimer microsecond clock
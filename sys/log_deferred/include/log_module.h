@@ -0,0 +1,280 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    sys_log_deferred log_deferred: binary log formatted on the host
+ * @ingroup     sys
+ * @brief       Logging module that leaves formatting to the host
+ *
+ * `LOG_*()` calls do not format anything on the target. The format string is
+ * placed into the `.logstr` section, the call only stores the address of the
+ * string, the log level and the raw arguments as a record into a ring buffer.
+ * A thread of the lowest priority writes the records to stdio when the system
+ * is idle. `dist/tools/log_deferred/log_deferred.py` reads the format strings
+ * from the ELF file and prints the messages, passing other output through:
+ *
+ * ```
+ * make term | dist/tools/log_deferred/log_deferred.py bin/<board>/<app>.elf
+ * ```
+ *
+ * Linker scripts that mark `.logstr` as `INFO` section, as the Cortex-M one
+ * does, keep the format strings out of the firmware image.
+ *
+ * Constraints:
+ * - the format string must be a string literal
+ * - at most @ref LOG_DEFERRED_ARGS_MAX arguments per call
+ * - arguments of type `char *` are copied as strings of at most
+ *   @ref CONFIG_LOG_DEFERRED_STR_MAX bytes, other pointers must be cast to
+ *   `void *`
+ * - records are dropped while the ring buffer is full, the number of dropped
+ *   records is reported
+ * - only `LOG_*()` is deferred, output of `printf()` is passed through by
+ *   the decoder
+ *
+ * @{
+ *
+ * @file
+ * @brief       log_module header
+ */
+
+#ifndef LOG_MODULE_H
+#define LOG_MODULE_H
+
+#include <stdint.h>
+
+#include "kernel_defines.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Size of the ring buffer in bytes, must be a power of two
+ */
+#ifndef CONFIG_LOG_DEFERRED_BUF_SIZE
+#define CONFIG_LOG_DEFERRED_BUF_SIZE    512
+#endif
+
+/**
+ * @brief   Maximum number of bytes copied of a string argument
+ */
+#ifndef CONFIG_LOG_DEFERRED_STR_MAX
+#define CONFIG_LOG_DEFERRED_STR_MAX     16
+#endif
+
+/**
+ * @brief   Maximum number of arguments of a log call
+ */
+#define LOG_DEFERRED_ARGS_MAX           8
+
+/**
+ * @brief   Start of a record in the output
+ */
+#define LOG_DEFERRED_SYNC               (0x1e)
+
+/**
+ * @name    Types of the arguments in a record
+ * @{
+ */
+#define LOG_DEFERRED_ARG_U32            (1U)    /**< 32 bit integer */
+#define LOG_DEFERRED_ARG_U64            (2U)    /**< 64 bit integer */
+#define LOG_DEFERRED_ARG_DOUBLE         (3U)    /**< double */
+#define LOG_DEFERRED_ARG_STR            (4U)    /**< string, length first */
+/** @} */
+
+/**
+ * @brief   Argument of a log call
+ */
+typedef struct {
+    uint8_t type;               /**< type of the argument */
+    union {
+        uint32_t u32;           /**< @ref LOG_DEFERRED_ARG_U32 */
+        uint64_t u64;           /**< @ref LOG_DEFERRED_ARG_U64 */
+        double d;               /**< @ref LOG_DEFERRED_ARG_DOUBLE */
+        const char *s;          /**< @ref LOG_DEFERRED_ARG_STR */
+    };
+} log_deferred_arg_t;
+
+/**
+ * @brief   Stores a record into the ring buffer
+ *
+ * Use @ref LOG_DEFERRED instead.
+ *
+ * @param[in]   level   log level
+ * @param[in]   fmt     format string in the `.logstr` section
+ * @param[in]   args    arguments
+ * @param[in]   numof   number of arguments
+ */
+void log_deferred_write(unsigned level, const char *fmt,
+                        const log_deferred_arg_t *args, unsigned numof);
+
+/**
+ * @brief   Starts the thread writing the records to stdio
+ *
+ * Called by @ref sys_auto_init, records stored before are kept.
+ */
+void log_deferred_init(void);
+
+#ifndef DOXYGEN
+static inline log_deferred_arg_t _log_deferred_u32(uint32_t v)
+{
+    log_deferred_arg_t arg;
+    arg.type = LOG_DEFERRED_ARG_U32;
+    arg.u32 = v;
+    return arg;
+}
+
+static inline log_deferred_arg_t _log_deferred_u64(uint64_t v)
+{
+    log_deferred_arg_t arg;
+    arg.type = LOG_DEFERRED_ARG_U64;
+    arg.u64 = v;
+    return arg;
+}
+
+static inline log_deferred_arg_t _log_deferred_long(unsigned long v)
+{
+    return (sizeof(v) > sizeof(uint32_t)) ? _log_deferred_u64(v)
+                                          : _log_deferred_u32(v);
+}
+
+static inline log_deferred_arg_t _log_deferred_ptr(const void *v)
+{
+    return (sizeof(v) > sizeof(uint32_t)) ? _log_deferred_u64((uintptr_t)v)
+                                          : _log_deferred_u32((uintptr_t)v);
+}
+
+static inline log_deferred_arg_t _log_deferred_double(double v)
+{
+    log_deferred_arg_t arg;
+    arg.type = LOG_DEFERRED_ARG_DOUBLE;
+    arg.d = v;
+    return arg;
+}
+
+static inline log_deferred_arg_t _log_deferred_str(const char *v)
+{
+    log_deferred_arg_t arg;
+    arg.type = LOG_DEFERRED_ARG_STR;
+    arg.s = v;
+    return arg;
+}
+
+#ifdef __cplusplus
+/* log.h includes this header with C linkage */
+extern "C++" {
+template <typename T>
+static inline log_deferred_arg_t _log_deferred_arg(T v)
+{
+    return _log_deferred_u32(v);
+}
+static inline log_deferred_arg_t _log_deferred_arg(char *v)
+{
+    return _log_deferred_str(v);
+}
+static inline log_deferred_arg_t _log_deferred_arg(const char *v)
+{
+    return _log_deferred_str(v);
+}
+static inline log_deferred_arg_t _log_deferred_arg(void *v)
+{
+    return _log_deferred_ptr(v);
+}
+static inline log_deferred_arg_t _log_deferred_arg(const void *v)
+{
+    return _log_deferred_ptr(v);
+}
+static inline log_deferred_arg_t _log_deferred_arg(float v)
+{
+    return _log_deferred_double(v);
+}
+static inline log_deferred_arg_t _log_deferred_arg(double v)
+{
+    return _log_deferred_double(v);
+}
+static inline log_deferred_arg_t _log_deferred_arg(long v)
+{
+    return _log_deferred_long(v);
+}
+static inline log_deferred_arg_t _log_deferred_arg(unsigned long v)
+{
+    return _log_deferred_long(v);
+}
+static inline log_deferred_arg_t _log_deferred_arg(long long v)
+{
+    return _log_deferred_u64(v);
+}
+static inline log_deferred_arg_t _log_deferred_arg(unsigned long long v)
+{
+    return _log_deferred_u64(v);
+}
+}
+#define _LOG_DEFERRED_ARG(x) _log_deferred_arg(x)
+#else
+#define _LOG_DEFERRED_ARG(x) _Generic((x),                      \
+        char *: _log_deferred_str,                              \
+        const char *: _log_deferred_str,                        \
+        void *: _log_deferred_ptr,                              \
+        const void *: _log_deferred_ptr,                        \
+        float: _log_deferred_double,                            \
+        double: _log_deferred_double,                           \
+        long: _log_deferred_long,                               \
+        unsigned long: _log_deferred_long,                      \
+        long long: _log_deferred_u64,                           \
+        unsigned long long: _log_deferred_u64,                  \
+        default: _log_deferred_u32)(x)
+#endif
+
+/* the format string is passed along, so argument lists are never empty */
+#define _LOG_DEFERRED_FMT(fmt, ...) fmt
+#define _LOG_DEFERRED_MAP0(f)
+#define _LOG_DEFERRED_MAP1(f, a) , _LOG_DEFERRED_ARG(a)
+#define _LOG_DEFERRED_MAP2(f, a, ...) , _LOG_DEFERRED_ARG(a) _LOG_DEFERRED_MAP1(f, __VA_ARGS__)
+#define _LOG_DEFERRED_MAP3(f, a, ...) , _LOG_DEFERRED_ARG(a) _LOG_DEFERRED_MAP2(f, __VA_ARGS__)
+#define _LOG_DEFERRED_MAP4(f, a, ...) , _LOG_DEFERRED_ARG(a) _LOG_DEFERRED_MAP3(f, __VA_ARGS__)
+#define _LOG_DEFERRED_MAP5(f, a, ...) , _LOG_DEFERRED_ARG(a) _LOG_DEFERRED_MAP4(f, __VA_ARGS__)
+#define _LOG_DEFERRED_MAP6(f, a, ...) , _LOG_DEFERRED_ARG(a) _LOG_DEFERRED_MAP5(f, __VA_ARGS__)
+#define _LOG_DEFERRED_MAP7(f, a, ...) , _LOG_DEFERRED_ARG(a) _LOG_DEFERRED_MAP6(f, __VA_ARGS__)
+#define _LOG_DEFERRED_MAP8(f, a, ...) , _LOG_DEFERRED_ARG(a) _LOG_DEFERRED_MAP7(f, __VA_ARGS__)
+#define _LOG_DEFERRED_SELECT(f, _1, _2, _3, _4, _5, _6, _7, _8, name, ...) name
+#define _LOG_DEFERRED_MAP(...)                                          \
+    _LOG_DEFERRED_SELECT(__VA_ARGS__,                                   \
+                         _LOG_DEFERRED_MAP8, _LOG_DEFERRED_MAP7,        \
+                         _LOG_DEFERRED_MAP6, _LOG_DEFERRED_MAP5,        \
+                         _LOG_DEFERRED_MAP4, _LOG_DEFERRED_MAP3,        \
+                         _LOG_DEFERRED_MAP2, _LOG_DEFERRED_MAP1,        \
+                         _LOG_DEFERRED_MAP0, _)(__VA_ARGS__)
+#endif /* DOXYGEN */
+
+/**
+ * @brief   Stores a log record
+ *
+ * @param[in]   level   log level
+ * @param[in]   ...     format string, must be a string literal, followed by
+ *                      at most @ref LOG_DEFERRED_ARGS_MAX arguments
+ */
+#define LOG_DEFERRED(level, ...) do {                                       \
+        static const char _log_fmt[] __attribute__((section(".logstr"), used)) \
+            = "" _LOG_DEFERRED_FMT(__VA_ARGS__, 0);                         \
+        const log_deferred_arg_t _log_args[] = {                            \
+            { 0, { 0 } } _LOG_DEFERRED_MAP(__VA_ARGS__)                     \
+        };                                                                  \
+        log_deferred_write((level), _log_fmt, &_log_args[1],                \
+                           ARRAY_SIZE(_log_args) - 1);                      \
+    } while (0)
+
+/**
+ * @brief   log_write overridden function
+ */
+#define log_write(level, ...) LOG_DEFERRED(level, __VA_ARGS__)
+
+#ifdef __cplusplus
+}
+#endif
+/** @} */
+#endif /* LOG_MODULE_H */
@@ -0,0 +1,168 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_log_deferred
+ * @{
+ *
+ * @file
+ * @brief       Deferred binary log implementation
+ *
+ * A record is @ref LOG_DEFERRED_SYNC, the length of the rest of the record,
+ * the log level, the address of the format string and the arguments, each
+ * one its type followed by its value. All values are in host byte order.
+ * Level 0 reports the number of records dropped instead.
+ *
+ * @}
+ */
+
+#include <assert.h>
+#include <string.h>
+
+#include "irq.h"
+#include "log.h"
+#include "stdio_base.h"
+#include "thread.h"
+#include "thread_flags.h"
+#include "tsrb.h"
+
+#define THREAD_FLAG_LOG_DEFERRED    (1U << 0)
+
+/* sync and length are not counted in the length */
+#define RECORD_MAX  (2 + UINT8_MAX)
+
+static_assert(!(CONFIG_LOG_DEFERRED_BUF_SIZE & (CONFIG_LOG_DEFERRED_BUF_SIZE - 1)),
+              "CONFIG_LOG_DEFERRED_BUF_SIZE must be a power of two");
+
+static uint8_t _buf[CONFIG_LOG_DEFERRED_BUF_SIZE];
+static tsrb_t _rb = TSRB_INIT(_buf);
+static uint32_t _dropped;
+static thread_t *_thread;
+static char _stack[THREAD_STACKSIZE_SMALL];
+
+static size_t _put(uint8_t *rec, size_t pos, const void *data, size_t len)
+{
+    if (pos + len > RECORD_MAX) {
+        return RECORD_MAX + 1;
+    }
+    memcpy(&rec[pos], data, len);
+    return pos + len;
+}
+
+static bool _add(const uint8_t *rec, size_t len)
+{
+    bool added = false;
+    unsigned state = irq_disable();
+
+    if (tsrb_free(&_rb) >= len) {
+        tsrb_add(&_rb, rec, len);
+        added = true;
+    }
+    irq_restore(state);
+
+    return added;
+}
+
+void log_deferred_write(unsigned level, const char *fmt,
+                        const log_deferred_arg_t *args, unsigned numof)
+{
+    uint8_t rec[RECORD_MAX];
+    uint32_t id = (uintptr_t)fmt;
+    size_t pos = 2;
+
+    rec[0] = LOG_DEFERRED_SYNC;
+    rec[pos++] = level;
+    pos = _put(rec, pos, &id, sizeof(id));
+
+    for (unsigned i = 0; i < numof; i++) {
+        const log_deferred_arg_t *arg = &args[i];
+
+        pos = _put(rec, pos, &arg->type, sizeof(arg->type));
+        switch (arg->type) {
+        case LOG_DEFERRED_ARG_U32:
+            pos = _put(rec, pos, &arg->u32, sizeof(arg->u32));
+            break;
+        case LOG_DEFERRED_ARG_U64:
+            pos = _put(rec, pos, &arg->u64, sizeof(arg->u64));
+            break;
+        case LOG_DEFERRED_ARG_DOUBLE:
+            pos = _put(rec, pos, &arg->d, sizeof(arg->d));
+            break;
+        case LOG_DEFERRED_ARG_STR: {
+            const char *s = arg->s ? arg->s : "(null)";
+            uint8_t len = strnlen(s, CONFIG_LOG_DEFERRED_STR_MAX);
+            pos = _put(rec, pos, &len, sizeof(len));
+            pos = _put(rec, pos, s, len);
+            break;
+        }
+        }
+    }
+    if (pos > RECORD_MAX) {
+        /* arguments too long, keep the message without them */
+        pos = 2 + 1 + sizeof(id);
+    }
+    rec[1] = pos - 2;
+
+    if (!_add(rec, pos)) {
+        unsigned state = irq_disable();
+        _dropped++;
+        irq_restore(state);
+    }
+    if (_thread) {
+        thread_flags_set(_thread, THREAD_FLAG_LOG_DEFERRED);
+    }
+}
+
+static void _report_dropped(void)
+{
+    unsigned state = irq_disable();
+    uint32_t dropped = _dropped;
+    irq_restore(state);
+
+    if (dropped == 0) {
+        return;
+    }
+
+    uint8_t rec[] = { LOG_DEFERRED_SYNC, 1 + sizeof(dropped), 0, 0, 0, 0, 0 };
+    memcpy(&rec[3], &dropped, sizeof(dropped));
+    if (_add(rec, sizeof(rec))) {
+        state = irq_disable();
+        _dropped -= dropped;
+        irq_restore(state);
+    }
+}
+
+static void *_log_deferred_thread(void *arg)
+{
+    (void)arg;
+    uint8_t chunk[32];
+
+    while (1) {
+        thread_flags_wait_any(THREAD_FLAG_LOG_DEFERRED);
+        _report_dropped();
+
+        int len;
+        while ((len = tsrb_get(&_rb, chunk, sizeof(chunk))) > 0) {
+            stdio_write(chunk, len);
+        }
+    }
+
+    return NULL;
+}
+
+void log_deferred_init(void)
+{
+    kernel_pid_t pid = thread_create(_stack, sizeof(_stack),
+                                     THREAD_PRIORITY_IDLE - 1,
+                                     THREAD_CREATE_STACKTEST,
+                                     _log_deferred_thread, NULL,
+                                     "log_deferred");
+    _thread = thread_get(pid);
+    /* write out what was logged before */
+    thread_flags_set(_thread, THREAD_FLAG_LOG_DEFERRED);
+}
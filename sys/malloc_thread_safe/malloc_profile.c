@@ -0,0 +1,210 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_malloc_profile
+ * @{
+ *
+ * @file
+ * @brief       Heap usage profiler implementation
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "malloc_profile.h"
+#include "mutex.h"
+#include "thread.h"
+
+static mutex_t _lock;
+static malloc_profile_stats_t _stats;
+static malloc_profile_site_t _sites[CONFIG_MALLOC_PROFILE_SITES_NUMOF];
+static malloc_profile_alloc_t _allocs[CONFIG_MALLOC_PROFILE_ALLOCS_NUMOF];
+
+static malloc_profile_site_t *_get_site(uintptr_t pc)
+{
+    malloc_profile_site_t *empty = NULL;
+
+    for (unsigned i = 0; i < CONFIG_MALLOC_PROFILE_SITES_NUMOF; i++) {
+        if (_sites[i].pc == pc) {
+            return &_sites[i];
+        }
+        if (!empty && !_sites[i].pc) {
+            empty = &_sites[i];
+        }
+    }
+
+    if (empty) {
+        memset(empty, 0, sizeof(*empty));
+        empty->pc = pc;
+    }
+    return empty;
+}
+
+static malloc_profile_alloc_t *_find(const void *ptr)
+{
+    for (unsigned i = 0; i < CONFIG_MALLOC_PROFILE_ALLOCS_NUMOF; i++) {
+        if (_allocs[i].ptr == ptr) {
+            return &_allocs[i];
+        }
+    }
+    return NULL;
+}
+
+void malloc_profile_on_alloc(void *ptr, size_t size, uintptr_t pc)
+{
+    mutex_lock(&_lock);
+
+    if (!ptr) {
+        _stats.failed++;
+        goto out;
+    }
+
+    malloc_profile_alloc_t *alloc = _find(NULL);
+    malloc_profile_site_t *site = alloc ? _get_site(pc) : NULL;
+    if (!site) {
+        _stats.untracked++;
+        goto out;
+    }
+
+    alloc->ptr = ptr;
+    alloc->size = size;
+    alloc->site = site - _sites;
+    alloc->pid = thread_getpid();
+
+    site->allocs++;
+    site->live++;
+    site->live_bytes += size;
+    if (site->live_bytes > site->peak_bytes) {
+        site->peak_bytes = site->live_bytes;
+    }
+
+    _stats.live++;
+    _stats.live_bytes += size;
+    if (_stats.live_bytes > _stats.peak_bytes) {
+        _stats.peak_bytes = _stats.live_bytes;
+    }
+
+out:
+    mutex_unlock(&_lock);
+}
+
+size_t malloc_profile_on_free(void *ptr)
+{
+    size_t size = 0;
+
+    if (!ptr) {
+        return 0;
+    }
+
+    mutex_lock(&_lock);
+
+    malloc_profile_alloc_t *alloc = _find(ptr);
+    if (alloc) {
+        size = alloc->size;
+        malloc_profile_site_t *site = &_sites[alloc->site];
+        site->live--;
+        site->live_bytes -= alloc->size;
+        _stats.live--;
+        _stats.live_bytes -= alloc->size;
+        alloc->ptr = NULL;
+    }
+
+    mutex_unlock(&_lock);
+    return size;
+}
+
+void malloc_profile_get_stats(malloc_profile_stats_t *stats)
+{
+    mutex_lock(&_lock);
+    *stats = _stats;
+    mutex_unlock(&_lock);
+}
+
+unsigned malloc_profile_get_sites(malloc_profile_site_t *sites, unsigned numof)
+{
+    unsigned n = 0;
+
+    mutex_lock(&_lock);
+    for (unsigned i = 0; (i < CONFIG_MALLOC_PROFILE_SITES_NUMOF) && (n < numof); i++) {
+        if (_sites[i].pc) {
+            sites[n++] = _sites[i];
+        }
+    }
+    mutex_unlock(&_lock);
+
+    return n;
+}
+
+void malloc_profile_foreach(malloc_profile_cb_t cb, void *arg)
+{
+    mutex_lock(&_lock);
+    for (unsigned i = 0; i < CONFIG_MALLOC_PROFILE_ALLOCS_NUMOF; i++) {
+        if (_allocs[i].ptr) {
+            cb(&_allocs[i], &_sites[_allocs[i].site], arg);
+        }
+    }
+    mutex_unlock(&_lock);
+}
+
+void malloc_profile_reset_peak(void)
+{
+    mutex_lock(&_lock);
+    _stats.peak_bytes = _stats.live_bytes;
+    for (unsigned i = 0; i < CONFIG_MALLOC_PROFILE_SITES_NUMOF; i++) {
+        if (!_sites[i].live) {
+            _sites[i].pc = 0;
+        }
+        _sites[i].peak_bytes = _sites[i].live_bytes;
+    }
+    mutex_unlock(&_lock);
+}
+
+void malloc_profile_print(void)
+{
+    malloc_profile_stats_t stats;
+    size_t per_thread[KERNEL_PID_LAST + 1] = { 0 };
+
+    /* printf() may allocate, so copy everything before printing */
+    mutex_lock(&_lock);
+    stats = _stats;
+    for (unsigned i = 0; i < CONFIG_MALLOC_PROFILE_ALLOCS_NUMOF; i++) {
+        if (_allocs[i].ptr) {
+            per_thread[_allocs[i].pid] += _allocs[i].size;
+        }
+    }
+    mutex_unlock(&_lock);
+
+    printf("live: %u B in %u blocks, peak: %u B, failed: %u, untracked: %u\n",
+           (unsigned)stats.live_bytes, stats.live, (unsigned)stats.peak_bytes,
+           stats.failed, stats.untracked);
+
+    puts("call site  | live B | blocks | peak B | allocs");
+    for (unsigned i = 0; i < CONFIG_MALLOC_PROFILE_SITES_NUMOF; i++) {
+        malloc_profile_site_t site;
+        mutex_lock(&_lock);
+        site = _sites[i];
+        mutex_unlock(&_lock);
+        if (!site.pc) {
+            continue;
+        }
+        printf("0x%08" PRIxPTR " | %6u | %6u | %6u | %6u\n", site.pc,
+               (unsigned)site.live_bytes, site.live,
+               (unsigned)site.peak_bytes, site.allocs);
+    }
+
+    puts("pid | live B");
+    for (unsigned pid = 0; pid <= KERNEL_PID_LAST; pid++) {
+        if (per_thread[pid]) {
+            printf("%3u | %6u\n", pid, (unsigned)per_thread[pid]);
+        }
+    }
+}
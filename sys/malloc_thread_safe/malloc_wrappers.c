@@ -14,30 +14,177 @@
  * @author  Gunar Schorcht <gunar@schorcht.net>
  */
 
+#include <stdint.h>
 #include <string.h>
 
 #include "assert.h"
 #include "irq.h"
+#include "kernel_defines.h"
 #include "mutex.h"
+#include "thread.h"
 
 extern void *__real_malloc(size_t size);
 extern void __real_free(void *ptr);
 extern void *__real_realloc(void *ptr, size_t size);
 
+/* hooks of the malloc_profile module */
+extern void malloc_profile_on_alloc(void *ptr, size_t size, uintptr_t pc);
+extern size_t malloc_profile_on_free(void *ptr);
+
+#define CALLER_PC() ((uintptr_t)__builtin_return_address(0))
+
 static mutex_t _lock;
 
-void __attribute__((used)) *__wrap_malloc(size_t size)
+#if IS_USED(MODULE_MALLOC_THREAD_CACHE)
+#ifndef CONFIG_MALLOC_THREAD_CACHE_ARENA_SIZE
+/**
+ * @brief   Size of the arena the small blocks are taken from, in bytes
+ *
+ * The arena is split evenly among the size classes.
+ */
+#define CONFIG_MALLOC_THREAD_CACHE_ARENA_SIZE   4096
+#endif
+
+#ifndef CONFIG_MALLOC_THREAD_CACHE_LIMIT
+/**
+ * @brief   Maximum number of free blocks per size class a thread keeps
+ */
+#define CONFIG_MALLOC_THREAD_CACHE_LIMIT        8
+#endif
+
+/* size classes are 16, 32, 64 and 128 bytes */
+#define CLASS_MIN_SHIFT     4
+#define CLASS_NUMOF         4
+#define CLASS_MAX_SIZE      (1U << (CLASS_MIN_SHIFT + CLASS_NUMOF - 1))
+#define SLAB_SIZE           (CONFIG_MALLOC_THREAD_CACHE_ARENA_SIZE / CLASS_NUMOF \
+                             / CLASS_MAX_SIZE * CLASS_MAX_SIZE)
+
+typedef struct block {
+    struct block *next;
+} block_t;
+
+typedef struct {
+    block_t *head;
+    uint8_t numof;
+} cache_t;
+
+static uint8_t _arena[CLASS_NUMOF][SLAB_SIZE] __attribute__((aligned(8)));
+/* blocks returned from the thread caches, shared by all threads */
+static block_t *_shared[CLASS_NUMOF];
+/* part of each slab that was never handed out yet */
+static unsigned _carved[CLASS_NUMOF];
+/* per thread caches, indexed by PID. Only the owning thread modifies them,
+ * so no lock is needed. Index 0 is used before the scheduler is started */
+static cache_t _cache[KERNEL_PID_LAST + 1][CLASS_NUMOF];
+
+static int _class(size_t size)
+{
+    if (size > CLASS_MAX_SIZE) {
+        return -1;
+    }
+    int cls = 0;
+    while ((1U << (CLASS_MIN_SHIFT + cls)) < size) {
+        cls++;
+    }
+    return cls;
+}
+
+static int _class_of_ptr(const void *ptr)
+{
+    const uint8_t *p = ptr;
+    if ((p < &_arena[0][0]) || (p >= &_arena[CLASS_NUMOF][0])) {
+        return -1;
+    }
+    return (p - &_arena[0][0]) / SLAB_SIZE;
+}
+
+static void *_cache_alloc(int cls)
+{
+    cache_t *cache = &_cache[thread_getpid()][cls];
+    block_t *block = cache->head;
+
+    if (block) {
+        cache->head = block->next;
+        cache->numof--;
+        return block;
+    }
+
+    /* refill from the shared pool or the untouched part of the slab */
+    unsigned state = irq_disable();
+    block = _shared[cls];
+    if (block) {
+        _shared[cls] = block->next;
+    }
+    else if (_carved[cls] < SLAB_SIZE) {
+        block = (block_t *)&_arena[cls][_carved[cls]];
+        _carved[cls] += 1U << (CLASS_MIN_SHIFT + cls);
+    }
+    irq_restore(state);
+
+    return block;
+}
+
+static void _cache_free(int cls, void *ptr)
+{
+    cache_t *cache = &_cache[thread_getpid()][cls];
+    block_t *block = ptr;
+
+    if (cache->numof < CONFIG_MALLOC_THREAD_CACHE_LIMIT) {
+        block->next = cache->head;
+        cache->head = block;
+        cache->numof++;
+        return;
+    }
+
+    /* do not let a single thread hoard the blocks */
+    unsigned state = irq_disable();
+    block->next = _shared[cls];
+    _shared[cls] = block;
+    irq_restore(state);
+}
+#endif
+
+static void *_malloc(size_t size)
 {
     assert(!irq_is_in());
+#if IS_USED(MODULE_MALLOC_THREAD_CACHE)
+    int cls = _class(size);
+    if (cls >= 0) {
+        void *ptr = _cache_alloc(cls);
+        if (ptr) {
+            return ptr;
+        }
+    }
+#endif
     mutex_lock(&_lock);
     void *ptr = __real_malloc(size);
     mutex_unlock(&_lock);
     return ptr;
 }
 
+void __attribute__((used)) *__wrap_malloc(size_t size)
+{
+    void *ptr = _malloc(size);
+
+    if (IS_USED(MODULE_MALLOC_PROFILE)) {
+        malloc_profile_on_alloc(ptr, size, CALLER_PC());
+    }
+    return ptr;
+}
+
 void __attribute__((used)) __wrap_free(void *ptr)
 {
     assert(!irq_is_in());
+    if (IS_USED(MODULE_MALLOC_PROFILE)) {
+        malloc_profile_on_free(ptr);
+    }
+#if IS_USED(MODULE_MALLOC_THREAD_CACHE)
+    int cls = _class_of_ptr(ptr);
+    if (cls >= 0) {
+        _cache_free(cls, ptr);
+        return;
+    }
+#endif
     mutex_lock(&_lock);
     __real_free(ptr);
     mutex_unlock(&_lock);
@@ -53,7 +200,10 @@ void * __attribute__((used)) __wrap_calloc(size_t nmemb, size_t size)
         return NULL;
     }
 
-    void *res = __wrap_malloc(total_size);
+    void *res = _malloc(total_size);
+    if (IS_USED(MODULE_MALLOC_PROFILE)) {
+        malloc_profile_on_alloc(res, total_size, CALLER_PC());
+    }
     if (res) {
         memset(res, 0, total_size);
     }
@@ -61,13 +211,56 @@ void * __attribute__((used)) __wrap_calloc(size_t nmemb, size_t size)
     return res;
 }
 
-void * __attribute__((used))__wrap_realloc(void *ptr, size_t size)
+static void *_realloc(void *ptr, size_t size)
 {
     assert(!irq_is_in());
+#if IS_USED(MODULE_MALLOC_THREAD_CACHE)
+    int cls = _class_of_ptr(ptr);
+    if (cls >= 0) {
+        size_t old_size = 1U << (CLASS_MIN_SHIFT + cls);
+        if (size <= old_size && size) {
+            return ptr;
+        }
+        void *new = NULL;
+        if (size) {
+            new = _malloc(size);
+            if (!new) {
+                return NULL;
+            }
+            memcpy(new, ptr, old_size);
+        }
+        _cache_free(cls, ptr);
+        return new;
+    }
+#endif
     mutex_lock(&_lock);
     void *new = __real_realloc(ptr, size);
     mutex_unlock(&_lock);
     return new;
 }
 
+void * __attribute__((used))__wrap_realloc(void *ptr, size_t size)
+{
+    if (!IS_USED(MODULE_MALLOC_PROFILE)) {
+        return _realloc(ptr, size);
+    }
+
+    /* drop the record before the block is released, another thread may get
+     * the same address right after */
+    size_t old_size = malloc_profile_on_free(ptr);
+    void *new = _realloc(ptr, size);
+
+    if (new) {
+        malloc_profile_on_alloc(new, size, CALLER_PC());
+    }
+    else if (size) {
+        /* the old block is still valid */
+        malloc_profile_on_alloc(NULL, size, CALLER_PC());
+        if (old_size) {
+            malloc_profile_on_alloc(ptr, old_size, CALLER_PC());
+        }
+    }
+    return new;
+}
+
 /** @} */
@@ -0,0 +1,137 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_memarray_atomic
+ * @{
+ *
+ * @file
+ * @brief       Lock-free memory array allocator implementation
+ *
+ * Each free element stores the index + 1 of the next free element in its
+ * first two bytes, 0 terminates the list.
+ *
+ * @}
+ */
+
+#include <assert.h>
+#include <string.h>
+
+#include "memarray_atomic.h"
+
+#define IDX_MASK    (0xffffUL)
+#define TAG_INC     (0x10000UL)
+
+static inline uint8_t *_elem(const memarray_atomic_t *mem, uint32_t idx)
+{
+    return mem->data + (idx - 1) * mem->size;
+}
+
+void memarray_atomic_init(memarray_atomic_t *mem, void *data, size_t size,
+                          size_t num)
+{
+    assert(mem && data && (size >= sizeof(uint16_t)) && num &&
+           (num <= UINT16_MAX));
+
+    mem->data = data;
+    mem->size = size;
+    mem->num = num;
+
+    for (uint16_t idx = 1; idx <= num; idx++) {
+        uint16_t next = (idx < num) ? idx + 1 : 0;
+        memcpy(_elem(mem, idx), &next, sizeof(next));
+    }
+
+    atomic_init(&mem->head, 1);
+    atomic_init(&mem->in_use, 0);
+    atomic_init(&mem->high_water, 0);
+    atomic_init(&mem->failed, 0);
+}
+
+void *memarray_atomic_alloc(memarray_atomic_t *mem)
+{
+    uint_least32_t old = atomic_load(&mem->head);
+    uint_least32_t desired;
+    uint16_t next;
+
+    do {
+        uint32_t idx = old & IDX_MASK;
+        if (!idx) {
+            atomic_fetch_add(&mem->failed, 1);
+            return NULL;
+        }
+        /* the element may be allocated and modified concurrently, the
+         * compare-and-swap fails in that case as the tag has changed */
+        memcpy(&next, _elem(mem, idx), sizeof(next));
+        desired = ((old & ~IDX_MASK) + TAG_INC) | next;
+    } while (!atomic_compare_exchange_weak(&mem->head, &old, desired));
+
+    unsigned in_use = atomic_fetch_add(&mem->in_use, 1) + 1;
+    unsigned high = atomic_load(&mem->high_water);
+    while ((in_use > high) &&
+           !atomic_compare_exchange_weak(&mem->high_water, &high, in_use)) {}
+
+    return _elem(mem, old & IDX_MASK);
+}
+
+void memarray_atomic_free(memarray_atomic_t *mem, void *ptr)
+{
+    assert(memarray_atomic_contains(mem, ptr));
+
+    uint16_t idx = ((uint8_t *)ptr - mem->data) / mem->size + 1;
+    uint_least32_t old = atomic_load(&mem->head);
+    uint_least32_t desired;
+
+    do {
+        uint16_t next = old & IDX_MASK;
+        memcpy(ptr, &next, sizeof(next));
+        desired = ((old & ~IDX_MASK) + TAG_INC) | idx;
+    } while (!atomic_compare_exchange_weak(&mem->head, &old, desired));
+
+    atomic_fetch_sub(&mem->in_use, 1);
+}
+
+void *memarray_atomic_alloc_size(memarray_atomic_t *pools, unsigned numof,
+                                 size_t size)
+{
+    for (unsigned i = 0; i < numof; i++) {
+        if (pools[i].size < size) {
+            continue;
+        }
+        void *res = memarray_atomic_alloc(&pools[i]);
+        if (res) {
+            return res;
+        }
+    }
+    return NULL;
+}
+
+void memarray_atomic_free_any(memarray_atomic_t *pools, unsigned numof,
+                              void *ptr)
+{
+    for (unsigned i = 0; i < numof; i++) {
+        if (memarray_atomic_contains(&pools[i], ptr)) {
+            memarray_atomic_free(&pools[i], ptr);
+            return;
+        }
+    }
+    assert(0);
+}
+
+void memarray_atomic_get_stats(memarray_atomic_t *mem,
+                               memarray_atomic_stats_t *stats)
+{
+    stats->in_use = atomic_load(&mem->in_use);
+    stats->high_water = atomic_load(&mem->high_water);
+    stats->failed = atomic_load(&mem->failed);
+}
+
+void memarray_atomic_reset_high_water(memarray_atomic_t *mem)
+{
+    atomic_store(&mem->high_water, atomic_load(&mem->in_use));
+}
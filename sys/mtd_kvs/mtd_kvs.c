@@ -0,0 +1,725 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_mtd_kvs
+ * @{
+ *
+ * @file
+ * @brief       Log-structured key-value store on MTD
+ *
+ * @}
+ */
+
+#include <assert.h>
+#include <errno.h>
+#include <inttypes.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "checksum/crc16_ccitt.h"
+#include "mtd_kvs.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+#define SECTOR_MAGIC        (0x53564b4dU)   /* "MKVS" */
+#define LOC_NONE            (UINT32_MAX)
+#define ENTRY_VALUE         (0x01)
+#define ENTRY_DELETED       (0x02)
+#define CHUNK_SIZE          (32U)
+
+typedef struct {
+    uint32_t magic;
+    uint32_t seq;
+    uint16_t crc;
+} _sector_hdr_t;
+
+typedef struct {
+    uint8_t type;           /**< ENTRY_VALUE or ENTRY_DELETED */
+    uint8_t key_len;        /**< length of the key following the header */
+    uint16_t val_len;       /**< length of the value following the key */
+    uint16_t hash;          /**< upper half of the hash of the key */
+    uint16_t crc;           /**< CRC of sector sequence number and entry */
+    uint32_t prev;          /**< previous entry in the same bucket */
+} _entry_hdr_t;
+
+/* streams an entry to the head sector in aligned chunks */
+typedef struct {
+    mtd_kvs_t *kvs;
+    uint32_t offset;
+    uint8_t fill;
+    uint8_t buf[MTD_KVS_ALIGN];
+} _writer_t;
+
+static_assert(sizeof(_entry_hdr_t) == 12, "unexpected entry header size");
+static_assert(CONFIG_MTD_KVS_KEY_LEN_MAX <= UINT8_MAX,
+              "CONFIG_MTD_KVS_KEY_LEN_MAX too large");
+
+static uint32_t _align(uint32_t n)
+{
+    return (n + MTD_KVS_ALIGN - 1) & ~(MTD_KVS_ALIGN - 1);
+}
+
+#define SECTOR_HDR_SIZE _align(sizeof(_sector_hdr_t))
+
+static uint32_t _loc(uint32_t sector, uint32_t offset)
+{
+    return (sector << 16) | offset;
+}
+
+static uint32_t _loc_sector(uint32_t loc)
+{
+    return loc >> 16;
+}
+
+static uint32_t _loc_offset(uint32_t loc)
+{
+    return loc & 0xffff;
+}
+
+static uint32_t _entry_size(const _entry_hdr_t *hdr)
+{
+    return _align(sizeof(*hdr) + hdr->key_len + hdr->val_len);
+}
+
+static uint32_t _page(const mtd_kvs_t *kvs, uint32_t sector)
+{
+    return (kvs->first_sector + sector) * kvs->mtd->pages_per_sector;
+}
+
+static int _read(const mtd_kvs_t *kvs, uint32_t sector, uint32_t offset,
+                 void *buf, size_t len)
+{
+    return mtd_read_page(kvs->mtd, buf, _page(kvs, sector), offset, len);
+}
+
+static int _write(const mtd_kvs_t *kvs, uint32_t sector, uint32_t offset,
+                  const void *buf, size_t len)
+{
+    return mtd_write_page_raw(kvs->mtd, buf, _page(kvs, sector), offset, len);
+}
+
+static uint32_t _next(const mtd_kvs_t *kvs, uint32_t sector)
+{
+    return (sector + 1 < kvs->sectors) ? sector + 1 : 0;
+}
+
+static uint32_t *_bucket(mtd_kvs_t *kvs, uint32_t hash)
+{
+    return &kvs->buckets[hash & (kvs->buckets_numof - 1)];
+}
+
+/* FNV-1a */
+static uint32_t _hash(const void *key, size_t len)
+{
+    const uint8_t *p = key;
+    uint32_t hash = 2166136261U;
+
+    for (size_t i = 0; i < len; i++) {
+        hash = (hash ^ p[i]) * 16777619U;
+    }
+    return hash;
+}
+
+static bool _is_erased(const void *buf, size_t len)
+{
+    const uint8_t *p = buf;
+
+    for (size_t i = 0; i < len; i++) {
+        if (p[i] != 0xff) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static uint16_t _sector_crc(const _sector_hdr_t *hdr)
+{
+    uint16_t crc = crc16_ccitt_false_update(0xffff, (void *)&hdr->magic,
+                                            sizeof(hdr->magic));
+    return crc16_ccitt_false_update(crc, (void *)&hdr->seq, sizeof(hdr->seq));
+}
+
+/* entries are bound to the sector they were written to, so stale entries of
+ * an earlier use of the sector never pass as valid */
+static uint16_t _entry_crc(uint32_t seq, const _entry_hdr_t *hdr)
+{
+    uint16_t crc = crc16_ccitt_false_update(0xffff, (void *)&seq, sizeof(seq));
+    crc = crc16_ccitt_false_update(crc, (void *)hdr,
+                                   offsetof(_entry_hdr_t, crc));
+    return crc16_ccitt_false_update(crc, (void *)&hdr->prev, sizeof(hdr->prev));
+}
+
+/* updates crc and, for the first key_len bytes, hash with data on flash */
+static int _scan(const mtd_kvs_t *kvs, uint32_t sector, uint32_t offset,
+                 size_t len, size_t key_len, uint16_t *crc, uint32_t *hash)
+{
+    uint8_t chunk[CONFIG_MTD_KVS_KEY_LEN_MAX > CHUNK_SIZE ?
+                  CONFIG_MTD_KVS_KEY_LEN_MAX : CHUNK_SIZE];
+    int res;
+
+    /* read the key at once, so it can be hashed */
+    if (key_len && ((res = _read(kvs, sector, offset, chunk, key_len)) < 0)) {
+        return res;
+    }
+    if (hash) {
+        *hash = _hash(chunk, key_len);
+    }
+    *crc = crc16_ccitt_false_update(*crc, chunk, key_len);
+    for (size_t pos = key_len; pos < len; pos += CHUNK_SIZE) {
+        size_t n = len - pos;
+        if (n > CHUNK_SIZE) {
+            n = CHUNK_SIZE;
+        }
+        if ((res = _read(kvs, sector, offset + pos, chunk, n)) < 0) {
+            return res;
+        }
+        *crc = crc16_ccitt_false_update(*crc, chunk, n);
+    }
+    return 0;
+}
+
+/**
+ * @brief   Reads the header of the entry at @p offset of @p sector
+ *
+ * @return  1 if the header is plausible
+ * @return  0 if there are no more entries in the sector
+ * @return  -EBADMSG if the header is corrupted
+ */
+static int _read_entry(const mtd_kvs_t *kvs, uint32_t sector, uint32_t offset,
+                       _entry_hdr_t *hdr)
+{
+    int res;
+
+    if (offset + sizeof(*hdr) > kvs->sector_size) {
+        return 0;
+    }
+    if ((res = _read(kvs, sector, offset, hdr, sizeof(*hdr))) < 0) {
+        return res;
+    }
+    if (_is_erased(hdr, sizeof(*hdr))) {
+        return 0;
+    }
+    if (((hdr->type != ENTRY_VALUE) && (hdr->type != ENTRY_DELETED)) ||
+        (hdr->key_len == 0) || (hdr->key_len > CONFIG_MTD_KVS_KEY_LEN_MAX) ||
+        (_entry_size(hdr) > kvs->sector_size - offset)) {
+        return -EBADMSG;
+    }
+    return 1;
+}
+
+/* checks the CRC of an entry and gets the full hash of its key */
+static int _check_entry(const mtd_kvs_t *kvs, uint32_t sector, uint32_t offset,
+                        const _entry_hdr_t *hdr, uint32_t *hash)
+{
+    uint16_t crc = _entry_crc(kvs->seq[sector], hdr);
+    int res = _scan(kvs, sector, offset + sizeof(*hdr),
+                    hdr->key_len + hdr->val_len, hdr->key_len, &crc, hash);
+
+    if (res < 0) {
+        return res;
+    }
+    return (crc == hdr->crc) ? 0 : -EBADMSG;
+}
+
+/* an entry of a chain must be older than the one linking to it, everything
+ * else points to a sector that was erased in the meantime */
+static bool _is_older(const mtd_kvs_t *kvs, uint32_t loc, uint32_t seq,
+                      uint32_t offset)
+{
+    if ((loc == LOC_NONE) || (_loc_sector(loc) >= kvs->sectors)) {
+        return false;
+    }
+
+    uint32_t loc_seq = kvs->seq[_loc_sector(loc)];
+    return (loc_seq != 0) && ((loc_seq < seq) ||
+                              ((loc_seq == seq) && (_loc_offset(loc) < offset)));
+}
+
+/* finds the newest entry of key */
+static int _find(mtd_kvs_t *kvs, const char *key, size_t key_len,
+                 uint32_t hash, uint32_t *loc, _entry_hdr_t *hdr)
+{
+    uint32_t seq = UINT32_MAX, offset = UINT32_MAX;
+    uint8_t buf[CONFIG_MTD_KVS_KEY_LEN_MAX];
+
+    for (uint32_t it = *_bucket(kvs, hash); _is_older(kvs, it, seq, offset);
+         it = hdr->prev) {
+        int res = _read_entry(kvs, _loc_sector(it), _loc_offset(it), hdr);
+
+        if (res <= 0) {
+            return ((res < 0) && (res != -EBADMSG)) ? res : -ENOENT;
+        }
+        seq = kvs->seq[_loc_sector(it)];
+        offset = _loc_offset(it);
+        if ((hdr->hash != (hash >> 16)) || (hdr->key_len != key_len)) {
+            continue;
+        }
+        if ((res = _read(kvs, _loc_sector(it), offset + sizeof(*hdr),
+                         buf, key_len)) < 0) {
+            return res;
+        }
+        if (memcmp(buf, key, key_len) == 0) {
+            *loc = it;
+            return 0;
+        }
+    }
+    return -ENOENT;
+}
+
+static int _put(_writer_t *w, const void *data, size_t len)
+{
+    const uint8_t *p = data;
+    int res;
+
+    while (len) {
+        size_t n;
+
+        if ((w->fill == 0) && (len >= MTD_KVS_ALIGN)) {
+            n = len & ~(MTD_KVS_ALIGN - 1);
+            if ((res = _write(w->kvs, w->kvs->head, w->offset, p, n)) < 0) {
+                return res;
+            }
+            w->offset += n;
+        }
+        else {
+            n = MTD_KVS_ALIGN - w->fill;
+            if (n > len) {
+                n = len;
+            }
+            memcpy(&w->buf[w->fill], p, n);
+            w->fill += n;
+            if (w->fill == MTD_KVS_ALIGN) {
+                if ((res = _write(w->kvs, w->kvs->head, w->offset,
+                                  w->buf, sizeof(w->buf))) < 0) {
+                    return res;
+                }
+                w->offset += sizeof(w->buf);
+                w->fill = 0;
+            }
+        }
+        p += n;
+        len -= n;
+    }
+    return 0;
+}
+
+static int _put_flash(_writer_t *w, uint32_t sector, uint32_t offset, size_t len)
+{
+    uint8_t chunk[CHUNK_SIZE];
+    int res;
+
+    for (size_t pos = 0; pos < len; pos += CHUNK_SIZE) {
+        size_t n = len - pos;
+        if (n > CHUNK_SIZE) {
+            n = CHUNK_SIZE;
+        }
+        if (((res = _read(w->kvs, sector, offset + pos, chunk, n)) < 0) ||
+            ((res = _put(w, chunk, n)) < 0)) {
+            return res;
+        }
+    }
+    return 0;
+}
+
+static int _flush(_writer_t *w)
+{
+    if (w->fill == 0) {
+        return 0;
+    }
+    memset(&w->buf[w->fill], 0xff, sizeof(w->buf) - w->fill);
+    w->fill = 0;
+    return _put(w, w->buf, sizeof(w->buf));
+}
+
+/**
+ * @brief   Writes an entry to the head sector, which must have room for it
+ *
+ * The value is taken from @p value or, if that is NULL, from @p src on flash.
+ */
+static int _put_entry(mtd_kvs_t *kvs, _entry_hdr_t *hdr, uint32_t hash,
+                      const char *key, const void *value, uint32_t src)
+{
+    _writer_t w = { .kvs = kvs, .offset = kvs->offset };
+    uint32_t *bucket = _bucket(kvs, hash);
+    int res;
+
+    assert(kvs->offset + _entry_size(hdr) <= kvs->sector_size);
+    hdr->prev = *bucket;
+    hdr->crc = _entry_crc(kvs->seq[kvs->head], hdr);
+    hdr->crc = crc16_ccitt_false_update(hdr->crc, (void *)key, hdr->key_len);
+    if (value) {
+        hdr->crc = crc16_ccitt_false_update(hdr->crc, value, hdr->val_len);
+    }
+    else if ((res = _scan(kvs, _loc_sector(src), _loc_offset(src),
+                          hdr->val_len, 0, &hdr->crc, NULL)) < 0) {
+        return res;
+    }
+
+    /* if anything below fails, the sector can't be appended to anymore */
+    const uint32_t offset = kvs->offset;
+    kvs->offset = kvs->sector_size;
+    if (((res = _put(&w, hdr, sizeof(*hdr))) < 0) ||
+        ((res = _put(&w, key, hdr->key_len)) < 0)) {
+        return res;
+    }
+    if (value) {
+        res = _put(&w, value, hdr->val_len);
+    }
+    else {
+        res = _put_flash(&w, _loc_sector(src), _loc_offset(src), hdr->val_len);
+    }
+    if ((res < 0) || ((res = _flush(&w)) < 0)) {
+        return res;
+    }
+    *bucket = _loc(kvs->head, offset);
+    kvs->offset = offset + _entry_size(hdr);
+    return 0;
+}
+
+static int _open(mtd_kvs_t *kvs, uint32_t sector, uint32_t seq)
+{
+    _sector_hdr_t hdr = { .magic = SECTOR_MAGIC, .seq = seq };
+    uint8_t tmp[SECTOR_HDR_SIZE];
+    int res;
+
+    DEBUG("mtd_kvs: open sector %" PRIu32 ", seq %" PRIu32 "\n", sector, seq);
+    kvs->seq[sector] = 0;
+    if ((res = mtd_erase_sector(kvs->mtd, kvs->first_sector + sector, 1)) < 0) {
+        return res;
+    }
+    hdr.crc = _sector_crc(&hdr);
+    memset(tmp, 0xff, sizeof(tmp));
+    memcpy(tmp, &hdr, sizeof(hdr));
+    if ((res = _write(kvs, sector, 0, tmp, sizeof(tmp))) < 0) {
+        return res;
+    }
+    kvs->seq[sector] = seq;
+    kvs->head = sector;
+    kvs->offset = SECTOR_HDR_SIZE;
+    return 0;
+}
+
+/* copies the live entries of a sector to the head and drops the sector */
+static int _collect(mtd_kvs_t *kvs, uint32_t sector)
+{
+    uint32_t offset = SECTOR_HDR_SIZE;
+    _entry_hdr_t hdr;
+    int res;
+
+    DEBUG("mtd_kvs: collect sector %" PRIu32 "\n", sector);
+    while ((res = _read_entry(kvs, sector, offset, &hdr)) == 1) {
+        const uint32_t loc = _loc(sector, offset);
+        uint8_t key[CONFIG_MTD_KVS_KEY_LEN_MAX];
+        _entry_hdr_t newest;
+        uint32_t newest_loc, hash;
+
+        offset += _entry_size(&hdr);
+        if (hdr.type != ENTRY_VALUE) {
+            /* older entries of the key are in this sector or already gone */
+            continue;
+        }
+        if ((res = _read(kvs, sector, _loc_offset(loc) + sizeof(hdr),
+                         key, hdr.key_len)) < 0) {
+            return res;
+        }
+        hash = _hash(key, hdr.key_len);
+        res = _find(kvs, (char *)key, hdr.key_len, hash, &newest_loc, &newest);
+        if ((res == -ENOENT) || ((res == 0) && (newest_loc != loc))) {
+            continue;
+        }
+        if (res < 0) {
+            return res;
+        }
+        if (kvs->offset + _entry_size(&hdr) > kvs->sector_size) {
+            return -ENOSPC;
+        }
+        res = _put_entry(kvs, &hdr, hash, (char *)key, NULL,
+                         loc + sizeof(hdr) + hdr.key_len);
+        if (res < 0) {
+            return res;
+        }
+    }
+    if ((res < 0) && (res != -EBADMSG)) {
+        return res;
+    }
+
+    /* the sector is erased when it is opened again */
+    kvs->seq[sector] = 0;
+    for (uint32_t i = 0; i < kvs->buckets_numof; i++) {
+        if ((kvs->buckets[i] != LOC_NONE) &&
+            (_loc_sector(kvs->buckets[i]) == sector)) {
+            kvs->buckets[i] = LOC_NONE;
+        }
+    }
+    return 0;
+}
+
+/* opens the next sector, keeping the one after it free */
+static int _advance(mtd_kvs_t *kvs)
+{
+    const uint32_t sector = _next(kvs, kvs->head);
+    const uint32_t victim = _next(kvs, sector);
+    int res;
+
+    if ((res = _open(kvs, sector, kvs->seq[kvs->head] + 1)) < 0) {
+        return res;
+    }
+    if ((victim != sector) && (kvs->seq[victim] != 0)) {
+        /* the live entries of a sector always fit into an empty one */
+        res = _collect(kvs, victim);
+    }
+    return res;
+}
+
+static int _append(mtd_kvs_t *kvs, uint8_t type, const char *key,
+                   size_t key_len, uint32_t hash, const void *value, size_t len)
+{
+    _entry_hdr_t hdr = {
+        .type = type,
+        .key_len = key_len,
+        .val_len = len,
+        .hash = hash >> 16,
+    };
+    int res;
+
+    /* when all sectors are full of live entries, they are only moved */
+    for (uint32_t i = 0; kvs->offset + _entry_size(&hdr) > kvs->sector_size; i++) {
+        if (i == kvs->sectors) {
+            return -ENOSPC;
+        }
+        if ((res = _advance(kvs)) < 0) {
+            return res;
+        }
+    }
+    return _put_entry(kvs, &hdr, hash, key, value ? value : "", 0);
+}
+
+static int _scan_sector(mtd_kvs_t *kvs, uint32_t sector)
+{
+    uint32_t offset = SECTOR_HDR_SIZE;
+    _entry_hdr_t hdr;
+    int res;
+
+    while ((res = _read_entry(kvs, sector, offset, &hdr)) == 1) {
+        uint32_t hash;
+
+        res = _check_entry(kvs, sector, offset, &hdr, &hash);
+        if (res == 0) {
+            *_bucket(kvs, hash) = _loc(sector, offset);
+        }
+        else if (res == -EBADMSG) {
+            /* torn entry, but its header is intact: skip it */
+            DEBUG("mtd_kvs: corrupted entry at %" PRIu32 ":%" PRIu32 "\n",
+                  sector, offset);
+        }
+        else {
+            return res;
+        }
+        offset += _entry_size(&hdr);
+    }
+    if (res == -EBADMSG) {
+        /* the end of the entries is unknown, nothing can be written here */
+        offset = kvs->sector_size;
+    }
+    else if (res < 0) {
+        return res;
+    }
+    if (sector == kvs->head) {
+        kvs->offset = offset;
+    }
+    return 0;
+}
+
+int mtd_kvs_init(mtd_kvs_t *kvs)
+{
+    mtd_dev_t *mtd = kvs->mtd;
+    uint32_t max_seq = 0;
+    int res;
+
+    assert((kvs->seq != NULL) && (kvs->buckets != NULL) && (kvs->sectors >= 2));
+    assert((kvs->buckets_numof & (kvs->buckets_numof - 1)) == 0);
+    mutex_init(&kvs->lock);
+    if ((res = mtd_init(mtd)) < 0) {
+        return res;
+    }
+    kvs->sector_size = mtd->pages_per_sector * mtd->page_size;
+    if ((kvs->first_sector + kvs->sectors > mtd->sector_count) ||
+        (kvs->sectors >= UINT16_MAX) || (kvs->sector_size > UINT16_MAX + 1) ||
+        (mtd->write_size > MTD_KVS_ALIGN) || (MTD_KVS_ALIGN % mtd->write_size) ||
+        (kvs->sector_size < SECTOR_HDR_SIZE + _align(sizeof(_entry_hdr_t) + 1))) {
+        DEBUG("mtd_kvs: unsuitable MTD device\n");
+        return -ENOTSUP;
+    }
+
+    mutex_lock(&kvs->lock);
+    for (uint32_t i = 0; i < kvs->buckets_numof; i++) {
+        kvs->buckets[i] = LOC_NONE;
+    }
+    for (uint32_t i = 0; i < kvs->sectors; i++) {
+        _sector_hdr_t hdr;
+
+        if ((res = _read(kvs, i, 0, &hdr, sizeof(hdr))) < 0) {
+            goto out;
+        }
+        kvs->seq[i] = ((hdr.magic == SECTOR_MAGIC) &&
+                       (hdr.crc == _sector_crc(&hdr))) ? hdr.seq : 0;
+        if (kvs->seq[i] > max_seq) {
+            max_seq = kvs->seq[i];
+            kvs->head = i;
+        }
+    }
+    if (max_seq == 0) {
+        DEBUG("mtd_kvs: no store found, starting a new one\n");
+        res = _open(kvs, 0, 1);
+        goto out;
+    }
+
+    /* oldest sector first, so newer entries replace older ones */
+    uint32_t sector = kvs->head;
+    do {
+        sector = _next(kvs, sector);
+        if ((kvs->seq[sector] != 0) && ((res = _scan_sector(kvs, sector)) < 0)) {
+            goto out;
+        }
+    } while (sector != kvs->head);
+
+    /* finish a garbage collection interrupted by a power failure */
+    sector = _next(kvs, kvs->head);
+    if ((sector != kvs->head) && (kvs->seq[sector] != 0)) {
+        res = _collect(kvs, sector);
+        if (res == -ENOSPC) {
+            DEBUG("mtd_kvs: no room to finish garbage collection\n");
+            kvs->seq[sector] = 0;
+            res = 0;
+        }
+    }
+    DEBUG("mtd_kvs: continue in sector %" PRIu32 " at %" PRIu32 "\n",
+          kvs->head, kvs->offset);
+out:
+    mutex_unlock(&kvs->lock);
+    return res;
+}
+
+int mtd_kvs_get(mtd_kvs_t *kvs, const char *key, void *value, size_t len)
+{
+    const size_t key_len = strlen(key);
+    _entry_hdr_t hdr;
+    uint32_t loc;
+    int res;
+
+    if ((key_len == 0) || (key_len > CONFIG_MTD_KVS_KEY_LEN_MAX)) {
+        return -ENOENT;
+    }
+
+    mutex_lock(&kvs->lock);
+    res = _find(kvs, key, key_len, _hash(key, key_len), &loc, &hdr);
+    if (res < 0) {
+        goto out;
+    }
+    if (hdr.type != ENTRY_VALUE) {
+        res = -ENOENT;
+        goto out;
+    }
+    if (hdr.val_len > len) {
+        res = -ENOBUFS;
+        goto out;
+    }
+    res = _read(kvs, _loc_sector(loc), _loc_offset(loc) + sizeof(hdr) + key_len,
+                value, hdr.val_len);
+    if (res == 0) {
+        res = hdr.val_len;
+    }
+out:
+    mutex_unlock(&kvs->lock);
+    return res;
+}
+
+static int _is_equal(mtd_kvs_t *kvs, uint32_t loc, const _entry_hdr_t *hdr,
+                     const void *value, size_t len)
+{
+    uint8_t chunk[CHUNK_SIZE];
+    uint32_t offset = _loc_offset(loc) + sizeof(*hdr) + hdr->key_len;
+
+    if ((hdr->type != ENTRY_VALUE) || (hdr->val_len != len)) {
+        return 0;
+    }
+    for (size_t pos = 0; pos < len; pos += CHUNK_SIZE) {
+        size_t n = len - pos;
+        if (n > CHUNK_SIZE) {
+            n = CHUNK_SIZE;
+        }
+        int res = _read(kvs, _loc_sector(loc), offset + pos, chunk, n);
+        if (res < 0) {
+            return res;
+        }
+        if (memcmp(chunk, (const uint8_t *)value + pos, n)) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+int mtd_kvs_set(mtd_kvs_t *kvs, const char *key, const void *value, size_t len)
+{
+    const size_t key_len = strlen(key);
+    const uint32_t hash = _hash(key, key_len);
+    _entry_hdr_t hdr;
+    uint32_t loc;
+    int res;
+
+    if ((key_len == 0) || (key_len > CONFIG_MTD_KVS_KEY_LEN_MAX)) {
+        return -EINVAL;
+    }
+    if ((len > UINT16_MAX) ||
+        (_align(sizeof(hdr) + key_len + len) > kvs->sector_size - SECTOR_HDR_SIZE)) {
+        return -EOVERFLOW;
+    }
+
+    mutex_lock(&kvs->lock);
+    res = _find(kvs, key, key_len, hash, &loc, &hdr);
+    if (res == 0) {
+        /* spare the flash a write of the same value */
+        if ((res = _is_equal(kvs, loc, &hdr, value, len)) != 0) {
+            res = (res < 0) ? res : 0;
+            goto out;
+        }
+    }
+    else if (res != -ENOENT) {
+        goto out;
+    }
+    res = _append(kvs, ENTRY_VALUE, key, key_len, hash, value, len);
+out:
+    mutex_unlock(&kvs->lock);
+    return res;
+}
+
+int mtd_kvs_del(mtd_kvs_t *kvs, const char *key)
+{
+    const size_t key_len = strlen(key);
+    const uint32_t hash = _hash(key, key_len);
+    _entry_hdr_t hdr;
+    uint32_t loc;
+    int res;
+
+    if ((key_len == 0) || (key_len > CONFIG_MTD_KVS_KEY_LEN_MAX)) {
+        return -ENOENT;
+    }
+
+    mutex_lock(&kvs->lock);
+    res = _find(kvs, key, key_len, hash, &loc, &hdr);
+    if ((res == 0) && (hdr.type != ENTRY_VALUE)) {
+        res = -ENOENT;
+    }
+    if (res == 0) {
+        res = _append(kvs, ENTRY_DELETED, key, key_len, hash, NULL, 0);
+    }
+    mutex_unlock(&kvs->lock);
+    return res;
+}
@@ -0,0 +1,464 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_mtd_log
+ * @{
+ *
+ * @file
+ * @brief       Circular, append-only log of timestamped records on MTD
+ *
+ * @}
+ */
+
+#include <assert.h>
+#include <errno.h>
+#include <inttypes.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "checksum/crc16_ccitt.h"
+#include "mtd_log.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+#define SECTOR_MAGIC    (0x474f4c4dU)   /* "MLOG" */
+#define NO_RECORDS      (UINT32_MAX)    /* first timestamp of empty sectors */
+#define RECORD_LEN_MAX  (UINT16_MAX - 1)
+
+typedef struct {
+    uint32_t magic;
+    uint32_t seq;
+    uint16_t crc;
+} _sector_hdr_t;
+
+typedef struct {
+    uint16_t len;
+    uint16_t crc;
+    uint32_t timestamp;
+} _record_hdr_t;
+
+static_assert(sizeof(_record_hdr_t) == MTD_LOG_RECORD_HDR,
+              "unexpected record header size");
+
+static uint32_t _align(uint32_t n)
+{
+    return (n + MTD_LOG_ALIGN - 1) & ~(MTD_LOG_ALIGN - 1);
+}
+
+#define SECTOR_HDR_SIZE _align(sizeof(_sector_hdr_t))
+
+static uint32_t _page(const mtd_log_t *log, uint32_t sector)
+{
+    return (log->first_sector + sector) * log->mtd->pages_per_sector;
+}
+
+static int _read(const mtd_log_t *log, uint32_t sector, uint32_t offset,
+                 void *buf, size_t len)
+{
+    return mtd_read_page(log->mtd, buf, _page(log, sector), offset, len);
+}
+
+static int _write(const mtd_log_t *log, uint32_t sector, uint32_t offset,
+                  const void *buf, size_t len)
+{
+    return mtd_write_page_raw(log->mtd, buf, _page(log, sector), offset, len);
+}
+
+static uint32_t _next(const mtd_log_t *log, uint32_t sector)
+{
+    return (sector + 1 < log->sectors) ? sector + 1 : 0;
+}
+
+static bool _is_erased(const void *buf, size_t len)
+{
+    const uint8_t *p = buf;
+
+    for (size_t i = 0; i < len; i++) {
+        if (p[i] != 0xff) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static uint16_t _sector_crc(const _sector_hdr_t *hdr)
+{
+    uint16_t crc = crc16_ccitt_false_update(0xffff, (void *)&hdr->magic,
+                                            sizeof(hdr->magic));
+    return crc16_ccitt_false_update(crc, (void *)&hdr->seq, sizeof(hdr->seq));
+}
+
+/* records are bound to the sector they were written to, so stale records of
+ * an earlier use of the sector never pass as valid */
+static uint16_t _record_crc(uint32_t seq, const _record_hdr_t *hdr)
+{
+    uint16_t crc = crc16_ccitt_false_update(0xffff, (void *)&seq, sizeof(seq));
+    crc = crc16_ccitt_false_update(crc, (void *)&hdr->len, sizeof(hdr->len));
+    return crc16_ccitt_false_update(crc, (void *)&hdr->timestamp,
+                                    sizeof(hdr->timestamp));
+}
+
+static int _sector_seq(const mtd_log_t *log, uint32_t sector, uint32_t *seq)
+{
+    _sector_hdr_t hdr;
+    int res = _read(log, sector, 0, &hdr, sizeof(hdr));
+
+    if (res < 0) {
+        return res;
+    }
+    if ((hdr.magic == SECTOR_MAGIC) && (hdr.crc == _sector_crc(&hdr))) {
+        *seq = hdr.seq;
+    }
+    else {
+        *seq = 0;
+    }
+    return 0;
+}
+
+/**
+ * @brief   Checks the record at @p offset of @p sector
+ *
+ * If @p buf is large enough, the record data is read into it.
+ *
+ * @return  1 if the record is valid
+ * @return  0 if there are no more records in the sector
+ * @return  -EBADMSG if the record is corrupted, e.g. by a power failure
+ * @return  -ENOBUFS if @p buf is given, but too small
+ */
+static int _check_record(const mtd_log_t *log, uint32_t sector, uint32_t seq,
+                         uint32_t offset, _record_hdr_t *hdr,
+                         void *buf, size_t len)
+{
+    int res;
+
+    if (offset + sizeof(*hdr) > log->sector_size) {
+        return 0;
+    }
+    if ((res = _read(log, sector, offset, hdr, sizeof(*hdr))) < 0) {
+        return res;
+    }
+    if (_is_erased(hdr, sizeof(*hdr))) {
+        return 0;
+    }
+    if (hdr->len > log->sector_size - offset - sizeof(*hdr)) {
+        return -EBADMSG;
+    }
+
+    uint16_t crc = _record_crc(seq, hdr);
+    offset += sizeof(*hdr);
+    if (buf != NULL) {
+        if (hdr->len > len) {
+            return -ENOBUFS;
+        }
+        if ((res = _read(log, sector, offset, buf, hdr->len)) < 0) {
+            return res;
+        }
+        crc = crc16_ccitt_false_update(crc, buf, hdr->len);
+    }
+    else {
+        uint8_t chunk[32];
+        for (uint32_t pos = 0; pos < hdr->len; pos += sizeof(chunk)) {
+            size_t n = hdr->len - pos;
+            if (n > sizeof(chunk)) {
+                n = sizeof(chunk);
+            }
+            if ((res = _read(log, sector, offset + pos, chunk, n)) < 0) {
+                return res;
+            }
+            crc = crc16_ccitt_false_update(crc, chunk, n);
+        }
+    }
+    return (crc == hdr->crc) ? 1 : -EBADMSG;
+}
+
+static int _open(mtd_log_t *log, uint32_t sector, uint32_t seq)
+{
+    _sector_hdr_t hdr = { .magic = SECTOR_MAGIC, .seq = seq };
+    uint8_t tmp[SECTOR_HDR_SIZE];
+    int res;
+
+    DEBUG("mtd_log: open sector %" PRIu32 ", seq %" PRIu32 "\n", sector, seq);
+    /* the sector is gone, no matter if the erase succeeds */
+    log->index[sector].seq = 0;
+    log->index[sector].first = NO_RECORDS;
+    if ((res = mtd_erase_sector(log->mtd, log->first_sector + sector, 1)) < 0) {
+        return res;
+    }
+    hdr.crc = _sector_crc(&hdr);
+    memset(tmp, 0xff, sizeof(tmp));
+    memcpy(tmp, &hdr, sizeof(hdr));
+    if ((res = _write(log, sector, 0, tmp, sizeof(tmp))) < 0) {
+        return res;
+    }
+    log->index[sector].seq = seq;
+    log->head = sector;
+    log->offset = SECTOR_HDR_SIZE;
+    return 0;
+}
+
+/* gets the sector of the oldest record */
+static uint32_t _oldest(const mtd_log_t *log)
+{
+    uint32_t sector = _next(log, log->head);
+
+    /* skip sectors erased, but not opened before a power failure */
+    while ((sector != log->head) && (log->index[sector].seq == 0)) {
+        sector = _next(log, sector);
+    }
+    return sector;
+}
+
+static void _set(const mtd_log_t *log, mtd_log_cursor_t *cur, uint32_t sector)
+{
+    cur->sector = sector;
+    cur->offset = SECTOR_HDR_SIZE;
+    cur->seq = log->index[sector].seq;
+}
+
+/* moves the cursor to the next valid record and gets its header */
+static int _peek(const mtd_log_t *log, mtd_log_cursor_t *cur,
+                 _record_hdr_t *hdr, void *buf, size_t len)
+{
+    while (1) {
+        if (log->index[cur->sector].seq != cur->seq) {
+            DEBUG("mtd_log: sector %" PRIu32 " was overwritten\n", cur->sector);
+            _set(log, cur, _oldest(log));
+        }
+        if ((cur->sector == log->head) && (cur->offset >= log->offset)) {
+            return -ENOENT;
+        }
+
+        int res = _check_record(log, cur->sector, cur->seq, cur->offset,
+                                hdr, buf, len);
+        if (res == 1) {
+            return 0;
+        }
+        if ((res < 0) && (res != -EBADMSG)) {
+            return res;
+        }
+        /* the rest of the sector holds no valid records */
+        if (cur->sector == log->head) {
+            return -ENOENT;
+        }
+        uint32_t sector = _next(log, cur->sector);
+        while ((sector != log->head) && (log->index[sector].seq == 0)) {
+            sector = _next(log, sector);
+        }
+        _set(log, cur, sector);
+    }
+}
+
+int mtd_log_init(mtd_log_t *log)
+{
+    mtd_dev_t *mtd = log->mtd;
+    uint32_t max_seq = 0;
+    int res;
+
+    assert((log->index != NULL) && (log->sectors >= 2));
+    mutex_init(&log->lock);
+    if ((res = mtd_init(mtd)) < 0) {
+        return res;
+    }
+    log->sector_size = mtd->pages_per_sector * mtd->page_size;
+    if ((log->first_sector + log->sectors > mtd->sector_count) ||
+        (mtd->write_size > MTD_LOG_ALIGN) ||
+        (MTD_LOG_ALIGN % mtd->write_size) ||
+        (log->sector_size < SECTOR_HDR_SIZE + _align(MTD_LOG_RECORD_HDR + 1))) {
+        DEBUG("mtd_log: unsuitable MTD device\n");
+        return -ENOTSUP;
+    }
+
+    mutex_lock(&log->lock);
+    for (uint32_t i = 0; i < log->sectors; i++) {
+        mtd_log_sector_t *entry = &log->index[i];
+        _record_hdr_t hdr;
+
+        if ((res = _sector_seq(log, i, &entry->seq)) < 0) {
+            goto out;
+        }
+        entry->first = NO_RECORDS;
+        if (entry->seq == 0) {
+            continue;
+        }
+        res = _check_record(log, i, entry->seq, SECTOR_HDR_SIZE, &hdr, NULL, 0);
+        if (res == 1) {
+            entry->first = hdr.timestamp;
+        }
+        else if ((res < 0) && (res != -EBADMSG)) {
+            goto out;
+        }
+        if (entry->seq > max_seq) {
+            max_seq = entry->seq;
+            log->head = i;
+        }
+    }
+
+    if (max_seq == 0) {
+        DEBUG("mtd_log: no log found, starting a new one\n");
+        res = _open(log, 0, 1);
+        goto out;
+    }
+
+    /* find the end of the log in the newest sector */
+    log->offset = SECTOR_HDR_SIZE;
+    while (1) {
+        _record_hdr_t hdr;
+
+        res = _check_record(log, log->head, max_seq, log->offset, &hdr, NULL, 0);
+        if (res == 1) {
+            log->offset += _align(sizeof(hdr) + hdr.len);
+            continue;
+        }
+        if (res == -EBADMSG) {
+            /* torn record, nothing can be written after it */
+            DEBUG("mtd_log: corrupted record at %" PRIu32 "\n", log->offset);
+            log->offset = log->sector_size;
+            res = 0;
+        }
+        break;
+    }
+    DEBUG("mtd_log: continue in sector %" PRIu32 " at %" PRIu32 "\n",
+          log->head, log->offset);
+out:
+    mutex_unlock(&log->lock);
+    return (res < 0) ? res : 0;
+}
+
+int mtd_log_append(mtd_log_t *log, uint32_t timestamp,
+                   const void *data, size_t len)
+{
+    const uint32_t size = _align(sizeof(_record_hdr_t) + len);
+    _record_hdr_t hdr = { .len = len, .timestamp = timestamp };
+    int res = 0;
+
+    if ((len > RECORD_LEN_MAX) ||
+        (size > log->sector_size - SECTOR_HDR_SIZE)) {
+        return -EOVERFLOW;
+    }
+
+    mutex_lock(&log->lock);
+    if (log->offset + size > log->sector_size) {
+        uint32_t seq = log->index[log->head].seq + 1;
+        if ((res = _open(log, _next(log, log->head), seq)) < 0) {
+            goto out;
+        }
+    }
+
+    const uint32_t offset = log->offset;
+    const size_t aligned = len & ~(MTD_LOG_ALIGN - 1);
+
+    hdr.crc = crc16_ccitt_false_update(_record_crc(log->index[log->head].seq,
+                                                   &hdr),
+                                       data, len);
+    /* if anything below fails, the sector can't be appended to anymore */
+    log->offset = log->sector_size;
+    /* header first: a record torn by a power failure is never mistaken for
+     * the end of the log */
+    if ((res = _write(log, log->head, offset, &hdr, sizeof(hdr))) < 0) {
+        goto out;
+    }
+    if (aligned && (res = _write(log, log->head, offset + sizeof(hdr),
+                                 data, aligned)) < 0) {
+        goto out;
+    }
+    if (aligned < len) {
+        uint8_t tail[MTD_LOG_ALIGN];
+
+        memset(tail, 0xff, sizeof(tail));
+        memcpy(tail, (const uint8_t *)data + aligned, len - aligned);
+        if ((res = _write(log, log->head, offset + sizeof(hdr) + aligned,
+                          tail, sizeof(tail))) < 0) {
+            goto out;
+        }
+    }
+    if (offset == SECTOR_HDR_SIZE) {
+        log->index[log->head].first = timestamp;
+    }
+    log->offset = offset + size;
+out:
+    mutex_unlock(&log->lock);
+    return res;
+}
+
+void mtd_log_rewind(mtd_log_t *log, mtd_log_cursor_t *cur)
+{
+    mutex_lock(&log->lock);
+    _set(log, cur, _oldest(log));
+    mutex_unlock(&log->lock);
+}
+
+int mtd_log_seek(mtd_log_t *log, mtd_log_cursor_t *cur, uint32_t timestamp)
+{
+    _record_hdr_t hdr;
+    int res;
+
+    mutex_lock(&log->lock);
+    uint32_t sector = _oldest(log);
+    _set(log, cur, sector);
+    /* the records are sorted, so only the last sector starting before
+     * timestamp has to be searched */
+    while (1) {
+        const mtd_log_sector_t *entry = &log->index[sector];
+        if ((entry->seq != 0) && (entry->first != NO_RECORDS) &&
+            (entry->first <= timestamp)) {
+            _set(log, cur, sector);
+        }
+        if (sector == log->head) {
+            break;
+        }
+        sector = _next(log, sector);
+    }
+    while ((res = _peek(log, cur, &hdr, NULL, 0)) == 0) {
+        if (hdr.timestamp >= timestamp) {
+            break;
+        }
+        cur->offset += _align(sizeof(hdr) + hdr.len);
+    }
+    mutex_unlock(&log->lock);
+    return res;
+}
+
+int mtd_log_read(mtd_log_t *log, mtd_log_cursor_t *cur, uint32_t *timestamp,
+                 void *buf, size_t len)
+{
+    _record_hdr_t hdr;
+    int res;
+
+    mutex_lock(&log->lock);
+    if ((res = _peek(log, cur, &hdr, buf, len)) == 0) {
+        if (timestamp) {
+            *timestamp = hdr.timestamp;
+        }
+        cur->offset += _align(sizeof(hdr) + hdr.len);
+        res = hdr.len;
+    }
+    mutex_unlock(&log->lock);
+    return res;
+}
+
+int mtd_log_clear(mtd_log_t *log)
+{
+    int res;
+
+    mutex_lock(&log->lock);
+    /* continue the sequence, so cursors notice the log is gone */
+    uint32_t seq = log->index[log->head].seq + 1;
+    for (uint32_t i = 0; i < log->sectors; i++) {
+        log->index[i].seq = 0;
+        log->index[i].first = NO_RECORDS;
+    }
+    /* the first sector is erased when it is opened */
+    res = mtd_erase_sector(log->mtd, log->first_sector + 1, log->sectors - 1);
+    if (res == 0) {
+        res = _open(log, 0, seq);
+    }
+    mutex_unlock(&log->lock);
+    return res;
+}
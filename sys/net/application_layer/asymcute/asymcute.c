@@ -134,7 +134,7 @@ static asymcute_req_t *_req_preprocess(asymcute_con_t *con,
     if (iter == NULL) {
         return NULL;
     }
-    if (iter->msg_id == msg_id) {
+    if ((iter->msg_id == msg_id) && (_req_type(iter) == rtype)) {
         res = iter;
         con->pending = iter->next;
     }
@@ -200,29 +200,65 @@ static ssize_t _req_resend(asymcute_req_t *req, asymcute_con_t *con, int initial
     return n;
 }
 
-/* @pre con is locked */
-static int _req_send(asymcute_req_t *req, asymcute_con_t *con,
+static void _req_init(asymcute_req_t *req, asymcute_con_t *con,
                       asymcute_to_cb_t cb)
 {
-    /* initialize request */
     req->con = con;
     req->cb = cb;
     req->retry_cnt = CONFIG_ASYMCUTE_N_RETRY;
     event_callback_init(&req->to_evt, _on_req_timeout, req);
     event_timeout_init(&req->to_timer, &_queue, &req->to_evt.super);
+}
+
+/* @pre con is locked */
+static int _req_send(asymcute_req_t *req, asymcute_con_t *con,
+                      asymcute_to_cb_t cb)
+{
+    /* initialize request */
+    _req_init(req, con, cb);
     /* add request to the pending queue (if non-con request) */
     req->next = con->pending;
     con->pending = req;
     /* send request */
     ssize_t n = _req_resend(req, con, 1);
     if (n < MIN_PKT_LEN) {
-        req->con = NULL;
+        _req_remove(con, req);
         mutex_unlock(&req->lock);
         return ASYMCUTE_SENDERR;
     }
     return ASYMCUTE_OK;
 }
 
+/* @pre con is locked */
+static void _pub_queue(asymcute_req_t *req, asymcute_con_t *con)
+{
+    _req_init(req, con, NULL);
+    req->next = NULL;
+    asymcute_req_t **tail = &con->queued;
+    while (*tail) {
+        tail = &(*tail)->next;
+    }
+    *tail = req;
+}
+
+/* @pre con is locked */
+static void _pub_done(asymcute_con_t *con)
+{
+    assert(con->inflight > 0);
+    con->inflight--;
+    /* move the next queued PUBLISH into the in-flight window */
+    asymcute_req_t *req = con->queued;
+    if (req) {
+        con->queued = req->next;
+        req->next = con->pending;
+        con->pending = req;
+        con->inflight++;
+        /* the request was accepted already, so a failed send is handled like
+         * a lost packet by the retry timer */
+        _req_resend(req, con, 0);
+    }
+}
+
 static int _req_send_once(asymcute_req_t *req, asymcute_con_t *con)
 {
     ssize_t n = sock_udp_send(&con->sock, req->data, req->data_len, NULL);
@@ -255,6 +291,11 @@ static void _disconnect(asymcute_con_t *con, uint8_t state)
             _req_cancel(req);
         }
         con->pending = NULL;
+        for (asymcute_req_t *req = con->queued; req; req = req->next) {
+            _req_cancel(req);
+        }
+        con->queued = NULL;
+        con->inflight = 0;
         for (asymcute_sub_t *sub = con->subscriptions; sub; sub = sub->next) {
             _sub_cancel(sub);
         }
@@ -284,6 +325,9 @@ static void _on_req_timeout(void *arg)
         asymcute_con_t *con = req->con;
         mutex_lock(&con->lock);
         _req_remove(con, req);
+        if (_req_type(req) == MQTTSN_PUBLISH) {
+            _pub_done(con);
+        }
         /* communicate timeout to outer world */
         unsigned ret = ASYMCUTE_TIMEOUT;
         if (req->cb) {
@@ -493,6 +537,8 @@ static void _on_puback(asymcute_con_t *con, const uint8_t *data, size_t len)
         return;
     }
 
+    _pub_done(con);
+
     unsigned ret = (data[6] == MQTTSN_ACCEPTED) ?
                     ASYMCUTE_PUBLISHED : ASYMCUTE_REJECTED;
     mutex_unlock(&req->lock);
@@ -912,7 +958,15 @@ int asymcute_publish(asymcute_con_t *con, asymcute_req_t *req,
 
     /* publish selected data */
     if (flags & MQTTSN_QOS_1) {
-        ret = _req_send(req, con, NULL);
+        if (con->inflight >= CONFIG_ASYMCUTE_INFLIGHT_MAX) {
+            _pub_queue(req, con);
+        }
+        else {
+            ret = _req_send(req, con, NULL);
+            if (ret == ASYMCUTE_OK) {
+                con->inflight++;
+            }
+        }
     }
     else {
         ret = _req_send_once(req, con);
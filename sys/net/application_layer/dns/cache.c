@@ -24,6 +24,11 @@
 #include "net/ipv6/addr.h"
 #include "time_units.h"
 #include "ztimer.h"
+#if IS_USED(MODULE_DNS_CACHE_VFS)
+#include <errno.h>
+#include <fcntl.h>
+#include "vfs.h"
+#endif
 
 #define ENABLE_DEBUG 0
 #include "debug.h"
@@ -31,6 +36,9 @@
 static struct dns_cache_entry {
     uint32_t hash;
     uint32_t expires;
+#if IS_USED(MODULE_DNS_CACHE_PREFETCH)
+    uint32_t refresh;   /* time from which on a refresh is due */
+#endif
     union {
 #if IS_ACTIVE(CONFIG_DNS_CACHE_A)
         ipv4_addr_t v4;
@@ -118,14 +126,12 @@ static uint32_t _hash(const void *data, size_t len)
     return fletcher32(data, (len + 1) / 2);
 }
 
-int dns_cache_query(const char *domain_name, void *addr_out, int family)
+/* must be called with cache_mutex held, returns the index of the entry or -1 */
+static int _find(const char *domain_name, int family, uint32_t now)
 {
-    int res = 0;
-    uint32_t now = ztimer_now(ZTIMER_MSEC) / MS_PER_SEC;
     uint32_t hash = _hash(domain_name, strlen(domain_name));
     uint8_t addr_len = _addr_len(family);
 
-    mutex_lock(&cache_mutex);
     for (unsigned i = 0; i < CONFIG_DNS_CACHE_SIZE; ++i) {
         /* empty slot */
         if (_is_empty(i)) {
@@ -139,57 +145,92 @@ int dns_cache_query(const char *domain_name, void *addr_out, int family)
         }
         /* check if hash and length match */
         if (cache[i].hash == hash && (!addr_len || addr_len == _get_len(i))) {
-            DEBUG("dns_cache[%u] hit\n", i);
-            memcpy(addr_out, &cache[i].addr, _get_len(i));
-            res = _get_len(i);
-            break;
+            return i;
         }
     }
-    if (res == 0) {
+    return -1;
+}
+
+int dns_cache_query(const char *domain_name, void *addr_out, int family)
+{
+    int res = 0;
+    uint32_t now = ztimer_now(ZTIMER_MSEC) / MS_PER_SEC;
+
+    mutex_lock(&cache_mutex);
+    int i = _find(domain_name, family, now);
+    if (i >= 0) {
+        DEBUG("dns_cache[%u] hit\n", i);
+        memcpy(addr_out, &cache[i].addr, _get_len(i));
+        res = _get_len(i);
+    }
+    else {
         DEBUG("dns_cache miss\n");
     }
     mutex_unlock(&cache_mutex);
     return res;
 }
 
+#if IS_USED(MODULE_DNS_CACHE_PREFETCH)
+bool dns_cache_refresh_due(const char *domain_name, int family)
+{
+    bool res = false;
+    uint32_t now = ztimer_now(ZTIMER_MSEC) / MS_PER_SEC;
+
+    mutex_lock(&cache_mutex);
+    int i = _find(domain_name, family, now);
+    if ((i >= 0) && (now >= cache[i].refresh)) {
+        DEBUG("dns_cache[%u] refresh due\n", i);
+        /* only report once, the entry expires as usual if no refresh comes */
+        cache[i].refresh = UINT32_MAX;
+        res = true;
+    }
+    mutex_unlock(&cache_mutex);
+    return res;
+}
+#endif
+
+static void _set_expires(uint8_t i, uint32_t now, uint32_t ttl)
+{
+    cache[i].expires = now + ttl;
+#if IS_USED(MODULE_DNS_CACHE_PREFETCH)
+    cache[i].refresh = cache[i].expires -
+                       ((uint64_t)ttl * CONFIG_DNS_CACHE_PREFETCH_PERCENT) / 100;
+#endif
+}
+
 static void _add_entry(uint8_t i, uint32_t hash, const void *addr_out,
-                       int addr_len, uint32_t expires)
+                       int addr_len, uint32_t now, uint32_t ttl)
 {
     DEBUG("dns_cache[%u] add cache entry\n", i);
     cache[i].hash = hash;
-    cache[i].expires = expires;
+    _set_expires(i, now, ttl);
     memcpy(&cache[i].addr, addr_out, addr_len);
     _set_len(i, addr_len);
 }
 
-void dns_cache_add(const char *domain_name, const void *addr_out,
-                        int addr_len, uint32_t ttl)
+/* must be called with cache_mutex held */
+static void _add(uint32_t hash, const void *addr_out, int addr_len, uint32_t ttl)
 {
     uint32_t now = ztimer_now(ZTIMER_MSEC) / MS_PER_SEC;
-    uint32_t hash = _hash(domain_name, strlen(domain_name));
     uint32_t oldest = ttl;
     int idx = -1;
 
-    assert(addr_len == 4 || addr_len == 16);
-    DEBUG("dns_cache: lifetime of %s is %"PRIu32" s\n", domain_name, ttl);
-
-    mutex_lock(&cache_mutex);
     /* iterate even if TTL = 0 just in case we need to expire */
     for (unsigned i = 0; i < CONFIG_DNS_CACHE_SIZE; ++i) {
         if (ttl && (now > cache[i].expires || _is_empty(i))) {
-            _add_entry(i, hash, addr_out, addr_len, now + ttl);
-            goto exit;
+            _add_entry(i, hash, addr_out, addr_len, now, ttl);
+            return;
         }
         if (cache[i].hash == hash && _get_len(i) == addr_len) {
             DEBUG("dns_cache[%u] update ttl\n", i);
             if (ttl) {
-                cache[i].expires = now + ttl;
+                _set_expires(i, now, ttl);
             }
             else {
                 /* put one second into past so that it is immediately expired */
                 cache[i].expires = now - 1;
             }
-            goto exit;
+            return;
         }
         uint32_t _ttl = cache[i].expires - now;
         if (_ttl < oldest) {
@@ -200,8 +241,88 @@ void dns_cache_add(const char *domain_name, const void *addr_out,
 
     if (ttl && idx >= 0) {
         DEBUG("dns_cache: evict first entry to expire\n");
-        _add_entry(idx, hash, addr_out, addr_len, now + ttl);
+        _add_entry(idx, hash, addr_out, addr_len, now, ttl);
+    }
+}
+
+void dns_cache_add(const char *domain_name, const void *addr_out,
+                        int addr_len, uint32_t ttl)
+{
+    assert(addr_len == 4 || addr_len == 16);
+    DEBUG("dns_cache: lifetime of %s is %"PRIu32" s\n", domain_name, ttl);
+
+    mutex_lock(&cache_mutex);
+    _add(_hash(domain_name, strlen(domain_name)), addr_out, addr_len, ttl);
+    mutex_unlock(&cache_mutex);
+}
+
+#if IS_USED(MODULE_DNS_CACHE_VFS)
+#define DNS_CACHE_VFS_MAGIC     (0x444e5343)    /* "DNSC" */
+
+/* Entry as stored in a file */
+typedef struct {
+    uint32_t hash;
+    uint32_t ttl;           /* remaining lifetime in seconds */
+    uint8_t len;
+    uint8_t addr[16];
+} _vfs_entry_t;
+
+int dns_cache_save(const char *path)
+{
+    uint32_t now = ztimer_now(ZTIMER_MSEC) / MS_PER_SEC;
+    uint32_t magic = DNS_CACHE_VFS_MAGIC;
+    int res, fd = vfs_open(path, O_CREAT | O_WRONLY | O_TRUNC, 0);
+
+    if (fd < 0) {
+        return fd;
+    }
+
+    mutex_lock(&cache_mutex);
+    res = vfs_write(fd, &magic, sizeof(magic));
+    for (unsigned i = 0; (res >= 0) && (i < CONFIG_DNS_CACHE_SIZE); ++i) {
+        if (_is_empty(i) || (now >= cache[i].expires)) {
+            continue;
+        }
+
+        _vfs_entry_t entry = {
+            .hash = cache[i].hash,
+            .ttl = cache[i].expires - now,
+            .len = _get_len(i),
+        };
+        memcpy(entry.addr, &cache[i].addr, entry.len);
+        res = vfs_write(fd, &entry, sizeof(entry));
     }
-exit:
     mutex_unlock(&cache_mutex);
+
+    vfs_close(fd);
+    return (res < 0) ? res : 0;
 }
+
+int dns_cache_load(const char *path)
+{
+    uint32_t magic;
+    _vfs_entry_t entry;
+    int res, fd = vfs_open(path, O_RDONLY, 0);
+
+    if (fd < 0) {
+        return fd;
+    }
+
+    res = vfs_read(fd, &magic, sizeof(magic));
+    if ((res >= 0) && ((res != sizeof(magic)) || (magic != DNS_CACHE_VFS_MAGIC))) {
+        res = -EINVAL;
+    }
+
+    mutex_lock(&cache_mutex);
+    while ((res >= 0) &&
+           ((res = vfs_read(fd, &entry, sizeof(entry))) == sizeof(entry))) {
+        if (_addr_len(entry.len == 16 ? AF_INET6 : AF_INET) == entry.len) {
+            _add(entry.hash, entry.addr, entry.len, entry.ttl);
+        }
+    }
+    mutex_unlock(&cache_mutex);
+
+    vfs_close(fd);
+    return (res < 0) ? res : 0;
+}
+#endif
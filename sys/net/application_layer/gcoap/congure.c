@@ -0,0 +1,278 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     net_gcoap
+ * @{
+ *
+ * @file
+ * @brief       Congestion control of confirmable requests
+ *
+ * Retransmission timeouts follow CoCoA (draft-ietf-core-cocoa-03): a strong
+ * estimator of RFC 6298 (K = 4) is fed by exchanges without resends, a weak
+ * one (K = 1) by exchanges with one or two resends, measured from the first
+ * transmission. Both are blended into the overall RTO of the peer, which is
+ * backed off by a factor depending on its value and aged while unused.
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <inttypes.h>
+#include <string.h>
+
+#include "mutex.h"
+#include "net/sock/util.h"
+#include "random.h"
+#include "ztimer.h"
+
+#include "gcoap_congure.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+/* Upper bound of the overall RTO, as in RFC 6298 */
+#define RTO_MAX_MS      (60000UL)
+/* Below, the backoff factor is 3 and the RTO is doubled while unused */
+#define RTO_SMALL_MS    (1000UL)
+/* Above, the backoff factor is 1.5 and the RTO converges back while unused */
+#define RTO_LARGE_MS    (3000UL)
+
+static mutex_t _lock = MUTEX_INIT;
+static gcoap_congure_peer_t _peers[CONFIG_GCOAP_CONGURE_PEERS_NUMOF];
+
+static gcoap_congure_peer_t *_peer_get(const sock_udp_ep_t *remote,
+                                       uint32_t now)
+{
+    gcoap_congure_peer_t *peer = NULL;
+
+    for (unsigned i = 0; i < ARRAY_SIZE(_peers); i++) {
+        if (_peers[i].congure && sock_udp_ep_equal(&_peers[i].remote, remote)) {
+            return &_peers[i];
+        }
+    }
+    /* take a free slot or replace the least recently used idle peer */
+    for (unsigned i = 0; i < ARRAY_SIZE(_peers); i++) {
+        if (_peers[i].congure == NULL) {
+            peer = &_peers[i];
+            break;
+        }
+        if ((_peers[i].in_flight == 0) &&
+            (!peer || ((now - _peers[i].last_used) > (now - peer->last_used)))) {
+            peer = &_peers[i];
+        }
+    }
+    if (peer == NULL) {
+        return NULL;
+    }
+
+    congure_snd_t *congure = peer->congure;
+
+    if ((congure == NULL) && ((congure = _gcoap_congure_snd_alloc()) == NULL)) {
+        return NULL;
+    }
+    memset(peer, 0, sizeof(*peer));
+    peer->remote = *remote;
+    peer->congure = congure;
+    peer->rto = CONFIG_COAP_ACK_TIMEOUT_MS;
+    peer->rto_updated = now;
+    congure->driver->init(congure, peer);
+    DEBUG("gcoap_congure: new peer %u\n", (unsigned)index_of(_peers, peer));
+    return peer;
+}
+
+static void _age(gcoap_congure_peer_t *peer, uint32_t now)
+{
+    uint32_t idle = now - peer->rto_updated;
+
+    if ((peer->rto < RTO_SMALL_MS) && (idle > (16 * peer->rto))) {
+        peer->rto *= 2;
+        peer->rto_updated = now;
+    }
+    else if ((peer->rto > RTO_LARGE_MS) && (idle > (4 * peer->rto))) {
+        peer->rto = (CONFIG_COAP_ACK_TIMEOUT_MS + peer->rto) / 2;
+        peer->rto_updated = now;
+    }
+}
+
+static uint32_t _estimate(gcoap_congure_rtt_t *e, uint32_t rtt, unsigned k)
+{
+    /* see https://tools.ietf.org/html/rfc6298#section-2, in 1/8 ms */
+    rtt <<= 3;
+    if ((e->srtt == 0) && (e->rttvar == 0)) {
+        e->srtt = rtt;
+        e->rttvar = rtt / 2;
+    }
+    else {
+        uint32_t delta = (e->srtt > rtt) ? (e->srtt - rtt) : (rtt - e->srtt);
+
+        e->rttvar = e->rttvar - (e->rttvar / 4) + (delta / 4);
+        e->srtt = e->srtt - (e->srtt / 8) + (rtt / 8);
+    }
+    return (e->srtt + (k * e->rttvar)) >> 3;
+}
+
+static unsigned _resends(const gcoap_request_memo_t *memo)
+{
+    return CONFIG_COAP_MAX_RETRANSMIT - memo->send_limit;
+}
+
+static void _report_timeout(gcoap_request_memo_t *memo, unsigned resends)
+{
+    congure_snd_t *congure = memo->congure_peer->congure;
+    congure_snd_msg_t msg = {
+        .send_time = memo->send_time,
+        .size = 1,
+        .resends = resends,
+    };
+
+    msg.super.next = &msg.super;
+    congure->driver->report_msgs_timeout(congure, &msg);
+}
+
+static void _unlink(gcoap_request_memo_t *memo)
+{
+    memo->congure_peer->in_flight--;
+    memo->congure_peer = NULL;
+}
+
+int _gcoap_congure_request(gcoap_request_memo_t *memo, uint32_t *timeout)
+{
+    uint32_t now = ztimer_now(ZTIMER_MSEC);
+    gcoap_congure_peer_t *peer;
+    int res = 0;
+
+    mutex_lock(&_lock);
+    memo->congure_peer = NULL;
+    if ((peer = _peer_get(&memo->remote_ep, now)) == NULL) {
+        DEBUG("gcoap_congure: no state left, using default timeouts\n");
+    }
+    else if (peer->in_flight >= peer->congure->cwnd) {
+        DEBUG("gcoap_congure: %u requests in flight, window full\n",
+              peer->in_flight);
+        res = -EAGAIN;
+    }
+    else {
+        uint32_t end;
+
+        _age(peer, now);
+        end = (peer->rto * CONFIG_COAP_RANDOM_FACTOR_1000) / 1000;
+        memo->rto = peer->rto;
+        if (end > peer->rto) {
+            memo->rto = random_uint32_range(peer->rto, end);
+        }
+        memo->send_time = now;
+        memo->congure_peer = peer;
+        peer->last_used = now;
+        peer->in_flight++;
+        peer->congure->driver->report_msg_sent(peer->congure, 1);
+        *timeout = memo->rto;
+    }
+    mutex_unlock(&_lock);
+    return res;
+}
+
+uint32_t _gcoap_congure_resend(gcoap_request_memo_t *memo, uint32_t timeout)
+{
+    gcoap_congure_peer_t *peer = memo->congure_peer;
+
+    if (peer == NULL) {
+        return timeout;
+    }
+
+    unsigned resends = _resends(memo);
+
+    mutex_lock(&_lock);
+    _report_timeout(memo, resends - 1);
+    peer->congure->driver->report_msg_sent(peer->congure, 1);
+    mutex_unlock(&_lock);
+
+    timeout = memo->rto;
+#ifndef CONFIG_GCOAP_NO_RETRANS_BACKOFF
+    /* variable backoff factor of CoCoA, in percent */
+    unsigned vbf = (memo->rto < RTO_SMALL_MS) ? 300
+                 : (memo->rto > RTO_LARGE_MS) ? 150 : 200;
+
+    while (resends--) {
+        timeout = (timeout * vbf) / 100;
+    }
+#endif
+    return timeout;
+}
+
+void _gcoap_congure_report_reply(gcoap_request_memo_t *memo)
+{
+    gcoap_congure_peer_t *peer = memo->congure_peer;
+
+    if (peer == NULL) {
+        return;
+    }
+
+    uint32_t now = ztimer_now(ZTIMER_MSEC);
+    uint32_t rtt = now - memo->send_time;
+    unsigned resends = _resends(memo);
+
+    mutex_lock(&_lock);
+    if (resends == 0) {
+        peer->rto = (_estimate(&peer->strong, rtt, 4) + peer->rto) / 2;
+        peer->rto_updated = now;
+    }
+    else if (resends <= 2) {
+        peer->rto = (_estimate(&peer->weak, rtt, 1) + (3 * peer->rto)) / 4;
+        peer->rto_updated = now;
+    }
+    if (peer->rto == 0) {
+        peer->rto = 1;
+    }
+    else if (peer->rto > RTO_MAX_MS) {
+        peer->rto = RTO_MAX_MS;
+    }
+    DEBUG("gcoap_congure: RTT %" PRIu32 " ms, %u resends, RTO %" PRIu32 " ms\n",
+          rtt, resends, peer->rto);
+
+    congure_snd_msg_t msg = {
+        .send_time = memo->send_time,
+        .size = 1,
+        .resends = resends,
+    };
+    congure_snd_ack_t ack = {
+        .recv_time = now,
+        .id = peer->acks++,
+        .clean = 1,
+    };
+
+    peer->congure->driver->report_msg_acked(peer->congure, &msg, &ack);
+    _unlink(memo);
+    mutex_unlock(&_lock);
+}
+
+void _gcoap_congure_report_timeout(gcoap_request_memo_t *memo)
+{
+    if (memo->congure_peer == NULL) {
+        return;
+    }
+
+    mutex_lock(&_lock);
+    _report_timeout(memo, _resends(memo));
+    _unlink(memo);
+    mutex_unlock(&_lock);
+}
+
+void _gcoap_congure_release(gcoap_request_memo_t *memo)
+{
+    gcoap_congure_peer_t *peer = memo->congure_peer;
+
+    if (peer == NULL) {
+        return;
+    }
+
+    mutex_lock(&_lock);
+    peer->congure->driver->report_msg_discarded(peer->congure, 1);
+    _unlink(memo);
+    mutex_unlock(&_lock);
+}
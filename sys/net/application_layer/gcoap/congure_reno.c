@@ -0,0 +1,132 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     net_gcoap
+ * @{
+ *
+ * @file
+ * @brief       TCP Reno as congestion control backend for gcoap
+ *
+ * The window counts confirmable requests. It starts at @ref COAP_NSTART and
+ * grows by one request per reply up to @ref CONFIG_GCOAP_REQ_WAITING_MAX,
+ * as more requests cannot be in flight at once anyway.
+ *
+ * @}
+ */
+
+#include "mutex.h"
+#include "congure/reno.h"
+
+#include "gcoap_congure.h"
+
+static void _init(congure_snd_t *cong, void *ctx);
+static void _report_msg_discarded(congure_snd_t *cong, unsigned msg_size);
+static void _report_msg_acked(congure_snd_t *cong, congure_snd_msg_t *msg,
+                              congure_snd_ack_t *ack);
+static void _fr(congure_reno_snd_t *c);
+static bool _same_wnd_adv(congure_reno_snd_t *c, congure_snd_ack_t *ack);
+static void _cwnd_inc(congure_reno_snd_t *c);
+
+static const congure_snd_driver_t _driver = {
+    .init = _init,
+    .inter_msg_interval = congure_reno_snd_inter_msg_interval,
+    .report_msg_sent = congure_reno_snd_report_msg_sent,
+    .report_msg_discarded = _report_msg_discarded,
+    .report_msgs_timeout = congure_reno_snd_report_msgs_timeout,
+    .report_msgs_lost = congure_reno_snd_report_msgs_lost,
+    .report_msg_acked = _report_msg_acked,
+    .report_ecn_ce = congure_reno_snd_report_ecn_ce,
+};
+
+static const congure_reno_snd_consts_t _consts = {
+    .fr = _fr,
+    .same_wnd_adv = _same_wnd_adv,
+    .ss_cwnd_inc = _cwnd_inc,
+    .ca_cwnd_inc = _cwnd_inc,
+    /* requests are the unit of the window */
+    .init_mss = 1,
+    .cwnd_upper = CONFIG_GCOAP_REQ_WAITING_MAX,
+    .cwnd_lower = 1,
+    .init_ssthresh = CONFIG_GCOAP_REQ_WAITING_MAX,
+    .frthresh = 3,
+};
+
+static mutex_t _lock = MUTEX_INIT;
+static congure_reno_snd_t _states[CONFIG_GCOAP_CONGURE_PEERS_NUMOF];
+
+static void _init(congure_snd_t *cong, void *ctx)
+{
+    congure_reno_snd_t *c = (congure_reno_snd_t *)cong;
+
+    congure_reno_snd_init(cong, ctx);
+    c->in_flight_size = 0;
+    c->super.cwnd = COAP_NSTART;
+}
+
+static void _report_msg_discarded(congure_snd_t *cong, unsigned msg_size)
+{
+    congure_reno_snd_t *c = (congure_reno_snd_t *)cong;
+
+    /* Reno caps the flight size to cwnd when requests are resent after a
+     * timeout, so more requests might be released than Reno deems in flight */
+    if (msg_size > c->in_flight_size) {
+        msg_size = c->in_flight_size;
+    }
+    congure_reno_snd_report_msg_discarded(cong, msg_size);
+}
+
+static void _report_msg_acked(congure_snd_t *cong, congure_snd_msg_t *msg,
+                              congure_snd_ack_t *ack)
+{
+    congure_reno_snd_t *c = (congure_reno_snd_t *)cong;
+
+    /* see _report_msg_discarded() */
+    if (msg->size > c->in_flight_size) {
+        msg->size = c->in_flight_size;
+    }
+    congure_reno_snd_report_msg_acked(cong, msg, ack);
+}
+
+static void _fr(congure_reno_snd_t *c)
+{
+    /* CoAP has no duplicate ACKs, every reply gets a new ACK ID */
+    (void)c;
+}
+
+static bool _same_wnd_adv(congure_reno_snd_t *c, congure_snd_ack_t *ack)
+{
+    /* CoAP does not advertise a window */
+    (void)c;
+    (void)ack;
+    return true;
+}
+
+static void _cwnd_inc(congure_reno_snd_t *c)
+{
+    if (c->super.cwnd < c->consts->cwnd_upper) {
+        c->super.cwnd++;
+    }
+}
+
+congure_snd_t *_gcoap_congure_snd_alloc(void)
+{
+    congure_snd_t *res = NULL;
+
+    mutex_lock(&_lock);
+    for (unsigned i = 0; i < ARRAY_SIZE(_states); i++) {
+        if (_states[i].super.driver == NULL) {
+            _states[i].super.driver = &_driver;
+            _states[i].consts = &_consts;
+            res = &_states[i].super;
+            break;
+        }
+    }
+    mutex_unlock(&_lock);
+    return res;
+}
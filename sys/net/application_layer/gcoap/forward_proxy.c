@@ -19,6 +19,7 @@
 
 #include "event.h"
 #include "kernel_defines.h"
+#include "mutex.h"
 #include "net/gcoap.h"
 #include "net/gcoap/forward_proxy.h"
 #include "uri_parser.h"
@@ -50,6 +51,8 @@ extern void gcoap_forward_proxy_post_event(void *arg);
 
 static uint8_t proxy_req_buf[CONFIG_GCOAP_PDU_BUF_SIZE];
 static client_ep_t _client_eps[CONFIG_GCOAP_REQ_WAITING_MAX];
+/* Protects proxy_req_buf and the allocation of _client_eps with gcoap_workers */
+static mutex_t _lock = MUTEX_INIT;
 
 static int _request_matcher_forward_proxy(gcoap_listener_t *listener,
                                           const coap_resource_t **resource,
@@ -84,6 +87,7 @@ void gcoap_forward_proxy_init(void)
 static client_ep_t *_allocate_client_ep(const sock_udp_ep_t *ep)
 {
     client_ep_t *cep;
+    mutex_lock(&_lock);
     for (cep = _client_eps;
          cep < (_client_eps + CONFIG_GCOAP_REQ_WAITING_MAX);
          cep++) {
@@ -91,9 +95,11 @@ static client_ep_t *_allocate_client_ep(const sock_udp_ep_t *ep)
             _cep_set_in_use(cep);
             _cep_set_req_etag_len(cep, 0);
             memcpy(&cep->ep, ep, sizeof(*ep));
+            mutex_unlock(&_lock);
             return cep;
         }
     }
+    mutex_unlock(&_lock);
     return NULL;
 }
 
@@ -420,6 +426,7 @@ static int _gcoap_forward_proxy_via_coap(coap_pkt_t *client_pkt,
 
     unsigned token_len = coap_get_token_len(client_pkt);
 
+    mutex_lock(&_lock);
     coap_pkt_init(&pkt, proxy_req_buf, CONFIG_GCOAP_PDU_BUF_SIZE,
                   sizeof(coap_hdr_t) + token_len);
 
@@ -435,12 +442,14 @@ static int _gcoap_forward_proxy_via_coap(coap_pkt_t *client_pkt,
     len = _gcoap_forward_proxy_copy_options(&pkt, client_pkt, client_ep, urip);
 
     if (len == -EINVAL) {
+        mutex_unlock(&_lock);
         return -EINVAL;
     }
 
     len = gcoap_req_send((uint8_t *)pkt.hdr, len,
                          &origin_server_ep,
                          _forward_resp_handler, (void *)client_ep);
+    mutex_unlock(&_lock);
     return len;
 }
 
@@ -38,6 +38,8 @@
 #include "thread.h"
 #include "ztimer.h"
 
+#include "gcoap_congure.h"
+
 #if IS_USED(MODULE_GCOAP_DTLS)
 #include "net/sock/dtls.h"
 #include "net/credman.h"
@@ -94,6 +96,7 @@ static int _request_matcher_default(gcoap_listener_t *listener,
 #if IS_USED(MODULE_GCOAP_DTLS)
 static void _on_sock_dtls_evt(sock_dtls_t *sock, sock_async_flags_t type, void *arg);
 static void _dtls_free_up_session(void *arg);
+static void _dtls_close_idle_sessions(void *arg);
 #endif
 
 /* Internal variables */
@@ -134,6 +137,105 @@ static gcoap_state_t _coap_state = {
     .listeners   = &_default_listener,
 };
 
+#if IS_USED(MODULE_GCOAP_INDEX)
+/* Terminates a chain of the index */
+#define GCOAP_INDEX_NONE    (UINT16_MAX)
+
+static_assert(CONFIG_GCOAP_REQ_WAITING_MAX < GCOAP_INDEX_NONE,
+              "CONFIG_GCOAP_REQ_WAITING_MAX too large for gcoap_index");
+static_assert(CONFIG_GCOAP_OBS_REGISTRATIONS_MAX < GCOAP_INDEX_NONE,
+              "CONFIG_GCOAP_OBS_REGISTRATIONS_MAX too large for gcoap_index");
+
+/* Hash chains over the entries of one of the tables in _coap_state, with as
+ * many buckets as the table has entries */
+typedef struct {
+    uint16_t *head;                     /* First entry of each bucket */
+    uint16_t *next;                     /* Next entry in the same bucket */
+    uint16_t *bucket;                   /* Bucket an entry is linked into */
+    uint16_t numof;                     /* Number of entries and buckets */
+} gcoap_index_t;
+
+static uint16_t _req_index_head[CONFIG_GCOAP_REQ_WAITING_MAX];
+static uint16_t _req_index_next[CONFIG_GCOAP_REQ_WAITING_MAX];
+static uint16_t _req_index_bucket[CONFIG_GCOAP_REQ_WAITING_MAX];
+/* Open requests by token */
+static gcoap_index_t _req_index = {
+    _req_index_head, _req_index_next, _req_index_bucket,
+    CONFIG_GCOAP_REQ_WAITING_MAX
+};
+
+static uint16_t _obs_index_head[CONFIG_GCOAP_OBS_REGISTRATIONS_MAX];
+static uint16_t _obs_index_next[CONFIG_GCOAP_OBS_REGISTRATIONS_MAX];
+static uint16_t _obs_index_bucket[CONFIG_GCOAP_OBS_REGISTRATIONS_MAX];
+/* Observe registrations by resource */
+static gcoap_index_t _obs_index = {
+    _obs_index_head, _obs_index_next, _obs_index_bucket,
+    CONFIG_GCOAP_OBS_REGISTRATIONS_MAX
+};
+
+/* FNV-1a hash */
+static uint32_t _index_hash(const void *data, size_t len)
+{
+    const uint8_t *bytes = data;
+    uint32_t hash = 2166136261U;
+
+    while (len--) {
+        hash = (hash ^ *bytes++) * 16777619U;
+    }
+    return hash;
+}
+
+static void _index_init(gcoap_index_t *index)
+{
+    memset(index->head, 0xff, index->numof * sizeof(index->head[0]));
+    memset(index->bucket, 0xff, index->numof * sizeof(index->bucket[0]));
+}
+
+static inline uint16_t _index_first(const gcoap_index_t *index, uint32_t hash)
+{
+    return index->head[hash % index->numof];
+}
+
+static void _index_add(gcoap_index_t *index, unsigned entry, uint32_t hash)
+{
+    unsigned bucket = hash % index->numof;
+
+    index->bucket[entry] = bucket;
+    index->next[entry] = index->head[bucket];
+    index->head[bucket] = entry;
+}
+
+static void _index_del(gcoap_index_t *index, unsigned entry)
+{
+    if (index->bucket[entry] == GCOAP_INDEX_NONE) {
+        return;
+    }
+
+    uint16_t *pos = &index->head[index->bucket[entry]];
+
+    while (*pos != entry) {
+        assert(*pos != GCOAP_INDEX_NONE);
+        pos = &index->next[*pos];
+    }
+    *pos = index->next[entry];
+    index->bucket[entry] = GCOAP_INDEX_NONE;
+}
+#endif
+
+/* Marks a request memo as unused */
+static void _memo_release(gcoap_request_memo_t *memo)
+{
+    _gcoap_congure_release(memo);
+#if IS_USED(MODULE_GCOAP_INDEX)
+    mutex_lock(&_coap_state.lock);
+    _index_del(&_req_index, index_of(_coap_state.open_reqs, memo));
+    memo->state = GCOAP_MEMO_UNUSED;
+    mutex_unlock(&_coap_state.lock);
+#else
+    memo->state = GCOAP_MEMO_UNUSED;
+#endif
+}
+
 static kernel_pid_t _pid = KERNEL_PID_UNDEF;
 static char _msg_stack[GCOAP_STACK_SIZE];
 static event_queue_t _queue;
@@ -150,6 +252,29 @@ static kernel_pid_t _auth_waiting_thread;
 
 static event_timeout_t _dtls_session_free_up_tmout;
 static event_callback_t _dtls_session_free_up_tmout_cb;
+
+static event_timeout_t _dtls_idle_tmout;
+static event_callback_t _dtls_idle_tmout_cb;
+#endif
+
+#if IS_USED(MODULE_GCOAP_WORKERS)
+/* Worker handling a request in its own thread, with its own PDU buffer */
+typedef struct {
+    event_t super;                      /* Event to start handling the request */
+    event_queue_t queue;                /* Queue of the worker thread */
+    atomic_bool busy;                   /* Claimed by the gcoap thread, released
+                                           by the worker when done */
+    gcoap_socket_t socket;              /* Socket the request was received on */
+    sock_udp_ep_t remote;               /* Sender of the request */
+    sock_udp_aux_tx_t aux;              /* Auxiliary data for the response */
+    size_t len;                         /* Length of the request in buf */
+    bool truncated;                     /* Request was truncated */
+    uint8_t buf[CONFIG_GCOAP_PDU_BUF_SIZE];
+                                        /* Request and response PDU buffer */
+} gcoap_worker_t;
+
+static gcoap_worker_t _workers[CONFIG_GCOAP_WORKERS_NUMOF];
+static char _worker_stacks[CONFIG_GCOAP_WORKERS_NUMOF][GCOAP_WORKER_STACK_SIZE];
 #endif
 
 /* Event loop for gcoap _pid thread. */
@@ -197,6 +322,14 @@ static void *_event_loop(void *arg)
         }
         sock_dtls_event_init(&_sock_dtls, &_queue, _on_sock_dtls_evt,
                             NULL);
+        if (CONFIG_GCOAP_DTLS_IDLE_TIMEOUT_SEC) {
+            event_callback_init(&_dtls_idle_tmout_cb,
+                                _dtls_close_idle_sessions, NULL);
+            event_timeout_ztimer_init(&_dtls_idle_tmout, ZTIMER_MSEC, &_queue,
+                                      &_dtls_idle_tmout_cb.super);
+            event_timeout_set(&_dtls_idle_tmout,
+                              CONFIG_GCOAP_DTLS_IDLE_TIMEOUT_SEC * MS_PER_SEC);
+        }
 #endif
     }
 
@@ -281,6 +414,8 @@ static void _on_sock_dtls_evt(sock_dtls_t *sock, sock_async_flags_t type, void *
             DEBUG("gcoap: DTLS recv failure: %d\n", (int)res);
             return;
         }
+        /* mark the session as used */
+        dsm_store(sock, &socket.ctx_dtls_session, SESSION_STATE_ESTABLISHED, false);
         sock_udp_ep_t ep;
         sock_dtls_session_get_udp_ep(&socket.ctx_dtls_session, &ep);
         /* Truncated DTLS messages would already have gotten lost at verification */
@@ -302,8 +437,79 @@ static void _dtls_free_up_session(void *arg) {
         }
     }
 }
+
+/* Timeout function to close sessions idle for CONFIG_GCOAP_DTLS_IDLE_TIMEOUT_SEC,
+ * the timeout is set again for the session that becomes idle next */
+static void _dtls_close_idle_sessions(void *arg) {
+    (void)arg;
+    sock_dtls_session_t session;
+    uint32_t next_sec = CONFIG_GCOAP_DTLS_IDLE_TIMEOUT_SEC;
+
+    while (dsm_get_idle_session(&_sock_dtls, &session,
+                                CONFIG_GCOAP_DTLS_IDLE_TIMEOUT_SEC, &next_sec) == 1) {
+        DEBUG("gcoap: closing idle DTLS session\n");
+        dsm_remove(&_sock_dtls, &session);
+        sock_dtls_session_destroy(&_sock_dtls, &session);
+    }
+    event_timeout_set(&_dtls_idle_tmout, next_sec * MS_PER_SEC);
+}
 #endif /* MODULE_GCOAP_DTLS */
 
+#if IS_USED(MODULE_GCOAP_WORKERS)
+/* Claims an idle worker, returns NULL if all workers are busy */
+static gcoap_worker_t *_worker_claim(void)
+{
+    for (unsigned i = 0; i < CONFIG_GCOAP_WORKERS_NUMOF; i++) {
+        if (!atomic_exchange(&_workers[i].busy, true)) {
+            return &_workers[i];
+        }
+    }
+    DEBUG("gcoap: all workers busy, handling message in gcoap thread\n");
+    return NULL;
+}
+
+static void _worker_release(gcoap_worker_t *worker)
+{
+    if (worker) {
+        atomic_store(&worker->busy, false);
+    }
+}
+
+/* Only requests are handed over to a worker, responses and empty messages
+ * need the request memos and are quickly handled by the gcoap thread */
+static bool _is_request(const uint8_t *buf, size_t len)
+{
+    if (len < sizeof(coap_hdr_t)) {
+        return false;
+    }
+    const coap_hdr_t *hdr = (const coap_hdr_t *)buf;
+    unsigned type = (hdr->ver_t_tkl & 0x30) >> 4;
+
+    return ((hdr->code >> 5) == COAP_CLASS_REQ) && (hdr->code != COAP_CODE_EMPTY)
+           && ((type == COAP_TYPE_CON) || (type == COAP_TYPE_NON));
+}
+
+/* Event loop for a worker thread */
+static void *_worker_loop(void *arg)
+{
+    gcoap_worker_t *worker = arg;
+
+    event_queue_claim(&worker->queue);
+    event_loop(&worker->queue);
+    return NULL;
+}
+
+/* Handles a request handed over to a worker */
+static void _on_worker_evt(event_t *event)
+{
+    gcoap_worker_t *worker = container_of(event, gcoap_worker_t, super);
+
+    _process_coap_pdu(&worker->socket, &worker->remote, &worker->aux,
+                      worker->buf, worker->len, worker->truncated);
+    _worker_release(worker);
+}
+#endif
+
 /* Handles UDP socket events from the event queue. */
 static void _on_sock_udp_evt(sock_udp_t *sock, sock_async_flags_t type, void *arg)
 {
@@ -315,10 +521,19 @@ static void _on_sock_udp_evt(sock_udp_t *sock, sock_async_flags_t type, void *ar
         void *buf_ctx = NULL;
         bool truncated = false;
         size_t cursor = 0;
+        uint8_t *buf = _listen_buf;
         sock_udp_aux_rx_t aux_in = {
             .flags = SOCK_AUX_GET_LOCAL,
         };
 
+#if IS_USED(MODULE_GCOAP_WORKERS)
+        /* receive directly into the buffer of an idle worker, if any */
+        gcoap_worker_t *worker = _worker_claim();
+        if (worker) {
+            buf = worker->buf;
+        }
+#endif
+
         /* The zero-copy _buf API is not used to its full potential here -- we
          * still copy out data in what is a manual version of sock_udp_recv,
          * but this gives the direly needed overflow information.
@@ -333,16 +548,19 @@ static void _on_sock_udp_evt(sock_udp_t *sock, sock_async_flags_t type, void *ar
             ssize_t res = sock_udp_recv_buf_aux(sock, &stackbuf, &buf_ctx, 0, &remote, &aux_in);
             if (res < 0) {
                 DEBUG("gcoap: udp recv failure: %d\n", (int)res);
+#if IS_USED(MODULE_GCOAP_WORKERS)
+                _worker_release(worker);
+#endif
                 return;
             }
             if (res == 0) {
                 break;
             }
-            if (cursor + res > sizeof(_listen_buf)) {
-                res = sizeof(_listen_buf) - cursor;
+            if (cursor + res > CONFIG_GCOAP_PDU_BUF_SIZE) {
+                res = CONFIG_GCOAP_PDU_BUF_SIZE - cursor;
                 truncated = true;
             }
-            memcpy(&_listen_buf[cursor], stackbuf, res);
+            memcpy(&buf[cursor], stackbuf, res);
             cursor += res;
         }
 
@@ -357,7 +575,24 @@ static void _on_sock_udp_evt(sock_udp_t *sock, sock_async_flags_t type, void *ar
             .socket.udp = sock,
          };
 
-        _process_coap_pdu(&socket, &remote, &aux_out, _listen_buf, cursor, truncated);
+#if IS_USED(MODULE_GCOAP_WORKERS)
+        if (worker && _is_request(buf, cursor)) {
+            /* hand the request over, the worker releases itself when done */
+            worker->socket = socket;
+            worker->remote = remote;
+            worker->aux = aux_out;
+            worker->len = cursor;
+            worker->truncated = truncated;
+            event_post(&worker->queue, &worker->super);
+            return;
+        }
+#endif
+
+        _process_coap_pdu(&socket, &remote, &aux_out, buf, cursor, truncated);
+
+#if IS_USED(MODULE_GCOAP_WORKERS)
+        _worker_release(worker);
+#endif
     }
 }
 
@@ -396,6 +631,7 @@ static void _process_coap_pdu(gcoap_socket_t *sock, sock_udp_ep_t *remote, sock_
         _find_req_memo(&memo, &pdu, remote, true);
         if (memo) {
             event_timeout_clear(&memo->resp_evt_tmout);
+            _gcoap_congure_report_reply(memo);
             _expire_request(memo);
         }
     }
@@ -428,15 +664,15 @@ static void _process_coap_pdu(gcoap_socket_t *sock, sock_udp_ep_t *remote, sock_
 
             if (truncated) {
                 /* TBD: Set a Size1 */
-                pdu_len = gcoap_response(&pdu, _listen_buf, sizeof(_listen_buf),
+                pdu_len = gcoap_response(&pdu, buf, CONFIG_GCOAP_PDU_BUF_SIZE,
                                          COAP_CODE_REQUEST_ENTITY_TOO_LARGE);
             } else {
-                pdu_len = _handle_req(sock, &pdu, _listen_buf,
-                                      sizeof(_listen_buf), remote);
+                pdu_len = _handle_req(sock, &pdu, buf,
+                                      CONFIG_GCOAP_PDU_BUF_SIZE, remote);
             }
 
             if (pdu_len > 0) {
-                ssize_t bytes = _tl_send(sock, _listen_buf, pdu_len, remote, aux);
+                ssize_t bytes = _tl_send(sock, buf, pdu_len, remote, aux);
                 if (bytes <= 0) {
                     DEBUG("gcoap: send response failed: %d\n", (int)bytes);
                 }
@@ -463,6 +699,7 @@ static void _process_coap_pdu(gcoap_socket_t *sock, sock_udp_ep_t *remote, sock_
                 if (memo->resp_evt_tmout.queue) {
                     event_timeout_clear(&memo->resp_evt_tmout);
                 }
+                _gcoap_congure_report_reply(memo);
                 memo->state = truncated ? GCOAP_MEMO_RESP_TRUNC : GCOAP_MEMO_RESP;
                 if (IS_USED(MODULE_NANOCOAP_CACHE)) {
                     nanocoap_cache_entry_t *ce = NULL;
@@ -476,9 +713,9 @@ static void _process_coap_pdu(gcoap_socket_t *sock, sock_udp_ep_t *remote, sock_
                         ce->max_age = ztimer_now(ZTIMER_SEC) + max_age;
                         /* copy all options and possible payload from the cached response
                          * to the new response */
-                        assert((uint8_t *)pdu.hdr == &_listen_buf[0]);
-                        if (_cache_build_response(ce, &pdu, _listen_buf,
-                                                  sizeof(_listen_buf)) < 0) {
+                        assert((uint8_t *)pdu.hdr == buf);
+                        if (_cache_build_response(ce, &pdu, buf,
+                                                  CONFIG_GCOAP_PDU_BUF_SIZE) < 0) {
                             memo->state = GCOAP_MEMO_ERR;
                         }
                         if (ce->truncated) {
@@ -497,7 +734,7 @@ static void _process_coap_pdu(gcoap_socket_t *sock, sock_udp_ep_t *remote, sock_
                 if (memo->send_limit >= 0) {        /* if confirmable */
                     *memo->msg.data.pdu_buf = 0;    /* clear resend PDU buffer */
                 }
-                memo->state = GCOAP_MEMO_UNUSED;
+                _memo_release(memo);
                 break;
             default:
                 DEBUG("gcoap: illegal response type: %u\n", coap_get_type(&pdu));
@@ -557,6 +794,7 @@ static void _on_resp_timeout(void *arg) {
         uint32_t end = (uint32_t)TIMEOUT_RANGE_END << i;
         timeout = random_uint32_range(timeout, end);
 #endif
+        timeout = _gcoap_congure_resend(memo, timeout);
         event_timeout_set(&memo->resp_evt_tmout, timeout);
 
         if (memo->state == GCOAP_MEMO_WAIT) {
@@ -597,6 +835,7 @@ static void _on_resp_timeout(void *arg) {
  *      send_limit is not GCOAP_SEND_LIMIT_NON.
  */
 static void _cease_retransmission(gcoap_request_memo_t *memo) {
+    _gcoap_congure_report_reply(memo);
     memo->state = GCOAP_MEMO_WAIT;
     /* there is also no response handler to wait for => expire memo */
     if (memo->resp_handler == NULL) {
@@ -627,8 +866,6 @@ static size_t _handle_req(gcoap_socket_t *sock, coap_pkt_t *pdu, uint8_t *buf,
         case GCOAP_RESOURCE_NO_PATH:
             return gcoap_response(pdu, buf, len, COAP_CODE_PATH_NOT_FOUND);
         case GCOAP_RESOURCE_FOUND:
-            /* find observe registration for resource */
-            _find_obs_memo_resource(&resource_memo, resource);
             break;
         case GCOAP_RESOURCE_ERROR:
         default:
@@ -636,6 +873,12 @@ static size_t _handle_req(gcoap_socket_t *sock, coap_pkt_t *pdu, uint8_t *buf,
             break;
     }
 
+    /* requests may be handled concurrently by gcoap_workers */
+    mutex_lock(&_coap_state.lock);
+
+    /* find observe registration for resource */
+    _find_obs_memo_resource(&resource_memo, resource);
+
     if (coap_get_observe(pdu) == COAP_OBS_REGISTER) {
         /* lookup remote+token */
         int empty_slot = _find_obs_memo(&memo, remote, pdu);
@@ -684,6 +927,11 @@ static size_t _handle_req(gcoap_socket_t *sock, coap_pkt_t *pdu, uint8_t *buf,
         if (memo != NULL) {
             /* resource may be assigned here if it is not already registered */
             memo->resource = resource;
+#if IS_USED(MODULE_GCOAP_INDEX)
+            unsigned idx = index_of(_coap_state.observe_memos, memo);
+            _index_del(&_obs_index, idx);
+            _index_add(&_obs_index, idx, _index_hash(&resource, sizeof(resource)));
+#endif
             memo->token_len = coap_get_token_len(pdu);
             memo->socket = *sock;
             if (memo->token_len) {
@@ -698,6 +946,9 @@ static size_t _handle_req(gcoap_socket_t *sock, coap_pkt_t *pdu, uint8_t *buf,
         if (memo != NULL) {
             DEBUG("gcoap: Deregistering observer for: %s\n", memo->resource->path);
             memo->observer = NULL;
+#if IS_USED(MODULE_GCOAP_INDEX)
+            _index_del(&_obs_index, index_of(_coap_state.observe_memos, memo));
+#endif
             memo           = NULL;
             _find_obs_memo(&memo, remote, NULL);
             if (memo == NULL) {
@@ -712,9 +963,12 @@ static size_t _handle_req(gcoap_socket_t *sock, coap_pkt_t *pdu, uint8_t *buf,
     } else if (coap_has_observe(pdu)) {
         /* bogus request; don't respond */
         DEBUG("gcoap: Observe value unexpected: %" PRIu32 "\n", coap_get_observe(pdu));
+        mutex_unlock(&_coap_state.lock);
         return -1;
     }
 
+    mutex_unlock(&_coap_state.lock);
+
     ssize_t pdu_len;
 
     coap_request_ctx_t ctx = {
@@ -873,6 +1127,28 @@ static void _find_req_memo(gcoap_request_memo_t **memo_ptr, coap_pkt_t *src_pdu,
     coap_pkt_t *memo_pdu = &memo_pdu_data;
     unsigned cmplen      = coap_get_token_len(src_pdu);
 
+#if IS_USED(MODULE_GCOAP_INDEX)
+    if (!by_mid) {
+        mutex_lock(&_coap_state.lock);
+        for (uint16_t i = _index_first(&_req_index,
+                                       _index_hash(coap_get_token(src_pdu), cmplen));
+             i != GCOAP_INDEX_NONE; i = _req_index.next[i]) {
+            gcoap_request_memo_t *memo = &_coap_state.open_reqs[i];
+
+            memo_pdu->hdr = gcoap_request_memo_get_hdr(memo);
+            if ((coap_get_token_len(memo_pdu) == cmplen)
+                    && (memcmp(coap_get_token(src_pdu), coap_get_token(memo_pdu), cmplen) == 0)
+                    && (sock_udp_ep_equal(&memo->remote_ep, remote)
+                      || _memo_ep_is_multicast(memo))) {
+                *memo_ptr = memo;
+                break;
+            }
+        }
+        mutex_unlock(&_coap_state.lock);
+        return;
+    }
+#endif
+
     for (int i = 0; i < CONFIG_GCOAP_REQ_WAITING_MAX; i++) {
         if (_coap_state.open_reqs[i].state == GCOAP_MEMO_UNUSED) {
             continue;
@@ -906,6 +1182,7 @@ static void _expire_request(gcoap_request_memo_t *memo)
     DEBUG("coap: received timeout message\n");
     if ((memo->state == GCOAP_MEMO_RETRANSMIT) || (memo->state == GCOAP_MEMO_WAIT)) {
         memo->state = GCOAP_MEMO_TIMEOUT;
+        _gcoap_congure_report_timeout(memo);
         /* Pass response to handler */
         if (memo->resp_handler) {
             coap_pkt_t req;
@@ -916,7 +1193,7 @@ static void _expire_request(gcoap_request_memo_t *memo)
         if (memo->send_limit != GCOAP_SEND_LIMIT_NON) {
             *memo->msg.data.pdu_buf = 0;    /* clear resend buffer */
         }
-        memo->state = GCOAP_MEMO_UNUSED;
+        _memo_release(memo);
     }
     else {
         /* Response already handled; timeout must have fired while response */
@@ -1023,6 +1300,15 @@ static void _find_obs_memo_resource(gcoap_observe_memo_t **memo,
                                    const coap_resource_t *resource)
 {
     *memo = NULL;
+#if IS_USED(MODULE_GCOAP_INDEX)
+    for (uint16_t i = _index_first(&_obs_index, _index_hash(&resource, sizeof(resource)));
+         i != GCOAP_INDEX_NONE; i = _obs_index.next[i]) {
+        if (_coap_state.observe_memos[i].resource == resource) {
+            *memo = &_coap_state.observe_memos[i];
+            break;
+        }
+    }
+#else
     for (int i = 0; i < CONFIG_GCOAP_OBS_REGISTRATIONS_MAX; i++) {
         if (_coap_state.observe_memos[i].observer != NULL
                 && _coap_state.observe_memos[i].resource == resource) {
@@ -1030,6 +1316,7 @@ static void _find_obs_memo_resource(gcoap_observe_memo_t **memo,
             break;
         }
     }
+#endif
 }
 
 /*
@@ -1256,7 +1543,7 @@ static void _receive_from_cache_cb(void *ctx)
                 if (memo->send_limit >= 0) {        /* if confirmable */
                     *memo->msg.data.pdu_buf = 0;    /* clear resend PDU buffer */
                 }
-                memo->state = GCOAP_MEMO_UNUSED;
+                _memo_release(memo);
             }
         }
     }
@@ -1380,6 +1667,20 @@ kernel_pid_t gcoap_init(void)
     if (_pid != KERNEL_PID_UNDEF) {
         return -EEXIST;
     }
+#if IS_USED(MODULE_GCOAP_WORKERS)
+    /* workers must be ready before the gcoap thread hands requests over */
+    for (unsigned i = 0; i < CONFIG_GCOAP_WORKERS_NUMOF; i++) {
+        gcoap_worker_t *worker = &_workers[i];
+
+        worker->super.handler = _on_worker_evt;
+        event_queue_init_detached(&worker->queue);
+        atomic_init(&worker->busy, false);
+        thread_create(_worker_stacks[i], sizeof(_worker_stacks[i]),
+                      GCOAP_WORKER_PRIO, THREAD_CREATE_STACKTEST,
+                      _worker_loop, worker, "coap_worker");
+    }
+#endif
+
     _pid = thread_create(_msg_stack, sizeof(_msg_stack), THREAD_PRIORITY_MAIN - 1,
                             THREAD_CREATE_STACKTEST, _event_loop, NULL, "coap");
 
@@ -1389,6 +1690,10 @@ kernel_pid_t gcoap_init(void)
     memset(&_coap_state.observers[0], 0, sizeof(_coap_state.observers));
     memset(&_coap_state.observe_memos[0], 0, sizeof(_coap_state.observe_memos));
     memset(&_coap_state.resend_bufs[0], 0, sizeof(_coap_state.resend_bufs));
+#if IS_USED(MODULE_GCOAP_INDEX)
+    _index_init(&_req_index);
+    _index_init(&_obs_index);
+#endif
     /* randomize initial value */
     atomic_init(&_coap_state.next_message_id, (unsigned)random_uint32());
 
@@ -1539,6 +1844,11 @@ ssize_t gcoap_req_send_tl(const uint8_t *buf, size_t len,
                 timeout = random_uint32_range(timeout, TIMEOUT_RANGE_END);
 #endif
                 memo->state = GCOAP_MEMO_RETRANSMIT;
+                if (_gcoap_congure_request(memo, &timeout) < 0) {
+                    *memo->msg.data.pdu_buf = 0;    /* clear resend buffer */
+                    memo->state = GCOAP_MEMO_UNUSED;
+                    DEBUG("gcoap: congestion window of remote is full\n");
+                }
             }
             else {
                 memo->state = GCOAP_MEMO_UNUSED;
@@ -1556,6 +1866,15 @@ ssize_t gcoap_req_send_tl(const uint8_t *buf, size_t len,
             DEBUG("gcoap: illegal msg type %u\n", msg_type);
             break;
         }
+#if IS_USED(MODULE_GCOAP_INDEX)
+        if (memo->state != GCOAP_MEMO_UNUSED) {
+            coap_pkt_t memo_pdu = { .hdr = gcoap_request_memo_get_hdr(memo) };
+
+            _index_add(&_req_index, index_of(_coap_state.open_reqs, memo),
+                       _index_hash(coap_get_token(&memo_pdu),
+                                   coap_get_token_len(&memo_pdu)));
+        }
+#endif
         mutex_unlock(&_coap_state.lock);
         if (memo->state == GCOAP_MEMO_UNUSED) {
             return 0;
@@ -1610,7 +1929,7 @@ ssize_t gcoap_req_send_tl(const uint8_t *buf, size_t len,
             if (timeout > 0) {
                 event_timeout_clear(&memo->resp_evt_tmout);
             }
-            memo->state = GCOAP_MEMO_UNUSED;
+            _memo_release(memo);
         }
         DEBUG("gcoap: sock send failed: %d\n", (int)res);
     }
@@ -1645,7 +1964,9 @@ int gcoap_obs_init(coap_pkt_t *pdu, uint8_t *buf, size_t len,
 {
     gcoap_observe_memo_t *memo = NULL;
 
+    mutex_lock(&_coap_state.lock);
     _find_obs_memo_resource(&memo, resource);
+    mutex_unlock(&_coap_state.lock);
     if (memo == NULL) {
         /* Unique return value to specify there is not an observer */
         return GCOAP_OBS_INIT_UNUSED;
@@ -1675,7 +1996,10 @@ size_t gcoap_obs_send(const uint8_t *buf, size_t len,
                       const coap_resource_t *resource)
 {
     gcoap_observe_memo_t *memo = NULL;
+
+    mutex_lock(&_coap_state.lock);
     _find_obs_memo_resource(&memo, resource);
+    mutex_unlock(&_coap_state.lock);
 
     if (memo) {
         ssize_t bytes = _tl_send(&memo->socket, buf, len, memo->observer, NULL);
@@ -0,0 +1,166 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     net_gcoap
+ * @{
+ *
+ * @file
+ * @brief       gcoap congestion control declarations
+ *
+ * With the module `gcoap_congure`, gcoap keeps the state of up to
+ * @ref CONFIG_GCOAP_CONGURE_PEERS_NUMOF peers. Retransmission timeouts of
+ * confirmable requests are derived from the round-trip times measured to the
+ * peer as proposed by CoCoA (draft-ietf-core-cocoa), and the number of
+ * confirmable requests in flight to a peer is limited by the congestion window
+ * of a @ref sys_congure instance. The algorithm is selected with one of the
+ * following modules:
+ *
+ * - `gcoap_congure_reno`: @ref sys_congure_reno, counting requests (default)
+ */
+
+#ifndef GCOAP_CONGURE_H
+#define GCOAP_CONGURE_H
+
+#include <stdint.h>
+
+#include "kernel_defines.h"
+#include "net/gcoap.h"
+
+#if IS_USED(MODULE_GCOAP_CONGURE) || defined(DOXYGEN)
+#include "congure.h"
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if IS_USED(MODULE_GCOAP_CONGURE) || defined(DOXYGEN)
+/**
+ * @brief   Round-trip time estimator of RFC 6298
+ */
+typedef struct {
+    uint32_t srtt;              /**< smoothed round-trip time in 1/8 ms */
+    uint32_t rttvar;            /**< round-trip time variation in 1/8 ms */
+} gcoap_congure_rtt_t;
+
+/**
+ * @brief   Congestion control state of a peer
+ */
+struct gcoap_congure_peer {
+    sock_udp_ep_t remote;           /**< remote endpoint of the peer */
+    congure_snd_t *congure;         /**< CongURE state, NULL if none */
+    gcoap_congure_rtt_t strong;     /**< estimator of exchanges without resends */
+    gcoap_congure_rtt_t weak;       /**< estimator of exchanges with resends */
+    uint32_t rto;                   /**< overall retransmission timeout in ms */
+    uint32_t rto_updated;           /**< time of the last RTO update in ms */
+    uint32_t last_used;             /**< time of the last request in ms */
+    uint32_t acks;                  /**< number of responses, ID of the next ACK */
+    uint8_t in_flight;              /**< confirmable requests in flight */
+};
+
+/**
+ * @brief   Allocate a CongURE state object for a peer
+ *
+ * State objects are kept when the state of a peer is replaced.
+ *
+ * @note    Provided by the selected congestion control implementation.
+ *
+ * @return  State object with congure_snd_t::driver set.
+ * @return  NULL if all state objects are in use.
+ */
+congure_snd_t *_gcoap_congure_snd_alloc(void);
+
+/**
+ * @brief   Account a confirmable request that is about to be sent
+ *
+ * Assigns the state of the remote endpoint of @p memo to it and replaces
+ * @p timeout by the retransmission timeout of the peer. Without state left for
+ * the peer, the request is sent with the default timeouts.
+ *
+ * @param[in,out]   memo        Memo of the request.
+ * @param[in,out]   timeout     Initial timeout of the request in ms.
+ *
+ * @return  0 on success
+ * @return  -EAGAIN if the congestion window of the peer is full
+ */
+int _gcoap_congure_request(gcoap_request_memo_t *memo, uint32_t *timeout);
+
+/**
+ * @brief   Account a retransmission of a confirmable request
+ *
+ * @param[in,out]   memo        Memo of the request.
+ * @param[in]       timeout     Timeout with the default backoff in ms.
+ *
+ * @return  Timeout until the next retransmission in ms.
+ */
+uint32_t _gcoap_congure_resend(gcoap_request_memo_t *memo, uint32_t timeout);
+
+/**
+ * @brief   Account the reply to a confirmable request
+ *
+ * Updates the round-trip time estimators of the peer. Replies are responses,
+ * empty ACKs and RSTs.
+ *
+ * @param[in,out]   memo    Memo of the request.
+ */
+void _gcoap_congure_report_reply(gcoap_request_memo_t *memo);
+
+/**
+ * @brief   Account a confirmable request that timed out after the last resend
+ *
+ * @param[in,out]   memo    Memo of the request.
+ */
+void _gcoap_congure_report_timeout(gcoap_request_memo_t *memo);
+
+/**
+ * @brief   Account a confirmable request that is released otherwise
+ *
+ * E.g. if sending failed or the response was taken from the cache.
+ *
+ * @param[in,out]   memo    Memo of the request.
+ */
+void _gcoap_congure_release(gcoap_request_memo_t *memo);
+#else   /* IS_USED(MODULE_GCOAP_CONGURE) || defined(DOXYGEN) */
+static inline int _gcoap_congure_request(gcoap_request_memo_t *memo,
+                                         uint32_t *timeout)
+{
+    (void)memo;
+    (void)timeout;
+    return 0;
+}
+
+static inline uint32_t _gcoap_congure_resend(gcoap_request_memo_t *memo,
+                                             uint32_t timeout)
+{
+    (void)memo;
+    return timeout;
+}
+
+static inline void _gcoap_congure_report_reply(gcoap_request_memo_t *memo)
+{
+    (void)memo;
+}
+
+static inline void _gcoap_congure_report_timeout(gcoap_request_memo_t *memo)
+{
+    (void)memo;
+}
+
+static inline void _gcoap_congure_release(gcoap_request_memo_t *memo)
+{
+    (void)memo;
+}
+#endif  /* IS_USED(MODULE_GCOAP_CONGURE) || defined(DOXYGEN) */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* GCOAP_CONGURE_H */
+/** @} */
@@ -35,38 +35,146 @@ static clist_node_t _empty_list_head = { NULL };
 
 static nanocoap_cache_entry_t _cache_entries[CONFIG_NANOCOAP_CACHE_ENTRIES];
 
+/* Hash chains of the used entries by cache key, one bucket per entry */
+static nanocoap_cache_entry_t *_buckets[CONFIG_NANOCOAP_CACHE_ENTRIES];
+static nanocoap_cache_entry_t *_bucket_next[CONFIG_NANOCOAP_CACHE_ENTRIES];
+
+/* Access sequence number of each entry, for the LRU replacement */
+static uint32_t _last_access[CONFIG_NANOCOAP_CACHE_ENTRIES];
+static uint32_t _access_seq;
+
+static nanocoap_cache_stats_t _stats;
+
+#if IS_USED(MODULE_NANOCOAP_CACHE_ARENA)
+/* Storage for the responses, used responses are packed at the start */
+static uint8_t _arena[CONFIG_NANOCOAP_CACHE_ARENA_SIZE];
+static size_t _arena_used;
+#endif
+
 static const nanocoap_cache_replacement_strategy_t _replacement_strategy = _cache_replacement_lru;
 static const nanocoap_cache_update_strategy_t _update_strategy = _cache_update_lru;
 
 static int _cache_replacement_lru(void)
 {
-    clist_node_t *lru_node = clist_lpeek(&_cache_list_head);
+    clist_node_t *lru_node = NULL;
+    uint32_t lru_age = 0;
+    clist_node_t *node = _cache_list_head.next;
 
     /* no element in the list */
-    if (!lru_node) {
+    if (!node) {
         return -1;
     }
 
+    /* finding the victim is linear, in exchange accesses are O(1) */
+    do {
+        node = node->next;
+        unsigned idx = index_of(_cache_entries,
+                                container_of(node, nanocoap_cache_entry_t, node));
+        uint32_t age = _access_seq - _last_access[idx];
+
+        if (!lru_node || (age > lru_age)) {
+            lru_node = node;
+            lru_age = age;
+        }
+    } while (node != _cache_list_head.next);
+
+    _stats.evictions++;
     nanocoap_cache_entry_t *lru_ce = container_of(lru_node, nanocoap_cache_entry_t, node);
     return nanocoap_cache_del(lru_ce);
 }
 
 static int _cache_update_lru(clist_node_t *node)
 {
-    if (clist_remove(&_cache_list_head, node)) {
-        /* Move an accessed node to the end of the list. Least
-         * recently used nodes are at the beginning of this list */
-        clist_rpush(&_cache_list_head, node);
-        return 0;
+    nanocoap_cache_entry_t *ce = container_of(node, nanocoap_cache_entry_t, node);
+
+    _last_access[index_of(_cache_entries, ce)] = ++_access_seq;
+    return 0;
+}
+
+static unsigned _bucket(const uint8_t *cache_key)
+{
+    /* the cache key is a prefix of a SHA-256 digest, so its first bytes are
+     * already a good hash */
+    uint32_t hash = 0;
+
+    memcpy(&hash, cache_key, (CONFIG_NANOCOAP_CACHE_KEY_LENGTH < sizeof(hash))
+                             ? CONFIG_NANOCOAP_CACHE_KEY_LENGTH : sizeof(hash));
+    return hash % CONFIG_NANOCOAP_CACHE_ENTRIES;
+}
+
+static void _bucket_add(nanocoap_cache_entry_t *ce)
+{
+    unsigned bucket = _bucket(ce->cache_key);
+
+    _bucket_next[index_of(_cache_entries, ce)] = _buckets[bucket];
+    _buckets[bucket] = ce;
+}
+
+static void _bucket_del(const nanocoap_cache_entry_t *ce)
+{
+    nanocoap_cache_entry_t **pos = &_buckets[_bucket(ce->cache_key)];
+
+    while (*pos && (*pos != ce)) {
+        pos = &_bucket_next[index_of(_cache_entries, *pos)];
+    }
+    if (*pos) {
+        *pos = _bucket_next[index_of(_cache_entries, ce)];
     }
-    return -1;
 }
 
+#if IS_USED(MODULE_NANOCOAP_CACHE_ARENA)
+/* Allocates @p len bytes, evicting entries until the response fits */
+static uint8_t *_arena_alloc(size_t len)
+{
+    if (len > sizeof(_arena)) {
+        return NULL;
+    }
+    while ((sizeof(_arena) - _arena_used) < len) {
+        if (_replacement_strategy()) {
+            return NULL;
+        }
+    }
+
+    uint8_t *buf = &_arena[_arena_used];
+    _arena_used += len;
+    return buf;
+}
+
+/* Releases the response of @p ce and moves all responses behind it down */
+static void _arena_free(nanocoap_cache_entry_t *ce)
+{
+    uint8_t *start = ce->response_buf;
+    size_t len = ce->response_len;
+
+    if (!start) {
+        return;
+    }
+    memmove(start, start + len, &_arena[_arena_used] - (start + len));
+    _arena_used -= len;
+
+    for (unsigned i = 0; i < CONFIG_NANOCOAP_CACHE_ENTRIES; i++) {
+        nanocoap_cache_entry_t *e = &_cache_entries[i];
+
+        if (e->response_buf && (e->response_buf > start)) {
+            e->response_buf -= len;
+            e->response_pkt.hdr = (coap_hdr_t *)((uint8_t *)e->response_pkt.hdr - len);
+            e->response_pkt.payload -= len;
+        }
+    }
+    ce->response_buf = NULL;
+}
+#endif
+
 void nanocoap_cache_init(void)
 {
     _cache_list_head.next = NULL;
     _empty_list_head.next = NULL;
     memset(_cache_entries, 0, sizeof(_cache_entries));
+    memset(_buckets, 0, sizeof(_buckets));
+    memset(&_stats, 0, sizeof(_stats));
+#if IS_USED(MODULE_NANOCOAP_CACHE_ARENA)
+    _arena_used = 0;
+#endif
     /* construct list of empty entries */
     for (unsigned i = 0; i < CONFIG_NANOCOAP_CACHE_ENTRIES; i++) {
         clist_rpush(&_empty_list_head, &_cache_entries[i].node);
@@ -83,6 +191,11 @@ size_t nanocoap_cache_free_count(void)
     return clist_count(&_empty_list_head);
 }
 
+void nanocoap_cache_get_stats(nanocoap_cache_stats_t *stats)
+{
+    *stats = _stats;
+}
+
 void nanocoap_cache_key_generate(const coap_pkt_t *req, uint8_t *cache_key)
 {
     sha256_context_t ctx;
@@ -122,31 +235,32 @@ ssize_t nanocoap_cache_key_compare(uint8_t *cache_key1, uint8_t *cache_key2)
     return memcmp(cache_key1, cache_key2, CONFIG_NANOCOAP_CACHE_KEY_LENGTH);
 }
 
-static int _compare_cache_keys(clist_node_t *ce, void *arg)
+static nanocoap_cache_entry_t *_lookup(const uint8_t *key)
 {
-    nanocoap_cache_entry_t *iterator = container_of(ce, nanocoap_cache_entry_t, node);
-    uint8_t *cache_key = (uint8_t *) arg;
+    nanocoap_cache_entry_t *ce = _buckets[_bucket(key)];
 
-    if (!memcmp(iterator->cache_key, cache_key, CONFIG_NANOCOAP_CACHE_KEY_LENGTH)) {
-        return 1;
+    while (ce && memcmp(ce->cache_key, key, CONFIG_NANOCOAP_CACHE_KEY_LENGTH)) {
+        ce = _bucket_next[index_of(_cache_entries, ce)];
+    }
+    if (ce) {
+        _update_strategy(&ce->node);
     }
-    return 0;
-}
 
-static clist_node_t *_nanocoap_cache_foreach(const uint8_t *key)
-{
-    return clist_foreach(&_cache_list_head, _compare_cache_keys, (uint8_t *)key);
+    return ce;
 }
 
 nanocoap_cache_entry_t *nanocoap_cache_key_lookup(const uint8_t *key)
 {
-    clist_node_t *node = _nanocoap_cache_foreach(key);
+    nanocoap_cache_entry_t *ce = _lookup(key);
 
-    if (node) {
-        _update_strategy(node);
+    if (ce) {
+        _stats.hits++;
+    }
+    else {
+        _stats.misses++;
     }
 
-    return container_of(node, nanocoap_cache_entry_t, node);
+    return ce;
 }
 
 nanocoap_cache_entry_t *nanocoap_cache_request_lookup(const coap_pkt_t *req)
@@ -167,7 +281,7 @@ nanocoap_cache_entry_t *nanocoap_cache_process(const uint8_t *cache_key, unsigne
                                                const coap_pkt_t *resp, size_t resp_len)
 {
     nanocoap_cache_entry_t *ce;
-    ce = nanocoap_cache_key_lookup(cache_key);
+    ce = _lookup(cache_key);
 
     /* This response is not cacheable. */
     if (resp->hdr->code == COAP_CODE_CREATED) {
@@ -245,7 +359,7 @@ nanocoap_cache_entry_t *nanocoap_cache_add_by_key(const uint8_t *cache_key,
                                                   const coap_pkt_t *resp,
                                                   size_t resp_len)
 {
-    nanocoap_cache_entry_t *ce = nanocoap_cache_key_lookup(cache_key);
+    nanocoap_cache_entry_t *ce = _lookup(cache_key);
     bool add_to_cache = false;
 
     if (resp_len > CONFIG_NANOCOAP_CACHE_RESPONSE_SIZE) {
@@ -254,6 +368,14 @@ nanocoap_cache_entry_t *nanocoap_cache_add_by_key(const uint8_t *cache_key,
         return NULL;
     }
 
+#if IS_USED(MODULE_NANOCOAP_CACHE_ARENA)
+    /* the new response may differ in size, so replace the entry */
+    if (ce) {
+        nanocoap_cache_del(ce);
+        ce = NULL;
+    }
+#endif
+
     if (!ce) {
         /* did not find .. get an empty cache container */
         ce = _nanocoap_cache_pop();
@@ -275,9 +397,18 @@ nanocoap_cache_entry_t *nanocoap_cache_add_by_key(const uint8_t *cache_key,
         }
     }
 
+#if IS_USED(MODULE_NANOCOAP_CACHE_ARENA)
+    /* the entry is not in the cache list yet, so it cannot be evicted here */
+    ce->response_buf = _arena_alloc(resp_len);
+    if (!ce->response_buf) {
+        clist_rpush(&_empty_list_head, &ce->node);
+        return NULL;
+    }
+#endif
+
     memcpy(ce->cache_key, cache_key, CONFIG_NANOCOAP_CACHE_KEY_LENGTH);
     memcpy(&ce->response_pkt, resp, sizeof(coap_pkt_t));
-    memcpy(&ce->response_buf, resp->hdr, resp_len);
+    memcpy(ce->response_buf, resp->hdr, resp_len);
     ce->response_pkt.hdr = (coap_hdr_t *) ce->response_buf;
     ce->response_pkt.payload = ce->response_buf + (resp->payload - ((uint8_t *)resp->hdr));
     ce->response_len = resp_len;
@@ -290,7 +421,9 @@ nanocoap_cache_entry_t *nanocoap_cache_add_by_key(const uint8_t *cache_key,
 
     if (add_to_cache) {
         clist_rpush(&_cache_list_head, &ce->node);
+        _bucket_add(ce);
     }
+    _update_strategy(&ce->node);
 
     return ce;
 }
@@ -316,6 +449,10 @@ int nanocoap_cache_del(const nanocoap_cache_entry_t *ce)
 
     if (entry) {
         clist_remove(&_cache_list_head, entry);
+        _bucket_del(ce);
+#if IS_USED(MODULE_NANOCOAP_CACHE_ARENA)
+        _arena_free((nanocoap_cache_entry_t *)ce);
+#endif
         memset(entry, 0, sizeof(nanocoap_cache_entry_t));
         clist_rpush(&_empty_list_head, entry);
         return 0;
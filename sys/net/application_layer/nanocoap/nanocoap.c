@@ -45,6 +45,45 @@ static int _decode_value(unsigned val, uint8_t **pkt_pos_ptr, uint8_t *pkt_end);
 static uint32_t _decode_uint(uint8_t *pkt_pos, unsigned nbytes);
 static size_t _encode_uint(uint32_t *val);
 
+#if IS_USED(MODULE_NANOCOAP_OPT_INDEX)
+static_assert(CONFIG_NANOCOAP_NOPTS_MAX < UINT8_MAX,
+              "CONFIG_NANOCOAP_NOPTS_MAX too large for the option index");
+
+/* Returns the position in pkt->options plus one of the first option @p opt_num
+ * among the first @p count options, 0 if there is none. Entries left over from
+ * before options_len was reset are rejected. */
+static unsigned _opt_index_get(const coap_pkt_t *pkt, unsigned opt_num,
+                               unsigned count)
+{
+    unsigned idx = pkt->opt_index[opt_num];
+
+    if ((idx == 0) || (idx > count) || (pkt->options[idx - 1].opt_num != opt_num)) {
+        return 0;
+    }
+    return idx;
+}
+
+static void _opt_index_add(coap_pkt_t *pkt, unsigned idx)
+{
+    uint16_t opt_num = pkt->options[idx].opt_num;
+
+    /* the Packet API adds an entry for each instance of a repeated option,
+     * only the first one is indexed */
+    if ((opt_num <= CONFIG_NANOCOAP_OPT_INDEX_MAX) &&
+        !_opt_index_get(pkt, opt_num, idx)) {
+        pkt->opt_index[opt_num] = idx + 1;
+    }
+}
+
+static void _opt_index_build(coap_pkt_t *pkt)
+{
+    memset(pkt->opt_index, 0, sizeof(pkt->opt_index));
+    for (unsigned i = 0; i < pkt->options_len; i++) {
+        _opt_index_add(pkt, i);
+    }
+}
+#endif
+
 /* http://tools.ietf.org/html/rfc7252#section-3
  *  0                   1                   2                   3
  *  0 1 2 3 4 5 6 7 8 9 0 1 2 3 4 5 6 7 8 9 0 1 2 3 4 5 6 7 8 9 0 1
@@ -69,6 +108,9 @@ int coap_parse(coap_pkt_t *pkt, uint8_t *buf, size_t len)
     pkt->payload = NULL;
     pkt->payload_len = 0;
     memset(pkt->opt_crit, 0, sizeof(pkt->opt_crit));
+#if IS_USED(MODULE_NANOCOAP_OPT_INDEX)
+    memset(pkt->opt_index, 0, sizeof(pkt->opt_index));
+#endif
     pkt->snips = NULL;
 
     if (len < sizeof(coap_hdr_t)) {
@@ -127,6 +169,9 @@ int coap_parse(coap_pkt_t *pkt, uint8_t *buf, size_t len)
                 }
                 optpos->opt_num = option_nr;
                 optpos->offset = (uintptr_t)option_start - (uintptr_t)hdr;
+#if IS_USED(MODULE_NANOCOAP_OPT_INDEX)
+                _opt_index_add(pkt, option_count);
+#endif
                 DEBUG("optpos option_nr=%u %u\n", (unsigned)option_nr, (unsigned)optpos->offset);
                 optpos++;
                 option_count++;
@@ -177,6 +222,18 @@ int coap_match_path(const coap_resource_t *resource, uint8_t *uri)
 
 uint8_t *coap_find_option(coap_pkt_t *pkt, unsigned opt_num)
 {
+#if IS_USED(MODULE_NANOCOAP_OPT_INDEX)
+    if (opt_num <= CONFIG_NANOCOAP_OPT_INDEX_MAX) {
+        unsigned idx = _opt_index_get(pkt, opt_num, pkt->options_len);
+
+        if (idx == 0) {
+            return NULL;
+        }
+        bf_unset(pkt->opt_crit, idx - 1);
+        return (uint8_t *)pkt->hdr + pkt->options[idx - 1].offset;
+    }
+#endif
+
     const coap_optpos_t *optpos = pkt->options;
     unsigned opt_count = pkt->options_len;
 
@@ -437,6 +494,80 @@ ssize_t coap_subtree_handler(coap_pkt_t *pkt, uint8_t *buf, size_t len,
                              subtree->resources_numof);
 }
 
+#if IS_USED(MODULE_NANOCOAP_RESOURCES_SORTED)
+/*
+ * Binary search for a resource whose path equals the first @p len bytes of
+ * @p uri and that accepts @p method_flag. Resources with the same path are
+ * adjacent in a sorted list, so the neighbours of the hit are checked as well.
+ * If @p subtree is set, only resources with COAP_MATCH_SUBTREE are considered.
+ */
+static const coap_resource_t *_bsearch_path(const coap_resource_t *resources,
+                                            size_t resources_numof,
+                                            const uint8_t *uri, size_t len,
+                                            coap_method_flags_t method_flag,
+                                            bool subtree)
+{
+    size_t lo = 0;
+    size_t hi = resources_numof;
+
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+        const char *path = resources[mid].path;
+        int res = strncmp(path, (const char *)uri, len);
+
+        if ((res == 0) && (path[len] != '\0')) {
+            /* uri prefix is a proper prefix of path, so path sorts after it */
+            res = 1;
+        }
+        if (res < 0) {
+            lo = mid + 1;
+        }
+        else if (res > 0) {
+            hi = mid;
+        }
+        else {
+            /* rewind to the first resource with this path */
+            while ((mid > 0) && !strcmp(resources[mid - 1].path, path)) {
+                mid--;
+            }
+            for (; (mid < resources_numof) && !strcmp(resources[mid].path, path);
+                 mid++) {
+                coap_method_flags_t methods = resources[mid].methods;
+                if ((methods & method_flag) &&
+                    (!subtree || (methods & COAP_MATCH_SUBTREE))) {
+                    return &resources[mid];
+                }
+            }
+            return NULL;
+        }
+    }
+
+    return NULL;
+}
+
+/*
+ * Find the resource for @p uri in a list sorted by path. An exact match wins,
+ * otherwise the subtree resource with the longest matching prefix is used.
+ */
+static const coap_resource_t *_find_resource_sorted(const coap_resource_t *resources,
+                                                    size_t resources_numof,
+                                                    const uint8_t *uri,
+                                                    coap_method_flags_t method_flag)
+{
+    size_t len = strlen((const char *)uri);
+    const coap_resource_t *resource = _bsearch_path(resources, resources_numof,
+                                                    uri, len, method_flag,
+                                                    false);
+
+    while (!resource && (len > 1)) {
+        resource = _bsearch_path(resources, resources_numof, uri, --len,
+                                 method_flag, true);
+    }
+
+    return resource;
+}
+#endif
+
 ssize_t coap_tree_handler(coap_pkt_t *pkt, uint8_t *resp_buf,
                           unsigned resp_buf_len,
                           const coap_resource_t *resources,
@@ -450,6 +581,17 @@ ssize_t coap_tree_handler(coap_pkt_t *pkt, uint8_t *resp_buf,
     }
     DEBUG("nanocoap: URI path: \"%s\"\n", uri);
 
+#if IS_USED(MODULE_NANOCOAP_RESOURCES_SORTED)
+    const coap_resource_t *resource = _find_resource_sorted(resources,
+                                                            resources_numof,
+                                                            uri, method_flag);
+    if (resource) {
+        coap_request_ctx_t ctx = {
+            .resource = resource,
+        };
+        return resource->handler(pkt, resp_buf, resp_buf_len, &ctx);
+    }
+#else
     for (unsigned i = 0; i < resources_numof; i++) {
         const coap_resource_t *resource = &resources[i];
         if (!(resource->methods & method_flag)) {
@@ -466,6 +608,7 @@ ssize_t coap_tree_handler(coap_pkt_t *pkt, uint8_t *resp_buf,
         };
         return resource->handler(pkt, resp_buf, resp_buf_len, &ctx);
     }
+#endif
 
     return coap_build_reply(pkt, COAP_CODE_404, resp_buf, resp_buf_len, 0);
 }
@@ -894,6 +1037,9 @@ static ssize_t _add_opt_pkt(coap_pkt_t *pkt, uint16_t optnum, const void *val,
 
     pkt->options[pkt->options_len].opt_num = optnum;
     pkt->options[pkt->options_len].offset = pkt->payload - (uint8_t *)pkt->hdr;
+#if IS_USED(MODULE_NANOCOAP_OPT_INDEX)
+    _opt_index_add(pkt, pkt->options_len);
+#endif
     pkt->options_len++;
     pkt->payload += optlen;
     pkt->payload_len -= optlen;
@@ -1089,6 +1235,9 @@ ssize_t coap_opt_remove(coap_pkt_t *pkt, uint16_t opt_num)
             memmove(start_new, start_old, move_size);
         }
         pkt->payload -= (start_old - start_new);
+#if IS_USED(MODULE_NANOCOAP_OPT_INDEX)
+        _opt_index_build(pkt);
+#endif
     }
     return (pkt->payload - ((uint8_t *)pkt->hdr)) + pkt->payload_len;
 }
@@ -26,6 +26,7 @@
 #include <stdio.h>
 
 #include "atomic_utils.h"
+#include "mutex.h"
 #include "net/nanocoap_sock.h"
 #include "net/sock/util.h"
 #include "net/sock/udp.h"
@@ -47,6 +48,7 @@ typedef struct {
     coap_blockwise_cb_t callback;
     void *arg;
     bool more;
+    uint8_t szx;
 } _block_ctx_t;
 
 static uint16_t _get_id(void)
@@ -464,6 +466,10 @@ static int _block_cb(void *arg, coap_pkt_t *pkt)
         block2.more = false;
     }
 
+    else {
+        ctx->szx = block2.szx;
+    }
+
     ctx->more = block2.more;
     return ctx->callback(ctx->arg, block2.offset, pkt->payload, pkt->payload_len, block2.more);
 }
@@ -536,29 +542,246 @@ int nanocoap_sock_block_request(coap_block_request_t *req,
     return len;
 }
 
+static int _get_blockwise(nanocoap_sock_t *sock, const char *path,
+                          unsigned num, _block_ctx_t *ctx)
+{
+    uint8_t buf[CONFIG_NANOCOAP_BLOCK_HEADER_MAX];
+
+    while (ctx->more) {
+        DEBUG("fetching block %u\n", num);
+
+        int res = _fetch_block(sock, buf, sizeof(buf), path, ctx->szx, num, ctx);
+        if (res < 0) {
+            DEBUG("error fetching block %u: %d\n", num, res);
+            return res;
+        }
+
+        num += 1;
+    }
+
+    return 0;
+}
+
 int nanocoap_sock_get_blockwise(nanocoap_sock_t *sock, const char *path,
                                 coap_blksize_t blksize,
                                 coap_blockwise_cb_t callback, void *arg)
+{
+    _block_ctx_t ctx = {
+        .callback = callback,
+        .arg = arg,
+        .more = true,
+        .szx = blksize,
+    };
+
+    return _get_blockwise(sock, path, 0, &ctx);
+}
+
+enum {
+    SLOT_SENT,              /**< request sent, waiting for the response      */
+    SLOT_RCVD,              /**< response payload stored in the window       */
+    SLOT_FAILED,            /**< error response received                     */
+};
+
+/* State of one block request of a pipelined transfer */
+typedef struct {
+    uint32_t deadline;      /**< deadline for the next retransmission        */
+    uint32_t timeout;       /**< current retransmission timeout in µs        */
+    int res;                /**< error of a failed block                     */
+    uint16_t id;            /**< message ID of the request                   */
+    uint16_t len;           /**< length of the stored payload                */
+    uint8_t tries_left;     /**< transmissions left                          */
+    uint8_t state;          /**< SLOT_*                                      */
+    bool more;              /**< more flag of the response                   */
+} _pipe_slot_t;
+
+static int _send_block_req(nanocoap_sock_t *sock, const char *path,
+                           coap_blksize_t blksize, unsigned num,
+                           _pipe_slot_t *slot)
 {
     uint8_t buf[CONFIG_NANOCOAP_BLOCK_HEADER_MAX];
+    uint8_t *pos = buf;
+    uint16_t lastonum = 0;
+
+    if (slot->tries_left-- == 0) {
+        DEBUG("nanocoap: maximum retries reached for block %u\n", num);
+        return -ETIMEDOUT;
+    }
+
+    pos += coap_build_hdr((coap_hdr_t *)buf, COAP_TYPE_CON, NULL, 0,
+                          COAP_METHOD_GET, slot->id);
+    pos += coap_opt_put_uri_pathquery(pos, &lastonum, path);
+    pos += coap_opt_put_uint(pos, lastonum, COAP_OPT_BLOCK2, (num << 4) | blksize);
+    assert((size_t)(pos - buf) < sizeof(buf));
 
+    slot->deadline = _deadline_from_interval(slot->timeout);
+    slot->timeout *= 2;
+
+    DEBUG("nanocoap: requesting block %u (%u tries left)\n", num, slot->tries_left);
+    ssize_t res = sock_udp_send(sock, buf, pos - buf, NULL);
+    return (res < 0) ? (int)res : 0;
+}
+
+int nanocoap_sock_get_blockwise_pipelined(nanocoap_sock_t *sock, const char *path,
+                                          coap_blksize_t blksize,
+                                          void *buf, size_t len,
+                                          coap_blockwise_cb_t callback, void *arg)
+{
     _block_ctx_t ctx = {
         .callback = callback,
         .arg = arg,
         .more = true,
+        .szx = blksize,
     };
+    uint8_t reqbuf[CONFIG_NANOCOAP_BLOCK_HEADER_MAX];
 
-    unsigned num = 0;
-    while (ctx.more) {
-        DEBUG("fetching block %u\n", num);
+    /* the first block tells the block size of the server and if there is
+     * anything more to fetch at all */
+    int res = _fetch_block(sock, reqbuf, sizeof(reqbuf), path, blksize, 0, &ctx);
+    if (res < 0 || !ctx.more) {
+        return (res < 0) ? res : 0;
+    }
 
-        int res = _fetch_block(sock, buf, sizeof(buf), path, blksize, num, &ctx);
-        if (res < 0) {
-            DEBUG("error fetching block %u: %d\n", num, res);
-            return res;
+    const size_t blklen = coap_szx2size(ctx.szx);
+    unsigned window = len / blklen;
+    if (window > CONFIG_NANOCOAP_BLOCKWISE_WINDOW) {
+        window = CONFIG_NANOCOAP_BLOCKWISE_WINDOW;
+    }
+    if (window < 2) {
+        return _get_blockwise(sock, path, 1, &ctx);
+    }
+
+    _pipe_slot_t slots[CONFIG_NANOCOAP_BLOCKWISE_WINDOW];
+    uint32_t base = 1;              /* next block handed to the callback */
+    uint32_t next = 1;              /* next block to request */
+    uint32_t last = UINT32_MAX;     /* last block, once a response told */
+
+    while (base <= last) {
+        /* fill the window and retransmit requests that timed out */
+        while ((next < base + window) && (next <= last)) {
+            _pipe_slot_t *slot = &slots[next % window];
+            slot->id = _get_id();
+            slot->tries_left = CONFIG_COAP_MAX_RETRANSMIT + 1;
+            slot->timeout = random_uint32_range(CONFIG_COAP_ACK_TIMEOUT_MS * US_PER_MS,
+                                                CONFIG_COAP_ACK_TIMEOUT_MS *
+                                                CONFIG_COAP_RANDOM_FACTOR_1000);
+            slot->state = SLOT_SENT;
+            if ((res = _send_block_req(sock, path, ctx.szx, next, slot))) {
+                return res;
+            }
+            next++;
         }
 
-        num += 1;
+        uint32_t timeout = UINT32_MAX;
+        for (uint32_t num = base; (num < next) && (num <= last); num++) {
+            _pipe_slot_t *slot = &slots[num % window];
+            if (slot->state != SLOT_SENT) {
+                continue;
+            }
+            if (!_deadline_left_us(slot->deadline) &&
+                (res = _send_block_req(sock, path, ctx.szx, num, slot))) {
+                return res;
+            }
+            if (_deadline_left_us(slot->deadline) < timeout) {
+                timeout = _deadline_left_us(slot->deadline);
+            }
+        }
+
+        /* wait for the next response */
+        void *payload, *rctx = NULL;
+        coap_pkt_t pkt;
+        ssize_t rcvd = sock_udp_recv_buf(sock, &payload, &rctx, timeout, NULL);
+        if (rcvd == -ETIMEDOUT) {
+            continue;
+        }
+        if (rcvd < 0) {
+            DEBUG("nanocoap: error receiving coap response, %d\n", (int)rcvd);
+            return rcvd;
+        }
+
+        uint32_t num = next;
+        coap_block1_t block2;
+        bool has_block2 = false;
+        if (coap_parse(&pkt, payload, rcvd) < 0) {
+            DEBUG("nanocoap: error parsing packet\n");
+        }
+        else if ((coap_get_type(&pkt) == COAP_TYPE_ACK) &&
+                 (coap_get_code_raw(&pkt) == COAP_CODE_EMPTY)) {
+            DEBUG("nanocoap: empty ACK, waiting for separate response\n");
+        }
+        else {
+            has_block2 = coap_get_block2(&pkt, &block2);
+            switch (coap_get_type(&pkt)) {
+            case COAP_TYPE_RST:
+            case COAP_TYPE_ACK:
+                /* match by message ID */
+                for (num = base; num < next; num++) {
+                    if (slots[num % window].id == coap_get_id(&pkt)) {
+                        break;
+                    }
+                }
+                break;
+            case COAP_TYPE_CON:
+                _send_ack(sock, &pkt);
+                /* fall-through */
+            default:
+                /* separate response, match by block number */
+                if (has_block2 && (block2.blknum >= base)) {
+                    num = block2.blknum;
+                }
+                break;
+            }
+        }
+
+        _pipe_slot_t *slot = &slots[num % window];
+        if ((num < next) && (num <= last) && (slot->state == SLOT_SENT)) {
+            int err = _get_error(&pkt);
+
+            slot->state = SLOT_FAILED;
+            if (coap_get_type(&pkt) == COAP_TYPE_RST) {
+                slot->res = -EBADMSG;
+            }
+            else if (err) {
+                /* ignored should the resource turn out to end before */
+                slot->res = err;
+            }
+            else if (!has_block2 || (block2.blknum != num) ||
+                     (block2.szx != ctx.szx) || (pkt.payload_len > blklen)) {
+                DEBUG("nanocoap: unexpected response for block %u\n", (unsigned)num);
+                slot->res = -EBADMSG;
+            }
+            else {
+                memcpy((uint8_t *)buf + (num % window) * blklen,
+                       pkt.payload, pkt.payload_len);
+                slot->len = pkt.payload_len;
+                slot->more = block2.more;
+                slot->state = SLOT_RCVD;
+                if (!slot->more && (num < last)) {
+                    last = num;
+                }
+            }
+        }
+
+        /* release the packet */
+        while (rctx) {
+            sock_udp_recv_buf(sock, &payload, &rctx, 0, NULL);
+        }
+
+        /* hand all blocks received in order to the callback */
+        while ((base <= last) && (slots[base % window].state != SLOT_SENT)) {
+            slot = &slots[base % window];
+            if (slot->state == SLOT_FAILED) {
+                DEBUG("error fetching block %u: %d\n", (unsigned)base, slot->res);
+                return slot->res;
+            }
+            res = callback(arg, base * blklen, (uint8_t *)buf + (base % window) * blklen,
+                           slot->len, slot->more);
+            if (res < 0) {
+                return res;
+            }
+            /* don't mistake the slot's old state for the next block using it */
+            slot->state = SLOT_SENT;
+            base++;
+        }
     }
 
     return 0;
@@ -601,7 +824,18 @@ int nanocoap_get_blockwise_url(const char *url,
         return res;
     }
 
+#if IS_USED(MODULE_NANOCOAP_SOCK_PIPELINE)
+    static uint8_t window[CONFIG_NANOCOAP_BLOCKWISE_WINDOW << CONFIG_NANOCOAP_BLOCK_SIZE_EXP_MAX];
+    static mutex_t lock = MUTEX_INIT;
+
+    mutex_lock(&lock);
+    res = nanocoap_sock_get_blockwise_pipelined(&sock, sock_urlpath(url), blksize,
+                                                window, sizeof(window),
+                                                callback, arg);
+    mutex_unlock(&lock);
+#else
     res = nanocoap_sock_get_blockwise(&sock, sock_urlpath(url), blksize, callback, arg);
+#endif
     nanocoap_sock_close(&sock);
 
     return res;
@@ -93,6 +93,18 @@ int nanocoap_vfs_get_url(const char *url, const char *dst)
     return _finalize_file(fd, res, dst, dst_tmp);
 }
 
+static int _read(int fd, void *buffer, const void **data, size_t len)
+{
+    /* send the file directly from memory mapped storage if possible */
+    int res = vfs_read_ptr(fd, data, len);
+    if (res != -ENOTSUP) {
+        return res;
+    }
+
+    *data = buffer;
+    return vfs_read(fd, buffer, len);
+}
+
 static int _vfs_put(coap_block_request_t *ctx, const char *file, void *buffer)
 {
     int res, fd = vfs_open(file, O_RDONLY, 0644);
@@ -104,9 +116,10 @@ static int _vfs_put(coap_block_request_t *ctx, const char *file, void *buffer)
     int buffer_len = coap_szx2size(ctx->blksize) + 1;
 
     bool more = true;
-    while (more && (res = vfs_read(fd, buffer, buffer_len)) > 0) {
+    const void *data = buffer;
+    while (more && (res = _read(fd, buffer, &data, buffer_len)) > 0) {
         more = res == buffer_len;
-        res = nanocoap_sock_block_request(ctx, buffer,
+        res = nanocoap_sock_block_request(ctx, data,
                                           res, more, NULL, NULL);
         if (res < 0) {
             break;
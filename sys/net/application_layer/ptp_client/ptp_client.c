@@ -0,0 +1,429 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     net_ptp_client
+ * @{
+ *
+ * @file
+ * @brief       PTP client implementation
+ *
+ * @}
+ */
+
+#include <assert.h>
+#include <errno.h>
+#include <inttypes.h>
+#include <string.h>
+
+#include "byteorder.h"
+#include "event.h"
+#include "luid.h"
+#include "mutex.h"
+#include "net/netif.h"
+#include "net/ptp_client.h"
+#include "net/sock/async/event.h"
+#include "periph/ptp.h"
+#include "time_units.h"
+#include "ztimer.h"
+
+#define ENABLE_DEBUG            0
+#include "debug.h"
+
+#define PTP_VERSION             (2U)
+
+#define MSG_SYNC                (0x0)
+#define MSG_DELAY_REQ           (0x1)
+#define MSG_FOLLOW_UP           (0x8)
+#define MSG_DELAY_RESP          (0x9)
+
+#define LEN_HDR                 (34U)
+#define LEN_TIMESTAMP           (10U)
+#define LEN_PORT_ID             (10U)
+/* Sync, Follow_Up and Delay_Req */
+#define LEN_SYNC                (LEN_HDR + LEN_TIMESTAMP)
+#define LEN_DELAY_RESP          (LEN_HDR + LEN_TIMESTAMP + LEN_PORT_ID)
+
+#define POS_LEN                 (2U)
+#define POS_DOMAIN              (4U)
+#define POS_FLAGS               (6U)
+#define POS_CORRECTION          (8U)
+#define POS_PORT_ID             (20U)
+#define POS_SEQ                 (30U)
+#define POS_CONTROL             (32U)
+#define POS_LOG_INTERVAL        (33U)
+#define POS_BODY                (LEN_HDR)
+
+#define FLAG_TWO_STEP           (0x02)
+#define CONTROL_DELAY_REQ       (0x01)
+#define LOG_INTERVAL_NONE       (0x7f)
+
+/* a transmission timestamp taken later than this after reading the clock
+ * before sending belongs to another frame */
+#define TX_TS_WINDOW_NS         (NS_PER_MS)
+
+/* correction of ptp_clock_adjust_speed() per ppb, Q16 */
+#define SPEED_PER_PPB_Q16       (281475U)   /* 2^32 / 10^9 * 2^16 */
+
+static char _stack[PTP_CLIENT_STACKSIZE];
+static event_queue_t _queue;
+static sock_udp_t _event_sock;
+static sock_udp_t _general_sock;
+static uint8_t _buf[LEN_DELAY_RESP + 32];
+
+static mutex_t _stats_lock = MUTEX_INIT;
+static ptp_client_stats_t _stats;
+
+static struct {
+    uint8_t port_id[LEN_PORT_ID];   /* own port identity */
+    uint8_t master[LEN_PORT_ID];    /* port identity of the master */
+    sock_udp_ep_t master_ep;        /* event port of the master */
+    uint16_t netif;                 /* interface the master is heard on */
+    uint32_t last_sync_ms;          /* reception of the last Sync */
+    uint32_t last_delay_req_ms;     /* transmission of the last Delay_Req */
+    uint64_t t2;                    /* reception of the pending Sync */
+    int64_t sync_correction;        /* correction of the pending Sync */
+    uint64_t t1_prev;               /* origin of the last Sync processed */
+    int64_t ms_delay;               /* t2 - t1 of the last Sync processed */
+    int64_t req_ms_delay;           /* ms_delay when Delay_Req was sent */
+    uint64_t t3;                    /* Delay_Req read before sending */
+    int64_t integral;               /* integral term of the controller, ppb */
+    uint16_t sync_seq;
+    uint16_t delay_seq;
+    bool has_master;
+    bool sync_pending;
+    bool delay_pending;
+    bool ms_valid;                  /* ms_delay valid for the current clock */
+    bool running;                   /* controller was started */
+    bool started;                   /* client thread was started */
+} _state;
+
+static uint64_t _ts_get(const uint8_t *buf)
+{
+    uint64_t sec = ((uint64_t)byteorder_bebuftohs(buf) << 32)
+                 | byteorder_bebuftohl(&buf[2]);
+
+    return sec * NS_PER_SEC + byteorder_bebuftohl(&buf[6]);
+}
+
+static void _ts_set(uint8_t *buf, uint64_t ns)
+{
+    uint64_t sec = ns / NS_PER_SEC;
+
+    byteorder_htobebufs(buf, (uint16_t)(sec >> 32));
+    byteorder_htobebufl(&buf[2], (uint32_t)sec);
+    byteorder_htobebufl(&buf[6], (uint32_t)(ns % NS_PER_SEC));
+}
+
+static int64_t _correction_get(const uint8_t *buf)
+{
+    /* the correction field is given in 2^-16 ns */
+    return (int64_t)byteorder_bebuftohll(&buf[POS_CORRECTION]) / (1 << 16);
+}
+
+static bool _hdr_valid(const uint8_t *buf, ssize_t len, size_t min_len)
+{
+    return (len >= (ssize_t)min_len)
+        && ((buf[1] & 0x0f) == PTP_VERSION)
+        && (byteorder_bebuftohs(&buf[POS_LEN]) >= min_len)
+        && (buf[POS_DOMAIN] == CONFIG_PTP_CLIENT_DOMAIN);
+}
+
+static bool _from_master(const uint8_t *buf)
+{
+    return _state.has_master &&
+           !memcmp(&buf[POS_PORT_ID], _state.master, LEN_PORT_ID);
+}
+
+static int64_t _clamp(int64_t val, int64_t max)
+{
+    if (val > max) {
+        return max;
+    }
+    if (val < -max) {
+        return -max;
+    }
+    return val;
+}
+
+static void _update_stats(int64_t offset, int64_t ppb, bool step)
+{
+    mutex_lock(&_stats_lock);
+    _stats.offset = offset;
+    _stats.ppb = ppb;
+    _stats.syncs++;
+    if (step) {
+        _stats.steps++;
+    }
+    _stats.locked = !step && (offset < CONFIG_PTP_CLIENT_LOCK_THRESHOLD_NS)
+                          && (-offset < CONFIG_PTP_CLIENT_LOCK_THRESHOLD_NS);
+    mutex_unlock(&_stats_lock);
+}
+
+/* PI controller of the clock speed, returns true if the clock was stepped */
+static bool _discipline(int64_t offset, uint64_t t1)
+{
+    if (!_state.running || (offset > CONFIG_PTP_CLIENT_STEP_THRESHOLD_NS) ||
+        (-offset > CONFIG_PTP_CLIENT_STEP_THRESHOLD_NS)) {
+        DEBUG("ptp_client: stepping clock by %" PRId64 " ns\n", -offset);
+        ptp_clock_adjust(-offset);
+        _state.t1_prev = t1;
+        _state.running = true;
+        _update_stats(offset, _state.integral, true);
+        return true;
+    }
+
+    int64_t interval = (int64_t)(t1 - _state.t1_prev);
+    _state.t1_prev = t1;
+    if (interval <= 0) {
+        return false;
+    }
+
+    /* offset accumulated per second, i.e. the speed error in ppb */
+    int64_t error = offset * (int64_t)NS_PER_SEC / interval;
+    _state.integral = _clamp(_state.integral +
+                             error * CONFIG_PTP_CLIENT_KI / 1000,
+                             CONFIG_PTP_CLIENT_MAX_PPB);
+    int64_t ppb = _clamp(_state.integral + error * CONFIG_PTP_CLIENT_KP / 1000,
+                         CONFIG_PTP_CLIENT_MAX_PPB);
+    /* slow the clock down if it is ahead of the master */
+    ptp_clock_adjust_speed((int32_t)((-ppb * SPEED_PER_PPB_Q16) / (1 << 16)));
+    _update_stats(offset, ppb, false);
+    return false;
+}
+
+static void _send_delay_req(void)
+{
+    uint8_t *buf = _buf;
+
+    memset(buf, 0, LEN_SYNC);
+    buf[0] = MSG_DELAY_REQ;
+    buf[1] = PTP_VERSION;
+    byteorder_htobebufs(&buf[POS_LEN], LEN_SYNC);
+    buf[POS_DOMAIN] = CONFIG_PTP_CLIENT_DOMAIN;
+    memcpy(&buf[POS_PORT_ID], _state.port_id, LEN_PORT_ID);
+    byteorder_htobebufs(&buf[POS_SEQ], ++_state.delay_seq);
+    buf[POS_CONTROL] = CONTROL_DELAY_REQ;
+    buf[POS_LOG_INTERVAL] = LOG_INTERVAL_NONE;
+
+    uint64_t t3 = ptp_clock_read_u64();
+    _ts_set(&buf[POS_BODY], t3);
+    if (sock_udp_send(&_event_sock, buf, LEN_SYNC, &_state.master_ep) < 0) {
+        DEBUG_PUTS("ptp_client: sending Delay_Req failed");
+        return;
+    }
+    _state.t3 = t3;
+    _state.req_ms_delay = _state.ms_delay;
+    _state.delay_pending = true;
+    _state.last_delay_req_ms = ztimer_now(ZTIMER_MSEC);
+}
+
+static void _sync(uint64_t t1, uint64_t t2)
+{
+    int64_t path_delay = _stats.path_delay;
+    int64_t ms_delay = (int64_t)(t2 - t1);
+    int64_t offset = ms_delay - ((path_delay > 0) ? path_delay : 0);
+
+    _state.ms_delay = ms_delay;
+    if (_discipline(offset, t1)) {
+        /* the measurement no longer matches the clock */
+        _state.ms_valid = false;
+        _state.delay_pending = false;
+        return;
+    }
+    _state.ms_valid = true;
+
+    uint32_t now = ztimer_now(ZTIMER_MSEC);
+    if ((path_delay < 0) ||
+        ((now - _state.last_delay_req_ms) >=
+         CONFIG_PTP_CLIENT_DELAY_REQ_INTERVAL_MS)) {
+        _send_delay_req();
+    }
+}
+
+/* the network device timestamps the transmission, if supported */
+static uint64_t _t3_get(void)
+{
+    uint64_t ts;
+    netif_t *netif = (_state.netif) ? netif_get_by_id(_state.netif)
+                                    : netif_iter(NULL);
+
+    if (netif && (netif_get_opt(netif, NETOPT_TX_TIMESTAMP, 0, &ts,
+                                sizeof(ts)) == sizeof(ts)) &&
+        (ts >= _state.t3) && ((ts - _state.t3) < TX_TS_WINDOW_NS)) {
+        return ts;
+    }
+    return _state.t3;
+}
+
+static void _delay(uint64_t t4)
+{
+    int64_t sample = (_state.req_ms_delay + (int64_t)(t4 - _t3_get())) / 2;
+
+    _state.delay_pending = false;
+    if (!_state.ms_valid || (sample < 0)) {
+        return;
+    }
+
+    mutex_lock(&_stats_lock);
+    if (_stats.path_delay < 0) {
+        _stats.path_delay = sample;
+    }
+    else {
+        _stats.path_delay += (sample - _stats.path_delay) /
+                             (1 << CONFIG_PTP_CLIENT_DELAY_FILTER_SHIFT);
+    }
+    mutex_unlock(&_stats_lock);
+}
+
+static void _on_sync(const uint8_t *buf, const sock_udp_ep_t *remote,
+                     uint64_t t2)
+{
+    uint32_t now = ztimer_now(ZTIMER_MSEC);
+
+    if (!_from_master(buf)) {
+        if (_state.has_master &&
+            ((now - _state.last_sync_ms) < CONFIG_PTP_CLIENT_MASTER_TIMEOUT_MS)) {
+            return;
+        }
+        DEBUG_PUTS("ptp_client: new master");
+        memcpy(_state.master, &buf[POS_PORT_ID], LEN_PORT_ID);
+        _state.has_master = true;
+        _state.running = false;
+        _state.ms_valid = false;
+        _state.delay_pending = false;
+        mutex_lock(&_stats_lock);
+        _stats.path_delay = -1;
+        mutex_unlock(&_stats_lock);
+    }
+    _state.last_sync_ms = now;
+    _state.master_ep = *remote;
+    _state.master_ep.port = PTP_CLIENT_EVENT_PORT;
+    _state.netif = remote->netif;
+
+    if (buf[POS_FLAGS] & FLAG_TWO_STEP) {
+        /* the origin timestamp follows in the Follow_Up message */
+        _state.t2 = t2;
+        _state.sync_correction = _correction_get(buf);
+        _state.sync_seq = byteorder_bebuftohs(&buf[POS_SEQ]);
+        _state.sync_pending = true;
+    }
+    else {
+        _sync(_ts_get(&buf[POS_BODY]) + _correction_get(buf), t2);
+    }
+}
+
+static void _on_event_pkt(sock_udp_t *sock, sock_async_flags_t type, void *arg)
+{
+    (void)arg;
+
+    if (!(type & SOCK_ASYNC_MSG_RECV)) {
+        return;
+    }
+
+    sock_udp_ep_t remote;
+    sock_udp_aux_rx_t aux = { .flags = SOCK_AUX_GET_TIMESTAMP };
+    ssize_t len = sock_udp_recv_aux(sock, _buf, sizeof(_buf), 0, &remote, &aux);
+    if (aux.flags & SOCK_AUX_GET_TIMESTAMP) {
+        /* not timestamped by the network device */
+        aux.timestamp = ptp_clock_read_u64();
+    }
+
+    if (_hdr_valid(_buf, len, LEN_SYNC) && ((_buf[0] & 0x0f) == MSG_SYNC)) {
+        _on_sync(_buf, &remote, aux.timestamp);
+    }
+}
+
+static void _on_general_pkt(sock_udp_t *sock, sock_async_flags_t type,
+                            void *arg)
+{
+    (void)arg;
+
+    if (!(type & SOCK_ASYNC_MSG_RECV)) {
+        return;
+    }
+
+    ssize_t len = sock_udp_recv(sock, _buf, sizeof(_buf), 0, NULL);
+    if (!_hdr_valid(_buf, len, LEN_SYNC) || !_from_master(_buf)) {
+        return;
+    }
+
+    uint16_t seq = byteorder_bebuftohs(&_buf[POS_SEQ]);
+    switch (_buf[0] & 0x0f) {
+    case MSG_FOLLOW_UP:
+        if (_state.sync_pending && (seq == _state.sync_seq)) {
+            _state.sync_pending = false;
+            _sync(_ts_get(&_buf[POS_BODY]) + _state.sync_correction +
+                  _correction_get(_buf), _state.t2);
+        }
+        break;
+    case MSG_DELAY_RESP:
+        if ((len >= (ssize_t)LEN_DELAY_RESP) && _state.delay_pending &&
+            (seq == _state.delay_seq) &&
+            !memcmp(&_buf[POS_BODY + LEN_TIMESTAMP], _state.port_id,
+                    LEN_PORT_ID)) {
+            _delay(_ts_get(&_buf[POS_BODY]) - _correction_get(_buf));
+        }
+        break;
+    default:
+        break;
+    }
+}
+
+static void *_ptp_client_thread(void *arg)
+{
+    (void)arg;
+    event_queue_claim(&_queue);
+    event_loop(&_queue);
+    /* should never be reached */
+    return NULL;
+}
+
+int ptp_client_run(const sock_udp_ep_t *local)
+{
+    assert(local);
+
+    int res;
+    sock_udp_ep_t ep = *local;
+
+    if (_state.started) {
+        return -EALREADY;
+    }
+
+    ep.port = PTP_CLIENT_EVENT_PORT;
+    if ((res = sock_udp_create(&_event_sock, &ep, NULL, 0)) < 0) {
+        return res;
+    }
+    ep.port = PTP_CLIENT_GENERAL_PORT;
+    if ((res = sock_udp_create(&_general_sock, &ep, NULL, 0)) < 0) {
+        sock_udp_close(&_event_sock);
+        return res;
+    }
+
+    /* clock identity followed by port number 1 */
+    luid_get(_state.port_id, LEN_PORT_ID - 2);
+    byteorder_htobebufs(&_state.port_id[LEN_PORT_ID - 2], 1);
+    _state.netif = local->netif;
+    _state.started = true;
+    _stats.path_delay = -1;
+
+    event_queue_init_detached(&_queue);
+    sock_udp_event_init(&_event_sock, &_queue, _on_event_pkt, NULL);
+    sock_udp_event_init(&_general_sock, &_queue, _on_general_pkt, NULL);
+    thread_create(_stack, sizeof(_stack), PTP_CLIENT_PRIO,
+                  THREAD_CREATE_STACKTEST, _ptp_client_thread, NULL,
+                  "ptp_client");
+    return 0;
+}
+
+void ptp_client_get_stats(ptp_client_stats_t *stats)
+{
+    mutex_lock(&_stats_lock);
+    *stats = _stats;
+    mutex_unlock(&_stats_lock);
+}
@@ -21,11 +21,15 @@
 
 #include <arpa/inet.h>
 
+#include "mutex.h"
 #include "net/dns.h"
 #include "net/dns/cache.h"
 #include "net/dns/msg.h"
 #include "net/sock/udp.h"
 #include "net/sock/dns.h"
+#if IS_USED(MODULE_DNS_CACHE_PREFETCH)
+#include "event/thread.h"
+#endif
 
 /* min domain name length is 1, so minimum record length is 7 */
 #define DNS_MIN_REPLY_LEN   (unsigned)(sizeof(dns_hdr_t) + 7)
@@ -33,6 +37,18 @@
 /* global DNS server UDP endpoint */
 sock_udp_ep_t sock_dns_server;
 
+/* protects the message buffer */
+static mutex_t _lock = MUTEX_INIT;
+
+#if IS_USED(MODULE_DNS_CACHE_PREFETCH)
+static void _prefetch_handler(event_t *event);
+
+static event_t _prefetch_event = { .handler = _prefetch_handler };
+static mutex_t _prefetch_lock = MUTEX_INIT;
+static char _prefetch_name[SOCK_DNS_MAX_NAME_LEN + 1];
+static int _prefetch_family;
+#endif
+
 #ifdef MODULE_AUTO_INIT_SOCK_DNS
 void auto_init_sock_dns(void)
 {
@@ -66,30 +82,18 @@ void auto_init_sock_dns(void)
 }
 #endif /* MODULE_AUTO_INIT_SOCK_DNS */
 
-int sock_dns_query(const char *domain_name, void *addr_out, int family)
+static int _query(const char *domain_name, void *addr_out, int family)
 {
     ssize_t res;
     sock_udp_t sock_dns;
     static uint8_t dns_buf[CONFIG_DNS_MSG_LEN];
 
-    if (sock_dns_server.port == 0) {
-        return -ECONNREFUSED;
-    }
-
-    if (strlen(domain_name) > SOCK_DNS_MAX_NAME_LEN) {
-        return -ENOSPC;
-    }
-
-    res = dns_cache_query(domain_name, addr_out, family);
-    if (res) {
-        return res;
-    }
-
     res = sock_udp_create(&sock_dns, NULL, &sock_dns_server, 0);
     if (res) {
-        goto out;
+        return res;
     }
 
+    mutex_lock(&_lock);
     uint16_t id = 0;
     for (int i = 0; i < SOCK_DNS_RETRIES; i++) {
         size_t buflen = dns_msg_compose_query(dns_buf, domain_name, id, family);
@@ -115,6 +119,61 @@ int sock_dns_query(const char *domain_name, void *addr_out, int family)
     }
 
 out:
+    mutex_unlock(&_lock);
     sock_udp_close(&sock_dns);
     return res;
 }
+
+#if IS_USED(MODULE_DNS_CACHE_PREFETCH)
+static void _prefetch_handler(event_t *event)
+{
+    (void)event;
+    char domain_name[SOCK_DNS_MAX_NAME_LEN + 1];
+    uint8_t addr[16];
+    int family;
+
+    mutex_lock(&_prefetch_lock);
+    strcpy(domain_name, _prefetch_name);
+    family = _prefetch_family;
+    _prefetch_name[0] = '\0';
+    mutex_unlock(&_prefetch_lock);
+
+    /* the answer ends up in the cache */
+    _query(domain_name, addr, family);
+}
+
+static void _prefetch(const char *domain_name, int family)
+{
+    mutex_lock(&_prefetch_lock);
+    /* one refresh at a time, others get another chance on their next lookup */
+    if ((_prefetch_name[0] == '\0') && dns_cache_refresh_due(domain_name, family)) {
+        strcpy(_prefetch_name, domain_name);
+        _prefetch_family = family;
+        event_post(EVENT_PRIO_LOWEST, &_prefetch_event);
+    }
+    mutex_unlock(&_prefetch_lock);
+}
+#endif
+
+int sock_dns_query(const char *domain_name, void *addr_out, int family)
+{
+    ssize_t res;
+
+    if (sock_dns_server.port == 0) {
+        return -ECONNREFUSED;
+    }
+
+    if (strlen(domain_name) > SOCK_DNS_MAX_NAME_LEN) {
+        return -ENOSPC;
+    }
+
+    res = dns_cache_query(domain_name, addr_out, family);
+    if (res) {
+#if IS_USED(MODULE_DNS_CACHE_PREFETCH)
+        _prefetch(domain_name, family);
+#endif
+        return res;
+    }
+
+    return _query(domain_name, addr_out, family);
+}
@@ -29,6 +29,7 @@
 #include "net/iana/portrange.h"
 #include "net/sock/dtls.h"
 #include "net/sock/udp.h"
+#include "net/sock/util.h"
 #include "net/sock/dodtls.h"
 #include "random.h"
 #include "ztimer.h"
@@ -159,6 +160,18 @@ static inline bool _server_set(void)
     return _cred_type != CREDMAN_TYPE_EMPTY;
 }
 
+static bool _server_is(const sock_udp_ep_t *server,
+                       const credman_credential_t *creds)
+{
+    sock_udp_ep_t remote;
+
+    if (!_server_set() || (creds->tag != _cred_tag) || (creds->type != _cred_type)) {
+        return false;
+    }
+    return (sock_udp_get_remote(&_udp_sock, &remote) == 0) &&
+           sock_udp_ep_equal(&remote, server);
+}
+
 static void _close_session(credman_tag_t creds_tag, credman_type_t creds_type)
 {
     sock_dtls_session_destroy(&_dtls_sock, &_server_session);
@@ -177,6 +190,17 @@ static int _connect_server(const sock_udp_ep_t *server,
     /* server != NULL is checked in sock_dodtls_set_server() */
     assert(creds != NULL);
     mutex_lock(&_server_mutex);
+    if (_server_is(server, creds)) {
+        /* keep the established session, a new one would need a full handshake */
+        DEBUG("Session with server already established\n");
+        res = 0;
+        goto exit;
+    }
+    if (_server_set()) {
+        _close_session(_cred_tag, _cred_type);
+        _cred_tag = CREDMAN_TAG_EMPTY;
+        _cred_type = CREDMAN_TYPE_EMPTY;
+    }
     while (res == -EADDRINUSE) {
         /* choose random ephemeral port, since DTLS requires a local port */
         local.port = IANA_DYNAMIC_PORTRANGE_MIN +
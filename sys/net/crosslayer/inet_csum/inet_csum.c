@@ -14,12 +14,56 @@
 
 #include <inttypes.h>
 #include <stdio.h>
+#include <string.h>
+
+#include "byteorder.h"
 #include "od.h"
 #include "net/inet_csum.h"
 
 #define ENABLE_DEBUG 0
 #include "debug.h"
 
+/* The ones' complement sum does not depend on the byte order (RFC 1071,
+ * section 2 (B)), so the buffer is summed in 32 bit words of host byte order
+ * into a 64 bit accumulator, which can't overflow for any uint16_t length.
+ * Compilers turn this into word loads and add-with-carry, e.g. on Cortex-M
+ * and x86, instead of forming every 16 bit word from two bytes. */
+static uint16_t _sum(const uint8_t *buf, size_t len)
+{
+    uint64_t acc = 0;
+    uint32_t w[4];
+    uint16_t h;
+
+    for (; len >= sizeof(w); buf += sizeof(w), len -= sizeof(w)) {
+        memcpy(w, buf, sizeof(w));
+        acc += (uint64_t)w[0] + w[1] + w[2] + w[3];
+    }
+    for (; len >= sizeof(w[0]); buf += sizeof(w[0]), len -= sizeof(w[0])) {
+        memcpy(w, buf, sizeof(w[0]));
+        acc += w[0];
+    }
+    if (len >= sizeof(h)) {
+        memcpy(&h, buf, sizeof(h));
+        acc += h;
+        buf += sizeof(h);
+        len -= sizeof(h);
+    }
+    if (len) {
+        /* last byte is the top half of a 16 bit word in network byte order */
+        const uint8_t last[2] = { *buf, 0 };
+        memcpy(&h, last, sizeof(h));
+        acc += h;
+    }
+
+    acc = (acc & 0xffffffff) + (acc >> 32);
+    acc = (acc & 0xffffffff) + (acc >> 32);
+    acc = (acc & 0xffff) + (acc >> 16);
+    acc = (acc & 0xffff) + (acc >> 16);
+    acc = (acc & 0xffff) + (acc >> 16);
+
+    return ntohs((uint16_t)acc);
+}
+
 uint16_t inet_csum_slice(uint16_t sum, const uint8_t *buf, uint16_t len, size_t accum_len)
 {
     uint32_t csum = sum;
@@ -42,16 +86,9 @@ uint16_t inet_csum_slice(uint16_t sum, const uint8_t *buf, uint16_t len, size_t
         csum += *buf;         /* add first byte as bottom half of 16-byte word */
         buf++;
         len--;
-        accum_len++;
-    }
-
-    for (unsigned i = 0; i < (len >> 1); buf += 2, i++) {
-        csum += (uint16_t)(*buf << 8) + *(buf + 1); /* group bytes by 16-byte words */
-                                                    /* and add them */
     }
 
-    if ((accum_len + len) & 1)          /* if accumulated length is odd */
-        csum += (uint16_t)(*buf << 8);  /* add last byte as top half of 16-byte word */
+    csum += _sum(buf, len);
 
     while (csum >> 16) {
         uint16_t carry = csum >> 16;
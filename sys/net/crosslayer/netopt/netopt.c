@@ -133,6 +133,10 @@ static const char *_netopt_strmap[] = {
     [NETOPT_BATMON]                = "NETOPT_BATMON",
     [NETOPT_L2_GROUP]              = "NETOPT_L2_GROUP",
     [NETOPT_L2_GROUP_LEAVE]        = "NETOPT_L2_GROUP_LEAVE",
+    [NETOPT_TX_IOLIST_MAX]         = "NETOPT_TX_IOLIST_MAX",
+    [NETOPT_TX_TIMESTAMP]          = "NETOPT_TX_TIMESTAMP",
+    [NETOPT_TX_CSUM_OFFLOAD]       = "NETOPT_TX_CSUM_OFFLOAD",
+    [NETOPT_RX_CSUM_OFFLOAD]       = "NETOPT_RX_CSUM_OFFLOAD",
     [NETOPT_NUMOF]                 = "NETOPT_NUMOF",
 };
 
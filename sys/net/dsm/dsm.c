@@ -18,31 +18,169 @@
  * @}
  */
 
+#include <assert.h>
+#include <string.h>
+
 #include "net/dsm.h"
 #include "mutex.h"
 #include "net/sock/util.h"
-#include "xtimer.h"
+#include "ztimer.h"
 
 #define ENABLE_DEBUG 0
 #include "debug.h"
 
+/* marks the end of the lists, slots are indexed by uint8_t */
+#define NIL             UINT8_MAX
+
+static_assert(CONFIG_DSM_PEER_MAX < NIL, "CONFIG_DSM_PEER_MAX must be below 255");
+static_assert(CONFIG_DSM_BUCKETS_NUMOF <= NIL, "CONFIG_DSM_BUCKETS_NUMOF must be at most 255");
+
 typedef struct {
     sock_dtls_t *sock;
     sock_dtls_session_t session;
     dsm_state_t state;
     uint32_t last_used_sec;
+    uint8_t next;       /**< next slot in the bucket or the free list */
+    uint8_t bucket;     /**< bucket of the endpoint */
+    uint8_t lru_prev;   /**< more recently used slot */
+    uint8_t lru_next;   /**< less recently used slot */
 } dsm_session_t;
 
-static int _find_session(sock_dtls_t *sock, sock_dtls_session_t *to_find,
-                         dsm_session_t **session);
-
 static mutex_t _lock;
 static dsm_session_t _sessions[CONFIG_DSM_PEER_MAX];
+static uint8_t _buckets[CONFIG_DSM_BUCKETS_NUMOF];
+static uint8_t _free;
+static uint8_t _lru_head;
+static uint8_t _lru_tail;
 static uint8_t _available_slots;
 
+static uint8_t _hash(const sock_dtls_t *sock, const sock_udp_ep_t *ep)
+{
+    uint32_t h = 2166136261U ^ (uintptr_t)sock ^ ep->port;
+    const uint8_t *addr = (const uint8_t *)&ep->addr;
+    size_t len = sizeof(ep->addr);
+
+#ifdef SOCK_HAS_IPV4
+    if (ep->family == AF_INET) {
+        len = sizeof(ep->addr.ipv4);
+    }
+#endif
+    for (size_t i = 0; i < len; i++) {
+        h = (h ^ addr[i]) * 16777619U;
+    }
+
+    return (h ^ (h >> 16)) % CONFIG_DSM_BUCKETS_NUMOF;
+}
+
+static uint32_t _now_sec(void)
+{
+    return ztimer_now(ZTIMER_SEC);
+}
+
+static void _lru_unlink(uint8_t idx)
+{
+    dsm_session_t *slot = &_sessions[idx];
+
+    if (slot->lru_prev == NIL) {
+        _lru_head = slot->lru_next;
+    }
+    else {
+        _sessions[slot->lru_prev].lru_next = slot->lru_next;
+    }
+    if (slot->lru_next == NIL) {
+        _lru_tail = slot->lru_prev;
+    }
+    else {
+        _sessions[slot->lru_next].lru_prev = slot->lru_prev;
+    }
+}
+
+static void _lru_push(uint8_t idx)
+{
+    dsm_session_t *slot = &_sessions[idx];
+
+    slot->lru_prev = NIL;
+    slot->lru_next = _lru_head;
+    if (_lru_head == NIL) {
+        _lru_tail = idx;
+    }
+    else {
+        _sessions[_lru_head].lru_prev = idx;
+    }
+    _lru_head = idx;
+}
+
+/* Search for existing session
+ * Returns the index of the session or NIL */
+static uint8_t _find_session(sock_dtls_t *sock, const sock_udp_ep_t *ep, uint8_t bucket)
+{
+    sock_udp_ep_t curr_ep;
+
+    for (uint8_t i = _buckets[bucket]; i != NIL; i = _sessions[i].next) {
+        if (_sessions[i].sock != sock) {
+            continue;
+        }
+        sock_dtls_session_get_udp_ep(&_sessions[i].session, &curr_ep);
+        if (sock_udp_ep_equal(&curr_ep, ep)) {
+            return i;
+        }
+    }
+    return NIL;
+}
+
+/* Takes a slot from the free list and adds it to the index
+ * Returns the index of the slot or NIL */
+static uint8_t _alloc_session(sock_dtls_t *sock, const sock_udp_ep_t *ep, uint8_t bucket)
+{
+    uint8_t idx = _free;
+
+    if (idx == NIL) {
+        return NIL;
+    }
+
+    dsm_session_t *slot = &_sessions[idx];
+    _free = slot->next;
+    slot->sock = sock;
+    sock_dtls_session_set_udp_ep(&slot->session, ep);
+    slot->state = SESSION_STATE_NONE;
+    slot->bucket = bucket;
+    slot->next = _buckets[bucket];
+    _buckets[bucket] = idx;
+    _lru_push(idx);
+    _available_slots--;
+
+    return idx;
+}
+
+static void _free_session(uint8_t idx)
+{
+    dsm_session_t *slot = &_sessions[idx];
+    uint8_t *prev = &_buckets[slot->bucket];
+
+    while (*prev != idx) {
+        prev = &_sessions[*prev].next;
+    }
+    *prev = slot->next;
+    _lru_unlink(idx);
+
+    slot->state = SESSION_STATE_NONE;
+    slot->sock = NULL;
+    slot->next = _free;
+    _free = idx;
+    _available_slots++;
+}
+
 void dsm_init(void)
 {
     mutex_init(&_lock);
+    memset(_buckets, NIL, sizeof(_buckets));
+    for (uint8_t i = 0; i < CONFIG_DSM_PEER_MAX; i++) {
+        _sessions[i].state = SESSION_STATE_NONE;
+        _sessions[i].next = (i + 1 < CONFIG_DSM_PEER_MAX) ? i + 1 : NIL;
+    }
+    _free = 0;
+    _lru_head = NIL;
+    _lru_tail = NIL;
     _available_slots = CONFIG_DSM_PEER_MAX;
 }
 
@@ -50,36 +188,41 @@ dsm_state_t dsm_store(sock_dtls_t *sock, sock_dtls_session_t *session,
                       dsm_state_t new_state, bool restore)
 {
     sock_udp_ep_t ep;
-    dsm_session_t *session_slot = NULL;
     dsm_state_t prev_state = NO_SPACE;
+
+    sock_dtls_session_get_udp_ep(session, &ep);
+    uint8_t bucket = _hash(sock, &ep);
+
     mutex_lock(&_lock);
+    uint8_t idx = _find_session(sock, &ep, bucket);
+    dsm_session_t *session_slot;
 
-    ssize_t res = _find_session(sock, session, &session_slot);
-    if (res < 0) {
-        DEBUG("dsm: no space for session to store\n");
-        goto out;
+    if (idx != NIL) {
+        session_slot = &_sessions[idx];
+        /* existing session found and session should be restored */
+        if (restore) {
+            DEBUG("dsm: existing session found, restoring\n");
+            memcpy(session, &session_slot->session, sizeof(sock_dtls_session_t));
+        }
+        _lru_unlink(idx);
+        _lru_push(idx);
+    }
+    else {
+        idx = _alloc_session(sock, &ep, bucket);
+        if (idx == NIL) {
+            DEBUG("dsm: no space for session to store\n");
+            goto out;
+        }
+        /* no existing session found */
+        DEBUG("dsm: no existing session found, storing as new session\n");
+        session_slot = &_sessions[idx];
     }
 
     prev_state = session_slot->state;
     if (session_slot->state != SESSION_STATE_ESTABLISHED) {
         session_slot->state = new_state;
     }
-
-    /* no existing session found */
-    if (res == 0) {
-        DEBUG("dsm: no existing session found, storing as new session\n");
-        sock_dtls_session_get_udp_ep(session, &ep);
-        sock_dtls_session_set_udp_ep(&session_slot->session, &ep);
-        session_slot->sock = sock;
-        _available_slots--;
-    }
-
-    /* existing session found and session should be restored */
-    if (res == 1 && restore) {
-        DEBUG("dsm: existing session found, restoring\n");
-        memcpy(session, &session_slot->session, sizeof(sock_dtls_session_t));
-    }
-    session_slot->last_used_sec = (uint32_t)(xtimer_now_usec64() / US_PER_SEC);
+    session_slot->last_used_sec = _now_sec();
 
 out:
     mutex_unlock(&_lock);
@@ -88,24 +231,22 @@ out:
 
 void dsm_remove(sock_dtls_t *sock, sock_dtls_session_t *session)
 {
-    dsm_session_t *session_slot = NULL;
-    mutex_lock(&_lock);
-    if (_find_session(sock, session, &session_slot) == 1) {
-        if (session_slot->state == SESSION_STATE_NONE) {
-            /* session has already been removed. Can happen when we remove the session
-            before we get the close ACK of the remote peer (e.g. force reset of peer)
-            and then get an ACK (= SOCK_ASYNC_CONN_FIN event) of the remote and
-            call this function again. */
-            goto out;
-        }
+    sock_udp_ep_t ep;
+
+    sock_dtls_session_get_udp_ep(session, &ep);
+    uint8_t bucket = _hash(sock, &ep);
 
-        session_slot->state = SESSION_STATE_NONE;
-        _available_slots++;
+    mutex_lock(&_lock);
+    uint8_t idx = _find_session(sock, &ep, bucket);
+    if (idx != NIL) {
+        _free_session(idx);
         DEBUG("dsm: removed session\n");
     } else {
+        /* Can happen when we remove the session before we get the close ACK of
+        the remote peer (e.g. force reset of peer) and then get an ACK
+        (= SOCK_ASYNC_CONN_FIN event) of the remote and call this function again. */
         DEBUG("dsm: could not find session to remove, it was probably already removed\n");
     }
-out:
     mutex_unlock(&_lock);
 }
 
@@ -119,68 +260,50 @@ uint8_t dsm_get_num_maximum_slots(void)
     return CONFIG_DSM_PEER_MAX;
 }
 
+/* Search for the least recently used established session of sock
+ * Returns the index of the session or NIL */
+static uint8_t _find_lru(sock_dtls_t *sock)
+{
+    for (uint8_t i = _lru_tail; i != NIL; i = _sessions[i].lru_prev) {
+        if ((_sessions[i].state == SESSION_STATE_ESTABLISHED) &&
+            (_sessions[i].sock == sock)) {
+            return i;
+        }
+    }
+    return NIL;
+}
+
 ssize_t dsm_get_least_recently_used_session(sock_dtls_t *sock, sock_dtls_session_t *session)
 {
     int res = -1;
-    dsm_session_t *session_slot = NULL;
-
-    if (dsm_get_num_available_slots() == CONFIG_DSM_PEER_MAX) {
-        return res;
-    }
 
     mutex_lock(&_lock);
-    for (uint8_t i=0; i < CONFIG_DSM_PEER_MAX; i++) {
-        if (_sessions[i].state != SESSION_STATE_ESTABLISHED) {
-            continue;
-        }
-        if (_sessions[i].sock != sock) {
-            continue;
-        }
-
-        if (session_slot == NULL ||
-            session_slot->last_used_sec > _sessions[i].last_used_sec) {
-            session_slot = &_sessions[i];
-        }
-    }
-
-    if (session_slot) {
-        memcpy(session, &session_slot->session, sizeof(sock_dtls_session_t));
+    uint8_t idx = _find_lru(sock);
+    if (idx != NIL) {
+        memcpy(session, &_sessions[idx].session, sizeof(sock_dtls_session_t));
         res = 1;
     }
     mutex_unlock(&_lock);
     return res;
 }
 
-/* Search for existing session or empty slot for new one
- * Returns 1, if existing session found
- * Returns 0, if empty slot found
- * Returns -1, if no existing or empty session found */
-static int _find_session(sock_dtls_t *sock, sock_dtls_session_t *to_find,
-                         dsm_session_t **session)
+ssize_t dsm_get_idle_session(sock_dtls_t *sock, sock_dtls_session_t *session,
+                             uint32_t idle_sec, uint32_t *next_sec)
 {
+    int res = -1;
 
-    /* FIXME: optimize search / data structure */
-    sock_udp_ep_t to_find_ep, curr_ep;
-    dsm_session_t *empty_session = NULL;
-
-    sock_dtls_session_get_udp_ep(to_find, &to_find_ep);
-    for (uint8_t i=0; i < CONFIG_DSM_PEER_MAX; i++) {
-        if (_sessions[i].state == SESSION_STATE_NONE) {
-            empty_session = &_sessions[i];
-            continue;
+    mutex_lock(&_lock);
+    uint8_t idx = _find_lru(sock);
+    if (idx != NIL) {
+        uint32_t idle = _now_sec() - _sessions[idx].last_used_sec;
+        if (idle >= idle_sec) {
+            memcpy(session, &_sessions[idx].session, sizeof(sock_dtls_session_t));
+            res = 1;
         }
-
-        sock_dtls_session_get_udp_ep(&_sessions[i].session, &curr_ep);
-        if (sock_udp_ep_equal(&curr_ep, &to_find_ep) && _sessions[i].sock == sock) {
-            /* found existing session */
-            *session = &_sessions[i];
-            return 1;
+        else if (next_sec) {
+            *next_sec = idle_sec - idle;
         }
     }
-
-    if (empty_session) {
-        *session = empty_session;
-        return 0;
-    }
-    return -1;
+    mutex_unlock(&_lock);
+    return res;
 }
@@ -113,6 +113,7 @@ void gnrc_lorawan_init(gnrc_lorawan_t *mac, uint8_t *joineui, const gnrc_lorawan
 
     mac->busy = false;
     gnrc_lorawan_mlme_backoff_init(mac);
+    gnrc_lorawan_duty_cycle_init(mac);
     gnrc_lorawan_reset(mac);
 
     if (IS_USED(MODULE_GNRC_LORAWAN_1_1)) {
@@ -288,6 +289,7 @@ void gnrc_lorawan_send_pkt(gnrc_lorawan_t *mac, iolist_t *psdu, uint8_t dr,
     dev->driver->get(dev, NETOPT_CODING_RATE, &cr, sizeof(cr));
 
     mac->toa = lora_time_on_air(iolist_size(psdu), dr, cr);
+    gnrc_lorawan_duty_cycle_update(mac, chan, mac->toa);
 
     if (dev->driver->send(dev, psdu) == -ENOTSUP) {
         DEBUG("gnrc_lorawan: Cannot send: radio is still transmitting");
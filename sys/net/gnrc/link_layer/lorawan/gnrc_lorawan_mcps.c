@@ -25,6 +25,7 @@
 #include "net/lorawan/hdr.h"
 
 #include "random.h"
+#include "timex.h"
 
 #define ENABLE_DEBUG      0
 #include "debug.h"
@@ -380,7 +381,14 @@ static void _transmit_pkt(gnrc_lorawan_t *mac)
         last_snip = last_snip->iol_next;
     }
 
-    mac->last_chan_idx = gnrc_lorawan_pick_channel(mac);
+    int chan = gnrc_lorawan_pick_channel(mac);
+
+    if (chan < 0) {
+        /* try again as soon as the first sub-band has duty cycle left */
+        gnrc_lorawan_set_timer(mac, gnrc_lorawan_duty_cycle_wait(mac) * US_PER_MS);
+        return;
+    }
+    mac->last_chan_idx = chan;
 
     uint16_t conf_fcnt = 0;
 
@@ -457,6 +465,16 @@ void gnrc_lorawan_event_no_rx(gnrc_lorawan_t *mac)
     _handle_retransmissions(mac);
 }
 
+size_t gnrc_lorawan_mcps_payload_max(gnrc_lorawan_t *mac, uint8_t dr)
+{
+    uint8_t fopts_length = gnrc_lorawan_build_options(mac, NULL);
+
+    /* We don't include the port because `MACPayload` doesn't consider
+     * the MHDR...*/
+    return gnrc_lorawan_region_mac_payload_max(dr) - sizeof(lorawan_hdr_t) -
+           fopts_length;
+}
+
 void gnrc_lorawan_mcps_request(gnrc_lorawan_t *mac,
                                const mcps_request_t *mcps_request,
                                mcps_confirm_t *mcps_confirm)
@@ -485,14 +503,8 @@ void gnrc_lorawan_mcps_request(gnrc_lorawan_t *mac,
         goto out;
     }
 
-    uint8_t fopts_length = gnrc_lorawan_build_options(mac, NULL);
-    /* We don't include the port because `MACPayload` doesn't consider
-     * the MHDR...*/
-    size_t mac_payload_size = sizeof(lorawan_hdr_t) + fopts_length +
-                              iolist_size(pkt);
-
-    if (mac_payload_size >
-        gnrc_lorawan_region_mac_payload_max(mcps_request->data.dr)) {
+    if (iolist_size(pkt) >
+        gnrc_lorawan_mcps_payload_max(mac, mcps_request->data.dr)) {
         mcps_confirm->status = -EMSGSIZE;
         goto out;
     }
@@ -24,6 +24,7 @@
 #include "errno.h"
 #include "net/gnrc/pktbuf.h"
 #include "random.h"
+#include "timex.h"
 
 #include "net/lorawan/hdr.h"
 
@@ -59,7 +60,14 @@ void gnrc_lorawan_trigger_join(gnrc_lorawan_t *mac)
     iolist_t pkt = { .iol_base = mac->mcps.mhdr_mic, .iol_len =
                          sizeof(lorawan_join_request_t), .iol_next = NULL };
 
-    mac->last_chan_idx = gnrc_lorawan_pick_channel(mac);
+    int chan = gnrc_lorawan_pick_channel(mac);
+
+    if (chan < 0) {
+        /* try again as soon as the first sub-band has duty cycle left */
+        gnrc_lorawan_set_timer(mac, gnrc_lorawan_duty_cycle_wait(mac) * US_PER_MS);
+        return;
+    }
+    mac->last_chan_idx = chan;
     gnrc_lorawan_send_pkt(mac, &pkt, mac->last_dr,
                           mac->channel[mac->last_chan_idx]);
 }
@@ -215,6 +223,8 @@ void gnrc_lorawan_mlme_backoff_expire_cb(gnrc_lorawan_t *mac)
 
     counter--;
     mac->mlme.backoff_state = state << 5 | (counter & 0x1F);
+
+    gnrc_lorawan_duty_cycle_refresh(mac);
 }
 
 static void _mlme_set(gnrc_lorawan_t *mac, const mlme_request_t *mlme_request,
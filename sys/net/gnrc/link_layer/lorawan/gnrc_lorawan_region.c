@@ -12,9 +12,14 @@
  * @file
  * @author  José Ignacio Alamos <jose.alamos@haw-hamburg.de>
  */
+#include <assert.h>
+#include <errno.h>
+
 #include "kernel_defines.h"
 #include "bitarithm.h"
 #include "random.h"
+#include "timex.h"
+#include "ztimer.h"
 #include "net/gnrc/lorawan/region.h"
 
 #define ENABLE_DEBUG 0
@@ -31,6 +36,60 @@ static uint8_t dr_bw[GNRC_LORAWAN_DATARATES_NUMOF] =
 { LORA_BW_125_KHZ, LORA_BW_125_KHZ, LORA_BW_125_KHZ, LORA_BW_125_KHZ,
   LORA_BW_125_KHZ, LORA_BW_125_KHZ };
 
+/**
+ * @brief   Duty cycle sub-band
+ */
+typedef struct {
+    uint32_t min_freq;  /**< lowest frequency of the sub-band */
+    uint32_t max_freq;  /**< first frequency above the sub-band */
+    uint16_t dc_inv;    /**< inverse of the duty cycle */
+} _band_t;
+
+#if (IS_ACTIVE(CONFIG_LORAMAC_REGION_EU_868))
+/* ETSI EN 300 220 sub-bands, as used by the LoRaWAN Regional Parameters */
+static const _band_t _bands[] = {
+    { 863000000UL, 865000000UL, 1000 },
+    { 865000000UL, 868000000UL, 100 },
+    { 868000000UL, 868600000UL, 100 },
+    { 868700000UL, 869200000UL, 1000 },
+    { 869400000UL, 869650000UL, 10 },
+    { 869700000UL, 870000000UL, 100 },
+};
+#else
+/* no duty cycle restrictions, the empty band matches no channel */
+static const _band_t _bands[] = {
+    { 0, 0, 1 },
+};
+#endif
+
+static_assert(ARRAY_SIZE(_bands) <= GNRC_LORAWAN_MAX_BANDS,
+              "GNRC_LORAWAN_MAX_BANDS too small for this region");
+
+static int _band_idx(uint32_t freq)
+{
+    for (unsigned i = 0; i < ARRAY_SIZE(_bands); i++) {
+        if (freq >= _bands[i].min_freq && freq < _bands[i].max_freq) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+/* time until the sub-band of a channel has duty cycle left */
+static uint32_t _channel_wait(const gnrc_lorawan_t *mac, uint8_t chan,
+                              uint32_t now)
+{
+    int band = _band_idx(mac->channel[chan]);
+
+    if (band < 0) {
+        return 0;
+    }
+
+    int32_t diff = mac->band_ready[band] - now;
+
+    return (diff > 0) ? (uint32_t)diff : 0;
+}
+
 int gnrc_lorawan_set_dr(gnrc_lorawan_t *mac, uint8_t datarate)
 {
     netdev_t *dev = gnrc_lorawan_get_netdev(mac);
@@ -97,12 +156,25 @@ void gnrc_lorawan_channels_init(gnrc_lorawan_t *mac)
     }
 }
 
-uint8_t gnrc_lorawan_pick_channel(gnrc_lorawan_t *mac)
+int gnrc_lorawan_pick_channel(gnrc_lorawan_t *mac)
 {
+    uint32_t now = ztimer_now(ZTIMER_MSEC);
+    unsigned available = 0;
     uint8_t index = 0;
 
-    uint8_t pos = random_uint32_range(0, bitarithm_bits_set(mac->channel_mask));
-    unsigned state = mac->channel_mask;
+    for (unsigned i = 0; i < GNRC_LORAWAN_MAX_CHANNELS; i++) {
+        if ((mac->channel_mask & (1 << i)) && !_channel_wait(mac, i, now)) {
+            available |= 1 << i;
+        }
+    }
+
+    if (!available) {
+        DEBUG("gnrc_lorawan_region: no duty cycle left\n");
+        return -EAGAIN;
+    }
+
+    uint8_t pos = random_uint32_range(0, bitarithm_bits_set(available));
+    unsigned state = available;
 
     for (int i = 0; i < pos + 1; i++) {
         state = bitarithm_test_and_clear(state, &index);
@@ -111,6 +183,61 @@ uint8_t gnrc_lorawan_pick_channel(gnrc_lorawan_t *mac)
     return index;
 }
 
+void gnrc_lorawan_duty_cycle_init(gnrc_lorawan_t *mac)
+{
+    uint32_t now = ztimer_now(ZTIMER_MSEC);
+
+    for (unsigned i = 0; i < GNRC_LORAWAN_MAX_BANDS; i++) {
+        mac->band_ready[i] = now;
+    }
+}
+
+void gnrc_lorawan_duty_cycle_update(gnrc_lorawan_t *mac, uint32_t freq,
+                                    uint32_t toa)
+{
+    int band = _band_idx(freq);
+
+    if (band < 0) {
+        return;
+    }
+
+    /* called when the transmission starts: the sub-band is off for the time
+     * on air plus toa * (1 / dc - 1) afterwards */
+    uint32_t off = ((uint64_t)toa * _bands[band].dc_inv) / US_PER_MS;
+
+    mac->band_ready[band] = ztimer_now(ZTIMER_MSEC) + off;
+    DEBUG("gnrc_lorawan_region: sub-band %d off for %" PRIu32 " ms\n",
+          band, off);
+}
+
+uint32_t gnrc_lorawan_duty_cycle_wait(gnrc_lorawan_t *mac)
+{
+    uint32_t now = ztimer_now(ZTIMER_MSEC);
+    uint32_t wait = UINT32_MAX;
+
+    for (unsigned i = 0; i < GNRC_LORAWAN_MAX_CHANNELS; i++) {
+        if (mac->channel_mask & (1 << i)) {
+            uint32_t chan_wait = _channel_wait(mac, i, now);
+            if (chan_wait < wait) {
+                wait = chan_wait;
+            }
+        }
+    }
+
+    return (wait == UINT32_MAX) ? 0 : wait;
+}
+
+void gnrc_lorawan_duty_cycle_refresh(gnrc_lorawan_t *mac)
+{
+    uint32_t now = ztimer_now(ZTIMER_MSEC);
+
+    for (unsigned i = 0; i < GNRC_LORAWAN_MAX_BANDS; i++) {
+        if ((int32_t)(mac->band_ready[i] - now) < 0) {
+            mac->band_ready[i] = now;
+        }
+    }
+}
+
 void gnrc_lorawan_process_cflist(gnrc_lorawan_t *mac, uint8_t *cflist)
 {
     /* TODO: Check CFListType to 0 */
@@ -53,6 +53,7 @@ extern "C" {
 #define CFLIST_SIZE (16U)                               /**< Channel Frequency list size in bytes */
 
 #define GNRC_LORAWAN_MAX_CHANNELS (16U)                 /**< Maximum number of channels */
+#define GNRC_LORAWAN_MAX_BANDS (6U)                     /**< Maximum number of duty cycle sub-bands */
 
 #define LORAWAN_STATE_IDLE (0)                          /**< MAC state machine in idle */
 #define LORAWAN_STATE_RX_1 (1)                          /**< MAC state machine in RX1 */
@@ -229,6 +230,7 @@ typedef struct {
 #endif
     uint32_t channel[GNRC_LORAWAN_MAX_CHANNELS];    /**< channel array */
     uint16_t channel_mask;                          /**< channel mask */
+    uint32_t band_ready[GNRC_LORAWAN_MAX_BANDS];    /**< time (in ms) from which each sub-band has duty cycle left */
     uint32_t toa;                                   /**< Time on Air of the last transmission */
     int busy;                                       /**< MAC busy  */
     int shutdown_req;                               /**< MAC Shutdown request */
@@ -353,11 +355,50 @@ size_t gnrc_lorawan_build_uplink(gnrc_lorawan_t *mac, iolist_t *payload,
 /**
  * @brief pick a random available LoRaWAN channel
  *
+ * Only channels whose sub-band has duty cycle left are considered.
+ *
  * @param[in] mac pointer to the MAC descriptor
  *
  * @return index of free channel inside channel array
+ * @return -EAGAIN if the duty cycle of all enabled channels is used up
+ */
+int gnrc_lorawan_pick_channel(gnrc_lorawan_t *mac);
+
+/**
+ * @brief Initialize the duty cycle state of all sub-bands
+ *
+ * @param[in] mac pointer to the MAC descriptor
+ */
+void gnrc_lorawan_duty_cycle_init(gnrc_lorawan_t *mac);
+
+/**
+ * @brief Account a transmission to the duty cycle of its sub-band
+ *
+ * @param[in] mac pointer to the MAC descriptor
+ * @param[in] freq frequency of the transmission
+ * @param[in] toa time on air of the transmission (in us)
  */
-uint8_t gnrc_lorawan_pick_channel(gnrc_lorawan_t *mac);
+void gnrc_lorawan_duty_cycle_update(gnrc_lorawan_t *mac, uint32_t freq,
+                                    uint32_t toa);
+
+/**
+ * @brief Get the time until an enabled channel has duty cycle left
+ *
+ * @param[in] mac pointer to the MAC descriptor
+ *
+ * @return time to wait (in ms), 0 if a channel can be used right away
+ */
+uint32_t gnrc_lorawan_duty_cycle_wait(gnrc_lorawan_t *mac);
+
+/**
+ * @brief Refresh the duty cycle state of idle sub-bands
+ *
+ * Must be called periodically (at least every few days) so idle sub-bands are
+ * not affected by the overflow of the millisecond clock.
+ *
+ * @param[in] mac pointer to the MAC descriptor
+ */
+void gnrc_lorawan_duty_cycle_refresh(gnrc_lorawan_t *mac);
 
 /**
  * @brief Build fopts header
@@ -583,6 +624,18 @@ static inline int gnrc_lorawan_mac_acquire(gnrc_lorawan_t *mac)
     return !_c;
 }
 
+/**
+ * @brief Check whether the MAC layer is acquired
+ *
+ * @param[in] mac pointer to the MAC descriptor
+ *
+ * @return true if a MLME or MCPS request is in progress
+ */
+static inline bool gnrc_lorawan_mac_is_busy(const gnrc_lorawan_t *mac)
+{
+    return mac->busy;
+}
+
 /**
  * @brief Release the MAC layer
  *
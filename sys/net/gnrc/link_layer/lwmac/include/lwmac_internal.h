@@ -374,6 +374,45 @@ static inline uint32_t _gnrc_lwmac_ticks_until_phase(uint32_t phase)
     return (uint32_t)tmp;
 }
 
+/**
+ * @brief Calculate how many ticks remain until a neighbor's next wake-up
+ *
+ * With @ref net_gnrc_lwmac_adaptive, the neighbor wakes up
+ * 2^gnrc_mac_tx_neighbor_t::wakeup_exp times per cycle, starting at its phase.
+ *
+ * @param[in]   neighbor    neighbor to send to
+ * @param[in]   min_ticks   RTT ticks needed to prepare, less than a cycle
+ *
+ * @return               RTT ticks until the first wake-up at least
+ *                       @p min_ticks in the future
+ */
+static inline uint32_t _gnrc_lwmac_ticks_until_wakeup(const gnrc_mac_tx_neighbor_t *neighbor,
+                                                      uint32_t min_ticks)
+{
+    uint32_t interval = RTT_US_TO_TICKS(CONFIG_GNRC_LWMAC_WAKEUP_INTERVAL_US);
+    uint32_t ticks = _gnrc_lwmac_ticks_until_phase(neighbor->phase);
+#ifdef MODULE_GNRC_LWMAC_ADAPTIVE
+    unsigned exp = neighbor->wakeup_exp;
+#else
+    unsigned exp = 0;
+#endif
+
+    if (ticks >= interval) {
+        /* phase unknown */
+        return ticks;
+    }
+
+    /* wake-ups are counted from the last one at the neighbor's phase */
+    uint32_t since = interval - ticks;
+    for (unsigned i = 1; i <= (2U << exp); i++) {
+        uint32_t offset = (uint32_t)(((uint64_t)interval * i) >> exp);
+        if (offset >= since + min_ticks) {
+            return offset - since;
+        }
+    }
+    return ticks + interval;
+}
+
 /**
  * @brief Store the received packet to the dispatch buffer and remove possible
  *        duplicate packets.
@@ -241,7 +241,7 @@ static gnrc_mac_tx_neighbor_t *_next_tx_neighbor(gnrc_netif_t *netif)
             /* Unknown destinations are initialized with their phase at the end
              * of the local interval, so known destinations that still wakeup
              * in this interval will be preferred. */
-            uint32_t phase_check = _gnrc_lwmac_ticks_until_phase(netif->mac.tx.neighbors[i].phase);
+            uint32_t phase_check = _gnrc_lwmac_ticks_until_wakeup(&netif->mac.tx.neighbors[i], 0);
 
             if (phase_check <= phase_nearest) {
                 next = &(netif->mac.tx.neighbors[i]);
@@ -273,6 +273,81 @@ static uint32_t _next_inphase_event(uint32_t last, uint32_t interval)
     return last;
 }
 
+/**
+ * @brief   Get the time of the next wake-up
+ *
+ * With @ref net_gnrc_lwmac_adaptive, this may be one of the additional
+ * wake-ups inside the cycle, its index is stored in gnrc_lwmac_t::wakeup_slot.
+ */
+static uint32_t _next_wakeup(gnrc_netif_t *netif)
+{
+    uint32_t interval = RTT_US_TO_TICKS(CONFIG_GNRC_LWMAC_WAKEUP_INTERVAL_US);
+    uint32_t next = _next_inphase_event(netif->mac.prot.lwmac.last_wakeup, interval);
+
+#ifdef MODULE_GNRC_LWMAC_ADAPTIVE
+    gnrc_lwmac_t *lwmac = &netif->mac.prot.lwmac;
+    uint32_t start = next - interval;
+
+    lwmac->wakeup_slot = 0;
+    for (unsigned i = 1; i < (1U << lwmac->wakeup_exp); i++) {
+        uint32_t slot = start + (uint32_t)(((uint64_t)interval * i) >> lwmac->wakeup_exp);
+        if ((int32_t)(slot - (rtt_get_counter() + GNRC_LWMAC_RTT_EVENT_MARGIN_TICKS)) > 0) {
+            lwmac->wakeup_slot = i;
+            return slot;
+        }
+    }
+#endif
+
+    return next;
+}
+
+#ifdef MODULE_GNRC_LWMAC_ADAPTIVE
+/**
+ * @brief   Adapt the number of wake-ups to the packets received in the last cycle
+ */
+static void _adapt_wakeups(gnrc_lwmac_t *lwmac)
+{
+    unsigned slots = 1U << lwmac->wakeup_exp;
+
+    if ((lwmac->rx_count > slots) &&
+        (lwmac->wakeup_exp < CONFIG_GNRC_LWMAC_ADAPTIVE_MAX_EXP)) {
+        lwmac->wakeup_exp++;
+        LOG_DEBUG("[LWMAC] %u wake-ups per cycle\n", 2 * slots);
+    }
+    else if ((lwmac->rx_count < slots / 2) && (lwmac->wakeup_exp > 0)) {
+        lwmac->wakeup_exp--;
+        LOG_DEBUG("[LWMAC] %u wake-ups per cycle\n", slots / 2);
+    }
+    lwmac->rx_count = 0;
+}
+#endif
+
+/**
+ * @brief   Check if the current wake-up is close to the next one
+ */
+static bool _wakeup_almost_over(gnrc_netif_t *netif)
+{
+#ifdef MODULE_GNRC_LWMAC_ADAPTIVE
+    uint32_t wakeup = netif->mac.prot.lwmac.wakeup;
+    uint32_t interval = RTT_US_TO_TICKS(CONFIG_GNRC_LWMAC_WAKEUP_INTERVAL_US) >>
+                        netif->mac.prot.lwmac.wakeup_exp;
+#else
+    uint32_t wakeup = netif->mac.prot.lwmac.last_wakeup;
+    uint32_t interval = RTT_US_TO_TICKS(CONFIG_GNRC_LWMAC_WAKEUP_INTERVAL_US);
+#endif
+
+    /* Get the relative phase. */
+    uint32_t phase = rtt_get_counter();
+    if (phase < wakeup) {
+        phase = (RTT_US_TO_TICKS(GNRC_LWMAC_PHASE_MAX) - wakeup) + phase;
+    }
+    else {
+        phase = phase - wakeup;
+    }
+    /* If the relative phase is beyond 4/5 of the interval, go to sleep. */
+    return phase > (4 * interval / 5);
+}
+
 inline void lwmac_schedule_update(gnrc_netif_t *netif)
 {
     gnrc_lwmac_set_reschedule(netif, true);
@@ -335,8 +410,7 @@ void lwmac_set_state(gnrc_netif_t *netif, gnrc_lwmac_state_t newstate)
                 LOG_WARNING("WARNING: [LWMAC] phase backoffed: %lu us\n",
                             (unsigned long)RTT_TICKS_TO_US(alarm));
                 netif->mac.prot.lwmac.last_wakeup = netif->mac.prot.lwmac.last_wakeup + alarm;
-                alarm = _next_inphase_event(netif->mac.prot.lwmac.last_wakeup,
-                            RTT_US_TO_TICKS(CONFIG_GNRC_LWMAC_WAKEUP_INTERVAL_US));
+                alarm = _next_wakeup(netif);
                 rtt_set_alarm(alarm, rtt_cb, (void *) GNRC_LWMAC_EVENT_RTT_WAKEUP_PENDING);
             }
 
@@ -421,14 +495,14 @@ static void _sleep_management(gnrc_netif_t *netif)
 
             /* Offset in microseconds when the earliest (phase) destination
              * node wakes up that we have packets for. */
-            uint32_t time_until_tx = RTT_TICKS_TO_US(_gnrc_lwmac_ticks_until_phase(neighbour->phase));
-
             /* If there's not enough time to prepare a WR to catch the phase
-             * postpone to next interval */
-            if (time_until_tx < CONFIG_GNRC_LWMAC_WR_PREPARATION_US) {
-                time_until_tx += CONFIG_GNRC_LWMAC_WAKEUP_INTERVAL_US;
-            }
-            time_until_tx -= CONFIG_GNRC_LWMAC_WR_PREPARATION_US;
+             * postpone to next wake-up */
+            uint32_t time_until_tx = RTT_TICKS_TO_US(_gnrc_lwmac_ticks_until_wakeup(
+                                        neighbour,
+                                        RTT_US_TO_TICKS(CONFIG_GNRC_LWMAC_WR_PREPARATION_US)));
+            /* the conversion from ticks may round below the preparation time */
+            time_until_tx = (time_until_tx > CONFIG_GNRC_LWMAC_WR_PREPARATION_US) ?
+                            time_until_tx - CONFIG_GNRC_LWMAC_WR_PREPARATION_US : 0;
 
             /* add a random time before goto TX, for avoiding one node for
              * always holding the medium (if the receiver's phase is recorded earlier in this
@@ -469,17 +543,8 @@ static void _rx_management_failed(gnrc_netif_t *netif)
     }
 
     /* Here we check if we are close to the end of the cycle. If yes,
-     * go to sleep. Firstly, get the relative phase. */
-    uint32_t phase = rtt_get_counter();
-    if (phase < netif->mac.prot.lwmac.last_wakeup) {
-        phase = (RTT_US_TO_TICKS(GNRC_LWMAC_PHASE_MAX) - netif->mac.prot.lwmac.last_wakeup) +
-                phase;
-    }
-    else {
-        phase = phase - netif->mac.prot.lwmac.last_wakeup;
-    }
-    /* If the relative phase is beyond 4/5 cycle time, go to sleep. */
-    if (phase > (4 * RTT_US_TO_TICKS(CONFIG_GNRC_LWMAC_WAKEUP_INTERVAL_US) / 5)) {
+     * go to sleep. */
+    if (_wakeup_almost_over(netif)) {
         gnrc_lwmac_set_quit_rx(netif, true);
     }
 
@@ -498,19 +563,15 @@ static void _rx_management_success(gnrc_netif_t *netif)
     gnrc_lwmac_rx_stop(netif);
     /* Dispatch received packets, timing is not critical anymore */
     gnrc_mac_dispatch(&netif->mac.rx);
+#ifdef MODULE_GNRC_LWMAC_ADAPTIVE
+    if (netif->mac.prot.lwmac.rx_count < UINT8_MAX) {
+        netif->mac.prot.lwmac.rx_count++;
+    }
+#endif
 
     /* Here we check if we are close to the end of the cycle. If yes,
-     * go to sleep. Firstly, get the relative phase. */
-    uint32_t phase = rtt_get_counter();
-    if (phase < netif->mac.prot.lwmac.last_wakeup) {
-        phase = (RTT_US_TO_TICKS(GNRC_LWMAC_PHASE_MAX) - netif->mac.prot.lwmac.last_wakeup) +
-                phase;
-    }
-    else {
-        phase = phase - netif->mac.prot.lwmac.last_wakeup;
-    }
-    /* If the relative phase is beyond 4/5 cycle time, go to sleep. */
-    if (phase > (4 * RTT_US_TO_TICKS(CONFIG_GNRC_LWMAC_WAKEUP_INTERVAL_US) / 5)) {
+     * go to sleep. */
+    if (_wakeup_almost_over(netif)) {
         gnrc_lwmac_set_quit_rx(netif, true);
     }
 
@@ -735,8 +796,18 @@ void rtt_handler(uint32_t event, gnrc_netif_t *netif)
     switch (event & 0xffff) {
         case GNRC_LWMAC_EVENT_RTT_WAKEUP_PENDING: {
             /* A new cycle starts, set sleep timing and initialize related MAC-info flags. */
-            netif->mac.prot.lwmac.last_wakeup = rtt_get_alarm();
-            alarm = _next_inphase_event(netif->mac.prot.lwmac.last_wakeup,
+            alarm = rtt_get_alarm();
+#ifdef MODULE_GNRC_LWMAC_ADAPTIVE
+            /* additional wake-ups inside the cycle keep its phase */
+            netif->mac.prot.lwmac.wakeup = alarm;
+            if (netif->mac.prot.lwmac.wakeup_slot == 0) {
+                netif->mac.prot.lwmac.last_wakeup = alarm;
+                _adapt_wakeups(&netif->mac.prot.lwmac);
+            }
+#else
+            netif->mac.prot.lwmac.last_wakeup = alarm;
+#endif
+            alarm = _next_inphase_event(alarm,
                                         RTT_US_TO_TICKS(GNRC_LWMAC_WAKEUP_DURATION_US));
             rtt_set_alarm(alarm, rtt_cb, (void *) GNRC_LWMAC_EVENT_RTT_SLEEP_PENDING);
             gnrc_lwmac_set_quit_tx(netif, false);
@@ -748,8 +819,7 @@ void rtt_handler(uint32_t event, gnrc_netif_t *netif)
         }
         case GNRC_LWMAC_EVENT_RTT_SLEEP_PENDING: {
             /* Set next wake-up timing. */
-            alarm = _next_inphase_event(netif->mac.prot.lwmac.last_wakeup,
-                                        RTT_US_TO_TICKS(CONFIG_GNRC_LWMAC_WAKEUP_INTERVAL_US));
+            alarm = _next_wakeup(netif);
             rtt_set_alarm(alarm, rtt_cb, (void *) GNRC_LWMAC_EVENT_RTT_WAKEUP_PENDING);
             lwmac_set_state(netif, GNRC_LWMAC_SLEEPING);
             break;
@@ -773,8 +843,7 @@ void rtt_handler(uint32_t event, gnrc_netif_t *netif)
         case GNRC_LWMAC_EVENT_RTT_RESUME: {
             LOG_DEBUG("[LWMAC] RTT: Resume duty cycling\n");
             rtt_clear_alarm();
-            alarm = _next_inphase_event(netif->mac.prot.lwmac.last_wakeup,
-                                        RTT_US_TO_TICKS(CONFIG_GNRC_LWMAC_WAKEUP_INTERVAL_US));
+            alarm = _next_wakeup(netif);
             rtt_set_alarm(alarm, rtt_cb, (void *) GNRC_LWMAC_EVENT_RTT_WAKEUP_PENDING);
             gnrc_lwmac_set_dutycycle_active(netif, true);
             break;
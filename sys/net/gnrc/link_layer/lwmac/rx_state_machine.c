@@ -150,13 +150,29 @@ static bool _send_wa(gnrc_netif_t *netif)
                                    _gnrc_lwmac_ticks_to_phase(netif->mac.prot.lwmac.last_wakeup);
     }
 
-    pkt = gnrc_pktbuf_add(NULL, &lwmac_hdr, sizeof(lwmac_hdr), GNRC_NETTYPE_LWMAC);
+    pkt = NULL;
+#ifdef MODULE_GNRC_LWMAC_ADAPTIVE
+    /* Append the number of wake-ups per cycle, this trailing byte is
+     * ignored by senders without the module */
+    pkt = gnrc_pktbuf_add(NULL, &netif->mac.prot.lwmac.wakeup_exp,
+                          sizeof(netif->mac.prot.lwmac.wakeup_exp),
+                          GNRC_NETTYPE_UNDEF);
     if (pkt == NULL) {
+        LOG_ERROR("ERROR: [LWMAC-rx] Cannot allocate pktbuf of type GNRC_NETTYPE_UNDEF\n");
+        gnrc_lwmac_set_quit_rx(netif, true);
+        return false;
+    }
+#endif
+    pkt_lwmac = gnrc_pktbuf_add(pkt, &lwmac_hdr, sizeof(lwmac_hdr), GNRC_NETTYPE_LWMAC);
+    if (pkt_lwmac == NULL) {
         LOG_ERROR("ERROR: [LWMAC-rx] Cannot allocate pktbuf of type GNRC_NETTYPE_LWMAC\n");
+        if (pkt != NULL) {
+            gnrc_pktbuf_release(pkt);
+        }
         gnrc_lwmac_set_quit_rx(netif, true);
         return false;
     }
-    pkt_lwmac = pkt;
+    pkt = pkt_lwmac;
 
     pkt = gnrc_pktbuf_add(pkt, NULL,
                           sizeof(gnrc_netif_hdr_t) + netif->mac.rx.l2_addr.len,
@@ -237,6 +237,9 @@ static uint8_t _packet_process_in_wait_for_wa(gnrc_netif_t *netif)
     bool found_wa = false;
     bool postponed = false;
     bool from_expected_destination = false;
+#ifdef MODULE_GNRC_LWMAC_ADAPTIVE
+    uint8_t wakeup_exp = 0;
+#endif
 
     while ((pkt = gnrc_priority_pktqueue_pop(&netif->mac.rx.queue)) != NULL) {
         LOG_DEBUG("[LWMAC-tx] Inspecting pkt @ %p\n", pkt);
@@ -332,6 +335,17 @@ static uint8_t _packet_process_in_wait_for_wa(gnrc_netif_t *netif)
                 gnrc_lwmac_set_phase_backoff(netif, true);
                 LOG_WARNING("WARNING: [LWMAC-tx] phase close\n");
             }
+
+#ifdef MODULE_GNRC_LWMAC_ADAPTIVE
+            /* a trailing byte tells about additional wake-ups */
+            wakeup_exp = 0;
+            if (pkt->size > 0) {
+                wakeup_exp = *((uint8_t *)pkt->data);
+                if (wakeup_exp > CONFIG_GNRC_LWMAC_ADAPTIVE_MAX_EXP) {
+                    wakeup_exp = CONFIG_GNRC_LWMAC_ADAPTIVE_MAX_EXP;
+                }
+            }
+#endif
         }
 
         /* No need to keep pkt anymore */
@@ -362,6 +376,9 @@ static uint8_t _packet_process_in_wait_for_wa(gnrc_netif_t *netif)
 
     /* Save newly calculated phase for destination */
     netif->mac.tx.current_neighbor->phase = netif->mac.tx.timestamp;
+#ifdef MODULE_GNRC_LWMAC_ADAPTIVE
+    netif->mac.tx.current_neighbor->wakeup_exp = wakeup_exp;
+#endif
     LOG_INFO("[LWMAC-tx] New phase: %" PRIu32 "\n", netif->mac.tx.timestamp);
 
     /* We've got our WA, so discard the rest, TODO: no flushing */
@@ -111,19 +111,21 @@ void gnrc_mac_clear_timeout(gnrc_mac_timeout_t *mac_timeout, gnrc_mac_timeout_ty
     }
 }
 
+static int _is_event(evtimer_event_t *event, uint32_t remaining, void *arg)
+{
+    (void)remaining;
+    return event == arg;
+}
+
 bool gnrc_mac_timeout_is_expired(gnrc_mac_timeout_t *mac_timeout, gnrc_mac_timeout_type_t type)
 {
     assert(mac_timeout);
 
     int index = gnrc_mac_find_timeout(mac_timeout, type);
     if (index >= 0) {
-        evtimer_event_t *list;
-        list = (evtimer_event_t *)&mac_timeout->evtimer.events;
-        while (list->next) {
-            if (list->next == &mac_timeout->timeouts[index].msg_event.event) {
-                return false;
-            }
-            list = list->next;
+        if (evtimer_foreach(&mac_timeout->evtimer, _is_event,
+                            &mac_timeout->timeouts[index].msg_event.event)) {
+            return false;
         }
 
         /* if we reach here, timeout is expired */
@@ -27,6 +27,10 @@
 #include "net/gnrc/pktbuf.h"
 #include "net/gnrc/netapi.h"
 
+#if IS_USED(MODULE_GNRC_NETAPI_STEERING)
+#include "net/ipv6/hdr.h"
+#endif
+
 #define ENABLE_DEBUG 0
 #include "debug.h"
 
@@ -82,6 +86,77 @@ static inline int _snd_rcv_mbox(mbox_t *mbox, uint16_t type, gnrc_pktsnip_t *pkt
 }
 #endif
 
+#if IS_USED(MODULE_GNRC_NETAPI_STEERING)
+static uint32_t _fnv1a(uint32_t hash, const void *data, size_t len)
+{
+    const uint8_t *ptr = data;
+
+    while (len--) {
+        hash ^= *ptr++;
+        hash *= 16777619U;
+    }
+    return hash;
+}
+
+static uint32_t _flow_hash(gnrc_pktsnip_t *pkt)
+{
+    /* only used when the network and transport layer nettypes are used */
+    (void)pkt;
+    uint32_t hash = 2166136261U;
+#if IS_USED(MODULE_GNRC_NETTYPE_IPV6)
+    gnrc_pktsnip_t *ipv6 = gnrc_pktsnip_search_type(pkt, GNRC_NETTYPE_IPV6);
+
+    if ((ipv6 != NULL) && (ipv6->size >= sizeof(ipv6_hdr_t))) {
+        const ipv6_hdr_t *hdr = ipv6->data;
+
+        hash = _fnv1a(hash, &hdr->src, sizeof(hdr->src));
+        hash = _fnv1a(hash, &hdr->dst, sizeof(hdr->dst));
+        hash = _fnv1a(hash, &hdr->nh, sizeof(hdr->nh));
+    }
+#endif
+    gnrc_pktsnip_t *tl = NULL;
+#if IS_USED(MODULE_GNRC_NETTYPE_UDP)
+    tl = gnrc_pktsnip_search_type(pkt, GNRC_NETTYPE_UDP);
+#endif
+#if IS_USED(MODULE_GNRC_NETTYPE_TCP)
+    if (tl == NULL) {
+        tl = gnrc_pktsnip_search_type(pkt, GNRC_NETTYPE_TCP);
+    }
+#endif
+    /* source and destination port are the first 4 bytes for both UDP and TCP */
+    if ((tl != NULL) && (tl->size >= 2 * sizeof(uint16_t))) {
+        hash = _fnv1a(hash, tl->data, 2 * sizeof(uint16_t));
+    }
+    return hash;
+}
+
+/* returns the steered entry that gets pkt, or NULL if there are none */
+static gnrc_netreg_entry_t *_steer(gnrc_netreg_entry_t *entry, uint16_t cmd,
+                                   gnrc_pktsnip_t *pkt, int *numof)
+{
+    unsigned steered = 0;
+
+    if (cmd != GNRC_NETAPI_MSG_TYPE_RCV) {
+        return NULL;
+    }
+    for (gnrc_netreg_entry_t *e = entry; e != NULL; e = gnrc_netreg_getnext(e)) {
+        steered += e->steered;
+    }
+    if (steered == 0) {
+        return NULL;
+    }
+    /* only one of the steered entries gets the packet */
+    *numof -= steered - 1;
+    steered = _flow_hash(pkt) % steered;
+    for (gnrc_netreg_entry_t *e = entry; e != NULL; e = gnrc_netreg_getnext(e)) {
+        if (e->steered && (steered-- == 0)) {
+            return e;
+        }
+    }
+    return NULL;
+}
+#endif
+
 int gnrc_netapi_dispatch(gnrc_nettype_t type, uint32_t demux_ctx,
                          uint16_t cmd, gnrc_pktsnip_t *pkt)
 {
@@ -91,10 +166,19 @@ int gnrc_netapi_dispatch(gnrc_nettype_t type, uint32_t demux_ctx,
 
     if (numof != 0) {
         gnrc_netreg_entry_t *sendto = gnrc_netreg_lookup(type, demux_ctx);
+#if IS_USED(MODULE_GNRC_NETAPI_STEERING)
+        gnrc_netreg_entry_t *worker = _steer(sendto, cmd, pkt, &numof);
+#endif
 
         gnrc_pktbuf_hold(pkt, numof - 1);
 
         while (sendto) {
+#if IS_USED(MODULE_GNRC_NETAPI_STEERING)
+            if ((worker != NULL) && sendto->steered && (sendto != worker)) {
+                sendto = gnrc_netreg_getnext(sendto);
+                continue;
+            }
+#endif
 #if defined(MODULE_GNRC_NETAPI_MBOX) || defined(MODULE_GNRC_NETAPI_CALLBACKS)
             uint32_t status = 0;
             switch (sendto->type) {
@@ -16,6 +16,7 @@
  */
 
 #include <assert.h>
+#include <errno.h>
 #include <string.h>
 
 #include "net/ethernet/hdr.h"
@@ -81,6 +82,33 @@ static inline void _addr_set_multicast(gnrc_netif_t *netif, uint8_t *dst,
     }
 }
 
+/* Copies the payload into a single snip, if the iolist is longer than the
+ * device can gather from */
+static int _linearize(netdev_t *dev, const iolist_t *iolist,
+                      gnrc_pktsnip_t **linear)
+{
+    uint16_t iolist_max;
+
+    *linear = NULL;
+    if ((dev->driver->get(dev, NETOPT_TX_IOLIST_MAX, &iolist_max,
+                          sizeof(iolist_max)) != sizeof(iolist_max)) ||
+        (iolist_count(iolist) <= iolist_max)) {
+        /* device copies the frame itself or can gather it directly */
+        return 0;
+    }
+
+    assert(iolist_max >= 2);
+    DEBUG("gnrc_netif_ethernet: merging payload for %u chunks\n", iolist_max);
+    *linear = gnrc_pktbuf_add(NULL, NULL, iolist_size(iolist->iol_next),
+                              GNRC_NETTYPE_UNDEF);
+    if (*linear == NULL) {
+        DEBUG("gnrc_netif_ethernet: cannot allocate merged payload\n");
+        return -ENOBUFS;
+    }
+    iolist_to_buffer(iolist->iol_next, (*linear)->data, (*linear)->size);
+    return 0;
+}
+
 static int _send(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt)
 {
     ethernet_hdr_t hdr;
@@ -151,6 +179,16 @@ static int _send(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt)
         .iol_len = sizeof(ethernet_hdr_t)
     };
 
+    /* scatter-gather capable devices transmit directly from the snips */
+    gnrc_pktsnip_t *linear;
+    res = _linearize(dev, &iolist, &linear);
+    if (res < 0) {
+        return res;
+    }
+    if (linear) {
+        iolist.iol_next = (iolist_t *)linear;
+    }
+
 #ifdef MODULE_NETSTATS_L2
     if ((netif_hdr->flags & GNRC_NETIF_HDR_FLAGS_BROADCAST) ||
         (netif_hdr->flags & GNRC_NETIF_HDR_FLAGS_MULTICAST)) {
@@ -162,6 +200,10 @@ static int _send(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt)
 #endif
     res = dev->driver->send(dev, &iolist);
 
+    if (linear) {
+        gnrc_pktbuf_release(linear);
+    }
+
     if (gnrc_netif_netdev_legacy_api(netif)) {
         /* only for legacy drivers we need to release pkt here */
         gnrc_pktbuf_release(pkt);
@@ -170,45 +212,104 @@ static int _send(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt)
     return res;
 }
 
+static gnrc_pktsnip_t *_recv_copy(netdev_t *dev, netdev_eth_rx_info_t *rx_info)
+{
+    gnrc_pktsnip_t *pkt;
+    int bytes_expected = dev->driver->recv(dev, NULL, 0, NULL);
+
+    if (bytes_expected <= 0) {
+        return NULL;
+    }
+
+    pkt = gnrc_pktbuf_add(NULL, NULL, bytes_expected, GNRC_NETTYPE_UNDEF);
+    if (!pkt) {
+        DEBUG("gnrc_netif_ethernet: cannot allocate pktsnip.\n");
+
+        /* drop the packet */
+        dev->driver->recv(dev, NULL, bytes_expected, NULL);
+        return NULL;
+    }
+
+    int nread = dev->driver->recv(dev, pkt->data, bytes_expected, rx_info);
+    if (nread <= 0) {
+        DEBUG("gnrc_netif_ethernet: read error.\n");
+        gnrc_pktbuf_release(pkt);
+        return NULL;
+    }
+
+    if (nread < bytes_expected) {
+        /* we've got less than the expected packet size,
+         * so free the unused space.*/
+
+        DEBUG("gnrc_netif_ethernet: reallocating.\n");
+        gnrc_pktbuf_realloc_data(pkt, nread);
+    }
+
+    return pkt;
+}
+
+#if IS_USED(MODULE_NETDEV_RX_LEND)
+static void _return_rx_buf(void *arg, void *data)
+{
+    netdev_t *dev = arg;
+
+    dev->driver->recv_return(dev, data);
+}
+
+/* Returns the received frame lent by the driver, or NULL with *res being
+ * -ENOTSUP if the driver wants the frame to be copied out instead */
+static gnrc_pktsnip_t *_recv_lend(netdev_t *dev, netdev_eth_rx_info_t *rx_info,
+                                  int *res)
+{
+    gnrc_pktsnip_t *pkt;
+    void *buf;
+
+    *res = dev->driver->recv_lend(dev, &buf, rx_info);
+    if (*res <= 0) {
+        return NULL;
+    }
+
+    pkt = gnrc_pktbuf_add_ext(NULL, buf, *res, GNRC_NETTYPE_UNDEF,
+                              _return_rx_buf, dev);
+    if (!pkt) {
+        /* no slot for the lent buffer left, try to copy it instead */
+        DEBUG("gnrc_netif_ethernet: cannot lend buffer, copying.\n");
+        pkt = gnrc_pktbuf_add(NULL, buf, *res, GNRC_NETTYPE_UNDEF);
+        dev->driver->recv_return(dev, buf);
+    }
+
+    return pkt;
+}
+#endif
+
 static gnrc_pktsnip_t *_recv(gnrc_netif_t *netif)
 {
     netdev_t *dev = netif->dev;
     gnrc_pktsnip_t *pkt = NULL;
     netdev_eth_rx_info_t rx_info = { .flags = 0 };
-    int bytes_expected = dev->driver->recv(dev, NULL, 0, NULL);
-
-    if (bytes_expected > 0) {
-        pkt = gnrc_pktbuf_add(NULL, NULL,
-                              bytes_expected,
-                              GNRC_NETTYPE_UNDEF);
 
-        if (!pkt) {
-            DEBUG("gnrc_netif_ethernet: cannot allocate pktsnip.\n");
+#if IS_USED(MODULE_NETDEV_RX_LEND)
+    if (dev->driver->recv_lend) {
+        int res;
 
-            /* drop the packet */
-            dev->driver->recv(dev, NULL, bytes_expected, NULL);
-
-            goto out;
+        pkt = _recv_lend(dev, &rx_info, &res);
+        if (res != -ENOTSUP) {
+            goto received;
         }
+    }
+#endif
+    pkt = _recv_copy(dev, &rx_info);
+#if IS_USED(MODULE_NETDEV_RX_LEND)
+received:
+#endif
 
-        int nread = dev->driver->recv(dev, pkt->data, bytes_expected, &rx_info);
-        if (nread <= 0) {
-            DEBUG("gnrc_netif_ethernet: read error.\n");
-            goto safe_out;
-        }
+    if (pkt) {
+        int nread = pkt->size;
 #ifdef MODULE_NETSTATS_L2
         netif->stats.rx_count++;
         netif->stats.rx_bytes += nread;
 #endif
 
-        if (nread < bytes_expected) {
-            /* we've got less than the expected packet size,
-             * so free the unused space.*/
-
-            DEBUG("gnrc_netif_ethernet: reallocating.\n");
-            gnrc_pktbuf_realloc_data(pkt, nread);
-        }
-
         DEBUG("gnrc_netif_ethernet: received packet from %s of length %d\n",
               gnrc_netif_addr_to_str(pkt->data, ETHERNET_ADDR_LEN, addr_str),
               nread);
@@ -258,7 +359,6 @@ static gnrc_pktsnip_t *_recv(gnrc_netif_t *netif)
         pkt = gnrc_pkt_append(pkt, netif_hdr);
     }
 
-out:
     return pkt;
 
 safe_out:
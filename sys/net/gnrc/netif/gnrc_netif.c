@@ -22,15 +22,21 @@
 
 #include "bitfield.h"
 #include "event.h"
+#if IS_USED(MODULE_GNRC_NETIF_RX_OFFLOAD)
+#include "event/thread.h"
+#include "irq.h"
+#endif
 #include "net/ethernet.h"
 #include "net/ipv6.h"
 #include "net/gnrc.h"
 #include "net/gnrc/ipv6/nib.h"
 #include "net/gnrc/ipv6.h"
+#include "net/gnrc/ipv6/flowcache.h"
 #if IS_USED(MODULE_GNRC_NETIF_PKTQ)
 #include "net/gnrc/netif/pktq.h"
 #endif /* IS_USED(MODULE_GNRC_NETIF_PKTQ) */
 #include "net/gnrc/sixlowpan/ctx.h"
+#include "net/gnrc/sixlowpan/iphc.h"
 #if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_SFR)
 #include "net/gnrc/sixlowpan/frag/sfr.h"
 #endif /* IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_SFR) */
@@ -54,6 +60,9 @@ static void _update_l2addr_from_dev(gnrc_netif_t *netif);
 static void _check_netdev_capabilities(netdev_t *dev);
 static void *_gnrc_netif_thread(void *args);
 static void _event_cb(netdev_t *dev, netdev_event_t event);
+#if IS_USED(MODULE_GNRC_NETIF_RX_OFFLOAD)
+static void _event_handler_rx(event_t *evp);
+#endif
 
 typedef struct {
     gnrc_netif_t *netif;
@@ -61,6 +70,10 @@ typedef struct {
     int result;
 } _netif_ctx_t;
 
+#if IS_USED(MODULE_GNRC_NETIF_SINGLE)
+gnrc_netif_t *gnrc_netif_single;
+#endif
+
 int gnrc_netif_create(gnrc_netif_t *netif, char *stack, int stacksize,
                       char priority, const char *name, netdev_t *netdev,
                       const gnrc_netif_ops_t *ops)
@@ -135,11 +148,13 @@ unsigned gnrc_netif_numof(void)
     return res;
 }
 
+#if !IS_USED(MODULE_GNRC_NETIF_SINGLE)
 gnrc_netif_t *gnrc_netif_iter(const gnrc_netif_t *prev)
 {
     netif_t *result = netif_iter((prev) ? &prev->netif : NULL);
     return (result) ? container_of(result, gnrc_netif_t, netif) : NULL;
 }
+#endif
 
 gnrc_netif_t *gnrc_netif_get_by_type(netdev_type_t type, uint8_t index)
 {
@@ -474,6 +489,7 @@ int gnrc_netif_set_from_netdev(gnrc_netif_t *netif,
     return res;
 }
 
+#if !IS_USED(MODULE_GNRC_NETIF_SINGLE)
 gnrc_netif_t *gnrc_netif_get_by_pid(kernel_pid_t pid)
 {
     gnrc_netif_t *netif = NULL;
@@ -485,6 +501,7 @@ gnrc_netif_t *gnrc_netif_get_by_pid(kernel_pid_t pid)
     }
     return NULL;
 }
+#endif
 
 void gnrc_netif_acquire(gnrc_netif_t *netif)
 {
@@ -649,6 +666,9 @@ int gnrc_netif_ipv6_addr_add_internal(gnrc_netif_t *netif,
 #endif /* CONFIG_GNRC_IPV6_NIB_ARSM */
     netif->ipv6.addrs_flags[idx] = flags;
     memcpy(&netif->ipv6.addrs[idx], addr, sizeof(netif->ipv6.addrs[idx]));
+    if (IS_USED(MODULE_GNRC_IPV6_FLOWCACHE)) {
+        gnrc_ipv6_flowcache_flush();
+    }
 #ifdef MODULE_GNRC_IPV6_NIB
     if (_get_state(netif, idx) == GNRC_NETIF_IPV6_ADDRS_FLAGS_STATE_VALID) {
         void *state = NULL;
@@ -712,6 +732,9 @@ void gnrc_netif_ipv6_addr_remove_internal(gnrc_netif_t *netif,
     if (remove_sol_nodes) {
         gnrc_netif_ipv6_group_leave_internal(netif, &sol_nodes);
     }
+    if (IS_USED(MODULE_GNRC_IPV6_FLOWCACHE)) {
+        gnrc_ipv6_flowcache_flush();
+    }
     gnrc_netif_release(netif);
 }
 
@@ -1456,6 +1479,16 @@ static void _update_l2addr_from_dev(gnrc_netif_t *netif)
     if (res > 0) {
         netif->l2addr_len = res;
     }
+    /* interface identifier might have changed */
+    gnrc_sixlowpan_iphc_cache_flush();
+}
+
+static bool _netopt_enabled(netdev_t *dev, netopt_t opt)
+{
+    netopt_enable_t enable;
+
+    return (dev->driver->get(dev, opt, &enable, sizeof(enable)) ==
+            sizeof(enable)) && (enable == NETOPT_ENABLE);
 }
 
 static void _init_from_device(gnrc_netif_t *netif)
@@ -1468,6 +1501,12 @@ static void _init_from_device(gnrc_netif_t *netif)
     (void)res;
     assert(res == sizeof(tmp));
     netif->device_type = (uint8_t)tmp;
+    if (_netopt_enabled(dev, NETOPT_TX_CSUM_OFFLOAD)) {
+        netif->flags |= GNRC_NETIF_FLAGS_TX_CSUM_OFFLOAD;
+    }
+    if (_netopt_enabled(dev, NETOPT_RX_CSUM_OFFLOAD)) {
+        netif->flags |= GNRC_NETIF_FLAGS_RX_CSUM_OFFLOAD;
+    }
     gnrc_netif_ipv6_init_mtu(netif);
     _update_l2addr_from_dev(netif);
 }
@@ -1621,6 +1660,9 @@ int gnrc_netif_default_init(gnrc_netif_t *netif)
         return res;
     }
     netif_register(&netif->netif);
+#if IS_USED(MODULE_GNRC_NETIF_SINGLE)
+    gnrc_netif_single = netif;
+#endif
     _check_netdev_capabilities(dev);
     _init_from_device(netif);
 #ifdef DEVELHELP
@@ -1673,6 +1715,19 @@ static void _process_receive_stats(gnrc_netif_t *netdev, gnrc_pktsnip_t *pkt)
     netstats_nb_update_rx(&netdev->netif, src, src_len, hdr->rssi, hdr->lqi);
 }
 
+static void _process_receive_csum(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt)
+{
+    if (!(netif->flags & GNRC_NETIF_FLAGS_RX_CSUM_OFFLOAD)) {
+        return;
+    }
+
+    gnrc_pktsnip_t *hdr = gnrc_pktsnip_search_type(pkt, GNRC_NETTYPE_NETIF);
+
+    if (hdr != NULL) {
+        ((gnrc_netif_hdr_t *)hdr->data)->flags |= GNRC_NETIF_HDR_FLAGS_CSUM_VALID;
+    }
+}
+
 static event_t *_gnrc_netif_fetch_event(gnrc_netif_t *netif)
 {
     event_t *ev;
@@ -1922,6 +1977,11 @@ static void *_gnrc_netif_thread(void *args)
     netif->event_isr.handler = _event_handler_isr;
 #if IS_USED(MODULE_NETDEV_NEW_API)
     netif->event_tx_done.handler = _event_handler_tx_done;
+#endif
+#if IS_USED(MODULE_GNRC_NETIF_RX_OFFLOAD)
+    netif->event_rx.handler = _event_handler_rx;
+    netif->rx_evq = EVENT_PRIO_MEDIUM;
+    cib_init(&netif->rx_cib, GNRC_NETIF_RX_OFFLOAD_QUEUE_SIZE);
 #endif
     /* set up the event queue */
     event_queues_init(netif->evq, GNRC_NETIF_EVQ_NUMOF);
@@ -2032,7 +2092,53 @@ static void _pass_on_packet(gnrc_pktsnip_t *pkt)
     }
 }
 
-static void _event_cb(netdev_t *dev, netdev_event_t event)
+#if IS_USED(MODULE_GNRC_NETIF_RX_OFFLOAD)
+/**
+ * @brief   Dispatch the received packets queued by the interface's thread
+ *
+ * @param[in]   evp     pointer to the event
+ */
+static void _event_handler_rx(event_t *evp)
+{
+    gnrc_netif_t *netif = container_of(evp, gnrc_netif_t, event_rx);
+
+    while (1) {
+        gnrc_pktsnip_t *pkt = NULL;
+        unsigned state = irq_disable();
+        int idx = cib_get(&netif->rx_cib);
+
+        if (idx >= 0) {
+            pkt = netif->rx_queue[idx];
+        }
+        irq_restore(state);
+
+        if (pkt == NULL) {
+            break;
+        }
+        _pass_on_packet(pkt);
+    }
+}
+
+static void _offload_packet(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt)
+{
+    unsigned state = irq_disable();
+    int idx = cib_put(&netif->rx_cib);
+
+    if (idx >= 0) {
+        netif->rx_queue[idx] = pkt;
+    }
+    irq_restore(state);
+
+    if (idx < 0) {
+        DEBUG("gnrc_netif: RX offload queue full, dropping packet\n");
+        gnrc_pktbuf_release(pkt);
+        return;
+    }
+    event_post(netif->rx_evq, &netif->event_rx);
+}
+#endif
+
+static void RIOT_HOT _event_cb(netdev_t *dev, netdev_event_t event)
 {
     gnrc_netif_t *netif = (gnrc_netif_t *)dev->context;
 
@@ -2071,7 +2177,12 @@ static void _event_cb(netdev_t *dev, netdev_event_t event)
                 _send_queued_pkt(netif);
                 if (pkt) {
                     _process_receive_stats(netif, pkt);
+                    _process_receive_csum(netif, pkt);
+#if IS_USED(MODULE_GNRC_NETIF_RX_OFFLOAD)
+                    _offload_packet(netif, pkt);
+#else
                     _pass_on_packet(pkt);
+#endif
                 }
                 break;
 #if IS_USED(MODULE_NETDEV_LEGACY_API)
@@ -2124,6 +2235,14 @@ static void _event_cb(netdev_t *dev, netdev_event_t event)
                 break;
 #  endif  /* IS_USED(MODULE_NETSTATS_L2) || IS_USED(MODULE_GNRC_NETIF_PKTQ) */
 #endif /* IS_USED(MODULE_NETDEV_LEGACY_API) */
+#if IS_USED(MODULE_NETSTATS_L2)
+            case NETDEV_EVENT_CRC_ERROR:
+                netif->stats.rx_invalid++;
+                break;
+            case NETDEV_EVENT_RX_OVERRUN:
+                netif->stats.rx_overrun++;
+                break;
+#endif  /* IS_USED(MODULE_NETSTATS_L2) */
             default:
                 DEBUG("gnrc_netif: warning: unhandled event %u.\n", event);
         }
@@ -51,6 +51,8 @@ static msg_t backoff_msg = { .type = MSG_TYPE_MLME_BACKOFF_EXPIRE };
 static int _send(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt);
 static gnrc_pktsnip_t *_recv(gnrc_netif_t *netif);
 static void _msg_handler(gnrc_netif_t *netif, msg_t *msg);
+static void _txq_send(gnrc_netif_t *netif);
+static void _txq_flush(gnrc_netif_lorawan_t *lw_netif);
 static int _get(gnrc_netif_t *netif, gnrc_netapi_opt_t *opt);
 static int _set(gnrc_netif_t *netif, const gnrc_netapi_opt_t *opt);
 static int _init(gnrc_netif_t *netif);
@@ -83,6 +85,8 @@ void gnrc_lorawan_mlme_confirm(gnrc_lorawan_t *mac, mlme_confirm_t *confirm)
         else {
             DEBUG("gnrc_lorawan: join failed\n");
         }
+        /* uplinks queued during the join procedure */
+        _txq_send(container_of(lw_netif, gnrc_netif_t, lorawan));
     }
     else if (confirm->type == MLME_LINK_CHECK) {
         lw_netif->flags &= ~GNRC_NETIF_LORAWAN_FLAGS_LINK_CHECK;
@@ -174,12 +178,14 @@ void gnrc_lorawan_mlme_indication(gnrc_lorawan_t *mac, mlme_indication_t *ind)
 
 void gnrc_lorawan_mcps_confirm(gnrc_lorawan_t *mac, mcps_confirm_t *confirm)
 {
-    (void)mac;
+    gnrc_netif_t *netif = container_of(mac, gnrc_netif_t, lorawan.mac);
 
     gnrc_pktbuf_release_error((gnrc_pktsnip_t *)confirm->msdu, confirm->status);
 
     DEBUG("gnrc_lorawan: transmission finished with status %i\n",
           confirm->status);
+
+    _txq_send(netif);
 }
 
 static void _rx_done(gnrc_lorawan_t *mac)
@@ -254,6 +260,7 @@ static void _driver_cb(netdev_t *dev, netdev_event_t event)
 
 static void _reset(gnrc_netif_t *netif)
 {
+    _txq_flush(&netif->lorawan);
     netif->lorawan.otaa = CONFIG_LORAMAC_DEFAULT_JOIN_PROCEDURE ==
                           LORAMAC_JOIN_OTAA ? NETOPT_ENABLE : NETOPT_DISABLE;
     netif->lorawan.datarate = CONFIG_LORAMAC_DEFAULT_DR;
@@ -361,11 +368,120 @@ static gnrc_pktsnip_t *_recv(gnrc_netif_t *netif)
     return 0;
 }
 
-static int _send(gnrc_netif_t *netif, gnrc_pktsnip_t *payload)
+static void _txq_push(gnrc_netif_lorawan_t *lw_netif, gnrc_pktsnip_t *pkt,
+                      uint8_t port)
+{
+    unsigned idx = (lw_netif->txq_first + lw_netif->txq_len) %
+                   CONFIG_GNRC_NETIF_LORAWAN_TX_QUEUE_LEN;
+
+    lw_netif->txq[idx] = pkt;
+    lw_netif->txq_port[idx] = port;
+    lw_netif->txq_len++;
+}
+
+static gnrc_pktsnip_t *_txq_pop(gnrc_netif_lorawan_t *lw_netif)
+{
+    gnrc_pktsnip_t *pkt = lw_netif->txq[lw_netif->txq_first];
+
+    lw_netif->txq_first = (lw_netif->txq_first + 1) %
+                          CONFIG_GNRC_NETIF_LORAWAN_TX_QUEUE_LEN;
+    lw_netif->txq_len--;
+    return pkt;
+}
+
+static void _txq_flush(gnrc_netif_lorawan_t *lw_netif)
+{
+    while (lw_netif->txq_len) {
+        gnrc_pktbuf_release_error(_txq_pop(lw_netif), ENETDOWN);
+    }
+    lw_netif->txq_first = 0;
+}
+
+static bool _is_exclusive(const gnrc_pktsnip_t *pkt)
+{
+    for (; pkt; pkt = pkt->next) {
+        if (pkt->users > 1) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/* Appends the following queued packets to the same port to the one just
+ * popped from the queue, as long as they fit into a single frame */
+static void _txq_aggregate(gnrc_netif_lorawan_t *lw_netif,
+                           gnrc_pktsnip_t *pkt, uint8_t port)
+{
+    size_t max = gnrc_lorawan_mcps_payload_max(&lw_netif->mac,
+                                               lw_netif->datarate);
+    size_t len = gnrc_pkt_len(pkt);
+
+    /* the chained packets are modified and released together */
+    if (!_is_exclusive(pkt)) {
+        return;
+    }
+
+    while (lw_netif->txq_len) {
+        gnrc_pktsnip_t *next = lw_netif->txq[lw_netif->txq_first];
+        size_t next_len = gnrc_pkt_len(next);
+
+        if ((lw_netif->txq_port[lw_netif->txq_first] != port) ||
+            (len + next_len > max) || !_is_exclusive(next)) {
+            break;
+        }
+        gnrc_pkt_append(pkt, _txq_pop(lw_netif));
+        len += next_len;
+    }
+    DEBUG("gnrc_netif_lorawan: sending %u aggregated bytes\n", (unsigned)len);
+}
+
+static int _transmit(gnrc_netif_t *netif, gnrc_pktsnip_t *payload,
+                     uint8_t port)
 {
     mlme_request_t mlme_request;
     mlme_confirm_t mlme_confirm;
 
+    if (netif->lorawan.flags & GNRC_NETIF_LORAWAN_FLAGS_LINK_CHECK) {
+        mlme_request.type = MLME_LINK_CHECK;
+        gnrc_lorawan_mlme_request(&netif->lorawan.mac, &mlme_request,
+                                  &mlme_confirm);
+    }
+
+    if (IS_ACTIVE(CONFIG_GNRC_NETIF_LORAWAN_AGGREGATE)) {
+        _txq_aggregate(&netif->lorawan, payload, port);
+    }
+
+    mcps_request_t req =
+    { .type = netif->lorawan.ack_req ? MCPS_CONFIRMED : MCPS_UNCONFIRMED,
+      .data =
+      { .pkt = (iolist_t *)payload, .port = port,
+        .dr = netif->lorawan.datarate } };
+    mcps_confirm_t conf;
+
+    gnrc_lorawan_mcps_request(&netif->lorawan.mac, &req, &conf);
+
+    if (conf.status < 0) {
+        DEBUG("gnrc_netif: unable to send (%s)\n", strerror(-conf.status));
+        gnrc_pktbuf_release_error(payload, -conf.status);
+    }
+
+    return conf.status;
+}
+
+/* Sends queued uplinks until one of them keeps the MAC layer busy */
+static void _txq_send(gnrc_netif_t *netif)
+{
+    gnrc_netif_lorawan_t *lw_netif = &netif->lorawan;
+
+    while (lw_netif->txq_len && !gnrc_lorawan_mac_is_busy(&lw_netif->mac)) {
+        uint8_t port = lw_netif->txq_port[lw_netif->txq_first];
+
+        _transmit(netif, _txq_pop(lw_netif), port);
+    }
+}
+
+static int _send(gnrc_netif_t *netif, gnrc_pktsnip_t *payload)
+{
     uint8_t port;
     int res = -EINVAL;
 
@@ -392,27 +508,22 @@ static int _send(gnrc_netif_t *netif, gnrc_pktsnip_t *payload)
         port = netif->lorawan.port;
     }
 
-    if (netif->lorawan.flags & GNRC_NETIF_LORAWAN_FLAGS_LINK_CHECK) {
-        mlme_request.type = MLME_LINK_CHECK;
-        gnrc_lorawan_mlme_request(&netif->lorawan.mac, &mlme_request,
-                                  &mlme_confirm);
+    if (!gnrc_lorawan_mac_is_busy(&netif->lorawan.mac) &&
+        !netif->lorawan.txq_len) {
+        /* errors of an idle MAC layer are reported right away */
+        return _transmit(netif, payload, port);
     }
 
-    mcps_request_t req =
-    { .type = netif->lorawan.ack_req ? MCPS_CONFIRMED : MCPS_UNCONFIRMED,
-      .data =
-      { .pkt = (iolist_t *)payload, .port = port,
-        .dr = netif->lorawan.datarate } };
-    mcps_confirm_t conf;
-
-    gnrc_lorawan_mcps_request(&netif->lorawan.mac, &req, &conf);
-    res = conf.status;
-
-    if (res < 0) {
-        DEBUG("gnrc_netif: unable to send (%s)\n", strerror(-res));
-        gnrc_pktbuf_release_error(payload, res);
+    if (netif->lorawan.txq_len == CONFIG_GNRC_NETIF_LORAWAN_TX_QUEUE_LEN) {
+        DEBUG("gnrc_netif_lorawan: TX queue full\n");
+        gnrc_pktbuf_release_error(payload, ENOBUFS);
+        return -ENOBUFS;
     }
 
+    /* sent from gnrc_lorawan_mcps_confirm() or gnrc_lorawan_mlme_confirm() */
+    _txq_push(&netif->lorawan, payload, port);
+    res = 0;
+
 end:
     return res;
 }
@@ -14,11 +14,17 @@
  */
 
 #include <assert.h>
+#include <errno.h>
 
+#include "net/gnrc/pktbuf.h"
 #include "net/gnrc/pktqueue.h"
 #include "net/gnrc/netif/conf.h"
+#include "net/gnrc/netif/hdr.h"
 #include "net/gnrc/netif/internal.h"
 #include "net/gnrc/netif/pktq.h"
+#include "net/ipv6/hdr.h"
+#include "net/protnum.h"
+#include "ztimer.h"
 
 #define ENABLE_DEBUG 0
 #include "debug.h"
@@ -55,11 +61,267 @@ unsigned gnrc_netif_pktq_usage(void)
     return res;
 }
 
+#if IS_USED(MODULE_GNRC_NETIF_PKTQ_FQ)
+#define FLOWS       CONFIG_GNRC_NETIF_PKTQ_FQ_FLOWS
+#define QUANTUM     CONFIG_GNRC_NETIF_PKTQ_FQ_QUANTUM
+#define TARGET      CONFIG_GNRC_NETIF_PKTQ_CODEL_TARGET_MS
+#define INTERVAL    CONFIG_GNRC_NETIF_PKTQ_CODEL_INTERVAL_MS
+
+/* enqueue time in ms of the packet in the _pool entry of the same index */
+static uint32_t _enqueued[CONFIG_GNRC_NETIF_PKTQ_POOL_SIZE];
+
+static gnrc_pktsnip_t *_take(gnrc_pktqueue_t *entry)
+{
+    gnrc_pktsnip_t *pkt = entry->pkt;
+
+    entry->pkt = NULL;
+    return pkt;
+}
+
+static void _drop(gnrc_pktqueue_t *entry)
+{
+    DEBUG("gnrc_netif_pktq: dropping packet %p\n", (void *)entry->pkt);
+    gnrc_pktbuf_release_error(_take(entry), ENOBUFS);
+}
+
+/* ICMPv6, including NDP and RPL, keeps the network operating */
+static bool _is_control(gnrc_pktsnip_t *pkt)
+{
+#if IS_USED(MODULE_GNRC_NETTYPE_ICMPV6)
+    /* 6LoWPAN compresses the IPv6 header, but keeps the ICMPv6 snip */
+    if (gnrc_pktsnip_search_type(pkt, GNRC_NETTYPE_ICMPV6)) {
+        return true;
+    }
+#endif
+#if IS_USED(MODULE_GNRC_NETTYPE_IPV6)
+    gnrc_pktsnip_t *ipv6 = gnrc_pktsnip_search_type(pkt, GNRC_NETTYPE_IPV6);
+
+    if (ipv6 && (((ipv6_hdr_t *)ipv6->data)->nh == PROTNUM_ICMPV6)) {
+        return true;
+    }
+#endif
+    (void)pkt;
+    return false;
+}
+
+/* FNV-1a */
+static uint32_t _hash(uint32_t hash, const void *data, size_t len)
+{
+    const uint8_t *bytes = data;
+
+    while (len--) {
+        hash = (hash ^ *(bytes++)) * 16777619U;
+    }
+    return hash;
+}
+
+static uint32_t _flow_hash(gnrc_pktsnip_t *pkt)
+{
+    uint32_t hash = 2166136261U;
+
+#if IS_USED(MODULE_GNRC_NETTYPE_IPV6)
+    gnrc_pktsnip_t *ipv6 = gnrc_pktsnip_search_type(pkt, GNRC_NETTYPE_IPV6);
+
+    if (ipv6) {
+        ipv6_hdr_t *hdr = ipv6->data;
+
+        hash = _hash(hash, &hdr->src, sizeof(hdr->src));
+        hash = _hash(hash, &hdr->dst, sizeof(hdr->dst));
+        return _hash(hash, &hdr->nh, sizeof(hdr->nh));
+    }
+#endif
+    /* compressed or fragmented packets are classified by next hop, this keeps
+     * the fragments of a datagram in order */
+    if (pkt->type == GNRC_NETTYPE_NETIF) {
+        gnrc_netif_hdr_t *hdr = pkt->data;
+
+        hash = _hash(hash, gnrc_netif_hdr_get_dst_addr(hdr),
+                     hdr->dst_l2addr_len);
+    }
+    return hash;
+}
+
+static gnrc_pktqueue_t *_flow_remove_head(gnrc_netif_pktq_t *q,
+                                          gnrc_netif_pktq_flow_t *flow)
+{
+    gnrc_pktqueue_t *entry = gnrc_pktqueue_remove_head(&flow->queue);
+
+    if (entry) {
+        flow->len--;
+        q->backlog--;
+    }
+    return entry;
+}
+
+static gnrc_netif_pktq_flow_t *_longest_flow(gnrc_netif_pktq_t *q)
+{
+    gnrc_netif_pktq_flow_t *res = NULL;
+
+    for (unsigned i = 0; i < FLOWS; i++) {
+        if (q->flows[i].len && (!res || (q->flows[i].len > res->len))) {
+            res = &q->flows[i];
+        }
+    }
+    return res;
+}
+
+static int _fq_put(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt)
+{
+    gnrc_netif_pktq_t *q = &netif->send_queue;
+    gnrc_pktqueue_t *entry = _get_free_entry(pkt);
+
+    if (entry == NULL) {
+        /* make room by dropping from the flow hogging the queue */
+        gnrc_netif_pktq_flow_t *longest = _longest_flow(q);
+
+        if (longest == NULL) {
+            return -1;
+        }
+        _drop(_flow_remove_head(q, longest));
+        if ((entry = _get_free_entry(pkt)) == NULL) {
+            return -1;
+        }
+    }
+
+    if (_is_control(pkt)) {
+        gnrc_pktqueue_add(&q->queue, entry);
+        return 0;
+    }
+
+    gnrc_netif_pktq_flow_t *flow = &q->flows[_flow_hash(pkt) % FLOWS];
+
+    if (flow->queue == NULL) {
+        flow->deficit = QUANTUM;
+    }
+    _enqueued[entry - _pool] = ztimer_now(ZTIMER_MSEC);
+    gnrc_pktqueue_add(&flow->queue, entry);
+    flow->len++;
+    q->backlog++;
+    return 0;
+}
+
+static uint32_t _control_law(uint32_t t, unsigned count)
+{
+    unsigned root = 1;
+
+    while ((root + 1) * (root + 1) <= count) {
+        root++;
+    }
+    return t + INTERVAL / root;
+}
+
+/* removes the head of a flow and checks if it stayed for too long */
+static gnrc_pktqueue_t *_codel_pop(gnrc_netif_pktq_t *q,
+                                   gnrc_netif_pktq_flow_t *flow, uint32_t now,
+                                   bool *ok_to_drop)
+{
+    gnrc_pktqueue_t *entry = _flow_remove_head(q, flow);
+
+    *ok_to_drop = false;
+    if (entry == NULL) {
+        flow->first_above = 0;
+        return NULL;
+    }
+
+    /* never drop the last packet, the queue can't get shorter */
+    if (((now - _enqueued[entry - _pool]) < TARGET) || (flow->queue == NULL)) {
+        flow->first_above = 0;
+    }
+    else if (flow->first_above == 0) {
+        flow->first_above = now + INTERVAL;
+    }
+    else {
+        *ok_to_drop = (int32_t)(now - flow->first_above) >= 0;
+    }
+    return entry;
+}
+
+/* see RFC 8289, section 5.5 */
+static gnrc_pktqueue_t *_codel_dequeue(gnrc_netif_pktq_t *q,
+                                       gnrc_netif_pktq_flow_t *flow,
+                                       uint32_t now)
+{
+    bool ok_to_drop;
+    gnrc_pktqueue_t *entry = _codel_pop(q, flow, now, &ok_to_drop);
+
+    if (entry == NULL) {
+        flow->dropping = false;
+    }
+    else if (flow->dropping) {
+        if (!ok_to_drop) {
+            flow->dropping = false;
+        }
+        while (flow->dropping && ((int32_t)(now - flow->drop_next) >= 0)) {
+            _drop(entry);
+            if (flow->count < UINT16_MAX) {
+                flow->count++;
+            }
+            entry = _codel_pop(q, flow, now, &ok_to_drop);
+            if (!ok_to_drop) {
+                flow->dropping = false;
+            }
+            else {
+                flow->drop_next = _control_law(flow->drop_next, flow->count);
+            }
+        }
+    }
+    else if (ok_to_drop) {
+        _drop(entry);
+        entry = _codel_pop(q, flow, now, &ok_to_drop);
+        flow->dropping = true;
+
+        /* resume with the previous drop rate if dropping stopped recently */
+        uint16_t delta = flow->count - flow->last_count;
+        if ((delta > 1) &&
+            ((int32_t)(now - flow->drop_next) < (int32_t)(16 * INTERVAL))) {
+            flow->count = delta;
+        }
+        else {
+            flow->count = 1;
+        }
+        flow->drop_next = _control_law(now, flow->count);
+        flow->last_count = flow->count;
+    }
+    return entry;
+}
+
+gnrc_pktsnip_t *gnrc_netif_pktq_fq_get(gnrc_netif_t *netif)
+{
+    gnrc_netif_pktq_t *q = &netif->send_queue;
+    gnrc_pktqueue_t *entry = gnrc_pktqueue_remove_head(&q->queue);
+
+    if (entry != NULL) {
+        return _take(entry);
+    }
+
+    uint32_t now = ztimer_now(ZTIMER_MSEC);
+
+    /* deficit round robin, every round adds a quantum to the flows */
+    while (q->backlog) {
+        gnrc_netif_pktq_flow_t *flow = &q->flows[q->flow];
+
+        if (flow->queue && (flow->deficit > 0) &&
+            (entry = _codel_dequeue(q, flow, now))) {
+            flow->deficit -= gnrc_pkt_len(entry->pkt);
+            return _take(entry);
+        }
+        if (flow->queue) {
+            flow->deficit += QUANTUM;
+        }
+        q->flow = (q->flow + 1) % FLOWS;
+    }
+    return NULL;
+}
+#endif /* IS_USED(MODULE_GNRC_NETIF_PKTQ_FQ) */
+
 int gnrc_netif_pktq_put(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt)
 {
     assert(netif != NULL);
     assert(pkt != NULL);
 
+#if IS_USED(MODULE_GNRC_NETIF_PKTQ_FQ)
+    return _fq_put(netif, pkt);
+#else
     gnrc_pktqueue_t *entry = _get_free_entry(pkt);
 
     if (entry == NULL) {
@@ -67,6 +329,7 @@ int gnrc_netif_pktq_put(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt)
     }
     gnrc_pktqueue_add(&netif->send_queue.queue, entry);
     return 0;
+#endif
 }
 
 void gnrc_netif_pktq_sched_get(gnrc_netif_t *netif)
@@ -17,6 +17,7 @@
 #include <limits.h>
 
 #include "assert.h"
+#include "kernel_defines.h"
 #include "log.h"
 #include "utlist.h"
 #include "net/gnrc/netreg.h"
@@ -24,6 +25,7 @@
 #include "net/gnrc/pkt.h"
 #include "net/gnrc/icmpv6.h"
 #include "net/gnrc/ipv6.h"
+#include "net/gnrc/ipv6/flowcache.h"
 #include "net/gnrc/udp.h"
 #ifdef MODULE_GNRC_TCP
 #include "net/gnrc/tcp.h"
@@ -31,9 +33,34 @@
 
 #define _INVALID_TYPE(type) (((type) < GNRC_NETTYPE_UNDEF) || ((type) >= GNRC_NETTYPE_NUMOF))
 
+#if IS_USED(MODULE_GNRC_NETREG_HASH)
+#define _BUCKETS    (1U << CONFIG_GNRC_NETREG_HASH_BUCKETS_EXP)
+
+/* The registry as lookup table by gnrc_nettype_t and hashed demux_ctx. All
+ * entries with the same demux_ctx end up in the same list, so getnext() can
+ * still just continue from an entry */
+static gnrc_netreg_entry_t *netreg[GNRC_NETTYPE_NUMOF][_BUCKETS];
+
+static inline gnrc_netreg_entry_t **_head(gnrc_nettype_t type,
+                                          uint32_t demux_ctx)
+{
+    /* fold the upper bits in, GNRC_NETREG_DEMUX_CTX_ALL only sets those */
+    demux_ctx ^= demux_ctx >> 16;
+    demux_ctx ^= demux_ctx >> 8;
+    return &netreg[type][demux_ctx & (_BUCKETS - 1)];
+}
+#else
 /* The registry as lookup table by gnrc_nettype_t */
 static gnrc_netreg_entry_t *netreg[GNRC_NETTYPE_NUMOF];
 
+static inline gnrc_netreg_entry_t **_head(gnrc_nettype_t type,
+                                          uint32_t demux_ctx)
+{
+    (void)demux_ctx;
+    return &netreg[type];
+}
+#endif
+
 /** Held while accessing _lock_counter, and also while the exclusive lock is held */
 static mutex_t _lock_for_counter = MUTEX_INIT;
 /** Number of shared locks on netreg. Saturating arithmetic is used; if this
@@ -63,7 +90,7 @@ static mutex_t _lock_wait_exclusive = MUTEX_INIT;
 void gnrc_netreg_init(void)
 {
     /* set all pointers in registry to NULL */
-    memset(netreg, 0, GNRC_NETTYPE_NUMOF * sizeof(gnrc_netreg_entry_t *));
+    memset(netreg, 0, sizeof(netreg));
 }
 
 void gnrc_netreg_acquire_shared(void) {
@@ -152,7 +179,10 @@ int gnrc_netreg_register(gnrc_nettype_t type, gnrc_netreg_entry_t *entry)
     }
 
     _gnrc_netreg_acquire_exclusive();
-    LL_PREPEND(netreg[type], entry);
+    LL_PREPEND(*_head(type, entry->demux_ctx), entry);
+    if (IS_USED(MODULE_GNRC_IPV6_FLOWCACHE)) {
+        gnrc_ipv6_flowcache_flush();
+    }
     _gnrc_netreg_release_exclusive();
 
     return 0;
@@ -165,7 +195,10 @@ void gnrc_netreg_unregister(gnrc_nettype_t type, gnrc_netreg_entry_t *entry)
     }
 
     _gnrc_netreg_acquire_exclusive();
-    LL_DELETE(netreg[type], entry);
+    LL_DELETE(*_head(type, entry->demux_ctx), entry);
+    if (IS_USED(MODULE_GNRC_IPV6_FLOWCACHE)) {
+        gnrc_ipv6_flowcache_flush();
+    }
     /* We can release now already: No new references to this entry can be made
      * any more, and the caller is only allowed to reuse the entry and the mbox
      * target referenced by it after *this* function returned, not when the
@@ -204,7 +237,8 @@ static gnrc_netreg_entry_t *_netreg_lookup(gnrc_netreg_entry_t *from,
     gnrc_netreg_entry_t *res = NULL;
 
     if (from || !_INVALID_TYPE(type)) {
-        gnrc_netreg_entry_t *head = (from) ? from->next : netreg[type];
+        gnrc_netreg_entry_t *head = (from) ? from->next
+                                           : *_head(type, demux_ctx);
         LL_SEARCH_SCALAR(head, res, demux_ctx, demux_ctx);
     }
 
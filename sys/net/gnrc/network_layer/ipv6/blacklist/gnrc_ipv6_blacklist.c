@@ -18,6 +18,7 @@
 #include "bitfield.h"
 
 #include "net/gnrc/ipv6/blacklist.h"
+#include "net/gnrc/ipv6/flowcache.h"
 
 #define ENABLE_DEBUG 0
 #include "debug.h"
@@ -33,6 +34,10 @@ int gnrc_ipv6_blacklist_add(const ipv6_addr_t *addr)
         if (!bf_isset(gnrc_ipv6_blacklist_set, i)) {
             bf_set(gnrc_ipv6_blacklist_set, i);
             memcpy(&gnrc_ipv6_blacklist[i], addr, sizeof(*addr));
+            if (IS_USED(MODULE_GNRC_IPV6_FLOWCACHE)) {
+                /* cached flows may come from this address */
+                gnrc_ipv6_flowcache_flush();
+            }
             DEBUG("IPv6 blacklist: blacklisted %s\n",
                   ipv6_addr_to_str(addr_str, addr, sizeof(addr_str)));
             return 0;
@@ -24,6 +24,7 @@
 #include "net/gnrc/ipv6.h"
 #include "net/gnrc/ipv6/ext.h"
 #include "net/gnrc/ipv6/ext/frag.h"
+#include "net/gnrc/netif/hdr.h"
 #include "net/gnrc/nettype.h"
 #include "net/gnrc/pktbuf.h"
 #include "random.h"
@@ -52,7 +53,7 @@ static uint32_t _last_id;
 
 typedef enum {
     FRAG_LIMITS_NEW = 0,        /**< limits are not present and do not overlap */
-    FRAG_LIMITS_DUPLICATE,      /**< fragment limits are already present */
+    FRAG_LIMITS_DUPLICATE,      /**< fragment limits were already received */
     FRAG_LIMITS_OVERLAP,        /**< limits overlap */
     FRAG_LIMITS_FULL,           /**< no free gnrc_ipv6_ext_frag_limits_t object */
 } _limits_res_t;
@@ -377,7 +378,9 @@ static inline void _init_rbuf(gnrc_ipv6_ext_frag_rbuf_t *rbuf, ipv6_hdr_t *ipv6,
  * @brief   Checks if given fragment limits overlap with fragment limits already
  *          in a given reassembly buffer entry
  *
- * If no overlap exists the new limits are added to @p rbuf.
+ * If no overlap exists the new limits are added to @p rbuf. The limits of
+ * @p rbuf are kept sorted and adjacent limits are merged, so there is one
+ * limits object per contiguous range received and not one per fragment.
  *
  * @param[in, out] rbuf A reassembly buffer entry.
  * @param[in] offset    A fragment offset.
@@ -408,6 +411,14 @@ static inline void _set_nh(gnrc_pktsnip_t *hdr_snip, uint8_t nh);
  */
 static gnrc_pktsnip_t *_completed(gnrc_ipv6_ext_frag_rbuf_t *rbuf);
 
+/**
+ * @brief   Clears @ref GNRC_NETIF_HDR_FLAGS_CSUM_VALID of a datagram that was
+ *          received as fragment
+ *
+ * @param[in] pkt       A datagram.
+ */
+static void _clear_csum_valid(gnrc_pktsnip_t *pkt);
+
 gnrc_pktsnip_t *gnrc_ipv6_ext_frag_reass(gnrc_pktsnip_t *pkt)
 {
     gnrc_ipv6_ext_frag_rbuf_t *rbuf;
@@ -445,13 +456,16 @@ gnrc_pktsnip_t *gnrc_ipv6_ext_frag_reass(gnrc_pktsnip_t *pkt)
             gnrc_pktbuf_release(pkt);
             return NULL;
         case FRAG_LIMITS_OVERLAP:
+            /* RFC 8200, section 4.5: overlapping fragments are not
+             * allowed, discard the whole datagram */
             DEBUG("ipv6_ext_frag: fragment overlaps with existing fragments\n");
-            /* intentionally falls through */
+            goto error_exit;
         case FRAG_LIMITS_FULL:
         default:
             DEBUG("ipv6_ext_frag: can't store fragment limits\n");
             goto error_exit;
     }
+    rbuf->frags++;
     if (offset > 0) {
         size_t size_until = offset + pkt->size;
 
@@ -507,6 +521,7 @@ gnrc_pktsnip_t *gnrc_ipv6_ext_frag_reass(gnrc_pktsnip_t *pkt)
         _set_nh(fh_snip->next, nh);
         gnrc_pktbuf_remove_snip(pkt, fh_snip);
         gnrc_ipv6_ext_frag_rbuf_del(rbuf);
+        _clear_csum_valid(pkt);
         ipv6->len = byteorder_htons(byteorder_ntohs(ipv6->len) -
                                     sizeof(ipv6_ext_frag_t));
         if (IS_USED(MODULE_GNRC_IPV6_EXT_FRAG_STATS)) {
@@ -630,22 +645,7 @@ static inline void _init_rbuf(gnrc_ipv6_ext_frag_rbuf_t *rbuf, ipv6_hdr_t *ipv6,
     rbuf->id = id;
     rbuf->pkt_len = 0;
     rbuf->last = 0;
-}
-
-static int _check_overlap(clist_node_t *node, void *arg)
-{
-    _check_limits_t *limits = arg;
-    gnrc_ipv6_ext_frag_limits_t *cur = (gnrc_ipv6_ext_frag_limits_t *)node;
-
-    return ((cur->start < limits->end) && (limits->start < cur->end));
-}
-
-static int _limits_cmp(clist_node_t *a, clist_node_t *b)
-{
-    gnrc_ipv6_ext_frag_limits_t *al = (gnrc_ipv6_ext_frag_limits_t *)a;
-    gnrc_ipv6_ext_frag_limits_t *bl = (gnrc_ipv6_ext_frag_limits_t *)b;
-
-    return (int)al->start - (int)bl->start;
+    rbuf->frags = 0;
 }
 
 static _limits_res_t _overlaps(gnrc_ipv6_ext_frag_rbuf_t *rbuf,
@@ -653,34 +653,73 @@ static _limits_res_t _overlaps(gnrc_ipv6_ext_frag_rbuf_t *rbuf,
 {
     _check_limits_t limits = { .start = offset >> 3U,
                                .end = (offset + pkt_len) >> 3U };
-    gnrc_ipv6_ext_frag_limits_t *res;
+    gnrc_ipv6_ext_frag_limits_t *tail =
+        (gnrc_ipv6_ext_frag_limits_t *)rbuf->limits.next;
+    gnrc_ipv6_ext_frag_limits_t *prev = NULL, *next = NULL;
 
     if (limits.start == limits.end) {
         /* might happen with last fragment */
         limits.end++;
     }
-    res = (gnrc_ipv6_ext_frag_limits_t *)clist_foreach(&rbuf->limits,
-                                                       _check_overlap,
-                                                       &limits);
-    if (res == NULL) {
-        res = (gnrc_ipv6_ext_frag_limits_t *)clist_lpop(&_free_limits);
-        if (res != NULL) {
-            res->start = limits.start;
-            res->end = limits.end;
-            clist_rpush(&rbuf->limits, (clist_node_t *)res);
-            clist_sort(&rbuf->limits, _limits_cmp);
-            return FRAG_LIMITS_NEW;
+    if (tail != NULL) {
+        gnrc_ipv6_ext_frag_limits_t *ptr = tail;
+
+        /* limits are sorted and disjoint: find the last one before the
+         * fragment and the first one that is not */
+        do {
+            ptr = ptr->next;
+            if (ptr->end > limits.start) {
+                next = ptr;
+                break;
+            }
+            prev = ptr;
+        } while (ptr != tail);
+    }
+    if ((next != NULL) && (next->start < limits.end)) {
+        if ((next->start <= limits.start) && (limits.end <= next->end)) {
+            return FRAG_LIMITS_DUPLICATE;
+        }
+        return FRAG_LIMITS_OVERLAP;
+    }
+    if ((prev != NULL) && (prev->end == limits.start)) {
+        if ((next != NULL) && (next->start == limits.end)) {
+            /* fragment closes the hole between prev and next */
+            prev->end = next->end;
+            prev->next = next->next;
+            if (next == tail) {
+                rbuf->limits.next = (clist_node_t *)prev;
+            }
+            clist_rpush(&_free_limits, (clist_node_t *)next);
         }
         else {
-            return FRAG_LIMITS_FULL;
+            prev->end = limits.end;
         }
+        return FRAG_LIMITS_NEW;
+    }
+    if ((next != NULL) && (next->start == limits.end)) {
+        next->start = limits.start;
+        return FRAG_LIMITS_NEW;
+    }
+
+    gnrc_ipv6_ext_frag_limits_t *res =
+        (gnrc_ipv6_ext_frag_limits_t *)clist_lpop(&_free_limits);
+
+    if (res == NULL) {
+        return FRAG_LIMITS_FULL;
     }
-    else if ((res->start == limits.start) && (res->end == limits.end)) {
-        return FRAG_LIMITS_DUPLICATE;
+    res->start = limits.start;
+    res->end = limits.end;
+    if (prev == NULL) {
+        clist_lpush(&rbuf->limits, (clist_node_t *)res);
+    }
+    else if (prev == tail) {
+        clist_rpush(&rbuf->limits, (clist_node_t *)res);
     }
     else {
-        return FRAG_LIMITS_NEW;
+        res->next = prev->next;
+        prev->next = res;
     }
+    return FRAG_LIMITS_NEW;
 }
 
 static inline void _set_nh(gnrc_pktsnip_t *hdr_snip, uint8_t nh)
@@ -703,6 +742,17 @@ static inline void _set_nh(gnrc_pktsnip_t *hdr_snip, uint8_t nh)
     }
 }
 
+static void _clear_csum_valid(gnrc_pktsnip_t *pkt)
+{
+    gnrc_pktsnip_t *netif = gnrc_pktsnip_search_type(pkt, GNRC_NETTYPE_NETIF);
+
+    /* the device only saw fragments, the checksum of the datagram is
+     * unverified */
+    if (netif != NULL) {
+        ((gnrc_netif_hdr_t *)netif->data)->flags &= ~GNRC_NETIF_HDR_FLAGS_CSUM_VALID;
+    }
+}
+
 static gnrc_pktsnip_t *_completed(gnrc_ipv6_ext_frag_rbuf_t *rbuf)
 {
     assert(rbuf->limits.next != NULL);    /* this function is only called when
@@ -711,24 +761,18 @@ static gnrc_pktsnip_t *_completed(gnrc_ipv6_ext_frag_rbuf_t *rbuf)
     /* clist: first element is second element ;-) (from next of head) */
     gnrc_ipv6_ext_frag_limits_t *ptr =
             (gnrc_ipv6_ext_frag_limits_t *)rbuf->limits.next->next;
-    if (rbuf->last && (ptr->start == 0)) {
-        gnrc_pktsnip_t *res = NULL;
+    /* adjacent limits are merged, so the datagram is complete when the last
+     * fragment was received and a single range starts at the beginning */
+    if (rbuf->last && (ptr->start == 0) &&
+        (((clist_node_t *)ptr) == rbuf->limits.next)) {
+        gnrc_pktsnip_t *res = rbuf->pkt;
 
-        /* last and first fragment were received, so check if everything
-         * in-between is there */
-        do {
-            gnrc_ipv6_ext_frag_limits_t *next = ptr->next;
-            if (ptr->end < next->start) {
-                return NULL;
-            }
-            ptr = next;
-        } while (((clist_node_t *)ptr) != rbuf->limits.next);
-        res = rbuf->pkt;
+        _clear_csum_valid(res);
         /* rewrite length */
         rbuf->ipv6->len = byteorder_htons(rbuf->pkt_len);
         rbuf->pkt = NULL;
         if (IS_USED(MODULE_GNRC_IPV6_EXT_FRAG_STATS)) {
-            _stats.fragments += clist_count(&rbuf->limits);
+            _stats.fragments += rbuf->frags;
             _stats.datagrams++;
         }
         gnrc_ipv6_ext_frag_rbuf_free(rbuf);
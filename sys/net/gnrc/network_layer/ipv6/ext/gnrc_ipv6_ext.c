@@ -264,9 +264,10 @@ static gnrc_pktsnip_t *_demux(gnrc_pktsnip_t *pkt, unsigned protnum)
         gnrc_pktsnip_t *sub_pkt;
 
         /* enforce duplication so we can dispatch packet to subscriber(s) and
-         * handle the packet */
+         * handle the packet. The subscribers get their own snip, but the
+         * data may stay shared */
         gnrc_pktbuf_hold(pkt, 1);
-        sub_pkt = gnrc_pktbuf_start_write(pkt);
+        sub_pkt = gnrc_pktbuf_start_write_desc(pkt);
         if (sub_pkt != NULL) {
             /* check in case subscriber unregistered in the meantime */
             if (gnrc_netapi_dispatch_receive(GNRC_NETTYPE_IPV6, protnum,
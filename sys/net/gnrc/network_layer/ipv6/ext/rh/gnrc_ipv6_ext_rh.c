@@ -67,7 +67,7 @@ static void _forward_pkt(gnrc_pktsnip_t *pkt, ipv6_hdr_t *hdr)
 
 int gnrc_ipv6_ext_rh_process(gnrc_pktsnip_t *pkt)
 {
-    gnrc_pktsnip_t *ipv6;
+    gnrc_pktsnip_t *ipv6, *prev;
     ipv6_ext_rh_t *ext = pkt->data;
     ipv6_hdr_t *hdr;
     int res = GNRC_IPV6_EXT_RH_AT_DST;
@@ -79,6 +79,19 @@ int gnrc_ipv6_ext_rh_process(gnrc_pktsnip_t *pkt)
     }
     ipv6 = gnrc_pktsnip_search_type(pkt, GNRC_NETTYPE_IPV6);
     assert(ipv6 != NULL);
+    /* the routing header and the IPv6 header are changed in place, so their
+     * data must not be shared with other users of the packet. pkt has no
+     * other users, so it is not replaced */
+    assert(pkt->users == 1);
+    prev = gnrc_pkt_prev_snip(pkt, ipv6);
+    if ((gnrc_pktbuf_start_write(pkt) == NULL) ||
+        ((ipv6 = gnrc_pktbuf_start_write(ipv6)) == NULL)) {
+        DEBUG("ipv6_ext_rh: unable to get write access to headers\n");
+        gnrc_pktbuf_release_error(pkt, ENOMEM);
+        return GNRC_IPV6_EXT_RH_ERROR;
+    }
+    prev->next = ipv6;
+    ext = pkt->data;
     hdr = ipv6->data;
     switch (ext->type) {
 #ifdef MODULE_GNRC_RPL_SRH
@@ -0,0 +1,100 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ *
+ * The entries are only read and written by the IPv6 thread. Other threads
+ * only flush the cache, by changing the version, so no lock is needed.
+ */
+
+#include <string.h>
+
+#include "net/gnrc/ipv6/flowcache.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+static gnrc_ipv6_flowcache_entry_t _flows[CONFIG_GNRC_IPV6_FLOWCACHE_NUMOF];
+static volatile unsigned _version = 1;
+static uint16_t _now;
+
+static inline bool _valid(const gnrc_ipv6_flowcache_entry_t *flow)
+{
+    return flow->version == _version;
+}
+
+static bool _match(const gnrc_ipv6_flowcache_entry_t *flow,
+                   const gnrc_netif_t *rx_netif, const ipv6_hdr_t *hdr,
+                   const udp_hdr_t *udp)
+{
+    return (flow->rx_netif == rx_netif) &&
+           (flow->src_port.u16 == udp->src_port.u16) &&
+           (flow->dst_port.u16 == udp->dst_port.u16) &&
+           ipv6_addr_equal(&flow->src, &hdr->src) &&
+           ipv6_addr_equal(&flow->dst, &hdr->dst);
+}
+
+unsigned gnrc_ipv6_flowcache_version(void)
+{
+    return _version;
+}
+
+const gnrc_ipv6_flowcache_entry_t *gnrc_ipv6_flowcache_get(const gnrc_netif_t *rx_netif,
+                                                           const ipv6_hdr_t *hdr,
+                                                           const udp_hdr_t *udp)
+{
+    for (unsigned i = 0; i < ARRAY_SIZE(_flows); i++) {
+        gnrc_ipv6_flowcache_entry_t *flow = &_flows[i];
+
+        if (_valid(flow) && _match(flow, rx_netif, hdr, udp)) {
+            flow->last_used = ++_now;
+            return flow;
+        }
+    }
+    return NULL;
+}
+
+void gnrc_ipv6_flowcache_add(unsigned version, const gnrc_netif_t *rx_netif,
+                             const ipv6_hdr_t *hdr, const udp_hdr_t *udp,
+                             gnrc_netif_t *netif, bool nh_subs)
+{
+    gnrc_ipv6_flowcache_entry_t *flow = &_flows[0];
+
+    for (unsigned i = 0; i < ARRAY_SIZE(_flows); i++) {
+        if (!_valid(&_flows[i])) {
+            flow = &_flows[i];
+            break;
+        }
+        if ((uint16_t)(_now - _flows[i].last_used) >
+            (uint16_t)(_now - flow->last_used)) {
+            flow = &_flows[i];
+        }
+    }
+    DEBUG("ipv6_flowcache: caching flow in entry %u\n",
+          (unsigned)index_of(_flows, flow));
+    memcpy(&flow->src, &hdr->src, sizeof(flow->src));
+    memcpy(&flow->dst, &hdr->dst, sizeof(flow->dst));
+    flow->rx_netif = rx_netif;
+    flow->netif = netif;
+    flow->src_port = udp->src_port;
+    flow->dst_port = udp->dst_port;
+    flow->last_used = ++_now;
+    flow->nh_subs = nh_subs;
+    /* only valid if the cache was not flushed since the lookups */
+    flow->version = version;
+}
+
+void gnrc_ipv6_flowcache_flush(void)
+{
+    _version++;
+}
+
+/** @} */
@@ -25,6 +25,7 @@
 #include "net/gnrc/sixlowpan/ctx.h"
 #include "net/gnrc/sixlowpan/nd.h"
 #include "net/protnum.h"
+#include "rmutex.h"
 #include "thread.h"
 #include "utlist.h"
 
@@ -32,6 +33,7 @@
 #include "net/gnrc/netif/internal.h"
 #include "net/gnrc/ipv6/whitelist.h"
 #include "net/gnrc/ipv6/blacklist.h"
+#include "net/gnrc/ipv6/flowcache.h"
 
 #ifdef MODULE_GNRC_IPV6_EXT_FRAG
 #include "net/gnrc/ipv6/ext/frag.h"
@@ -80,6 +82,28 @@ static void _send_by_netif_hdr(gnrc_pktsnip_t *pkt);
 /* Main event loop for IPv6 */
 static void *_event_loop(void *args);
 
+#if IS_USED(MODULE_GNRC_NETIF_RX_OFFLOAD)
+/* Received packets are processed in the context of the dispatching thread,
+ * this serializes them with everything handled by the IPv6 thread. Recursive,
+ * as encapsulated packets are dispatched again from within _receive() */
+static rmutex_t _lock = RMUTEX_INIT;
+
+static void _netapi_cb(uint16_t cmd, gnrc_pktsnip_t *pkt, void *ctx)
+{
+    (void)ctx;
+    if (cmd == GNRC_NETAPI_MSG_TYPE_RCV) {
+        rmutex_lock(&_lock);
+        _receive(pkt);
+        rmutex_unlock(&_lock);
+    }
+    /* keep sending in the IPv6 thread, so upper layers' threads don't need
+     * the stack for it */
+    else if (gnrc_netapi_send(gnrc_ipv6_pid, pkt) < 1) {
+        gnrc_pktbuf_release_error(pkt, EIO);
+    }
+}
+#endif
+
 kernel_pid_t gnrc_ipv6_init(void)
 {
     if (gnrc_ipv6_pid == KERNEL_PID_UNDEF) {
@@ -99,7 +123,7 @@ kernel_pid_t gnrc_ipv6_init(void)
 }
 
 static void _dispatch_next_header(gnrc_pktsnip_t *pkt, unsigned nh,
-                                  bool interested);
+                                  bool interested, bool nh_subs);
 
 static inline bool _gnrc_ipv6_is_interested(unsigned nh) {
 #ifdef MODULE_GNRC_ICMPV6
@@ -109,10 +133,11 @@ static inline bool _gnrc_ipv6_is_interested(unsigned nh) {
 #endif /* MODULE_GNRC_ICMPV6 */
 }
 
-static void _demux(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt, unsigned nh)
+static void _demux(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt, unsigned nh,
+                   bool nh_subs)
 {
     pkt->type = gnrc_nettype_from_protnum(nh);
-    _dispatch_next_header(pkt, nh, _gnrc_ipv6_is_interested(nh));
+    _dispatch_next_header(pkt, nh, _gnrc_ipv6_is_interested(nh), nh_subs);
     switch (nh) {
 #ifdef MODULE_GNRC_ICMPV6
         case PROTNUM_ICMPV6:
@@ -141,10 +166,9 @@ ipv6_hdr_t *gnrc_ipv6_get_header(gnrc_pktsnip_t *pkt)
 
 /* internal functions */
 static void _dispatch_next_header(gnrc_pktsnip_t *pkt, unsigned nh,
-                                  bool interested)
+                                  bool interested, bool nh_subs)
 {
-    const bool has_nh_subs = (gnrc_netreg_num(GNRC_NETTYPE_IPV6, nh) > 0) ||
-                             interested;
+    const bool has_nh_subs = nh_subs || interested;
 
     DEBUG("ipv6: forward nh = %u to other threads\n", nh);
 
@@ -173,8 +197,14 @@ static void _dispatch_next_header(gnrc_pktsnip_t *pkt, unsigned nh,
 static void *_event_loop(void *args)
 {
     msg_t msg, reply, msg_q[GNRC_IPV6_MSG_QUEUE_SIZE];
+#if IS_USED(MODULE_GNRC_NETIF_RX_OFFLOAD)
+    static gnrc_netreg_entry_cbd_t me_cbd = { .cb = _netapi_cb };
+    gnrc_netreg_entry_t me_reg = GNRC_NETREG_ENTRY_INIT_CB(GNRC_NETREG_DEMUX_CTX_ALL,
+                                                           &me_cbd);
+#else
     gnrc_netreg_entry_t me_reg = GNRC_NETREG_ENTRY_INIT_PID(GNRC_NETREG_DEMUX_CTX_ALL,
                                                             thread_getpid());
+#endif
 
     (void)args;
     msg_init_queue(msg_q, GNRC_IPV6_MSG_QUEUE_SIZE);
@@ -193,6 +223,9 @@ static void *_event_loop(void *args)
     while (1) {
         DEBUG("ipv6: waiting for incoming message.\n");
         msg_receive(&msg);
+#if IS_USED(MODULE_GNRC_NETIF_RX_OFFLOAD)
+        rmutex_lock(&_lock);
+#endif
 
         switch (msg.type) {
             case GNRC_NETAPI_MSG_TYPE_RCV:
@@ -253,6 +286,9 @@ static void *_event_loop(void *args)
             default:
                 break;
         }
+#if IS_USED(MODULE_GNRC_NETIF_RX_OFFLOAD)
+        rmutex_unlock(&_lock);
+#endif
     }
 
     return NULL;
@@ -333,7 +369,18 @@ static bool _is_ipv6_hdr(gnrc_pktsnip_t *hdr)
 #endif
 }
 
-static int _fill_ipv6_hdr(gnrc_netif_t *netif, gnrc_pktsnip_t *ipv6)
+/* checksums of the upper layer are calculated by the device */
+static inline bool _csum_offloaded(gnrc_netif_t *netif, gnrc_pktsnip_t *ipv6,
+                                   bool loopback)
+{
+    /* the device only sees fragments of packets exceeding the MTU */
+    return !loopback && (netif != NULL) &&
+           (netif->flags & GNRC_NETIF_FLAGS_TX_CSUM_OFFLOAD) &&
+           (gnrc_pkt_len(ipv6) <= netif->ipv6.mtu);
+}
+
+static int _fill_ipv6_hdr(gnrc_netif_t *netif, gnrc_pktsnip_t *ipv6,
+                          bool loopback)
 {
     int res;
     ipv6_hdr_t *hdr = ipv6->data;
@@ -418,6 +465,11 @@ static int _fill_ipv6_hdr(gnrc_netif_t *netif, gnrc_pktsnip_t *ipv6)
         }
     }
 
+    if (_csum_offloaded(netif, ipv6, loopback)) {
+        DEBUG("ipv6: checksum is calculated by the device\n");
+        return 0;
+    }
+
     DEBUG("ipv6: write protect up to payload to calculate checksum\n");
     payload = ipv6;
     prev = ipv6;
@@ -446,9 +498,9 @@ static int _fill_ipv6_hdr(gnrc_netif_t *netif, gnrc_pktsnip_t *ipv6)
 }
 
 static bool _safe_fill_ipv6_hdr(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt,
-                                bool prep_hdr)
+                                bool prep_hdr, bool loopback)
 {
-    if (prep_hdr && (_fill_ipv6_hdr(netif, pkt) < 0)) {
+    if (prep_hdr && (_fill_ipv6_hdr(netif, pkt, loopback) < 0)) {
         /* error on filling up header */
         gnrc_pktbuf_release(pkt);
         return false;
@@ -505,7 +557,7 @@ static void _send_unicast(gnrc_pktsnip_t *pkt, bool prep_hdr,
     }
     netif = gnrc_netif_get_by_pid(gnrc_ipv6_nib_nc_get_iface(&nce));
     assert(netif != NULL);
-    if (_safe_fill_ipv6_hdr(netif, pkt, prep_hdr)) {
+    if (_safe_fill_ipv6_hdr(netif, pkt, prep_hdr, false)) {
         DEBUG("ipv6: add interface header to packet\n");
         if ((pkt = _create_netif_hdr(nce.l2addr, nce.l2addr_len, pkt,
                                      netif_hdr_flags)) == NULL) {
@@ -595,7 +647,7 @@ static void _send_multicast(gnrc_pktsnip_t *pkt, bool prep_hdr,
                         gnrc_pktbuf_release(pkt);
                         return;
                     }
-                    if (_fill_ipv6_hdr(netif, send_pkt) < 0) {
+                    if (_fill_ipv6_hdr(netif, send_pkt, false) < 0) {
                         /* error on filling up header */
                         if (send_pkt != pkt) {
                             gnrc_pktbuf_release(send_pkt);
@@ -609,7 +661,7 @@ static void _send_multicast(gnrc_pktsnip_t *pkt, bool prep_hdr,
             }
         }
         else {
-            if (_safe_fill_ipv6_hdr(netif, pkt, prep_hdr)) {
+            if (_safe_fill_ipv6_hdr(netif, pkt, prep_hdr, false)) {
                 _send_multicast_over_iface(pkt, prep_hdr, netif, netif_hdr_flags);
             }
         }
@@ -624,7 +676,7 @@ static void _send_multicast(gnrc_pktsnip_t *pkt, bool prep_hdr,
                 return;
             }
         }
-        if (_safe_fill_ipv6_hdr(netif, pkt, prep_hdr)) {
+        if (_safe_fill_ipv6_hdr(netif, pkt, prep_hdr, false)) {
             _send_multicast_over_iface(pkt, prep_hdr, netif, netif_hdr_flags);
         }
     }
@@ -633,7 +685,7 @@ static void _send_multicast(gnrc_pktsnip_t *pkt, bool prep_hdr,
 static void _send_to_self(gnrc_pktsnip_t *pkt, bool prep_hdr,
                           gnrc_netif_t *netif)
 {
-    if (!_safe_fill_ipv6_hdr(netif, pkt, prep_hdr) ||
+    if (!_safe_fill_ipv6_hdr(netif, pkt, prep_hdr, true) ||
         /* no netif header so we just merge the whole packet. */
         (gnrc_pktbuf_merge(pkt) != 0)) {
         DEBUG("ipv6: error looping packet to sender.\n");
@@ -725,6 +777,20 @@ static void _send(gnrc_pktsnip_t *pkt, bool prep_hdr)
 }
 
 /* functions for receiving */
+
+/* returns the UDP header if the packet is eligible for the flow cache */
+static inline const udp_hdr_t *_flowcache_udp_hdr(const ipv6_hdr_t *hdr,
+                                                  const void *payload,
+                                                  size_t payload_len)
+{
+    if (!IS_USED(MODULE_GNRC_IPV6_FLOWCACHE) || (hdr->nh != PROTNUM_UDP) ||
+        ipv6_addr_is_multicast(&hdr->dst) ||
+        (payload_len < sizeof(udp_hdr_t))) {
+        return NULL;
+    }
+    return payload;
+}
+
 static inline bool _pkt_not_for_me(gnrc_netif_t **netif, ipv6_hdr_t *hdr)
 {
     if (ipv6_addr_is_loopback(&hdr->dst)) {
@@ -745,7 +811,10 @@ static void _receive(gnrc_pktsnip_t *pkt)
     gnrc_netif_t *netif = NULL;
     gnrc_pktsnip_t *ipv6, *netif_hdr;
     ipv6_hdr_t *hdr;
+    const gnrc_ipv6_flowcache_entry_t *flow = NULL;
+    unsigned flow_version = 0;
     uint8_t first_nh;
+    bool nh_subs;
 
     assert(pkt != NULL);
 
@@ -771,8 +840,19 @@ static void _receive(gnrc_pktsnip_t *pkt)
         gnrc_pktbuf_release(pkt);
         return;
     }
+
+    const gnrc_netif_t *rx_netif = netif;
+    const udp_hdr_t *udp = _flowcache_udp_hdr(pkt->data,
+                                              (ipv6_hdr_t *)pkt->data + 1,
+                                              pkt->size - sizeof(ipv6_hdr_t));
+
+    if (udp != NULL) {
+        /* read before the lookups, in case they are to be cached */
+        flow_version = gnrc_ipv6_flowcache_version();
+        flow = gnrc_ipv6_flowcache_get(rx_netif, pkt->data, udp);
+    }
 #ifdef MODULE_GNRC_IPV6_WHITELIST
-    else if (!gnrc_ipv6_whitelisted(&((ipv6_hdr_t *)(pkt->data))->src)) {
+    if (!flow && !gnrc_ipv6_whitelisted(&((ipv6_hdr_t *)(pkt->data))->src)) {
         DEBUG("ipv6: Source address not whitelisted, dropping packet\n");
         gnrc_icmpv6_error_dst_unr_send(ICMPV6_ERROR_DST_UNR_PROHIB, pkt);
         gnrc_pktbuf_release(pkt);
@@ -780,15 +860,17 @@ static void _receive(gnrc_pktsnip_t *pkt)
     }
 #endif
 #ifdef MODULE_GNRC_IPV6_BLACKLIST
-    else if (gnrc_ipv6_blacklisted(&((ipv6_hdr_t *)(pkt->data))->src)) {
+    if (!flow && gnrc_ipv6_blacklisted(&((ipv6_hdr_t *)(pkt->data))->src)) {
         DEBUG("ipv6: Source address blacklisted, dropping packet\n");
         gnrc_icmpv6_error_dst_unr_send(ICMPV6_ERROR_DST_UNR_PROHIB, pkt);
         gnrc_pktbuf_release(pkt);
         return;
     }
 #endif
-    /* seize ipv6 as a temporary variable */
-    ipv6 = gnrc_pktbuf_start_write(pkt);
+    /* seize ipv6 as a temporary variable. Only the snip is changed by marking
+     * the header, so its data may stay shared with other receivers of the
+     * packet (e.g. for multicast) until something writes to it */
+    ipv6 = gnrc_pktbuf_start_write_desc(pkt);
 
     if (ipv6 == NULL) {
         DEBUG("ipv6: unable to get write access to packet, drop it\n");
@@ -855,7 +937,10 @@ static void _receive(gnrc_pktsnip_t *pkt)
               "consumed due to it\n");
         return;
     }
-    if (_pkt_not_for_me(&netif, hdr)) { /* if packet is not for me */
+    if (flow != NULL) {
+        netif = flow->netif;
+    }
+    else if (_pkt_not_for_me(&netif, hdr)) { /* if packet is not for me */
         DEBUG("ipv6: packet destination not this host\n");
 
 #ifdef MODULE_GNRC_IPV6_ROUTER    /* only routers redirect */
@@ -881,8 +966,18 @@ static void _receive(gnrc_pktsnip_t *pkt)
             gnrc_pktbuf_release(pkt);
             return;
         }
+        /* the hop limit is changed below, so the header must not be shared.
+         * ipv6 was marked above and has no other users, so this doesn't
+         * replace the snip */
+        else if (gnrc_pktbuf_start_write(ipv6) == NULL) {
+            DEBUG("ipv6: unable to get write access to IPv6 header, "
+                  "dropping packet\n");
+            gnrc_pktbuf_release(pkt);
+            return;
+        }
         /* TODO: check if receiving interface is router */
-        else if (--(hdr->hl) > 0) {  /* drop packets that *reach* Hop Limit 0 */
+        /* drop packets that *reach* Hop Limit 0 */
+        else if (--(((ipv6_hdr_t *)ipv6->data)->hl) > 0) {
             DEBUG("ipv6: forward packet to next hop\n");
 
             /* remove L2 headers around IPV6 */
@@ -917,7 +1012,18 @@ static void _receive(gnrc_pktsnip_t *pkt)
         DEBUG("ipv6: packet was consumed in extension header handling\n");
         return;
     }
-    _demux(netif, pkt, first_nh);
+    if (flow != NULL) {
+        nh_subs = flow->nh_subs;
+    }
+    else {
+        nh_subs = (gnrc_netreg_num(GNRC_NETTYPE_IPV6, first_nh) > 0);
+        /* the UDP header is the payload now */
+        if ((udp = _flowcache_udp_hdr(hdr, pkt->data, pkt->size)) != NULL) {
+            gnrc_ipv6_flowcache_add(flow_version, rx_netif, hdr, udp, netif,
+                                    nh_subs);
+        }
+    }
+    _demux(netif, pkt, first_nh, nh_subs);
 }
 
 /** @} */
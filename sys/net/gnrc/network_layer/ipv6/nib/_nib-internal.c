@@ -38,14 +38,59 @@ _nib_dr_entry_t *_prime_def_router = NULL;
 static clist_node_t _next_removable = { NULL };
 
 static _nib_onl_entry_t _nodes[CONFIG_GNRC_IPV6_NIB_NUMOF];
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_NC_HASH)
+#define _NODES_HASH_NUMOF   (1U << CONFIG_GNRC_IPV6_NIB_NC_HASH_BUCKETS_EXP)
+static _nib_onl_entry_t *_nodes_hash[_NODES_HASH_NUMOF];
+#endif  /* CONFIG_GNRC_IPV6_NIB_NC_HASH */
 static _nib_offl_entry_t _dsts[CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF];
 static _nib_dr_entry_t _def_routers[CONFIG_GNRC_IPV6_NIB_DEFAULT_ROUTER_NUMOF];
 
 #if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_MULTIHOP_P6C)
 static _nib_abr_entry_t _abrs[CONFIG_GNRC_IPV6_NIB_ABR_NUMOF];
 #endif  /* CONFIG_GNRC_IPV6_NIB_MULTIHOP_P6C */
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_FT_TRIE)
+/**
+ * @brief   Node of the forwarding table trie
+ *
+ * A node either carries the off-link entries with exactly its prefix
+ * (_nib_ft_trie_node_t::entries != NULL) or it is a glue node that joins two
+ * sub-tries diverging at bit _nib_ft_trie_node_t::pfx_len. Glue nodes always
+ * have two children, so there are less glue nodes than off-link entries.
+ * A node in the pool with neither entries nor children is free.
+ */
+typedef struct _nib_ft_trie_node {
+    struct _nib_ft_trie_node *child[2]; /**< sub-tries by next prefix bit */
+    _nib_offl_entry_t *entries;         /**< entries with this prefix */
+    ipv6_addr_t pfx;                    /**< prefix of this node */
+    uint8_t pfx_len;                    /**< length of _nib_ft_trie_node_t::pfx */
+} _nib_ft_trie_node_t;
+
+static _nib_ft_trie_node_t _ft_trie[2 * CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF];
+static _nib_ft_trie_node_t *_ft_trie_root;
+#endif  /* CONFIG_GNRC_IPV6_NIB_FT_TRIE */
 static rmutex_t _nib_mutex = RMUTEX_INIT;
 
+#if CONFIG_GNRC_IPV6_NIB_SNAPSHOT_NUMOF
+/**
+ * @brief   Result of a next hop lookup, valid while _nib_version is unchanged
+ */
+typedef struct {
+    ipv6_addr_t dst;            /**< destination looked up */
+    gnrc_ipv6_nib_nc_t nce;     /**< result of the lookup */
+    uint32_t version;           /**< value of _nib_version it is valid for */
+    unsigned iface;             /**< interface of the lookup, 0 for any */
+} _nib_snapshot_t;
+
+static _nib_snapshot_t _snapshots[CONFIG_GNRC_IPV6_NIB_SNAPSHOT_NUMOF];
+static unsigned _snapshot_next;
+/* incremented when the NIB is acquired and when it is released, so it is odd
+ * while the NIB is held and snapshots are only read while it is even */
+static uint32_t _nib_version;
+static uint8_t _nib_depth;
+/* the current critical section did not change the NIB */
+static bool _nib_unchanged;
+#endif  /* CONFIG_GNRC_IPV6_NIB_SNAPSHOT_NUMOF */
+
 static char addr_str[IPV6_ADDR_MAX_STR_LEN];
 
 evtimer_msg_t _nib_evtimer;
@@ -60,11 +105,18 @@ void _nib_init(void)
     _prime_def_router = NULL;
     _next_removable.next = NULL;
     memset(_nodes, 0, sizeof(_nodes));
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_NC_HASH)
+    memset(_nodes_hash, 0, sizeof(_nodes_hash));
+#endif  /* CONFIG_GNRC_IPV6_NIB_NC_HASH */
     memset(_def_routers, 0, sizeof(_def_routers));
     memset(_dsts, 0, sizeof(_dsts));
 #if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_MULTIHOP_P6C)
     memset(_abrs, 0, sizeof(_abrs));
 #endif  /* CONFIG_GNRC_IPV6_NIB_MULTIHOP_P6C */
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_FT_TRIE)
+    memset(_ft_trie, 0, sizeof(_ft_trie));
+    _ft_trie_root = NULL;
+#endif  /* CONFIG_GNRC_IPV6_NIB_FT_TRIE */
 #endif  /* TEST_SUITES */
     evtimer_init_msg(&_nib_evtimer);
     /* TODO: load ABR information from persistent memory */
@@ -73,13 +125,97 @@ void _nib_init(void)
 void _nib_acquire(void)
 {
     rmutex_lock(&_nib_mutex);
+#if CONFIG_GNRC_IPV6_NIB_SNAPSHOT_NUMOF
+    if (_nib_depth++ == 0) {
+        _nib_unchanged = false;
+        __atomic_store_n(&_nib_version, _nib_version + 1, __ATOMIC_RELAXED);
+        __atomic_thread_fence(__ATOMIC_RELEASE);
+    }
+#endif  /* CONFIG_GNRC_IPV6_NIB_SNAPSHOT_NUMOF */
 }
 
 void _nib_release(void)
 {
+#if CONFIG_GNRC_IPV6_NIB_SNAPSHOT_NUMOF
+    if (--_nib_depth == 0) {
+        uint32_t version = _nib_version + 1;
+
+        if (_nib_unchanged) {
+            /* carry the snapshots of the previous version over */
+            for (unsigned i = 0; i < CONFIG_GNRC_IPV6_NIB_SNAPSHOT_NUMOF; i++) {
+                if (_snapshots[i].version == version - 2) {
+                    _snapshots[i].version = version;
+                }
+            }
+        }
+        __atomic_store_n(&_nib_version, version, __ATOMIC_RELEASE);
+    }
+#endif  /* CONFIG_GNRC_IPV6_NIB_SNAPSHOT_NUMOF */
     rmutex_unlock(&_nib_mutex);
 }
 
+#if CONFIG_GNRC_IPV6_NIB_SNAPSHOT_NUMOF
+bool _nib_snapshot_get(const ipv6_addr_t *dst, unsigned iface,
+                       gnrc_ipv6_nib_nc_t *nce)
+{
+    uint32_t version = __atomic_load_n(&_nib_version, __ATOMIC_ACQUIRE);
+
+    /* version 0: no snapshot was taken yet */
+    if ((version & 1) || (version == 0)) {
+        return false;
+    }
+    for (unsigned i = 0; i < CONFIG_GNRC_IPV6_NIB_SNAPSHOT_NUMOF; i++) {
+        const _nib_snapshot_t *snapshot = &_snapshots[i];
+
+        if ((snapshot->version == version) && (snapshot->iface == iface) &&
+            ipv6_addr_equal(&snapshot->dst, dst)) {
+            *nce = snapshot->nce;
+            /* the copy is only valid if no writer started meanwhile */
+            __atomic_thread_fence(__ATOMIC_ACQUIRE);
+            return __atomic_load_n(&_nib_version, __ATOMIC_RELAXED) == version;
+        }
+    }
+    return false;
+}
+
+void _nib_snapshot_add(const ipv6_addr_t *dst, unsigned iface,
+                       const gnrc_ipv6_nib_nc_t *nce)
+{
+    /* valid from the next release on */
+    uint32_t version = _nib_version + 1;
+    _nib_snapshot_t *snapshot = NULL;
+
+    assert(_nib_depth > 0);
+    for (unsigned i = 0; i < CONFIG_GNRC_IPV6_NIB_SNAPSHOT_NUMOF; i++) {
+        if ((_snapshots[i].iface == iface) &&
+            ipv6_addr_equal(&_snapshots[i].dst, dst)) {
+            snapshot = &_snapshots[i];
+            break;
+        }
+    }
+    if (snapshot == NULL) {
+        /* replace round robin, stale snapshots first */
+        for (unsigned i = 0; i < CONFIG_GNRC_IPV6_NIB_SNAPSHOT_NUMOF; i++) {
+            if (_snapshots[i].version != version - 2) {
+                snapshot = &_snapshots[i];
+                break;
+            }
+        }
+        if (snapshot == NULL) {
+            snapshot = &_snapshots[_snapshot_next++];
+            if (_snapshot_next >= CONFIG_GNRC_IPV6_NIB_SNAPSHOT_NUMOF) {
+                _snapshot_next = 0;
+            }
+        }
+    }
+    snapshot->dst = *dst;
+    snapshot->nce = *nce;
+    snapshot->iface = iface;
+    snapshot->version = version;
+    _nib_unchanged = true;
+}
+#endif  /* CONFIG_GNRC_IPV6_NIB_SNAPSHOT_NUMOF */
+
 static inline bool _addr_equals(const ipv6_addr_t *addr,
                                 const _nib_onl_entry_t *node)
 {
@@ -87,6 +223,38 @@ static inline bool _addr_equals(const ipv6_addr_t *addr,
            (ipv6_addr_equal(addr, &node->ipv6));
 }
 
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_NC_HASH)
+static inline _nib_onl_entry_t **_nodes_bucket(const ipv6_addr_t *addr)
+{
+    /* link-local and global addresses of a neighbor usually share the IID */
+    uint32_t hash = addr->u32[2].u32 ^ addr->u32[3].u32;
+
+    hash ^= hash >> 16;
+    hash ^= hash >> 8;
+    return &_nodes_hash[hash & (_NODES_HASH_NUMOF - 1)];
+}
+
+void _nib_onl_hash_remove(_nib_onl_entry_t *node)
+{
+    for (_nib_onl_entry_t **ptr = _nodes_bucket(&node->ipv6); *ptr != NULL;
+         ptr = &(*ptr)->hash_next) {
+        if (*ptr == node) {
+            *ptr = node->hash_next;
+            node->hash_next = NULL;
+            return;
+        }
+    }
+}
+
+void _nib_onl_hash_insert(_nib_onl_entry_t *node)
+{
+    _nib_onl_entry_t **bucket = _nodes_bucket(&node->ipv6);
+
+    node->hash_next = *bucket;
+    *bucket = node;
+}
+#endif  /* CONFIG_GNRC_IPV6_NIB_NC_HASH */
+
 _nib_onl_entry_t *_nib_onl_alloc(const ipv6_addr_t *addr, unsigned iface)
 {
     _nib_onl_entry_t *node = NULL;
@@ -214,24 +382,47 @@ _nib_onl_entry_t *_nib_onl_iter(const _nib_onl_entry_t *last)
     return NULL;
 }
 
+static inline bool _onl_get_matches(const _nib_onl_entry_t *node,
+                                    const ipv6_addr_t *addr, unsigned iface)
+{
+    return (node->mode != _EMPTY) &&
+           /* either requested or current interface undefined or
+            * interfaces equal */
+           ((_nib_onl_get_if(node) == 0) || (iface == 0) ||
+            (_nib_onl_get_if(node) == iface)) &&
+           ipv6_addr_equal(&node->ipv6, addr);
+}
+
 _nib_onl_entry_t *_nib_onl_get(const ipv6_addr_t *addr, unsigned iface)
 {
     assert(addr != NULL);
     DEBUG("nib: Getting on-link node entry (addr = %s, iface = %u)\n",
           ipv6_addr_to_str(addr_str, addr, sizeof(addr_str)), iface);
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_NC_HASH)
+    _nib_onl_entry_t *res = NULL;
+
+    for (_nib_onl_entry_t *node = *_nodes_bucket(addr); node != NULL;
+         node = node->hash_next) {
+        /* keep the table order for entries on different interfaces */
+        if (_onl_get_matches(node, addr, iface) &&
+            ((res == NULL) || (node < res))) {
+            res = node;
+        }
+    }
+    if (res != NULL) {
+        DEBUG("  Found %p\n", (void *)res);
+        return res;
+    }
+#else   /* CONFIG_GNRC_IPV6_NIB_NC_HASH */
     for (unsigned i = 0; i < CONFIG_GNRC_IPV6_NIB_NUMOF; i++) {
         _nib_onl_entry_t *node = &_nodes[i];
 
-        if ((node->mode != _EMPTY) &&
-            /* either requested or current interface undefined or
-             * interfaces equal */
-            ((_nib_onl_get_if(node) == 0) || (iface == 0) ||
-             (_nib_onl_get_if(node) == iface)) &&
-            ipv6_addr_equal(&node->ipv6, addr)) {
+        if (_onl_get_matches(node, addr, iface)) {
             DEBUG("  Found %p\n", (void *)node);
             return node;
         }
     }
+#endif  /* CONFIG_GNRC_IPV6_NIB_NC_HASH */
     DEBUG("  No suitable entry found\n");
     return NULL;
 }
@@ -467,6 +658,132 @@ void _nib_drl_ft_get(const _nib_dr_entry_t *drl, gnrc_ipv6_nib_ft_t *fte)
     fte->iface = _nib_onl_get_if(drl->next_hop);
 }
 
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_FT_TRIE)
+static inline unsigned _ft_trie_bit(const ipv6_addr_t *addr, unsigned pos)
+{
+    return (addr->u8[pos / 8] >> (7 - (pos % 8))) & 1;
+}
+
+static _nib_ft_trie_node_t *_ft_trie_node_alloc(const ipv6_addr_t *pfx,
+                                                unsigned pfx_len)
+{
+    for (unsigned i = 0; i < ARRAY_SIZE(_ft_trie); i++) {
+        _nib_ft_trie_node_t *node = &_ft_trie[i];
+
+        if ((node->entries == NULL) && (node->child[0] == NULL) &&
+            (node->child[1] == NULL)) {
+            ipv6_addr_init_prefix(&node->pfx, pfx, pfx_len);
+            node->pfx_len = pfx_len;
+            return node;
+        }
+    }
+    return NULL;
+}
+
+static void _ft_trie_node_free(_nib_ft_trie_node_t *node)
+{
+    memset(node, 0, sizeof(*node));
+}
+
+static void _ft_trie_insert(_nib_offl_entry_t *dst)
+{
+    _nib_ft_trie_node_t **link = &_ft_trie_root;
+    _nib_ft_trie_node_t *node;
+
+    while ((node = *link) != NULL) {
+        unsigned common = ipv6_addr_match_prefix(&node->pfx, &dst->pfx);
+
+        common = (common > node->pfx_len) ? node->pfx_len : common;
+        common = (common > dst->pfx_len) ? dst->pfx_len : common;
+        if (common == node->pfx_len) {
+            if (node->pfx_len == dst->pfx_len) {
+                break;
+            }
+            /* node's prefix covers dst's prefix => descend */
+            link = &node->child[_ft_trie_bit(&dst->pfx, node->pfx_len)];
+            continue;
+        }
+        /* dst's prefix diverges from node's prefix before its end =>
+         * new node has to be inserted above node */
+        _nib_ft_trie_node_t *new = _ft_trie_node_alloc(&dst->pfx, common);
+
+        /* pool under-run is impossible, as there are at most two nodes per
+         * off-link entry */
+        assert(new != NULL);
+        new->child[_ft_trie_bit(&node->pfx, common)] = node;
+        if (common < dst->pfx_len) {
+            /* new is a glue node, dst gets its own node on the other side */
+            _nib_ft_trie_node_t *leaf = _ft_trie_node_alloc(&dst->pfx,
+                                                            dst->pfx_len);
+
+            assert(leaf != NULL);
+            new->child[_ft_trie_bit(&dst->pfx, common)] = leaf;
+            *link = new;
+            node = leaf;
+        }
+        else {
+            *link = new;
+            node = new;
+        }
+        break;
+    }
+    if (node == NULL) {
+        node = _ft_trie_node_alloc(&dst->pfx, dst->pfx_len);
+        assert(node != NULL);
+        *link = node;
+    }
+    dst->trie_next = node->entries;
+    node->entries = dst;
+}
+
+static void _ft_trie_remove(_nib_offl_entry_t *dst)
+{
+    _nib_ft_trie_node_t **parent_link = NULL;
+    _nib_ft_trie_node_t **link = &_ft_trie_root;
+    _nib_ft_trie_node_t *node;
+
+    while (((node = *link) != NULL) && (node->pfx_len < dst->pfx_len)) {
+        parent_link = link;
+        link = &node->child[_ft_trie_bit(&dst->pfx, node->pfx_len)];
+    }
+    if ((node == NULL) || (node->pfx_len != dst->pfx_len)) {
+        return;
+    }
+    _nib_offl_entry_t **ptr = &node->entries;
+
+    while ((*ptr != NULL) && (*ptr != dst)) {
+        ptr = &(*ptr)->trie_next;
+    }
+    if (*ptr == NULL) {
+        return;
+    }
+    *ptr = dst->trie_next;
+    dst->trie_next = NULL;
+    if ((node->entries != NULL) ||
+        ((node->child[0] != NULL) && (node->child[1] != NULL))) {
+        /* node still carries entries or is needed as glue */
+        return;
+    }
+    if ((node->child[0] != NULL) || (node->child[1] != NULL)) {
+        *link = (node->child[0] != NULL) ? node->child[0] : node->child[1];
+        _ft_trie_node_free(node);
+        return;
+    }
+    *link = NULL;
+    _ft_trie_node_free(node);
+    if (parent_link != NULL) {
+        _nib_ft_trie_node_t *parent = *parent_link;
+
+        if (parent->entries == NULL) {
+            /* parent was a glue node and has only one child left */
+            *parent_link = (parent->child[0] != NULL) ? parent->child[0]
+                                                      : parent->child[1];
+            _ft_trie_node_free(parent);
+        }
+    }
+}
+#endif  /* CONFIG_GNRC_IPV6_NIB_FT_TRIE */
+
 _nib_offl_entry_t *_nib_offl_alloc(const ipv6_addr_t *next_hop, unsigned iface,
                                    const ipv6_addr_t *pfx, unsigned pfx_len)
 {
@@ -493,7 +810,13 @@ _nib_offl_entry_t *_nib_offl_alloc(const ipv6_addr_t *next_hop, unsigned iface,
             /* exact match (or next hop address was previously unset) */
             DEBUG("  %p is an exact match\n", (void *)tmp);
             if (next_hop != NULL) {
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_NC_HASH)
+                _nib_onl_hash_remove(tmp_node);
+#endif  /* CONFIG_GNRC_IPV6_NIB_NC_HASH */
                 memcpy(&tmp_node->ipv6, next_hop, sizeof(tmp_node->ipv6));
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_NC_HASH)
+                _nib_onl_hash_insert(tmp_node);
+#endif  /* CONFIG_GNRC_IPV6_NIB_NC_HASH */
             }
             tmp->next_hop->mode |= _DST;
             return tmp;
@@ -514,6 +837,9 @@ _nib_offl_entry_t *_nib_offl_alloc(const ipv6_addr_t *next_hop, unsigned iface,
         dst->next_hop->mode |= _DST;
         ipv6_addr_init_prefix(&dst->pfx, pfx, pfx_len);
         dst->pfx_len = pfx_len;
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_FT_TRIE)
+        _ft_trie_insert(dst);
+#endif  /* CONFIG_GNRC_IPV6_NIB_FT_TRIE */
     }
     return dst;
 }
@@ -550,6 +876,9 @@ void _nib_offl_clear(_nib_offl_entry_t *dst)
             dst->next_hop->mode &= ~(_DST);
             _nib_onl_clear(dst->next_hop);
         }
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_FT_TRIE)
+        _ft_trie_remove(dst);
+#endif  /* CONFIG_GNRC_IPV6_NIB_FT_TRIE */
         memset(dst, 0, sizeof(_nib_offl_entry_t));
     }
 }
@@ -573,6 +902,39 @@ bool _nib_offl_is_entry(const _nib_offl_entry_t *entry)
     return (entry >= _dsts) && _in_dsts(entry);
 }
 
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_FT_TRIE)
+static _nib_offl_entry_t *_nib_offl_get_match(const ipv6_addr_t *dst)
+{
+    _nib_offl_entry_t *res = NULL;
+
+    DEBUG("nib: get match for destination %s from NIB trie\n",
+          ipv6_addr_to_str(addr_str, dst, sizeof(addr_str)));
+    for (const _nib_ft_trie_node_t *node = _ft_trie_root; node != NULL;
+         node = node->child[_ft_trie_bit(dst, node->pfx_len)]) {
+        if (ipv6_addr_match_prefix(&node->pfx, dst) < node->pfx_len) {
+            break;
+        }
+        /* keep the table order among entries with the same prefix */
+        _nib_offl_entry_t *match = NULL;
+        for (_nib_offl_entry_t *entry = node->entries; entry != NULL;
+             entry = entry->trie_next) {
+            if ((entry->mode != _EMPTY) && ((match == NULL) || (entry < match))) {
+                match = entry;
+            }
+        }
+        if (match != NULL) {
+            DEBUG("nib: best match so far %s/%u\n",
+                  ipv6_addr_to_str(addr_str, &match->pfx, sizeof(addr_str)),
+                  match->pfx_len);
+            res = match;
+        }
+        if (node->pfx_len == IPV6_ADDR_BIT_LEN) {
+            break;
+        }
+    }
+    return res;
+}
+#else   /* CONFIG_GNRC_IPV6_NIB_FT_TRIE */
 static _nib_offl_entry_t *_nib_offl_get_match(const ipv6_addr_t *dst)
 {
     _nib_offl_entry_t *res = NULL;
@@ -601,6 +963,7 @@ static _nib_offl_entry_t *_nib_offl_get_match(const ipv6_addr_t *dst)
     }
     return res;
 }
+#endif  /* CONFIG_GNRC_IPV6_NIB_FT_TRIE */
 
 void _nib_ft_get(const _nib_offl_entry_t *dst, gnrc_ipv6_nib_ft_t *fte)
 {
@@ -857,10 +1220,16 @@ static void _override_node(const ipv6_addr_t *addr, unsigned iface,
                            _nib_onl_entry_t *node)
 {
     _nib_onl_clear(node);
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_NC_HASH)
+    _nib_onl_hash_remove(node);
+#endif  /* CONFIG_GNRC_IPV6_NIB_NC_HASH */
     if (addr != NULL) {
         memcpy(&node->ipv6, addr, sizeof(node->ipv6));
     }
     _nib_onl_set_if(node, iface);
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_NC_HASH)
+    _nib_onl_hash_insert(node);
+#endif  /* CONFIG_GNRC_IPV6_NIB_NC_HASH */
 }
 
 static inline bool _node_unreachable(_nib_onl_entry_t *node)
@@ -875,21 +1244,32 @@ static inline bool _node_unreachable(_nib_onl_entry_t *node)
     }
 }
 
+typedef struct {
+    const void *ctx;
+    uint32_t offset;
+    uint16_t type;
+} _lookup_t;
+
+static int _lookup_cb(evtimer_event_t *ev, uint32_t remaining, void *arg)
+{
+    evtimer_msg_event_t *event = (evtimer_msg_event_t *)ev;
+    _lookup_t *lookup = arg;
+
+    if ((event->msg.type == lookup->type) &&
+        ((lookup->ctx == NULL) || (event->msg.content.ptr == lookup->ctx)) &&
+        (remaining < lookup->offset)) {
+        lookup->offset = remaining;
+    }
+    return 0;
+}
+
 uint32_t _evtimer_lookup(const void *ctx, uint16_t type)
 {
-    evtimer_msg_event_t *event = (evtimer_msg_event_t *)_nib_evtimer.events;
-    uint32_t offset = 0;
+    _lookup_t lookup = { .ctx = ctx, .offset = UINT32_MAX, .type = type };
 
     DEBUG("nib: lookup ctx = %p, type = %04x\n", (void *)ctx, type);
-    while (event != NULL) {
-        offset += event->event.offset;
-        if ((event->msg.type == type) &&
-            ((ctx == NULL) || (event->msg.content.ptr == ctx))) {
-            return offset;
-        }
-        event = (evtimer_msg_event_t *)event->event.next;
-    }
-    return UINT32_MAX;
+    evtimer_foreach((evtimer_t *)&_nib_evtimer, _lookup_cb, &lookup);
+    return lookup.offset;
 }
 
 /** @} */
@@ -93,6 +93,14 @@ extern "C" {
  */
 typedef struct _nib_onl_entry {
     struct _nib_onl_entry *next;        /**< next removable entry */
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_NC_HASH) || defined(DOXYGEN)
+    /**
+     * @brief   next entry in the same bucket of the address hash index
+     *
+     * @note    Only available if @ref CONFIG_GNRC_IPV6_NIB_NC_HASH != 0.
+     */
+    struct _nib_onl_entry *hash_next;
+#endif
 #if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_QUEUE_PKT) || defined(DOXYGEN)
     /**
      * @brief   queue for packets currently in address resolution
@@ -196,7 +204,7 @@ typedef struct {
 /**
  * @brief   Off-link NIB entry
  */
-typedef struct {
+typedef struct _nib_offl_entry {
     _nib_onl_entry_t *next_hop; /**< next hop to destination */
     ipv6_addr_t pfx;            /**< prefix to the destination */
     /**
@@ -218,6 +226,14 @@ typedef struct {
                                      valid (UINT32_MAX means forever) */
     uint32_t pref_until;        /**< timestamp (in ms) until which the prefix
                                      preferred (UINT32_MAX means forever) */
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_FT_TRIE) || defined(DOXYGEN)
+    /**
+     * @brief   Next entry with the same prefix in the forwarding table trie
+     *
+     * @note    Only available with @ref CONFIG_GNRC_IPV6_NIB_FT_TRIE
+     */
+    struct _nib_offl_entry *trie_next;
+#endif
 } _nib_offl_entry_t;
 
 /**
@@ -273,6 +289,46 @@ void _nib_acquire(void);
  */
 void _nib_release(void);
 
+#if CONFIG_GNRC_IPV6_NIB_SNAPSHOT_NUMOF || defined(DOXYGEN)
+/**
+ * @brief   Gets the result of a previous next hop lookup without acquiring
+ *          the NIB
+ *
+ * Snapshots are only valid until the NIB is changed. Readers copy them
+ * optimistically and check afterwards that no critical section started in
+ * between, so they never block.
+ *
+ * @note    Only available if @ref CONFIG_GNRC_IPV6_NIB_SNAPSHOT_NUMOF > 0.
+ *
+ * @param[in] dst       Destination address.
+ * @param[in] iface     Interface of the lookup, 0 for any.
+ * @param[out] nce      Neighbor cache entry of the next hop.
+ *
+ * @return  true, if a valid snapshot of the lookup was found.
+ * @return  false, if the lookup must take the slow path.
+ */
+bool _nib_snapshot_get(const ipv6_addr_t *dst, unsigned iface,
+                       gnrc_ipv6_nib_nc_t *nce);
+
+/**
+ * @brief   Stores the result of a next hop lookup as snapshot
+ *
+ * The snapshot becomes valid when the NIB is released. The caller asserts
+ * that the current critical section did not change the NIB, so the other
+ * snapshots are kept valid as well.
+ *
+ * @pre The NIB is acquired.
+ *
+ * @note    Only available if @ref CONFIG_GNRC_IPV6_NIB_SNAPSHOT_NUMOF > 0.
+ *
+ * @param[in] dst       Destination address.
+ * @param[in] iface     Interface of the lookup, 0 for any.
+ * @param[in] nce       Neighbor cache entry of the next hop.
+ */
+void _nib_snapshot_add(const ipv6_addr_t *dst, unsigned iface,
+                       const gnrc_ipv6_nib_nc_t *nce);
+#endif  /* CONFIG_GNRC_IPV6_NIB_SNAPSHOT_NUMOF */
+
 /**
  * @brief   Gets interface identifier from a NIB entry
  *
@@ -311,6 +367,30 @@ static inline void _nib_onl_set_if(_nib_onl_entry_t *node, unsigned iface)
  */
 _nib_onl_entry_t *_nib_onl_alloc(const ipv6_addr_t *addr, unsigned iface);
 
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_NC_HASH) || defined(DOXYGEN)
+/**
+ * @brief   Removes an on-link entry from the address hash index
+ *
+ * Must be called before _nib_onl_entry_t::ipv6 of an entry is changed.
+ *
+ * @note    Only available if @ref CONFIG_GNRC_IPV6_NIB_NC_HASH != 0.
+ *
+ * @param[in] node  An entry. May not be in the index.
+ */
+void _nib_onl_hash_remove(_nib_onl_entry_t *node);
+
+/**
+ * @brief   Adds an on-link entry to the address hash index
+ *
+ * Must be called after _nib_onl_entry_t::ipv6 of an entry was changed.
+ *
+ * @note    Only available if @ref CONFIG_GNRC_IPV6_NIB_NC_HASH != 0.
+ *
+ * @param[in] node  An entry that is not in the index.
+ */
+void _nib_onl_hash_insert(_nib_onl_entry_t *node);
+#endif  /* CONFIG_GNRC_IPV6_NIB_NC_HASH */
+
 /**
  * @brief   Clears out a NIB entry (on-link version)
  *
@@ -322,6 +402,9 @@ _nib_onl_entry_t *_nib_onl_alloc(const ipv6_addr_t *addr, unsigned iface);
 static inline bool _nib_onl_clear(_nib_onl_entry_t *node)
 {
     if (node->mode == _EMPTY) {
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_NC_HASH)
+        _nib_onl_hash_remove(node);
+#endif  /* CONFIG_GNRC_IPV6_NIB_NC_HASH */
         memset(node, 0, sizeof(_nib_onl_entry_t));
         return true;
     }
@@ -90,16 +90,18 @@ static void _handle_rdnss_timeout(sock_udp_ep_t *dns_server);
 #endif
 /** @} */
 
-void gnrc_ipv6_nib_init(void)
+static int _del_event(evtimer_event_t *event, uint32_t remaining, void *arg)
 {
-    evtimer_event_t *tmp;
+    (void)remaining;
+    (void)arg;
+    evtimer_del((evtimer_t *)(&_nib_evtimer), event);
+    return 0;
+}
 
+void gnrc_ipv6_nib_init(void)
+{
     _nib_acquire();
-    for (evtimer_event_t *ptr = _nib_evtimer.events;
-         (ptr != NULL) && (tmp = (ptr->next), 1);
-         ptr = tmp) {
-        evtimer_del((evtimer_t *)(&_nib_evtimer), ptr);
-    }
+    evtimer_foreach((evtimer_t *)(&_nib_evtimer), _del_event, NULL);
     _nib_init();
     _nib_release();
 }
@@ -253,6 +255,14 @@ int gnrc_ipv6_nib_get_next_hop_l2addr(const ipv6_addr_t *dst,
                                       gnrc_ipv6_nib_nc_t *nce)
 {
     int res = 0;
+#if CONFIG_GNRC_IPV6_NIB_SNAPSHOT_NUMOF
+    unsigned req_iface = (netif != NULL) ? (unsigned)netif->pid : 0U;
+    bool cacheable = true;
+
+    if (_nib_snapshot_get(dst, req_iface, nce)) {
+        return 0;
+    }
+#endif  /* CONFIG_GNRC_IPV6_NIB_SNAPSHOT_NUMOF */
 
     DEBUG("nib: get next hop link-layer address of %s%%%u\n",
           ipv6_addr_to_str(addr_str, dst, sizeof(addr_str)),
@@ -335,6 +345,14 @@ int gnrc_ipv6_nib_get_next_hop_l2addr(const ipv6_addr_t *dst,
             node = _nib_onl_nc_get(&route.next_hop,
                                    (netif != NULL) ? netif->pid : 0);
             if (_resolve_addr(&route.next_hop, netif, pkt, nce, node)) {
+#if CONFIG_GNRC_IPV6_NIB_SNAPSHOT_NUMOF
+                /* the route notification and the destination cache must
+                 * see every lookup */
+                cacheable = !IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_DC);
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_ROUTER)
+                cacheable = cacheable && (netif->ipv6.route_info_cb == NULL);
+#endif  /* CONFIG_GNRC_IPV6_NIB_ROUTER */
+#endif  /* CONFIG_GNRC_IPV6_NIB_SNAPSHOT_NUMOF */
                 _call_route_info_cb(netif,
                                     GNRC_IPV6_NIB_ROUTE_INFO_TYPE_RN,
                                     &route.dst,
@@ -350,6 +368,18 @@ int gnrc_ipv6_nib_get_next_hop_l2addr(const ipv6_addr_t *dst,
             }
         }
     } while (0);
+#if CONFIG_GNRC_IPV6_NIB_SNAPSHOT_NUMOF
+    /* only a next hop that is reachable was looked up without changing the
+     * NIB, e.g. by a transition from STALE to DELAY */
+    if ((res == 0) && cacheable &&
+        (!IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_ARSM) ||
+         (gnrc_ipv6_nib_nc_get_nud_state(nce) ==
+          GNRC_IPV6_NIB_NC_INFO_NUD_STATE_REACHABLE) ||
+         (gnrc_ipv6_nib_nc_get_nud_state(nce) ==
+          GNRC_IPV6_NIB_NC_INFO_NUD_STATE_UNMANAGED))) {
+        _nib_snapshot_add(dst, req_iface, nce);
+    }
+#endif  /* CONFIG_GNRC_IPV6_NIB_SNAPSHOT_NUMOF */
     _nib_release();
     gnrc_netif_release(netif);
     return res;
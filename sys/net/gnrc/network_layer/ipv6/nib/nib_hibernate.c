@@ -0,0 +1,108 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ * @brief   Keeps the neighbor cache with @ref sys_hibernate
+ *
+ * Only entries with a link-layer address are kept. Managed entries are
+ * restored as STALE, so they are used right away and verified by neighbor
+ * unreachability detection on first use, as their timers are lost.
+ */
+
+#include <string.h>
+#include <kernel_defines.h>
+
+#include "net/gnrc/ipv6/nib/nc.h"
+
+#include "_nib-internal.h"
+
+#if IS_USED(MODULE_HIBERNATE) && IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_ARSM)
+#include "hibernate.h"
+
+typedef struct {
+    ipv6_addr_t ipv6;
+    uint8_t l2addr[CONFIG_GNRC_IPV6_NIB_L2ADDR_MAX_LEN];
+    uint8_t l2addr_len;
+    uint8_t iface;
+    uint8_t unmanaged;
+} _nc_state_t;
+
+static int _save(hibernate_t *h)
+{
+    _nib_onl_entry_t *node = NULL;
+    int res = 0;
+
+    _nib_acquire();
+    while ((node = _nib_onl_iter(node)) != NULL) {
+        unsigned nud = node->info & GNRC_IPV6_NIB_NC_INFO_NUD_STATE_MASK;
+
+        if (!(node->mode & _NC) || (node->l2addr_len == 0) ||
+            (nud == GNRC_IPV6_NIB_NC_INFO_NUD_STATE_UNREACHABLE) ||
+            (nud == GNRC_IPV6_NIB_NC_INFO_NUD_STATE_INCOMPLETE)) {
+            continue;
+        }
+
+        _nc_state_t state = {
+            .ipv6 = node->ipv6,
+            .l2addr_len = node->l2addr_len,
+            .iface = _nib_onl_get_if(node),
+            .unmanaged = (nud == GNRC_IPV6_NIB_NC_INFO_NUD_STATE_UNMANAGED),
+        };
+        memcpy(state.l2addr, node->l2addr, node->l2addr_len);
+        if ((res = hibernate_write(h, &state, sizeof(state))) < 0) {
+            break;
+        }
+    }
+    _nib_release();
+    return res;
+}
+
+static void _restore(hibernate_t *h)
+{
+    _nc_state_t state;
+
+    _nib_acquire();
+    while (hibernate_read(h, &state, sizeof(state)) == 0) {
+        uint16_t cstate = state.unmanaged
+                        ? GNRC_IPV6_NIB_NC_INFO_NUD_STATE_UNMANAGED
+                        : GNRC_IPV6_NIB_NC_INFO_NUD_STATE_STALE;
+
+        if ((state.l2addr_len > CONFIG_GNRC_IPV6_NIB_L2ADDR_MAX_LEN) ||
+            (state.iface == 0)) {
+            continue;
+        }
+
+        _nib_onl_entry_t *node = _nib_nc_add(&state.ipv6, state.iface, cstate);
+        if (node == NULL) {
+            break;
+        }
+        memcpy(node->l2addr, state.l2addr, state.l2addr_len);
+        node->l2addr_len = state.l2addr_len;
+        node->info &= ~(GNRC_IPV6_NIB_NC_INFO_AR_STATE_MASK |
+                        GNRC_IPV6_NIB_NC_INFO_NUD_STATE_MASK);
+        node->info |= cstate;
+        if (state.unmanaged) {
+            node->info |= GNRC_IPV6_NIB_NC_INFO_AR_STATE_MANUAL;
+        }
+    }
+    _nib_release();
+}
+
+HIBERNATE_STATE(gnrc_ipv6_nib_nc) = {
+    .id = HIBERNATE_ID_GNRC_IPV6_NIB_NC,
+    .save = _save,
+    .restore = _restore,
+};
+#else
+typedef int dont_be_pedantic;
+#endif
+
+/** @} */
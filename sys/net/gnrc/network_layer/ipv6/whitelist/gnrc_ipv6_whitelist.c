@@ -17,6 +17,7 @@
 #include "bitfield.h"
 
 #include "net/gnrc/ipv6/whitelist.h"
+#include "net/gnrc/ipv6/flowcache.h"
 
 #define ENABLE_DEBUG 0
 #include "debug.h"
@@ -45,6 +46,10 @@ void gnrc_ipv6_whitelist_del(const ipv6_addr_t *addr)
     for (int i = 0; i < CONFIG_GNRC_IPV6_WHITELIST_SIZE; i++) {
         if (ipv6_addr_equal(addr, &gnrc_ipv6_whitelist[i])) {
             bf_unset(gnrc_ipv6_whitelist_set, i);
+            if (IS_USED(MODULE_GNRC_IPV6_FLOWCACHE)) {
+                /* cached flows may come from this address */
+                gnrc_ipv6_flowcache_flush();
+            }
             DEBUG("IPv6 whitelist: unwhitelisted %s\n",
                   ipv6_addr_to_str(addr_str, addr, sizeof(addr_str)));
         }
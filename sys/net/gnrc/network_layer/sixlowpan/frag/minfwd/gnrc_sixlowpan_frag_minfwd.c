@@ -86,6 +86,50 @@ int gnrc_sixlowpan_frag_minfwd_forward(gnrc_pktsnip_t *pkt,
     return 0;
 }
 
+int gnrc_sixlowpan_frag_minfwd_forward_in_place(gnrc_pktsnip_t *pkt,
+                                                gnrc_sixlowpan_frag_vrb_t *vrbe,
+                                                unsigned page)
+{
+    gnrc_pktsnip_t *netif;
+    gnrc_netif_hdr_t *netif_hdr;
+    sixlowpan_frag_t *frag;
+    size_t netif_hdr_size;
+
+    assert(vrbe != NULL);
+    assert(pkt != NULL);
+    netif = pkt->next;
+    frag = pkt->data;
+    netif_hdr_size = sizeof(gnrc_netif_hdr_t) + vrbe->super.dst_len;
+    if ((netif == NULL) || (netif->type != GNRC_NETTYPE_NETIF) ||
+        (netif->next != NULL) || (pkt->users > 1) || (netif->users > 1) ||
+        (netif->size < netif_hdr_size)) {
+        DEBUG("6lo minfwd: can't forward fragment in place\n");
+        return -ENOTSUP;
+    }
+    assert(sixlowpan_frag_is(frag));
+    frag->tag = byteorder_htons(vrbe->out_tag);
+    netif_hdr = netif->data;
+    gnrc_netif_hdr_init(netif_hdr, 0, vrbe->super.dst_len);
+    gnrc_netif_hdr_set_dst_addr(netif_hdr, vrbe->super.dst, vrbe->super.dst_len);
+    gnrc_netif_hdr_set_netif(netif_hdr, vrbe->out_netif);
+    /* shrinking never moves the data, so this can't fail */
+    gnrc_pktbuf_realloc_data(netif, netif_hdr_size);
+    if (_is_last_frag(vrbe)) {
+        DEBUG("6lo minfwd: current_size (%u) >= datagram_size (%u)\n",
+              vrbe->super.current_size, vrbe->super.datagram_size);
+        gnrc_sixlowpan_frag_vrb_rm(vrbe);
+    }
+    else {
+        netif_hdr->flags |= GNRC_NETIF_HDR_FLAGS_MORE_DATA;
+    }
+    /* received packets are in reverse order, so put network interface header
+     * in front for sending */
+    pkt->next = NULL;
+    netif->next = pkt;
+    gnrc_sixlowpan_dispatch_send(netif, NULL, page);
+    return 0;
+}
+
 int gnrc_sixlowpan_frag_minfwd_frag_iphc(gnrc_pktsnip_t *pkt,
                                          size_t orig_datagram_size,
                                          const ipv6_addr_t *ipv6_dst,
@@ -59,10 +59,26 @@
 #endif  /* IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_MINFWD) */
 #endif
 
+/**
+ * @brief   Number of slots in the (source, tag) index of the reassembly buffer
+ */
+#define RBUF_IDX_SIZE   (2 * CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE)
+
 static gnrc_sixlowpan_frag_rb_int_t rbuf_int[RBUF_INT_SIZE];
 
 static gnrc_sixlowpan_frag_rb_t rbuf[CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE];
 
+/* Index from a hash of (source address, tag) to the reassembly buffer entry
+ * created last for that hash. It is only a hint: entries are neither removed
+ * from it nor protected against collisions, so hits are verified and misses
+ * fall back to scanning the whole buffer. */
+static uint8_t rbuf_idx[RBUF_IDX_SIZE];
+static_assert(CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE <= UINT8_MAX,
+              "reassembly buffer too large for rbuf_idx");
+
+/* position in rbuf_int to start searching for a free interval from */
+static unsigned rbuf_int_next;
+
 static char l2addr_str[3 * IEEE802154_LONG_ADDRESS_LEN];
 
 static xtimer_t _gc_timer;
@@ -180,6 +196,44 @@ void gnrc_sixlowpan_frag_rb_rm_by_datagram(const gnrc_netif_hdr_t *netif_hdr,
     }
 }
 
+static unsigned _rbuf_idx_hash(const uint8_t *src, size_t src_len,
+                               uint16_t tag)
+{
+    unsigned hash = tag;
+
+    /* the last bytes of the L2 address differ most between neighbors */
+    for (size_t i = 0; i < src_len; i++) {
+        hash = (hash * 31) + src[i];
+    }
+    return hash % RBUF_IDX_SIZE;
+}
+
+static inline bool _rbuf_match(const gnrc_sixlowpan_frag_rb_t *e,
+                               const uint8_t *src, size_t src_len,
+                               const uint8_t *dst, size_t dst_len,
+                               uint16_t tag)
+{
+    return (e->pkt != NULL) && (e->super.tag == tag) &&
+           (e->super.src_len == src_len) &&
+           (e->super.dst_len == dst_len) &&
+           (memcmp(e->super.src, src, src_len) == 0) &&
+           (memcmp(e->super.dst, dst, dst_len) == 0);
+}
+
+static inline bool _rbuf_is_datagram(const gnrc_sixlowpan_frag_rb_t *e,
+                                     const uint8_t *src, size_t src_len,
+                                     const uint8_t *dst, size_t dst_len,
+                                     size_t size, uint16_t tag)
+{
+    return _rbuf_match(e, src, src_len, dst, dst_len, tag) &&
+           ((IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_SFR) &&
+             /* not all SFR fragments carry the datagram size, so make 0 a
+              * legal value to not compare datagram size */
+             ((size == 0) || (e->super.datagram_size == size))) ||
+            (!IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_SFR) &&
+             (e->super.datagram_size == size)));
+}
+
 static gnrc_sixlowpan_frag_rb_t *_rbuf_get_by_tag(const gnrc_netif_hdr_t *netif_hdr,
                                                   uint16_t tag)
 {
@@ -188,15 +242,16 @@ static gnrc_sixlowpan_frag_rb_t *_rbuf_get_by_tag(const gnrc_netif_hdr_t *netif_
     const uint8_t *dst = gnrc_netif_hdr_get_dst_addr(netif_hdr);
     const uint8_t src_len = netif_hdr->src_l2addr_len;
     const uint8_t dst_len = netif_hdr->dst_l2addr_len;
+    gnrc_sixlowpan_frag_rb_t *e;
 
+    e = &rbuf[rbuf_idx[_rbuf_idx_hash(src, src_len, tag)]];
+    if (_rbuf_match(e, src, src_len, dst, dst_len, tag)) {
+        return e;
+    }
     for (unsigned i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE; i++) {
-        gnrc_sixlowpan_frag_rb_t *e = &rbuf[i];
+        e = &rbuf[i];
 
-        if ((e->pkt != NULL) && (e->super.tag == tag) &&
-            (e->super.src_len == src_len) &&
-            (e->super.dst_len == dst_len) &&
-            (memcmp(e->super.src, src, src_len) == 0) &&
-            (memcmp(e->super.dst, dst, dst_len) == 0)) {
+        if (_rbuf_match(e, src, src_len, dst, dst_len, tag)) {
             return e;
         }
     }
@@ -490,7 +545,14 @@ static inline bool _rbuf_int_overlap_partially(gnrc_sixlowpan_frag_rb_int_t *i,
 
 static gnrc_sixlowpan_frag_rb_int_t *_rbuf_int_get_free(void)
 {
-    for (unsigned int i = 0; i < RBUF_INT_SIZE; i++) {
+    /* intervals are mostly allocated and released in order, so continuing
+     * after the last allocated one usually finds a free one right away */
+    for (unsigned int n = 0; n < RBUF_INT_SIZE; n++) {
+        unsigned int i = rbuf_int_next;
+
+        if (++rbuf_int_next == RBUF_INT_SIZE) {
+            rbuf_int_next = 0;
+        }
         if (rbuf_int[i].end == 0) { /* start must be smaller than end anyways*/
             return rbuf_int + i;
         }
@@ -595,40 +657,21 @@ static int _rbuf_get(const void *src, size_t src_len,
 {
     gnrc_sixlowpan_frag_rb_t *res = NULL, *oldest = NULL;
     uint32_t now_usec = xtimer_now_usec();
+    unsigned idx = _rbuf_idx_hash(src, src_len, tag);
+    int found = -1;
 
-    for (unsigned int i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE; i++) {
+    /* fragments of known datagrams are typically found via the index */
+    if (_rbuf_is_datagram(&rbuf[rbuf_idx[idx]], src, src_len, dst, dst_len,
+                          size, tag)) {
+        found = rbuf_idx[idx];
+    }
+    for (unsigned int i = 0; (found < 0) &&
+         (i < CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE); i++) {
         /* check first if entry already available */
-        if ((rbuf[i].pkt != NULL) && (rbuf[i].super.tag == tag) &&
-            ((IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_SFR) &&
-              /* not all SFR fragments carry the datagram size, so make 0 a
-               * legal value to not compare datagram size */
-              ((size == 0) || (rbuf[i].super.datagram_size == size))) ||
-             (!IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_SFR) &&
-              (rbuf[i].super.datagram_size == size))) &&
-            (rbuf[i].super.src_len == src_len) &&
-            (rbuf[i].super.dst_len == dst_len) &&
-            (memcmp(rbuf[i].super.src, src, src_len) == 0) &&
-            (memcmp(rbuf[i].super.dst, dst, dst_len) == 0)) {
-            DEBUG("6lo rfrag: entry %p (%s, ", (void *)(&rbuf[i]),
-                  gnrc_netif_addr_to_str(rbuf[i].super.src,
-                                         rbuf[i].super.src_len,
-                                         l2addr_str));
-            DEBUG("%s, %u, %u) found\n",
-                  gnrc_netif_addr_to_str(rbuf[i].super.dst,
-                                         rbuf[i].super.dst_len,
-                                         l2addr_str),
-                  (unsigned)rbuf[i].super.datagram_size, rbuf[i].super.tag);
-#if CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_DEL_TIMER > 0
-            if (rbuf[i].super.current_size == 0) {
-                /* ensure that only empty reassembly buffer entries and entries
-                 * scheduled for deletion have `current_size == 0` */
-                DEBUG("6lo rfrag: scheduled for deletion, don't add fragment\n");
-                return -1;
-            }
-#endif
-            rbuf[i].super.arrival = now_usec;
-            _set_rbuf_timeout();
-            return i;
+        if (_rbuf_is_datagram(&rbuf[i], src, src_len, dst, dst_len,
+                              size, tag)) {
+            found = i;
+            break;
         }
 
         /* if there is a free spot: remember it */
@@ -644,6 +687,30 @@ static int _rbuf_get(const void *src, size_t src_len,
         }
     }
 
+    if (found >= 0) {
+        gnrc_sixlowpan_frag_rb_t *e = &rbuf[found];
+
+        DEBUG("6lo rfrag: entry %p (%s, ", (void *)e,
+              gnrc_netif_addr_to_str(e->super.src, e->super.src_len,
+                                     l2addr_str));
+        DEBUG("%s, %u, %u) found\n",
+              gnrc_netif_addr_to_str(e->super.dst, e->super.dst_len,
+                                     l2addr_str),
+              (unsigned)e->super.datagram_size, e->super.tag);
+#if CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_DEL_TIMER > 0
+        if (e->super.current_size == 0) {
+            /* ensure that only empty reassembly buffer entries and entries
+             * scheduled for deletion have `current_size == 0` */
+            DEBUG("6lo rfrag: scheduled for deletion, don't add fragment\n");
+            return -1;
+        }
+#endif
+        e->super.arrival = now_usec;
+        rbuf_idx[idx] = found;
+        _set_rbuf_timeout();
+        return found;
+    }
+
     /* entry not in buffer and no empty spot found */
     if (res == NULL) {
         assert(oldest != NULL);
@@ -731,6 +798,7 @@ static int _rbuf_get(const void *src, size_t src_len,
                                  l2addr_str), res->super.datagram_size,
           res->super.tag);
 
+    rbuf_idx[idx] = res - &(rbuf[0]);
     _set_rbuf_timeout();
 
     return res - &(rbuf[0]);
@@ -741,6 +809,7 @@ void gnrc_sixlowpan_frag_rb_reset(void)
 {
     xtimer_remove(&_gc_timer);
     memset(rbuf_int, 0, sizeof(rbuf_int));
+    rbuf_int_next = 0;
     for (unsigned int i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE; i++) {
         if ((rbuf[i].pkt != NULL) &&
             (rbuf[i].pkt->users > 0)) {
@@ -748,6 +817,7 @@ void gnrc_sixlowpan_frag_rb_reset(void)
         }
     }
     memset(rbuf, 0, sizeof(rbuf));
+    memset(rbuf_idx, 0, sizeof(rbuf_idx));
 }
 
 const gnrc_sixlowpan_frag_rb_t *gnrc_sixlowpan_frag_rb_array(void)
@@ -887,8 +957,15 @@ static int _forward_frag(gnrc_pktsnip_t *pkt, size_t frag_hdr_size,
     int res = -ENOTSUP;
 
     if (IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_MINFWD)) {
-        gnrc_pktsnip_t *frag = gnrc_pktbuf_mark(pkt, frag_hdr_size,
-                                                GNRC_NETTYPE_SIXLOWPAN);
+        gnrc_pktsnip_t *frag;
+
+        if (gnrc_sixlowpan_frag_minfwd_forward_in_place(pkt, vrbe, page) == 0) {
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_STATS
+            gnrc_sixlowpan_frag_stats_get()->vrb_in_place++;
+#endif
+            return 0;
+        }
+        frag = gnrc_pktbuf_mark(pkt, frag_hdr_size, GNRC_NETTYPE_SIXLOWPAN);
         if (frag == NULL) {
             gnrc_pktbuf_release(pkt);
             res = -ENOMEM;
@@ -0,0 +1,197 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ */
+
+#include "kernel_defines.h"
+
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_SFR_CONGURE)
+#include <assert.h>
+#include <string.h>
+
+#include "net/gnrc/netif/hdr.h"
+#include "net/ieee802154.h"
+#include "ztimer.h"
+
+#include "net/gnrc/sixlowpan/frag/sfr/congure.h"
+
+#define ENABLE_DEBUG    0
+#include "debug.h"
+
+typedef struct {
+    uint8_t dst[IEEE802154_LONG_ADDRESS_LEN];   /**< link-layer destination */
+    uint8_t dst_len;                            /**< length of _dst_t::dst,
+                                                 *   0 if unused */
+    uint32_t ack_id;                            /**< ID of the last ACK */
+} _dst_t;
+
+static _dst_t _dsts[CONFIG_GNRC_SIXLOWPAN_SFR_CONGURE_NUMOF];
+static unsigned _next_evict;
+
+static inline unsigned _idx(const gnrc_sixlowpan_frag_fb_t *fbuf)
+{
+    for (unsigned i = 0; i < CONFIG_GNRC_SIXLOWPAN_SFR_CONGURE_NUMOF; i++) {
+        if (fbuf->sfr.congure == gnrc_sixlowpan_frag_sfr_congure_snd_get(i)) {
+            return i;
+        }
+    }
+    assert(false);
+    return 0;
+}
+
+static void _update_window(gnrc_sixlowpan_frag_fb_t *fbuf)
+{
+    congure_wnd_size_t cwnd = fbuf->sfr.congure->cwnd;
+
+    if (cwnd < CONFIG_GNRC_SIXLOWPAN_SFR_MIN_WIN_SIZE) {
+        cwnd = CONFIG_GNRC_SIXLOWPAN_SFR_MIN_WIN_SIZE;
+    }
+    else if (cwnd > CONFIG_GNRC_SIXLOWPAN_SFR_MAX_WIN_SIZE) {
+        cwnd = CONFIG_GNRC_SIXLOWPAN_SFR_MAX_WIN_SIZE;
+    }
+    DEBUG("6lo sfr congure: window size of datagram %u: %u\n",
+          fbuf->tag, (unsigned)cwnd);
+    /* also clamp the congestion window itself, so it does not grow beyond
+     * what SFR can use and a reduction takes effect immediately */
+    fbuf->sfr.congure->cwnd = cwnd;
+    fbuf->sfr.window_size = (uint8_t)cwnd;
+}
+
+/* CongURE expects collections of messages as clist, so wrap a single
+ * message, describing a number of fragments, into one */
+static congure_snd_msg_t *_msgs(congure_snd_msg_t *head, congure_snd_msg_t *msg)
+{
+    msg->super.next = &msg->super;
+    head->super.next = &msg->super;
+    return head;
+}
+
+void gnrc_sixlowpan_frag_sfr_congure_snd_init(gnrc_sixlowpan_frag_fb_t *fbuf)
+{
+    const gnrc_netif_hdr_t *netif_hdr = fbuf->pkt->data;
+    const uint8_t *dst = gnrc_netif_hdr_get_dst_addr(netif_hdr);
+    uint8_t dst_len = netif_hdr->dst_l2addr_len;
+    congure_snd_t *c;
+    unsigned i;
+
+    assert(dst_len <= IEEE802154_LONG_ADDRESS_LEN);
+    for (i = 0; i < CONFIG_GNRC_SIXLOWPAN_SFR_CONGURE_NUMOF; i++) {
+        if ((_dsts[i].dst_len == dst_len) &&
+            (memcmp(_dsts[i].dst, dst, dst_len) == 0)) {
+            break;
+        }
+    }
+    if (i == CONFIG_GNRC_SIXLOWPAN_SFR_CONGURE_NUMOF) {
+        /* unknown destination: take over the state of the least recently
+         * added one */
+        i = _next_evict;
+        _next_evict = (_next_evict + 1) % CONFIG_GNRC_SIXLOWPAN_SFR_CONGURE_NUMOF;
+        memcpy(_dsts[i].dst, dst, dst_len);
+        _dsts[i].dst_len = dst_len;
+        _dsts[i].ack_id = 0;
+        c = gnrc_sixlowpan_frag_sfr_congure_snd_get(i);
+        c->driver->init(c, NULL);
+        /* start with OptWindowSize as RFC 8931 recommends */
+        c->cwnd = CONFIG_GNRC_SIXLOWPAN_SFR_OPT_WIN_SIZE;
+        DEBUG("6lo sfr congure: new congestion state %u\n", i);
+    }
+    fbuf->sfr.congure = gnrc_sixlowpan_frag_sfr_congure_snd_get(i);
+    _update_window(fbuf);
+}
+
+uint32_t gnrc_sixlowpan_frag_sfr_congure_snd_inter_frame_gap(
+    gnrc_sixlowpan_frag_fb_t *fbuf)
+{
+    congure_snd_t *c = fbuf->sfr.congure;
+    int32_t gap = c->driver->inter_msg_interval(c, 1U);
+
+    if (gap < (int32_t)CONFIG_GNRC_SIXLOWPAN_SFR_INTER_FRAME_GAP_US) {
+        /* no pacing supported or InterFrameGap is larger */
+        return CONFIG_GNRC_SIXLOWPAN_SFR_INTER_FRAME_GAP_US;
+    }
+    return gap;
+}
+
+void gnrc_sixlowpan_frag_sfr_congure_snd_report_frag_sent(
+    gnrc_sixlowpan_frag_fb_t *fbuf)
+{
+    congure_snd_t *c = fbuf->sfr.congure;
+
+    c->driver->report_msg_sent(c, 1U);
+}
+
+void gnrc_sixlowpan_frag_sfr_congure_snd_report_frags_acked(
+    gnrc_sixlowpan_frag_fb_t *fbuf, unsigned frags, ztimer_now_t send_time)
+{
+    congure_snd_t *c = fbuf->sfr.congure;
+    congure_snd_msg_t msg = { .send_time = send_time, .size = frags };
+    congure_snd_ack_t ack = {
+        .recv_time = ztimer_now(ZTIMER_MSEC),
+        /* every RFRAG-ACK acknowledging fragments is a new ACK */
+        .id = ++_dsts[_idx(fbuf)].ack_id,
+        .clean = 1U,
+    };
+
+    if (frags == 0) {
+        return;
+    }
+    c->driver->report_msg_acked(c, &msg, &ack);
+    _update_window(fbuf);
+}
+
+void gnrc_sixlowpan_frag_sfr_congure_snd_report_frags_lost(
+    gnrc_sixlowpan_frag_fb_t *fbuf, unsigned frags, ztimer_now_t send_time,
+    uint8_t resends)
+{
+    congure_snd_t *c = fbuf->sfr.congure;
+    congure_snd_msg_t head = { .size = 0 };
+    congure_snd_msg_t msg = {
+        .send_time = send_time,
+        .size = frags,
+        .resends = resends,
+    };
+
+    if (frags == 0) {
+        return;
+    }
+    c->driver->report_msgs_lost(c, _msgs(&head, &msg));
+    _update_window(fbuf);
+}
+
+void gnrc_sixlowpan_frag_sfr_congure_snd_report_frag_timeout(
+    gnrc_sixlowpan_frag_fb_t *fbuf, ztimer_now_t send_time, uint8_t resends)
+{
+    congure_snd_t *c = fbuf->sfr.congure;
+    congure_snd_msg_t head = { .size = 0 };
+    congure_snd_msg_t msg = {
+        .send_time = send_time,
+        .size = 1U,
+        .resends = resends,
+    };
+
+    c->driver->report_msgs_timeout(c, _msgs(&head, &msg));
+    _update_window(fbuf);
+}
+
+void gnrc_sixlowpan_frag_sfr_congure_snd_report_ecn(
+    gnrc_sixlowpan_frag_fb_t *fbuf, ztimer_now_t send_time)
+{
+    congure_snd_t *c = fbuf->sfr.congure;
+
+    c->driver->report_ecn_ce(c, send_time);
+    _update_window(fbuf);
+}
+#else   /* IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_SFR_CONGURE) */
+typedef int dont_be_pedantic;
+#endif  /* IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_SFR_CONGURE) */
+
+/** @} */
@@ -0,0 +1,56 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ * @brief   QUIC congestion control as backend for SFR
+ */
+
+#include "kernel_defines.h"
+
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_SFR_CONGURE_QUIC)
+#include <assert.h>
+
+#include "congure/quic.h"
+#include "net/gnrc/sixlowpan/config.h"
+
+#include "net/gnrc/sixlowpan/frag/sfr/congure.h"
+
+static const congure_quic_snd_consts_t _consts = {
+    .cong_event_cb = NULL,
+    .init_wnd = CONFIG_GNRC_SIXLOWPAN_SFR_OPT_WIN_SIZE,
+    .min_wnd = CONFIG_GNRC_SIXLOWPAN_SFR_MIN_WIN_SIZE,
+    /* the ARQ timeout is an upper bound for the RTT */
+    .init_rtt = CONFIG_GNRC_SIXLOWPAN_SFR_MIN_ARQ_TIMEOUT_MS,
+    /* fragments are the unit of the window */
+    .max_msg_size = 1,
+    .pc_thresh = 3000,      /* kPersistentCongestionThreshold = 3s */
+    .granularity = 1,       /* kGranularity = 1ms */
+    .loss_reduction_numerator = 1,      /* kLossReductionFactor = .5 */
+    .loss_reduction_denominator = 2,
+    .inter_msg_interval_numerator = 5,  /* Pacing factor N = 1.25 */
+    .inter_msg_interval_denominator = 4,
+};
+
+static congure_quic_snd_t _states[CONFIG_GNRC_SIXLOWPAN_SFR_CONGURE_NUMOF];
+
+congure_snd_t *gnrc_sixlowpan_frag_sfr_congure_snd_get(unsigned idx)
+{
+    assert(idx < ARRAY_SIZE(_states));
+    if (_states[idx].super.driver == NULL) {
+        congure_quic_snd_setup(&_states[idx], &_consts);
+    }
+    return &_states[idx].super;
+}
+#else   /* IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_SFR_CONGURE_QUIC) */
+typedef int dont_be_pedantic;
+#endif  /* IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_SFR_CONGURE_QUIC) */
+
+/** @} */
@@ -0,0 +1,95 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ * @brief   TCP Reno as congestion control backend for SFR
+ */
+
+#include "kernel_defines.h"
+
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_SFR_CONGURE_RENO)
+#include <assert.h>
+
+#include "congure/reno.h"
+#include "net/gnrc/sixlowpan/config.h"
+
+#include "net/gnrc/sixlowpan/frag/sfr/congure.h"
+
+static void _fr(congure_reno_snd_t *c);
+static bool _same_wnd_adv(congure_reno_snd_t *c, congure_snd_ack_t *ack);
+static void _snd_report_msg_acked(congure_snd_t *cong, congure_snd_msg_t *msg,
+                                  congure_snd_ack_t *ack);
+
+static const congure_snd_driver_t _driver = {
+    .init = congure_reno_snd_init,
+    .inter_msg_interval = congure_reno_snd_inter_msg_interval,
+    .report_msg_sent = congure_reno_snd_report_msg_sent,
+    .report_msg_discarded = congure_reno_snd_report_msg_discarded,
+    .report_msgs_timeout = congure_reno_snd_report_msgs_timeout,
+    .report_msgs_lost = congure_reno_snd_report_msgs_lost,
+    .report_msg_acked = _snd_report_msg_acked,
+    .report_ecn_ce = congure_reno_snd_report_ecn_ce,
+};
+
+static const congure_reno_snd_consts_t _consts = {
+    .fr = _fr,
+    .same_wnd_adv = _same_wnd_adv,
+    /* fragments are the unit of the window */
+    .init_mss = 1,
+    .cwnd_lower = CONFIG_GNRC_SIXLOWPAN_SFR_MIN_WIN_SIZE,
+    .cwnd_upper = CONFIG_GNRC_SIXLOWPAN_SFR_MAX_WIN_SIZE,
+    .init_ssthresh = CONFIG_GNRC_SIXLOWPAN_SFR_MAX_WIN_SIZE,
+    .frthresh = 3,
+};
+
+static congure_reno_snd_t _states[CONFIG_GNRC_SIXLOWPAN_SFR_CONGURE_NUMOF];
+
+static void _fr(congure_reno_snd_t *c)
+{
+    /* SFR resends lost fragments on its own with the next RFRAG-ACK */
+    (void)c;
+}
+
+static bool _same_wnd_adv(congure_reno_snd_t *c, congure_snd_ack_t *ack)
+{
+    /* RFRAG-ACKs do not advertise a window */
+    (void)c;
+    (void)ack;
+    return true;
+}
+
+static void _snd_report_msg_acked(congure_snd_t *cong, congure_snd_msg_t *msg,
+                                  congure_snd_ack_t *ack)
+{
+    congure_reno_snd_t *c = (congure_reno_snd_t *)cong;
+
+    /* Reno caps the flight size to cwnd when fragments are resent, so more
+     * fragments might get acknowledged than Reno deems in flight */
+    if (msg->size > c->in_flight_size) {
+        msg->size = c->in_flight_size;
+    }
+    congure_reno_snd_report_msg_acked(cong, msg, ack);
+}
+
+congure_snd_t *gnrc_sixlowpan_frag_sfr_congure_snd_get(unsigned idx)
+{
+    assert(idx < ARRAY_SIZE(_states));
+    if (_states[idx].super.driver == NULL) {
+        _states[idx].super.driver = &_driver;
+        _states[idx].consts = &_consts;
+    }
+    return &_states[idx].super;
+}
+#else   /* IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_SFR_CONGURE_RENO) */
+typedef int dont_be_pedantic;
+#endif  /* IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_SFR_CONGURE_RENO) */
+
+/** @} */
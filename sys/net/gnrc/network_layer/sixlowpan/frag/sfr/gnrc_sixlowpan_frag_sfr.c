@@ -37,8 +37,10 @@
 #include "thread.h"
 #include "unaligned.h"
 #include "xtimer.h"
+#include "ztimer.h"
 
 #include "net/gnrc/sixlowpan/frag/sfr.h"
+#include "net/gnrc/sixlowpan/frag/sfr/congure.h"
 
 #define ENABLE_DEBUG    0
 #include "debug.h"
@@ -59,6 +61,22 @@ typedef struct {
     uint8_t retries;        /**< how often the fragment was retried */
 } _frag_desc_t;
 
+/**
+ * @brief   Fragments acknowledged or lost according to an RFRAG-ACK, to be
+ *          reported to @ref net_gnrc_sixlowpan_frag_sfr_congure
+ */
+typedef struct {
+    uint32_t now;               /**< time the ACK was handled in microseconds */
+    uint32_t acked_last_sent;   /**< last send time of the most recently sent
+                                 *   acknowledged fragment */
+    uint32_t lost_last_sent;    /**< last send time of the most recently sent
+                                 *   lost fragment */
+    unsigned acked;             /**< number of acknowledged fragments */
+    unsigned lost;              /**< number of lost fragments */
+    uint8_t lost_resends;       /**< maximum number of resends of the lost
+                                 *   fragments */
+} _ack_report_t;
+
 typedef struct {
     clist_node_t super;     /**< list parent instance */
     gnrc_pktsnip_t *frame;  /**< frame in the queue */
@@ -89,6 +107,7 @@ static evtimer_msg_t _arq_timer;
 static xtimer_t _if_gap_timer = { 0 };
 static msg_t _if_gap_msg = { .type = GNRC_SIXLOWPAN_FRAG_SFR_INTER_FRAG_GAP_MSG };
 static uint32_t _last_frame_sent = 0U;
+static uint32_t _inter_frame_gap = CONFIG_GNRC_SIXLOWPAN_SFR_INTER_FRAME_GAP_US;
 
 static _frag_desc_t _frag_descs_pool[FRAG_DESCS_POOL_SIZE];
 static _frame_queue_t _frame_queue_pool[FRAME_QUEUE_POOL_SIZE];
@@ -129,6 +148,24 @@ static inline uint8_t _frag_seq(_frag_desc_t *frag);
  */
 static inline uint16_t _frag_size(_frag_desc_t *frag);
 
+/**
+ * @brief   Converts the microsecond timestamp of a fragment descriptor to a
+ *          ZTIMER_MSEC timestamp for @ref net_gnrc_sixlowpan_frag_sfr_congure
+ *
+ * @param[in] last_sent _frag_desc_t::last_sent of a fragment
+ * @param[in] now       The current time in microseconds
+ */
+static inline ztimer_now_t _send_time(uint32_t last_sent, uint32_t now);
+
+/**
+ * @brief   Reports a (re-)sent fragment to
+ *          @ref net_gnrc_sixlowpan_frag_sfr_congure and updates the
+ *          inter-frame gap
+ *
+ * @param[in] fbuf  The fragmentation buffer entry the fragment belongs to
+ */
+static void _report_frag_sent(gnrc_sixlowpan_frag_fb_t *fbuf);
+
 /**
  * @brief   Cleans up a fragmentation buffer entry and all state related to its
  *          datagram.
@@ -505,6 +542,9 @@ void gnrc_sixlowpan_frag_sfr_arq_timeout(gnrc_sixlowpan_frag_fb_t *fbuf)
                 reschedule_arq_timeout = true;
             }
             else if (_frag_ack_req(frag_desc)) {
+                gnrc_sixlowpan_frag_sfr_congure_snd_report_frag_timeout(
+                    fbuf, _send_time(frag_desc->last_sent, now), frag_desc->retries
+                );
                 /* for this fragment we requested an ACK which was not received
                  * yet. Try to resend it */
                 if ((frag_desc->retries++) < CONFIG_GNRC_SIXLOWPAN_SFR_FRAG_RETRIES) {
@@ -814,7 +854,7 @@ static bool _send_frame(gnrc_pktsnip_t *frame, void *ctx, unsigned page)
     _check_for_ecn(frame);
     now = xtimer_now_usec();
     if ((CONFIG_GNRC_SIXLOWPAN_SFR_INTER_FRAME_GAP_US == 0) ||
-        ((now - _last_frame_sent) > CONFIG_GNRC_SIXLOWPAN_SFR_INTER_FRAME_GAP_US)) {
+        ((now - _last_frame_sent) > _inter_frame_gap)) {
         DEBUG("6lo sfr: dispatch frame to network interface\n");
         _last_frame_sent = now;
         gnrc_sixlowpan_dispatch_send(frame, ctx, page);
@@ -858,6 +898,7 @@ static bool _send_fragment(gnrc_pktsnip_t *frag, gnrc_sixlowpan_frag_fb_t *fbuf,
             _stats.fragments_sent.usual++;
         }
         frag_desc->last_sent = _last_frame_sent;
+        _report_frag_sent(fbuf);
         fbuf->sfr.cur_seq++;
         fbuf->sfr.frags_sent++;
     }
@@ -1197,14 +1238,49 @@ static int _resend_failed_frag(clist_node_t *node, void *fbuf_ptr)
     return res;
 }
 
+static void _ack_report_add(unsigned *frags, uint32_t *last_sent,
+                            _frag_desc_t *frag_desc, uint32_t now)
+{
+    /* the time since the fragment was last sent is the smallest for the most
+     * recently sent one. Compare differences to be safe against wrap-around */
+    if ((*frags == 0) ||
+        ((now - frag_desc->last_sent) < (now - *last_sent))) {
+        *last_sent = frag_desc->last_sent;
+    }
+    (*frags)++;
+}
+
+static void _ack_report(gnrc_sixlowpan_frag_fb_t *fbuf,
+                        sixlowpan_sfr_ack_t *ack, _ack_report_t *report)
+{
+    if (!IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_SFR_CONGURE)) {
+        return;
+    }
+    gnrc_sixlowpan_frag_sfr_congure_snd_report_frags_lost(
+        fbuf, report->lost, _send_time(report->lost_last_sent, report->now),
+        report->lost_resends
+    );
+    gnrc_sixlowpan_frag_sfr_congure_snd_report_frags_acked(
+        fbuf, report->acked, _send_time(report->acked_last_sent, report->now)
+    );
+    if (CONFIG_GNRC_SIXLOWPAN_SFR_USE_ECN && sixlowpan_sfr_ecn(&ack->base)) {
+        DEBUG("6lo sfr: ECN echoed for datagram %u\n", fbuf->tag);
+        gnrc_sixlowpan_frag_sfr_congure_snd_report_ecn(
+            fbuf, _send_time(report->acked_last_sent, report->now)
+        );
+    }
+}
+
 static void _check_failed_frags(sixlowpan_sfr_ack_t *ack,
                                 gnrc_sixlowpan_frag_fb_t *fbuf)
 {
     _frag_desc_t *frag_desc;
     clist_node_t not_received = { .next = NULL };
+    _ack_report_t report = { .acked = 0 };
 
     DEBUG("6lo sfr: checking which fragments to resend for datagram %u\n",
           fbuf->tag);
+    report.now = xtimer_now_usec();
     for (frag_desc = (_frag_desc_t *)clist_lpop(&fbuf->sfr.window);
          frag_desc != NULL;
          frag_desc = (_frag_desc_t *)clist_lpop(&fbuf->sfr.window)) {
@@ -1215,6 +1291,8 @@ static void _check_failed_frags(sixlowpan_sfr_ack_t *ack,
             DEBUG("6lo sfr: fragment %u (offset: %u, frag_size: %u) "
                   "for datagram %u was received\n", seq,
                   frag_desc->offset, _frag_size(frag_desc), fbuf->tag);
+            _ack_report_add(&report.acked, &report.acked_last_sent,
+                            frag_desc, report.now);
             fbuf->sfr.frags_sent--;
             clist_rpush(&_frag_descs_free, &frag_desc->super);
         }
@@ -1222,6 +1300,11 @@ static void _check_failed_frags(sixlowpan_sfr_ack_t *ack,
             DEBUG("6lo sfr: fragment %u (offset: %u, frag_size: %u) "
                   "for datagram %u was not received\n", seq,
                   frag_desc->offset, _frag_size(frag_desc), fbuf->tag);
+            _ack_report_add(&report.lost, &report.lost_last_sent,
+                            frag_desc, report.now);
+            if (frag_desc->retries > report.lost_resends) {
+                report.lost_resends = frag_desc->retries;
+            }
             if ((frag_desc->retries++) < CONFIG_GNRC_SIXLOWPAN_SFR_FRAG_RETRIES) {
                 DEBUG("6lo sfr: %u retries left\n",
                       CONFIG_GNRC_SIXLOWPAN_SFR_FRAG_RETRIES -
@@ -1233,12 +1316,14 @@ static void _check_failed_frags(sixlowpan_sfr_ack_t *ack,
             else {
                 DEBUG("6lo sfr: no more retries for fragment %u\n", seq);
                 clist_rpush(&_frag_descs_free, &frag_desc->super);
+                _ack_report(fbuf, ack, &report);
                 /* retry to resend whole datagram */
                 _retry_datagram(fbuf);
                 return;
             }
         }
     }
+    _ack_report(fbuf, ack, &report);
     /* all fragments were received of the current window were received and
      * the datagram was transmitted completely */
     if ((clist_lpeek(&not_received) == NULL) &&
@@ -1306,6 +1391,25 @@ static inline uint16_t _frag_size(_frag_desc_t *frag)
     return (frag->ar_seq_fs & SIXLOWPAN_SFR_FRAG_SIZE_MASK);
 }
 
+static inline ztimer_now_t _send_time(uint32_t last_sent, uint32_t now)
+{
+    if (!IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_SFR_CONGURE)) {
+        return 0;
+    }
+    return ztimer_now(ZTIMER_MSEC) - ((now - last_sent) / US_PER_MS);
+}
+
+static void _report_frag_sent(gnrc_sixlowpan_frag_fb_t *fbuf)
+{
+    if (IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_SFR_CONGURE)) {
+        gnrc_sixlowpan_frag_sfr_congure_snd_report_frag_sent(fbuf);
+        if (CONFIG_GNRC_SIXLOWPAN_SFR_INTER_FRAME_GAP_US > 0) {
+            _inter_frame_gap =
+                gnrc_sixlowpan_frag_sfr_congure_snd_inter_frame_gap(fbuf);
+        }
+    }
+}
+
 static void _clean_up_fbuf(gnrc_sixlowpan_frag_fb_t *fbuf, int error)
 {
     DEBUG("6lo sfr: removing fragmentation buffer entry for datagram %u\n",
@@ -1348,6 +1452,8 @@ static uint16_t _send_1st_fragment(gnrc_netif_t *netif,
     }
     fbuf->sfr.arq_timeout = CONFIG_GNRC_SIXLOWPAN_SFR_OPT_ARQ_TIMEOUT_MS;
     fbuf->sfr.window_size = CONFIG_GNRC_SIXLOWPAN_SFR_OPT_WIN_SIZE;
+    /* may adapt window size to congestion state of destination */
+    gnrc_sixlowpan_frag_sfr_congure_snd_init(fbuf);
 
     frag = _build_frag_from_fbuf(pkt, fbuf, frag_size);
     if (frag == NULL) {
@@ -1488,6 +1594,7 @@ static int _resend_frag(clist_node_t *node, void *fbuf_ptr)
           sixlowpan_sfr_rfrag_get_offset(hdr));
     if (_send_frame(frag, NULL, 0)) {
         frag_desc->last_sent = _last_frame_sent;
+        _report_frag_sent(fbuf);
         return 0;
     }
     else {
@@ -1564,9 +1671,8 @@ static void _sched_next_frame(void)
         if (!already_set) {
             uint32_t last_sent_since = (_last_frame_sent - xtimer_now_usec());
 
-            if (last_sent_since <= CONFIG_GNRC_SIXLOWPAN_SFR_INTER_FRAME_GAP_US) {
-                uint32_t offset = CONFIG_GNRC_SIXLOWPAN_SFR_INTER_FRAME_GAP_US -
-                                  last_sent_since;
+            if (last_sent_since <= _inter_frame_gap) {
+                uint32_t offset = _inter_frame_gap - last_sent_since;
                 DEBUG("6lo sfr: arming inter-frame timer in %" PRIu32 " us\n",
                       last_sent_since);
                 xtimer_set_msg(&_if_gap_timer, offset, &_if_gap_msg, _getpid());
@@ -176,10 +176,16 @@ gnrc_sixlowpan_frag_vrb_t *gnrc_sixlowpan_frag_vrb_get(
                   gnrc_netif_addr_to_str(vrbe->super.dst,
                                          vrbe->super.dst_len,
                                          addr_str), vrbe->out_tag);
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_STATS
+            gnrc_sixlowpan_frag_stats_get()->vrb_hits++;
+#endif
             return vrbe;
         }
     }
     DEBUG("6lo vrb: no entry found\n");
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_STATS
+    gnrc_sixlowpan_frag_stats_get()->vrb_misses++;
+#endif
     return NULL;
 }
 
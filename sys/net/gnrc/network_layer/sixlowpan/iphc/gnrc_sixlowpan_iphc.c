@@ -25,6 +25,7 @@
 #include "net/gnrc/netif/internal.h"
 #include "net/gnrc/sixlowpan.h"
 #include "net/gnrc/sixlowpan/ctx.h"
+#include "net/gnrc/sixlowpan/config.h"
 #include "net/gnrc/sixlowpan/frag/rb.h"
 #include "net/gnrc/sixlowpan/frag/minfwd.h"
 #ifdef MODULE_GNRC_SIXLOWPAN_FRAG_SFR
@@ -1035,55 +1036,150 @@ static inline bool _compressible_nh(uint8_t nh)
     }
 }
 
-static size_t _iphc_ipv6_encode(gnrc_pktsnip_t *pkt,
-                                const gnrc_netif_hdr_t *netif_hdr,
-                                gnrc_netif_t *iface,
-                                uint8_t *iphc_hdr)
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_IPHC_CACHE)
+/**
+ * @brief   Cached address compression of a flow
+ */
+typedef struct {
+    ipv6_addr_t src;            /**< source address of the flow */
+    ipv6_addr_t dst;            /**< destination address of the flow */
+    /**
+     * @brief   link-layer destination address of the flow
+     */
+    uint8_t l2dst[GNRC_NETIF_HDR_L2ADDR_MAX_LEN];
+    uint16_t ctx_deps;          /**< bitmap of the contexts the compressed
+                                 *   addresses depend on */
+    uint16_t ctx_version;       /**< gnrc_sixlowpan_ctx_version() upon
+                                 *   caching */
+    kernel_pid_t iface;         /**< interface of the flow,
+                                 *   KERNEL_PID_UNDEF if entry is unused */
+    uint8_t l2dst_len;          /**< length of _iphc_cache_t::l2dst */
+    uint8_t iphc2;              /**< second IPHC byte (SAC, SAM, M, DAC, DAM,
+                                 *   and CID flag) */
+    uint8_t cid_ext;            /**< context identifier extension */
+    uint8_t addr_len;           /**< length of _iphc_cache_t::addr */
+    uint8_t addr[2 * sizeof(ipv6_addr_t)];  /**< inline address fields */
+} _iphc_cache_t;
+
+static _iphc_cache_t _cache[CONFIG_GNRC_SIXLOWPAN_IPHC_CACHE_SIZE];
+static unsigned _cache_next;
+static volatile bool _cache_flush;
+
+void gnrc_sixlowpan_iphc_cache_flush(void)
 {
-    gnrc_sixlowpan_ctx_t *src_ctx = NULL, *dst_ctx = NULL;
-    ipv6_hdr_t *ipv6_hdr = pkt->next->data;
-    bool addr_comp = false;
-    uint16_t inline_pos = SIXLOWPAN_IPHC_HDR_LEN;
-
-    assert(iface != NULL);
+    /* only mark cache as flushed, so it is only ever written to by the
+     * thread the encoder runs in */
+    _cache_flush = true;
+}
 
-    /* set initial dispatch value*/
-    iphc_hdr[IPHC1_IDX] = SIXLOWPAN_IPHC1_DISP;
-    iphc_hdr[IPHC2_IDX] = 0;
+static bool _cache_ctx_valid(uint16_t ctx_deps)
+{
+    for (uint8_t id = 0; ctx_deps != 0; id++, ctx_deps >>= 1) {
+        gnrc_sixlowpan_ctx_t *ctx;
 
-    /* check for available contexts */
-    if (!ipv6_addr_is_unspecified(&(ipv6_hdr->src))) {
-        src_ctx = gnrc_sixlowpan_ctx_lookup_addr(&(ipv6_hdr->src));
-        /* do not use source context for compression if */
-        /* GNRC_SIXLOWPAN_CTX_FLAGS_COMP is not set */
-        if (src_ctx && !(src_ctx->flags_id & GNRC_SIXLOWPAN_CTX_FLAGS_COMP)) {
-            src_ctx = NULL;
+        if ((ctx_deps & 1U) &&
+            (((ctx = gnrc_sixlowpan_ctx_lookup_id(id)) == NULL) ||
+             !(ctx->flags_id & GNRC_SIXLOWPAN_CTX_FLAGS_COMP))) {
+            /* context was removed or its lifetime expired */
+            return false;
         }
     }
+    return true;
+}
 
-    if (!ipv6_addr_is_multicast(&ipv6_hdr->dst)) {
-        dst_ctx = gnrc_sixlowpan_ctx_lookup_addr(&(ipv6_hdr->dst));
-        /* do not use destination context for compression if */
-        /* GNRC_SIXLOWPAN_CTX_FLAGS_COMP is not set */
-        if (dst_ctx && !(dst_ctx->flags_id & GNRC_SIXLOWPAN_CTX_FLAGS_COMP)) {
-            dst_ctx = NULL;
+static _iphc_cache_t *_cache_get(const ipv6_hdr_t *ipv6_hdr,
+                                 const gnrc_netif_hdr_t *netif_hdr,
+                                 const gnrc_netif_t *iface)
+{
+    if (_cache_flush) {
+        _cache_flush = false;
+        memset(_cache, 0, sizeof(_cache));
+        return NULL;
+    }
+    for (unsigned i = 0; i < CONFIG_GNRC_SIXLOWPAN_IPHC_CACHE_SIZE; i++) {
+        _iphc_cache_t *entry = &_cache[i];
+
+        if ((entry->iface == iface->pid) &&
+            (entry->l2dst_len == netif_hdr->dst_l2addr_len) &&
+            ipv6_addr_equal(&entry->dst, &ipv6_hdr->dst) &&
+            ipv6_addr_equal(&entry->src, &ipv6_hdr->src) &&
+            (memcmp(entry->l2dst, gnrc_netif_hdr_get_dst_addr(netif_hdr),
+                    entry->l2dst_len) == 0)) {
+            if ((entry->ctx_version != gnrc_sixlowpan_ctx_version()) ||
+                !_cache_ctx_valid(entry->ctx_deps)) {
+                DEBUG("6lo iphc: cached flow %u is stale\n", i);
+                entry->iface = KERNEL_PID_UNDEF;
+                return NULL;
+            }
+            return entry;
         }
     }
+    return NULL;
+}
 
-    /* if contexts available and both != 0 */
-    /* since this moves inline_pos we have to do this ahead*/
-    if (((src_ctx != NULL) &&
-            ((src_ctx->flags_id & GNRC_SIXLOWPAN_CTX_FLAGS_CID_MASK) != 0)) ||
-        ((dst_ctx != NULL) &&
-            ((dst_ctx->flags_id & GNRC_SIXLOWPAN_CTX_FLAGS_CID_MASK) != 0))) {
-        /* add context identifier extension */
-        iphc_hdr[IPHC2_IDX] |= SIXLOWPAN_IPHC2_CID_EXT;
-        iphc_hdr[CID_EXT_IDX] = 0;
+static void _cache_add(const ipv6_hdr_t *ipv6_hdr,
+                       const gnrc_netif_hdr_t *netif_hdr,
+                       const gnrc_netif_t *iface, const uint8_t *iphc_hdr,
+                       uint16_t addr_pos, uint16_t inline_pos,
+                       uint16_t ctx_deps)
+{
+    _iphc_cache_t *entry = &_cache[_cache_next];
 
-        /* move position to behind CID extension */
-        inline_pos += SIXLOWPAN_IPHC_CID_EXT_LEN;
+    if (netif_hdr->dst_l2addr_len > sizeof(entry->l2dst)) {
+        return;
     }
+    _cache_next = (_cache_next + 1) % CONFIG_GNRC_SIXLOWPAN_IPHC_CACHE_SIZE;
+    entry->src = ipv6_hdr->src;
+    entry->dst = ipv6_hdr->dst;
+    memcpy(entry->l2dst, gnrc_netif_hdr_get_dst_addr(netif_hdr),
+           netif_hdr->dst_l2addr_len);
+    entry->l2dst_len = netif_hdr->dst_l2addr_len;
+    entry->ctx_deps = ctx_deps;
+    entry->ctx_version = gnrc_sixlowpan_ctx_version();
+    entry->iface = iface->pid;
+    entry->iphc2 = iphc_hdr[IPHC2_IDX];
+    entry->cid_ext = iphc_hdr[CID_EXT_IDX];
+    entry->addr_len = inline_pos - addr_pos;
+    memcpy(entry->addr, &iphc_hdr[addr_pos], entry->addr_len);
+}
+#else   /* IS_USED(MODULE_GNRC_SIXLOWPAN_IPHC_CACHE) */
+typedef struct {
+    uint8_t iphc2;
+    uint8_t cid_ext;
+    uint8_t addr_len;
+    uint8_t addr[2 * sizeof(ipv6_addr_t)];
+} _iphc_cache_t;
+
+static inline _iphc_cache_t *_cache_get(const ipv6_hdr_t *ipv6_hdr,
+                                        const gnrc_netif_hdr_t *netif_hdr,
+                                        const gnrc_netif_t *iface)
+{
+    (void)ipv6_hdr;
+    (void)netif_hdr;
+    (void)iface;
+    return NULL;
+}
 
+static inline void _cache_add(const ipv6_hdr_t *ipv6_hdr,
+                              const gnrc_netif_hdr_t *netif_hdr,
+                              const gnrc_netif_t *iface,
+                              const uint8_t *iphc_hdr, uint16_t addr_pos,
+                              uint16_t inline_pos, uint16_t ctx_deps)
+{
+    (void)ipv6_hdr;
+    (void)netif_hdr;
+    (void)iface;
+    (void)iphc_hdr;
+    (void)addr_pos;
+    (void)inline_pos;
+    (void)ctx_deps;
+}
+#endif  /* IS_USED(MODULE_GNRC_SIXLOWPAN_IPHC_CACHE) */
+
+static uint16_t _iphc_ipv6_encode_tf_nh_hl(const ipv6_hdr_t *ipv6_hdr,
+                                           uint8_t *iphc_hdr,
+                                           uint16_t inline_pos)
+{
     /* compress flow label and traffic class */
     if (ipv6_hdr_get_fl(ipv6_hdr) == 0) {
         if (ipv6_hdr_get_tc(ipv6_hdr) == 0) {
@@ -1142,7 +1238,85 @@ static size_t _iphc_ipv6_encode(gnrc_pktsnip_t *pkt,
             iphc_hdr[inline_pos++] = ipv6_hdr->hl;
             break;
     }
+    return inline_pos;
+}
+
+static size_t _iphc_ipv6_encode_cached(const _iphc_cache_t *entry,
+                                       const ipv6_hdr_t *ipv6_hdr,
+                                       uint8_t *iphc_hdr)
+{
+    uint16_t inline_pos = SIXLOWPAN_IPHC_HDR_LEN;
+
+    /* addresses are compressed the same as for the last packet of the flow,
+     * so only the remaining fields need to be compressed */
+    iphc_hdr[IPHC2_IDX] = entry->iphc2;
+    if (entry->iphc2 & SIXLOWPAN_IPHC2_CID_EXT) {
+        iphc_hdr[CID_EXT_IDX] = entry->cid_ext;
+        inline_pos += SIXLOWPAN_IPHC_CID_EXT_LEN;
+    }
+    inline_pos = _iphc_ipv6_encode_tf_nh_hl(ipv6_hdr, iphc_hdr, inline_pos);
+    memcpy(&iphc_hdr[inline_pos], entry->addr, entry->addr_len);
+    return inline_pos + entry->addr_len;
+}
+
+static size_t _iphc_ipv6_encode(gnrc_pktsnip_t *pkt,
+                                const gnrc_netif_hdr_t *netif_hdr,
+                                gnrc_netif_t *iface,
+                                uint8_t *iphc_hdr)
+{
+    gnrc_sixlowpan_ctx_t *src_ctx = NULL, *dst_ctx = NULL;
+    ipv6_hdr_t *ipv6_hdr = pkt->next->data;
+    const _iphc_cache_t *cached;
+    bool addr_comp = false;
+    uint16_t inline_pos = SIXLOWPAN_IPHC_HDR_LEN, addr_pos;
+    uint16_t ctx_deps = 0;
+
+    assert(iface != NULL);
+
+    /* set initial dispatch value*/
+    iphc_hdr[IPHC1_IDX] = SIXLOWPAN_IPHC1_DISP;
+    iphc_hdr[IPHC2_IDX] = 0;
+
+    if ((cached = _cache_get(ipv6_hdr, netif_hdr, iface)) != NULL) {
+        return _iphc_ipv6_encode_cached(cached, ipv6_hdr, iphc_hdr);
+    }
+
+    /* check for available contexts */
+    if (!ipv6_addr_is_unspecified(&(ipv6_hdr->src))) {
+        src_ctx = gnrc_sixlowpan_ctx_lookup_addr(&(ipv6_hdr->src));
+        /* do not use source context for compression if */
+        /* GNRC_SIXLOWPAN_CTX_FLAGS_COMP is not set */
+        if (src_ctx && !(src_ctx->flags_id & GNRC_SIXLOWPAN_CTX_FLAGS_COMP)) {
+            src_ctx = NULL;
+        }
+    }
+
+    if (!ipv6_addr_is_multicast(&ipv6_hdr->dst)) {
+        dst_ctx = gnrc_sixlowpan_ctx_lookup_addr(&(ipv6_hdr->dst));
+        /* do not use destination context for compression if */
+        /* GNRC_SIXLOWPAN_CTX_FLAGS_COMP is not set */
+        if (dst_ctx && !(dst_ctx->flags_id & GNRC_SIXLOWPAN_CTX_FLAGS_COMP)) {
+            dst_ctx = NULL;
+        }
+    }
+
+    /* if contexts available and both != 0 */
+    /* since this moves inline_pos we have to do this ahead*/
+    if (((src_ctx != NULL) &&
+            ((src_ctx->flags_id & GNRC_SIXLOWPAN_CTX_FLAGS_CID_MASK) != 0)) ||
+        ((dst_ctx != NULL) &&
+            ((dst_ctx->flags_id & GNRC_SIXLOWPAN_CTX_FLAGS_CID_MASK) != 0))) {
+        /* add context identifier extension */
+        iphc_hdr[IPHC2_IDX] |= SIXLOWPAN_IPHC2_CID_EXT;
+        iphc_hdr[CID_EXT_IDX] = 0;
+
+        /* move position to behind CID extension */
+        inline_pos += SIXLOWPAN_IPHC_CID_EXT_LEN;
+    }
+
+    inline_pos = _iphc_ipv6_encode_tf_nh_hl(ipv6_hdr, iphc_hdr, inline_pos);
 
+    addr_pos = inline_pos;
     if (ipv6_addr_is_unspecified(&(ipv6_hdr->src))) {
         iphc_hdr[IPHC2_IDX] |= IPHC_SAC_SAM_UNSPEC;
     }
@@ -1150,6 +1324,7 @@ static size_t _iphc_ipv6_encode(gnrc_pktsnip_t *pkt,
         if (src_ctx != NULL) {
             /* stateful source address compression */
             iphc_hdr[IPHC2_IDX] |= SIXLOWPAN_IPHC2_SAC;
+            ctx_deps |= 1U << (src_ctx->flags_id & GNRC_SIXLOWPAN_CTX_FLAGS_CID_MASK);
 
             if (((src_ctx->flags_id & GNRC_SIXLOWPAN_CTX_FLAGS_CID_MASK) != 0)) {
                 iphc_hdr[CID_EXT_IDX] |= ((src_ctx->flags_id & GNRC_SIXLOWPAN_CTX_FLAGS_CID_MASK) << 4);
@@ -1256,6 +1431,7 @@ static size_t _iphc_ipv6_encode(gnrc_pktsnip_t *pkt,
                  * (https://tools.ietf.org/html/rfc3306) with given context
                  * for unicast prefix -> context based compression */
                 iphc_hdr[IPHC2_IDX] |= SIXLOWPAN_IPHC2_DAC;
+                ctx_deps |= 1U << (ctx->flags_id & GNRC_SIXLOWPAN_CTX_FLAGS_CID_MASK);
                 if ((ctx->flags_id & GNRC_SIXLOWPAN_CTX_FLAGS_CID_MASK) != 0) {
                     iphc_hdr[CID_EXT_IDX] |= (ctx->flags_id & GNRC_SIXLOWPAN_CTX_FLAGS_CID_MASK);
                 }
@@ -1274,6 +1450,7 @@ static size_t _iphc_ipv6_encode(gnrc_pktsnip_t *pkt,
         if (dst_ctx != NULL) {
             /* stateful destination address compression */
             iphc_hdr[IPHC2_IDX] |= SIXLOWPAN_IPHC2_DAC;
+            ctx_deps |= 1U << (dst_ctx->flags_id & GNRC_SIXLOWPAN_CTX_FLAGS_CID_MASK);
 
             if (((dst_ctx->flags_id & GNRC_SIXLOWPAN_CTX_FLAGS_CID_MASK) != 0)) {
                 iphc_hdr[CID_EXT_IDX] |= (dst_ctx->flags_id & GNRC_SIXLOWPAN_CTX_FLAGS_CID_MASK);
@@ -1315,6 +1492,8 @@ static size_t _iphc_ipv6_encode(gnrc_pktsnip_t *pkt,
         inline_pos += 16;
     }
 
+    _cache_add(ipv6_hdr, netif_hdr, iface, iphc_hdr, addr_pos, inline_pos,
+               ctx_deps);
     return inline_pos;
 }
 
@@ -41,8 +41,9 @@ gnrc_pktsnip_t *gnrc_pktbuf_reverse_snips(gnrc_pktsnip_t *pkt)
     while (ptr != NULL) {
         gnrc_pktsnip_t *next;
 
-        /* try to write-protect snip as its next-pointer is changed below */
-        pkt = gnrc_pktbuf_start_write(ptr); /* use pkt as temporary variable */
+        /* try to write-protect snip as its next-pointer is changed below,
+         * use pkt as temporary variable */
+        pkt = gnrc_pktbuf_start_write_desc(ptr);
         if (pkt == NULL) {
             gnrc_pktbuf_release(reversed);
             gnrc_pktbuf_release(ptr);
@@ -28,6 +28,7 @@
 #include "log.h"
 #include "mutex.h"
 #include "od.h"
+#include "tracepoint.h"
 #include "utlist.h"
 #include "net/gnrc/pktbuf.h"
 #include "net/gnrc/nettype.h"
@@ -101,6 +102,8 @@ gnrc_pktsnip_t *gnrc_pktbuf_add(gnrc_pktsnip_t *next, const void *data, size_t s
 {
     gnrc_pktsnip_t *pkt;
 
+    TRACEPOINT(pktbuf_alloc, size);
+
     if (size > CONFIG_GNRC_PKTBUF_SIZE) {
         DEBUG("pktbuf: size (%u) > CONFIG_GNRC_PKTBUF_SIZE (%u)\n",
               (unsigned)size, CONFIG_GNRC_PKTBUF_SIZE);
@@ -23,8 +23,10 @@
 #include <stdio.h>
 #include <sys/types.h>
 
+#include "bitarithm.h"
 #include "mutex.h"
 #include "od.h"
+#include "tracepoint.h"
 #include "utlist.h"
 #include "net/gnrc/pktbuf.h"
 #include "net/gnrc/nettype.h"
@@ -32,6 +34,10 @@
 
 #include "pktbuf_internal.h"
 #include "pktbuf_static.h"
+#if IS_USED(MODULE_GNRC_PKTBUF_STATIC_TRACE)
+#include "thread.h"
+#include "ztimer.h"
+#endif
 
 #define ENABLE_DEBUG 0
 #include "debug.h"
@@ -50,11 +56,285 @@
  * (word sized) uintptr_t is a trivial way to do this */
 static uintptr_t _pktbuf_buf[CONFIG_GNRC_PKTBUF_SIZE / sizeof(uintptr_t)];
 uint8_t *gnrc_pktbuf_static_buf = (uint8_t *)_pktbuf_buf;
-static _unused_t *_first_unused;
 
 #ifdef DEVELHELP
 /* maximum number of bytes allocated */
 static uint16_t max_byte_count = 0;
+/* number of bytes currently allocated */
+static uint16_t used_byte_count = 0;
+/* maximum number of bytes allocated at the same time */
+static uint16_t max_used_byte_count = 0;
+#endif
+
+#if IS_USED(MODULE_GNRC_PKTBUF_STATIC_SEGFIT)
+/* The buffer is managed in granules of the size of _unused_t. Free blocks
+ * are kept in one list per power-of-two size class, a bitmap tracks which
+ * classes are non-empty. Allocation takes the head of the smallest class that
+ * is guaranteed to fit, so both allocation and freeing are O(1). */
+#define SEGFIT_GRANULE      (sizeof(_unused_t))
+#define SEGFIT_NUMOF        (sizeof(_pktbuf_buf) / SEGFIT_GRANULE)
+#define SEGFIT_CLASSES      (16U)
+#define SEGFIT_NIL          (UINT16_MAX)
+
+static_assert(SEGFIT_NUMOF < SEGFIT_NIL,
+              "CONFIG_GNRC_PKTBUF_SIZE too large for gnrc_pktbuf_static_segfit");
+
+/**
+ * @brief   Header in the first and footer in the last granule of a free block
+ *
+ * Only the size is valid in the footer (and is at the same position in
+ * both), so that the start of the preceding free block can be found when
+ * coalescing.
+ */
+typedef struct {
+    uint16_t next;  /**< next free block in the same size class */
+    uint16_t prev;  /**< previous free block in the same size class */
+    uint16_t size;  /**< size of the free block in granules */
+} _segfit_blk_t;
+
+static_assert(sizeof(_segfit_blk_t) <= SEGFIT_GRANULE,
+              "free block header must fit into a granule");
+
+/* first free block of each size class */
+static uint16_t _segfit_head[SEGFIT_CLASSES];
+/* bit i set if _segfit_head[i] is not empty */
+static unsigned _segfit_classes;
+/* bit i set if granule i is the first or last granule of a free block */
+static uint32_t _segfit_edge[(SEGFIT_NUMOF + 31) / 32];
+#else
+static _unused_t *_first_unused;
+#endif
+
+static void _free(void *data, size_t size);
+
+/* Trace records are single lines of the form
+ * `pktbuf_trace: <event> <time in ms> <pid> <offset> <size>`, so they can be
+ * filtered from the rest of the output by dist/tools/pktbuf-stats/pktbuf-trace.py
+ *
+ * Events are 'i' (init, size of the buffer), 'a' (alloc), 'f' (free), 'x'
+ * (alloc failed, requested size) and 'r' (realloc, followed by the resulting
+ * allocs and frees). */
+static inline void _trace(char event, const void *ptr, size_t size)
+{
+#if IS_USED(MODULE_GNRC_PKTBUF_STATIC_TRACE)
+    unsigned offset = (ptr) ? (unsigned)((const uint8_t *)ptr -
+                                         gnrc_pktbuf_static_buf) : 0;
+
+    printf("pktbuf_trace: %c %" PRIu32 " %" PRIkernel_pid " %u %u\n", event,
+           ztimer_now(ZTIMER_MSEC), thread_getpid(), offset, (unsigned)size);
+#else
+    (void)event;
+    (void)ptr;
+    (void)size;
+#endif
+}
+
+#if IS_USED(MODULE_GNRC_PKTBUF_EXT)
+/**
+ * @brief   External buffer lent to the packet buffer
+ *
+ * With module `gnrc_pktbuf_cow` data in the packet buffer itself that is
+ * shared by gnrc_pktbuf_start_write_desc() is tracked the same way, with
+ * _ext_t::release being NULL.
+ */
+typedef struct {
+    uint8_t *data;                      /**< start of buffer, NULL if unused */
+    size_t size;                        /**< size of the buffer */
+    gnrc_pktbuf_ext_release_t release;  /**< callback to give it back */
+    void *arg;                          /**< argument for release */
+    unsigned refs;                      /**< number of snips using it */
+} _ext_t;
+
+static _ext_t _ext[CONFIG_GNRC_PKTBUF_EXT_NUMOF];
+
+static _ext_t *_ext_find(const void *ptr)
+{
+    for (unsigned i = 0; i < CONFIG_GNRC_PKTBUF_EXT_NUMOF; i++) {
+        if ((_ext[i].data != NULL) && ((const uint8_t *)ptr >= _ext[i].data) &&
+            ((const uint8_t *)ptr < (_ext[i].data + _ext[i].size))) {
+            return &_ext[i];
+        }
+    }
+    return NULL;
+}
+
+static _ext_t *_ext_alloc(void)
+{
+    for (unsigned i = 0; i < CONFIG_GNRC_PKTBUF_EXT_NUMOF; i++) {
+        if (_ext[i].data == NULL) {
+            return &_ext[i];
+        }
+    }
+    return NULL;
+}
+
+static void _ext_unref(_ext_t *ext)
+{
+    assert(ext->refs > 0);
+    if (--ext->refs == 0) {
+        uint8_t *data = ext->data;
+
+        ext->data = NULL;
+        if (ext->release == NULL) {
+            /* shared data of the packet buffer itself */
+            _free(data, ext->size);
+        }
+        else {
+            ext->release(ext->arg, data);
+        }
+    }
+}
+#endif
+
+static inline bool _is_ext(const void *ptr)
+{
+#if IS_USED(MODULE_GNRC_PKTBUF_EXT)
+    return _ext_find(ptr) != NULL;
+#else
+    (void)ptr;
+    return false;
+#endif
+}
+
+#if IS_USED(MODULE_GNRC_PKTBUF_STATIC_SEGFIT)
+static inline _segfit_blk_t *_segfit_blk(unsigned idx)
+{
+    /* cast via uintptr_t to silence -Wcast-align, granules are aligned */
+    return (_segfit_blk_t *)(uintptr_t)&gnrc_pktbuf_static_buf[idx * SEGFIT_GRANULE];
+}
+
+static inline bool _segfit_is_edge(unsigned idx)
+{
+    return _segfit_edge[idx / 32] & (1UL << (idx % 32));
+}
+
+static inline void _segfit_set_edge(unsigned idx, bool edge)
+{
+    if (edge) {
+        _segfit_edge[idx / 32] |= (1UL << (idx % 32));
+    }
+    else {
+        _segfit_edge[idx / 32] &= ~(1UL << (idx % 32));
+    }
+}
+
+static inline unsigned _segfit_class(unsigned size)
+{
+    return bitarithm_msb(size);
+}
+
+static void _segfit_insert(unsigned idx, unsigned size)
+{
+    _segfit_blk_t *blk = _segfit_blk(idx);
+    unsigned class = _segfit_class(size);
+
+    blk->size = size;
+    blk->prev = SEGFIT_NIL;
+    blk->next = _segfit_head[class];
+    if (blk->next != SEGFIT_NIL) {
+        _segfit_blk(blk->next)->prev = idx;
+    }
+    _segfit_head[class] = idx;
+    _segfit_classes |= (1U << class);
+    _segfit_blk(idx + size - 1)->size = size;
+    _segfit_set_edge(idx, true);
+    _segfit_set_edge(idx + size - 1, true);
+}
+
+static void _segfit_remove(unsigned idx)
+{
+    _segfit_blk_t *blk = _segfit_blk(idx);
+    unsigned size = blk->size;
+    unsigned class = _segfit_class(size);
+
+    if (blk->prev == SEGFIT_NIL) {
+        _segfit_head[class] = blk->next;
+        if (blk->next == SEGFIT_NIL) {
+            _segfit_classes &= ~(1U << class);
+        }
+    }
+    else {
+        _segfit_blk(blk->prev)->next = blk->next;
+    }
+    if (blk->next != SEGFIT_NIL) {
+        _segfit_blk(blk->next)->prev = blk->prev;
+    }
+    _segfit_set_edge(idx, false);
+    _segfit_set_edge(idx + size - 1, false);
+    if (CONFIG_GNRC_PKTBUF_CHECK_USE_AFTER_FREE) {
+        memset(_segfit_blk(idx + size - 1), CANARY, SEGFIT_GRANULE);
+        memset(blk, CANARY, SEGFIT_GRANULE);
+    }
+}
+
+static void _segfit_init(void)
+{
+    memset(_segfit_edge, 0, sizeof(_segfit_edge));
+    for (unsigned i = 0; i < SEGFIT_CLASSES; i++) {
+        _segfit_head[i] = SEGFIT_NIL;
+    }
+    _segfit_classes = 0;
+    _segfit_insert(0, SEGFIT_NUMOF);
+}
+
+static void *_segfit_alloc(size_t size)
+{
+    unsigned num = size / SEGFIT_GRANULE;
+    unsigned class = _segfit_class(num);
+    /* blocks in classes above the one of num are guaranteed to fit */
+    unsigned fits = (num == (1U << class)) ? (1U << class) : (2U << class);
+    unsigned classes = _segfit_classes & ~(fits - 1);
+    unsigned idx = SEGFIT_NIL;
+
+    assert(num > 0);
+    if (classes != 0) {
+        idx = _segfit_head[bitarithm_lsb(classes)];
+    }
+    else if (_segfit_classes & (1U << class)) {
+        /* only blocks of num's own class are left, check if any fits */
+        for (idx = _segfit_head[class]; idx != SEGFIT_NIL;
+             idx = _segfit_blk(idx)->next) {
+            if (_segfit_blk(idx)->size >= num) {
+                break;
+            }
+        }
+    }
+    if (idx == SEGFIT_NIL) {
+        return NULL;
+    }
+
+    unsigned blk_size = _segfit_blk(idx)->size;
+
+    _segfit_remove(idx);
+    if (blk_size > num) {
+        _segfit_insert(idx + num, blk_size - num);
+    }
+    return _segfit_blk(idx);
+}
+
+static void _segfit_free(void *data, size_t size)
+{
+    unsigned idx = ((uint8_t *)data - gnrc_pktbuf_static_buf) / SEGFIT_GRANULE;
+    unsigned num = size / SEGFIT_GRANULE;
+
+    assert(num > 0);
+    assert(idx + num <= SEGFIT_NUMOF);
+    /* coalesce with the free blocks just before and after the freed one */
+    if ((idx > 0) && _segfit_is_edge(idx - 1)) {
+        unsigned prev_size = _segfit_blk(idx - 1)->size;
+
+        idx -= prev_size;
+        num += prev_size;
+        _segfit_remove(idx);
+    }
+    if (((idx + num) < SEGFIT_NUMOF) && _segfit_is_edge(idx + num)) {
+        unsigned next = idx + num;
+
+        num += _segfit_blk(next)->size;
+        _segfit_remove(next);
+    }
+    _segfit_insert(idx, num);
+}
 #endif
 
 /* internal gnrc_pktbuf functions */
@@ -93,9 +373,14 @@ void gnrc_pktbuf_init(void)
     if (CONFIG_GNRC_PKTBUF_CHECK_USE_AFTER_FREE) {
         memset(_pktbuf_buf, CANARY, sizeof(_pktbuf_buf));
     }
+#if IS_USED(MODULE_GNRC_PKTBUF_STATIC_SEGFIT)
+    _segfit_init();
+#else
     _first_unused = (_unused_t *)_pktbuf_buf;
     _first_unused->next = NULL;
     _first_unused->size = sizeof(_pktbuf_buf);
+#endif
+    _trace('i', NULL, sizeof(_pktbuf_buf));
     mutex_unlock(&gnrc_pktbuf_mutex);
 }
 
@@ -104,6 +389,8 @@ gnrc_pktsnip_t *gnrc_pktbuf_add(gnrc_pktsnip_t *next, const void *data, size_t s
 {
     gnrc_pktsnip_t *pkt;
 
+    TRACEPOINT(pktbuf_alloc, size);
+
     if (size > CONFIG_GNRC_PKTBUF_SIZE) {
         DEBUG("pktbuf: size (%u) > CONFIG_GNRC_PKTBUF_SIZE (%u)\n",
               (unsigned)size, CONFIG_GNRC_PKTBUF_SIZE);
@@ -115,6 +402,40 @@ gnrc_pktsnip_t *gnrc_pktbuf_add(gnrc_pktsnip_t *next, const void *data, size_t s
     return pkt;
 }
 
+#if IS_USED(MODULE_GNRC_PKTBUF_EXT)
+gnrc_pktsnip_t *gnrc_pktbuf_add_ext(gnrc_pktsnip_t *next, void *data,
+                                    size_t size, gnrc_nettype_t type,
+                                    gnrc_pktbuf_ext_release_t release,
+                                    void *arg)
+{
+    gnrc_pktsnip_t *pkt;
+    _ext_t *ext;
+
+    assert((data != NULL) && (size > 0) && (release != NULL));
+    mutex_lock(&gnrc_pktbuf_mutex);
+    ext = _ext_alloc();
+    if (ext == NULL) {
+        DEBUG("pktbuf: no slot left for external buffer\n");
+        mutex_unlock(&gnrc_pktbuf_mutex);
+        return NULL;
+    }
+    pkt = _pktbuf_alloc(sizeof(gnrc_pktsnip_t));
+    if (pkt == NULL) {
+        DEBUG("pktbuf: error allocating new packet snip\n");
+        mutex_unlock(&gnrc_pktbuf_mutex);
+        return NULL;
+    }
+    ext->data = data;
+    ext->size = size;
+    ext->release = release;
+    ext->arg = arg;
+    ext->refs = 1;
+    _set_pktsnip(pkt, next, data, size, type);
+    mutex_unlock(&gnrc_pktbuf_mutex);
+    return pkt;
+}
+#endif
+
 gnrc_pktsnip_t *gnrc_pktbuf_mark(gnrc_pktsnip_t *pkt, size_t size, gnrc_nettype_t type)
 {
     gnrc_pktsnip_t *marked_snip;
@@ -139,8 +460,10 @@ gnrc_pktsnip_t *gnrc_pktbuf_mark(gnrc_pktsnip_t *pkt, size_t size, gnrc_nettype_
         return NULL;
     }
     /* marked data would not fit _unused_t marker => move data around to allow
-     * for proper free */
-    if ((pkt->size != size) && (size < required_new_size)) {
+     * for proper free (external data is never freed in parts, so it can
+     * always be split in place) */
+    if ((pkt->size != size) && (size < required_new_size) &&
+        !_is_ext(pkt->data)) {
         void *new_data_rest;
         new_data_marked = _pktbuf_alloc(size);
         if (new_data_marked == NULL) {
@@ -165,6 +488,13 @@ gnrc_pktsnip_t *gnrc_pktbuf_mark(gnrc_pktsnip_t *pkt, size_t size, gnrc_nettype_
     }
     else {
         new_data_marked = pkt->data;
+#if IS_USED(MODULE_GNRC_PKTBUF_EXT)
+        _ext_t *ext = _ext_find(pkt->data);
+        if ((ext != NULL) && (pkt->size != size)) {
+            /* both snips reference the external buffer now */
+            ext->refs++;
+        }
+#endif
         /* if (pkt->size - size) != 0 take remainder of data, otherwise set NULL */
         pkt->data = (pkt->size != size) ? (((uint8_t *)pkt->data) + size) :
                                           NULL;
@@ -183,13 +513,17 @@ int gnrc_pktbuf_realloc_data(gnrc_pktsnip_t *pkt, size_t size)
     mutex_lock(&gnrc_pktbuf_mutex);
     assert(pkt != NULL);
     assert(((pkt->size == 0) && (pkt->data == NULL)) ||
-           ((pkt->size > 0) && (pkt->data != NULL) && gnrc_pktbuf_contains(pkt->data)));
+           ((pkt->size > 0) && (pkt->data != NULL) &&
+            (gnrc_pktbuf_contains(pkt->data) || _is_ext(pkt->data))));
     /* new size and old size are equal */
     if (size == pkt->size) {
         /* nothing to do */
         mutex_unlock(&gnrc_pktbuf_mutex);
         return 0;
     }
+    if (gnrc_pktbuf_contains(pkt->data)) {
+        _trace('r', pkt->data, size);
+    }
     /* new size is 0 and data pointer isn't already NULL */
     if ((size == 0) && (pkt->data != NULL)) {
         /* set data pointer to NULL */
@@ -210,7 +544,8 @@ int gnrc_pktbuf_realloc_data(gnrc_pktsnip_t *pkt, size_t size)
         gnrc_pktbuf_free_internal(pkt->data, pkt->size);
         pkt->data = new_data;
     }
-    else if (_align(pkt->size) > aligned_size) {
+    else if ((_align(pkt->size) > aligned_size) &&
+             gnrc_pktbuf_contains(pkt->data) && !_is_ext(pkt->data)) {
         gnrc_pktbuf_free_internal(((uint8_t *)pkt->data) + aligned_size,
                      pkt->size - aligned_size);
     }
@@ -245,10 +580,60 @@ gnrc_pktsnip_t *gnrc_pktbuf_start_write(gnrc_pktsnip_t *pkt)
         mutex_unlock(&gnrc_pktbuf_mutex);
         return new;
     }
+#if IS_USED(MODULE_GNRC_PKTBUF_COW)
+    _ext_t *ext = (pkt->data != NULL) ? _ext_find(pkt->data) : NULL;
+
+    if ((ext != NULL) && (ext->release == NULL) && (ext->refs > 1)) {
+        /* data is shared with other snips, copy it */
+        void *data = _pktbuf_alloc(pkt->size);
+
+        if (data == NULL) {
+            DEBUG("pktbuf: error allocating data for shared packet snip\n");
+            mutex_unlock(&gnrc_pktbuf_mutex);
+            return NULL;
+        }
+        memcpy(data, pkt->data, pkt->size);
+        _ext_unref(ext);
+        pkt->data = data;
+    }
+#endif
     mutex_unlock(&gnrc_pktbuf_mutex);
     return pkt;
 }
 
+#if IS_USED(MODULE_GNRC_PKTBUF_COW)
+gnrc_pktsnip_t *gnrc_pktbuf_start_write_desc(gnrc_pktsnip_t *pkt)
+{
+    mutex_lock(&gnrc_pktbuf_mutex);
+    if ((pkt != NULL) && (pkt->users > 1) && (pkt->data != NULL)) {
+        _ext_t *ext = _ext_find(pkt->data);
+
+        if ((ext == NULL) && ((ext = _ext_alloc()) != NULL)) {
+            /* start tracking the data, so it is only freed with its last
+             * snip */
+            ext->data = pkt->data;
+            ext->size = pkt->size;
+            ext->release = NULL;
+            ext->refs = 1;
+        }
+        if (ext != NULL) {
+            gnrc_pktsnip_t *new = _pktbuf_alloc(sizeof(gnrc_pktsnip_t));
+
+            if (new != NULL) {
+                _set_pktsnip(new, pkt->next, pkt->data, pkt->size, pkt->type);
+                ext->refs++;
+                pkt->users--;
+            }
+            mutex_unlock(&gnrc_pktbuf_mutex);
+            return new;
+        }
+        DEBUG("pktbuf: no slot left to share data, copy it\n");
+    }
+    mutex_unlock(&gnrc_pktbuf_mutex);
+    return gnrc_pktbuf_start_write(pkt);
+}
+#endif
+
 #ifdef DEVELHELP
 #ifdef MODULE_OD
 static inline void _print_chunk(void *chunk, size_t size, int num)
@@ -258,6 +643,32 @@ static inline void _print_chunk(void *chunk, size_t size, int num)
     od_hex_dump(chunk, size, OD_WIDTH_DEFAULT);
 }
 
+#if IS_USED(MODULE_GNRC_PKTBUF_STATIC_SEGFIT)
+static void _print_segfit(void)
+{
+    unsigned idx = 0;
+    int count = 0;
+
+    while (idx < SEGFIT_NUMOF) {
+        unsigned start = idx;
+
+        if (_segfit_is_edge(idx)) {
+            _segfit_blk_t *blk = _segfit_blk(idx);
+
+            printf("~ unused: %p (class: %2u, size: %4u) ~\n", (void *)blk,
+                   _segfit_class(blk->size),
+                   (unsigned)(blk->size * SEGFIT_GRANULE));
+            idx += blk->size;
+            continue;
+        }
+        while ((idx < SEGFIT_NUMOF) && !_segfit_is_edge(idx)) {
+            idx++;
+        }
+        _print_chunk(_segfit_blk(start), (idx - start) * SEGFIT_GRANULE,
+                     count++);
+    }
+}
+#else
 static inline void _print_ptr(_unused_t *ptr)
 {
     if (ptr == NULL) {
@@ -277,19 +688,25 @@ static inline void _print_unused(_unused_t *ptr)
     printf(", size: %4u) ~\n", ptr->size);
 }
 #endif
+#endif
 
 void gnrc_pktbuf_stats(void)
 {
 #ifdef MODULE_OD
-    _unused_t *ptr = _first_unused;
-    uint8_t *chunk = &gnrc_pktbuf_static_buf[0];
-    int count = 0;
-
     printf("packet buffer: first byte: %p, last byte: %p (size: %u)\n",
            (void *)&gnrc_pktbuf_static_buf[0],
            (void *)&gnrc_pktbuf_static_buf[CONFIG_GNRC_PKTBUF_SIZE],
            CONFIG_GNRC_PKTBUF_SIZE);
     printf("  position of last byte used: %" PRIu16 "\n", max_byte_count);
+    printf("  bytes in use: %" PRIu16 " (high-water mark: %" PRIu16 ")\n",
+           used_byte_count, max_used_byte_count);
+#if IS_USED(MODULE_GNRC_PKTBUF_STATIC_SEGFIT)
+    _print_segfit();
+#else
+    _unused_t *ptr = _first_unused;
+    uint8_t *chunk = &gnrc_pktbuf_static_buf[0];
+    int count = 0;
+
     if (ptr == NULL) {  /* packet buffer is completely full */
         _print_chunk(chunk, CONFIG_GNRC_PKTBUF_SIZE, count++);
     }
@@ -316,13 +733,72 @@ void gnrc_pktbuf_stats(void)
     if (chunk <= &gnrc_pktbuf_static_buf[CONFIG_GNRC_PKTBUF_SIZE - 1]) {
         _print_chunk(chunk, &gnrc_pktbuf_static_buf[CONFIG_GNRC_PKTBUF_SIZE] - chunk, count);
     }
+#endif
 #else
     DEBUG("pktbuf: needs od module\n");
 #endif
 }
+
+size_t gnrc_pktbuf_get_high_water_mark(void)
+{
+    return max_used_byte_count;
+}
+
+void gnrc_pktbuf_reset_high_water_mark(void)
+{
+    mutex_lock(&gnrc_pktbuf_mutex);
+    max_used_byte_count = used_byte_count;
+    mutex_unlock(&gnrc_pktbuf_mutex);
+}
 #endif
 
 #ifdef TEST_SUITES
+#if IS_USED(MODULE_GNRC_PKTBUF_STATIC_SEGFIT)
+bool gnrc_pktbuf_is_empty(void)
+{
+    return _segfit_is_edge(0) && (_segfit_blk(0)->size == SEGFIT_NUMOF);
+}
+
+bool gnrc_pktbuf_is_sane(void)
+{
+    /* Invariants of this implementation:
+     *  - a size class is marked in _segfit_classes iff its list is not empty
+     *  - forall blk in the list of class c: class(blk->size) == c,
+     *      blk lies within the packet buffer, prev links are consistent
+     *  - forall blk: its first and last granules are marked as edge and the
+     *      footer's size matches the header's
+     *  - no two free blocks are adjacent (they are always coalesced)
+     */
+    for (unsigned c = 0; c < SEGFIT_CLASSES; c++) {
+        unsigned prev = SEGFIT_NIL;
+
+        if (!(_segfit_classes & (1U << c)) != (_segfit_head[c] == SEGFIT_NIL)) {
+            return false;
+        }
+        for (unsigned idx = _segfit_head[c]; idx != SEGFIT_NIL;
+             idx = _segfit_blk(idx)->next) {
+            _segfit_blk_t *blk = _segfit_blk(idx);
+            unsigned end = idx + blk->size;
+
+            if ((idx >= SEGFIT_NUMOF) || (blk->size == 0) ||
+                (end > SEGFIT_NUMOF) || (_segfit_class(blk->size) != c) ||
+                (blk->prev != prev)) {
+                return false;
+            }
+            if (!_segfit_is_edge(idx) || !_segfit_is_edge(end - 1) ||
+                (_segfit_blk(end - 1)->size != blk->size)) {
+                return false;
+            }
+            if ((end < SEGFIT_NUMOF) && _segfit_is_edge(end)) {
+                return false;
+            }
+            prev = idx;
+        }
+    }
+
+    return true;
+}
+#else
 bool gnrc_pktbuf_is_empty(void)
 {
     return ((uintptr_t)_first_unused == (uintptr_t)gnrc_pktbuf_static_buf) &&
@@ -363,6 +839,7 @@ bool gnrc_pktbuf_is_sane(void)
     return true;
 }
 #endif
+#endif
 
 static gnrc_pktsnip_t *_create_snip(gnrc_pktsnip_t *next, const void *data, size_t size,
                                     gnrc_nettype_t type)
@@ -389,17 +866,16 @@ static gnrc_pktsnip_t *_create_snip(gnrc_pktsnip_t *next, const void *data, size
     return pkt;
 }
 
-static void *_pktbuf_alloc(size_t size)
+#if !IS_USED(MODULE_GNRC_PKTBUF_STATIC_SEGFIT)
+static void *_first_fit_alloc(size_t size)
 {
     _unused_t *prev = NULL, *ptr = _first_unused;
 
-    size = _align(size);
     while (ptr && (size > ptr->size)) {
         prev = ptr;
         ptr = ptr->next;
     }
     if (ptr == NULL) {
-        DEBUG("pktbuf: no space left in packet buffer\n");
         return NULL;
     }
     /* _unused_t struct would fit => add new space at ptr */
@@ -430,7 +906,31 @@ static void *_pktbuf_alloc(size_t size)
         new->next = ptr->next;
         new->size = ptr->size - size;
     }
+    return ptr;
+}
+#endif
+
+static void *_pktbuf_alloc(size_t size)
+{
+    _unused_t *ptr;
+
+    size = _align(size);
+#if IS_USED(MODULE_GNRC_PKTBUF_STATIC_SEGFIT)
+    ptr = _segfit_alloc(size);
+#else
+    ptr = _first_fit_alloc(size);
+#endif
+    if (ptr == NULL) {
+        DEBUG("pktbuf: no space left in packet buffer\n");
+        _trace('x', NULL, size);
+        return NULL;
+    }
+    _trace('a', ptr, size);
 #ifdef DEVELHELP
+    used_byte_count += size;
+    if (used_byte_count > max_used_byte_count) {
+        max_used_byte_count = used_byte_count;
+    }
     uint16_t last_byte = (uint16_t)((((uint8_t *)ptr) + size) - &(gnrc_pktbuf_static_buf[0]));
     if (last_byte > max_byte_count) {
         max_byte_count = last_byte;
@@ -451,6 +951,7 @@ static void *_pktbuf_alloc(size_t size)
     return (void *)ptr;
 }
 
+#if !IS_USED(MODULE_GNRC_PKTBUF_STATIC_SEGFIT)
 static inline bool _too_small_hole(_unused_t *a, _unused_t *b)
 {
     return sizeof(_unused_t) > (size_t)(((uint8_t *)b) - (((uint8_t *)a) + a->size));
@@ -468,25 +969,17 @@ static inline _unused_t *_merge(_unused_t *a, _unused_t *b)
     return a;
 }
 
-void gnrc_pktbuf_free_internal(void *data, size_t size)
+static void _first_fit_free(void *data, size_t size)
 {
     size_t bytes_at_end;
     _unused_t *new = (_unused_t *)data, *prev = NULL, *ptr = _first_unused;
 
-    if (!gnrc_pktbuf_contains(data)) {
-        return;
-    }
-
-    if (CONFIG_GNRC_PKTBUF_CHECK_USE_AFTER_FREE) {
-        memset(data, CANARY, _align(size));
-    }
-
     while (ptr && (((void *)ptr) < data)) {
         prev = ptr;
         ptr = ptr->next;
     }
     new->next = ptr;
-    new->size = _align(size);
+    new->size = size;
     /* calculate number of bytes between new _unused_t chunk and end of packet
      * buffer */
     bytes_at_end = ((&gnrc_pktbuf_static_buf[0] + CONFIG_GNRC_PKTBUF_SIZE)
@@ -509,5 +1002,39 @@ void gnrc_pktbuf_free_internal(void *data, size_t size)
         _merge(new, new->next);
     }
 }
+#endif
+
+void gnrc_pktbuf_free_internal(void *data, size_t size)
+{
+#if IS_USED(MODULE_GNRC_PKTBUF_EXT)
+    _ext_t *ext = (data != NULL) ? _ext_find(data) : NULL;
+
+    if (ext != NULL) {
+        _ext_unref(ext);
+        return;
+    }
+#endif
+    if (!gnrc_pktbuf_contains(data)) {
+        return;
+    }
+    _free(data, size);
+}
+
+static void _free(void *data, size_t size)
+{
+    size = _align(size);
+    _trace('f', data, size);
+    if (CONFIG_GNRC_PKTBUF_CHECK_USE_AFTER_FREE) {
+        memset(data, CANARY, size);
+    }
+#ifdef DEVELHELP
+    used_byte_count -= size;
+#endif
+#if IS_USED(MODULE_GNRC_PKTBUF_STATIC_SEGFIT)
+    _segfit_free(data, size);
+#else
+    _first_fit_free(data, size);
+#endif
+}
 
 /** @} */
@@ -42,6 +42,10 @@
 #include "net/gnrc/rpl.h"
 #include "gnrc_rpl_internal/validation.h"
 
+#ifdef MODULE_GNRC_RPL_SRH_ROUTES
+#include "net/gnrc/rpl/srh_routes.h"
+#endif
+
 #ifdef MODULE_GNRC_RPL_P2P
 #include "net/gnrc/rpl/p2p_structs.h"
 #include "net/gnrc/rpl/p2p_dodag.h"
@@ -650,6 +654,37 @@ bool _parse_options(int msg_type, gnrc_rpl_instance_t *inst, gnrc_rpl_opt_t *opt
                     break;
                 }
 
+#ifdef MODULE_GNRC_RPL_SRH_ROUTES
+                /* in non-storing mode the transit option carries the DAO
+                 * parent of the targets: keep it in the source route store */
+                if ((inst->mop == GNRC_RPL_MOP_NON_STORING_MODE) &&
+                    (transit->length >= (sizeof(*transit) - sizeof(gnrc_rpl_opt_t) +
+                                         sizeof(ipv6_addr_t)))) {
+                    gnrc_rpl_opt_target_t *t = first_target;
+                    uint32_t lifetime = (transit->path_lifetime == UINT8_MAX)
+                                      ? UINT32_MAX
+                                      : ((uint32_t)transit->path_lifetime *
+                                         dodag->lifetime_unit);
+                    ipv6_addr_t parent;
+
+                    memcpy(&parent, transit + 1, sizeof(parent));
+                    do {
+                        if (t->prefix_length == IPV6_ADDR_BIT_LEN) {
+                            int res = gnrc_rpl_srh_routes_add(&t->target, &parent,
+                                                              lifetime);
+
+                            DEBUG("RPL: updating source route to %s (%d)\n",
+                                  ipv6_addr_to_str(addr_str, &(t->target),
+                                                   sizeof(addr_str)), res);
+                            (void)res;
+                        }
+                        t = (gnrc_rpl_opt_target_t *) (((uint8_t *) (t)) +
+                            sizeof(gnrc_rpl_opt_t) + t->length);
+                    }
+                    while (t->type == GNRC_RPL_OPT_TARGET);
+                }
+#endif
+
                 do {
                     DEBUG("RPL: updating FT entry %s/%d\n",
                           ipv6_addr_to_str(addr_str, &(first_target->target), sizeof(addr_str)),
@@ -730,6 +765,58 @@ void gnrc_rpl_recv_DIS(gnrc_rpl_dis_t *dis, kernel_pid_t iface, ipv6_addr_t *src
     }
 }
 
+/**
+ * @brief   Handles a DIO that is consistent with what its sender advertised
+ *          before, without parsing it any further
+ *
+ * Only DIOs of a known non-preferred parent with unchanged DODAG, version, MOP
+ * and rank qualify. Their full processing only counts them for trickle and
+ * restarts the lifetime of the parent: options are only parsed for the
+ * preferred parent, and with the ranks of all parents unchanged the preferred
+ * parent stays the same.
+ *
+ * @return  true, if the DIO was handled
+ * @return  false, if it needs full processing
+ */
+static bool _recv_DIO_consistent(const gnrc_rpl_dio_t *dio, const ipv6_addr_t *src)
+{
+    gnrc_rpl_instance_t *inst = gnrc_rpl_instance_get(dio->instance_id);
+
+    if (inst == NULL) {
+        return false;
+    }
+
+    gnrc_rpl_dodag_t *dodag = &inst->dodag;
+    uint16_t rank = byteorder_ntohs(dio->rank);
+
+    if ((dodag->node_status == GNRC_RPL_ROOT_NODE) ||
+#ifdef MODULE_GNRC_RPL_P2P
+        (inst->mop == GNRC_RPL_P2P_MOP) ||
+#endif
+        (rank == GNRC_RPL_INFINITE_RANK) ||
+        (dio->version_number != dodag->version) ||
+        (inst->mop != ((dio->g_mop_prf >> GNRC_RPL_MOP_SHIFT) & GNRC_RPL_SHIFTED_MOP_MASK)) ||
+        !ipv6_addr_equal(&dodag->dodag_id, &dio->dodag_id)) {
+        return false;
+    }
+
+    gnrc_rpl_parent_t *parent;
+
+    for (parent = dodag->parents; parent != NULL; parent = parent->next) {
+        if (ipv6_addr_equal(&parent->addr, src)) {
+            break;
+        }
+    }
+    if ((parent == NULL) || (parent == dodag->parents) ||
+        (parent->state != GNRC_RPL_PARENT_ACTIVE) || (parent->rank != rank)) {
+        return false;
+    }
+
+    trickle_increment_counter(&dodag->trickle);
+    gnrc_rpl_parent_refresh(dodag, parent);
+    return true;
+}
+
 void gnrc_rpl_recv_DIO(gnrc_rpl_dio_t *dio, kernel_pid_t iface, ipv6_addr_t *src, ipv6_addr_t *dst,
                        uint16_t len)
 {
@@ -747,6 +834,15 @@ void gnrc_rpl_recv_DIO(gnrc_rpl_dio_t *dio, kernel_pid_t iface, ipv6_addr_t *src
         }
     }
 
+    if (_recv_DIO_consistent(dio, src)) {
+        DEBUG("RPL: consistent DIO from %s\n",
+              ipv6_addr_to_str(addr_str, src, sizeof(addr_str)));
+#ifdef MODULE_NETSTATS_RPL
+        gnrc_rpl_netstats.dio_consistent++;
+#endif
+        return;
+    }
+
     len -= (sizeof(gnrc_rpl_dio_t) + sizeof(icmpv6_hdr_t));
 
     if (gnrc_rpl_instance_add(dio->instance_id, &inst)) {
@@ -283,15 +283,20 @@ void gnrc_rpl_local_repair(gnrc_rpl_dodag_t *dodag)
     }
 }
 
+void gnrc_rpl_parent_refresh(gnrc_rpl_dodag_t *dodag, gnrc_rpl_parent_t *parent)
+{
+    parent->state = GNRC_RPL_PARENT_ACTIVE;
+    evtimer_del((evtimer_t *)(&gnrc_rpl_evtimer), (evtimer_event_t *)&parent->timeout_event);
+    ((evtimer_event_t *)&(parent->timeout_event))->offset = (dodag->default_lifetime - 1) * dodag->lifetime_unit * MS_PER_SEC;
+    parent->timeout_event.msg.type = GNRC_RPL_MSG_TYPE_PARENT_TIMEOUT;
+    evtimer_add_msg(&gnrc_rpl_evtimer, &parent->timeout_event, gnrc_rpl_pid);
+}
+
 void gnrc_rpl_parent_update(gnrc_rpl_dodag_t *dodag, gnrc_rpl_parent_t *parent)
 {
     /* update Parent lifetime */
     if ((parent != NULL) && (parent->state != GNRC_RPL_PARENT_UNUSED)) {
-        parent->state = GNRC_RPL_PARENT_ACTIVE;
-        evtimer_del((evtimer_t *)(&gnrc_rpl_evtimer), (evtimer_event_t *)&parent->timeout_event);
-        ((evtimer_event_t *)&(parent->timeout_event))->offset = (dodag->default_lifetime - 1) * dodag->lifetime_unit * MS_PER_SEC;
-        parent->timeout_event.msg.type = GNRC_RPL_MSG_TYPE_PARENT_TIMEOUT;
-        evtimer_add_msg(&gnrc_rpl_evtimer, &parent->timeout_event, gnrc_rpl_pid);
+        gnrc_rpl_parent_refresh(dodag, parent);
 #ifdef MODULE_GNRC_RPL_P2P
         if (dodag->instance->mop != GNRC_RPL_P2P_MOP) {
 #endif
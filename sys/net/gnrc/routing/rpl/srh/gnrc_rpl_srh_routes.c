@@ -0,0 +1,299 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     net_gnrc_rpl_srh_routes
+ * @{
+ *
+ * @file
+ * @brief       Implementation of the RPL source route store
+ * @}
+ */
+#include "kernel_defines.h"
+
+#if IS_USED(MODULE_GNRC_RPL_SRH_ROUTES)
+#include <assert.h>
+#include <errno.h>
+#include <string.h>
+
+#include "mutex.h"
+#include "net/gnrc/netif/internal.h"
+#include "net/gnrc/rpl/srh_routes.h"
+#include "time_units.h"
+#include "ztimer.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+#define IID_LEN     (sizeof(ipv6_addr_t) / 2)
+
+#define IDX_ROOT    (0xffffU)   /**< parent is the root */
+#define IDX_NONE    (0xfffeU)   /**< parent is unknown / end of a list */
+#define IDX_FREE    (0xfffdU)   /**< entry is unused */
+
+#define LIFETIME_MAX    (INT32_MAX / MS_PER_SEC)
+
+static_assert(CONFIG_GNRC_RPL_SRH_ROUTES_NUMOF < IDX_FREE,
+              "CONFIG_GNRC_RPL_SRH_ROUTES_NUMOF too large");
+static_assert((CONFIG_GNRC_RPL_SRH_ROUTES_BUCKETS &
+               (CONFIG_GNRC_RPL_SRH_ROUTES_BUCKETS - 1)) == 0,
+              "CONFIG_GNRC_RPL_SRH_ROUTES_BUCKETS must be a power of two");
+
+typedef struct {
+    uint8_t iid[IID_LEN];   /**< interface identifier of the node */
+    uint32_t expires;       /**< end of lifetime in ms, 0 for infinite */
+    uint16_t parent;        /**< index of the DAO parent */
+    uint16_t next;          /**< next entry in the bucket or free list */
+} _route_t;
+
+static mutex_t _lock = MUTEX_INIT;
+static _route_t _routes[CONFIG_GNRC_RPL_SRH_ROUTES_NUMOF];
+static uint16_t _buckets[CONFIG_GNRC_RPL_SRH_ROUTES_BUCKETS];
+static uint8_t _prefix[IID_LEN];
+static uint16_t _free;
+static unsigned _numof;
+static bool _inited;
+
+static void _init(void)
+{
+    for (unsigned i = 0; i < ARRAY_SIZE(_buckets); i++) {
+        _buckets[i] = IDX_NONE;
+    }
+    for (unsigned i = 0; i < ARRAY_SIZE(_routes); i++) {
+        _routes[i].parent = IDX_FREE;
+        _routes[i].next = (i + 1 < ARRAY_SIZE(_routes)) ? (i + 1) : IDX_NONE;
+    }
+    _free = 0;
+    _numof = 0;
+    _inited = true;
+}
+
+static unsigned _hash(const uint8_t *iid)
+{
+    uint32_t hash = 0;
+
+    for (unsigned i = 0; i < IID_LEN; i++) {
+        hash = (hash * 31) + iid[i];
+    }
+    return hash & (CONFIG_GNRC_RPL_SRH_ROUTES_BUCKETS - 1);
+}
+
+static bool _expired(const _route_t *route, uint32_t now)
+{
+    return (route->expires != 0) && ((int32_t)(route->expires - now) <= 0);
+}
+
+static uint16_t _find(const ipv6_addr_t *addr)
+{
+    if ((_numof == 0) || (memcmp(addr->u8, _prefix, IID_LEN) != 0)) {
+        return IDX_NONE;
+    }
+    for (uint16_t i = _buckets[_hash(&addr->u8[IID_LEN])]; i != IDX_NONE;
+         i = _routes[i].next) {
+        if (memcmp(_routes[i].iid, &addr->u8[IID_LEN], IID_LEN) == 0) {
+            return i;
+        }
+    }
+    return IDX_NONE;
+}
+
+static void _remove(uint16_t idx)
+{
+    uint16_t *next = &_buckets[_hash(_routes[idx].iid)];
+
+    while (*next != idx) {
+        assert(*next != IDX_NONE);
+        next = &_routes[*next].next;
+    }
+    *next = _routes[idx].next;
+    /* orphan the children of the node */
+    for (unsigned i = 0; i < ARRAY_SIZE(_routes); i++) {
+        if (_routes[i].parent == idx) {
+            _routes[i].parent = IDX_NONE;
+        }
+    }
+    _routes[idx].parent = IDX_FREE;
+    _routes[idx].next = _free;
+    _free = idx;
+    _numof--;
+}
+
+static uint32_t _expires(uint32_t lifetime, uint32_t now)
+{
+    uint32_t expires;
+
+    if (lifetime == UINT32_MAX) {
+        return 0;
+    }
+    if (lifetime > LIFETIME_MAX) {
+        lifetime = LIFETIME_MAX;
+    }
+    expires = now + (lifetime * MS_PER_SEC);
+    /* 0 is reserved for infinite lifetimes */
+    return (expires == 0) ? 1 : expires;
+}
+
+static uint16_t _alloc(const ipv6_addr_t *addr, uint32_t expires, uint32_t now)
+{
+    uint16_t idx;
+
+    if (_free == IDX_NONE) {
+        /* reclaim the first expired node */
+        for (idx = 0; idx < ARRAY_SIZE(_routes); idx++) {
+            if (_expired(&_routes[idx], now)) {
+                DEBUG("gnrc_rpl_srh_routes: reclaim expired entry %u\n", idx);
+                _remove(idx);
+                break;
+            }
+        }
+        if (_free == IDX_NONE) {
+            return IDX_NONE;
+        }
+    }
+    if (_numof == 0) {
+        memcpy(_prefix, addr->u8, IID_LEN);
+    }
+    idx = _free;
+    _free = _routes[idx].next;
+    memcpy(_routes[idx].iid, &addr->u8[IID_LEN], IID_LEN);
+    _routes[idx].parent = IDX_NONE;
+    _routes[idx].expires = expires;
+    _routes[idx].next = _buckets[_hash(_routes[idx].iid)];
+    _buckets[_hash(_routes[idx].iid)] = idx;
+    _numof++;
+    return idx;
+}
+
+int gnrc_rpl_srh_routes_add(const ipv6_addr_t *target,
+                            const ipv6_addr_t *parent, uint32_t lifetime)
+{
+    uint32_t now = ztimer_now(ZTIMER_MSEC);
+    uint32_t expires = _expires(lifetime, now);
+    uint16_t target_idx, parent_idx = IDX_ROOT;
+    int res = 0;
+
+    assert((target != NULL) && (parent != NULL));
+    if (lifetime == 0) {
+        gnrc_rpl_srh_routes_del(target);
+        return 0;
+    }
+    if (ipv6_addr_equal(target, parent)) {
+        return -EINVAL;
+    }
+    mutex_lock(&_lock);
+    if (!_inited) {
+        _init();
+    }
+    if ((_numof > 0) && (memcmp(target->u8, _prefix, IID_LEN) != 0)) {
+        res = -ENOTSUP;
+        goto out;
+    }
+    if ((target_idx = _find(target)) == IDX_NONE) {
+        if ((target_idx = _alloc(target, expires, now)) == IDX_NONE) {
+            res = -ENOMEM;
+            goto out;
+        }
+    }
+    if (gnrc_netif_get_by_ipv6_addr(parent) == NULL) {
+        if ((_numof > 0) && (memcmp(parent->u8, _prefix, IID_LEN) != 0)) {
+            res = -ENOTSUP;
+            goto out;
+        }
+        if ((parent_idx = _find(parent)) == IDX_NONE) {
+            /* parent did not report its own route yet: keep a placeholder
+             * that lives as long as the route of its child */
+            if ((parent_idx = _alloc(parent, expires, now)) == IDX_NONE) {
+                res = -ENOMEM;
+                goto out;
+            }
+        }
+        /* reject loops */
+        for (uint16_t i = parent_idx; i < IDX_NONE; i = _routes[i].parent) {
+            if (i == target_idx) {
+                res = -EINVAL;
+                goto out;
+            }
+        }
+    }
+    _routes[target_idx].parent = parent_idx;
+    _routes[target_idx].expires = expires;
+out:
+    mutex_unlock(&_lock);
+    DEBUG("gnrc_rpl_srh_routes: add route (%d), %u entries\n", res, _numof);
+    return res;
+}
+
+void gnrc_rpl_srh_routes_del(const ipv6_addr_t *target)
+{
+    uint16_t idx;
+
+    assert(target != NULL);
+    mutex_lock(&_lock);
+    if (_inited && ((idx = _find(target)) != IDX_NONE)) {
+        _remove(idx);
+    }
+    mutex_unlock(&_lock);
+}
+
+int gnrc_rpl_srh_routes_path(const ipv6_addr_t *target, ipv6_addr_t *hops,
+                             unsigned max_hops)
+{
+    uint32_t now = ztimer_now(ZTIMER_MSEC);
+    unsigned numof = 0;
+    uint16_t idx;
+    int res;
+
+    assert((target != NULL) && ((hops != NULL) || (max_hops == 0)));
+    mutex_lock(&_lock);
+    if (!_inited || ((idx = _find(target)) == IDX_NONE)) {
+        res = -ENOENT;
+        goto out;
+    }
+    /* count the hops first, the path is filled from the target upwards */
+    for (uint16_t i = idx; i != IDX_ROOT; i = _routes[i].parent) {
+        if ((i == IDX_NONE) || _expired(&_routes[i], now) ||
+            (numof >= _numof)) {
+            res = -ENOENT;
+            goto out;
+        }
+        numof++;
+    }
+    if (numof > max_hops) {
+        res = -ENOSPC;
+        goto out;
+    }
+    res = numof;
+    for (uint16_t i = idx; i != IDX_ROOT; i = _routes[i].parent) {
+        ipv6_addr_t *hop = &hops[--numof];
+
+        memcpy(hop->u8, _prefix, IID_LEN);
+        memcpy(&hop->u8[IID_LEN], _routes[i].iid, IID_LEN);
+    }
+out:
+    mutex_unlock(&_lock);
+    return res;
+}
+
+void gnrc_rpl_srh_routes_clear(void)
+{
+    mutex_lock(&_lock);
+    _init();
+    mutex_unlock(&_lock);
+}
+
+void gnrc_rpl_srh_routes_stats(gnrc_rpl_srh_routes_stats_t *stats)
+{
+    assert(stats != NULL);
+    stats->numof = _numof;
+    stats->max = ARRAY_SIZE(_routes);
+    stats->route_size = sizeof(_route_t);
+    stats->total_size = sizeof(_routes) + sizeof(_buckets) + sizeof(_prefix);
+}
+#else   /* IS_USED(MODULE_GNRC_RPL_SRH_ROUTES) */
+typedef int dont_be_pedantic;
+#endif  /* IS_USED(MODULE_GNRC_RPL_SRH_ROUTES) */
@@ -17,6 +17,7 @@
 #include <errno.h>
 #include <stdlib.h>
 
+#include "irq.h"
 #include "log.h"
 #include "net/af.h"
 #include "net/ipv6/hdr.h"
@@ -41,7 +42,114 @@ extern gnrc_pktsnip_t *gnrc_pktbuf_fuzzptr;
 gnrc_pktsnip_t *gnrc_sock_prevpkt = NULL;
 #endif
 
-#if IS_USED(MODULE_XTIMER) || IS_USED(MODULE_ZTIMER_USEC)
+#if IS_USED(MODULE_GNRC_SOCK_ASYNC_ONLY) && IS_USED(MODULE_GNRC_SOCK_PKTQUEUE)
+#error "gnrc_sock_async_only and gnrc_sock_pktqueue are mutually exclusive"
+#endif
+
+#if IS_USED(MODULE_GNRC_SOCK_ASYNC_ONLY)
+#ifndef SOCK_HAS_ASYNC
+#error "gnrc_sock_async_only requires an asynchronous sock API (e.g. sock_async_event)"
+#endif
+static_assert(GNRC_SOCK_MBOX_SIZE <= UINT8_MAX,
+              "GNRC_SOCK_MBOX_SIZE too large for gnrc_sock_async_only");
+
+static bool _pkt_queue_put(gnrc_sock_reg_t *reg, gnrc_pktsnip_t *pkt)
+{
+    bool res = false;
+    unsigned state = irq_disable();
+
+    if (reg->pkt_queue_avail < GNRC_SOCK_MBOX_SIZE) {
+        unsigned idx = (reg->pkt_queue_start + reg->pkt_queue_avail) &
+                       (GNRC_SOCK_MBOX_SIZE - 1);
+
+        reg->pkt_queue[idx] = pkt;
+        reg->pkt_queue_avail++;
+        res = true;
+    }
+    irq_restore(state);
+    return res;
+}
+
+static gnrc_pktsnip_t *_pkt_queue_get(gnrc_sock_reg_t *reg)
+{
+    gnrc_pktsnip_t *pkt = NULL;
+    unsigned state = irq_disable();
+
+    if (reg->pkt_queue_avail > 0) {
+        pkt = reg->pkt_queue[reg->pkt_queue_start];
+        reg->pkt_queue_start = (reg->pkt_queue_start + 1) &
+                               (GNRC_SOCK_MBOX_SIZE - 1);
+        reg->pkt_queue_avail--;
+    }
+    irq_restore(state);
+    return pkt;
+}
+#elif IS_USED(MODULE_GNRC_SOCK_PKTQUEUE)
+/**
+ * @brief   Data of the snip prepended to a queued packet
+ */
+typedef struct {
+    gnrc_pktsnip_t *next;   /**< snip prepended to the next packet */
+    size_t len;             /**< length of the packet */
+} _pkt_link_t;
+
+static bool _pkt_queue_put(gnrc_sock_reg_t *reg, gnrc_pktsnip_t *pkt)
+{
+    size_t len = gnrc_pkt_len(pkt);
+    gnrc_pktsnip_t *link = gnrc_pktbuf_add(pkt, NULL, sizeof(_pkt_link_t),
+                                           GNRC_NETTYPE_UNDEF);
+
+    if (link == NULL) {
+        return false;
+    }
+
+    _pkt_link_t *data = link->data;
+    data->next = NULL;
+    data->len = len;
+
+    unsigned state = irq_disable();
+    /* a packet larger than the limit still fits an empty queue */
+    if ((reg->pkt_bytes > 0) &&
+        ((reg->pkt_bytes + len) > CONFIG_GNRC_SOCK_RCVBUF_SIZE)) {
+        irq_restore(state);
+        gnrc_pktbuf_remove_snip(link, link);
+        return false;
+    }
+    if (reg->pkt_tail == NULL) {
+        reg->pkt_head = link;
+    }
+    else {
+        ((_pkt_link_t *)reg->pkt_tail->data)->next = link;
+    }
+    reg->pkt_tail = link;
+    reg->pkt_bytes += len;
+    irq_restore(state);
+
+    mutex_unlock(&reg->pkt_ready);
+    return true;
+}
+
+static gnrc_pktsnip_t *_pkt_queue_get(gnrc_sock_reg_t *reg)
+{
+    unsigned state = irq_disable();
+    gnrc_pktsnip_t *link = reg->pkt_head;
+
+    if (link == NULL) {
+        irq_restore(state);
+        return NULL;
+    }
+
+    _pkt_link_t *data = link->data;
+    reg->pkt_head = data->next;
+    if (reg->pkt_head == NULL) {
+        reg->pkt_tail = NULL;
+    }
+    reg->pkt_bytes -= data->len;
+    irq_restore(state);
+
+    return gnrc_pktbuf_remove_snip(link, link);
+}
+#elif IS_USED(MODULE_XTIMER) || IS_USED(MODULE_ZTIMER_USEC)
 #define _TIMEOUT_MAGIC      (0xF38A0B63U)
 #define _TIMEOUT_MSG_TYPE   (0x8474)
 
@@ -58,13 +166,24 @@ static void _callback_put(void *arg)
 }
 #endif
 
-#ifdef SOCK_HAS_ASYNC
+#if defined(SOCK_HAS_ASYNC) || IS_USED(MODULE_GNRC_SOCK_PKTQUEUE)
 static void _netapi_cb(uint16_t cmd, gnrc_pktsnip_t *pkt, void *ctx)
 {
     if (cmd == GNRC_NETAPI_MSG_TYPE_RCV) {
+        gnrc_sock_reg_t *reg = ctx;
+
+#if IS_USED(MODULE_GNRC_SOCK_ASYNC_ONLY) || IS_USED(MODULE_GNRC_SOCK_PKTQUEUE)
+        /* queue the packet without going through an mbox */
+        if (!_pkt_queue_put(reg, pkt)) {
+            LOG_WARNING("gnrc_sock: dropped packet to %p (was full)\n",
+                        (void *)reg);
+            /* packet could not be delivered so it should be dropped */
+            gnrc_pktbuf_release(pkt);
+            return;
+        }
+#else   /* IS_USED(MODULE_GNRC_SOCK_ASYNC_ONLY) */
         msg_t msg = { .type = GNRC_NETAPI_MSG_TYPE_RCV,
                       .content = { .ptr = pkt } };
-        gnrc_sock_reg_t *reg = ctx;
 
         if (mbox_try_put(&reg->mbox, &msg) < 1) {
             LOG_WARNING("gnrc_sock: dropped message to %p (was full)\n",
@@ -73,24 +192,40 @@ static void _netapi_cb(uint16_t cmd, gnrc_pktsnip_t *pkt, void *ctx)
             gnrc_pktbuf_release(pkt);
             return;
         }
+#endif  /* IS_USED(MODULE_GNRC_SOCK_ASYNC_ONLY) */
+#ifdef SOCK_HAS_ASYNC
         if (reg->async_cb.generic) {
             reg->async_cb.generic(reg, SOCK_ASYNC_MSG_RECV, reg->async_cb_arg);
         }
+#endif  /* SOCK_HAS_ASYNC */
     }
 }
-#endif /* SOCK_HAS_ASYNC */
+#endif /* SOCK_HAS_ASYNC || IS_USED(MODULE_GNRC_SOCK_PKTQUEUE) */
 
 void gnrc_sock_create(gnrc_sock_reg_t *reg, gnrc_nettype_t type, uint32_t demux_ctx)
 {
+#if IS_USED(MODULE_GNRC_SOCK_ASYNC_ONLY)
+    reg->pkt_queue_start = 0;
+    reg->pkt_queue_avail = 0;
+#elif IS_USED(MODULE_GNRC_SOCK_PKTQUEUE)
+    reg->pkt_head = NULL;
+    reg->pkt_tail = NULL;
+    reg->pkt_bytes = 0;
+    mutex_init(&reg->pkt_ready);
+    mutex_lock(&reg->pkt_ready);
+#else
     mbox_init(&reg->mbox, reg->mbox_queue, GNRC_SOCK_MBOX_SIZE);
+#endif
 #ifdef SOCK_HAS_ASYNC
     reg->async_cb.generic = NULL;
+#endif
+#if defined(SOCK_HAS_ASYNC) || IS_USED(MODULE_GNRC_SOCK_PKTQUEUE)
     reg->netreg_cb.cb = _netapi_cb;
     reg->netreg_cb.ctx = reg;
     gnrc_netreg_entry_init_cb(&reg->entry, demux_ctx, &reg->netreg_cb);
-#else   /* SOCK_HAS_ASYNC */
+#else
     gnrc_netreg_entry_init_mbox(&reg->entry, demux_ctx, &reg->mbox);
-#endif  /* SOCK_HAS_ASYNC */
+#endif
     gnrc_netreg_register(type, &reg->entry);
 }
 
@@ -101,7 +236,6 @@ ssize_t gnrc_sock_recv(gnrc_sock_reg_t *reg, gnrc_pktsnip_t **pkt_out,
     /* only used when some sock_aux_% module is used */
     (void)aux;
     gnrc_pktsnip_t *pkt, *netif;
-    msg_t msg;
 
     /* The fuzzing module is only enabled when building a fuzzing
      * application from the fuzzing/ subdirectory. When using gnrc_sock
@@ -116,6 +250,47 @@ ssize_t gnrc_sock_recv(gnrc_sock_reg_t *reg, gnrc_pktsnip_t **pkt_out,
     }
 #endif
 
+#if IS_USED(MODULE_GNRC_SOCK_ASYNC_ONLY)
+    /* packets are only queued for the asynchronous handler, waiting for
+     * them is not possible */
+    (void)timeout;
+    if (reg->netreg_cb.ctx != reg) {
+        return -EINVAL;
+    }
+    if ((pkt = _pkt_queue_get(reg)) == NULL) {
+        return -EAGAIN;
+    }
+#elif IS_USED(MODULE_GNRC_SOCK_PKTQUEUE)
+    if (reg->netreg_cb.ctx != reg) {
+        return -EINVAL;
+    }
+    /* pkt_ready may be left unlocked by packets taken meanwhile, so check
+     * the queue again after every wakeup */
+    while ((pkt = _pkt_queue_get(reg)) == NULL) {
+        if (timeout == 0) {
+            return -EAGAIN;
+        }
+        if (timeout == SOCK_NO_TIMEOUT) {
+            mutex_lock(&reg->pkt_ready);
+        }
+#if IS_USED(MODULE_ZTIMER_USEC)
+        else if (ztimer_mutex_lock_timeout(ZTIMER_USEC, &reg->pkt_ready,
+                                           timeout) != 0) {
+            return -ETIMEDOUT;
+        }
+#elif IS_USED(MODULE_XTIMER)
+        else if (xtimer_mutex_lock_timeout(&reg->pkt_ready, timeout) != 0) {
+            return -ETIMEDOUT;
+        }
+#else
+        else {
+            mutex_lock(&reg->pkt_ready);
+        }
+#endif
+    }
+#else   /* IS_USED(MODULE_GNRC_SOCK_ASYNC_ONLY) */
+    msg_t msg;
+
     if (mbox_size(&reg->mbox) != GNRC_SOCK_MBOX_SIZE) {
         return -EINVAL;
     }
@@ -176,6 +351,7 @@ ssize_t gnrc_sock_recv(gnrc_sock_reg_t *reg, gnrc_pktsnip_t **pkt_out,
         default:
             return -EINVAL;
     }
+#endif  /* IS_USED(MODULE_GNRC_SOCK_ASYNC_ONLY) */
     /* TODO: discern NETTYPE from remote->family (set in caller), when IPv4
      * was implemented */
     ipv6_hdr_t *ipv6_hdr = gnrc_ipv6_get_header(pkt);
@@ -213,7 +389,13 @@ ssize_t gnrc_sock_recv(gnrc_sock_reg_t *reg, gnrc_pktsnip_t **pkt_out,
     *pkt_out = pkt; /* set out parameter */
 
 #if IS_ACTIVE(SOCK_HAS_ASYNC)
+#if IS_USED(MODULE_GNRC_SOCK_ASYNC_ONLY)
+    if (reg->async_cb.generic && reg->pkt_queue_avail) {
+#elif IS_USED(MODULE_GNRC_SOCK_PKTQUEUE)
+    if (reg->async_cb.generic && reg->pkt_head) {
+#else
     if (reg->async_cb.generic && mbox_avail(&reg->mbox)) {
+#endif
         reg->async_cb.generic(reg, SOCK_ASYNC_MSG_RECV, reg->async_cb_arg);
     }
 #endif
@@ -12,6 +12,20 @@
  * @brief       Provides an implementation of the @ref net_sock by the
  *              @ref net_gnrc
  *
+ * With module `gnrc_sock_async_only` received packets are handed to the
+ * @ref net_sock_async handler straight from the @ref net_gnrc_netreg callback
+ * instead of going through an @ref core_mbox per sock. This saves a queue hop
+ * and the mbox memory, but receiving with a timeout other than 0 is not
+ * possible anymore: all receive functions return `-EAGAIN` if no data is
+ * queued.
+ *
+ * With module `gnrc_sock_pktqueue` received packets are queued in the packet
+ * buffer instead of an @ref core_mbox per sock. Each packet is prepended by a
+ * small snip linking it to the next one, so the queue is limited by
+ * @ref CONFIG_GNRC_SOCK_RCVBUF_SIZE bytes instead of a fixed number of
+ * messages, and takes no memory in the sock while it is empty. A single
+ * mutex wakes the receiving thread.
+ *
  * @{
  *
  * @file
@@ -26,6 +40,7 @@
 #include <stdint.h>
 
 #include "mbox.h"
+#include "mutex.h"
 #include "net/af.h"
 #include "net/gnrc.h"
 #if IS_USED(MODULE_GNRC_TCP)
@@ -58,6 +73,16 @@ extern "C" {
 #ifndef CONFIG_GNRC_SOCK_MBOX_SIZE_EXP
 #define CONFIG_GNRC_SOCK_MBOX_SIZE_EXP      (3)
 #endif
+
+/**
+ * @brief   Maximum number of bytes queued for a sock
+ *
+ * @note    Only with module `gnrc_sock_pktqueue`. A packet is always queued
+ *          if the queue is empty, even if it is larger.
+ */
+#ifndef CONFIG_GNRC_SOCK_RCVBUF_SIZE
+#define CONFIG_GNRC_SOCK_RCVBUF_SIZE        (1280U)
+#endif
 /** @} */
 
 /**
@@ -92,10 +117,38 @@ struct gnrc_sock_reg {
     struct gnrc_sock_reg *next;            /**< list-like for internal storage */
 #endif
     gnrc_netreg_entry_t entry;             /**< @ref net_gnrc_netreg entry for mbox */
+#if IS_USED(MODULE_GNRC_SOCK_ASYNC_ONLY) || defined(DOXYGEN)
+    /**
+     * @brief   Received packets, handed out by the asynchronous handler
+     *
+     * @note    Only with module `gnrc_sock_async_only`, replaces
+     *          gnrc_sock_reg_t::mbox
+     */
+    gnrc_pktsnip_t *pkt_queue[GNRC_SOCK_MBOX_SIZE];
+    uint8_t pkt_queue_start;               /**< first packet in gnrc_sock_reg_t::pkt_queue */
+    uint8_t pkt_queue_avail;               /**< packets in gnrc_sock_reg_t::pkt_queue */
+#endif
+#if IS_USED(MODULE_GNRC_SOCK_PKTQUEUE) || defined(DOXYGEN)
+    /**
+     * @brief   Snip prepended to the first received packet
+     *
+     * @note    Only with module `gnrc_sock_pktqueue`, replaces
+     *          gnrc_sock_reg_t::mbox
+     */
+    gnrc_pktsnip_t *pkt_head;
+    gnrc_pktsnip_t *pkt_tail;              /**< snip prepended to the last packet */
+    size_t pkt_bytes;                      /**< bytes of the queued packets */
+    mutex_t pkt_ready;                     /**< unlocked when a packet was queued */
+#endif
+#if !(IS_USED(MODULE_GNRC_SOCK_ASYNC_ONLY) || IS_USED(MODULE_GNRC_SOCK_PKTQUEUE)) || \
+    defined(DOXYGEN)
     mbox_t mbox;                           /**< @ref core_mbox target for the sock */
     msg_t mbox_queue[GNRC_SOCK_MBOX_SIZE]; /**< queue for gnrc_sock_reg_t::mbox */
-#ifdef SOCK_HAS_ASYNC
+#endif
+#if defined(SOCK_HAS_ASYNC) || IS_USED(MODULE_GNRC_SOCK_PKTQUEUE)
     gnrc_netreg_entry_cbd_t netreg_cb;     /**< netreg callback */
+#endif
+#ifdef SOCK_HAS_ASYNC
     /**
      * @brief   asynchronous upper layer callback
      *
@@ -133,6 +133,38 @@ ssize_t sock_tcp_read(sock_tcp_t *sock, void *data, size_t max_len, uint32_t tim
     return gnrc_tcp_recv(sock, data, max_len, timeout);
 }
 
+ssize_t sock_tcp_read_buf(sock_tcp_t *sock, void **data, void **buf_ctx, uint32_t timeout)
+{
+    /* Asserts defined by API. */
+    assert(sock != NULL);
+    assert(data != NULL);
+    assert(buf_ctx != NULL);
+
+    /* Continue with data that is already buffered, releasing the previous chunk */
+    if (*buf_ctx != NULL) {
+        ssize_t res = gnrc_tcp_recv_buf(sock, data, 0);
+
+        if (res <= 0) {
+            *buf_ctx = NULL;
+            return (res == -EAGAIN) ? 0 : res;
+        }
+        return res;
+    }
+
+    /* Map SOCK_NO_TIMEOUT to GNRC_TCP_NO_TIMEOUT */
+    if (timeout == SOCK_NO_TIMEOUT) {
+        timeout = GNRC_TCP_NO_TIMEOUT;
+    }
+
+    /* Forward call to gnrc_tcp_recv_buf: All error codes share the same semantics */
+    ssize_t res = gnrc_tcp_recv_buf(sock, data, timeout);
+
+    if (res > 0) {
+        *buf_ctx = sock;
+    }
+    return res;
+}
+
 ssize_t sock_tcp_write(sock_tcp_t *sock, const void *data, size_t len)
 {
     /* Asserts defined by API. */
@@ -278,18 +278,12 @@ ssize_t sock_udp_recv_buf_aux(sock_udp_t *sock, void **data, void **buf_ctx,
     return res;
 }
 
-ssize_t sock_udp_sendv_aux(sock_udp_t *sock,
-                           const iolist_t *snips,
-                           const sock_udp_ep_t *remote, sock_udp_aux_tx_t *aux)
+static int _prepare_send(sock_udp_t *sock, const sock_udp_ep_t *remote,
+                         sock_udp_aux_tx_t *aux, sock_ip_ep_t *local,
+                         sock_udp_ep_t *remote_cpy, sock_ip_ep_t **rem,
+                         uint16_t *src_port, uint16_t *dst_port)
 {
     (void)aux;
-    int res;
-    gnrc_pktsnip_t *pkt, *payload = NULL;
-    uint16_t src_port = 0, dst_port;
-    sock_ip_ep_t local;
-    sock_udp_ep_t remote_cpy;
-    sock_ip_ep_t *rem;
-
     assert((sock != NULL) || (remote != NULL));
 
     if (remote != NULL) {
@@ -317,8 +311,8 @@ ssize_t sock_udp_sendv_aux(sock_udp_t *sock,
      * cppcheck is being weird here anyways) */
     if ((sock == NULL) || (sock->local.family == AF_UNSPEC)) {
         /* no sock or sock currently unbound */
-        memset(&local, 0, sizeof(local));
-        if ((src_port = _get_dyn_port(sock)) == GNRC_SOCK_DYN_PORTRANGE_ERR) {
+        memset(local, 0, sizeof(*local));
+        if ((*src_port = _get_dyn_port(sock)) == GNRC_SOCK_DYN_PORTRANGE_ERR) {
             return -EADDRINUSE;
         }
         /* cppcheck-suppress nullPointer
@@ -326,14 +320,14 @@ ssize_t sock_udp_sendv_aux(sock_udp_t *sock,
          * well, see above) */
         if (sock != NULL) {
             /* bind sock object implicitly */
-            sock->local.port = src_port;
+            sock->local.port = *src_port;
             if (remote == NULL) {
                 sock->local.family = sock->remote.family;
             }
             else {
                 sock->local.family = remote->family;
             }
-            gnrc_sock_create(&sock->reg, GNRC_NETTYPE_UDP, src_port);
+            gnrc_sock_create(&sock->reg, GNRC_NETTYPE_UDP, *src_port);
 #ifdef MODULE_GNRC_SOCK_CHECK_REUSE
             /* prepend to current socks */
             sock->reg.next = (gnrc_sock_reg_t *)_udp_socks;
@@ -342,36 +336,45 @@ ssize_t sock_udp_sendv_aux(sock_udp_t *sock,
         }
     }
     else {
-        src_port = sock->local.port;
-        memcpy(&local, &sock->local, sizeof(local));
+        *src_port = sock->local.port;
+        memcpy(local, &sock->local, sizeof(*local));
     }
 #if IS_USED(MODULE_SOCK_AUX_LOCAL)
     /* user supplied local endpoint takes precedent */
     if ((aux != NULL) && (aux->flags & SOCK_AUX_SET_LOCAL)) {
-        local.family = aux->local.family;
-        local.netif = aux->local.netif;
-        memcpy(&local.addr, &aux->local.addr, sizeof(local.addr));
+        local->family = aux->local.family;
+        local->netif = aux->local.netif;
+        memcpy(&local->addr, &aux->local.addr, sizeof(local->addr));
 
         aux->flags &= ~SOCK_AUX_SET_LOCAL;
     }
 #endif
     /* sock can't be NULL at this point */
     if (remote == NULL) {
-        rem = (sock_ip_ep_t *)&sock->remote;
-        dst_port = sock->remote.port;
+        *rem = (sock_ip_ep_t *)&sock->remote;
+        *dst_port = sock->remote.port;
     }
     else {
-        rem = (sock_ip_ep_t *)&remote_cpy;
-        gnrc_ep_set(rem, (sock_ip_ep_t *)remote, sizeof(sock_udp_ep_t));
-        dst_port = remote->port;
+        *rem = (sock_ip_ep_t *)remote_cpy;
+        gnrc_ep_set(*rem, (sock_ip_ep_t *)remote, sizeof(sock_udp_ep_t));
+        *dst_port = remote->port;
     }
     /* check for matching address families in local and remote */
-    if (local.family == AF_UNSPEC) {
-        local.family = rem->family;
+    if (local->family == AF_UNSPEC) {
+        local->family = (*rem)->family;
     }
-    else if (local.family != rem->family) {
+    else if (local->family != (*rem)->family) {
         return -EINVAL;
     }
+    return 0;
+}
+
+static ssize_t _send(const iolist_t *snips, sock_ip_ep_t *local,
+                     const sock_ip_ep_t *rem, uint16_t src_port,
+                     uint16_t dst_port)
+{
+    gnrc_pktsnip_t *pkt, *payload;
+    ssize_t res;
 
     /* allocate snip for payload */
     payload = gnrc_pktbuf_add(NULL, NULL, iolist_size(snips), GNRC_NETTYPE_UNDEF);
@@ -387,10 +390,29 @@ ssize_t sock_udp_sendv_aux(sock_udp_t *sock,
         gnrc_pktbuf_release(payload);
         return -ENOMEM;
     }
-    res = gnrc_sock_send(pkt, &local, rem, PROTNUM_UDP);
+    res = gnrc_sock_send(pkt, local, rem, PROTNUM_UDP);
     if (res > 0) {
         res -= sizeof(udp_hdr_t);
     }
+    return res;
+}
+
+ssize_t sock_udp_sendv_aux(sock_udp_t *sock,
+                           const iolist_t *snips,
+                           const sock_udp_ep_t *remote, sock_udp_aux_tx_t *aux)
+{
+    int res;
+    uint16_t src_port = 0, dst_port;
+    sock_ip_ep_t local;
+    sock_udp_ep_t remote_cpy;
+    sock_ip_ep_t *rem;
+
+    res = _prepare_send(sock, remote, aux, &local, &remote_cpy, &rem,
+                        &src_port, &dst_port);
+    if (res < 0) {
+        return res;
+    }
+    res = _send(snips, &local, rem, src_port, dst_port);
 #ifdef SOCK_HAS_ASYNC
     if ((sock != NULL) && (sock->reg.async_cb.udp)) {
         sock->reg.async_cb.udp(sock, SOCK_ASYNC_MSG_SENT,
@@ -400,6 +422,67 @@ ssize_t sock_udp_sendv_aux(sock_udp_t *sock,
     return res;
 }
 
+ssize_t sock_udp_send_many(sock_udp_t *sock, const iolist_t *const *snips,
+                           unsigned numof, const sock_udp_ep_t *remote)
+{
+    int res;
+    uint16_t src_port = 0, dst_port;
+    sock_ip_ep_t local;
+    sock_udp_ep_t remote_cpy;
+    sock_ip_ep_t *rem;
+    unsigned sent;
+
+    assert((numof == 0) || (snips != NULL));
+    /* resolve and bind end points only once for the whole batch */
+    res = _prepare_send(sock, remote, NULL, &local, &remote_cpy, &rem,
+                        &src_port, &dst_port);
+    if (res < 0) {
+        return res;
+    }
+    for (sent = 0; sent < numof; sent++) {
+        res = _send(snips[sent], &local, rem, src_port, dst_port);
+        if (res < 0) {
+            break;
+        }
+    }
+#ifdef SOCK_HAS_ASYNC
+    if ((sent > 0) && (sock != NULL) && (sock->reg.async_cb.udp)) {
+        sock->reg.async_cb.udp(sock, SOCK_ASYNC_MSG_SENT,
+                               sock->reg.async_cb_arg);
+    }
+#endif  /* SOCK_HAS_ASYNC */
+    return ((sent == 0) && (res < 0)) ? res : (ssize_t)sent;
+}
+
+ssize_t sock_udp_recv_many(sock_udp_t *sock, sock_udp_msg_t *msgs,
+                           unsigned numof, uint32_t timeout)
+{
+    unsigned rcvd;
+
+    assert((sock != NULL) && ((numof == 0) || (msgs != NULL)));
+    for (rcvd = 0; rcvd < numof; rcvd++) {
+        /* only wait for the first datagram, take the others from the queue */
+        ssize_t res = sock_udp_recv(sock, msgs[rcvd].data, msgs[rcvd].max_len,
+                                    (rcvd == 0) ? timeout : 0,
+                                    &msgs[rcvd].remote);
+
+        if (res >= 0) {
+            msgs[rcvd].len = res;
+        }
+        else if (rcvd == 0) {
+            return res;
+        }
+        else if ((res == -ENOBUFS) || (res == -EPROTO)) {
+            /* the datagram was consumed, report it to the caller */
+            msgs[rcvd].len = res;
+        }
+        else {
+            break;
+        }
+    }
+    return rcvd;
+}
+
 #ifdef SOCK_HAS_ASYNC
 void sock_udp_set_cb(sock_udp_t *sock, sock_udp_cb_t cb, void *arg)
 {
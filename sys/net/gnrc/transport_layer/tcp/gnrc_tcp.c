@@ -705,8 +705,8 @@ ssize_t gnrc_tcp_send(gnrc_tcp_tcb_t *tcb, const void *data, const size_t len,
                     MSG_TYPE_USER_SPEC_TIMEOUT, &mbox);
     }
 
-    /* Loop until something was sent and acked */
-    while (ret == 0 || tcb->pkt_retransmit != NULL) {
+    /* Loop until everything was sent and acked */
+    while (ret >= 0 && ((size_t)ret < len || tcb->pkt_retransmit_numof > 0)) {
         state = _gnrc_tcp_fsm_get_state(tcb);
 
         /* Check if the connections state is closed. If so, a reset was received */
@@ -729,9 +729,10 @@ ssize_t gnrc_tcp_send(gnrc_tcp_tcb_t *tcb, const void *data, const size_t len,
                         MSG_TYPE_PROBE_TIMEOUT, &mbox);
         }
 
-        /* Try to send data in case there nothing has been sent and we are not probing */
-        if (ret == 0 && !probing_mode) {
-            ret = _gnrc_tcp_fsm(tcb, FSM_EVENT_CALL_SEND, NULL, (void *) data, len);
+        /* Try to send remaining data in case we are not probing */
+        if ((size_t)ret < len && !probing_mode) {
+            ret += _gnrc_tcp_fsm(tcb, FSM_EVENT_CALL_SEND, NULL,
+                                 (void *)((const uint8_t *)data + ret), len - ret);
         }
 
         /* Wait for responses */
@@ -795,13 +796,10 @@ ssize_t gnrc_tcp_send(gnrc_tcp_tcb_t *tcb, const void *data, const size_t len,
     return ret;
 }
 
-ssize_t gnrc_tcp_recv(gnrc_tcp_tcb_t *tcb, void *data, const size_t max_len,
-                      const uint32_t timeout_duration_ms)
+static ssize_t _recv(gnrc_tcp_tcb_t *tcb, _gnrc_tcp_fsm_event_t event, void *data,
+                     const size_t max_len, const uint32_t timeout_duration_ms)
 {
     TCP_DEBUG_ENTER;
-    assert(tcb != NULL);
-    assert(data != NULL);
-
     msg_t msg;
     msg_t msg_queue[TCP_MSG_QUEUE_SIZE];
     mbox_t mbox = MBOX_INIT(msg_queue, TCP_MSG_QUEUE_SIZE);
@@ -832,7 +830,7 @@ ssize_t gnrc_tcp_recv(gnrc_tcp_tcb_t *tcb, void *data, const size_t max_len,
     /* If FIN was received (CLOSE_WAIT), no further data can be received. */
     /* Copy received data into given buffer and return number of bytes. Can be zero. */
     if (state == FSM_STATE_CLOSE_WAIT) {
-        ret = _gnrc_tcp_fsm(tcb, FSM_EVENT_CALL_RECV, NULL, data, max_len);
+        ret = _gnrc_tcp_fsm(tcb, event, NULL, data, max_len);
         mutex_unlock(&(tcb->function_lock));
         TCP_DEBUG_LEAVE;
         return ret;
@@ -840,7 +838,7 @@ ssize_t gnrc_tcp_recv(gnrc_tcp_tcb_t *tcb, void *data, const size_t max_len,
 
     /* If this call is non-blocking (timeout_duration_ms == 0): Try to read data and return */
     if (timeout_duration_ms == 0) {
-        ret = _gnrc_tcp_fsm(tcb, FSM_EVENT_CALL_RECV, NULL, data, max_len);
+        ret = _gnrc_tcp_fsm(tcb, event, NULL, data, max_len);
         if (ret == 0) {
             TCP_DEBUG_ERROR("-EAGAIN: Not data available, try later again.");
             ret = -EAGAIN;
@@ -872,7 +870,7 @@ ssize_t gnrc_tcp_recv(gnrc_tcp_tcb_t *tcb, void *data, const size_t max_len,
         }
 
         /* Try to read available data */
-        ret = _gnrc_tcp_fsm(tcb, FSM_EVENT_CALL_RECV, NULL, data, max_len);
+        ret = _gnrc_tcp_fsm(tcb, event, NULL, data, max_len);
 
         /* If FIN was received (CLOSE_WAIT), no further data can be received. Leave event loop */
         if (state == FSM_STATE_CLOSE_WAIT) {
@@ -916,6 +914,41 @@ ssize_t gnrc_tcp_recv(gnrc_tcp_tcb_t *tcb, void *data, const size_t max_len,
     return ret;
 }
 
+ssize_t gnrc_tcp_recv(gnrc_tcp_tcb_t *tcb, void *data, const size_t max_len,
+                      const uint32_t timeout_duration_ms)
+{
+    assert(tcb != NULL);
+    assert(data != NULL);
+
+    return _recv(tcb, FSM_EVENT_CALL_RECV, data, max_len, timeout_duration_ms);
+}
+
+ssize_t gnrc_tcp_recv_buf(gnrc_tcp_tcb_t *tcb, void **data,
+                          const uint32_t timeout_duration_ms)
+{
+    assert(tcb != NULL);
+    assert(data != NULL);
+
+    return _recv(tcb, FSM_EVENT_CALL_RECV_BUF, data, SIZE_MAX, timeout_duration_ms);
+}
+
+void gnrc_tcp_recv_buf_release(gnrc_tcp_tcb_t *tcb)
+{
+    TCP_DEBUG_ENTER;
+    assert(tcb != NULL);
+
+    mutex_lock(&(tcb->function_lock));
+
+    /* Lent data is only left in the receive buffer while connected */
+    _gnrc_tcp_fsm_state_t state = _gnrc_tcp_fsm_get_state(tcb);
+    if (state == FSM_STATE_ESTABLISHED || state == FSM_STATE_FIN_WAIT_1 ||
+        state == FSM_STATE_FIN_WAIT_2 || state == FSM_STATE_CLOSE_WAIT) {
+        _gnrc_tcp_fsm(tcb, FSM_EVENT_CALL_RECV_BUF, NULL, NULL, 0);
+    }
+    mutex_unlock(&(tcb->function_lock));
+    TCP_DEBUG_LEAVE;
+}
+
 void gnrc_tcp_close(gnrc_tcp_tcb_t *tcb)
 {
     TCP_DEBUG_ENTER;
@@ -0,0 +1,108 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     net_gnrc
+ * @{
+ *
+ * @file
+ * @brief       Implementation of internal/congure.h
+ * @}
+ */
+#include "kernel_defines.h"
+
+#if IS_USED(MODULE_GNRC_TCP_CONGURE)
+#include "evtimer.h"
+#include "include/gnrc_tcp_common.h"
+#include "include/gnrc_tcp_congure.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+static inline congure_wnd_size_t _wnd_size(uint32_t size)
+{
+    return (size > CONGURE_WND_SIZE_MAX) ? CONGURE_WND_SIZE_MAX : size;
+}
+
+void _gnrc_tcp_congure_init(gnrc_tcp_tcb_t *tcb)
+{
+    TCP_DEBUG_ENTER;
+    if (tcb->congure == NULL) {
+        tcb->congure = _gnrc_tcp_congure_snd_alloc();
+    }
+    if (tcb->congure == NULL) {
+        TCP_DEBUG_ERROR("No congestion state available.");
+    }
+    else {
+        tcb->congure->driver->init(tcb->congure, tcb);
+    }
+    TCP_DEBUG_LEAVE;
+}
+
+void _gnrc_tcp_congure_release(gnrc_tcp_tcb_t *tcb)
+{
+    TCP_DEBUG_ENTER;
+    if (tcb->congure != NULL) {
+        _gnrc_tcp_congure_snd_free(tcb->congure);
+        tcb->congure = NULL;
+    }
+    TCP_DEBUG_LEAVE;
+}
+
+uint32_t _gnrc_tcp_congure_cwnd(const gnrc_tcp_tcb_t *tcb)
+{
+    return (tcb->congure != NULL) ? tcb->congure->cwnd : UINT32_MAX;
+}
+
+void _gnrc_tcp_congure_report_sent(gnrc_tcp_tcb_t *tcb, uint32_t size)
+{
+    if (tcb->congure != NULL) {
+        tcb->congure->driver->report_msg_sent(tcb->congure, _wnd_size(size));
+    }
+}
+
+void _gnrc_tcp_congure_report_acked(gnrc_tcp_tcb_t *tcb, uint32_t ack,
+                                    uint32_t acked, uint32_t pay_len,
+                                    bool clean)
+{
+    if (tcb->congure != NULL) {
+        congure_snd_msg_t msg = {
+            .send_time = tcb->rtt_start,
+            .size = _wnd_size(acked),
+            .resends = tcb->retries,
+        };
+        congure_snd_ack_t ack_info = {
+            .recv_time = evtimer_now_msec(),
+            .id = ack,
+            .size = _wnd_size(pay_len),
+            /* the window is compared by the caller and reflected in clean */
+            .wnd = 0,
+            .clean = clean,
+        };
+
+        tcb->congure->driver->report_msg_acked(tcb->congure, &msg, &ack_info);
+    }
+}
+
+void _gnrc_tcp_congure_report_timeout(gnrc_tcp_tcb_t *tcb)
+{
+    if (tcb->congure != NULL) {
+        /* everything in flight is considered lost on timeout */
+        congure_snd_msg_t msg = {
+            .send_time = tcb->rtt_start,
+            .size = _wnd_size(tcb->snd_nxt - tcb->snd_una),
+            .resends = tcb->retries,
+        };
+
+        msg.super.next = &msg.super;
+        tcb->congure->driver->report_msgs_timeout(tcb->congure, &msg);
+    }
+}
+#else   /* IS_USED(MODULE_GNRC_TCP_CONGURE) */
+typedef int dont_be_pedantic;
+#endif  /* IS_USED(MODULE_GNRC_TCP_CONGURE) */
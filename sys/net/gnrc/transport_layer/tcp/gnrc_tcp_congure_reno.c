@@ -0,0 +1,192 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     net_gnrc
+ * @{
+ *
+ * @file
+ * @brief       TCP NewReno as congestion control backend for GNRC TCP
+ *
+ * Extends @ref sys_congure_reno with the fast recovery of NewReno (see
+ * [RFC 6582](https://tools.ietf.org/html/rfc6582)), using tcb->recover as
+ * the recovery point.
+ * @}
+ */
+#include "kernel_defines.h"
+
+#if IS_USED(MODULE_GNRC_TCP_CONGURE_RENO)
+#include "mutex.h"
+#include "seq.h"
+#include "congure/reno.h"
+#include "net/gnrc/tcp/config.h"
+#include "include/gnrc_tcp_common.h"
+#include "include/gnrc_tcp_congure.h"
+
+static void _init(congure_snd_t *cong, void *ctx);
+static void _report_msg_acked(congure_snd_t *cong, congure_snd_msg_t *msg,
+                              congure_snd_ack_t *ack);
+static void _report_msgs_timeout(congure_snd_t *cong, congure_snd_msg_t *msgs);
+static void _fr(congure_reno_snd_t *c);
+static bool _same_wnd_adv(congure_reno_snd_t *c, congure_snd_ack_t *ack);
+static void _ss_cwnd_inc(congure_reno_snd_t *c);
+static void _ca_cwnd_inc(congure_reno_snd_t *c);
+static void _fr_cwnd_dec(congure_reno_snd_t *c);
+
+static const congure_snd_driver_t _driver = {
+    .init = _init,
+    .inter_msg_interval = congure_reno_snd_inter_msg_interval,
+    .report_msg_sent = congure_reno_snd_report_msg_sent,
+    .report_msg_discarded = congure_reno_snd_report_msg_discarded,
+    .report_msgs_timeout = _report_msgs_timeout,
+    .report_msgs_lost = congure_reno_snd_report_msgs_lost,
+    .report_msg_acked = _report_msg_acked,
+    .report_ecn_ce = congure_reno_snd_report_ecn_ce,
+};
+
+static const congure_reno_snd_consts_t _consts = {
+    .fr = _fr,
+    .same_wnd_adv = _same_wnd_adv,
+    .ss_cwnd_inc = _ss_cwnd_inc,
+    .ca_cwnd_inc = _ca_cwnd_inc,
+    .fr_cwnd_dec = _fr_cwnd_dec,
+    .init_mss = CONFIG_GNRC_TCP_MSS,
+    /* see https://tools.ietf.org/html/rfc5681#section-3.1 */
+    .cwnd_upper = 2190,
+    .cwnd_lower = 1095,
+    .init_ssthresh = CONGURE_WND_SIZE_MAX,
+    .frthresh = CONFIG_GNRC_TCP_DUP_ACK_THRESH,
+};
+
+static mutex_t _lock = MUTEX_INIT;
+static congure_reno_snd_t _states[CONFIG_GNRC_TCP_RCV_BUFFERS];
+
+static void _cwnd_add(congure_reno_snd_t *c, unsigned inc)
+{
+    c->super.cwnd = ((unsigned)(CONGURE_WND_SIZE_MAX - c->super.cwnd) < inc)
+                  ? CONGURE_WND_SIZE_MAX : (c->super.cwnd + inc);
+}
+
+static void _init(congure_snd_t *cong, void *ctx)
+{
+    congure_reno_snd_t *c = (congure_reno_snd_t *)cong;
+    gnrc_tcp_tcb_t *tcb = ctx;
+
+    congure_reno_snd_init(cong, ctx);
+    c->in_flight_size = 0;
+    if ((tcb->mss > 0) && (tcb->mss < CONFIG_GNRC_TCP_MSS)) {
+        congure_reno_set_mss(c, tcb->mss);
+    }
+}
+
+static void _report_msg_acked(congure_snd_t *cong, congure_snd_msg_t *msg,
+                              congure_snd_ack_t *ack)
+{
+    congure_reno_snd_t *c = (congure_reno_snd_t *)cong;
+    gnrc_tcp_tcb_t *tcb = c->super.ctx;
+    bool in_fr = (c->dup_acks >= c->consts->frthresh);
+    bool new_ack = (seq32_compare(ack->id, c->last_ack) > 0);
+    congure_wnd_size_t cwnd = c->super.cwnd;
+
+    /* segments resent after a timeout are not accounted as in flight */
+    if (msg->size > c->in_flight_size) {
+        msg->size = c->in_flight_size;
+    }
+    congure_reno_snd_report_msg_acked(cong, msg, ack);
+    if (in_fr && new_ack) {
+        if (LEQ_32_BIT(tcb->recover, ack->id)) {
+            /* full ACK: deflate window and leave fast recovery */
+            c->super.cwnd = c->ssthresh;
+        }
+        else {
+            /* partial ACK: deflate by the amount of new data acknowledged,
+             * add back one MSS and stay in fast recovery */
+            c->super.cwnd = (cwnd > msg->size) ? (cwnd - msg->size) : 0;
+            _cwnd_add(c, c->mss);
+            c->dup_acks = c->consts->frthresh;
+        }
+    }
+}
+
+static void _report_msgs_timeout(congure_snd_t *cong, congure_snd_msg_t *msgs)
+{
+    congure_reno_snd_t *c = (congure_reno_snd_t *)cong;
+
+    congure_reno_snd_report_msgs_timeout(cong, msgs);
+    /* a timeout ends fast recovery */
+    c->dup_acks = 0;
+}
+
+static void _fr(congure_reno_snd_t *c)
+{
+    /* GNRC TCP retransmits on its own on duplicate ACKs */
+    (void)c;
+}
+
+static bool _same_wnd_adv(congure_reno_snd_t *c, congure_snd_ack_t *ack)
+{
+    /* GNRC TCP compares the advertised window itself */
+    (void)c;
+    (void)ack;
+    return true;
+}
+
+static void _ss_cwnd_inc(congure_reno_snd_t *c)
+{
+    _cwnd_add(c, (c->in_flight_size < c->mss) ? c->in_flight_size : c->mss);
+}
+
+static void _ca_cwnd_inc(congure_reno_snd_t *c)
+{
+    /* see https://tools.ietf.org/html/rfc5681#section-3.1 equation 3 */
+    unsigned inc = ((unsigned)c->mss * c->mss) / c->super.cwnd;
+
+    _cwnd_add(c, (inc > 0) ? inc : 1);
+}
+
+static void _fr_cwnd_dec(congure_reno_snd_t *c)
+{
+    if (c->dup_acks == c->consts->frthresh) {
+        /* see https://tools.ietf.org/html/rfc5681#section-3.2 step 2 and 3 */
+        c->ssthresh = ((c->in_flight_size / 2) > (c->mss * 2))
+                    ? (c->in_flight_size / 2) : (c->mss * 2);
+        c->super.cwnd = c->ssthresh;
+        _cwnd_add(c, 3 * c->mss);
+    }
+    else {
+        /* inflate window for every further duplicate ACK */
+        _cwnd_add(c, c->mss);
+    }
+}
+
+congure_snd_t *_gnrc_tcp_congure_snd_alloc(void)
+{
+    congure_snd_t *res = NULL;
+
+    mutex_lock(&_lock);
+    for (unsigned i = 0; i < ARRAY_SIZE(_states); i++) {
+        if (_states[i].super.driver == NULL) {
+            _states[i].super.driver = &_driver;
+            _states[i].consts = &_consts;
+            res = &_states[i].super;
+            break;
+        }
+    }
+    mutex_unlock(&_lock);
+    return res;
+}
+
+void _gnrc_tcp_congure_snd_free(congure_snd_t *c)
+{
+    mutex_lock(&_lock);
+    c->driver = NULL;
+    mutex_unlock(&_lock);
+}
+#else   /* IS_USED(MODULE_GNRC_TCP_CONGURE_RENO) */
+typedef int dont_be_pedantic;
+#endif  /* IS_USED(MODULE_GNRC_TCP_CONGURE_RENO) */
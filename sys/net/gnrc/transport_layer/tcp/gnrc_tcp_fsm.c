@@ -25,6 +25,7 @@
 #include "evtimer.h"
 #include "evtimer_msg.h"
 #include "include/gnrc_tcp_common.h"
+#include "include/gnrc_tcp_congure.h"
 #include "include/gnrc_tcp_eventloop.h"
 #include "include/gnrc_tcp_pkt.h"
 #include "include/gnrc_tcp_option.h"
@@ -92,11 +93,16 @@ static uint16_t _get_random_local_port(void)
 static int _clear_retransmit(gnrc_tcp_tcb_t *tcb)
 {
     TCP_DEBUG_ENTER;
-    if (tcb->pkt_retransmit != NULL) {
+    if (tcb->pkt_retransmit_numof > 0) {
         _gnrc_tcp_eventloop_unsched(&tcb->event_retransmit);
-        gnrc_pktbuf_release(tcb->pkt_retransmit);
-        tcb->pkt_retransmit = NULL;
+        for (uint8_t i = 0; i < tcb->pkt_retransmit_numof; i++) {
+            gnrc_pktbuf_release(tcb->pkt_retransmit[i]);
+            tcb->pkt_retransmit[i] = NULL;
+        }
+        tcb->pkt_retransmit_numof = 0;
     }
+    tcb->status &= ~(STATUS_RTT_PENDING | STATUS_RECOVERY);
+    tcb->dup_acks = 0;
     TCP_DEBUG_LEAVE;
     return 0;
 }
@@ -148,8 +154,9 @@ static int _transition_to(gnrc_tcp_tcb_t *tcb, _gnrc_tcp_fsm_state_t state)
 
     switch (state) {
         case FSM_STATE_CLOSED:
-            /* Clear retransmit queue */
+            /* Clear retransmit queue and congestion state */
             _clear_retransmit(tcb);
+            _gnrc_tcp_congure_release(tcb);
 
             /* Close connection if not listenng */
             if (!(tcb->status & STATUS_LISTENING))
@@ -233,6 +240,10 @@ static int _transition_to(gnrc_tcp_tcb_t *tcb, _gnrc_tcp_fsm_state_t state)
 
         case FSM_STATE_ESTABLISHED:
         case FSM_STATE_CLOSE_WAIT:
+            /* Setup congestion control, the peers MSS is known by now */
+            if (state == FSM_STATE_ESTABLISHED) {
+                _gnrc_tcp_congure_init(tcb);
+            }
             /* Stop timeout for listening TCBs */
             if (tcb->status & STATUS_LISTENING) {
                 _gnrc_tcp_eventloop_unsched(&tcb->event_timeout);
@@ -274,6 +285,8 @@ static int _fsm_call_open(gnrc_tcp_tcb_t *tcb)
     }
 
     tcb->rcv_wnd = CONFIG_GNRC_TCP_DEFAULT_WINDOW;
+    tcb->status &= ~STATUS_WND_SCALE;
+    tcb->snd_wnd_shift = 0;
 
     if (tcb->status & STATUS_LISTENING) {
         /* Passive open, T: CLOSED -> LISTEN */
@@ -308,6 +321,9 @@ static int _fsm_call_open(gnrc_tcp_tcb_t *tcb)
 /**
  * @brief FSM Handling function for sending data.
  *
+ * @note Sends as many segments as the send window, the congestion window and
+ *       the retransmission queue allow.
+ *
  * @param[in,out] tcb   TCB holding the connection information.
  * @param[in,out] buf   Buffer containing data to send.
  * @param[in]     len   Maximum Number of Bytes to send from @p buf.
@@ -317,27 +333,82 @@ static int _fsm_call_open(gnrc_tcp_tcb_t *tcb)
 static int _fsm_call_send(gnrc_tcp_tcb_t *tcb, void *buf, size_t len)
 {
     TCP_DEBUG_ENTER;
-    size_t payload = (tcb->snd_una + tcb->snd_wnd) - tcb->snd_nxt;
+    uint32_t wnd = tcb->snd_wnd;
+    uint32_t cwnd = _gnrc_tcp_congure_cwnd(tcb);
+    uint32_t in_flight = tcb->snd_nxt - tcb->snd_una;
+    size_t sent = 0;
+
+    if (cwnd < wnd) {
+        wnd = cwnd;
+    }
 
-    /* Check if window is open and all packets were transmitted */
-    if (payload > 0 && tcb->snd_wnd > 0 && tcb->pkt_retransmit == NULL) {
+    /* Check if window is open and the retransmission queue has space left */
+    while ((sent < len) && (in_flight < wnd) &&
+           (tcb->pkt_retransmit_numof < CONFIG_GNRC_TCP_RETRANSMIT_QUEUE_SIZE)) {
         /* Calculate segment size */
-        payload = (payload < CONFIG_GNRC_TCP_MSS) ? payload : CONFIG_GNRC_TCP_MSS;
-        payload = (payload < tcb->mss) ? payload : tcb->mss;
-        payload = (payload < len) ? payload : len;
+        size_t seg_size = (len - sent < CONFIG_GNRC_TCP_MSS) ? len - sent : CONFIG_GNRC_TCP_MSS;
+        seg_size = (seg_size < tcb->mss) ? seg_size : tcb->mss;
 
         /* Calculate payload size for this segment */
+        size_t payload = wnd - in_flight;
+        payload = (payload < seg_size) ? payload : seg_size;
+
+        /* Avoid silly window syndrome: wait for ACKs instead of sending small segments */
+        if ((payload == 0) || ((payload < seg_size) && (in_flight > 0))) {
+            break;
+        }
+
         gnrc_pktsnip_t *out_pkt = NULL;
         uint16_t seq_con = 0;
-        _gnrc_tcp_pkt_build(tcb, &out_pkt, &seq_con, MSK_ACK | MSK_PSH,
-                            tcb->snd_nxt, tcb->rcv_nxt, buf, payload);
+        if (_gnrc_tcp_pkt_build(tcb, &out_pkt, &seq_con, MSK_ACK | MSK_PSH,
+                                tcb->snd_nxt, tcb->rcv_nxt, (uint8_t *)buf + sent,
+                                payload) < 0) {
+            break;
+        }
         _gnrc_tcp_pkt_setup_retransmit(tcb, out_pkt, false);
         _gnrc_tcp_pkt_send(tcb, out_pkt, seq_con, false);
-        TCP_DEBUG_LEAVE;
-        return payload;
+        sent += payload;
+        in_flight += payload;
     }
     TCP_DEBUG_LEAVE;
-    return 0;
+    return sent;
+}
+
+/**
+ * @brief Announce a window update to the peer after data left the receive buffer.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ */
+static void _update_rcv_wnd(gnrc_tcp_tcb_t *tcb)
+{
+    /* If receive buffer can store more than CONFIG_GNRC_TCP_MSS: set window to free buffer size */
+    if (ringbuffer_get_free(&tcb->rcv_buf) >= CONFIG_GNRC_TCP_MSS) {
+        tcb->rcv_wnd = ringbuffer_get_free(&(tcb->rcv_buf));
+
+        /* Send ACK to announce window update */
+        gnrc_pktsnip_t *out_pkt = NULL;
+        uint16_t seq_con = 0;
+        _gnrc_tcp_pkt_build(tcb, &out_pkt, &seq_con, MSK_ACK, tcb->snd_nxt,
+                            tcb->rcv_nxt, NULL, 0);
+        _gnrc_tcp_pkt_send(tcb, out_pkt, seq_con, false);
+    }
+}
+
+/**
+ * @brief Release data previously lent to the user from the receive buffer.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ *
+ * @returns   true if lent data was released, false otherwise.
+ */
+static bool _release_lent(gnrc_tcp_tcb_t *tcb)
+{
+    if (tcb->rcv_buf_lent == 0) {
+        return false;
+    }
+    ringbuffer_remove(&(tcb->rcv_buf), tcb->rcv_buf_lent);
+    tcb->rcv_buf_lent = 0;
+    return true;
 }
 
 /**
@@ -353,7 +424,13 @@ static int _fsm_call_recv(gnrc_tcp_tcb_t *tcb, void *buf, size_t len)
 {
     TCP_DEBUG_ENTER;
 
+    /* Data lent by a previous _fsm_call_recv_buf() counts as consumed */
+    bool released = _release_lent(tcb);
+
     if (ringbuffer_empty(&tcb->rcv_buf)) {
+        if (released) {
+            _update_rcv_wnd(tcb);
+        }
         TCP_DEBUG_LEAVE;
         return 0;
     }
@@ -361,19 +438,47 @@ static int _fsm_call_recv(gnrc_tcp_tcb_t *tcb, void *buf, size_t len)
     /* Read data into 'buf' up to 'len' bytes from receive buffer */
     size_t rcvd = ringbuffer_get(&(tcb->rcv_buf), buf, len);
 
-    /* If receive buffer can store more than CONFIG_GNRC_TCP_MSS: set window to free buffer size */
-    if (ringbuffer_get_free(&tcb->rcv_buf) >= CONFIG_GNRC_TCP_MSS) {
-        tcb->rcv_wnd = ringbuffer_get_free(&(tcb->rcv_buf));
+    _update_rcv_wnd(tcb);
+    TCP_DEBUG_LEAVE;
+    return rcvd;
+}
 
-        /* Send ACK to announce window update */
-        gnrc_pktsnip_t *out_pkt = NULL;
-        uint16_t seq_con = 0;
-        _gnrc_tcp_pkt_build(tcb, &out_pkt, &seq_con, MSK_ACK, tcb->snd_nxt,
-                            tcb->rcv_nxt, NULL, 0);
-        _gnrc_tcp_pkt_send(tcb, out_pkt, seq_con, false);
+/**
+ * @brief FSM handling function for lending received data in place.
+ *
+ * Releases the data lent by the previous call and lends the next contiguous
+ * chunk of the receive buffer. The lent data stays in the receive buffer
+ * (and thus in the receive window) until it is released.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ * @param[out]    buf   Pointer to store the start of the lent data into.
+ *                      May be NULL to only release data lent before.
+ * @param[in]     len   Maximum number of bytes to lend.
+ *
+ * @returns   Number of lent bytes.
+ */
+static int _fsm_call_recv_buf(gnrc_tcp_tcb_t *tcb, void **buf, size_t len)
+{
+    TCP_DEBUG_ENTER;
+
+    if (_release_lent(tcb)) {
+        _update_rcv_wnd(tcb);
+    }
+
+    if ((buf == NULL) || ringbuffer_empty(&tcb->rcv_buf)) {
+        TCP_DEBUG_LEAVE;
+        return 0;
     }
+
+    /* Lend data up to the end of the ringbuffers memory, the rest follows on the next call */
+    size_t lent = tcb->rcv_buf.size - tcb->rcv_buf.start;
+
+    lent = (lent < tcb->rcv_buf.avail) ? lent : tcb->rcv_buf.avail;
+    lent = (lent < len) ? lent : len;
+    *buf = tcb->rcv_buf.buf + tcb->rcv_buf.start;
+    tcb->rcv_buf_lent = lent;
     TCP_DEBUG_LEAVE;
-    return rcvd;
+    return lent;
 }
 
 /**
@@ -480,6 +585,10 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
     seg_seq = byteorder_ntohl(tcp_hdr->seq_num);
     seg_ack = byteorder_ntohl(tcp_hdr->ack_num);
     seg_wnd = byteorder_ntohs(tcp_hdr->window);
+    /* The window field of SYN segments is never scaled */
+    if (!(ctl & MSK_SYN) && (tcb->status & STATUS_WND_SCALE)) {
+        seg_wnd <<= tcb->snd_wnd_shift;
+    }
 
     /* Extract network layer header */
 #ifdef MODULE_GNRC_IPV6
@@ -712,8 +821,38 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
                 tcb->state == FSM_STATE_CLOSING || tcb->state == FSM_STATE_LAST_ACK) {
                 /* Acknowledge previously sent data */
                 if (LSS_32_BIT(tcb->snd_una, seg_ack) && LEQ_32_BIT(seg_ack, tcb->snd_nxt)) {
+                    uint32_t acked = seg_ack - tcb->snd_una;
+
                     tcb->snd_una = seg_ack;
+                    tcb->dup_acks = 0;
                     _gnrc_tcp_pkt_acknowledge(tcb, seg_ack);
+                    _gnrc_tcp_congure_report_acked(tcb, seg_ack, acked, pay_len,
+                                                   !(ctl & (MSK_SYN | MSK_FIN)) &&
+                                                   (seg_wnd == tcb->snd_wnd));
+                    if (tcb->status & STATUS_RECOVERY) {
+                        /* Partial ACK: the next unacknowledged segment is lost as well */
+                        if (LSS_32_BIT(seg_ack, tcb->recover)) {
+                            _gnrc_tcp_pkt_retransmit_first(tcb);
+                        }
+                        /* Everything sent before loss detection is acknowledged */
+                        else {
+                            tcb->status &= ~STATUS_RECOVERY;
+                        }
+                    }
+                }
+                /* Duplicate ACK: count and fast retransmit if threshold is reached */
+                else if ((seg_ack == tcb->snd_una) && (pay_len == 0) &&
+                         !(ctl & (MSK_SYN | MSK_FIN)) && (seg_wnd == tcb->snd_wnd) &&
+                         (tcb->pkt_retransmit_numof > 0)) {
+                    tcb->dup_acks++;
+                    _gnrc_tcp_congure_report_acked(tcb, seg_ack, 0, pay_len, true);
+                    if ((tcb->dup_acks == CONFIG_GNRC_TCP_DUP_ACK_THRESH) &&
+                        !(tcb->status & STATUS_RECOVERY)) {
+                        TCP_DEBUG_INFO("Duplicate ACK threshold reached. Fast retransmit.");
+                        tcb->status |= STATUS_RECOVERY;
+                        tcb->recover = tcb->snd_nxt;
+                        _gnrc_tcp_pkt_retransmit_first(tcb);
+                    }
                 }
                 /* ACK received for something not yet sent: Reply with pure ACK */
                 else if (LSS_32_BIT(tcb->snd_nxt, seg_ack)) {
@@ -738,25 +877,25 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
                 /* Additional processing */
                 /* Check additionally if previously sent FIN was acknowledged */
                 if (tcb->state == FSM_STATE_FIN_WAIT_1) {
-                    if (tcb->pkt_retransmit == NULL) {
+                    if (tcb->pkt_retransmit_numof == 0) {
                         _transition_to(tcb, FSM_STATE_FIN_WAIT_2);
                     }
                 }
                 /* If retransmission queue is empty, acknowledge close operation */
                 if (tcb->state == FSM_STATE_FIN_WAIT_2) {
-                    if (tcb->pkt_retransmit == NULL) {
+                    if (tcb->pkt_retransmit_numof == 0) {
                         /* Optional: Unblock user close operation */
                     }
                 }
                 /* If our FIN has been acknowledged: Transition to TIME_WAIT */
                 if (tcb->state == FSM_STATE_CLOSING) {
-                    if (tcb->pkt_retransmit == NULL) {
+                    if (tcb->pkt_retransmit_numof == 0) {
                         _transition_to(tcb, FSM_STATE_TIME_WAIT);
                     }
                 }
                 /* If our FIN was acknowledged and status is LAST_ACK: close connection */
                 if (tcb->state == FSM_STATE_LAST_ACK) {
-                    if (tcb->pkt_retransmit == NULL) {
+                    if (tcb->pkt_retransmit_numof == 0) {
                         _transition_to(tcb, FSM_STATE_CLOSED);
                         TCP_DEBUG_LEAVE;
                         return 0;
@@ -813,7 +952,7 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
                 _transition_to(tcb, FSM_STATE_CLOSE_WAIT);
             }
             else if (tcb->state == FSM_STATE_FIN_WAIT_1) {
-                if (tcb->pkt_retransmit == NULL) {
+                if (tcb->pkt_retransmit_numof == 0) {
                     _transition_to(tcb, FSM_STATE_TIME_WAIT);
                 }
                 else {
@@ -857,9 +996,17 @@ static int _fsm_timeout_timewait(gnrc_tcp_tcb_t *tcb)
 static int _fsm_timeout_retransmit(gnrc_tcp_tcb_t *tcb)
 {
     TCP_DEBUG_ENTER;
-    if (tcb->pkt_retransmit != NULL) {
-        _gnrc_tcp_pkt_setup_retransmit(tcb, tcb->pkt_retransmit, true);
-        _gnrc_tcp_pkt_send(tcb, tcb->pkt_retransmit, 0, true);
+    if (tcb->pkt_retransmit_numof > 0) {
+        gnrc_pktsnip_t *pkt = tcb->pkt_retransmit[0];
+
+        /* Everything sent so far has to be recovered */
+        _gnrc_tcp_congure_report_timeout(tcb);
+        tcb->status |= STATUS_RECOVERY;
+        tcb->recover = tcb->snd_nxt;
+        tcb->dup_acks = 0;
+        _gnrc_tcp_pkt_setup_retransmit(tcb, pkt, true);
+        _gnrc_tcp_pkt_send(tcb, pkt, 0, true);
+        _gnrc_tcp_congure_report_sent(tcb, _gnrc_tcp_pkt_get_seg_len(pkt));
     }
     else {
         TCP_DEBUG_INFO("Retransmission queue is empty.");
@@ -949,6 +1096,9 @@ static int _fsm_unprotected(gnrc_tcp_tcb_t *tcb, _gnrc_tcp_fsm_event_t event,
         case FSM_EVENT_CALL_RECV :
             ret = _fsm_call_recv(tcb, buf, len);
             break;
+        case FSM_EVENT_CALL_RECV_BUF :
+            ret = _fsm_call_recv_buf(tcb, buf, len);
+            break;
         case FSM_EVENT_CALL_CLOSE :
             ret = _fsm_call_close(tcb);
             break;
@@ -25,8 +25,16 @@
 int _gnrc_tcp_option_parse(gnrc_tcp_tcb_t *tcb, tcp_hdr_t *hdr)
 {
     TCP_DEBUG_ENTER;
+    uint16_t ctl = byteorder_ntohs(hdr->off_ctl);
+
+    /* Window scaling is negotiated on SYN, forget previous negotiation */
+    if (ctl & MSK_SYN) {
+        tcb->status &= ~STATUS_WND_SCALE;
+        tcb->snd_wnd_shift = 0;
+    }
+
     /* Extract offset value. Return if no options are set */
-    uint8_t offset = GET_OFFSET(byteorder_ntohs(hdr->off_ctl));
+    uint8_t offset = GET_OFFSET(ctl);
     if (offset <= TCP_HDR_OFFSET_MIN) {
         TCP_DEBUG_LEAVE;
         return 0;
@@ -64,6 +72,28 @@ int _gnrc_tcp_option_parse(gnrc_tcp_tcb_t *tcb, tcp_hdr_t *hdr)
                 tcb->mss = (option->value[0] << 8) | option->value[1];
                 break;
 
+            case TCP_OPTION_KIND_WS:
+                if (opt_left < TCP_OPTION_LENGTH_MIN || option->length > opt_left ||
+                    option->length != TCP_OPTION_LENGTH_WS) {
+                    TCP_DEBUG_ERROR("Invalid window scale option length.");
+                    TCP_DEBUG_LEAVE;
+                    return -1;
+                }
+                TCP_DEBUG_INFO("Window scale option found.");
+                if (CONFIG_GNRC_TCP_WND_SCALE_EN && (ctl & MSK_SYN)) {
+                    tcb->status |= STATUS_WND_SCALE;
+                    tcb->snd_wnd_shift = (option->value[0] > TCP_OPTION_WS_SHIFT_MAX)
+                                       ? TCP_OPTION_WS_SHIFT_MAX : option->value[0];
+                }
+                break;
+
+            case TCP_OPTION_KIND_SACK_PERM:
+            case TCP_OPTION_KIND_SACK:
+                /* Only one segment is in flight and out of order segments are
+                 * not queued, so selective acknowledgements are never used */
+                TCP_DEBUG_INFO("SACK option found, ignoring it.");
+                break;
+
             default:
                 if (opt_left >= TCP_OPTION_LENGTH_MIN) {
                     TCP_DEBUG_INFO("Valid, unsupported option found.");
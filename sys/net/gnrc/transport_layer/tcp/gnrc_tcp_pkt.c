@@ -25,6 +25,7 @@
 #include "net/inet_csum.h"
 #include "net/gnrc.h"
 #include "include/gnrc_tcp_common.h"
+#include "include/gnrc_tcp_congure.h"
 #include "include/gnrc_tcp_eventloop.h"
 #include "include/gnrc_tcp_option.h"
 #include "include/gnrc_tcp_pkt.h"
@@ -49,6 +50,51 @@ static inline uint32_t _max(const uint32_t x, const uint32_t y)
   return (x > y) ? x : y;
 }
 
+/**
+ * @brief Calculates the RTO and (re-)starts the retransmission timer.
+ *
+ * @param[in,out] tcb       TCB holding the connection information.
+ * @param[in]     backoff   Flag used to indicate that the timer expired before.
+ */
+static void _sched_retransmit(gnrc_tcp_tcb_t *tcb, const bool backoff)
+{
+    /* RTO adjustment */
+    if (!backoff) {
+        /* If this is the first transmission: rto is 1 sec (Lower Bound) */
+        if (tcb->srtt == RTO_UNINITIALIZED || tcb->rtt_var == RTO_UNINITIALIZED) {
+            tcb->rto = CONFIG_GNRC_TCP_RTO_LOWER_BOUND_MS;
+        }
+        else {
+            tcb->rto = tcb->srtt + _max(CONFIG_GNRC_TCP_RTO_GRANULARITY_MS,
+                                        CONFIG_GNRC_TCP_RTO_K * tcb->rtt_var);
+        }
+    }
+    else {
+        /* If this is a retransmission: Double the rto (Timer Backoff) */
+        tcb->rto *= 2;
+
+        /* If the transmission has been tried five times, we assume srtt and rtt_var are bogus */
+        /* New measurements must be taken the next time something is sent. */
+        if (tcb->retries >= 5) {
+            tcb->srtt = RTO_UNINITIALIZED;
+            tcb->rtt_var = RTO_UNINITIALIZED;
+        }
+    }
+
+    /* Perform boundary checks on current RTO before usage */
+    if (tcb->rto < (int32_t) CONFIG_GNRC_TCP_RTO_LOWER_BOUND_MS) {
+        tcb->rto = CONFIG_GNRC_TCP_RTO_LOWER_BOUND_MS;
+    }
+    else if (tcb->rto > (int32_t) CONFIG_GNRC_TCP_RTO_UPPER_BOUND_MS) {
+        tcb->rto = CONFIG_GNRC_TCP_RTO_UPPER_BOUND_MS;
+    }
+
+    /* Setup retransmission timer, msg to TCP thread with ptr to TCB */
+    _gnrc_tcp_eventloop_unsched(&tcb->event_retransmit);
+    _gnrc_tcp_eventloop_sched(&tcb->event_retransmit, tcb->rto,
+                              MSG_TYPE_RETRANSMISSION, tcb);
+}
+
 int _gnrc_tcp_pkt_build_reset_from_pkt(gnrc_pktsnip_t **out_pkt,
                                        gnrc_pktsnip_t *in_pkt)
 {
@@ -155,6 +201,10 @@ int _gnrc_tcp_pkt_build(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t **out_pkt,
     gnrc_pktsnip_t *tcp_snp = NULL;
     tcp_hdr_t tcp_hdr;
     uint8_t offset = TCP_HDR_OFFSET_MIN;
+    uint32_t wnd = tcb->rcv_wnd;
+    /* Window scale option is sent on active open or if the peer sent it */
+    bool wnd_scale = CONFIG_GNRC_TCP_WND_SCALE_EN && (ctl & MSK_SYN) &&
+                     (!(ctl & MSK_ACK) || (tcb->status & STATUS_WND_SCALE));
 
     /* Add payload, if supplied */
     if (payload != NULL && payload_len > 0) {
@@ -173,7 +223,11 @@ int _gnrc_tcp_pkt_build(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t **out_pkt,
     tcp_hdr.checksum = byteorder_htons(0);
     tcp_hdr.seq_num = byteorder_htonl(seq_num);
     tcp_hdr.ack_num = byteorder_htonl(ack_num);
-    tcp_hdr.window = byteorder_htons(tcb->rcv_wnd);
+    /* The window field of SYN segments is never scaled */
+    if (!(ctl & MSK_SYN)) {
+        wnd >>= _gnrc_tcp_option_rcv_wnd_shift(tcb);
+    }
+    tcp_hdr.window = byteorder_htons((wnd > UINT16_MAX) ? UINT16_MAX : wnd);
     tcp_hdr.urgent_ptr = byteorder_htons(0);
 
     /* Calculate option field size. */
@@ -181,6 +235,10 @@ int _gnrc_tcp_pkt_build(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t **out_pkt,
     if (ctl & MSK_SYN) {
         offset += 1;
     }
+    /* Add window scale option if negotiated */
+    if (wnd_scale) {
+        offset += 1;
+    }
     /* Set offset and control bit accordingly */
     tcp_hdr.off_ctl = byteorder_htons(
         _gnrc_tcp_option_build_offset_control(offset, ctl));
@@ -217,6 +275,14 @@ int _gnrc_tcp_pkt_build(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t **out_pkt,
                     _gnrc_tcp_option_build_mss(CONFIG_GNRC_TCP_MSS));
 
                 memcpy(opt_ptr, &mss_option, sizeof(mss_option));
+                opt_ptr += sizeof(mss_option);
+            }
+            /* Add window scale option, our shift count depends on the buffer size */
+            if (wnd_scale) {
+                network_uint32_t ws_option = byteorder_htonl(
+                    _gnrc_tcp_option_build_wnd_scale(_gnrc_tcp_option_wnd_scale_shift()));
+
+                memcpy(opt_ptr, &ws_option, sizeof(ws_option));
             }
             /* Increase opt_ptr and decrease opt_left, if other options are added */
             /* NOTE: Add additional options here */
@@ -285,13 +351,22 @@ int _gnrc_tcp_pkt_send(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *out_pkt,
         return -EINVAL;
     }
 
-    /* If this is no retransmission, advance sequence number and measure time */
+    /* If this is no retransmission, advance sequence number and measure time
+     * of one segment per round trip */
     if (!retransmit) {
-        tcb->retries = 0;
         tcb->snd_nxt += seq_con;
-        tcb->rtt_start = evtimer_now_msec();
+        if ((seq_con > 0) && !(tcb->status & STATUS_RTT_PENDING)) {
+            tcb->status |= STATUS_RTT_PENDING;
+            tcb->rtt_start = evtimer_now_msec();
+            tcb->rtt_seq = tcb->snd_nxt;
+        }
+        if (seq_con > 0) {
+            _gnrc_tcp_congure_report_sent(tcb, seq_con);
+        }
     }
     else {
+        /* Retransmitted segments must not be timed (Karns Algorithm) */
+        tcb->status &= ~STATUS_RTT_PENDING;
         tcb->retries += 1;
     }
 
@@ -390,11 +465,18 @@ int _gnrc_tcp_pkt_setup_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt,
         return -EINVAL;
     }
 
-    /* Check if retransmit queue is full and pkt is not already in retransmit queue */
-    if (tcb->pkt_retransmit != NULL && tcb->pkt_retransmit != pkt) {
-        TCP_DEBUG_ERROR("-ENOMEM: Retransmit queue is full.");
+    /* Retransmissions are always done for the oldest packet in retransmit queue */
+    if (retransmit) {
+        if (tcb->pkt_retransmit_numof == 0 || tcb->pkt_retransmit[0] != pkt) {
+            TCP_DEBUG_ERROR("-EINVAL: pkt is not first in retransmit queue.");
+            TCP_DEBUG_LEAVE;
+            return -EINVAL;
+        }
+        /* Increase users: every send attempt consumes a user */
+        gnrc_pktbuf_hold(pkt, 1);
+        _sched_retransmit(tcb, true);
         TCP_DEBUG_LEAVE;
-        return -ENOMEM;
+        return 0;
     }
 
     /* Extract control bits and segment length */
@@ -408,44 +490,37 @@ int _gnrc_tcp_pkt_setup_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt,
         return 0;
     }
 
-    /* Assign pkt and increase users: every send attempt consumes a user */
-    tcb->pkt_retransmit = pkt;
-    gnrc_pktbuf_hold(pkt, 1);
-
-    /* RTO adjustment */
-    if (!retransmit) {
-        /* If this is the first transmission: rto is 1 sec (Lower Bound) */
-        if (tcb->srtt == RTO_UNINITIALIZED || tcb->rtt_var == RTO_UNINITIALIZED) {
-            tcb->rto = CONFIG_GNRC_TCP_RTO_LOWER_BOUND_MS;
-        }
-        else {
-            tcb->rto = tcb->srtt + _max(CONFIG_GNRC_TCP_RTO_GRANULARITY_MS,
-                                        CONFIG_GNRC_TCP_RTO_K * tcb->rtt_var);
-        }
+    /* Check if retransmit queue is full */
+    if (tcb->pkt_retransmit_numof >= CONFIG_GNRC_TCP_RETRANSMIT_QUEUE_SIZE) {
+        TCP_DEBUG_ERROR("-ENOMEM: Retransmit queue is full.");
+        TCP_DEBUG_LEAVE;
+        return -ENOMEM;
     }
-    else {
-        /* If this is a retransmission: Double the rto (Timer Backoff) */
-        tcb->rto *= 2;
 
-        /* If the transmission has been tried five times, we assume srtt and rtt_var are bogus */
-        /* New measurements must be taken the next time something is sent. */
-        if (tcb->retries >= 5) {
-            tcb->srtt = RTO_UNINITIALIZED;
-            tcb->rtt_var = RTO_UNINITIALIZED;
-        }
-    }
+    /* Append pkt and increase users: every send attempt consumes a user */
+    tcb->pkt_retransmit[tcb->pkt_retransmit_numof++] = pkt;
+    gnrc_pktbuf_hold(pkt, 1);
 
-    /* Perform boundary checks on current RTO before usage */
-    if (tcb->rto < (int32_t) CONFIG_GNRC_TCP_RTO_LOWER_BOUND_MS) {
-        tcb->rto = CONFIG_GNRC_TCP_RTO_LOWER_BOUND_MS;
-    }
-    else if (tcb->rto > (int32_t) CONFIG_GNRC_TCP_RTO_UPPER_BOUND_MS) {
-        tcb->rto = CONFIG_GNRC_TCP_RTO_UPPER_BOUND_MS;
+    /* The retransmission timer covers the oldest unacknowledged packet */
+    if (tcb->pkt_retransmit_numof == 1) {
+        _sched_retransmit(tcb, false);
     }
+    TCP_DEBUG_LEAVE;
+    return 0;
+}
 
-    /* Setup retransmission timer, msg to TCP thread with ptr to TCB */
-    _gnrc_tcp_eventloop_sched(&tcb->event_retransmit, tcb->rto,
-                              MSG_TYPE_RETRANSMISSION, tcb);
+int _gnrc_tcp_pkt_retransmit_first(gnrc_tcp_tcb_t *tcb)
+{
+    TCP_DEBUG_ENTER;
+    /* Retransmission queue is empty. Nothing to retransmit */
+    if (tcb->pkt_retransmit_numof == 0) {
+        TCP_DEBUG_ERROR("-ENODATA: No packet to retransmit.");
+        TCP_DEBUG_LEAVE;
+        return -ENODATA;
+    }
+    /* Increase users: every send attempt consumes a user */
+    gnrc_pktbuf_hold(tcb->pkt_retransmit[0], 1);
+    _gnrc_tcp_pkt_send(tcb, tcb->pkt_retransmit[0], 0, true);
     TCP_DEBUG_LEAVE;
     return 0;
 }
@@ -454,34 +529,45 @@ int _gnrc_tcp_pkt_acknowledge(gnrc_tcp_tcb_t *tcb, const uint32_t ack)
 {
     TCP_DEBUG_ENTER;
     uint32_t seg = 0;
+    uint8_t acked = 0;
     gnrc_pktsnip_t *snp = NULL;
     tcp_hdr_t *hdr;
 
     /* Retransmission queue is empty. Nothing to ACK there */
-    if (tcb->pkt_retransmit == NULL) {
+    if (tcb->pkt_retransmit_numof == 0) {
         TCP_DEBUG_ERROR("-ENODATA: No packet to acknowledge.");
         TCP_DEBUG_LEAVE;
         return -ENODATA;
     }
 
-    snp = gnrc_pktsnip_search_type(tcb->pkt_retransmit, GNRC_NETTYPE_TCP);
-    hdr = (tcp_hdr_t *) snp->data;
-
-    /* There must be a packet, waiting to be acknowledged. */
-    seg = byteorder_ntohl(hdr->seq_num) + _gnrc_tcp_pkt_get_seg_len(
-        tcb->pkt_retransmit) - 1;
-
-        /* If segment can be acknowledged -> stop timer, release packet from pktbuf and update rto. */
-    if (LSS_32_BIT(seg, ack)) {
-        _gnrc_tcp_eventloop_unsched(&tcb->event_retransmit);
-        gnrc_pktbuf_release(tcb->pkt_retransmit);
-        tcb->pkt_retransmit = NULL;
+    /* Release all packets that are acknowledged. */
+    while (acked < tcb->pkt_retransmit_numof) {
+        snp = gnrc_pktsnip_search_type(tcb->pkt_retransmit[acked], GNRC_NETTYPE_TCP);
+        hdr = (tcp_hdr_t *) snp->data;
+        seg = byteorder_ntohl(hdr->seq_num) + _gnrc_tcp_pkt_get_seg_len(
+            tcb->pkt_retransmit[acked]) - 1;
+        if (!LSS_32_BIT(seg, ack)) {
+            break;
+        }
+        gnrc_pktbuf_release(tcb->pkt_retransmit[acked]);
+        acked++;
+    }
+    if (acked == 0) {
+        TCP_DEBUG_LEAVE;
+        return 0;
+    }
+    tcb->pkt_retransmit_numof -= acked;
+    memmove(&tcb->pkt_retransmit[0], &tcb->pkt_retransmit[acked],
+            tcb->pkt_retransmit_numof * sizeof(tcb->pkt_retransmit[0]));
+    tcb->retries = 0;
 
-        /* Measure round trip time */
+    /* Measure round trip time, if the timed segment was acknowledged */
+    if ((tcb->status & STATUS_RTT_PENDING) && LEQ_32_BIT(tcb->rtt_seq, ack)) {
         int32_t rtt = evtimer_now_msec() - tcb->rtt_start;
 
-        /* Use time only if there was no timer overflow and no retransmission (Karns Algorithm) */
-        if (tcb->retries == 0 && rtt > 0) {
+        tcb->status &= ~STATUS_RTT_PENDING;
+        /* Use time only if there was no timer overflow */
+        if (rtt > 0) {
             /* If this is the first sample taken */
             if (tcb->srtt == RTO_UNINITIALIZED && tcb->rtt_var == RTO_UNINITIALIZED) {
                 tcb->srtt = rtt;
@@ -496,6 +582,14 @@ int _gnrc_tcp_pkt_acknowledge(gnrc_tcp_tcb_t *tcb, const uint32_t ack)
             }
         }
     }
+
+    /* Restart retransmission timer for the remaining packets, stop it if none are left */
+    if (tcb->pkt_retransmit_numof > 0) {
+        _sched_retransmit(tcb, false);
+    }
+    else {
+        _gnrc_tcp_eventloop_unsched(&tcb->event_retransmit);
+    }
     TCP_DEBUG_LEAVE;
     return 0;
 }
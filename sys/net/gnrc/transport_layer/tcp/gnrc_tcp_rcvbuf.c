@@ -18,6 +18,8 @@
 #include <errno.h>
 #include <mutex.h>
 #include <stdint.h>
+#include "assert.h"
+#include "net/tcp.h"
 #include "net/gnrc/tcp/config.h"
 #include "include/gnrc_tcp_common.h"
 #include "include/gnrc_tcp_rcvbuf.h"
@@ -25,6 +27,10 @@
 #define ENABLE_DEBUG 0
 #include "debug.h"
 
+/* The receive window can't be advertised beyond the largest scaled window */
+static_assert(GNRC_TCP_RCV_BUF_SIZE <= ((uint32_t)UINT16_MAX << TCP_OPTION_WS_SHIFT_MAX),
+              "GNRC_TCP_RCV_BUF_SIZE exceeds the maximum TCP window size");
+
 /**
  * @brief Receive buffer entry.
  */
@@ -109,6 +115,7 @@ int _gnrc_tcp_rcvbuf_get_buffer(gnrc_tcp_tcb_t *tcb)
         }
         else {
             ringbuffer_init(&tcb->rcv_buf, (char *) tcb->rcv_buf_raw, GNRC_TCP_RCV_BUF_SIZE);
+            tcb->rcv_buf_lent = 0;
         }
     }
     TCP_DEBUG_LEAVE;
@@ -121,6 +128,7 @@ void _gnrc_tcp_rcvbuf_release_buffer(gnrc_tcp_tcb_t *tcb)
     if (tcb->rcv_buf_raw != NULL) {
         _rcvbuf_free(tcb->rcv_buf_raw);
         tcb->rcv_buf_raw = NULL;
+        tcb->rcv_buf_lent = 0;
     }
     TCP_DEBUG_LEAVE;
 }
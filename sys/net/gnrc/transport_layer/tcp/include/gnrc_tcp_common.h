@@ -47,6 +47,9 @@ extern "C" {
 #define STATUS_NOTIFY_USER    (1 << 2) /**< Internal: Status bitmask NOTIFY_USER */
 #define STATUS_ACCEPTED       (1 << 3) /**< Internal: Status bitmask ACCEPTED */
 #define STATUS_LOCKED         (1 << 4) /**< Internal: Status bitmask LOCKED */
+#define STATUS_WND_SCALE      (1 << 5) /**< Internal: Status bitmask WND_SCALE */
+#define STATUS_RTT_PENDING    (1 << 6) /**< Internal: Status bitmask RTT_PENDING */
+#define STATUS_RECOVERY       (1 << 7) /**< Internal: Status bitmask RECOVERY */
 /** @} */
 
 /**
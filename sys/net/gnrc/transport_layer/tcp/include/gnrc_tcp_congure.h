@@ -0,0 +1,160 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     net_gnrc_tcp
+ *
+ * @{
+ *
+ * @file
+ * @brief       TCP congestion control declarations.
+ *
+ * Without the module `gnrc_tcp_congure` the amount of data in flight is
+ * only limited by the peers receive window and
+ * @ref CONFIG_GNRC_TCP_RETRANSMIT_QUEUE_SIZE. With the module, it is
+ * additionally limited by the congestion window of a @ref sys_congure
+ * instance. The algorithm is selected with one of the following modules:
+ *
+ * - `gnrc_tcp_congure_reno`: @ref sys_congure_reno with NewReno fast
+ *   recovery (default)
+ */
+
+#ifndef GNRC_TCP_CONGURE_H
+#define GNRC_TCP_CONGURE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "kernel_defines.h"
+#include "net/gnrc/tcp/tcb.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if IS_USED(MODULE_GNRC_TCP_CONGURE) || defined(DOXYGEN)
+/**
+ * @brief Allocate a CongURE state object for a connection.
+ *
+ * @note Provided by the selected congestion control implementation.
+ *
+ * @returns   State object with congure_snd_t::driver set.
+ *            NULL if all state objects are in use.
+ */
+congure_snd_t *_gnrc_tcp_congure_snd_alloc(void);
+
+/**
+ * @brief Release a CongURE state object.
+ *
+ * @note Provided by the selected congestion control implementation.
+ *
+ * @param[in] c   State object allocated with _gnrc_tcp_congure_snd_alloc().
+ */
+void _gnrc_tcp_congure_snd_free(congure_snd_t *c);
+
+/**
+ * @brief Assign and initialize congestion state of a connection.
+ *
+ * @note Must be called after the peers MSS is known.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ */
+void _gnrc_tcp_congure_init(gnrc_tcp_tcb_t *tcb);
+
+/**
+ * @brief Release congestion state of a connection.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ */
+void _gnrc_tcp_congure_release(gnrc_tcp_tcb_t *tcb);
+
+/**
+ * @brief Get the congestion window of a connection.
+ *
+ * @param[in] tcb   TCB holding the connection information.
+ *
+ * @returns   Congestion window in bytes.
+ *            UINT32_MAX if the connection has no congestion state.
+ */
+uint32_t _gnrc_tcp_congure_cwnd(const gnrc_tcp_tcb_t *tcb);
+
+/**
+ * @brief Report that a segment was sent.
+ *
+ * @param[in,out] tcb    TCB holding the connection information.
+ * @param[in]     size   Number of bytes sent.
+ */
+void _gnrc_tcp_congure_report_sent(gnrc_tcp_tcb_t *tcb, uint32_t size);
+
+/**
+ * @brief Report an incoming ACK.
+ *
+ * @param[in,out] tcb       TCB holding the connection information.
+ * @param[in]     ack       Acknowledgment number of the ACK.
+ * @param[in]     acked     Number of newly acknowledged bytes.
+ * @param[in]     pay_len   Payload length of the segment carrying the ACK.
+ * @param[in]     clean     The ACK carries neither SYN nor FIN and advertises
+ *                          the same window as the previous ACK.
+ */
+void _gnrc_tcp_congure_report_acked(gnrc_tcp_tcb_t *tcb, uint32_t ack,
+                                    uint32_t acked, uint32_t pay_len,
+                                    bool clean);
+
+/**
+ * @brief Report that the retransmission timer expired.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ */
+void _gnrc_tcp_congure_report_timeout(gnrc_tcp_tcb_t *tcb);
+#else   /* IS_USED(MODULE_GNRC_TCP_CONGURE) || defined(DOXYGEN) */
+static inline void _gnrc_tcp_congure_init(gnrc_tcp_tcb_t *tcb)
+{
+    (void)tcb;
+}
+
+static inline void _gnrc_tcp_congure_release(gnrc_tcp_tcb_t *tcb)
+{
+    (void)tcb;
+}
+
+static inline uint32_t _gnrc_tcp_congure_cwnd(const gnrc_tcp_tcb_t *tcb)
+{
+    (void)tcb;
+    return UINT32_MAX;
+}
+
+static inline void _gnrc_tcp_congure_report_sent(gnrc_tcp_tcb_t *tcb,
+                                                 uint32_t size)
+{
+    (void)tcb;
+    (void)size;
+}
+
+static inline void _gnrc_tcp_congure_report_acked(gnrc_tcp_tcb_t *tcb,
+                                                  uint32_t ack, uint32_t acked,
+                                                  uint32_t pay_len, bool clean)
+{
+    (void)tcb;
+    (void)ack;
+    (void)acked;
+    (void)pay_len;
+    (void)clean;
+}
+
+static inline void _gnrc_tcp_congure_report_timeout(gnrc_tcp_tcb_t *tcb)
+{
+    (void)tcb;
+}
+#endif  /* IS_USED(MODULE_GNRC_TCP_CONGURE) || defined(DOXYGEN) */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* GNRC_TCP_CONGURE_H */
+/** @} */
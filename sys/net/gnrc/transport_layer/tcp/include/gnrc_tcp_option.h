@@ -24,6 +24,7 @@
 #include "assert.h"
 #include "net/tcp.h"
 #include "net/gnrc/tcp/tcb.h"
+#include "gnrc_tcp_common.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -42,6 +43,51 @@ static inline uint32_t _gnrc_tcp_option_build_mss(uint16_t mss)
             ((uint32_t) TCP_OPTION_LENGTH_MSS << 16) | mss);
 }
 
+/**
+ * @brief Helper function to build the window scale option.
+ *
+ * @note The option is prefixed with a NOP to keep the option field aligned.
+ *
+ * @param[in] shift   Shift count that should be set.
+ *
+ * @returns   Window scale option value.
+ */
+static inline uint32_t _gnrc_tcp_option_build_wnd_scale(uint8_t shift)
+{
+    return (((uint32_t) TCP_OPTION_KIND_NOP << 24) |
+            ((uint32_t) TCP_OPTION_KIND_WS << 16) |
+            ((uint32_t) TCP_OPTION_LENGTH_WS << 8) | shift);
+}
+
+/**
+ * @brief Get the shift count announced in the window scale option.
+ *
+ * @returns   Smallest shift count that fits the receive buffer size into the
+ *            window field.
+ */
+static inline uint8_t _gnrc_tcp_option_wnd_scale_shift(void)
+{
+    uint8_t shift = 0;
+
+    while (((GNRC_TCP_RCV_BUF_SIZE >> shift) > UINT16_MAX) &&
+           (shift < TCP_OPTION_WS_SHIFT_MAX)) {
+        shift++;
+    }
+    return shift;
+}
+
+/**
+ * @brief Get the shift count applied to the advertised receive window.
+ *
+ * @param[in] tcb   TCB holding the connection information.
+ *
+ * @returns   Shift count for the receive window of @p tcb.
+ */
+static inline uint8_t _gnrc_tcp_option_rcv_wnd_shift(const gnrc_tcp_tcb_t *tcb)
+{
+    return (tcb->status & STATUS_WND_SCALE) ? _gnrc_tcp_option_wnd_scale_shift() : 0;
+}
+
 /**
  * @brief Helper function to build the combined option and control flag field.
  *
@@ -59,6 +105,9 @@ static inline uint16_t _gnrc_tcp_option_build_offset_control(uint16_t nopts, uin
 /**
  * @brief Parses options of a given TCP header.
  *
+ * @note The window scale option is only evaluated in SYN segments. Each
+ *       SYN segment renegotiates window scaling for @p tcb.
+ *
  * @param[in,out] tcb   TCB holding the connection information.
  * @param[in]     hdr   TCP header to be parsed.
  *
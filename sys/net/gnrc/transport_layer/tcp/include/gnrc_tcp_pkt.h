@@ -113,17 +113,30 @@ uint32_t _gnrc_tcp_pkt_get_pay_len(gnrc_pktsnip_t *pkt);
  *
  * @param[in,out] tcb          TCB holding the connection information.
  * @param[in]     pkt          Packet to add to the retransmission mechanism.
- * @param[in]     retransmit   Flag used to indicate that @p pkt is a retransmit.
+ * @param[in]     retransmit   Flag used to indicate that @p pkt is a retransmit
+ *                             after a timeout. @p pkt must be the oldest packet
+ *                             in the retransmission queue.
  *
  * @returns   Zero on success.
  *            -ENOMEM if the retransmission queue is full.
- *            -EINVAL if pkt is null.
+ *            -EINVAL if pkt is null or not the oldest packet on retransmit.
  */
 int _gnrc_tcp_pkt_setup_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt,
                                    const bool retransmit);
 
 /**
- * @brief Acknowledges and removes packet from the retransmission mechanism.
+ * @brief Retransmits the oldest packet of the retransmission queue without
+ *        waiting for the retransmission timer (fast retransmit).
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ *
+ * @returns   Zero on success.
+ *            -ENODATA if the retransmission queue is empty.
+ */
+int _gnrc_tcp_pkt_retransmit_first(gnrc_tcp_tcb_t *tcb);
+
+/**
+ * @brief Acknowledges and removes packets from the retransmission mechanism.
  *
  * @param[in,out] tcb   TCB holding the connection information.
  * @param[in]     ack   Acknowldegment number used to acknowledge packets.
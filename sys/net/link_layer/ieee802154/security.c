@@ -26,9 +26,15 @@
 const ieee802154_radio_cipher_ops_t ieee802154_radio_cipher_ops = {
     .set_key = NULL,
     .ecb = NULL,
-    .cbc = NULL
+    .cbc = NULL,
+    .ccm = NULL,
 };
 
+/**
+ * @brief   Number of blocks passed to the block cipher at once
+ */
+#define BATCH_BLOCKS    (4U)
+
 static inline uint16_t _min(uint16_t a, uint16_t b)
 {
     return a < b ? a : b;
@@ -37,10 +43,17 @@ static inline uint16_t _min(uint16_t a, uint16_t b)
 static void _set_key(ieee802154_sec_context_t *ctx,
                      const uint8_t *key)
 {
+    if (key == ctx->dev_key) {
+        /* loading the key costs a bus transfer with most transceivers */
+        return;
+    }
     if (ctx->dev.cipher_ops->set_key) {
         ctx->dev.cipher_ops->set_key(&ctx->dev, key, IEEE802154_SEC_BLOCK_SIZE);
     }
-    memcpy(ctx->cipher.context.context, key, IEEE802154_SEC_KEY_LENGTH);
+    if (key != ctx->cipher.context.context) {
+        memcpy(ctx->cipher.context.context, key, IEEE802154_SEC_KEY_LENGTH);
+    }
+    ctx->dev_key = key;
 }
 
 /**
@@ -239,19 +252,25 @@ static uint8_t _set_aux_hdr(const ieee802154_sec_context_t *ctx,
     return len;
 }
 
+static inline void _init_nonce(ieee802154_sec_ccm_nonce_t *nonce,
+                               uint32_t frame_counter,
+                               uint8_t security_level,
+                               const uint8_t *src_address)
+{
+    memcpy(nonce->src_addr, src_address, IEEE802154_LONG_ADDRESS_LEN);
+    nonce->frame_counter = htonl(frame_counter);
+    nonce->security_level = security_level;
+}
+
 /**
  * @brief   Construct the first block A0 for CTR
  */
 static inline void _init_ctr_A0(ieee802154_sec_ccm_block_t *A0,
-                                uint32_t frame_counter,
-                                uint8_t security_level,
-                                const uint8_t *src_address)
+                                const ieee802154_sec_ccm_nonce_t *nonce)
 {
     A0->flags = _ccm_flag(0, 2);
-    A0->nonce.frame_counter = htonl(frame_counter);
-    A0->nonce.security_level = security_level;
+    A0->nonce = *nonce;
     A0->counter = 0;
-    memcpy(A0->nonce.src_addr, src_address, IEEE802154_LONG_ADDRESS_LEN);
 }
 
 /**
@@ -266,17 +285,13 @@ static inline void _advance_ctr_Ai(ieee802154_sec_ccm_block_t *Ai)
  * @brief   Construct the first block B0 for CBC-MAC
  */
 static inline void _init_cbc_B0(ieee802154_sec_ccm_block_t *B0,
-                                uint32_t frame_counter,
-                                uint8_t security_level,
+                                const ieee802154_sec_ccm_nonce_t *nonce,
                                 uint16_t m_len,
-                                uint8_t mic_size,
-                                const uint8_t *src_address)
+                                uint8_t mic_size)
 {
     B0->flags = _ccm_flag(mic_size, 2);
-    B0->nonce.frame_counter = htonl(frame_counter),
-    B0->nonce.security_level = security_level,
+    B0->nonce = *nonce;
     B0->counter = htons(m_len);
-    memcpy(B0->nonce.src_addr, src_address, IEEE802154_LONG_ADDRESS_LEN);
 }
 
 static const uint8_t *_get_encryption_key(const ieee802154_sec_context_t *ctx,
@@ -303,44 +318,81 @@ static const uint8_t *_get_decryption_key(const ieee802154_sec_context_t *ctx,
     return ctx->cipher.context.context;
 }
 
-/**
- * @brief   Perform ECB on one block of data and and add padding if necessary
- */
-static uint8_t _ecb(ieee802154_sec_context_t *ctx,
-                    uint8_t *tmp1, uint8_t *tmp2, uint8_t *data,
-                    const uint8_t *Ai, uint16_t size)
+static void _ecb(ieee802154_sec_context_t *ctx, uint8_t *cipher,
+                 const uint8_t *plain, uint8_t nblocks)
 {
-    uint16_t s = _min(IEEE802154_SEC_BLOCK_SIZE, size);
     if (ctx->dev.cipher_ops->ecb) {
-        ctx->dev.cipher_ops->ecb(&ctx->dev, tmp2, Ai, 1);
+        ctx->dev.cipher_ops->ecb(&ctx->dev, cipher, plain, nblocks);
     }
     else {
-        _sec_ecb(&ctx->dev, tmp2, Ai, 1);
+        _sec_ecb(&ctx->dev, cipher, plain, nblocks);
+    }
+}
+
+static void _cbc(ieee802154_sec_context_t *ctx, uint8_t *cipher, uint8_t *iv,
+                 const uint8_t *plain, uint8_t nblocks)
+{
+    if (ctx->dev.cipher_ops->cbc) {
+        ctx->dev.cipher_ops->cbc(&ctx->dev, cipher, iv, plain, nblocks);
+    }
+    else {
+        _sec_cbc(&ctx->dev, cipher, iv, plain, nblocks);
     }
-    memcpy(tmp1, data, s);
-    memset(tmp1 + s, 0, IEEE802154_SEC_BLOCK_SIZE - s);
-    _memxor(tmp1, tmp2, IEEE802154_SEC_BLOCK_SIZE);
-    memcpy(data, tmp1, s);
-    return s;
 }
 
 /**
- * @brief   Perform CBC on one block of data and add padding if necessary
+ * @brief   State of a CBC-MAC computation, input is collected to pass
+ *          @ref BATCH_BLOCKS blocks to the cipher at once
  */
-static uint8_t _cbc_next(ieee802154_sec_context_t *ctx,
-                         uint8_t *last, uint8_t *tmp,
-                         const uint8_t *next, uint16_t size)
-{
-    uint16_t s = _min(IEEE802154_SEC_BLOCK_SIZE, size);
-    memcpy(tmp, next, s);
-    memset(tmp + s, 0, IEEE802154_SEC_BLOCK_SIZE - s);
-    if (ctx->dev.cipher_ops->cbc){
-        ctx->dev.cipher_ops->cbc(&ctx->dev, last, last, tmp, 1);
+typedef struct {
+    uint8_t mac[IEEE802154_SEC_BLOCK_SIZE];
+    uint8_t in[BATCH_BLOCKS * IEEE802154_SEC_BLOCK_SIZE];
+    uint8_t out[BATCH_BLOCKS * IEEE802154_SEC_BLOCK_SIZE];
+    uint8_t fill;
+} _cbc_mac_t;
+
+static void _cbc_mac_flush(ieee802154_sec_context_t *ctx, _cbc_mac_t *state)
+{
+    uint8_t nblocks = state->fill / IEEE802154_SEC_BLOCK_SIZE;
+
+    if (nblocks) {
+        _cbc(ctx, state->out, state->mac, state->in, nblocks);
+        memcpy(state->mac,
+               &state->out[(nblocks - 1) * IEEE802154_SEC_BLOCK_SIZE],
+               IEEE802154_SEC_BLOCK_SIZE);
+        state->fill = 0;
     }
-    else {
-        _sec_cbc(&ctx->dev, last, last, tmp, 1);
+}
+
+static void _cbc_mac_update(ieee802154_sec_context_t *ctx, _cbc_mac_t *state,
+                            const void *data, uint16_t len)
+{
+    const uint8_t *in = data;
+
+    while (len) {
+        uint16_t s = _min(sizeof(state->in) - state->fill, len);
+
+        memcpy(&state->in[state->fill], in, s);
+        state->fill += s;
+        in += s;
+        len -= s;
+        if (state->fill == sizeof(state->in)) {
+            _cbc_mac_flush(ctx, state);
+        }
+    }
+}
+
+/**
+ * @brief   Pad the input with zeros to a multiple of the block size
+ */
+static void _cbc_mac_pad(ieee802154_sec_context_t *ctx, _cbc_mac_t *state)
+{
+    static const uint8_t zeros[IEEE802154_SEC_BLOCK_SIZE];
+    uint8_t rem = state->fill % IEEE802154_SEC_BLOCK_SIZE;
+
+    if (rem) {
+        _cbc_mac_update(ctx, state, zeros, IEEE802154_SEC_BLOCK_SIZE - rem);
     }
-    return s;
 }
 
 static void _comp_mic(ieee802154_sec_context_t *ctx,
@@ -349,44 +401,72 @@ static void _comp_mic(ieee802154_sec_context_t *ctx,
                       const void *a, uint16_t a_len,
                       const void *m, uint16_t m_len)
 {
-    uint8_t tmp[IEEE802154_SEC_BLOCK_SIZE] = { 0 };
-    uint16_t off;
-    memset(mic, 0, IEEE802154_SEC_MAX_MAC_SIZE);
-    _cbc_next(ctx, mic, tmp, (uint8_t *)B0, sizeof(*B0));
-    byteorder_htobebufs(tmp, a_len);
-    off = _min(sizeof(tmp) - sizeof(uint16_t), a_len);
-    memcpy(tmp + sizeof(uint16_t), a, off);
-    _cbc_next(ctx, mic, tmp, tmp, sizeof(uint16_t) + off);
-    for (;off < a_len;) {
-        off += _cbc_next(ctx, mic, tmp, &(((uint8_t *)a)[off]), a_len - off);
-    }
-    for (off = 0; off < m_len;) {
-        off += _cbc_next(ctx, mic, tmp, &(((uint8_t *)m)[off]), m_len - off);
-    }
+    _cbc_mac_t state = { .fill = 0 };
+    uint8_t l_a[sizeof(uint16_t)];
+
+    memset(state.mac, 0, sizeof(state.mac));
+    byteorder_htobebufs(l_a, a_len);
+    _cbc_mac_update(ctx, &state, B0, sizeof(*B0));
+    _cbc_mac_update(ctx, &state, l_a, sizeof(l_a));
+    _cbc_mac_update(ctx, &state, a, a_len);
+    _cbc_mac_pad(ctx, &state);
+    _cbc_mac_update(ctx, &state, m, m_len);
+    _cbc_mac_pad(ctx, &state);
+    _cbc_mac_flush(ctx, &state);
+    memcpy(mic, state.mac, IEEE802154_SEC_MAX_MAC_SIZE);
 }
 
+/**
+ * @brief   XOR @p m with the key stream of the counter blocks following @p Ai
+ *
+ * @p Ai is advanced to the last counter block used.
+ */
 static void _ctr(ieee802154_sec_context_t *ctx,
-                 ieee802154_sec_ccm_block_t *A0,
-                 const void *m, uint16_t m_len)
+                 ieee802154_sec_ccm_block_t *Ai,
+                 void *m, uint16_t m_len)
 {
-    uint8_t tmp1[IEEE802154_SEC_BLOCK_SIZE] = { 0 };
-    uint8_t tmp2[IEEE802154_SEC_BLOCK_SIZE] = { 0 };
+    uint8_t ctr[BATCH_BLOCKS * IEEE802154_SEC_BLOCK_SIZE];
+    uint8_t stream[BATCH_BLOCKS * IEEE802154_SEC_BLOCK_SIZE];
+    uint8_t *data = m;
 
-    for (uint16_t off = 0; off < m_len;) {
-        _advance_ctr_Ai(A0);
-        off += _ecb(ctx, tmp1, tmp2,
-                    &(((uint8_t *)m)[off]), (uint8_t *)A0, m_len - off);
+    while (m_len) {
+        uint8_t nblocks = 0;
+
+        while ((nblocks < BATCH_BLOCKS) &&
+               (nblocks * IEEE802154_SEC_BLOCK_SIZE < m_len)) {
+            _advance_ctr_Ai(Ai);
+            memcpy(&ctr[nblocks++ * IEEE802154_SEC_BLOCK_SIZE], Ai, sizeof(*Ai));
+        }
+        _ecb(ctx, stream, ctr, nblocks);
+
+        uint16_t s = _min(nblocks * IEEE802154_SEC_BLOCK_SIZE, m_len);
+        _memxor(data, stream, s);
+        data += s;
+        m_len -= s;
     }
 }
 
 static void _ctr_mic(ieee802154_sec_context_t *ctx,
-                     ieee802154_sec_ccm_block_t *A0,
+                     const ieee802154_sec_ccm_block_t *A0,
                      void *mic, uint8_t mic_size)
 {
-    uint8_t tmp1[IEEE802154_SEC_BLOCK_SIZE] = { 0 };
-    uint8_t tmp2[IEEE802154_SEC_BLOCK_SIZE] = { 0 };
+    uint8_t stream[IEEE802154_SEC_BLOCK_SIZE];
 
-    _ecb(ctx, tmp1, tmp2, mic, (uint8_t *)A0, mic_size);
+    _ecb(ctx, stream, (const uint8_t *)A0, 1);
+    _memxor(mic, stream, mic_size);
+}
+
+static int _ccm_offload(ieee802154_sec_context_t *ctx,
+                        const ieee802154_sec_ccm_nonce_t *nonce,
+                        const uint8_t *a, uint16_t a_len,
+                        uint8_t *m, uint16_t m_len,
+                        uint8_t *mic, uint8_t mic_size, bool decrypt)
+{
+    if (!ctx->dev.cipher_ops->ccm) {
+        return -IEEE802154_SEC_UNSUPORTED;
+    }
+    return ctx->dev.cipher_ops->ccm(&ctx->dev, nonce, a, a_len, m, m_len,
+                                    mic, mic_size, decrypt);
 }
 
 void ieee802154_sec_init(ieee802154_sec_context_t *ctx)
@@ -401,6 +481,7 @@ void ieee802154_sec_init(ieee802154_sec_context_t *ctx)
     memset(ctx->key_source, 0, sizeof(ctx->key_source));
     ctx->key_index = 0;
     ctx->frame_counter = 0;
+    ctx->dev_key = NULL;
     uint8_t key[] = CONFIG_IEEE802154_SEC_DEFAULT_KEY;
     assert(sizeof(key) >= IEEE802154_SEC_KEY_LENGTH);
     assert(CIPHER_MAX_CONTEXT_SIZE >= IEEE802154_SEC_KEY_LENGTH);
@@ -444,20 +525,33 @@ int ieee802154_sec_encrypt_frame(ieee802154_sec_context_t *ctx,
     uint8_t *m = payload;
     uint16_t a_len = *header_size + aux_size;
     uint16_t m_len = payload_size;
+    ieee802154_sec_ccm_nonce_t nonce;
     ieee802154_sec_ccm_block_t ccm; /* Ai or Bi */
 
+    _init_nonce(&nonce, ctx->frame_counter, ctx->security_level, src_address);
+
+    int res = _ccm_offload(ctx, &nonce, a, a_len, m, m_len, mic, *mic_size, false);
+    if (res != -IEEE802154_SEC_UNSUPORTED) {
+        if (res < 0) {
+            return res;
+        }
+        *header_size += aux_size;
+        ctx->frame_counter++;
+        return IEEE802154_SEC_OK;
+    }
+
     /* compute MIC */
     if (_req_mac(ctx->security_level)) {
-        _init_cbc_B0(&ccm, ctx->frame_counter, ctx->security_level, m_len, *mic_size, src_address);
+        _init_cbc_B0(&ccm, &nonce, m_len, *mic_size);
         _comp_mic(ctx, mic, &ccm, a, a_len, m, m_len);
 
         /* encrypt MIC */
-        _init_ctr_A0(&ccm, ctx->frame_counter, ctx->security_level, src_address);
+        _init_ctr_A0(&ccm, &nonce);
         _ctr_mic(ctx, &ccm, mic, *mic_size);
     }
     /* encrypt payload */
     if (_req_encryption(ctx->security_level)) {
-        _init_ctr_A0(&ccm, ctx->frame_counter, ctx->security_level, src_address);
+        _init_ctr_A0(&ccm, &nonce);
         _ctr(ctx, &ccm, m, m_len);
     }
     *header_size += aux_size;
@@ -510,6 +604,7 @@ int ieee802154_sec_decrypt_frame(ieee802154_sec_context_t *ctx,
     uint16_t a_len = *header_size + aux_size;
     uint16_t c_len = *payload_size;
     uint8_t *mac = *mic;
+    ieee802154_sec_ccm_nonce_t nonce;
     ieee802154_sec_ccm_block_t ccm; /* Ai or Bi */
 
     /* TODO:
@@ -519,20 +614,31 @@ int ieee802154_sec_decrypt_frame(ieee802154_sec_context_t *ctx,
        But we do not store this information because we also do not have
        a proper key store, to avoid complexity on embedded devices. */
 
+    _init_nonce(&nonce, frame_counter, security_level, src_address);
+
+    int res = _ccm_offload(ctx, &nonce, a, a_len, c, c_len, mac, mac_size, true);
+    if (res != -IEEE802154_SEC_UNSUPORTED) {
+        if (res < 0) {
+            return -IEEE802154_SEC_MAC_CHECK_FAILURE;
+        }
+        *header_size += aux_size;
+        return IEEE802154_SEC_OK;
+    }
+
     /* decrypt MIC */
     if (mac_size) {
-        _init_ctr_A0(&ccm, frame_counter, security_level, src_address);
+        _init_ctr_A0(&ccm, &nonce);
         _ctr_mic(ctx, &ccm, mac, mac_size);
     }
     /* decrypt cipher */
     if (_req_encryption(security_level)) {
-        _init_ctr_A0(&ccm, frame_counter, security_level, src_address);
+        _init_ctr_A0(&ccm, &nonce);
         _ctr(ctx, &ccm, c, c_len);
     }
     /* check MIC */
     if (_req_mac(security_level)) {
         uint8_t tmp_mic[IEEE802154_SEC_MAX_MAC_SIZE];
-        _init_cbc_B0(&ccm, frame_counter, security_level, c_len, mac_size, src_address);
+        _init_cbc_B0(&ccm, &nonce, c_len, mac_size);
         _comp_mic(ctx, tmp_mic, &ccm, a, a_len, c, c_len);
         if (memcmp(tmp_mic, *mic, mac_size)) {
             return -IEEE802154_SEC_MAC_CHECK_FAILURE;
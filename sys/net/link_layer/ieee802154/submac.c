@@ -67,9 +67,24 @@ static bool _has_retrans_left(ieee802154_submac_t *submac)
     return submac->retrans < CONFIG_IEEE802154_DEFAULT_MAX_FRAME_RETRANS;
 }
 
+static int _handle_fsm_ev_request_tx(ieee802154_submac_t *submac);
+
+static void _prepare_tx(ieee802154_submac_t *submac, const iolist_t *iolist)
+{
+    uint8_t *buf = iolist->iol_base;
+    bool cnf = buf[0] & IEEE802154_FCF_ACK_REQ;
+
+    submac->wait_for_ack = cnf;
+    submac->psdu = iolist;
+    submac->retrans = 0;
+    submac->csma_retries_nb = 0;
+    submac->backoff_mask = (1 << submac->be.min) - 1;
+}
+
 static ieee802154_fsm_state_t _tx_end(ieee802154_submac_t *submac, int status,
                                       ieee802154_tx_info_t *info)
 {
+    ieee802154_fsm_state_t next_state = IEEE802154_FSM_STATE_IDLE;
     int res;
 
     /* This is required to prevent unused variable warnings */
@@ -80,8 +95,25 @@ static ieee802154_fsm_state_t _tx_end(ieee802154_submac_t *submac, int status,
     res = ieee802154_radio_set_idle(&submac->dev, true);
 
     assert(res >= 0);
+
+#if IS_USED(MODULE_IEEE802154_SUBMAC_PIPELINE)
+    /* Start the pending frame before reporting the previous one, so the
+     * upper layer can queue the next frame from within the TX done callback.
+     * The radio copies the frame, so the buffer can be reused right away. */
+    if (submac->next.iol_len) {
+        _prepare_tx(submac, &submac->next);
+        if (_handle_fsm_ev_request_tx(submac) == 0) {
+            next_state = IEEE802154_FSM_STATE_PREPARE;
+        }
+        else {
+            DEBUG("IEEE802154 submac: dropping pipelined frame\n");
+        }
+        submac->next.iol_len = 0;
+    }
+#endif
+
     submac->cb->tx_done(submac, status, info);
-    return IEEE802154_FSM_STATE_IDLE;
+    return next_state;
 }
 
 static void _print_debug(ieee802154_fsm_state_t old, ieee802154_fsm_state_t new,
@@ -403,26 +435,45 @@ ieee802154_fsm_state_t ieee802154_submac_process_ev(ieee802154_submac_t *submac,
     return submac->fsm_state;
 }
 
+#if IS_USED(MODULE_IEEE802154_SUBMAC_PIPELINE)
+static int _queue_next(ieee802154_submac_t *submac, const iolist_t *iolist)
+{
+    /* The RX and IDLE states are handled by the regular TX path, so the
+     * SubMAC is in the middle of a transmission here. */
+    if (iolist == NULL || submac->next.iol_len) {
+        return -EBUSY;
+    }
+
+    ssize_t len = iolist_to_buffer(iolist, submac->next_psdu,
+                                   IEEE802154_FRAME_LEN_MAX - IEEE802154_FCS_LEN);
+    if (len <= 0) {
+        return -EMSGSIZE;
+    }
+
+    submac->next.iol_next = NULL;
+    submac->next.iol_base = submac->next_psdu;
+    submac->next.iol_len = len;
+    return 0;
+}
+#endif
+
 int ieee802154_send(ieee802154_submac_t *submac, const iolist_t *iolist)
 {
     ieee802154_fsm_state_t current_state = submac->fsm_state;
 
     if (current_state != IEEE802154_FSM_STATE_RX && current_state != IEEE802154_FSM_STATE_IDLE) {
+#if IS_USED(MODULE_IEEE802154_SUBMAC_PIPELINE)
+        return _queue_next(submac, iolist);
+#else
         return -EBUSY;
+#endif
     }
 
     if (iolist == NULL) {
         return 0;
     }
 
-    uint8_t *buf = iolist->iol_base;
-    bool cnf = buf[0] & IEEE802154_FCF_ACK_REQ;
-
-    submac->wait_for_ack = cnf;
-    submac->psdu = iolist;
-    submac->retrans = 0;
-    submac->csma_retries_nb = 0;
-    submac->backoff_mask = (1 << submac->be.min) - 1;
+    _prepare_tx(submac, iolist);
 
     if (ieee802154_submac_process_ev(submac, IEEE802154_FSM_EV_REQUEST_TX)
         != IEEE802154_FSM_STATE_PREPARE) {
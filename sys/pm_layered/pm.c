@@ -25,6 +25,10 @@
 #include "irq.h"
 #include "periph/pm.h"
 #include "pm_layered.h"
+#ifdef MODULE_PM_LAYERED_TICKLESS
+#include "time_units.h"
+#include "ztimer.h"
+#endif
 
 #define ENABLE_DEBUG 0
 #include "debug.h"
@@ -56,6 +60,30 @@
  */
 static pm_blocker_t pm_blocker = { .blockers = PM_BLOCKER_INITIAL };
 
+#ifdef MODULE_PM_LAYERED_TICKLESS
+static const uint32_t _wakeup_latency_us[PM_NUM_MODES] = PM_WAKEUP_LATENCY_US;
+
+/**
+ * @brief   Time in microseconds until the next ztimer timer expires
+ */
+static uint32_t _idle_time_us(void)
+{
+    uint32_t res = UINT32_MAX;
+
+#if MODULE_ZTIMER_USEC
+    res = ztimer_until_next(ZTIMER_USEC);
+#endif
+#if MODULE_ZTIMER_MSEC
+    uint32_t ms = ztimer_until_next(ZTIMER_MSEC);
+    if ((ms < UINT32_MAX / US_PER_MS) && (ms * US_PER_MS < res)) {
+        res = ms * US_PER_MS;
+    }
+#endif
+
+    return res;
+}
+#endif
+
 void pm_set_lowest(void)
 {
     unsigned mode = PM_NUM_MODES;
@@ -69,6 +97,16 @@ void pm_set_lowest(void)
         mode--;
     }
 
+#ifdef MODULE_PM_LAYERED_TICKLESS
+    if (mode != PM_NUM_MODES) {
+        /* skip modes that cannot be left before the next timer is due */
+        uint32_t idle_us = _idle_time_us();
+        while ((mode != PM_NUM_MODES) && (_wakeup_latency_us[mode] > idle_us)) {
+            mode++;
+        }
+    }
+#endif
+
     if (mode != PM_NUM_MODES) {
         pm_set(mode);
     }
@@ -0,0 +1,347 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ * @ingroup posix_epoll
+ * @file
+ * @brief   epoll implementation for POSIX sockets
+ */
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdbool.h>
+#include <sys/epoll.h>
+
+#include "clist.h"
+#include "irq.h"
+#include "kernel_defines.h"
+#include "thread.h"
+#include "thread_flags.h"
+#include "timex.h"
+#include "vfs.h"
+#include "ztimer64.h"
+
+extern bool posix_socket_is(int fd);
+extern unsigned posix_socket_avail(int fd);
+extern int posix_socket_watch(int fd, void (*cb)(void *arg, bool closed),
+                              void *arg);
+
+typedef struct {
+    clist_node_t ready;         /**< items that may be ready */
+    thread_t *waiting;          /**< thread waiting in epoll_wait() */
+    bool used;                  /**< instance is in use */
+} _epoll_t;
+
+typedef struct {
+    clist_node_t node;          /**< entry in the ready list of epoll */
+    _epoll_t *epoll;            /**< instance, NULL if the item is unused */
+    epoll_data_t data;          /**< user data */
+    uint32_t events;            /**< events of interest */
+    int fd;                     /**< watched file descriptor */
+    bool queued;                /**< item is in the ready list */
+} _item_t;
+
+static _epoll_t _epolls[CONFIG_POSIX_EPOLL_NUMOF];
+static _item_t _items[CONFIG_POSIX_EPOLL_FD_NUMOF];
+
+/* all functions below must be called with IRQs disabled */
+static void _queue(_item_t *item)
+{
+    if (!item->queued) {
+        clist_rpush(&item->epoll->ready, &item->node);
+        item->queued = true;
+    }
+}
+
+static void _unqueue(_item_t *item)
+{
+    if (item->queued) {
+        clist_remove(&item->epoll->ready, &item->node);
+        item->queued = false;
+    }
+}
+
+static _item_t *_find(const _epoll_t *epoll, int fd)
+{
+    for (unsigned i = 0; i < CONFIG_POSIX_EPOLL_FD_NUMOF; i++) {
+        if ((_items[i].epoll == epoll) && (_items[i].fd == fd)) {
+            return &_items[i];
+        }
+    }
+    return NULL;
+}
+
+static void _watch_cb(void *arg, bool closed)
+{
+    _item_t *item = arg;
+    thread_t *waiting;
+    unsigned state = irq_disable();
+
+    if (item->epoll == NULL) {
+        irq_restore(state);
+        return;
+    }
+    waiting = item->epoll->waiting;
+    if (closed) {
+        _unqueue(item);
+        item->epoll = NULL;
+    }
+    else if (item->events & EPOLLIN) {
+        _queue(item);
+    }
+    irq_restore(state);
+
+    if (waiting) {
+        thread_flags_set(waiting, POSIX_EPOLL_THREAD_FLAG);
+    }
+}
+
+static int _epoll_close(vfs_file_t *filp)
+{
+    _epoll_t *epoll = filp->private_data.ptr;
+
+    for (unsigned i = 0; i < CONFIG_POSIX_EPOLL_FD_NUMOF; i++) {
+        if (_items[i].epoll == epoll) {
+            posix_socket_watch(_items[i].fd, NULL, NULL);
+            unsigned state = irq_disable();
+            _unqueue(&_items[i]);
+            _items[i].epoll = NULL;
+            irq_restore(state);
+        }
+    }
+    epoll->used = false;
+    return 0;
+}
+
+static const vfs_file_ops_t _epoll_ops = {
+    .close = _epoll_close,
+};
+
+static _epoll_t *_get_epoll(int fd)
+{
+    const vfs_file_t *file = vfs_file_get(fd);
+
+    if ((file == NULL) || (file->f_op != &_epoll_ops)) {
+        return NULL;
+    }
+    return file->private_data.ptr;
+}
+
+int epoll_create1(int flags)
+{
+    if (flags & ~EPOLL_CLOEXEC) {
+        errno = EINVAL;
+        return -1;
+    }
+
+    unsigned state = irq_disable();
+    for (unsigned i = 0; i < CONFIG_POSIX_EPOLL_NUMOF; i++) {
+        if (!_epolls[i].used) {
+            _epolls[i].used = true;
+            irq_restore(state);
+
+            _epolls[i].ready.next = NULL;
+            _epolls[i].waiting = NULL;
+            int fd = vfs_bind(VFS_ANY_FD, O_RDWR, &_epoll_ops, &_epolls[i]);
+            if (fd < 0) {
+                _epolls[i].used = false;
+                errno = -fd;
+                return -1;
+            }
+            return fd;
+        }
+    }
+    irq_restore(state);
+    errno = ENFILE;
+    return -1;
+}
+
+int epoll_create(int size)
+{
+    if (size <= 0) {
+        errno = EINVAL;
+        return -1;
+    }
+    return epoll_create1(0);
+}
+
+static int _add(_epoll_t *epoll, int fd, const struct epoll_event *event)
+{
+    _item_t *item = NULL;
+    unsigned state = irq_disable();
+
+    if (_find(epoll, fd) != NULL) {
+        irq_restore(state);
+        errno = EEXIST;
+        return -1;
+    }
+    for (unsigned i = 0; i < CONFIG_POSIX_EPOLL_FD_NUMOF; i++) {
+        if (_items[i].epoll == NULL) {
+            item = &_items[i];
+            item->queued = false;
+            item->fd = fd;
+            item->events = event->events;
+            item->data = event->data;
+            item->epoll = epoll;
+            break;
+        }
+    }
+    irq_restore(state);
+
+    if (item == NULL) {
+        errno = ENOSPC;
+        return -1;
+    }
+    if (posix_socket_watch(fd, _watch_cb, item) < 0) {
+        item->epoll = NULL;
+        return -1;
+    }
+    /* the socket may have been ready before, epoll_wait() checks it */
+    state = irq_disable();
+    _queue(item);
+    irq_restore(state);
+    return 0;
+}
+
+int epoll_ctl(int epfd, int op, int fd, struct epoll_event *event)
+{
+    _epoll_t *epoll = _get_epoll(epfd);
+    _item_t *item = NULL;
+    unsigned state;
+
+    if (epoll == NULL) {
+        errno = EBADF;
+        return -1;
+    }
+    if (!posix_socket_is(fd)) {
+        errno = EPERM;
+        return -1;
+    }
+    if ((op != EPOLL_CTL_DEL) && (event == NULL)) {
+        errno = EFAULT;
+        return -1;
+    }
+
+    switch (op) {
+        case EPOLL_CTL_ADD:
+            return _add(epoll, fd, event);
+        case EPOLL_CTL_MOD:
+            state = irq_disable();
+            item = _find(epoll, fd);
+            if (item != NULL) {
+                item->events = event->events;
+                item->data = event->data;
+                _queue(item);
+            }
+            irq_restore(state);
+            break;
+        case EPOLL_CTL_DEL:
+            state = irq_disable();
+            item = _find(epoll, fd);
+            irq_restore(state);
+            if (item != NULL) {
+                /* stop the callback before the item can be reused */
+                posix_socket_watch(fd, NULL, NULL);
+                state = irq_disable();
+                _unqueue(item);
+                item->epoll = NULL;
+                irq_restore(state);
+            }
+            break;
+        default:
+            errno = EINVAL;
+            return -1;
+    }
+    if (item == NULL) {
+        errno = ENOENT;
+        return -1;
+    }
+    return 0;
+}
+
+static int _collect(_epoll_t *epoll, struct epoll_event *events,
+                    int maxevents)
+{
+    int n = 0;
+    unsigned state = irq_disable();
+    /* items re-queued below are only visited on the next call */
+    size_t count = clist_count(&epoll->ready);
+
+    while ((count-- > 0) && (n < maxevents)) {
+        _item_t *item = container_of(clist_lpop(&epoll->ready), _item_t,
+                                     node);
+        item->queued = false;
+        irq_restore(state);
+
+        uint32_t revents = item->events & EPOLLOUT;
+        if ((item->events & EPOLLIN) && (posix_socket_avail(item->fd) > 0)) {
+            revents |= EPOLLIN;
+        }
+
+        state = irq_disable();
+        if (revents && (item->epoll == epoll)) {
+            events[n].events = revents;
+            events[n].data = item->data;
+            n++;
+            if (item->events & EPOLLONESHOT) {
+                /* disabled until re-armed with EPOLL_CTL_MOD */
+                item->events = 0;
+            }
+            else if (!(item->events & EPOLLET)) {
+                /* level-triggered: stays ready until it is drained */
+                _queue(item);
+            }
+        }
+    }
+    irq_restore(state);
+    return n;
+}
+
+int epoll_wait(int epfd, struct epoll_event *events, int maxevents,
+               int timeout)
+{
+    _epoll_t *epoll = _get_epoll(epfd);
+    ztimer64_t timeout_timer;
+    int n;
+
+    if (epoll == NULL) {
+        errno = EBADF;
+        return -1;
+    }
+    if (maxevents <= 0) {
+        errno = EINVAL;
+        return -1;
+    }
+
+    epoll->waiting = thread_get_active();
+    n = _collect(epoll, events, maxevents);
+    if ((n > 0) || (timeout == 0)) {
+        epoll->waiting = NULL;
+        return n;
+    }
+    if (timeout > 0) {
+        ztimer64_set_timeout_flag(ZTIMER64_USEC, &timeout_timer,
+                                  (uint64_t)timeout * US_PER_MS);
+    }
+    while (n == 0) {
+        thread_flags_t tflags = thread_flags_wait_any(POSIX_EPOLL_THREAD_FLAG |
+                                                      THREAD_FLAG_TIMEOUT);
+        if (tflags & THREAD_FLAG_TIMEOUT) {
+            break;
+        }
+        n = _collect(epoll, events, maxevents);
+    }
+    if (timeout > 0) {
+        ztimer64_remove(ZTIMER64_USEC, &timeout_timer);
+    }
+    epoll->waiting = NULL;
+    return n;
+}
+
+/** @} */
@@ -0,0 +1,85 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @addtogroup  posix_select
+ * @{
+ *
+ * @file
+ * @brief   Definitions for the poll() function
+ * @see     [The Open Group Base Specification Issue 7, 2018 edition,
+ *          <poll.h>](https://pubs.opengroup.org/onlinepubs/9699919799.2018edition/basedefs/poll.h.html)
+ */
+
+#ifndef POLL_H
+#define POLL_H
+
+#if defined(CPU_NATIVE) && !defined(DOXYGEN)
+/* native uses the host's poll() internally, so the host's definitions have to
+ * be used. They are the same as below. */
+#pragma GCC system_header
+/* without the GCC pragma above #include_next will trigger a pedantic error */
+#include_next <poll.h>
+#else
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define POLLIN      0x001   /**< Data other than high-priority data may be read */
+#define POLLPRI     0x002   /**< High-priority data may be read */
+#define POLLOUT     0x004   /**< Normal data may be written */
+#define POLLERR     0x008   /**< An error has occurred */
+#define POLLHUP     0x010   /**< Device has been disconnected */
+#define POLLNVAL    0x020   /**< Invalid fd member */
+
+#define POLLRDNORM  POLLIN  /**< Normal data may be read */
+#define POLLWRNORM  POLLOUT /**< Equivalent to POLLOUT */
+
+/**
+ * @brief   Type used for the number of file descriptors
+ */
+typedef unsigned long nfds_t;
+
+/**
+ * @brief   File descriptor to be polled
+ */
+struct pollfd {
+    int fd;         /**< The file descriptor to poll, ignored if negative */
+    short events;   /**< The events of interest */
+    short revents;  /**< The events that occurred */
+};
+
+/**
+ * @brief   Waits for a set of file descriptors to become ready
+ *
+ * @note    Only [sockets](@ref posix_sockets) are supported. Sockets are
+ *          always considered writable.
+ *
+ * @param[in,out] fds   The file descriptors to check. The events found for
+ *                      every descriptor are stored in its
+ *                      pollfd::revents member.
+ * @param[in] nfds      The number of elements in @p fds
+ * @param[in] timeout   The timeout in milliseconds. 0 to return immediately,
+ *                      -1 to wait indefinitely.
+ *
+ * @return  The number of elements in @p fds with a non-zero pollfd::revents
+ *          member
+ * @return  0, if the timeout expired before any descriptor became ready
+ * @return  -1 on error, errno is set to indicate the error
+ */
+int poll(struct pollfd fds[], nfds_t nfds, int timeout);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CPU_NATIVE */
+
+#endif /* POLL_H */
+/** @} */
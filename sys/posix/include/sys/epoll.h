@@ -0,0 +1,188 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup posix_epoll    epoll
+ * @ingroup  posix
+ * @brief   Linux compatible epoll interface for POSIX sockets
+ *
+ * Unlike @ref select() and @ref poll(), which check every file descriptor
+ * passed to them on every call, an epoll instance keeps an interest list of
+ * file descriptors. The sock_async callback of a socket queues its entry to
+ * the ready list of the instance, so epoll_wait() only visits the file
+ * descriptors that became ready.
+ *
+ * Both level-triggered (default) and edge-triggered (@ref EPOLLET) as well as
+ * one-shot (@ref EPOLLONESHOT) notification are supported. Limitations:
+ *
+ * - Only [sockets](@ref posix_sockets) are supported, other file descriptors
+ *   are refused with `EPERM`.
+ * - A socket can be in the interest list of a single epoll instance only.
+ * - Sockets are always considered writable, so @ref EPOLLOUT is reported
+ *   whenever it is requested.
+ * - A socket is removed from the interest list when it is closed.
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~{.c}
+ * struct epoll_event ev = { .events = EPOLLIN, .data.fd = sock };
+ * struct epoll_event ready[4];
+ * int epfd = epoll_create1(0);
+ *
+ * epoll_ctl(epfd, EPOLL_CTL_ADD, sock, &ev);
+ * while (1) {
+ *     int n = epoll_wait(epfd, ready, ARRAY_SIZE(ready), -1);
+ *     for (int i = 0; i < n; i++) {
+ *         recv(ready[i].data.fd, buf, sizeof(buf), 0);
+ *     }
+ * }
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ *
+ * @see     [epoll(7)](https://man7.org/linux/man-pages/man7/epoll.7.html)
+ * @{
+ *
+ * @file
+ * @brief   epoll definitions
+ */
+
+#ifndef SYS_EPOLL_H
+#define SYS_EPOLL_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @addtogroup  config_posix
+ * @{
+ */
+/**
+ * @brief   Maximum number of epoll instances
+ */
+#ifndef CONFIG_POSIX_EPOLL_NUMOF
+#define CONFIG_POSIX_EPOLL_NUMOF        (1U)
+#endif
+
+/**
+ * @brief   Maximum number of file descriptors in the interest lists of all
+ *          epoll instances together
+ */
+#ifndef CONFIG_POSIX_EPOLL_FD_NUMOF
+#define CONFIG_POSIX_EPOLL_FD_NUMOF     (8U)
+#endif
+/** @} */
+
+/**
+ * @brief   @ref core_thread_flags for epoll
+ *
+ * The same flag as @ref POSIX_SELECT_THREAD_FLAG, a thread can only wait in
+ * one of them at a time.
+ */
+#define POSIX_EPOLL_THREAD_FLAG     (1U << 3)
+
+/**
+ * @name    epoll_ctl() operations
+ * @{
+ */
+#define EPOLL_CTL_ADD   1   /**< Add a file descriptor to the interest list */
+#define EPOLL_CTL_DEL   2   /**< Remove a file descriptor from the interest list */
+#define EPOLL_CTL_MOD   3   /**< Change the events of a file descriptor */
+/** @} */
+
+/**
+ * @name    epoll events
+ * @{
+ */
+#define EPOLLIN         0x001U      /**< Data is available to be read */
+#define EPOLLOUT        0x004U      /**< Data may be written */
+#define EPOLLERR        0x008U      /**< An error has occurred */
+#define EPOLLHUP        0x010U      /**< The peer hung up */
+#define EPOLLONESHOT    (1U << 30)  /**< Disable the entry after one event */
+#define EPOLLET         (1U << 31)  /**< Edge-triggered notification */
+/** @} */
+
+/**
+ * @brief   Flag for epoll_create1() to set close-on-exec, ignored by RIOT
+ */
+#define EPOLL_CLOEXEC   0x80000
+
+/**
+ * @brief   User data of an interest list entry
+ */
+typedef union epoll_data {
+    void *ptr;      /**< pointer */
+    int fd;         /**< file descriptor */
+    uint32_t u32;   /**< 32 bit value */
+    uint64_t u64;   /**< 64 bit value */
+} epoll_data_t;
+
+/**
+ * @brief   Event of an interest list entry
+ */
+struct epoll_event {
+    uint32_t events;    /**< epoll events */
+    epoll_data_t data;  /**< user data */
+};
+
+/**
+ * @brief   Creates a new epoll instance
+ *
+ * @param[in] flags     0 or @ref EPOLL_CLOEXEC
+ *
+ * @return  file descriptor of the new instance, to be closed with `close()`
+ * @return  -1 on error, errno is set to indicate the error
+ */
+int epoll_create1(int flags);
+
+/**
+ * @brief   Creates a new epoll instance
+ *
+ * @param[in] size      ignored, but has to be greater than 0
+ *
+ * @return  file descriptor of the new instance, to be closed with `close()`
+ * @return  -1 on error, errno is set to indicate the error
+ */
+int epoll_create(int size);
+
+/**
+ * @brief   Changes the interest list of an epoll instance
+ *
+ * @param[in] epfd      file descriptor of the epoll instance
+ * @param[in] op        @ref EPOLL_CTL_ADD, @ref EPOLL_CTL_MOD or
+ *                      @ref EPOLL_CTL_DEL
+ * @param[in] fd        file descriptor to add, modify or remove
+ * @param[in] event     events of interest and user data for @p fd, ignored
+ *                      for @ref EPOLL_CTL_DEL
+ *
+ * @return  0 on success
+ * @return  -1 on error, errno is set to indicate the error
+ */
+int epoll_ctl(int epfd, int op, int fd, struct epoll_event *event);
+
+/**
+ * @brief   Waits for events on an epoll instance
+ *
+ * @param[in] epfd      file descriptor of the epoll instance
+ * @param[out] events   the events that occurred
+ * @param[in] maxevents number of elements in @p events
+ * @param[in] timeout   timeout in milliseconds. 0 to return immediately, -1
+ *                      to wait indefinitely.
+ *
+ * @return  number of events stored in @p events
+ * @return  0, if the timeout expired before an event occurred
+ * @return  -1 on error, errno is set to indicate the error
+ */
+int epoll_wait(int epfd, struct epoll_event *events, int maxevents,
+               int timeout);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SYS_EPOLL_H */
+/** @} */
@@ -9,7 +9,7 @@
 /**
  * @defgroup posix_select   POSIX select
  * @ingroup  posix
- * @brief   Select implementation for RIOT
+ * @brief   Select and poll implementation for RIOT
  * @see     [The Open Group Base Specification Issue 7]
  *          (https://pubs.opengroup.org/onlinepubs/9699919799.2018edition/)
  * @todo    Omitted from original specification for now:
@@ -18,6 +18,7 @@
  *          - `pselect()` as it uses `sigset_t` from `<signal.h>`
  *          - handling of the `writefds` and `errorfds` parameters of `select()`
  * @todo    Currently, only [sockets](@ref posix_sockets) are supported
+ * @see     @ref posix_epoll to wait for many sockets at once
  * @{
  *
  * @file
@@ -17,8 +17,7 @@
 #ifndef PTHREAD_RWLOCK_H
 #define PTHREAD_RWLOCK_H
 
-#include "priority_queue.h"
-#include "thread.h"
+#include "rwlock.h"
 
 #include <errno.h>
 #include <stdbool.h>
@@ -33,38 +32,15 @@ extern "C" {
  *            won't starve each other.
  *            E.g. no new readers will get into the critical section
  *            if a writer of the same or a higher priority already waits for the lock.
+ *            This is a @ref core_sync_rwlock, so locking and unlocking without
+ *            contention does not block on an internal mutex.
  */
-typedef struct
-{
-    /**
-     * @brief     The current amount of reader inside the critical section.
-     * @details
-     *            * `== 0`: no thread is in the critical section.
-     *            * `> 0`: the number of readers currently in the critical section.
-     *            * `< 0`: a writer is currently in the critical section.
-     */
-    int readers;
-
-    /**
-     * @brief     Queue of waiting threads.
-     */
-    priority_queue_t queue;
-
-    /**
-     * @brief     Provides mutual exclusion on reading and writing on the structure.
-     */
-    mutex_t mutex;
-} pthread_rwlock_t;
+typedef rwlock_t pthread_rwlock_t;
 
 /**
- * @brief     Internal structure that stores one waiting thread.
+ * @brief     Static initializer for pthread_rwlock_t.
  */
-typedef struct {
-    bool is_writer;                 /**< `false`: reader; `true`: writer */
-    thread_t *thread;               /**< waiting thread */
-    priority_queue_node_t qnode;    /**< Node to store in `pthread_rwlock_t::queue`. */
-    bool continue_;                 /**< This is not a spurious wakeup. */
-} __pthread_rwlock_waiter_node_t;
+#define PTHREAD_RWLOCK_INITIALIZER RWLOCK_INIT
 
 /**
  * @brief           Initialize a reader/writer lock.
@@ -158,20 +134,6 @@ int pthread_rwlock_timedwrlock(pthread_rwlock_t *rwlock, const struct timespec *
  */
 int pthread_rwlock_unlock(pthread_rwlock_t *rwlock);
 
-/**
- * @brief            Internal function to determine of the lock can be acquired for reading.
- * @param[in]        rwlock   Lock to query.
- * @returns          `false` if locking for reading is possible without blocking.
- */
-bool __pthread_rwlock_blocked_readingly(const pthread_rwlock_t *rwlock);
-
-/**
- * @brief            Internal function to determine of the lock can be acquired for writing.
- * @param[in]        rwlock   Lock to query.
- * @returns          `false` if locking for writing is possible without blocking.
- */
-bool __pthread_rwlock_blocked_writingly(const pthread_rwlock_t *rwlock);
-
 #ifdef __cplusplus
 }
 #endif
@@ -23,16 +23,20 @@ extern "C" {
 #endif
 
 /**
- * @brief   Internal representation of a thread-specific key.
- * @internal
+ * @brief   Maximum number of thread-specific keys that exist at the same time
+ *
+ * Every pthread holds an array of this many values, so that
+ * @ref pthread_getspecific and @ref pthread_setspecific take constant time.
  */
-struct __pthread_tls_key;
+#ifndef CONFIG_PTHREAD_KEYS_MAX
+#define CONFIG_PTHREAD_KEYS_MAX     (16)
+#endif
 
 /**
- * @brief   A single thread-specific datum.
+ * @brief   Internal representation of a thread-specific key.
  * @internal
  */
-struct __pthread_tls_datum;
+struct __pthread_tls_key;
 
 /**
  * @brief   A thread-specific key.
@@ -59,6 +63,7 @@ int pthread_setspecific(pthread_key_t key, const void *value);
  * @param[out] key the created key is scribed to the given pointer
  * @param[in] destructor function pointer called when non NULL just before the pthread exits
  * @return returns 0 on success, an errorcode otherwise
+ * @retval EAGAIN if @ref CONFIG_PTHREAD_KEYS_MAX keys exist already
  */
 int pthread_key_create(pthread_key_t *key, void (*destructor)(void *));
 
@@ -78,10 +83,10 @@ int pthread_key_delete(pthread_key_t key);
 void __pthread_keys_exit(int self_id);
 
 /**
- * @brief Returns the pointer to the head of the list of thread-specific data.
+ * @brief Returns the array of the thread-specific values of pthread `self_id`.
  * @internal
  */
-struct __pthread_tls_datum **__pthread_get_tls_head(int self_id) PURE;
+void **__pthread_get_tls(int self_id) PURE;
 
 #ifdef __cplusplus
 }
@@ -70,12 +70,14 @@ typedef struct {
 
     char *stack;
 
-    struct __pthread_tls_datum *tls_head;
+    void *tls[CONFIG_PTHREAD_KEYS_MAX];
 
     __pthread_cleanup_datum_t *cleanup_top;
 } pthread_thread_t;
 
 static pthread_thread_t *volatile pthread_sched_threads[MAXTHREADS];
+/* pthread_t of the thread with a given kernel PID, 0 if it's no pthread */
+static pthread_t pthread_by_pid[MAXTHREADS];
 static mutex_t pthread_mutex;
 
 static volatile kernel_pid_t pthread_reaper_pid = KERNEL_PID_UNDEF;
@@ -187,6 +189,7 @@ int pthread_create(pthread_t *newthread, const pthread_attr_t *attr, void *(*sta
         return -1;
     }
 
+    pthread_by_pid[pt->thread_pid - KERNEL_PID_FIRST] = pthread_pid;
     thread_wakeup(pt->thread_pid);
 
     return 0;
@@ -215,6 +218,7 @@ void pthread_exit(void *retval)
             __pthread_keys_exit(self_id);
         }
 
+        pthread_by_pid[self->thread_pid - KERNEL_PID_FIRST] = 0;
         self->thread_pid = KERNEL_PID_UNDEF;
         DEBUG("pthread_exit(%p), self == %p\n", retval, (void *) self);
         if (self->status != PTS_DETACHED) {
@@ -298,17 +302,8 @@ int pthread_detach(pthread_t th)
 
 pthread_t pthread_self(void)
 {
-    pthread_t result = 0;
-    mutex_lock(&pthread_mutex);
-    kernel_pid_t pid = thread_getpid(); /* thread_getpid() is volatile */
-    for (int i = 0; i < MAXTHREADS; i++) {
-        if (pthread_sched_threads[i] && pthread_sched_threads[i]->thread_pid == pid) {
-            result = i+1;
-            break;
-        }
-    }
-    mutex_unlock(&pthread_mutex);
-    return result;
+    /* only the thread itself sets and clears its entry */
+    return pthread_by_pid[thread_getpid() - KERNEL_PID_FIRST];
 }
 
 int pthread_cancel(pthread_t th)
@@ -385,8 +380,8 @@ void __pthread_cleanup_pop(__pthread_cleanup_datum_t *datum, int execute)
     }
 }
 
-struct __pthread_tls_datum **__pthread_get_tls_head(int self_id)
+void **__pthread_get_tls(int self_id)
 {
     pthread_thread_t *self = pthread_sched_threads[self_id-1];
-    return self ? &self->tls_head : NULL;
+    return self ? self->tls : NULL;
 }
@@ -16,62 +16,39 @@
  * @}
  */
 
-#include "pthread.h"
+#include <stdbool.h>
 
-#ifdef HAVE_MALLOC_H
-#include <malloc.h>
-#endif
+#include "pthread.h"
 
 #define ENABLE_DEBUG 0
 #include "debug.h"
 
-typedef struct __pthread_tls_datum {
-    pthread_key_t key;
-    struct __pthread_tls_datum *next;
-    void *value;
-} tls_data_t;
-
 struct __pthread_tls_key {
     void (*destructor)(void *);
+    bool used;
 };
 
 /**
- * @brief   Used while manipulating the TLS of a pthread.
+ * @brief   The keys, a key is used as index into the values of a pthread.
  */
-static mutex_t tls_mutex;
+static struct __pthread_tls_key tls_keys[CONFIG_PTHREAD_KEYS_MAX];
 
 /**
- * @brief        Find a thread-specific datum.
- * @param[in]    tls    Pointer to the list of the thread-specific datums.
- * @param[in]    key    The key to look up.
- * @param[out]   prev   The datum before the result. `NULL` if the result is the first key. Spurious if the key was not found.
- * @returns      The datum or `NULL`.
+ * @brief   Used while creating and deleting keys.
  */
-static tls_data_t *find_specific(tls_data_t **tls, pthread_key_t key, tls_data_t **prev)
-{
-    tls_data_t *specific = *tls;
-    *prev = NULL;
-
-    while (specific) {
-        if (specific->key == key) {
-            return specific;
-        }
-
-        *prev = specific;
-        specific = specific->next;
-    }
+static mutex_t tls_mutex;
 
-    return 0;
+static inline bool key_is_valid(pthread_key_t key)
+{
+    return (key >= tls_keys) && (key < tls_keys + CONFIG_PTHREAD_KEYS_MAX)
+           && key->used;
 }
 
 /**
- * @brief       Find or allocate a thread specific datum.
- * @details     The `key` must be initialized.
- *              The result will be the head of the thread-specific datums afterwards.
- * @param[in]   key   The key to lookup.
- * @returns     The datum. `NULL` on ENOMEM or if the caller is not a pthread.
+ * @brief       Get the thread-specific values of the calling thread.
+ * @returns     The values. `NULL` if the caller is not a pthread.
  */
-static tls_data_t *get_specific(pthread_key_t key)
+static void **get_tls(void)
 {
     pthread_t self_id = pthread_self();
     if (self_id == 0) {
@@ -79,44 +56,26 @@ static tls_data_t *get_specific(pthread_key_t key)
         return NULL;
     }
 
-    tls_data_t **tls = __pthread_get_tls_head(self_id);
-    tls_data_t *prev, *specific = find_specific(tls, key, &prev);
-
-    /* Did the datum already exist? */
-    if (specific) {
-        if (prev) {
-            /* Move the datum to the front for a faster next lookup. */
-            /* Let's pretend that we have a totally degenerated splay tree. ;-) */
-            prev->next = specific->next;
-            specific->next = *tls;
-            *tls = specific;
-        }
-        return specific;
-    }
-
-    /* Allocate new datum. */
-    specific = malloc(sizeof (*specific));
-    if (specific) {
-        specific->key = key;
-        specific->next = *tls;
-        specific->value = NULL;
-        *tls = specific;
-    }
-    else {
-        DEBUG("ERROR out of memory in %s!\n", __func__);
-    }
-    return specific;
+    return __pthread_get_tls(self_id);
 }
 
 int pthread_key_create(pthread_key_t *key, void (*destructor)(void *))
 {
-    *key = malloc(sizeof (**key));
-    if (!*key) {
-        return ENOMEM;
+    int res = EAGAIN;
+
+    mutex_lock(&tls_mutex);
+    for (unsigned i = 0; i < CONFIG_PTHREAD_KEYS_MAX; ++i) {
+        if (!tls_keys[i].used) {
+            tls_keys[i].used = true;
+            tls_keys[i].destructor = destructor;
+            *key = &tls_keys[i];
+            res = 0;
+            break;
+        }
     }
+    mutex_unlock(&tls_mutex);
 
-    (*key)->destructor = destructor;
-    return 0;
+    return res;
 }
 
 int pthread_key_delete(pthread_key_t key)
@@ -126,22 +85,16 @@ int pthread_key_delete(pthread_key_t key)
     }
 
     mutex_lock(&tls_mutex);
-    for (unsigned i = 1; i <= MAXTHREADS; ++i) {
-        tls_data_t **tls = __pthread_get_tls_head(i);
-        if (!tls) {
-            continue;
-        }
-
-        tls_data_t *prev, *specific = find_specific(tls, key, &prev);
-        if (specific) {
-            if (prev) {
-                prev->next = specific->next;
-            }
-            else {
-                *tls = specific->next;
+    if (key_is_valid(key)) {
+        unsigned idx = key - tls_keys;
+        /* a key created later on starts with NULL in every thread */
+        for (unsigned i = 1; i <= MAXTHREADS; ++i) {
+            void **tls = __pthread_get_tls(i);
+            if (tls) {
+                tls[idx] = NULL;
             }
-            free(specific);
         }
+        key->used = false;
     }
     mutex_unlock(&tls_mutex);
 
@@ -150,51 +103,40 @@ int pthread_key_delete(pthread_key_t key)
 
 void *pthread_getspecific(pthread_key_t key)
 {
-    if (!key) {
+    void **tls = get_tls();
+
+    if (!tls || !key_is_valid(key)) {
         return NULL;
     }
 
-    mutex_lock(&tls_mutex);
-    tls_data_t *specific = get_specific(key);
-    void *result = specific ? specific->value : NULL;
-    mutex_unlock(&tls_mutex);
-
-    return result;
+    return tls[key - tls_keys];
 }
 
 int pthread_setspecific(pthread_key_t key, const void *value)
 {
-    if (!key) {
-        return EINVAL;
-    }
+    void **tls = get_tls();
 
-    mutex_lock(&tls_mutex);
-    tls_data_t *specific = get_specific(key);
-    if (specific) {
-        specific->value = (void *) value;
+    if (!tls || !key_is_valid(key)) {
+        return EINVAL;
     }
-    mutex_unlock(&tls_mutex);
 
-    return specific ? 0 : ENOMEM;
+    tls[key - tls_keys] = (void *)value;
+    return 0;
 }
 
 void __pthread_keys_exit(int self_id)
 {
-    tls_data_t **tls = __pthread_get_tls_head(self_id);
+    void **tls = __pthread_get_tls(self_id);
 
-    /* Calling the dtor could cause another pthread_exit(), so we dehead and free before calling it. */
-    mutex_lock(&tls_mutex);
-    for (tls_data_t *specific; (specific = *tls); ) {
-        *tls = specific->next;
-        void *value = specific->value;
-        void (*destructor)(void *) = specific->key->destructor;
-        free(specific);
-
-        if (value && destructor) {
-            mutex_unlock(&tls_mutex);
+    /* Calling the dtor could cause another pthread_exit(), so we clear the
+     * value before calling it. */
+    for (unsigned i = 0; i < CONFIG_PTHREAD_KEYS_MAX; ++i) {
+        void *value = tls[i];
+        void (*destructor)(void *) = tls_keys[i].destructor;
+        tls[i] = NULL;
+
+        if (value && tls_keys[i].used && destructor) {
             destructor(value);
-            mutex_lock(&tls_mutex);
         }
     }
-    mutex_unlock(&tls_mutex);
 }
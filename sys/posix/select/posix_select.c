@@ -13,6 +13,7 @@
  */
 
 #include <errno.h>
+#include <poll.h>
 #include <stdbool.h>
 #include <sys/select.h>
 
@@ -24,7 +25,7 @@
 #if IS_USED(MODULE_POSIX_SOCKETS)
 extern bool posix_socket_is(int fd);
 extern unsigned posix_socket_avail(int fd);
-extern void posix_socket_select(int fd);
+extern int posix_socket_select(int fd);
 #else   /* MODULE_POSIX_SOCKETS */
 static inline bool posix_socket_is(int fd)
 {
@@ -38,10 +39,10 @@ static inline unsigned posix_socket_avail(int fd)
     return 0;
 }
 
-static inline void posix_socket_select(int fd)
+static inline int posix_socket_select(int fd)
 {
     (void)fd;
-    return 0;
+    return -1;
 }
 #endif  /* IS_USED(MODULE_POSIX_SOCKETS) */
 
@@ -142,3 +143,67 @@ int select(int nfds, fd_set *readfds, fd_set *writefds, fd_set *errorfds,
     *readfds = ret_readfds;
     return fds_set;
 }
+
+static int _poll_fds(struct pollfd fds[], nfds_t nfds, bool arm)
+{
+    int fds_set = 0;
+
+    for (nfds_t i = 0; i < nfds; i++) {
+        int fd = fds[i].fd;
+
+        fds[i].revents = 0;
+        if (fd < 0) {
+            continue;
+        }
+        if (!posix_socket_is(fd)) {
+            fds[i].revents = POLLNVAL;
+        }
+        else {
+            if (fds[i].events & POLLIN) {
+                if (posix_socket_avail(fd) > 0) {
+                    fds[i].revents |= POLLIN;
+                }
+                else if (arm) {
+                    posix_socket_select(fd);
+                }
+            }
+            /* sending on a socket does not need to wait for anything */
+            fds[i].revents |= fds[i].events & POLLOUT;
+        }
+        if (fds[i].revents) {
+            fds_set++;
+        }
+    }
+    return fds_set;
+}
+
+int poll(struct pollfd fds[], nfds_t nfds, int timeout)
+{
+    ztimer64_t timeout_timer;
+    int fds_set;
+
+    if (nfds > VFS_MAX_OPEN_FILES) {
+        errno = EINVAL;
+        return -1;
+    }
+    fds_set = _poll_fds(fds, nfds, true);
+    if ((fds_set > 0) || (timeout == 0)) {
+        return fds_set;
+    }
+    if (timeout > 0) {
+        ztimer64_set_timeout_flag(ZTIMER64_USEC, &timeout_timer,
+                                  (uint64_t)timeout * US_PER_MS);
+    }
+    while (fds_set == 0) {
+        thread_flags_t tflags = thread_flags_wait_any(POSIX_SELECT_THREAD_FLAG |
+                                                      THREAD_FLAG_TIMEOUT);
+        if (tflags & THREAD_FLAG_TIMEOUT) {
+            break;
+        }
+        fds_set = _poll_fds(fds, nfds, false);
+    }
+    if (timeout > 0) {
+        ztimer64_remove(ZTIMER64_USEC, &timeout_timer);
+    }
+    return fds_set;
+}
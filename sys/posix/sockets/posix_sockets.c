@@ -47,6 +47,9 @@
 #include "thread.h"
 #include "thread_flags.h"
 #endif
+#if IS_USED(MODULE_POSIX_EPOLL)
+#include "irq.h"
+#endif
 
 /* enough to create sockets both with socket() and accept() */
 #define _ACTUAL_SOCKET_POOL_SIZE   (SOCKET_POOL_SIZE + \
@@ -95,6 +98,10 @@ typedef struct {
 #endif
 #if IS_USED(MODULE_POSIX_SELECT)
     thread_t *selecting_thread;
+#endif
+#if IS_USED(MODULE_POSIX_EPOLL)
+    void (*watch_cb)(void *arg, bool closed);
+    void *watch_arg;
 #endif
     sock_tcp_ep_t local;        /* to store bind before connect/listen */
 } socket_t;
@@ -127,6 +134,9 @@ static socket_t *_get_free_socket(void)
 #endif
 #if IS_USED(MODULE_POSIX_SELECT)
             _socket_pool[i].selecting_thread = NULL;
+#endif
+#if IS_USED(MODULE_POSIX_EPOLL)
+            _socket_pool[i].watch_cb = NULL;
 #endif
             return &_socket_pool[i];
         }
@@ -286,6 +296,12 @@ static int socket_close(vfs_file_t *filp)
     int res = 0;
 
     assert((s->domain == AF_INET) || (s->domain == AF_INET6));
+#if IS_USED(MODULE_POSIX_EPOLL)
+    if (s->watch_cb) {
+        s->watch_cb(s->watch_arg, true);
+        s->watch_cb = NULL;
+    }
+#endif
     mutex_lock(&_socket_pool_mutex);
     if (s->sock != NULL) {
         int idx = _get_sock_idx(s->sock);
@@ -374,6 +390,11 @@ static void _async_cb(void *sock, sock_async_flags_t type,
             thread_flags_set(socket->selecting_thread,
                              POSIX_SELECT_THREAD_FLAG);
         }
+#endif
+#if IS_USED(MODULE_POSIX_EPOLL)
+        if (socket->watch_cb) {
+            socket->watch_cb(socket->watch_arg, false);
+        }
 #endif
     }
 }
@@ -1204,6 +1225,40 @@ int posix_socket_select(int fd)
     return -1;
 }
 
+int posix_socket_watch(int fd, void (*cb)(void *arg, bool closed), void *arg)
+{
+#if IS_USED(MODULE_POSIX_EPOLL)
+    socket_t *socket = _get_socket(fd);
+
+    if (socket != NULL) {
+        if ((cb != NULL) && (socket->watch_cb != NULL)) {
+            /* only one epoll instance can watch a socket */
+            errno = EBUSY;
+            return -1;
+        }
+        if (socket->sock == NULL) {  /* socket is not connected */
+            int res;
+
+            /* bind implicitly */
+            if ((res = _bind_connect(socket, NULL, 0)) < 0) {
+                return res;
+            }
+        }
+        unsigned state = irq_disable();
+        socket->watch_cb = cb;
+        socket->watch_arg = arg;
+        irq_restore(state);
+        return 0;
+    }
+#else
+    (void)fd;
+    (void)cb;
+    (void)arg;
+#endif
+    errno = ENOTSUP;
+    return -1;
+}
+
 /**
  * @}
  */
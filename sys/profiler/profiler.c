@@ -0,0 +1,186 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_profiler
+ * @{
+ *
+ * @file
+ * @brief       Sampling profiler implementation
+ *
+ * The histogram is a hash table indexed by program counter and thread, it is
+ * only written from the timer interrupt.
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "irq.h"
+#include "profiler.h"
+#include "thread.h"
+#include "timex.h"
+#include "ztimer.h"
+#include "ztimer/periodic.h"
+
+#if defined(MODULE_CORTEXM_COMMON)
+#include "cpu.h"
+#elif defined(MODULE_RISCV_COMMON)
+#include "vendor/riscv_csr.h"
+#elif defined(CPU_NATIVE)
+#include "native_internal.h"
+#endif
+
+/* slots probed before a sample is lost */
+#define PROBES_MAX  (8)
+
+static ztimer_periodic_t _timer;
+static profiler_stats_t _stats;
+static profiler_sample_t _slots[CONFIG_PROFILER_SLOTS_NUMOF];
+
+/* returns false if the interrupted code is not known */
+static bool _get_pc(uintptr_t *pc)
+{
+#if defined(MODULE_CORTEXM_COMMON)
+#ifdef SCB_ICSR_RETTOBASE_Msk
+    if (!(SCB->ICSR & SCB_ICSR_RETTOBASE_Msk)) {
+        /* another interrupt was interrupted, its frame is on the main stack */
+        return false;
+    }
+#endif
+    /* threads use the process stack, the return address is the 7th word of
+     * the exception frame */
+    *pc = ((uint32_t *)__get_PSP())[6];
+    return true;
+#elif defined(MODULE_RISCV_COMMON)
+    *pc = read_csr(mepc);
+    return true;
+#elif defined(CPU_NATIVE)
+    *pc = _native_saved_eip;
+    return true;
+#else
+    (void)pc;
+    return false;
+#endif
+}
+
+static void _count(uintptr_t pc, kernel_pid_t pid)
+{
+    unsigned idx = ((pc >> 1) ^ ((unsigned)pid * 0x9e37U))
+                   % CONFIG_PROFILER_SLOTS_NUMOF;
+
+    for (unsigned i = 0; i < PROBES_MAX; i++) {
+        profiler_sample_t *slot = &_slots[idx];
+
+        if (slot->count == 0) {
+            slot->pc = pc;
+            slot->pid = pid;
+        }
+        if ((slot->pc == pc) && (slot->pid == pid)) {
+            slot->count++;
+            return;
+        }
+        idx = (idx + 1) % CONFIG_PROFILER_SLOTS_NUMOF;
+    }
+    _stats.lost++;
+}
+
+static bool _sample(void *arg)
+{
+    (void)arg;
+    uintptr_t pc;
+
+    _stats.samples++;
+    if (_get_pc(&pc)) {
+        _count(pc, thread_getpid());
+    }
+    else {
+        _stats.isr++;
+    }
+
+    return ZTIMER_PERIODIC_KEEP_GOING;
+}
+
+void profiler_start(void)
+{
+    if (!_timer.callback) {
+        ztimer_periodic_init(ZTIMER_USEC, &_timer, _sample, NULL,
+                             US_PER_SEC / CONFIG_PROFILER_FREQ_HZ);
+    }
+    ztimer_periodic_start(&_timer);
+}
+
+void profiler_stop(void)
+{
+    ztimer_periodic_stop(&_timer);
+}
+
+void profiler_reset(void)
+{
+    unsigned state = irq_disable();
+
+    memset(&_stats, 0, sizeof(_stats));
+    memset(_slots, 0, sizeof(_slots));
+    irq_restore(state);
+}
+
+void profiler_get_stats(profiler_stats_t *stats)
+{
+    unsigned state = irq_disable();
+
+    *stats = _stats;
+    irq_restore(state);
+}
+
+static bool _get_slot(unsigned idx, profiler_sample_t *slot)
+{
+    unsigned state = irq_disable();
+
+    *slot = _slots[idx];
+    irq_restore(state);
+
+    return slot->count != 0;
+}
+
+unsigned profiler_get_samples(profiler_sample_t *samples, unsigned numof)
+{
+    unsigned n = 0;
+
+    for (unsigned i = 0; (i < CONFIG_PROFILER_SLOTS_NUMOF) && (n < numof); i++) {
+        if (_get_slot(i, &samples[n])) {
+            n++;
+        }
+    }
+
+    return n;
+}
+
+void profiler_print(void)
+{
+    profiler_stats_t stats;
+
+    profiler_get_stats(&stats);
+    printf("profiler: samples %" PRIu32 " isr %" PRIu32 " lost %" PRIu32
+           " freq %u\n", stats.samples, stats.isr, stats.lost,
+           (unsigned)CONFIG_PROFILER_FREQ_HZ);
+
+    for (unsigned i = 0; i < CONFIG_PROFILER_SLOTS_NUMOF; i++) {
+        profiler_sample_t slot;
+
+        if (!_get_slot(i, &slot)) {
+            continue;
+        }
+
+        const char *name = thread_getname(slot.pid);
+        printf("profiler: %" PRIu32 " %d %s 0x%" PRIxPTR "\n", slot.count,
+               (int)slot.pid, name ? name : "-", slot.pc);
+    }
+    puts("profiler: end");
+}
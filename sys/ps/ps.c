@@ -53,6 +53,12 @@ void ps(void)
 #endif
 #ifdef MODULE_SCHEDSTATISTICS
            "| runtime  | switches  | runtime_usec "
+#endif
+#ifdef MODULE_SCHEDSTATISTICS_CYCLES
+           "| runtime_kcycles "
+#endif
+#ifdef MODULE_CORE_STACK_WATERMARK
+           "| stack_hwm "
 #endif
            "\n",
 #ifdef CONFIG_THREAD_NAMES
@@ -108,6 +114,9 @@ void ps(void)
             unsigned runtime_major = runtime_us / rt_sum;
             unsigned runtime_minor = ((runtime_us % rt_sum) * 1000) / rt_sum;
             unsigned switches = sched_pidlist[i].schedules;
+#endif
+#ifdef MODULE_SCHEDSTATISTICS_CYCLES
+            uint32_t kcycles = schedstat_get_cycles(i) / 1000;
 #endif
             printf("\t%3" PRIkernel_pid
 #ifdef CONFIG_THREAD_NAMES
@@ -119,6 +128,12 @@ void ps(void)
 #endif
 #ifdef MODULE_SCHEDSTATISTICS
                    " | %2d.%03d%% |  %8u  | %10"PRIu32" "
+#endif
+#ifdef MODULE_SCHEDSTATISTICS_CYCLES
+                   "| %15"PRIu32" "
+#endif
+#ifdef MODULE_CORE_STACK_WATERMARK
+                   "| %9u "
 #endif
                    "\n",
                    thread_getpid_of(p),
@@ -132,6 +147,12 @@ void ps(void)
 #endif
 #ifdef MODULE_SCHEDSTATISTICS
                    , runtime_major, runtime_minor, switches, ztimer_us
+#endif
+#ifdef MODULE_SCHEDSTATISTICS_CYCLES
+                   , kcycles
+#endif
+#ifdef MODULE_CORE_STACK_WATERMARK
+                   , (unsigned)thread_stack_watermark(p)
 #endif
                   );
         }
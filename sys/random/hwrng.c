@@ -17,16 +17,82 @@
  * @}
  */
 
+#include <stdbool.h>
+#include <string.h>
+
+#include "irq.h"
 #include "kernel_defines.h"
 #include "periph/hwrng.h"
 #include "random.h"
 
+#if IS_USED(MODULE_RANDOM_HWRNG_POOL)
+#include "event/thread.h"
+
+static uint32_t _pool[CONFIG_RANDOM_HWRNG_POOL_SIZE];
+static unsigned _pool_fill;
+
+/* fills the pool with a single read from the HWRNG */
+static void _refill(void)
+{
+    uint32_t buf[CONFIG_RANDOM_HWRNG_POOL_SIZE];
+    unsigned missing = CONFIG_RANDOM_HWRNG_POOL_SIZE - _pool_fill;
+
+    if (!missing) {
+        return;
+    }
+    /* the HWRNG might sleep, so read without holding the pool */
+    hwrng_read(buf, missing * sizeof(buf[0]));
+
+    unsigned state = irq_disable();
+    /* the pool might have been drained in the meantime, but not filled */
+    memcpy(&_pool[_pool_fill], buf, missing * sizeof(buf[0]));
+    _pool_fill += missing;
+    irq_restore(state);
+
+    memset(buf, 0, sizeof(buf));
+}
+
+static void _refill_handler(event_t *event)
+{
+    (void)event;
+    _refill();
+}
+
+static event_t _refill_event = { .handler = _refill_handler };
+
+uint32_t random_uint32(void)
+{
+    uint32_t rnd = 0;
+    unsigned state = irq_disable();
+    unsigned fill = _pool_fill;
+    bool empty = !fill;
+
+    if (!empty) {
+        rnd = _pool[--fill];
+        _pool[fill] = 0;
+        _pool_fill = fill;
+    }
+    irq_restore(state);
+
+    /* refill in the background, once the event thread is running */
+    if ((fill <= CONFIG_RANDOM_HWRNG_POOL_SIZE / 2) &&
+        EVENT_PRIO_LOWEST->waiter) {
+        event_post(EVENT_PRIO_LOWEST, &_refill_event);
+    }
+
+    if (empty) {
+        hwrng_read(&rnd, sizeof(rnd));
+    }
+    return rnd;
+}
+#else
 uint32_t random_uint32(void)
 {
     uint32_t rnd;
     hwrng_read(&rnd, sizeof(rnd));
     return rnd;
 }
+#endif
 
 void random_init(uint32_t val)
 {
@@ -35,4 +101,7 @@ void random_init(uint32_t val)
     if (!IS_ACTIVE(MODULE_PERIPH_INIT_HWRNG)) {
         hwrng_init();
     }
+#if IS_USED(MODULE_RANDOM_HWRNG_POOL)
+    _refill();
+#endif
 }
@@ -0,0 +1,202 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_sample_window
+ * @{
+ *
+ * @file
+ * @brief       Quantized sample windows implementation
+ *
+ * @}
+ */
+
+#include <assert.h>
+#include <math.h>
+#include <stdbool.h>
+
+#include "irq.h"
+#include "sample_window.h"
+
+/* marks sample_window_t::mult as set for raw samples */
+#define EXP_RAW         INT8_MIN
+
+static inline int8_t *_window(const sample_window_t *sw, unsigned idx)
+{
+    return sw->buf + idx * sw->frames * sw->channels;
+}
+
+static void _set_mult(sample_window_t *sw, float unit)
+{
+    float mult = roundf(unit / sw->scale * 65536.0f);
+
+    if (mult > (float)INT32_MAX) {
+        sw->mult = INT32_MAX;
+    }
+    else if (mult < (float)INT32_MIN) {
+        sw->mult = INT32_MIN;
+    }
+    else {
+        sw->mult = (int32_t)mult;
+    }
+}
+
+static inline int8_t _quantize(const sample_window_t *sw, int32_t raw)
+{
+    int32_t q = (int32_t)(((int64_t)raw * sw->mult + (1 << 15)) >> 16)
+              + sw->zero_point;
+
+    if (q > INT8_MAX) {
+        return INT8_MAX;
+    }
+    if (q < INT8_MIN) {
+        return INT8_MIN;
+    }
+    return q;
+}
+
+static bool _begin_window(sample_window_t *sw)
+{
+    unsigned state = irq_disable();
+
+    if (sw->ready < sw->numof) {
+        sw->cur = _window(sw, (sw->read + sw->ready) % sw->numof);
+        sw->pos = 0;
+    }
+    irq_restore(state);
+    return sw->cur != NULL;
+}
+
+static void _complete_window(sample_window_t *sw)
+{
+    unsigned state = irq_disable();
+
+    sw->ready++;
+    sw->cur = NULL;
+    irq_restore(state);
+    event_post(sw->queue, &sw->event);
+}
+
+/* adds num frames, the samples of a frame are stride samples apart */
+static void _add(sample_window_t *sw, const int16_t *samples, size_t num,
+                 size_t stride, bool is_unsigned)
+{
+    for (; num > 0; num--, samples += stride) {
+        if ((sw->cur == NULL) && !_begin_window(sw)) {
+            sw->overruns++;
+            continue;
+        }
+
+        int8_t *dst = sw->cur + sw->pos * sw->channels;
+        for (unsigned i = 0; i < sw->channels; i++) {
+            int32_t raw = is_unsigned ? (uint16_t)samples[i] : samples[i];
+            dst[i] = _quantize(sw, raw);
+        }
+        if (++sw->pos == sw->frames) {
+            _complete_window(sw);
+        }
+    }
+}
+
+void sample_window_init(sample_window_t *sw, int8_t *buf, uint8_t numof,
+                        uint16_t frames, uint8_t channels, float scale,
+                        int8_t zero_point, event_queue_t *queue,
+                        event_handler_t handler)
+{
+    assert(buf && numof && frames && channels && (scale > 0) && queue);
+
+    *sw = (sample_window_t){
+        .event.handler = handler,
+        .queue = queue,
+        .buf = buf,
+        .frames = frames,
+        .channels = channels,
+        .numof = numof,
+        .zero_point = zero_point,
+        .exp = EXP_RAW,
+        .scale = scale,
+    };
+    _set_mult(sw, 1.0f);
+}
+
+void sample_window_set_input_scale(sample_window_t *sw, float unit)
+{
+    sw->exp = EXP_RAW;
+    _set_mult(sw, unit);
+}
+
+void sample_window_add(sample_window_t *sw, const int16_t *samples,
+                       size_t num)
+{
+    _add(sw, samples, num, sw->channels, false);
+}
+
+const int8_t *sample_window_get(sample_window_t *sw)
+{
+    /* only the consumer changes the oldest window, reading ready is atomic */
+    return sw->ready ? _window(sw, sw->read) : NULL;
+}
+
+void sample_window_release(sample_window_t *sw)
+{
+    unsigned state = irq_disable();
+
+    assert(sw->ready);
+    sw->read = (sw->read + 1) % sw->numof;
+    sw->ready--;
+    irq_restore(state);
+}
+
+unsigned sample_window_overruns(sample_window_t *sw)
+{
+    unsigned state = irq_disable();
+    unsigned overruns = sw->overruns;
+
+    sw->overruns = 0;
+    irq_restore(state);
+    return overruns;
+}
+
+#if IS_USED(MODULE_SAUL_REG)
+int sample_window_read_saul(sample_window_t *sw, saul_reg_t *dev)
+{
+    saul_sample_t chunk[CONFIG_SAMPLE_WINDOW_SAUL_CHUNK];
+    int added = 0;
+    int n;
+
+    assert(sw->channels <= PHYDAT_DIM);
+
+    do {
+        /* the timestamps are not used */
+        n = saul_reg_read_batch(dev, chunk, ARRAY_SIZE(chunk), 0);
+        if (n < 0) {
+            return n;
+        }
+        for (int i = 0; i < n; i++) {
+            if (chunk[i].data.scale != sw->exp) {
+                sw->exp = chunk[i].data.scale;
+                _set_mult(sw, powf(10.0f, sw->exp));
+            }
+            _add(sw, chunk[i].data.val, 1, 0, false);
+        }
+        added += n;
+    } while (n == (int)ARRAY_SIZE(chunk));
+
+    return added;
+}
+#endif
+
+#if IS_USED(MODULE_PERIPH_ADC_CONTINUOUS)
+void sample_window_adc_cb(void *arg, const uint16_t *samples, size_t len)
+{
+    sample_window_t *sw = arg;
+
+    _add(sw, (const int16_t *)samples, len / sw->channels, sw->channels,
+         true);
+}
+#endif
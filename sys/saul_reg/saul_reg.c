@@ -18,11 +18,13 @@
  * @}
  */
 
+#include <stdbool.h>
 #include <stddef.h>
 #include <stdio.h>
 #include <stdint.h>
 #include <string.h>
 
+#include "kernel_defines.h"
 #include "saul_reg.h"
 
 /**
@@ -30,6 +32,105 @@
  */
 saul_reg_t *saul_reg = NULL;
 
+#if IS_USED(MODULE_SAUL_REG_INDEX)
+/* The index holds the first registered entry for every type, name and pair of
+ * type and name in open addressing hash tables. Lookups only fall back to the
+ * list if a table ran full. */
+typedef struct {
+    uint32_t hash;
+    saul_reg_t *dev;
+} _slot_t;
+
+static saul_reg_t *_by_type[CONFIG_SAUL_REG_INDEX_TYPES_NUMOF];
+static _slot_t _by_name[CONFIG_SAUL_REG_INDEX_NAMES_NUMOF];
+static _slot_t _by_type_name[CONFIG_SAUL_REG_INDEX_NAMES_NUMOF];
+static bool _by_type_full;
+static bool _by_name_full;
+static bool _by_type_name_full;
+
+static uint32_t _hash_name(const char *name)
+{
+    uint32_t h = 2166136261U;
+
+    while (*name) {
+        h = (h ^ (uint8_t)*name++) * 16777619U;
+    }
+    return h;
+}
+
+static uint32_t _hash_type_name(uint8_t type, uint32_t name_hash)
+{
+    return (name_hash ^ type) * 16777619U;
+}
+
+/* Returns the slot of the entry matching, or the empty slot to insert it to
+ * or NULL if the table is full */
+static saul_reg_t **_find_type(uint8_t type)
+{
+    for (unsigned i = 0; i < CONFIG_SAUL_REG_INDEX_TYPES_NUMOF; i++) {
+        saul_reg_t **slot = &_by_type[(type + i) % CONFIG_SAUL_REG_INDEX_TYPES_NUMOF];
+
+        if ((*slot == NULL) || ((*slot)->driver->type == type)) {
+            return slot;
+        }
+    }
+    return NULL;
+}
+
+static _slot_t *_find_name(_slot_t *table, uint32_t hash, const char *name,
+                           int type)
+{
+    for (unsigned i = 0; i < CONFIG_SAUL_REG_INDEX_NAMES_NUMOF; i++) {
+        _slot_t *slot = &table[(hash + i) % CONFIG_SAUL_REG_INDEX_NAMES_NUMOF];
+
+        if (slot->dev == NULL) {
+            return slot;
+        }
+        if ((slot->hash == hash) &&
+            ((type < 0) || (slot->dev->driver->type == type)) &&
+            (strcmp(slot->dev->name, name) == 0)) {
+            return slot;
+        }
+    }
+    return NULL;
+}
+
+static void _index_add_name(_slot_t *table, bool *full, uint32_t hash,
+                            saul_reg_t *dev, int type)
+{
+    _slot_t *slot = _find_name(table, hash, dev->name, type);
+
+    if (slot == NULL) {
+        *full = true;
+    }
+    else if (slot->dev == NULL) {
+        slot->hash = hash;
+        slot->dev = dev;
+    }
+}
+
+static void _index_add(saul_reg_t *dev)
+{
+    uint8_t type = dev->driver->type;
+    saul_reg_t **slot = _find_type(type);
+
+    if (slot == NULL) {
+        _by_type_full = true;
+    }
+    else if (*slot == NULL) {
+        *slot = dev;
+    }
+
+    if (dev->name == NULL) {
+        return;
+    }
+    uint32_t hash = _hash_name(dev->name);
+    _index_add_name(_by_name, &_by_name_full, hash, dev, -1);
+    _index_add_name(_by_type_name, &_by_type_name_full,
+                    _hash_type_name(type, hash), dev, type);
+}
+#endif
+
 int saul_reg_add(saul_reg_t *dev)
 {
     saul_reg_t *tmp = saul_reg;
@@ -50,6 +151,9 @@ int saul_reg_add(saul_reg_t *dev)
         }
         tmp->next = dev;
     }
+#if IS_USED(MODULE_SAUL_REG_INDEX)
+    _index_add(dev);
+#endif
     return 0;
 }
 
@@ -65,6 +169,12 @@ saul_reg_t *saul_reg_find_nth(int pos)
 
 saul_reg_t *saul_reg_find_type(uint8_t type)
 {
+#if IS_USED(MODULE_SAUL_REG_INDEX)
+    saul_reg_t **slot = _find_type(type);
+    if ((slot && *slot) || !_by_type_full) {
+        return slot ? *slot : NULL;
+    }
+#endif
     saul_reg_t *tmp = saul_reg;
 
     while (tmp) {
@@ -78,6 +188,12 @@ saul_reg_t *saul_reg_find_type(uint8_t type)
 
 saul_reg_t *saul_reg_find_name(const char *name)
 {
+#if IS_USED(MODULE_SAUL_REG_INDEX)
+    _slot_t *slot = _find_name(_by_name, _hash_name(name), name, -1);
+    if ((slot && slot->dev) || !_by_name_full) {
+        return slot ? slot->dev : NULL;
+    }
+#endif
     saul_reg_t *tmp = saul_reg;
 
     while (tmp) {
@@ -91,6 +207,14 @@ saul_reg_t *saul_reg_find_name(const char *name)
 
 saul_reg_t *saul_reg_find_type_and_name(uint8_t type, const char *name)
 {
+#if IS_USED(MODULE_SAUL_REG_INDEX)
+    _slot_t *slot = _find_name(_by_type_name,
+                               _hash_type_name(type, _hash_name(name)),
+                               name, type);
+    if ((slot && slot->dev) || !_by_type_name_full) {
+        return slot ? slot->dev : NULL;
+    }
+#endif
     saul_reg_t *tmp = saul_reg;
 
     while (tmp) {
@@ -110,6 +234,34 @@ int saul_reg_read(saul_reg_t *dev, phydat_t *res)
     return dev->driver->read(dev->dev, res);
 }
 
+int saul_reg_read_batch(saul_reg_t *dev, saul_sample_t *res, size_t num,
+                        uint32_t now)
+{
+    int n;
+
+    if (dev == NULL) {
+        return -ENODEV;
+    }
+    if (num == 0) {
+        return 0;
+    }
+    if (dev->driver->read_batch == NULL) {
+        n = dev->driver->read(dev->dev, &res->data);
+        if (n < 0) {
+            return n;
+        }
+        res->timestamp = now;
+        return 1;
+    }
+
+    n = dev->driver->read_batch(dev->dev, res, num);
+    /* the driver stores the age of the samples */
+    for (int i = 0; i < n; i++) {
+        res[i].timestamp = now - res[i].timestamp;
+    }
+    return n;
+}
+
 int saul_reg_write(saul_reg_t *dev, const phydat_t *data)
 {
     if (dev == NULL) {
@@ -77,7 +77,7 @@ static inline void _sched_round_robin_set(uint8_t prio)
         return;
     }
     _current_rr_priority = prio;
-    ztimer_set(SCHED_RR_TIMERBASE, &_rr_timer, SCHED_RR_TIMEOUT);
+    ztimer_set(SCHED_RR_TIMERBASE, &_rr_timer, SCHED_RR_TIMEOUT_PRIO(prio));
 }
 
 void sched_runq_callback(uint8_t prio)
@@ -86,8 +86,10 @@ void sched_runq_callback(uint8_t prio)
         return;
     }
 
+    /* stop the timer as soon as the priority has no thread to switch to,
+     * instead of letting it fire once more for nothing */
     if (_current_rr_priority == prio) {
-        if (sched_runq_is_empty(prio)) {
+        if (!sched_runq_more_than_one(prio)) {
             _sched_round_robin_remove();
             thread_t *active_thread = thread_get_active();
             if (active_thread) {
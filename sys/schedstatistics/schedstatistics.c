@@ -21,11 +21,44 @@
  * @}
  */
 
+#include "irq.h"
 #include "sched.h"
 #include "schedstatistics.h"
 #include "thread.h"
 #include "ztimer.h"
 
+#ifdef MODULE_SCHEDSTATISTICS_CYCLES
+#include "cpu.h"
+
+#if defined(CPU_NATIVE) && (defined(__i386__) || defined(__x86_64__))
+typedef uint64_t _cycles_t;
+
+static inline _cycles_t _cycles_now(void)
+{
+    return __builtin_ia32_rdtsc();
+}
+
+static inline void _cycles_init(void)
+{
+}
+#elif defined(DWT_CTRL_CYCCNTENA_Msk)
+typedef uint32_t _cycles_t;
+
+static inline _cycles_t _cycles_now(void)
+{
+    return DWT->CYCCNT;
+}
+
+static inline void _cycles_init(void)
+{
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+}
+#else
+#error "schedstatistics_cycles: no cycle counter available for this CPU"
+#endif
+#endif /* MODULE_SCHEDSTATISTICS_CYCLES */
+
 /**
  * When core_idle_thread is not active, the KERNEL_PID_UNDEF is used to track
  * the idle time
@@ -35,11 +68,19 @@ schedstat_t sched_pidlist[KERNEL_PID_LAST + 1];
 void sched_statistics_cb(kernel_pid_t active_thread, kernel_pid_t next_thread)
 {
     uint32_t now = ztimer_now(ZTIMER_USEC);
+#ifdef MODULE_SCHEDSTATISTICS_CYCLES
+    _cycles_t cycles = _cycles_now();
+#endif
 
     /* Update active thread stats */
     if (!IS_USED(MODULE_CORE_IDLE_THREAD) || active_thread != KERNEL_PID_UNDEF) {
         schedstat_t *active_stat = &sched_pidlist[active_thread];
         active_stat->runtime_us += now - active_stat->laststart;
+#ifdef MODULE_SCHEDSTATISTICS_CYCLES
+        /* truncation takes care of the counter overflowing in between */
+        active_stat->runtime_cycles +=
+            (_cycles_t)(cycles - (_cycles_t)active_stat->laststart_cycles);
+#endif
     }
 
     /* Update next_thread stats */
@@ -47,6 +88,9 @@ void sched_statistics_cb(kernel_pid_t active_thread, kernel_pid_t next_thread)
         schedstat_t *next_stat = &sched_pidlist[next_thread];
         next_stat->laststart = now;
         next_stat->schedules++;
+#ifdef MODULE_SCHEDSTATISTICS_CYCLES
+        next_stat->laststart_cycles = cycles;
+#endif
     }
 }
 
@@ -57,5 +101,21 @@ void init_schedstatistics(void)
     schedstat_t *active_stat = &sched_pidlist[thread_getpid()];
     active_stat->laststart = ztimer_now(ZTIMER_USEC);
     active_stat->schedules = 1;
+#ifdef MODULE_SCHEDSTATISTICS_CYCLES
+    _cycles_init();
+    active_stat->laststart_cycles = _cycles_now();
+#endif
     sched_register_cb(sched_statistics_cb);
 }
+
+#ifdef MODULE_SCHEDSTATISTICS_CYCLES
+uint64_t schedstat_get_cycles(kernel_pid_t pid)
+{
+    /* 64 bit reads are not atomic */
+    unsigned state = irq_disable();
+    uint64_t res = sched_pidlist[pid].runtime_cycles;
+
+    irq_restore(state);
+    return res;
+}
+#endif
@@ -17,6 +17,7 @@
 
 #include <errno.h>
 #include <limits.h>
+#include <stdbool.h>
 
 #include "irq.h"
 #include "assert.h"
@@ -45,6 +46,23 @@ void sema_destroy(sema_t *sema)
     mutex_unlock(&sema->mutex);
 }
 
+/* Takes the semaphore without blocking if its value is not 0, the same way a
+ * non-blocking wait does. Threads only ever block on a value of 0, so this
+ * never has to wake anyone and does not need to disable interrupts. */
+static bool _sema_wait_fast(sema_t *sema)
+{
+    unsigned value = __atomic_load_n(&sema->value, __ATOMIC_RELAXED);
+
+    while (value > 0) {
+        if (__atomic_compare_exchange_n(&sema->value, &value, value - 1, true,
+                                        __ATOMIC_ACQUIRE, __ATOMIC_RELAXED)) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
 #if IS_USED(MODULE_SEMA_DEPRECATED)
 int _sema_wait_ztimer64(sema_t *sema, int block, ztimer64_clock_t *clock, uint64_t us)
 {
@@ -54,6 +72,10 @@ int _sema_wait_ztimer64(sema_t *sema, int block, ztimer64_clock_t *clock, uint64
         return -ECANCELED;
     }
 
+    if (_sema_wait_fast(sema)) {
+        return 0;
+    }
+
     int did_block = block;
     unsigned old = irq_disable();
     while ((sema->value == 0) && block) {
@@ -108,6 +130,10 @@ int _sema_wait_ztimer(sema_t *sema, int block,
         return -ECANCELED;
     }
 
+    if (_sema_wait_fast(sema)) {
+        return 0;
+    }
+
     int did_block = block;
     unsigned old = irq_disable();
     while ((sema->value == 0) && block) {
@@ -156,13 +182,25 @@ int sema_post(sema_t *sema)
 {
     assert(sema != NULL);
 
+    /* a value of 0 may have waiters, only then the slow path is needed */
+    unsigned value = __atomic_load_n(&sema->value, __ATOMIC_RELAXED);
+    while (value > 0) {
+        if (value == UINT_MAX) {
+            return -EOVERFLOW;
+        }
+        if (__atomic_compare_exchange_n(&sema->value, &value, value + 1, true,
+                                        __ATOMIC_RELEASE, __ATOMIC_RELAXED)) {
+            return 0;
+        }
+    }
+
     unsigned old = irq_disable();
     if (sema->value == UINT_MAX) {
         irq_restore(old);
         return -EOVERFLOW;
     }
 
-    unsigned value = sema->value++;
+    value = sema->value++;
     irq_restore(old);
 
     if (value == 0) {
@@ -0,0 +1,824 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_senml_json
+ * @{
+ *
+ * @file
+ * @brief       Streaming SenML JSON decoder
+ *
+ * A JSON parser driven one byte at a time, with the state kept in the parser
+ * context. Only string content and whitespace come in long runs, they are
+ * scanned a machine word at a time.
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <string.h>
+
+#include "senml/json.h"
+
+enum {
+    S_START,            /**< expects `[` */
+    S_RECORD_OR_END,    /**< expects `{` or `]` */
+    S_RECORD,           /**< expects `{` */
+    S_AFTER_RECORD,     /**< expects `,` or `]` */
+    S_KEY_OR_END,       /**< expects `"` or `}` */
+    S_KEY,              /**< expects `"` */
+    S_KEY_STR,          /**< in a key */
+    S_COLON,            /**< expects `:` */
+    S_VALUE,            /**< expects a value */
+    S_STR,              /**< in a string value */
+    S_NUM,              /**< in a number */
+    S_LIT,              /**< in `true` or `false` */
+    S_SKIP,             /**< in a value that is skipped */
+    S_AFTER_VALUE,      /**< expects `,` or `}` */
+    S_END,              /**< after the pack */
+};
+
+enum {
+    F_UNKNOWN,
+    F_BN,
+    F_BT,
+    F_BU,
+    F_BV,
+    F_BS,
+    F_BVER,
+    F_N,
+    F_U,
+    F_V,
+    F_VS,
+    F_VB,
+    F_VD,
+    F_S,
+    F_T,
+    F_UT,
+    F_NUMOF,
+};
+
+static const char _keys[F_NUMOF][5] = {
+    [F_BN] = "bn",
+    [F_BT] = "bt",
+    [F_BU] = "bu",
+    [F_BV] = "bv",
+    [F_BS] = "bs",
+    [F_BVER] = "bver",
+    [F_N] = "n",
+    [F_U] = "u",
+    [F_V] = "v",
+    [F_VS] = "vs",
+    [F_VB] = "vb",
+    [F_VD] = "vd",
+    [F_S] = "s",
+    [F_T] = "t",
+    [F_UT] = "ut",
+};
+
+#define HAS_V       (0x1)
+#define HAS_VS      (0x2)
+#define HAS_VB      (0x4)
+
+#define N_NEG       (0x001)     /**< leading `-` */
+#define N_INT       (0x002)     /**< integer digit */
+#define N_LEAD0     (0x004)     /**< integer part starts with `0` */
+#define N_DOT       (0x008)     /**< `.` */
+#define N_FRAC      (0x010)     /**< fraction digit */
+#define N_E         (0x020)     /**< `e` or `E` */
+#define N_ESIGN     (0x040)     /**< sign of the exponent */
+#define N_ENEG      (0x080)     /**< negative exponent */
+#define N_EDIG      (0x100)     /**< exponent digit */
+#define N_LOSSY     (0x200)     /**< digits were dropped */
+
+#define ESC_START   (1)         /**< after `\` */
+#define ESC_U       (2)         /**< first hex digit of `\u`, up to ESC_U + 3 */
+
+#define SKIP_STR    (0x1)       /**< in a string of a skipped value */
+#define SKIP_ESC    (0x2)       /**< after `\` in that string */
+
+#define ONES        ((uintptr_t)-1 / 0xff)
+#define HIGHS       (ONES * 0x80)
+
+static inline uintptr_t _has_zero(uintptr_t v)
+{
+    return (v - ONES) & ~v & HIGHS;
+}
+
+/* number of bytes that can be copied as they are from a string */
+static size_t _plain_run(const uint8_t *p, size_t len)
+{
+    size_t i = 0;
+
+    while (len - i >= sizeof(uintptr_t)) {
+        uintptr_t v;
+        memcpy(&v, &p[i], sizeof(v));
+        /* control characters, `"` or `\`, may report a few false positives */
+        uintptr_t special = ((v - ONES * 0x20) & ~v & HIGHS)
+                          | _has_zero(v ^ (ONES * '"'))
+                          | _has_zero(v ^ (ONES * '\\'));
+        if (special) {
+            break;
+        }
+        i += sizeof(v);
+    }
+    while ((i < len) && (p[i] >= 0x20) && (p[i] != '"') && (p[i] != '\\')) {
+        i++;
+    }
+    return i;
+}
+
+static inline bool _is_ws(uint8_t c)
+{
+    return (c == ' ') || (c == '\n') || (c == '\r') || (c == '\t');
+}
+
+static size_t _ws_run(const uint8_t *p, size_t len)
+{
+    size_t i = 0;
+
+    while (len - i >= sizeof(uintptr_t)) {
+        uintptr_t v;
+        memcpy(&v, &p[i], sizeof(v));
+        if (v != ONES * ' ') {
+            break;
+        }
+        i += sizeof(v);
+    }
+    while ((i < len) && _is_ws(p[i])) {
+        i++;
+    }
+    return i;
+}
+
+static senml_unit_t _unit_from_str(const char *str)
+{
+    for (unsigned u = SENML_UNIT_NONE; u <= SENML_UNIT_GRAM_PER_LITER; u++) {
+        if (strcmp(senml_unit_to_str(u), str) == 0) {
+            return u;
+        }
+    }
+    return SENML_UNIT_NONE;
+}
+
+static void _str_start(senml_json_parser_t *parser, char *dst, size_t max)
+{
+    parser->str = dst;
+    parser->str_len = 0;
+    parser->str_max = max;
+    parser->esc = 0;
+    parser->hi_surrogate = 0;
+    parser->underscore = false;
+}
+
+static int _append(senml_json_parser_t *parser, const void *data, size_t len)
+{
+    if (parser->hi_surrogate) {
+        return -EBADMSG;
+    }
+    parser->underscore = (((const char *)data)[len - 1] == '_');
+    if (len >= (size_t)(parser->str_max - parser->str_len)) {
+        /* keys and units that don't fit are unknown anyway */
+        if ((parser->state == S_KEY_STR) ||
+            (parser->field == F_U) || (parser->field == F_BU)) {
+            parser->str_len = parser->str_max;
+            return 0;
+        }
+        return -ENOBUFS;
+    }
+    memcpy(&parser->str[parser->str_len], data, len);
+    parser->str_len += len;
+    return 0;
+}
+
+static int _append_code_point(senml_json_parser_t *parser, uint32_t cp)
+{
+    uint8_t utf8[4];
+    size_t len;
+
+    if (cp == 0) {
+        /* strings are terminated by '\0' */
+        return -ENOTSUP;
+    }
+    if (cp < 0x80) {
+        utf8[0] = cp;
+        len = 1;
+    }
+    else if (cp < 0x800) {
+        utf8[0] = 0xc0 | (cp >> 6);
+        utf8[1] = 0x80 | (cp & 0x3f);
+        len = 2;
+    }
+    else if (cp < 0x10000) {
+        utf8[0] = 0xe0 | (cp >> 12);
+        utf8[1] = 0x80 | ((cp >> 6) & 0x3f);
+        utf8[2] = 0x80 | (cp & 0x3f);
+        len = 3;
+    }
+    else {
+        utf8[0] = 0xf0 | (cp >> 18);
+        utf8[1] = 0x80 | ((cp >> 12) & 0x3f);
+        utf8[2] = 0x80 | ((cp >> 6) & 0x3f);
+        utf8[3] = 0x80 | (cp & 0x3f);
+        len = 4;
+    }
+    return _append(parser, utf8, len);
+}
+
+static int _hex(uint8_t c)
+{
+    if ((c >= '0') && (c <= '9')) {
+        return c - '0';
+    }
+    c |= 0x20;
+    if ((c >= 'a') && (c <= 'f')) {
+        return c - 'a' + 10;
+    }
+    return -EBADMSG;
+}
+
+static int _escape(senml_json_parser_t *parser, uint8_t c)
+{
+    static const char from[] = "\"\\/bfnrt";
+    static const char to[] = "\"\\/\b\f\n\r\t";
+
+    if (parser->esc == ESC_START) {
+        if (c == 'u') {
+            parser->esc = ESC_U;
+            parser->code = 0;
+            return 0;
+        }
+
+        const char *pos = memchr(from, c, sizeof(from) - 1);
+        parser->esc = 0;
+        if (pos == NULL) {
+            return -EBADMSG;
+        }
+        return _append(parser, &to[pos - from], 1);
+    }
+
+    int digit = _hex(c);
+    if (digit < 0) {
+        return digit;
+    }
+    parser->code = (parser->code << 4) | digit;
+    if (parser->esc++ < ESC_U + 3) {
+        return 0;
+    }
+    parser->esc = 0;
+
+    uint16_t code = parser->code;
+    if (parser->hi_surrogate) {
+        if ((code < 0xdc00) || (code > 0xdfff)) {
+            return -EBADMSG;
+        }
+        uint32_t cp = 0x10000 + (((uint32_t)parser->hi_surrogate - 0xd800) << 10)
+                    + (code - 0xdc00);
+        parser->hi_surrogate = 0;
+        return _append_code_point(parser, cp);
+    }
+    if ((code >= 0xd800) && (code <= 0xdbff)) {
+        parser->hi_surrogate = code;
+        return 0;
+    }
+    if ((code >= 0xdc00) && (code <= 0xdfff)) {
+        return -EBADMSG;
+    }
+    return _append_code_point(parser, code);
+}
+
+/* returns the number of bytes consumed, 1 + the position of the closing `"` at most */
+static int _str(senml_json_parser_t *parser, const uint8_t *p, size_t len,
+                bool *done)
+{
+    size_t i = 0;
+    int res;
+
+    while (i < len) {
+        if (parser->esc) {
+            if ((res = _escape(parser, p[i++])) < 0) {
+                return res;
+            }
+            continue;
+        }
+
+        size_t run = _plain_run(&p[i], len - i);
+        if (run) {
+            if ((res = _append(parser, &p[i], run)) < 0) {
+                return res;
+            }
+            i += run;
+            continue;
+        }
+
+        uint8_t c = p[i++];
+        if (c == '\\') {
+            parser->esc = ESC_START;
+        }
+        else if ((c == '"') && !parser->hi_surrogate) {
+            if (parser->str_len < parser->str_max) {
+                parser->str[parser->str_len] = '\0';
+            }
+            *done = true;
+            return i;
+        }
+        else {
+            /* control character or unpaired surrogate */
+            return -EBADMSG;
+        }
+    }
+    return i;
+}
+
+static int _key_done(senml_json_parser_t *parser)
+{
+    parser->field = F_UNKNOWN;
+    if (parser->str_len < parser->str_max) {
+        for (unsigned f = F_UNKNOWN + 1; f < F_NUMOF; f++) {
+            if (strcmp(_keys[f], parser->key) == 0) {
+                parser->field = f;
+                break;
+            }
+        }
+    }
+    if ((parser->field == F_UNKNOWN) && parser->underscore) {
+        return -ENOTSUP;
+    }
+    return 0;
+}
+
+static void _str_done(senml_json_parser_t *parser)
+{
+    switch (parser->field) {
+    case F_BN:
+        parser->base.base_name = parser->base_name;
+        break;
+    case F_N:
+        parser->attr.name = parser->name;
+        break;
+    case F_BU:
+        parser->base.base_unit = (parser->str_len < parser->str_max)
+                               ? _unit_from_str(parser->unit) : SENML_UNIT_NONE;
+        break;
+    case F_U:
+        parser->attr.unit = (parser->str_len < parser->str_max)
+                          ? _unit_from_str(parser->unit) : SENML_UNIT_NONE;
+        break;
+    case F_VS:
+        parser->string_len = parser->str_len;
+        parser->has |= HAS_VS;
+        break;
+    }
+}
+
+/* returns 1 if c is part of the number, 0 if it ends the number */
+static int _num_char(senml_json_num_t *num, uint8_t c)
+{
+    uint16_t f = num->flags;
+
+    if ((c >= '0') && (c <= '9')) {
+        unsigned d = c - '0';
+        bool fits = (num->mant < UINT64_MAX / 10) ||
+                    ((num->mant == UINT64_MAX / 10) && (d <= UINT64_MAX % 10));
+
+        if (f & N_E) {
+            if (num->e < 100000) {
+                num->e = num->e * 10 + d;
+            }
+            f |= N_EDIG;
+        }
+        else if (f & N_DOT) {
+            f |= N_FRAC;
+            if (fits) {
+                num->mant = num->mant * 10 + d;
+                num->exp--;
+            }
+            else {
+                f |= N_LOSSY;
+            }
+        }
+        else if (f & N_LEAD0) {
+            return -EBADMSG;
+        }
+        else {
+            if (!(f & N_INT) && (d == 0)) {
+                f |= N_LEAD0;
+            }
+            f |= N_INT;
+            if (fits) {
+                num->mant = num->mant * 10 + d;
+            }
+            else {
+                num->exp++;
+                f |= N_LOSSY;
+            }
+        }
+    }
+    else if ((c == '-') && (f == 0)) {
+        f |= N_NEG;
+    }
+    else if ((c == '.') && (f & N_INT) && !(f & (N_DOT | N_E))) {
+        f |= N_DOT;
+    }
+    else if (((c == 'e') || (c == 'E')) && (f & N_INT) && !(f & N_E) &&
+             (!(f & N_DOT) || (f & N_FRAC))) {
+        f |= N_E;
+    }
+    else if (((c == '+') || (c == '-')) && (f & N_E) && !(f & (N_ESIGN | N_EDIG))) {
+        f |= N_ESIGN | ((c == '-') ? N_ENEG : 0);
+    }
+    else {
+        if (!(f & N_INT) || ((f & N_DOT) && !(f & N_FRAC)) ||
+            ((f & N_E) && !(f & N_EDIG))) {
+            return -EBADMSG;
+        }
+        return 0;
+    }
+    num->flags = f;
+    return 1;
+}
+
+static void _num_value(const senml_json_num_t *num, senml_numeric_t *v)
+{
+    uint64_t mant = num->mant;
+    bool neg = num->flags & N_NEG;
+
+    if (!(num->flags & (N_DOT | N_E | N_LOSSY))) {
+        if (neg && (mant <= (uint64_t)INT64_MAX + 1)) {
+            senml_set_int(v, mant ? -(int64_t)(mant - 1) - 1 : 0);
+            return;
+        }
+        if (!neg) {
+            if (mant <= INT64_MAX) {
+                senml_set_int(v, mant);
+            }
+            else {
+                set_senml_uint(v, mant);
+            }
+            return;
+        }
+    }
+
+    int64_t exp = (int64_t)num->exp + ((num->flags & N_ENEG) ? -num->e : num->e);
+    while (mant > INT32_MAX) {
+        mant /= 10;
+        exp++;
+    }
+    if (exp > INT32_MAX) {
+        exp = INT32_MAX;
+    }
+    else if (exp < INT32_MIN) {
+        exp = INT32_MIN;
+    }
+    senml_set_decfrac(v, neg ? -(int32_t)mant : (int32_t)mant, exp);
+}
+
+static int _num_done(senml_json_parser_t *parser)
+{
+    senml_numeric_t v;
+
+    _num_value(&parser->num, &v);
+
+    switch (parser->field) {
+    case F_BT:
+        parser->base.base_time = v;
+        break;
+    case F_BV:
+        parser->base.base_value = v;
+        break;
+#if IS_ACTIVE(CONFIG_SENML_ATTR_SUM)
+    case F_BS:
+        parser->base.base_sum = v;
+        break;
+    case F_S:
+        parser->attr.sum = v;
+        break;
+#endif
+#if IS_ACTIVE(CONFIG_SENML_ATTR_VERSION)
+    case F_BVER:
+        if (v.type != SENML_TYPE_NUMERIC_INT || v.value.i < 0) {
+            return -EBADMSG;
+        }
+        parser->base.base_version = v.value.i;
+        break;
+#endif
+#if IS_ACTIVE(CONFIG_SENML_ATTR_UPDATE_TIME)
+    case F_UT:
+        parser->attr.update_time = v;
+        break;
+#endif
+    case F_T:
+        parser->attr.time = v;
+        break;
+    case F_V:
+        parser->value = v;
+        parser->has |= HAS_V;
+        break;
+    }
+    return 0;
+}
+
+static void _record_start(senml_json_parser_t *parser)
+{
+    memset(&parser->attr, 0, sizeof(parser->attr));
+    memset(&parser->value, 0, sizeof(parser->value));
+    parser->has = 0;
+}
+
+static int _record_end(senml_json_parser_t *parser)
+{
+    const senml_json_cbs_t *cbs = parser->cbs;
+    senml_attr_t *attr = &parser->attr;
+
+    if (parser->has & (parser->has - 1)) {
+        /* more than one value */
+        return -EBADMSG;
+    }
+
+    attr->base_name = parser->base.base_name;
+    attr->base_time = parser->base.base_time;
+    attr->base_unit = parser->base.base_unit;
+    attr->base_value = parser->base.base_value;
+#if IS_ACTIVE(CONFIG_SENML_ATTR_SUM)
+    attr->base_sum = parser->base.base_sum;
+#endif
+#if IS_ACTIVE(CONFIG_SENML_ATTR_VERSION)
+    attr->base_version = parser->base.base_version;
+#endif
+
+    if ((parser->has & HAS_V) && cbs->value) {
+        senml_value_t val = { .attr = *attr, .value = parser->value };
+        cbs->value(parser->arg, &val);
+    }
+    else if ((parser->has & HAS_VS) && cbs->string) {
+        senml_string_value_t val = {
+            .attr = *attr, .value = parser->string, .len = parser->string_len,
+        };
+        cbs->string(parser->arg, &val);
+    }
+    else if ((parser->has & HAS_VB) && cbs->boolean) {
+        senml_bool_value_t val = { .attr = *attr, .value = parser->boolean };
+        cbs->boolean(parser->arg, &val);
+    }
+    return 0;
+}
+
+static int _value_start(senml_json_parser_t *parser, uint8_t c)
+{
+    switch (parser->field) {
+    case F_UNKNOWN:
+    case F_VD:
+        parser->depth = 0;
+        parser->esc = 0;
+        parser->state = S_SKIP;
+        return 0;
+    case F_BN:
+        if (c == '"') {
+            _str_start(parser, parser->base_name, sizeof(parser->base_name));
+            parser->state = S_STR;
+            return 1;
+        }
+        break;
+    case F_N:
+        if (c == '"') {
+            _str_start(parser, parser->name, sizeof(parser->name));
+            parser->state = S_STR;
+            return 1;
+        }
+        break;
+    case F_U:
+    case F_BU:
+        if (c == '"') {
+            _str_start(parser, parser->unit, sizeof(parser->unit));
+            parser->state = S_STR;
+            return 1;
+        }
+        break;
+    case F_VS:
+        if (c == '"') {
+            _str_start(parser, parser->string, sizeof(parser->string));
+            parser->state = S_STR;
+            return 1;
+        }
+        break;
+    case F_VB:
+        if ((c == 't') || (c == 'f')) {
+            parser->boolean = (c == 't');
+            parser->lit = 1;
+            parser->state = S_LIT;
+            return 1;
+        }
+        break;
+    default:
+        if ((c == '-') || ((c >= '0') && (c <= '9'))) {
+            memset(&parser->num, 0, sizeof(parser->num));
+            parser->state = S_NUM;
+            return 0;
+        }
+        break;
+    }
+    return -EBADMSG;
+}
+
+/* skips any JSON value without checking it */
+static int _skip(senml_json_parser_t *parser, const uint8_t *p, size_t len)
+{
+    size_t i = 0;
+
+    while (i < len) {
+        uint8_t c = p[i];
+
+        if (parser->esc & SKIP_ESC) {
+            parser->esc &= ~SKIP_ESC;
+            i++;
+            continue;
+        }
+        if (parser->esc & SKIP_STR) {
+            size_t run = _plain_run(&p[i], len - i);
+            if (run) {
+                i += run;
+                continue;
+            }
+            i++;
+            if (c == '\\') {
+                parser->esc |= SKIP_ESC;
+            }
+            else if (c == '"') {
+                parser->esc = 0;
+                if (parser->depth == 0) {
+                    parser->state = S_AFTER_VALUE;
+                    return i;
+                }
+            }
+            continue;
+        }
+
+        if (c == '"') {
+            parser->esc = SKIP_STR;
+        }
+        else if ((c == '{') || (c == '[')) {
+            if (parser->depth == UINT8_MAX) {
+                return -EBADMSG;
+            }
+            parser->depth++;
+        }
+        else if ((c == '}') || (c == ']') || (c == ',')) {
+            if (parser->depth == 0) {
+                /* end of a scalar, handled by the next state */
+                parser->state = S_AFTER_VALUE;
+                return i;
+            }
+            if ((c != ',') && (--parser->depth == 0)) {
+                parser->state = S_AFTER_VALUE;
+                return i + 1;
+            }
+        }
+        i++;
+    }
+    return i;
+}
+
+static int _expect(senml_json_parser_t *parser, uint8_t c, uint8_t expected,
+                   uint8_t state)
+{
+    if (c != expected) {
+        return -EBADMSG;
+    }
+    parser->state = state;
+    return 1;
+}
+
+/* returns the number of bytes consumed */
+static int _step(senml_json_parser_t *parser, const uint8_t *p, size_t len)
+{
+    static const char *const literals[] = { "false", "true" };
+    bool done = false;
+    int res;
+
+    switch (parser->state) {
+    case S_KEY_STR:
+        res = _str(parser, p, len, &done);
+        if ((res >= 0) && done) {
+            parser->state = S_COLON;
+            int err = _key_done(parser);
+            if (err < 0) {
+                return err;
+            }
+        }
+        return res;
+    case S_STR:
+        res = _str(parser, p, len, &done);
+        if ((res >= 0) && done) {
+            _str_done(parser);
+            parser->state = S_AFTER_VALUE;
+        }
+        return res;
+    case S_NUM:
+        res = _num_char(&parser->num, *p);
+        if (res == 0) {
+            parser->state = S_AFTER_VALUE;
+            return _num_done(parser);
+        }
+        return res;
+    case S_LIT: {
+        const char *lit = literals[parser->boolean];
+        if (*p != (uint8_t)lit[parser->lit]) {
+            return -EBADMSG;
+        }
+        if (lit[++parser->lit] == '\0') {
+            parser->has |= HAS_VB;
+            parser->state = S_AFTER_VALUE;
+        }
+        return 1;
+    }
+    case S_SKIP:
+        return _skip(parser, p, len);
+    default:
+        break;
+    }
+
+    size_t ws = _ws_run(p, len);
+    if (ws) {
+        return ws;
+    }
+
+    uint8_t c = *p;
+    switch (parser->state) {
+    case S_START:
+        return _expect(parser, c, '[', S_RECORD_OR_END);
+    case S_RECORD_OR_END:
+        if (c == ']') {
+            parser->state = S_END;
+            return 1;
+        }
+        /* fall through */
+    case S_RECORD:
+        _record_start(parser);
+        return _expect(parser, c, '{', S_KEY_OR_END);
+    case S_AFTER_RECORD:
+        if (c == ']') {
+            parser->state = S_END;
+            return 1;
+        }
+        return _expect(parser, c, ',', S_RECORD);
+    case S_KEY_OR_END:
+        if (c == '}') {
+            parser->state = S_AFTER_RECORD;
+            return (res = _record_end(parser)) < 0 ? res : 1;
+        }
+        /* fall through */
+    case S_KEY:
+        _str_start(parser, parser->key, sizeof(parser->key));
+        return _expect(parser, c, '"', S_KEY_STR);
+    case S_COLON:
+        return _expect(parser, c, ':', S_VALUE);
+    case S_VALUE:
+        return _value_start(parser, c);
+    case S_AFTER_VALUE:
+        if (c == '}') {
+            parser->state = S_AFTER_RECORD;
+            return (res = _record_end(parser)) < 0 ? res : 1;
+        }
+        return _expect(parser, c, ',', S_KEY);
+    default:
+        return -EBADMSG;
+    }
+}
+
+void senml_json_init(senml_json_parser_t *parser, const senml_json_cbs_t *cbs,
+                     void *arg)
+{
+    memset(parser, 0, sizeof(*parser));
+    parser->cbs = cbs;
+    parser->arg = arg;
+    parser->state = S_START;
+}
+
+int senml_json_parse(senml_json_parser_t *parser, const void *buf, size_t len)
+{
+    const uint8_t *p = buf;
+
+    while (len && (parser->error == 0)) {
+        int res = _step(parser, p, len);
+        if (res < 0) {
+            parser->error = res;
+            break;
+        }
+        p += res;
+        len -= res;
+    }
+    return parser->error;
+}
+
+int senml_json_finish(const senml_json_parser_t *parser)
+{
+    if (parser->error) {
+        return parser->error;
+    }
+    return (parser->state == S_END) ? 0 : -ENODATA;
+}
@@ -6,6 +6,7 @@
  * directory for more details.
  */
 
+#include "kernel_defines.h"
 #include "nanocbor/nanocbor.h"
 #include "saul_reg.h"
 #include "senml.h"
@@ -97,3 +98,41 @@ size_t senml_saul_encode_cbor(uint8_t *buf, size_t len, saul_reg_t *dev)
     nanocbor_fmt_end_indefinite(&enc);
     return nanocbor_encoded_len(&enc);
 }
+
+#if IS_USED(MODULE_NANOCOAP)
+/* appends the encoded data of enc to the current block */
+static size_t _put_block(coap_block_slicer_t *slicer, uint8_t *bufpos,
+                         nanocbor_encoder_t *enc, const uint8_t *scratch)
+{
+    return coap_blockwise_put_bytes(slicer, bufpos, scratch,
+                                    nanocbor_encoded_len(enc));
+}
+
+size_t senml_saul_encode_cbor_block(coap_block_slicer_t *slicer, uint8_t *buf,
+                                    saul_reg_t *dev)
+{
+    uint8_t scratch[CONFIG_SENML_SAUL_BLOCK_SCRATCH_SIZE];
+    nanocbor_encoder_t enc;
+    size_t pos = 0;
+
+    nanocbor_encoder_init(&enc, scratch, sizeof(scratch));
+    nanocbor_fmt_array_indefinite(&enc);
+    pos += _put_block(slicer, buf + pos, &enc, scratch);
+
+    while (dev) {
+        nanocbor_encoder_init(&enc, scratch, sizeof(scratch));
+        if ((senml_saul_reg_encode_cbor(&enc, dev) <= 0) ||
+            (nanocbor_encoded_len(&enc) > sizeof(scratch))) {
+            return 0;
+        }
+        pos += _put_block(slicer, buf + pos, &enc, scratch);
+        dev = dev->next;
+    }
+
+    nanocbor_encoder_init(&enc, scratch, sizeof(scratch));
+    nanocbor_fmt_end_indefinite(&enc);
+    pos += _put_block(slicer, buf + pos, &enc, scratch);
+
+    return pos;
+}
+#endif
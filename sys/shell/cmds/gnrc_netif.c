@@ -179,6 +179,11 @@ static int _netif_stats(netif_t *iface, unsigned module, bool reset)
                (unsigned)stats.tx_bytes,
                (unsigned)stats.tx_success,
                (unsigned)stats.tx_failed);
+        if (module == NETSTATS_LAYER2) {
+            printf("            RX invalid %u  overruns %u\n",
+                   (unsigned)stats.rx_invalid,
+                   (unsigned)stats.rx_overrun);
+        }
         res = 0;
     }
     return res;
@@ -31,6 +31,9 @@
 #include "net/gnrc/rpl/p2p_dodag.h"
 #include "net/gnrc/rpl/p2p_structs.h"
 #endif
+#ifdef MODULE_GNRC_RPL_SRH_ROUTES
+#include "net/gnrc/rpl/srh_routes.h"
+#endif
 
 int _gnrc_rpl_init(char *arg)
 {
@@ -247,6 +250,41 @@ int _stats(void)
     _print_stats_block(&gnrc_rpl_netstats.dis, "DIS");
     _print_stats_block(&gnrc_rpl_netstats.dao, "DAO");
     _print_stats_block(&gnrc_rpl_netstats.dao_ack, "DAO-ACK");
+    printf("DIO consistent: %" PRIu32 "\n", gnrc_rpl_netstats.dio_consistent);
+    return 0;
+}
+#endif
+
+#ifdef MODULE_GNRC_RPL_SRH_ROUTES
+int _gnrc_rpl_routes(char *arg)
+{
+    gnrc_rpl_srh_routes_stats_t stats;
+
+    if (arg != NULL) {
+        ipv6_addr_t target;
+        ipv6_addr_t hops[8];
+        char addr_str[IPV6_ADDR_MAX_STR_LEN];
+        int res;
+
+        if (ipv6_addr_from_str(&target, arg) == NULL) {
+            puts("error: <target> must be a valid IPv6 address");
+            return 1;
+        }
+        if ((res = gnrc_rpl_srh_routes_path(&target, hops, ARRAY_SIZE(hops))) < 0) {
+            puts("error: no source route to <target>");
+            return 1;
+        }
+        for (int i = 0; i < res; i++) {
+            printf("%s%s", (i == 0) ? "" : " -> ",
+                   ipv6_addr_to_str(addr_str, &hops[i], sizeof(addr_str)));
+        }
+        puts("");
+        return 0;
+    }
+    gnrc_rpl_srh_routes_stats(&stats);
+    printf("source routes: %u / %u, %u bytes per route, %u bytes total\n",
+           stats.numof, stats.max, (unsigned)stats.route_size,
+           (unsigned)stats.total_size);
     return 0;
 }
 #endif
@@ -448,6 +486,11 @@ static int _gnrc_rpl(int argc, char **argv)
         return _stats();
     }
 #endif
+#ifdef MODULE_GNRC_RPL_SRH_ROUTES
+    else if ((argc <= 3) && (strcmp(argv[1], "routes") == 0)) {
+        return _gnrc_rpl_routes((argc == 3) ? argv[2] : NULL);
+    }
+#endif
 
 #ifdef MODULE_GNRC_RPL_P2P
     puts("* find <dodag_id> <target>\t\t\t- initiate a P2P-RPL route discovery");
@@ -461,6 +504,9 @@ static int _gnrc_rpl(int argc, char **argv)
     puts("* rm <instance_id>\t\t\t- delete the given instance and related dodag");
     puts("* root <inst_id> <dodag_id>\t\t- add a dodag to a new or existing instance");
     puts("* router <instance_id>\t\t\t- operate as router in the instance");
+#ifdef MODULE_GNRC_RPL_SRH_ROUTES
+    puts("* routes [<target>]\t\t\t- show source route store or route to target");
+#endif
     puts("* send dis\t\t\t\t- send a multicast DIS");
     puts("* send dis <VID_flags> <version> <instance_id> <dodag_id> - send a multicast DIS with SOL option");
 
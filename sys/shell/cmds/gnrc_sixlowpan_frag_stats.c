@@ -31,6 +31,10 @@ static int _gnrc_6lo_frag_stats(int argc, char **argv)
     printf("frag full: %u\n", stats->frag_full);
 #ifdef MODULE_GNRC_SIXLOWPAN_FRAG_VRB
     printf("VRB full: %u\n", stats->vrb_full);
+    printf("VRB hits: %u, misses: %u\n", stats->vrb_hits, stats->vrb_misses);
+#endif
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_MINFWD
+    printf("VRB forwarded in place: %u\n", stats->vrb_in_place);
 #endif
 #ifdef MODULE_GNRC_SIXLOWPAN_FRAG_SFR_STATS
     gnrc_sixlowpan_frag_sfr_stats_t sfr;
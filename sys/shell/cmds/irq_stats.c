@@ -0,0 +1,41 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_shell_commands
+ * @{
+ *
+ * @file
+ * @brief       Shell command to print ISR and IRQ-off time statistics
+ *
+ * @}
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "irq_stats.h"
+#include "shell.h"
+
+static int _irq_stats_handler(int argc, char **argv)
+{
+    if (argc < 2) {
+        irq_stats_print();
+        return 0;
+    }
+    if (strcmp(argv[1], "reset") == 0) {
+        irq_stats_reset();
+        return 0;
+    }
+
+    printf("usage: %s [reset]\n", argv[0]);
+    return 1;
+}
+
+SHELL_COMMAND(irqstats, "Print ISR durations and max. IRQ-off time",
+              _irq_stats_handler);
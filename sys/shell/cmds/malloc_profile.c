@@ -0,0 +1,40 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_shell_commands
+ * @{
+ *
+ * @file
+ * @brief       Shell command to print heap usage by call site
+ *
+ * @}
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "malloc_profile.h"
+#include "shell.h"
+
+static int _malloc_profile_handler(int argc, char **argv)
+{
+    if (argc < 2) {
+        malloc_profile_print();
+        return 0;
+    }
+    if (strcmp(argv[1], "reset") == 0) {
+        malloc_profile_reset_peak();
+        return 0;
+    }
+
+    printf("usage: %s [reset]\n", argv[0]);
+    return 1;
+}
+
+SHELL_COMMAND(mprof, "Print heap usage by call site", _malloc_profile_handler);
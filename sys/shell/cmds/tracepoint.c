@@ -0,0 +1,60 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_shell_commands
+ * @{
+ *
+ * @file
+ * @brief       Shell command to list and enable tracepoints
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "shell.h"
+#include "tracepoint.h"
+
+static void _print(void)
+{
+    const tracepoint_t *tp;
+
+    for (unsigned i = 0; (tp = tracepoint_get(i)); i++) {
+        printf("%3u %-3s %10" PRIu32 " %s\n", i, tp->enabled ? "on" : "off",
+               tp->hits, tp->name);
+    }
+}
+
+static int _tracepoint_handler(int argc, char **argv)
+{
+    if (argc < 2) {
+        _print();
+        return 0;
+    }
+    if (strcmp(argv[1], "reset") == 0) {
+        tracepoint_reset();
+        return 0;
+    }
+    if ((argc == 3) && (!strcmp(argv[1], "on") || !strcmp(argv[1], "off"))) {
+        const char *name = strcmp(argv[2], "all") ? argv[2] : NULL;
+
+        if (!tracepoint_enable(name, !strcmp(argv[1], "on"))) {
+            printf("%s: no tracepoint %s\n", argv[0], argv[2]);
+            return 1;
+        }
+        return 0;
+    }
+
+    printf("usage: %s [on|off <name|all>] [reset]\n", argv[0]);
+    return 1;
+}
+
+SHELL_COMMAND(tp, "List and enable tracepoints", _tracepoint_handler);
@@ -364,21 +364,25 @@ static int _storage_helper(void *arg, size_t offset, uint8_t *buf, size_t len,
         return -1;
     }
 
-    if (image_size < offset + len) {
-        /* Extra newline at the start to compensate for the progress bar */
-        LOG_ERROR(
-            "\n_suit_coap(): Image beyond size, offset + len=%u, "
-            "image_size=%u\n", (unsigned)(total), (unsigned)image_size);
-        return -1;
-    }
+    /* a delta has a size of its own, backends taking one check the size of
+     * the resulting image instead */
+    if (!suit_storage_is_delta(comp->storage_backend)) {
+        if (image_size < offset + len) {
+            /* Extra newline at the start to compensate for the progress bar */
+            LOG_ERROR(
+                "\n_suit_coap(): Image beyond size, offset + len=%u, "
+                "image_size=%u\n", (unsigned)(total), (unsigned)image_size);
+            return -1;
+        }
 
-    if (!more && image_size != total) {
-        LOG_INFO("Incorrect size received, got %u, expected %u\n",
-                 (unsigned)total, (unsigned)image_size);
-        return -1;
-    }
+        if (!more && image_size != total) {
+            LOG_INFO("Incorrect size received, got %u, expected %u\n",
+                     (unsigned)total, (unsigned)image_size);
+            return -1;
+        }
 
-    _print_download_progress(manifest, offset, len, image_size);
+        _print_download_progress(manifest, offset, len, image_size);
+    }
 
     int res = suit_storage_write(comp->storage_backend, manifest, buf, offset, len);
     if (!more) {
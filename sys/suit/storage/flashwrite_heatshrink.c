@@ -0,0 +1,293 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_suit_storage_flashwrite_heatshrink
+ * @{
+ *
+ * @file
+ * @brief       SUIT riotboot heatshrink storage module implementation
+ *
+ * @}
+ */
+#include <string.h>
+
+#include "kernel_defines.h"
+#include "log.h"
+#include "xfa.h"
+
+#include "suit.h"
+#include "suit/storage.h"
+#include "suit/storage/flashwrite_heatshrink.h"
+#include "riotboot/flashwrite.h"
+#include "riotboot/slot.h"
+#include "heatshrink_decoder.h"
+
+XFA_USE(suit_storage_t, suit_storage_reg);
+
+static inline suit_storage_flashwrite_heatshrink_t *_get_fw(
+    suit_storage_t *storage)
+{
+    return container_of(storage, suit_storage_flashwrite_heatshrink_t, storage);
+}
+
+static int _put_image(suit_storage_flashwrite_heatshrink_t *fw,
+                      const uint8_t *buf, size_t len)
+{
+    size_t skip = 0;
+
+    if (fw->img_offset + len > fw->img_size) {
+        LOG_ERROR("_put_image(): image exceeds %u bytes\n",
+                  (unsigned)fw->img_size);
+        return -1;
+    }
+
+    /* the magic number is skipped until install, just like with the
+     * flashwrite backend */
+    if (fw->img_offset < RIOTBOOT_FLASHWRITE_SKIPLEN) {
+        skip = RIOTBOOT_FLASHWRITE_SKIPLEN - fw->img_offset;
+        skip = (skip < len) ? skip : len;
+    }
+    fw->img_offset += len;
+
+    return riotboot_flashwrite_putbytes(&fw->writer, buf + skip, len - skip, 1);
+}
+
+static int _drain(suit_storage_flashwrite_heatshrink_t *fw)
+{
+    uint8_t buf[CONFIG_SUIT_STORAGE_FLASHWRITE_HEATSHRINK_BUF_SIZE];
+    HSD_poll_res res;
+
+    do {
+        size_t len = 0;
+        res = heatshrink_decoder_poll(&fw->decoder, buf, sizeof(buf), &len);
+        if (res < 0) {
+            return SUIT_ERR_STORAGE;
+        }
+        if (len && (_put_image(fw, buf, len) < 0)) {
+            return SUIT_ERR_STORAGE;
+        }
+    } while (res == HSDR_POLL_MORE);
+
+    return SUIT_OK;
+}
+
+static int _heatshrink_init(suit_storage_t *storage)
+{
+    (void)storage;
+
+    LOG_DEBUG("Storage size %u\n",
+              (unsigned)sizeof(suit_storage_flashwrite_heatshrink_t));
+
+    return 0;
+}
+
+static int _heatshrink_start(suit_storage_t *storage,
+                             const suit_manifest_t *manifest,
+                             size_t len)
+{
+    (void)manifest;
+    suit_storage_flashwrite_heatshrink_t *fw = _get_fw(storage);
+    int target_slot = riotboot_slot_other();
+
+    if (len > riotboot_slot_size(target_slot)) {
+        return SUIT_ERR_STORAGE_EXCEEDED;
+    }
+
+    fw->img_size = len;
+    fw->img_offset = 0;
+    fw->payload_offset = 0;
+    heatshrink_decoder_reset(&fw->decoder);
+
+    return riotboot_flashwrite_init(&fw->writer, target_slot);
+}
+
+static int _heatshrink_write(suit_storage_t *storage,
+                             const suit_manifest_t *manifest,
+                             const uint8_t *buf, size_t offset, size_t len)
+{
+    (void)manifest;
+    suit_storage_flashwrite_heatshrink_t *fw = _get_fw(storage);
+
+    if (offset != fw->payload_offset) {
+        LOG_ERROR("Unexpected offset: %u - expected: %u\n", (unsigned)offset,
+                  (unsigned)fw->payload_offset);
+        return SUIT_ERR_STORAGE;
+    }
+    fw->payload_offset += len;
+
+    while (len) {
+        size_t sunk = 0;
+        if (heatshrink_decoder_sink(&fw->decoder, (uint8_t *)buf, len,
+                                    &sunk) < 0) {
+            return SUIT_ERR_STORAGE;
+        }
+        buf += sunk;
+        len -= sunk;
+
+        int res = _drain(fw);
+        if (res != SUIT_OK) {
+            return res;
+        }
+    }
+
+    return SUIT_OK;
+}
+
+static int _heatshrink_finish(suit_storage_t *storage,
+                              const suit_manifest_t *manifest)
+{
+    (void)manifest;
+    suit_storage_flashwrite_heatshrink_t *fw = _get_fw(storage);
+    HSD_finish_res res;
+
+    while ((res = heatshrink_decoder_finish(&fw->decoder)) == HSDR_FINISH_MORE) {
+        if (_drain(fw) != SUIT_OK) {
+            return SUIT_ERR_STORAGE;
+        }
+    }
+
+    if ((res != HSDR_FINISH_DONE) ||
+        (riotboot_flashwrite_flush(&fw->writer) < 0)) {
+        return SUIT_ERR_STORAGE;
+    }
+
+    if (fw->img_offset != fw->img_size) {
+        LOG_INFO("Incorrect image size, got %u, expected %u\n",
+                 (unsigned)fw->img_offset, (unsigned)fw->img_size);
+        return SUIT_ERR_STORAGE;
+    }
+
+    return SUIT_OK;
+}
+
+static int _heatshrink_install(suit_storage_t *storage,
+                               const suit_manifest_t *manifest)
+{
+    (void)manifest;
+    suit_storage_flashwrite_heatshrink_t *fw = _get_fw(storage);
+
+    return riotboot_flashwrite_finish(&fw->writer);
+}
+
+static int _heatshrink_read(suit_storage_t *storage, uint8_t *buf,
+                            size_t offset, size_t len)
+{
+    suit_storage_flashwrite_heatshrink_t *fw = _get_fw(storage);
+
+    static const char _prefix[] = "RIOT";
+    static const size_t _prefix_len = sizeof(_prefix) - 1;
+    int target_slot = riotboot_slot_other();
+    size_t slot_size = riotboot_slot_size(target_slot);
+
+    /* Insert the "RIOT" magic number */
+    if (offset < (_prefix_len)) {
+        size_t prefix_to_copy = _prefix_len - offset;
+        memcpy(buf, _prefix + offset, prefix_to_copy);
+        len -= prefix_to_copy;
+        offset = _prefix_len;
+        buf += prefix_to_copy;
+    }
+
+#if CONFIG_RIOTBOOT_FLASHWRITE_RAW
+    /* The first chunk is only written to flash on install */
+    if (offset < RIOTBOOT_FLASHPAGE_BUFFER_SIZE) {
+        size_t firstpage_to_copy = RIOTBOOT_FLASHPAGE_BUFFER_SIZE - offset;
+        if (firstpage_to_copy > len) {
+            firstpage_to_copy = len;
+        }
+        memcpy(buf, fw->writer.firstblock_buf + offset, firstpage_to_copy);
+
+        offset += firstpage_to_copy;
+        buf += firstpage_to_copy;
+        len -= firstpage_to_copy;
+    }
+#else
+    (void)fw;
+#endif /* CONFIG_RIOTBOOT_FLASHWRITE_RAW */
+
+    if (offset + len > slot_size) {
+        return -1;
+    }
+
+    uint8_t *slot = (uint8_t *)riotboot_slot_get_hdr(target_slot);
+
+    memcpy(buf, slot + offset, len);
+    return 0;
+}
+
+static bool _heatshrink_has_location(const suit_storage_t *storage,
+                                     const char *location)
+{
+    (void)storage;
+
+    return strcmp(location,
+                  CONFIG_SUIT_STORAGE_FLASHWRITE_HEATSHRINK_LOCATION) == 0;
+}
+
+static int _heatshrink_set_active_location(suit_storage_t *storage,
+                                           const char *location)
+{
+    (void)storage;
+    (void)location;
+    return 0;
+}
+
+static bool _heatshrink_match_offset(const suit_storage_t *storage,
+                                     size_t offset)
+{
+    (void)storage;
+
+    int target_slot = riotboot_slot_other();
+    uintptr_t slot_start = (uintptr_t)riotboot_slot_offset(target_slot);
+
+    return (slot_start == (uintptr_t)offset);
+}
+
+static int _heatshrink_get_seq_no(const suit_storage_t *storage,
+                                  uint32_t *seq_no)
+{
+    (void)storage;
+    (void)seq_no;
+
+    /* the slots are covered by the flashwrite backend */
+    return -1;
+}
+
+static int _heatshrink_set_seq_no(suit_storage_t *storage, uint32_t seq_no)
+{
+    (void)storage;
+    (void)seq_no;
+
+    return SUIT_OK;
+}
+
+static const suit_storage_driver_t suit_storage_flashwrite_heatshrink_driver = {
+    .init = _heatshrink_init,
+    .start = _heatshrink_start,
+    .write = _heatshrink_write,
+    .finish = _heatshrink_finish,
+    .read = _heatshrink_read,
+    .install = _heatshrink_install,
+    .has_location = _heatshrink_has_location,
+    .set_active_location = _heatshrink_set_active_location,
+    .match_offset = _heatshrink_match_offset,
+    .get_seq_no = _heatshrink_get_seq_no,
+    .set_seq_no = _heatshrink_set_seq_no,
+    .separator = '\0',
+    .delta = true,
+};
+
+static suit_storage_flashwrite_heatshrink_t suit_storage_flashwrite_heatshrink = {
+    .storage = {
+        .driver = &suit_storage_flashwrite_heatshrink_driver,
+    },
+};
+
+XFA(suit_storage_reg, 0) suit_storage_t *suit_storage_flashwrite_heatshrink_ptr =
+    &suit_storage_flashwrite_heatshrink.storage;
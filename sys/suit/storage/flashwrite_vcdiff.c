@@ -0,0 +1,313 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_suit_storage_flashwrite_vcdiff
+ * @{
+ *
+ * @file
+ * @brief       SUIT riotboot VCDIFF storage module implementation
+ *
+ * The running slot is the source of the delta, the target is written to the
+ * other slot with riotboot_flashwrite. The decoder reads back parts of the
+ * target already written, these may still be in the buffers of the
+ * flashwriter.
+ *
+ * @}
+ */
+#include <errno.h>
+#include <string.h>
+
+#include "kernel_defines.h"
+#include "log.h"
+#include "xfa.h"
+
+#include "suit.h"
+#include "suit/storage.h"
+#include "suit/storage/flashwrite_vcdiff.h"
+#include "riotboot/flashwrite.h"
+#include "riotboot/slot.h"
+#include "vcdiff.h"
+
+XFA_USE(suit_storage_t, suit_storage_reg);
+
+static const char _prefix[] = "RIOT";
+
+static inline size_t _min(size_t a, size_t b)
+{
+    return a < b ? a : b;
+}
+
+static inline suit_storage_flashwrite_vcdiff_t *_get_fw(suit_storage_t *storage)
+{
+    return container_of(storage, suit_storage_flashwrite_vcdiff_t, storage);
+}
+
+static int _source_read(void *dev, uint8_t *dest, size_t offset, size_t len)
+{
+    (void)dev;
+    int slot = riotboot_slot_current();
+
+    if (offset + len > riotboot_slot_size(slot)) {
+        return -EINVAL;
+    }
+
+    memcpy(dest, (const uint8_t *)riotboot_slot_get_hdr(slot) + offset, len);
+    return 0;
+}
+
+static const vcdiff_driver_t _source_driver = {
+    .read = _source_read,
+};
+
+static int _target_read(void *dev, uint8_t *dest, size_t offset, size_t len)
+{
+    suit_storage_flashwrite_vcdiff_t *fw = dev;
+    const riotboot_flashwrite_t *writer = &fw->writer;
+    const uint8_t *slot = (const uint8_t *)riotboot_slot_get_hdr(
+        writer->target_slot);
+    /* start of the bytes not yet written to flash */
+    size_t buffered = writer->offset -
+                      (writer->offset % RIOTBOOT_FLASHPAGE_BUFFER_SIZE);
+
+    if (offset + len > writer->offset) {
+        return -EINVAL;
+    }
+
+    while (len) {
+        const uint8_t *src;
+        size_t chunk;
+
+        if (offset < RIOTBOOT_FLASHWRITE_SKIPLEN) {
+            /* the magic number is only written on install */
+            src = (const uint8_t *)_prefix + offset;
+            chunk = RIOTBOOT_FLASHWRITE_SKIPLEN - offset;
+        }
+        else if (offset >= buffered) {
+            src = writer->flashpage_buf + (offset - buffered);
+            chunk = writer->offset - offset;
+        }
+#if CONFIG_RIOTBOOT_FLASHWRITE_RAW
+        else if (offset < RIOTBOOT_FLASHPAGE_BUFFER_SIZE) {
+            src = writer->firstblock_buf + offset;
+            chunk = RIOTBOOT_FLASHPAGE_BUFFER_SIZE - offset;
+        }
+#endif
+        else {
+            src = slot + offset;
+            chunk = buffered - offset;
+        }
+
+        chunk = _min(chunk, len);
+        memcpy(dest, src, chunk);
+        dest += chunk;
+        offset += chunk;
+        len -= chunk;
+    }
+
+    return 0;
+}
+
+static int _target_write(void *dev, uint8_t *src, size_t offset, size_t len)
+{
+    suit_storage_flashwrite_vcdiff_t *fw = dev;
+
+    if (offset + len > fw->img_size) {
+        LOG_ERROR("_target_write(): image exceeds %u bytes\n",
+                  (unsigned)fw->img_size);
+        return -EFBIG;
+    }
+
+    /* the magic number is skipped until install, just like with the
+     * flashwrite backend */
+    if (offset < RIOTBOOT_FLASHWRITE_SKIPLEN) {
+        size_t skip = _min(RIOTBOOT_FLASHWRITE_SKIPLEN - offset, len);
+        offset += skip;
+        src += skip;
+        len -= skip;
+    }
+
+    if (offset != fw->writer.offset) {
+        LOG_ERROR("Unexpected offset: %u - expected: %u\n", (unsigned)offset,
+                  (unsigned)fw->writer.offset);
+        return -EINVAL;
+    }
+
+    return riotboot_flashwrite_putbytes(&fw->writer, src, len, 1);
+}
+
+static int _target_flush(void *dev)
+{
+    suit_storage_flashwrite_vcdiff_t *fw = dev;
+
+    return riotboot_flashwrite_flush(&fw->writer);
+}
+
+static const vcdiff_driver_t _target_driver = {
+    .read = _target_read,
+    .write = _target_write,
+    .flush = _target_flush,
+};
+
+static int _vcdiff_init(suit_storage_t *storage)
+{
+    (void)storage;
+
+    LOG_DEBUG("Storage size %u\n",
+              (unsigned)sizeof(suit_storage_flashwrite_vcdiff_t));
+
+    return 0;
+}
+
+static int _vcdiff_start(suit_storage_t *storage,
+                         const suit_manifest_t *manifest,
+                         size_t len)
+{
+    (void)manifest;
+    suit_storage_flashwrite_vcdiff_t *fw = _get_fw(storage);
+    int target_slot = riotboot_slot_other();
+
+    if (len > riotboot_slot_size(target_slot)) {
+        return SUIT_ERR_STORAGE_EXCEEDED;
+    }
+
+    fw->img_size = len;
+    fw->delta_offset = 0;
+    vcdiff_init(&fw->vcdiff);
+    vcdiff_set_source_driver(&fw->vcdiff, &_source_driver, NULL);
+    vcdiff_set_target_driver(&fw->vcdiff, &_target_driver, fw);
+
+    return riotboot_flashwrite_init(&fw->writer, target_slot);
+}
+
+static int _vcdiff_write(suit_storage_t *storage,
+                         const suit_manifest_t *manifest,
+                         const uint8_t *buf, size_t offset, size_t len)
+{
+    (void)manifest;
+    suit_storage_flashwrite_vcdiff_t *fw = _get_fw(storage);
+
+    if (offset != fw->delta_offset) {
+        LOG_ERROR("Unexpected delta offset: %u - expected: %u\n",
+                  (unsigned)offset, (unsigned)fw->delta_offset);
+        return SUIT_ERR_STORAGE;
+    }
+    fw->delta_offset += len;
+
+    if (vcdiff_apply_delta(&fw->vcdiff, buf, len) != 0) {
+        LOG_ERROR("Applying the delta failed\n");
+        return SUIT_ERR_STORAGE;
+    }
+
+    return SUIT_OK;
+}
+
+static int _vcdiff_finish(suit_storage_t *storage,
+                          const suit_manifest_t *manifest)
+{
+    (void)manifest;
+    suit_storage_flashwrite_vcdiff_t *fw = _get_fw(storage);
+
+    if (vcdiff_finish(&fw->vcdiff) != 0) {
+        return SUIT_ERR_STORAGE;
+    }
+
+    if (fw->writer.offset != fw->img_size) {
+        LOG_INFO("Incorrect image size, got %u, expected %u\n",
+                 (unsigned)fw->writer.offset, (unsigned)fw->img_size);
+        return SUIT_ERR_STORAGE;
+    }
+
+    return SUIT_OK;
+}
+
+static int _vcdiff_install(suit_storage_t *storage,
+                           const suit_manifest_t *manifest)
+{
+    (void)manifest;
+    suit_storage_flashwrite_vcdiff_t *fw = _get_fw(storage);
+
+    return riotboot_flashwrite_finish(&fw->writer);
+}
+
+static int _vcdiff_read(suit_storage_t *storage, uint8_t *buf,
+                        size_t offset, size_t len)
+{
+    suit_storage_flashwrite_vcdiff_t *fw = _get_fw(storage);
+
+    return _target_read(fw, buf, offset, len) ? -1 : 0;
+}
+
+static bool _vcdiff_has_location(const suit_storage_t *storage,
+                                 const char *location)
+{
+    (void)storage;
+
+    return strcmp(location, CONFIG_SUIT_STORAGE_FLASHWRITE_VCDIFF_LOCATION) == 0;
+}
+
+static int _vcdiff_set_active_location(suit_storage_t *storage,
+                                       const char *location)
+{
+    (void)storage;
+    (void)location;
+    return 0;
+}
+
+static bool _vcdiff_match_offset(const suit_storage_t *storage,
+                                 size_t offset)
+{
+    (void)storage;
+
+    int target_slot = riotboot_slot_other();
+    uintptr_t slot_start = (uintptr_t)riotboot_slot_offset(target_slot);
+
+    return (slot_start == (uintptr_t)offset);
+}
+
+static int _vcdiff_get_seq_no(const suit_storage_t *storage, uint32_t *seq_no)
+{
+    (void)storage;
+    (void)seq_no;
+
+    /* the slots are covered by the flashwrite backend */
+    return -1;
+}
+
+static int _vcdiff_set_seq_no(suit_storage_t *storage, uint32_t seq_no)
+{
+    (void)storage;
+    (void)seq_no;
+
+    return SUIT_OK;
+}
+
+static const suit_storage_driver_t suit_storage_flashwrite_vcdiff_driver = {
+    .init = _vcdiff_init,
+    .start = _vcdiff_start,
+    .write = _vcdiff_write,
+    .finish = _vcdiff_finish,
+    .read = _vcdiff_read,
+    .install = _vcdiff_install,
+    .has_location = _vcdiff_has_location,
+    .set_active_location = _vcdiff_set_active_location,
+    .match_offset = _vcdiff_match_offset,
+    .get_seq_no = _vcdiff_get_seq_no,
+    .set_seq_no = _vcdiff_set_seq_no,
+    .separator = '\0',
+    .delta = true,
+};
+
+static suit_storage_flashwrite_vcdiff_t suit_storage_flashwrite_vcdiff = {
+    .storage = {
+        .driver = &suit_storage_flashwrite_vcdiff_driver,
+    },
+};
+
+XFA(suit_storage_reg, 0) suit_storage_t *suit_storage_flashwrite_vcdiff_ptr =
+    &suit_storage_flashwrite_vcdiff.storage;
@@ -20,6 +20,8 @@
  * @}
  */
 
+#ifndef MODULE_TRACE_STREAM
+
 #include <stdio.h>
 
 #include "irq.h"
@@ -68,3 +70,7 @@ void trace_reset(void)
     tracebuf_pos = 0;
     irq_restore(state);
 }
+
+#else
+typedef int dont_be_pedantic;
+#endif /* !MODULE_TRACE_STREAM */
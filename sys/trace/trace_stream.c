@@ -0,0 +1,145 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys
+ * @{
+ *
+ * @file
+ * @brief       Lock-free binary trace stream implementation
+ *
+ * @}
+ */
+
+#ifdef MODULE_TRACE_STREAM
+
+#include "irq.h"
+#include "stdio_base.h"
+#include "trace.h"
+
+#ifndef TRACE_NOW
+#include "ztimer.h"
+#define TRACE_NOW() ztimer_now(ZTIMER_USEC)
+#endif
+
+#if CONFIG_TRACE_STREAM_BUFSIZE & (CONFIG_TRACE_STREAM_BUFSIZE - 1)
+#error "CONFIG_TRACE_STREAM_BUFSIZE must be a power of two"
+#endif
+
+static uint8_t _buf[CONFIG_TRACE_STREAM_BUFSIZE];
+/* free running byte counters, only their difference matters */
+static unsigned _head;      /**< end of the space reserved by writers */
+static unsigned _commit;    /**< end of the data visible to the reader */
+static unsigned _tail;      /**< end of the data consumed by the reader */
+static unsigned _writers;   /**< writers between reservation and publishing */
+static unsigned _dropped;
+
+static unsigned _varint(uint8_t *out, uint32_t val)
+{
+    unsigned len = 0;
+
+    while (val >= 0x80) {
+        out[len++] = (val & 0x7f) | 0x80;
+        val >>= 7;
+    }
+    out[len++] = val;
+
+    return len;
+}
+
+static void _publish(void)
+{
+    /* Writers can only preempt each other, but never run in parallel. So
+     * once the last pending writer is done, all space reserved up to now
+     * has been written to and can be handed to the reader. */
+    if (__atomic_sub_fetch(&_writers, 1, __ATOMIC_ACQ_REL)) {
+        return;
+    }
+
+    unsigned head = __atomic_load_n(&_head, __ATOMIC_RELAXED);
+    unsigned commit = __atomic_load_n(&_commit, __ATOMIC_RELAXED);
+
+    /* a writer preempting us here may already have published more */
+    while (((int)(head - commit) > 0) &&
+           !__atomic_compare_exchange_n(&_commit, &commit, head, false,
+                                        __ATOMIC_RELEASE, __ATOMIC_RELAXED)) {}
+}
+
+void trace(uint32_t val)
+{
+    uint8_t rec[10];
+    unsigned len = _varint(rec, TRACE_NOW());
+
+    len += _varint(&rec[len], val);
+
+    __atomic_fetch_add(&_writers, 1, __ATOMIC_ACQUIRE);
+
+    unsigned head = __atomic_load_n(&_head, __ATOMIC_RELAXED);
+    do {
+        unsigned used = head - __atomic_load_n(&_tail, __ATOMIC_ACQUIRE);
+        if (used + len > CONFIG_TRACE_STREAM_BUFSIZE) {
+            __atomic_fetch_add(&_dropped, 1, __ATOMIC_RELAXED);
+            _publish();
+            return;
+        }
+    } while (!__atomic_compare_exchange_n(&_head, &head, head + len, false,
+                                          __ATOMIC_RELAXED, __ATOMIC_RELAXED));
+
+    for (unsigned i = 0; i < len; i++) {
+        _buf[(head + i) & (CONFIG_TRACE_STREAM_BUFSIZE - 1)] = rec[i];
+    }
+
+    _publish();
+}
+
+size_t trace_stream_read(void *buf, size_t len)
+{
+    uint8_t *out = buf;
+    unsigned tail = __atomic_load_n(&_tail, __ATOMIC_RELAXED);
+    unsigned avail = __atomic_load_n(&_commit, __ATOMIC_ACQUIRE) - tail;
+
+    if (len > avail) {
+        len = avail;
+    }
+    for (size_t i = 0; i < len; i++) {
+        out[i] = _buf[(tail + i) & (CONFIG_TRACE_STREAM_BUFSIZE - 1)];
+    }
+    __atomic_store_n(&_tail, tail + len, __ATOMIC_RELEASE);
+
+    return len;
+}
+
+unsigned trace_stream_dropped(void)
+{
+    return __atomic_load_n(&_dropped, __ATOMIC_RELAXED);
+}
+
+void trace_dump(void)
+{
+    uint8_t chunk[32];
+    size_t len;
+
+    while ((len = trace_stream_read(chunk, sizeof(chunk)))) {
+        stdio_write(chunk, len);
+    }
+}
+
+void trace_reset(void)
+{
+    unsigned state = irq_disable();
+
+    _head = 0;
+    _commit = 0;
+    _tail = 0;
+    _dropped = 0;
+    irq_restore(state);
+}
+
+#else
+typedef int dont_be_pedantic;
+#endif /* MODULE_TRACE_STREAM */
@@ -0,0 +1,80 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_tracepoint
+ * @{
+ *
+ * @file
+ * @brief       Tracepoint implementation
+ *
+ * @}
+ */
+
+#include <string.h>
+
+#include "irq.h"
+#include "tracepoint.h"
+#include "xfa.h"
+
+#if IS_USED(MODULE_TRACE)
+#include "trace.h"
+#endif
+
+XFA_INIT(tracepoint_t, tracepoint_xfa);
+
+void tracepoint_hit(tracepoint_t *tp, uint32_t val)
+{
+    unsigned state = irq_disable();
+
+    tp->hits++;
+    irq_restore(state);
+
+#if IS_USED(MODULE_TRACE)
+    trace(((uint32_t)(tp - tracepoint_xfa) << 24) | (val & 0xffffff));
+#else
+    (void)val;
+#endif
+}
+
+unsigned tracepoint_enable(const char *name, bool enable)
+{
+    unsigned changed = 0;
+
+    for (tracepoint_t *tp = tracepoint_xfa; tp < tracepoint_xfa_end; tp++) {
+        if (!name || !strcmp(tp->name, name)) {
+            tp->enabled = enable;
+            changed++;
+        }
+    }
+
+    return changed;
+}
+
+unsigned tracepoint_numof(void)
+{
+    return XFA_LEN(tracepoint_t, tracepoint_xfa);
+}
+
+const tracepoint_t *tracepoint_get(unsigned idx)
+{
+    if (idx >= XFA_LEN(tracepoint_t, tracepoint_xfa)) {
+        return NULL;
+    }
+    return &tracepoint_xfa[idx];
+}
+
+void tracepoint_reset(void)
+{
+    unsigned state = irq_disable();
+
+    for (tracepoint_t *tp = tracepoint_xfa; tp < tracepoint_xfa_end; tp++) {
+        tp->hits = 0;
+    }
+    irq_restore(state);
+}
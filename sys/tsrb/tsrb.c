@@ -17,6 +17,8 @@
  * @}
  */
 
+#include <string.h>
+
 #include "irq.h"
 #include "tsrb.h"
 
@@ -35,6 +37,48 @@ static uint8_t _peek(tsrb_t *rb, unsigned int idx)
     return rb->buf[(rb->reads + idx) & (rb->size - 1)];
 }
 
+/* splits the len bytes starting at index start at the end of the buffer */
+static size_t _regions(tsrb_t *rb, unsigned int start, size_t len,
+                       tsrb_region_t regions[2])
+{
+    unsigned int idx = start & (rb->size - 1);
+    size_t first = rb->size - idx;
+
+    if (first > len) {
+        first = len;
+    }
+    regions[0].buf = &rb->buf[idx];
+    regions[0].len = first;
+    regions[1].buf = rb->buf;
+    regions[1].len = len - first;
+    return len;
+}
+
+static void _memcpy_to(const tsrb_region_t regions[2], const uint8_t *src,
+                       size_t n)
+{
+    size_t first = (n < regions[0].len) ? n : regions[0].len;
+
+    memcpy(regions[0].buf, src, first);
+    memcpy(regions[1].buf, src + first, n - first);
+}
+
+/* copies up to n bytes from the read position, returns the number copied */
+static size_t _copy_out(tsrb_t *rb, uint8_t *dst, size_t n)
+{
+    tsrb_region_t regions[2];
+    size_t avail = _regions(rb, rb->reads, tsrb_avail(rb), regions);
+
+    if (n > avail) {
+        n = avail;
+    }
+    size_t first = (n < regions[0].len) ? n : regions[0].len;
+
+    memcpy(dst, regions[0].buf, first);
+    memcpy(dst + first, regions[1].buf, n - first);
+    return n;
+}
+
 int tsrb_get_one(tsrb_t *rb)
 {
     int retval = -1;
@@ -59,38 +103,31 @@ int tsrb_peek_one(tsrb_t *rb)
 
 int tsrb_get(tsrb_t *rb, uint8_t *dst, size_t n)
 {
-    size_t tmp = n;
     unsigned irq_state = irq_disable();
-    while (tmp && !tsrb_empty(rb)) {
-        *dst++ = _pop(rb);
-        tmp--;
-    }
+    n = _copy_out(rb, dst, n);
+    rb->reads += n;
     irq_restore(irq_state);
-    return (n - tmp);
+    return n;
 }
 
 int tsrb_peek(tsrb_t *rb, uint8_t *dst, size_t n)
 {
-    size_t idx = 0;
     unsigned irq_state = irq_disable();
-    unsigned int avail = tsrb_avail(rb);
-    while (idx < n && idx != avail) {
-        *dst++ = _peek(rb, idx++);
-    }
+    n = _copy_out(rb, dst, n);
     irq_restore(irq_state);
-    return idx;
+    return n;
 }
 
 int tsrb_drop(tsrb_t *rb, size_t n)
 {
-    size_t tmp = n;
     unsigned irq_state = irq_disable();
-    while (tmp && !tsrb_empty(rb)) {
-        _pop(rb);
-        tmp--;
+    unsigned int avail = tsrb_avail(rb);
+    if (n > avail) {
+        n = avail;
     }
+    rb->reads += n;
     irq_restore(irq_state);
-    return (n - tmp);
+    return n;
 }
 
 int tsrb_add_one(tsrb_t *rb, uint8_t c)
@@ -107,12 +144,47 @@ int tsrb_add_one(tsrb_t *rb, uint8_t c)
 
 int tsrb_add(tsrb_t *rb, const uint8_t *src, size_t n)
 {
-    size_t tmp = n;
+    tsrb_region_t regions[2];
     unsigned irq_state = irq_disable();
-    while (tmp && !tsrb_full(rb)) {
-        _push(rb, *src++);
-        tmp--;
+    size_t space = _regions(rb, rb->writes, tsrb_free(rb), regions);
+
+    if (n > space) {
+        n = space;
     }
+    _memcpy_to(regions, src, n);
+    rb->writes += n;
+    irq_restore(irq_state);
+    return n;
+}
+
+size_t tsrb_get_write_region(tsrb_t *rb, tsrb_region_t regions[2])
+{
+    unsigned irq_state = irq_disable();
+    size_t space = _regions(rb, rb->writes, tsrb_free(rb), regions);
+    irq_restore(irq_state);
+    return space;
+}
+
+void tsrb_commit(tsrb_t *rb, size_t n)
+{
+    unsigned irq_state = irq_disable();
+    assert(n <= tsrb_free(rb));
+    rb->writes += n;
+    irq_restore(irq_state);
+}
+
+size_t tsrb_peek_region(tsrb_t *rb, tsrb_region_t regions[2])
+{
+    unsigned irq_state = irq_disable();
+    size_t avail = _regions(rb, rb->reads, tsrb_avail(rb), regions);
+    irq_restore(irq_state);
+    return avail;
+}
+
+void tsrb_consume(tsrb_t *rb, size_t n)
+{
+    unsigned irq_state = irq_disable();
+    assert(n <= tsrb_avail(rb));
+    rb->reads += n;
     irq_restore(irq_state);
-    return (n - tmp);
 }
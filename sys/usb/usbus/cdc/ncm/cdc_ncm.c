@@ -0,0 +1,525 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup usbus_cdc_ncm
+ * @{
+ * @file USBUS implementation for network control model
+ *
+ * @}
+ */
+
+#define USB_H_USER_IS_RIOT_INTERNAL
+
+#include "event.h"
+#include "fmt.h"
+#include "kernel_defines.h"
+#include "luid.h"
+#include "net/ethernet.h"
+#include "net/eui48.h"
+#include "usb/cdc.h"
+#include "usb/descriptor.h"
+#include "usb/usbus.h"
+#include "usb/usbus/control.h"
+#include "usb/usbus/cdc/ncm.h"
+
+#include <inttypes.h>
+#include <string.h>
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+/**
+ * @brief   Alignment of datagrams and NDPs in both directions
+ */
+#define NCM_ALIGNMENT           4
+
+/**
+ * @brief   bmNetworkCapabilities: SetEthernetPacketFilter is supported
+ */
+#define NCM_CAPS                0x01
+
+static void _event_handler(usbus_t *usbus, usbus_handler_t *handler,
+                          usbus_event_usb_t event);
+static int _control_handler(usbus_t *usbus, usbus_handler_t *handler,
+                            usbus_control_request_state_t state,
+                            usb_setup_t *setup);
+static void _transfer_handler(usbus_t *usbus, usbus_handler_t *handler,
+                              usbdev_ep_t *ep, usbus_event_transfer_t event);
+static void _init(usbus_t *usbus, usbus_handler_t *handler);
+static void _handle_rx_ready(event_t *ev);
+static void _handle_tx_xmit(event_t *ev);
+
+static size_t _gen_full_ncm_descriptor(usbus_t *usbus, void *arg);
+
+static const usbus_descr_gen_funcs_t _ncm_descriptor = {
+    .fmt_post_descriptor = _gen_full_ncm_descriptor,
+    .len = {
+        .fixed_len = sizeof(usb_desc_cdc_t) +
+                     sizeof(usb_desc_union_t) +
+                     sizeof(usb_desc_ecm_t) +
+                     sizeof(usb_desc_ncm_t),
+    },
+    .len_type = USBUS_DESCR_LEN_FIXED,
+};
+
+static size_t _gen_union_descriptor(usbus_t *usbus, usbus_cdcncm_device_t *cdcncm)
+{
+    usb_desc_union_t uni;
+
+    /* functional union descriptor */
+    uni.length = sizeof(usb_desc_union_t);
+    uni.type = USB_TYPE_DESCRIPTOR_CDC;
+    uni.subtype = USB_CDC_DESCR_SUBTYPE_UNION;
+    uni.master_if = cdcncm->iface_ctrl.idx;
+    uni.slave_if = cdcncm->iface_data.idx;
+    usbus_control_slicer_put_bytes(usbus, (uint8_t *)&uni, sizeof(uni));
+    return sizeof(usb_desc_union_t);
+}
+
+static size_t _gen_ecm_descriptor(usbus_t *usbus, usbus_cdcncm_device_t *cdcncm)
+{
+    usb_desc_ecm_t ecm;
+
+    /* functional ethernet networking descriptor */
+    ecm.length = sizeof(usb_desc_ecm_t);
+    ecm.type = USB_TYPE_DESCRIPTOR_CDC;
+    ecm.subtype = USB_CDC_DESCR_SUBTYPE_ETH_NET;
+    ecm.macaddress = cdcncm->mac_str.idx;
+    ecm.ethernetstatistics = 0;
+    ecm.maxsegmentsize = ETHERNET_FRAME_LEN;
+    ecm.numbermcfilters = 0x0000; /* No filtering */
+    ecm.numberpowerfilters = 0;
+    usbus_control_slicer_put_bytes(usbus, (uint8_t *)&ecm, sizeof(ecm));
+    return sizeof(usb_desc_ecm_t);
+}
+
+static size_t _gen_ncm_descriptor(usbus_t *usbus)
+{
+    usb_desc_ncm_t ncm;
+
+    /* functional cdc ncm descriptor */
+    ncm.length = sizeof(usb_desc_ncm_t);
+    ncm.type = USB_TYPE_DESCRIPTOR_CDC;
+    ncm.subtype = USB_CDC_DESCR_SUBTYPE_NCM;
+    ncm.bcd_ncm = 0x0100;
+    ncm.capabilities = NCM_CAPS;
+    usbus_control_slicer_put_bytes(usbus, (uint8_t *)&ncm, sizeof(ncm));
+    return sizeof(usb_desc_ncm_t);
+}
+
+static size_t _gen_cdc_descriptor(usbus_t *usbus)
+{
+    usb_desc_cdc_t cdc;
+    /* functional cdc descriptor */
+    cdc.length = sizeof(usb_desc_cdc_t);
+    cdc.bcd_cdc = USB_CDC_VERSION_BCD;
+    cdc.type = USB_TYPE_DESCRIPTOR_CDC;
+    cdc.subtype = 0x00;
+    usbus_control_slicer_put_bytes(usbus, (uint8_t *)&cdc, sizeof(cdc));
+    return sizeof(usb_desc_cdc_t);
+}
+
+static size_t _gen_full_ncm_descriptor(usbus_t *usbus, void *arg)
+{
+    usbus_cdcncm_device_t *cdcncm = (usbus_cdcncm_device_t *)arg;
+    size_t total_size = 0;
+
+    total_size += _gen_cdc_descriptor(usbus);
+    total_size += _gen_union_descriptor(usbus, cdcncm);
+    total_size += _gen_ecm_descriptor(usbus, cdcncm);
+    total_size += _gen_ncm_descriptor(usbus);
+    return total_size;
+}
+
+static void _notify_link_speed(usbus_cdcncm_device_t *cdcncm)
+{
+    DEBUG("CDC NCM: sending link speed indication\n");
+    usb_desc_cdcecm_speed_t *notification =
+        (usb_desc_cdcecm_speed_t *)cdcncm->control_in;
+    notification->setup.type = USB_SETUP_REQUEST_DEVICE2HOST |
+                               USB_SETUP_REQUEST_TYPE_CLASS |
+                               USB_SETUP_REQUEST_RECIPIENT_INTERFACE;
+    notification->setup.request = USB_CDC_MGNT_NOTIF_CONN_SPEED_CHANGE;
+    notification->setup.value = 0;
+    notification->setup.index = cdcncm->iface_ctrl.idx;
+    notification->setup.length = 8;
+
+    notification->down = CONFIG_USBUS_CDC_NCM_CONFIG_SPEED;
+    notification->up = CONFIG_USBUS_CDC_NCM_CONFIG_SPEED;
+    usbdev_ep_xmit(cdcncm->ep_ctrl->ep, cdcncm->control_in,
+                   sizeof(usb_desc_cdcecm_speed_t));
+    cdcncm->notif = USBUS_CDCNCM_NOTIF_SPEED;
+}
+
+static void _notify_link_up(usbus_cdcncm_device_t *cdcncm)
+{
+    DEBUG("CDC NCM: sending link up indication\n");
+    usb_setup_t *notification = (usb_setup_t *)cdcncm->control_in;
+    notification->type = USB_SETUP_REQUEST_DEVICE2HOST |
+                         USB_SETUP_REQUEST_TYPE_CLASS |
+                         USB_SETUP_REQUEST_RECIPIENT_INTERFACE;
+    notification->request = USB_CDC_MGNT_NOTIF_NETWORK_CONNECTION;
+    notification->value = 1;
+    notification->index = cdcncm->iface_ctrl.idx;
+    notification->length = 0;
+    usbdev_ep_xmit(cdcncm->ep_ctrl->ep, cdcncm->control_in, sizeof(usb_setup_t));
+    cdcncm->notif = USBUS_CDCNCM_NOTIF_LINK_UP;
+}
+
+static const usbus_handler_driver_t cdcncm_driver = {
+    .init = _init,
+    .event_handler = _event_handler,
+    .transfer_handler = _transfer_handler,
+    .control_handler = _control_handler,
+};
+
+static void _fill_ethernet(usbus_cdcncm_device_t *cdcncm)
+{
+    uint8_t ethernet[ETHERNET_ADDR_LEN];
+
+    luid_get_eui48((eui48_t*)ethernet);
+    fmt_bytes_hex(cdcncm->mac_host, ethernet, sizeof(ethernet));
+}
+
+void usbus_cdcncm_init(usbus_t *usbus, usbus_cdcncm_device_t *handler)
+{
+    assert(usbus);
+    assert(handler);
+    memset(handler, 0, sizeof(usbus_cdcncm_device_t));
+    mutex_init(&handler->tx_busy);
+    _fill_ethernet(handler);
+    handler->usbus = usbus;
+    handler->ntb_in_max = CONFIG_USBUS_CDC_NCM_NTB_SIZE;
+    handler->tx[0].len = USBUS_CDCNCM_TX_HEADER_LEN;
+    handler->tx[1].len = USBUS_CDCNCM_TX_HEADER_LEN;
+    handler->handler_ctrl.driver = &cdcncm_driver;
+    usbus_register_event_handler(usbus, (usbus_handler_t *)handler);
+}
+
+static void _init(usbus_t *usbus, usbus_handler_t *handler)
+{
+    DEBUG("CDC NCM: initialization\n");
+    usbus_cdcncm_device_t *cdcncm = (usbus_cdcncm_device_t *)handler;
+
+    /* Add event handlers */
+    cdcncm->tx_xmit.handler = _handle_tx_xmit;
+    cdcncm->rx_ready.handler = _handle_rx_ready;
+
+    /* Set up descriptor generators */
+    cdcncm->ncm_descr.next = NULL;
+    cdcncm->ncm_descr.funcs = &_ncm_descriptor;
+    cdcncm->ncm_descr.arg = cdcncm;
+
+    /* Configure Interface 0 as control interface */
+    cdcncm->iface_ctrl.class = USB_CLASS_CDC_CONTROL;
+    cdcncm->iface_ctrl.subclass = USB_CDC_SUBCLASS_NCM;
+    cdcncm->iface_ctrl.protocol = USB_CDC_PROTOCOL_NONE;
+    cdcncm->iface_ctrl.descr_gen = &cdcncm->ncm_descr;
+    cdcncm->iface_ctrl.handler = handler;
+
+    /* Configure second interface to handle data endpoint, the alternative
+     * setting inherits class and protocol */
+    cdcncm->iface_data.class = USB_CLASS_CDC_DATA;
+    cdcncm->iface_data.subclass = USB_CDC_SUBCLASS_NONE;
+    cdcncm->iface_data.protocol = USB_CDC_PROTOCOL_NCM_NTB;
+    cdcncm->iface_data.descr_gen = NULL;
+    cdcncm->iface_data.handler = handler;
+
+    /* Add string descriptor for the host mac */
+    usbus_add_string_descriptor(usbus, &cdcncm->mac_str, cdcncm->mac_host);
+
+    /* Create required endpoints */
+    cdcncm->ep_ctrl = usbus_add_endpoint(usbus, &cdcncm->iface_ctrl,
+                                         USB_EP_TYPE_INTERRUPT,
+                                         USB_EP_DIR_IN,
+                                         USBUS_CDCNCM_EP_CTRL_SIZE);
+    cdcncm->ep_ctrl->interval = 0x10;
+
+    cdcncm->ep_out = usbus_add_endpoint(usbus,
+                                        (usbus_interface_t *)&cdcncm->iface_data_alt,
+                                        USB_EP_TYPE_BULK,
+                                        USB_EP_DIR_OUT,
+                                        USBUS_CDCNCM_EP_DATA_SIZE);
+    cdcncm->ep_out->interval = 0; /* Must be 0 for bulk endpoints */
+    cdcncm->ep_in = usbus_add_endpoint(usbus,
+                                       (usbus_interface_t *)&cdcncm->iface_data_alt,
+                                       USB_EP_TYPE_BULK,
+                                       USB_EP_DIR_IN,
+                                       USBUS_CDCNCM_EP_DATA_SIZE);
+    cdcncm->ep_in->interval = 0; /* Must be 0 for bulk endpoints */
+
+    /* Keep the next packet of an NTB queued if the peripheral supports it */
+    static const usbopt_enable_t enable = USBOPT_ENABLE;
+    cdcncm->tx_depth = (usbdev_ep_set(cdcncm->ep_in->ep, USBOPT_EP_DOUBLE_BUFFER,
+                                      &enable, sizeof(enable)) > 0) ? 2 : 1;
+
+    /* Add interfaces to the stack */
+    usbus_add_interface(usbus, &cdcncm->iface_ctrl);
+    usbus_add_interface(usbus, &cdcncm->iface_data);
+
+    usbus_add_interface_alt(&cdcncm->iface_data, &cdcncm->iface_data_alt);
+
+    usbus_enable_endpoint(cdcncm->ep_out);
+    usbus_enable_endpoint(cdcncm->ep_in);
+    usbus_enable_endpoint(cdcncm->ep_ctrl);
+    usbus_handler_set_flag(handler, USBUS_HANDLER_FLAG_RESET);
+}
+
+/* Start receiving the next NTB if its buffer is released by netdev */
+static void _rx_start(usbus_cdcncm_device_t *cdcncm)
+{
+    usbus_cdcncm_rx_ntb_t *ntb = &cdcncm->rx[cdcncm->rx_usb];
+
+    if (ntb->state != USBUS_CDCNCM_RX_EMPTY) {
+        DEBUG("CDC NCM: no free NTB buffer, stalling reception\n");
+        cdcncm->rx_stalled = true;
+        return;
+    }
+    cdcncm->rx_stalled = false;
+    ntb->len = 0;
+    ntb->state = USBUS_CDCNCM_RX_RECEIVING;
+    usbdev_ep_xmit(cdcncm->ep_out->ep, ntb->data, USBUS_CDCNCM_EP_DATA_SIZE);
+}
+
+static void _handle_rx_ready(event_t *ev)
+{
+    usbus_cdcncm_device_t *cdcncm = container_of(ev, usbus_cdcncm_device_t,
+                                                 rx_ready);
+
+    if (cdcncm->rx_stalled && cdcncm->active_iface == 1) {
+        _rx_start(cdcncm);
+    }
+}
+
+static void _handle_rx(usbus_cdcncm_device_t *cdcncm, usbdev_ep_t *ep)
+{
+    usbus_cdcncm_rx_ntb_t *ntb = &cdcncm->rx[cdcncm->rx_usb];
+    size_t len = 0;
+
+    usbdev_ep_get(ep, USBOPT_EP_AVAILABLE, &len, sizeof(size_t));
+    ntb->len += len;
+    if ((len == USBUS_CDCNCM_EP_DATA_SIZE) &&
+        (ntb->len + USBUS_CDCNCM_EP_DATA_SIZE <= CONFIG_USBUS_CDC_NCM_NTB_SIZE)) {
+        /* ready next chunk */
+        usbdev_ep_xmit(ep, ntb->data + ntb->len, USBUS_CDCNCM_EP_DATA_SIZE);
+        return;
+    }
+    /* short packet or the maximum NTB size terminates the transfer */
+    DEBUG("CDC NCM: received NTB of %u bytes\n", (unsigned)ntb->len);
+    ntb->state = USBUS_CDCNCM_RX_FULL;
+    netdev_trigger_event_isr(&cdcncm->netdev);
+    cdcncm->rx_usb ^= 1;
+    _rx_start(cdcncm);
+}
+
+static void _tx_done(usbus_cdcncm_device_t *cdcncm)
+{
+    mutex_unlock(&cdcncm->tx_busy);
+    /* let netdev send the frames queued in the meantime */
+    netdev_trigger_event_isr(&cdcncm->netdev);
+}
+
+static void _tx_continue(usbus_cdcncm_device_t *cdcncm)
+{
+    /* the other buffer is filled by netdev */
+    usbus_cdcncm_tx_ntb_t *ntb = &cdcncm->tx[cdcncm->tx_fill ^ 1];
+    size_t maxpacketsize = cdcncm->ep_in->maxpacketsize;
+
+    while (cdcncm->tx_pending < cdcncm->tx_depth) {
+        size_t remain = ntb->len - cdcncm->tx_offset;
+
+        if (remain) {
+            size_t len = remain < maxpacketsize ? remain : maxpacketsize;
+            usbdev_ep_xmit(cdcncm->ep_in->ep, ntb->data + cdcncm->tx_offset,
+                           len);
+            cdcncm->tx_offset += len;
+        }
+        else if (!cdcncm->tx_zlp && ((ntb->len % maxpacketsize) == 0) &&
+                 (ntb->len < cdcncm->ntb_in_max)) {
+            DEBUG("CDC NCM: Zero length USB packet required\n");
+            cdcncm->tx_zlp = true;
+            usbdev_ep_xmit(cdcncm->ep_in->ep, ntb->data, 0);
+        }
+        else {
+            break;
+        }
+        cdcncm->tx_pending++;
+    }
+    if (cdcncm->tx_pending == 0) {
+        _tx_done(cdcncm);
+    }
+}
+
+static void _handle_tx_xmit(event_t *ev)
+{
+    usbus_cdcncm_device_t *cdcncm = container_of(ev, usbus_cdcncm_device_t,
+                                                 tx_xmit);
+    usbus_t *usbus = cdcncm->usbus;
+
+    DEBUG("CDC NCM: Handling TX xmit from netdev\n");
+    if (usbus->state != USBUS_STATE_CONFIGURED || cdcncm->active_iface == 0) {
+        DEBUG("CDC NCM: not configured, dropping NTB\n");
+        _tx_done(cdcncm);
+        return;
+    }
+    cdcncm->tx_offset = 0;
+    cdcncm->tx_zlp = false;
+    cdcncm->tx_pending = 0;
+    _tx_continue(cdcncm);
+}
+
+static void _put_ntb_params(usbus_t *usbus)
+{
+    usb_cdc_ncm_ntb_params_t params = {
+        .length = sizeof(usb_cdc_ncm_ntb_params_t),
+        .formats = USB_CDC_NCM_NTB16_FORMAT,
+        .in_max_size = CONFIG_USBUS_CDC_NCM_NTB_SIZE,
+        .in_divisor = NCM_ALIGNMENT,
+        .in_alignment = NCM_ALIGNMENT,
+        .out_max_size = CONFIG_USBUS_CDC_NCM_NTB_SIZE,
+        .out_divisor = NCM_ALIGNMENT,
+        .out_alignment = NCM_ALIGNMENT,
+    };
+
+    usbus_control_slicer_put_bytes(usbus, (uint8_t *)&params, sizeof(params));
+}
+
+static int _set_ntb_input_size(usbus_t *usbus, usbus_cdcncm_device_t *cdcncm)
+{
+    size_t len = 0;
+    uint8_t *data = usbus_control_get_out_data(usbus, &len);
+    uint32_t size;
+
+    if (len < sizeof(size)) {
+        return -1;
+    }
+    memcpy(&size, data, sizeof(size));
+    if (size < USBUS_CDCNCM_TX_HEADER_LEN + ETHERNET_FRAME_LEN) {
+        DEBUG("CDC NCM: rejecting NTB input size %" PRIu32 "\n", size);
+        return -1;
+    }
+    cdcncm->ntb_in_max = (size < CONFIG_USBUS_CDC_NCM_NTB_SIZE)
+                         ? size : CONFIG_USBUS_CDC_NCM_NTB_SIZE;
+    DEBUG("CDC NCM: NTB input size %" PRIu32 "\n", cdcncm->ntb_in_max);
+    return 1;
+}
+
+static int _control_handler(usbus_t *usbus, usbus_handler_t *handler,
+                          usbus_control_request_state_t state,
+                          usb_setup_t *setup)
+{
+    usbus_cdcncm_device_t *cdcncm = (usbus_cdcncm_device_t *)handler;
+    DEBUG("CDC NCM: Request: 0x%x\n", setup->request);
+    switch (setup->request) {
+        case USB_SETUP_REQ_SET_INTERFACE:
+            DEBUG("CDC NCM: Changing active interface to alt %d\n",
+                  setup->value);
+            cdcncm->active_iface = (uint8_t)setup->value;
+            if (cdcncm->active_iface == 1) {
+                _rx_start(cdcncm);
+                _notify_link_up(cdcncm);
+            }
+            break;
+
+        case USB_CDC_MGNT_REQUEST_GET_NTB_PARAMETERS:
+            _put_ntb_params(usbus);
+            break;
+
+        case USB_CDC_MGNT_REQUEST_GET_NTB_FORMAT:
+        {
+            uint16_t format = 0; /* NTB16 */
+            usbus_control_slicer_put_bytes(usbus, (uint8_t *)&format,
+                                           sizeof(format));
+            break;
+        }
+
+        case USB_CDC_MGNT_REQUEST_SET_NTB_FORMAT:
+            /* only NTB16 is supported */
+            if (setup->value != 0) {
+                return -1;
+            }
+            break;
+
+        case USB_CDC_MGNT_REQUEST_GET_NTB_INPUT_SIZE:
+            usbus_control_slicer_put_bytes(usbus, (uint8_t *)&cdcncm->ntb_in_max,
+                                           sizeof(cdcncm->ntb_in_max));
+            break;
+
+        case USB_CDC_MGNT_REQUEST_SET_NTB_INPUT_SIZE:
+            if (state == USBUS_CONTROL_REQUEST_STATE_OUTDATA) {
+                return _set_ntb_input_size(usbus, cdcncm);
+            }
+            break;
+
+        case USB_CDC_MGNT_REQUEST_SET_ETH_PACKET_FILTER:
+            /* While we do answer the request, CDC NCM filters are not really
+             * implemented */
+            DEBUG("CDC NCM: Not modifying filter to 0x%x\n", setup->value);
+            break;
+
+        default:
+            return -1;
+    }
+
+    return 1;
+}
+
+static void _transfer_handler(usbus_t *usbus, usbus_handler_t *handler,
+                             usbdev_ep_t *ep, usbus_event_transfer_t event)
+{
+    (void)event; /* Only receives TR_COMPLETE events */
+    (void)usbus;
+    usbus_cdcncm_device_t *cdcncm = (usbus_cdcncm_device_t *)handler;
+    if (ep == cdcncm->ep_out->ep) {
+        if (cdcncm->notif == USBUS_CDCNCM_NOTIF_NONE) {
+            _notify_link_up(cdcncm);
+        }
+        _handle_rx(cdcncm, ep);
+    }
+    else if (ep == cdcncm->ep_in->ep) {
+        cdcncm->tx_pending--;
+        _tx_continue(cdcncm);
+    }
+    else if (ep == cdcncm->ep_ctrl->ep &&
+             cdcncm->notif == USBUS_CDCNCM_NOTIF_LINK_UP) {
+        _notify_link_speed(cdcncm);
+    }
+}
+
+static void _handle_reset(usbus_t *usbus, usbus_handler_t *handler)
+{
+    (void)usbus;
+    usbus_cdcncm_device_t *cdcncm = (usbus_cdcncm_device_t *)handler;
+
+    DEBUG("CDC NCM: Reset\n");
+    cdcncm->notif = USBUS_CDCNCM_NOTIF_NONE;
+    cdcncm->active_iface = 0;
+    cdcncm->ntb_in_max = CONFIG_USBUS_CDC_NCM_NTB_SIZE;
+    /* Flush a partially received NTB, complete ones are still processed by
+     * netdev and released afterwards */
+    if (cdcncm->rx[cdcncm->rx_usb].state == USBUS_CDCNCM_RX_RECEIVING) {
+        cdcncm->rx[cdcncm->rx_usb].state = USBUS_CDCNCM_RX_EMPTY;
+    }
+    cdcncm->rx_stalled = false;
+    mutex_unlock(&cdcncm->tx_busy);
+}
+
+static void _event_handler(usbus_t *usbus, usbus_handler_t *handler,
+                          usbus_event_usb_t event)
+{
+    switch (event) {
+        case USBUS_EVENT_USB_RESET:
+            _handle_reset(usbus, handler);
+            break;
+
+        default:
+            DEBUG("Unhandled event :0x%x\n", event);
+            break;
+    }
+}
@@ -0,0 +1,294 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup usbus_cdc_ncm
+ * @{
+ * @file Netdev implementation for network control model
+ *
+ * Frames are copied exactly once in each direction: from the iolist into the
+ * NTB sent to the host, and from the NTB received from the host into the
+ * buffer passed to @ref netdev_driver_t::recv.
+ *
+ * @}
+ */
+
+#define USB_H_USER_IS_RIOT_INTERNAL
+
+#include <assert.h>
+#include <errno.h>
+#include <string.h>
+
+#include "kernel_defines.h"
+#include "iolist.h"
+#include "mutex.h"
+#include "net/ethernet.h"
+#include "net/eui_provider.h"
+#include "net/netdev.h"
+#include "net/netdev/eth.h"
+#include "usb/cdc.h"
+#include "usb/usbus/cdc/ncm.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+/**
+ * @brief   Alignment of datagrams in NTBs sent to the host
+ */
+#define TX_ALIGNMENT    4
+
+static const netdev_driver_t netdev_driver_cdcncm;
+
+static usbus_cdcncm_device_t *_netdev_to_cdcncm(netdev_t *netdev)
+{
+    return container_of(netdev, usbus_cdcncm_device_t, netdev);
+}
+
+void cdcncm_netdev_setup(usbus_cdcncm_device_t *cdcncm)
+{
+    cdcncm->netdev.driver = &netdev_driver_cdcncm;
+    netdev_register(&cdcncm->netdev, NETDEV_CDC_NCM, 0);
+}
+
+static usb_cdc_ncm_dpe16_t *_tx_dpe(usbus_cdcncm_tx_ntb_t *ntb)
+{
+    return (usb_cdc_ncm_dpe16_t *)(ntb->data + sizeof(usb_cdc_ncm_nth16_t) +
+                                   sizeof(usb_cdc_ncm_ndp16_t));
+}
+
+static size_t _tx_datagram_offset(const usbus_cdcncm_tx_ntb_t *ntb)
+{
+    return (ntb->len + TX_ALIGNMENT - 1) & ~(TX_ALIGNMENT - 1);
+}
+
+static bool _tx_fits(const usbus_cdcncm_device_t *cdcncm,
+                     const usbus_cdcncm_tx_ntb_t *ntb, size_t len)
+{
+    return (ntb->datagrams < CONFIG_USBUS_CDC_NCM_TX_DATAGRAMS) &&
+           (_tx_datagram_offset(ntb) + len <= cdcncm->ntb_in_max);
+}
+
+/* Finalizes the NTB being filled and hands it to USBUS
+ * @pre tx_busy is locked by the caller */
+static void _tx_flush(usbus_cdcncm_device_t *cdcncm)
+{
+    usbus_cdcncm_tx_ntb_t *ntb = &cdcncm->tx[cdcncm->tx_fill];
+    usb_cdc_ncm_nth16_t *nth = (usb_cdc_ncm_nth16_t *)ntb->data;
+    usb_cdc_ncm_ndp16_t *ndp = (usb_cdc_ncm_ndp16_t *)(nth + 1);
+    usb_cdc_ncm_dpe16_t *dpe = _tx_dpe(ntb);
+
+    nth->signature = USB_CDC_NCM_NTH16_SIGNATURE;
+    nth->length = sizeof(usb_cdc_ncm_nth16_t);
+    nth->sequence = cdcncm->tx_seq++;
+    nth->block_length = ntb->len;
+    nth->ndp_index = sizeof(usb_cdc_ncm_nth16_t);
+
+    ndp->signature = USB_CDC_NCM_NDP16_SIGNATURE;
+    ndp->length = sizeof(usb_cdc_ncm_ndp16_t) +
+                  (ntb->datagrams + 1) * sizeof(usb_cdc_ncm_dpe16_t);
+    ndp->next_ndp_index = 0;
+
+    /* terminating entry */
+    dpe[ntb->datagrams].index = 0;
+    dpe[ntb->datagrams].length = 0;
+
+    DEBUG("CDC NCM netdev: sending NTB with %u frames, %u bytes\n",
+          ntb->datagrams, (unsigned)ntb->len);
+
+    /* continue with the other buffer */
+    cdcncm->tx_fill ^= 1;
+    cdcncm->tx[cdcncm->tx_fill].len = USBUS_CDCNCM_TX_HEADER_LEN;
+    cdcncm->tx[cdcncm->tx_fill].datagrams = 0;
+    usbus_event_post(cdcncm->usbus, &cdcncm->tx_xmit);
+}
+
+static int _send(netdev_t *netdev, const iolist_t *iolist)
+{
+    assert(iolist);
+    usbus_cdcncm_device_t *cdcncm = _netdev_to_cdcncm(netdev);
+    size_t len = iolist_size(iolist);
+
+    /* interface with alternative function ID 1 is the interface containing the
+     * data endpoints, no sense trying to transmit data if it is not active */
+    if (cdcncm->active_iface != 1) {
+        return -ENOTCONN;
+    }
+    if (len > ETHERNET_FRAME_LEN) {
+        return -EMSGSIZE;
+    }
+
+    usbus_cdcncm_tx_ntb_t *ntb = &cdcncm->tx[cdcncm->tx_fill];
+    if (!_tx_fits(cdcncm, ntb, len)) {
+        /* NTB is full, send it as soon as the previous one is out */
+        mutex_lock(&cdcncm->tx_busy);
+        _tx_flush(cdcncm);
+        ntb = &cdcncm->tx[cdcncm->tx_fill];
+    }
+
+    size_t offset = _tx_datagram_offset(ntb);
+    usb_cdc_ncm_dpe16_t *dpe = &_tx_dpe(ntb)[ntb->datagrams++];
+    dpe->index = offset;
+    dpe->length = len;
+    DEBUG("CDC NCM netdev: adding %u bytes at %u\n", (unsigned)len,
+          (unsigned)offset);
+    for (; iolist; iolist = iolist->iol_next) {
+        memcpy(ntb->data + offset, iolist->iol_base, iolist->iol_len);
+        offset += iolist->iol_len;
+    }
+    ntb->len = offset;
+
+    /* send right away if USB is idle, otherwise frames are collected until the
+     * NTB in flight is out */
+    if (mutex_trylock(&cdcncm->tx_busy)) {
+        _tx_flush(cdcncm);
+    }
+    return len;
+}
+
+/* Passes all datagrams of a received NTB to the network stack */
+static void _rx_ntb(usbus_cdcncm_device_t *cdcncm,
+                    const usbus_cdcncm_rx_ntb_t *ntb)
+{
+    const usb_cdc_ncm_nth16_t *nth = (const usb_cdc_ncm_nth16_t *)ntb->data;
+
+    if ((ntb->len < sizeof(*nth)) ||
+        (nth->signature != USB_CDC_NCM_NTH16_SIGNATURE) ||
+        (nth->block_length > ntb->len)) {
+        DEBUG("CDC NCM netdev: invalid NTB header\n");
+        return;
+    }
+
+    size_t len = nth->block_length;
+    uint16_t ndp_index = nth->ndp_index;
+    /* every NDP occupies its own space, this bounds malformed chains */
+    unsigned ndps_left = len / sizeof(usb_cdc_ncm_ndp16_t);
+
+    while (ndp_index && ndps_left--) {
+        const usb_cdc_ncm_ndp16_t *ndp =
+            (const usb_cdc_ncm_ndp16_t *)(ntb->data + ndp_index);
+
+        if ((ndp_index % sizeof(uint32_t)) ||
+            (ndp_index + sizeof(*ndp) > len) ||
+            (ndp->signature != USB_CDC_NCM_NDP16_SIGNATURE) ||
+            (ndp->length < sizeof(*ndp)) ||
+            (ndp_index + ndp->length > len)) {
+            DEBUG("CDC NCM netdev: invalid NDP at %u\n", ndp_index);
+            return;
+        }
+
+        const usb_cdc_ncm_dpe16_t *dpe = (const usb_cdc_ncm_dpe16_t *)(ndp + 1);
+        unsigned entries = (ndp->length - sizeof(*ndp)) / sizeof(*dpe);
+
+        for (unsigned i = 0; i < entries; i++) {
+            if ((dpe[i].index == 0) || (dpe[i].length == 0)) {
+                break;
+            }
+            if (dpe[i].index + dpe[i].length > len) {
+                DEBUG("CDC NCM netdev: datagram out of bounds\n");
+                continue;
+            }
+            cdcncm->rx_index = dpe[i].index;
+            cdcncm->rx_len = dpe[i].length;
+            cdcncm->netdev.event_callback(&cdcncm->netdev,
+                                          NETDEV_EVENT_RX_COMPLETE);
+        }
+        ndp_index = ndp->next_ndp_index;
+    }
+}
+
+static int _recv(netdev_t *netdev, void *buf, size_t max_len, void *info)
+{
+    (void)info;
+    usbus_cdcncm_device_t *cdcncm = _netdev_to_cdcncm(netdev);
+    const usbus_cdcncm_rx_ntb_t *ntb = &cdcncm->rx[cdcncm->rx_net];
+    size_t pktlen = cdcncm->rx_len;
+
+    if (buf == NULL) {
+        /* size request or drop, the next datagram is selected by _isr */
+        return pktlen;
+    }
+    if (pktlen > max_len) {
+        return -ENOBUFS;
+    }
+    /* Copy the received data from the host to the netif buffer */
+    memcpy(buf, ntb->data + cdcncm->rx_index, pktlen);
+    return pktlen;
+}
+
+static int _init(netdev_t *netdev)
+{
+    usbus_cdcncm_device_t *cdcncm = _netdev_to_cdcncm(netdev);
+
+    netdev_eui48_get(netdev, (eui48_t*)&cdcncm->mac_netdev);
+
+    /* signal link UP */
+    netdev->event_callback(netdev, NETDEV_EVENT_LINK_UP);
+
+    return 0;
+}
+
+static int _get(netdev_t *netdev, netopt_t opt, void *value, size_t max_len)
+{
+    usbus_cdcncm_device_t *cdcncm = _netdev_to_cdcncm(netdev);
+
+    (void)max_len;
+
+    switch (opt) {
+        case NETOPT_ADDRESS:
+            assert(max_len >= ETHERNET_ADDR_LEN);
+            memcpy(value, cdcncm->mac_netdev, ETHERNET_ADDR_LEN);
+            return ETHERNET_ADDR_LEN;
+        default:
+            return netdev_eth_get(netdev, opt, value, max_len);
+    }
+}
+
+static int _set(netdev_t *netdev, netopt_t opt, const void *value,
+                size_t value_len)
+{
+    usbus_cdcncm_device_t *cdcncm = _netdev_to_cdcncm(netdev);
+
+    switch (opt) {
+        case NETOPT_ADDRESS:
+            assert(value_len == ETHERNET_ADDR_LEN);
+            memcpy(cdcncm->mac_netdev, value, ETHERNET_ADDR_LEN);
+            return ETHERNET_ADDR_LEN;
+        default:
+            return netdev_eth_set(netdev, opt, value, value_len);
+    }
+}
+
+static void _isr(netdev_t *dev)
+{
+    usbus_cdcncm_device_t *cdcncm = _netdev_to_cdcncm(dev);
+    usbus_cdcncm_rx_ntb_t *ntb = &cdcncm->rx[cdcncm->rx_net];
+
+    while (ntb->state == USBUS_CDCNCM_RX_FULL) {
+        _rx_ntb(cdcncm, ntb);
+        /* release the buffer to USBUS */
+        ntb->state = USBUS_CDCNCM_RX_EMPTY;
+        usbus_event_post(cdcncm->usbus, &cdcncm->rx_ready);
+        cdcncm->rx_net ^= 1;
+        ntb = &cdcncm->rx[cdcncm->rx_net];
+    }
+
+    /* send the frames collected while the previous NTB was in flight */
+    if (cdcncm->tx[cdcncm->tx_fill].datagrams &&
+        mutex_trylock(&cdcncm->tx_busy)) {
+        _tx_flush(cdcncm);
+    }
+}
+
+static const netdev_driver_t netdev_driver_cdcncm = {
+    .send = _send,
+    .recv = _recv,
+    .init = _init,
+    .isr = _isr,
+    .get = _get,
+    .set = _set,
+};
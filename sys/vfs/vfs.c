@@ -14,6 +14,7 @@
  * @author  Joakim Nohlgård <joakim.nohlgard@eistec.se>
  */
 
+#include <assert.h> /* for static_assert */
 #include <errno.h> /* for error codes */
 #include <string.h> /* for strncmp */
 #include <stddef.h> /* for NULL */
@@ -24,6 +25,8 @@
 #include <unistd.h> /* for STDIN_FILENO, STDOUT_FILENO, STDERR_FILENO */
 
 #include "vfs.h"
+#include "bitarithm.h"
+#include "irq.h"
 #include "mutex.h"
 #include "thread.h"
 #include "sched.h"
@@ -61,6 +64,33 @@ XFA_INIT(vfs_mount_t, vfs_mountpoints_xfa);
  */
 static vfs_file_t _vfs_open_files[VFS_MAX_OPEN_FILES];
 
+/**
+ * @internal
+ * @brief Number of bits in a word of the _vfs_fds_used bitmap
+ */
+#define FDS_WORD_BITS   (sizeof(unsigned) * 8)
+
+/**
+ * @internal
+ * @brief Bitmap of the entries in use in the _vfs_open_files array
+ *
+ * This allows to find a free file descriptor without scanning the whole
+ * _vfs_open_files array.
+ */
+static unsigned _vfs_fds_used[(VFS_MAX_OPEN_FILES + FDS_WORD_BITS - 1) / FDS_WORD_BITS];
+
+/**
+ * @internal
+ * @brief Hash table of all currently mounted file systems
+ *
+ * Mount points are hashed by their path, so finding the mount of a path does
+ * not need to compare the path with every mount point.
+ */
+static vfs_mount_t *_vfs_mount_buckets[VFS_MOUNT_BUCKETS];
+
+static_assert((VFS_MOUNT_BUCKETS & (VFS_MOUNT_BUCKETS - 1)) == 0,
+              "VFS_MOUNT_BUCKETS must be a power of two");
+
 /**
  * @internal
  * @brief List handle for list of all currently mounted file systems
@@ -140,6 +170,22 @@ static inline int _find_mount(vfs_mount_t **mountpp, const char *name, const cha
  */
 static inline int _fd_is_valid(int fd);
 
+/**
+ * @internal
+ * @brief Add a mount point to the _vfs_mount_buckets hash table
+ *
+ * @param[in]  mountp       mount point to add
+ */
+static void _add_mount(vfs_mount_t *mountp);
+
+/**
+ * @internal
+ * @brief Remove a mount point from the _vfs_mount_buckets hash table
+ *
+ * @param[in]  mountp       mount point to remove
+ */
+static void _remove_mount(vfs_mount_t *mountp);
+
 static mutex_t _mount_mutex = MUTEX_INIT;
 static mutex_t _open_mutex = MUTEX_INIT;
 
@@ -333,6 +379,46 @@ ssize_t vfs_read(int fd, void *dest, size_t count)
     return filp->f_op->read(filp, dest, count);
 }
 
+ssize_t vfs_read_ptr(int fd, const void **data, size_t count)
+{
+    DEBUG("vfs_read_ptr: %d, %p, %lu\n", fd, (void *)data, (unsigned long)count);
+    if (data == NULL) {
+        return -EFAULT;
+    }
+    int res = _fd_is_valid(fd);
+    if (res < 0) {
+        return res;
+    }
+    vfs_file_t *filp = &_vfs_open_files[fd];
+    if (((filp->flags & O_ACCMODE) != O_RDONLY) & ((filp->flags & O_ACCMODE) != O_RDWR)) {
+        /* File not open for reading */
+        return -EBADF;
+    }
+    if (filp->f_op->read_ptr == NULL) {
+        /* file system does not keep the file in memory mapped storage */
+        return -ENOTSUP;
+    }
+    return filp->f_op->read_ptr(filp, data, count);
+}
+
+int vfs_fadvise(int fd, vfs_fadvise_t advice)
+{
+    DEBUG("vfs_fadvise: %d, %d\n", fd, (int)advice);
+    int res = _fd_is_valid(fd);
+    if (res < 0) {
+        return res;
+    }
+    if ((unsigned)advice > VFS_FADV_WILLNEED) {
+        return -EINVAL;
+    }
+    vfs_file_t *filp = &_vfs_open_files[fd];
+    if (filp->f_op->fadvise == NULL) {
+        /* the hint is of no use to the file system */
+        return 0;
+    }
+    return filp->f_op->fadvise(filp, advice);
+}
+
 ssize_t vfs_write(int fd, const void *src, size_t count)
 {
     DEBUG_NOT_STDOUT(fd, "vfs_write: %d, %p, %lu\n", fd, src, (unsigned long)count);
@@ -540,6 +626,7 @@ int vfs_mount(vfs_mount_t *mountp)
     }
     /* Insert last in list. This property is relied on by vfs_iterate_mount_dirs. */
     clist_rpush(&_vfs_mounts_list, &mountp->list_entry);
+    _add_mount(mountp);
     mutex_unlock(&_mount_mutex);
     DEBUG("vfs_mount: mount done\n");
     return 0;
@@ -585,6 +672,7 @@ int vfs_umount(vfs_mount_t *mountp)
         mutex_unlock(&_mount_mutex);
         return -EINVAL;
     }
+    _remove_mount(mountp);
     mutex_unlock(&_mount_mutex);
     return 0;
 }
@@ -981,20 +1069,23 @@ const vfs_file_t *vfs_file_get(int fd)
 static inline int _allocate_fd(int fd)
 {
     if (fd < 0) {
-        for (fd = 0; fd < VFS_MAX_OPEN_FILES; ++fd) {
-            if ((fd == STDIN_FILENO) || (fd == STDOUT_FILENO) || (fd == STDERR_FILENO)) {
+        for (unsigned i = 0; i < ARRAY_SIZE(_vfs_fds_used); i++) {
+            unsigned unused = ~_vfs_fds_used[i];
+            if (i == 0) {
                 /* Do not auto-allocate the stdio file descriptor numbers to
                  * avoid conflicts between normal file system users and stdio
                  * drivers such as stdio_uart, stdio_rtt which need to be able
                  * to bind to these specific file descriptor numbers. */
-                continue;
+                unused &= ~((1U << STDIN_FILENO) | (1U << STDOUT_FILENO) |
+                            (1U << STDERR_FILENO));
             }
-            if (_vfs_open_files[fd].pid == KERNEL_PID_UNDEF) {
+            if (unused != 0) {
+                fd = i * FDS_WORD_BITS + bitarithm_lsb(unused);
                 break;
             }
         }
     }
-    if (fd >= VFS_MAX_OPEN_FILES) {
+    if ((fd < 0) || (fd >= VFS_MAX_OPEN_FILES)) {
         /* The _vfs_open_files array is full */
         return -ENFILE;
     }
@@ -1009,6 +1100,10 @@ static inline int _allocate_fd(int fd)
         pid = -1;
     }
     _vfs_open_files[fd].pid = pid;
+    /* fds are freed without holding _open_mutex */
+    unsigned state = irq_disable();
+    _vfs_fds_used[fd / FDS_WORD_BITS] |= 1U << (fd % FDS_WORD_BITS);
+    irq_restore(state);
     return fd;
 }
 
@@ -1019,6 +1114,9 @@ static inline void _free_fd(int fd)
         atomic_fetch_sub(&_vfs_open_files[fd].mp->open_files, 1);
     }
     _vfs_open_files[fd].pid = KERNEL_PID_UNDEF;
+    unsigned state = irq_disable();
+    _vfs_fds_used[fd / FDS_WORD_BITS] &= ~(1U << (fd % FDS_WORD_BITS));
+    irq_restore(state);
 }
 
 static inline int _init_fd(int fd, const vfs_file_ops_t *f_op, vfs_mount_t *mountp, int flags, void *private_data)
@@ -1036,44 +1134,83 @@ static inline int _init_fd(int fd, const vfs_file_ops_t *f_op, vfs_mount_t *moun
     return fd;
 }
 
-static inline int _find_mount(vfs_mount_t **mountpp, const char *name, const char **rel_path)
+/* FNV-1a */
+#define MOUNT_HASH_INIT     (2166136261U)
+
+static inline uint32_t _mount_hash_step(uint32_t hash, char c)
 {
-    size_t longest_match = 0;
-    size_t name_len = strlen(name);
-    mutex_lock(&_mount_mutex);
+    return (hash ^ (uint8_t)c) * 16777619U;
+}
 
-    clist_node_t *node = _vfs_mounts_list.next;
-    if (node == NULL) {
-        /* list empty */
-        mutex_unlock(&_mount_mutex);
-        return -ENOENT;
+static vfs_mount_t **_mount_bucket(const char *mount_point, size_t len)
+{
+    uint32_t hash = MOUNT_HASH_INIT;
+    for (size_t i = 0; i < len; i++) {
+        hash = _mount_hash_step(hash, mount_point[i]);
     }
-    vfs_mount_t *mountp = NULL;
-    do {
-        node = node->next;
-        vfs_mount_t *it = container_of(node, vfs_mount_t, list_entry);
-        size_t len = it->mount_point_len;
-        if (len < longest_match) {
-            /* Already found a longer prefix */
-            continue;
-        }
-        if (len > name_len) {
-            /* path name is shorter than the mount point name */
-            continue;
+    return &_vfs_mount_buckets[hash & (VFS_MOUNT_BUCKETS - 1)];
+}
+
+static void _add_mount(vfs_mount_t *mountp)
+{
+    vfs_mount_t **bucket = _mount_bucket(mountp->mount_point, mountp->mount_point_len);
+    /* insert first, so the latest mount of a path hides earlier ones */
+    mountp->hash_next = *bucket;
+    *bucket = mountp;
+}
+
+static void _remove_mount(vfs_mount_t *mountp)
+{
+    vfs_mount_t **it = _mount_bucket(mountp->mount_point, mountp->mount_point_len);
+    while (*it != NULL) {
+        if (*it == mountp) {
+            *it = mountp->hash_next;
+            return;
         }
-        if ((len > 1) && (name[len] != '/') && (name[len] != '\0')) {
-            /* name does not have a directory separator where mount point name ends */
-            continue;
+        it = &(*it)->hash_next;
+    }
+}
+
+static vfs_mount_t *_lookup_mount(const char *name, size_t len, uint32_t hash)
+{
+    vfs_mount_t *it = _vfs_mount_buckets[hash & (VFS_MOUNT_BUCKETS - 1)];
+    for (; it != NULL; it = it->hash_next) {
+        if ((it->mount_point_len == len) && (memcmp(it->mount_point, name, len) == 0)) {
+            return it;
         }
-        if (strncmp(name, it->mount_point, len) == 0) {
-            /* mount_point is a prefix of name */
+    }
+    return NULL;
+}
+
+static inline int _find_mount(vfs_mount_t **mountpp, const char *name, const char **rel_path)
+{
+    size_t longest_match = 0;
+    uint32_t hash = MOUNT_HASH_INIT;
+    vfs_mount_t *mountp = NULL;
+    mutex_lock(&_mount_mutex);
+
+    /* Every prefix of name ending at a directory separator (or the end of
+     * name) may be a mount point, the longest one found wins. */
+    for (size_t len = 0; ; len++) {
+        char c = name[len];
+        vfs_mount_t *it;
+        if ((len == 1) && (name[0] == '/')) {
             /* special check for mount_point == "/" */
-            if (len > 1) {
+            if ((it = _lookup_mount(name, len, hash)) != NULL) {
+                mountp = it;
+            }
+        }
+        else if ((len > 1) && ((c == '/') || (c == '\0'))) {
+            if ((it = _lookup_mount(name, len, hash)) != NULL) {
+                mountp = it;
                 longest_match = len;
             }
-            mountp = it;
         }
-    } while (node != _vfs_mounts_list.next);
+        if (c == '\0') {
+            break;
+        }
+        hash = _mount_hash_step(hash, c);
+    }
     if (mountp == NULL) {
         /* not found */
         mutex_unlock(&_mount_mutex);
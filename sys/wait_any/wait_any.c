@@ -0,0 +1,136 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_wait_any
+ * @{
+ *
+ * @file
+ * @brief       Wait on multiple sources implementation
+ *
+ * @}
+ */
+
+#include <assert.h>
+#include <errno.h>
+
+#include "irq.h"
+#include "thread.h"
+#include "thread_flags.h"
+#include "wait_any.h"
+
+static thread_flags_t _flag(const wait_any_src_t *src)
+{
+    switch (src->type) {
+    case WAIT_ANY_MSG:
+        return THREAD_FLAG_MSG_WAITING;
+    case WAIT_ANY_MBOX:
+        return THREAD_FLAG_MBOX;
+    case WAIT_ANY_EVENT:
+        return THREAD_FLAG_EVENT;
+    }
+    return 0;
+}
+
+static bool _fetch(wait_any_src_t *src)
+{
+    switch (src->type) {
+    case WAIT_ANY_MSG:
+        return msg_try_receive(&src->msg) == 1;
+    case WAIT_ANY_MBOX:
+        return mbox_try_get(src->mbox, &src->msg);
+    case WAIT_ANY_EVENT:
+        return (src->event = event_get(src->queue)) != NULL;
+    }
+    return false;
+}
+
+static int _fetch_any(wait_any_src_t *srcs, unsigned numof)
+{
+    for (unsigned i = 0; i < numof; i++) {
+        if (_fetch(&srcs[i])) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+static void _register(wait_any_src_t *srcs, unsigned numof, thread_t *me)
+{
+    for (unsigned i = 0; i < numof; i++) {
+        if (srcs[i].type == WAIT_ANY_MBOX) {
+            assert((srcs[i].mbox->notify == NULL) ||
+                   (srcs[i].mbox->notify == me));
+            unsigned state = irq_disable();
+            srcs[i].mbox->notify = me;
+            irq_restore(state);
+        }
+        else if ((srcs[i].type == WAIT_ANY_EVENT) &&
+                 (srcs[i].queue->waiter != me)) {
+            event_queue_claim(srcs[i].queue);
+        }
+    }
+}
+
+static void _unregister(wait_any_src_t *srcs, unsigned numof)
+{
+    for (unsigned i = 0; i < numof; i++) {
+        if (srcs[i].type == WAIT_ANY_MBOX) {
+            srcs[i].mbox->notify = NULL;
+        }
+    }
+}
+
+int wait_any(wait_any_src_t *srcs, unsigned numof, ztimer_clock_t *clock,
+             uint32_t timeout)
+{
+    thread_t *me = thread_get_active();
+    thread_flags_t flags = 0;
+    ztimer_t timer;
+    int res;
+
+    /* only block if nothing is ready yet */
+    if ((res = _fetch_any(srcs, numof)) >= 0) {
+        return res;
+    }
+
+    for (unsigned i = 0; i < numof; i++) {
+        flags |= _flag(&srcs[i]);
+    }
+    _register(srcs, numof, me);
+
+    if (clock) {
+        thread_flags_clear(THREAD_FLAG_TIMEOUT);
+        ztimer_set_timeout_flag(clock, &timer, timeout);
+    }
+
+    while (1) {
+        /* flags set for data that was fetched already must not wake us up
+         * again, anything arriving after clearing is found below */
+        thread_flags_clear(flags);
+        if ((res = _fetch_any(srcs, numof)) >= 0) {
+            break;
+        }
+        if (thread_flags_wait_any(flags | (clock ? THREAD_FLAG_TIMEOUT : 0))
+            & THREAD_FLAG_TIMEOUT) {
+            /* prefer a source that got ready just in time */
+            if ((res = _fetch_any(srcs, numof)) < 0) {
+                res = -ETIMEDOUT;
+            }
+            break;
+        }
+    }
+
+    if (clock) {
+        ztimer_remove(clock, &timer);
+        thread_flags_clear(THREAD_FLAG_TIMEOUT);
+    }
+    _unregister(srcs, numof);
+
+    return res;
+}
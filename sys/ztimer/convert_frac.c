@@ -25,6 +25,7 @@
 #include <stdint.h>
 #include <inttypes.h>
 
+#include "bitarithm.h"
 #include "frac.h"
 #include "assert.h"
 #include "irq.h"
@@ -45,10 +46,51 @@ static void ztimer_convert_frac_compute_scale(ztimer_convert_frac_t *self,
                                               uint32_t freq_self,
                                               uint32_t freq_lower);
 
+#if defined(__ARM_ARCH_ISA_THUMB) && (__ARM_ARCH_ISA_THUMB == 1)
+/* frac_scale() from 16 bit partial products, as the 32x32->64 bit
+ * multiplication is a library call on cores without long multiply */
+static uint32_t _frac_scale(const frac_t *frac, uint32_t x)
+{
+    uint32_t fl = frac->frac & 0xffff;
+    uint32_t fh = frac->frac >> 16;
+    uint32_t xl = x & 0xffff;
+    uint32_t xh = x >> 16;
+    uint32_t ll = fl * xl;
+    uint32_t lh = fl * xh;
+    uint32_t hl = fh * xl;
+    uint32_t mid = (ll >> 16) + (lh & 0xffff) + (hl & 0xffff);
+    uint32_t hi = fh * xh + (lh >> 16) + (hl >> 16) + (mid >> 16);
+    uint32_t lo = (mid << 16) | (ll & 0xffff);
+
+    if (frac->shift >= 32) {
+        return hi >> (frac->shift - 32);
+    }
+    if (frac->shift == 0) {
+        return lo;
+    }
+    return (hi << (32 - frac->shift)) | (lo >> frac->shift);
+}
+#else
+#define _frac_scale frac_scale
+#endif
+
+/* lower to self, exact and without 64 bit multiplication for power of two
+ * denominators */
+static uint32_t _scale_now(const ztimer_convert_frac_t *self, uint32_t x)
+{
+    if (self->now_num) {
+        uint32_t mask = (1LU << self->now_shift) - 1;
+
+        return (x >> self->now_shift) * self->now_num
+               + (((x & mask) * self->now_num) >> self->now_shift);
+    }
+    return _frac_scale(&self->scale_now, x);
+}
+
 static void ztimer_convert_frac_op_set(ztimer_clock_t *z, uint32_t val)
 {
     ztimer_convert_frac_t *self = (ztimer_convert_frac_t *)z;
-    uint32_t target_lower = frac_scale(&self->scale_set, val + self->round);
+    uint32_t target_lower = _frac_scale(&self->scale_set, val + self->round);
 
     DEBUG("ztimer_convert_frac_op_set(%" PRIu32 ")=%" PRIu32 "\n", val,
           target_lower);
@@ -63,7 +105,7 @@ static uint32_t ztimer_convert_frac_op_now(ztimer_clock_t *z)
     if (lower_now == 0) {
         return 0;
     }
-    uint32_t scaled = frac_scale(&self->scale_now, lower_now);
+    uint32_t scaled = _scale_now(self, lower_now);
 
     DEBUG("ztimer_convert_frac_op_now() %" PRIu32 "->%" PRIu32 "\n", lower_now,
           scaled);
@@ -84,6 +126,17 @@ static void ztimer_convert_frac_compute_scale(ztimer_convert_frac_t *self,
     assert(freq_lower);
     frac_init(&self->scale_now, freq_self, freq_lower);
     frac_init(&self->scale_set, freq_lower, freq_self);
+
+    uint32_t div = gcd32(freq_self, freq_lower);
+    uint32_t num = freq_self / div;
+    uint32_t den = freq_lower / div;
+    self->now_num = 0;
+    /* power of two denominator, the product of the remainder must not
+     * overflow */
+    if (!(den & (den - 1)) && (num <= UINT32_MAX / den)) {
+        self->now_num = num;
+        self->now_shift = bitarithm_msb(den);
+    }
 }
 
 void ztimer_convert_frac_init(ztimer_convert_frac_t *self,
@@ -102,7 +155,7 @@ void ztimer_convert_frac_init(ztimer_convert_frac_t *self,
 
     ztimer_convert_frac_compute_scale(self, freq_self, freq_lower);
     if (freq_self < freq_lower) {
-        self->super.super.max_value = frac_scale(&self->scale_now, UINT32_MAX);
+        self->super.super.max_value = _scale_now(self, UINT32_MAX);
         ztimer_init_extend(&self->super.super);
     }
     else {
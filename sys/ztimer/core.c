@@ -31,6 +31,7 @@
 #ifdef MODULE_PM_LAYERED
 #include "pm_layered.h"
 #endif
+#include "tracepoint.h"
 #include "ztimer.h"
 
 #define ENABLE_DEBUG 0
@@ -42,13 +43,109 @@ static void _ztimer_update(ztimer_clock_t *clock);
 static void _ztimer_print(const ztimer_clock_t *clock);
 static uint32_t _ztimer_update_head_offset(ztimer_clock_t *clock);
 
-#ifdef MODULE_ZTIMER_EXTEND
+#if defined(MODULE_ZTIMER_EXTEND) || defined(MODULE_ZTIMER_SLACK)
 static inline uint32_t _min_u32(uint32_t a, uint32_t b)
 {
     return a < b ? a : b;
 }
 #endif
 
+#ifdef MODULE_ZTIMER_HEAP
+static unsigned _is_set(const ztimer_clock_t *clock, const ztimer_t *t)
+{
+    /* only the heap root has no predecessor */
+    return (&t->base == clock->list.next) || t->base.prev;
+}
+
+/* Heap entries are ordered by the distance of their absolute target to the
+ * clock's base time, which never advances past the earliest target. */
+static inline uint32_t _heap_key(const ztimer_clock_t *clock,
+                                 const ztimer_base_t *entry)
+{
+    return entry->offset - clock->list.offset;
+}
+
+/* Both a and b must be detached roots (next and prev being NULL) */
+static ztimer_base_t *_heap_meld(const ztimer_clock_t *clock,
+                                 ztimer_base_t *a, ztimer_base_t *b)
+{
+    if (_heap_key(clock, b) < _heap_key(clock, a)) {
+        ztimer_base_t *tmp = a;
+        a = b;
+        b = tmp;
+    }
+
+    /* make b the first child of a */
+    b->prev = a;
+    b->next = a->child;
+    if (b->next) {
+        b->next->prev = b;
+    }
+    a->child = b;
+
+    return a;
+}
+
+static ztimer_base_t *_heap_merge_pairs(const ztimer_clock_t *clock,
+                                        ztimer_base_t *first)
+{
+    ztimer_base_t *stack = NULL;
+
+    /* first pass: meld siblings pairwise from left to right, pushing the
+     * results onto a stack linked via next */
+    while (first) {
+        ztimer_base_t *a = first;
+        ztimer_base_t *b = a->next;
+
+        a->next = NULL;
+        a->prev = NULL;
+        if (b) {
+            first = b->next;
+            b->next = NULL;
+            b->prev = NULL;
+            a = _heap_meld(clock, a, b);
+        }
+        else {
+            first = NULL;
+        }
+        a->next = stack;
+        stack = a;
+    }
+
+    if (!stack) {
+        return NULL;
+    }
+
+    /* second pass: meld the pairs from right to left */
+    ztimer_base_t *root = stack;
+    stack = stack->next;
+    root->next = NULL;
+    while (stack) {
+        ztimer_base_t *entry = stack;
+        stack = entry->next;
+        entry->next = NULL;
+        root = _heap_meld(clock, root, entry);
+    }
+
+    return root;
+}
+
+static inline uint32_t _head_offset(const ztimer_clock_t *clock)
+{
+    return _heap_key(clock, clock->list.next);
+}
+
+static inline void _expire_head(ztimer_clock_t *clock)
+{
+    clock->list.offset = clock->list.next->offset;
+}
+
+static inline uint32_t _head_deadline(const ztimer_clock_t *clock)
+{
+    /* walking the batch window is not possible in the heap */
+    return _head_offset(clock);
+}
+#else
 static unsigned _is_set(const ztimer_clock_t *clock, const ztimer_t *t)
 {
     if (!clock->list.next) {
@@ -59,6 +156,58 @@ static unsigned _is_set(const ztimer_clock_t *clock, const ztimer_t *t)
     }
 }
 
+static inline uint32_t _head_offset(const ztimer_clock_t *clock)
+{
+    return clock->list.next->offset;
+}
+
+static inline void _expire_head(ztimer_clock_t *clock)
+{
+    clock->list.offset += clock->list.next->offset;
+    clock->list.next->offset = 0;
+}
+
+#ifdef MODULE_ZTIMER_SLACK
+static inline uint32_t _sat_add_u32(uint32_t a, uint32_t b)
+{
+    return (a > UINT32_MAX - b) ? UINT32_MAX : a + b;
+}
+
+/* Returns the latest point in time (relative to the clock's base time) that
+ * satisfies all timers targeted before it */
+static uint32_t _head_deadline(const ztimer_clock_t *clock)
+{
+    const ztimer_base_t *entry = clock->list.next;
+    uint32_t target = entry->offset;
+
+    if (target == 0) {
+        /* head is already due (and its remaining slack unknown) */
+        return 0;
+    }
+
+    uint32_t deadline = _sat_add_u32(target,
+                                     ((const ztimer_t *)entry)->slack);
+
+    while ((entry = entry->next)) {
+        target += entry->offset;
+        if (target >= deadline) {
+            break;
+        }
+        deadline = _min_u32(deadline,
+                            _sat_add_u32(target,
+                                         ((const ztimer_t *)entry)->slack));
+    }
+
+    return deadline;
+}
+#else
+static inline uint32_t _head_deadline(const ztimer_clock_t *clock)
+{
+    return _head_offset(clock);
+}
+#endif
+#endif
+
 unsigned ztimer_is_set(const ztimer_clock_t *clock, const ztimer_t *timer)
 {
     unsigned state = irq_disable();
@@ -68,6 +217,23 @@ unsigned ztimer_is_set(const ztimer_clock_t *clock, const ztimer_t *timer)
     return res;
 }
 
+uint32_t ztimer_until_next(ztimer_clock_t *clock)
+{
+    uint32_t res = UINT32_MAX;
+    unsigned state = irq_disable();
+
+    if (clock->list.next) {
+        /* targets are relative to the base time, which now() may be past */
+        uint32_t elapsed = (uint32_t)ztimer_now(clock) - clock->list.offset;
+        uint32_t target = _head_offset(clock);
+
+        res = (elapsed < target) ? target - elapsed : 0;
+    }
+
+    irq_restore(state);
+    return res;
+}
+
 bool ztimer_remove(ztimer_clock_t *clock, ztimer_t *timer)
 {
     bool was_removed = false;
@@ -89,6 +255,8 @@ uint32_t ztimer_set(ztimer_clock_t *clock, ztimer_t *timer, uint32_t val)
     DEBUG("ztimer_set(): %p: set %p at %" PRIu32 " offset %" PRIu32 "\n",
           (void *)clock, (void *)timer, clock->ops->now(clock), val);
 
+    TRACEPOINT(ztimer_set, val);
+
     unsigned state = irq_disable();
 
     uint32_t now = _ztimer_update_head_offset(clock);
@@ -106,8 +274,21 @@ uint32_t ztimer_set(ztimer_clock_t *clock, ztimer_t *timer, uint32_t val)
     }
 
     timer->base.offset = val;
+#ifdef MODULE_ZTIMER_HEAP
+    /* the base time may lag behind now while an expired timer is pending */
+    uint32_t lag = now - clock->list.offset;
+    timer->base.offset = (val > UINT32_MAX - lag) ? UINT32_MAX : val + lag;
+#endif
     _add_entry_to_list(clock, &timer->base);
+#if defined(MODULE_ZTIMER_SLACK) && !defined(MODULE_ZTIMER_HEAP)
+    /* a timer within the current batch may shorten the batch window, an
+     * already due head needs to be triggered right away */
+    uint32_t deadline = _head_deadline(clock);
+    if ((val <= deadline) || (deadline == 0)) {
+        val = deadline;
+#else
     if (clock->list.next == &timer->base) {
+#endif
 #ifdef MODULE_ZTIMER_EXTEND
         if (clock->max_value < UINT32_MAX) {
             val = _min_u32(val, clock->max_value >> 1);
@@ -121,6 +302,33 @@ uint32_t ztimer_set(ztimer_clock_t *clock, ztimer_t *timer, uint32_t val)
     return now;
 }
 
+#ifdef MODULE_ZTIMER_HEAP
+static void _add_entry_to_list(ztimer_clock_t *clock, ztimer_base_t *entry)
+{
+#ifdef MODULE_PM_LAYERED
+    /* First timer on the clock's heap */
+    if (clock->list.next == NULL &&
+        clock->block_pm_mode != ZTIMER_CLOCK_NO_REQUIRED_PM_MODE) {
+        pm_block(clock->block_pm_mode);
+    }
+#endif
+
+    /* convert offset relative to the base time into absolute target */
+    entry->offset += clock->list.offset;
+    entry->next = NULL;
+    entry->prev = NULL;
+    entry->child = NULL;
+
+    if (clock->list.next) {
+        clock->list.next = _heap_meld(clock, clock->list.next, entry);
+    }
+    else {
+        clock->list.next = entry;
+    }
+    DEBUG("_add_entry_to_list() %p target %" PRIu32 "\n", (void *)entry,
+          entry->offset);
+}
+#else
 static void _add_entry_to_list(ztimer_clock_t *clock, ztimer_base_t *entry)
 {
     uint32_t delta_sum = 0;
@@ -159,6 +367,7 @@ static void _add_entry_to_list(ztimer_clock_t *clock, ztimer_base_t *entry)
           entry->offset);
 
 }
+#endif
 
 static uint32_t _add_modulo(uint32_t a, uint32_t b, uint32_t mod)
 {
@@ -191,6 +400,90 @@ ztimer_now_t _ztimer_now_extend(ztimer_clock_t *clock)
 }
 #endif /* MODULE_ZTIMER_EXTEND */
 
+#ifdef MODULE_ZTIMER_HEAP
+static uint32_t _ztimer_update_head_offset(ztimer_clock_t *clock)
+{
+    uint32_t now = ztimer_now(clock);
+    ztimer_base_t *entry = clock->list.next;
+
+    /* advance the base time, but never beyond the earliest target */
+    if (entry && (now - clock->list.offset) > _heap_key(clock, entry)) {
+        clock->list.offset = entry->offset;
+    }
+    else {
+        clock->list.offset = now;
+    }
+
+    DEBUG("clock %p: _ztimer_update_head_offset(): now=%" PRIu32
+          " base=%" PRIu32 "\n", (void *)clock, now, clock->list.offset);
+
+    return now;
+}
+
+static bool _del_entry_from_list(ztimer_clock_t *clock, ztimer_base_t *entry)
+{
+    DEBUG("_del_entry_from_list()\n");
+
+    assert(_is_set(clock, (ztimer_t *)entry));
+
+    if (entry == clock->list.next) {
+        clock->list.next = _heap_merge_pairs(clock, entry->child);
+    }
+    else {
+        /* unlink entry (and its sub-heap) from its parent or sibling */
+        if (entry->prev->child == entry) {
+            entry->prev->child = entry->next;
+        }
+        else {
+            entry->prev->next = entry->next;
+        }
+        if (entry->next) {
+            entry->next->prev = entry->prev;
+        }
+
+        ztimer_base_t *sub = _heap_merge_pairs(clock, entry->child);
+        if (sub) {
+            clock->list.next = _heap_meld(clock, clock->list.next, sub);
+        }
+    }
+
+    /* reset the entry's pointers so _is_set() considers it unset */
+    entry->next = NULL;
+    entry->prev = NULL;
+    entry->child = NULL;
+
+#ifdef MODULE_PM_LAYERED
+    /* The last timer just got removed from the clock's heap */
+    if (clock->list.next == NULL &&
+        clock->block_pm_mode != ZTIMER_CLOCK_NO_REQUIRED_PM_MODE) {
+        pm_unblock(clock->block_pm_mode);
+    }
+#endif
+
+    return true;
+}
+
+static ztimer_t *_now_next(ztimer_clock_t *clock)
+{
+    ztimer_base_t *entry = clock->list.next;
+
+    if (entry && (_heap_key(clock, entry) == 0)) {
+        clock->list.next = _heap_merge_pairs(clock, entry->child);
+        entry->child = NULL;
+#ifdef MODULE_PM_LAYERED
+        /* The last timer just got removed from the clock's heap */
+        if (!clock->list.next &&
+            clock->block_pm_mode != ZTIMER_CLOCK_NO_REQUIRED_PM_MODE) {
+            pm_unblock(clock->block_pm_mode);
+        }
+#endif
+        return (ztimer_t *)entry;
+    }
+    else {
+        return NULL;
+    }
+}
+#else
 static uint32_t _ztimer_update_head_offset(ztimer_clock_t *clock)
 {
     uint32_t old_base = clock->list.offset;
@@ -302,14 +595,15 @@ static ztimer_t *_now_next(ztimer_clock_t *clock)
         return NULL;
     }
 }
+#endif
 
-static void _ztimer_update(ztimer_clock_t *clock)
+static void RIOT_HOT _ztimer_update(ztimer_clock_t *clock)
 {
 #ifdef MODULE_ZTIMER_EXTEND
     if (clock->max_value < UINT32_MAX) {
         if (clock->list.next) {
             clock->ops->set(clock,
-                            _min_u32(clock->list.next->offset,
+                            _min_u32(_head_deadline(clock),
                                      clock->max_value >> 1));
         }
         else {
@@ -321,7 +615,7 @@ static void _ztimer_update(ztimer_clock_t *clock)
     }
     else {
         if (clock->list.next) {
-            clock->ops->set(clock, clock->list.next->offset);
+            clock->ops->set(clock, _head_deadline(clock));
         }
         else {
             if (IS_USED(MODULE_ZTIMER_NOW64)) {
@@ -335,7 +629,7 @@ static void _ztimer_update(ztimer_clock_t *clock)
     }
 }
 
-void ztimer_handler(ztimer_clock_t *clock)
+void RIOT_HOT ztimer_handler(ztimer_clock_t *clock)
 {
     DEBUG("ztimer_handler(): %p now=%" PRIu32 "\n", (void *)clock, clock->ops->now(
               clock));
@@ -349,7 +643,7 @@ void ztimer_handler(ztimer_clock_t *clock)
         uint32_t now = ztimer_now(clock);
 
         if (clock->list.next) {
-            uint32_t target = clock->list.offset + clock->list.next->offset;
+            uint32_t target = clock->list.offset + _head_deadline(clock);
             int32_t diff = (int32_t)(target - now);
             if (diff > 0) {
                 DEBUG("ztimer_handler(): %p postponing by %" PRIi32 "\n",
@@ -374,8 +668,7 @@ void ztimer_handler(ztimer_clock_t *clock)
 #endif
 
     if (clock->list.next) {
-        clock->list.offset += clock->list.next->offset;
-        clock->list.next->offset = 0;
+        _expire_head(clock);
 
         ztimer_t *entry = _now_next(clock);
         while (entry) {
@@ -404,6 +697,23 @@ void ztimer_handler(ztimer_clock_t *clock)
     }
 }
 
+#ifdef MODULE_ZTIMER_HEAP
+static void _ztimer_print_heap(const ztimer_clock_t *clock,
+                               const ztimer_base_t *entry, unsigned depth)
+{
+    for (; entry; entry = entry->next) {
+        printf("%*s0x%08x:%" PRIu32 "(%" PRIu32 ")\n", (int)depth * 2, "",
+               (unsigned)entry, _heap_key(clock, entry), entry->offset);
+        _ztimer_print_heap(clock, entry->child, depth + 1);
+    }
+}
+
+static void _ztimer_print(const ztimer_clock_t *clock)
+{
+    printf("base %" PRIu32 "\n", clock->list.offset);
+    _ztimer_print_heap(clock, clock->list.next, 0);
+}
+#else
 static void _ztimer_print(const ztimer_clock_t *clock)
 {
     const ztimer_base_t *entry = &clock->list;
@@ -419,3 +729,4 @@ static void _ztimer_print(const ztimer_clock_t *clock)
     } while ((entry = entry->next));
     puts("");
 }
+#endif
@@ -21,7 +21,8 @@
  * Anyhow, this configures ztimer as follows:
  *
  * 1. if ztimer_usec in USEMODULE:
- * 1.1. assume ztimer_usec uses periph_timer
+ * 1.1a. if ztimer_usec_ptp in USEMODULE: use the PTP clock
+ * 1.1b. else: assume ztimer_usec uses periph_timer
  * 1.2a. if no config given
  * 1.2a.1a. use xtimer config if available
  * 1.2a.1b. default to TIMER_DEV(0), 32bit
@@ -45,6 +46,7 @@
 #include "ztimer/convert_shift.h"
 #include "ztimer/convert_muldiv64.h"
 #include "ztimer/overhead.h"
+#include "ztimer/periph_ptp.h"
 #include "ztimer/periph_timer.h"
 #include "ztimer/periph_rtt.h"
 #include "ztimer/periph_rtc.h"
@@ -61,6 +63,7 @@
 
 #define WIDTH_TO_MAXVAL(width)  (UINT32_MAX >> (32 - width))
 
+#define FREQ_1GHZ       1000000000LU
 #define FREQ_1MHZ       1000000LU
 #define FREQ_250KHZ     250000LU
 #define FREQ_1KHZ       1000LU
@@ -92,15 +95,25 @@
 #  define ZTIMER_RTC_FREQ FREQ_1HZ
 #endif
 
+#if MODULE_ZTIMER_PERIPH_PTP
+#  define ZTIMER_PTP      _ztimer_periph_ptp
+#  define ZTIMER_PTP_CLK  _ztimer_periph_ptp
+#  define ZTIMER_PTP_FREQ FREQ_1GHZ
+#endif
+
 /* Step 1: select which periphery to use for the higher level ZTIMER_*SEC
  *         selected periphery is marked for initialisation (INIT_ZTIMER_<periph>
  *         prepare defines for ztimer initialization
  */
 
-/* ZTIMER_USEC always uses the basic timer
+/* ZTIMER_USEC uses the basic timer, unless it is synchronized to network time
+ * by using the PTP clock (ztimer_usec_ptp)
  * basic timer is available on all boards */
 #if MODULE_ZTIMER_USEC
-#  ifdef ZTIMER_TIMER
+#  if MODULE_ZTIMER_USEC_PTP && defined(ZTIMER_PTP)
+#    define ZTIMER_USEC_PTP 1
+#    define INIT_ZTIMER_PTP 1
+#  elif defined(ZTIMER_TIMER)
 #    define ZTIMER_USEC_TIMER 1
 #    ifndef INIT_ZTIMER_TIMER
 #      define INIT_ZTIMER_TIMER 1
@@ -201,15 +214,24 @@ static ztimer_periph_rtt_t ZTIMER_RTT;
 static ztimer_periph_rtc_t ZTIMER_RTC;
 #endif
 
+#if INIT_ZTIMER_PTP
+static ztimer_periph_ptp_t ZTIMER_PTP;
+#endif
+
 /* Step 3: setup constants for ztimers and memory for converters */
 
 #if MODULE_ZTIMER_USEC
-#  ifdef ZTIMER_USEC_TIMER
+#  ifdef ZTIMER_USEC_PTP
+ztimer_clock_t *const ZTIMER_USEC_BASE = &ZTIMER_PTP_CLK;
+#  elif defined(ZTIMER_USEC_TIMER)
 ztimer_clock_t *const ZTIMER_USEC_BASE = &ZTIMER_TIMER_CLK;
 #  else
 #    error No suitable ZTIMER_USEC config. Basic timer configuration missing?
 #  endif
-#  if ZTIMER_TIMER_FREQ == FREQ_1MHZ
+#  ifdef ZTIMER_USEC_PTP
+static ztimer_convert_frac_t _ztimer_convert_frac_usec;
+ztimer_clock_t *const ZTIMER_USEC = &_ztimer_convert_frac_usec.super.super;
+#  elif ZTIMER_TIMER_FREQ == FREQ_1MHZ
 ztimer_clock_t *const ZTIMER_USEC = &ZTIMER_TIMER_CLK;
 #  elif ZTIMER_TIMER_FREQ == 250000LU
 static ztimer_convert_shift_t _ztimer_convert_shift_usec;
@@ -333,9 +355,19 @@ void ztimer_init(void)
 #  endif
 #endif
 
+#if INIT_ZTIMER_PTP
+    LOG_DEBUG("ztimer_init(): initializing ptp\n");
+    ztimer_periph_ptp_init(&ZTIMER_PTP);
+#endif
+
 /* Step 5: initialize ztimers requested */
 #if MODULE_ZTIMER_USEC
-#  if ZTIMER_TIMER_FREQ != FREQ_1MHZ
+#  ifdef ZTIMER_USEC_PTP
+    LOG_DEBUG("ztimer_init(): ZTIMER_USEC convert_frac %lu to 1000000\n",
+              ZTIMER_PTP_FREQ);
+    ztimer_convert_frac_init(&_ztimer_convert_frac_usec, ZTIMER_USEC_BASE,
+                             FREQ_1MHZ, ZTIMER_PTP_FREQ);
+#  elif ZTIMER_TIMER_FREQ != FREQ_1MHZ
 #    if ZTIMER_TIMER_FREQ == FREQ_250KHZ
     LOG_DEBUG("ztimer_init(): ZTIMER_USEC convert_shift %lu to 1000000\n",
               ZTIMER_TIMER_FREQ);
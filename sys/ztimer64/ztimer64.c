@@ -27,6 +27,9 @@
 #include <stdio.h>
 #include <inttypes.h>
 
+#include "periph/timer.h"
+#include "time_units.h"
+#include "ztimer/config.h"
 #include "ztimer64.h"
 
 #define ENABLE_DEBUG 0
@@ -62,7 +65,8 @@ void ztimer64_remove(ztimer64_clock_t *clock, ztimer64_t *timer)
     unsigned state = irq_disable();
 
     if (_is_set(timer)) {
-        if (_del_entry_from_list(clock, &timer->base) == 0) {
+        /* reprogram the base clock if the head was removed */
+        if (_del_entry_from_list(clock, &timer->base)) {
             _ztimer64_update(clock);
         }
     }
@@ -165,6 +169,10 @@ static int _del_entry_from_list(ztimer64_clock_t *clock, ztimer64_base_t *entry)
 
 uint64_t ztimer64_now(ztimer64_clock_t *clock)
 {
+    if (clock->native_now) {
+        return clock->native_now();
+    }
+
     uint64_t now;
     unsigned state = irq_disable();
     uint32_t base_now = ztimer_now(clock->base_clock);
@@ -196,11 +204,23 @@ uint64_t ztimer64_now(ztimer64_clock_t *clock)
 static void _ztimer64_update(ztimer64_clock_t *clock)
 {
     uint64_t now = ztimer64_now(clock);
-    uint64_t next_checkpoint = clock->checkpoint + ZTIMER64_CHECKPOINT_INTERVAL;
+    uint64_t next_checkpoint;
     uint64_t target;
 
-    if (next_checkpoint < now) {
-        next_checkpoint = now;
+    if (clock->native_now) {
+        if (!clock->first) {
+            /* no checkpointing needed, stop using the base clock */
+            ztimer_remove(clock->base_clock, &clock->base_timer);
+            return;
+        }
+        /* only limits the interval set on the base clock */
+        next_checkpoint = now + ZTIMER64_CHECKPOINT_INTERVAL;
+    }
+    else {
+        next_checkpoint = clock->checkpoint + ZTIMER64_CHECKPOINT_INTERVAL;
+        if (next_checkpoint < now) {
+            next_checkpoint = now;
+        }
     }
 
     if (!clock->first) {
@@ -271,6 +291,29 @@ void ztimer64_clock_init(ztimer64_clock_t *clock, ztimer_clock_t *base_clock)
     _ztimer64_update(clock);
 }
 
+void ztimer64_clock_init_native(ztimer64_clock_t *clock,
+                                ztimer_clock_t *base_clock,
+                                ztimer64_native_now_t now)
+{
+    assert(now);
+    *clock =
+        (ztimer64_clock_t){ .base_clock = base_clock,
+                            .base_timer =
+                            { .callback = ztimer64_handler, .arg = clock },
+                            .native_now = now };
+}
+
+/* ZTIMER_USEC is the periph_timer without conversion */
+#if MODULE_ZTIMER64_USEC && MODULE_PERIPH_TIMER_READ64 && \
+    MODULE_ZTIMER_PERIPH_TIMER && !MODULE_ZTIMER_USEC_PTP && \
+    (CONFIG_ZTIMER_USEC_BASE_FREQ == US_PER_SEC)
+#  define ZTIMER64_USEC_NATIVE 1
+static uint64_t _ztimer64_usec_native_now(void)
+{
+    return timer_read64(CONFIG_ZTIMER_USEC_DEV);
+}
+#endif
+
 #if MODULE_ZTIMER64_USEC
 static ztimer64_clock_t _ztimer64_usec;
 ztimer64_clock_t *const ZTIMER64_USEC = &_ztimer64_usec;
@@ -286,7 +329,10 @@ ztimer64_clock_t *const ZTIMER64_SEC = &_ztimer64_sec;
 
 void ztimer64_init(void)
 {
-#if MODULE_ZTIMER64_USEC
+#if ZTIMER64_USEC_NATIVE
+    ztimer64_clock_init_native(ZTIMER64_USEC, ZTIMER_USEC,
+                               _ztimer64_usec_native_now);
+#elif MODULE_ZTIMER64_USEC
     ztimer64_clock_init(ZTIMER64_USEC, ZTIMER_USEC);
 #endif
 #if MODULE_ZTIMER64_MSEC
@@ -0,0 +1,139 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Benchmark for ChaCha20-Poly1305
+ *
+ * @}
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+#include "crypto/chacha20poly1305.h"
+#include "crypto/poly1305.h"
+#include "fmt.h"
+#include "kernel_defines.h"
+#include "ztimer.h"
+
+#if IS_USED(MODULE_HACL)
+#include "haclnacl.h"
+#include "Chacha20Poly1305.h"
+#endif
+#if IS_USED(MODULE_MONOCYPHER)
+#include "monocypher.h"
+#endif
+
+#define MSG_LEN     (1024U)
+#define ROUNDS      (100U)
+
+static uint8_t msg[MSG_LEN];
+static uint8_t cipher[MSG_LEN + CHACHA20POLY1305_TAG_BYTES];
+static uint8_t tag[POLY1305_BLOCK_SIZE];
+
+static const uint8_t key[CHACHA20POLY1305_KEY_BYTES] = {
+    0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8b, 0x8c, 0x8d, 0x8e, 0x8f,
+    0x90, 0x91, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9a, 0x9b, 0x9c, 0x9d, 0x9e, 0x9f
+};
+
+/* large enough for the 24 byte nonce of XChaCha20 */
+static const uint8_t nonce[24] = {
+    0x07, 0x00, 0x00, 0x00, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47
+};
+
+static const uint8_t aad[] = {
+    0x50, 0x51, 0x52, 0x53, 0xc0, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7
+};
+
+/* tag of the first 300 bytes of msg */
+static const uint8_t expected_tag[] = {
+    0x22, 0x3d, 0x83, 0xf2, 0x31, 0xe4, 0x97, 0x49,
+    0x10, 0xda, 0xd8, 0xd0, 0xea, 0xbb, 0x89, 0x2d,
+};
+
+static void _print_result(const char *name, uint32_t usec)
+{
+    print_str(name);
+    print_str(": ");
+    print_u32_dec(usec);
+    print_str(" µs\n");
+}
+
+int main(void)
+{
+    uint32_t start;
+
+    for (unsigned i = 0; i < sizeof(msg); i++) {
+        msg[i] = i;
+    }
+
+    print_str("Verifying ChaCha20-Poly1305: ");
+    chacha20poly1305_encrypt(cipher, msg, 300, aad, sizeof(aad), key, nonce);
+    if (memcmp(cipher + 300, expected_tag, sizeof(expected_tag))) {
+        print_str("FAIL\n");
+    }
+    else {
+        print_str("OK\n");
+    }
+
+    print_str("Processing ");
+    print_u32_dec(ROUNDS);
+    print_str(" x ");
+    print_u32_dec(MSG_LEN);
+    print_str(" bytes\n");
+
+    start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < ROUNDS; i++) {
+        poly1305_auth(tag, msg, sizeof(msg), key);
+    }
+    _print_result("riot poly1305", ztimer_now(ZTIMER_USEC) - start);
+
+    start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < ROUNDS; i++) {
+        chacha20poly1305_encrypt(cipher, msg, sizeof(msg), aad, sizeof(aad),
+                                 key, nonce);
+    }
+    _print_result("riot chacha20poly1305", ztimer_now(ZTIMER_USEC) - start);
+
+#if IS_USED(MODULE_HACL)
+    start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < ROUNDS; i++) {
+        crypto_onetimeauth(tag, msg, sizeof(msg), key);
+    }
+    _print_result("hacl poly1305", ztimer_now(ZTIMER_USEC) - start);
+
+    start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < ROUNDS; i++) {
+        Chacha20Poly1305_aead_encrypt(cipher, cipher + sizeof(msg), msg,
+                                      sizeof(msg), (uint8_t *)aad, sizeof(aad),
+                                      (uint8_t *)key, (uint8_t *)nonce);
+    }
+    _print_result("hacl chacha20poly1305", ztimer_now(ZTIMER_USEC) - start);
+#endif
+
+#if IS_USED(MODULE_MONOCYPHER)
+    start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < ROUNDS; i++) {
+        crypto_poly1305(tag, msg, sizeof(msg), key);
+    }
+    _print_result("monocypher poly1305", ztimer_now(ZTIMER_USEC) - start);
+
+    start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < ROUNDS; i++) {
+        crypto_lock_aead(cipher + sizeof(msg), cipher, key, nonce,
+                         aad, sizeof(aad), msg, sizeof(msg));
+    }
+    _print_result("monocypher xchacha20poly1305", ztimer_now(ZTIMER_USEC) - start);
+#endif
+
+    return 0;
+}
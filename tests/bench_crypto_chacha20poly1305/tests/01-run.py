@@ -0,0 +1,20 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 Freie Universität Berlin
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    child.expect_exact("Verifying ChaCha20-Poly1305: OK\r\n")
+    child.expect(r"riot poly1305: [0-9]+ µs\r\n")
+    child.expect(r"riot chacha20poly1305: [0-9]+ µs\r\n")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
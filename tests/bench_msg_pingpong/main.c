@@ -27,11 +27,20 @@
 
 #include "msg.h"
 #include "xtimer.h"
+#include "test_utils/result_output.h"
 
 #ifndef TEST_DURATION_US
 #define TEST_DURATION_US    (1000000U)
 #endif
 
+/**
+ * @brief   Number of messages moved per msg_send_bulk()/msg_receive_bulk()
+ *          call, 0 to use msg_send()/msg_receive(). Must be a power of two.
+ */
+#ifndef TEST_BULK_SIZE
+#define TEST_BULK_SIZE      (0U)
+#endif
+
 static char _stack[THREAD_STACKSIZE_MAIN];
 
 static void _timer_callback(void *flag)
@@ -39,6 +48,22 @@ static void _timer_callback(void *flag)
     atomic_flag_clear(flag);
 }
 
+#if TEST_BULK_SIZE
+static msg_t _queue[TEST_BULK_SIZE];
+
+static void *_second_thread(void *arg)
+{
+    (void)arg;
+
+    msg_init_queue(_queue, TEST_BULK_SIZE);
+    while (1) {
+        msg_t test[TEST_BULK_SIZE];
+        msg_receive_bulk(test, TEST_BULK_SIZE);
+    }
+
+    return NULL;
+}
+#else
 static void *_second_thread(void *arg)
 {
     (void)arg;
@@ -50,6 +75,7 @@ static void *_second_thread(void *arg)
 
     return NULL;
 }
+#endif
 
 int main(void)
 {
@@ -75,15 +101,28 @@ int main(void)
     xtimer_set(&timer, TEST_DURATION_US);
 
     while (atomic_flag_test_and_set(&flag)) {
+#if TEST_BULK_SIZE
+        msg_t test[TEST_BULK_SIZE];
+        n += msg_send_bulk(test, TEST_BULK_SIZE, other);
+#else
         msg_t test;
         msg_send(&test, other);
         n++;
+#endif
     }
 
-    printf("{ \"result\" : %"PRIu32, n);
-    printf(", \"ticks\" : %"PRIu32,
-           (uint32_t)((TEST_DURATION_US/US_PER_MS) * (coreclk()/KHZ(1)))/n);
-    puts(" }");
+    uint32_t ticks = (uint32_t)((TEST_DURATION_US/US_PER_MS) * (coreclk()/KHZ(1)))/n;
+    turo_t ctx;
+
+    turo_init(&ctx);
+    turo_container_open(&ctx);
+    turo_dict_open(&ctx);
+    turo_dict_key(&ctx, "result");
+    turo_u32(&ctx, n);
+    turo_dict_key(&ctx, "ticks");
+    turo_u32(&ctx, ticks);
+    turo_dict_close(&ctx);
+    turo_container_close(&ctx, 0);
 
     return 0;
 }
@@ -25,11 +25,25 @@
 #include "mutex.h"
 #include "thread.h"
 #include "xtimer.h"
+#include "test_utils/result_output.h"
 
 #ifndef TEST_DURATION
 #define TEST_DURATION       (1000000U)
 #endif
 
+/**
+ * @brief   Set to 1 to let two threads of the same priority compete for the
+ *          mutex instead
+ *
+ * Each thread repeatedly takes the mutex, yields inside the critical section
+ * and releases it again. This is the pattern that leads to lock convoys when
+ * the mutex is handed over on unlock, compare the results with and without
+ * module `core_mutex_no_handoff`.
+ */
+#ifndef TEST_SAME_PRIO
+#define TEST_SAME_PRIO      (0)
+#endif
+
 volatile unsigned _flag = 0;
 static char _stack[THREAD_STACKSIZE_MAIN];
 static mutex_t _mutex = MUTEX_INIT;
@@ -47,6 +61,10 @@ static void *_second_thread(void *arg)
 
     while(1) {
         mutex_lock(&_mutex);
+        if (TEST_SAME_PRIO) {
+            thread_yield();
+            mutex_unlock(&_mutex);
+        }
     }
 
     return NULL;
@@ -58,15 +76,18 @@ int main(void)
 
     thread_create(_stack,
                   sizeof(_stack),
-                  THREAD_PRIORITY_MAIN - 1,
+                  TEST_SAME_PRIO ? THREAD_PRIORITY_MAIN
+                                 : THREAD_PRIORITY_MAIN - 1,
                   THREAD_CREATE_WOUT_YIELD | THREAD_CREATE_STACKTEST,
                   _second_thread,
                   NULL,
                   "second_thread");
 
-    /* lock the mutex, then yield to second_thread */
-    mutex_lock(&_mutex);
-    thread_yield_higher();
+    if (!TEST_SAME_PRIO) {
+        /* lock the mutex, then yield to second_thread */
+        mutex_lock(&_mutex);
+        thread_yield_higher();
+    }
 
     xtimer_t timer;
     timer.callback = _timer_callback;
@@ -75,14 +96,26 @@ int main(void)
 
     xtimer_set(&timer, TEST_DURATION);
     while(!_flag) {
+        if (TEST_SAME_PRIO) {
+            mutex_lock(&_mutex);
+            thread_yield();
+        }
         mutex_unlock(&_mutex);
         n++;
     }
 
-    printf("{ \"result\" : %"PRIu32, n);
-    printf(", \"ticks\" : %"PRIu32,
-           (uint32_t)((TEST_DURATION/US_PER_MS) * (coreclk()/KHZ(1)))/n);
-    puts(" }");
+    uint32_t ticks = (uint32_t)((TEST_DURATION/US_PER_MS) * (coreclk()/KHZ(1)))/n;
+    turo_t ctx;
+
+    turo_init(&ctx);
+    turo_container_open(&ctx);
+    turo_dict_open(&ctx);
+    turo_dict_key(&ctx, "result");
+    turo_u32(&ctx, n);
+    turo_dict_key(&ctx, "ticks");
+    turo_u32(&ctx, ticks);
+    turo_dict_close(&ctx);
+    turo_container_close(&ctx, 0);
 
     return 0;
 }
@@ -12,7 +12,8 @@ from testrunner import run
 
 
 def testfunc(child):
-    child.expect(r"{ \"result\" : \d+(, \"ticks\" : \d+)? }")
+    child.expect(r'\[{"result":\s*\d+,\s*"ticks":\s*\d+},\s*'
+                 r'{"exit_status":\s*0}\]')
 
 
 if __name__ == "__main__":
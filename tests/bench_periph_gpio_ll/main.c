@@ -23,6 +23,8 @@
 #include <string.h>
 #include <stdlib.h>
 
+#include "gpio_par_bus.h"
+#include "kernel_defines.h"
 #include "mutex.h"
 #include "periph/gpio.h"
 #include "periph/gpio_ll.h"
@@ -289,6 +291,32 @@ int main(void)
         }
     }
 
+    {
+        puts("\n"
+             "gpio_par_bus: Using 2x gpio_par_bus_write()\n"
+             "-------------------------------------------");
+        const gpio_t pins[] = {
+            GPIO_PIN(PORT_OUT, PIN_OUT_0), GPIO_PIN(PORT_OUT, PIN_OUT_1)
+        };
+        gpio_par_bus_t bus;
+        expect(0 == gpio_par_bus_init(&bus, pins, ARRAY_SIZE(pins)));
+
+        uint32_t start = ztimer_now(ZTIMER_USEC);
+        for (uint_fast16_t i = loops; i > 0; i--) {
+            gpio_par_bus_write(&bus, 0x3);
+            gpio_par_bus_write(&bus, 0x0);
+        }
+        uint32_t duration = ztimer_now(ZTIMER_USEC) - start;
+
+        if (COMPENSATE_OVERHEAD) {
+            print_summary_compensated(loops, duration - loop_overhead,
+                                      duration);
+        }
+        else {
+            print_summary_uncompensated(loops, duration);
+        }
+    }
+
     puts("\n\nTEST SUCCEEDED");
     return 0;
 }
@@ -22,18 +22,92 @@
 
 #include "mutex.h"
 #include "benchmark.h"
+#include "test_utils/result_output.h"
 #include "thread.h"
 #include "thread_flags.h"
+#include "timex.h"
 
 #ifndef BENCH_RUNS
 #define BENCH_RUNS          (1000UL * 1000UL)
 #endif
 
+/**
+ * @brief   Set to the number of samples to split the BENCH_RUNS runs of each
+ *          benchmark into, to get statistics instead of a single average
+ */
+#ifndef BENCH_SAMPLES
+#define BENCH_SAMPLES       (0U)
+#endif
+
+#if BENCH_SAMPLES
+#define BENCH(name, func)                                               \
+    do {                                                                \
+        benchmark_stats_t _stats;                                       \
+        BENCHMARK_STATS_COLLECT(&_stats, BENCH_SAMPLES,                 \
+                                BENCH_RUNS / BENCH_SAMPLES, func);      \
+        _print_stats(name, &_stats);                                    \
+    } while (0)
+#else
+#define BENCH(name, func)                                               \
+    do {                                                                \
+        uint32_t _time = ztimer_now(ZTIMER_USEC);                       \
+        for (unsigned long i = 0; i < BENCH_RUNS; i++) {                \
+            func;                                                       \
+        }                                                               \
+        _print_time(name, ztimer_now(ZTIMER_USEC) - _time);             \
+    } while (0)
+#endif
+
+static turo_t _ctx;
 static mutex_t _lock;
 static thread_t *t;
 static thread_flags_t _flag = 0x0001;
 static msg_t _msg;
 
+static void _print_name(const char *name)
+{
+    turo_dict_key(&_ctx, "name");
+    turo_string(&_ctx, name);
+    turo_dict_key(&_ctx, "runs");
+    turo_u32(&_ctx, BENCH_RUNS);
+}
+
+static inline void _print_time(const char *name, uint32_t time)
+{
+    turo_dict_open(&_ctx);
+    _print_name(name);
+    turo_dict_key(&_ctx, "time_us");
+    turo_u32(&_ctx, time);
+    turo_dict_key(&_ctx, "ns_per_call");
+    turo_u32(&_ctx, ((uint64_t)time * NS_PER_US) / BENCH_RUNS);
+    turo_dict_close(&_ctx);
+}
+
+static inline void _print_stats(const char *name, benchmark_stats_t *stats)
+{
+    benchmark_summary_t summary;
+
+    benchmark_stats_summary(stats, &summary);
+    turo_dict_open(&_ctx);
+    _print_name(name);
+    /* all in ns per call */
+    turo_dict_key(&_ctx, "samples");
+    turo_u32(&_ctx, summary.samples);
+    turo_dict_key(&_ctx, "min");
+    turo_u32(&_ctx, summary.min);
+    turo_dict_key(&_ctx, "median");
+    turo_u32(&_ctx, summary.median);
+    turo_dict_key(&_ctx, "p99");
+    turo_u32(&_ctx, summary.p99);
+    turo_dict_key(&_ctx, "max");
+    turo_u32(&_ctx, summary.max);
+    turo_dict_key(&_ctx, "mean");
+    turo_s32(&_ctx, summary.mean);
+    turo_dict_key(&_ctx, "stddev");
+    turo_u32(&_ctx, summary.stddev);
+    turo_dict_close(&_ctx);
+}
+
 static void _mutex_lockunlock(void)
 {
     mutex_lock(&_lock);
@@ -64,20 +138,19 @@ int main(void)
 
     t = thread_get_active();
 
-    BENCHMARK_FUNC("nop loop", BENCH_RUNS, __asm__ volatile ("nop"));
-    puts("");
-    BENCHMARK_FUNC("mutex_init()", BENCH_RUNS, mutex_init(&_lock));
-    BENCHMARK_FUNC("mutex lock/unlock", BENCH_RUNS, _mutex_lockunlock());
-    puts("");
-    BENCHMARK_FUNC("thread_flags_set()", BENCH_RUNS, thread_flags_set(t, _flag));
-    BENCHMARK_FUNC("thread_flags_clear()", BENCH_RUNS, thread_flags_clear(_flag));
-    BENCHMARK_FUNC("thread flags set/wait any", BENCH_RUNS, _flag_waitany());
-    BENCHMARK_FUNC("thread flags set/wait all", BENCH_RUNS, _flag_waitall());
-    BENCHMARK_FUNC("thread flags set/wait one", BENCH_RUNS, _flag_waitone());
-    puts("");
-    BENCHMARK_FUNC("msg_try_receive()", BENCH_RUNS, msg_try_receive(&_msg));
-    BENCHMARK_FUNC("msg_avail()", BENCH_RUNS, msg_avail());
-
-    puts("\n[SUCCESS]");
+    turo_init(&_ctx);
+    turo_container_open(&_ctx);
+    BENCH("nop loop", __asm__ volatile ("nop"));
+    BENCH("mutex_init()", mutex_init(&_lock));
+    BENCH("mutex lock/unlock", _mutex_lockunlock());
+    BENCH("thread_flags_set()", thread_flags_set(t, _flag));
+    BENCH("thread_flags_clear()", thread_flags_clear(_flag));
+    BENCH("thread flags set/wait any", _flag_waitany());
+    BENCH("thread flags set/wait all", _flag_waitall());
+    BENCH("thread flags set/wait one", _flag_waitone());
+    BENCH("msg_try_receive()", msg_try_receive(&_msg));
+    BENCH("msg_avail()", msg_avail());
+    turo_container_close(&_ctx, 0);
+
     return 0;
 }
@@ -12,11 +12,12 @@ from testrunner import run
 
 # The default timeout is not enough for this test on some of the slower boards
 TIMEOUT = 30
-BENCHMARK_REGEXP = r"\s+{func}:\s+\d+us\s+---\s+\d*\.*\d+us per call\s+---\s+\d+ calls per sec"
+BENCHMARK_REGEXP = r'{{"name":\s*"{func}",\s*"runs":\s*\d+,[^}}]+}},\s*'
 
 
 def testfunc(child):
     child.expect_exact('Runtime of Selected Core API functions')
+    child.expect_exact('[')
     child.expect(BENCHMARK_REGEXP.format(func="nop loop"))
     child.expect(BENCHMARK_REGEXP.format(func=r"mutex_init\(\)"))
     child.expect(BENCHMARK_REGEXP.format(func="mutex lock/unlock"), timeout=TIMEOUT)
@@ -27,8 +28,7 @@ def testfunc(child):
     child.expect(BENCHMARK_REGEXP.format(func="thread flags set/wait one"), timeout=TIMEOUT)
     child.expect(BENCHMARK_REGEXP.format(func=r"msg_try_receive\(\)"), timeout=TIMEOUT)
     child.expect(BENCHMARK_REGEXP.format(func=r"msg_avail\(\)"))
-    child.expect_exact('[SUCCESS]')
-
+    child.expect(r'{"exit_status":\s*0}\]')
 
 if __name__ == "__main__":
     sys.exit(run(testfunc))
@@ -25,6 +25,7 @@
 
 #include "thread_flags.h"
 #include "xtimer.h"
+#include "test_utils/result_output.h"
 
 #ifndef TEST_DURATION
 #define TEST_DURATION       (1000000U)
@@ -76,10 +77,18 @@ int main(void)
         n++;
     }
 
-    printf("{ \"result\" : %"PRIu32, n);
-    printf(", \"ticks\" : %"PRIu32,
-           (uint32_t)((TEST_DURATION/US_PER_MS) * (coreclk()/KHZ(1)))/n);
-    puts(" }");
+    uint32_t ticks = (uint32_t)((TEST_DURATION/US_PER_MS) * (coreclk()/KHZ(1)))/n;
+    turo_t ctx;
+
+    turo_init(&ctx);
+    turo_container_open(&ctx);
+    turo_dict_open(&ctx);
+    turo_dict_key(&ctx, "result");
+    turo_u32(&ctx, n);
+    turo_dict_key(&ctx, "ticks");
+    turo_u32(&ctx, ticks);
+    turo_dict_close(&ctx);
+    turo_container_close(&ctx, 0);
 
     return 0;
 }
@@ -18,169 +18,162 @@
  * @}
  */
 
+#include <stdbool.h>
+
 #include "print_results.h"
 #include "matstat.h"
 #include "fmt.h"
+#include "test_utils/result_output.h"
 #include "bench_timers_config.h"
 
-static void print_statistics(const matstat_state_t *state, const stat_limits_t *limits)
+/* Adds the statistics to the dict opened by the caller */
+static void print_statistics(turo_t *ctx, const matstat_state_t *state, const stat_limits_t *limits)
 {
+    turo_dict_key(ctx, "count");
+    turo_u32(ctx, state->count);
     if (state->count == 0) {
-        print_str("no samples\n");
-        return;
-    }
-    if (state->count == 1) {
-        print_str("single sample: ");
-        print_s32_dec((int32_t)state->sum);
-        print("\n", 1);
         return;
     }
     int32_t mean = matstat_mean(state);
     uint64_t variance = matstat_variance(state);
 
-    char buf[20];
-    print(buf, fmt_lpad(buf, fmt_u32_dec(buf, state->count), 8, ' '));
-    print(" ", 1);
-    print(buf, fmt_lpad(buf, fmt_s64_dec(buf, state->sum), 9, ' '));
-    print(" ", 1);
-    print(buf, fmt_lpad(buf, fmt_u64_dec(buf, state->sum_sq), 12, ' '));
-    print(" ", 1);
-    print(buf, fmt_lpad(buf, fmt_s32_dec(buf, state->min), 6, ' '));
-    print(" ", 1);
-    print(buf, fmt_lpad(buf, fmt_s32_dec(buf, state->max), 5, ' '));
-    print(" ", 1);
-    print(buf, fmt_lpad(buf, fmt_s32_dec(buf, mean), 5, ' '));
-    print(" ", 1);
-    print(buf, fmt_lpad(buf, fmt_u64_dec(buf, variance), 6, ' '));
+    turo_dict_key(ctx, "sum");
+    turo_s64(ctx, state->sum);
+    turo_dict_key(ctx, "sum_sq");
+    turo_u64(ctx, state->sum_sq);
+    turo_dict_key(ctx, "min");
+    turo_s32(ctx, state->min);
+    turo_dict_key(ctx, "max");
+    turo_s32(ctx, state->max);
+    turo_dict_key(ctx, "mean");
+    turo_s32(ctx, mean);
+    turo_dict_key(ctx, "variance");
+    turo_u64(ctx, variance);
     if (limits) {
-        if ((mean < limits->mean_low) || (limits->mean_high < mean) ||
-            (variance < limits->variance_low) || (limits->variance_high < variance) ) {
-            /* mean or variance is outside the expected range, alert the user */
-            print_str("  <=== SIC!");
-        }
+        /* false if mean or variance is outside the expected range */
+        turo_dict_key(ctx, "in_limits");
+        turo_bool(ctx, (mean >= limits->mean_low) && (mean <= limits->mean_high) &&
+                       (variance >= limits->variance_low) &&
+                       (variance <= limits->variance_high));
     }
-    print("\n", 1);
 }
 
-static void print_totals(const matstat_state_t *states, size_t nelem, const stat_limits_t *limits)
+static void print_totals(turo_t *ctx, const matstat_state_t *states, size_t nelem, const stat_limits_t *limits)
 {
     matstat_state_t totals;
     matstat_clear(&totals);
     for (size_t k = 0; k < nelem; ++k) {
         matstat_merge(&totals, &states[k]);
     }
-    print_statistics(&totals, limits);
+    turo_dict_key(ctx, "total");
+    turo_dict_open(ctx);
+    print_statistics(ctx, &totals, limits);
+    turo_dict_close(ctx);
 }
 
-static void print_detailed(const matstat_state_t *states, size_t nelem, unsigned int test_min, const stat_limits_t *limits)
+static void print_detailed(turo_t *ctx, const matstat_state_t *states, size_t nelem, unsigned int test_min, const stat_limits_t *limits)
 {
-    if (LOG2_STATS) {
-        print_str("   interval     count       sum       sum_sq    min   max  mean  variance\n");
-        for (unsigned int k = 0; k < nelem; ++k) {
-            char buf[20];
+    turo_dict_key(ctx, "intervals");
+    turo_array_open(ctx);
+    for (unsigned int k = 0; k < nelem; ++k) {
+        unsigned int start = k + test_min;
+        unsigned int end = start;
+        if (LOG2_STATS) {
             unsigned int num = (1 << k);
             if (num >= TEST_NUM) {
                 break;
             }
-            unsigned int start = num + test_min;
+            start = num + test_min;
             if (num == 1) {
                 /* special case, bitarithm_msb will return 0 for both 0 and 1 */
                 start = test_min;
             }
-            print(buf, fmt_lpad(buf, fmt_u32_dec(buf, start), 4, ' '));
-            print_str(" - ");
-            print(buf, fmt_lpad(buf, fmt_u32_dec(buf, test_min + (num * 2) - 1), 4, ' '));
-            print_str(": ");
-            print_statistics(&states[k], limits);
+            end = test_min + (num * 2) - 1;
         }
-        print_str("      TOTAL  ");
+        turo_dict_open(ctx);
+        turo_dict_key(ctx, "from");
+        turo_u32(ctx, start);
+        turo_dict_key(ctx, "to");
+        turo_u32(ctx, end);
+        print_statistics(ctx, &states[k], limits);
+        turo_dict_close(ctx);
     }
-    else {
-        print_str("interval    count       sum       sum_sq    min   max  mean  variance\n");
-        for (unsigned int k = 0; k < nelem; ++k) {
-            char buf[10];
-            print(buf, fmt_lpad(buf, fmt_u32_dec(buf, k + test_min), 7, ' '));
-            print_str(": ");
-            print_statistics(&states[k], limits);
-        }
-        print_str("  TOTAL: ");
-    }
-    print_totals(states, nelem, limits);
+    turo_array_close(ctx);
+    print_totals(ctx, states, nelem, limits);
 }
 
-void print_results(const result_presentation_t *pres, const matstat_state_t *ref_states, const matstat_state_t *int_states)
+static void print_limits(turo_t *ctx, const stat_limits_t *limits)
 {
-    static char buf[48]; /* String formatting temporary buffer, not thread safe */
-    print_str("------------- BEGIN STATISTICS --------------\n");
-    print_str("===== Reference timer statistics =====\n");
-    print_str("Limits: mean: [");
-    print_s32_dec(pres->ref_limits->mean_low);
-    print_str(", ");
-    print_s32_dec(pres->ref_limits->mean_high);
-    print_str("], variance: [");
-    print_u32_dec(pres->ref_limits->variance_low);
-    print_str(", ");
-    print_u32_dec(pres->ref_limits->variance_high);
-    print_str("]\n");
-    print_str("Target error (actual trigger time - expected trigger time), in reference timer ticks\n");
-    print_str("positive: timer under test is late, negative: timer under test is early\n");
+    turo_dict_key(ctx, "limits");
+    turo_dict_open(ctx);
+    turo_dict_key(ctx, "mean_low");
+    turo_s32(ctx, limits->mean_low);
+    turo_dict_key(ctx, "mean_high");
+    turo_s32(ctx, limits->mean_high);
+    turo_dict_key(ctx, "variance_low");
+    turo_u32(ctx, limits->variance_low);
+    turo_dict_key(ctx, "variance_high");
+    turo_u32(ctx, limits->variance_high);
+    turo_dict_close(ctx);
+}
 
-    if (DETAILED_STATS) {
-        static const unsigned int count = ((LOG2_STATS) ? (TEST_LOG2NUM) : (TEST_NUM));
-        unsigned k = 0;
-        for (unsigned g = 0; g < pres->num_groups; ++g) {
-            for (unsigned c = 0; c < pres->groups[g].num_sub_labels; ++c) {
-                print_str("=== ");
-                print_str(pres->groups[g].label);
-                print(" ", 1);
-                print_str(pres->groups[g].sub_labels[c]);
-                print_str(" ===\n");
-                print_detailed(&ref_states[k * count], count, pres->offsets[k], pres->ref_limits);
-                ++k;
-            }
-        }
-    }
-    else {
-        print_str("function              count       sum       sum_sq    min   max  mean  variance\n");
-        unsigned k = 0;
-        for (unsigned g = 0; g < pres->num_groups; ++g) {
-            print("\n", 1);
-            print(buf, fmt_lpad(buf, fmt_str(buf, pres->groups[g].label), 18, ' '));
-            print(" ", 1);
-            print_totals(&ref_states[k], pres->groups[g].num_sub_labels, pres->ref_limits);
-            for (unsigned c = 0; c < pres->groups[g].num_sub_labels; ++c) {
-                print(buf, fmt_lpad(buf, fmt_str(buf, pres->groups[g].sub_labels[c]), 18, ' '));
-                print(" ", 1);
-                print_statistics(&ref_states[k], pres->ref_limits);
-                ++k;
-            }
-        }
-    }
-    print_str("===== introspective statistics =====\n");
-    print_str("Limits: mean: [");
-    print_s32_dec(pres->int_limits->mean_low);
-    print_str(", ");
-    print_s32_dec(pres->int_limits->mean_high);
-    print_str("], variance: [");
-    print_u32_dec(pres->int_limits->variance_low);
-    print_str(", ");
-    print_u32_dec(pres->int_limits->variance_high);
-    print_str("]\n");
-    print_str("self-referencing error (TUT time elapsed - expected TUT interval), in timer under test ticks\n");
-    print_str("positive: timer target handling is slow, negative: TUT is dropping ticks or triggering callback early\n");
-    print_str("function              count       sum       sum_sq    min   max  mean  variance\n");
+static void print_functions(turo_t *ctx, const result_presentation_t *pres,
+                            const matstat_state_t *states,
+                            const stat_limits_t *limits, bool detailed)
+{
+    static const unsigned int count = ((LOG2_STATS) ? (TEST_LOG2NUM) : (TEST_NUM));
+
+    print_limits(ctx, limits);
+    turo_dict_key(ctx, "functions");
+    turo_array_open(ctx);
     for (unsigned k = 0, g = 0; g < pres->num_groups; ++g) {
-        print("\n", 1);
-        print(buf, fmt_lpad(buf, fmt_str(buf, pres->groups[g].label), 18, ' '));
-        print(" ", 1);
-        print_totals(&int_states[k], pres->groups[g].num_sub_labels, pres->int_limits);
+        turo_dict_open(ctx);
+        turo_dict_key(ctx, "function");
+        turo_string(ctx, pres->groups[g].label);
+        if (!detailed) {
+            print_totals(ctx, &states[k], pres->groups[g].num_sub_labels, limits);
+        }
+        turo_dict_key(ctx, "variants");
+        turo_array_open(ctx);
         for (unsigned c = 0; c < pres->groups[g].num_sub_labels; ++c) {
-            print(buf, fmt_lpad(buf, fmt_str(buf, pres->groups[g].sub_labels[c]), 18, ' '));
-            print(" ", 1);
-            print_statistics(&int_states[k], pres->int_limits);
+            turo_dict_open(ctx);
+            turo_dict_key(ctx, "variant");
+            turo_string(ctx, pres->groups[g].sub_labels[c]);
+            if (detailed) {
+                print_detailed(ctx, &states[k * count], count, pres->offsets[k], limits);
+            }
+            else {
+                print_statistics(ctx, &states[k], limits);
+            }
+            turo_dict_close(ctx);
             ++k;
         }
+        turo_array_close(ctx);
+        turo_dict_close(ctx);
     }
+    turo_array_close(ctx);
+}
+
+void print_results(const result_presentation_t *pres, const matstat_state_t *ref_states, const matstat_state_t *int_states)
+{
+    turo_t ctx;
+
+    print_str("Reference: target error (actual trigger time - expected trigger time), in reference timer ticks\n");
+    print_str("positive: timer under test is late, negative: timer under test is early\n");
+    print_str("Introspective: self-referencing error (TUT time elapsed - expected TUT interval), in timer under test ticks\n");
+    print_str("positive: timer target handling is slow, negative: TUT is dropping ticks or triggering callback early\n");
 
-    print_str("-------------- END STATISTICS ---------------\n");
+    turo_init(&ctx);
+    turo_container_open(&ctx);
+    turo_dict_open(&ctx);
+    turo_dict_key(&ctx, "reference");
+    turo_dict_open(&ctx);
+    print_functions(&ctx, pres, ref_states, pres->ref_limits, DETAILED_STATS);
+    turo_dict_close(&ctx);
+    turo_dict_key(&ctx, "introspective");
+    turo_dict_open(&ctx);
+    print_functions(&ctx, pres, int_states, pres->int_limits, false);
+    turo_dict_close(&ctx);
+    turo_dict_close(&ctx);
+    turo_container_close(&ctx, 0);
 }
@@ -21,6 +21,7 @@
 #include <stdio.h>
 
 #include "test_utils/expect.h"
+#include "test_utils/result_output.h"
 
 #include "msg.h"
 #include "thread.h"
@@ -54,6 +55,8 @@ static ztimer_t _timers[NUMOF_TIMERS];
  */
 static unsigned _triggers;
 
+static turo_t _ctx;
+
 /*
  * The test assumes that first, middle and last will always end up in at the
  * same index within the timer queue.  In order to compensate for the time that
@@ -88,13 +91,25 @@ static void _timer_remove(unsigned n)
 
 static void _print_result(const char *desc, unsigned n, uint32_t total)
 {
-    printf("%30s %8"PRIu32" / %u = %"PRIu32"\n", desc, total, n, total/n);
+    turo_dict_open(&_ctx);
+    turo_dict_key(&_ctx, "name");
+    turo_string(&_ctx, desc);
+    turo_dict_key(&_ctx, "total");
+    turo_u32(&_ctx, total);
+    turo_dict_key(&_ctx, "n");
+    turo_u32(&_ctx, n);
+    turo_dict_key(&_ctx, "result");
+    turo_u32(&_ctx, total / n);
+    turo_dict_close(&_ctx);
 }
 
 int main(void)
 {
     puts("ztimer benchmark application.\n");
 
+    turo_init(&_ctx);
+    turo_container_open(&_ctx);
+
     unsigned n;
     uint32_t before, diff, start;
 
@@ -178,7 +193,7 @@ int main(void)
 
     diff = ztimer_now(ZTIMER_USEC) - before;
 
-    _print_result("re-set()  first", REPEAT, diff);
+    _print_result("re-set() first", REPEAT, diff);
     expect(!_triggers);
 
     /*
@@ -208,7 +223,7 @@ int main(void)
 
     diff = ztimer_now(ZTIMER_USEC) - before;
 
-    _print_result("re-set()   last", REPEAT, diff);
+    _print_result("re-set() last", REPEAT, diff);
     expect(!_triggers);
 
     /*
@@ -224,7 +239,7 @@ int main(void)
 
     diff = ztimer_now(ZTIMER_USEC) - before;
 
-    _print_result("remove() + set()  first", REPEAT, diff);
+    _print_result("remove() + set() first", REPEAT, diff);
     expect(!_triggers);
 
     /*
@@ -256,7 +271,7 @@ int main(void)
 
     diff = ztimer_now(ZTIMER_USEC) - before;
 
-    _print_result("remove() + set()   last", REPEAT, diff);
+    _print_result("remove() + set() last", REPEAT, diff);
     expect(!_triggers);
 
     /*
@@ -288,9 +303,24 @@ int main(void)
     _print_result("ztimer_now()", REPEAT, diff);
     expect(!_triggers);
 
+    /*
+     * test ztimer_now() of ZTIMER_USEC, usually a converted clock
+     *
+     */
+    before = ztimer_now(ZTIMER_USEC);
+    n = REPEAT;
+    while (n--) {
+        ztimer_now(ZTIMER_USEC);
+    }
+
+    diff = ztimer_now(ZTIMER_USEC) - before;
+
+    _print_result("ztimer_now() ZTIMER_USEC", REPEAT, diff);
+    expect(!_triggers);
+
     _print_result("sizeof(ztimer_t)", NUMOF_TIMERS, sizeof(_timers));
 
-    puts("done.");
+    turo_container_close(&_ctx, 0);
 
     return 0;
 }
@@ -12,10 +12,12 @@ from testrunner import run
 
 def testfunc(child):
     child.expect_exact("ztimer benchmark application.\r\n")
-    for i in range(13):
-        child.expect(r"\s+[\w() _\+]+\s+\d+ / \d+ = \d+\r\n")
+    child.expect_exact("[")
+    for i in range(14):
+        child.expect(r'{"name":\s*"[\w() _\+]+",\s*"total":\s*\d+,\s*'
+                     r'"n":\s*\d+,\s*"result":\s*\d+},\s*')
 
-    child.expect_exact("done.\r\n")
+    child.expect(r'{"exit_status":\s*0}\]')
 
 
 if __name__ == "__main__":
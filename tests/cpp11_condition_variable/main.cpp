@@ -122,6 +122,20 @@ int main() {
   }
   puts("Done\n");
 
+  puts("Wait until with msec_clock ...");
+  {
+    constexpr unsigned timeout = 100;
+    mutex m;
+    condition_variable cv;
+    unique_lock<mutex> lk(m);
+    auto before = msec_clock::now();
+    auto res = cv.wait_until(lk, before + chrono::milliseconds(timeout));
+    auto diff = msec_clock::now() - before;
+    expect(res == cv_status::timeout);
+    expect(diff >= chrono::milliseconds(timeout));
+  }
+  puts("Done\n");
+
   puts("Bye, bye. ");
   puts("******************************************************\n");
 
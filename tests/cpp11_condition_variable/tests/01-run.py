@@ -21,6 +21,8 @@ def testfunc(child):
     child.expect_exact("Done")
     child.expect_exact("Wait until ...")
     child.expect_exact("Done")
+    child.expect_exact("Wait until with msec_clock ...")
+    child.expect_exact("Done")
     child.expect_exact("Bye, bye.")
     child.expect_exact("******************************************************")
 
@@ -0,0 +1,101 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup tests
+ * @{
+ *
+ * @file
+ * @brief   Test application for the lock-free queues
+ *
+ * @}
+ */
+
+#include <cstdio>
+
+#include "test_utils/expect.h"
+#include "ztimer.h"
+
+#include "riot/queue.hpp"
+
+#define ITEMS   (64U)
+
+struct item {
+  unsigned seq;
+  unsigned check;
+};
+
+static riot::blocking_queue<riot::spsc_queue<item, 4>> spsc;
+static riot::blocking_queue<riot::mpmc_queue<item, 8>> mpmc;
+static ztimer_t timer;
+static unsigned produced;
+
+template <class Queue>
+static void _produce(void* arg) {
+  Queue* queue = static_cast<Queue*>(arg);
+  /* push a few items per interrupt, some may not fit */
+  for (unsigned i = 0; (i < 3) && (produced < ITEMS); i++) {
+    if (!queue->try_push(item{ produced, ~produced })) {
+      break;
+    }
+    produced++;
+  }
+  if (produced < ITEMS) {
+    ztimer_set(ZTIMER_USEC, &timer, 100);
+  }
+}
+
+template <class Queue>
+static void _test(Queue& queue) {
+  produced = 0;
+  timer.callback = _produce<Queue>;
+  timer.arg = &queue;
+  ztimer_set(ZTIMER_USEC, &timer, 100);
+
+  for (unsigned i = 0; i < ITEMS; i++) {
+    item it;
+    queue.pop(it);
+    expect(it.seq == i);
+    expect(it.check == ~i);
+  }
+  expect(queue.empty());
+}
+
+int main() {
+  puts("************ C++ queue test ***********");
+
+  puts("Non-blocking operations ...");
+  {
+    riot::mpmc_queue<unsigned, 4> queue;
+    unsigned val;
+    expect(!queue.try_pop(val));
+    for (unsigned i = 0; i < queue.capacity(); i++) {
+      expect(queue.try_push(i));
+    }
+    expect(!queue.try_push(42U));
+    expect(queue.size() == 4);
+    for (unsigned i = 0; i < queue.capacity(); i++) {
+      expect(queue.try_pop(val) && (val == i));
+    }
+    expect(queue.empty());
+  }
+  puts("Done");
+
+  puts("SPSC queue from ISR ...");
+  _test(spsc);
+  puts("Done");
+
+  puts("MPMC queue from ISR ...");
+  _test(mpmc);
+  puts("Done");
+
+  puts("Bye, bye.");
+  puts("******************************************");
+
+  return 0;
+}
@@ -32,6 +32,8 @@
 using namespace std;
 using namespace riot;
 
+static static_thread<THREAD_STACKSIZE_DEFAULT> static_worker;
+
 /* http://en.cppreference.com/w/cpp/thread/thread */
 int main() {
   puts("\n************ C++ thread test ***********");
@@ -180,6 +182,25 @@ int main() {
 
   expect(sched_num_threads == initial_num_threads);
 
+  puts("Static thread ...");
+  {
+    int res = 0;
+    expect(static_worker.joinable() == 0);
+    static_worker.start({ THREAD_PRIORITY_MAIN - 1, "static" },
+                        [&res](const int j) { res = j; }, 42);
+    expect(static_worker.joinable() == 1);
+    static_worker.join();
+    expect(res == 42);
+    /* the object can be reused once the thread finished */
+    static_worker.start([&res] { res = 1; });
+    static_worker.join();
+    expect(res == 1);
+    expect(static_worker.joinable() == 0);
+  }
+  puts("Done\n");
+
+  expect(sched_num_threads == initial_num_threads);
+
   puts("Bye, bye.");
   puts("******************************************");
 
@@ -0,0 +1,82 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup tests
+ * @{
+ *
+ * @file
+ * @brief   Test application for the C++20 coroutine support
+ *
+ * @}
+ */
+
+#include <cstdio>
+
+#include "event/thread.h"
+#include "mutex.h"
+#include "ztimer.h"
+
+#include "riot/coroutine.hpp"
+
+static mutex_t done = MUTEX_INIT_LOCKED;
+static riot::async_flags flags;
+static unsigned order;
+
+static riot::task<int> twice(int val, uint32_t delay)
+{
+  co_await riot::sleep(ZTIMER_MSEC, delay);
+  co_return 2 * val;
+}
+
+static riot::task<void> sleeper(int id, uint32_t delay)
+{
+  int res = co_await twice(id, delay);
+  printf("sleeper %d: %d (order %u)\n", id, res, order++);
+}
+
+static riot::task<void> waiter(void)
+{
+  uint16_t res = co_await flags.wait_any(0x2);
+  printf("waiter: flags 0x%x\n", (unsigned)res);
+  co_await riot::yield();
+  co_await riot::resume_on(EVENT_PRIO_HIGHEST);
+  puts("waiter: resumed on highest");
+  mutex_unlock(&done);
+}
+
+static void _set_flags(void *arg)
+{
+  (void)arg;
+  flags.set(0x1);
+  flags.set(0x2);
+}
+
+int main()
+{
+  puts("************ C++ coroutine test ***********");
+
+  puts("Sleeping tasks ...");
+  riot::spawn(EVENT_PRIO_MEDIUM, sleeper(2, 20));
+  riot::spawn(EVENT_PRIO_MEDIUM, sleeper(1, 10));
+  ztimer_sleep(ZTIMER_MSEC, 50);
+  puts("Done");
+
+  puts("Flags set from ISR ...");
+  ztimer_t timer = {};
+  timer.callback = _set_flags;
+  riot::spawn(EVENT_PRIO_MEDIUM, waiter());
+  ztimer_set(ZTIMER_MSEC, &timer, 10);
+  mutex_lock(&done);
+  puts("Done");
+
+  puts("Bye, bye.");
+  puts("******************************************");
+
+  return 0;
+}
@@ -0,0 +1,28 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 Freie Universität Berlin
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    child.expect_exact("************ C++ coroutine test ***********")
+    child.expect_exact("Sleeping tasks ...")
+    child.expect_exact("sleeper 1: 2 (order 0)")
+    child.expect_exact("sleeper 2: 4 (order 1)")
+    child.expect_exact("Done")
+    child.expect_exact("Flags set from ISR ...")
+    child.expect_exact("waiter: flags 0x2")
+    child.expect_exact("waiter: resumed on highest")
+    child.expect_exact("Done")
+    child.expect_exact("Bye, bye.")
+    child.expect_exact("******************************************")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
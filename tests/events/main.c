@@ -166,7 +166,7 @@ int main(void)
     printf("posting %p to delayed queue at index 1\n", (void *)&delayed_event1);
     event_post(&dqs[1], &delayed_event1);
     printf("posting %p to delayed queue at index 1\n", (void *)&delayed_event2);
-    event_post(&dqs[1], &delayed_event2);
+    event_post_deferred(&dqs[1], &delayed_event2);
     printf("posting %p to delayed queue at index 0\n", (void *)&delayed_event3);
     event_post(&dqs[0], &delayed_event3);
 
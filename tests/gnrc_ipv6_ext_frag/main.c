@@ -244,16 +244,12 @@ static void test_ipv6_ext_frag_reass_in_order(void)
                           rbuf->pkt->size);
     TEST_ASSERT_EQUAL_INT(TEST_ID, rbuf->id);
     TEST_ASSERT(!rbuf->last);
+    /* limits of adjacent fragments are merged */
     ptr = (gnrc_ipv6_ext_frag_limits_t *)rbuf->limits.next;
     TEST_ASSERT_NOT_NULL(ptr);
     ptr = ptr->next;
     TEST_ASSERT_NOT_NULL(ptr);
     TEST_ASSERT_EQUAL_INT(0, ptr->start);
-    TEST_ASSERT_EQUAL_INT(TEST_FRAG2_OFFSET / 8, ptr->end);
-    TEST_ASSERT_NOT_NULL(ptr->next);
-    ptr = ptr->next;
-    TEST_ASSERT_NOT_NULL(ptr);
-    TEST_ASSERT_EQUAL_INT(TEST_FRAG2_OFFSET / 8, ptr->start);
     TEST_ASSERT_EQUAL_INT(TEST_FRAG3_OFFSET / 8, ptr->end);
     TEST_ASSERT(((clist_node_t *)ptr) == rbuf->limits.next);
     TEST_ASSERT(memcmp(_exp_payload, rbuf->pkt->data, rbuf->pkt->size) == 0);
@@ -350,17 +346,13 @@ static void test_ipv6_ext_frag_reass_out_of_order(void)
     TEST_ASSERT_NOT_NULL(rbuf->pkt);
     TEST_ASSERT_EQUAL_INT(sizeof(_exp_payload), rbuf->pkt->size);
     TEST_ASSERT(rbuf->last);
+    /* limits of adjacent fragments are merged */
     ptr = (gnrc_ipv6_ext_frag_limits_t *)rbuf->limits.next;
     TEST_ASSERT_NOT_NULL(ptr);
     ptr = ptr->next;
     TEST_ASSERT_NOT_NULL(ptr);
     TEST_ASSERT_EQUAL_INT(TEST_FRAG2_OFFSET / 8, ptr->start);
-    TEST_ASSERT_EQUAL_INT(TEST_FRAG3_OFFSET / 8, ptr->end);
-    ptr = ptr->next;
-    TEST_ASSERT_NOT_NULL(ptr);
-    TEST_ASSERT_EQUAL_INT(TEST_FRAG3_OFFSET / 8, ptr->start);
     TEST_ASSERT_EQUAL_INT(sizeof(_exp_payload) / 8, ptr->end);
-    TEST_ASSERT_NOT_NULL(ptr->next);
     TEST_ASSERT(((clist_node_t *)ptr) == rbuf->limits.next);
     TEST_ASSERT(memcmp(&_exp_payload[TEST_FRAG2_OFFSET],
                        (uint8_t *)rbuf->pkt->data + TEST_FRAG2_OFFSET,
@@ -445,6 +437,55 @@ static void test_ipv6_ext_frag_reass_out_of_order_rbuf_full(void)
     test_ipv6_ext_frag_reass_out_of_order();
 }
 
+static void test_ipv6_ext_frag_reass_overlap(void)
+{
+    gnrc_pktsnip_t *ipv6_snip = gnrc_ipv6_hdr_build(NULL, &_src, &_dst);
+    gnrc_pktsnip_t *pkt = gnrc_pktbuf_add(ipv6_snip, _test_frag1,
+                                          sizeof(_test_frag1),
+                                          GNRC_NETTYPE_UNDEF);
+    ipv6_hdr_t *ipv6 = ipv6_snip->data;
+    ipv6_ext_frag_t *frag = pkt->data;
+    gnrc_ipv6_ext_frag_rbuf_t *rbuf;
+
+    ipv6->nh = PROTNUM_IPV6_EXT_FRAG;
+    ipv6->hl = TEST_HL;
+    ipv6->len = byteorder_htons(pkt->size);
+    frag->nh = PROTNUM_UDP;
+    frag->resv = 0U;
+    ipv6_ext_frag_set_offset(frag, TEST_FRAG1_OFFSET);
+    ipv6_ext_frag_set_more(frag);
+    frag->id = byteorder_htonl(TEST_ID);
+
+    /* receive 1st fragment */
+    TEST_ASSERT_NULL(gnrc_ipv6_ext_frag_reass(pkt));
+    TEST_ASSERT_NOT_NULL((rbuf = gnrc_ipv6_ext_frag_rbuf_get(ipv6, TEST_ID)));
+    TEST_ASSERT_NOT_NULL(rbuf->pkt);
+
+    /* prepare 2nd fragment overlapping with the 1st */
+    ipv6_snip = gnrc_ipv6_hdr_build(NULL, &_src, &_dst);
+    pkt = gnrc_pktbuf_add(ipv6_snip, _test_frag2,
+                          sizeof(_test_frag2),
+                          GNRC_NETTYPE_UNDEF);
+    ipv6 = ipv6_snip->data;
+    frag = pkt->data;
+
+    ipv6->nh = PROTNUM_IPV6_EXT_FRAG;
+    ipv6->hl = TEST_HL;
+    ipv6->len = byteorder_htons(pkt->size);
+    frag->nh = PROTNUM_UDP;
+    frag->resv = 0U;
+    ipv6_ext_frag_set_offset(frag, TEST_FRAG2_OFFSET - 8U);
+    ipv6_ext_frag_set_more(frag);
+    frag->id = byteorder_htonl(TEST_ID);
+
+    /* receive overlapping fragment */
+    TEST_ASSERT_NULL(gnrc_ipv6_ext_frag_reass(pkt));
+    /* datagram should be discarded */
+    TEST_ASSERT_NULL(rbuf->ipv6);
+    TEST_ASSERT_NULL(rbuf->limits.next);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
 static void test_ipv6_ext_frag_reass_one_frag(void)
 {
     gnrc_pktsnip_t *ipv6_snip = gnrc_ipv6_hdr_build(NULL, &_src, &_dst);
@@ -489,6 +530,7 @@ static void run_unittests(void)
         new_TestFixture(test_ipv6_ext_frag_reass_in_order),
         new_TestFixture(test_ipv6_ext_frag_reass_out_of_order),
         new_TestFixture(test_ipv6_ext_frag_reass_out_of_order_rbuf_full),
+        new_TestFixture(test_ipv6_ext_frag_reass_overlap),
         new_TestFixture(test_ipv6_ext_frag_reass_one_frag),
     };
 
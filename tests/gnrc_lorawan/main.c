@@ -12,6 +12,7 @@
  * @author      Jose I. Alamos <jose.alamos@haw-hamburg.de>
  * @file
  */
+#include <errno.h>
 #include <stdio.h>
 #include <string.h>
 #include "embUnit.h"
@@ -171,6 +172,33 @@ static void test_gnrc_lorawan_fopts__perform_wrong(void)
     TEST_ASSERT(mac.mlme.pending_mlme_opts & GNRC_LORAWAN_MLME_OPTS_LINK_CHECK_REQ);
 }
 
+static void test_gnrc_lorawan__duty_cycle(void)
+{
+    gnrc_lorawan_t mac;
+
+    memset(&mac, 0, sizeof(mac));
+    /* channels in two different 1% sub-bands */
+    mac.channel[0] = 868100000UL;
+    mac.channel[1] = 867100000UL;
+    mac.channel_mask = 0x3;
+    gnrc_lorawan_duty_cycle_init(&mac);
+
+    TEST_ASSERT_EQUAL_INT(0, gnrc_lorawan_duty_cycle_wait(&mac));
+
+    /* 100 ms on air use up the sub-band of channel 0 for 10 s */
+    gnrc_lorawan_duty_cycle_update(&mac, mac.channel[0], 100000);
+    for (unsigned i = 0; i < 10; i++) {
+        TEST_ASSERT_EQUAL_INT(1, gnrc_lorawan_pick_channel(&mac));
+    }
+    TEST_ASSERT_EQUAL_INT(0, gnrc_lorawan_duty_cycle_wait(&mac));
+
+    gnrc_lorawan_duty_cycle_update(&mac, mac.channel[1], 100000);
+    TEST_ASSERT_EQUAL_INT(-EAGAIN, gnrc_lorawan_pick_channel(&mac));
+
+    uint32_t wait = gnrc_lorawan_duty_cycle_wait(&mac);
+    TEST_ASSERT(wait > 9000 && wait <= 10000);
+}
+
 Test *tests_gnrc_lorawan_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -180,6 +208,7 @@ Test *tests_gnrc_lorawan_tests(void)
         new_TestFixture(test_gnrc_lorawan_fopts__mlme_link_check_req),
         new_TestFixture(test_gnrc_lorawan_fopts__perform),
         new_TestFixture(test_gnrc_lorawan_fopts__perform_wrong),
+        new_TestFixture(test_gnrc_lorawan__duty_cycle),
     };
 
     EMB_UNIT_TESTCALLER(gnrc_lorawan_tests, set_up, NULL, fixtures);
@@ -325,6 +325,52 @@ int gnrc_tcp_recv_cmd(int argc, char **argv)
     return 0;
 }
 
+int gnrc_tcp_recv_buf_cmd(int argc, char **argv)
+{
+    dump_args(argc, argv);
+
+    int timeout = atol(argv[1]);
+    size_t to_receive = atol(argv[2]);
+    size_t rcvd = 0;
+
+    do {
+        void *data = NULL;
+        int ret = gnrc_tcp_recv_buf(tcb, &data, timeout);
+        switch (ret) {
+            case 0:
+                printf("%s: returns 0\n", argv[0]);
+                return ret;
+
+            case -EAGAIN:
+                printf("%s: returns -EAGAIN\n", argv[0]);
+                continue;
+
+            case -ETIMEDOUT:
+                printf("%s: returns -ETIMEDOUT\n", argv[0]);
+                continue;
+
+            case -ENOTCONN:
+                printf("%s: returns -ENOTCONN\n", argv[0]);
+                return ret;
+
+            case -ECONNRESET:
+                printf("%s: returns -ECONNRESET\n", argv[0]);
+                return ret;
+
+            case -ECONNABORTED:
+                printf("%s: returns -ECONNABORTED\n", argv[0]);
+                return ret;
+        }
+        size_t len = ((size_t)ret < (to_receive - rcvd)) ? (size_t)ret : (to_receive - rcvd);
+        memcpy(buffer + rcvd, data, len);
+        rcvd += len;
+    } while (rcvd < to_receive);
+    gnrc_tcp_recv_buf_release(tcb);
+
+    printf("%s: received %u\n", argv[0], (unsigned)rcvd);
+    return 0;
+}
+
 int gnrc_tcp_close_cmd(int argc, char **argv)
 {
     dump_args(argc, argv);
@@ -437,6 +483,8 @@ static const shell_command_t shell_commands[] = {
       gnrc_tcp_send_cmd },
     { "gnrc_tcp_recv", "gnrc_tcp: recv data from connected peer",
       gnrc_tcp_recv_cmd },
+    { "gnrc_tcp_recv_buf", "gnrc_tcp: recv data from connected peer without copying",
+      gnrc_tcp_recv_buf_cmd },
     { "gnrc_tcp_close", "gnrc_tcp: close connection gracefully",
       gnrc_tcp_close_cmd },
     { "gnrc_tcp_abort", "gnrc_tcp: close connection forcefully",
@@ -83,6 +83,31 @@ def test_send_data_from_host_to_riot(child):
             riot_srv.close()
 
 
+@Runner(timeout=5)
+def test_recv_buf_data_from_host_to_riot(child):
+    """ Send Data from Host system to RIOT node and receive it in place """
+    # Setup RIOT as server
+    with RiotTcpServer(child, generate_port_number()) as riot_srv:
+        # Setup Host as client
+        with HostTcpClient(riot_srv) as host_cli:
+            # Accept and close connection
+            riot_srv.accept(timeout_ms=1000)
+
+            # Send Data from Host system to RIOT
+            data = '0123456789' * 200
+            host_cli.send(data)
+
+            # Receive via gnrc_tcp_recv_buf and verify that buffered data matches
+            child.sendline('buffer_init')
+            child.sendline('gnrc_tcp_recv_buf 1000 {}'.format(len(data)))
+            child.expect_exact('gnrc_tcp_recv_buf: received {}'.format(len(data)), timeout=20)
+            child.sendline('buffer_read 0 {}'.format(len(data)))
+            child.expect('<begin>(.*)<end>')
+            assert child.match.group(1) == data
+
+            riot_srv.close()
+
+
 @Runner(timeout=5)
 def test_gnrc_tcp_garbage_packets_short_payload(child):
     """ Receive unusually short payload with timeout. Verifies fix for
@@ -0,0 +1,124 @@
+/*
+ * Copyright (C) 2026 Otto-von-Guericke-Universität Magdeburg
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup tests
+ * @{
+ *
+ * @file
+ * @brief       Test application for priority inheritance of msg_send_receive()
+ *
+ * A low priority server handles a request of a high priority client. While
+ * doing so, it wakes up a mid priority thread. With priority inheritance, the
+ * server finishes the request and the client runs before the mid priority
+ * thread.
+ *
+ * @}
+ */
+
+#include <string.h>
+
+#include "fmt.h"
+#include "irq.h"
+#include "msg.h"
+#include "mutex.h"
+#include "thread.h"
+
+static mutex_t mtx_start_mid = MUTEX_INIT_LOCKED;
+
+static char stack_server[THREAD_STACKSIZE_SMALL];
+static char stack_mid[THREAD_STACKSIZE_SMALL];
+static char stack_client[THREAD_STACKSIZE_SMALL];
+
+static kernel_pid_t server_pid;
+
+static char run_order[16] = "";
+static size_t run_order_pos = 0;
+
+static void record(char c)
+{
+    unsigned irq_state = irq_disable();
+    run_order[run_order_pos++] = c;
+    irq_restore(irq_state);
+}
+
+static void *server_handler(void *arg)
+{
+    (void)arg;
+    msg_t m;
+
+    while (1) {
+        msg_receive(&m);
+        print_str("server handles request at prio ");
+        print_u32_dec(thread_get_active()->priority);
+        print_str("\n");
+
+        /* wake up the mid priority thread while handling the request */
+        mutex_unlock(&mtx_start_mid);
+        record('s');
+
+        msg_reply(&m, &m);
+    }
+
+    return NULL;
+}
+
+static void *mid_handler(void *arg)
+{
+    (void)arg;
+    mutex_lock(&mtx_start_mid);
+    record('m');
+    return NULL;
+}
+
+static void *client_handler(void *arg)
+{
+    (void)arg;
+    msg_t m = { .type = 0x1234 };
+
+    msg_send_receive(&m, &m, server_pid);
+    record('c');
+    return NULL;
+}
+
+int main(void)
+{
+    server_pid = thread_create(stack_server, sizeof(stack_server),
+                               THREAD_PRIORITY_MAIN - 1, THREAD_CREATE_STACKTEST,
+                               server_handler, NULL, "server");
+
+    thread_create(stack_mid, sizeof(stack_mid),
+                  THREAD_PRIORITY_MAIN - 2, THREAD_CREATE_STACKTEST,
+                  mid_handler, NULL, "mid");
+
+    /* the client starts right away and sends its request */
+    thread_create(stack_client, sizeof(stack_client),
+                  THREAD_PRIORITY_MAIN - 3, THREAD_CREATE_STACKTEST,
+                  client_handler, NULL, "client");
+
+    print_str("server prio after reply: ");
+    print_u32_dec(thread_get(server_pid)->priority);
+    print_str("\n");
+
+    if ((strcmp("scm", run_order) == 0) &&
+        (thread_get(server_pid)->priority == THREAD_PRIORITY_MAIN - 1)) {
+        print_str("TEST PASSED\n");
+        return 0;
+    }
+    else if (strcmp("msc", run_order) == 0) {
+        print_str("==> Priority inversion occurred\n");
+    }
+    else {
+        print_str("BUG: \"");
+        print_str(run_order);
+        print_str("\"\n");
+    }
+
+    print_str("TEST FAILED\n");
+    return 0;
+}
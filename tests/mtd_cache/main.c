@@ -0,0 +1,239 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       mtd_cache module test
+ *
+ * @}
+ */
+
+#include <stdint.h>
+#include <errno.h>
+#include <string.h>
+
+#include "embUnit.h"
+
+#include "mtd.h"
+#include "mtd_cache.h"
+
+/* Test mock object implementing a simple RAM-based mtd */
+#define SECTOR_COUNT        4
+#define PAGE_PER_SECTOR     4
+#define PAGE_SIZE           64
+#define WRITE_SIZE          4
+
+#define MEMORY_PAGE_COUNT   (PAGE_PER_SECTOR * SECTOR_COUNT)
+#define MEMORY_SIZE         (PAGE_SIZE * MEMORY_PAGE_COUNT)
+
+#define MIN(x, y) (((x) < (y)) ? (x) : (y))
+
+static uint8_t _dummy_memory[MEMORY_SIZE];
+static uint8_t _buffer[PAGE_SIZE];
+static unsigned _reads, _writes;
+
+static int _init(mtd_dev_t *dev)
+{
+    (void)dev;
+
+    return 0;
+}
+
+static int _read_page(mtd_dev_t *dev, void *buff, uint32_t page, uint32_t offset, uint32_t size)
+{
+    uint32_t addr = page * dev->page_size + offset;
+
+    if (page >= dev->sector_count * dev->pages_per_sector) {
+        return -EOVERFLOW;
+    }
+    size = MIN(dev->page_size - offset, size);
+    memcpy(buff, _dummy_memory + addr, size);
+    _reads++;
+
+    return size;
+}
+
+static int _write_page(mtd_dev_t *dev, const void *buff, uint32_t page, uint32_t offset,
+                       uint32_t size)
+{
+    uint32_t addr = page * dev->page_size + offset;
+
+    if (page >= dev->sector_count * dev->pages_per_sector) {
+        return -EOVERFLOW;
+    }
+    size = MIN(dev->page_size - offset, size);
+    /* NOR semantics: only clear bits */
+    for (unsigned i = 0; i < size; i++) {
+        _dummy_memory[addr + i] &= ((const uint8_t *)buff)[i];
+    }
+    _writes++;
+
+    return size;
+}
+
+static int _erase_sector(mtd_dev_t *dev, uint32_t sector, uint32_t count)
+{
+    uint32_t addr = sector * dev->page_size * dev->pages_per_sector;
+
+    if (sector + count > dev->sector_count) {
+        return -EOVERFLOW;
+    }
+    memset(_dummy_memory + addr, 0xff, count * dev->page_size * dev->pages_per_sector);
+
+    return 0;
+}
+
+static const mtd_desc_t driver = {
+    .init = _init,
+    .read_page    = _read_page,
+    .write_page   = _write_page,
+    .erase_sector = _erase_sector,
+};
+
+static mtd_dev_t _dev = {
+    .driver = &driver,
+    .sector_count = SECTOR_COUNT,
+    .pages_per_sector = PAGE_PER_SECTOR,
+    .page_size = PAGE_SIZE,
+    .write_size = WRITE_SIZE,
+};
+
+static mtd_cache_t _cache = MTD_CACHE_INIT(&_dev);
+
+static mtd_dev_t *_cached = &_cache.mtd;
+
+static void test_mtd_cache_init(void)
+{
+    TEST_ASSERT_EQUAL_INT(0, mtd_init(_cached));
+    TEST_ASSERT_EQUAL_INT(SECTOR_COUNT, _cached->sector_count);
+    TEST_ASSERT_EQUAL_INT(PAGE_SIZE, _cached->page_size);
+    TEST_ASSERT_EQUAL_INT(WRITE_SIZE, _cached->write_size);
+}
+
+static void test_mtd_cache_read_hit(void)
+{
+    _dummy_memory[3 * PAGE_SIZE] = 0x42;
+
+    TEST_ASSERT_EQUAL_INT(0, mtd_read_page(_cached, _buffer, 3, 0, PAGE_SIZE));
+    TEST_ASSERT_EQUAL_INT(0x42, _buffer[0]);
+    TEST_ASSERT_EQUAL_INT(1, _reads);
+    /* served from the cache */
+    TEST_ASSERT_EQUAL_INT(0, mtd_read_page(_cached, _buffer, 3, 0, PAGE_SIZE));
+    TEST_ASSERT_EQUAL_INT(0, mtd_read(_cached, _buffer, 3 * PAGE_SIZE + 1, 4));
+    TEST_ASSERT_EQUAL_INT(1, _reads);
+
+    TEST_ASSERT_EQUAL_INT(-EOVERFLOW,
+                          mtd_read_page(_cached, _buffer, MEMORY_PAGE_COUNT, 0, PAGE_SIZE));
+}
+
+static void test_mtd_cache_lru(void)
+{
+    /* fill the cache with scattered pages, so no read-ahead kicks in */
+    for (unsigned i = 0; i < CONFIG_MTD_CACHE_PAGES; i++) {
+        TEST_ASSERT_EQUAL_INT(0, mtd_read_page(_cached, _buffer, 2 * i, 0, 1));
+    }
+    TEST_ASSERT_EQUAL_INT(CONFIG_MTD_CACHE_PAGES, _reads);
+    /* touch page 0, so page 2 is the least recently used one */
+    TEST_ASSERT_EQUAL_INT(0, mtd_read_page(_cached, _buffer, 0, 0, 1));
+    TEST_ASSERT_EQUAL_INT(0, mtd_read_page(_cached, _buffer, 15, 0, 1));
+    TEST_ASSERT_EQUAL_INT(CONFIG_MTD_CACHE_PAGES + 1, _reads);
+    TEST_ASSERT_EQUAL_INT(0, mtd_read_page(_cached, _buffer, 0, 0, 1));
+    TEST_ASSERT_EQUAL_INT(CONFIG_MTD_CACHE_PAGES + 1, _reads);
+    TEST_ASSERT_EQUAL_INT(0, mtd_read_page(_cached, _buffer, 2, 0, 1));
+    TEST_ASSERT_EQUAL_INT(CONFIG_MTD_CACHE_PAGES + 2, _reads);
+}
+
+static void test_mtd_cache_read_ahead(void)
+{
+    TEST_ASSERT_EQUAL_INT(0, mtd_read_page(_cached, _buffer, 8, 0, PAGE_SIZE));
+    TEST_ASSERT_EQUAL_INT(0, mtd_read_page(_cached, _buffer, 9, 0, PAGE_SIZE));
+    TEST_ASSERT_EQUAL_INT(2 + CONFIG_MTD_CACHE_READ_AHEAD, _reads);
+    TEST_ASSERT_EQUAL_INT(0, mtd_read_page(_cached, _buffer, 10, 0, PAGE_SIZE));
+    TEST_ASSERT_EQUAL_INT(2 + 2 * CONFIG_MTD_CACHE_READ_AHEAD, _reads);
+}
+
+static void test_mtd_cache_write_back(void)
+{
+    const uint8_t data[] = { 0xa0, 0xa1, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6, 0xa7 };
+
+    TEST_ASSERT_EQUAL_INT(0, mtd_write_page_raw(_cached, data, 1, 0, 4));
+    TEST_ASSERT_EQUAL_INT(0, mtd_write_page_raw(_cached, data + 4, 1, 4, 4));
+    TEST_ASSERT_EQUAL_INT(0, _writes);
+    TEST_ASSERT_EQUAL_INT(0xff, _dummy_memory[PAGE_SIZE]);
+
+    /* the cached data is read back */
+    TEST_ASSERT_EQUAL_INT(0, mtd_read_page(_cached, _buffer, 1, 0, sizeof(data)));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(data, _buffer, sizeof(data)));
+
+    /* contiguous writes are written back at once */
+    TEST_ASSERT_EQUAL_INT(0, mtd_flush(_cached));
+    TEST_ASSERT_EQUAL_INT(1, _writes);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(data, &_dummy_memory[PAGE_SIZE], sizeof(data)));
+    TEST_ASSERT_EQUAL_INT(0, mtd_flush(_cached));
+    TEST_ASSERT_EQUAL_INT(1, _writes);
+
+    /* a gap in between writes the pending bytes first */
+    TEST_ASSERT_EQUAL_INT(0, mtd_write_page_raw(_cached, data, 1, 16, 4));
+    TEST_ASSERT_EQUAL_INT(0, mtd_write_page_raw(_cached, data, 1, 32, 4));
+    TEST_ASSERT_EQUAL_INT(2, _writes);
+    /* the mock has no power control, but the cache is flushed anyway */
+    TEST_ASSERT_EQUAL_INT(-ENOTSUP, mtd_power(_cached, MTD_POWER_DOWN));
+    TEST_ASSERT_EQUAL_INT(3, _writes);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(data, &_dummy_memory[PAGE_SIZE + 32], 4));
+}
+
+static void test_mtd_cache_erase(void)
+{
+    memset(_buffer, 0x00, PAGE_SIZE);
+    TEST_ASSERT_EQUAL_INT(0, mtd_write_page_raw(_cached, _buffer, 5, 0, PAGE_SIZE));
+    /* the page is completely overwritten, so it isn't read first */
+    TEST_ASSERT_EQUAL_INT(0, _reads);
+
+    /* erasing drops the pending write */
+    TEST_ASSERT_EQUAL_INT(0, mtd_erase_sector(_cached, 1, 1));
+    TEST_ASSERT_EQUAL_INT(0, mtd_flush(_cached));
+    TEST_ASSERT_EQUAL_INT(0, _writes);
+    TEST_ASSERT_EQUAL_INT(0, mtd_read_page(_cached, _buffer, 5, 0, PAGE_SIZE));
+    TEST_ASSERT_EQUAL_INT(0xff, _buffer[0]);
+}
+
+static void set_up(void)
+{
+    memset(_dummy_memory, 0xff, sizeof(_dummy_memory));
+    /* start each test with an empty cache */
+    mtd_init(_cached);
+    _reads = 0;
+    _writes = 0;
+}
+
+Test *tests_mtd_cache_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_mtd_cache_init),
+        new_TestFixture(test_mtd_cache_read_hit),
+        new_TestFixture(test_mtd_cache_lru),
+        new_TestFixture(test_mtd_cache_read_ahead),
+        new_TestFixture(test_mtd_cache_write_back),
+        new_TestFixture(test_mtd_cache_erase),
+    };
+
+    EMB_UNIT_TESTCALLER(mtd_cache_tests, set_up, NULL, fixtures);
+
+    return (Test *)&mtd_cache_tests;
+}
+
+int main(void)
+{
+    TESTS_START();
+    TESTS_RUN(tests_mtd_cache_tests());
+    TESTS_END();
+    return 0;
+}
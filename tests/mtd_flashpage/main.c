@@ -145,6 +145,34 @@ static void test_mtd_write_read(void)
 #endif
 }
 
+#if IS_USED(MODULE_MTD_FLASHPAGE_BUFFERED)
+static void test_mtd_write_buffered(void)
+{
+    const char buf[] __attribute__ ((aligned (FLASHPAGE_WRITE_BLOCK_ALIGNMENT)))
+            = "ABCDEFGHIJKLMNO";
+    char buf_read[2 * sizeof(buf)];
+
+    /* sequential writes are combined, reads see them */
+    int ret = mtd_write(dev, buf, TEST_ADDRESS1, sizeof(buf));
+    TEST_ASSERT_EQUAL_INT(0, ret);
+    ret = mtd_write(dev, buf, TEST_ADDRESS1 + sizeof(buf), sizeof(buf));
+    TEST_ASSERT_EQUAL_INT(0, ret);
+    TEST_ASSERT(_dev.buf_len > 0);
+
+    ret = mtd_read(dev, buf_read, TEST_ADDRESS1, sizeof(buf_read));
+    TEST_ASSERT_EQUAL_INT(0, ret);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(buf, buf_read, sizeof(buf)));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(buf, buf_read + sizeof(buf), sizeof(buf)));
+
+    /* mtd_flush() writes the buffer */
+    ret = mtd_write(dev, buf, TEST_ADDRESS2, sizeof(buf));
+    TEST_ASSERT_EQUAL_INT(0, ret);
+    TEST_ASSERT_EQUAL_INT(0, mtd_flush(dev));
+    TEST_ASSERT_EQUAL_INT(0, _dev.buf_len);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(buf, (void *)(uintptr_t)TEST_ADDRESS2, sizeof(buf)));
+}
+#endif
+
 Test *tests_mtd_flashpage_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -152,6 +180,9 @@ Test *tests_mtd_flashpage_tests(void)
         new_TestFixture(test_mtd_erase),
         new_TestFixture(test_mtd_write_erase),
         new_TestFixture(test_mtd_write_read),
+#if IS_USED(MODULE_MTD_FLASHPAGE_BUFFERED)
+        new_TestFixture(test_mtd_write_buffered),
+#endif
     };
 
     EMB_UNIT_TESTCALLER(mtd_flashpage_tests, setup, teardown, fixtures);
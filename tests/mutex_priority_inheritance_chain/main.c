@@ -0,0 +1,124 @@
+/*
+ * Copyright (C) 2026 Otto-von-Guericke-Universität Magdeburg
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup tests
+ * @{
+ *
+ * @file
+ * @brief       Test application for transitive priority inheritance of mutexes
+ *
+ * @}
+ */
+
+#include <string.h>
+
+#include "fmt.h"
+#include "irq.h"
+#include "mutex.h"
+#include "thread.h"
+
+static mutex_t mtx_a = MUTEX_INIT;
+static mutex_t mtx_b = MUTEX_INIT;
+static mutex_t mtx_start_low = MUTEX_INIT_LOCKED;
+static mutex_t mtx_start_x = MUTEX_INIT_LOCKED;
+
+static char stack_low[THREAD_STACKSIZE_SMALL];
+static char stack_mid[THREAD_STACKSIZE_SMALL];
+static char stack_high[THREAD_STACKSIZE_SMALL];
+static char stack_x[THREAD_STACKSIZE_SMALL];
+
+static char run_order[16] = "";
+static size_t run_order_pos = 0;
+
+static void record(char c)
+{
+    unsigned irq_state = irq_disable();
+    run_order[run_order_pos++] = c;
+    irq_restore(irq_state);
+}
+
+static void *low_handler(void *arg)
+{
+    (void)arg;
+    mutex_lock(&mtx_a);
+    mutex_lock(&mtx_start_low);
+
+    print_str("low runs at prio ");
+    print_u32_dec(thread_get_active()->priority);
+    print_str("\n");
+
+    /* wake up x while still holding A */
+    mutex_unlock(&mtx_start_x);
+    record('l');
+    mutex_unlock(&mtx_a);
+    return NULL;
+}
+
+static void *mid_handler(void *arg)
+{
+    (void)arg;
+    mutex_lock(&mtx_b);
+    mutex_lock(&mtx_a);
+    record('m');
+    mutex_unlock(&mtx_a);
+    mutex_unlock(&mtx_b);
+    return NULL;
+}
+
+static void *high_handler(void *arg)
+{
+    (void)arg;
+    mutex_lock(&mtx_b);
+    record('h');
+    mutex_unlock(&mtx_b);
+    return NULL;
+}
+
+static void *x_handler(void *arg)
+{
+    (void)arg;
+    mutex_lock(&mtx_start_x);
+    record('x');
+    return NULL;
+}
+
+int main(void)
+{
+    /* each thread runs right away until it blocks */
+    thread_create(stack_low, sizeof(stack_low),
+                  THREAD_PRIORITY_MAIN - 1, THREAD_CREATE_STACKTEST,
+                  low_handler, NULL, "low");
+    thread_create(stack_mid, sizeof(stack_mid),
+                  THREAD_PRIORITY_MAIN - 2, THREAD_CREATE_STACKTEST,
+                  mid_handler, NULL, "mid");
+    thread_create(stack_x, sizeof(stack_x),
+                  THREAD_PRIORITY_MAIN - 3, THREAD_CREATE_STACKTEST,
+                  x_handler, NULL, "x");
+    thread_create(stack_high, sizeof(stack_high),
+                  THREAD_PRIORITY_MAIN - 4, THREAD_CREATE_STACKTEST,
+                  high_handler, NULL, "high");
+
+    mutex_unlock(&mtx_start_low);
+
+    if (strcmp("lmhx", run_order) == 0) {
+        print_str("TEST PASSED\n");
+        return 0;
+    }
+    else if (strcmp("xlmh", run_order) == 0) {
+        print_str("==> Priority was not passed on to the owner of A\n");
+    }
+    else {
+        print_str("BUG: \"");
+        print_str(run_order);
+        print_str("\"\n");
+    }
+
+    print_str("TEST FAILED\n");
+    return 0;
+}
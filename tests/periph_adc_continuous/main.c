@@ -0,0 +1,119 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Test application for continuous ADC sampling
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include "irq.h"
+#include "kernel_defines.h"
+#include "periph/adc.h"
+#include "ztimer.h"
+
+#ifndef TEST_LINES
+#define TEST_LINES          (2U)
+#endif
+
+#ifndef TEST_RATE
+#define TEST_RATE           (1000U)
+#endif
+
+#define TEST_SCANS          (32U)
+#define TEST_RUNS           (5U)
+
+static const adc_t lines[TEST_LINES] = {
+    ADC_LINE(0),
+#if TEST_LINES > 1
+    ADC_LINE(1),
+#endif
+};
+
+static uint16_t buf[2 * TEST_SCANS * TEST_LINES];
+static uint32_t sums[TEST_LINES];
+static volatile unsigned halves;
+
+static void _cb(void *arg, const uint16_t *samples, size_t len)
+{
+    (void)arg;
+
+    for (unsigned l = 0; l < TEST_LINES; l++) {
+        sums[l] = 0;
+    }
+    for (size_t i = 0; i < len; i++) {
+        sums[i % TEST_LINES] += samples[i];
+    }
+    halves++;
+}
+
+static const adc_continuous_t params = {
+    .lines = lines,
+    .lines_numof = TEST_LINES,
+    .res = ADC_RES_12BIT,
+    .rate = TEST_RATE,
+    .buf = buf,
+    .len = ARRAY_SIZE(buf),
+    .cb = _cb,
+};
+
+int main(void)
+{
+    for (unsigned l = 0; l < TEST_LINES; l++) {
+        if (adc_init(lines[l]) < 0) {
+            printf("Initialization of ADC_LINE(%u) failed\n", l);
+            return 1;
+        }
+    }
+
+    int res = adc_continuous_start(&params);
+    if (res < 0) {
+        printf("adc_continuous_start() failed: %d\n", res);
+        return 1;
+    }
+
+    for (unsigned run = 0; run < TEST_RUNS; run++) {
+        uint32_t mean[TEST_LINES];
+        unsigned start = halves;
+
+        ztimer_sleep(ZTIMER_MSEC, 1000);
+        unsigned count = halves - start;
+
+        unsigned state = irq_disable();
+        for (unsigned l = 0; l < TEST_LINES; l++) {
+            mean[l] = sums[l] / TEST_SCANS;
+        }
+        irq_restore(state);
+
+        printf("%u halves, %u scans/s:", count, count * TEST_SCANS);
+        for (unsigned l = 0; l < TEST_LINES; l++) {
+            printf(" %" PRIu32, mean[l]);
+        }
+        puts("");
+
+        /* allow for one half of jitter at the start and at the end */
+        if ((count + 2) * TEST_SCANS < TEST_RATE ||
+            (count - 2) * TEST_SCANS > TEST_RATE) {
+            adc_continuous_stop();
+            puts("TEST FAILED");
+            return 1;
+        }
+    }
+
+    adc_continuous_stop();
+    puts("TEST SUCCEEDED");
+
+    return 0;
+}
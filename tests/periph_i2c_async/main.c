@@ -0,0 +1,101 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Test application for asynchronous I2C transactions
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "periph/i2c.h"
+#include "ztimer.h"
+
+#ifndef TEST_I2C_DEV
+#define TEST_I2C_DEV        I2C_DEV(0)
+#endif
+
+#ifndef TEST_I2C_ADDR
+#define TEST_I2C_ADDR       (0x1e)
+#endif
+
+#ifndef TEST_I2C_REG
+#define TEST_I2C_REG        (0x0f)
+#endif
+
+#define TEST_LEN            (4U)
+#define TEST_XFERS          (8U)
+#define TEST_RUNS           (4U)
+
+static const uint8_t reg = TEST_I2C_REG;
+static uint8_t expected[TEST_LEN];
+static uint8_t data[TEST_XFERS][TEST_LEN];
+static i2c_async_xfer_t xfers[TEST_XFERS];
+static volatile unsigned done;
+
+static void _done(void *arg)
+{
+    (void)arg;
+    done++;
+}
+
+int main(void)
+{
+    i2c_acquire(TEST_I2C_DEV);
+    int res = i2c_read_regs(TEST_I2C_DEV, TEST_I2C_ADDR, TEST_I2C_REG,
+                            expected, sizeof(expected), 0);
+    i2c_release(TEST_I2C_DEV);
+    if (res) {
+        printf("Blocking read failed: %d\n", res);
+        return 1;
+    }
+
+    for (unsigned run = 0; run < TEST_RUNS; run++) {
+        unsigned loops = 0;
+
+        memset(data, 0, sizeof(data));
+        done = 0;
+
+        uint32_t start = ztimer_now(ZTIMER_USEC);
+        for (unsigned i = 0; i < TEST_XFERS; i++) {
+            xfers[i] = (i2c_async_xfer_t){
+                .addr = TEST_I2C_ADDR,
+                .out = &reg, .out_len = 1,
+                .in = data[i], .in_len = TEST_LEN,
+                .cb = _done,
+            };
+            i2c_transfer_async(TEST_I2C_DEV, &xfers[i]);
+        }
+        while (done < TEST_XFERS) {
+            loops++;
+        }
+        uint32_t stop = ztimer_now(ZTIMER_USEC);
+
+        for (unsigned i = 0; i < TEST_XFERS; i++) {
+            if (xfers[i].res || memcmp(data[i], expected, TEST_LEN)) {
+                printf("Transaction %u of run %u failed: %d\n", i, run,
+                       xfers[i].res);
+                puts("TEST FAILED");
+                return 1;
+            }
+        }
+        printf("run %u: %" PRIu32 " us, %u loops while waiting\n", run,
+               stop - start, loops);
+    }
+
+    puts("TEST SUCCEEDED");
+
+    return 0;
+}
@@ -0,0 +1,99 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Test application for asynchronous SPI transfers
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "kernel_defines.h"
+#include "periph/spi.h"
+#include "ztimer.h"
+
+#ifndef TEST_SPI_DEV
+#define TEST_SPI_DEV        SPI_DEV(0)
+#endif
+
+#ifndef TEST_SPI_CS
+#define TEST_SPI_CS         SPI_CS_UNDEF
+#endif
+
+#define TEST_LEN            (300U)
+#define TEST_RUNS           (4U)
+
+static uint8_t wbuf[TEST_LEN];
+static uint8_t rbuf[TEST_LEN];
+static volatile unsigned done;
+
+static void _done(void *arg)
+{
+    (void)arg;
+    done++;
+}
+
+int main(void)
+{
+    /* the transfers are chained: a short header, a large and a receive only
+     * chunk that is sent as dummy bytes */
+    spi_async_xfer_t xfers[] = {
+        { .cs = TEST_SPI_CS, .cont = true, .out = wbuf, .in = rbuf, .len = 4 },
+        { .cs = TEST_SPI_CS, .cont = true, .out = wbuf + 4, .in = rbuf + 4,
+          .len = TEST_LEN - 4 - 8 },
+        { .cs = TEST_SPI_CS, .out = NULL, .in = rbuf + TEST_LEN - 8, .len = 8,
+          .cb = _done },
+    };
+    bool failed = false;
+
+    for (unsigned i = 0; i < TEST_LEN; i++) {
+        wbuf[i] = i;
+    }
+    if (TEST_SPI_CS != SPI_CS_UNDEF) {
+        spi_init_cs(TEST_SPI_DEV, TEST_SPI_CS);
+    }
+
+    puts("Connect MOSI to MISO for this test");
+
+    for (unsigned run = 0; run < TEST_RUNS; run++) {
+        unsigned loops = 0;
+
+        memset(rbuf, 0, sizeof(rbuf));
+        done = 0;
+
+        spi_acquire(TEST_SPI_DEV, TEST_SPI_CS, SPI_MODE_0, SPI_CLK_1MHZ);
+        uint32_t start = ztimer_now(ZTIMER_USEC);
+        for (unsigned i = 0; i < ARRAY_SIZE(xfers); i++) {
+            spi_transfer_bytes_async(TEST_SPI_DEV, &xfers[i]);
+        }
+        while (!done) {
+            loops++;
+        }
+        uint32_t dur = ztimer_now(ZTIMER_USEC) - start;
+        spi_release(TEST_SPI_DEV);
+
+        printf("run %u: %"PRIu32" us, %u loops while waiting\n",
+               run, dur, loops);
+
+        if (memcmp(rbuf, wbuf, TEST_LEN - 8)) {
+            puts("received data does not match");
+            failed = true;
+        }
+    }
+
+    puts(failed ? "TEST FAILED" : "TEST SUCCEEDED");
+
+    return 0;
+}
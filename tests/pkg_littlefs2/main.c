@@ -414,6 +414,30 @@ static void tests_littlefs_statvfs(void)
     TEST_ASSERT(stat1.f_bavail > stat2.f_bavail);
 }
 
+#if IS_USED(MODULE_LITTLEFS2_FS_STATS)
+static void tests_littlefs_stats(void)
+{
+    const char buf[] = "TESTSTRING";
+    littlefs2_stats_t stats;
+
+    littlefs2_fs_get_stats(&littlefs_desc, &stats, true);
+
+    int fd = vfs_open("/test-littlefs/test.txt", O_CREAT | O_RDWR, 0);
+    TEST_ASSERT(fd >= 0);
+    TEST_ASSERT_EQUAL_INT(sizeof(buf), vfs_write(fd, buf, sizeof(buf)));
+    TEST_ASSERT_EQUAL_INT(0, vfs_close(fd));
+
+    littlefs2_fs_get_stats(&littlefs_desc, &stats, true);
+    TEST_ASSERT(stats.read.count > 0);
+    TEST_ASSERT(stats.prog.count > 0);
+    TEST_ASSERT(stats.prog.bytes >= sizeof(buf));
+
+    littlefs2_fs_get_stats(&littlefs_desc, &stats, false);
+    TEST_ASSERT_EQUAL_INT(0, stats.read.count);
+    TEST_ASSERT_EQUAL_INT(0, stats.prog.count);
+}
+#endif
+
 Test *tests_littlefs(void)
 {
 #ifndef USE_MTD_0
@@ -429,6 +453,9 @@ Test *tests_littlefs(void)
         new_TestFixture(tests_littlefs_readdir),
         new_TestFixture(tests_littlefs_rename),
         new_TestFixture(tests_littlefs_statvfs),
+#if IS_USED(MODULE_LITTLEFS2_FS_STATS)
+        new_TestFixture(tests_littlefs_stats),
+#endif
     };
 
     EMB_UNIT_TESTCALLER(littlefs_tests, test_littlefs_setup, test_littlefs_teardown, fixtures);
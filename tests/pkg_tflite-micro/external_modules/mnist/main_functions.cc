@@ -32,6 +32,7 @@
 
 #include "blob/digit.h"
 #include "blob/model.tflite.h"
+#include "tflite_arena.h"
 
 #define THRESHOLD       (0.5)
 
@@ -43,10 +44,9 @@ namespace {
     TfLiteTensor* input = nullptr;
     TfLiteTensor* output = nullptr;
 
-    // Create an area of memory to use for input, output, and intermediate arrays.
-    // Finding the minimum value for your model may require some trial and error.
-    constexpr int kTensorArenaSize = 6 * 1024;
-    uint8_t tensor_arena[kTensorArenaSize];
+    // Area of memory to use for input, output, and intermediate arrays, sized
+    // from the model at build time.
+    TFLITE_ARENA_DEFINE(tensor_arena);
 }  // namespace
 
 // The name of this function is important for Arduino compatibility.
@@ -83,7 +83,7 @@ void setup()
 
     // Build an interpreter to run the model with.
     static tflite::MicroInterpreter static_interpreter(
-        model, resolver, tensor_arena, kTensorArenaSize, error_reporter);
+        model, resolver, tensor_arena, sizeof(tensor_arena), error_reporter);
     interpreter = &static_interpreter;
 
     // Allocate memory from the tensor_arena for the model's tensors.
@@ -93,6 +93,12 @@ void setup()
         return;
     }
 
+#if IS_ACTIVE(DEVELHELP)
+    printf("Tensor arena: %u of %u bytes used\n",
+           static_cast<unsigned>(interpreter->arena_used_bytes()),
+           static_cast<unsigned>(sizeof(tensor_arena)));
+#endif
+
     // Obtain pointers to the model's input and output tensors.
     input = interpreter->input(0);
     output = interpreter->output(0);
@@ -0,0 +1,207 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       SenML JSON decoder tests
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <string.h>
+
+#include "embUnit.h"
+#include "senml/json.h"
+
+#define RECORDS_MAX     (4)
+
+typedef struct {
+    senml_attr_t attr;
+    senml_numeric_t value;
+    char name[16];
+    char string[16];
+    bool boolean;
+    char type;
+} record_t;
+
+static senml_json_parser_t parser;
+static record_t records[RECORDS_MAX];
+static unsigned numof;
+
+static const char pack[] =
+    "[{\"bn\":\"urn:dev:ow:10e2073a01080063:\",\"bt\":1276020076,\"bu\":\"A\",\n"
+    "  \"n\":\"voltage\",\"u\":\"V\",\"v\":120.1},\n"
+    "  {\"n\":\"current\",\"t\":-5,\"v\":1.2},\n"
+    "  {\"n\":\"label\",\"vs\":\"caf\\u00e9\",\"ext\":{\"a\":[1,\"]\"]}},\n"
+    "  {\"n\":\"open\",\"vb\":true}]";
+
+static record_t *_add(const senml_attr_t *attr, char type)
+{
+    static record_t overflow;
+    record_t *rec = (numof < RECORDS_MAX) ? &records[numof] : &overflow;
+
+    numof++;
+    rec->attr = *attr;
+    rec->type = type;
+    strncpy(rec->name, attr->name ? attr->name : "", sizeof(rec->name) - 1);
+    return rec;
+}
+
+static void _on_value(void *arg, const senml_value_t *val)
+{
+    (void)arg;
+    _add(&val->attr, 'v')->value = val->value;
+}
+
+static void _on_string(void *arg, const senml_string_value_t *val)
+{
+    (void)arg;
+    record_t *rec = _add(&val->attr, 's');
+    memcpy(rec->string, val->value,
+           (val->len < sizeof(rec->string)) ? val->len : sizeof(rec->string) - 1);
+}
+
+static void _on_bool(void *arg, const senml_bool_value_t *val)
+{
+    (void)arg;
+    _add(&val->attr, 'b')->boolean = val->value;
+}
+
+static const senml_json_cbs_t cbs = {
+    .value = _on_value,
+    .string = _on_string,
+    .boolean = _on_bool,
+};
+
+static void setup(void)
+{
+    memset(records, 0, sizeof(records));
+    numof = 0;
+    senml_json_init(&parser, &cbs, NULL);
+}
+
+static int _parse(const char *json, size_t chunk)
+{
+    size_t len = strlen(json);
+    int res;
+
+    for (size_t pos = 0; pos < len; pos += chunk) {
+        if ((res = senml_json_parse(&parser, &json[pos],
+                                    (len - pos < chunk) ? len - pos : chunk)) < 0) {
+            return res;
+        }
+    }
+    return senml_json_finish(&parser);
+}
+
+static void _check_pack(void)
+{
+    TEST_ASSERT_EQUAL_INT(4, numof);
+
+    TEST_ASSERT_EQUAL_STRING("urn:dev:ow:10e2073a01080063:",
+                             records[0].attr.base_name);
+    TEST_ASSERT_EQUAL_INT(SENML_TYPE_NUMERIC_INT, records[0].attr.base_time.type);
+    TEST_ASSERT(records[0].attr.base_time.value.i == 1276020076);
+    TEST_ASSERT_EQUAL_INT(SENML_UNIT_AMPERE, records[0].attr.base_unit);
+
+    TEST_ASSERT_EQUAL_INT('v', records[0].type);
+    TEST_ASSERT_EQUAL_STRING("voltage", records[0].name);
+    TEST_ASSERT_EQUAL_INT(SENML_UNIT_VOLT, records[0].attr.unit);
+    TEST_ASSERT_EQUAL_INT(SENML_TYPE_NUMERIC_DECFRAC, records[0].value.type);
+    TEST_ASSERT_EQUAL_INT(1201, records[0].value.value.df.m);
+    TEST_ASSERT_EQUAL_INT(-1, records[0].value.value.df.e);
+
+    TEST_ASSERT_EQUAL_INT('v', records[1].type);
+    TEST_ASSERT_EQUAL_STRING("current", records[1].name);
+    TEST_ASSERT_EQUAL_INT(SENML_UNIT_AMPERE, records[1].attr.base_unit);
+    TEST_ASSERT_EQUAL_INT(SENML_UNIT_NONE, records[1].attr.unit);
+    TEST_ASSERT(records[1].attr.time.value.i == -5);
+    TEST_ASSERT_EQUAL_INT(12, records[1].value.value.df.m);
+
+    TEST_ASSERT_EQUAL_INT('s', records[2].type);
+    TEST_ASSERT_EQUAL_STRING("label", records[2].name);
+    TEST_ASSERT_EQUAL_STRING("caf\xc3\xa9", records[2].string);
+
+    TEST_ASSERT_EQUAL_INT('b', records[3].type);
+    TEST_ASSERT_EQUAL_STRING("open", records[3].name);
+    TEST_ASSERT(records[3].boolean);
+}
+
+static void test_senml_json_decode(void)
+{
+    TEST_ASSERT_EQUAL_INT(0, _parse(pack, sizeof(pack)));
+    _check_pack();
+}
+
+static void test_senml_json_decode_chunked(void)
+{
+    /* every chunk boundary must be handled, including inside escapes */
+    for (size_t chunk = 1; chunk < 12; chunk++) {
+        setup();
+        TEST_ASSERT_EQUAL_INT(0, _parse(pack, chunk));
+        _check_pack();
+    }
+}
+
+static void test_senml_json_numbers(void)
+{
+    TEST_ASSERT_EQUAL_INT(0, _parse("[{\"v\":-9223372036854775808},"
+                                    "{\"v\":18446744073709551615},"
+                                    "{\"v\":-2.5E-2},"
+                                    "{\"v\":123456789012345678901234}]", 64));
+    TEST_ASSERT_EQUAL_INT(4, numof);
+    TEST_ASSERT_EQUAL_INT(SENML_TYPE_NUMERIC_INT, records[0].value.type);
+    TEST_ASSERT(records[0].value.value.i == INT64_MIN);
+    TEST_ASSERT_EQUAL_INT(SENML_TYPE_NUMERIC_UINT, records[1].value.type);
+    TEST_ASSERT(records[1].value.value.u == UINT64_MAX);
+    TEST_ASSERT_EQUAL_INT(-25, records[2].value.value.df.m);
+    TEST_ASSERT_EQUAL_INT(-3, records[2].value.value.df.e);
+    TEST_ASSERT_EQUAL_INT(1234567890, records[3].value.value.df.m);
+    TEST_ASSERT_EQUAL_INT(14, records[3].value.value.df.e);
+}
+
+static void test_senml_json_errors(void)
+{
+    TEST_ASSERT_EQUAL_INT(-ENODATA, _parse("[{\"v\":1}", 64));
+    setup();
+    TEST_ASSERT_EQUAL_INT(-EBADMSG, _parse("[{\"v\":01}]", 64));
+    setup();
+    TEST_ASSERT_EQUAL_INT(-EBADMSG, _parse("[{\"v\":\"1\"}]", 64));
+    setup();
+    TEST_ASSERT_EQUAL_INT(-EBADMSG, _parse("[{\"v\":1,\"vb\":true}]", 64));
+    setup();
+    TEST_ASSERT_EQUAL_INT(-ENOTSUP, _parse("[{\"new_\":1,\"v\":1}]", 64));
+    setup();
+    TEST_ASSERT_EQUAL_INT(-ENOBUFS, _parse("[{\"vs\":\"01234567890123456789012345678901"
+                                           "01234567890123456789012345678901\"}]", 64));
+    TEST_ASSERT_EQUAL_INT(0, numof);
+}
+
+Test *tests_senml_json(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_senml_json_decode),
+        new_TestFixture(test_senml_json_decode_chunked),
+        new_TestFixture(test_senml_json_numbers),
+        new_TestFixture(test_senml_json_errors),
+    };
+    EMB_UNIT_TESTCALLER(senml_json_tests, setup, NULL, fixtures);
+    return (Test *)&senml_json_tests;
+}
+
+int main(void)
+{
+    TESTS_START();
+    TESTS_RUN(tests_senml_json());
+    TESTS_END();
+    return 0;
+}
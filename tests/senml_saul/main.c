@@ -24,6 +24,7 @@
 #include "embUnit.h"
 #include "senml/saul.h"
 #include "fmt.h"
+#include "net/nanocoap.h"
 
 #define BUF_SIZE (128)
 
@@ -43,10 +44,61 @@ void test_senml_encode(void)
     TEST_ASSERT_EQUAL_INT(0, strncmp(expect, result, len));
 }
 
+static int _read_dummy(const void *dev, phydat_t *res)
+{
+    (void)dev;
+    res->val[0] = 215;
+    res->val[1] = -3;
+    res->val[2] = 1024;
+    res->unit = UNIT_TEMP_C;
+    res->scale = -1;
+    return 3;
+}
+
+static const saul_driver_t _dummy_driver = {
+    .read = _read_dummy,
+    .write = saul_write_notsup,
+    .type = SAUL_SENSE_TEMP,
+};
+
+/* a registry of its own, so the global one stays empty */
+static saul_reg_t _dummy[] = {
+    { .next = &_dummy[1], .name = "dummy-0", .driver = &_dummy_driver },
+    { .next = NULL, .name = "dummy-1", .driver = &_dummy_driver },
+};
+
+void test_senml_encode_block(void)
+{
+    static uint8_t full[2 * BUF_SIZE];
+    static uint8_t block[16];
+    coap_block_slicer_t slicer;
+    size_t len;
+
+    len = senml_saul_encode_cbor(full, sizeof(full), _dummy);
+    TEST_ASSERT(len > 2 * sizeof(block));
+    TEST_ASSERT(len <= sizeof(full));
+
+    /* the blocks add up to the encoding of the whole registry */
+    for (unsigned blknum = 0; blknum * sizeof(block) < len; blknum++) {
+        size_t offset = blknum * sizeof(block);
+        size_t expected = len - offset;
+
+        if (expected > sizeof(block)) {
+            expected = sizeof(block);
+        }
+        coap_block_slicer_init(&slicer, blknum, sizeof(block));
+        TEST_ASSERT_EQUAL_INT(expected,
+                              senml_saul_encode_cbor_block(&slicer, block, _dummy));
+        TEST_ASSERT_EQUAL_INT(len, slicer.cur);
+        TEST_ASSERT_EQUAL_INT(0, memcmp(block, full + offset, expected));
+    }
+}
+
 Test *tests_senml(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
         new_TestFixture(test_senml_encode),
+        new_TestFixture(test_senml_encode_block),
     };
     EMB_UNIT_TESTCALLER(senml_tests, NULL, NULL, fixtures);
     return (Test *)&senml_tests;
@@ -86,6 +86,32 @@ static void test_crypto_aes_decrypt(void)
                                      AES_BLOCK_SIZE), "wrong plaintext");
 }
 
+static void test_crypto_aes_blocks(void)
+{
+    cipher_context_t ctx;
+    uint8_t data[3 * AES_BLOCK_SIZE];
+
+    /* an odd number of blocks, the bitsliced implementation does pairs */
+    memcpy(&data[0], TEST_0_INP, AES_BLOCK_SIZE);
+    memcpy(&data[AES_BLOCK_SIZE], TEST_0_ENC, AES_BLOCK_SIZE);
+    memcpy(&data[2 * AES_BLOCK_SIZE], TEST_0_INP, AES_BLOCK_SIZE);
+
+    TEST_ASSERT_EQUAL_INT(1, aes_init(&ctx, TEST_0_KEY, sizeof(TEST_0_KEY)));
+    TEST_ASSERT_EQUAL_INT(1, aes_encrypt_blocks(&ctx, data, data, 3));
+    TEST_ASSERT_MESSAGE(1 == compare(TEST_0_ENC, &data[0],
+                                     AES_BLOCK_SIZE), "wrong ciphertext");
+    TEST_ASSERT_MESSAGE(1 == compare(TEST_0_ENC, &data[2 * AES_BLOCK_SIZE],
+                                     AES_BLOCK_SIZE), "wrong ciphertext");
+
+    TEST_ASSERT_EQUAL_INT(1, aes_decrypt_blocks(&ctx, data, data, 3));
+    TEST_ASSERT_MESSAGE(1 == compare(TEST_0_INP, &data[0],
+                                     AES_BLOCK_SIZE), "wrong plaintext");
+    TEST_ASSERT_MESSAGE(1 == compare(TEST_0_ENC, &data[AES_BLOCK_SIZE],
+                                     AES_BLOCK_SIZE), "wrong plaintext");
+    TEST_ASSERT_MESSAGE(1 == compare(TEST_0_INP, &data[2 * AES_BLOCK_SIZE],
+                                     AES_BLOCK_SIZE), "wrong plaintext");
+}
+
 static void test_crypto_aes_init_key_length(void)
 {
     cipher_context_t ctx;
@@ -105,6 +131,7 @@ Test *tests_crypto_aes_tests(void)
         new_TestFixture(test_crypto_aes_encrypt),
         new_TestFixture(test_crypto_aes_decrypt),
         new_TestFixture(test_crypto_aes_init_key_length),
+        new_TestFixture(test_crypto_aes_blocks),
     };
 
     EMB_UNIT_TESTCALLER(crypto_aes_tests, NULL, NULL, fixtures);
@@ -82,10 +82,36 @@ static void test_crypto_chacha20poly1305_1(void)
     _test_chacha20poly1305(key_1, nonce_1, msg_1, sizeof(msg_1), aad_1, sizeof(aad_1));
 }
 
+/* tag of a 300 byte message of the bytes 0x00, 0x01, ..., with key_1, nonce_1
+ * and aad_1, covering more blocks than computed in parallel */
+static const uint8_t tag_2[] = {
+    0x22, 0x3d, 0x83, 0xf2, 0x31, 0xe4, 0x97, 0x49,
+    0x10, 0xda, 0xd8, 0xd0, 0xea, 0xbb, 0x89, 0x2d,
+};
+
+static void test_crypto_chacha20poly1305_2(void)
+{
+    static uint8_t msg[300];
+    size_t len;
+
+    for (unsigned i = 0; i < sizeof(msg); i++) {
+        msg[i] = i;
+    }
+    chacha20poly1305_encrypt(ebuf, msg, sizeof(msg), aad_1, sizeof(aad_1),
+                             key_1, nonce_1);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(ebuf + sizeof(msg), tag_2, sizeof(tag_2)));
+    TEST_ASSERT_EQUAL_INT(1,
+            chacha20poly1305_decrypt(ebuf, sizeof(msg) + 16, pbuf, &len,
+                                     aad_1, sizeof(aad_1), key_1, nonce_1));
+    TEST_ASSERT_EQUAL_INT(sizeof(msg), len);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(pbuf, msg, sizeof(msg)));
+}
+
 Test *tests_crypto_chacha20poly1305_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
         new_TestFixture(test_crypto_chacha20poly1305_1),
+        new_TestFixture(test_crypto_chacha20poly1305_2),
     };
     EMB_UNIT_TESTCALLER(crypto_chacha20poly1305_tests, NULL, NULL, fixtures);
     return (Test *) &crypto_chacha20poly1305_tests;
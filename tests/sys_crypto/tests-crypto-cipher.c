@@ -11,6 +11,9 @@
 
 #include "embUnit.h"
 #include "crypto/ciphers.h"
+#include "crypto/modes/cbc.h"
+#include "crypto/modes/ctr.h"
+#include "crypto/modes/ecb.h"
 #include "tests-crypto.h"
 
 static uint8_t TEST_KEY[] = {
@@ -75,12 +78,104 @@ static void test_crypto_cipher_init_aes_key_length(void)
     TEST_ASSERT_EQUAL_INT(CIPHER_ERR_INVALID_KEY_SIZE, err);
 }
 
+/* mock of an engine with a bulk operation, wrapping AES in software */
+static unsigned _bulk_calls;
+
+static int _bulk_init(cipher_context_t *ctx, const uint8_t *key, uint8_t key_size)
+{
+    return CIPHER_AES_SW->init(ctx, key, key_size);
+}
+
+static int _bulk_encrypt(const cipher_context_t *ctx, const uint8_t *in,
+                         uint8_t *out)
+{
+    return CIPHER_AES_SW->encrypt(ctx, in, out);
+}
+
+static int _bulk_decrypt(const cipher_context_t *ctx, const uint8_t *in,
+                         uint8_t *out)
+{
+    return CIPHER_AES_SW->decrypt(ctx, in, out);
+}
+
+static int _bulk_encrypt_blocks(const cipher_context_t *ctx, const uint8_t *in,
+                                uint8_t *out, size_t blocks)
+{
+    _bulk_calls++;
+    for (size_t i = 0; i < blocks; i++) {
+        CIPHER_AES_SW->encrypt(ctx, in + 16 * i, out + 16 * i);
+    }
+    return 1;
+}
+
+static int _bulk_decrypt_blocks(const cipher_context_t *ctx, const uint8_t *in,
+                                uint8_t *out, size_t blocks)
+{
+    _bulk_calls++;
+    for (size_t i = 0; i < blocks; i++) {
+        CIPHER_AES_SW->decrypt(ctx, in + 16 * i, out + 16 * i);
+    }
+    return 1;
+}
+
+static const cipher_interface_t _bulk_interface = {
+    .block_size = 16,
+    .init = _bulk_init,
+    .encrypt = _bulk_encrypt,
+    .decrypt = _bulk_decrypt,
+    .encrypt_blocks = _bulk_encrypt_blocks,
+    .decrypt_blocks = _bulk_decrypt_blocks,
+};
+
+static void test_crypto_cipher_blocks(void)
+{
+    cipher_t sw, bulk;
+    uint8_t input[100], expected[sizeof(input)], output[sizeof(input)];
+    uint8_t iv[16] = { 0 }, ctr_sw[16] = { 0 }, ctr_bulk[16] = { 0 };
+
+    for (unsigned i = 0; i < sizeof(input); i++) {
+        input[i] = i;
+    }
+    TEST_ASSERT_EQUAL_INT(1, cipher_init(&sw, CIPHER_AES_SW, TEST_KEY, 16));
+    TEST_ASSERT_EQUAL_INT(1, cipher_init(&bulk, &_bulk_interface, TEST_KEY, 16));
+    TEST_ASSERT(cipher_supports_blocks(&sw));
+    TEST_ASSERT(cipher_supports_blocks(&bulk));
+
+    _bulk_calls = 0;
+    TEST_ASSERT_EQUAL_INT(96, cipher_encrypt_ecb(&sw, input, 96, expected));
+    TEST_ASSERT_EQUAL_INT(96, cipher_encrypt_ecb(&bulk, input, 96, output));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(expected, output, 96));
+    TEST_ASSERT_EQUAL_INT(96, cipher_decrypt_ecb(&bulk, expected, 96, output));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(input, output, 96));
+    TEST_ASSERT_EQUAL_INT(2, _bulk_calls);
+
+    /* the counter is advanced the same way, the odd length as well */
+    _bulk_calls = 0;
+    TEST_ASSERT_EQUAL_INT(sizeof(input),
+                          cipher_encrypt_ctr(&sw, ctr_sw, 8, input,
+                                             sizeof(input), expected));
+    TEST_ASSERT_EQUAL_INT(sizeof(input),
+                          cipher_encrypt_ctr(&bulk, ctr_bulk, 8, input,
+                                             sizeof(input), output));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(expected, output, sizeof(input)));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(ctr_sw, ctr_bulk, sizeof(ctr_sw)));
+    TEST_ASSERT_EQUAL_INT(2, _bulk_calls);
+
+    /* CBC decrypts in bulk, encryption is chained */
+    _bulk_calls = 0;
+    TEST_ASSERT_EQUAL_INT(96, cipher_encrypt_cbc(&sw, iv, input, 96, expected));
+    TEST_ASSERT_EQUAL_INT(96, cipher_decrypt_cbc(&bulk, iv, expected, 96, output));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(input, output, 96));
+    TEST_ASSERT_EQUAL_INT(1, _bulk_calls);
+}
+
 Test *tests_crypto_cipher_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
         new_TestFixture(test_crypto_cipher_aes_encrypt),
         new_TestFixture(test_crypto_cipher_aes_decrypt),
         new_TestFixture(test_crypto_cipher_init_aes_key_length),
+        new_TestFixture(test_crypto_cipher_blocks),
     };
 
     EMB_UNIT_TESTCALLER(crypto_cipher_tests, NULL, NULL, fixtures);
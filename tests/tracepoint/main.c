@@ -0,0 +1,65 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       tracepoint module test application
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "trace.h"
+#include "tracepoint.h"
+#include "ztimer.h"
+
+static const tracepoint_t *_find(const char *name, unsigned *idx)
+{
+    const tracepoint_t *tp;
+
+    for (unsigned i = 0; (tp = tracepoint_get(i)); i++) {
+        if (!strcmp(tp->name, name)) {
+            *idx = i;
+            return tp;
+        }
+    }
+    return NULL;
+}
+
+int main(void)
+{
+    unsigned idx;
+    const tracepoint_t *tp = _find("test", &idx);
+
+    for (unsigned i = 0; i < 3; i++) {
+        TRACEPOINT(test, i);
+    }
+    printf("disabled: %" PRIu32 "\n", tp->hits);
+
+    printf("enabled: %u\n", tracepoint_enable("test", true));
+    TRACEPOINT(test, 0x42);
+    tracepoint_enable("test", false);
+    TRACEPOINT(test, 0x43);
+    printf("hits: %" PRIu32 "\n", tp->hits);
+    printf("value: 0x%08" PRIx32 "\n", ((uint32_t)idx << 24) | 0x42);
+    trace_dump();
+
+    tracepoint_enable("sched_run", true);
+    ztimer_sleep(ZTIMER_USEC, 1000);
+    tracepoint_enable(NULL, false);
+    tp = _find("sched_run", &idx);
+    printf("sched_run: %s\n", (tp && tp->hits) ? "hit" : "not hit");
+
+    return 0;
+}
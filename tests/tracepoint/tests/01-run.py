@@ -0,0 +1,18 @@
+#!/usr/bin/env python3
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    child.expect_exact("disabled: 0\r\n")
+    child.expect_exact("enabled: 1\r\n")
+    child.expect_exact("hits: 1\r\n")
+    child.expect(r"value: (0x[0-9a-f]{8})\r\n")
+    value = child.match.group(1)
+    child.expect(r"n=   0 t=\ +\d+ v=" + value + r"\r\n")
+    child.expect_exact("sched_run: hit\r\n")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
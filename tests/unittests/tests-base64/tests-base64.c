@@ -502,6 +502,107 @@ static void test_base64_13_size_estimation(void) {
     }
 }
 
+static void test_base64_14_ctx_chunked(void)
+{
+    static const char data_in[] = "Hello RIOT this is a base64 test!\n"
+                                  "This should work as intended.";
+    static const char expected_encoding[] =
+        "SGVsbG8gUklPVCB0aGlzIGlzIGEgYmFzZTY0IHR"
+        "lc3QhClRoaXMgc2hvdWxkIHdvcmsgYXMgaW50ZW5kZWQu";
+    const size_t data_in_size = strlen(data_in);
+    const size_t encoded_size = strlen(expected_encoding);
+
+    for (size_t chunk = 1; chunk <= 7; chunk++) {
+        base64_encode_ctx_t ectx;
+        base64_decode_ctx_t dctx;
+        char encoded[sizeof(expected_encoding) + 4];
+        char decoded[sizeof(data_in) + 2];
+        size_t pos = 0;
+        size_t size;
+
+        base64_encode_init(&ectx);
+        for (size_t i = 0; i < data_in_size; i += chunk) {
+            size_t len = (data_in_size - i < chunk) ? data_in_size - i : chunk;
+
+            size = sizeof(encoded) - pos;
+            TEST_ASSERT_EQUAL_INT(BASE64_SUCCESS,
+                                  base64_encode_update(&ectx, data_in + i, len,
+                                                       encoded + pos, &size));
+            pos += size;
+        }
+        size = sizeof(encoded) - pos;
+        TEST_ASSERT_EQUAL_INT(BASE64_SUCCESS,
+                              base64_encode_finish(&ectx, encoded + pos, &size));
+        pos += size;
+        TEST_ASSERT_EQUAL_INT(encoded_size, pos);
+        TEST_ASSERT_EQUAL_INT(0, memcmp(expected_encoding, encoded, pos));
+
+        /* decode with a newline after every chunk */
+        base64_decode_init(&dctx);
+        pos = 0;
+        for (size_t i = 0; i < encoded_size; i += chunk) {
+            size_t len = (encoded_size - i < chunk) ? encoded_size - i : chunk;
+
+            size = sizeof(decoded) - pos;
+            TEST_ASSERT_EQUAL_INT(BASE64_SUCCESS,
+                                  base64_decode_update(&dctx, encoded + i, len,
+                                                       decoded + pos, &size));
+            pos += size;
+            size = sizeof(decoded) - pos;
+            TEST_ASSERT_EQUAL_INT(BASE64_SUCCESS,
+                                  base64_decode_update(&dctx, "\n", 1,
+                                                       decoded + pos, &size));
+            pos += size;
+        }
+        size = sizeof(decoded) - pos;
+        TEST_ASSERT_EQUAL_INT(BASE64_SUCCESS,
+                              base64_decode_finish(&dctx, decoded + pos, &size));
+        pos += size;
+        TEST_ASSERT_EQUAL_INT(data_in_size, pos);
+        TEST_ASSERT_EQUAL_INT(0, memcmp(data_in, decoded, pos));
+    }
+}
+
+static void test_base64_15_ctx_urlsafe(void)
+{
+    static const uint8_t data_in[] = { 0xfb, 0xff, 0xbf, 0xfe };
+    base64_encode_ctx_t ctx;
+    char encoded[8];
+    size_t size = 0;
+
+    base64url_encode_init(&ctx);
+    /* only complete groups of three bytes are encoded */
+    TEST_ASSERT_EQUAL_INT(BASE64_ERROR_BUFFER_OUT_SIZE,
+                          base64_encode_update(&ctx, data_in, sizeof(data_in),
+                                               encoded, &size));
+    TEST_ASSERT_EQUAL_INT(4, size);
+    TEST_ASSERT_EQUAL_INT(BASE64_SUCCESS,
+                          base64_encode_update(&ctx, data_in, sizeof(data_in),
+                                               encoded, &size));
+    TEST_ASSERT_EQUAL_INT(0, memcmp("-_-_", encoded, 4));
+
+    /* no padding with the URL safe alphabet */
+    size = sizeof(encoded) - 4;
+    TEST_ASSERT_EQUAL_INT(BASE64_SUCCESS,
+                          base64_encode_finish(&ctx, encoded + 4, &size));
+    TEST_ASSERT_EQUAL_INT(2, size);
+    TEST_ASSERT_EQUAL_INT(0, memcmp("_g", encoded + 4, 2));
+
+    /* a single code left cannot be decoded */
+    base64_decode_ctx_t dctx;
+    uint8_t decoded[4];
+
+    base64_decode_init(&dctx);
+    size = sizeof(decoded);
+    TEST_ASSERT_EQUAL_INT(BASE64_SUCCESS,
+                          base64_decode_update(&dctx, "-_-_x", 5, decoded, &size));
+    TEST_ASSERT_EQUAL_INT(3, size);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(data_in, decoded, 3));
+    size = sizeof(decoded);
+    TEST_ASSERT_EQUAL_INT(BASE64_ERROR_DATA_IN_SIZE,
+                          base64_decode_finish(&dctx, decoded, &size));
+}
+
 Test *tests_base64_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -519,6 +620,8 @@ Test *tests_base64_tests(void)
         new_TestFixture(test_base64_11_urlsafe_encode_int),
         new_TestFixture(test_base64_12_urlsafe_decode_int),
         new_TestFixture(test_base64_13_size_estimation),
+        new_TestFixture(test_base64_14_ctx_chunked),
+        new_TestFixture(test_base64_15_ctx_urlsafe),
     };
 
     EMB_UNIT_TESTCALLER(base64_tests, NULL, NULL, fixtures);
@@ -13,6 +13,7 @@
 
 #include "hashes.h"
 #include "bloom.h"
+#include "bloom_blocked.h"
 #include "bitfield.h"
 
 #include "tests-bloom-sets.h"
@@ -23,6 +24,9 @@
 #define TESTS_BLOOM_NOT_IN_FILTER (996)
 #define TESTS_BLOOM_FALSE_POS_RATE_THR (0.005)
 
+#define TESTS_BLOOM_BLOCKED_SIZE (2 * BLOOM_BLOCKED_BLOCK_SIZE)
+#define TESTS_BLOOM_BLOCKED_K (6)
+
 static bloom_t bloom;
 BITFIELD(bf, TESTS_BLOOM_BITS);
 hashfp_t hashes[TESTS_BLOOM_HASHF] = {
@@ -34,6 +38,11 @@ hashfp_t hashes[TESTS_BLOOM_HASHF] = {
                      (hashfp_t) dek_hash,
                     };
 
+static bloom_blocked_t bloom_blocked;
+static bloom_counting_t bloom_counting;
+static uint8_t blocked_buf[TESTS_BLOOM_BLOCKED_SIZE];
+static uint8_t counting_buf[TESTS_BLOOM_BLOCKED_SIZE];
+
 static void load_dictionary_fixture(void)
 {
     for (int i = 0; i < lenB; i++)
@@ -85,6 +94,116 @@ static void test_bloom_based_on_dictionary_fixture(void)
     TEST_ASSERT(false_positive_rate < TESTS_BLOOM_FALSE_POS_RATE_THR);
 }
 
+static void set_up_bloom_blocked(void)
+{
+    bloom_blocked_init(&bloom_blocked, blocked_buf, sizeof(blocked_buf),
+                       TESTS_BLOOM_BLOCKED_K);
+    bloom_counting_init(&bloom_counting, counting_buf, sizeof(counting_buf),
+                        TESTS_BLOOM_BLOCKED_K);
+}
+
+static int count_in(bool (*check)(const char *))
+{
+    int in = 0;
+
+    for (int i = 0; i < lenA; i++) {
+        if (check(A[i])) {
+            in++;
+        }
+    }
+    return in;
+}
+
+static bool check_blocked(const char *s)
+{
+    return bloom_blocked_check(&bloom_blocked, s, strlen(s));
+}
+
+static bool check_counting(const char *s)
+{
+    return bloom_counting_check(&bloom_counting, s, strlen(s));
+}
+
+static void test_bloom_blocked_parameters(void)
+{
+    TEST_ASSERT_EQUAL_INT(2, bloom_blocked.numof);
+    TEST_ASSERT_EQUAL_INT(TESTS_BLOOM_BLOCKED_K, bloom_blocked.k);
+    TEST_ASSERT_EQUAL_INT(0, count_in(check_blocked));
+}
+
+static void test_bloom_blocked_hash(void)
+{
+    TEST_ASSERT(bloom_blocked_hash("foo", 3) == bloom_blocked_hash("foo", 3));
+    TEST_ASSERT(bloom_blocked_hash("foo", 3) != bloom_blocked_hash("fop", 3));
+    TEST_ASSERT(bloom_blocked_hash("", 0) != bloom_blocked_hash("\0", 1));
+}
+
+static void test_bloom_blocked_based_on_dictionary_fixture(void)
+{
+    for (int i = 0; i < lenB; i++) {
+        bloom_blocked_add(&bloom_blocked, B[i], strlen(B[i]));
+    }
+    for (int i = 0; i < lenB; i++) {
+        TEST_ASSERT(bloom_blocked_check(&bloom_blocked, B[i], strlen(B[i])));
+    }
+
+    double false_positive_rate = (double)count_in(check_blocked) / lenA;
+    TEST_ASSERT(false_positive_rate < TESTS_BLOOM_FALSE_POS_RATE_THR);
+}
+
+static void test_bloom_counting_remove(void)
+{
+    for (int i = 0; i < lenB; i++) {
+        bloom_counting_add(&bloom_counting, B[i], strlen(B[i]));
+    }
+    /* add the first element a second time */
+    bloom_counting_add(&bloom_counting, B[0], strlen(B[0]));
+
+    double false_positive_rate = (double)count_in(check_counting) / lenA;
+    TEST_ASSERT(false_positive_rate < TESTS_BLOOM_FALSE_POS_RATE_THR);
+
+    for (int i = 1; i < lenB; i++) {
+        bloom_counting_remove(&bloom_counting, B[i], strlen(B[i]));
+        TEST_ASSERT(bloom_counting_check(&bloom_counting, B[0], strlen(B[0])));
+    }
+    bloom_counting_remove(&bloom_counting, B[0], strlen(B[0]));
+    TEST_ASSERT(bloom_counting_check(&bloom_counting, B[0], strlen(B[0])));
+    bloom_counting_remove(&bloom_counting, B[0], strlen(B[0]));
+
+    /* all counters are back to zero */
+    for (unsigned i = 0; i < sizeof(counting_buf); i++) {
+        TEST_ASSERT_EQUAL_INT(0, counting_buf[i]);
+    }
+}
+
+static void test_bloom_counting_saturation(void)
+{
+    for (int i = 0; i < 20; i++) {
+        bloom_counting_add(&bloom_counting, "foo", 3);
+    }
+    for (int i = 0; i < 20; i++) {
+        bloom_counting_remove(&bloom_counting, "foo", 3);
+    }
+    /* saturated counters are never decremented */
+    TEST_ASSERT(bloom_counting_check(&bloom_counting, "foo", 3));
+}
+
+Test *tests_bloom_blocked_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_bloom_blocked_parameters),
+        new_TestFixture(test_bloom_blocked_hash),
+        new_TestFixture(test_bloom_blocked_based_on_dictionary_fixture),
+        new_TestFixture(test_bloom_counting_remove),
+        new_TestFixture(test_bloom_counting_saturation),
+    };
+
+    EMB_UNIT_TESTCALLER(bloom_blocked_tests, set_up_bloom_blocked, NULL,
+                        fixtures);
+
+    return (Test *)&bloom_blocked_tests;
+}
+
 Test *tests_bloom_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -100,4 +219,5 @@ Test *tests_bloom_tests(void)
 void tests_bloom(void)
 {
     TESTS_RUN(tests_bloom_tests());
+    TESTS_RUN(tests_bloom_blocked_tests());
 }
@@ -36,6 +36,13 @@ void tests_bloom(void);
  */
 Test *tests_bloom_tests(void);
 
+/**
+ * @brief   Generates tests for the blocked and counting bloom filters
+ *
+ * @return  embUnit tests if successful, NULL if not.
+ */
+Test *tests_bloom_blocked_tests(void);
+
 #ifdef __cplusplus
 }
 #endif
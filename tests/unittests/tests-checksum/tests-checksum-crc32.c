@@ -56,6 +56,19 @@ static void test_checksum_crc32_sequence_4bytes(void)
     TEST_ASSERT_EQUAL_INT(expect, crc32(buf, sizeof(buf)));
 }
 
+static void test_checksum_crc32_sequence_unaligned(void)
+{
+    unsigned char buf[256];
+
+    for (unsigned i = 0; i < sizeof(buf); i++) {
+        buf[i] = i;
+    }
+
+    /* leaves a tail of bytes after the blocks of the slicing variants */
+    TEST_ASSERT_EQUAL_INT(0xd0161f87, crc32(&buf[1], 255));
+    TEST_ASSERT_EQUAL_INT(0x7594f01a, crc32(&buf[3], 13));
+}
+
 Test *tests_checksum_crc32_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -64,6 +77,7 @@ Test *tests_checksum_crc32_tests(void)
         new_TestFixture(test_checksum_crc32_sequence_256a),
         new_TestFixture(test_checksum_crc32_sequence_1to9),
         new_TestFixture(test_checksum_crc32_sequence_4bytes),
+        new_TestFixture(test_checksum_crc32_sequence_unaligned),
     };
 
     EMB_UNIT_TESTCALLER(checksum_crc32_tests, NULL, NULL, fixtures);
@@ -100,11 +100,95 @@ static void test_crb_add_while_consume(void)
     TEST_ASSERT_EQUAL_STRING("HelloWorld", buf_out);
 }
 
+static void test_crb_reserve_and_peek(void)
+{
+    size_t len;
+    uint8_t buffer[16];
+    char buf_out[8];
+    chunk_ringbuf_t cb;
+    void *data;
+    char *chunk;
+
+    crb_init(&cb, buffer, sizeof(buffer));
+
+    TEST_ASSERT(!crb_peek_chunk(&cb, &data, &len));
+    TEST_ASSERT_NULL(crb_reserve_chunk(&cb, sizeof(buffer) + 1));
+
+    chunk = crb_reserve_chunk(&cb, 8);
+    TEST_ASSERT(chunk == (char *)buffer);
+    memcpy(chunk, "one", 4);
+    TEST_ASSERT(crb_commit_chunk(&cb, 4));
+
+    TEST_ASSERT(crb_add_chunk(&cb, "two", 4));
+
+    /* only 8 bytes left */
+    TEST_ASSERT_NULL(crb_reserve_chunk(&cb, 9));
+    chunk = crb_reserve_chunk(&cb, 8);
+    TEST_ASSERT(chunk == (char *)&buffer[8]);
+    memcpy(chunk, "three", 6);
+    TEST_ASSERT(crb_commit_chunk(&cb, 6));
+
+    TEST_ASSERT(crb_peek_chunk(&cb, &data, &len));
+    TEST_ASSERT(data == buffer);
+    TEST_ASSERT_EQUAL_INT(4, len);
+    TEST_ASSERT_EQUAL_STRING("one", data);
+    TEST_ASSERT(crb_consume_chunk(&cb, NULL, 0));
+
+    /* the chunk does not fit behind "three", so it is placed at the start */
+    chunk = crb_reserve_chunk(&cb, 4);
+    TEST_ASSERT(chunk == (char *)buffer);
+    memcpy(chunk, "four", 4);
+    TEST_ASSERT(!crb_end_chunk(&cb, false));
+    chunk = crb_reserve_chunk(&cb, 4);
+    TEST_ASSERT(chunk == (char *)buffer);
+    memcpy(chunk, "four", 4);
+    TEST_ASSERT(crb_commit_chunk(&cb, 4));
+    TEST_ASSERT_NULL(crb_reserve_chunk(&cb, 1));
+
+    TEST_ASSERT(crb_peek_chunk(&cb, &data, &len));
+    TEST_ASSERT(data == &buffer[4]);
+    TEST_ASSERT_EQUAL_STRING("two", data);
+    TEST_ASSERT(crb_consume_chunk(&cb, NULL, 0));
+
+    TEST_ASSERT(crb_peek_chunk(&cb, &data, &len));
+    TEST_ASSERT_EQUAL_INT(6, len);
+    TEST_ASSERT_EQUAL_STRING("three", data);
+    TEST_ASSERT(crb_consume_chunk(&cb, NULL, 0));
+
+    TEST_ASSERT(crb_get_chunk_size(&cb, &len));
+    TEST_ASSERT_EQUAL_INT(4, len);
+    memset(buf_out, 0, sizeof(buf_out));
+    TEST_ASSERT(crb_consume_chunk(&cb, buf_out, sizeof(buf_out)));
+    TEST_ASSERT_EQUAL_STRING("four", buf_out);
+    TEST_ASSERT(!crb_peek_chunk(&cb, &data, &len));
+}
+
+static void test_crb_peek_wrapped(void)
+{
+    size_t len;
+    uint8_t buffer[16];
+    chunk_ringbuf_t cb;
+    void *data;
+
+    crb_init(&cb, buffer, sizeof(buffer));
+
+    TEST_ASSERT(crb_add_chunk(&cb, "Hello World!", 13));
+    TEST_ASSERT(crb_consume_chunk(&cb, NULL, 0));
+    TEST_ASSERT(crb_add_chunk(&cb, "wrapped", 8));
+
+    /* the chunk was copied in byte by byte and wraps around */
+    TEST_ASSERT(!crb_peek_chunk(&cb, &data, &len));
+    TEST_ASSERT(data == &buffer[13]);
+    TEST_ASSERT_EQUAL_INT(8, len);
+}
+
 static Test *chunked_ringbuffer_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
         new_TestFixture(test_crb_add_and_consume),
         new_TestFixture(test_crb_add_while_consume),
+        new_TestFixture(test_crb_reserve_and_peek),
+        new_TestFixture(test_crb_peek_wrapped),
     };
 
     EMB_UNIT_TESTCALLER(crb_tests, NULL, NULL, fixtures);
@@ -0,0 +1,111 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+#include <string.h>
+
+#include "embUnit.h"
+
+#include "priority_heap.h"
+
+#include "tests-core.h"
+
+#define H_LEN (8)
+
+static priority_heap_t h = PRIORITY_HEAP_INIT;
+static priority_heap_node_t he[H_LEN];
+
+static void set_up(void)
+{
+    priority_heap_init(&h);
+    for (unsigned i = 0; i < ARRAY_SIZE(he); ++i) {
+        priority_heap_node_init(&(he[i]));
+        he[i].data = i;
+    }
+}
+
+static void test_priority_heap_remove_head_empty(void)
+{
+    TEST_ASSERT_NULL(priority_heap_peek(&h));
+    TEST_ASSERT_NULL(priority_heap_remove_head(&h));
+}
+
+static void test_priority_heap_remove_head_one(void)
+{
+    priority_heap_add(&h, &he[1]);
+
+    TEST_ASSERT(priority_heap_peek(&h) == &he[1]);
+    TEST_ASSERT(priority_heap_remove_head(&h) == &he[1]);
+    TEST_ASSERT_NULL(priority_heap_remove_head(&h));
+}
+
+static void test_priority_heap_order(void)
+{
+    static const uint32_t prio[H_LEN] = { 5, 3, 7, 3, 0, 5, 9, 1 };
+    static const unsigned order[H_LEN] = { 4, 7, 1, 3, 0, 5, 2, 6 };
+
+    for (unsigned i = 0; i < H_LEN; i++) {
+        he[i].priority = prio[i];
+        priority_heap_add(&h, &he[i]);
+    }
+
+    for (unsigned i = 0; i < H_LEN; i++) {
+        priority_heap_node_t *res = priority_heap_remove_head(&h);
+        TEST_ASSERT_NOT_NULL(res);
+        TEST_ASSERT_EQUAL_INT(order[i], res->data);
+    }
+    TEST_ASSERT_NULL(priority_heap_remove_head(&h));
+}
+
+static void test_priority_heap_add_two_equal(void)
+{
+    he[1].priority = 4;
+    he[2].priority = 4;
+
+    priority_heap_add(&h, &he[1]);
+    priority_heap_add(&h, &he[2]);
+
+    TEST_ASSERT(priority_heap_remove_head(&h) == &he[1]);
+    TEST_ASSERT(priority_heap_remove_head(&h) == &he[2]);
+}
+
+static void test_priority_heap_remove(void)
+{
+    for (unsigned i = 0; i < H_LEN; i++) {
+        he[i].priority = H_LEN - i;
+        priority_heap_add(&h, &he[i]);
+    }
+    /* force a tree with more than one level */
+    TEST_ASSERT(priority_heap_remove_head(&h) == &he[H_LEN - 1]);
+
+    priority_heap_remove(&h, &he[3]);
+    priority_heap_remove(&h, &he[H_LEN - 2]);
+    /* removing a node twice does nothing */
+    priority_heap_remove(&h, &he[3]);
+
+    for (int i = H_LEN - 3; i >= 0; i--) {
+        if (i == 3) {
+            continue;
+        }
+        TEST_ASSERT(priority_heap_remove_head(&h) == &he[i]);
+    }
+    TEST_ASSERT_NULL(priority_heap_remove_head(&h));
+}
+
+Test *tests_core_priority_heap_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_priority_heap_remove_head_empty),
+        new_TestFixture(test_priority_heap_remove_head_one),
+        new_TestFixture(test_priority_heap_order),
+        new_TestFixture(test_priority_heap_add_two_equal),
+        new_TestFixture(test_priority_heap_remove),
+    };
+
+    EMB_UNIT_TESTCALLER(core_priority_heap_tests, set_up, NULL, fixtures);
+
+    return (Test *)&core_priority_heap_tests;
+}
@@ -0,0 +1,215 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+#include "embUnit.h"
+
+#include "kernel_defines.h"
+#include "rbtree.h"
+
+#include "tests-core.h"
+
+#define T_LEN (16)
+
+typedef struct {
+    rbtree_node_t node;
+    unsigned key;
+    unsigned data;
+} entry_t;
+
+static entry_t te[T_LEN];
+
+static int _cmp(const rbtree_node_t *a, const rbtree_node_t *b)
+{
+    unsigned ka = container_of(a, entry_t, node)->key;
+    unsigned kb = container_of(b, entry_t, node)->key;
+
+    return (ka > kb) - (ka < kb);
+}
+
+static int _key_cmp(const void *key, const rbtree_node_t *node)
+{
+    unsigned k = *(const unsigned *)key;
+    unsigned kn = container_of(node, entry_t, node)->key;
+
+    return (k > kn) - (k < kn);
+}
+
+static rbtree_t t = RBTREE_INIT(_cmp);
+
+static void set_up(void)
+{
+    rbtree_init(&t, _cmp);
+    for (unsigned i = 0; i < ARRAY_SIZE(te); ++i) {
+        te[i].key = 0;
+        te[i].data = i;
+    }
+}
+
+static entry_t *_entry(rbtree_node_t *node)
+{
+    return node ? container_of(node, entry_t, node) : NULL;
+}
+
+/* returns the black height of the subtree, -1 if it violates the rules */
+static int _check(const rbtree_node_t *node, const rbtree_node_t *parent)
+{
+    if (!node) {
+        return 1;
+    }
+
+    bool black = node->parent_color & 1;
+    if ((const rbtree_node_t *)(node->parent_color & ~(uintptr_t)1) != parent) {
+        return -1;
+    }
+    if (!black && ((node->child[0] && !(node->child[0]->parent_color & 1)) ||
+                   (node->child[1] && !(node->child[1]->parent_color & 1)))) {
+        return -1;
+    }
+
+    int left = _check(node->child[0], node);
+    int right = _check(node->child[1], node);
+    if ((left < 0) || (left != right)) {
+        return -1;
+    }
+    return left + black;
+}
+
+static void _assert_valid(void)
+{
+    TEST_ASSERT(!t.root || (t.root->parent_color & 1));
+    TEST_ASSERT(_check(t.root, NULL) > 0);
+
+    rbtree_node_t *prev = NULL;
+    for (rbtree_node_t *n = rbtree_first(&t); n; n = rbtree_next(n)) {
+        TEST_ASSERT(rbtree_prev(n) == prev);
+        TEST_ASSERT(!prev || (_cmp(prev, n) <= 0));
+        prev = n;
+    }
+    TEST_ASSERT(rbtree_last(&t) == prev);
+}
+
+static void test_rbtree_empty(void)
+{
+    unsigned key = 0;
+
+    TEST_ASSERT(rbtree_is_empty(&t));
+    TEST_ASSERT_NULL(rbtree_first(&t));
+    TEST_ASSERT_NULL(rbtree_last(&t));
+    TEST_ASSERT_NULL(rbtree_find(&t, &key, _key_cmp));
+    TEST_ASSERT_NULL(rbtree_lower_bound(&t, &key, _key_cmp));
+}
+
+static void test_rbtree_insert_order(void)
+{
+    /* keys 0 .. T_LEN - 1 in a scrambled order */
+    for (unsigned i = 0; i < T_LEN; i++) {
+        te[i].key = (i * 7) % T_LEN;
+        rbtree_insert(&t, &te[i].node);
+        _assert_valid();
+    }
+    TEST_ASSERT(!rbtree_is_empty(&t));
+
+    unsigned key = 0;
+    for (rbtree_node_t *n = rbtree_first(&t); n; n = rbtree_next(n)) {
+        TEST_ASSERT_EQUAL_INT(key++, _entry(n)->key);
+    }
+    TEST_ASSERT_EQUAL_INT(T_LEN, key);
+}
+
+static void test_rbtree_insert_equal(void)
+{
+    for (unsigned i = 0; i < T_LEN; i++) {
+        te[i].key = i % 2;
+        rbtree_insert(&t, &te[i].node);
+    }
+    _assert_valid();
+
+    /* equal keys keep the insertion order */
+    rbtree_node_t *n = rbtree_first(&t);
+    for (unsigned i = 0; i < T_LEN; i += 2, n = rbtree_next(n)) {
+        TEST_ASSERT_EQUAL_INT(i, _entry(n)->data);
+    }
+    for (unsigned i = 1; i < T_LEN; i += 2, n = rbtree_next(n)) {
+        TEST_ASSERT_EQUAL_INT(i, _entry(n)->data);
+    }
+    TEST_ASSERT_NULL(n);
+
+    unsigned key = 1;
+    TEST_ASSERT(rbtree_find(&t, &key, _key_cmp) == &te[1].node);
+}
+
+static void test_rbtree_find(void)
+{
+    for (unsigned i = 0; i < T_LEN; i++) {
+        te[i].key = 2 * i + 2;
+        rbtree_insert(&t, &te[i].node);
+    }
+
+    for (unsigned key = 0; key < 2 * T_LEN + 4; key++) {
+        rbtree_node_t *n = rbtree_find(&t, &key, _key_cmp);
+        rbtree_node_t *lb = rbtree_lower_bound(&t, &key, _key_cmp);
+
+        if ((key < 2) || (key > 2 * T_LEN)) {
+            TEST_ASSERT_NULL(n);
+        }
+        else if (key % 2) {
+            TEST_ASSERT_NULL(n);
+        }
+        else {
+            TEST_ASSERT(n == &te[key / 2 - 1].node);
+        }
+
+        if (key > 2 * T_LEN) {
+            TEST_ASSERT_NULL(lb);
+        }
+        else {
+            TEST_ASSERT_NOT_NULL(lb);
+            TEST_ASSERT_EQUAL_INT(key + (key % 2) + (key == 0) * 2,
+                                  _entry(lb)->key);
+        }
+    }
+}
+
+static void test_rbtree_remove(void)
+{
+    for (unsigned i = 0; i < T_LEN; i++) {
+        te[i].key = (i * 5) % T_LEN;
+        rbtree_insert(&t, &te[i].node);
+    }
+
+    /* remove in a different scrambled order */
+    for (unsigned i = 0; i < T_LEN; i++) {
+        entry_t *e = &te[(i * 3) % T_LEN];
+        unsigned key = e->key;
+
+        TEST_ASSERT(rbtree_find(&t, &key, _key_cmp) == &e->node);
+        rbtree_remove(&t, &e->node);
+        TEST_ASSERT_NULL(rbtree_find(&t, &key, _key_cmp));
+        _assert_valid();
+    }
+    TEST_ASSERT(rbtree_is_empty(&t));
+
+    /* nodes can be inserted again */
+    rbtree_insert(&t, &te[0].node);
+    TEST_ASSERT(rbtree_first(&t) == &te[0].node);
+    _assert_valid();
+}
+
+Test *tests_core_rbtree_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_rbtree_empty),
+        new_TestFixture(test_rbtree_insert_order),
+        new_TestFixture(test_rbtree_insert_equal),
+        new_TestFixture(test_rbtree_find),
+        new_TestFixture(test_rbtree_remove),
+    };
+
+    EMB_UNIT_TESTCALLER(core_rbtree_tests, set_up, NULL, fixtures);
+
+    return (Test *)&core_rbtree_tests;
+}
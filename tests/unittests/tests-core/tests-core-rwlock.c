@@ -0,0 +1,72 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+#include "embUnit.h"
+
+#include "rwlock.h"
+
+#include "tests-core.h"
+
+static rwlock_t lock = RWLOCK_INIT;
+
+static void set_up(void)
+{
+    rwlock_init(&lock);
+}
+
+static void test_rwlock_readers(void)
+{
+    TEST_ASSERT(!rwlock_is_locked(&lock));
+    rwlock_rdlock(&lock);
+    TEST_ASSERT_EQUAL_INT(1, rwlock_tryrdlock(&lock));
+    TEST_ASSERT_EQUAL_INT(0, rwlock_trywrlock(&lock));
+    rwlock_unlock(&lock);
+    TEST_ASSERT(rwlock_is_locked(&lock));
+    rwlock_unlock(&lock);
+    TEST_ASSERT(!rwlock_is_locked(&lock));
+    TEST_ASSERT_EQUAL_INT(0, lock.state);
+}
+
+static void test_rwlock_writer(void)
+{
+    rwlock_wrlock(&lock);
+    TEST_ASSERT(rwlock_is_locked(&lock));
+    TEST_ASSERT_EQUAL_INT(0, rwlock_tryrdlock(&lock));
+    TEST_ASSERT_EQUAL_INT(0, rwlock_trywrlock(&lock));
+    rwlock_unlock(&lock);
+    TEST_ASSERT(!rwlock_is_locked(&lock));
+    TEST_ASSERT_EQUAL_INT(1, rwlock_trywrlock(&lock));
+    rwlock_unlock(&lock);
+    TEST_ASSERT_EQUAL_INT(0, lock.state);
+}
+
+static void test_rwlock_slow_path(void)
+{
+    /* uncontended calls of the slow path must behave like the fast path */
+    TEST_ASSERT(rwlock_lock_internal(&lock, false, false));
+    TEST_ASSERT(rwlock_lock_internal(&lock, false, true));
+    TEST_ASSERT_EQUAL_INT(2, lock.state);
+    rwlock_unlock_internal(&lock);
+    rwlock_unlock_internal(&lock);
+    TEST_ASSERT(rwlock_lock_internal(&lock, true, false));
+    TEST_ASSERT_EQUAL_INT(RWLOCK_WRITER, lock.state);
+    rwlock_unlock_internal(&lock);
+    TEST_ASSERT_EQUAL_INT(0, lock.state);
+}
+
+Test *tests_core_rwlock_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_rwlock_readers),
+        new_TestFixture(test_rwlock_writer),
+        new_TestFixture(test_rwlock_slow_path),
+    };
+
+    EMB_UNIT_TESTCALLER(core_rwlock_tests, set_up, NULL, fixtures);
+
+    return (Test *)&core_rwlock_tests;
+}
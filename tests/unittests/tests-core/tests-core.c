@@ -16,6 +16,9 @@ void tests_core(void)
     TESTS_RUN(tests_core_clist_tests());
     TESTS_RUN(tests_core_list_tests());
     TESTS_RUN(tests_core_priority_queue_tests());
+    TESTS_RUN(tests_core_priority_heap_tests());
+    TESTS_RUN(tests_core_rbtree_tests());
+    TESTS_RUN(tests_core_rwlock_tests());
     TESTS_RUN(tests_core_byteorder_tests());
     TESTS_RUN(tests_core_ringbuffer_tests());
     TESTS_RUN(tests_core_xfa_tests());
@@ -0,0 +1,170 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ * @brief       Unit tests for the display device generic API
+ */
+
+#include <string.h>
+
+#include "embUnit.h"
+#include "tests-disp_dev.h"
+
+#include "disp_dev.h"
+
+static disp_dev_dirty_t dirty;
+
+static unsigned map_calls;
+static unsigned cb_calls;
+
+static void _map(const disp_dev_t *dev, const disp_dev_area_t *area,
+                 const uint16_t *color)
+{
+    (void)dev;
+    (void)area;
+    (void)color;
+    map_calls++;
+}
+
+static void _cb(void *arg)
+{
+    TEST_ASSERT(arg == &cb_calls);
+    cb_calls++;
+}
+
+static const disp_dev_driver_t sync_driver = {
+    .map = _map,
+};
+
+static void _add(uint16_t x1, uint16_t x2, uint16_t y1, uint16_t y2)
+{
+    const disp_dev_area_t area = { x1, x2, y1, y2 };
+    disp_dev_dirty_add(&dirty, &area);
+}
+
+static int _has(uint16_t x1, uint16_t x2, uint16_t y1, uint16_t y2)
+{
+    for (unsigned i = 0; i < dirty.numof; i++) {
+        const disp_dev_area_t *a = &dirty.areas[i];
+        if ((a->x1 == x1) && (a->x2 == x2) && (a->y1 == y1) && (a->y2 == y2)) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+static void setUp(void)
+{
+    disp_dev_dirty_clear(&dirty);
+    map_calls = 0;
+    cb_calls = 0;
+}
+
+static void test_area_size(void)
+{
+    const disp_dev_area_t pixel = { 3, 3, 5, 5 };
+    const disp_dev_area_t area = { 0, 9, 10, 29 };
+
+    TEST_ASSERT_EQUAL_INT(1, disp_dev_area_size(&pixel));
+    TEST_ASSERT_EQUAL_INT(200, disp_dev_area_size(&area));
+}
+
+static void test_dirty_contained(void)
+{
+    _add(0, 99, 0, 99);
+    _add(10, 20, 10, 20);
+    TEST_ASSERT_EQUAL_INT(1, dirty.numof);
+    TEST_ASSERT(_has(0, 99, 0, 99));
+
+    /* the new area covers the old one */
+    _add(0, 199, 0, 99);
+    TEST_ASSERT_EQUAL_INT(1, dirty.numof);
+    TEST_ASSERT(_has(0, 199, 0, 99));
+}
+
+static void test_dirty_adjacent(void)
+{
+    /* two rows on top of each other form a rectangle */
+    _add(0, 99, 0, 9);
+    _add(0, 99, 10, 19);
+    TEST_ASSERT_EQUAL_INT(1, dirty.numof);
+    TEST_ASSERT(_has(0, 99, 0, 19));
+}
+
+static void test_dirty_separate(void)
+{
+    /* opposite corners are kept apart */
+    _add(0, 9, 0, 9);
+    _add(90, 99, 90, 99);
+    TEST_ASSERT_EQUAL_INT(2, dirty.numof);
+    TEST_ASSERT(_has(0, 9, 0, 9));
+    TEST_ASSERT(_has(90, 99, 90, 99));
+
+    /* merging with a long row costs more pixels than it saves */
+    _add(0, 99, 45, 54);
+    TEST_ASSERT_EQUAL_INT(3, dirty.numof);
+
+    /* this covers all of them */
+    _add(0, 99, 0, 99);
+    TEST_ASSERT_EQUAL_INT(1, dirty.numof);
+    TEST_ASSERT(_has(0, 99, 0, 99));
+}
+
+static void test_dirty_full(void)
+{
+    for (unsigned i = 0; i < CONFIG_DISP_DEV_DIRTY_AREAS_NUMOF; i++) {
+        _add(i * 20, i * 20 + 9, 0, 9);
+    }
+    TEST_ASSERT_EQUAL_INT(CONFIG_DISP_DEV_DIRTY_AREAS_NUMOF, dirty.numof);
+
+    /* no room left, merged with the closest area */
+    _add(1000, 1009, 0, 9);
+    TEST_ASSERT_EQUAL_INT(CONFIG_DISP_DEV_DIRTY_AREAS_NUMOF, dirty.numof);
+    unsigned last = (CONFIG_DISP_DEV_DIRTY_AREAS_NUMOF - 1) * 20;
+    TEST_ASSERT(_has(last, 1009, 0, 9));
+}
+
+static void test_map_async_fallback(void)
+{
+    const disp_dev_t dev = { .driver = &sync_driver };
+    const disp_dev_area_t area = { 0, 1, 0, 1 };
+    const uint16_t color[4] = { 0 };
+
+    disp_dev_map_async(&dev, &area, color, _cb, &cb_calls);
+    TEST_ASSERT_EQUAL_INT(1, map_calls);
+    TEST_ASSERT_EQUAL_INT(1, cb_calls);
+
+    disp_dev_map_async(&dev, &area, color, NULL, NULL);
+    TEST_ASSERT_EQUAL_INT(2, map_calls);
+    TEST_ASSERT_EQUAL_INT(1, cb_calls);
+}
+
+Test *tests_disp_dev_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_area_size),
+        new_TestFixture(test_dirty_contained),
+        new_TestFixture(test_dirty_adjacent),
+        new_TestFixture(test_dirty_separate),
+        new_TestFixture(test_dirty_full),
+        new_TestFixture(test_map_async_fallback),
+    };
+
+    EMB_UNIT_TESTCALLER(disp_dev_tests, setUp, NULL, fixtures);
+
+    return (Test *)&disp_dev_tests;
+}
+
+void tests_disp_dev(void)
+{
+    TESTS_RUN(tests_disp_dev_tests());
+}
+/** @} */
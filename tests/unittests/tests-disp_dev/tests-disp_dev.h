@@ -0,0 +1,36 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @addtogroup  unittests
+ * @{
+ *
+ * @file
+ * @brief       Unit tests for the ``disp_dev`` module
+ */
+
+#ifndef TESTS_DISP_DEV_H
+#define TESTS_DISP_DEV_H
+
+#include "embUnit.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   The entry point of this test suite
+ */
+void tests_disp_dev(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TESTS_DISP_DEV_H */
+/** @} */
@@ -51,11 +51,34 @@ static void test_dns_cache_add_ttl0(void)
     TEST_ASSERT_EQUAL_INT(0, dns_cache_query("example.com", &addr_out, AF_INET6));
 }
 
+static void test_dns_cache_refresh_due(void)
+{
+#if IS_USED(MODULE_DNS_CACHE_PREFETCH)
+    ipv6_addr_t addr_in = IPV6_ADDR_ALL_NODES_IF_LOCAL;
+
+    TEST_ASSERT(!dns_cache_refresh_due("example.com", AF_INET6));
+    dns_cache_add("example.com", &addr_in, sizeof(addr_in), 1);
+    TEST_ASSERT(!dns_cache_refresh_due("example.com", AF_INET6));
+
+    /* entry is still valid, but at the end of its lifetime */
+    ztimer_sleep(ZTIMER_USEC, 1000000);
+    TEST_ASSERT(dns_cache_refresh_due("example.com", AF_INET6));
+    /* only reported once */
+    TEST_ASSERT(!dns_cache_refresh_due("example.com", AF_INET6));
+
+    /* a refresh starts over */
+    dns_cache_add("example.com", &addr_in, sizeof(addr_in), 100);
+    TEST_ASSERT(!dns_cache_refresh_due("example.com", AF_INET6));
+    dns_cache_add("example.com", &addr_in, sizeof(addr_in), 0);
+#endif
+}
+
 Test *tests_dns_cache_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
         new_TestFixture(test_dns_cache_add),
         new_TestFixture(test_dns_cache_add_ttl0),
+        new_TestFixture(test_dns_cache_refresh_due),
     };
 
     EMB_UNIT_TESTCALLER(dns_cache_tests, NULL, NULL, fixtures);
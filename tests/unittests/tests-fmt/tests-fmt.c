@@ -12,10 +12,12 @@
  * @file
  */
 #include <errno.h>
+#include <math.h>
 #include <stdint.h>
 #include <string.h>
 
 #include "embUnit/embUnit.h"
+#include "kernel_defines.h"
 
 #include "fmt.h"
 #include "tests-fmt.h"
@@ -751,6 +753,41 @@ static void test_fmt_s32_dfp(void)
     TEST_ASSERT_EQUAL_STRING("z", &out[28]);
 }
 
+static void test_fmt_float_shortest(void)
+{
+    static const struct {
+        float f;
+        const char *str;
+    } cases[] = {
+        { 0.0f, "0" },
+        { -0.0f, "-0" },
+        { 21.5f, "21.5" },
+        { 0.1f, "0.1" },
+        { -0.0001f, "-0.0001" },
+        { 0.00001f, "1e-5" },
+        { 100.0f, "100" },
+        { 123456789.0f, "123456790" },
+        { 1e9f, "1e9" },
+        { 3.4028235e38f, "3.4028235e38" },
+        { -1.17549435e-38f, "-1.1754944e-38" },
+        { 1e-45f, "1e-45" },
+        { INFINITY, "inf" },
+        { -INFINITY, "-inf" },
+        { NAN, "nan" },
+    };
+    char out[FMT_FLOAT_SHORTEST_MAXLEN + 2];
+
+    for (unsigned i = 0; i < ARRAY_SIZE(cases); i++) {
+        memset(out, 'z', sizeof(out));
+        size_t len = fmt_float_shortest(out, cases[i].f);
+        TEST_ASSERT_EQUAL_INT(strlen(cases[i].str), len);
+        TEST_ASSERT_EQUAL_INT(len, fmt_float_shortest(NULL, cases[i].f));
+        TEST_ASSERT_EQUAL_INT('z', out[len]);
+        out[len] = '\0';
+        TEST_ASSERT_EQUAL_STRING(cases[i].str, (char *)out);
+    }
+}
+
 static void test_fmt_strlen(void)
 {
     const char *empty_str = "";
@@ -879,6 +916,7 @@ Test *tests_fmt_tests(void)
         new_TestFixture(test_fmt_s16_dec),
         new_TestFixture(test_fmt_s16_dfp),
         new_TestFixture(test_fmt_s32_dfp),
+        new_TestFixture(test_fmt_float_shortest),
         new_TestFixture(test_fmt_strlen),
         new_TestFixture(test_fmt_strnlen),
         new_TestFixture(test_fmt_str),
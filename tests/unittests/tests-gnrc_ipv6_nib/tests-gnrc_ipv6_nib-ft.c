@@ -178,6 +178,44 @@ static void test_nib_ft_get__success4(void)
     TEST_ASSERT_EQUAL_INT(IFACE, fte.iface);
 }
 
+#if CONFIG_GNRC_IPV6_NIB_NUMOF < CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF
+#define MAX_NUMOF   (CONFIG_GNRC_IPV6_NIB_NUMOF)
+#else /* CONFIG_GNRC_IPV6_NIB_NUMOF < CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF */
+#define MAX_NUMOF   (CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF)
+#endif
+
+/*
+ * Adds MAX_NUMOF nested routes with decreasing prefix length, then removes
+ * them from the longest to the shortest, getting the route to an address
+ * covered by all of them after each step.
+ * Expected result: gnrc_ipv6_nib_ft_get() always returns the longest route
+ * left
+ */
+static void test_nib_ft_get__success5(void)
+{
+    gnrc_ipv6_nib_ft_t fte;
+    static const ipv6_addr_t dst = { .u64 = { { .u8 = GLOBAL_PREFIX },
+                                              { .u64 = TEST_UINT64 } } };
+    ipv6_addr_t next_hop = { .u64 = { { .u8 = LINK_LOCAL_PREFIX },
+                                      { .u64 = TEST_UINT64 } } };
+    unsigned dst_len = IPV6_ADDR_BIT_LEN;
+
+    for (unsigned i = 0; i < MAX_NUMOF; i++) {
+        TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_ft_add(&dst, dst_len - i,
+                                                      &next_hop, IFACE, 0));
+        next_hop.u64[1].u64++;
+    }
+    for (unsigned i = 0; i < MAX_NUMOF; i++) {
+        next_hop.u64[1].u64 = TEST_UINT64 + i;
+        TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_ft_get(&dst, NULL, &fte));
+        TEST_ASSERT(ipv6_addr_equal(&next_hop, &fte.next_hop));
+        TEST_ASSERT_EQUAL_INT(dst_len - i, fte.dst_len);
+        TEST_ASSERT_EQUAL_INT(IFACE, fte.iface);
+        gnrc_ipv6_nib_ft_del(&dst, dst_len - i);
+    }
+    TEST_ASSERT_EQUAL_INT(-ENETUNREACH, gnrc_ipv6_nib_ft_get(&dst, NULL, &fte));
+}
+
 /*
  * Tries to create a forwarding table entry for the default route (::) with
  * NULL as next hop.
@@ -212,12 +250,6 @@ static void test_nib_ft_add__EINVAL_iface0(void)
                                                         &next_hop, 0, 0));
 }
 
-#if CONFIG_GNRC_IPV6_NIB_NUMOF < CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF
-#define MAX_NUMOF   (CONFIG_GNRC_IPV6_NIB_NUMOF)
-#else /* CONFIG_GNRC_IPV6_NIB_NUMOF < CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF */
-#define MAX_NUMOF   (CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF)
-#endif
-
 /*
  * Creates CONFIG_GNRC_IPV6_NIB_DEFAULT_ROUTER_NUMOF default route entries and then
  * tries to create another one
@@ -727,6 +759,7 @@ Test *tests_gnrc_ipv6_nib_ft_tests(void)
         new_TestFixture(test_nib_ft_get__success2),
         new_TestFixture(test_nib_ft_get__success3),
         new_TestFixture(test_nib_ft_get__success4),
+        new_TestFixture(test_nib_ft_get__success5),
         new_TestFixture(test_nib_ft_add__EINVAL_def_route_next_hop_NULL),
         new_TestFixture(test_nib_ft_add__EINVAL_iface0),
         new_TestFixture(test_nib_ft_add__ENOMEM_diff_def_router),
@@ -361,6 +361,50 @@ static void test_nib_get__empty(void)
     TEST_ASSERT_NULL(_nib_onl_get(&addr, IFACE));
 }
 
+/*
+ * Creates CONFIG_GNRC_IPV6_NIB_NUMOF entries with different IP addresses,
+ * clears every second one and re-allocates those with new addresses.
+ * Expected result: _nib_onl_get() returns the entries by their current
+ * addresses and NULL for the cleared addresses
+ */
+static void test_nib_get__success_full(void)
+{
+    _nib_onl_entry_t *nodes[CONFIG_GNRC_IPV6_NIB_NUMOF];
+    ipv6_addr_t addr = { .u64 = { { .u8 = GLOBAL_PREFIX },
+                                  { .u64 = TEST_UINT64 } } };
+
+    for (int i = 0; i < CONFIG_GNRC_IPV6_NIB_NUMOF; i++) {
+        TEST_ASSERT_NOT_NULL((nodes[i] = _nib_onl_alloc(&addr, IFACE)));
+        nodes[i]->mode = _NC;
+        addr.u64[1].u64++;
+    }
+    for (int i = 0; i < CONFIG_GNRC_IPV6_NIB_NUMOF; i += 2) {
+        nodes[i]->mode = _EMPTY;
+        TEST_ASSERT(_nib_onl_clear(nodes[i]));
+    }
+    for (int i = 0; i < CONFIG_GNRC_IPV6_NIB_NUMOF; i += 2) {
+        TEST_ASSERT_NOT_NULL((nodes[i] = _nib_onl_alloc(&addr, IFACE)));
+        nodes[i]->mode = _NC;
+        addr.u64[1].u64++;
+    }
+    addr.u64[1].u64 = TEST_UINT64;
+    for (int i = 0; i < CONFIG_GNRC_IPV6_NIB_NUMOF; i++) {
+        _nib_onl_entry_t *node = _nib_onl_get(&addr, IFACE);
+
+        if (i % 2) {
+            TEST_ASSERT(nodes[i] == node);
+        }
+        else {
+            TEST_ASSERT_NULL(node);
+        }
+        addr.u64[1].u64++;
+    }
+    for (int i = 0; i < CONFIG_GNRC_IPV6_NIB_NUMOF; i += 2) {
+        TEST_ASSERT(nodes[i] == _nib_onl_get(&addr, 0));
+        addr.u64[1].u64++;
+    }
+}
+
 /*
  * Creates CONFIG_GNRC_IPV6_NIB_NUMOF neighbor cache entries with different IP
  * addresses and a non-garbage-collectible AR state and then tries to add
@@ -2018,6 +2062,7 @@ Test *tests_gnrc_ipv6_nib_internal_tests(void)
         new_TestFixture(test_nib_iter__three_elem),
         new_TestFixture(test_nib_iter__three_elem_middle_removed),
         new_TestFixture(test_nib_get__empty),
+        new_TestFixture(test_nib_get__success_full),
         new_TestFixture(test_nib_get__not_in_nib),
         new_TestFixture(test_nib_get__success),
         new_TestFixture(test_nib_nc_add__no_space_left_diff_addr),
@@ -31,15 +31,17 @@
 #define GLOBAL_PREFIX_LEN   (30)
 #define IFACE               (6)
 
-static void set_up(void)
+static int _del_event(evtimer_event_t *event, uint32_t remaining, void *arg)
 {
-    evtimer_event_t *tmp;
+    (void)remaining;
+    (void)arg;
+    evtimer_del((evtimer_t *)(&_nib_evtimer), event);
+    return 0;
+}
 
-    for (evtimer_event_t *ptr = _nib_evtimer.events;
-         (ptr != NULL) && (tmp = (ptr->next), 1);
-         ptr = tmp) {
-        evtimer_del((evtimer_t *)(&_nib_evtimer), ptr);
-    }
+static void set_up(void)
+{
+    evtimer_foreach((evtimer_t *)(&_nib_evtimer), _del_event, NULL);
     _nib_init();
 }
 
@@ -30,6 +30,7 @@
 #include "embUnit/embUnit.h"
 
 #include "hashes/sha256.h"
+#include "kernel_defines.h"
 
 #include "tests-hashes.h"
 
@@ -252,6 +253,32 @@ static void test_hashes_sha256_hash_long_sequence(void)
     TEST_ASSERT(calc_and_compare_hash_wrapper(teststring, hlong_sequence));
 }
 
+static void test_hashes_sha256_hash_long_sequence_split(void)
+{
+    static const char *teststring =
+        {"RIOT is an open-source microkernel-based operating system, designed"
+        " to match the requirements of Internet of Things (IoT) devices and"
+        " other embedded devices. These requirements include a very low memory"
+        " footprint (on the order of a few kilobytes), high energy efficiency"
+        ", real-time capabilities, communication stacks for both wireless and"
+        " wired networks, and support for a wide range of low-power hardware."};
+    /* partial blocks, several blocks at once from an unaligned address */
+    static const size_t chunks[] = { 1, 63, 1, 130, 64, 3 };
+    unsigned char hash[SHA256_DIGEST_LENGTH];
+    size_t len = strlen(teststring), pos = 0;
+    sha256_context_t sha256;
+
+    sha256_init(&sha256);
+    for (unsigned i = 0; i < ARRAY_SIZE(chunks); i++) {
+        sha256_update(&sha256, &teststring[pos], chunks[i]);
+        pos += chunks[i];
+    }
+    sha256_update(&sha256, &teststring[pos], len - pos);
+    sha256_final(&sha256, hash);
+
+    TEST_ASSERT_EQUAL_INT(0, memcmp(hlong_sequence, hash, sizeof(hash)));
+}
+
 static void test_hashes_sha256_hash_sequence_abc(void)
 {
     static const char *teststring = "abc";
@@ -281,6 +308,7 @@ Test *tests_hashes_sha256_tests(void)
         new_TestFixture(test_hashes_sha256_hash_sequence_failing_compare),
 
         new_TestFixture(test_hashes_sha256_hash_long_sequence),
+        new_TestFixture(test_hashes_sha256_hash_long_sequence_split),
 
         new_TestFixture(test_hashes_sha256_hash_sequence_abc),
         new_TestFixture(test_hashes_sha256_hash_sequence_abc_long),
@@ -165,6 +165,39 @@ static void test_inet_csum__empty_app_buffer(void)
     TEST_ASSERT_EQUAL_INT(hdr_expected, pyld_sum);
 }
 
+static uint16_t _csum_bytewise(uint16_t sum, const uint8_t *buf, uint16_t len,
+                               size_t accum_len)
+{
+    uint32_t csum = sum;
+
+    for (unsigned i = 0; i < len; i++, accum_len++) {
+        csum += (accum_len & 1) ? buf[i] : (uint16_t)(buf[i] << 8);
+    }
+    while (csum >> 16) {
+        csum = (csum & 0xffff) + (csum >> 16);
+    }
+    return csum;
+}
+
+static void test_inet_csum__word_wise(void)
+{
+    uint8_t data[80];
+
+    for (unsigned i = 0; i < sizeof(data); i++) {
+        data[i] = 0xff - i * 7;
+    }
+    /* every alignment, length and parity of the accumulated length */
+    for (unsigned offset = 0; offset < 8; offset++) {
+        for (unsigned len = 0; len <= sizeof(data) - offset; len++) {
+            for (unsigned accum_len = 0; accum_len < 2; accum_len++) {
+                TEST_ASSERT_EQUAL_INT(
+                    _csum_bytewise(0xfff0, &data[offset], len, accum_len),
+                    inet_csum_slice(0xfff0, &data[offset], len, accum_len));
+            }
+        }
+    }
+}
+
 Test *tests_inet_csum_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -176,6 +209,7 @@ Test *tests_inet_csum_tests(void)
         new_TestFixture(test_inet_csum__odd_len),
         new_TestFixture(test_inet_csum__two_app_snips),
         new_TestFixture(test_inet_csum__empty_app_buffer),
+        new_TestFixture(test_inet_csum__word_wise),
     };
 
     EMB_UNIT_TESTCALLER(inet_csum_tests, NULL, NULL, fixtures);
@@ -0,0 +1,128 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ */
+#include <stdint.h>
+#include <string.h>
+
+#include "embUnit/embUnit.h"
+
+#include "kernel_defines.h"
+#include "memarray_atomic.h"
+#include "tests-memarray_atomic.h"
+
+#define SMALL_NUMOF     (4U)
+#define LARGE_NUMOF     (2U)
+
+static uint8_t _small[SMALL_NUMOF][8];
+static uint8_t _large[LARGE_NUMOF][32];
+static memarray_atomic_t _pools[2];
+
+static void set_up(void)
+{
+    memarray_atomic_init(&_pools[0], _small, sizeof(_small[0]), SMALL_NUMOF);
+    memarray_atomic_init(&_pools[1], _large, sizeof(_large[0]), LARGE_NUMOF);
+}
+
+static void test_alloc_free(void)
+{
+    void *elems[SMALL_NUMOF];
+    memarray_atomic_stats_t stats;
+
+    for (unsigned i = 0; i < SMALL_NUMOF; i++) {
+        elems[i] = memarray_atomic_alloc(&_pools[0]);
+        TEST_ASSERT_NOT_NULL(elems[i]);
+        TEST_ASSERT(memarray_atomic_contains(&_pools[0], elems[i]));
+        for (unsigned j = 0; j < i; j++) {
+            TEST_ASSERT(elems[i] != elems[j]);
+        }
+        memset(elems[i], 0xff, sizeof(_small[0]));
+    }
+    TEST_ASSERT_NULL(memarray_atomic_alloc(&_pools[0]));
+
+    memarray_atomic_free(&_pools[0], elems[1]);
+    TEST_ASSERT(memarray_atomic_alloc(&_pools[0]) == elems[1]);
+
+    for (unsigned i = 0; i < SMALL_NUMOF; i++) {
+        memarray_atomic_free(&_pools[0], elems[i]);
+    }
+
+    memarray_atomic_get_stats(&_pools[0], &stats);
+    TEST_ASSERT_EQUAL_INT(0, stats.in_use);
+    TEST_ASSERT_EQUAL_INT(SMALL_NUMOF, stats.high_water);
+    TEST_ASSERT_EQUAL_INT(1, stats.failed);
+}
+
+static void test_high_water(void)
+{
+    memarray_atomic_stats_t stats;
+    void *a = memarray_atomic_alloc(&_pools[0]);
+    void *b = memarray_atomic_alloc(&_pools[0]);
+
+    memarray_atomic_free(&_pools[0], b);
+    memarray_atomic_get_stats(&_pools[0], &stats);
+    TEST_ASSERT_EQUAL_INT(1, stats.in_use);
+    TEST_ASSERT_EQUAL_INT(2, stats.high_water);
+
+    memarray_atomic_reset_high_water(&_pools[0]);
+    memarray_atomic_get_stats(&_pools[0], &stats);
+    TEST_ASSERT_EQUAL_INT(1, stats.high_water);
+
+    memarray_atomic_free(&_pools[0], a);
+}
+
+static void test_alloc_size(void)
+{
+    void *elems[SMALL_NUMOF + LARGE_NUMOF];
+
+    TEST_ASSERT_NULL(memarray_atomic_alloc_size(_pools, ARRAY_SIZE(_pools),
+                                                33));
+
+    elems[0] = memarray_atomic_alloc_size(_pools, ARRAY_SIZE(_pools), 9);
+    TEST_ASSERT(memarray_atomic_contains(&_pools[1], elems[0]));
+    memarray_atomic_free_any(_pools, ARRAY_SIZE(_pools), elems[0]);
+
+    /* small requests spill over to the large pool */
+    for (unsigned i = 0; i < ARRAY_SIZE(elems); i++) {
+        elems[i] = memarray_atomic_alloc_size(_pools, ARRAY_SIZE(_pools), 8);
+        TEST_ASSERT_NOT_NULL(elems[i]);
+        TEST_ASSERT(memarray_atomic_contains(&_pools[i >= SMALL_NUMOF],
+                                             elems[i]));
+    }
+    TEST_ASSERT_NULL(memarray_atomic_alloc_size(_pools, ARRAY_SIZE(_pools),
+                                                1));
+
+    for (unsigned i = 0; i < ARRAY_SIZE(elems); i++) {
+        memarray_atomic_free_any(_pools, ARRAY_SIZE(_pools), elems[i]);
+    }
+    TEST_ASSERT_NOT_NULL(memarray_atomic_alloc(&_pools[0]));
+    TEST_ASSERT_NOT_NULL(memarray_atomic_alloc(&_pools[1]));
+}
+
+Test *tests_memarray_atomic_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_alloc_free),
+        new_TestFixture(test_high_water),
+        new_TestFixture(test_alloc_size),
+    };
+
+    EMB_UNIT_TESTCALLER(memarray_atomic_tests, set_up, NULL, fixtures);
+
+    return (Test *)&memarray_atomic_tests;
+}
+
+void tests_memarray_atomic(void)
+{
+    TESTS_RUN(tests_memarray_atomic_tests());
+}
+/** @} */
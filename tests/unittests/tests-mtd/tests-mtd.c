@@ -269,6 +269,68 @@ static void test_mtd_write_read_flash(void)
 }
 #endif
 
+#if MODULE_MTD_ASYNC
+static void _async_cb(mtd_async_req_t *req, int res)
+{
+    int *result = mtd_async_arg(req);
+
+    *result = res;
+}
+
+static void test_mtd_async(void)
+{
+    const char buf[] = "uvwxyz";
+    char buf_read[sizeof(buf)];
+    event_queue_t queue;
+    mtd_async_req_t write, read;
+    int write_res = 1, read_res = 1;
+    event_t *ev;
+
+    event_queue_init_detached(&queue);
+    mtd_async_init(&write, &queue, _async_cb, &write_res);
+    mtd_async_init(&read, &queue, _async_cb, &read_res);
+
+    int ret = mtd_write_page_raw_async(&write, dev, buf, 1, 0, sizeof(buf));
+    TEST_ASSERT_EQUAL_INT(0, ret);
+    TEST_ASSERT(mtd_async_pending(&write));
+    ret = mtd_write_page_raw_async(&write, dev, buf, 1, 0, sizeof(buf));
+    TEST_ASSERT_EQUAL_INT(-EBUSY, ret);
+    ret = mtd_read_page_async(&read, dev, buf_read, 1, 0, sizeof(buf_read));
+    TEST_ASSERT_EQUAL_INT(0, ret);
+    /* nothing happens until the queue is served */
+    TEST_ASSERT_EQUAL_INT(1, write_res);
+
+    /* requests complete in order */
+    ev = event_get(&queue);
+    TEST_ASSERT(ev == &write.super);
+    ev->handler(ev);
+    TEST_ASSERT_EQUAL_INT(0, write_res);
+    TEST_ASSERT(!mtd_async_pending(&write));
+    TEST_ASSERT(mtd_async_pending(&read));
+    ev = event_get(&queue);
+    ev->handler(ev);
+    TEST_ASSERT_EQUAL_INT(0, read_res);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(buf, buf_read, sizeof(buf)));
+
+    ret = mtd_erase_sector_async(&write, dev, 0, 1);
+    TEST_ASSERT_EQUAL_INT(0, ret);
+    ret = mtd_read_page_async(&read, dev, buf_read, 1, 0, sizeof(buf_read));
+    TEST_ASSERT_EQUAL_INT(0, ret);
+    while ((ev = event_get(&queue))) {
+        ev->handler(ev);
+    }
+    TEST_ASSERT_EQUAL_INT(0, write_res);
+    TEST_ASSERT_EQUAL_INT(0, read_res);
+    TEST_ASSERT_EQUAL_INT(0xff, (uint8_t)buf_read[0]);
+
+    ret = mtd_erase_sector_async(&write, dev, dev->sector_count, 1);
+    TEST_ASSERT_EQUAL_INT(0, ret);
+    ev = event_get(&queue);
+    ev->handler(ev);
+    TEST_ASSERT_EQUAL_INT(-EOVERFLOW, write_res);
+}
+#endif
+
 #if MODULE_VFS
 static void test_mtd_vfs(void)
 {
@@ -308,6 +370,9 @@ Test *tests_mtd_tests(void)
 #ifdef MTD_0
         new_TestFixture(test_mtd_write_read_flash),
 #endif
+#if MODULE_MTD_ASYNC
+        new_TestFixture(test_mtd_async),
+#endif
 #if MODULE_VFS
         new_TestFixture(test_mtd_vfs),
 #endif
@@ -0,0 +1,282 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ */
+#include <errno.h>
+#include <string.h>
+
+#include "embUnit.h"
+
+#include "mtd.h"
+#include "mtd_kvs.h"
+
+/* Test mock object implementing a simple RAM-based NOR flash */
+#define SECTOR_COUNT        4
+#define PAGE_PER_SECTOR     4
+#define PAGE_SIZE           64
+#define WRITE_SIZE          4
+#define SECTOR_SIZE         (PAGE_PER_SECTOR * PAGE_SIZE)
+
+static uint8_t _memory[SECTOR_COUNT * SECTOR_SIZE];
+
+static int _init(mtd_dev_t *dev)
+{
+    (void)dev;
+    return 0;
+}
+
+static int _read_page(mtd_dev_t *dev, void *buff, uint32_t page,
+                      uint32_t offset, uint32_t size)
+{
+    uint32_t addr = page * dev->page_size + offset;
+
+    if (addr + size > sizeof(_memory)) {
+        return -EOVERFLOW;
+    }
+    memcpy(buff, &_memory[addr], size);
+    return size;
+}
+
+static int _write_page(mtd_dev_t *dev, const void *buff, uint32_t page,
+                       uint32_t offset, uint32_t size)
+{
+    uint32_t addr = page * dev->page_size + offset;
+
+    if ((addr + size > sizeof(_memory)) || (addr % WRITE_SIZE) ||
+        (size % WRITE_SIZE)) {
+        return -EOVERFLOW;
+    }
+    if (size > dev->page_size - offset) {
+        size = dev->page_size - offset;
+    }
+    /* NOR semantics: only clear bits */
+    for (unsigned i = 0; i < size; i++) {
+        _memory[addr + i] &= ((const uint8_t *)buff)[i];
+    }
+    return size;
+}
+
+static int _erase_sector(mtd_dev_t *dev, uint32_t sector, uint32_t count)
+{
+    if (sector + count > dev->sector_count) {
+        return -EOVERFLOW;
+    }
+    memset(&_memory[sector * SECTOR_SIZE], 0xff, count * SECTOR_SIZE);
+    return 0;
+}
+
+static const mtd_desc_t _driver = {
+    .init = _init,
+    .read_page = _read_page,
+    .write_page = _write_page,
+    .erase_sector = _erase_sector,
+};
+
+static mtd_dev_t _dev = {
+    .driver = &_driver,
+    .sector_count = SECTOR_COUNT,
+    .pages_per_sector = PAGE_PER_SECTOR,
+    .page_size = PAGE_SIZE,
+    .write_size = WRITE_SIZE,
+};
+
+static uint32_t _seq[SECTOR_COUNT];
+static uint32_t _buckets[8];
+
+static mtd_kvs_t _kvs = {
+    .mtd = &_dev,
+    .sectors = SECTOR_COUNT,
+    .seq = _seq,
+    .buckets = _buckets,
+    .buckets_numof = ARRAY_SIZE(_buckets),
+};
+
+/* a key of 3 and a value of 17 bytes take 32 bytes, 7 entries fit in a sector */
+#define VALUE_LEN           17
+#define ENTRIES_PER_SECTOR  7
+
+static void _key(char *key, unsigned i)
+{
+    key[0] = 'k';
+    key[1] = '0' + (i / 10) % 10;
+    key[2] = '0' + i % 10;
+    key[3] = '\0';
+}
+
+static void _set(unsigned i, uint8_t round)
+{
+    uint8_t value[VALUE_LEN];
+    char key[4];
+
+    _key(key, i);
+    memset(value, round, sizeof(value));
+    value[0] = i;
+    TEST_ASSERT_EQUAL_INT(0, mtd_kvs_set(&_kvs, key, value, sizeof(value)));
+}
+
+static void _expect(unsigned i, uint8_t round)
+{
+    uint8_t value[VALUE_LEN + 1];
+    char key[4];
+
+    _key(key, i);
+    TEST_ASSERT_EQUAL_INT(VALUE_LEN, mtd_kvs_get(&_kvs, key, value, sizeof(value)));
+    TEST_ASSERT_EQUAL_INT(i, value[0]);
+    TEST_ASSERT_EQUAL_INT(round, value[VALUE_LEN - 1]);
+}
+
+static void set_up(void)
+{
+    memset(_memory, 0xff, sizeof(_memory));
+    TEST_ASSERT_EQUAL_INT(0, mtd_kvs_init(&_kvs));
+}
+
+static void test_mtd_kvs_set_get_del(void)
+{
+    char buf[8];
+
+    TEST_ASSERT_EQUAL_INT(-ENOENT, mtd_kvs_get(&_kvs, "ssid", buf, sizeof(buf)));
+    TEST_ASSERT_EQUAL_INT(0, mtd_kvs_set(&_kvs, "ssid", "abc", 3));
+    TEST_ASSERT_EQUAL_INT(0, mtd_kvs_set(&_kvs, "psk", "", 0));
+    TEST_ASSERT_EQUAL_INT(3, mtd_kvs_get(&_kvs, "ssid", buf, sizeof(buf)));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(buf, "abc", 3));
+    TEST_ASSERT_EQUAL_INT(0, mtd_kvs_get(&_kvs, "psk", buf, sizeof(buf)));
+    TEST_ASSERT_EQUAL_INT(-ENOBUFS, mtd_kvs_get(&_kvs, "ssid", buf, 2));
+    TEST_ASSERT_EQUAL_INT(-ENOENT, mtd_kvs_get(&_kvs, "ssi", buf, sizeof(buf)));
+
+    TEST_ASSERT_EQUAL_INT(0, mtd_kvs_set(&_kvs, "ssid", "defgh", 5));
+    TEST_ASSERT_EQUAL_INT(5, mtd_kvs_get(&_kvs, "ssid", buf, sizeof(buf)));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(buf, "defgh", 5));
+
+    TEST_ASSERT_EQUAL_INT(0, mtd_kvs_del(&_kvs, "ssid"));
+    TEST_ASSERT_EQUAL_INT(-ENOENT, mtd_kvs_get(&_kvs, "ssid", buf, sizeof(buf)));
+    TEST_ASSERT_EQUAL_INT(-ENOENT, mtd_kvs_del(&_kvs, "ssid"));
+    TEST_ASSERT_EQUAL_INT(0, mtd_kvs_get(&_kvs, "psk", buf, sizeof(buf)));
+
+    TEST_ASSERT_EQUAL_INT(-EINVAL, mtd_kvs_set(&_kvs, "", "abc", 3));
+    TEST_ASSERT_EQUAL_INT(-EOVERFLOW, mtd_kvs_set(&_kvs, "big", _memory, SECTOR_SIZE));
+}
+
+static void test_mtd_kvs_unchanged(void)
+{
+    TEST_ASSERT_EQUAL_INT(0, mtd_kvs_set(&_kvs, "ssid", "abc", 3));
+    uint32_t offset = _kvs.offset;
+    TEST_ASSERT_EQUAL_INT(0, mtd_kvs_set(&_kvs, "ssid", "abc", 3));
+    TEST_ASSERT_EQUAL_INT(offset, _kvs.offset);
+    TEST_ASSERT_EQUAL_INT(0, mtd_kvs_set(&_kvs, "ssid", "abd", 3));
+    TEST_ASSERT(offset != _kvs.offset);
+}
+
+static void test_mtd_kvs_recover(void)
+{
+    char buf[4];
+
+    for (unsigned i = 0; i < ENTRIES_PER_SECTOR + 2; i++) {
+        _set(i, 1);
+    }
+    TEST_ASSERT_EQUAL_INT(0, mtd_kvs_del(&_kvs, "k03"));
+    _set(5, 2);
+
+    TEST_ASSERT_EQUAL_INT(0, mtd_kvs_init(&_kvs));
+    for (unsigned i = 0; i < ENTRIES_PER_SECTOR + 2; i++) {
+        if (i == 3) {
+            TEST_ASSERT_EQUAL_INT(-ENOENT, mtd_kvs_get(&_kvs, "k03", buf, sizeof(buf)));
+        }
+        else {
+            _expect(i, i == 5 ? 2 : 1);
+        }
+    }
+}
+
+static void test_mtd_kvs_gc(void)
+{
+    const unsigned numof = ENTRIES_PER_SECTOR + 3;
+
+    /* overwrite all keys until every sector was erased several times */
+    for (unsigned round = 0; round < 10; round++) {
+        for (unsigned i = 0; i < numof; i++) {
+            _set(i, round);
+        }
+        TEST_ASSERT_EQUAL_INT(0, mtd_kvs_del(&_kvs, "k00"));
+    }
+    for (unsigned i = 1; i < numof; i++) {
+        _expect(i, 9);
+    }
+
+    TEST_ASSERT_EQUAL_INT(0, mtd_kvs_init(&_kvs));
+    for (unsigned i = 1; i < numof; i++) {
+        _expect(i, 9);
+    }
+    TEST_ASSERT_EQUAL_INT(-ENOENT, mtd_kvs_del(&_kvs, "k00"));
+}
+
+static void test_mtd_kvs_full(void)
+{
+    unsigned i;
+    int res;
+
+    /* one sector is kept free */
+    for (i = 0; i < (SECTOR_COUNT - 1) * ENTRIES_PER_SECTOR; i++) {
+        _set(i, 1);
+    }
+    uint8_t value[VALUE_LEN] = { 0 };
+    res = mtd_kvs_set(&_kvs, "k99", value, sizeof(value));
+    TEST_ASSERT_EQUAL_INT(-ENOSPC, res);
+    for (i = 0; i < (SECTOR_COUNT - 1) * ENTRIES_PER_SECTOR; i++) {
+        _expect(i, 1);
+    }
+
+    /* deleting makes room again */
+    TEST_ASSERT_EQUAL_INT(0, mtd_kvs_del(&_kvs, "k00"));
+    TEST_ASSERT_EQUAL_INT(0, mtd_kvs_del(&_kvs, "k01"));
+    TEST_ASSERT_EQUAL_INT(0, mtd_kvs_set(&_kvs, "k99", value, sizeof(value)));
+}
+
+static void test_mtd_kvs_torn_entry(void)
+{
+    char buf[4];
+
+    _set(1, 1);
+    _set(2, 1);
+    /* simulate a power failure while writing the value of the second entry */
+    _memory[16 + 32 + 12 + 3 + 4] = 0x00;
+
+    TEST_ASSERT_EQUAL_INT(0, mtd_kvs_init(&_kvs));
+    _expect(1, 1);
+    TEST_ASSERT_EQUAL_INT(-ENOENT, mtd_kvs_get(&_kvs, "k02", buf, sizeof(buf)));
+    _set(3, 1);
+    TEST_ASSERT_EQUAL_INT(0, mtd_kvs_init(&_kvs));
+    _expect(1, 1);
+    _expect(3, 1);
+}
+
+Test *tests_mtd_kvs_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_mtd_kvs_set_get_del),
+        new_TestFixture(test_mtd_kvs_unchanged),
+        new_TestFixture(test_mtd_kvs_recover),
+        new_TestFixture(test_mtd_kvs_gc),
+        new_TestFixture(test_mtd_kvs_full),
+        new_TestFixture(test_mtd_kvs_torn_entry),
+    };
+
+    EMB_UNIT_TESTCALLER(mtd_kvs_tests, set_up, NULL, fixtures);
+
+    return (Test *)&mtd_kvs_tests;
+}
+
+void tests_mtd_kvs(void)
+{
+    TESTS_RUN(tests_mtd_kvs_tests());
+}
+/** @} */
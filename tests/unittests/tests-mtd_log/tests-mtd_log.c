@@ -0,0 +1,272 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ */
+#include <errno.h>
+#include <string.h>
+
+#include "embUnit.h"
+
+#include "mtd.h"
+#include "mtd_log.h"
+
+/* Test mock object implementing a simple RAM-based NOR flash */
+#define SECTOR_COUNT        4
+#define PAGE_PER_SECTOR     4
+#define PAGE_SIZE           64
+#define WRITE_SIZE          4
+#define SECTOR_SIZE         (PAGE_PER_SECTOR * PAGE_SIZE)
+
+static uint8_t _memory[SECTOR_COUNT * SECTOR_SIZE];
+
+static int _init(mtd_dev_t *dev)
+{
+    (void)dev;
+    return 0;
+}
+
+static int _read_page(mtd_dev_t *dev, void *buff, uint32_t page,
+                      uint32_t offset, uint32_t size)
+{
+    uint32_t addr = page * dev->page_size + offset;
+
+    if (addr + size > sizeof(_memory)) {
+        return -EOVERFLOW;
+    }
+    memcpy(buff, &_memory[addr], size);
+    return size;
+}
+
+static int _write_page(mtd_dev_t *dev, const void *buff, uint32_t page,
+                       uint32_t offset, uint32_t size)
+{
+    uint32_t addr = page * dev->page_size + offset;
+
+    if ((addr + size > sizeof(_memory)) || (addr % WRITE_SIZE) ||
+        (size % WRITE_SIZE)) {
+        return -EOVERFLOW;
+    }
+    if (size > dev->page_size - offset) {
+        size = dev->page_size - offset;
+    }
+    /* NOR semantics: only clear bits */
+    for (unsigned i = 0; i < size; i++) {
+        _memory[addr + i] &= ((const uint8_t *)buff)[i];
+    }
+    return size;
+}
+
+static int _erase_sector(mtd_dev_t *dev, uint32_t sector, uint32_t count)
+{
+    if (sector + count > dev->sector_count) {
+        return -EOVERFLOW;
+    }
+    memset(&_memory[sector * SECTOR_SIZE], 0xff, count * SECTOR_SIZE);
+    return 0;
+}
+
+static const mtd_desc_t _driver = {
+    .init = _init,
+    .read_page = _read_page,
+    .write_page = _write_page,
+    .erase_sector = _erase_sector,
+};
+
+static mtd_dev_t _dev = {
+    .driver = &_driver,
+    .sector_count = SECTOR_COUNT,
+    .pages_per_sector = PAGE_PER_SECTOR,
+    .page_size = PAGE_SIZE,
+    .write_size = WRITE_SIZE,
+};
+
+static mtd_log_sector_t _index[SECTOR_COUNT];
+
+static mtd_log_t _log = {
+    .mtd = &_dev,
+    .sectors = SECTOR_COUNT,
+    .index = _index,
+};
+
+/* a record of 21 bytes takes 32 bytes in the log, 7 records fit in a sector */
+#define RECORD_LEN          21
+#define RECORDS_PER_SECTOR  7
+
+static void _append(uint32_t timestamp)
+{
+    uint8_t data[RECORD_LEN];
+
+    memset(data, timestamp, sizeof(data));
+    TEST_ASSERT_EQUAL_INT(0, mtd_log_append(&_log, timestamp, data, sizeof(data)));
+}
+
+static void _expect(mtd_log_cursor_t *cur, uint32_t timestamp)
+{
+    uint8_t buf[32];
+    uint32_t ts;
+
+    TEST_ASSERT_EQUAL_INT(RECORD_LEN, mtd_log_read(&_log, cur, &ts, buf, sizeof(buf)));
+    TEST_ASSERT_EQUAL_INT(timestamp, ts);
+    TEST_ASSERT_EQUAL_INT(timestamp & 0xff, buf[RECORD_LEN - 1]);
+}
+
+static void set_up(void)
+{
+    memset(_memory, 0xff, sizeof(_memory));
+    TEST_ASSERT_EQUAL_INT(0, mtd_log_init(&_log));
+}
+
+static void test_mtd_log_append_read(void)
+{
+    mtd_log_cursor_t cur;
+    uint8_t buf[4];
+
+    mtd_log_rewind(&_log, &cur);
+    TEST_ASSERT_EQUAL_INT(-ENOENT, mtd_log_read(&_log, &cur, NULL, buf, sizeof(buf)));
+
+    TEST_ASSERT_EQUAL_INT(0, mtd_log_append(&_log, 1, "abc", 3));
+    TEST_ASSERT_EQUAL_INT(0, mtd_log_append(&_log, 2, "", 0));
+    TEST_ASSERT_EQUAL_INT(0, mtd_log_append(&_log, 3, "defg", 4));
+
+    /* the cursor continues where it hit the end */
+    TEST_ASSERT_EQUAL_INT(3, mtd_log_read(&_log, &cur, NULL, buf, sizeof(buf)));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(buf, "abc", 3));
+    TEST_ASSERT_EQUAL_INT(0, mtd_log_read(&_log, &cur, NULL, buf, sizeof(buf)));
+    TEST_ASSERT_EQUAL_INT(-ENOBUFS, mtd_log_read(&_log, &cur, NULL, buf, 2));
+    TEST_ASSERT_EQUAL_INT(4, mtd_log_read(&_log, &cur, NULL, buf, sizeof(buf)));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(buf, "defg", 4));
+    TEST_ASSERT_EQUAL_INT(-ENOENT, mtd_log_read(&_log, &cur, NULL, buf, sizeof(buf)));
+
+    TEST_ASSERT_EQUAL_INT(-EOVERFLOW, mtd_log_append(&_log, 4, _memory, SECTOR_SIZE));
+}
+
+static void test_mtd_log_recover(void)
+{
+    mtd_log_cursor_t cur;
+
+    for (unsigned i = 0; i < RECORDS_PER_SECTOR + 2; i++) {
+        _append(i);
+    }
+    TEST_ASSERT_EQUAL_INT(0, mtd_log_init(&_log));
+    _append(RECORDS_PER_SECTOR + 2);
+
+    mtd_log_rewind(&_log, &cur);
+    for (unsigned i = 0; i < RECORDS_PER_SECTOR + 3; i++) {
+        _expect(&cur, i);
+    }
+    TEST_ASSERT_EQUAL_INT(-ENOENT, mtd_log_read(&_log, &cur, NULL, NULL, 0));
+}
+
+static void test_mtd_log_wrap(void)
+{
+    const unsigned numof = 5 * RECORDS_PER_SECTOR + 3;
+    mtd_log_cursor_t cur;
+
+    for (unsigned i = 0; i < numof; i++) {
+        _append(i);
+    }
+    /* three full sectors and the current one are left */
+    mtd_log_rewind(&_log, &cur);
+    for (unsigned i = numof - 3 * RECORDS_PER_SECTOR - 3; i < numof; i++) {
+        _expect(&cur, i);
+    }
+    TEST_ASSERT_EQUAL_INT(-ENOENT, mtd_log_read(&_log, &cur, NULL, NULL, 0));
+
+    /* a cursor in an overwritten sector continues with the oldest record */
+    mtd_log_rewind(&_log, &cur);
+    for (unsigned i = 0; i < RECORDS_PER_SECTOR; i++) {
+        _append(numof + i);
+    }
+    _expect(&cur, numof - 2 * RECORDS_PER_SECTOR - 3);
+
+    TEST_ASSERT_EQUAL_INT(0, mtd_log_init(&_log));
+    mtd_log_rewind(&_log, &cur);
+    _expect(&cur, numof - 2 * RECORDS_PER_SECTOR - 3);
+}
+
+static void test_mtd_log_seek(void)
+{
+    mtd_log_cursor_t cur;
+
+    for (unsigned i = 0; i < 3 * RECORDS_PER_SECTOR; i++) {
+        _append(10 * i);
+    }
+    TEST_ASSERT_EQUAL_INT(0, mtd_log_seek(&_log, &cur, 0));
+    _expect(&cur, 0);
+    TEST_ASSERT_EQUAL_INT(0, mtd_log_seek(&_log, &cur, 95));
+    _expect(&cur, 100);
+    _expect(&cur, 110);
+    TEST_ASSERT_EQUAL_INT(0, mtd_log_seek(&_log, &cur, 140));
+    _expect(&cur, 140);
+    TEST_ASSERT_EQUAL_INT(-ENOENT, mtd_log_seek(&_log, &cur, 1000));
+
+    /* the cursor is at the end of the log */
+    _append(1000);
+    _expect(&cur, 1000);
+}
+
+static void test_mtd_log_torn_record(void)
+{
+    mtd_log_cursor_t cur;
+
+    _append(1);
+    _append(2);
+    /* simulate a power failure while writing the second record */
+    _memory[16 + 32 + 8 + 4] = 0x00;
+
+    TEST_ASSERT_EQUAL_INT(0, mtd_log_init(&_log));
+    _append(3);
+
+    mtd_log_rewind(&_log, &cur);
+    _expect(&cur, 1);
+    _expect(&cur, 3);
+    TEST_ASSERT_EQUAL_INT(-ENOENT, mtd_log_read(&_log, &cur, NULL, NULL, 0));
+}
+
+static void test_mtd_log_clear(void)
+{
+    mtd_log_cursor_t cur;
+
+    for (unsigned i = 0; i < 2 * RECORDS_PER_SECTOR; i++) {
+        _append(i);
+    }
+    TEST_ASSERT_EQUAL_INT(0, mtd_log_clear(&_log));
+    mtd_log_rewind(&_log, &cur);
+    TEST_ASSERT_EQUAL_INT(-ENOENT, mtd_log_read(&_log, &cur, NULL, NULL, 0));
+
+    TEST_ASSERT_EQUAL_INT(0, mtd_log_init(&_log));
+    _append(42);
+    mtd_log_rewind(&_log, &cur);
+    _expect(&cur, 42);
+}
+
+Test *tests_mtd_log_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_mtd_log_append_read),
+        new_TestFixture(test_mtd_log_recover),
+        new_TestFixture(test_mtd_log_wrap),
+        new_TestFixture(test_mtd_log_seek),
+        new_TestFixture(test_mtd_log_torn_record),
+        new_TestFixture(test_mtd_log_clear),
+    };
+
+    EMB_UNIT_TESTCALLER(mtd_log_tests, set_up, NULL, fixtures);
+
+    return (Test *)&mtd_log_tests;
+}
+
+void tests_mtd_log(void)
+{
+    TESTS_RUN(tests_mtd_log_tests());
+}
+/** @} */
@@ -18,6 +18,7 @@
 #include <stdio.h>
 
 #include "embUnit.h"
+#include "kernel_defines.h"
 
 #include "net/nanocoap.h"
 
@@ -1065,6 +1066,122 @@ static void test_nanocoap__token_length_over_limit(void)
     TEST_ASSERT_EQUAL_INT(-EBADMSG, res);
 }
 
+/*
+ * Resource handler for the tree handler test, recording the resource context
+ */
+static const char *_handled;
+
+static ssize_t _record_handler(coap_pkt_t *pkt, uint8_t *buf, size_t len,
+                               coap_request_ctx_t *ctx)
+{
+    (void)pkt;
+    (void)buf;
+    (void)len;
+    _handled = coap_request_ctx_get_context(ctx);
+    return 0;
+}
+
+/* sorted by path, as required by nanocoap_resources_sorted */
+static const coap_resource_t _tree_resources[] = {
+    { "/riot", COAP_GET, _record_handler, "riot" },
+    { "/riot/", COAP_GET | COAP_MATCH_SUBTREE, _record_handler, "subtree" },
+    { "/riot/board", COAP_GET, _record_handler, "board" },
+    { "/riot/value", COAP_GET, _record_handler, "value_get" },
+    { "/riot/value", COAP_PUT, _record_handler, "value_put" },
+    { "/sha256", COAP_POST, _record_handler, "sha256" },
+};
+
+static const char *_tree_request(unsigned method, const char *path)
+{
+    uint8_t buf[_BUF_SIZE];
+    coap_pkt_t pkt;
+    uint8_t token[2] = {0xDA, 0xEC};
+
+    size_t len = coap_build_hdr((coap_hdr_t *)&buf[0], COAP_TYPE_NON,
+                                &token[0], 2, method, 0xABCD);
+    coap_pkt_init(&pkt, &buf[0], sizeof(buf), len);
+    coap_opt_add_string(&pkt, COAP_OPT_URI_PATH, path, '/');
+    coap_opt_finish(&pkt, COAP_OPT_FINISH_NONE);
+
+    _handled = NULL;
+    coap_tree_handler(&pkt, buf, sizeof(buf), _tree_resources,
+                      ARRAY_SIZE(_tree_resources));
+    return _handled;
+}
+
+/*
+ * Dispatch of requests to exactly matching resources, to resources matching
+ * only for another method and to subtree resources.
+ */
+static void test_nanocoap__tree_handler(void)
+{
+    TEST_ASSERT_EQUAL_STRING("riot", _tree_request(COAP_METHOD_GET, "/riot"));
+    TEST_ASSERT_EQUAL_STRING("value_put", _tree_request(COAP_METHOD_PUT, "/riot/value"));
+    TEST_ASSERT_EQUAL_STRING("sha256", _tree_request(COAP_METHOD_POST, "/sha256"));
+    TEST_ASSERT_EQUAL_STRING("subtree", _tree_request(COAP_METHOD_GET, "/riot/ver"));
+    TEST_ASSERT_EQUAL_STRING("subtree", _tree_request(COAP_METHOD_GET, "/riot/board/x"));
+    TEST_ASSERT_NULL(_tree_request(COAP_METHOD_POST, "/riot"));
+    TEST_ASSERT_NULL(_tree_request(COAP_METHOD_GET, "/sha256"));
+    TEST_ASSERT_NULL(_tree_request(COAP_METHOD_GET, "/rio"));
+    TEST_ASSERT_NULL(_tree_request(COAP_METHOD_GET, "/zzz"));
+#if IS_USED(MODULE_NANOCOAP_RESOURCES_SORTED)
+    /* an exact match wins over a subtree resource listed before it */
+    TEST_ASSERT_EQUAL_STRING("board", _tree_request(COAP_METHOD_GET, "/riot/board"));
+    TEST_ASSERT_EQUAL_STRING("value_get", _tree_request(COAP_METHOD_GET, "/riot/value"));
+#endif
+}
+
+/*
+ * Option lookups after parsing, after the options were reset and after
+ * options were added and removed again.
+ */
+static void test_nanocoap__find_option(void)
+{
+    uint8_t buf[_BUF_SIZE];
+    coap_pkt_t pkt;
+    uint8_t token[2] = {0xDA, 0xEC};
+    uint32_t value;
+    char path[CONFIG_NANOCOAP_URI_MAX];
+
+    size_t len = coap_build_hdr((coap_hdr_t *)&buf[0], COAP_TYPE_CON,
+                                &token[0], 2, COAP_METHOD_GET, 0xABCD);
+    coap_pkt_init(&pkt, &buf[0], sizeof(buf), len);
+    coap_opt_add_string(&pkt, COAP_OPT_URI_PATH, "/riot/value", '/');
+    coap_opt_add_format(&pkt, COAP_FORMAT_CBOR);
+    coap_opt_add_uint(&pkt, COAP_OPT_BLOCK2, (2 << 4) | COAP_BLOCKSIZE_64);
+    coap_opt_add_proxy_uri(&pkt, "coap://[::1]/");
+    len = coap_opt_finish(&pkt, COAP_OPT_FINISH_NONE);
+
+    TEST_ASSERT_EQUAL_INT(0, coap_parse(&pkt, buf, len));
+    TEST_ASSERT_EQUAL_INT(COAP_FORMAT_CBOR, coap_get_content_type(&pkt));
+    TEST_ASSERT_EQUAL_INT(COAP_FORMAT_NONE, coap_get_accept(&pkt));
+    TEST_ASSERT_EQUAL_INT(0, coap_opt_get_uint(&pkt, COAP_OPT_BLOCK2, &value));
+    TEST_ASSERT_EQUAL_INT((2 << 4) | COAP_BLOCKSIZE_64, value);
+    TEST_ASSERT_EQUAL_INT(-ENOENT, coap_opt_get_uint(&pkt, COAP_OPT_BLOCK1, &value));
+    TEST_ASSERT_NOT_NULL(coap_find_option(&pkt, COAP_OPT_PROXY_URI));
+    TEST_ASSERT_EQUAL_INT(sizeof("/riot/value"),
+                          coap_get_uri_path(&pkt, (uint8_t *)path));
+    TEST_ASSERT_EQUAL_STRING("/riot/value", path);
+
+    /* rebuild the options in place */
+    pkt.payload = (uint8_t *)pkt.hdr + coap_get_total_hdr_len(&pkt);
+    pkt.payload_len = sizeof(buf) - coap_get_total_hdr_len(&pkt);
+    pkt.options_len = 0;
+    TEST_ASSERT_NULL(coap_find_option(&pkt, COAP_OPT_URI_PATH));
+    TEST_ASSERT_NULL(coap_find_option(&pkt, COAP_OPT_CONTENT_FORMAT));
+
+    coap_opt_add_format(&pkt, COAP_FORMAT_TEXT);
+    coap_opt_add_accept(&pkt, COAP_FORMAT_JSON);
+    coap_opt_finish(&pkt, COAP_OPT_FINISH_NONE);
+    TEST_ASSERT_NULL(coap_find_option(&pkt, COAP_OPT_URI_PATH));
+    TEST_ASSERT_EQUAL_INT(COAP_FORMAT_TEXT, coap_get_content_type(&pkt));
+    TEST_ASSERT_EQUAL_INT(COAP_FORMAT_JSON, coap_get_accept(&pkt));
+
+    coap_opt_remove(&pkt, COAP_OPT_CONTENT_FORMAT);
+    TEST_ASSERT_NULL(coap_find_option(&pkt, COAP_OPT_CONTENT_FORMAT));
+    TEST_ASSERT_EQUAL_INT(COAP_FORMAT_JSON, coap_get_accept(&pkt));
+}
+
 Test *tests_nanocoap_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -1101,6 +1218,8 @@ Test *tests_nanocoap_tests(void)
         new_TestFixture(test_nanocoap__add_path_unterminated_string),
         new_TestFixture(test_nanocoap__add_get_proxy_uri),
         new_TestFixture(test_nanocoap__token_length_over_limit),
+        new_TestFixture(test_nanocoap__tree_handler),
+        new_TestFixture(test_nanocoap__find_option),
     };
 
     EMB_UNIT_TESTCALLER(nanocoap_tests, NULL, NULL, fixtures);
@@ -257,6 +257,91 @@ static void test_nanocoap_cache__max_age(void)
     TEST_ASSERT(nanocoap_cache_entry_is_stale(c, 20));
 }
 
+/*
+ * Adds a fake response of @p len bytes filled with @p fill for @p path
+ */
+static nanocoap_cache_entry_t *_add_fake(const char *path, uint8_t fill, size_t len)
+{
+    uint8_t buf[_BUF_SIZE];
+    uint8_t rbuf[_BUF_SIZE];
+    uint8_t token[2] = {0xDA, 0xEC};
+    coap_pkt_t req, resp;
+
+    size_t hdr_len = coap_build_hdr((coap_hdr_t *)&buf[0], COAP_TYPE_NON,
+                                    &token[0], 2, COAP_METHOD_GET, 0xABCD);
+    coap_pkt_init(&req, &buf[0], sizeof(buf), hdr_len);
+    coap_opt_add_string(&req, COAP_OPT_URI_PATH, path, '/');
+    coap_opt_finish(&req, COAP_OPT_FINISH_NONE);
+
+    memset(rbuf, fill, sizeof(rbuf));
+    memset(&resp, 0, sizeof(resp));
+    resp.hdr = (coap_hdr_t *)rbuf;
+    resp.payload = rbuf;
+
+    return nanocoap_cache_add_by_req(&req, &resp, len);
+}
+
+static void test_nanocoap_cache__stats(void)
+{
+    nanocoap_cache_stats_t stats;
+    uint8_t unknown_key[CONFIG_NANOCOAP_CACHE_KEY_LENGTH] = { 0 };
+    char path[16];
+
+    nanocoap_cache_init();
+
+    nanocoap_cache_entry_t *c = _add_fake("/path", 0x42, 16);
+    TEST_ASSERT_NOT_NULL(c);
+    TEST_ASSERT(nanocoap_cache_key_lookup(c->cache_key) == c);
+    TEST_ASSERT_NULL(nanocoap_cache_key_lookup(unknown_key));
+
+    /* overfill the cache */
+    for (unsigned i = 0; i < CONFIG_NANOCOAP_CACHE_ENTRIES; i++) {
+        snprintf(path, sizeof(path), "/path_%u", i);
+        TEST_ASSERT_NOT_NULL(_add_fake(path, i, 16));
+    }
+
+    nanocoap_cache_get_stats(&stats);
+    TEST_ASSERT_EQUAL_INT(1, stats.hits);
+    TEST_ASSERT_EQUAL_INT(1, stats.misses);
+    TEST_ASSERT_EQUAL_INT(1, stats.evictions);
+}
+
+#if IS_USED(MODULE_NANOCOAP_CACHE_ARENA)
+static void test_nanocoap_cache__arena(void)
+{
+    nanocoap_cache_entry_t *c[CONFIG_NANOCOAP_CACHE_ENTRIES];
+    nanocoap_cache_stats_t stats;
+    const size_t len = CONFIG_NANOCOAP_CACHE_ARENA_SIZE / CONFIG_NANOCOAP_CACHE_ENTRIES;
+    char path[16];
+
+    nanocoap_cache_init();
+
+    /* fill the arena */
+    for (unsigned i = 0; i < CONFIG_NANOCOAP_CACHE_ENTRIES; i++) {
+        snprintf(path, sizeof(path), "/path_%u", i);
+        c[i] = _add_fake(path, i, len);
+        TEST_ASSERT_NOT_NULL(c[i]);
+    }
+
+    /* responses behind a deleted one are moved down in the arena */
+    TEST_ASSERT_EQUAL_INT(0, nanocoap_cache_del(c[1]));
+    for (unsigned i = 2; i < CONFIG_NANOCOAP_CACHE_ENTRIES; i++) {
+        for (unsigned j = 0; j < len; j++) {
+            TEST_ASSERT_EQUAL_INT(i, c[i]->response_buf[j]);
+        }
+        TEST_ASSERT(c[i]->response_pkt.hdr == (coap_hdr_t *)c[i]->response_buf);
+    }
+
+    /* a response of the freed size fits without eviction */
+    c[1] = _add_fake("/new", 0xff, len);
+    TEST_ASSERT_NOT_NULL(c[1]);
+    TEST_ASSERT_EQUAL_INT(0xff, c[1]->response_buf[len - 1]);
+    TEST_ASSERT_EQUAL_INT(0, c[0]->response_buf[len - 1]);
+    nanocoap_cache_get_stats(&stats);
+    TEST_ASSERT_EQUAL_INT(0, stats.evictions);
+}
+#endif
+
 Test *tests_nanocoap_cache_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -264,6 +349,10 @@ Test *tests_nanocoap_cache_tests(void)
         new_TestFixture(test_nanocoap_cache__del),
         new_TestFixture(test_nanocoap_cache__cachekey),
         new_TestFixture(test_nanocoap_cache__max_age),
+        new_TestFixture(test_nanocoap_cache__stats),
+#if IS_USED(MODULE_NANOCOAP_CACHE_ARENA)
+        new_TestFixture(test_nanocoap_cache__arena),
+#endif
     };
 
     EMB_UNIT_TESTCALLER(nanocoap_cache_entry_tests, NULL, NULL, fixtures);
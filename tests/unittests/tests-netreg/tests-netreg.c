@@ -12,11 +12,15 @@
  * @file
  */
 #include <errno.h>
+#include <string.h>
 
 #include "embUnit.h"
+#include "kernel_defines.h"
 
+#include "net/gnrc/netapi.h"
 #include "net/gnrc/netreg.h"
 #include "net/gnrc/nettype.h"
+#include "net/gnrc/pktbuf.h"
 
 #include "unittests-constants.h"
 #include "tests-netreg.h"
@@ -185,6 +189,94 @@ void test_netreg_getnext__2_entries(void)
     gnrc_netreg_release_shared();
 }
 
+void test_netreg_lookup__many_entries(void)
+{
+    gnrc_netreg_entry_t many[16];
+
+    for (unsigned i = 0; i < ARRAY_SIZE(many); i++) {
+        /* two entries per demux context, spread over the 32 bit space */
+        gnrc_netreg_entry_init_pid(&many[i], (i / 2) * 0x01010101U,
+                                   TEST_UINT8);
+        TEST_ASSERT_EQUAL_INT(0, gnrc_netreg_register(GNRC_NETTYPE_TEST,
+                                                      &many[i]));
+    }
+    gnrc_netreg_acquire_shared();
+    for (unsigned i = 0; i < ARRAY_SIZE(many) / 2; i++) {
+        uint32_t demux_ctx = i * 0x01010101U;
+        gnrc_netreg_entry_t *res = gnrc_netreg_lookup(GNRC_NETTYPE_TEST,
+                                                      demux_ctx);
+
+        TEST_ASSERT_EQUAL_INT(2, gnrc_netreg_num(GNRC_NETTYPE_TEST, demux_ctx));
+        TEST_ASSERT_NOT_NULL(res);
+        TEST_ASSERT_EQUAL_INT(demux_ctx, res->demux_ctx);
+        TEST_ASSERT_NOT_NULL((res = gnrc_netreg_getnext(res)));
+        TEST_ASSERT_EQUAL_INT(demux_ctx, res->demux_ctx);
+        TEST_ASSERT_NULL(gnrc_netreg_getnext(res));
+    }
+    TEST_ASSERT_NULL(gnrc_netreg_lookup(GNRC_NETTYPE_TEST, TEST_UINT16));
+    gnrc_netreg_release_shared();
+    for (unsigned i = 0; i < ARRAY_SIZE(many); i++) {
+        gnrc_netreg_unregister(GNRC_NETTYPE_TEST, &many[i]);
+    }
+    gnrc_netreg_acquire_shared();
+    TEST_ASSERT_EQUAL_INT(0, gnrc_netreg_num(GNRC_NETTYPE_TEST, 0));
+    gnrc_netreg_release_shared();
+}
+
+static unsigned _rcvd[4];
+
+static void _count_cb(uint16_t cmd, gnrc_pktsnip_t *pkt, void *ctx)
+{
+    (void)cmd;
+    _rcvd[(uintptr_t)ctx]++;
+    gnrc_pktbuf_release(pkt);
+}
+
+void test_netapi_dispatch__steered(void)
+{
+    gnrc_netreg_entry_cbd_t cbd[ARRAY_SIZE(_rcvd)];
+    gnrc_netreg_entry_t workers[ARRAY_SIZE(_rcvd)];
+    unsigned worker = ARRAY_SIZE(_rcvd);
+
+    gnrc_pktbuf_init();
+    memset(_rcvd, 0, sizeof(_rcvd));
+    for (unsigned i = 0; i < ARRAY_SIZE(workers); i++) {
+        cbd[i].cb = _count_cb;
+        cbd[i].ctx = (void *)(uintptr_t)i;
+        gnrc_netreg_entry_init_cb(&workers[i], TEST_UINT16, &cbd[i]);
+        /* last entry is a listener that gets every packet */
+        if (i < (ARRAY_SIZE(workers) - 1)) {
+            gnrc_netreg_entry_set_steered(&workers[i]);
+        }
+        TEST_ASSERT_EQUAL_INT(0, gnrc_netreg_register(GNRC_NETTYPE_TEST,
+                                                      &workers[i]));
+    }
+    for (unsigned i = 0; i < 5; i++) {
+        gnrc_pktsnip_t *pkt = gnrc_pktbuf_add(NULL, TEST_STRING8,
+                                              sizeof(TEST_STRING8),
+                                              GNRC_NETTYPE_TEST);
+
+        TEST_ASSERT_NOT_NULL(pkt);
+        /* one steered worker and the listener */
+        TEST_ASSERT_EQUAL_INT(2, gnrc_netapi_dispatch_receive(GNRC_NETTYPE_TEST,
+                                                              TEST_UINT16, pkt));
+    }
+    for (unsigned i = 0; i < (ARRAY_SIZE(workers) - 1); i++) {
+        if (_rcvd[i] > 0) {
+            /* all packets of the flow went to the same worker */
+            TEST_ASSERT_EQUAL_INT(ARRAY_SIZE(workers), worker);
+            TEST_ASSERT_EQUAL_INT(5, _rcvd[i]);
+            worker = i;
+        }
+    }
+    TEST_ASSERT(worker < ARRAY_SIZE(workers));
+    TEST_ASSERT_EQUAL_INT(5, _rcvd[ARRAY_SIZE(workers) - 1]);
+    for (unsigned i = 0; i < ARRAY_SIZE(workers); i++) {
+        gnrc_netreg_unregister(GNRC_NETTYPE_TEST, &workers[i]);
+    }
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
 Test *tests_netreg_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -201,6 +293,8 @@ Test *tests_netreg_tests(void)
         new_TestFixture(test_netreg_num__2_entries),
         new_TestFixture(test_netreg_getnext__NULL),
         new_TestFixture(test_netreg_getnext__2_entries),
+        new_TestFixture(test_netreg_lookup__many_entries),
+        new_TestFixture(test_netapi_dispatch__steered),
     };
 
     EMB_UNIT_TESTCALLER(netreg_tests, set_up, NULL, fixtures);
@@ -14,6 +14,7 @@
  */
 #include <errno.h>
 #include <stdint.h>
+#include <string.h>
 #include <sys/uio.h>
 
 #include "embUnit.h"
@@ -813,6 +814,38 @@ static void test_pktbuf_start_write__pkt_users_2(void)
     TEST_ASSERT(gnrc_pktbuf_is_empty());
 }
 
+#if IS_USED(MODULE_GNRC_PKTBUF_COW)
+static void test_pktbuf_start_write_desc__pkt_users_2(void)
+{
+    gnrc_pktsnip_t *hdr, *pkt_copy, *pkt = gnrc_pktbuf_add(NULL, TEST_STRING16, sizeof(TEST_STRING16),
+                                                           GNRC_NETTYPE_TEST);
+
+    gnrc_pktbuf_hold(pkt, 1);
+    TEST_ASSERT_NOT_NULL((pkt_copy = gnrc_pktbuf_start_write_desc(pkt)));
+    TEST_ASSERT(pkt != pkt_copy);
+    TEST_ASSERT(pkt->data == pkt_copy->data);
+    TEST_ASSERT_EQUAL_INT(1, pkt->users);
+    TEST_ASSERT_EQUAL_INT(1, pkt_copy->users);
+
+    /* changing the copy leaves the original as is */
+    TEST_ASSERT_NOT_NULL((hdr = gnrc_pktbuf_mark(pkt_copy, 8, GNRC_NETTYPE_UNDEF)));
+    TEST_ASSERT_EQUAL_INT(sizeof(TEST_STRING16), pkt->size);
+    TEST_ASSERT_EQUAL_STRING(TEST_STRING16, pkt->data);
+
+    /* writing to the data copies it */
+    TEST_ASSERT(gnrc_pktbuf_start_write(hdr) == hdr);
+    TEST_ASSERT(hdr->data != pkt->data);
+    memset(hdr->data, 0, hdr->size);
+    TEST_ASSERT_EQUAL_STRING(TEST_STRING16, pkt->data);
+
+    gnrc_pktbuf_release(pkt_copy);
+    TEST_ASSERT_EQUAL_STRING(TEST_STRING16, pkt->data);
+    gnrc_pktbuf_release(pkt);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+}
+#endif
+
 #ifndef MODULE_GNRC_PKTBUF_MALLOC
 static void test_pktbuf_reverse_snips__too_full(void)
 {
@@ -906,6 +939,9 @@ Test *tests_pktbuf_tests(void)
         new_TestFixture(test_pktbuf_start_write__NULL),
         new_TestFixture(test_pktbuf_start_write__pkt_users_1),
         new_TestFixture(test_pktbuf_start_write__pkt_users_2),
+#if IS_USED(MODULE_GNRC_PKTBUF_COW)
+        new_TestFixture(test_pktbuf_start_write_desc__pkt_users_2),
+#endif
 #ifndef MODULE_GNRC_PKTBUF_MALLOC
         new_TestFixture(test_pktbuf_reverse_snips__too_full),
 #endif /* MODULE_GNRC_PKTBUF_MALLOC */
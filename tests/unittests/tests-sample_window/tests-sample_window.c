@@ -0,0 +1,130 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ */
+
+#include <string.h>
+
+#include "embUnit.h"
+
+#include "event.h"
+#include "sample_window.h"
+
+#define FRAMES      (2U)
+#define CHANNELS    (2U)
+#define NUMOF       (2U)
+
+static event_queue_t _queue;
+static sample_window_t _sw;
+static int8_t _buf[NUMOF * FRAMES * CHANNELS];
+
+static void _handler(event_t *event)
+{
+    (void)event;
+}
+
+static void set_up(void)
+{
+    memset(_buf, 0, sizeof(_buf));
+    event_queue_init_detached(&_queue);
+    sample_window_init(&_sw, _buf, NUMOF, FRAMES, CHANNELS, 0.5f, -10,
+                       &_queue, _handler);
+}
+
+static void test_sample_window_quantize(void)
+{
+    static const int16_t samples[] = { 4, -3, 1000, -1000 };
+
+    sample_window_add(&_sw, samples, FRAMES);
+    const int8_t *win = sample_window_get(&_sw);
+    TEST_ASSERT(win == _buf);
+    TEST_ASSERT_EQUAL_INT(-2, win[0]);
+    TEST_ASSERT_EQUAL_INT(-16, win[1]);
+    TEST_ASSERT_EQUAL_INT(INT8_MAX, win[2]);
+    TEST_ASSERT_EQUAL_INT(INT8_MIN, win[3]);
+}
+
+static void test_sample_window_input_scale(void)
+{
+    static const int16_t samples[] = { 4, 40, 0, -40 };
+
+    sample_window_set_input_scale(&_sw, 0.25f);
+    sample_window_add(&_sw, samples, FRAMES);
+    const int8_t *win = sample_window_get(&_sw);
+    TEST_ASSERT_NOT_NULL(win);
+    TEST_ASSERT_EQUAL_INT(-8, win[0]);
+    TEST_ASSERT_EQUAL_INT(10, win[1]);
+    TEST_ASSERT_EQUAL_INT(-10, win[2]);
+    TEST_ASSERT_EQUAL_INT(-30, win[3]);
+}
+
+static void test_sample_window_event(void)
+{
+    static const int16_t samples[FRAMES * CHANNELS] = { 0 };
+
+    sample_window_add(&_sw, samples, FRAMES - 1);
+    TEST_ASSERT_NULL(sample_window_get(&_sw));
+    TEST_ASSERT_NULL(event_get(&_queue));
+    sample_window_add(&_sw, samples, 1);
+    TEST_ASSERT(event_get(&_queue) == &_sw.event);
+    TEST_ASSERT_NOT_NULL(sample_window_get(&_sw));
+}
+
+static void test_sample_window_ring(void)
+{
+    static const int16_t samples[] = { 2, 2, 2, 2, 4, 4, 4, 4, 6, 6, 6, 6 };
+
+    /* fill both windows, the frames of the third window are dropped */
+    sample_window_add(&_sw, samples, 3 * FRAMES);
+    TEST_ASSERT_EQUAL_INT(FRAMES, sample_window_overruns(&_sw));
+    TEST_ASSERT_EQUAL_INT(0, sample_window_overruns(&_sw));
+
+    const int8_t *win = sample_window_get(&_sw);
+    TEST_ASSERT(win == _buf);
+    TEST_ASSERT_EQUAL_INT(-6, win[0]);
+    sample_window_release(&_sw);
+
+    /* sampling continues into the released window */
+    sample_window_add(&_sw, &samples[2 * FRAMES * CHANNELS], FRAMES);
+    TEST_ASSERT_EQUAL_INT(0, sample_window_overruns(&_sw));
+
+    win = sample_window_get(&_sw);
+    TEST_ASSERT(win == &_buf[FRAMES * CHANNELS]);
+    TEST_ASSERT_EQUAL_INT(-2, win[0]);
+    sample_window_release(&_sw);
+
+    win = sample_window_get(&_sw);
+    TEST_ASSERT(win == _buf);
+    TEST_ASSERT_EQUAL_INT(2, win[0]);
+    sample_window_release(&_sw);
+    TEST_ASSERT_NULL(sample_window_get(&_sw));
+}
+
+Test *tests_sample_window_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_sample_window_quantize),
+        new_TestFixture(test_sample_window_input_scale),
+        new_TestFixture(test_sample_window_event),
+        new_TestFixture(test_sample_window_ring),
+    };
+
+    EMB_UNIT_TESTCALLER(sample_window_tests, set_up, NULL, fixtures);
+
+    return (Test *)&sample_window_tests;
+}
+
+void tests_sample_window(void)
+{
+    TESTS_RUN(tests_sample_window_tests());
+}
+/** @} */
@@ -25,11 +25,11 @@
 #include "saul_reg.h"
 #include "tests-saul_reg.h"
 
-static const saul_driver_t s0_dri = { NULL, NULL, SAUL_ACT_SERVO };
-static const saul_driver_t s1_dri = { NULL, NULL, SAUL_SENSE_TEMP };
-static const saul_driver_t s2_dri = { NULL, NULL, SAUL_SENSE_LIGHT };
-static const saul_driver_t s3a_dri = { NULL, NULL, SAUL_ACT_LED_RGB };
-static const saul_driver_t s3b_dri = { NULL, NULL, SAUL_ACT_SWITCH };
+static const saul_driver_t s0_dri = { NULL, NULL, SAUL_ACT_SERVO, NULL };
+static const saul_driver_t s1_dri = { NULL, NULL, SAUL_SENSE_TEMP, NULL };
+static const saul_driver_t s2_dri = { NULL, NULL, SAUL_SENSE_LIGHT, NULL };
+static const saul_driver_t s3a_dri = { NULL, NULL, SAUL_ACT_LED_RGB, NULL };
+static const saul_driver_t s3b_dri = { NULL, NULL, SAUL_ACT_SWITCH, NULL };
 
 static saul_reg_t s0 = { NULL, NULL, "S0", &s0_dri };
 static saul_reg_t s1 = { NULL, NULL, "S1", &s1_dri };
@@ -166,6 +166,58 @@ static void test_reg_find_type_and_name(void)
     TEST_ASSERT_NULL(dev);
 }
 
+static int _read_one(const void *dev, phydat_t *res)
+{
+    (void)dev;
+    res->val[0] = 42;
+    return 1;
+}
+
+static int _read_batch(const void *dev, saul_sample_t *res, size_t num)
+{
+    (void)dev;
+    size_t n = (num < 3) ? num : 3;
+
+    for (size_t i = 0; i < n; i++) {
+        res[i].data.val[0] = i;
+        res[i].timestamp = (n - 1 - i) * 1000;
+    }
+    return n;
+}
+
+static const saul_driver_t single_dri = {
+    .read = _read_one,
+    .type = SAUL_SENSE_TEMP,
+};
+static const saul_driver_t batch_dri = {
+    .read = _read_one,
+    .type = SAUL_SENSE_ACCEL,
+    .read_batch = _read_batch,
+};
+
+static void test_reg_read_batch(void)
+{
+    saul_reg_t single = { NULL, NULL, "single", &single_dri };
+    saul_reg_t batch = { NULL, NULL, "batch", &batch_dri };
+    saul_sample_t res[4];
+
+    TEST_ASSERT_EQUAL_INT(-ENODEV, saul_reg_read_batch(NULL, res, 4, 0));
+
+    /* devices without a buffer return one current sample */
+    TEST_ASSERT_EQUAL_INT(1, saul_reg_read_batch(&single, res, 4, 5000));
+    TEST_ASSERT_EQUAL_INT(42, res[0].data.val[0]);
+    TEST_ASSERT_EQUAL_INT(5000, res[0].timestamp);
+
+    /* ages are converted to timestamps */
+    TEST_ASSERT_EQUAL_INT(3, saul_reg_read_batch(&batch, res, 4, 5000));
+    for (unsigned i = 0; i < 3; i++) {
+        TEST_ASSERT_EQUAL_INT(i, res[i].data.val[0]);
+        TEST_ASSERT_EQUAL_INT(3000 + i * 1000, res[i].timestamp);
+    }
+    TEST_ASSERT_EQUAL_INT(2, saul_reg_read_batch(&batch, res, 2, 5000));
+    TEST_ASSERT_EQUAL_INT(4000, res[0].timestamp);
+}
+
 Test *tests_saul_reg_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -175,6 +227,7 @@ Test *tests_saul_reg_tests(void)
         new_TestFixture(test_reg_find_type),
         new_TestFixture(test_reg_find_name),
         new_TestFixture(test_reg_find_type_and_name),
+        new_TestFixture(test_reg_read_batch),
     };
 
     EMB_UNIT_TESTCALLER(pkt_tests, NULL, NULL, fixtures);
@@ -195,6 +195,27 @@ static void test_sixlowpan_ctx_remove(void)
     TEST_ASSERT_NULL(gnrc_sixlowpan_ctx_lookup_addr(&addr));
 }
 
+static void test_sixlowpan_ctx_version(void)
+{
+    ipv6_addr_t addr = DEFAULT_TEST_PREFIX;
+    uint16_t version = gnrc_sixlowpan_ctx_version();
+
+    TEST_ASSERT_NULL(gnrc_sixlowpan_ctx_update(GNRC_SIXLOWPAN_CTX_SIZE, &addr,
+                                               DEFAULT_TEST_PREFIX_LEN,
+                                               TEST_UINT16, true));
+    TEST_ASSERT_EQUAL_INT(version, gnrc_sixlowpan_ctx_version());
+    test_sixlowpan_ctx_update__success();
+    TEST_ASSERT(version != gnrc_sixlowpan_ctx_version());
+    version = gnrc_sixlowpan_ctx_version();
+    TEST_ASSERT_NOT_NULL(gnrc_sixlowpan_ctx_lookup_addr(&addr));
+    TEST_ASSERT_EQUAL_INT(version, gnrc_sixlowpan_ctx_version());
+    /* changing only the compression flag changes the version as well */
+    TEST_ASSERT_NOT_NULL(gnrc_sixlowpan_ctx_update(DEFAULT_TEST_ID, &addr,
+                                                   DEFAULT_TEST_PREFIX_LEN,
+                                                   TEST_UINT16, false));
+    TEST_ASSERT(version != gnrc_sixlowpan_ctx_version());
+}
+
 Test *tests_sixlowpan_ctx_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -211,6 +232,7 @@ Test *tests_sixlowpan_ctx_tests(void)
         new_TestFixture(test_sixlowpan_ctx_lookup_id__wrong_id),
         new_TestFixture(test_sixlowpan_ctx_lookup_id__success),
         new_TestFixture(test_sixlowpan_ctx_remove),
+        new_TestFixture(test_sixlowpan_ctx_version),
     };
 
     EMB_UNIT_TESTCALLER(sixlowpan_ctx_tests, NULL, tear_down, fixtures);
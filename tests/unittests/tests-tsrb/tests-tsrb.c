@@ -213,6 +213,83 @@ static void test_add(void)
     }
 }
 
+static void test_write_region(void)
+{
+    tsrb_region_t regions[2];
+
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE, tsrb_get_write_region(&_tsrb, regions));
+    TEST_ASSERT(regions[0].buf == _tsrb_buffer);
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE, regions[0].len);
+    TEST_ASSERT_EQUAL_INT(0, regions[1].len);
+
+    /* move the write position behind the middle of the buffer */
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE - TEST_DROP_NUM,
+                          tsrb_add(&_tsrb, _io_buffer,
+                                   BUFFER_SIZE - TEST_DROP_NUM));
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE - TEST_DROP_NUM,
+                          tsrb_drop(&_tsrb, BUFFER_SIZE));
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE, tsrb_get_write_region(&_tsrb, regions));
+    TEST_ASSERT(regions[0].buf == &_tsrb_buffer[BUFFER_SIZE - TEST_DROP_NUM]);
+    TEST_ASSERT_EQUAL_INT(TEST_DROP_NUM, regions[0].len);
+    TEST_ASSERT(regions[1].buf == _tsrb_buffer);
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE - TEST_DROP_NUM, regions[1].len);
+
+    for (unsigned i = 0; i < regions[0].len; i++) {
+        regions[0].buf[i] = TEST_INPUT + i;
+    }
+    regions[1].buf[0] = TEST_INPUT + regions[0].len;
+    tsrb_commit(&_tsrb, regions[0].len + 1);
+
+    TEST_ASSERT_EQUAL_INT(TEST_DROP_NUM + 1, tsrb_avail(&_tsrb));
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE - TEST_DROP_NUM - 1,
+                          tsrb_get_write_region(&_tsrb, regions));
+    TEST_ASSERT(regions[0].buf == &_tsrb_buffer[1]);
+    TEST_ASSERT_EQUAL_INT(0, regions[1].len);
+    for (int i = 0; i < (int)(TEST_DROP_NUM + 1); i++) {
+        TEST_ASSERT_EQUAL_INT((uint8_t)(TEST_INPUT + i), tsrb_get_one(&_tsrb));
+    }
+}
+
+static void test_peek_region(void)
+{
+    tsrb_region_t regions[2];
+
+    TEST_ASSERT_EQUAL_INT(0, tsrb_peek_region(&_tsrb, regions));
+    TEST_ASSERT_EQUAL_INT(0, regions[0].len);
+    TEST_ASSERT_EQUAL_INT(0, regions[1].len);
+
+    /* let the data wrap around */
+    for (int i = 0; i < (int)sizeof(_io_buffer); i++) {
+        _io_buffer[i] = TEST_INPUT + i;
+    }
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE - TEST_DROP_NUM,
+                          tsrb_add(&_tsrb, _io_buffer,
+                                   BUFFER_SIZE - TEST_DROP_NUM));
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE - TEST_DROP_NUM,
+                          tsrb_drop(&_tsrb, BUFFER_SIZE));
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE,
+                          tsrb_add(&_tsrb, _io_buffer, sizeof(_io_buffer)));
+
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE, tsrb_peek_region(&_tsrb, regions));
+    TEST_ASSERT(regions[0].buf == &_tsrb_buffer[BUFFER_SIZE - TEST_DROP_NUM]);
+    TEST_ASSERT_EQUAL_INT(TEST_DROP_NUM, regions[0].len);
+    TEST_ASSERT(regions[1].buf == _tsrb_buffer);
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE - TEST_DROP_NUM, regions[1].len);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(regions[0].buf, _io_buffer,
+                                    regions[0].len));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(regions[1].buf,
+                                    &_io_buffer[regions[0].len],
+                                    regions[1].len));
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE, tsrb_avail(&_tsrb));
+
+    tsrb_consume(&_tsrb, TEST_DROP_NUM + 1);
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE - TEST_DROP_NUM - 1,
+                          tsrb_peek_region(&_tsrb, regions));
+    TEST_ASSERT(regions[0].buf == &_tsrb_buffer[1]);
+    TEST_ASSERT_EQUAL_INT(0, regions[1].len);
+    TEST_ASSERT_EQUAL_INT(TEST_INPUT + TEST_DROP_NUM + 1, tsrb_get_one(&_tsrb));
+}
+
 static Test *tests_tsrb_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -228,6 +305,8 @@ static Test *tests_tsrb_tests(void)
         new_TestFixture(test_drop),
         new_TestFixture(test_add_one),
         new_TestFixture(test_add),
+        new_TestFixture(test_write_region),
+        new_TestFixture(test_peek_region),
     };
 
     EMB_UNIT_TESTCALLER(tsrb_tests, NULL, tear_down, fixtures);
@@ -150,6 +150,16 @@ static void test_vfs_null_file_ops_write(void)
     TEST_ASSERT_EQUAL_INT(-EFAULT, res);
 }
 
+static void test_vfs_null_file_ops_fadvise(void)
+{
+    TEST_ASSERT(_test_vfs_file_op_my_fd >= 0);
+    /* the hint is ignored */
+    int res = vfs_fadvise(_test_vfs_file_op_my_fd, VFS_FADV_SEQUENTIAL);
+    TEST_ASSERT_EQUAL_INT(0, res);
+    res = vfs_fadvise(_test_vfs_file_op_my_fd, (vfs_fadvise_t)42);
+    TEST_ASSERT_EQUAL_INT(-EINVAL, res);
+}
+
 Test *tests_vfs_null_file_ops_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -159,6 +169,7 @@ Test *tests_vfs_null_file_ops_tests(void)
         new_TestFixture(test_vfs_null_file_ops_fstat),
         new_TestFixture(test_vfs_null_file_ops_read),
         new_TestFixture(test_vfs_null_file_ops_write),
+        new_TestFixture(test_vfs_null_file_ops_fadvise),
     };
 
     EMB_UNIT_TESTCALLER(vfs_file_op_tests, setup, teardown, fixtures);
@@ -67,6 +67,25 @@ static vfs_mount_t _test_vfs_mount = {
     .private_data = (void *)&fs_data,
 };
 
+static const constfs_file_t _nested_files[] = {
+    {
+        .path = "/data.bin",
+        .data = str_data,
+        .size = sizeof(str_data),
+    },
+};
+
+static const constfs_t fs_nested_data = {
+    .files = _nested_files,
+    .nfiles = ARRAY_SIZE(_nested_files),
+};
+
+static vfs_mount_t _test_vfs_mount_nested = {
+    .mount_point = "/test/sub",
+    .fs = &constfs_file_system,
+    .private_data = (void *)&fs_nested_data,
+};
+
 static void test_vfs_mount_umount(void)
 {
     int res;
@@ -171,6 +190,77 @@ static void test_vfs_constfs_read_lseek(void)
     TEST_ASSERT_EQUAL_INT(0, res);
 }
 
+static void test_vfs_constfs_read_ptr(void)
+{
+    int res;
+    res = vfs_mount(&_test_vfs_mount);
+    TEST_ASSERT_EQUAL_INT(0, res);
+
+    int fd = vfs_open("/test/data.bin", O_RDONLY, 0);
+    TEST_ASSERT(fd >= 0);
+
+    const void *data;
+    ssize_t nbytes;
+    nbytes = vfs_read_ptr(fd, &data, 8);
+    TEST_ASSERT_EQUAL_INT(8, nbytes);
+    TEST_ASSERT(data == &bin_data[0]);
+
+    /* the file position is advanced */
+    nbytes = vfs_read_ptr(fd, &data, sizeof(bin_data));
+    TEST_ASSERT_EQUAL_INT(sizeof(bin_data) - 8, nbytes);
+    TEST_ASSERT(data == &bin_data[8]);
+
+    nbytes = vfs_read_ptr(fd, &data, sizeof(bin_data));
+    TEST_ASSERT_EQUAL_INT(0, nbytes);
+
+    off_t pos = vfs_lseek(fd, -2, SEEK_END);
+    TEST_ASSERT_EQUAL_INT(sizeof(bin_data) - 2, pos);
+    uint8_t buf[4];
+    nbytes = vfs_read(fd, buf, sizeof(buf));
+    TEST_ASSERT_EQUAL_INT(2, nbytes);
+    TEST_ASSERT_EQUAL_INT(0xFE, buf[0]);
+
+    TEST_ASSERT_EQUAL_INT(-EFAULT, vfs_read_ptr(fd, NULL, 1));
+
+    res = vfs_close(fd);
+    TEST_ASSERT_EQUAL_INT(0, res);
+
+    res = vfs_umount(&_test_vfs_mount);
+    TEST_ASSERT_EQUAL_INT(0, res);
+}
+
+static void test_vfs_constfs_nested_mount(void)
+{
+    int res;
+    res = vfs_mount(&_test_vfs_mount);
+    TEST_ASSERT_EQUAL_INT(0, res);
+    res = vfs_mount(&_test_vfs_mount_nested);
+    TEST_ASSERT_EQUAL_INT(0, res);
+
+    struct stat buf;
+    /* the longest matching mount point is used */
+    res = vfs_stat("/test/sub/data.bin", &buf);
+    TEST_ASSERT_EQUAL_INT(0, res);
+    TEST_ASSERT_EQUAL_INT(sizeof(str_data), buf.st_size);
+    res = vfs_stat("/test/data.bin", &buf);
+    TEST_ASSERT_EQUAL_INT(0, res);
+    TEST_ASSERT_EQUAL_INT(sizeof(bin_data), buf.st_size);
+
+    /* mount points only match whole path components */
+    res = vfs_stat("/test/subdir/data.bin", &buf);
+    TEST_ASSERT_EQUAL_INT(-ENOENT, res);
+    res = vfs_stat("/tes", &buf);
+    TEST_ASSERT_EQUAL_INT(-ENOENT, res);
+
+    res = vfs_umount(&_test_vfs_mount_nested);
+    TEST_ASSERT_EQUAL_INT(0, res);
+    res = vfs_stat("/test/sub/data.bin", &buf);
+    TEST_ASSERT_EQUAL_INT(-ENOENT, res);
+
+    res = vfs_umount(&_test_vfs_mount);
+    TEST_ASSERT_EQUAL_INT(0, res);
+}
+
 #if MODULE_NEWLIB || MODULE_PICOLIBC || defined(BOARD_NATIVE)
 static void test_vfs_constfs__posix(void)
 {
@@ -210,6 +300,8 @@ Test *tests_vfs_mount_constfs_tests(void)
         new_TestFixture(test_vfs_umount__invalid_mount),
         new_TestFixture(test_vfs_constfs_open),
         new_TestFixture(test_vfs_constfs_read_lseek),
+        new_TestFixture(test_vfs_constfs_read_ptr),
+        new_TestFixture(test_vfs_constfs_nested_mount),
 #if MODULE_NEWLIB || MODULE_PICOLIBC || defined(BOARD_NATIVE)
         new_TestFixture(test_vfs_constfs__posix),
 #endif
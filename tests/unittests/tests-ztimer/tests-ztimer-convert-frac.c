@@ -0,0 +1,153 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ * @brief       Unittests for ztimer_convert_frac
+ */
+
+#include "frac.h"
+#include "kernel_defines.h"
+#include "ztimer.h"
+#include "ztimer/mock.h"
+#include "ztimer/convert_frac.h"
+
+#include "embUnit/embUnit.h"
+
+#include "tests-ztimer.h"
+
+static void test_ztimer_convert_frac_now_helper(uint32_t freq_self,
+                                                uint32_t freq_lower)
+{
+    ztimer_mock_t zmock;
+    ztimer_convert_frac_t zc;
+    ztimer_clock_t *z = &zc.super.super;
+
+    ztimer_mock_init(&zmock, 32);
+    ztimer_convert_frac_init(&zc, &zmock.super, freq_self, freq_lower);
+
+    uint32_t last = 0;
+    for (uint32_t i = 0; i <= 0xfffff; i++) {
+        uint32_t now = ztimer_now(z);
+        uint64_t should = (uint64_t)i * freq_self / freq_lower;
+
+        TEST_ASSERT(now >= last);
+        TEST_ASSERT_EQUAL_INT(should, now);
+        ztimer_mock_advance(&zmock, 1);
+        last = now;
+    }
+}
+
+/**
+ * @brief   now() is exact for power of two denominators
+ */
+static void test_ztimer_convert_frac_now_pow2(void)
+{
+    /* 1 MHz from 32768 Hz */
+    test_ztimer_convert_frac_now_helper(1000000LU, 32768LU);
+    /* 1 kHz from 1024 Hz */
+    test_ztimer_convert_frac_now_helper(1000LU, 1024LU);
+}
+
+/**
+ * @brief   now() is exact for power of two denominators up to the wrap
+ *          around of the lower clock
+ */
+static void test_ztimer_convert_frac_now_pow2_large(void)
+{
+    static const uint32_t lower[] = {
+        0x7fffffffLU, 0x80000000LU, 0xdeadbeefLU, 0xfffffdffLU, 0xffffffffLU,
+    };
+    ztimer_mock_t zmock;
+    ztimer_convert_frac_t zc;
+    ztimer_clock_t *z = &zc.super.super;
+
+    ztimer_mock_init(&zmock, 32);
+    ztimer_convert_frac_init(&zc, &zmock.super, 1000000LU, 32768LU);
+
+    for (unsigned i = 0; i < ARRAY_SIZE(lower); i++) {
+        ztimer_mock_jump(&zmock, lower[i]);
+        uint32_t should = (uint64_t)lower[i] * 15625 / 512;
+        TEST_ASSERT_EQUAL_INT(should, ztimer_now(z));
+    }
+}
+
+/**
+ * @brief   now() is monotonic for other ratios
+ */
+static void test_ztimer_convert_frac_now_generic(void)
+{
+    ztimer_mock_t zmock;
+    ztimer_convert_frac_t zc;
+    ztimer_clock_t *z = &zc.super.super;
+
+    ztimer_mock_init(&zmock, 32);
+    /* 1 MHz from 3 MHz */
+    ztimer_convert_frac_init(&zc, &zmock.super, 1000000LU, 3000000LU);
+
+    uint32_t last = 0;
+    for (uint32_t i = 0; i <= 0xfffff; i++) {
+        uint32_t now = ztimer_now(z);
+        uint32_t should = (uint64_t)i / 3;
+
+        TEST_ASSERT(now >= last);
+        TEST_ASSERT(now + 1 >= should && now <= should + 1);
+        ztimer_mock_advance(&zmock, 1);
+        last = now;
+    }
+}
+
+static void _set_cb(void *arg)
+{
+    unsigned *val = arg;
+    *val = 1;
+}
+
+/**
+ * @brief   set() programs the lower clock as frac does
+ */
+static void test_ztimer_convert_frac_set(void)
+{
+    static const uint32_t vals[] = {
+        1, 1000, 123456LU, 0x7fffffffLU, 0xfffe0000LU,
+    };
+    ztimer_mock_t zmock;
+    ztimer_convert_frac_t zc;
+    ztimer_clock_t *z = &zc.super.super;
+    unsigned fired = 0;
+
+    ztimer_mock_init(&zmock, 32);
+    ztimer_convert_frac_init(&zc, &zmock.super, 1000000LU, 32768LU);
+
+    for (unsigned i = 0; i < ARRAY_SIZE(vals); i++) {
+        ztimer_t t = { .callback = _set_cb, .arg = &fired };
+        ztimer_set(z, &t, vals[i]);
+        TEST_ASSERT_EQUAL_INT(frac_scale(&zc.scale_set, vals[i] + zc.round),
+                              zmock.target);
+        ztimer_remove(z, &t);
+    }
+    TEST_ASSERT_EQUAL_INT(0, fired);
+}
+
+Test *tests_ztimer_convert_frac_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_ztimer_convert_frac_now_pow2),
+        new_TestFixture(test_ztimer_convert_frac_now_pow2_large),
+        new_TestFixture(test_ztimer_convert_frac_now_generic),
+        new_TestFixture(test_ztimer_convert_frac_set),
+    };
+
+    EMB_UNIT_TESTCALLER(ztimer_convert_frac_tests, NULL, NULL, fixtures);
+
+    return (Test *)&ztimer_convert_frac_tests;
+}
+
+/** @} */
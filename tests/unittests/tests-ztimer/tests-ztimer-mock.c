@@ -15,6 +15,7 @@
  * @author      Joakim Nohlgård <joakim.nohlgard@eistec.se>
  */
 
+#include "kernel_defines.h"
 #include "ztimer.h"
 #include "ztimer/mock.h"
 
@@ -284,6 +285,144 @@ static void test_ztimer_mock_is_set(void)
     TEST_ASSERT(!ztimer_is_set(z, &alarm2));
 }
 
+/**
+ * @brief   Testing ztimer_until_next()
+ */
+static void test_ztimer_mock_until_next(void)
+{
+    ztimer_mock_t zmock;
+    ztimer_clock_t *z = &zmock.super;
+
+    ztimer_mock_init(&zmock, 32);
+
+    uint32_t count = 0;
+    ztimer_t alarm = { .callback = cb_incr, .arg = &count, };
+    ztimer_t alarm2 = { .callback = cb_incr, .arg = &count, };
+
+    TEST_ASSERT_EQUAL_INT(UINT32_MAX, ztimer_until_next(z));
+
+    ztimer_set(z, &alarm, 1000);
+    ztimer_mock_advance(&zmock, 100);
+    TEST_ASSERT_EQUAL_INT(900, ztimer_until_next(z));
+
+    /* setting a later timer does not change the next expiry... */
+    ztimer_set(z, &alarm2, 2000);
+    TEST_ASSERT_EQUAL_INT(900, ztimer_until_next(z));
+
+    /* ... but removing the earlier one does */
+    ztimer_remove(z, &alarm);
+    TEST_ASSERT_EQUAL_INT(2000, ztimer_until_next(z));
+
+    ztimer_mock_advance(&zmock, 1500);
+    TEST_ASSERT_EQUAL_INT(500, ztimer_until_next(z));
+
+    ztimer_mock_advance(&zmock, 500);
+    TEST_ASSERT_EQUAL_INT(1, count);
+    TEST_ASSERT_EQUAL_INT(UINT32_MAX, ztimer_until_next(z));
+}
+
+/**
+ * @brief   Records the order in which the timers of
+ *          test_ztimer_mock_many_timers() trigger
+ */
+static uint8_t _fired[16];
+static unsigned _fired_numof;
+
+static void cb_record(void *arg)
+{
+    _fired[_fired_numof++] = (uintptr_t)arg;
+}
+
+/**
+ * @brief   Testing trigger order with many timers being set and removed
+ */
+static void test_ztimer_mock_many_timers(void)
+{
+    static const uint32_t offsets[] = {
+        700, 100, 1500, 300, 350, 900, 50, 1200,
+        800, 400, 1000, 60, 2000, 10, 1100, 500,
+    };
+    ztimer_mock_t zmock;
+    ztimer_clock_t *z = &zmock.super;
+    ztimer_t alarms[ARRAY_SIZE(offsets)];
+
+    ztimer_mock_init(&zmock, 32);
+    _fired_numof = 0;
+
+    for (unsigned i = 0; i < ARRAY_SIZE(alarms); i++) {
+        alarms[i] = (ztimer_t){ .callback = cb_record,
+                                .arg = (void *)(uintptr_t)i };
+        ztimer_set(z, &alarms[i], offsets[i]);
+    }
+    for (unsigned i = 0; i < ARRAY_SIZE(alarms); i++) {
+        TEST_ASSERT(ztimer_is_set(z, &alarms[i]));
+    }
+
+    /* remove head, tail and some entry in between */
+    TEST_ASSERT(ztimer_remove(z, &alarms[13]));
+    TEST_ASSERT(ztimer_remove(z, &alarms[12]));
+    TEST_ASSERT(ztimer_remove(z, &alarms[5]));
+    TEST_ASSERT(!ztimer_remove(z, &alarms[5]));
+    TEST_ASSERT(!ztimer_is_set(z, &alarms[5]));
+
+    /* re-arm an entry to a later target */
+    ztimer_mock_advance(&zmock, 55);
+    TEST_ASSERT_EQUAL_INT(1, _fired_numof);
+    TEST_ASSERT_EQUAL_INT(6, _fired[0]);
+    ztimer_set(z, &alarms[1], 1245);        /* now triggers at 1300 */
+
+    ztimer_mock_advance(&zmock, 3000);
+    static const uint8_t expected[] = {
+        6, 11, 3, 4, 9, 15, 0, 8, 10, 14, 7, 1, 2
+    };
+    TEST_ASSERT_EQUAL_INT(ARRAY_SIZE(expected), _fired_numof);
+    for (unsigned i = 0; i < ARRAY_SIZE(expected); i++) {
+        TEST_ASSERT_EQUAL_INT(expected[i], _fired[i]);
+    }
+    for (unsigned i = 0; i < ARRAY_SIZE(alarms); i++) {
+        TEST_ASSERT(!ztimer_is_set(z, &alarms[i]));
+    }
+}
+
+#if MODULE_ZTIMER_SLACK && !MODULE_ZTIMER_HEAP
+/**
+ * @brief   Testing that timers with slack get triggered in batches
+ */
+static void test_ztimer_mock_slack(void)
+{
+    ztimer_mock_t zmock;
+    ztimer_clock_t *z = &zmock.super;
+
+    ztimer_mock_init(&zmock, 32);
+
+    uint32_t count = 0;
+    ztimer_t alarm_a = { .callback = cb_incr, .arg = &count, };
+    ztimer_t alarm_b = { .callback = cb_incr, .arg = &count, };
+    ztimer_t alarm_c = { .callback = cb_incr, .arg = &count, };
+    ztimer_t alarm_d = { .callback = cb_incr, .arg = &count, };
+
+    ztimer_set_slack(&alarm_a, 50);
+    ztimer_set_slack(&alarm_c, 100);
+    ztimer_set(z, &alarm_a, 100);
+    TEST_ASSERT_EQUAL_INT(150, zmock.target);
+    /* B has no slack and thus shortens the batch */
+    ztimer_set(z, &alarm_b, 120);
+    TEST_ASSERT_EQUAL_INT(120, zmock.target);
+    ztimer_set(z, &alarm_c, 130);
+    ztimer_set(z, &alarm_d, 200);
+    TEST_ASSERT_EQUAL_INT(120, zmock.target);
+
+    ztimer_mock_advance(&zmock, 119);
+    TEST_ASSERT_EQUAL_INT(0, count);
+    ztimer_mock_advance(&zmock, 1);         /* now = 120 */
+    TEST_ASSERT_EQUAL_INT(2, count);
+    ztimer_mock_advance(&zmock, 79);        /* now = 199 */
+    TEST_ASSERT_EQUAL_INT(2, count);
+    ztimer_mock_advance(&zmock, 1);         /* now = 200 */
+    TEST_ASSERT_EQUAL_INT(4, count);
+}
+#endif
+
 Test *tests_ztimer_mock_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -294,6 +433,11 @@ Test *tests_ztimer_mock_tests(void)
         new_TestFixture(test_ztimer_mock_set32),
         new_TestFixture(test_ztimer_mock_set16),
         new_TestFixture(test_ztimer_mock_is_set),
+        new_TestFixture(test_ztimer_mock_until_next),
+        new_TestFixture(test_ztimer_mock_many_timers),
+#if MODULE_ZTIMER_SLACK && !MODULE_ZTIMER_HEAP
+        new_TestFixture(test_ztimer_mock_slack),
+#endif
     };
 
     EMB_UNIT_TESTCALLER(ztimer_tests, NULL, NULL, fixtures);
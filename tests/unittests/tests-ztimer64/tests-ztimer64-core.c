@@ -238,6 +238,63 @@ static void test_ztimer64_remove_clear(void)
     TEST_ASSERT(!ztimer64_is_set(&timer));
 }
 
+static uint64_t _native_high;
+static uint32_t _native_last;
+
+/* 64bit counter with the base clock as lower half */
+static uint64_t _native_now(void)
+{
+    if (zmock.now < _native_last) {
+        _native_high += 1ULL << 32;
+    }
+    _native_last = zmock.now;
+    return _native_high | zmock.now;
+}
+
+static void test_ztimer64_native(void)
+{
+    uint32_t count = 0;
+    ztimer64_t alarm = { .callback = cb_incr, .arg = &count, };
+
+    /* replace the clock set up by setup() */
+    memset(&zmock, '\0', sizeof(ztimer_mock_t));
+    ztimer_mock_init(&zmock, 32);
+    _native_high = 0x123400000000ULL;
+    _native_last = 0;
+    ztimer_mock_jump(&zmock, 0x56789abc);
+    ztimer64_clock_init_native(z64, z, _native_now);
+
+    TEST_ASSERT_EQUAL_INT(0x123456789abcULL, ztimer64_now(z64));
+    /* the base clock is not used without timers */
+    TEST_ASSERT(!ztimer_is_set(z, &z64->base_timer));
+
+    ztimer64_set(z64, &alarm, 1000);
+    TEST_ASSERT(ztimer_is_set(z, &z64->base_timer));
+    ztimer_mock_advance(&zmock, 999);
+    TEST_ASSERT_EQUAL_INT(0, count);
+    ztimer_mock_advance(&zmock, 1);
+    TEST_ASSERT_EQUAL_INT(1, count);
+    TEST_ASSERT_EQUAL_INT(0x123456789abcULL + 1000, ztimer64_now(z64));
+    TEST_ASSERT(!ztimer_is_set(z, &z64->base_timer));
+
+    /* longer than the base clock */
+    ztimer64_set(z64, &alarm, 10000000000ULL);
+    ztimer_mock_advance(&zmock, 4000000000ul);
+    ztimer_mock_advance(&zmock, 4000000000ul);
+    ztimer_mock_advance(&zmock, 1999999999ul);
+    TEST_ASSERT_EQUAL_INT(1, count);
+    ztimer_mock_advance(&zmock, 1);
+    TEST_ASSERT_EQUAL_INT(2, count);
+    TEST_ASSERT(!ztimer_is_set(z, &z64->base_timer));
+
+    ztimer64_set(z64, &alarm, 15);
+    ztimer_mock_advance(&zmock, 14);
+    ztimer64_remove(z64, &alarm);
+    TEST_ASSERT(!ztimer_is_set(z, &z64->base_timer));
+    ztimer_mock_advance(&zmock, 1000);
+    TEST_ASSERT_EQUAL_INT(2, count);
+}
+
 Test *tests_ztimer64_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -248,6 +305,7 @@ Test *tests_ztimer64_tests(void)
         new_TestFixture(test_ztimer64_checkpoint),
         new_TestFixture(test_ztimer64_set_uninitialized),
         new_TestFixture(test_ztimer64_remove_clear),
+        new_TestFixture(test_ztimer64_native),
     };
 
     EMB_UNIT_TESTCALLER(ztimer64_tests, setup, NULL, fixtures);